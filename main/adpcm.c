@@ -0,0 +1,67 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include "adpcm.h"
+
+static const int16_t step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+int adpcm_decode_block(const uint8_t *in, size_t bytes, int16_t *out)
+{
+    if (bytes < 4) {
+        return 0;
+    }
+
+    int predictor = (int16_t)(in[0] | (in[1] << 8));
+    int index = in[2] > 88 ? 88 : in[2];
+    int n = 0;
+    out[n++] = predictor;
+
+    for (size_t i = 4; i < bytes; i++) {
+        uint8_t byte = in[i];
+        for (int half = 0; half < 2; half++) {
+            int code = half ? byte >> 4 : byte & 0x0f;
+            int step = step_table[index];
+            int diff = step >> 3;
+            if (code & 1) {
+                diff += step >> 2;
+            }
+            if (code & 2) {
+                diff += step >> 1;
+            }
+            if (code & 4) {
+                diff += step;
+            }
+            predictor += (code & 8) ? -diff : diff;
+            if (predictor > 32767) {
+                predictor = 32767;
+            } else if (predictor < -32768) {
+                predictor = -32768;
+            }
+
+            index += index_table[code];
+            if (index < 0) {
+                index = 0;
+            } else if (index > 88) {
+                index = 88;
+            }
+            out[n++] = predictor;
+        }
+    }
+    return n;
+}
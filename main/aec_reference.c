@@ -0,0 +1,469 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Playback reference for the AFE echo canceller.
+//
+// The audio engine writes every mixed block into a ring indexed by
+// microphone sample position; feed_Task reads the slot for each captured
+// sample, clears it and interleaves it as the AFE reference channel. TX and
+// RX share the I2S clock, so once a stream is placed it stays aligned: only
+// the first block after idle is positioned by time, from the block's
+// estimated playout start and the capture time of the last mic chunk, plus
+// a calibrated delay that absorbs codec, DMA and acoustic latency.
+//
+// One writer, one reader, no locks. The reader publishes the end of the
+// chunk it is about to consume and the writer drops samples before it
+// (counted as late). The position/time anchor is a seqlock.
+//
+// Calibration plays a noise burst, records mic and reference and takes the
+// cross-correlation peak as the residual misalignment. ERLE is the ratio of
+// microphone to AFE output energy over chunks where the reference is active.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "audio_engine.h"
+#include "aec_reference.h"
+
+#define AEC_MAX_DELAY           (AEC_REF_RATE * AEC_MAX_DELAY_MS / 1000)
+#define AEC_FAR_END_ENERGY      (300 * 300)     // per-sample energy, about -40 dBFS
+#define AEC_FLAG_CHUNKS         64
+#define AEC_CAL_PROBE_MS        500
+#define AEC_CAL_CAPTURE_MS      1000
+#define AEC_CAL_AMPLITUDE       6000
+#define AEC_CAL_MIN_CORR        0.1f
+#define AEC_CAL_TIMEOUT_MS      (2 * AEC_CAL_CAPTURE_MS + AEC_CAL_PROBE_MS)    // capture and probe done by then
+
+static const char *TAG = "AEC_REF";
+
+typedef enum {
+    CAL_IDLE = 0,
+    CAL_RUNNING,
+    CAL_DONE,
+    CAL_FAILED,
+} cal_state_t;
+
+static int16_t s_ring[AEC_REF_RING_SAMPLES];
+
+static _Atomic uint32_t s_read_end = 0;     // reader owns everything before this
+static uint32_t s_read_pos = 0;             // feed_Task only
+static uint32_t s_write_pos = 0;            // audio engine only
+static bool s_write_placed = false;
+static int32_t s_delay = 0;                 // samples added to the placed position
+
+// Mic sample position and its capture time, written by feed_Task
+static _Atomic uint32_t s_anchor_seq = 0;
+static uint32_t s_anchor_pos = 0;
+static int64_t s_anchor_us = 0;
+
+static struct {
+    uint32_t placed;            // streams positioned by time
+    uint32_t late;              // samples that arrived after their slot was read
+    uint32_t overflow;          // samples too far ahead for the ring
+    uint64_t far_end_samples;
+    double mic_energy;          // over far-end chunks
+    double out_energy;
+    uint64_t out_samples;
+    perf_counter_t feed_cycles;
+    perf_counter_t interleave_cycles;
+    int feed_chunk;
+} s_stats;
+
+// Far-end flag per feed chunk, looked up by the fetch side by sample position
+static uint8_t s_far_flags[AEC_FLAG_CHUNKS];
+static uint32_t s_fetch_pos = 0;
+
+static volatile cal_state_t s_cal_state = CAL_IDLE;
+static int16_t *s_cal_mic = NULL;
+static int16_t *s_cal_ref = NULL;
+static volatile uint32_t s_cal_len = 0;
+static uint32_t s_cal_cap = 0;
+static int32_t s_cal_lag = 0;
+static float s_cal_corr = 0.0f;
+
+bool aec_reference_available(void)
+{
+    return AUDIO_ENGINE_AVAILABLE;
+}
+
+esp_err_t aec_reference_init(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(AEC_NVS_NS, NVS_READONLY, &nvs_handle) == ESP_OK) {
+        int32_t delay;
+        if (nvs_get_i32(nvs_handle, "delay", &delay) == ESP_OK && delay >= -AEC_MAX_DELAY && delay <= AEC_MAX_DELAY) {
+            s_delay = delay;
+        }
+        nvs_close(nvs_handle);
+    }
+    ESP_LOGI(TAG, "AEC reference %s, delay %ld samples", aec_reference_available() ? "available" : "unavailable",
+             (long)s_delay);
+    return ESP_OK;
+}
+
+static void aec_reference_save_delay(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(AEC_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_i32(nvs_handle, "delay", s_delay);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving AEC delay: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static bool aec_reference_anchor(uint32_t *pos, int64_t *us)
+{
+    uint32_t seq;
+    do {
+        seq = atomic_load_explicit(&s_anchor_seq, memory_order_acquire);
+        *pos = s_anchor_pos;
+        *us = s_anchor_us;
+    } while ((seq & 1) || seq != atomic_load_explicit(&s_anchor_seq, memory_order_acquire));
+    return *us != 0;
+}
+
+void aec_reference_write(const int16_t *pcm, int samples, int64_t play_us, bool continuous)
+{
+    if (!continuous || !s_write_placed) {
+        uint32_t pos;
+        int64_t us;
+        if (!aec_reference_anchor(&pos, &us)) {
+            return;         // feed_Task not running yet
+        }
+        s_write_pos = pos + (int32_t)((play_us - us) * AEC_REF_RATE / 1000000) + s_delay;
+        s_write_placed = true;
+        s_stats.placed++;
+    }
+
+    uint32_t read_end = atomic_load_explicit(&s_read_end, memory_order_acquire);
+    for (int i = 0; i < samples; i++) {
+        int32_t ahead = (int32_t)(s_write_pos + i - read_end);
+        if (ahead < 0) {
+            s_stats.late++;
+        } else if (ahead >= AEC_REF_RING_SAMPLES) {
+            s_stats.overflow++;
+        } else {
+            s_ring[(s_write_pos + i) & (AEC_REF_RING_SAMPLES - 1)] = pcm[i];
+        }
+    }
+    s_write_pos += samples;
+}
+
+void aec_reference_feed(const int16_t *board, int board_channels, int16_t *afe_in, int mics, int total,
+                        int samples)
+{
+    uint32_t start = esp_cpu_get_cycle_count();
+    uint32_t pos = s_read_pos;
+    atomic_store_explicit(&s_read_end, pos + samples, memory_order_release);
+
+    // esp_get_feed_data just returned, so the chunk started one chunk ago
+    atomic_fetch_add_explicit(&s_anchor_seq, 1, memory_order_acq_rel);
+    s_anchor_pos = pos;
+    s_anchor_us = esp_timer_get_time() - (int64_t)samples * 1000000 / AEC_REF_RATE;
+    atomic_fetch_add_explicit(&s_anchor_seq, 1, memory_order_release);
+
+    bool capture = s_cal_state == CAL_RUNNING;
+    int64_t mic_energy = 0;
+    int64_t ref_energy = 0;
+    for (int i = 0; i < samples; i++) {
+        int16_t *slot = &s_ring[(pos + i) & (AEC_REF_RING_SAMPLES - 1)];
+        int16_t ref = *slot;
+        *slot = 0;
+        const int16_t *in = board + i * board_channels;
+        int16_t *out = afe_in + i * total;
+        for (int c = 0; c < mics; c++) {
+            out[c] = in[c];
+        }
+        for (int c = mics; c < total; c++) {
+            out[c] = ref;
+        }
+        mic_energy += (int32_t)in[0] * in[0];
+        ref_energy += (int32_t)ref * ref;
+        if (capture && s_cal_len < s_cal_cap) {
+            s_cal_mic[s_cal_len] = in[0];
+            s_cal_ref[s_cal_len] = ref;
+            s_cal_len++;
+        }
+    }
+    s_read_pos = pos + samples;
+
+    bool far_end = ref_energy > (int64_t)AEC_FAR_END_ENERGY * samples;
+    s_stats.feed_chunk = samples;
+    s_far_flags[(pos / samples) % AEC_FLAG_CHUNKS] = far_end;
+    if (far_end) {
+        s_stats.mic_energy += mic_energy;
+        s_stats.far_end_samples += samples;
+    }
+    perf_counter_add(&s_stats.interleave_cycles, esp_cpu_get_cycle_count() - start);
+}
+
+void aec_reference_record_feed(uint32_t cycles, int samples)
+{
+    perf_counter_add(&s_stats.feed_cycles, cycles);
+}
+
+void aec_reference_resync(void)
+{
+    s_fetch_pos = s_read_pos;
+}
+
+void aec_reference_fetched(const int16_t *out, int samples)
+{
+    int chunk = s_stats.feed_chunk;
+    if (chunk == 0) {
+        return;
+    }
+    if (s_far_flags[(s_fetch_pos / chunk) % AEC_FLAG_CHUNKS]) {
+        int64_t energy = 0;
+        for (int i = 0; i < samples; i++) {
+            energy += (int32_t)out[i] * out[i];
+        }
+        s_stats.out_energy += energy;
+        s_stats.out_samples += samples;
+    }
+    s_fetch_pos += samples;
+}
+
+static float aec_reference_erle_db(void)
+{
+    if (s_stats.far_end_samples == 0 || s_stats.out_samples == 0) {
+        return 0.0f;
+    }
+    double mic = s_stats.mic_energy / s_stats.far_end_samples;
+    double out = s_stats.out_energy / s_stats.out_samples;
+    return out > 0.0 ? 10.0f * log10f((float)(mic / out)) : 0.0f;
+}
+
+// Lag (in samples) where the mic best matches the reference; positive when
+// the echo arrives later than the reference is fed
+static int32_t aec_reference_correlate(const int16_t *mic, const int16_t *ref, int len, float *corr)
+{
+    double ref_energy = 0.0;
+    double mic_energy = 0.0;
+    for (int i = 0; i < len; i++) {
+        ref_energy += (double)ref[i] * ref[i];
+        mic_energy += (double)mic[i] * mic[i];
+    }
+
+    int64_t best = 0;
+    int32_t best_lag = 0;
+    for (int32_t lag = -AEC_MAX_DELAY; lag <= AEC_MAX_DELAY; lag++) {
+        int64_t sum = 0;
+        int from = lag < 0 ? -lag : 0;
+        int to = lag > 0 ? len - lag : len;
+        for (int i = from; i < to; i++) {
+            sum += (int32_t)ref[i] * mic[i + lag];
+        }
+        if (llabs(sum) > llabs(best)) {
+            best = sum;
+            best_lag = lag;
+        }
+    }
+    *corr = (ref_energy > 0 && mic_energy > 0) ? (float)(llabs(best) / sqrt(ref_energy * mic_energy)) : 0.0f;
+    return best_lag;
+}
+
+static void aec_calibrate_task(void *arg)
+{
+    uint32_t probe_len = AEC_REF_RATE * AEC_CAL_PROBE_MS / 1000;
+    uint32_t cap = AEC_REF_RATE * AEC_CAL_CAPTURE_MS / 1000;
+    int16_t *probe = heap_caps_malloc(probe_len * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    s_cal_mic = heap_caps_malloc(cap * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    s_cal_ref = heap_caps_malloc(cap * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    if (!probe || !s_cal_mic || !s_cal_ref) {
+        ESP_LOGE(TAG, "No PSRAM for calibration");
+        s_cal_state = CAL_FAILED;
+        goto done;
+    }
+
+    // White noise: flat spectrum, sharp correlation peak
+    uint32_t seed = 0x12345678;
+    for (uint32_t i = 0; i < probe_len; i++) {
+        seed = seed * 1664525 + 1013904223;
+        probe[i] = (int16_t)((int32_t)(seed >> 16) - 32768) * AEC_CAL_AMPLITUDE / 32768;
+    }
+
+    s_cal_len = 0;
+    s_cal_cap = cap;
+    audio_play_t req = {
+        .voice = AUDIO_VOICE_ALERT,
+        .priority = 255,
+        .gain = 1.0f,
+        .duck = true,
+        .source = { .kind = AUDIO_SOURCE_PCM, .pcm = { probe, probe_len } },
+    };
+    if (audio_engine_play(&req) != ESP_OK) {
+        s_cal_state = CAL_FAILED;
+        goto done;
+    }
+    // feed_Task stops delivering frames while the bench runs, a profile is
+    // rebuilt or the models reload; give up rather than wait for good
+    int64_t deadline = esp_timer_get_time() + AEC_CAL_TIMEOUT_MS * 1000LL;
+    while (s_cal_len < cap && esp_timer_get_time() < deadline) {
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+    while (audio_engine_busy(AUDIO_VOICE_ALERT) && esp_timer_get_time() < deadline) {
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    if (s_cal_len < cap || audio_engine_busy(AUDIO_VOICE_ALERT)) {
+        ESP_LOGW(TAG, "Calibration: %lu of %lu samples captured in %d ms, delay unchanged",
+                 (unsigned long)s_cal_len, (unsigned long)cap, AEC_CAL_TIMEOUT_MS);
+        s_cal_state = CAL_FAILED;
+        goto done;
+    }
+
+    int32_t lag = aec_reference_correlate(s_cal_mic, s_cal_ref, cap, &s_cal_corr);
+    s_cal_lag = lag;
+    if (s_cal_corr < AEC_CAL_MIN_CORR) {
+        ESP_LOGW(TAG, "Calibration: no clear echo (correlation %.2f), delay unchanged", s_cal_corr);
+        s_cal_state = CAL_FAILED;
+        goto done;
+    }
+    int32_t delay = s_delay + lag;
+    s_delay = delay < -AEC_MAX_DELAY ? -AEC_MAX_DELAY : (delay > AEC_MAX_DELAY ? AEC_MAX_DELAY : delay);
+    aec_reference_save_delay();
+    ESP_LOGI(TAG, "Calibration: lag %ld samples, correlation %.2f, delay now %ld", (long)lag, s_cal_corr,
+             (long)s_delay);
+    s_cal_state = CAL_DONE;
+
+done:
+    // Stop feed_Task capturing and let a chunk in flight finish; the engine
+    // is done with the probe unless it never started
+    s_cal_cap = 0;
+    vTaskDelay(pdMS_TO_TICKS(100));
+    while (audio_engine_busy(AUDIO_VOICE_ALERT) && s_cal_state != CAL_DONE) {
+        audio_engine_stop(AUDIO_VOICE_ALERT);
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    free(probe);
+    free(s_cal_mic);
+    free(s_cal_ref);
+    s_cal_mic = NULL;
+    s_cal_ref = NULL;
+    vTaskDelete(NULL);
+}
+
+static esp_err_t aec_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[96];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        if (!json) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
+            return ESP_OK;
+        }
+        cJSON *delay = cJSON_GetObjectItem(json, "delay_ms");
+        bool calibrate = cJSON_IsTrue(cJSON_GetObjectItem(json, "calibrate"));
+        bool reset = cJSON_IsTrue(cJSON_GetObjectItem(json, "reset"));
+        cJSON_Delete(json);
+
+        if (cJSON_IsNumber(delay)) {
+            if (fabs(delay->valuedouble) > AEC_MAX_DELAY_MS) {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "delay_ms out of range");
+                return ESP_OK;
+            }
+            s_delay = (int32_t)(delay->valuedouble * AEC_REF_RATE / 1000);
+            aec_reference_save_delay();
+        }
+        if (reset) {
+            s_stats.mic_energy = 0;
+            s_stats.out_energy = 0;
+            s_stats.far_end_samples = 0;
+            s_stats.out_samples = 0;
+            perf_counter_reset(&s_stats.feed_cycles);
+            perf_counter_reset(&s_stats.interleave_cycles);
+        }
+        if (calibrate) {
+            if (!aec_reference_available() || s_cal_state == CAL_RUNNING) {
+                httpd_resp_set_status(req, "409 Conflict");
+                httpd_resp_sendstr(req, "{\"error\":\"calibration not possible now\"}");
+                return ESP_OK;
+            }
+            s_cal_state = CAL_RUNNING;
+            if (xTaskCreatePinnedToCore(&aec_calibrate_task, "aec_cal", 4 * 1024, NULL, 2, NULL, 1) != pdPASS) {
+                s_cal_state = CAL_FAILED;
+                httpd_resp_send_500(req);
+                return ESP_FAIL;
+            }
+            httpd_resp_set_status(req, "202 Accepted");
+        }
+    }
+
+    static const char *cal_names[] = {"idle", "running", "done", "failed"};
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "available", aec_reference_available());
+    cJSON_AddNumberToObject(response, "delay_ms", s_delay * 1000.0 / AEC_REF_RATE);
+    cJSON_AddNumberToObject(response, "erle_db", aec_reference_erle_db());
+    cJSON_AddNumberToObject(response, "far_end_ms", (double)s_stats.far_end_samples * 1000.0 / AEC_REF_RATE);
+    cJSON_AddNumberToObject(response, "streams", s_stats.placed);
+    cJSON_AddNumberToObject(response, "late_samples", s_stats.late);
+    cJSON_AddNumberToObject(response, "overflow_samples", s_stats.overflow);
+
+    // AFE feed() runs the echo canceller; cost relative to real time
+    uint32_t chunk_us = s_stats.feed_chunk * 1000000 / AEC_REF_RATE;
+    float feed_us = perf_cycles_to_us(perf_counter_avg(&s_stats.feed_cycles));
+    cJSON_AddNumberToObject(response, "feed_us_avg", feed_us);
+    cJSON_AddNumberToObject(response, "feed_cpu_percent", chunk_us ? feed_us * 100.0f / chunk_us : 0);
+    cJSON_AddNumberToObject(response, "interleave_us_avg", perf_cycles_to_us(perf_counter_avg(&s_stats.interleave_cycles)));
+
+    cJSON *cal = cJSON_AddObjectToObject(response, "calibration");
+    cJSON_AddStringToObject(cal, "state", cal_names[s_cal_state]);
+    cJSON_AddNumberToObject(cal, "lag_ms", s_cal_lag * 1000.0 / AEC_REF_RATE);
+    cJSON_AddNumberToObject(cal, "correlation", s_cal_corr);
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t aec_reference_register_http(httpd_handle_t server)
+{
+    httpd_uri_t aec_get_uri = {
+        .uri = "/api/aec",
+        .method = HTTP_GET,
+        .handler = aec_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &aec_get_uri);
+
+    httpd_uri_t aec_post_uri = {
+        .uri = "/api/aec",
+        .method = HTTP_POST,
+        .handler = aec_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &aec_post_uri);
+}
@@ -0,0 +1,684 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Audio front-end ownership and adaptive wakenet mode.
+//
+// The AFE runs in one of two modes: FULL (the active profile, normally
+// 2-channel wakenet on the high-perf front end) and LIGHT (the "low-power"
+// profile: single-channel wakenet on the low-cost front end).
+// detect_Task reports every fetch result here; after a long quiet spell
+// (VAD silence and low volume) the AFE is recreated in LIGHT mode, and any
+// sustained speech or noise brings it back to FULL.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_afe_sr_models.h"
+#include "esp_wn_models.h"
+#include "cJSON.h"
+#include "afe_manager.h"
+#include "aec_reference.h"
+
+// Adaptive policy tuning
+#define AFE_QUIET_DB            -50.0f  // silent frames below this volume count as quiet
+#define AFE_NOISE_DB            -38.0f  // frames above this volume count as noisy
+#define AFE_QUIET_HOLD_MS       20000   // continuous quiet before dropping to LIGHT
+#define AFE_NOISE_HOLD_MS       400     // accumulated speech/noise before returning to FULL
+#define AFE_MIN_DWELL_MS        5000    // minimum time in a mode before switching again
+#define AFE_WAKE_HOLDOFF_MS     5000    // no switching right after a wake word
+#define AFE_PARK_TIMEOUT_MS     3000
+#define AFE_LOCK_TIMEOUT_MS     3000    // callers give up while the benchmark owns the AFE
+#define AFE_STATS_PERIOD_MS     60000
+#define AFE_SAMPLE_RATE         16000
+#define AFE_FEED_HISTORY        32      // feed timestamps kept for latency lookup
+
+#define FEED_PARKED_BIT   BIT0
+#define DETECT_PARKED_BIT BIT1
+
+static const char *TAG = "AFE_MGR";
+
+static const char *mode_names[AFE_MODE_COUNT] = {"full", "light"};
+
+static esp_afe_sr_iface_t *s_afe_handle = NULL;
+static esp_afe_sr_data_t *volatile s_afe_data = NULL;
+static srmodel_list_t *s_models = NULL;
+static const afe_profile_t *volatile s_profile = NULL;
+static volatile afe_run_mode_t s_mode = AFE_MODE_FULL;
+static volatile uint32_t s_generation = 0;
+static volatile bool s_pause_req = false;
+static volatile bool s_adaptive = true;
+
+static EventGroupHandle_t s_park_group = NULL;
+static SemaphoreHandle_t s_feed_resume = NULL;
+static SemaphoreHandle_t s_detect_resume = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static TaskHandle_t s_adaptive_task = NULL;
+
+static afe_mode_stats_t s_stats[AFE_MODE_COUNT];
+static int64_t s_mode_enter_us = 0;
+static int64_t s_last_wake_us = 0;
+static perf_cpu_snapshot_t s_cpu_snap;
+static uint32_t s_switches = 0;
+static uint32_t s_quiet_ms = 0;
+static uint32_t s_noise_ms = 0;
+
+// Feed timestamps by sample index, written by feed_Task and read by detect_Task
+static struct {
+    uint32_t end_sample;
+    int64_t time_us;
+} s_feed_hist[AFE_FEED_HISTORY];
+static volatile uint32_t s_feed_head = 0;
+static uint32_t s_feed_samples = 0;
+static uint32_t s_fetch_samples = 0;
+static perf_counter_t s_window_latency;
+
+static const afe_profile_t *afe_manager_profile_for(afe_run_mode_t mode)
+{
+    const afe_profile_t *light = afe_profiles_find(AFE_LIGHT_PROFILE);
+    return (mode == AFE_MODE_LIGHT && light) ? light : s_profile;
+}
+
+static bool afe_manager_lock(void)
+{
+    return xSemaphoreTake(s_lock, pdMS_TO_TICKS(AFE_LOCK_TIMEOUT_MS)) == pdTRUE;
+}
+
+void afe_manager_build_config(afe_config_t *cfg, const afe_profile_t *profile)
+{
+    afe_config_t afe_config = AFE_CONFIG_DEFAULT();
+    afe_config.memory_alloc_mode = profile->memory_alloc_mode;
+    afe_config.wakenet_init = true;
+    afe_config.aec_init = profile->aec_init;
+    afe_config.se_init = profile->se_init;
+    // The AFE frame is the profile's mics and nothing else; feed_Task packs
+    // them out of the wider board frame
+    afe_config.pcm_config.total_ch_num = profile->mic_num;
+    afe_config.pcm_config.mic_num = profile->mic_num;
+    afe_config.pcm_config.ref_num = 0;
+    afe_config.pcm_config.sample_rate = AFE_SAMPLE_RATE;
+    afe_config.wakenet_mode = profile->wakenet_mode;
+    afe_config.afe_mode = profile->afe_mode;
+    afe_config.vad_mode = profile->vad_mode;
+
+    afe_config.wakenet_model_name = esp_srmodel_filter(s_models, ESP_WN_PREFIX, NULL);
+
+    if (afe_config.aec_init) {
+        if (aec_reference_available()) {
+            // feed_Task appends the audio engine output as the reference channel
+            afe_config.pcm_config.total_ch_num = profile->mic_num + 1;
+            afe_config.pcm_config.ref_num = 1;
+        } else {
+            ESP_LOGI(TAG, "Profile %s requests AEC but this board has no playback reference", profile->name);
+            afe_config.aec_init = false;
+        }
+    }
+
+#if defined CONFIG_ESP32_S3_BOX_BOARD || defined CONFIG_ESP32_S3_EYE_BOARD
+    afe_config.aec_init = false;
+    afe_config.pcm_config.total_ch_num = 2;
+    afe_config.pcm_config.ref_num = 0;
+#if defined CONFIG_ESP32_S3_EYE_BOARD
+    afe_config.pcm_config.total_ch_num = 2;
+    afe_config.pcm_config.mic_num = 1;
+    afe_config.pcm_config.ref_num = 1;
+#endif
+#endif
+    *cfg = afe_config;
+}
+
+static esp_afe_sr_data_t *afe_manager_create(afe_run_mode_t mode, const afe_profile_t *profile,
+                                             afe_footprint_t *footprint)
+{
+    afe_config_t afe_config;
+    afe_manager_build_config(&afe_config, profile);
+
+    size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    int64_t start = esp_timer_get_time();
+    esp_afe_sr_data_t *data = s_afe_handle->create_from_config(&afe_config);
+    s_stats[mode].create_ms = (esp_timer_get_time() - start) / 1000;
+
+    if (footprint) {
+        footprint->internal_bytes = (int32_t)(internal_free - heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+        footprint->psram_bytes = (int32_t)(psram_free - heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+        footprint->create_ms = s_stats[mode].create_ms;
+    }
+    return data;
+}
+
+// Fold CPU time since the last snapshot into the current mode. Caller holds s_lock.
+static void afe_manager_account_cpu(void)
+{
+    perf_cpu_snapshot_t now;
+    perf_cpu_snapshot(&now);
+
+    afe_mode_stats_t *st = &s_stats[s_mode];
+    uint32_t elapsed = (uint32_t)(now.time_us - s_cpu_snap.time_us);
+    st->cpu_window_us += elapsed;
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        uint32_t idle = now.idle_us[core] - s_cpu_snap.idle_us[core];
+        st->busy_us[core] += (idle < elapsed) ? elapsed - idle : 0;
+    }
+    st->time_us += now.time_us - s_mode_enter_us;
+    s_mode_enter_us = now.time_us;
+    s_cpu_snap = now;
+}
+
+static float afe_manager_cpu_percent(const afe_mode_stats_t *st, int core)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    return st->cpu_window_us ? (100.0f * st->busy_us[core]) / st->cpu_window_us : 0;
+#else
+    return -1;
+#endif
+}
+
+static void afe_manager_log_stats(void)
+{
+    for (int m = 0; m < AFE_MODE_COUNT; m++) {
+        afe_mode_stats_t *st = &s_stats[m];
+        if (st->entries == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "[%s%s] %llus, cpu %.1f%%/%.1f%%, feed %lu cyc, latency %lu us, wake %lu/%lu, cmd %lu, unknown %lu, timeout %lu",
+                 mode_names[m], m == s_mode ? "*" : "", st->time_us / 1000000,
+                 afe_manager_cpu_percent(st, 0), afe_manager_cpu_percent(st, 1),
+                 (unsigned long)perf_counter_avg(&st->feed),
+                 (unsigned long)perf_counter_avg(&st->fetch_latency_us),
+                 (unsigned long)st->wake_detected, (unsigned long)st->wake_verified,
+                 (unsigned long)st->commands, (unsigned long)st->unknown, (unsigned long)st->timeouts);
+    }
+}
+
+static void afe_manager_park(EventBits_t bit, SemaphoreHandle_t resume)
+{
+    xEventGroupSetBits(s_park_group, bit);
+    xSemaphoreTake(resume, portMAX_DELAY);
+}
+
+esp_afe_sr_data_t *afe_manager_detect_checkpoint(void)
+{
+    if (s_pause_req) {
+        afe_manager_park(DETECT_PARKED_BIT, s_detect_resume);
+    }
+    return s_afe_data;
+}
+
+esp_afe_sr_data_t *afe_manager_feed_checkpoint(void)
+{
+    // Keep feeding until detect_Task has parked, otherwise its fetch() never returns
+    if (s_pause_req && (xEventGroupGetBits(s_park_group) & DETECT_PARKED_BIT)) {
+        afe_manager_park(FEED_PARKED_BIT, s_feed_resume);
+    }
+    return s_afe_data;
+}
+
+static void afe_manager_release(EventBits_t bits)
+{
+    xEventGroupClearBits(s_park_group, FEED_PARKED_BIT | DETECT_PARKED_BIT);
+    if (bits & FEED_PARKED_BIT) {
+        xSemaphoreGive(s_feed_resume);
+    }
+    if (bits & DETECT_PARKED_BIT) {
+        xSemaphoreGive(s_detect_resume);
+    }
+}
+
+// Park feed_Task and detect_Task. Caller holds s_lock.
+static bool afe_manager_pause(void)
+{
+    const EventBits_t both = FEED_PARKED_BIT | DETECT_PARKED_BIT;
+    xEventGroupClearBits(s_park_group, both);
+    s_pause_req = true;
+    EventBits_t bits = xEventGroupWaitBits(s_park_group, both, pdFALSE, pdTRUE, pdMS_TO_TICKS(AFE_PARK_TIMEOUT_MS));
+    if ((bits & both) == both) {
+        return true;
+    }
+
+    // A task may have seen the request just before we withdraw it; give it time to park
+    s_pause_req = false;
+    vTaskDelay(pdMS_TO_TICKS(50));
+    afe_manager_release(xEventGroupGetBits(s_park_group));
+    ESP_LOGW(TAG, "Speech tasks did not pause, AFE left unchanged");
+    return false;
+}
+
+static void afe_manager_resume(void)
+{
+    s_pause_req = false;
+    afe_manager_release(FEED_PARKED_BIT | DETECT_PARKED_BIT);
+}
+
+// Make data the live instance. Feed/detect must be parked; caller holds s_lock.
+static void afe_manager_install(esp_afe_sr_data_t *data, afe_run_mode_t mode, const afe_profile_t *profile)
+{
+    s_afe_data = data;
+    if (mode == AFE_MODE_FULL) {
+        s_profile = profile;
+    }
+    if (mode != s_mode) {
+        s_switches++;
+        s_stats[mode].entries++;
+    }
+    s_mode = mode;
+    s_generation++;
+    s_quiet_ms = 0;
+    s_noise_ms = 0;
+    // Sample indices restart with the new instance
+    s_feed_head = 0;
+    s_feed_samples = 0;
+    s_fetch_samples = 0;
+    // Do not charge the recreate time to the new mode
+    perf_cpu_snapshot(&s_cpu_snap);
+    s_mode_enter_us = s_cpu_snap.time_us;
+}
+
+// Destroy the running AFE and create it again for mode/profile. Caller holds s_lock.
+static esp_err_t afe_manager_recreate(afe_run_mode_t mode, const afe_profile_t *profile,
+                                      afe_footprint_t *footprint)
+{
+    if (!afe_manager_pause()) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    afe_manager_account_cpu();
+    afe_run_mode_t old_mode = s_mode;
+    const afe_profile_t *old_profile = afe_manager_profile_for(old_mode);
+    s_afe_handle->destroy(s_afe_data);
+
+    esp_err_t err = ESP_OK;
+    esp_afe_sr_data_t *data = afe_manager_create(mode, profile, footprint);
+    if (!data) {
+        ESP_LOGE(TAG, "Failed to create AFE with profile %s, restoring %s", profile->name, old_profile->name);
+        mode = old_mode;
+        profile = old_profile;
+        data = afe_manager_create(mode, profile, NULL);
+        assert(data);
+        err = ESP_FAIL;
+    }
+
+    afe_manager_install(data, mode, profile);
+    afe_manager_resume();
+
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "AFE %s -> %s, profile %s (create %lu ms)", mode_names[old_mode], mode_names[mode],
+                 profile->name, (unsigned long)s_stats[mode].create_ms);
+    }
+    return err;
+}
+
+esp_err_t afe_manager_switch(afe_run_mode_t mode)
+{
+    if (mode >= AFE_MODE_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!afe_manager_lock()) {
+        return ESP_ERR_TIMEOUT;
+    }
+    esp_err_t err = ESP_OK;
+    const afe_profile_t *profile = afe_manager_profile_for(mode);
+    if (mode != s_mode && profile != afe_manager_profile_for(s_mode)) {
+        err = afe_manager_recreate(mode, profile, NULL);
+    } else if (mode != s_mode) {
+        // Active profile already is the light one, nothing to rebuild
+        afe_manager_account_cpu();
+        s_mode = mode;
+        s_stats[mode].entries++;
+    }
+    xSemaphoreGive(s_lock);
+    return err;
+}
+
+esp_err_t afe_manager_set_profile(const afe_profile_t *profile, afe_footprint_t *footprint)
+{
+    if (!profile) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!afe_manager_lock()) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (footprint) {
+        // Left zeroed if the tasks could not be paused
+        memset(footprint, 0, sizeof(*footprint));
+    }
+    // The old instance is destroyed first, so the footprint covers only the new one
+    esp_err_t err = afe_manager_recreate(AFE_MODE_FULL, profile, footprint);
+    xSemaphoreGive(s_lock);
+    return err;
+}
+
+esp_err_t afe_manager_suspend(void)
+{
+    if (!afe_manager_lock()) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (!afe_manager_pause()) {
+        xSemaphoreGive(s_lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    afe_manager_account_cpu();
+    s_afe_handle->destroy(s_afe_data);
+    s_afe_data = NULL;
+    ESP_LOGI(TAG, "Live AFE suspended");
+    // s_lock stays taken until afe_manager_resume_live()
+    return ESP_OK;
+}
+
+void afe_manager_resume_live(void)
+{
+    const afe_profile_t *profile = afe_manager_profile_for(s_mode);
+    esp_afe_sr_data_t *data = afe_manager_create(s_mode, profile, NULL);
+    assert(data);
+    afe_manager_install(data, s_mode, profile);
+    afe_manager_resume();
+    xSemaphoreGive(s_lock);
+    ESP_LOGI(TAG, "Live AFE resumed with profile %s", profile->name);
+}
+
+static void afe_manager_request(afe_run_mode_t mode)
+{
+    if (s_adaptive_task) {
+        xTaskNotify(s_adaptive_task, mode + 1, eSetValueWithOverwrite);
+    }
+}
+
+// Time since the input sample that produced the end of this fetch was fed
+static void afe_manager_track_latency(afe_mode_stats_t *st, const afe_fetch_result_t *res, int64_t now)
+{
+    s_fetch_samples += res->data_size / sizeof(int16_t);
+
+    uint32_t head = s_feed_head;
+    uint32_t oldest = head > AFE_FEED_HISTORY ? head - AFE_FEED_HISTORY : 0;
+    for (uint32_t i = head; i > oldest; i--) {
+        uint32_t slot = (i - 1) % AFE_FEED_HISTORY;
+        uint32_t prev_end = (i - 1 > oldest) ? s_feed_hist[(i - 2) % AFE_FEED_HISTORY].end_sample : 0;
+        if (s_fetch_samples <= s_feed_hist[slot].end_sample && s_fetch_samples > prev_end) {
+            uint32_t latency = (uint32_t)(now - s_feed_hist[slot].time_us);
+            perf_counter_add(&st->fetch_latency_us, latency);
+            perf_counter_add(&s_window_latency, latency);
+            return;
+        }
+    }
+}
+
+void afe_manager_observe(const afe_fetch_result_t *res, bool listening)
+{
+    afe_mode_stats_t *st = &s_stats[s_mode];
+    st->frames++;
+
+    int64_t now = esp_timer_get_time();
+    afe_manager_track_latency(st, res, now);
+    if (res->wakeup_state == WAKENET_DETECTED) {
+        st->wake_detected++;
+        s_last_wake_us = now;
+    } else if (res->wakeup_state == WAKENET_CHANNEL_VERIFIED) {
+        st->wake_verified++;
+    }
+
+    if (!s_adaptive || listening || s_pause_req ||
+        now - s_last_wake_us < AFE_WAKE_HOLDOFF_MS * 1000LL) {
+        s_quiet_ms = 0;
+        s_noise_ms = 0;
+        return;
+    }
+
+    uint32_t frame_ms = res->data_size * 1000 / (sizeof(int16_t) * AFE_SAMPLE_RATE);
+    bool speech = res->vad_state == AFE_VAD_SPEECH;
+    bool dwell_ok = now - s_mode_enter_us >= AFE_MIN_DWELL_MS * 1000LL;
+
+    if (s_mode == AFE_MODE_FULL) {
+        if (!speech && res->data_volume < AFE_QUIET_DB) {
+            s_quiet_ms += frame_ms;
+        } else {
+            s_quiet_ms = 0;
+        }
+        if (s_quiet_ms >= AFE_QUIET_HOLD_MS && dwell_ok) {
+            s_quiet_ms = 0;
+            afe_manager_request(AFE_MODE_LIGHT);
+        }
+    } else {
+        if (speech || res->data_volume > AFE_NOISE_DB) {
+            s_noise_ms += frame_ms;
+        } else {
+            s_noise_ms = (s_noise_ms > frame_ms) ? s_noise_ms - frame_ms : 0;
+        }
+        if (s_noise_ms >= AFE_NOISE_HOLD_MS && dwell_ok) {
+            s_noise_ms = 0;
+            afe_manager_request(AFE_MODE_FULL);
+        }
+    }
+}
+
+void afe_manager_record_feed(uint32_t cycles, int samples)
+{
+    perf_counter_add(&s_stats[s_mode].feed, cycles);
+
+    s_feed_samples += samples;
+    uint32_t slot = s_feed_head % AFE_FEED_HISTORY;
+    s_feed_hist[slot].end_sample = s_feed_samples;
+    s_feed_hist[slot].time_us = esp_timer_get_time();
+    s_feed_head++;
+}
+
+void afe_manager_record_command(bool recognized)
+{
+    if (recognized) {
+        s_stats[s_mode].commands++;
+    } else {
+        s_stats[s_mode].unknown++;
+    }
+}
+
+void afe_manager_record_timeout(void)
+{
+    s_stats[s_mode].timeouts++;
+}
+
+static void afe_adaptive_task(void *arg)
+{
+    TickType_t last_log = xTaskGetTickCount();
+    while (1) {
+        uint32_t target = 0;
+        if (xTaskNotifyWait(0, UINT32_MAX, &target, pdMS_TO_TICKS(1000)) == pdTRUE && target > 0) {
+            afe_manager_switch((afe_run_mode_t)(target - 1));
+        }
+        if (xTaskGetTickCount() - last_log >= pdMS_TO_TICKS(AFE_STATS_PERIOD_MS)) {
+            if (afe_manager_lock()) {
+                afe_manager_account_cpu();
+                afe_manager_log_stats();
+                xSemaphoreGive(s_lock);
+            }
+            last_log = xTaskGetTickCount();
+        }
+    }
+}
+
+esp_err_t afe_manager_init(srmodel_list_t *models, const afe_profile_t *profile)
+{
+    s_models = models;
+    s_profile = profile;
+#if CONFIG_IDF_TARGET_ESP32
+    ESP_LOGE(TAG, "This demo only supports ESP32S3");
+    return ESP_ERR_NOT_SUPPORTED;
+#else
+    s_afe_handle = (esp_afe_sr_iface_t *)&ESP_AFE_SR_HANDLE;
+#endif
+
+    s_park_group = xEventGroupCreate();
+    s_feed_resume = xSemaphoreCreateBinary();
+    s_detect_resume = xSemaphoreCreateBinary();
+    s_lock = xSemaphoreCreateMutex();
+
+    s_mode = AFE_MODE_FULL;
+    s_afe_data = afe_manager_create(s_mode, s_profile, NULL);
+    if (!s_afe_data) {
+        ESP_LOGE(TAG, "Failed to create AFE");
+        return ESP_FAIL;
+    }
+    s_stats[s_mode].entries = 1;
+    perf_cpu_snapshot(&s_cpu_snap);
+    s_mode_enter_us = s_cpu_snap.time_us;
+
+    xTaskCreatePinnedToCore(&afe_adaptive_task, "afe_adaptive", 4 * 1024, NULL, 2, &s_adaptive_task, 1);
+    ESP_LOGI(TAG, "AFE created with profile %s (adaptive %s)", s_profile->name, s_adaptive ? "on" : "off");
+    return ESP_OK;
+}
+
+esp_afe_sr_iface_t *afe_manager_handle(void)
+{
+    return s_afe_handle;
+}
+
+uint32_t afe_manager_generation(void)
+{
+    return s_generation;
+}
+
+afe_run_mode_t afe_manager_mode(void)
+{
+    return s_mode;
+}
+
+bool afe_manager_adaptive(void)
+{
+    return s_adaptive;
+}
+
+void afe_manager_set_adaptive(bool enable)
+{
+    s_adaptive = enable;
+    if (!enable) {
+        afe_manager_request(AFE_MODE_FULL);
+    }
+}
+
+void afe_manager_get_stats(afe_run_mode_t mode, afe_mode_stats_t *out)
+{
+    if (afe_manager_lock()) {
+        afe_manager_account_cpu();
+        *out = s_stats[mode];
+        xSemaphoreGive(s_lock);
+    } else {
+        *out = s_stats[mode];
+    }
+}
+
+void afe_manager_reset_window(void)
+{
+    perf_counter_reset(&s_window_latency);
+}
+
+void afe_manager_window_latency(perf_counter_t *out)
+{
+    *out = s_window_latency;
+}
+
+static esp_err_t afe_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[128];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        if (json) {
+            cJSON *adaptive = cJSON_GetObjectItem(json, "adaptive");
+            cJSON *mode = cJSON_GetObjectItem(json, "mode");
+            if (adaptive) {
+                afe_manager_set_adaptive(cJSON_IsTrue(adaptive));
+            }
+            if (mode && cJSON_IsString(mode)) {
+                for (int m = 0; m < AFE_MODE_COUNT; m++) {
+                    if (strcmp(mode->valuestring, mode_names[m]) == 0) {
+                        afe_manager_request((afe_run_mode_t)m);
+                    }
+                }
+            }
+            cJSON_Delete(json);
+        }
+    }
+
+    if (!s_lock) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "AFE not started");
+        return ESP_FAIL;
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddStringToObject(response, "mode", mode_names[s_mode]);
+    cJSON_AddStringToObject(response, "profile", afe_manager_profile_for(s_mode)->name);
+    cJSON_AddBoolToObject(response, "adaptive", s_adaptive);
+    cJSON_AddNumberToObject(response, "switches", s_switches);
+
+    cJSON *modes = cJSON_AddArrayToObject(response, "modes");
+    for (int m = 0; m < AFE_MODE_COUNT; m++) {
+        afe_mode_stats_t st;
+        afe_manager_get_stats((afe_run_mode_t)m, &st);
+        float hours = st.time_us / 3600e6f;
+
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", mode_names[m]);
+        cJSON_AddNumberToObject(item, "time_s", (double)(st.time_us / 1000000));
+        cJSON_AddNumberToObject(item, "entries", st.entries);
+        cJSON_AddNumberToObject(item, "frames", st.frames);
+        cJSON_AddNumberToObject(item, "create_ms", st.create_ms);
+        cJSON *cpu = cJSON_AddArrayToObject(item, "cpu_percent");
+        for (int core = 0; core < portNUM_PROCESSORS; core++) {
+            cJSON_AddItemToArray(cpu, cJSON_CreateNumber(afe_manager_cpu_percent(&st, core)));
+        }
+        cJSON_AddNumberToObject(item, "feed_cycles_avg", perf_counter_avg(&st.feed));
+        cJSON_AddNumberToObject(item, "feed_cycles_max", st.feed.max);
+        cJSON_AddNumberToObject(item, "fetch_latency_avg_us", perf_counter_avg(&st.fetch_latency_us));
+        cJSON_AddNumberToObject(item, "fetch_latency_max_us", st.fetch_latency_us.max);
+        cJSON_AddNumberToObject(item, "wake_detected", st.wake_detected);
+        cJSON_AddNumberToObject(item, "wake_verified", st.wake_verified);
+        cJSON_AddNumberToObject(item, "commands", st.commands);
+        cJSON_AddNumberToObject(item, "unknown", st.unknown);
+        cJSON_AddNumberToObject(item, "timeouts", st.timeouts);
+        cJSON_AddNumberToObject(item, "wakes_per_hour", hours > 0 ? st.wake_detected / hours : 0);
+        cJSON_AddItemToArray(modes, item);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t afe_manager_register_http(httpd_handle_t server)
+{
+    httpd_uri_t afe_get_uri = {
+        .uri = "/api/afe",
+        .method = HTTP_GET,
+        .handler = afe_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &afe_get_uri);
+
+    httpd_uri_t afe_post_uri = {
+        .uri = "/api/afe",
+        .method = HTTP_POST,
+        .handler = afe_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &afe_post_uri);
+}
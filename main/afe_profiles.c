@@ -0,0 +1,438 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Named AFE profiles stored in NVS, selectable over HTTP, with a built-in
+// benchmark that runs every profile on the live microphone feed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_board_init.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "afe_profiles.h"
+#include "afe_manager.h"
+#include "perf_monitor.h"
+
+#define AFE_PROFILES_NVS_NS      "afe"
+#define AFE_PROFILES_VERSION     1
+#define AFE_BENCH_WARMUP_MS      2000
+#define AFE_BENCH_DEFAULT_S      10
+#define AFE_BENCH_MAX_S          120
+
+static const char *TAG = "AFE_PROFILES";
+
+typedef struct {
+    uint16_t version;
+    uint16_t count;
+    afe_profile_t profiles[AFE_MAX_PROFILES];
+} afe_profile_table_t;
+
+static const afe_profile_t default_profiles[] = {
+    {"low-power", AFE_MEMORY_ALLOC_MORE_PSRAM, SR_MODE_LOW_COST, DET_MODE_90, VAD_MODE_3, false, true, 2},
+    {"balanced", AFE_MEMORY_ALLOC_INTERNAL_PSRAM_BALANCE, SR_MODE_HIGH_PERF, DET_MODE_2CH_90, VAD_MODE_3, false, true, 2},
+    {"far-field", AFE_MEMORY_ALLOC_MORE_PSRAM, SR_MODE_HIGH_PERF, DET_MODE_2CH_95, VAD_MODE_4, true, true, 2},
+};
+
+#define DEFAULT_ACTIVE_PROFILE "far-field"
+
+static afe_profile_table_t s_table;
+static const afe_profile_t *s_active = NULL;
+static afe_profile_bench_t s_bench[AFE_MAX_PROFILES];
+static volatile bool s_bench_running = false;
+
+static const char *memory_names[] = {"", "internal", "balance", "psram"};
+static const char *afe_mode_names[] = {"low_cost", "high_perf"};
+static const char *wakenet_mode_names[] = {"1ch_90", "1ch_95", "2ch_90", "2ch_95", "3ch_90", "3ch_95"};
+
+static int name_index(const char *const *names, int count, const char *value)
+{
+    for (int i = 0; i < count; i++) {
+        if (strcmp(names[i], value) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void afe_profiles_save(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(AFE_PROFILES_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+
+    err = nvs_set_blob(nvs_handle, "profiles", &s_table, sizeof(s_table));
+    if (err == ESP_OK) {
+        err = nvs_set_str(nvs_handle, "active", s_active->name);
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving AFE profiles: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+esp_err_t afe_profiles_init(void)
+{
+    s_table.version = AFE_PROFILES_VERSION;
+    s_table.count = sizeof(default_profiles) / sizeof(default_profiles[0]);
+    memcpy(s_table.profiles, default_profiles, sizeof(default_profiles));
+    s_active = afe_profiles_find(DEFAULT_ACTIVE_PROFILE);
+
+    nvs_handle_t nvs_handle;
+    if (nvs_open(AFE_PROFILES_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        ESP_LOGI(TAG, "No saved AFE profiles, using defaults");
+        return ESP_OK;
+    }
+
+    afe_profile_table_t saved;
+    size_t required_size = sizeof(saved);
+    esp_err_t err = nvs_get_blob(nvs_handle, "profiles", &saved, &required_size);
+    if (err == ESP_OK && required_size == sizeof(saved) && saved.version == AFE_PROFILES_VERSION &&
+        saved.count > 0 && saved.count <= AFE_MAX_PROFILES) {
+        s_table = saved;
+    } else if (err != ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGW(TAG, "Invalid saved AFE profiles, using defaults");
+    }
+
+    char active[AFE_PROFILE_NAME_LEN];
+    required_size = sizeof(active);
+    if (nvs_get_str(nvs_handle, "active", active, &required_size) == ESP_OK && afe_profiles_find(active)) {
+        s_active = afe_profiles_find(active);
+    } else {
+        s_active = afe_profiles_find(DEFAULT_ACTIVE_PROFILE);
+    }
+    if (!s_active) {
+        s_active = &s_table.profiles[0];
+    }
+    nvs_close(nvs_handle);
+
+    ESP_LOGI(TAG, "%d AFE profiles loaded, active: %s", s_table.count, s_active->name);
+    return ESP_OK;
+}
+
+const afe_profile_t *afe_profiles_active(void)
+{
+    return s_active;
+}
+
+const afe_profile_t *afe_profiles_find(const char *name)
+{
+    for (int i = 0; i < s_table.count; i++) {
+        if (strcmp(s_table.profiles[i].name, name) == 0) {
+            return &s_table.profiles[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t afe_profiles_select(const char *name)
+{
+    const afe_profile_t *profile = afe_profiles_find(name);
+    if (!profile) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (s_bench_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t err = afe_manager_set_profile(profile, NULL);
+    if (err == ESP_OK) {
+        s_active = profile;
+        afe_profiles_save();
+        ESP_LOGI(TAG, "Active AFE profile: %s", profile->name);
+    }
+    return err;
+}
+
+// Add a new profile or replace an existing one with the same name
+static esp_err_t afe_profiles_put(const afe_profile_t *profile)
+{
+    // The benchmark walks the table and swaps profiles in and out
+    if (s_bench_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    afe_profile_t *slot = (afe_profile_t *)afe_profiles_find(profile->name);
+    if (!slot) {
+        if (s_table.count >= AFE_MAX_PROFILES) {
+            return ESP_ERR_NO_MEM;
+        }
+        slot = &s_table.profiles[s_table.count++];
+    }
+    *slot = *profile;
+
+    esp_err_t err = ESP_OK;
+    if (slot == s_active) {
+        err = afe_manager_set_profile(slot, NULL);
+    }
+    afe_profiles_save();
+    return err;
+}
+
+static void afe_bench_task(void *arg)
+{
+    uint32_t seconds = (uint32_t)arg;
+    bool adaptive = afe_manager_adaptive();
+    const afe_profile_t *original = s_active;
+
+    afe_manager_set_adaptive(false);
+    ESP_LOGI(TAG, "Benchmarking %d AFE profiles, %lu s each", s_table.count, (unsigned long)seconds);
+
+    for (int i = 0; i < s_table.count; i++) {
+        afe_profile_bench_t *bench = &s_bench[i];
+        afe_footprint_t footprint;
+        memset(bench, 0, sizeof(*bench));
+
+        if (afe_manager_set_profile(&s_table.profiles[i], &footprint) != ESP_OK) {
+            ESP_LOGW(TAG, "Profile %s could not be applied", s_table.profiles[i].name);
+            continue;
+        }
+        vTaskDelay(pdMS_TO_TICKS(AFE_BENCH_WARMUP_MS));
+
+        perf_cpu_snapshot_t from, to;
+        perf_counter_t latency;
+        afe_manager_reset_window();
+        perf_cpu_snapshot(&from);
+        vTaskDelay(pdMS_TO_TICKS(seconds * 1000));
+        perf_cpu_snapshot(&to);
+        afe_manager_window_latency(&latency);
+
+        perf_cpu_load(&from, &to, bench->cpu_percent);
+        bench->internal_bytes = footprint.internal_bytes;
+        bench->psram_bytes = footprint.psram_bytes;
+        bench->create_ms = footprint.create_ms;
+        bench->latency_avg_us = perf_counter_avg(&latency);
+        bench->latency_max_us = latency.max;
+        bench->frames = latency.count;
+        bench->valid = true;
+
+        ESP_LOGI(TAG, "[%s] cpu %.1f%%/%.1f%%, internal %ld B, psram %ld B, create %lu ms, latency avg %lu us max %lu us",
+                 s_table.profiles[i].name, bench->cpu_percent[0], bench->cpu_percent[1],
+                 (long)bench->internal_bytes, (long)bench->psram_bytes, (unsigned long)bench->create_ms,
+                 (unsigned long)bench->latency_avg_us, (unsigned long)bench->latency_max_us);
+    }
+
+    afe_manager_set_profile(original, NULL);
+    afe_manager_set_adaptive(adaptive);
+    s_bench_running = false;
+    ESP_LOGI(TAG, "AFE benchmark finished, restored profile %s", original->name);
+    vTaskDelete(NULL);
+}
+
+static bool afe_profile_from_json(cJSON *json, afe_profile_t *profile)
+{
+    cJSON *name = cJSON_GetObjectItem(json, "name");
+    if (!cJSON_IsString(name) || strlen(name->valuestring) == 0 ||
+        strlen(name->valuestring) >= AFE_PROFILE_NAME_LEN) {
+        return false;
+    }
+
+    // Start from the existing definition so partial updates work
+    const afe_profile_t *existing = afe_profiles_find(name->valuestring);
+    *profile = existing ? *existing : *afe_profiles_find(DEFAULT_ACTIVE_PROFILE);
+    strcpy(profile->name, name->valuestring);
+
+    cJSON *item = cJSON_GetObjectItem(json, "memory");
+    if (cJSON_IsString(item)) {
+        int idx = name_index(memory_names, 4, item->valuestring);
+        if (idx <= 0) {
+            return false;
+        }
+        profile->memory_alloc_mode = (afe_memory_alloc_mode_t)idx;
+    }
+    item = cJSON_GetObjectItem(json, "afe_mode");
+    if (cJSON_IsString(item)) {
+        int idx = name_index(afe_mode_names, 2, item->valuestring);
+        if (idx < 0) {
+            return false;
+        }
+        profile->afe_mode = (afe_sr_mode_t)idx;
+    }
+    item = cJSON_GetObjectItem(json, "wakenet_mode");
+    if (cJSON_IsString(item)) {
+        int idx = name_index(wakenet_mode_names, 6, item->valuestring);
+        if (idx < 0) {
+            return false;
+        }
+        profile->wakenet_mode = (det_mode_t)idx;
+    }
+    item = cJSON_GetObjectItem(json, "vad_mode");
+    if (cJSON_IsNumber(item)) {
+        if (item->valueint < VAD_MODE_0 || item->valueint > VAD_MODE_4) {
+            return false;
+        }
+        profile->vad_mode = (vad_mode_t)item->valueint;
+    }
+    item = cJSON_GetObjectItem(json, "aec");
+    if (item) {
+        profile->aec_init = cJSON_IsTrue(item);
+    }
+    item = cJSON_GetObjectItem(json, "se");
+    if (item) {
+        profile->se_init = cJSON_IsTrue(item);
+    }
+    item = cJSON_GetObjectItem(json, "mic_num");
+    if (cJSON_IsNumber(item)) {
+        // total_ch_num and ref_num follow from it, see afe_manager_build_config()
+        if (item->valueint < 1 || item->valueint > 2 || item->valueint > esp_get_feed_channel()) {
+            return false;
+        }
+        profile->mic_num = item->valueint;
+    }
+    return true;
+}
+
+static esp_err_t profiles_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[512];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        esp_err_t err = ESP_OK;
+        cJSON *json = cJSON_Parse(buf);
+        if (json) {
+            cJSON *profile = cJSON_GetObjectItem(json, "profile");
+            cJSON *active = cJSON_GetObjectItem(json, "active");
+            if (profile) {
+                afe_profile_t parsed;
+                err = afe_profile_from_json(profile, &parsed) ? afe_profiles_put(&parsed) : ESP_ERR_INVALID_ARG;
+            }
+            if (err == ESP_OK && cJSON_IsString(active)) {
+                err = afe_profiles_select(active->valuestring);
+            }
+            cJSON_Delete(json);
+        } else {
+            err = ESP_ERR_INVALID_ARG;
+        }
+
+        if (err == ESP_ERR_INVALID_STATE) {
+            httpd_resp_set_type(req, "application/json");
+            httpd_resp_set_status(req, "409 Conflict");
+            httpd_resp_sendstr(req, "{\"status\":\"busy\"}");
+            return ESP_OK;
+        }
+        if (err != ESP_OK) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, esp_err_to_name(err));
+            return ESP_OK;
+        }
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddStringToObject(response, "active", s_active->name);
+    cJSON_AddBoolToObject(response, "benchmark_running", s_bench_running);
+
+    cJSON *profiles = cJSON_AddArrayToObject(response, "profiles");
+    for (int i = 0; i < s_table.count; i++) {
+        const afe_profile_t *p = &s_table.profiles[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", p->name);
+        cJSON_AddStringToObject(item, "memory", memory_names[p->memory_alloc_mode]);
+        cJSON_AddStringToObject(item, "afe_mode", afe_mode_names[p->afe_mode]);
+        cJSON_AddStringToObject(item, "wakenet_mode", wakenet_mode_names[p->wakenet_mode]);
+        cJSON_AddNumberToObject(item, "vad_mode", p->vad_mode);
+        cJSON_AddBoolToObject(item, "aec", p->aec_init);
+        cJSON_AddBoolToObject(item, "se", p->se_init);
+        cJSON_AddNumberToObject(item, "mic_num", p->mic_num);
+
+        const afe_profile_bench_t *b = &s_bench[i];
+        if (b->valid) {
+            cJSON *bench = cJSON_AddObjectToObject(item, "benchmark");
+            cJSON *cpu = cJSON_AddArrayToObject(bench, "cpu_percent");
+            for (int core = 0; core < portNUM_PROCESSORS; core++) {
+                cJSON_AddItemToArray(cpu, cJSON_CreateNumber(b->cpu_percent[core]));
+            }
+            cJSON_AddNumberToObject(bench, "internal_bytes", b->internal_bytes);
+            cJSON_AddNumberToObject(bench, "psram_bytes", b->psram_bytes);
+            cJSON_AddNumberToObject(bench, "create_ms", b->create_ms);
+            cJSON_AddNumberToObject(bench, "fetch_latency_avg_us", b->latency_avg_us);
+            cJSON_AddNumberToObject(bench, "fetch_latency_max_us", b->latency_max_us);
+            cJSON_AddNumberToObject(bench, "frames", b->frames);
+        }
+        cJSON_AddItemToArray(profiles, item);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+static esp_err_t benchmark_api_handler(httpd_req_t *req)
+{
+    uint32_t seconds = AFE_BENCH_DEFAULT_S;
+    char buf[64];
+    int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+    if (ret > 0) {
+        buf[ret] = '\0';
+        cJSON *json = cJSON_Parse(buf);
+        cJSON *item = json ? cJSON_GetObjectItem(json, "seconds") : NULL;
+        if (cJSON_IsNumber(item) && item->valueint > 0 && item->valueint <= AFE_BENCH_MAX_S) {
+            seconds = item->valueint;
+        }
+        cJSON_Delete(json);
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    if (s_bench_running) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_sendstr(req, "{\"status\":\"busy\"}");
+        return ESP_OK;
+    }
+
+    s_bench_running = true;
+    if (xTaskCreatePinnedToCore(&afe_bench_task, "afe_bench", 4 * 1024, (void *)seconds, 2, NULL, 1) != pdPASS) {
+        s_bench_running = false;
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    httpd_resp_set_status(req, "202 Accepted");
+    httpd_resp_sendstr(req, "{\"status\":\"started\"}");
+    return ESP_OK;
+}
+
+esp_err_t afe_profiles_register_http(httpd_handle_t server)
+{
+    httpd_uri_t profiles_get_uri = {
+        .uri = "/api/afe/profiles",
+        .method = HTTP_GET,
+        .handler = profiles_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &profiles_get_uri);
+
+    httpd_uri_t profiles_post_uri = {
+        .uri = "/api/afe/profiles",
+        .method = HTTP_POST,
+        .handler = profiles_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &profiles_post_uri);
+
+    httpd_uri_t benchmark_uri = {
+        .uri = "/api/afe/benchmark",
+        .method = HTTP_POST,
+        .handler = benchmark_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &benchmark_uri);
+}
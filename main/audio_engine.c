@@ -0,0 +1,434 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Audio output engine.
+//
+// One task owns the speaker. Requests arrive on a queue, so callers never
+// block on playback. Every AUDIO_ENGINE_BLOCK_MS the task pulls a block from
+// each active voice, applies the per-voice gain ramp (fade-in, fade-out on
+// stop or preemption, ducking) and writes the mix to I2S. esp_audio_play
+// blocks once the DMA buffers are full, which paces the loop in real time.
+//
+// Underruns are estimated from a playout clock: every write extends it by
+// one block, and if the clock has already run out when the next block is
+// ready, the DMA went dry while a voice was playing. Time-to-first-sample
+// is measured from audio_engine_play() until the voice's first block has
+// been handed to the I2S driver. Each mixed block is also published to
+// aec_reference as the echo canceller's reference signal.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_board_init.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "prompt_pack.h"
+#include "aec_reference.h"
+#include "audio_engine.h"
+
+#define AUDIO_BLOCK_US          (AUDIO_ENGINE_BLOCK_MS * 1000)
+#define AUDIO_RAMP_STEP         (1.0f / (AUDIO_ENGINE_RATE * AUDIO_RAMP_MS / 1000))
+
+static const char *TAG = "AUDIO_ENGINE";
+
+typedef enum {
+    ENGINE_CMD_PLAY = 0,
+    ENGINE_CMD_STOP,
+} engine_cmd_type_t;
+
+typedef struct {
+    engine_cmd_type_t type;
+    int64_t enqueued_us;
+    audio_play_t play;          // voice only for ENGINE_CMD_STOP
+} engine_cmd_t;
+
+typedef struct {
+    bool active;
+    bool stopping;              // fading out, then idle or the pending request
+    bool started;               // first block has gone out
+    bool source_done;
+    uint8_t priority;
+    bool duck;
+    float gain;
+    float target;
+    int64_t enqueued_us;
+    audio_source_kind_t kind;
+    union {
+        prompt_reader_t prompt;
+        phrase_reader_t phrase;
+        tone_reader_t tone;
+        struct {
+            const int16_t *data;
+            uint32_t remaining;
+        } pcm;
+    } reader;
+    int16_t buf[PROMPT_READ_SAMPLES];
+    int buf_pos;
+    int buf_len;
+    bool has_pending;
+    engine_cmd_t pending;
+} voice_t;
+
+static QueueHandle_t s_queue = NULL;
+static voice_t s_voices[AUDIO_VOICE_COUNT];
+static int16_t s_mix[AUDIO_ENGINE_BLOCK];
+static int16_t s_voice_block[AUDIO_ENGINE_BLOCK];
+static int32_t s_acc[AUDIO_ENGINE_BLOCK];
+
+static struct {
+    uint32_t queued;
+    uint32_t queue_full;
+    uint32_t rejected;          // lower priority than what the voice plays
+    uint32_t preempted;
+    uint32_t missing;           // prompt id not in the pack, unknown tone
+    uint32_t blocks;
+    uint32_t underruns;
+    uint64_t underrun_us;
+    perf_counter_t ttfs_us;
+    perf_counter_t mix_cycles;
+} s_stats;
+
+static const char *const s_voice_names[AUDIO_VOICE_COUNT] = {"prompt", "alert"};
+
+static void voice_start(voice_t *v, const engine_cmd_t *cmd)
+{
+    const audio_play_t *req = &cmd->play;
+    if (req->source.kind == AUDIO_SOURCE_PROMPT) {
+        prompt_t prompt;
+        if (prompt_pack_find(req->source.prompt_id, &prompt) != ESP_OK) {
+            ESP_LOGW(TAG, "No prompt with id %u", req->source.prompt_id);
+            s_stats.missing++;
+            v->active = false;
+            return;
+        }
+        prompt_reader_init(&v->reader.prompt, &prompt);
+    } else if (req->source.kind == AUDIO_SOURCE_PHRASE) {
+        phrase_reader_init(&v->reader.phrase, &req->source.phrase);
+    } else if (req->source.kind == AUDIO_SOURCE_TONE) {
+        if (req->source.tone >= TONE_COUNT) {
+            s_stats.missing++;
+            v->active = false;
+            return;
+        }
+        tone_reader_init(&v->reader.tone, req->source.tone);
+    } else {
+        v->reader.pcm.data = req->source.pcm.data;
+        v->reader.pcm.remaining = req->source.pcm.samples;
+    }
+
+    v->kind = req->source.kind;
+    v->active = true;
+    v->stopping = false;
+    v->started = false;
+    v->source_done = false;
+    v->priority = req->priority;
+    v->duck = req->duck;
+    v->gain = 0.0f;
+    v->target = req->gain < 0.0f ? 0.0f : (req->gain > 1.0f ? 1.0f : req->gain);
+    v->enqueued_us = cmd->enqueued_us;
+    v->buf_pos = 0;
+    v->buf_len = 0;
+}
+
+// Voice went silent: start what preempted it, if anything
+static void voice_finish(voice_t *v)
+{
+    v->active = false;
+    if (v->has_pending) {
+        v->has_pending = false;
+        voice_start(v, &v->pending);
+    }
+}
+
+static void engine_handle(const engine_cmd_t *cmd)
+{
+    voice_t *v = &s_voices[cmd->play.voice];
+    if (cmd->type == ENGINE_CMD_STOP) {
+        if (v->active) {
+            v->stopping = true;
+            v->has_pending = false;
+        }
+        return;
+    }
+
+    if (!v->active) {
+        voice_start(v, cmd);
+        return;
+    }
+    uint8_t current = v->has_pending ? v->pending.play.priority : v->priority;
+    if (cmd->play.priority < current) {
+        s_stats.rejected++;
+        return;
+    }
+    // Fade the current sound out, then start this one
+    v->stopping = true;
+    v->has_pending = true;
+    v->pending = *cmd;
+    s_stats.preempted++;
+}
+
+static int voice_read(voice_t *v)
+{
+    switch (v->kind) {
+    case AUDIO_SOURCE_PROMPT:
+        return prompt_reader_read(&v->reader.prompt, v->buf, PROMPT_READ_SAMPLES);
+    case AUDIO_SOURCE_PHRASE:
+        return phrase_reader_read(&v->reader.phrase, v->buf, PROMPT_READ_SAMPLES);
+    case AUDIO_SOURCE_TONE:
+        return tone_reader_read(&v->reader.tone, v->buf, PROMPT_READ_SAMPLES);
+    case AUDIO_SOURCE_PCM: {
+        int n = v->reader.pcm.remaining < PROMPT_READ_SAMPLES ? v->reader.pcm.remaining : PROMPT_READ_SAMPLES;
+        memcpy(v->buf, v->reader.pcm.data, n * sizeof(int16_t));
+        v->reader.pcm.data += n;
+        v->reader.pcm.remaining -= n;
+        return n;
+    }
+    }
+    return 0;
+}
+
+static int voice_fill(voice_t *v, int16_t *out, int want)
+{
+    int got = 0;
+    while (got < want) {
+        if (v->buf_pos == v->buf_len) {
+            if (v->source_done) {
+                break;
+            }
+            int n = voice_read(v);
+            if (n <= 0) {
+                v->source_done = true;
+                break;
+            }
+            v->buf_pos = 0;
+            v->buf_len = n;
+        }
+        int n = v->buf_len - v->buf_pos;
+        if (n > want - got) {
+            n = want - got;
+        }
+        memcpy(out + got, v->buf + v->buf_pos, n * sizeof(int16_t));
+        v->buf_pos += n;
+        got += n;
+    }
+    return got;
+}
+
+// Mix one block; returns the voices that produced their first samples
+static uint32_t engine_mix(void)
+{
+    bool ducking = false;
+    for (int i = 0; i < AUDIO_VOICE_COUNT; i++) {
+        if (s_voices[i].active && !s_voices[i].stopping && s_voices[i].duck) {
+            ducking = true;
+        }
+    }
+
+    uint32_t first = 0;
+    memset(s_acc, 0, sizeof(s_acc));
+    for (int i = 0; i < AUDIO_VOICE_COUNT; i++) {
+        voice_t *v = &s_voices[i];
+        if (!v->active) {
+            continue;
+        }
+        float target = v->stopping ? 0.0f : v->target * (ducking && !v->duck ? AUDIO_DUCK_GAIN : 1.0f);
+        int n = voice_fill(v, s_voice_block, AUDIO_ENGINE_BLOCK);
+        for (int j = 0; j < n; j++) {
+            if (v->gain < target) {
+                v->gain = v->gain + AUDIO_RAMP_STEP > target ? target : v->gain + AUDIO_RAMP_STEP;
+            } else if (v->gain > target) {
+                v->gain = v->gain - AUDIO_RAMP_STEP < target ? target : v->gain - AUDIO_RAMP_STEP;
+            }
+            s_acc[j] += (int32_t)(s_voice_block[j] * v->gain);
+        }
+        if (n > 0 && !v->started) {
+            v->started = true;
+            first |= 1u << i;
+        }
+
+        if ((v->stopping && v->gain <= 0.0f) || (v->source_done && v->buf_pos == v->buf_len)) {
+            voice_finish(v);
+        }
+    }
+
+    for (int j = 0; j < AUDIO_ENGINE_BLOCK; j++) {
+        int32_t s = s_acc[j];
+        s_mix[j] = s > 32767 ? 32767 : (s < -32768 ? -32768 : s);
+    }
+    return first;
+}
+
+static bool engine_active(void)
+{
+    for (int i = 0; i < AUDIO_VOICE_COUNT; i++) {
+        if (s_voices[i].active) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void audio_engine_task(void *arg)
+{
+    int64_t playout_end_us = 0;
+    bool streaming = false;
+    engine_cmd_t cmd;
+
+    while (true) {
+        // Idle: sleep on the queue. Playing: only take what is already there.
+        TickType_t wait = engine_active() ? 0 : portMAX_DELAY;
+        while (xQueueReceive(s_queue, &cmd, wait) == pdTRUE) {
+            engine_handle(&cmd);
+            wait = 0;
+        }
+        if (!engine_active()) {
+            streaming = false;
+            continue;
+        }
+
+        uint32_t start = esp_cpu_get_cycle_count();
+        uint32_t first = engine_mix();
+        perf_counter_add(&s_stats.mix_cycles, esp_cpu_get_cycle_count() - start);
+
+        int64_t now = esp_timer_get_time();
+        bool continuous = streaming && now <= playout_end_us;
+        if (streaming && !continuous) {
+            s_stats.underruns++;
+            s_stats.underrun_us += now - playout_end_us;
+        }
+        if (!continuous) {
+            playout_end_us = now;
+        }
+        // Echo reference for the AFE, stamped with the block's playout start
+        aec_reference_write(s_mix, AUDIO_ENGINE_BLOCK, playout_end_us, continuous);
+        playout_end_us += AUDIO_BLOCK_US;
+        streaming = true;
+
+        esp_audio_play(s_mix, sizeof(s_mix), portMAX_DELAY);
+        s_stats.blocks++;
+
+        if (first) {
+            now = esp_timer_get_time();
+            for (int i = 0; i < AUDIO_VOICE_COUNT; i++) {
+                if (first & (1u << i)) {
+                    perf_counter_add(&s_stats.ttfs_us, (uint32_t)(now - s_voices[i].enqueued_us));
+                }
+            }
+        }
+    }
+}
+
+esp_err_t audio_engine_init(void)
+{
+    s_queue = xQueueCreate(AUDIO_ENGINE_QUEUE_LEN, sizeof(engine_cmd_t));
+    if (!s_queue) {
+        return ESP_ERR_NO_MEM;
+    }
+    // Above detect_Task on the same core, a late block is an audible click
+    if (xTaskCreatePinnedToCore(&audio_engine_task, "audio", 4 * 1024, NULL, 6, NULL, 1) != pdPASS) {
+        vQueueDelete(s_queue);
+        s_queue = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Audio engine: %d voices, %d ms blocks", AUDIO_VOICE_COUNT, AUDIO_ENGINE_BLOCK_MS);
+    return ESP_OK;
+}
+
+static esp_err_t audio_engine_send(const engine_cmd_t *cmd)
+{
+    if (!s_queue || cmd->play.voice >= AUDIO_VOICE_COUNT) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xQueueSend(s_queue, cmd, 0) != pdTRUE) {
+        s_stats.queue_full++;
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+esp_err_t audio_engine_play(const audio_play_t *req)
+{
+    engine_cmd_t cmd = {
+        .type = ENGINE_CMD_PLAY,
+        .enqueued_us = esp_timer_get_time(),
+        .play = *req,
+    };
+    esp_err_t err = audio_engine_send(&cmd);
+    if (err == ESP_OK) {
+        s_stats.queued++;
+    }
+    return err;
+}
+
+esp_err_t audio_engine_stop(audio_voice_t voice)
+{
+    engine_cmd_t cmd = {
+        .type = ENGINE_CMD_STOP,
+        .enqueued_us = esp_timer_get_time(),
+        .play = { .voice = voice },
+    };
+    return audio_engine_send(&cmd);
+}
+
+bool audio_engine_busy(audio_voice_t voice)
+{
+    return voice < AUDIO_VOICE_COUNT && s_voices[voice].active;
+}
+
+static esp_err_t audio_engine_api_handler(httpd_req_t *req)
+{
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "running", s_queue != NULL);
+    cJSON_AddNumberToObject(response, "block_ms", AUDIO_ENGINE_BLOCK_MS);
+
+    cJSON *voices = cJSON_AddArrayToObject(response, "voices");
+    for (int i = 0; i < AUDIO_VOICE_COUNT; i++) {
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", s_voice_names[i]);
+        cJSON_AddBoolToObject(item, "active", s_voices[i].active);
+        cJSON_AddNumberToObject(item, "priority", s_voices[i].priority);
+        cJSON_AddNumberToObject(item, "gain", s_voices[i].gain);
+        cJSON_AddItemToArray(voices, item);
+    }
+
+    cJSON_AddNumberToObject(response, "queued", s_stats.queued);
+    cJSON_AddNumberToObject(response, "queue_full", s_stats.queue_full);
+    cJSON_AddNumberToObject(response, "rejected", s_stats.rejected);
+    cJSON_AddNumberToObject(response, "preempted", s_stats.preempted);
+    cJSON_AddNumberToObject(response, "missing", s_stats.missing);
+    cJSON_AddNumberToObject(response, "blocks", s_stats.blocks);
+    cJSON_AddNumberToObject(response, "underruns", s_stats.underruns);
+    cJSON_AddNumberToObject(response, "underrun_ms", (double)s_stats.underrun_us / 1000.0);
+    cJSON_AddNumberToObject(response, "ttfs_ms_avg", perf_counter_avg(&s_stats.ttfs_us) / 1000.0);
+    cJSON_AddNumberToObject(response, "ttfs_ms_max", s_stats.ttfs_us.max / 1000.0);
+    cJSON_AddNumberToObject(response, "mix_us_avg", perf_cycles_to_us(perf_counter_avg(&s_stats.mix_cycles)));
+    cJSON_AddNumberToObject(response, "mix_us_max", perf_cycles_to_us(s_stats.mix_cycles.max));
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t audio_engine_register_http(httpd_handle_t server)
+{
+    httpd_uri_t engine_get_uri = {
+        .uri = "/api/audio/engine",
+        .method = HTTP_GET,
+        .handler = audio_engine_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &engine_get_uri);
+}
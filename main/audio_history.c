@@ -0,0 +1,500 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Rolling history of the raw microphone feed for field debugging.
+//
+// feed_Task is the only writer: each chunk is copied into a PSRAM ring and
+// the frame counter is published with a release store, no locks. Readers
+// either freeze the ring (HTTP download) or copy a window behind the
+// writer and check afterwards that it was not overwritten (auto-capture).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "audio_history.h"
+#include "http_workers.h"
+#include "perf_monitor.h"
+
+#define HISTORY_NVS_NS          "audio"
+#define CAPTURE_SLOTS           3
+#define CAPTURE_MAX_MS          4000
+#define CAPTURE_QUEUE_LEN       4
+#define STREAM_CHUNK_FRAMES     1024
+
+static const char *TAG = "AUDIO_HISTORY";
+
+static const char *reason_names[AUDIO_CAPTURE_REASON_COUNT] = {"wake", "timeout"};
+
+// Audio kept before/after each event: the command follows a wake, a
+// timeout is about what was said before it
+static const struct {
+    uint32_t pre_ms;
+    uint32_t post_ms;
+} capture_window[AUDIO_CAPTURE_REASON_COUNT] = {
+    {1000, 3000},
+    {4000, 0},
+};
+
+typedef struct {
+    audio_capture_reason_t reason;
+    uint32_t event_frame;
+    uint32_t time_s;
+} capture_request_t;
+
+typedef struct {
+    uint32_t id;                // 0 = empty
+    audio_capture_reason_t reason;
+    uint32_t time_s;            // uptime at the event
+    uint32_t frames;
+    int16_t *pcm;
+} capture_slot_t;
+
+typedef struct __attribute__((packed)) {
+    char riff[4];
+    uint32_t riff_size;
+    char wave[4];
+    char fmt[4];
+    uint32_t fmt_size;
+    uint16_t format;
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;
+    uint16_t bits;
+    char data[4];
+    uint32_t data_size;
+} wav_header_t;
+
+static int16_t *s_ring = NULL;
+static uint32_t s_capacity = 0;         // frames, power of two so the counter can wrap
+static int s_channels = 0;
+static int s_sample_rate = 0;
+
+static _Atomic uint32_t s_head = 0;     // frames ever written
+static _Atomic uint32_t s_seq = 0;      // odd while the writer is inside audio_history_write()
+static _Atomic bool s_frozen = false;
+static perf_counter_t s_write_cycles;
+static uint32_t s_dropped = 0;          // frames skipped while frozen
+
+static bool s_auto = false;
+static QueueHandle_t s_capture_queue = NULL;
+static SemaphoreHandle_t s_slot_lock = NULL;
+static capture_slot_t s_slots[CAPTURE_SLOTS];
+static uint32_t s_next_id = 1;
+static uint32_t s_overwritten = 0;
+
+void audio_history_write(const int16_t *data, int frames)
+{
+    if (!s_ring) {
+        return;
+    }
+
+    uint32_t start = esp_cpu_get_cycle_count();
+    // Announce the write before checking the freeze flag; a reader sets the
+    // flag and then waits for s_seq to become even
+    atomic_fetch_add(&s_seq, 1);
+    if (atomic_load(&s_frozen)) {
+        atomic_fetch_add(&s_seq, 1);
+        s_dropped += frames;
+        return;
+    }
+
+    uint32_t head = atomic_load_explicit(&s_head, memory_order_relaxed);
+    uint32_t pos = head & (s_capacity - 1);
+    uint32_t first = frames < s_capacity - pos ? frames : s_capacity - pos;
+    memcpy(s_ring + pos * s_channels, data, first * s_channels * sizeof(int16_t));
+    if (frames > first) {
+        memcpy(s_ring, data + first * s_channels, (frames - first) * s_channels * sizeof(int16_t));
+    }
+    atomic_store_explicit(&s_head, head + frames, memory_order_release);
+    atomic_fetch_add(&s_seq, 1);
+
+    perf_counter_add(&s_write_cycles, esp_cpu_get_cycle_count() - start);
+}
+
+static void history_freeze(void)
+{
+    atomic_store(&s_frozen, true);
+    while (atomic_load(&s_seq) & 1) {
+        vTaskDelay(1);
+    }
+}
+
+static void history_thaw(void)
+{
+    atomic_store(&s_frozen, false);
+}
+
+// Copy frames starting at absolute frame index `from` out of the ring
+static void history_copy(int16_t *dst, uint32_t from, uint32_t frames)
+{
+    uint32_t pos = from & (s_capacity - 1);
+    uint32_t first = frames < s_capacity - pos ? frames : s_capacity - pos;
+    memcpy(dst, s_ring + pos * s_channels, first * s_channels * sizeof(int16_t));
+    if (frames > first) {
+        memcpy(dst + first * s_channels, s_ring, (frames - first) * s_channels * sizeof(int16_t));
+    }
+}
+
+static uint32_t ms_to_frames(uint32_t ms)
+{
+    return ms * s_sample_rate / 1000;
+}
+
+static void capture_task(void *arg)
+{
+    capture_request_t req;
+    while (1) {
+        xQueueReceive(s_capture_queue, &req, portMAX_DELAY);
+
+        uint32_t pre = ms_to_frames(capture_window[req.reason].pre_ms);
+        uint32_t post = ms_to_frames(capture_window[req.reason].post_ms);
+        uint32_t end = req.event_frame + post;
+        while ((int32_t)(atomic_load_explicit(&s_head, memory_order_acquire) - end) < 0) {
+            vTaskDelay(pdMS_TO_TICKS(50));
+        }
+        uint32_t frames = pre + post;
+        if (end < frames) {
+            frames = end;   // event within the first seconds after boot
+        }
+        uint32_t from = end - frames;
+
+        xSemaphoreTake(s_slot_lock, portMAX_DELAY);
+        capture_slot_t *slot = &s_slots[s_next_id % CAPTURE_SLOTS];
+        if (!slot->pcm) {
+            slot->pcm = heap_caps_malloc(ms_to_frames(CAPTURE_MAX_MS) * s_channels * sizeof(int16_t),
+                                         MALLOC_CAP_SPIRAM);
+        }
+        if (slot->pcm) {
+            history_copy(slot->pcm, from, frames);
+            // The writer may have lapped us while copying
+            uint32_t head = atomic_load_explicit(&s_head, memory_order_acquire);
+            if (head - from <= s_capacity) {
+                slot->id = s_next_id++;
+                slot->reason = req.reason;
+                slot->time_s = req.time_s;
+                slot->frames = frames;
+                ESP_LOGI(TAG, "Captured %lu ms around %s event as #%lu",
+                         (unsigned long)(frames * 1000 / s_sample_rate), reason_names[req.reason],
+                         (unsigned long)slot->id);
+            } else {
+                slot->id = 0;
+                s_overwritten++;
+                ESP_LOGW(TAG, "Capture overwritten before it was copied");
+            }
+        } else {
+            ESP_LOGE(TAG, "No PSRAM for capture slot");
+        }
+        xSemaphoreGive(s_slot_lock);
+    }
+}
+
+uint32_t audio_history_head(void)
+{
+    return atomic_load_explicit(&s_head, memory_order_acquire);
+}
+
+int audio_history_channels(void)
+{
+    return s_channels;
+}
+
+bool audio_history_read(int16_t *dst, uint32_t end, uint32_t frames)
+{
+    if (!s_ring || frames > s_capacity || end < frames) {
+        return false;
+    }
+    uint32_t from = end - frames;
+    if ((int32_t)(atomic_load_explicit(&s_head, memory_order_acquire) - end) < 0) {
+        return false;
+    }
+    history_copy(dst, from, frames);
+    // The writer may have lapped us while copying
+    return atomic_load_explicit(&s_head, memory_order_acquire) - from <= s_capacity;
+}
+
+void audio_history_mark(audio_capture_reason_t reason)
+{
+    if (!s_auto || !s_ring || reason >= AUDIO_CAPTURE_REASON_COUNT) {
+        return;
+    }
+    capture_request_t req = {
+        .reason = reason,
+        .event_frame = atomic_load_explicit(&s_head, memory_order_acquire),
+        .time_s = esp_timer_get_time() / 1000000,
+    };
+    xQueueSend(s_capture_queue, &req, 0);
+}
+
+static void audio_history_save_auto(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(HISTORY_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_u8(nvs_handle, "auto", s_auto);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving auto-capture: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+esp_err_t audio_history_init(int channels, int sample_rate)
+{
+    // Round up to a power of two so frame counter wrap-around stays seamless
+    uint32_t frames = (uint32_t)sample_rate * AUDIO_HISTORY_SECONDS;
+    s_capacity = 1;
+    while (s_capacity < frames) {
+        s_capacity <<= 1;
+    }
+    s_channels = channels;
+    s_sample_rate = sample_rate;
+    perf_counter_reset(&s_write_cycles);
+
+    size_t bytes = s_capacity * channels * sizeof(int16_t);
+    int16_t *ring = heap_caps_calloc(1, bytes, MALLOC_CAP_SPIRAM);
+    if (!ring) {
+        ESP_LOGE(TAG, "Failed to allocate %u bytes of PSRAM for audio history", (unsigned)bytes);
+        return ESP_ERR_NO_MEM;
+    }
+
+    nvs_handle_t nvs_handle;
+    if (nvs_open(HISTORY_NVS_NS, NVS_READONLY, &nvs_handle) == ESP_OK) {
+        uint8_t value;
+        if (nvs_get_u8(nvs_handle, "auto", &value) == ESP_OK) {
+            s_auto = value;
+        }
+        nvs_close(nvs_handle);
+    }
+
+    s_slot_lock = xSemaphoreCreateMutex();
+    s_capture_queue = xQueueCreate(CAPTURE_QUEUE_LEN, sizeof(capture_request_t));
+    xTaskCreatePinnedToCore(&capture_task, "audio_capture", 3 * 1024, NULL, 1, NULL, 1);
+    s_ring = ring;
+
+    ESP_LOGI(TAG, "Audio history: %lu ms of %d-channel audio (%u KB PSRAM), auto-capture %s",
+             (unsigned long)(s_capacity * 1000ULL / sample_rate), channels, (unsigned)(bytes / 1024),
+             s_auto ? "on" : "off");
+    return ESP_OK;
+}
+
+static esp_err_t send_wav(httpd_req_t *req, const char *filename, uint32_t frames,
+                          const int16_t *linear, uint32_t ring_from)
+{
+    uint32_t data_bytes = frames * s_channels * sizeof(int16_t);
+    wav_header_t header = {
+        .riff = {'R', 'I', 'F', 'F'},
+        .riff_size = 36 + data_bytes,
+        .wave = {'W', 'A', 'V', 'E'},
+        .fmt = {'f', 'm', 't', ' '},
+        .fmt_size = 16,
+        .format = 1,
+        .channels = s_channels,
+        .sample_rate = s_sample_rate,
+        .byte_rate = s_sample_rate * s_channels * sizeof(int16_t),
+        .block_align = s_channels * sizeof(int16_t),
+        .bits = 16,
+        .data = {'d', 'a', 't', 'a'},
+        .data_size = data_bytes,
+    };
+
+    char disposition[64];
+    snprintf(disposition, sizeof(disposition), "attachment; filename=\"%s\"", filename);
+    httpd_resp_set_type(req, "audio/wav");
+    httpd_resp_set_hdr(req, "Content-Disposition", disposition);
+
+    esp_err_t err = httpd_resp_send_chunk(req, (const char *)&header, sizeof(header));
+    uint32_t sent = 0;
+    while (sent < frames && err == ESP_OK) {
+        uint32_t n = frames - sent < STREAM_CHUNK_FRAMES ? frames - sent : STREAM_CHUNK_FRAMES;
+        const int16_t *src;
+        if (linear) {
+            src = linear + sent * s_channels;
+        } else {
+            // Stop the chunk at the end of the ring, the next one starts at its beginning
+            uint32_t pos = (ring_from + sent) & (s_capacity - 1);
+            if (n > s_capacity - pos) {
+                n = s_capacity - pos;
+            }
+            src = s_ring + pos * s_channels;
+        }
+        err = httpd_resp_send_chunk(req, (const char *)src, n * s_channels * sizeof(int16_t));
+        sent += n;
+    }
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return err;
+}
+
+static esp_err_t history_get_handler(httpd_req_t *req)
+{
+    if (!s_ring) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Audio history not available");
+        return ESP_FAIL;
+    }
+
+    uint32_t seconds = 0;
+    char query[32], value[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "seconds", value, sizeof(value)) == ESP_OK) {
+        seconds = atoi(value);
+    }
+
+    history_freeze();
+    uint32_t head = atomic_load_explicit(&s_head, memory_order_acquire);
+    uint32_t frames = head < s_capacity ? head : s_capacity;
+    if (seconds > 0 && seconds * s_sample_rate < frames) {
+        frames = seconds * s_sample_rate;
+    }
+    esp_err_t err = send_wav(req, "history.wav", frames, NULL, head - frames);
+    history_thaw();
+    return err;
+}
+
+static esp_err_t capture_get_handler(httpd_req_t *req)
+{
+    uint32_t id = 0;
+    char query[32], value[12];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "id", value, sizeof(value)) == ESP_OK) {
+        id = strtoul(value, NULL, 10);
+    }
+    if (!s_slot_lock) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Audio history not available");
+        return ESP_FAIL;
+    }
+
+    xSemaphoreTake(s_slot_lock, portMAX_DELAY);
+    esp_err_t err = ESP_OK;
+    capture_slot_t *slot = NULL;
+    for (int i = 0; i < CAPTURE_SLOTS; i++) {
+        if (id != 0 && s_slots[i].id == id) {
+            slot = &s_slots[i];
+        }
+    }
+    if (slot) {
+        char filename[32];
+        snprintf(filename, sizeof(filename), "capture_%lu_%s.wav", (unsigned long)id, reason_names[slot->reason]);
+        err = send_wav(req, filename, slot->frames, slot->pcm, 0);
+    } else {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such capture");
+    }
+    xSemaphoreGive(s_slot_lock);
+    return err;
+}
+
+static esp_err_t captures_api_handler(httpd_req_t *req)
+{
+    if (!s_slot_lock) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Audio history not available");
+        return ESP_FAIL;
+    }
+
+    if (req->method == HTTP_POST) {
+        char buf[64];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        cJSON *enable = json ? cJSON_GetObjectItem(json, "auto") : NULL;
+        if (cJSON_IsBool(enable)) {
+            s_auto = cJSON_IsTrue(enable);
+            audio_history_save_auto();
+        }
+        cJSON_Delete(json);
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "auto", s_auto);
+    cJSON_AddNumberToObject(response, "channels", s_channels);
+    cJSON_AddNumberToObject(response, "sample_rate", s_sample_rate);
+    cJSON_AddNumberToObject(response, "history_ms", s_sample_rate ? s_capacity * 1000ULL / s_sample_rate : 0);
+    cJSON_AddNumberToObject(response, "write_cycles_avg", perf_counter_avg(&s_write_cycles));
+    cJSON_AddNumberToObject(response, "write_cycles_max", s_write_cycles.max);
+    cJSON_AddNumberToObject(response, "dropped_frames", s_dropped);
+    cJSON_AddNumberToObject(response, "overwritten", s_overwritten);
+
+    cJSON *captures = cJSON_AddArrayToObject(response, "captures");
+    xSemaphoreTake(s_slot_lock, portMAX_DELAY);
+    for (int i = 0; i < CAPTURE_SLOTS; i++) {
+        const capture_slot_t *slot = &s_slots[i];
+        if (slot->id == 0) {
+            continue;
+        }
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "id", slot->id);
+        cJSON_AddStringToObject(item, "reason", reason_names[slot->reason]);
+        cJSON_AddNumberToObject(item, "time_s", slot->time_s);
+        cJSON_AddNumberToObject(item, "ms", slot->frames * 1000ULL / s_sample_rate);
+        cJSON_AddItemToArray(captures, item);
+    }
+    xSemaphoreGive(s_slot_lock);
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t audio_history_register_http(httpd_handle_t server)
+{
+    httpd_uri_t history_uri = {
+        .uri = "/api/audio/history",
+        .method = HTTP_GET,
+        .handler = history_get_handler,
+        .user_ctx = NULL
+    };
+    http_workers_register(server, &history_uri);     // WAV download, paced by the client
+
+    httpd_uri_t capture_uri = {
+        .uri = "/api/audio/capture",
+        .method = HTTP_GET,
+        .handler = capture_get_handler,
+        .user_ctx = NULL
+    };
+    http_workers_register(server, &capture_uri);
+
+    httpd_uri_t captures_get_uri = {
+        .uri = "/api/audio/captures",
+        .method = HTTP_GET,
+        .handler = captures_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &captures_get_uri);
+
+    httpd_uri_t captures_post_uri = {
+        .uri = "/api/audio/captures",
+        .method = HTTP_POST,
+        .handler = captures_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &captures_post_uri);
+}
@@ -0,0 +1,328 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Dependency-ordered parallel boot.
+//
+// app_main hands over a table of stages (NVS, LEDs, WiFi, models, audio
+// board, speech pipeline, web server...). Each stage gets its own task that
+// waits on an event group for the stages it depends on and then runs, so a
+// slow WiFi association no longer holds back the wake word. Start and end
+// of every stage and a few one-off milestones (voice ready, first wake,
+// WiFi connected, pixels restored) are timestamped against esp_timer, which
+// starts counting at reset; the bootloader is not included. The summary is
+// logged once the last stage finishes, the time to voice of the last few
+// boots is kept in NVS, and everything is served at /api/boot. The milestone
+// call only stores a timestamp; the NVS update for voice ready runs later
+// from a one-shot esp_timer, so neither the figure nor the first wake waits
+// on a flash commit.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "boot_orchestrator.h"
+
+static const char *TAG = "BOOT";
+
+typedef enum {
+    BOOT_PENDING,
+    BOOT_RUNNING,
+    BOOT_OK,
+    BOOT_FAILED,
+    BOOT_SKIPPED,
+} boot_status_t;
+
+static const char *const s_status_names[] = { "pending", "running", "ok", "failed", "skipped" };
+static const char *const s_milestone_names[BOOT_MILESTONE_COUNT] = {
+    "voice_ready", "first_wake", "wifi_connected", "pixels_restored"
+};
+
+typedef struct {
+    const boot_stage_t *stage;
+    int index;
+    volatile boot_status_t status;
+    esp_err_t err;
+    int64_t ready_us;           // dependencies done
+    int64_t start_us;
+    int64_t end_us;
+} boot_slot_t;
+
+static const boot_stage_t *s_stages = NULL;
+static int s_count = 0;
+static boot_slot_t s_slots[BOOT_MAX_STAGES];
+static EventGroupHandle_t s_done = NULL;
+static atomic_int s_remaining;
+static int64_t s_run_us = 0;
+static atomic_int_least64_t s_milestones[BOOT_MILESTONE_COUNT];
+static uint32_t s_history[BOOT_HISTORY_LEN];    // voice ready ms of earlier boots, newest first
+static int s_history_len = 0;
+static esp_timer_handle_t s_history_timer = NULL;
+
+static float us_to_ms(int64_t us)
+{
+    return us / 1000.0f;
+}
+
+static void boot_load_history(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(BOOT_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    size_t size = sizeof(s_history);
+    if (nvs_get_blob(nvs_handle, "voice_ms", s_history, &size) == ESP_OK) {
+        s_history_len = size / sizeof(s_history[0]);
+    }
+    nvs_close(nvs_handle);
+}
+
+static void boot_save_history(uint32_t voice_ms)
+{
+    uint32_t history[BOOT_HISTORY_LEN];
+    int len = s_history_len < BOOT_HISTORY_LEN ? s_history_len + 1 : BOOT_HISTORY_LEN;
+    history[0] = voice_ms;
+    memcpy(&history[1], s_history, (len - 1) * sizeof(history[0]));
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(BOOT_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_blob(nvs_handle, "voice_ms", history, len * sizeof(history[0]));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving boot history: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static void boot_history_cb(void *arg)
+{
+    // NVS is up long before the AFE delivers its first frame
+    boot_load_history();
+    boot_save_history(boot_milestone_ms(BOOT_MILESTONE_VOICE_READY));
+}
+
+static void boot_log_summary(void)
+{
+    for (int i = 0; i < s_count; i++) {
+        const boot_slot_t *slot = &s_slots[i];
+        if (slot->status == BOOT_SKIPPED) {
+            ESP_LOGW(TAG, "  %-10s skipped", slot->stage->name);
+        } else {
+            ESP_LOGI(TAG, "  %-10s %7.1f -> %7.1f ms (%6.1f ms, waited %6.1f ms)%s", slot->stage->name,
+                     us_to_ms(slot->start_us), us_to_ms(slot->end_us), us_to_ms(slot->end_us - slot->start_us),
+                     us_to_ms(slot->ready_us - s_run_us),
+                     slot->status == BOOT_FAILED ? " FAILED" : "");
+        }
+    }
+    for (int m = 0; m < BOOT_MILESTONE_COUNT; m++) {
+        int32_t ms = boot_milestone_ms(m);
+        if (ms >= 0) {
+            ESP_LOGI(TAG, "  %-14s at %ld ms", s_milestone_names[m], (long)ms);
+        }
+    }
+}
+
+static void boot_stage_task(void *arg)
+{
+    boot_slot_t *slot = arg;
+    const boot_stage_t *stage = slot->stage;
+
+    if (stage->deps | stage->after) {
+        xEventGroupWaitBits(s_done, stage->deps | stage->after, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+    slot->ready_us = esp_timer_get_time();
+
+    bool blocked = false;
+    for (int i = 0; i < s_count; i++) {
+        if ((stage->deps & BOOT_DEP(i)) && s_slots[i].status != BOOT_OK) {
+            ESP_LOGW(TAG, "Skipping %s: %s did not come up", stage->name, s_slots[i].stage->name);
+            blocked = true;
+            break;
+        }
+    }
+
+    slot->start_us = esp_timer_get_time();
+    if (blocked) {
+        slot->status = BOOT_SKIPPED;
+    } else {
+        slot->status = BOOT_RUNNING;
+        slot->err = stage->fn();
+        slot->status = slot->err == ESP_OK ? BOOT_OK : BOOT_FAILED;
+    }
+    slot->end_us = esp_timer_get_time();
+    if (slot->status == BOOT_FAILED) {
+        ESP_LOGE(TAG, "Stage %s failed: %s", stage->name, esp_err_to_name(slot->err));
+    } else if (slot->status == BOOT_OK) {
+        ESP_LOGI(TAG, "Stage %s done in %.1f ms (at %.1f ms)", stage->name,
+                 us_to_ms(slot->end_us - slot->start_us), us_to_ms(slot->end_us));
+    }
+    // Dependents look at the status once this bit is set
+    xEventGroupSetBits(s_done, BOOT_DEP(slot->index));
+
+    if (atomic_fetch_sub(&s_remaining, 1) == 1) {
+        ESP_LOGI(TAG, "Boot finished at %.1f ms:", us_to_ms(esp_timer_get_time()));
+        boot_log_summary();
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t boot_run(const boot_stage_t *stages, int count)
+{
+    if (count <= 0 || count > BOOT_MAX_STAGES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 0; i < count; i++) {
+        // Dependencies must point backwards, which also rules out cycles
+        if ((stages[i].deps | stages[i].after) & ~(BOOT_DEP(i) - 1)) {
+            ESP_LOGE(TAG, "Stage %s depends on a later stage", stages[i].name);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    s_done = xEventGroupCreate();
+    if (!s_done) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_timer_create_args_t timer_args = {
+        .callback = boot_history_cb,
+        .name = "boot_history",
+    };
+    esp_err_t err = esp_timer_create(&timer_args, &s_history_timer);
+    if (err != ESP_OK) {
+        return err;
+    }
+    s_stages = stages;
+    s_count = count;
+    atomic_store(&s_remaining, count);
+    s_run_us = esp_timer_get_time();
+
+    for (int i = 0; i < count; i++) {
+        s_slots[i] = (boot_slot_t) {
+            .stage = &stages[i],
+            .index = i,
+            .status = BOOT_PENDING,
+        };
+    }
+    for (int i = 0; i < count; i++) {
+        if (xTaskCreatePinnedToCore(&boot_stage_task, stages[i].name, stages[i].stack, &s_slots[i],
+                                    BOOT_TASK_PRIORITY, NULL, stages[i].core) != pdPASS) {
+            ESP_LOGE(TAG, "Could not start stage %s", stages[i].name);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    ESP_LOGI(TAG, "%d boot stages started at %.1f ms", count, us_to_ms(s_run_us));
+    return ESP_OK;
+}
+
+void boot_milestone(boot_milestone_t milestone)
+{
+    if (milestone >= BOOT_MILESTONE_COUNT) {
+        return;
+    }
+    if (atomic_load(&s_milestones[milestone])) {
+        return;
+    }
+    int_least64_t expected = 0;
+    int64_t now = esp_timer_get_time();
+    if (!atomic_compare_exchange_strong(&s_milestones[milestone], &expected, now)) {
+        return;
+    }
+    ESP_LOGI(TAG, "%s at %.1f ms after reset", s_milestone_names[milestone], us_to_ms(now));
+    if (milestone == BOOT_MILESTONE_VOICE_READY && s_history_timer) {
+        // Off the detect path, and past the first few seconds of listening
+        esp_timer_start_once(s_history_timer, BOOT_HISTORY_DELAY_MS * 1000ULL);
+    }
+}
+
+int32_t boot_milestone_ms(boot_milestone_t milestone)
+{
+    if (milestone >= BOOT_MILESTONE_COUNT) {
+        return -1;
+    }
+    int64_t us = atomic_load(&s_milestones[milestone]);
+    return us ? us / 1000 : -1;
+}
+
+static esp_err_t boot_api_handler(httpd_req_t *req)
+{
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddNumberToObject(response, "run_ms", us_to_ms(s_run_us));
+    cJSON_AddNumberToObject(response, "uptime_ms", esp_timer_get_time() / 1000);
+
+    cJSON *stages = cJSON_AddArrayToObject(response, "stages");
+    for (int i = 0; i < s_count; i++) {
+        const boot_slot_t *slot = &s_slots[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", slot->stage->name);
+        cJSON_AddStringToObject(item, "status", s_status_names[slot->status]);
+        cJSON *deps = cJSON_AddArrayToObject(item, "deps");
+        for (int d = 0; d < s_count; d++) {
+            if (slot->stage->deps & BOOT_DEP(d)) {
+                cJSON_AddItemToArray(deps, cJSON_CreateString(s_stages[d].name));
+            }
+        }
+        if (slot->stage->after) {
+            cJSON *after = cJSON_AddArrayToObject(item, "after");
+            for (int d = 0; d < s_count; d++) {
+                if (slot->stage->after & BOOT_DEP(d)) {
+                    cJSON_AddItemToArray(after, cJSON_CreateString(s_stages[d].name));
+                }
+            }
+        }
+        if (slot->status >= BOOT_RUNNING) {
+            cJSON_AddNumberToObject(item, "ready_ms", us_to_ms(slot->ready_us));
+            cJSON_AddNumberToObject(item, "start_ms", us_to_ms(slot->start_us));
+        }
+        if (slot->status >= BOOT_OK) {
+            cJSON_AddNumberToObject(item, "end_ms", us_to_ms(slot->end_us));
+            cJSON_AddNumberToObject(item, "duration_ms", us_to_ms(slot->end_us - slot->start_us));
+        }
+        if (slot->status == BOOT_FAILED) {
+            cJSON_AddStringToObject(item, "error", esp_err_to_name(slot->err));
+        }
+        cJSON_AddItemToArray(stages, item);
+    }
+
+    cJSON *milestones = cJSON_AddObjectToObject(response, "milestones_ms");
+    for (int m = 0; m < BOOT_MILESTONE_COUNT; m++) {
+        cJSON_AddNumberToObject(milestones, s_milestone_names[m], boot_milestone_ms(m));
+    }
+
+    cJSON *history = cJSON_AddArrayToObject(response, "previous_voice_ready_ms");
+    for (int i = 0; i < s_history_len; i++) {
+        cJSON_AddItemToArray(history, cJSON_CreateNumber(s_history[i]));
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t boot_register_http(httpd_handle_t server)
+{
+    httpd_uri_t boot_uri = {
+        .uri = "/api/boot",
+        .method = HTTP_GET,
+        .handler = boot_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &boot_uri);
+}
@@ -0,0 +1,555 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Direction of arrival of the wake word from the two-microphone array.
+//
+// On wake detection a background task copies the DOA_WINDOW_MS before it
+// out of the audio history and runs GCC-PHAT: each DOA_FFT_SIZE frame of
+// mic 1 and mic 2 is transformed with one complex FFT (mic 1 real, mic 2
+// imaginary, split with dsps_cplx2reC_fc32), the cross-spectrum is formed
+// with esp-dsp vector multiplies and reduced to its phase, and the phases
+// are summed over the frames that pass an energy gate. A zero-padded
+// inverse transform gives the correlation at 1/DOA_UPSAMPLE-sample lags;
+// the peak inside the physical lag range, refined with a parabola, is the
+// inter-microphone delay, and the delay against spacing / speed of sound
+// gives the angle from the mic axis. Two microphones cannot tell front from
+// back, so the ring shows the half selected by the mounting setting.
+//
+// tools/doa_eval.py runs the same steps on recorded stereo clips on the
+// host, or uploads them to POST /api/doa/eval to score this code.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_dsp.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "audio_history.h"
+#include "doa.h"
+#include "http_workers.h"
+
+#define DOA_CORR_SIZE           (DOA_FFT_SIZE * DOA_UPSAMPLE)
+#define DOA_BINS                (DOA_FFT_SIZE / 2)
+#define DOA_BIN_LO              (DOA_MIN_HZ * DOA_FFT_SIZE / DOA_RATE)
+#define DOA_BIN_HI              (DOA_MAX_HZ * DOA_FFT_SIZE / DOA_RATE)
+#define DOA_WINDOW_FRAMES       (DOA_WINDOW_MS * DOA_RATE / 1000)
+#define DOA_EVAL_MAX_FRAMES     ((DOA_MAX_FRAMES - 1) * DOA_HOP + DOA_FFT_SIZE)
+#define DOA_EVAL_MAX_CHANNELS   4
+#define DOA_EVAL_RECV_TIMEOUTS  3       // receive timeouts per upload before a 408, as in json_codec
+
+static const char *TAG = "DOA";
+
+static int s_channels = 0;
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_lock = NULL;         // the estimator's buffers
+static portMUX_TYPE s_result_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static float s_window[DOA_FFT_SIZE];
+static float s_frame[DOA_FFT_SIZE * 2] __attribute__((aligned(16)));
+static float s_prod[4][DOA_BINS] __attribute__((aligned(16)));
+static float s_cross[DOA_BINS * 2];
+static float s_energy[DOA_MAX_FRAMES];
+static float *s_corr = NULL;                    // DOA_CORR_SIZE complex, PSRAM
+static int16_t *s_pcm = NULL;                   // wake window copy, PSRAM
+
+static uint16_t s_spacing_mm = DOA_MIC_SPACING_MM;
+static uint8_t s_axis_led = 0;                  // LED the mic 1 end of the axis points at
+static bool s_mirror = false;                   // show the counter-clockwise half instead
+
+static doa_result_t s_latest;
+
+static struct {
+    uint32_t requests;
+    uint32_t valid;
+    uint32_t unavailable;       // window not (or no longer) in the audio history
+    perf_counter_t cycles;      // per estimate
+    perf_counter_t frames;      // frames used per estimate, in count/total
+} s_stats;
+
+static void doa_save_config(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(DOA_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_u16(nvs_handle, "spacing_mm", s_spacing_mm);
+    if (err == ESP_OK) {
+        err = nvs_set_u8(nvs_handle, "axis_led", s_axis_led);
+    }
+    if (err == ESP_OK) {
+        err = nvs_set_u8(nvs_handle, "mirror", s_mirror);
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving DOA mounting: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static void doa_load_config(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(DOA_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    uint16_t spacing;
+    uint8_t value;
+    if (nvs_get_u16(nvs_handle, "spacing_mm", &spacing) == ESP_OK && spacing > 0) {
+        s_spacing_mm = spacing;
+    }
+    if (nvs_get_u8(nvs_handle, "axis_led", &value) == ESP_OK) {
+        s_axis_led = value;
+    }
+    if (nvs_get_u8(nvs_handle, "mirror", &value) == ESP_OK) {
+        s_mirror = value;
+    }
+    nvs_close(nvs_handle);
+}
+
+// Correlation at lag n quarter-samples; negative lags wrap to the top of the buffer
+static inline float doa_corr_at(int n)
+{
+    return s_corr[2 * ((n + DOA_CORR_SIZE) % DOA_CORR_SIZE)];
+}
+
+static float doa_max_lag(void)
+{
+    return s_spacing_mm / 1000.0f / DOA_SOUND_SPEED * DOA_RATE;
+}
+
+// Add the phase of one frame's cross-spectrum to s_cross
+static void doa_accumulate(const int16_t *p, int channels)
+{
+    for (int i = 0; i < DOA_FFT_SIZE; i++) {
+        s_frame[2 * i] = p[i * channels] * s_window[i];
+        s_frame[2 * i + 1] = p[i * channels + 1] * s_window[i];
+    }
+    dsps_fft2r_fc32(s_frame, DOA_FFT_SIZE);
+    dsps_bit_rev_fc32(s_frame, DOA_FFT_SIZE);
+    dsps_cplx2reC_fc32(s_frame, DOA_FFT_SIZE);
+    const float *x1 = s_frame;
+    const float *x2 = s_frame + DOA_FFT_SIZE;
+
+    // X1 * conj(X2) for every bin at once
+    dsps_mul_f32(x1, x2, s_prod[0], DOA_BINS, 2, 2, 1);
+    dsps_mul_f32(x1 + 1, x2 + 1, s_prod[1], DOA_BINS, 2, 2, 1);
+    dsps_mul_f32(x1 + 1, x2, s_prod[2], DOA_BINS, 2, 2, 1);
+    dsps_mul_f32(x1, x2 + 1, s_prod[3], DOA_BINS, 2, 2, 1);
+    dsps_add_f32(s_prod[0], s_prod[1], s_prod[0], DOA_BINS, 1, 1, 1);
+    dsps_sub_f32(s_prod[2], s_prod[3], s_prod[2], DOA_BINS, 1, 1, 1);
+
+    // PHAT weighting: keep the phase only
+    for (int k = DOA_BIN_LO; k < DOA_BIN_HI; k++) {
+        float re = s_prod[0][k];
+        float im = s_prod[2][k];
+        float mag = sqrtf(re * re + im * im);
+        if (mag > 1e-20f) {
+            s_cross[2 * k] += re / mag;
+            s_cross[2 * k + 1] += im / mag;
+        }
+    }
+}
+
+esp_err_t doa_estimate(const int16_t *pcm, int channels, int frames, doa_result_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (channels < 2 || frames < DOA_FFT_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_corr) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    int count = (frames - DOA_FFT_SIZE) / DOA_HOP + 1;
+    if (count > DOA_MAX_FRAMES) {
+        // Keep the newest frames
+        pcm += (count - DOA_MAX_FRAMES) * DOA_HOP * channels;
+        count = DOA_MAX_FRAMES;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    uint32_t start = esp_cpu_get_cycle_count();
+
+    // Energy gate on mic 1: only frames with the talker in them
+    float loudest = 0.0f;
+    for (int f = 0; f < count; f++) {
+        const int16_t *p = pcm + f * DOA_HOP * channels;
+        int64_t e = 0;
+        for (int i = 0; i < DOA_FFT_SIZE; i++) {
+            e += (int32_t)p[i * channels] * p[i * channels];
+        }
+        s_energy[f] = (float)e;
+        if (s_energy[f] > loudest) {
+            loudest = s_energy[f];
+        }
+    }
+    float gate = loudest * powf(10.0f, -DOA_GATE_DB / 10.0f);
+
+    memset(s_cross, 0, sizeof(s_cross));
+    uint32_t used = 0;
+    for (int f = 0; f < count; f++) {
+        if (s_energy[f] > 0.0f && s_energy[f] >= gate) {
+            doa_accumulate(pcm + f * DOA_HOP * channels, channels);
+            used++;
+        }
+    }
+
+    if (used) {
+        // Zero-padded inverse transform of the summed cross-spectrum. A forward
+        // FFT of the conjugate gives the conjugate of the inverse, and the
+        // correlation is real, so the real parts are the lags.
+        memset(s_corr, 0, DOA_CORR_SIZE * 2 * sizeof(float));
+        for (int k = DOA_BIN_LO; k < DOA_BIN_HI; k++) {
+            s_corr[2 * k] = s_cross[2 * k];
+            s_corr[2 * k + 1] = -s_cross[2 * k + 1];
+            s_corr[2 * (DOA_CORR_SIZE - k)] = s_cross[2 * k];
+            s_corr[2 * (DOA_CORR_SIZE - k) + 1] = s_cross[2 * k + 1];
+        }
+        dsps_fft2r_fc32(s_corr, DOA_CORR_SIZE);
+        dsps_bit_rev_fc32(s_corr, DOA_CORR_SIZE);
+
+        float max_lag = doa_max_lag();
+        int range = (int)ceilf(max_lag * DOA_UPSAMPLE) + 1;
+        if (range > DOA_CORR_SIZE / 2 - 2) {
+            range = DOA_CORR_SIZE / 2 - 2;
+        }
+        int best = 0;
+        float peak = -1e30f;
+        for (int n = -range; n <= range; n++) {
+            float v = doa_corr_at(n);
+            if (v > peak) {
+                peak = v;
+                best = n;
+            }
+        }
+        float l = doa_corr_at(best - 1);
+        float r = doa_corr_at(best + 1);
+        float denom = l - 2.0f * peak + r;
+        float delta = denom < 0.0f ? 0.5f * (l - r) / denom : 0.0f;
+
+        // The peak sits at minus the delay of mic 2 behind mic 1
+        out->lag_samples = -(best + delta) / DOA_UPSAMPLE;
+        float c = out->lag_samples / max_lag;
+        c = c > 1.0f ? 1.0f : (c < -1.0f ? -1.0f : c);
+        out->angle_deg = acosf(c) * 180.0f / (float)M_PI;
+        out->coherence = peak / (2.0f * used * (DOA_BIN_HI - DOA_BIN_LO));
+        out->valid = out->coherence >= DOA_MIN_COHERENCE;
+    }
+    out->frames = used;
+    out->cycles = esp_cpu_get_cycle_count() - start;
+    out->time_us = esp_timer_get_time();
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+static void doa_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        s_stats.requests++;
+
+        doa_result_t result;
+        if (!audio_history_read(s_pcm, audio_history_head(), DOA_WINDOW_FRAMES)) {
+            s_stats.unavailable++;
+            continue;
+        }
+        if (doa_estimate(s_pcm, s_channels, DOA_WINDOW_FRAMES, &result) != ESP_OK) {
+            continue;
+        }
+        perf_counter_add(&s_stats.cycles, result.cycles);
+        s_stats.frames.count++;
+        s_stats.frames.total += result.frames;
+        if (result.valid) {
+            s_stats.valid++;
+        }
+        taskENTER_CRITICAL(&s_result_mux);
+        s_latest = result;
+        taskEXIT_CRITICAL(&s_result_mux);
+        ESP_LOGI(TAG, "%s %.0f deg (lag %.2f samples, coherence %.2f, %lu frames) in %.2f ms",
+                 result.valid ? "Speaker at" : "Unsure,", result.angle_deg, result.lag_samples, result.coherence,
+                 (unsigned long)result.frames, perf_cycles_to_us(result.cycles) / 1000.0f);
+    }
+}
+
+void doa_request(void)
+{
+    if (s_task) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+bool doa_latest(doa_result_t *out)
+{
+    taskENTER_CRITICAL(&s_result_mux);
+    *out = s_latest;
+    taskEXIT_CRITICAL(&s_result_mux);
+    return out->valid && esp_timer_get_time() - out->time_us < (int64_t)DOA_RESULT_TTL_MS * 1000;
+}
+
+int doa_ring_position(const doa_result_t *result, int leds)
+{
+    int offset = (int)lroundf(result->angle_deg * leds / 360.0f);
+    int pos = s_mirror ? s_axis_led - offset : s_axis_led + offset;
+    return ((pos % leds) + leds) % leds;
+}
+
+esp_err_t doa_init(int channels)
+{
+    if (channels < 2) {
+        ESP_LOGI(TAG, "Single microphone, direction of arrival disabled");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    esp_err_t err = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "FFT init failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    s_corr = heap_caps_aligned_alloc(16, DOA_CORR_SIZE * 2 * sizeof(float), MALLOC_CAP_SPIRAM);
+    s_pcm = heap_caps_malloc(DOA_WINDOW_FRAMES * channels * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    if (!s_corr || !s_pcm) {
+        ESP_LOGE(TAG, "No PSRAM for the DOA buffers");
+        return ESP_ERR_NO_MEM;
+    }
+    dsps_wind_hann_f32(s_window, DOA_FFT_SIZE);
+    s_channels = channels;
+    s_lock = xSemaphoreCreateMutex();
+    doa_load_config();
+
+    // Below detect_Task so wakenet and multinet keep their time
+    if (xTaskCreatePinnedToCore(&doa_task, "doa", 4 * 1024, NULL, 4, &s_task, 1) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "DOA ready: %u mm spacing, max lag %.2f samples, axis at LED %u%s", s_spacing_mm,
+             doa_max_lag(), s_axis_led, s_mirror ? " (mirrored)" : "");
+    return ESP_OK;
+}
+
+static void doa_result_json(cJSON *obj, const doa_result_t *r)
+{
+    cJSON_AddBoolToObject(obj, "valid", r->valid);
+    cJSON_AddNumberToObject(obj, "angle_deg", r->angle_deg);
+    cJSON_AddNumberToObject(obj, "lag_samples", r->lag_samples);
+    cJSON_AddNumberToObject(obj, "coherence", r->coherence);
+    cJSON_AddNumberToObject(obj, "frames", r->frames);
+    cJSON_AddNumberToObject(obj, "cycles", r->cycles);
+    cJSON_AddNumberToObject(obj, "ms", perf_cycles_to_us(r->cycles) / 1000.0f);
+}
+
+static esp_err_t doa_send_json(httpd_req_t *req, cJSON *response)
+{
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+static esp_err_t doa_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[128];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        if (!json) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
+            return ESP_OK;
+        }
+        cJSON *spacing = cJSON_GetObjectItem(json, "spacing_mm");
+        cJSON *axis = cJSON_GetObjectItem(json, "axis_led");
+        cJSON *mirror = cJSON_GetObjectItem(json, "mirror");
+        bool estimate = cJSON_IsTrue(cJSON_GetObjectItem(json, "estimate"));
+        bool changed = false;
+        if (cJSON_IsNumber(spacing) && spacing->valueint >= 10 && spacing->valueint <= 500) {
+            s_spacing_mm = spacing->valueint;
+            changed = true;
+        }
+        if (cJSON_IsNumber(axis) && axis->valueint >= 0 && axis->valueint <= 255) {
+            s_axis_led = axis->valueint;
+            changed = true;
+        }
+        if (cJSON_IsBool(mirror)) {
+            s_mirror = cJSON_IsTrue(mirror);
+            changed = true;
+        }
+        cJSON_Delete(json);
+        if (changed) {
+            doa_save_config();
+        }
+        if (estimate) {
+            if (!s_task) {
+                httpd_resp_set_status(req, "409 Conflict");
+                httpd_resp_sendstr(req, "{\"error\":\"DOA not available\"}");
+                return ESP_OK;
+            }
+            doa_request();
+            httpd_resp_set_status(req, "202 Accepted");
+        }
+    }
+
+    doa_result_t latest;
+    bool fresh = doa_latest(&latest);
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "available", s_task != NULL);
+    cJSON *last = cJSON_AddObjectToObject(response, "latest");
+    doa_result_json(last, &latest);
+    cJSON_AddBoolToObject(last, "fresh", fresh);
+    cJSON_AddNumberToObject(last, "age_ms", latest.time_us ? (esp_timer_get_time() - latest.time_us) / 1000 : -1);
+
+    cJSON *config = cJSON_AddObjectToObject(response, "mounting");
+    cJSON_AddNumberToObject(config, "spacing_mm", s_spacing_mm);
+    cJSON_AddNumberToObject(config, "axis_led", s_axis_led);
+    cJSON_AddBoolToObject(config, "mirror", s_mirror);
+    cJSON_AddNumberToObject(config, "max_lag_samples", doa_max_lag());
+
+    cJSON *cost = cJSON_AddObjectToObject(response, "estimates");
+    cJSON_AddNumberToObject(cost, "requests", s_stats.requests);
+    cJSON_AddNumberToObject(cost, "valid", s_stats.valid);
+    cJSON_AddNumberToObject(cost, "unavailable", s_stats.unavailable);
+    cJSON_AddNumberToObject(cost, "frames_avg", perf_counter_avg(&s_stats.frames));
+    cJSON_AddNumberToObject(cost, "cycles_avg", perf_counter_avg(&s_stats.cycles));
+    cJSON_AddNumberToObject(cost, "cycles_max", s_stats.cycles.max);
+    cJSON_AddNumberToObject(cost, "ms_avg", perf_cycles_to_us(perf_counter_avg(&s_stats.cycles)) / 1000.0f);
+    cJSON_AddNumberToObject(cost, "ms_max", perf_cycles_to_us(s_stats.cycles.max) / 1000.0f);
+    return doa_send_json(req, response);
+}
+
+// Find a RIFF chunk; returns its payload or NULL
+static const uint8_t *wav_chunk(const uint8_t *wav, size_t len, const char *id, uint32_t *size)
+{
+    size_t pos = 12;
+    while (pos + 8 <= len) {
+        uint32_t chunk = wav[pos + 4] | wav[pos + 5] << 8 | wav[pos + 6] << 16 | (uint32_t)wav[pos + 7] << 24;
+        if (memcmp(wav + pos, id, 4) == 0) {
+            *size = chunk <= len - pos - 8 ? chunk : len - pos - 8;
+            return wav + pos + 8;
+        }
+        // A size running past the body would wrap pos on a 32-bit size_t
+        if (chunk > len - pos - 8) {
+            break;
+        }
+        pos += 8 + chunk + (chunk & 1);
+    }
+    return NULL;
+}
+
+// Score a recorded clip: 16 kHz 16-bit WAV with mic 1 and mic 2 in the first two channels
+static esp_err_t doa_eval_handler(httpd_req_t *req)
+{
+    size_t max_len = 256 + (size_t)DOA_EVAL_MAX_FRAMES * DOA_EVAL_MAX_CHANNELS * sizeof(int16_t);
+    if (!s_corr) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_sendstr(req, "{\"error\":\"DOA not available\"}");
+        return ESP_OK;
+    }
+    if (req->content_len < 44 || req->content_len > max_len) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "WAV too short or too long");
+        return ESP_OK;
+    }
+    uint8_t *wav = heap_caps_malloc(req->content_len, MALLOC_CAP_SPIRAM);
+    if (!wav) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    size_t got = 0;
+    int timeouts = 0;
+    while (got < req->content_len) {
+        int ret = httpd_req_recv(req, (char *)wav + got, req->content_len - got);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts <= DOA_EVAL_RECV_TIMEOUTS) {
+            continue;
+        }
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            free(wav);
+            httpd_resp_send_err(req, HTTPD_408_REQ_TIMEOUT, "WAV upload stalled");
+            return ESP_FAIL;
+        }
+        if (ret <= 0) {
+            free(wav);
+            return ESP_FAIL;
+        }
+        got += ret;
+    }
+
+    uint32_t fmt_size = 0, data_size = 0;
+    const uint8_t *fmt = memcmp(wav, "RIFF", 4) == 0 ? wav_chunk(wav, got, "fmt ", &fmt_size) : NULL;
+    const uint8_t *data = fmt ? wav_chunk(wav, got, "data", &data_size) : NULL;
+    int channels = fmt && fmt_size >= 16 ? fmt[2] | fmt[3] << 8 : 0;
+    uint32_t rate = fmt && fmt_size >= 16 ? fmt[4] | fmt[5] << 8 | fmt[6] << 16 | (uint32_t)fmt[7] << 24 : 0;
+    int bits = fmt && fmt_size >= 16 ? fmt[14] | fmt[15] << 8 : 0;
+    if (!data || channels < 2 || channels > DOA_EVAL_MAX_CHANNELS || rate != DOA_RATE || bits != 16) {
+        free(wav);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Need a 16 kHz 16-bit WAV with at least two channels");
+        return ESP_OK;
+    }
+
+    // The data chunk may sit at an odd offset; copy it to aligned memory
+    int frames = data_size / (channels * sizeof(int16_t));
+    int16_t *pcm = heap_caps_malloc(frames * channels * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    if (!pcm) {
+        free(wav);
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    memcpy(pcm, data, frames * channels * sizeof(int16_t));
+    free(wav);
+
+    doa_result_t result;
+    esp_err_t err = doa_estimate(pcm, channels, frames, &result);
+    free(pcm);
+    if (err != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Clip shorter than one frame");
+        return ESP_OK;
+    }
+    cJSON *response = cJSON_CreateObject();
+    doa_result_json(response, &result);
+    return doa_send_json(req, response);
+}
+
+esp_err_t doa_register_http(httpd_handle_t server)
+{
+    httpd_uri_t doa_get_uri = {
+        .uri = "/api/doa",
+        .method = HTTP_GET,
+        .handler = doa_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &doa_get_uri);
+
+    httpd_uri_t doa_post_uri = {
+        .uri = "/api/doa",
+        .method = HTTP_POST,
+        .handler = doa_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &doa_post_uri);
+
+    httpd_uri_t doa_eval_uri = {
+        .uri = "/api/doa/eval",
+        .method = HTTP_POST,
+        .handler = doa_eval_handler,
+        .user_ctx = NULL
+    };
+    return http_workers_register(server, &doa_eval_uri);     // upload and estimate
+}
@@ -0,0 +1,220 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Worker pool for HTTP handlers that can block.
+//
+// esp_http_server runs handlers on its one server task, so a handler that
+// waits on a slow client's body, an NVS commit or an LED refresh stops every
+// other connection -- including the web UI page and the live push socket --
+// until it returns. Handlers registered with http_workers_register() are
+// instead detached from the server task with httpd_req_async_handler_begin()
+// and put on a bounded queue served by HTTP_WORKERS tasks; the server task
+// goes straight back to its sockets. When the queue is full the request is
+// answered 503 with Retry-After on the spot rather than piling up.
+//
+// Each route records how long requests waited in the queue and how long the
+// handler took; both are served at /api/http, and every response carries the
+// queue wait as a Server-Timing header for tools/http_load.py.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "http_workers.h"
+
+static const char *TAG = "HTTP_WORKERS";
+
+typedef struct {
+    const char *uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t *req);
+    void *user_ctx;
+    uint32_t rejected;                  // 503s
+    uint32_t failed;                    // handler returned an error
+    perf_counter_t wait_us;             // queued until a worker picked it up
+    perf_counter_t service_us;          // handler run time
+} http_route_t;
+
+typedef struct {
+    httpd_req_t *req;                   // async copy, owned by the worker
+    http_route_t *route;
+    int64_t queued_us;
+} http_work_t;
+
+static portMUX_TYPE s_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static QueueHandle_t s_queue = NULL;
+static http_route_t s_routes[HTTP_ROUTES_MAX];
+static int s_route_count = 0;
+static volatile bool s_busy[HTTP_WORKERS];
+static int s_queue_peak = 0;
+
+static void http_worker_task(void *arg)
+{
+    int index = (int)arg;
+    http_work_t work;
+    char timing[32];
+
+    while (1) {
+        if (xQueueReceive(s_queue, &work, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        s_busy[index] = true;
+        int64_t start = esp_timer_get_time();
+        uint32_t wait_us = start - work.queued_us;
+        http_route_t *route = work.route;
+
+        snprintf(timing, sizeof(timing), "queue;dur=%.1f", wait_us / 1000.0f);
+        httpd_resp_set_hdr(work.req, "Server-Timing", timing);
+        work.req->user_ctx = route->user_ctx;
+        esp_err_t err = route->handler(work.req);
+        if (err != ESP_OK) {
+            // As the server would after a failed handler: drop the connection
+            httpd_sess_trigger_close(work.req->handle, httpd_req_to_sockfd(work.req));
+        }
+        uint32_t service_us = esp_timer_get_time() - start;
+        httpd_req_async_handler_complete(work.req);
+
+        portENTER_CRITICAL(&s_stats_mux);
+        perf_counter_add(&route->wait_us, wait_us);
+        perf_counter_add(&route->service_us, service_us);
+        if (err != ESP_OK) {
+            route->failed++;
+        }
+        portEXIT_CRITICAL(&s_stats_mux);
+        s_busy[index] = false;
+    }
+}
+
+// Runs on the server task: hand the request over and return at once
+static esp_err_t http_workers_dispatch(httpd_req_t *req)
+{
+    http_route_t *route = (http_route_t *)req->user_ctx;
+
+    // Only the server task enqueues, so a free slot stays free until the send
+    int waiting = HTTP_WORK_QUEUE_LEN - (int)uxQueueSpacesAvailable(s_queue);
+    if (waiting >= HTTP_WORK_QUEUE_LEN) {
+        route->rejected++;
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\":\"busy\"}");
+        return ESP_OK;
+    }
+    if (waiting + 1 > s_queue_peak) {
+        s_queue_peak = waiting + 1;
+    }
+
+    http_work_t work = { .route = route, .queued_us = esp_timer_get_time() };
+    esp_err_t err = httpd_req_async_handler_begin(req, &work.req);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: async begin failed: %s", route->uri, esp_err_to_name(err));
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    xQueueSend(s_queue, &work, 0);
+    return ESP_OK;
+}
+
+esp_err_t http_workers_start(void)
+{
+    if (s_queue) {
+        return ESP_OK;
+    }
+    s_queue = xQueueCreate(HTTP_WORK_QUEUE_LEN, sizeof(http_work_t));
+    if (!s_queue) {
+        return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < HTTP_WORKERS; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "http_worker%d", i);
+        if (xTaskCreatePinnedToCore(&http_worker_task, name, HTTP_WORKER_STACK, (void *)i,
+                                    HTTP_WORKER_PRIORITY, NULL, 0) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create %s", name);
+            return i > 0 ? ESP_OK : ESP_ERR_NO_MEM;
+        }
+    }
+    ESP_LOGI(TAG, "%d HTTP workers, queue of %d", HTTP_WORKERS, HTTP_WORK_QUEUE_LEN);
+    return ESP_OK;
+}
+
+esp_err_t http_workers_register(httpd_handle_t server, const httpd_uri_t *uri)
+{
+    // Without the pool fall back to running on the server task
+    if (!s_queue || s_route_count >= HTTP_ROUTES_MAX) {
+        ESP_LOGW(TAG, "%s runs on the server task", uri->uri);
+        return httpd_register_uri_handler(server, uri);
+    }
+    http_route_t *route = &s_routes[s_route_count++];
+    route->uri = uri->uri;
+    route->method = uri->method;
+    route->handler = uri->handler;
+    route->user_ctx = uri->user_ctx;
+
+    httpd_uri_t async_uri = *uri;
+    async_uri.handler = http_workers_dispatch;
+    async_uri.user_ctx = route;
+    return httpd_register_uri_handler(server, &async_uri);
+}
+
+static void http_counter_json(cJSON *parent, const char *name, const perf_counter_t *c)
+{
+    cJSON *obj = cJSON_AddObjectToObject(parent, name);
+    cJSON_AddNumberToObject(obj, "avg", perf_counter_avg(c) / 1000.0);
+    cJSON_AddNumberToObject(obj, "max", c->max / 1000.0);
+}
+
+static esp_err_t http_stats_handler(httpd_req_t *req)
+{
+    int busy = 0;
+    for (int i = 0; i < HTTP_WORKERS; i++) {
+        busy += s_busy[i];
+    }
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddNumberToObject(response, "workers", HTTP_WORKERS);
+    cJSON_AddNumberToObject(response, "busy", busy);
+    cJSON_AddNumberToObject(response, "queue_len", HTTP_WORK_QUEUE_LEN);
+    cJSON_AddNumberToObject(response, "queued", s_queue ? uxQueueMessagesWaiting(s_queue) : 0);
+    cJSON_AddNumberToObject(response, "queue_peak", s_queue_peak);
+
+    cJSON *routes = cJSON_AddArrayToObject(response, "routes");
+    for (int i = 0; i < s_route_count; i++) {
+        http_route_t *route = &s_routes[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "uri", route->uri);
+        cJSON_AddStringToObject(item, "method", http_method_str(route->method));
+        cJSON_AddNumberToObject(item, "count", route->service_us.count);
+        cJSON_AddNumberToObject(item, "rejected", route->rejected);
+        cJSON_AddNumberToObject(item, "failed", route->failed);
+        http_counter_json(item, "wait_ms", &route->wait_us);
+        http_counter_json(item, "service_ms", &route->service_us);
+        cJSON_AddItemToArray(routes, item);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t http_workers_register_http(httpd_handle_t server)
+{
+    httpd_uri_t http_uri = {
+        .uri = "/api/http",
+        .method = HTTP_GET,
+        .handler = http_stats_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &http_uri);
+}
@@ -0,0 +1,24 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _ADPCM_H_
+#define _ADPCM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Mono IMA-ADPCM in WAV-style blocks: a 4-byte header (first sample as
+// int16 LE, step index, reserved) followed by 4-bit codes, low nibble first.
+// tools/mkprompts.py has the matching encoder.
+#define ADPCM_BLOCK_BYTES       256
+#define ADPCM_BLOCK_SAMPLES     (1 + (ADPCM_BLOCK_BYTES - 4) * 2)
+
+// Decode one block (the last one of a stream may be shorter) into out,
+// which must hold ADPCM_BLOCK_SAMPLES. Returns the number of samples.
+int adpcm_decode_block(const uint8_t *in, size_t bytes, int16_t *out);
+
+#endif
@@ -0,0 +1,49 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _AEC_REFERENCE_H_
+#define _AEC_REFERENCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define AEC_REF_RATE            16000
+#define AEC_REF_RING_SAMPLES    4096    // 256 ms, power of two
+#define AEC_MAX_DELAY_MS        100     // calibrated offset, either direction
+#define AEC_NVS_NS              "aec"
+
+// True when this board has a playback path to take a reference from
+bool aec_reference_available(void);
+
+// Load the calibrated delay from NVS
+esp_err_t aec_reference_init(void);
+
+// Audio engine: one mixed block whose first sample plays out at play_us
+// (esp_timer clock). continuous is false for the first block after idle or
+// an underrun, which re-anchors the block against the microphone clock.
+void aec_reference_write(const int16_t *pcm, int samples, int64_t play_us, bool continuous);
+
+// feed_Task: copy the first mics of each board frame into afe_in and put the
+// reference in channel `mics` (afe_in has `total` channels per frame)
+void aec_reference_feed(const int16_t *board, int board_channels, int16_t *afe_in, int mics, int total,
+                        int samples);
+
+// feed_Task: AFE feed() cost for one chunk with the reference channel
+void aec_reference_record_feed(uint32_t cycles, int samples);
+
+// feed_Task: the AFE was recreated, buffered samples were dropped
+void aec_reference_resync(void);
+
+// detect_Task: processed AFE output, for ERLE
+void aec_reference_fetched(const int16_t *out, int samples);
+
+// GET/POST /api/aec
+esp_err_t aec_reference_register_http(httpd_handle_t server);
+
+#endif
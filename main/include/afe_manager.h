@@ -0,0 +1,96 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _AFE_MANAGER_H_
+#define _AFE_MANAGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_afe_sr_iface.h"
+#include "esp_http_server.h"
+#include "model_path.h"
+#include "perf_monitor.h"
+#include "afe_profiles.h"
+
+typedef enum {
+    AFE_MODE_FULL = 0,  // active profile
+    AFE_MODE_LIGHT,     // "low-power" profile while the room is quiet
+    AFE_MODE_COUNT,
+} afe_run_mode_t;
+
+// Heap taken by one AFE instance
+typedef struct {
+    int32_t internal_bytes;
+    int32_t psram_bytes;
+    uint32_t create_ms;
+} afe_footprint_t;
+
+// Counters accumulated while a mode is active
+typedef struct {
+    uint64_t time_us;                       // time spent in this mode
+    uint64_t cpu_window_us;                 // time covered by CPU load accounting
+    uint64_t busy_us[portNUM_PROCESSORS];   // non-idle time per core
+    uint32_t entries;                       // times this mode was entered
+    uint32_t frames;                        // AFE frames fetched
+    uint32_t wake_detected;
+    uint32_t wake_verified;
+    uint32_t commands;                      // recognized commands after a wake
+    uint32_t unknown;                       // multinet results with no matching command
+    uint32_t timeouts;                      // wakes that ended without a command
+    uint32_t create_ms;                     // last AFE create time when entering this mode
+    perf_counter_t feed;                    // cycles spent in afe->feed()
+    perf_counter_t fetch_latency_us;        // time from feed() of a sample to its fetch()
+} afe_mode_stats_t;
+
+// Create the AFE from the given profile and start the adaptive policy task
+esp_err_t afe_manager_init(srmodel_list_t *models, const afe_profile_t *profile);
+
+esp_afe_sr_iface_t *afe_manager_handle(void);
+
+// Bumped every time the AFE instance is recreated
+uint32_t afe_manager_generation(void);
+
+// Called at the top of every feed/detect loop iteration. Blocks while the
+// AFE is being recreated and returns the instance to use afterwards.
+esp_afe_sr_data_t *afe_manager_feed_checkpoint(void);
+esp_afe_sr_data_t *afe_manager_detect_checkpoint(void);
+
+// Statistics hooks from feed_Task / detect_Task
+void afe_manager_record_feed(uint32_t cycles, int samples);
+void afe_manager_observe(const afe_fetch_result_t *res, bool listening);
+void afe_manager_record_command(bool recognized);
+void afe_manager_record_timeout(void);
+
+// Recreate the AFE in the given mode (pauses feed/detect while doing so)
+esp_err_t afe_manager_switch(afe_run_mode_t mode);
+
+// Recreate the AFE in full mode with a new active profile. The optional
+// footprint receives the heap used by the new instance.
+esp_err_t afe_manager_set_profile(const afe_profile_t *profile, afe_footprint_t *footprint);
+
+// Park feed/detect and destroy the live AFE so the speech benchmark can run
+// its own instances. Everything else that needs the AFE times out until
+// afe_manager_resume_live() is called from the same task.
+esp_err_t afe_manager_suspend(void);
+void afe_manager_resume_live(void);
+
+// afe_config_t for a profile, with the board overrides applied
+void afe_manager_build_config(afe_config_t *cfg, const afe_profile_t *profile);
+
+afe_run_mode_t afe_manager_mode(void);
+bool afe_manager_adaptive(void);
+void afe_manager_set_adaptive(bool enable);
+void afe_manager_get_stats(afe_run_mode_t mode, afe_mode_stats_t *out);
+
+// Measurement window used by the profile benchmark
+void afe_manager_reset_window(void);
+void afe_manager_window_latency(perf_counter_t *out);
+
+esp_err_t afe_manager_register_http(httpd_handle_t server);
+
+#endif
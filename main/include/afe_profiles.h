@@ -0,0 +1,56 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _AFE_PROFILES_H_
+#define _AFE_PROFILES_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_afe_sr_iface.h"
+#include "esp_http_server.h"
+
+#define AFE_PROFILE_NAME_LEN 16
+#define AFE_MAX_PROFILES     6
+#define AFE_LIGHT_PROFILE    "low-power"
+
+// Everything app_main used to hard-code in afe_config
+typedef struct {
+    char name[AFE_PROFILE_NAME_LEN];
+    afe_memory_alloc_mode_t memory_alloc_mode;
+    afe_sr_mode_t afe_mode;
+    det_mode_t wakenet_mode;
+    vad_mode_t vad_mode;
+    bool aec_init;
+    bool se_init;
+    uint8_t mic_num;
+} afe_profile_t;
+
+// Result of the last benchmark run for one profile
+typedef struct {
+    bool valid;
+    float cpu_percent[portNUM_PROCESSORS];
+    int32_t internal_bytes;     // internal RAM taken by the AFE instance
+    int32_t psram_bytes;        // PSRAM taken by the AFE instance
+    uint32_t create_ms;
+    uint32_t latency_avg_us;    // feed -> fetch latency
+    uint32_t latency_max_us;
+    uint32_t frames;
+} afe_profile_bench_t;
+
+// Load the profile table and active profile name from NVS
+esp_err_t afe_profiles_init(void);
+
+const afe_profile_t *afe_profiles_active(void);
+const afe_profile_t *afe_profiles_find(const char *name);
+
+// Recreate the running AFE with the named profile and remember it in NVS
+esp_err_t afe_profiles_select(const char *name);
+
+esp_err_t afe_profiles_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,82 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _AUDIO_ENGINE_H_
+#define _AUDIO_ENGINE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "phrase_synth.h"
+#include "tone_synth.h"
+
+#define AUDIO_ENGINE_RATE       16000
+#define AUDIO_ENGINE_BLOCK_MS   10
+#define AUDIO_ENGINE_BLOCK      (AUDIO_ENGINE_RATE * AUDIO_ENGINE_BLOCK_MS / 1000)
+#define AUDIO_ENGINE_QUEUE_LEN  8
+#define AUDIO_RAMP_MS           20      // gain changes, fade-in and fade-out
+#define AUDIO_DUCK_GAIN         0.25f   // other voices while a ducking voice plays
+
+// Boards with a speaker path; elsewhere the engine is not started
+#if defined CONFIG_ESP32_S3_KORVO_1_V4_0_BOARD || defined CONFIG_ESP32_S3_KORVO_2_V3_0_BOARD || \
+    defined CONFIG_ESP32_KORVO_V1_1_BOARD || defined CONFIG_ESP32_S3_BOX_BOARD
+#define AUDIO_ENGINE_AVAILABLE  1
+#else
+#define AUDIO_ENGINE_AVAILABLE  0
+#endif
+
+// Mixer voices; each plays one source at a time
+typedef enum {
+    AUDIO_VOICE_PROMPT = 0,     // wake chime, spoken confirmations
+    AUDIO_VOICE_ALERT,          // countdown beeps and timer alarms
+    AUDIO_VOICE_COUNT
+} audio_voice_t;
+
+typedef enum {
+    AUDIO_SOURCE_PROMPT = 0,    // clip from the prompt pack
+    AUDIO_SOURCE_PHRASE,        // word clips stitched by phrase_synth
+    AUDIO_SOURCE_PCM,           // caller's buffer, must stay valid while the voice is busy
+    AUDIO_SOURCE_TONE,          // pattern generated by tone_synth
+} audio_source_kind_t;
+
+typedef struct {
+    audio_source_kind_t kind;
+    union {
+        uint16_t prompt_id;
+        phrase_t phrase;
+        tone_id_t tone;
+        struct {
+            const int16_t *data;
+            uint32_t samples;
+        } pcm;
+    };
+} audio_source_t;
+
+typedef struct {
+    audio_voice_t voice;
+    uint8_t priority;           // equal or higher preempts what the voice is playing
+    float gain;                 // 0..1
+    bool duck;                  // lower the other voices while this one plays
+    audio_source_t source;
+} audio_play_t;
+
+// Start the engine task; sources must be at AUDIO_ENGINE_RATE, mono
+esp_err_t audio_engine_init(void);
+
+// Queue a sound without waiting. ESP_ERR_TIMEOUT when the queue is full.
+esp_err_t audio_engine_play(const audio_play_t *req);
+
+// Fade out whatever the voice is playing
+esp_err_t audio_engine_stop(audio_voice_t voice);
+
+bool audio_engine_busy(audio_voice_t voice);
+
+// GET /api/audio/engine
+esp_err_t audio_engine_register_http(httpd_handle_t server);
+
+#endif
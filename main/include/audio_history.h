@@ -0,0 +1,45 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _AUDIO_HISTORY_H_
+#define _AUDIO_HISTORY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define AUDIO_HISTORY_SECONDS   10      // at least; rounded up to a power-of-two frame count
+
+typedef enum {
+    AUDIO_CAPTURE_WAKE = 0,     // wake word detected
+    AUDIO_CAPTURE_TIMEOUT,      // multinet timed out without a command
+    AUDIO_CAPTURE_REASON_COUNT,
+} audio_capture_reason_t;
+
+// Allocate the PSRAM ring for the raw interleaved microphone feed
+esp_err_t audio_history_init(int channels, int sample_rate);
+
+// Producer side, called from feed_Task only. Copies frames (interleaved,
+// one sample per channel) into the ring without taking any lock.
+void audio_history_write(const int16_t *data, int frames);
+
+// Frames ever written; the newest frame in the ring is head - 1
+uint32_t audio_history_head(void);
+int audio_history_channels(void);
+
+// Copy the interleaved frames [end - frames, end) out of the ring. False when
+// they are not written yet, already overwritten, or lapped during the copy.
+bool audio_history_read(int16_t *dst, uint32_t end, uint32_t frames);
+
+// Record an event; with auto-capture on, the audio around it is copied
+// out of the ring into a capture slot
+void audio_history_mark(audio_capture_reason_t reason);
+
+esp_err_t audio_history_register_http(httpd_handle_t server);
+
+#endif
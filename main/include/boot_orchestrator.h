@@ -0,0 +1,57 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _BOOT_ORCHESTRATOR_H_
+#define _BOOT_ORCHESTRATOR_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define BOOT_MAX_STAGES         16
+#define BOOT_TASK_PRIORITY      4
+#define BOOT_HISTORY_LEN        8       // boots kept in NVS for the time-to-voice trend
+#define BOOT_HISTORY_DELAY_MS   3000    // after voice ready, when the trend is written
+#define BOOT_NVS_NS             "boot"
+
+#define BOOT_DEP(index)         (1u << (index))
+
+typedef esp_err_t (*boot_stage_fn)(void);
+
+typedef struct {
+    const char *name;
+    boot_stage_fn fn;
+    uint32_t deps;              // BOOT_DEP() of earlier entries that must have succeeded
+    uint32_t after;             // earlier entries that only have to be finished, ok or not
+    int core;                   // tskNO_AFFINITY or 0/1
+    uint32_t stack;             // bytes
+} boot_stage_t;
+
+// Points in time measured once per boot, independent of the stage table
+typedef enum {
+    BOOT_MILESTONE_VOICE_READY,     // first AFE frame fetched, wake word can be heard
+    BOOT_MILESTONE_FIRST_WAKE,
+    BOOT_MILESTONE_WIFI_CONNECTED,
+    BOOT_MILESTONE_PIXELS_RESTORED, // warm restart: the running timer repainted
+    BOOT_MILESTONE_COUNT
+} boot_milestone_t;
+
+// Start every stage in its own task. A stage runs once all of `deps` and
+// `after` have finished; if one of `deps` failed it is skipped. The table must stay
+// valid until the boot is over. Returns without waiting.
+esp_err_t boot_run(const boot_stage_t *stages, int count);
+
+// Record a milestone the first time it is reached; later calls are ignored
+void boot_milestone(boot_milestone_t milestone);
+
+// Milliseconds since reset at which the milestone was reached, -1 if not yet
+int32_t boot_milestone_ms(boot_milestone_t milestone);
+
+// GET /api/boot
+esp_err_t boot_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,61 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _DOA_H_
+#define _DOA_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// tools/doa_eval.py reads these defines; keep them plain numbers
+#define DOA_RATE                16000
+#define DOA_FFT_SIZE            512     // per frame, 32 ms
+#define DOA_HOP                 256
+#define DOA_UPSAMPLE            4       // correlation evaluated at 1/4-sample lags
+#define DOA_MIN_HZ              250
+#define DOA_MAX_HZ              4000
+#define DOA_GATE_DB             20      // frames this far below the loudest are skipped
+#define DOA_MIN_COHERENCE       0.15f   // weaker peaks are reported as invalid
+#define DOA_WINDOW_MS           800     // audio before the wake detection
+#define DOA_MAX_FRAMES          192     // 3 s, the eval upload limit
+#define DOA_MIC_SPACING_MM      65      // default, set per device with POST /api/doa
+#define DOA_SOUND_SPEED         343.0f
+#define DOA_RESULT_TTL_MS       10000   // the listening arc uses estimates this recent
+#define DOA_NVS_NS              "doa"
+
+typedef struct {
+    bool valid;
+    float angle_deg;            // 0 = source beyond mic 1 on the mic axis, 180 = beyond mic 2
+    float lag_samples;          // mic 2 relative to mic 1
+    float coherence;            // 0..1, normalised GCC-PHAT peak
+    uint32_t frames;            // frames that passed the energy gate
+    uint32_t cycles;
+    int64_t time_us;            // when the estimate was made
+} doa_result_t;
+
+// Needs at least two microphone channels in the audio history
+esp_err_t doa_init(int channels);
+
+// detect_Task, on wake: estimate from the DOA_WINDOW_MS just before now in the
+// background. Never blocks.
+void doa_request(void);
+
+// Latest estimate; false when none is valid or it is older than DOA_RESULT_TTL_MS
+bool doa_latest(doa_result_t *out);
+
+// GCC-PHAT over interleaved frames, mics in channels 0 and 1
+esp_err_t doa_estimate(const int16_t *pcm, int channels, int frames, doa_result_t *out);
+
+// LED facing the estimate on a ring of `leds`, using the configured mounting
+int doa_ring_position(const doa_result_t *result, int leds);
+
+// GET/POST /api/doa, POST /api/doa/eval (stereo WAV body)
+esp_err_t doa_register_http(httpd_handle_t server);
+
+#endif
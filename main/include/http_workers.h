@@ -0,0 +1,31 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _HTTP_WORKERS_H_
+#define _HTTP_WORKERS_H_
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define HTTP_WORKERS            2
+#define HTTP_WORK_QUEUE_LEN     6       // requests waiting for a worker; more get a 503
+#define HTTP_WORKER_STACK       (6 * 1024)
+#define HTTP_WORKER_PRIORITY    4       // below the server task, so it keeps accepting
+#define HTTP_ROUTES_MAX         16
+
+// Create the queue and the workers. Call before http_workers_register().
+esp_err_t http_workers_start(void);
+
+// Register a handler to run on a worker instead of the server task. The
+// handler is written as usual: it sees its own user_ctx and may block on
+// recv, NVS or the LEDs without holding up other clients.
+esp_err_t http_workers_register(httpd_handle_t server, const httpd_uri_t *uri);
+
+// GET /api/http
+esp_err_t http_workers_register_http(httpd_handle_t server);
+
+#endif
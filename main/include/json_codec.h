@@ -0,0 +1,115 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _JSON_CODEC_H_
+#define _JSON_CODEC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define JSON_MAX_DEPTH          8       // nesting allowed, including skipped values
+#define JSON_WRITER_MAX_DEPTH   16
+
+typedef enum {
+    JSON_INT,                   // signed or unsigned integer member of 1, 2 or 4 bytes
+    JSON_BOOL,                  // bool member
+    JSON_STRING,                // char array member, NUL-terminated
+    JSON_OBJECT,                // nested object; its fields are relative to this member
+} json_type_t;
+
+typedef enum {
+    JSON_OK = 0,
+    JSON_ERR_SYNTAX,
+    JSON_ERR_TYPE,              // known key with a value of the wrong type
+    JSON_ERR_RANGE,             // integer outside the field's [min, max]
+    JSON_ERR_TOO_LONG,          // string longer than the member
+    JSON_ERR_DEPTH,
+} json_err_t;
+
+// One key of a request schema. Values are written straight into the target
+// struct at `offset`; keys not in the schema are skipped, keys missing from
+// the body leave the member as it was, so fill in defaults before parsing.
+typedef struct json_field {
+    const char *key;
+    json_type_t type;
+    uint16_t offset;
+    uint16_t size;
+    int32_t min;
+    int32_t max;
+    const struct json_field *fields;    // JSON_OBJECT
+    uint8_t field_count;
+} json_field_t;
+
+#define JSON_FIELD_INT(type, member, key, lo, hi) \
+    { key, JSON_INT, offsetof(type, member), sizeof(((type *)0)->member), lo, hi, NULL, 0 }
+#define JSON_FIELD_BOOL(type, member, key) \
+    { key, JSON_BOOL, offsetof(type, member), sizeof(bool), 0, 0, NULL, 0 }
+#define JSON_FIELD_STRING(type, member, key) \
+    { key, JSON_STRING, offsetof(type, member), sizeof(((type *)0)->member), 0, 0, NULL, 0 }
+#define JSON_FIELD_OBJECT(type, member, key, schema) \
+    { key, JSON_OBJECT, offsetof(type, member), sizeof(((type *)0)->member), 0, 0, \
+      schema, sizeof(schema) / sizeof(schema[0]) }
+
+typedef struct {
+    json_err_t err;
+    uint16_t pos;               // byte offset of the error in the body
+    const char *key;            // schema key the error is about, or NULL
+} json_error_t;
+
+// Parse one JSON object from json[0..len) into out. Nothing is allocated and
+// json need not be NUL-terminated. On error out may be partly written.
+json_err_t json_parse(const char *json, size_t len, const json_field_t *schema, size_t field_count,
+                      void *out, json_error_t *error);
+
+const char *json_err_to_name(json_err_t err);
+
+// Response writer into a caller-owned buffer. Keys are ignored inside arrays
+// and for the outermost value. Running out of room is sticky and reported by
+// json_writer_finish().
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t len;
+    bool overflow;
+    uint8_t depth;
+    uint32_t has_items;         // bit per depth: a comma is needed before the next item
+    uint32_t in_array;          // bit per depth: the container is an array
+} json_writer_t;
+
+void json_writer_init(json_writer_t *w, char *buf, size_t size);
+void json_write_object_begin(json_writer_t *w, const char *key);
+void json_write_object_end(json_writer_t *w);
+void json_write_array_begin(json_writer_t *w, const char *key);
+void json_write_array_end(json_writer_t *w);
+void json_write_int(json_writer_t *w, const char *key, int32_t value);
+void json_write_uint(json_writer_t *w, const char *key, uint32_t value);
+void json_write_float(json_writer_t *w, const char *key, float value, int decimals);
+void json_write_bool(json_writer_t *w, const char *key, bool value);
+void json_write_string(json_writer_t *w, const char *key, const char *value);
+
+// Length of the finished document (NUL-terminated in buf), 0 if it did not fit
+size_t json_writer_finish(json_writer_t *w);
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// Read the whole request body into buf, over as many httpd_req_recv() calls
+// as it takes. ESP_ERR_INVALID_SIZE if it is larger than size - 1.
+esp_err_t json_recv_body(httpd_req_t *req, char *buf, size_t size, size_t *len);
+
+// json_recv_body() + json_parse(); on failure the 400/413/500 response has
+// already been sent and the caller just returns.
+esp_err_t json_recv_request(httpd_req_t *req, char *buf, size_t size,
+                            const json_field_t *schema, size_t field_count, void *out);
+
+// Send a finished writer as application/json, or a 500 if it overflowed
+esp_err_t json_send(httpd_req_t *req, json_writer_t *w);
+#endif
+
+#endif
@@ -0,0 +1,62 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _LIVE_PUSH_H_
+#define _LIVE_PUSH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define LIVE_MAX_CLIENTS        4
+#define LIVE_SAMPLE_MS          100     // state is polled this often
+#define LIVE_MIN_INTERVAL_MS    100     // at most one frame per client this often
+#define LIVE_FRAME_MAX          256
+#define LIVE_EVENT_QUEUE        8
+#define LIVE_DETAIL_LEN         24
+#define LIVE_NAME_LEN           32
+
+// Device state as the web UI sees it. Frames carry only the fields that
+// changed since the last frame that client received:
+//   {"s":seq,"a":active,"p":paused,"r":remaining_s,"d":total_s,"n":"name","l":led_state,
+//    "e":[["wake",""],["command","start timer"]]}
+typedef struct {
+    bool active;
+    bool paused;
+    int32_t remaining_s;
+    int32_t total_s;
+    uint8_t led_state;
+    char name[LIVE_NAME_LEN];
+} live_state_t;
+
+typedef enum {
+    LIVE_EVENT_WAKE,
+    LIVE_EVENT_COMMAND,         // detail: command text
+    LIVE_EVENT_TIMEOUT,
+    LIVE_EVENT_TIMER_DONE,      // detail: timer name
+    LIVE_EVENT_COUNT
+} live_event_t;
+
+// Fill in the current state; called from the push task only
+typedef void (*live_state_fn)(live_state_t *out);
+
+// Start the push task. Without CONFIG_HTTPD_WS_SUPPORT this does nothing.
+esp_err_t live_push_init(live_state_fn sample);
+
+// Queue a one-off event for the next frame. Never blocks; when the queue
+// is full the oldest event is dropped.
+void live_push_event(live_event_t event, const char *detail);
+
+// A server socket was closed; frees its client slot. Call from the
+// server's close_fn.
+void live_push_closed(int fd);
+
+// WebSocket /api/live, GET /api/live/stats
+esp_err_t live_push_register_http(httpd_handle_t server);
+
+#endif
@@ -1,1206 +0,0 @@
-#include <stdio.h>
-const unsigned char me_16_degress[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfc, 0xff, 0xfc, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0x04, 0x00, 0xfe, 0xff, 0x01, 0x00, 
-0x05, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x00, 0x05, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x04, 0x00, 
-0x04, 0x00, 0x01, 0x00, 0xfc, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x01, 0x00, 0xfb, 0xff, 0x01, 0x00, 
-0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x05, 0x00, 0x01, 0x00, 0xff, 0xff, 0xfd, 0xff, 0xf9, 0xff, 
-0xf7, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0x02, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 
-0x09, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x05, 0x00, 0xf9, 0xff, 
-0xec, 0xff, 0xf4, 0xff, 0xeb, 0xff, 0xe7, 0xff, 0xfe, 0xff, 0x11, 0x00, 0x1c, 0x00, 0x1e, 0x00, 
-0x2e, 0x00, 0x31, 0x00, 0x16, 0x00, 0xfc, 0xff, 0x01, 0x00, 0x17, 0x00, 0xf7, 0xff, 0xc2, 0xff, 
-0xe8, 0xff, 0xe5, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xe8, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0x17, 0x00, 
-0x38, 0x00, 0x13, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x12, 0x00, 0xf5, 0xff, 0x02, 0x00, 
-0xd7, 0xff, 0xe3, 0xff, 0x09, 0x00, 0x0d, 0x00, 0x05, 0x00, 0x04, 0x00, 0x08, 0x00, 0x24, 0x00, 
-0x4f, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xf9, 0xff, 
-0xd6, 0xff, 0x07, 0x00, 0x10, 0x00, 0xf0, 0xff, 0xf0, 0xff, 0x37, 0x00, 0x1d, 0x00, 0xdc, 0xff, 
-0x5a, 0x00, 0x80, 0x00, 0x0c, 0x00, 0xa1, 0xff, 0xd5, 0xff, 0x42, 0x00, 0xd1, 0xff, 0x6b, 0xff, 
-0x19, 0x00, 0x1e, 0x00, 0x9d, 0xff, 0xcf, 0xff, 0x27, 0x00, 0x3c, 0x00, 0xd6, 0xff, 0x27, 0x00, 
-0x57, 0x00, 0xf2, 0xff, 0xd9, 0xff, 0xc8, 0xff, 0xf5, 0xff, 0x1f, 0x00, 0xad, 0xff, 0x7b, 0xff, 
-0xe0, 0xff, 0x39, 0x00, 0xa0, 0xff, 0x95, 0xff, 0x4c, 0x00, 0xd8, 0xff, 0x1a, 0x00, 0x1f, 0x00, 
-0xc6, 0xff, 0x22, 0x00, 0x04, 0x00, 0x38, 0x00, 0xe4, 0xff, 0xf8, 0xff, 0x84, 0x00, 0xdc, 0xff, 
-0x04, 0x00, 0xf0, 0xff, 0x0b, 0x00, 0x42, 0x00, 0xf7, 0xff, 0xf2, 0xff, 0xec, 0xff, 0x5f, 0x00, 
-0xee, 0xff, 0x19, 0x00, 0x01, 0x00, 0x40, 0x00, 0x1a, 0x00, 0xb7, 0xff, 0x8b, 0x00, 0x26, 0x00, 
-0x22, 0x00, 0x5b, 0x00, 0xf3, 0xff, 0x0d, 0x00, 0xec, 0xff, 0xda, 0xff, 0xed, 0xff, 0xe0, 0xff, 
-0x75, 0xff, 0xc5, 0xff, 0x0a, 0x00, 0xa9, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x17, 0x00, 0x3b, 0x00, 
-0x3a, 0x00, 0x65, 0x00, 0x68, 0x00, 0x18, 0x00, 0x12, 0x00, 0x46, 0x00, 0x31, 0xff, 0x3c, 0xff, 
-0xe1, 0xff, 0x79, 0xff, 0xf8, 0xff, 0xae, 0xff, 0x56, 0xff, 0x91, 0x00, 0x1c, 0x00, 0x86, 0xff, 
-0x7e, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x97, 0xff, 0xa5, 0xff, 0x19, 0x00, 
-0x46, 0xff, 0xed, 0xff, 0x95, 0xff, 0xe8, 0xff, 0x0d, 0x00, 0x9b, 0xff, 0x97, 0x00, 0xcd, 0xff, 
-0x04, 0x00, 0x6a, 0x00, 0xaa, 0x00, 0x03, 0x00, 0x09, 0x00, 0x3f, 0x00, 0xbe, 0xff, 0xa7, 0xff, 
-0xc8, 0xff, 0xd0, 0xff, 0x68, 0xff, 0x1f, 0x00, 0x3e, 0x00, 0xf3, 0xff, 0xa6, 0xff, 0x6d, 0x00, 
-0x0b, 0x00, 0x0f, 0x00, 0xf8, 0xff, 0x3a, 0x00, 0xf0, 0xff, 0xfe, 0xff, 0x3c, 0x00, 0x6d, 0xff, 
-0x35, 0x00, 0x10, 0x00, 0x0b, 0x00, 0xbc, 0xff, 0x35, 0x00, 0x18, 0x00, 0x8c, 0xff, 0x8b, 0xff, 
-0xe9, 0xff, 0x02, 0x00, 0x5d, 0xff, 0x13, 0x00, 0x24, 0x00, 0xe2, 0xff, 0xd9, 0xff, 0xf4, 0xff, 
-0xff, 0xff, 0xad, 0xff, 0xec, 0xff, 0x26, 0x00, 0xed, 0xff, 0xc7, 0xff, 0x18, 0x00, 0xe0, 0xff, 
-0xcb, 0xff, 0x06, 0x00, 0xbc, 0xff, 0xf7, 0xff, 0xe4, 0xff, 0x6b, 0xff, 0x19, 0x00, 0x86, 0xff, 
-0x59, 0xff, 0x09, 0x00, 0xbc, 0xff, 0x38, 0x00, 0x3e, 0x00, 0x9f, 0xff, 0x4a, 0x00, 0x9d, 0x00, 
-0x8e, 0xff, 0xfc, 0xff, 0x44, 0x00, 0xe8, 0xff, 0x15, 0x00, 0x43, 0x00, 0xa9, 0xff, 0x92, 0xff, 
-0x5a, 0x00, 0x9c, 0xff, 0xbc, 0xff, 0xea, 0xff, 0xed, 0xff, 0x33, 0x00, 0x5f, 0xff, 0xa4, 0x00, 
-0xfd, 0xff, 0x9f, 0xff, 0xd6, 0x00, 0x32, 0x00, 0x6a, 0x00, 0x0f, 0x00, 0x5b, 0x00, 0x8c, 0xff, 
-0xb3, 0x00, 0xdd, 0xff, 0x36, 0xff, 0x12, 0x01, 0x56, 0xff, 0x42, 0x00, 0xdb, 0xff, 0x1d, 0x00, 
-0x49, 0xff, 0xcc, 0xff, 0x0b, 0x01, 0xe0, 0xfe, 0xeb, 0xff, 0xcd, 0x00, 0xcf, 0xff, 0x58, 0x00, 
-0x70, 0x00, 0xad, 0xff, 0xae, 0x00, 0x5d, 0x00, 0xff, 0xff, 0xf6, 0xff, 0xde, 0xff, 0xb2, 0xff, 
-0x76, 0xff, 0x00, 0x00, 0xbe, 0xff, 0x60, 0xff, 0x62, 0x00, 0x00, 0x00, 0x52, 0x00, 0xfc, 0xff, 
-0xc5, 0xff, 0x17, 0x00, 0x6c, 0x00, 0x2a, 0x00, 0x5c, 0xff, 0xc9, 0x00, 0x6b, 0xff, 0x04, 0x00, 
-0x66, 0x00, 0x02, 0xff, 0x48, 0x00, 0xcf, 0xff, 0xe1, 0xff, 0x7c, 0x00, 0x3c, 0xff, 0x33, 0x00, 
-0xc2, 0x00, 0x71, 0xff, 0x0b, 0x00, 0xe6, 0xff, 0x10, 0x00, 0x6e, 0x00, 0x8d, 0xff, 0x99, 0x00, 
-0xa3, 0xff, 0x0f, 0x00, 0x45, 0x00, 0xbf, 0xff, 0x7b, 0x00, 0x0f, 0x00, 0x9d, 0x00, 0x75, 0x00, 
-0xf0, 0xff, 0x9d, 0x00, 0xea, 0xff, 0x3c, 0x00, 0xd9, 0xff, 0x19, 0x00, 0x18, 0x00, 0xd3, 0xff, 
-0x36, 0x00, 0x80, 0xff, 0x91, 0x00, 0x44, 0x00, 0x78, 0xff, 0xf1, 0x00, 0xc2, 0x00, 0x87, 0xff, 
-0xb9, 0x00, 0xcf, 0xff, 0x71, 0xff, 0x8b, 0x00, 0xf7, 0xff, 0x8d, 0xff, 0x07, 0x00, 0xe9, 0xff, 
-0x57, 0x00, 0xe5, 0xff, 0x69, 0xff, 0x58, 0x00, 0xab, 0xff, 0xcf, 0xff, 0x97, 0xff, 0x46, 0x00, 
-0x40, 0x00, 0x9d, 0xff, 0x2b, 0x00, 0x39, 0x00, 0x45, 0x00, 0x73, 0x00, 0x9a, 0xff, 0x38, 0x00, 
-0x5d, 0x00, 0x98, 0xff, 0xc5, 0xff, 0xf7, 0xff, 0xc5, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0x94, 0xff, 
-0x87, 0x00, 0xe5, 0xff, 0x83, 0x00, 0x0b, 0x00, 0x10, 0x00, 0xde, 0xff, 0x3d, 0x00, 0x9e, 0x00, 
-0x98, 0xff, 0x5f, 0x00, 0x5d, 0xff, 0x0a, 0x00, 0xd2, 0xff, 0xe8, 0xff, 0x35, 0x00, 0xac, 0xff, 
-0x4c, 0x00, 0x4b, 0x00, 0x07, 0x00, 0xa1, 0x00, 0xce, 0xff, 0xe1, 0x00, 0x9e, 0xff, 0xf0, 0xff, 
-0x87, 0xff, 0x70, 0xff, 0x60, 0x00, 0xe3, 0xfe, 0x58, 0x00, 0x20, 0x00, 0x2e, 0x00, 0xdb, 0xff, 
-0x8e, 0x00, 0x44, 0x00, 0xa4, 0xff, 0x33, 0x01, 0x80, 0xff, 0xdd, 0x00, 0xf2, 0xff, 0xb1, 0xff, 
-0xd2, 0x00, 0x55, 0xff, 0x17, 0x00, 0x32, 0x00, 0xaa, 0xff, 0x50, 0x00, 0x97, 0xff, 0x82, 0x00, 
-0xfd, 0xff, 0xcb, 0xfe, 0xa7, 0x00, 0x75, 0xff, 0x8a, 0x00, 0xad, 0x00, 0xef, 0xff, 0x26, 0x00, 
-0x33, 0x00, 0x7d, 0xff, 0x5c, 0x00, 0x07, 0x00, 0xaf, 0xff, 0xf1, 0xff, 0x9f, 0x00, 0xdf, 0xff, 
-0xa3, 0xff, 0x02, 0x00, 0x59, 0xff, 0xad, 0x00, 0xe4, 0xff, 0x8e, 0xff, 0x99, 0x00, 0x88, 0xff, 
-0x54, 0x00, 0x50, 0x00, 0x1b, 0xff, 0xd0, 0x00, 0xb0, 0xff, 0xf3, 0xff, 0x95, 0x00, 0xa3, 0xff, 
-0xf5, 0x00, 0xa8, 0xff, 0x37, 0xff, 0xb8, 0x00, 0xd7, 0xff, 0xae, 0x00, 0xbb, 0xff, 0x8f, 0x00, 
-0x75, 0xff, 0x7e, 0xff, 0xaa, 0x00, 0x8b, 0xff, 0x82, 0x00, 0x0b, 0x00, 0xaf, 0xff, 0x50, 0x00, 
-0x19, 0x00, 0xfc, 0xff, 0x94, 0x00, 0x51, 0xff, 0x3a, 0x00, 0x6a, 0x00, 0x21, 0x00, 0xb2, 0xff, 
-0xc7, 0xff, 0x09, 0x00, 0x97, 0xff, 0x45, 0xff, 0xee, 0xff, 0x0f, 0x00, 0x1d, 0x00, 0x94, 0xff, 
-0x87, 0xff, 0x15, 0x01, 0x8a, 0xff, 0x1f, 0x00, 0xc6, 0x00, 0x6e, 0xff, 0x6b, 0x00, 0x55, 0x00, 
-0xef, 0xff, 0x8a, 0xff, 0x83, 0xff, 0xd2, 0x00, 0xcd, 0xff, 0x7a, 0xff, 0x75, 0x00, 0xeb, 0xff, 
-0x8d, 0xff, 0x2f, 0x00, 0x82, 0x00, 0x52, 0x00, 0x97, 0xff, 0x33, 0x00, 0xdc, 0xff, 0x52, 0x00, 
-0xf3, 0xff, 0xc7, 0xff, 0x01, 0x00, 0xc6, 0xff, 0xe8, 0xff, 0x61, 0x00, 0xde, 0xff, 0x0b, 0xff, 
-0x22, 0x00, 0x6a, 0x00, 0x87, 0x00, 0x4b, 0xff, 0x9f, 0xff, 0x85, 0x00, 0x6e, 0x00, 0xca, 0xff, 
-0x09, 0x00, 0x94, 0x00, 0xba, 0xff, 0x1b, 0xff, 0x53, 0x00, 0x13, 0x00, 0xd2, 0xfe, 0x67, 0x00, 
-0xae, 0xff, 0x3e, 0xff, 0xf1, 0x00, 0xa4, 0xff, 0x81, 0xff, 0x2b, 0x01, 0xed, 0xff, 0xa5, 0xff, 
-0x2b, 0x00, 0x4b, 0xff, 0x6c, 0x00, 0x2c, 0x00, 0x52, 0x00, 0x1c, 0x00, 0x0a, 0xff, 0x69, 0x00, 
-0xfc, 0xff, 0x3c, 0x00, 0x55, 0x00, 0xe8, 0xff, 0x61, 0x00, 0x4f, 0x00, 0xe8, 0xfe, 0x87, 0xff, 
-0x00, 0x00, 0xaa, 0xff, 0x51, 0x00, 0x1f, 0x00, 0xa8, 0xff, 0x78, 0x00, 0xee, 0xff, 0x99, 0xff, 
-0xc0, 0x00, 0x61, 0xff, 0xe9, 0xff, 0x64, 0x00, 0x0c, 0x00, 0xbd, 0xff, 0x10, 0x00, 0xc8, 0xff, 
-0xcf, 0xff, 0x3b, 0xff, 0xc9, 0xff, 0x3b, 0x00, 0x7a, 0xff, 0x3e, 0x00, 0xed, 0xff, 0x8f, 0xff, 
-0x3f, 0x00, 0xbf, 0x00, 0x24, 0xff, 0x47, 0x00, 0x39, 0x00, 0x4a, 0xff, 0xe1, 0x00, 0x13, 0x00, 
-0xa6, 0xff, 0xe5, 0xff, 0x51, 0x00, 0x56, 0xff, 0xa0, 0xff, 0x85, 0x00, 0x91, 0xff, 0x91, 0x00, 
-0x55, 0x00, 0x99, 0xfe, 0xd3, 0xff, 0xf1, 0x00, 0x51, 0xff, 0x63, 0x00, 0x51, 0x00, 0x48, 0xff, 
-0x85, 0x00, 0xfb, 0xff, 0x9c, 0xff, 0x24, 0x01, 0x1e, 0xff, 0x50, 0x00, 0x71, 0x00, 0xa1, 0xff, 
-0xa9, 0xff, 0x86, 0xff, 0xfa, 0xff, 0x88, 0xff, 0xde, 0x00, 0x57, 0xff, 0xf8, 0xff, 0x12, 0x00, 
-0xfc, 0xff, 0x1f, 0x00, 0x3c, 0xff, 0xbc, 0xff, 0xf1, 0xff, 0xb9, 0xfe, 0xa6, 0x00, 0xef, 0x00, 
-0x49, 0xff, 0xbd, 0x00, 0xf4, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x3b, 0x00, 0x17, 0xff, 
-0x69, 0x00, 0x1d, 0x01, 0x4f, 0xff, 0xdd, 0xff, 0x3c, 0xff, 0x66, 0x00, 0xe6, 0x00, 0xe0, 0xfe, 
-0x25, 0x00, 0x8b, 0xff, 0x07, 0x00, 0x72, 0x00, 0x0c, 0x00, 0xb9, 0xff, 0xc9, 0xfe, 0xfd, 0x00, 
-0x36, 0x00, 0xae, 0xfe, 0x46, 0x01, 0x49, 0x00, 0x43, 0xff, 0xd2, 0x00, 0x58, 0xff, 0xfe, 0x00, 
-0x35, 0x00, 0x8e, 0xff, 0x43, 0x00, 0x27, 0xff, 0xbc, 0xff, 0x34, 0x00, 0xd2, 0xff, 0x08, 0x00, 
-0x2d, 0x00, 0x59, 0xff, 0x90, 0x00, 0xc8, 0xff, 0x46, 0x00, 0x36, 0x00, 0xdc, 0xff, 0xc9, 0x00, 
-0x7a, 0xff, 0x11, 0x00, 0x9e, 0x00, 0xfa, 0xfe, 0xb0, 0xff, 0xf0, 0xff, 0x85, 0x00, 0xba, 0xff, 
-0x2f, 0x00, 0x36, 0x00, 0x64, 0xff, 0x6b, 0x00, 0x92, 0xff, 0x3e, 0x01, 0x93, 0xff, 0xed, 0xfe, 
-0x29, 0x00, 0xd8, 0xff, 0xc7, 0x00, 0x1c, 0x00, 0xe0, 0xff, 0x49, 0x00, 0x63, 0x00, 0x60, 0xff, 
-0x91, 0xff, 0x95, 0x00, 0xaa, 0xff, 0x42, 0x00, 0x90, 0x00, 0x72, 0xff, 0xf7, 0xff, 0xcb, 0xff, 
-0x1c, 0x01, 0x9f, 0xff, 0xfa, 0xff, 0xcd, 0x00, 0x8b, 0xff, 0xfd, 0xff, 0x13, 0x00, 0x0b, 0x00, 
-0xbb, 0xff, 0x21, 0x00, 0x20, 0xff, 0x80, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x94, 0xff, 0x14, 0x01, 
-0x21, 0x00, 0xf7, 0xff, 0x3c, 0x00, 0x13, 0xff, 0x2e, 0x00, 0x4e, 0x00, 0x9c, 0xff, 0x27, 0x00, 
-0x8f, 0x00, 0xea, 0xff, 0x61, 0x00, 0x5f, 0xff, 0x86, 0x00, 0x74, 0xff, 0x65, 0x00, 0x3f, 0x00, 
-0x68, 0x00, 0x21, 0x00, 0xdd, 0xff, 0x23, 0x00, 0x6f, 0xff, 0xae, 0xff, 0x8b, 0x00, 0xeb, 0xff, 
-0xb1, 0x00, 0xf2, 0xff, 0x17, 0x00, 0x8d, 0xff, 0x78, 0xff, 0x02, 0x01, 0xa6, 0xfe, 0xa8, 0x01, 
-0xaf, 0x00, 0x9a, 0xfe, 0xb4, 0x01, 0xd6, 0xfe, 0x54, 0x00, 0x59, 0x00, 0x2c, 0xff, 0x8b, 0x00, 
-0xe1, 0xfe, 0x17, 0x01, 0x66, 0xff, 0x8e, 0xff, 0x82, 0x01, 0x61, 0xff, 0x16, 0x00, 0xc5, 0xff, 
-0x17, 0x00, 0xa7, 0x00, 0x1b, 0x00, 0xfd, 0xff, 0x8e, 0xff, 0xa8, 0x00, 0x08, 0x00, 0xfd, 0xff, 
-0xc2, 0x00, 0xe6, 0xff, 0xf6, 0xfe, 0x16, 0x00, 0x08, 0x00, 0x80, 0x00, 0x62, 0xff, 0xf1, 0xff, 
-0xd6, 0xff, 0x74, 0x00, 0xe2, 0x00, 0xb5, 0xff, 0xa8, 0xff, 0x12, 0x00, 0x9b, 0xff, 0x27, 0x00, 
-0x06, 0x00, 0x53, 0x00, 0x69, 0x00, 0x5b, 0x00, 0xd8, 0xff, 0x12, 0xff, 0x40, 0x01, 0xe9, 0xff, 
-0xd4, 0xff, 0x11, 0x00, 0x8a, 0x00, 0x4c, 0x00, 0xd3, 0xfe, 0x75, 0x00, 0xb5, 0xff, 0xbb, 0x00, 
-0x33, 0x00, 0x0d, 0xff, 0x65, 0x00, 0x7b, 0xff, 0x95, 0x00, 0x13, 0x00, 0xb9, 0xff, 0xa4, 0x00, 
-0x1d, 0x00, 0xff, 0xff, 0xad, 0xff, 0x25, 0x00, 0x40, 0x00, 0x58, 0xff, 0x58, 0x00, 0xdc, 0xff, 
-0x28, 0x00, 0x08, 0x00, 0xa2, 0xff, 0x86, 0x00, 0xe7, 0x00, 0x3f, 0x00, 0x08, 0xff, 0x99, 0xff, 
-0x81, 0xff, 0xfc, 0xff, 0x96, 0x00, 0x5d, 0xff, 0xc5, 0xff, 0x51, 0x00, 0x1e, 0x00, 0x46, 0x00, 
-0xa4, 0x00, 0x40, 0xff, 0x76, 0x00, 0x4f, 0x01, 0xba, 0xff, 0x66, 0x00, 0x0f, 0x00, 0xf3, 0xfe, 
-0xbf, 0x00, 0xa4, 0xff, 0x80, 0xff, 0x11, 0x00, 0x37, 0xff, 0x94, 0x00, 0x23, 0xff, 0xf0, 0x00, 
-0x67, 0x00, 0x6a, 0xff, 0x69, 0x00, 0x62, 0xff, 0x93, 0x01, 0xc4, 0xff, 0xde, 0xff, 0xac, 0x00, 
-0x37, 0xff, 0xa8, 0x00, 0xd6, 0xff, 0x92, 0xff, 0xc3, 0xff, 0xf6, 0xff, 0xd5, 0xff, 0xee, 0xff, 
-0x9e, 0xff, 0xce, 0xfe, 0x8a, 0x01, 0x8f, 0xff, 0xdd, 0xff, 0x1e, 0x01, 0x46, 0xff, 0x52, 0x01, 
-0x5b, 0x00, 0xa0, 0xff, 0xc8, 0x00, 0xcc, 0xfe, 0x0a, 0x00, 0x92, 0x00, 0x13, 0x00, 0x86, 0xff, 
-0x36, 0xff, 0x2e, 0x00, 0xc5, 0xff, 0xdb, 0xff, 0x1c, 0x00, 0x51, 0x00, 0xc8, 0xff, 0xab, 0x00, 
-0xe5, 0x00, 0xa0, 0xff, 0xa2, 0xff, 0x3b, 0x00, 0x75, 0xff, 0xb5, 0x01, 0xe1, 0xfe, 0x13, 0xff, 
-0xad, 0x01, 0xbe, 0xff, 0xb1, 0x00, 0x11, 0x00, 0x51, 0xff, 0xca, 0xfe, 0x32, 0x00, 0xb1, 0x00, 
-0x13, 0xff, 0x97, 0x00, 0x75, 0x00, 0x3c, 0xff, 0xe4, 0xff, 0x7a, 0xff, 0x82, 0x00, 0xfa, 0x00, 
-0x69, 0x00, 0xd9, 0xff, 0xde, 0xff, 0x07, 0x00, 0x27, 0xff, 0x7f, 0xff, 0x07, 0x00, 0xf8, 0xff, 
-0x3c, 0x00, 0x40, 0x00, 0xf7, 0xff, 0xe0, 0xff, 0x0e, 0x00, 0xca, 0xff, 0x9a, 0xff, 0xe1, 0xfe, 
-0xb7, 0x01, 0x79, 0xff, 0xe3, 0x00, 0x62, 0x01, 0x99, 0xfd, 0x99, 0x00, 0x89, 0xfe, 0xdd, 0xff, 
-0x34, 0x01, 0xd9, 0xff, 0xc9, 0x00, 0x20, 0xff, 0x79, 0xff, 0x96, 0x00, 0x5b, 0xff, 0xbe, 0x00, 
-0xdd, 0xff, 0x71, 0xff, 0x96, 0xff, 0xb5, 0xfe, 0x46, 0x00, 0xed, 0x00, 0x4a, 0x00, 0x3e, 0x01, 
-0x3a, 0x00, 0xce, 0xfe, 0x15, 0x00, 0x2a, 0xff, 0x97, 0xff, 0x2a, 0x00, 0xe4, 0xff, 0x29, 0x00, 
-0xe3, 0xff, 0xdd, 0xff, 0x8e, 0x00, 0x06, 0x00, 0xee, 0xff, 0x7e, 0xff, 0x16, 0xff, 0xa3, 0xff, 
-0xab, 0xff, 0x66, 0x00, 0xda, 0xff, 0x39, 0x00, 0x52, 0x00, 0x55, 0x00, 0x27, 0x00, 0xb2, 0x00, 
-0x95, 0xff, 0x16, 0x00, 0xbd, 0x00, 0x41, 0x00, 0xe5, 0xfe, 0x40, 0xff, 0xb3, 0xff, 0x89, 0xff, 
-0x06, 0x00, 0xb4, 0x00, 0xef, 0xff, 0x24, 0xff, 0xcb, 0x01, 0x10, 0x00, 0x1f, 0x00, 0xb7, 0x00, 
-0x90, 0x00, 0x5c, 0xff, 0x4c, 0x00, 0x12, 0xff, 0x90, 0x00, 0x2c, 0x00, 0xac, 0xfe, 0xd8, 0xff, 
-0x20, 0x00, 0x2c, 0xff, 0xc1, 0xff, 0x1a, 0x00, 0xe6, 0xfe, 0x13, 0x00, 0xab, 0x00, 0x32, 0x01, 
-0x2f, 0xff, 0x6f, 0x00, 0x5f, 0xff, 0x9c, 0xff, 0x29, 0xff, 0x3b, 0x00, 0xfd, 0x00, 0x44, 0xff, 
-0x00, 0x01, 0xc9, 0xfe, 0x5a, 0xfe, 0x48, 0x00, 0xab, 0xfe, 0x06, 0x00, 0xfb, 0xff, 0x7d, 0xfe, 
-0x2d, 0x01, 0x27, 0xff, 0x7e, 0x00, 0x15, 0x01, 0x74, 0xff, 0x93, 0x02, 0x68, 0xff, 0x2f, 0x00, 
-0xcd, 0xff, 0x0d, 0xff, 0x4f, 0x01, 0x4a, 0xff, 0x60, 0x02, 0x66, 0xff, 0xc9, 0xfe, 0x93, 0x00, 
-0xc5, 0xfe, 0x60, 0x00, 0x4b, 0xff, 0xc0, 0xff, 0xf7, 0xfe, 0x7a, 0x00, 0x82, 0xff, 0xf0, 0x00, 
-0x2a, 0x00, 0x0b, 0xff, 0x90, 0x01, 0xe1, 0xfe, 0x24, 0x00, 0x25, 0x00, 0x69, 0x00, 0x4a, 0x00, 
-0x7e, 0x00, 0x37, 0x02, 0x5a, 0xfe, 0x6f, 0xfe, 0xe9, 0xff, 0x81, 0xff, 0x98, 0xff, 0x50, 0xff, 
-0xb2, 0x00, 0x9c, 0xfe, 0x15, 0x01, 0xd6, 0x00, 0xc8, 0xff, 0xe9, 0x00, 0x62, 0xfe, 0x63, 0x01, 
-0x5c, 0x00, 0x1d, 0x00, 0xe7, 0x00, 0xc7, 0xfe, 0x39, 0x01, 0xfb, 0xff, 0x7d, 0x00, 0x4d, 0xff, 
-0xc2, 0xfe, 0x94, 0x00, 0x4b, 0x01, 0x6c, 0xff, 0x3d, 0xff, 0x44, 0x00, 0x29, 0xff, 0x68, 0x00, 
-0x2f, 0x00, 0xff, 0xff, 0xa3, 0xff, 0xee, 0xff, 0x4b, 0x00, 0x1a, 0x01, 0x42, 0x02, 0x2f, 0x03, 
-0xb1, 0x04, 0x89, 0x04, 0x41, 0x01, 0xe3, 0xfd, 0xf0, 0xfa, 0xc4, 0xfb, 0xca, 0xfc, 0x6a, 0xfc, 
-0x75, 0xfc, 0x9a, 0xff, 0x67, 0xff, 0xbd, 0xff, 0x32, 0x02, 0x4d, 0x01, 0x27, 0x01, 0x03, 0x00, 
-0x08, 0x01, 0x47, 0x00, 0x1f, 0x00, 0xeb, 0x00, 0x2c, 0xff, 0x0b, 0x00, 0x9a, 0xff, 0xa8, 0x00, 
-0x0c, 0xff, 0x3b, 0xfe, 0x16, 0x01, 0xde, 0xfe, 0x67, 0xff, 0x50, 0xff, 0xcb, 0xfe, 0xcd, 0x00, 
-0x4d, 0xff, 0xa0, 0xff, 0xd6, 0x00, 0xe6, 0xfe, 0x25, 0xff, 0xb4, 0x00, 0x4d, 0xff, 0xc5, 0xff, 
-0x88, 0x00, 0xed, 0x00, 0x0a, 0x01, 0x0d, 0x01, 0xbc, 0x00, 0x88, 0x00, 0xf0, 0xff, 0xd9, 0xfe, 
-0xbb, 0x00, 0x40, 0xfe, 0xa7, 0x00, 0xa3, 0xff, 0xfd, 0xfd, 0x57, 0x01, 0x67, 0x00, 0xa6, 0xff, 
-0x57, 0xff, 0x8b, 0x00, 0x1d, 0xff, 0x50, 0xff, 0xcb, 0x00, 0xe0, 0xfe, 0x9d, 0x00, 0x43, 0x02, 
-0x44, 0x00, 0x31, 0x00, 0xae, 0x01, 0x58, 0x00, 0xb4, 0x00, 0xf1, 0x00, 0x37, 0x01, 0xaa, 0x00, 
-0x8a, 0x00, 0x74, 0x01, 0x1b, 0xff, 0x4f, 0xff, 0x1c, 0x01, 0xd3, 0x00, 0xf2, 0xfe, 0x75, 0x01, 
-0x0d, 0x00, 0x9a, 0xff, 0x04, 0x02, 0x35, 0x00, 0xb7, 0xff, 0x83, 0xff, 0x3d, 0x00, 0x7f, 0xff, 
-0xe1, 0xfe, 0x91, 0xff, 0xc3, 0xff, 0xb2, 0xff, 0xc9, 0xfd, 0x47, 0xfe, 0x86, 0xfd, 0xad, 0xfb, 
-0xfb, 0xfb, 0xd9, 0xfb, 0x29, 0xfa, 0xd8, 0xfa, 0x86, 0xfc, 0xd9, 0xfb, 0x03, 0xfd, 0x5a, 0xfe, 
-0xc9, 0xfe, 0x7d, 0x01, 0xbf, 0x01, 0x51, 0x05, 0xbb, 0x06, 0xa7, 0x06, 0xb2, 0x0a, 0x19, 0x09, 
-0x54, 0x0a, 0x14, 0x08, 0x3e, 0x08, 0xeb, 0x07, 0x01, 0x03, 0x5b, 0x06, 0x20, 0x01, 0xb9, 0x00, 
-0x94, 0x01, 0x07, 0xfd, 0x75, 0xff, 0xc1, 0xf9, 0xb2, 0xfa, 0xbc, 0xf9, 0x59, 0xf5, 0x15, 0xf7, 
-0x23, 0xf3, 0x2d, 0xf4, 0xcd, 0xf1, 0x02, 0xef, 0x83, 0xf1, 0x9c, 0xec, 0xb3, 0xf1, 0x13, 0xf5, 
-0x12, 0xf6, 0x33, 0xff, 0xd7, 0x00, 0x53, 0x08, 0xe2, 0x0c, 0xc1, 0x0e, 0xd1, 0x14, 0xc6, 0x12, 
-0x3f, 0x14, 0x4b, 0x12, 0xd3, 0x0d, 0xa9, 0x0c, 0xb1, 0x06, 0x23, 0x04, 0x36, 0x02, 0x8f, 0xff, 
-0x95, 0x00, 0x7c, 0x01, 0xe1, 0x01, 0xb7, 0x03, 0x3c, 0x06, 0x8e, 0x07, 0x4a, 0x07, 0x3a, 0x09, 
-0x9f, 0x07, 0x36, 0x04, 0x02, 0x02, 0x9b, 0xfa, 0x00, 0xf8, 0x02, 0xf4, 0x7c, 0xee, 0x0b, 0xee, 
-0x1e, 0xe8, 0x5a, 0xe5, 0x60, 0xe3, 0x7b, 0xe4, 0xe3, 0xe8, 0x22, 0xed, 0x1d, 0xf7, 0xa9, 0xfc, 
-0x86, 0x04, 0x3b, 0x0e, 0xf4, 0x10, 0xb1, 0x16, 0x8f, 0x18, 0x5e, 0x16, 0xea, 0x14, 0xcd, 0x0e, 
-0xce, 0x0a, 0x3b, 0x04, 0x1a, 0xfe, 0x2e, 0xfb, 0x82, 0xf6, 0x66, 0xf7, 0xab, 0xf7, 0x09, 0xfa, 
-0x68, 0x00, 0x06, 0x04, 0x7e, 0x0a, 0x05, 0x0f, 0x23, 0x11, 0x20, 0x14, 0xa3, 0x11, 0x3b, 0x0e, 
-0x5d, 0x09, 0x90, 0x02, 0xf6, 0xfc, 0x71, 0xf5, 0xaa, 0xf2, 0x86, 0xef, 0xd0, 0xec, 0x79, 0xec, 
-0x3b, 0xe9, 0x64, 0xe6, 0x3a, 0xe3, 0x9d, 0xe6, 0x5f, 0xeb, 0x1d, 0xf1, 0x01, 0xfa, 0x25, 0x00, 
-0x89, 0x09, 0xcf, 0x0f, 0xa1, 0x13, 0xe6, 0x17, 0xec, 0x16, 0x84, 0x15, 0xd4, 0x11, 0xff, 0x0b, 
-0xd6, 0x05, 0x4f, 0xff, 0x99, 0xfb, 0xb2, 0xf6, 0xed, 0xf4, 0xa2, 0xf5, 0x3d, 0xf5, 0xcd, 0xf8, 
-0x9b, 0xfd, 0x41, 0x04, 0xb5, 0x0a, 0x2c, 0x0f, 0x7e, 0x15, 0x39, 0x16, 0xf0, 0x14, 0xdb, 0x12, 
-0x4e, 0x0c, 0x87, 0x06, 0xa0, 0xff, 0xbe, 0xfa, 0xdb, 0xf4, 0x48, 0xf1, 0xcf, 0xef, 0xc9, 0xeb, 
-0xc0, 0xeb, 0xe7, 0xe5, 0xe5, 0xe2, 0xe7, 0xe2, 0x29, 0xe6, 0x55, 0xf0, 0xbc, 0xf3, 0xb3, 0xfd, 
-0x70, 0x08, 0x28, 0x0d, 0x8f, 0x14, 0x6c, 0x18, 0x2c, 0x19, 0x1d, 0x17, 0xf5, 0x12, 0x74, 0x0e, 
-0x6a, 0x06, 0x20, 0x00, 0x31, 0xfb, 0xae, 0xf5, 0xd5, 0xf2, 0xa7, 0xf2, 0xed, 0xf4, 0x0b, 0xf7, 
-0x34, 0xfc, 0x3d, 0x04, 0x44, 0x09, 0x82, 0x0f, 0xc9, 0x14, 0x53, 0x15, 0xa6, 0x15, 0xef, 0x12, 
-0xb1, 0x0c, 0x0e, 0x08, 0x38, 0x00, 0x92, 0xfa, 0x83, 0xf6, 0x40, 0xf1, 0xcc, 0xf0, 0x69, 0xee, 
-0x1d, 0xeb, 0x3f, 0xe8, 0x5f, 0xe4, 0x49, 0xe3, 0x0a, 0xe8, 0xf6, 0xf1, 0x6f, 0xf5, 0x07, 0xfc, 
-0x43, 0x0b, 0x74, 0x0e, 0x90, 0x13, 0xe5, 0x1b, 0x60, 0x19, 0x5d, 0x16, 0x00, 0x14, 0x09, 0x0e, 
-0x06, 0x04, 0x4e, 0xfe, 0xa0, 0xfa, 0x86, 0xf3, 0x4e, 0xf2, 0xf6, 0xf2, 0xf7, 0xf3, 0xdb, 0xf7, 
-0xfe, 0xfc, 0x90, 0x03, 0xd5, 0x09, 0x7f, 0x0f, 0xcf, 0x14, 0x0f, 0x15, 0xbb, 0x13, 0x90, 0x11, 
-0x67, 0x0b, 0xe1, 0x06, 0xcd, 0x00, 0xb4, 0xfa, 0xcc, 0xf6, 0xa2, 0xf3, 0xa4, 0xf2, 0xef, 0xef, 
-0x74, 0xee, 0x63, 0xeb, 0x3c, 0xe4, 0x6b, 0xe4, 0x1b, 0xe9, 0x36, 0xef, 0xd1, 0xf4, 0xdb, 0xfc, 
-0x74, 0x08, 0x6d, 0x0c, 0x55, 0x12, 0x1f, 0x19, 0x37, 0x16, 0xea, 0x14, 0x11, 0x13, 0x29, 0x0c, 
-0xd0, 0x03, 0xcf, 0xff, 0x08, 0xfb, 0x8d, 0xf3, 0xb9, 0xf3, 0x03, 0xf4, 0x9c, 0xf3, 0x3a, 0xf8, 
-0x8c, 0xfc, 0x2c, 0x01, 0xc5, 0x06, 0x13, 0x0c, 0xa9, 0x0f, 0x42, 0x12, 0x01, 0x12, 0x45, 0x0f, 
-0x22, 0x0d, 0x3b, 0x08, 0xf5, 0x02, 0x50, 0xfe, 0x3f, 0xfa, 0xf5, 0xf5, 0xfc, 0xf3, 0xae, 0xf3, 
-0x74, 0xf0, 0x8b, 0xef, 0xee, 0xeb, 0x27, 0xe5, 0x4c, 0xe8, 0x20, 0xee, 0x8a, 0xf0, 0x65, 0xf6, 
-0x74, 0x01, 0x6b, 0x08, 0x37, 0x0c, 0xd7, 0x14, 0xa1, 0x17, 0x39, 0x14, 0x1d, 0x15, 0xcf, 0x11, 
-0xf1, 0x08, 0x2b, 0x03, 0x01, 0x00, 0x9d, 0xf7, 0x82, 0xf3, 0xc4, 0xf5, 0xfc, 0xf3, 0x08, 0xf6, 
-0x92, 0xfb, 0x4e, 0x00, 0x2f, 0x04, 0xc9, 0x09, 0x3c, 0x0f, 0x34, 0x0e, 0x5b, 0x11, 0xeb, 0x10, 
-0xeb, 0x0a, 0x8e, 0x09, 0xe2, 0x05, 0xba, 0x00, 0xd6, 0xfc, 0x65, 0xfc, 0xcb, 0xf7, 0x8d, 0xf4, 
-0xa0, 0xf6, 0xf4, 0xf0, 0x8b, 0xee, 0x98, 0xeb, 0x52, 0xe4, 0xe0, 0xe8, 0x5f, 0xef, 0xbc, 0xf0, 
-0x61, 0xf7, 0x48, 0x03, 0x70, 0x07, 0xbb, 0x0b, 0x02, 0x16, 0xfc, 0x14, 0xc0, 0x11, 0xc2, 0x15, 
-0x8c, 0x0f, 0x0e, 0x07, 0x19, 0x05, 0xc2, 0xfe, 0xf7, 0xf6, 0x4a, 0xf5, 0x2b, 0xf5, 0x9b, 0xf3, 
-0x3e, 0xf6, 0x61, 0xfc, 0x8d, 0xff, 0x58, 0x03, 0x97, 0x09, 0x93, 0x0c, 0xf5, 0x0c, 0xf0, 0x0f, 
-0xb7, 0x0e, 0x43, 0x0a, 0x6c, 0x09, 0x12, 0x06, 0x3a, 0x01, 0xb0, 0xfe, 0x33, 0xfc, 0x70, 0xf8, 
-0xc4, 0xf6, 0x7c, 0xf5, 0xb3, 0xf1, 0x3b, 0xef, 0xb1, 0xe9, 0xb5, 0xe6, 0xbd, 0xeb, 0x67, 0xef, 
-0x8a, 0xf2, 0x62, 0xf9, 0x3b, 0x02, 0xed, 0x06, 0x07, 0x0d, 0x7f, 0x14, 0x8d, 0x13, 0x11, 0x14, 
-0x20, 0x15, 0xe4, 0x0d, 0x51, 0x09, 0xbe, 0x05, 0x51, 0xfe, 0x12, 0xfa, 0x86, 0xf7, 0xa2, 0xf5, 
-0x62, 0xf5, 0x2c, 0xf7, 0x3c, 0xfb, 0x10, 0xfd, 0x3f, 0x02, 0x69, 0x07, 0x73, 0x08, 0xc0, 0x0c, 
-0xa0, 0x0e, 0xa4, 0x0c, 0x53, 0x0c, 0x40, 0x0a, 0x1a, 0x06, 0xc8, 0x03, 0x27, 0x01, 0x51, 0xfd, 
-0xcd, 0xfa, 0x6b, 0xf8, 0x76, 0xf5, 0x42, 0xf2, 0x9b, 0xef, 0x41, 0xea, 0x29, 0xe8, 0x8b, 0xec, 
-0xb1, 0xed, 0x63, 0xf1, 0xb3, 0xf8, 0x21, 0xfe, 0x8f, 0x03, 0xc5, 0x09, 0x1c, 0x0f, 0xbd, 0x10, 
-0xc7, 0x12, 0x54, 0x13, 0x6e, 0x0f, 0xa0, 0x0c, 0x2e, 0x09, 0x41, 0x03, 0x28, 0xff, 0xa1, 0xfc, 
-0xe1, 0xf8, 0x2f, 0xf7, 0xd7, 0xf7, 0x45, 0xf8, 0xd5, 0xf9, 0xc6, 0xfd, 0x8e, 0x00, 0x3a, 0x03, 
-0xcd, 0x07, 0x50, 0x09, 0xc4, 0x0a, 0xda, 0x0b, 0xc4, 0x09, 0xf3, 0x08, 0xa3, 0x06, 0xbb, 0x02, 
-0x94, 0x00, 0x58, 0xfd, 0x65, 0xf9, 0x9b, 0xf7, 0xab, 0xf4, 0xb5, 0xf1, 0x73, 0xef, 0x00, 0xee, 
-0xed, 0xee, 0xc3, 0xee, 0xad, 0xf2, 0xb5, 0xf6, 0xb1, 0xf8, 0xbf, 0xff, 0x3c, 0x03, 0x90, 0x05, 
-0x61, 0x0b, 0xd0, 0x0c, 0x0d, 0x0d, 0x6b, 0x0f, 0x79, 0x0d, 0xb1, 0x0a, 0xfe, 0x09, 0x28, 0x06, 
-0xf1, 0x02, 0x3b, 0x01, 0xe0, 0xfe, 0x9e, 0xfc, 0xe5, 0xfb, 0x00, 0xfc, 0xa8, 0xfb, 0xf3, 0xfd, 
-0x3d, 0xff, 0xb5, 0x00, 0xd6, 0x03, 0x5e, 0x04, 0xd7, 0x05, 0x12, 0x07, 0xf4, 0x05, 0xac, 0x05, 
-0x77, 0x04, 0xfa, 0x01, 0x11, 0x01, 0xdc, 0xfe, 0xb7, 0xfc, 0xe6, 0xfb, 0x4a, 0xfa, 0x00, 0xfa, 
-0x53, 0xf8, 0xf2, 0xf6, 0x9f, 0xf7, 0x76, 0xf6, 0x6b, 0xf6, 0x8a, 0xf8, 0xca, 0xf8, 0x48, 0xf9, 
-0x6b, 0xfc, 0x3f, 0xfd, 0x70, 0xfe, 0x25, 0x02, 0x26, 0x03, 0xcb, 0x03, 0x18, 0x06, 0x7d, 0x06, 
-0xa3, 0x05, 0x8a, 0x06, 0xb9, 0x06, 0x38, 0x05, 0x9c, 0x04, 0x61, 0x04, 0x95, 0x02, 0x5f, 0x01, 
-0x0f, 0x02, 0x36, 0x00, 0x93, 0xff, 0xad, 0x00, 0x04, 0xff, 0x6e, 0xff, 0xac, 0x00, 0xfa, 0xff, 
-0x85, 0x00, 0x21, 0x01, 0x47, 0x00, 0x99, 0x00, 0xca, 0x00, 0xa3, 0xff, 0x35, 0x00, 0x5e, 0x00, 
-0x3d, 0xff, 0xc7, 0xff, 0x11, 0x00, 0x96, 0xfe, 0xf2, 0xfe, 0x65, 0xff, 0x33, 0xfe, 0xe0, 0xfe, 
-0xbe, 0xfe, 0xac, 0xfd, 0xa3, 0xfd, 0x7c, 0xfd, 0x1c, 0xfd, 0xc3, 0xfc, 0x27, 0xfd, 0x4f, 0xfd, 
-0x81, 0xfd, 0x27, 0xfe, 0xaf, 0xfe, 0x29, 0xff, 0x76, 0xff, 0x73, 0x00, 0xf7, 0x00, 0x23, 0x01, 
-0x49, 0x02, 0x0c, 0x03, 0xbe, 0x02, 0x29, 0x03, 0x76, 0x03, 0xda, 0x02, 0xdd, 0x02, 0x5c, 0x02, 
-0xb0, 0x01, 0x81, 0x01, 0xb7, 0x00, 0x39, 0x00, 0xcd, 0xff, 0xfb, 0xfe, 0xf5, 0xfe, 0x08, 0xff, 
-0x93, 0xfe, 0xc8, 0xfe, 0x49, 0xff, 0x4f, 0xff, 0x84, 0xff, 0x37, 0x00, 0x3e, 0x00, 0x48, 0x00, 
-0x0d, 0x01, 0xc0, 0x00, 0x94, 0x00, 0xb5, 0x00, 0x48, 0x00, 0x41, 0x00, 0x05, 0x00, 0xaa, 0xff, 
-0x55, 0xff, 0x0f, 0xff, 0x21, 0xff, 0xf2, 0xfe, 0xc4, 0xfe, 0xda, 0xfe, 0xf4, 0xfe, 0xd1, 0xfe, 
-0xd1, 0xfe, 0x3f, 0xff, 0x1c, 0xff, 0x2d, 0xff, 0xe7, 0xff, 0xfd, 0xff, 0x41, 0x00, 0xa2, 0x00, 
-0x9b, 0x00, 0x84, 0x00, 0x7d, 0x00, 0x9b, 0x00, 0xe5, 0xff, 0x99, 0xff, 0xd5, 0xff, 0x24, 0xff, 
-0x24, 0xff, 0xb3, 0xff, 0x2e, 0xff, 0x50, 0xff, 0x2c, 0x00, 0xd5, 0xff, 0x56, 0x00, 0x33, 0x01, 
-0xfb, 0x00, 0x7a, 0x01, 0xd0, 0x01, 0xd4, 0x01, 0x05, 0x02, 0x0a, 0x02, 0xf0, 0x01, 0xb6, 0x01, 
-0xb5, 0x01, 0x7e, 0x01, 0xf6, 0x00, 0x93, 0x00, 0x5f, 0x00, 0xea, 0xff, 0x72, 0xff, 0x36, 0xff, 
-0xe0, 0xfe, 0x8c, 0xfe, 0x7c, 0xfe, 0x80, 0xfe, 0x55, 0xfe, 0x86, 0xfe, 0x9e, 0xfe, 0x91, 0xfe, 
-0xe6, 0xfe, 0xdc, 0xfe, 0xdc, 0xfe, 0xfb, 0xfe, 0xea, 0xfe, 0xf3, 0xfe, 0x08, 0xff, 0xec, 0xfe, 
-0x03, 0xff, 0x4e, 0xff, 0x47, 0xff, 0x9f, 0xff, 0xef, 0xff, 0xff, 0xff, 0x7d, 0x00, 0xcc, 0x00, 
-0xdd, 0x00, 0x19, 0x01, 0x53, 0x01, 0x6f, 0x01, 0x7e, 0x01, 0xaf, 0x01, 0xc5, 0x01, 0xb2, 0x01, 
-0xbf, 0x01, 0xc4, 0x01, 0x88, 0x01, 0x46, 0x01, 0x43, 0x01, 0x24, 0x01, 0xb9, 0x00, 0x97, 0x00, 
-0x65, 0x00, 0xef, 0xff, 0xb0, 0xff, 0x77, 0xff, 0x25, 0xff, 0xee, 0xfe, 0xcf, 0xfe, 0x95, 0xfe, 
-0x71, 0xfe, 0x77, 0xfe, 0x59, 0xfe, 0x2a, 0xfe, 0x46, 0xfe, 0x4d, 0xfe, 0x43, 0xfe, 0x76, 0xfe, 
-0x87, 0xfe, 0xaa, 0xfe, 0xe3, 0xfe, 0x0c, 0xff, 0x64, 0xff, 0xa2, 0xff, 0xf0, 0xff, 0x50, 0x00, 
-0x9b, 0x00, 0xe0, 0x00, 0x21, 0x01, 0x5b, 0x01, 0x66, 0x01, 0x76, 0x01, 0x97, 0x01, 0x8d, 0x01, 
-0x79, 0x01, 0x67, 0x01, 0x55, 0x01, 0x48, 0x01, 0x16, 0x01, 0xfb, 0x00, 0xde, 0x00, 0xaa, 0x00, 
-0x9a, 0x00, 0x77, 0x00, 0x4a, 0x00, 0x34, 0x00, 0x26, 0x00, 0xfe, 0xff, 0xd7, 0xff, 0xcf, 0xff, 
-0x9f, 0xff, 0x6e, 0xff, 0x42, 0xff, 0x02, 0xff, 0xd6, 0xfe, 0x9d, 0xfe, 0x69, 0xfe, 0x52, 0xfe, 
-0x4b, 0xfe, 0x50, 0xfe, 0x46, 0xfe, 0x80, 0xfe, 0xd7, 0xfe, 0xf5, 0xfe, 0x44, 0xff, 0x9e, 0xff, 
-0xea, 0xff, 0x37, 0x00, 0x82, 0x00, 0xc1, 0x00, 0xf1, 0x00, 0x1b, 0x01, 0x26, 0x01, 0x36, 0x01, 
-0x39, 0x01, 0x27, 0x01, 0x1c, 0x01, 0x0b, 0x01, 0xf5, 0x00, 0xd3, 0x00, 0xbf, 0x00, 0x9f, 0x00, 
-0x7f, 0x00, 0x7a, 0x00, 0x57, 0x00, 0x46, 0x00, 0x3e, 0x00, 0x29, 0x00, 0x1a, 0x00, 0xfd, 0xff, 
-0xfd, 0xff, 0xe6, 0xff, 0xbb, 0xff, 0xb3, 0xff, 0x8f, 0xff, 0x65, 0xff, 0x4a, 0xff, 0x20, 0xff, 
-0x05, 0xff, 0xe8, 0xfe, 0xe5, 0xfe, 0xde, 0xfe, 0xe9, 0xfe, 0x1b, 0xff, 0x41, 0xff, 0x60, 0xff, 
-0x8c, 0xff, 0xca, 0xff, 0xfb, 0xff, 0x12, 0x00, 0x3e, 0x00, 0x69, 0x00, 0x7a, 0x00, 0xa1, 0x00, 
-0xa8, 0x00, 0xb7, 0x00, 0xdd, 0x00, 0xd8, 0x00, 0xd5, 0x00, 0xdf, 0x00, 0xd4, 0x00, 0xc7, 0x00, 
-0xaf, 0x00, 0x93, 0x00, 0x85, 0x00, 0x5f, 0x00, 0x3d, 0x00, 0x2e, 0x00, 0x0f, 0x00, 0x01, 0x00, 
-0x14, 0x00, 0xf0, 0xff, 0xd6, 0xff, 0xe0, 0xff, 0xc3, 0xff, 0xbe, 0xff, 0xb8, 0xff, 0xa1, 0xff, 
-0x8f, 0xff, 0x7e, 0xff, 0x89, 0xff, 0x77, 0xff, 0x7b, 0xff, 0x9f, 0xff, 0x9a, 0xff, 0xc0, 0xff, 
-0x07, 0x00, 0x0e, 0x00, 0xf1, 0xff, 0x0d, 0x00, 0x29, 0x00, 0x0d, 0x00, 0x21, 0x00, 0x2e, 0x00, 
-0x1f, 0x00, 0x43, 0x00, 0x6d, 0x00, 0x2e, 0x00, 0x02, 0x00, 0x67, 0x00, 0x45, 0x00, 0xf8, 0xff, 
-0x24, 0x00, 0x9c, 0x00, 0x6b, 0x00, 0xf4, 0xff, 0x2f, 0x00, 0xa9, 0x00, 0x76, 0x00, 0xb9, 0xff, 
-0x10, 0x00, 0x24, 0x00, 0x91, 0xff, 0x8d, 0xff, 0xd4, 0xff, 0xd8, 0xff, 0xb0, 0xff, 0xc5, 0xff, 
-0xe1, 0xff, 0xea, 0xff, 0xd6, 0xff, 0xaa, 0xff, 0x73, 0xff, 0xb8, 0xff, 0x1c, 0x00, 0xc8, 0xff, 
-0x12, 0x00, 0x63, 0x00, 0xae, 0xff, 0x14, 0x00, 0x94, 0x00, 0x32, 0x00, 0xee, 0xff, 0x49, 0x00, 
-0xc2, 0x00, 0xf2, 0xff, 0xec, 0xff, 0x9b, 0x00, 0xff, 0xff, 0x6c, 0xff, 0x7a, 0x00, 0xa5, 0x00, 
-0x25, 0x00, 0x37, 0x00, 0xda, 0xff, 0x53, 0x00, 0x11, 0x00, 0xe9, 0xff, 0x2d, 0x00, 0x20, 0x00, 
-0x1d, 0x00, 0x7d, 0xff, 0x16, 0x00, 0xa1, 0x00, 0x39, 0xff, 0x50, 0xff, 0xff, 0x00, 0x04, 0x00, 
-0xe1, 0xfe, 0x8f, 0xff, 0xc8, 0xff, 0x8f, 0xff, 0x74, 0xff, 0x2f, 0x00, 0x46, 0x00, 0x3e, 0xff, 
-0x04, 0x00, 0x39, 0x00, 0x2a, 0x00, 0xd2, 0x00, 0x0d, 0x00, 0x65, 0x00, 0xa7, 0x00, 0x2c, 0x00, 
-0x5b, 0x00, 0x9f, 0x00, 0x2c, 0x00, 0xa4, 0x00, 0x22, 0x01, 0x76, 0xff, 0x07, 0xff, 0xce, 0xff, 
-0x5c, 0x00, 0x9f, 0xff, 0x45, 0xff, 0xd0, 0xff, 0xcf, 0xff, 0x72, 0xff, 0xbe, 0xfe, 0x74, 0xff, 
-0x30, 0x00, 0xea, 0xff, 0x0a, 0x00, 0x54, 0x00, 0x27, 0x00, 0x38, 0xfd, 0x36, 0xff, 0xd5, 0xf9, 
-0x00, 0xf7, 0x7f, 0x0e, 0x9b, 0x12, 0x0d, 0xfc, 0x1e, 0xf7, 0xf7, 0x04, 0xad, 0x07, 0xc3, 0xfa, 
-0x71, 0xf7, 0x36, 0x01, 0xe6, 0xff, 0x24, 0xf6, 0x44, 0xf8, 0x10, 0x06, 0x4e, 0x04, 0xe0, 0xfa, 
-0x8c, 0x08, 0x0e, 0x12, 0xc9, 0x03, 0xc8, 0xf9, 0x9e, 0x03, 0xd6, 0x07, 0xce, 0xfd, 0xa8, 0xfa, 
-0xfe, 0x00, 0xc2, 0x00, 0x7a, 0xfa, 0x79, 0xf9, 0x15, 0xff, 0xed, 0x00, 0x2e, 0xfc, 0xa5, 0xfd, 
-0x68, 0x03, 0xc9, 0x03, 0xca, 0xfe, 0xb7, 0xfe, 0x49, 0x03, 0x69, 0x02, 0x9f, 0xfe, 0xad, 0xfe, 
-0x8a, 0x00, 0xa8, 0xfe, 0x61, 0xfc, 0x17, 0xfd, 0x28, 0xfe, 0xc9, 0xfd, 0xa1, 0xfc, 0xc8, 0xfe, 
-0xb8, 0x01, 0x34, 0x00, 0xba, 0xff, 0x98, 0x00, 0x11, 0x00, 0x02, 0x01, 0x92, 0xff, 0xd9, 0xfe, 
-0x38, 0x01, 0xf8, 0x00, 0xf5, 0x00, 0x28, 0x01, 0xc3, 0x00, 0xe0, 0x00, 0x12, 0x01, 0x78, 0xff, 
-0x2b, 0xff, 0x3b, 0x00, 0x93, 0xfe, 0xfd, 0xfe, 0x7b, 0x01, 0x77, 0xff, 0xa7, 0xfd, 0x02, 0x02, 
-0x3b, 0x02, 0x86, 0x00, 0xcb, 0xff, 0xe8, 0x00, 0x99, 0xff, 0x60, 0xfe, 0xde, 0x00, 0xe2, 0xfe, 
-0x52, 0xff, 0x94, 0xff, 0x3e, 0x00, 0x31, 0x01, 0x6b, 0x00, 0x86, 0xff, 0x7b, 0x00, 0x41, 0x00, 
-0x2f, 0xff, 0x9c, 0xff, 0xdd, 0xff, 0xf7, 0xfe, 0x7a, 0xff, 0x40, 0x01, 0x72, 0x00, 0xc2, 0xff, 
-0x3f, 0xff, 0xc8, 0x01, 0x59, 0x02, 0xf9, 0xff, 0x13, 0x00, 0x54, 0x01, 0x06, 0x02, 0x0c, 0xff, 
-0x24, 0xff, 0xd8, 0x02, 0xd6, 0x01, 0x87, 0xfe, 0xe3, 0xfe, 0xb6, 0x02, 0x33, 0x01, 0x80, 0xfe, 
-0x2d, 0xff, 0xd3, 0x00, 0x8d, 0x01, 0x1c, 0xfe, 0x5e, 0xfe, 0xcf, 0x01, 0x52, 0x01, 0xea, 0xfe, 
-0x13, 0xfe, 0x08, 0x01, 0xf9, 0xff, 0x01, 0xfd, 0xa5, 0xfd, 0x95, 0x01, 0x03, 0x01, 0x90, 0xfd, 
-0xdb, 0xff, 0x3e, 0x02, 0xe6, 0xfd, 0xd5, 0xfd, 0x46, 0x01, 0x59, 0x01, 0x76, 0xfe, 0x03, 0xff, 
-0xbe, 0x00, 0xfa, 0xff, 0xdd, 0x00, 0x8b, 0xfe, 0x7e, 0xff, 0xbf, 0x01, 0x19, 0x00, 0x48, 0xfd, 
-0x2c, 0x00, 0xfd, 0x02, 0xc9, 0xff, 0x14, 0xfe, 0xfc, 0x02, 0xfb, 0x01, 0xa4, 0xfe, 0x74, 0xfe, 
-0xf7, 0x02, 0xc2, 0x01, 0x6b, 0xfd, 0x83, 0xff, 0x83, 0x01, 0xa1, 0xff, 0xbf, 0xfd, 0x00, 0x00, 
-0xb5, 0x00, 0x43, 0xfe, 0xa6, 0xfe, 0xfe, 0xff, 0x47, 0x00, 0xdd, 0xff, 0xd7, 0xfd, 0x70, 0x00, 
-0x8e, 0x01, 0x06, 0x00, 0x07, 0xfe, 0x36, 0x00, 0x7b, 0x01, 0x36, 0xff, 0x52, 0xff, 0xa5, 0xff, 
-0x4e, 0x00, 0xac, 0x00, 0x6c, 0xfe, 0xa2, 0xff, 0xcf, 0x01, 0x5b, 0x00, 0x3a, 0xfe, 0xdc, 0x00, 
-0x63, 0x02, 0xd8, 0xfd, 0xf8, 0xfe, 0x45, 0x02, 0x3e, 0x01, 0x1f, 0xff, 0x53, 0xff, 0x0e, 0x02, 
-0xd1, 0x00, 0x3b, 0xff, 0x62, 0x00, 0x5d, 0x02, 0x92, 0x00, 0x60, 0xfd, 0x0c, 0x00, 0xa4, 0x01, 
-0xf8, 0xfe, 0x11, 0xff, 0x02, 0x00, 0xc5, 0x00, 0x09, 0xff, 0xd9, 0xfe, 0x07, 0x00, 0x9a, 0x00, 
-0x34, 0x00, 0x45, 0xfe, 0xab, 0xff, 0xa1, 0xff, 0xdf, 0xfe, 0xb7, 0xff, 0x7b, 0xff, 0xf6, 0xff, 
-0x1b, 0x00, 0x01, 0xff, 0xe7, 0xff, 0x0d, 0x01, 0x09, 0x00, 0x4b, 0xfd, 0x2c, 0x01, 0xbc, 0x01, 
-0x9d, 0xfd, 0x7f, 0xff, 0x8c, 0x02, 0x19, 0x01, 0xbc, 0xfe, 0x66, 0x00, 0x5b, 0x01, 0x02, 0x00, 
-0x47, 0x00, 0x13, 0x00, 0xb4, 0x00, 0xb3, 0x00, 0x2e, 0xff, 0xca, 0x00, 0xbb, 0x00, 0x31, 0x00, 
-0x03, 0xff, 0xc0, 0xff, 0x16, 0x01, 0x04, 0x00, 0x87, 0xff, 0xb5, 0xff, 0xbe, 0x00, 0x97, 0xff, 
-0x2c, 0xfe, 0xd3, 0x00, 0x7a, 0x00, 0x39, 0xfe, 0x92, 0xff, 0xed, 0x00, 0x55, 0x00, 0x86, 0xfe, 
-0x7b, 0x00, 0x36, 0x00, 0x76, 0x00, 0xa3, 0xff, 0x8d, 0xfe, 0x40, 0x00, 0xb1, 0x00, 0x56, 0x00, 
-0x00, 0x00, 0x50, 0x00, 0xc2, 0x00, 0xb8, 0xff, 0xa4, 0x00, 0xb5, 0x00, 0x1a, 0x00, 0x61, 0x00, 
-0x05, 0xff, 0x55, 0x01, 0xfb, 0xff, 0xc8, 0xfe, 0xef, 0xff, 0x3c, 0x01, 0x37, 0x00, 0x41, 0xfe, 
-0xdb, 0x00, 0xe1, 0x00, 0x18, 0xff, 0x49, 0x00, 0xa7, 0x00, 0x28, 0x01, 0xa9, 0xff, 0x92, 0xff, 
-0xcd, 0x00, 0xf0, 0xff, 0x67, 0xff, 0xce, 0xfe, 0x8f, 0x00, 0xec, 0xff, 0x86, 0xff, 0xb7, 0xff, 
-0xa7, 0xff, 0x14, 0x00, 0x2f, 0xff, 0x00, 0x00, 0x6f, 0x00, 0xa9, 0xff, 0x8d, 0xff, 0x61, 0x00, 
-0x31, 0x01, 0xbd, 0xff, 0xc9, 0xff, 0x29, 0x01, 0x70, 0x00, 0xf7, 0xff, 0x9d, 0xff, 0xb8, 0x00, 
-0x37, 0x00, 0xaa, 0xff, 0x41, 0x00, 0xba, 0xff, 0x0d, 0x00, 0xeb, 0xff, 0x10, 0x00, 0x02, 0x00, 
-0xe7, 0xff, 0x84, 0x00, 0x11, 0x00, 0x18, 0x00, 0x20, 0x00, 0xbe, 0xff, 0xf5, 0xff, 0xc6, 0xff, 
-0x25, 0x00, 0x3f, 0x00, 0xba, 0xff, 0x64, 0x00, 0x11, 0x00, 0x3d, 0xff, 0x06, 0x00, 0x09, 0x00, 
-0x09, 0x00, 0x29, 0x00, 0x15, 0x00, 0x74, 0x00, 0x7f, 0xff, 0xae, 0xff, 0xeb, 0xff, 0x06, 0x00, 
-0x1f, 0x00, 0xac, 0xff, 0x88, 0x00, 0x15, 0x00, 0x20, 0x00, 0xf8, 0xff, 0xdd, 0xff, 0x5e, 0x00, 
-0xfe, 0xff, 0x69, 0x00, 0x4d, 0x00, 0xce, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x50, 0x00, 0x36, 0x00, 
-0x07, 0x00, 0xb3, 0xff, 0x00, 0x00, 0x09, 0x00, 0x7a, 0xff, 0x71, 0x00, 0xd6, 0xff, 0xc5, 0xff, 
-0xf3, 0xff, 0x91, 0xff, 0x6f, 0x00, 0x7e, 0xff, 0x7b, 0x00, 0xe1, 0xff, 0x08, 0x00, 0x17, 0x00, 
-0x49, 0xff, 0x47, 0x00, 0x36, 0x00, 0x9f, 0xff, 0x0a, 0x00, 0x36, 0x00, 0xf7, 0xff, 0xef, 0xff, 
-0x30, 0x00, 0x03, 0x00, 0xe9, 0xff, 0x17, 0x00, 0xf4, 0xff, 0x73, 0x00, 0xae, 0xff, 0xea, 0xff, 
-0x0a, 0x00, 0x08, 0x00, 0x02, 0x00, 0xc1, 0xff, 0x4d, 0x00, 0x39, 0x00, 0xe8, 0xff, 0x3a, 0x00, 
-0xf5, 0xff, 0x19, 0x00, 0x29, 0x00, 0xa9, 0xff, 0x3a, 0x00, 0x04, 0x00, 0xf2, 0xff, 0xf3, 0xff, 
-0x0a, 0x00, 0xe4, 0xff, 0xa1, 0xff, 0x1c, 0x00, 0x04, 0x00, 0x01, 0x00, 0xfc, 0xff, 0xf0, 0xff, 
-0x0c, 0x00, 0xeb, 0xff, 0x05, 0x00, 0x01, 0x00, 0xda, 0xff, 0xf9, 0xff, 0xcf, 0xff, 0xe0, 0xff, 
-0x11, 0x00, 0xb8, 0xff, 0x01, 0x00, 0xda, 0xff, 0xfe, 0xff, 0x12, 0x00, 0xfa, 0xff, 0x26, 0x00, 
-0x3c, 0x00, 0x33, 0x00, 0xc5, 0xff, 0x54, 0x00, 0xc1, 0xff, 0x00, 0x00, 0x01, 0x00, 0xda, 0xff, 
-0x3a, 0x00, 0xdb, 0xff, 0x08, 0x00, 0xdd, 0xff, 0xe5, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xd6, 0xff, 
-0xfe, 0xff, 0x23, 0x00, 0xe0, 0xff, 0xdf, 0xff, 0x31, 0x00, 0xee, 0xff, 0xe3, 0xff, 0x33, 0x00, 
-0xeb, 0xff, 0xca, 0xff, 0x01, 0x00, 0x0b, 0x00, 0xc2, 0xff, 0xed, 0xff, 0xfc, 0xff, 0xd1, 0xff, 
-0xe9, 0xff, 0xe6, 0xff, 0xed, 0xff, 0xf6, 0xff, 0x0f, 0x00, 0x0c, 0x00, 0xf5, 0xff, 0x1d, 0x00, 
-0x25, 0x00, 0xf7, 0xff, 0x29, 0x00, 0x18, 0x00, 0xcc, 0xff, 0x2b, 0x00, 0x06, 0x00, 0xc5, 0xff, 
-0x0c, 0x00, 0xf5, 0xff, 0xe7, 0xff, 0xd9, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xe4, 0xff, 0xf8, 0xff, 
-0xc0, 0xff, 0x0d, 0x00, 0xd8, 0xff, 0xe6, 0xff, 0xec, 0xff, 0xe8, 0xff, 0x04, 0x00, 0xce, 0xff, 
-0xeb, 0xff, 0xcb, 0xff, 0x00, 0x00, 0xc2, 0xff, 0xdd, 0xff, 0xfa, 0xff, 0xd3, 0xff, 0xcf, 0xff, 
-0xeb, 0xff, 0x08, 0x00, 0xf4, 0xff, 0xf4, 0xff, 0x04, 0x00, 0x32, 0x00, 0xf3, 0xff, 0x17, 0x00, 
-0x1d, 0x00, 0x19, 0x00, 0x3f, 0x00, 0xff, 0xff, 0x28, 0x00, 0x37, 0x00, 0x00, 0x00, 0x06, 0x00, 
-0x20, 0x00, 0xfb, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x10, 0x00, 0xe7, 0xff, 0xf3, 0xff, 
-0xfa, 0xff, 0xf6, 0xff, 0xea, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0x02, 0x00, 0xf5, 0xff, 0xff, 0xff, 
-0x0c, 0x00, 0xf1, 0xff, 0x03, 0x00, 0x02, 0x00, 0x07, 0x00, 0xec, 0xff, 0x06, 0x00, 0xf5, 0xff, 
-0xf6, 0xff, 0x05, 0x00, 0xed, 0xff, 0x05, 0x00, 0xf9, 0xff, 0xf9, 0xff, 0x02, 0x00, 0xfe, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff, 0x01, 0x00, 0x05, 0x00, 0xfe, 0xff, 0xfc, 0xff, 
-0xfe, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xed, 0xff, 0xec, 0xff, 0xe4, 0xff, 0xe3, 0xff, 
-0xe5, 0xff, 0xdc, 0xff, 0xde, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xd9, 0xff, 0xdc, 0xff, 0xe1, 0xff, 
-0xd9, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xe4, 0xff, 0xeb, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf6, 0xff, 
-0xf9, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x03, 0x00, 
-0x09, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0d, 0x00, 
-0x08, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x05, 0x00, 0x09, 0x00, 
-0x00, 0x00, 0xf9, 0xff, 0xf6, 0xff, 0xee, 0xff, 0xec, 0xff, 0xf3, 0xff, 0xe7, 0xff, 0xea, 0xff, 
-0xe8, 0xff, 0xe2, 0xff, 0xe8, 0xff, 0xea, 0xff, 0xea, 0xff, 0xec, 0xff, 0xef, 0xff, 0xe7, 0xff, 
-0xf6, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0x01, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x0a, 0x00, 0xff, 0xff, 
-0x0c, 0x00, 0x06, 0x00, 0x09, 0x00, 0x10, 0x00, 0x10, 0x00, 0x17, 0x00, 0x15, 0x00, 0x2b, 0x00, 
-0x17, 0x00, 0x29, 0x00, 0x21, 0x00, 0x22, 0x00, 0x15, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x04, 0x00, 
-0x07, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xf9, 0xff, 0x03, 0x00, 0xef, 0xff, 0xfd, 0xff, 0xfa, 0xff, 
-0xf9, 0xff, 0x03, 0x00, 0xf9, 0xff, 0x05, 0x00, 0xf1, 0xff, 0xf6, 0xff, 0xea, 0xff, 0xf8, 0xff, 
-0xff, 0xff, 0xfc, 0xff, 0x1d, 0x00, 0xf7, 0xff, 0x0c, 0x00, 0x03, 0x00, 0xfe, 0xff, 0x15, 0x00, 
-0x23, 0x00, 0x05, 0x00, 0x18, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x29, 0x00, 
-0x0a, 0x00, 0x25, 0x00, 0x01, 0x00, 0x19, 0x00, 0x27, 0x00, 0xf7, 0xff, 0x13, 0x00, 0x09, 0x00, 
-0xec, 0xff, 0x2d, 0x00, 0xef, 0xff, 0x1c, 0x00, 0x0f, 0x00, 0xf5, 0xff, 0x2f, 0x00, 0xbc, 0xff, 
-0x21, 0x00, 0xde, 0xff, 0xcd, 0xff, 0xfd, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xde, 0xff, 0x1f, 0x00, 
-0xe9, 0xff, 0xec, 0xff, 0x09, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x83, 0x00, 0x39, 0x00, 0x13, 0x00, 
-0xd8, 0xff, 0xad, 0xff, 0x09, 0x00, 0x19, 0x00, 0x48, 0x00, 0xed, 0xff, 0x54, 0x00, 0xee, 0xff, 
-0xab, 0xff, 0x03, 0x00, 0x14, 0x00, 0x28, 0x00, 0xec, 0xff, 0x2d, 0x00, 0xeb, 0xff, 0x1e, 0x00, 
-0x13, 0x00, 0x07, 0x00, 0x15, 0x00, 0x50, 0x00, 0x63, 0x00, 0xbc, 0xff, 0x20, 0x00, 0xfe, 0xff, 
-0xec, 0xff, 0x38, 0x00, 0xd1, 0xff, 0x1e, 0x00, 0xe5, 0xff, 0x24, 0x00, 0x63, 0x00, 0xdb, 0xff, 
-0x22, 0x00, 0x3f, 0x00, 0xd1, 0xff, 0x39, 0x00, 0x36, 0x00, 0xa3, 0xff, 0x2f, 0x00, 0x41, 0x00, 
-0x0c, 0x00, 0x4a, 0x00, 0xfb, 0xff, 0x8f, 0x00, 0x98, 0xff, 0xda, 0x00, 0x0c, 0x00, 0xcd, 0xff, 
-0x29, 0x00, 0x9b, 0xff, 0x6c, 0x00, 0x80, 0xff, 0x9d, 0x00, 0x53, 0xff, 0x77, 0x00, 0x12, 0xff, 
-0xaf, 0x00, 0xd1, 0xff, 0x55, 0x00, 0xf9, 0x03, 0xa9, 0xff, 0x24, 0x01, 0x91, 0x00, 0x4e, 0x02, 
-0x32, 0x02, 0x34, 0x00, 0x2b, 0x01, 0xc4, 0xfd, 0xa8, 0xff, 0xf0, 0xff, 0x59, 0xff, 0xe0, 0xfe, 
-0xff, 0xfd, 0x9b, 0xff, 0xaf, 0xfe, 0xde, 0xfe, 0x97, 0x00, 0xe9, 0xff, 0x32, 0xff, 0x6a, 0x01, 
-0xc0, 0x00, 0xe3, 0xff, 0x1c, 0x00, 0x4c, 0x00, 0x49, 0xff, 0x4c, 0xff, 0x75, 0xff, 0x2c, 0xff, 
-0x07, 0xff, 0xbf, 0xfe, 0x28, 0xff, 0x19, 0xff, 0x41, 0xfe, 0x77, 0xff, 0x36, 0x00, 0x07, 0x00, 
-0x4b, 0x01, 0x31, 0x01, 0x98, 0x00, 0x41, 0xfe, 0x77, 0xff, 0xde, 0x00, 0x19, 0xfd, 0x65, 0x00, 
-0x32, 0x01, 0x9d, 0xfd, 0xd6, 0x00, 0x70, 0x01, 0xc0, 0x00, 0x82, 0x01, 0x49, 0x02, 0x02, 0x02, 
-0xb5, 0x01, 0x34, 0x02, 0x52, 0x02, 0xec, 0xff, 0x54, 0x01, 0xf0, 0xfe, 0xaa, 0xfe, 0x2b, 0xfe, 
-0xa2, 0xfd, 0x77, 0xfe, 0xf9, 0xfc, 0xbb, 0xfd, 0x5b, 0xfd, 0x3b, 0xfd, 0x17, 0xfe, 0x71, 0xfe, 
-0x95, 0xfe, 0x3e, 0xff, 0x00, 0xff, 0x04, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x80, 0x00, 0xf1, 0x01, 
-0xdf, 0xff, 0x4a, 0xff, 0x75, 0x01, 0x81, 0x00, 0x9a, 0xff, 0x7c, 0x00, 0x46, 0xff, 0x0c, 0xfe, 
-0x7e, 0xfe, 0xf2, 0xfe, 0xbc, 0xfd, 0x88, 0xfe, 0xf8, 0xfe, 0x5f, 0xfe, 0x82, 0x00, 0xb3, 0x00, 
-0xae, 0x01, 0xf5, 0x00, 0x96, 0x02, 0xcb, 0x01, 0xe0, 0x01, 0xcc, 0x03, 0xcf, 0x00, 0xee, 0x02, 
-0xda, 0x01, 0x17, 0x00, 0xba, 0x01, 0x79, 0x01, 0xe4, 0xfe, 0x41, 0x00, 0xe4, 0x00, 0xed, 0xfe, 
-0x9d, 0xff, 0x81, 0xff, 0xea, 0xff, 0xa6, 0xfe, 0x76, 0x01, 0xfb, 0x00, 0x3c, 0x00, 0xb6, 0x02, 
-0x24, 0x01, 0x4f, 0x02, 0x59, 0x01, 0x3d, 0x03, 0xa4, 0x02, 0x78, 0xff, 0x04, 0x03, 0xb0, 0x01, 
-0x56, 0xff, 0xfd, 0x02, 0x83, 0x01, 0xb6, 0xff, 0x85, 0x02, 0xe4, 0x01, 0xd2, 0x01, 0x0f, 0x04, 
-0x24, 0x02, 0x09, 0x01, 0xfc, 0x02, 0xde, 0x00, 0xd1, 0x00, 0x4c, 0x02, 0x66, 0x00, 0xd3, 0xfe, 
-0xf4, 0x00, 0xa8, 0x00, 0x6e, 0xff, 0x81, 0x00, 0xd8, 0xff, 0x07, 0xfc, 0xd9, 0xfa, 0x72, 0xfc, 
-0x55, 0xf9, 0x09, 0xfb, 0x1d, 0xfc, 0x1f, 0xfb, 0x93, 0xfc, 0x07, 0xfd, 0xbb, 0xfd, 0x61, 0xfc, 
-0x26, 0xff, 0x0a, 0xfe, 0x04, 0xfe, 0x0e, 0x01, 0xe0, 0xfd, 0xa8, 0x00, 0xce, 0xff, 0xcc, 0xfd, 
-0xfd, 0xfe, 0x2e, 0xfd, 0x45, 0xfd, 0x17, 0xfd, 0x0e, 0xfe, 0xa1, 0xfc, 0x2a, 0xfe, 0x9d, 0xff, 
-0x76, 0xfe, 0x19, 0x00, 0x75, 0xff, 0xfc, 0x00, 0xd7, 0xfe, 0x4a, 0xff, 0x29, 0x00, 0xcd, 0xfe, 
-0x82, 0x02, 0xe9, 0xfe, 0xf9, 0x00, 0x71, 0x01, 0x6e, 0xfe, 0xec, 0x01, 0x7a, 0xfe, 0x19, 0x00, 
-0xff, 0x00, 0xca, 0xff, 0x67, 0x01, 0x6d, 0x00, 0xb8, 0x01, 0xc2, 0x01, 0x39, 0x02, 0x2e, 0x02, 
-0x2c, 0x03, 0x6e, 0x04, 0xae, 0x02, 0x61, 0x02, 0x6d, 0x05, 0x27, 0x03, 0x87, 0x00, 0xd8, 0x04, 
-0x07, 0x02, 0xc1, 0xff, 0x02, 0x03, 0xee, 0xff, 0xe4, 0xfe, 0xd2, 0x00, 0xd3, 0xff, 0xec, 0xff, 
-0x66, 0x01, 0x96, 0x01, 0xfd, 0xfe, 0x49, 0x01, 0x1e, 0x01, 0x88, 0xfe, 0xb8, 0x02, 0x20, 0xff, 
-0x4f, 0xfe, 0x11, 0x03, 0x8b, 0xfd, 0xb4, 0xfe, 0xac, 0x01, 0x3c, 0xfe, 0x0a, 0x00, 0x3a, 0xff, 
-0x28, 0xff, 0x7b, 0xfe, 0x78, 0xfe, 0x62, 0xff, 0x3c, 0xfd, 0x71, 0x00, 0xd7, 0xfd, 0x98, 0xff, 
-0x7a, 0x01, 0x69, 0xfe, 0x5d, 0x01, 0x0c, 0x00, 0x98, 0x00, 0xb7, 0xff, 0x6e, 0x00, 0xe8, 0x00, 
-0xe1, 0xfc, 0x82, 0x00, 0xa3, 0xff, 0xdc, 0xfc, 0x8c, 0x00, 0x79, 0xfe, 0x18, 0xfd, 0x21, 0xff, 
-0xd4, 0xfd, 0x99, 0xfd, 0x62, 0xff, 0xd2, 0x00, 0xa8, 0xfe, 0xae, 0x00, 0xf2, 0x00, 0xd9, 0xfe, 
-0x1a, 0x02, 0x05, 0xff, 0x32, 0x00, 0x18, 0x00, 0x3b, 0xfe, 0x54, 0x00, 0x8e, 0xfe, 0x65, 0x00, 
-0xf0, 0xfe, 0x0b, 0x00, 0x21, 0x00, 0x5b, 0xfe, 0x5a, 0x01, 0x3b, 0xff, 0x65, 0x00, 0x48, 0x01, 
-0x4e, 0x01, 0x6f, 0x02, 0x88, 0x01, 0x67, 0x03, 0x6c, 0x01, 0xa8, 0x01, 0x1f, 0x03, 0xf0, 0xff, 
-0x1e, 0x02, 0xfb, 0x00, 0xe8, 0xff, 0x87, 0x01, 0x64, 0xfe, 0x28, 0x01, 0x8d, 0xff, 0xf1, 0xfd, 
-0xb5, 0x01, 0xe9, 0xfd, 0xb0, 0xfe, 0x07, 0x00, 0xc6, 0xfc, 0x6d, 0xfe, 0xc5, 0xfe, 0x12, 0xfc, 
-0x25, 0xfe, 0x02, 0xff, 0x14, 0xfc, 0x9f, 0xfe, 0xfa, 0xff, 0x54, 0xfd, 0x45, 0xff, 0x53, 0x00, 
-0x80, 0xfd, 0xbb, 0xff, 0x6e, 0x00, 0x6c, 0xff, 0xa7, 0x03, 0x05, 0x02, 0xf0, 0x01, 0xf8, 0x05, 
-0xe8, 0x01, 0xbe, 0x04, 0x7b, 0x06, 0xe0, 0x02, 0x94, 0x07, 0x21, 0x05, 0x36, 0x05, 0x64, 0x07, 
-0xed, 0x04, 0x15, 0x06, 0x9e, 0x04, 0x3b, 0x04, 0x36, 0x01, 0xf2, 0x01, 0xae, 0x00, 0x4f, 0xfc, 
-0x8b, 0x00, 0x46, 0xfb, 0xfb, 0xf9, 0x53, 0xfc, 0xad, 0xf5, 0x47, 0xf7, 0x96, 0xf5, 0x6d, 0xf2, 
-0x5b, 0xf5, 0xff, 0xf2, 0xcf, 0xf3, 0x78, 0xf4, 0xdc, 0xf4, 0xfb, 0xf5, 0x43, 0xf6, 0xca, 0xfb, 
-0xb6, 0xfa, 0x5e, 0xff, 0x0c, 0x06, 0x04, 0x05, 0xa5, 0x0b, 0x66, 0x0f, 0x25, 0x0f, 0xb8, 0x12, 
-0x94, 0x13, 0x30, 0x11, 0x9e, 0x12, 0x3f, 0x11, 0x00, 0x0e, 0xc2, 0x0e, 0xc2, 0x0a, 0xc6, 0x08, 
-0x78, 0x07, 0x0b, 0x03, 0x04, 0x01, 0x21, 0xfe, 0x90, 0xfb, 0x68, 0xf8, 0xd1, 0xf6, 0xb5, 0xf5, 
-0x00, 0xf3, 0xf9, 0xf3, 0x07, 0xf3, 0xa4, 0xf1, 0x66, 0xf2, 0x27, 0xf0, 0x7c, 0xef, 0x5c, 0xed, 
-0xd8, 0xed, 0x3c, 0xed, 0x22, 0xed, 0xb9, 0xf3, 0xf4, 0xf2, 0x58, 0xfa, 0x70, 0x00, 0xc5, 0x01, 
-0xf1, 0x0a, 0x4b, 0x0c, 0x39, 0x10, 0x85, 0x14, 0x59, 0x14, 0x82, 0x16, 0xf0, 0x16, 0x7e, 0x16, 
-0x65, 0x14, 0xba, 0x13, 0xb2, 0x10, 0x1c, 0x0c, 0x77, 0x0a, 0x7c, 0x05, 0xd6, 0x01, 0xcf, 0xff, 
-0x94, 0xfb, 0x66, 0xfa, 0xd4, 0xf8, 0x7d, 0xf5, 0x83, 0xf6, 0x89, 0xf5, 0x64, 0xf3, 0x41, 0xf6, 
-0x0b, 0xf4, 0x26, 0xf2, 0x80, 0xf4, 0x7f, 0xee, 0x1e, 0xee, 0x70, 0xed, 0x9e, 0xe7, 0x24, 0xed, 
-0xb4, 0xec, 0xd0, 0xee, 0x0b, 0xf9, 0x40, 0xfa, 0x19, 0x01, 0xdb, 0x08, 0x7a, 0x09, 0xb1, 0x0f, 
-0xea, 0x13, 0x6d, 0x13, 0x94, 0x16, 0x78, 0x18, 0xb0, 0x16, 0xc9, 0x17, 0xd7, 0x16, 0x9a, 0x12, 
-0x09, 0x10, 0x4b, 0x0b, 0x59, 0x06, 0x4c, 0x03, 0x90, 0xff, 0x47, 0xfd, 0x4a, 0xfb, 0xc3, 0xf9, 
-0x74, 0xf9, 0x42, 0xf8, 0xc4, 0xf7, 0x2b, 0xf8, 0x89, 0xf7, 0xbb, 0xf6, 0x23, 0xf8, 0x9f, 0xf5, 
-0xb2, 0xf3, 0x0d, 0xf1, 0x75, 0xed, 0xfb, 0xe9, 0x7a, 0xe7, 0x3c, 0xeb, 0x21, 0xea, 0xf0, 0xf0, 
-0xb6, 0xf8, 0x97, 0xf9, 0x87, 0x03, 0xad, 0x07, 0xd9, 0x08, 0xf1, 0x10, 0x17, 0x12, 0x7e, 0x12, 
-0x44, 0x18, 0x74, 0x16, 0x0f, 0x17, 0xc3, 0x18, 0x77, 0x13, 0x69, 0x12, 0x5c, 0x0d, 0x17, 0x08, 
-0x10, 0x06, 0xde, 0x00, 0x56, 0xff, 0xa1, 0xfd, 0x77, 0xfb, 0xa4, 0xfb, 0xbd, 0xfa, 0x3a, 0xfb, 
-0x47, 0xfa, 0x06, 0xfa, 0x40, 0xfa, 0xff, 0xf8, 0x15, 0xfa, 0xea, 0xf7, 0x72, 0xf6, 0x12, 0xf3, 
-0x96, 0xee, 0x05, 0xeb, 0x59, 0xe7, 0x13, 0xe8, 0xd8, 0xe8, 0xd3, 0xec, 0x54, 0xf3, 0xf9, 0xf7, 
-0xb6, 0xfe, 0x6a, 0x04, 0xa9, 0x08, 0x8c, 0x0e, 0x1c, 0x12, 0x72, 0x15, 0x42, 0x17, 0xbf, 0x18, 
-0xba, 0x18, 0x4b, 0x17, 0x99, 0x16, 0xc3, 0x11, 0x3a, 0x0e, 0x69, 0x0a, 0x80, 0x04, 0xb3, 0x02, 
-0x87, 0xff, 0xa6, 0xfb, 0xe4, 0xfb, 0x37, 0xf9, 0xd2, 0xf8, 0x8a, 0xfa, 0xf5, 0xf8, 0xba, 0xfb, 
-0xe6, 0xfa, 0x53, 0xfb, 0x74, 0xfd, 0x5b, 0xfa, 0xc3, 0xfb, 0xf7, 0xf7, 0x43, 0xf4, 0x0f, 0xf1, 
-0x30, 0xeb, 0xae, 0xe8, 0xb7, 0xe5, 0xc9, 0xe8, 0xae, 0xe9, 0x8d, 0xef, 0x1e, 0xf8, 0xde, 0xf9, 
-0x5c, 0x04, 0xcb, 0x08, 0xb7, 0x0c, 0xf6, 0x13, 0x74, 0x14, 0x89, 0x17, 0xa3, 0x18, 0x00, 0x19, 
-0xa7, 0x17, 0x2d, 0x16, 0x76, 0x12, 0x8f, 0x0d, 0xf7, 0x09, 0x56, 0x04, 0xac, 0x01, 0x9f, 0xfd, 
-0xa6, 0xfa, 0x82, 0xfa, 0x72, 0xf8, 0x98, 0xf9, 0x80, 0xfa, 0xea, 0xfa, 0x04, 0xfd, 0x57, 0xfe, 
-0x53, 0x00, 0x56, 0xff, 0xce, 0xff, 0x64, 0xfc, 0xda, 0xf8, 0x07, 0xf6, 0x40, 0xef, 0xa0, 0xec, 
-0x5c, 0xe8, 0x90, 0xe8, 0x1c, 0xea, 0xc1, 0xed, 0xb5, 0xf3, 0x85, 0xf6, 0x67, 0xfe, 0x47, 0x02, 
-0x44, 0x08, 0xca, 0x0e, 0x27, 0x0f, 0x53, 0x14, 0x70, 0x15, 0x01, 0x15, 0xd2, 0x18, 0x4a, 0x15, 
-0xe3, 0x12, 0xe0, 0x10, 0xd4, 0x09, 0x94, 0x07, 0x78, 0x03, 0x3e, 0x00, 0x4f, 0xfd, 0xe3, 0xfa, 
-0x81, 0xfa, 0x53, 0xf8, 0x12, 0xfb, 0x27, 0xfb, 0x85, 0xfb, 0x27, 0xff, 0x4f, 0xff, 0xbf, 0x01, 
-0x2e, 0x02, 0x8a, 0x00, 0x86, 0xfe, 0xf0, 0xf9, 0x87, 0xf6, 0x94, 0xf0, 0x65, 0xed, 0x8b, 0xe9, 
-0x26, 0xe8, 0x71, 0xea, 0xcd, 0xeb, 0x8a, 0xf2, 0x52, 0xf5, 0xb7, 0xfa, 0xdd, 0x00, 0x27, 0x04, 
-0xec, 0x0a, 0xea, 0x0d, 0x3d, 0x11, 0x14, 0x14, 0x51, 0x15, 0x99, 0x16, 0xa9, 0x15, 0xfa, 0x14, 
-0xd2, 0x10, 0xf6, 0x0c, 0x5e, 0x09, 0x09, 0x04, 0x17, 0x02, 0xec, 0xfd, 0x99, 0xfb, 0xba, 0xfa, 
-0x36, 0xf9, 0x98, 0xfa, 0x92, 0xfa, 0x72, 0xfc, 0xad, 0xfd, 0x15, 0xff, 0x62, 0x01, 0xe0, 0x00, 
-0xf1, 0x00, 0xd5, 0xfe, 0xd8, 0xfa, 0xd8, 0xf7, 0x61, 0xf2, 0xb2, 0xed, 0x98, 0xea, 0x9a, 0xe7, 
-0x56, 0xe9, 0xcc, 0xeb, 0xd5, 0xf0, 0x96, 0xf5, 0x1a, 0xfa, 0x2f, 0x00, 0x24, 0x04, 0xa5, 0x09, 
-0x68, 0x0d, 0x7b, 0x10, 0x84, 0x13, 0xa3, 0x15, 0xae, 0x16, 0xca, 0x17, 0xc7, 0x15, 0x4a, 0x12, 
-0x0a, 0x0f, 0x8a, 0x08, 0x64, 0x06, 0x16, 0x02, 0x09, 0xfe, 0x7b, 0xfd, 0x52, 0xf9, 0xb2, 0xf9, 
-0x26, 0xfa, 0x55, 0xf9, 0xbc, 0xfb, 0x71, 0xfc, 0xd1, 0xfd, 0x76, 0x00, 0x41, 0x01, 0xcf, 0x00, 
-0x0d, 0x00, 0xe5, 0xfb, 0x4e, 0xf8, 0x81, 0xf4, 0x03, 0xee, 0xd1, 0xeb, 0xd6, 0xe7, 0x7a, 0xe7, 
-0x7f, 0xeb, 0xfc, 0xec, 0x9d, 0xf3, 0x3e, 0xf8, 0x24, 0xfc, 0xd8, 0x03, 0x66, 0x07, 0xfb, 0x0b, 
-0xc8, 0x10, 0xcb, 0x11, 0x70, 0x15, 0xcd, 0x16, 0x95, 0x16, 0xeb, 0x16, 0x75, 0x13, 0x06, 0x10, 
-0x59, 0x0c, 0x1b, 0x08, 0x78, 0x04, 0x60, 0x01, 0x22, 0xfe, 0x8a, 0xfb, 0x0a, 0xfb, 0x2a, 0xfa, 
-0x12, 0xfa, 0x22, 0xfc, 0x1e, 0xfc, 0x38, 0xfe, 0x0f, 0x01, 0x08, 0x01, 0x29, 0x02, 0xa3, 0x00, 
-0x97, 0xfd, 0xb1, 0xf9, 0xde, 0xf5, 0x10, 0xf0, 0x49, 0xeb, 0xce, 0xe8, 0xfd, 0xe5, 0x99, 0xe8, 
-0x8d, 0xeb, 0xe9, 0xef, 0xbd, 0xf4, 0x30, 0xfa, 0xd1, 0xff, 0xc2, 0x04, 0x01, 0x0b, 0x95, 0x0d, 
-0x06, 0x12, 0xc1, 0x14, 0x36, 0x16, 0x4c, 0x18, 0x5d, 0x16, 0x29, 0x15, 0xf5, 0x10, 0x7f, 0x0c, 
-0xdc, 0x09, 0xcd, 0x04, 0x35, 0x02, 0x87, 0xff, 0x1d, 0xfc, 0xe6, 0xfa, 0x21, 0xfa, 0x6f, 0xf9, 
-0x2e, 0xfa, 0x56, 0xfc, 0x81, 0xfd, 0xa1, 0x00, 0x08, 0x03, 0xfc, 0x02, 0x2f, 0x03, 0x71, 0x00, 
-0x85, 0xfc, 0xbc, 0xf8, 0x4d, 0xf3, 0xd0, 0xee, 0xe3, 0xea, 0x17, 0xe8, 0x6b, 0xe8, 0x31, 0xea, 
-0xc1, 0xed, 0xd7, 0xf1, 0xa1, 0xf6, 0xe3, 0xfb, 0xa4, 0x01, 0x1d, 0x07, 0x8a, 0x0b, 0x7a, 0x0f, 
-0xe7, 0x11, 0xc1, 0x14, 0xb2, 0x15, 0x17, 0x16, 0x8b, 0x15, 0xf7, 0x11, 0x2b, 0x0f, 0x79, 0x0b, 
-0x75, 0x07, 0xe2, 0x04, 0x6e, 0x01, 0xc6, 0xfe, 0xb6, 0xfc, 0x88, 0xfb, 0x47, 0xfb, 0xe0, 0xfa, 
-0xbd, 0xfc, 0xc4, 0xfc, 0xe5, 0xfe, 0x3f, 0x01, 0xce, 0x00, 0x4f, 0x02, 0x5c, 0x00, 0x2b, 0xfd, 
-0xe1, 0xf9, 0xb4, 0xf5, 0x89, 0xf0, 0x86, 0xec, 0x05, 0xea, 0x75, 0xe7, 0xaf, 0xe9, 0x12, 0xed, 
-0x67, 0xf0, 0xaa, 0xf5, 0xdc, 0xfa, 0x71, 0xff, 0x11, 0x05, 0x5d, 0x0a, 0x4a, 0x0d, 0xb3, 0x10, 
-0x6c, 0x13, 0xaa, 0x14, 0xdb, 0x15, 0xbb, 0x15, 0xb7, 0x13, 0x0e, 0x10, 0xdb, 0x0c, 0x42, 0x09, 
-0x52, 0x05, 0x39, 0x03, 0xb5, 0xff, 0x27, 0xfd, 0x65, 0xfc, 0xec, 0xfa, 0x68, 0xfb, 0xfb, 0xfb, 
-0xcb, 0xfc, 0xeb, 0xfe, 0x3d, 0x00, 0x2d, 0x02, 0x67, 0x02, 0x5a, 0x01, 0xa8, 0xff, 0x3a, 0xfb, 
-0xfa, 0xf7, 0x59, 0xf3, 0x87, 0xee, 0x33, 0xeb, 0x3e, 0xe8, 0x6b, 0xe8, 0xad, 0xe9, 0x87, 0xed, 
-0x7c, 0xf1, 0x90, 0xf5, 0xde, 0xfb, 0x8d, 0x00, 0x1f, 0x06, 0x91, 0x0b, 0x44, 0x0e, 0x63, 0x11, 
-0x68, 0x14, 0x23, 0x15, 0xfb, 0x15, 0xe0, 0x15, 0x4a, 0x12, 0x92, 0x0f, 0x4c, 0x0c, 0xa6, 0x07, 
-0x75, 0x05, 0xd3, 0x01, 0x82, 0xfe, 0x14, 0xfd, 0x7d, 0xfb, 0x3a, 0xfb, 0x89, 0xfb, 0x6b, 0xfc, 
-0x66, 0xfd, 0x45, 0xff, 0x23, 0x01, 0x02, 0x02, 0xed, 0x01, 0xbd, 0x00, 0xe0, 0xfd, 0xc3, 0xf9, 
-0x89, 0xf6, 0x83, 0xf1, 0x5e, 0xed, 0x97, 0xea, 0xc2, 0xe8, 0x18, 0xea, 0x67, 0xec, 0xe2, 0xf0, 
-0x95, 0xf4, 0x09, 0xf9, 0x6b, 0xff, 0x71, 0x03, 0x13, 0x09, 0x11, 0x0e, 0x0f, 0x10, 0x4b, 0x13, 
-0x6d, 0x15, 0x7c, 0x15, 0xac, 0x15, 0xf9, 0x13, 0xd7, 0x0f, 0x64, 0x0c, 0x0b, 0x09, 0xfb, 0x04, 
-0x64, 0x02, 0xce, 0xff, 0x8d, 0xfc, 0x7f, 0xfb, 0xeb, 0xfa, 0x12, 0xfa, 0x60, 0xfb, 0xf8, 0xfb, 
-0x3b, 0xfd, 0x9c, 0xff, 0x03, 0x01, 0xfb, 0x01, 0x02, 0x01, 0xcc, 0xff, 0xf1, 0xfb, 0x26, 0xf8, 
-0x15, 0xf5, 0x1f, 0xef, 0x44, 0xec, 0xf4, 0xe9, 0xf4, 0xe8, 0xc6, 0xeb, 0xa6, 0xee, 0x0c, 0xf3, 
-0x3e, 0xf7, 0x18, 0xfc, 0x3d, 0x02, 0xa3, 0x06, 0xef, 0x0b, 0x3e, 0x10, 0x25, 0x12, 0x45, 0x15, 
-0xd9, 0x16, 0x5f, 0x16, 0x03, 0x16, 0x12, 0x13, 0xb2, 0x0e, 0x25, 0x0b, 0x83, 0x07, 0xd5, 0x03, 
-0xad, 0x00, 0x79, 0xfe, 0xea, 0xfb, 0xe1, 0xfa, 0x03, 0xfb, 0x77, 0xfa, 0x6c, 0xfb, 0xd7, 0xfc, 
-0x5a, 0xfe, 0x0a, 0x00, 0x9b, 0x01, 0x87, 0x01, 0x0b, 0x00, 0x03, 0xfe, 0x41, 0xfa, 0xb4, 0xf6, 
-0x34, 0xf2, 0xac, 0xed, 0xbf, 0xea, 0xb4, 0xe8, 0xee, 0xe9, 0x41, 0xec, 0x26, 0xef, 0x30, 0xf4, 
-0x4e, 0xf8, 0x17, 0xfd, 0x85, 0x03, 0x37, 0x08, 0x16, 0x0c, 0x27, 0x10, 0xb0, 0x12, 0xa8, 0x14, 
-0x42, 0x16, 0xfb, 0x15, 0x7a, 0x14, 0x76, 0x11, 0xd0, 0x0d, 0x5e, 0x0a, 0xe8, 0x06, 0xa6, 0x03, 
-0x7b, 0x00, 0x18, 0xfe, 0x75, 0xfc, 0x8d, 0xfb, 0x5a, 0xfb, 0x83, 0xfb, 0x21, 0xfc, 0xa6, 0xfd, 
-0x31, 0xff, 0xbf, 0x00, 0xd1, 0x01, 0xeb, 0x00, 0x7f, 0xff, 0xf5, 0xfc, 0x30, 0xf9, 0xbb, 0xf5, 
-0x50, 0xf1, 0xd1, 0xec, 0x16, 0xea, 0x5f, 0xe9, 0xbc, 0xea, 0xf3, 0xec, 0xc9, 0xf0, 0x43, 0xf5, 
-0x61, 0xf9, 0x2a, 0xff, 0x96, 0x04, 0x0a, 0x09, 0x27, 0x0d, 0x31, 0x10, 0xd5, 0x12, 0xca, 0x14, 
-0xd3, 0x15, 0x79, 0x15, 0x6a, 0x13, 0x9b, 0x10, 0x44, 0x0d, 0xf7, 0x09, 0xb9, 0x06, 0x6f, 0x03, 
-0x9f, 0x00, 0x34, 0xfe, 0xa7, 0xfc, 0xe6, 0xfb, 0x99, 0xfb, 0x8d, 0xfb, 0x4c, 0xfc, 0x43, 0xfd, 
-0x65, 0xfe, 0xf6, 0xff, 0xfb, 0xff, 0x3b, 0xff, 0xb8, 0xfd, 0xdf, 0xfa, 0xc6, 0xf7, 0x70, 0xf4, 
-0x8f, 0xf0, 0xb9, 0xec, 0xa9, 0xea, 0xa1, 0xea, 0x05, 0xec, 0xa7, 0xee, 0x44, 0xf2, 0x86, 0xf6, 
-0xf9, 0xfa, 0xdd, 0xff, 0x20, 0x05, 0xaa, 0x09, 0x45, 0x0d, 0x41, 0x10, 0xce, 0x12, 0xbc, 0x14, 
-0x69, 0x15, 0xc1, 0x14, 0xee, 0x12, 0x11, 0x10, 0xd5, 0x0c, 0xd3, 0x09, 0xff, 0x06, 0x5e, 0x04, 
-0xb4, 0x01, 0xb3, 0xff, 0x82, 0xfe, 0xb2, 0xfd, 0x65, 0xfd, 0x56, 0xfd, 0x7b, 0xfd, 0xdc, 0xfd, 
-0xb5, 0xfe, 0x3a, 0xff, 0xfd, 0xfe, 0x0c, 0xfe, 0x1c, 0xfc, 0x55, 0xf9, 0x47, 0xf6, 0x33, 0xf3, 
-0x54, 0xef, 0xd3, 0xeb, 0x37, 0xea, 0x50, 0xea, 0xdc, 0xeb, 0x4b, 0xee, 0x9d, 0xf1, 0xf5, 0xf5, 
-0x6c, 0xfa, 0x44, 0xff, 0x92, 0x04, 0x49, 0x09, 0x49, 0x0d, 0x88, 0x10, 0x4a, 0x13, 0x95, 0x15, 
-0x4d, 0x16, 0x91, 0x15, 0xd0, 0x13, 0xee, 0x10, 0x02, 0x0e, 0x23, 0x0b, 0x3c, 0x08, 0xa6, 0x05, 
-0x07, 0x03, 0x01, 0x01, 0x9d, 0xff, 0x59, 0xfe, 0xa8, 0xfd, 0x37, 0xfd, 0xa5, 0xfc, 0xbc, 0xfc, 
-0x1c, 0xfd, 0x07, 0xfd, 0x8a, 0xfc, 0x64, 0xfb, 0x81, 0xf9, 0xde, 0xf6, 0x3a, 0xf4, 0x7d, 0xf1, 
-0xdf, 0xed, 0x14, 0xeb, 0x9b, 0xea, 0x80, 0xeb, 0x0e, 0xed, 0xbd, 0xef, 0xa8, 0xf3, 0x11, 0xf8, 
-0x9e, 0xfc, 0xab, 0x01, 0xf0, 0x06, 0x81, 0x0b, 0x16, 0x0f, 0x54, 0x12, 0x1e, 0x15, 0xaf, 0x16, 
-0xf4, 0x16, 0xd0, 0x15, 0x46, 0x13, 0x64, 0x10, 0x83, 0x0d, 0x33, 0x0a, 0x2f, 0x07, 0x62, 0x04, 
-0xa4, 0x01, 0x94, 0xff, 0xf2, 0xfd, 0xce, 0xfc, 0x0d, 0xfc, 0x67, 0xfb, 0x52, 0xfb, 0x80, 0xfb, 
-0xd2, 0xfb, 0x0c, 0xfc, 0x36, 0xfb, 0xea, 0xf9, 0xfc, 0xf7, 0x7d, 0xf5, 0x25, 0xf3, 0xd6, 0xef, 
-0xae, 0xec, 0x64, 0xeb, 0x36, 0xeb, 0x73, 0xec, 0xf0, 0xee, 0xfa, 0xf1, 0x73, 0xf6, 0x34, 0xfb, 
-0x07, 0x00, 0x9c, 0x05, 0x66, 0x0a, 0x7a, 0x0e, 0xde, 0x11, 0x71, 0x14, 0x9d, 0x16, 0x09, 0x17, 
-0x1c, 0x16, 0x4a, 0x14, 0xf8, 0x10, 0xf3, 0x0d, 0x0a, 0x0b, 0xa4, 0x07, 0xd9, 0x04, 0x2a, 0x02, 
-0xef, 0xff, 0x45, 0xfe, 0xe2, 0xfc, 0x6b, 0xfc, 0xd4, 0xfb, 0x56, 0xfb, 0xce, 0xfb, 0x17, 0xfc, 
-0x7f, 0xfc, 0x36, 0xfc, 0xf9, 0xfa, 0x7d, 0xf9, 0xf3, 0xf6, 0x80, 0xf4, 0xa8, 0xf1, 0x2d, 0xee, 
-0x31, 0xec, 0x4e, 0xeb, 0xc7, 0xeb, 0x0e, 0xee, 0xd8, 0xf0, 0xc3, 0xf4, 0x65, 0xf9, 0x26, 0xfe, 
-0x98, 0x03, 0x9b, 0x08, 0xee, 0x0c, 0x9f, 0x10, 0x69, 0x13, 0xb9, 0x15, 0xae, 0x16, 0x27, 0x16, 
-0xc5, 0x14, 0xf9, 0x11, 0xba, 0x0e, 0x92, 0x0b, 0x4f, 0x08, 0x8e, 0x05, 0xa5, 0x02, 0x12, 0x00, 
-0x52, 0xfe, 0xad, 0xfc, 0xbc, 0xfb, 0x2c, 0xfb, 0xa4, 0xfa, 0xec, 0xfa, 0x57, 0xfb, 0xad, 0xfb, 
-0xe5, 0xfb, 0x53, 0xfb, 0x22, 0xfa, 0xfd, 0xf7, 0x8d, 0xf5, 0x1e, 0xf3, 0xbc, 0xef, 0x10, 0xed, 
-0xf6, 0xeb, 0xce, 0xeb, 0x69, 0xed, 0x24, 0xf0, 0xb0, 0xf3, 0x2c, 0xf8, 0xc2, 0xfc, 0x09, 0x02, 
-0x56, 0x07, 0xfb, 0x0b, 0xfd, 0x0f, 0x08, 0x13, 0xbf, 0x15, 0x41, 0x17, 0x11, 0x17, 0x21, 0x16, 
-0xdf, 0x13, 0x97, 0x10, 0x2f, 0x0d, 0x93, 0x09, 0x79, 0x06, 0x76, 0x03, 0x8a, 0x00, 0x96, 0xfe, 
-0xda, 0xfc, 0xab, 0xfb, 0x28, 0xfb, 0xb7, 0xfa, 0x01, 0xfb, 0x5e, 0xfb, 0xa7, 0xfb, 0x27, 0xfc, 
-0xb9, 0xfb, 0xc4, 0xfa, 0x12, 0xf9, 0x97, 0xf6, 0x45, 0xf4, 0x19, 0xf1, 0xc9, 0xed, 0x01, 0xec, 
-0x4d, 0xeb, 0xed, 0xeb, 0x15, 0xee, 0x4e, 0xf1, 0x6f, 0xf5, 0xe0, 0xf9, 0xdd, 0xfe, 0x55, 0x04, 
-0x58, 0x09, 0xa0, 0x0d, 0x1d, 0x11, 0x15, 0x14, 0x3d, 0x16, 0xd0, 0x16, 0x5b, 0x16, 0xf2, 0x14, 
-0x23, 0x12, 0x9a, 0x0e, 0x12, 0x0b, 0xc8, 0x07, 0x97, 0x04, 0xa6, 0x01, 0x91, 0xff, 0xf5, 0xfd, 
-0xa5, 0xfc, 0x10, 0xfc, 0xe5, 0xfb, 0x00, 0xfc, 0x4b, 0xfc, 0x9b, 0xfc, 0x0d, 0xfd, 0x1f, 0xfd, 
-0x75, 0xfc, 0x28, 0xfb, 0x23, 0xf9, 0xd1, 0xf6, 0x24, 0xf4, 0xbc, 0xf0, 0xe5, 0xed, 0x87, 0xec, 
-0x23, 0xec, 0x0d, 0xed, 0xa8, 0xef, 0x36, 0xf3, 0x41, 0xf7, 0xdc, 0xfb, 0xfe, 0x00, 0x27, 0x06, 
-0xb0, 0x0a, 0x7c, 0x0e, 0xb9, 0x11, 0x47, 0x14, 0xa4, 0x15, 0xc4, 0x15, 0xfb, 0x14, 0xf2, 0x12, 
-0xaa, 0x0f, 0x13, 0x0c, 0xb0, 0x08, 0x64, 0x05, 0x57, 0x02, 0xef, 0xff, 0x2c, 0xfe, 0xc6, 0xfc, 
-0xda, 0xfb, 0xa2, 0xfb, 0xb4, 0xfb, 0xdc, 0xfb, 0x5a, 0xfc, 0x07, 0xfd, 0x93, 0xfd, 0x7e, 0xfd, 
-0xa7, 0xfc, 0x39, 0xfb, 0xf6, 0xf8, 0x21, 0xf6, 0xf0, 0xf2, 0x7c, 0xef, 0xe8, 0xec, 0xa5, 0xeb, 
-0x75, 0xeb, 0x02, 0xed, 0xf6, 0xef, 0x91, 0xf3, 0x12, 0xf8, 0x12, 0xfd, 0x56, 0x02, 0x65, 0x07, 
-0xab, 0x0b, 0x76, 0x0f, 0x94, 0x12, 0xa0, 0x14, 0x84, 0x15, 0x3f, 0x15, 0xf8, 0x13, 0x80, 0x11, 
-0x20, 0x0e, 0xd2, 0x0a, 0x93, 0x07, 0x6f, 0x04, 0xbd, 0x01, 0x95, 0xff, 0x1b, 0xfe, 0xec, 0xfc, 
-0x28, 0xfc, 0x1c, 0xfc, 0x1f, 0xfc, 0x33, 0xfc, 0xa3, 0xfc, 0x1a, 0xfd, 0x68, 0xfd, 0x25, 0xfd, 
-0x5a, 0xfc, 0x1a, 0xfb, 0x19, 0xf9, 0xc8, 0xf6, 0x03, 0xf4, 0x41, 0xf1, 0x6d, 0xef, 0x53, 0xee, 
-0x86, 0xee, 0x48, 0xf0, 0xda, 0xf2, 0x5e, 0xf6, 0xad, 0xfa, 0x5d, 0xff, 0x2a, 0x04, 0x90, 0x08, 
-0x9b, 0x0c, 0x0e, 0x10, 0xa3, 0x12, 0x61, 0x14, 0x0b, 0x15, 0x98, 0x14, 0x0d, 0x13, 0x87, 0x10, 
-0x5d, 0x0d, 0xea, 0x09, 0x90, 0x06, 0x7d, 0x03, 0x02, 0x01, 0x1a, 0xff, 0x86, 0xfd, 0x6d, 0xfc, 
-0xd6, 0xfb, 0x81, 0xfb, 0x55, 0xfb, 0x7e, 0xfb, 0xd3, 0xfb, 0x17, 0xfc, 0x2d, 0xfc, 0x22, 0xfc, 
-0x9a, 0xfb, 0x34, 0xfa, 0x67, 0xf8, 0x6e, 0xf6, 0xfa, 0xf3, 0x99, 0xf1, 0x20, 0xf0, 0x79, 0xef, 
-0xc3, 0xef, 0x4e, 0xf1, 0xc5, 0xf3, 0xf1, 0xf6, 0xd7, 0xfa, 0x08, 0xff, 0x6c, 0x03, 0xb8, 0x07, 
-0x74, 0x0b, 0xc8, 0x0e, 0x3b, 0x11, 0xc7, 0x12, 0x69, 0x13, 0xd5, 0x12, 0x7f, 0x11, 0x3b, 0x0f, 
-0x53, 0x0c, 0x5f, 0x09, 0x33, 0x06, 0x49, 0x03, 0xf0, 0x00, 0xd7, 0xfe, 0x33, 0xfd, 0x0a, 0xfc, 
-0x69, 0xfb, 0x2d, 0xfb, 0x24, 0xfb, 0x9c, 0xfb, 0x1c, 0xfc, 0x83, 0xfc, 0xd3, 0xfc, 0xc2, 0xfc, 
-0x4e, 0xfc, 0x4f, 0xfb, 0xf3, 0xf9, 0x58, 0xf8, 0x66, 0xf6, 0x70, 0xf4, 0x12, 0xf3, 0x53, 0xf2, 
-0x30, 0xf2, 0x1a, 0xf3, 0xc8, 0xf4, 0x0e, 0xf7, 0x0d, 0xfa, 0x86, 0xfd, 0x48, 0x01, 0x19, 0x05, 
-0xab, 0x08, 0xfc, 0x0b, 0xa9, 0x0e, 0x82, 0x10, 0x8d, 0x11, 0x77, 0x11, 0x96, 0x10, 0xfa, 0x0e, 
-0xb9, 0x0c, 0x2c, 0x0a, 0x6f, 0x07, 0xd9, 0x04, 0x5f, 0x02, 0x56, 0x00, 0xba, 0xfe, 0x53, 0xfd, 
-0x72, 0xfc, 0xef, 0xfb, 0x91, 0xfb, 0xa3, 0xfb, 0xff, 0xfb, 0x41, 0xfc, 0x9c, 0xfc, 0xb6, 0xfc, 
-0x83, 0xfc, 0x31, 0xfc, 0x77, 0xfb, 0x93, 0xfa, 0x47, 0xf9, 0xd2, 0xf7, 0x6c, 0xf6, 0x4a, 0xf5, 
-0xd5, 0xf4, 0xc7, 0xf4, 0x6f, 0xf5, 0xa7, 0xf6, 0x76, 0xf8, 0xed, 0xfa, 0xdd, 0xfd, 0xf5, 0x00, 
-0xf5, 0x03, 0xdb, 0x06, 0x6b, 0x09, 0x98, 0x0b, 0x2f, 0x0d, 0xf6, 0x0d, 0xde, 0x0d, 0x22, 0x0d, 
-0xbb, 0x0b, 0xfc, 0x09, 0x00, 0x08, 0xd2, 0x05, 0xad, 0x03, 0xb1, 0x01, 0x27, 0x00, 0xb7, 0xfe, 
-0x8d, 0xfd, 0xca, 0xfc, 0x34, 0xfc, 0xfc, 0xfb, 0x05, 0xfc, 0x57, 0xfc, 0xb8, 0xfc, 0x09, 0xfd, 
-0x60, 0xfd, 0x8a, 0xfd, 0x8b, 0xfd, 0x32, 0xfd, 0xa9, 0xfc, 0x07, 0xfc, 0xe5, 0xfa, 0xdc, 0xf9, 
-0xce, 0xf8, 0x38, 0xf8, 0xaa, 0xf7, 0x4d, 0xf7, 0xfe, 0xf7, 0xc5, 0xf8, 0x22, 0xfa, 0x47, 0xfc, 
-0xde, 0xfe, 0x53, 0x01, 0xcc, 0x03, 0x88, 0x06, 0x87, 0x08, 0x7a, 0x0a, 0xa8, 0x0b, 0xf2, 0x0b, 
-0xde, 0x0b, 0xd5, 0x0a, 0x63, 0x09, 0x8c, 0x07, 0x80, 0x05, 0x7c, 0x03, 0xce, 0x01, 0xdd, 0xff, 
-0xa2, 0xfe, 0xd0, 0xfd, 0x2a, 0xfd, 0x38, 0xfd, 0x63, 0xfd, 0x02, 0xfe, 0xd7, 0xfe, 0xa5, 0xff, 
-0x4a, 0x00, 0xc5, 0x00, 0xf6, 0x00, 0x94, 0x00, 0x9a, 0xff, 0x40, 0xfe, 0x9a, 0xfc, 0x7c, 0xfa, 
-0x71, 0xf8, 0xa4, 0xf6, 0x10, 0xf5, 0x05, 0xf4, 0x5b, 0xf3, 0x9f, 0xf3, 0xcb, 0xf4, 0x77, 0xf6, 
-0xd8, 0xf8, 0xdc, 0xfb, 0x1f, 0xff, 0x89, 0x02, 0xcc, 0x05, 0xa2, 0x08, 0x1b, 0x0b, 0xaa, 0x0c, 
-0x36, 0x0d, 0x28, 0x0d, 0x69, 0x0c, 0xd2, 0x0a, 0xcf, 0x08, 0xb9, 0x06, 0xbf, 0x04, 0xab, 0x02, 
-0xdc, 0x00, 0x59, 0xff, 0x00, 0xfe, 0x4f, 0xfd, 0xb3, 0xfc, 0x74, 0xfc, 0xc7, 0xfc, 0x31, 0xfd, 
-0x1c, 0xfe, 0x00, 0xff, 0x98, 0xff, 0x4a, 0x00, 0xb0, 0x00, 0xda, 0x00, 0xd6, 0x00, 0x5c, 0x00, 
-0x89, 0xff, 0x74, 0xfe, 0x45, 0xfd, 0x15, 0xfc, 0xc4, 0xfa, 0x63, 0xf9, 0x63, 0xf8, 0xdb, 0xf7, 
-0x7c, 0xf7, 0xc6, 0xf7, 0xa5, 0xf8, 0xd4, 0xf9, 0x8b, 0xfb, 0x47, 0xfd, 0x16, 0xff, 0x32, 0x01, 
-0x19, 0x03, 0xc2, 0x04, 0x2c, 0x06, 0x15, 0x07, 0x92, 0x07, 0x8e, 0x07, 0x41, 0x07, 0x93, 0x06, 
-0xb2, 0x05, 0x8c, 0x04, 0x76, 0x03, 0x7b, 0x02, 0x41, 0x01, 0x70, 0x00, 0xc9, 0xff, 0x61, 0xff, 
-0x26, 0xff, 0x18, 0xff, 0x35, 0xff, 0x45, 0xff, 0x8a, 0xff, 0xcb, 0xff, 0x1e, 0x00, 0x52, 0x00, 
-0x60, 0x00, 0x76, 0x00, 0x8c, 0x00, 0x6a, 0x00, 0x23, 0x00, 0x86, 0xff, 0xbe, 0xfe, 0xf1, 0xfd, 
-0xcc, 0xfc, 0xdd, 0xfb, 0x07, 0xfb, 0x43, 0xfa, 0x91, 0xf9, 0x81, 0xf9, 0xba, 0xf9, 0x19, 0xfa, 
-0x02, 0xfb, 0x1e, 0xfc, 0x5a, 0xfd, 0xc0, 0xfe, 0x0f, 0x00, 0xcd, 0x01, 0x19, 0x03, 0x6b, 0x06, 
-0xf3, 0x0b, 0x9b, 0x0b, 0xd1, 0x09, 0x94, 0x08, 0x4b, 0x06, 0x6f, 0x05, 0x66, 0x03, 0x31, 0x03, 
-0xa3, 0x01, 0x85, 0xff, 0xe7, 0xff, 0xce, 0xfe, 0x88, 0xfe, 0x7f, 0xfe, 0x47, 0xfe, 0x1b, 0xff, 
-0x62, 0xfe, 0x41, 0xff, 0x9f, 0x00, 0xaf, 0xff, 0xbd, 0xff, 0x39, 0xff, 0xff, 0xfe, 0x98, 0xfd, 
-0xee, 0xfb, 0x0e, 0xfb, 0x78, 0xf9, 0x30, 0xf8, 0xe2, 0xf7, 0xee, 0xf7, 0x15, 0xf9, 0x2d, 0xfa, 
-0x49, 0xfb, 0xff, 0xfd, 0x5e, 0xff, 0x83, 0x01, 0xae, 0x03, 0xc9, 0x04, 0x86, 0x06, 0xc6, 0x06, 
-0xc2, 0x06, 0x1c, 0x07, 0x32, 0x06, 0xe5, 0x05, 0x4a, 0x05, 0x08, 0x04, 0x4e, 0x03, 0x70, 0x02, 
-0x62, 0x02, 0x7b, 0x02, 0x2e, 0x01, 0x5f, 0x01, 0x83, 0x01, 0x6a, 0x01, 0x09, 0x02, 0x9f, 0x01, 
-0xa4, 0x02, 0x54, 0x02, 0xbc, 0x01, 0x18, 0x02, 0xb7, 0xff, 0xca, 0xfe, 0x49, 0xfc, 0xf6, 0xf9, 
-0x8c, 0xf7, 0x3b, 0xf4, 0xb2, 0xf1, 0xac, 0xf0, 0x92, 0xf1, 0x1a, 0xf2, 0x10, 0xf6, 0x02, 0xf9, 
-0xf5, 0xfc, 0x63, 0x02, 0x3d, 0x05, 0x3c, 0x09, 0xd5, 0x0b, 0xe2, 0x0b, 0x9c, 0x0c, 0xfa, 0x0a, 
-0xb5, 0x08, 0xc3, 0x06, 0x61, 0x03, 0x81, 0x01, 0x39, 0xff, 0x9d, 0xfd, 0xfa, 0xfe, 0x30, 0xfe, 
-0x11, 0xff, 0x35, 0x02, 0x28, 0x02, 0xaf, 0x04, 0x42, 0x06, 0xb7, 0x05, 0xed, 0x07, 0x8d, 0x05, 
-0xf5, 0x04, 0x47, 0x05, 0x1a, 0x01, 0xdb, 0x00, 0x95, 0xfe, 0x0d, 0xfc, 0xdf, 0xfa, 0xe0, 0xf5, 
-0xb6, 0xf4, 0x5a, 0xf0, 0x46, 0xea, 0x7d, 0xec, 0xbb, 0xea, 0xd7, 0xed, 0xec, 0xf5, 0x8c, 0xf8, 
-0x60, 0x01, 0xc5, 0x07, 0x09, 0x0b, 0x14, 0x10, 0x3f, 0x0f, 0x98, 0x0f, 0x04, 0x0e, 0xa4, 0x08, 
-0xc7, 0x06, 0xd1, 0x01, 0xef, 0xfd, 0xe9, 0xfc, 0xd2, 0xf9, 0x8c, 0xfb, 0xc9, 0xfc, 0xfa, 0xfd, 
-0x0c, 0x03, 0x80, 0x04, 0x40, 0x07, 0xb1, 0x09, 0xa8, 0x09, 0xe7, 0x0a, 0x44, 0x09, 0xe1, 0x07, 
-0xef, 0x05, 0x48, 0x03, 0xba, 0x02, 0x68, 0xff, 0x84, 0xfe, 0xeb, 0xfd, 0x46, 0xf9, 0x34, 0xf6, 
-0xa3, 0xf3, 0xaa, 0xed, 0x05, 0xe9, 0x3d, 0xea, 0xf0, 0xe9, 0xd2, 0xef, 0x5d, 0xf8, 0x27, 0xfc, 
-0xec, 0x04, 0x4e, 0x0b, 0x6e, 0x0e, 0xd8, 0x11, 0x2b, 0x11, 0x24, 0x11, 0x7b, 0x0d, 0x94, 0x07, 
-0xe1, 0x04, 0x02, 0xff, 0x52, 0xfb, 0x9c, 0xf9, 0x9f, 0xf7, 0x89, 0xf9, 0xb1, 0xfa, 0x1c, 0xfd, 
-0x03, 0x02, 0x2a, 0x05, 0xcf, 0x08, 0xe2, 0x0b, 0x9c, 0x0d, 0x67, 0x0f, 0x53, 0x0e, 0xbc, 0x0b, 
-0x32, 0x0a, 0x94, 0x06, 0x45, 0x02, 0x77, 0xfd, 0x61, 0xf9, 0x62, 0xf5, 0xf7, 0xee, 0xe3, 0xe8, 
-0x92, 0xe4, 0x11, 0xe2, 0x58, 0xe3, 0xbb, 0xe6, 0x09, 0xec, 0x1f, 0xf5, 0xb4, 0xfb, 0xcf, 0x02, 
-0xda, 0x0a, 0xd7, 0x0f, 0xc3, 0x13, 0xf3, 0x15, 0x62, 0x16, 0x89, 0x14, 0xbc, 0x0f, 0x8a, 0x0b, 
-0x11, 0x07, 0xaf, 0x00, 0x78, 0xfc, 0x97, 0xf9, 0x8a, 0xf6, 0xeb, 0xf5, 0x42, 0xf6, 0x3c, 0xf8, 
-0xa2, 0xfb, 0x1a, 0x00, 0x89, 0x06, 0x71, 0x09, 0x5b, 0x0c, 0x17, 0x11, 0x54, 0x10, 0xe7, 0x0c, 
-0x33, 0x0d, 0x87, 0x09, 0x73, 0x02, 0x20, 0xfe, 0x03, 0xfa, 0xde, 0xf4, 0x03, 0xed, 0xd4, 0xe8, 
-0x51, 0xe5, 0xc2, 0xe1, 0x6e, 0xe4, 0x09, 0xe7, 0x39, 0xec, 0x81, 0xf4, 0x37, 0xfa, 0xf4, 0x00, 
-0x33, 0x0a, 0x9f, 0x0e, 0xd3, 0x11, 0x7e, 0x16, 0x51, 0x16, 0xe7, 0x14, 0xed, 0x12, 0x4b, 0x0e, 
-0xa2, 0x0a, 0xf4, 0x05, 0xff, 0xff, 0x01, 0xfd, 0x85, 0xf9, 0xc2, 0xf6, 0xdb, 0xf6, 0x40, 0xf8, 
-0xd7, 0xf9, 0xe0, 0xfd, 0xec, 0x03, 0x1f, 0x07, 0xed, 0x09, 0x30, 0x0e, 0xae, 0x0e, 0x5d, 0x0c, 
-0x1e, 0x0c, 0x0d, 0x0a, 0x78, 0x04, 0x4d, 0x00, 0x19, 0xfd, 0x14, 0xf8, 0xd7, 0xf2, 0x67, 0xee, 
-0x78, 0xea, 0x31, 0xe6, 0xbd, 0xe5, 0x1b, 0xe8, 0x39, 0xea, 0x79, 0xef, 0xf7, 0xf5, 0x54, 0xfb, 
-0x90, 0x01, 0x7f, 0x07, 0x16, 0x0c, 0x85, 0x10, 0x91, 0x12, 0x3f, 0x13, 0xb0, 0x13, 0x09, 0x11, 
-0x52, 0x0e, 0x6e, 0x0b, 0xc8, 0x06, 0x59, 0x03, 0xec, 0xff, 0x65, 0xfc, 0xab, 0xf9, 0xac, 0xf8, 
-0xa6, 0xf8, 0x1b, 0xf9, 0x43, 0xfc, 0xd0, 0xff, 0x29, 0x02, 0x91, 0x05, 0x3a, 0x09, 0xcd, 0x09, 
-0x99, 0x09, 0xb1, 0x0a, 0xe9, 0x07, 0x3f, 0x04, 0xd1, 0x01, 0x8f, 0xfd, 0xae, 0xf9, 0x31, 0xf5, 
-0xa4, 0xf1, 0xc9, 0xee, 0xd9, 0xeb, 0xca, 0xeb, 0x87, 0xec, 0xd8, 0xee, 0xa3, 0xf1, 0x91, 0xf4, 
-0xd2, 0xf9, 0x54, 0xfe, 0xe1, 0x01, 0x6d, 0x06, 0xbb, 0x0a, 0x63, 0x0d, 0xfe, 0x0e, 0x47, 0x10, 
-0xab, 0x10, 0x4a, 0x0f, 0xa1, 0x0d, 0x53, 0x0b, 0x37, 0x08, 0xae, 0x04, 0x5d, 0x01, 0x5a, 0xff, 
-0xd6, 0xfc, 0x0c, 0xfb, 0xf3, 0xfb, 0xe6, 0xfc, 0x3d, 0xfd, 0x4c, 0xff, 0xbc, 0x01, 0xce, 0x02, 
-0x6e, 0x03, 0x34, 0x04, 0x23, 0x04, 0xe4, 0x02, 0xdb, 0x01, 0x33, 0x00, 0xac, 0xfe, 0xd5, 0xfd, 
-0xde, 0xfb, 0x40, 0xfa, 0x0c, 0xf9, 0x89, 0xf7, 0x48, 0xf6, 0x78, 0xf5, 0xf2, 0xf4, 0x7b, 0xf5, 
-0x6d, 0xf6, 0x4d, 0xf7, 0x7c, 0xf9, 0xf9, 0xfb, 0x9f, 0xfd, 0xf2, 0xff, 0xaa, 0x02, 0x55, 0x04, 
-0x0a, 0x06, 0x8e, 0x07, 0x7e, 0x08, 0x0a, 0x09, 0xf5, 0x08, 0x2c, 0x08, 0x22, 0x07, 0x86, 0x06, 
-0x58, 0x05, 0xdb, 0x03, 0x78, 0x03, 0x0a, 0x03, 0x1d, 0x02, 0xae, 0x01, 0x7d, 0x01, 0x4e, 0x01, 
-0x74, 0x01, 0x1c, 0x01, 0xf5, 0x00, 0x6e, 0x01, 0x39, 0x01, 0x0a, 0x01, 0x04, 0x01, 0x87, 0x00, 
-0xdb, 0xff, 0x57, 0xff, 0x80, 0xfe, 0x13, 0xfd, 0xff, 0xfb, 0xca, 0xfa, 0x57, 0xf9, 0x88, 0xf8, 
-0x23, 0xf8, 0xe1, 0xf7, 0xe1, 0xf7, 0x54, 0xf8, 0x00, 0xf9, 0xbd, 0xf9, 0xc5, 0xfa, 0xa1, 0xfb, 
-0xc5, 0xfc, 0x79, 0xfe, 0x60, 0xff, 0x78, 0x00, 0xc1, 0x01, 0xa9, 0x02, 0xb0, 0x03, 0x63, 0x04, 
-0x26, 0x05, 0xdb, 0x05, 0x5b, 0x06, 0xc7, 0x06, 0xbe, 0x06, 0xe3, 0x06, 0xa4, 0x06, 0x14, 0x06, 
-0xd3, 0x05, 0x41, 0x05, 0xc3, 0x04, 0x26, 0x04, 0x6e, 0x03, 0xc9, 0x02, 0xed, 0x01, 0xf9, 0x00, 
-0x07, 0x00, 0x34, 0xff, 0x71, 0xfe, 0xa4, 0xfd, 0x0e, 0xfd, 0x56, 0xfc, 0xe0, 0xfb, 0xa6, 0xfb, 
-0x26, 0xfb, 0xbe, 0xfa, 0x9b, 0xfa, 0x63, 0xfa, 0x32, 0xfa, 0x3f, 0xfa, 0x2b, 0xfa, 0x6b, 0xfa, 
-0xc6, 0xfa, 0x26, 0xfb, 0xd4, 0xfb, 0x73, 0xfc, 0x3a, 0xfd, 0x3a, 0xfe, 0x48, 0xff, 0x6e, 0x00, 
-0x82, 0x01, 0xbd, 0x02, 0xb8, 0x03, 0x70, 0x04, 0x43, 0x05, 0xad, 0x05, 0xef, 0x05, 0x30, 0x06, 
-0x42, 0x06, 0x3a, 0x06, 0x2a, 0x06, 0xd4, 0x05, 0x50, 0x05, 0x08, 0x05, 0x78, 0x04, 0xcc, 0x03, 
-0x63, 0x03, 0xac, 0x02, 0xda, 0x01, 0x1e, 0x01, 0x40, 0x00, 0x4b, 0xff, 0x6c, 0xfe, 0xc4, 0xfd, 
-0x1b, 0xfd, 0x94, 0xfc, 0x5d, 0xfc, 0xf0, 0xfb, 0xa9, 0xfb, 0xb4, 0xfb, 0x80, 0xfb, 0x66, 0xfb, 
-0x71, 0xfb, 0x5d, 0xfb, 0x45, 0xfb, 0x2a, 0xfb, 0x14, 0xfb, 0x3e, 0xfb, 0x75, 0xfb, 0xb9, 0xfb, 
-0x39, 0xfc, 0xeb, 0xfc, 0xcf, 0xfd, 0x9b, 0xfe, 0x94, 0xff, 0x8c, 0x00, 0x61, 0x01, 0x54, 0x02, 
-0x12, 0x03, 0xc8, 0x03, 0x6b, 0x04, 0xc9, 0x04, 0x09, 0x05, 0x36, 0x05, 0x4b, 0x05, 0x3b, 0x05, 
-0x30, 0x05, 0x08, 0x05, 0xb6, 0x04, 0x5d, 0x04, 0xe6, 0x03, 0x57, 0x03, 0xbb, 0x02, 0xfe, 0x01, 
-0x33, 0x01, 0x6c, 0x00, 0xc8, 0xff, 0x1f, 0xff, 0x8d, 0xfe, 0x2c, 0xfe, 0xc1, 0xfd, 0x8e, 0xfd, 
-0x68, 0xfd, 0x3a, 0xfd, 0x30, 0xfd, 0x24, 0xfd, 0x18, 0xfd, 0x10, 0xfd, 0xfc, 0xfc, 0xd3, 0xfc, 
-0xa2, 0xfc, 0x7f, 0xfc, 0x50, 0xfc, 0x1f, 0xfc, 0x25, 0xfc, 0x3b, 0xfc, 0x55, 0xfc, 0xbb, 0xfc, 
-0x3f, 0xfd, 0xdf, 0xfd, 0xa3, 0xfe, 0x81, 0xff, 0x63, 0x00, 0x42, 0x01, 0x2d, 0x02, 0xf1, 0x02, 
-0x8f, 0x03, 0x18, 0x04, 0x7f, 0x04, 0xc0, 0x04, 0xd5, 0x04, 0xda, 0x04, 0xc7, 0x04, 0x8e, 0x04, 
-0x44, 0x04, 0xe6, 0x03, 0x7c, 0x03, 0xfb, 0x02, 0x7a, 0x02, 0xf6, 0x01, 0x68, 0x01, 0xeb, 0x00, 
-0x7d, 0x00, 0x15, 0x00, 0xc4, 0xff, 0x80, 0xff, 0x3f, 0xff, 0x05, 0xff, 0xcb, 0xfe, 0x8f, 0xfe, 
-0x4d, 0xfe, 0x0f, 0xfe, 0xc9, 0xfd, 0x74, 0xfd, 0x2b, 0xfd, 0xe2, 0xfc, 0x9a, 0xfc, 0x61, 0xfc, 
-0x2f, 0xfc, 0x0e, 0xfc, 0x0b, 0xfc, 0x1c, 0xfc, 0x46, 0xfc, 0x91, 0xfc, 0xfa, 0xfc, 0x7d, 0xfd, 
-0x13, 0xfe, 0xb5, 0xfe, 0x63, 0xff, 0x14, 0x00, 0xbd, 0x00, 0x56, 0x01, 0xdf, 0x01, 0x54, 0x02, 
-0xb8, 0x02, 0x08, 0x03, 0x41, 0x03, 0x6b, 0x03, 0x81, 0x03, 0x8b, 0x03, 0x8a, 0x03, 0x7a, 0x03, 
-0x5e, 0x03, 0x3c, 0x03, 0x11, 0x03, 0xd9, 0x02, 0x9b, 0x02, 0x51, 0x02, 0xfe, 0x01, 0xa5, 0x01, 
-0x3f, 0x01, 0xd8, 0x00, 0x71, 0x00, 0xfd, 0xff, 0x88, 0xff, 0x18, 0xff, 0xa7, 0xfe, 0x3d, 0xfe, 
-0xdd, 0xfd, 0x82, 0xfd, 0x34, 0xfd, 0xf3, 0xfc, 0xc0, 0xfc, 0x9c, 0xfc, 0x89, 0xfc, 0x88, 0xfc, 
-0x95, 0xfc, 0xb7, 0xfc, 0xe3, 0xfc, 0x1e, 0xfd, 0x6e, 0xfd, 0xc7, 0xfd, 0x2b, 0xfe, 0x8d, 0xfe, 
-0xf9, 0xfe, 0x6e, 0xff, 0xdd, 0xff, 0x41, 0x00, 0x98, 0x00, 0xf9, 0x00, 0x4a, 0x01, 0x85, 0x01, 
-0xc3, 0x01, 0xf8, 0x01, 0x1f, 0x02, 0x42, 0x02, 0x5e, 0x02, 0x77, 0x02, 0x8c, 0x02, 0x99, 0x02, 
-0xa6, 0x02, 0xa4, 0x02, 0x93, 0x02, 0x79, 0x02, 0x5f, 0x02, 0x31, 0x02, 0xe8, 0x01, 0x9b, 0x01, 
-0x3a, 0x01, 0xd3, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x1b, 0xff, 0xb5, 0xfe, 0x5b, 0xfe, 
-0x18, 0xfe, 0xe3, 0xfd, 0xb3, 0xfd, 0x90, 0xfd, 0x87, 0xfd, 0x8b, 0xfd, 0x9e, 0xfd, 0xc5, 0xfd, 
-0xef, 0xfd, 0x26, 0xfe, 0x63, 0xfe, 0xa8, 0xfe, 0xff, 0xfe, 0x4e, 0xff, 0x9a, 0xff, 0xe5, 0xff, 
-0x20, 0x00, 0x55, 0x00, 0x85, 0x00, 0xaa, 0x00, 0xd3, 0x00, 0xff, 0x00, 0x1f, 0x01, 0x43, 0x01, 
-0x4d, 0x01, 0x43, 0x01, 0x58, 0x01, 0x64, 0x01, 0x69, 0x01, 0x5e, 0x01, 0x4f, 0x01, 0x3a, 0x01, 
-0x12, 0x01, 0xf8, 0x00, 0xe0, 0x00, 0xcf, 0x00, 0xc3, 0x00, 0xae, 0x00, 0x5a, 0x00, 0x05, 0x00, 
-0xdf, 0xff, 0xcc, 0xff, 0xbf, 0xff, 0x9d, 0xff, 0x6d, 0xff, 0x12, 0xff, 0xec, 0xfe, 0x02, 0xff, 
-0x0a, 0xff, 0x04, 0xff, 0xfc, 0xfe, 0xe2, 0xfe, 0xca, 0xfe, 0xcd, 0xfe, 0xce, 0xfe, 0xec, 0xfe, 
-0x07, 0xff, 0x40, 0xff, 0x64, 0xff, 0x74, 0xff, 0xb8, 0xff, 0xd9, 0xff, 0x24, 0x00, 0x77, 0x00, 
-0xab, 0x00, 0x95, 0x00, 0x81, 0x00, 0x72, 0x00, 0x9d, 0x00, 0xf9, 0x00, 0x0c, 0x01, 0x67, 0x04, 
-0xb0, 0x05, 0xd6, 0x00, 0x6c, 0xfc, 0x5e, 0xfd, 0x0f, 0x02, 0x36, 0x03, 0xd5, 0xff, 0x15, 0xfd, 
-0x40, 0xfe, 0xc1, 0x00, 0xf7, 0x00, 0xec, 0xfe, 0xc1, 0xfd, 0x5e, 0xff, 0x48, 0x01, 0x1d, 0x01, 
-0x93, 0xff, 0xff, 0xfe, 0x33, 0x00, 0x12, 0x01, 0x44, 0x00, 0xcd, 0xfe, 0x9c, 0xfe, 0xc2, 0xff, 
-0x7e, 0x00, 0xf2, 0xff, 0x01, 0xff, 0xb3, 0xfe, 0x5e, 0xff, 0xda, 0xff, 0x71, 0xff, 0x17, 0xff, 
-0xf8, 0xfe, 0x88, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xed, 0xff, 0x08, 0x00, 0x4c, 0x00, 
-0x95, 0x00, 0x78, 0x00, 0x94, 0x00, 0xd7, 0x00, 0xd9, 0x00, 0xab, 0x00, 0x5e, 0x00, 0x90, 0x00, 
-0x7e, 0x00, 0xf0, 0xff, 0xcb, 0xff, 0x82, 0xff, 0x7d, 0x00, 0x1b, 0x01, 0x6d, 0x00, 0x46, 0xff, 
-0x34, 0xfe, 0x20, 0xff, 0x7c, 0x00, 0x77, 0x00, 0xea, 0xff, 0x73, 0xff, 0x8c, 0x00, 0x38, 0x05, 
-0xdb, 0x06, 0x7f, 0x01, 0xa7, 0xfb, 0x36, 0xfc, 0xc3, 0x00, 0xe3, 0x01, 0x97, 0xfe, 0x2d, 0xfb, 
-0x84, 0xfc, 0x24, 0x00, 0xc9, 0x01, 0x20, 0x00, 0xb0, 0xfd, 0xf1, 0xfd, 0xc2, 0xff, 0xde, 0x00, 
-0x97, 0xfd, 0xfe, 0xfc, 0x46, 0x00, 0xe0, 0x01, 0x29, 0x03, 0x0d, 0x03, 0xc2, 0x03, 0x17, 0x04, 
-0x7b, 0x02, 0x24, 0x00, 0x21, 0xfe, 0x9a, 0xfd, 0x5a, 0xfe, 0x6c, 0xff, 0x2b, 0x00, 0x94, 0xff, 
-0x49, 0xff, 0x7f, 0xff, 0xb9, 0x00, 0x41, 0x03, 0x9b, 0x02, 0x3a, 0xff, 0x54, 0xfc, 0x0a, 0xfe, 
-0xea, 0x00, 0x31, 0x01, 0x93, 0xff, 0x1f, 0xfe, 0x02, 0xff, 0x67, 0xff, 0x2e, 0xff, 0x0c, 0xff, 
-0x8c, 0xff, 0xdf, 0x00, 0x6e, 0x01, 0x3c, 0x02, 0xf3, 0x06, 0x08, 0x0c, 0xd2, 0x08, 0xf5, 0xfd, 
-0x0a, 0xf6, 0x2a, 0xf8, 0x93, 0xfe, 0x7a, 0xff, 0x06, 0xfb, 0xe7, 0xf8, 0x54, 0xfd, 0x38, 0x02, 
-0x3c, 0x00, 0x08, 0xfb, 0x30, 0xfb, 0xd8, 0x01, 0x4a, 0x07, 0xe9, 0x05, 0xf5, 0xff, 0xe5, 0xfc, 
-0xcf, 0xfe, 0xcd, 0x01, 0x1a, 0x01, 0xae, 0xfd, 0x10, 0xfd, 0xb5, 0xff, 0x90, 0x01, 0x2f, 0x00, 
-0xd6, 0xfd, 0x2a, 0xfd, 0x8e, 0xfe, 0xe7, 0xff, 0x20, 0x01, 0xd4, 0x00, 0x5d, 0xff, 0xd6, 0xfe, 
-0x33, 0xff, 0xcc, 0x00, 0x79, 0x01, 0x2f, 0x00, 0x98, 0xfe, 0x48, 0xff, 0x85, 0x00, 0x27, 0x01, 
-0xa3, 0x00, 0xe2, 0xfe, 0x40, 0x00, 0x95, 0x01, 0xb1, 0x00, 0x89, 0xff, 0x83, 0xff, 0xb5, 0x00, 
-0x07, 0x01, 0x3b, 0x00, 0x48, 0xff, 0xcb, 0xff, 0x59, 0x00, 0x37, 0x00, 0x21, 0xff, 0x75, 0xff, 
-0xea, 0x00, 0xe0, 0x00, 0x98, 0xff, 0x9b, 0xfe, 0x41, 0x00, 0x23, 0x01, 0xa7, 0x00, 0x1e, 0x00, 
-0xb8, 0xff, 0x93, 0x00, 0x11, 0x01, 0x15, 0x00, 0x0a, 0x00, 0x4f, 0x00, 0x6d, 0x00, 0x71, 0x00, 
-0xf3, 0xff, 0x08, 0x00, 0x52, 0x00, 0xc1, 0x00, 0x91, 0x00, 0x6a, 0x00, 0x44, 0x00, 0x72, 0x00, 
-0xf5, 0x00, 0xf5, 0x00, 0xde, 0xff, 0x89, 0xff, 0xca, 0xff, 0x1b, 0x00, 0x18, 0x01, 0x61, 0x00, 
-0x0e, 0xff, 0xb5, 0xfe, 0x52, 0xff, 0x40, 0x00, 0x07, 0x00, 0x9f, 0xff, 0xb9, 0xff, 0x55, 0xff, 
-0xe3, 0xfe, 0x2c, 0xff, 0x15, 0x00, 0xc8, 0xff, 0x0e, 0xff, 0xa0, 0xfe, 0x9c, 0xfe, 0xb1, 0xff, 
-0x11, 0x01, 0xf0, 0x01, 0x61, 0x01, 0x9b, 0xff, 0x51, 0xff, 0x88, 0x00, 0xe7, 0x00, 0x31, 0x00, 
-0x7e, 0xff, 0xb9, 0xff, 0x0a, 0x00, 0xe0, 0xff, 0x23, 0x00, 0x23, 0x00, 0x51, 0xff, 0x12, 0x00, 
-0xa1, 0x00, 0x46, 0x00, 0x9a, 0xff, 0xc3, 0xff, 0xd6, 0xff, 0xbb, 0xff, 0xf7, 0x00, 0xd8, 0xff, 
-0xcc, 0xfe, 0x26, 0xff, 0x02, 0x00, 0x15, 0x01, 0xd5, 0xff, 0xf6, 0xfd, 0x26, 0xff, 0x60, 0x00, 
-0xbf, 0xff, 0x1c, 0x00, 0x6b, 0x00, 0x5c, 0xff, 0x84, 0xff, 0xb9, 0x01, 0xf7, 0x00, 0x19, 0xfd, 
-0xc9, 0xfd, 0x7b, 0x01, 0xd8, 0x01, 0xb9, 0xfe, 0xf4, 0xfb, 0xa9, 0xfd, 0x9d, 0x00, 0xfb, 0x01, 
-0x5b, 0x00, 0x42, 0xfd, 0xd5, 0xfc, 0xce, 0x00, 0xa7, 0x02, 0xec, 0x00, 0x8e, 0xff, 0xe8, 0xfd, 
-0xdf, 0xff, 0xb3, 0x02, 0xca, 0x02, 0xa9, 0x00, 0x1e, 0xff, 0x43, 0xff, 0x1c, 0x02, 0x42, 0x02, 
-0x1d, 0xff, 0xe0, 0xfe, 0x1b, 0xff, 0x92, 0xff, 0x1b, 0x00, 0x78, 0x01, 0x6a, 0x00, 0x75, 0xfe, 
-0x2e, 0xff, 0x6a, 0x00, 0xcd, 0x00, 0x9d, 0x00, 0x18, 0x00, 0xbe, 0xfe, 0xbd, 0xfe, 0x05, 0x01, 
-0x3f, 0x02, 0x38, 0x01, 0xcd, 0xff, 0xf8, 0xfe, 0xac, 0xff, 0xeb, 0x00, 0xc6, 0x01, 0x9f, 0x00, 
-0x01, 0xff, 0x55, 0xfe, 0x35, 0x00, 0x87, 0x01, 0xe6, 0x00, 0xff, 0xfe, 0xcf, 0xfe, 0xa7, 0x01, 
-0x8a, 0x00, 0xc8, 0xff, 0x19, 0xfe, 0xf4, 0xfd, 0x6f, 0xff, 0xfa, 0xfd, 0x17, 0xfe, 0x62, 0xff, 
-0xa8, 0xfe, 0x4f, 0xfc, 0x43, 0xfc, 0x90, 0xfc, 0xd8, 0xfd, 0xd8, 0xfe, 0x10, 0xfe, 0x12, 0xfe, 
-0xf7, 0xfe, 0x50, 0x00, 0x28, 0x02, 0x10, 0x04, 0x42, 0x04, 0x15, 0x04, 0x80, 0x04, 0xb1, 0x05, 
-0x14, 0x07, 0x58, 0x07, 0x69, 0x06, 0x38, 0x05, 0x2f, 0x05, 0xce, 0x04, 0x52, 0x03, 0xbf, 0x02, 
-0xfa, 0x01, 0x52, 0x00, 0xad, 0xff, 0x5b, 0xfe, 0xd5, 0xfd, 0x61, 0xfd, 0x9a, 0xfb, 0xd6, 0xf9, 
-0xdb, 0xf7, 0x9d, 0xf7, 0x6a, 0xf6, 0x4b, 0xf4, 0x69, 0xf3, 0xf8, 0xf3, 0x50, 0xf5, 0xc7, 0xf5, 
-0xc6, 0xf6, 0x80, 0xf9, 0x99, 0xfd, 0x1e, 0x01, 0x85, 0x02, 0x8e, 0x04, 0xf2, 0x07, 0x74, 0x0c, 
-0x15, 0x0e, 0x67, 0x0c, 0x59, 0x0b, 0xd7, 0x0a, 0x23, 0x0c, 0x54, 0x0b, 0xe8, 0x07, 0xf4, 0x02, 
-0x02, 0x02, 0x34, 0x04, 0xcd, 0x02, 0x33, 0x00, 0x3f, 0xff, 0xd6, 0x00, 0x7c, 0x02, 0x68, 0x02, 
-0x4a, 0x02, 0x65, 0x02, 0x09, 0x01, 0xd6, 0xff, 0x4d, 0xff, 0x76, 0xfe, 0x57, 0xfa, 0x57, 0xf7, 
-0x6e, 0xf5, 0xc3, 0xf2, 0x5a, 0xef, 0x29, 0xed, 0x30, 0xee, 0x3b, 0xed, 0x19, 0xee, 0x5b, 0xf2, 
-0xb6, 0xf7, 0x4a, 0xfc, 0x13, 0x00, 0x17, 0x04, 0x12, 0x09, 0xb1, 0x0d, 0x02, 0x10, 0xa4, 0x10, 
-0x56, 0x10, 0x77, 0x0f, 0xa8, 0x0d, 0x63, 0x0b, 0x7e, 0x08, 0x1e, 0x04, 0xae, 0x00, 0xb7, 0xfe, 
-0x1d, 0xfe, 0xb4, 0xfe, 0x7a, 0xff, 0x3d, 0x00, 0xd6, 0x00, 0x91, 0x03, 0xea, 0x06, 0xed, 0x08, 
-0x33, 0x09, 0x45, 0x08, 0x6f, 0x06, 0xbc, 0x04, 0xd4, 0x03, 0xf5, 0x00, 0x8e, 0xfb, 0x83, 0xf7, 
-0xf8, 0xf4, 0x65, 0xf2, 0x67, 0xf0, 0x09, 0xed, 0xa6, 0xe9, 0x07, 0xe8, 0xd9, 0xe8, 0x44, 0xed, 
-0x10, 0xf2, 0x6f, 0xf6, 0xc3, 0xfa, 0x9c, 0xff, 0x73, 0x06, 0x52, 0x0c, 0xde, 0x0f, 0x13, 0x11, 
-0x8a, 0x10, 0xc7, 0x0f, 0xa9, 0x0f, 0x19, 0x0e, 0xfc, 0x09, 0x2f, 0x05, 0x8c, 0x01, 0x85, 0xfe, 
-0x56, 0xfd, 0x52, 0xfd, 0xbb, 0xfb, 0xbc, 0xfb, 0xc4, 0xfe, 0x21, 0x03, 0x39, 0x06, 0x8d, 0x08, 
-0xed, 0x0a, 0xe5, 0x0b, 0x30, 0x0c, 0xc6, 0x0b, 0x57, 0x0a, 0x2c, 0x07, 0xfe, 0x02, 0xc1, 0xff, 
-0xec, 0xfb, 0xdb, 0xf7, 0x44, 0xf4, 0xe2, 0xf0, 0xb4, 0xee, 0x5c, 0xed, 0x10, 0xea, 0x18, 0xe7, 
-0xbc, 0xe7, 0xa1, 0xeb, 0x7b, 0xf1, 0x63, 0xf7, 0xd7, 0xfb, 0x6c, 0xff, 0x76, 0x04, 0x1a, 0x0b, 
-0x60, 0x10, 0x1b, 0x12, 0x56, 0x11, 0x31, 0x0f, 0xa5, 0x0d, 0xe9, 0x0c, 0x2d, 0x0a, 0x35, 0x05, 
-0xc8, 0xff, 0x43, 0xfc, 0x89, 0xfb, 0xee, 0xfb, 0x71, 0xfc, 0x37, 0xfc, 0x72, 0xfd, 0x38, 0x01, 
-0x17, 0x06, 0x9e, 0x0a, 0x81, 0x0c, 0x33, 0x0d, 0xf8, 0x0c, 0x06, 0x0c, 0xac, 0x0a, 0xe1, 0x07, 
-0x10, 0x04, 0x94, 0xfe, 0xac, 0xfb, 0x7f, 0xf9, 0xa9, 0xf5, 0x14, 0xf3, 0xc5, 0xf0, 0xbe, 0xee, 
-0x4c, 0xeb, 0xc9, 0xe7, 0x0f, 0xe8, 0x21, 0xeb, 0x9e, 0xef, 0xe4, 0xf4, 0x08, 0xfa, 0x7b, 0xfe, 
-0xd3, 0x02, 0x86, 0x08, 0x8e, 0x0d, 0x6f, 0x10, 0x5c, 0x11, 0xe4, 0x10, 0x1f, 0x10, 0x2d, 0x0e, 
-0xd2, 0x0a, 0x86, 0x06, 0x18, 0x02, 0x92, 0xfe, 0xd8, 0xfb, 0x8e, 0xfa, 0x52, 0xfa, 0xa2, 0xfa, 
-0x46, 0xfc, 0xc2, 0xfe, 0xe5, 0x02, 0xfd, 0x07, 0xc2, 0x0b, 0x0f, 0x0e, 0x23, 0x0f, 0xbc, 0x0e, 
-0xf9, 0x0c, 0xe4, 0x09, 0xcf, 0x05, 0x91, 0x01, 0x64, 0xfd, 0xea, 0xf9, 0xc5, 0xf6, 0xc8, 0xf4, 
-0xd3, 0xf2, 0x95, 0xef, 0x9d, 0xec, 0xab, 0xe9, 0x3c, 0xe7, 0x79, 0xe7, 0x07, 0xec, 0x48, 0xf2, 
-0x82, 0xf7, 0x40, 0xfc, 0xc5, 0x00, 0xd8, 0x05, 0xba, 0x0a, 0x75, 0x0e, 0xa8, 0x10, 0xdf, 0x10, 
-0xea, 0x0f, 0xda, 0x0d, 0x2a, 0x0b, 0xf3, 0x07, 0x92, 0x03, 0x37, 0xff, 0x63, 0xfc, 0x71, 0xfb, 
-0x6b, 0xfb, 0x3e, 0xfb, 0xa6, 0xfb, 0xcf, 0xfd, 0x89, 0x01, 0x22, 0x06, 0x32, 0x0a, 0x41, 0x0d, 
-0x1a, 0x0f, 0x9a, 0x0f, 0xa3, 0x0e, 0x9b, 0x0c, 0x2d, 0x09, 0xb4, 0x03, 0x3b, 0xff, 0x3a, 0xfc, 
-0x22, 0xf9, 0x62, 0xf6, 0xc7, 0xf4, 0x92, 0xf3, 0x78, 0xf1, 0xde, 0xee, 0xe9, 0xea, 0x3d, 0xe7, 
-0x65, 0xe7, 0x93, 0xeb, 0x44, 0xf2, 0xaa, 0xf8, 0x70, 0xfd, 0xbf, 0x00, 0xd6, 0x04, 0xab, 0x0a, 
-0x84, 0x0f, 0x80, 0x11, 0xf9, 0x10, 0x4e, 0x0f, 0x3e, 0x0d, 0xf1, 0x0a, 0x20, 0x08, 0x7c, 0x03, 
-0x35, 0xfe, 0x0c, 0xfb, 0x64, 0xfa, 0xe1, 0xfa, 0xd7, 0xfa, 0xdd, 0xfa, 0x29, 0xfd, 0xa9, 0x01, 
-0x3f, 0x06, 0x33, 0x0a, 0x96, 0x0d, 0xc3, 0x0f, 0x34, 0x10, 0x3a, 0x0f, 0x09, 0x0d, 0x38, 0x09, 
-0x61, 0x04, 0x33, 0x00, 0xed, 0xfc, 0xab, 0xf9, 0x74, 0xf6, 0x4b, 0xf4, 0x4a, 0xf3, 0x35, 0xf2, 
-0xb5, 0xef, 0xe1, 0xea, 0xbb, 0xe5, 0xb5, 0xe4, 0xe4, 0xe9, 0x43, 0xf2, 0x80, 0xf8, 0xc9, 0xfb, 
-0x11, 0xff, 0x86, 0x04, 0x48, 0x0b, 0x87, 0x10, 0x0d, 0x12, 0x72, 0x10, 0xb2, 0x0e, 0xfd, 0x0d, 
-0x73, 0x0c, 0x6f, 0x08, 0xa0, 0x02, 0x0c, 0xfe, 0x2d, 0xfc, 0xf2, 0xfb, 0xf6, 0xfb, 0x67, 0xfb, 
-0x94, 0xfb, 0xd0, 0xfd, 0x01, 0x02, 0x28, 0x06, 0x1f, 0x09, 0x89, 0x0c, 0x8b, 0x0f, 0xe7, 0x0f, 
-0x1c, 0x0e, 0x5c, 0x0b, 0xda, 0x07, 0xd0, 0x03, 0x7d, 0x00, 0x5a, 0xfd, 0x4e, 0xf9, 0xff, 0xf5, 
-0x5b, 0xf5, 0xb4, 0xf5, 0x07, 0xf4, 0x75, 0xf0, 0xb6, 0xeb, 0xd3, 0xe6, 0x33, 0xe5, 0x50, 0xe9, 
-0x0a, 0xf1, 0x4b, 0xf7, 0x31, 0xfb, 0xa3, 0xff, 0x1a, 0x06, 0xf8, 0x0c, 0x59, 0x11, 0x4e, 0x12, 
-0xd5, 0x10, 0xbb, 0x0e, 0x54, 0x0d, 0x31, 0x0b, 0xef, 0x05, 0x61, 0xff, 0x3a, 0xfb, 0x91, 0xfa, 
-0xf4, 0xfa, 0x69, 0xfa, 0xd2, 0xf9, 0x3b, 0xfb, 0x41, 0xff, 0xd6, 0x03, 0x36, 0x07, 0x1e, 0x09, 
-0xe7, 0x0b, 0xde, 0x0f, 0x1a, 0x11, 0xa0, 0x0e, 0x4b, 0x0b, 0x13, 0x08, 0x77, 0x04, 0xb7, 0x00, 
-0x26, 0xfd, 0x9d, 0xf9, 0xc8, 0xf6, 0xe2, 0xf5, 0x4a, 0xf6, 0xc2, 0xf5, 0x5d, 0xf3, 0x19, 0xf0, 
-0x0d, 0xeb, 0x45, 0xe6, 0x68, 0xe7, 0x6b, 0xee, 0xe8, 0xf5, 0x48, 0xfa, 0x14, 0xfe, 0x14, 0x04, 
-0xc2, 0x0a, 0xa5, 0x0f, 0x65, 0x11, 0x75, 0x10, 0xb9, 0x0e, 0x6f, 0x0d, 0x56, 0x0b, 0xdd, 0x06, 
-0xf6, 0x00, 0x37, 0xfc, 0x44, 0xfa, 0xf9, 0xf9, 0x90, 0xf9, 0x5c, 0xf9, 0x9a, 0xfa, 0x0c, 0xfe, 
-0x2e, 0x03, 0x69, 0x07, 0x50, 0x09, 0xf9, 0x0a, 0x52, 0x0e, 0x7c, 0x11, 0x8d, 0x10, 0x20, 0x0c, 
-0x85, 0x08, 0x76, 0x06, 0xaf, 0x03, 0x59, 0xff, 0x10, 0xfb, 0x46, 0xf8, 0x09, 0xf7, 0x11, 0xf7, 
-0xf1, 0xf6, 0x09, 0xf5, 0xf6, 0xf1, 0xdc, 0xed, 0x68, 0xe8, 0x07, 0xe5, 0x11, 0xe8, 0x25, 0xf0, 
-0x09, 0xf7, 0x92, 0xfa, 0xc2, 0xfe, 0x97, 0x06, 0x86, 0x0e, 0x4f, 0x12, 0x97, 0x12, 0x6f, 0x11, 
-0x11, 0x10, 0xa6, 0x0e, 0x76, 0x0b, 0xa8, 0x05, 0xb0, 0xff, 0xa1, 0xfc, 0xca, 0xfb, 0x88, 0xfa, 
-0x6a, 0xf9, 0xb3, 0xf9, 0x5a, 0xfb, 0x79, 0xfe, 0x7c, 0x02, 0xc7, 0x05, 0xf5, 0x07, 0x51, 0x0a, 
-0x95, 0x0c, 0xdf, 0x0c, 0x55, 0x0b, 0x57, 0x09, 0x89, 0x07, 0xbf, 0x05, 0x4d, 0x03, 0xd8, 0x00, 
-0x99, 0xfe, 0x57, 0xfc, 0x28, 0xfb, 0xb8, 0xfa, 0x5d, 0xf9, 0x52, 0xf7, 0x81, 0xf4, 0x1d, 0xf0, 
-0x3e, 0xeb, 0x01, 0xe8, 0x10, 0xe6, 0x8b, 0xe6, 0x34, 0xec, 0xdc, 0xf3, 0xcc, 0xf8, 0x37, 0xfd, 
-0xb7, 0x05, 0x25, 0x10, 0x5f, 0x16, 0x1d, 0x17, 0xf4, 0x15, 0xea, 0x14, 0x15, 0x13, 0x49, 0x0e, 
-0xe6, 0x06, 0x39, 0x00, 0x66, 0xfc, 0xdf, 0xf9, 0xd7, 0xf7, 0xd8, 0xf6, 0x8c, 0xf7, 0xcc, 0xfa, 
-0xd9, 0xff, 0xc8, 0x03, 0x01, 0x06, 0x63, 0x09, 0xf5, 0x0c, 0x99, 0x0d, 0xf9, 0x0a, 0xc6, 0x08, 
-0x1e, 0x08, 0x08, 0x06, 0x0e, 0x03, 0x25, 0x00, 0x27, 0xfd, 0x13, 0xfc, 0xb7, 0xfc, 0xc7, 0xfb, 
-0x0c, 0xf9, 0xcf, 0xf6, 0x13, 0xf5, 0x63, 0xf1, 0x3a, 0xec, 0x1f, 0xe8, 0xd9, 0xe5, 0xe5, 0xe6, 
-0x15, 0xec, 0x6d, 0xf2, 0x15, 0xf7, 0x67, 0xfc, 0x62, 0x05, 0xa8, 0x0e, 0xf6, 0x13, 0xa0, 0x15, 
-0x66, 0x16, 0xe7, 0x16, 0x8f, 0x14, 0xa9, 0x0e, 0xba, 0x07, 0x1c, 0x03, 0x33, 0x00, 0x0d, 0xfc, 
-0x94, 0xf7, 0x5e, 0xf6, 0x6a, 0xf8, 0x2c, 0xfb, 0x1c, 0xfe, 0x0a, 0x02, 0x8a, 0x06, 0x5f, 0x0a, 
-0x20, 0x0c, 0xbd, 0x0b, 0x9c, 0x0b, 0x66, 0x0b, 0x7c, 0x08, 0x42, 0x04, 0x61, 0x01, 0x9e, 0xff, 
-0xbf, 0xfd, 0x93, 0xfb, 0x11, 0xfa, 0xe7, 0xf9, 0x40, 0xfa, 0xeb, 0xf8, 0xa7, 0xf5, 0x7a, 0xf2, 
-0x4c, 0xef, 0xec, 0xeb, 0x19, 0xe9, 0x9b, 0xe7, 0x4e, 0xea, 0x8a, 0xf0, 0x6b, 0xf5, 0x57, 0xf9, 
-0x90, 0x00, 0x7f, 0x09, 0x6e, 0x0f, 0xaa, 0x12, 0x13, 0x16, 0xdf, 0x17, 0x56, 0x15, 0x71, 0x10, 
-0x34, 0x0c, 0x60, 0x08, 0xda, 0x02, 0x74, 0xfc, 0xe2, 0xf8, 0xd5, 0xf8, 0x2b, 0xf9, 0x16, 0xf9, 
-0x92, 0xfb, 0x63, 0x00, 0x83, 0x04, 0xaa, 0x07, 0x25, 0x0a, 0x85, 0x0b, 0xd9, 0x0b, 0x14, 0x0b, 
-0xd9, 0x09, 0xfa, 0x08, 0x67, 0x06, 0x56, 0x02, 0x4d, 0x00, 0x4b, 0xff, 0x90, 0xfc, 0x19, 0xfb, 
-0x8b, 0xfb, 0xfe, 0xf9, 0xd6, 0xf7, 0x6d, 0xf6, 0xe1, 0xf2, 0xff, 0xed, 0x4a, 0xea, 0x95, 0xe7, 
-0xa5, 0xe5, 0x45, 0xe7, 0xb2, 0xec, 0x06, 0xf1, 0x9d, 0xf5, 0xeb, 0xfd, 0xb1, 0x06, 0xa5, 0x0c, 
-0x9c, 0x11, 0x65, 0x16, 0x11, 0x18, 0x06, 0x17, 0xcd, 0x14, 0xfd, 0x0f, 0xc3, 0x0a, 0x20, 0x06, 
-0x85, 0xff, 0xbe, 0xfa, 0x8a, 0xf9, 0xfa, 0xf7, 0x43, 0xf8, 0x87, 0xfb, 0x21, 0xfe, 0xd3, 0x00, 
-0xd0, 0x05, 0x67, 0x09, 0x60, 0x0a, 0x6f, 0x0c, 0x3e, 0x0d, 0x77, 0x0b, 0xc9, 0x09, 0xc7, 0x07, 
-0x2c, 0x05, 0xbe, 0x02, 0xce, 0xff, 0x3d, 0xfd, 0x0b, 0xfc, 0x6f, 0xfb, 0x9b, 0xfa, 0x40, 0xf9, 
-0xbb, 0xf7, 0x7f, 0xf6, 0xd1, 0xf3, 0x6d, 0xef, 0x73, 0xec, 0xb8, 0xe9, 0xc1, 0xe6, 0xee, 0xe8, 
-0xb6, 0xed, 0x8c, 0xf0, 0x13, 0xf6, 0x18, 0xff, 0x6a, 0x05, 0x85, 0x09, 0x58, 0x10, 0xde, 0x15, 
-0x57, 0x16, 0x5f, 0x15, 0x6f, 0x13, 0xa8, 0x0f, 0x5f, 0x0b, 0x19, 0x06, 0x9f, 0x00, 0x1f, 0xfd, 
-0xa3, 0xfa, 0x52, 0xf8, 0xa3, 0xf8, 0x6b, 0xfa, 0x30, 0xfc, 0x2e, 0x00, 0x8f, 0x04, 0xe8, 0x06, 
-0x0d, 0x0a, 0xa2, 0x0c, 0x32, 0x0c, 0xc7, 0x0b, 0x2a, 0x0b, 0xab, 0x08, 0x0c, 0x06, 0xd2, 0x03, 
-0x9e, 0x01, 0xd9, 0xfe, 0xe7, 0xfc, 0x6a, 0xfc, 0xf3, 0xfa, 0xa8, 0xf9, 0xb7, 0xf8, 0x5b, 0xf6, 
-0xa0, 0xf3, 0x60, 0xf0, 0x44, 0xec, 0x8b, 0xe9, 0x33, 0xe7, 0x89, 0xe5, 0xc6, 0xe9, 0xf3, 0xee, 
-0x7e, 0xf0, 0xd5, 0xf7, 0x62, 0x01, 0xe4, 0x05, 0xa0, 0x0d, 0x0c, 0x14, 0x77, 0x14, 0x3f, 0x17, 
-0x6c, 0x18, 0xc3, 0x13, 0x82, 0x10, 0x87, 0x0d, 0x31, 0x07, 0x24, 0x03, 0xac, 0xff, 0x45, 0xfb, 
-0xca, 0xfa, 0x1f, 0xfa, 0xf7, 0xf9, 0xaa, 0xfd, 0xc2, 0xff, 0x0a, 0x02, 0x5f, 0x06, 0x31, 0x08, 
-0x05, 0x0a, 0x2b, 0x0c, 0x49, 0x0b, 0xab, 0x0a, 0xdb, 0x09, 0xbb, 0x06, 0xb5, 0x04, 0x9b, 0x02, 
-0x79, 0xff, 0x30, 0xfe, 0x60, 0xfc, 0x6e, 0xfa, 0x40, 0xf9, 0xc8, 0xf6, 0xaa, 0xf4, 0x48, 0xf2, 
-0xb6, 0xee, 0x3a, 0xeb, 0x1a, 0xe8, 0xfc, 0xe5, 0x13, 0xe6, 0x5e, 0xe9, 0xe8, 0xec, 0xd4, 0xf0, 
-0xb2, 0xf8, 0xf6, 0xff, 0xb7, 0x05, 0xad, 0x0d, 0x37, 0x13, 0x58, 0x15, 0x64, 0x18, 0xcd, 0x18, 
-0x63, 0x15, 0x6a, 0x12, 0xb3, 0x0e, 0x4b, 0x09, 0xa3, 0x04, 0x11, 0x01, 0xec, 0xfc, 0xc1, 0xf9, 
-0x54, 0xf9, 0x6d, 0xf9, 0xf8, 0xf9, 0x9a, 0xfc, 0xd0, 0xff, 0x0d, 0x03, 0x16, 0x06, 0x8f, 0x08, 
-0x16, 0x0b, 0x46, 0x0b, 0xc8, 0x0a, 0xd3, 0x0a, 0xf2, 0x07, 0xd3, 0x05, 0x0f, 0x04, 0xab, 0xff, 
-0x1e, 0xfe, 0x4e, 0xfc, 0x4d, 0xf8, 0x3c, 0xf8, 0x15, 0xf6, 0x07, 0xf3, 0x20, 0xf3, 0xd7, 0xef, 
-0x0e, 0xed, 0xfb, 0xeb, 0xc1, 0xe8, 0x48, 0xe8, 0xba, 0xea, 0x2c, 0xed, 0xd2, 0xf0, 0xb7, 0xf5, 
-0xeb, 0xfb, 0x6f, 0x02, 0xa7, 0x08, 0x16, 0x0f, 0x76, 0x13, 0x74, 0x16, 0x03, 0x19, 0x2f, 0x18, 
-0xf9, 0x15, 0x16, 0x14, 0xd5, 0x0e, 0xc7, 0x09, 0x2f, 0x06, 0x68, 0x00, 0xae, 0xfc, 0xd2, 0xfa, 
-0xc8, 0xf7, 0xea, 0xf7, 0xbe, 0xfa, 0x72, 0xfb, 0x4f, 0xfe, 0x27, 0x03, 0xc1, 0x04, 0x12, 0x08, 
-0x09, 0x0b, 0x63, 0x0a, 0x9e, 0x0b, 0xd7, 0x0a, 0x18, 0x08, 0xf5, 0x06, 0x70, 0x03, 0xb9, 0x00, 
-0x78, 0xfe, 0x7c, 0xfa, 0x09, 0xf9, 0xd2, 0xf6, 0xdc, 0xf3, 0xa5, 0xf3, 0x48, 0xf1, 0xcc, 0xee, 
-0x19, 0xef, 0x5e, 0xeb, 0xfc, 0xe8, 0x3b, 0xeb, 0xbf, 0xe9, 0x3c, 0xec, 0x5e, 0xf2, 0x20, 0xf4, 
-0xf6, 0xfa, 0x70, 0x02, 0xfd, 0x05, 0xa5, 0x0d, 0xd2, 0x12, 0xd7, 0x14, 0x03, 0x19, 0x65, 0x19, 
-0xa5, 0x17, 0xe9, 0x15, 0xbe, 0x10, 0xc3, 0x0c, 0x92, 0x08, 0x36, 0x02, 0x29, 0xff, 0x4a, 0xfb, 
-0xd2, 0xf7, 0xa6, 0xf8, 0xe8, 0xf7, 0x3f, 0xf9, 0x5f, 0xfd, 0x12, 0xff, 0x01, 0x03, 0x06, 0x07, 
-0x01, 0x09, 0x51, 0x0b, 0xd2, 0x0b, 0x19, 0x0b, 0x3e, 0x0a, 0xf6, 0x07, 0xf0, 0x03, 0x66, 0x01, 
-0x7c, 0xfe, 0x2f, 0xfa, 0x69, 0xf8, 0x74, 0xf6, 0x25, 0xf4, 0xc9, 0xf3, 0xb8, 0xf2, 0x22, 0xf1, 
-0xdc, 0xf0, 0xd4, 0xee, 0x6d, 0xec, 0x4d, 0xec, 0x82, 0xeb, 0x63, 0xec, 0x12, 0xf0, 0xbc, 0xf1, 
-0x71, 0xf6, 0xe5, 0xfc, 0xc6, 0x00, 0x71, 0x08, 0xf6, 0x0d, 0x98, 0x11, 0x26, 0x17, 0xd8, 0x18, 
-0x5a, 0x18, 0xeb, 0x17, 0x39, 0x15, 0x4a, 0x10, 0x93, 0x0c, 0x5d, 0x07, 0xe0, 0x01, 0x8b, 0xfe, 
-0x4c, 0xfa, 0x4b, 0xf8, 0xb1, 0xf7, 0x85, 0xf7, 0x00, 0xfa, 0x99, 0xfb, 0xe4, 0xfe, 0xff, 0x02, 
-0xdd, 0x04, 0xa9, 0x08, 0x96, 0x09, 0x02, 0x0a, 0x52, 0x0a, 0x6f, 0x08, 0xae, 0x07, 0x96, 0x03, 
-0xd5, 0x01, 0xc3, 0xff, 0xbd, 0xfa, 0xfc, 0xfa, 0xf3, 0xf7, 0x0f, 0xf5, 0x15, 0xf7, 0x3f, 0xf3, 
-0xd2, 0xf2, 0xee, 0xf3, 0xe9, 0xee, 0xa8, 0xef, 0x95, 0xee, 0x9f, 0xeb, 0x63, 0xee, 0x56, 0xef, 
-0x71, 0xf1, 0x56, 0xf6, 0x77, 0xfa, 0x1a, 0x00, 0x0c, 0x06, 0x7a, 0x0b, 0xe9, 0x10, 0x7c, 0x14, 
-0xcd, 0x17, 0x6b, 0x18, 0x8f, 0x17, 0x2a, 0x16, 0xb1, 0x11, 0x2d, 0x0e, 0x81, 0x09, 0x81, 0x04, 
-0x92, 0x00, 0x1e, 0xfc, 0xb9, 0xf9, 0x20, 0xf8, 0x58, 0xf7, 0xa3, 0xf8, 0x61, 0xfa, 0xf2, 0xfc, 
-0xa5, 0xff, 0xdd, 0x02, 0x3c, 0x05, 0xc9, 0x06, 0x55, 0x09, 0x75, 0x07, 0x30, 0x08, 0x9a, 0x07, 
-0xf9, 0x02, 0x6b, 0x04, 0x49, 0xff, 0x68, 0xfc, 0x36, 0xfe, 0x31, 0xf7, 0x52, 0xf8, 0x54, 0xf8, 
-0x58, 0xf2, 0x39, 0xf6, 0x4c, 0xf3, 0x35, 0xf0, 0xc2, 0xf2, 0x60, 0xed, 0x16, 0xee, 0x75, 0xee, 
-0xe9, 0xec, 0xc3, 0xf2, 0x11, 0xf3, 0x5b, 0xf7, 0x9c, 0xff, 0x4b, 0x00, 0x91, 0x08, 0x8a, 0x0f, 
-0xbe, 0x0e, 0xda, 0x16, 0x10, 0x18, 0xee, 0x14, 0xbf, 0x18, 0x2c, 0x13, 0x17, 0x0f, 0x74, 0x0e, 
-0xa3, 0x06, 0xb9, 0x03, 0xad, 0x00, 0xec, 0xfa, 0xe3, 0xfa, 0x64, 0xf8, 0xc8, 0xf7, 0x86, 0xfa, 
-0x4e, 0xfa, 0x2d, 0xfd, 0x33, 0x00, 0x7d, 0x01, 0x4c, 0x04, 0x1a, 0x06, 0x71, 0x06, 0x2e, 0x07, 
-0xaf, 0x06, 0x92, 0x05, 0x22, 0x04, 0x12, 0x02, 0x51, 0x00, 0x59, 0xfd, 0x47, 0xfc, 0x5c, 0xfa, 
-0x97, 0xf7, 0xdc, 0xf7, 0x68, 0xf5, 0x98, 0xf3, 0x81, 0xf4, 0xaf, 0xf1, 0x93, 0xf0, 0xda, 0xef, 
-0xdc, 0xed, 0x2e, 0xef, 0x52, 0xef, 0x55, 0xf2, 0x30, 0xf5, 0x8d, 0xf8, 0x60, 0xff, 0xa8, 0x02, 
-0x10, 0x09, 0xe8, 0x0e, 0x51, 0x11, 0x41, 0x16, 0x5f, 0x17, 0x2d, 0x17, 0x36, 0x17, 0x58, 0x13, 
-0xc9, 0x10, 0xaf, 0x0c, 0x84, 0x07, 0x9e, 0x04, 0x8f, 0xff, 0x0b, 0xfc, 0xa8, 0xfa, 0x54, 0xf8, 
-0xe2, 0xf7, 0xbc, 0xf8, 0xaf, 0xf9, 0xb0, 0xfb, 0x9a, 0xfd, 0x54, 0x00, 0xfb, 0x01, 0x0b, 0x03, 
-0xd5, 0x05, 0xa3, 0x04, 0x07, 0x05, 0x77, 0x05, 0xe6, 0x01, 0x88, 0x02, 0xf4, 0xff, 0x1c, 0xfd, 
-0xd2, 0xfd, 0x2d, 0xfa, 0x87, 0xf9, 0xaa, 0xf9, 0x05, 0xf7, 0x54, 0xf7, 0x8a, 0xf6, 0x60, 0xf5, 
-0x3e, 0xf4, 0x70, 0xf3, 0x74, 0xf1, 0xbc, 0xef, 0xb6, 0xf2, 0x77, 0xf1, 0x37, 0xf3, 0x34, 0xf9, 
-0xe0, 0xf9, 0x7d, 0xff, 0x21, 0x06, 0x04, 0x08, 0x41, 0x0e, 0x82, 0x12, 0x01, 0x13, 0x5a, 0x16, 
-0x28, 0x16, 0x2a, 0x13, 0xec, 0x12, 0xcb, 0x0e, 0x3c, 0x0a, 0x10, 0x08, 0x6d, 0x02, 0x59, 0xff, 
-0xea, 0xfc, 0x8a, 0xf9, 0x23, 0xf9, 0xa4, 0xf8, 0xb7, 0xf8, 0x59, 0xfa, 0xb6, 0xfb, 0x64, 0xfd, 
-0x55, 0xff, 0x39, 0x01, 0xb4, 0x02, 0xb2, 0x03, 0x67, 0x04, 0x39, 0x04, 0x1e, 0x04, 0x4e, 0x03, 
-0x4a, 0x02, 0x7f, 0x00, 0x1d, 0xff, 0xc5, 0xfd, 0x9b, 0xfb, 0x19, 0xfb, 0xc3, 0xf8, 0x08, 0xf8, 
-0x18, 0xf7, 0x21, 0xf5, 0x0b, 0xf6, 0xd1, 0xf2, 0xd4, 0xf2, 0x22, 0xf2, 0x24, 0xef, 0x9b, 0xf4, 
-0x23, 0xf3, 0xe4, 0xf4, 0xed, 0xfc, 0x2d, 0xfb, 0x04, 0x03, 0x19, 0x09, 0xfe, 0x07, 0x29, 0x11, 
-0x09, 0x12, 0x8d, 0x11, 0xa1, 0x16, 0x6e, 0x12, 0x17, 0x11, 0xce, 0x10, 0xb4, 0x0a, 0x11, 0x09, 
-0x79, 0x05, 0xa3, 0x00, 0x25, 0xff, 0xeb, 0xfb, 0x57, 0xfa, 0x02, 0xfa, 0x25, 0xf9, 0xcb, 0xfa, 
-0x1d, 0xfc, 0xf1, 0xfc, 0xe5, 0x00, 0x28, 0x01, 0x7e, 0x03, 0x79, 0x06, 0xdc, 0x04, 0x57, 0x07, 
-0xaf, 0x06, 0x59, 0x04, 0xe9, 0x03, 0x2b, 0x01, 0xc7, 0xfd, 0xcc, 0xfb, 0x04, 0xf9, 0xd7, 0xf5, 
-0xf0, 0xf4, 0xd4, 0xf2, 0x00, 0xf2, 0xf5, 0xf1, 0x58, 0xf1, 0x7d, 0xf1, 0x5b, 0xf1, 0x60, 0xf1, 
-0x34, 0xf2, 0x6f, 0xf3, 0xc1, 0xf4, 0x85, 0xf7, 0x77, 0xf9, 0xd1, 0xfc, 0xa2, 0x00, 0xe0, 0x03, 
-0xf1, 0x08, 0xe4, 0x0b, 0xce, 0x0f, 0xc0, 0x12, 0xa8, 0x13, 0xb1, 0x15, 0x53, 0x14, 0x9a, 0x12, 
-0x25, 0x11, 0xd9, 0x0c, 0x2c, 0x09, 0x47, 0x06, 0x44, 0x01, 0xa2, 0xfe, 0x8c, 0xfc, 0x86, 0xf9, 
-0xc5, 0xf9, 0x4a, 0xf9, 0x2b, 0xfa, 0x7a, 0xfb, 0x0f, 0xfe, 0xa2, 0xff, 0x99, 0x01, 0x25, 0x05, 
-0x33, 0x04, 0xac, 0x07, 0x24, 0x07, 0xef, 0x05, 0x13, 0x07, 0x01, 0x03, 0x7c, 0x02, 0x7d, 0xff, 
-0x25, 0xfc, 0xab, 0xfa, 0x1d, 0xf7, 0x5b, 0xf5, 0xac, 0xf3, 0x2c, 0xf2, 0x24, 0xf2, 0xe1, 0xf0, 
-0x5d, 0xf1, 0xec, 0xf0, 0x47, 0xf0, 0xa8, 0xf2, 0x39, 0xf1, 0xe9, 0xf4, 0xae, 0xf6, 0x22, 0xf7, 
-0xa9, 0xfd, 0x99, 0xfd, 0xc6, 0x02, 0xff, 0x06, 0x06, 0x08, 0x3e, 0x0e, 0xc1, 0x0e, 0x5e, 0x11, 
-0x1d, 0x13, 0x49, 0x11, 0xc5, 0x11, 0x7c, 0x0f, 0x96, 0x0c, 0x6d, 0x0a, 0xdc, 0x06, 0x4e, 0x03, 
-0x4f, 0x01, 0x6d, 0xfe, 0xb6, 0xfc, 0x56, 0xfc, 0xbc, 0xfb, 0xb3, 0xfb, 0x7e, 0xfd, 0x42, 0xff, 
-0x73, 0xff, 0xa2, 0x03, 0xa9, 0x03, 0xb1, 0x04, 0xe1, 0x07, 0x70, 0x05, 0x32, 0x07, 0x38, 0x06, 
-0x8d, 0x03, 0x52, 0x03, 0xb3, 0xff, 0x67, 0xfd, 0x8b, 0xfb, 0xd0, 0xf7, 0xe7, 0xf6, 0xba, 0xf4, 
-0xc8, 0xf2, 0xbe, 0xf3, 0x38, 0xf1, 0x47, 0xf2, 0x1a, 0xf2, 0xa0, 0xf0, 0xd0, 0xf2, 0x95, 0xf1, 
-0x8e, 0xf3, 0x63, 0xf5, 0x93, 0xf6, 0x59, 0xfa, 0x3c, 0xfc, 0x66, 0x00, 0xcd, 0x03, 0x36, 0x07, 
-0x9f, 0x0b, 0x9a, 0x0d, 0xa6, 0x10, 0xe0, 0x11, 0xc2, 0x11, 0xea, 0x11, 0xdf, 0x0f, 0xc2, 0x0d, 
-0x71, 0x0b, 0xd5, 0x07, 0x0b, 0x05, 0x6e, 0x02, 0x57, 0xff, 0xd0, 0xfd, 0xaf, 0xfc, 0x4a, 0xfb, 
-0xd5, 0xfb, 0x88, 0xfd, 0x2b, 0xfd, 0xbc, 0x00, 0x6c, 0x02, 0x22, 0x02, 0x38, 0x07, 0x2f, 0x05, 
-0x09, 0x07, 0x91, 0x08, 0x9f, 0x04, 0xe4, 0x06, 0xc9, 0x02, 0xa7, 0x00, 0x86, 0xff, 0x98, 0xfa, 
-0xb2, 0xf9, 0x8f, 0xf6, 0x76, 0xf4, 0x3f, 0xf3, 0xd5, 0xf1, 0x55, 0xf1, 0xea, 0xf0, 0xe7, 0xf1, 
-0x49, 0xf1, 0xe6, 0xf1, 0xa3, 0xf2, 0x67, 0xf2, 0x54, 0xf5, 0x8b, 0xf6, 0x46, 0xf8, 0x86, 0xfc, 
-0xc3, 0xfd, 0xd2, 0x01, 0xa6, 0x05, 0x27, 0x07, 0x43, 0x0c, 0xa9, 0x0d, 0x94, 0x0f, 0xcf, 0x11, 
-0x6f, 0x10, 0x4c, 0x11, 0x86, 0x0f, 0x1c, 0x0d, 0xb9, 0x0b, 0x56, 0x08, 0x92, 0x05, 0xc2, 0x03, 
-0x51, 0x00, 0x3a, 0xff, 0xe8, 0xfd, 0xf9, 0xfb, 0xcd, 0xfd, 0xf4, 0xfb, 0xf1, 0xfe, 0x38, 0x00, 
-0x01, 0x00, 0x4a, 0x05, 0xfd, 0x02, 0x36, 0x06, 0x4f, 0x07, 0xfe, 0x04, 0xee, 0x07, 0xda, 0x03, 
-0x5e, 0x03, 0x04, 0x02, 0x77, 0xfd, 0x78, 0xfd, 0x4a, 0xf9, 0xb1, 0xf6, 0x39, 0xf6, 0xa3, 0xf2, 
-0xdb, 0xf2, 0x32, 0xf2, 0x5a, 0xf0, 0x5b, 0xf2, 0xeb, 0xf0, 0xdd, 0xf0, 0xc2, 0xf2, 0x32, 0xf2, 
-0x77, 0xf4, 0x7d, 0xf6, 0x20, 0xf8, 0xfe, 0xfa, 0x2d, 0xfe, 0xe4, 0x00, 0x7f, 0x04, 0x45, 0x08, 
-0x5c, 0x0a, 0xf4, 0x0d, 0x65, 0x0f, 0xb2, 0x10, 0xd9, 0x11, 0x96, 0x10, 0x2c, 0x10, 0x36, 0x0e, 
-0xc5, 0x0b, 0x49, 0x09, 0x35, 0x06, 0x60, 0x03, 0x37, 0x01, 0x8f, 0xfe, 0x49, 0xfd, 0x25, 0xfc, 
-0x3d, 0xfb, 0x64, 0xfd, 0x47, 0xfc, 0x05, 0xff, 0xe5, 0x00, 0x91, 0x00, 0x24, 0x05, 0x90, 0x03, 
-0xc6, 0x05, 0x82, 0x06, 0xc7, 0x03, 0xc5, 0x05, 0x0e, 0x02, 0xdc, 0x00, 0x17, 0xff, 0x86, 0xfb, 
-0x6b, 0xfa, 0x3f, 0xf7, 0x20, 0xf6, 0x7d, 0xf4, 0xc1, 0xf2, 0x32, 0xf2, 0xba, 0xf1, 0x24, 0xf1, 
-0x6d, 0xf1, 0xf5, 0xf1, 0xe0, 0xf1, 0x95, 0xf3, 0x63, 0xf4, 0x0b, 0xf7, 0xb9, 0xf9, 0xbd, 0xfb, 
-0x68, 0x00, 0xa4, 0x02, 0x28, 0x06, 0x52, 0x0a, 0xf5, 0x0b, 0x3e, 0x0f, 0xee, 0x10, 0x10, 0x11, 
-0x2d, 0x12, 0xd0, 0x10, 0x35, 0x0f, 0xf9, 0x0d, 0xb2, 0x0a, 0x0d, 0x08, 0x75, 0x05, 0x56, 0x02, 
-0xcf, 0xff, 0x30, 0xfe, 0x4b, 0xfc, 0xb8, 0xfb, 0xcf, 0xfb, 0x0c, 0xfb, 0x06, 0xfe, 0x29, 0xfe, 
-0xba, 0xff, 0x6f, 0x03, 0x24, 0x02, 0x4c, 0x06, 0x10, 0x06, 0x71, 0x05, 0xdd, 0x07, 0x69, 0x03, 
-0xc2, 0x04, 0xaf, 0x01, 0xdb, 0xfd, 0x2d, 0xfe, 0x75, 0xf8, 0xb0, 0xf7, 0x9a, 0xf5, 0xee, 0xf2, 
-0xc1, 0xf2, 0x67, 0xf1, 0x6d, 0xf1, 0x16, 0xf1, 0x69, 0xf2, 0x3b, 0xf1, 0xdd, 0xf2, 0x22, 0xf4, 
-0xe0, 0xf3, 0x95, 0xf8, 0x84, 0xf8, 0x18, 0xfc, 0xe2, 0xff, 0xe8, 0x00, 0x8e, 0x06, 0x52, 0x08, 
-0x9d, 0x0b, 0xd7, 0x0e, 0x98, 0x0f, 0xbd, 0x11, 0x91, 0x11, 0xf1, 0x10, 0xe6, 0x0f, 0x8b, 0x0d, 
-0xdd, 0x0a, 0x9f, 0x08, 0xfd, 0x04, 0x6c, 0x02, 0x51, 0x00, 0xff, 0xfc, 0x1a, 0xfd, 0xf9, 0xfa, 
-0xf1, 0xfa, 0xc9, 0xfc, 0x68, 0xfb, 0x1c, 0xff, 0xcd, 0xff, 0x9b, 0x00, 0x9c, 0x04, 0x5e, 0x03, 
-0xc4, 0x05, 0x67, 0x06, 0xc6, 0x04, 0x2b, 0x06, 0x68, 0x03, 0xff, 0x01, 0x9c, 0x00, 0x03, 0xfd, 
-0x76, 0xfb, 0xfa, 0xf8, 0x66, 0xf6, 0x91, 0xf5, 0xcc, 0xf3, 0x7b, 0xf2, 0x36, 0xf3, 0x9e, 0xf1, 
-0xbb, 0xf2, 0x03, 0xf3, 0xd6, 0xf1, 0xf6, 0xf4, 0x6a, 0xf3, 0xc8, 0xf6, 0x0e, 0xf9, 0x9d, 0xf8, 
-0x38, 0xff, 0x9b, 0xfe, 0x56, 0x03, 0x9f, 0x07, 0x57, 0x07, 0xe2, 0x0d, 0x69, 0x0d, 0xc1, 0x0f, 
-0xf6, 0x11, 0x5c, 0x0f, 0x00, 0x11, 0x6e, 0x0e, 0xef, 0x0b, 0xbc, 0x0a, 0xb1, 0x06, 0x4c, 0x04, 
-0x25, 0x02, 0xd3, 0xfe, 0xc3, 0xfd, 0x74, 0xfc, 0x1b, 0xfb, 0xd1, 0xfb, 0xbb, 0xfb, 0xfc, 0xfc, 
-0x90, 0xfe, 0x17, 0x00, 0xae, 0x01, 0x9d, 0x03, 0xee, 0x04, 0x2c, 0x05, 0xde, 0x06, 0x4a, 0x05, 
-0x81, 0x05, 0xb0, 0x04, 0x04, 0x01, 0x02, 0x01, 0x02, 0xfd, 0x9d, 0xfa, 0x15, 0xf9, 0x92, 0xf5, 
-0xd6, 0xf4, 0x1e, 0xf3, 0x66, 0xf2, 0xed, 0xf1, 0x3e, 0xf2, 0x0b, 0xf2, 0x43, 0xf2, 0x88, 0xf3, 
-0x41, 0xf3, 0x1a, 0xf6, 0xe2, 0xf6, 0xb1, 0xf8, 0x4f, 0xfc, 0x1e, 0xfd, 0x57, 0x01, 0x27, 0x04, 
-0x86, 0x06, 0x5d, 0x0a, 0x11, 0x0c, 0x7d, 0x0e, 0xf9, 0x0f, 0x48, 0x10, 0x5f, 0x10, 0x48, 0x0f, 
-0x98, 0x0d, 0xca, 0x0b, 0x05, 0x09, 0x58, 0x06, 0x12, 0x04, 0x33, 0x01, 0x78, 0xff, 0xbb, 0xfd, 
-0xa0, 0xfc, 0xb6, 0xfc, 0x7e, 0xfc, 0x85, 0xfd, 0xbe, 0xfe, 0xbf, 0xff, 0x88, 0x01, 0xc9, 0x02, 
-0xb7, 0x03, 0xf9, 0x04, 0xf2, 0x04, 0xc3, 0x04, 0xa6, 0x04, 0x03, 0x03, 0xf5, 0x01, 0x32, 0x00, 
-0x6e, 0xfd, 0xdd, 0xfb, 0x9f, 0xf9, 0x7b, 0xf7, 0x78, 0xf6, 0xfd, 0xf4, 0x1e, 0xf4, 0x39, 0xf4, 
-0x90, 0xf3, 0xf1, 0xf3, 0x87, 0xf4, 0xc9, 0xf3, 0x10, 0xf5, 0xa0, 0xf5, 0xf5, 0xf5, 0x5c, 0xf8, 
-0x3f, 0xf9, 0x4a, 0xfb, 0x4a, 0xfe, 0xec, 0xff, 0x8f, 0x03, 0x58, 0x06, 0x6b, 0x08, 0xe7, 0x0b, 
-0x23, 0x0d, 0x8a, 0x0e, 0xd8, 0x0f, 0x20, 0x0f, 0xb8, 0x0e, 0x36, 0x0d, 0x7c, 0x0b, 0x23, 0x09, 
-0x9f, 0x06, 0x8a, 0x04, 0x6c, 0x01, 0x45, 0x00, 0x12, 0xfe, 0xfd, 0xfc, 0x37, 0xfd, 0xe5, 0xfb, 
-0xc7, 0xfd, 0xd2, 0xfd, 0x9b, 0xfe, 0xf0, 0x00, 0xbf, 0x00, 0x9e, 0x02, 0x5d, 0x03, 0x77, 0x03, 
-0x32, 0x04, 0x88, 0x03, 0xde, 0x02, 0x93, 0x01, 0x81, 0x00, 0x2f, 0xfe, 0x6a, 0xfc, 0xe1, 0xfa, 
-0x3f, 0xf8, 0x8c, 0xf7, 0xed, 0xf5, 0x03, 0xf5, 0xe5, 0xf4, 0x84, 0xf4, 0xf0, 0xf4, 0x0c, 0xf5, 
-0x6b, 0xf5, 0x60, 0xf5, 0x91, 0xf6, 0x73, 0xf7, 0x13, 0xf8, 0xc4, 0xfa, 0xa4, 0xfb, 0xe2, 0xfd, 
-0x29, 0x01, 0x45, 0x02, 0x30, 0x06, 0x51, 0x08, 0x24, 0x0a, 0x4a, 0x0d, 0xa1, 0x0d, 0x06, 0x0f, 
-0x2d, 0x0f, 0xeb, 0x0d, 0x93, 0x0d, 0x6d, 0x0b, 0x64, 0x09, 0x02, 0x07, 0x77, 0x04, 0x75, 0x02, 
-0xd0, 0xff, 0x61, 0xff, 0x6b, 0xfd, 0xf4, 0xfc, 0xc3, 0xfd, 0x9e, 0xfc, 0x9c, 0xfe, 0xfa, 0xfe, 
-0x78, 0xff, 0x81, 0x01, 0x25, 0x01, 0x8e, 0x02, 0xdb, 0x02, 0x5d, 0x02, 0x0f, 0x03, 0x4a, 0x01, 
-0xb0, 0x00, 0x5b, 0xff, 0x84, 0xfd, 0xb8, 0xfb, 0xbe, 0xf9, 0x05, 0xf9, 0xd4, 0xf6, 0x70, 0xf6, 
-0x32, 0xf6, 0x02, 0xf5, 0x65, 0xf6, 0x85, 0xf6, 0x07, 0xf6, 0x3f, 0xf7, 0xa6, 0xf6, 0x31, 0xf7, 
-0xae, 0xf8, 0xe3, 0xf8, 0xab, 0xfa, 0xa3, 0xfc, 0x81, 0xfd, 0x8b, 0x00, 0xda, 0x02, 0x60, 0x04, 
-0x19, 0x08, 0x52, 0x09, 0x4e, 0x0b, 0x63, 0x0d, 0x46, 0x0d, 0xf3, 0x0d, 0xa9, 0x0d, 0x42, 0x0c, 
-0xec, 0x0a, 0x53, 0x09, 0xf1, 0x06, 0xbc, 0x04, 0x4b, 0x03, 0xe7, 0x00, 0xdc, 0xff, 0x41, 0xff, 
-0xd1, 0xfd, 0xb0, 0xfe, 0x3b, 0xfe, 0xd3, 0xfe, 0xc0, 0xff, 0xcc, 0xff, 0x28, 0x01, 0x2e, 0x01, 
-0xcb, 0x01, 0x17, 0x02, 0xa6, 0x01, 0xed, 0x01, 0x90, 0x00, 0xbe, 0xff, 0xba, 0xfe, 0x7c, 0xfc, 
-0xc8, 0xfb, 0xf4, 0xf9, 0xf5, 0xf8, 0x3c, 0xf8, 0x4c, 0xf7, 0x45, 0xf7, 0x9e, 0xf6, 0x69, 0xf7, 
-0x65, 0xf7, 0xa2, 0xf6, 0x60, 0xf7, 0x08, 0xf7, 0x10, 0xf7, 0x5c, 0xf8, 0xa9, 0xf8, 0x2f, 0xfa, 
-0xab, 0xfb, 0x88, 0xfd, 0x1b, 0x00, 0xaf, 0x01, 0xc8, 0x04, 0x9e, 0x07, 0xd2, 0x08, 0x7f, 0x0b, 
-0xb3, 0x0c, 0xe5, 0x0c, 0xf3, 0x0d, 0x8d, 0x0c, 0x11, 0x0c, 0xb9, 0x0a, 0xfa, 0x07, 0xe7, 0x06, 
-0x46, 0x04, 0x8d, 0x02, 0x86, 0x01, 0x58, 0xff, 0x63, 0xff, 0x69, 0xfe, 0x3c, 0xfe, 0x56, 0xff, 
-0xa1, 0xfe, 0x5b, 0x00, 0xa9, 0x00, 0x9e, 0x00, 0x25, 0x02, 0x62, 0x01, 0x6e, 0x01, 0x50, 0x01, 
-0x02, 0x00, 0x82, 0xff, 0x54, 0xfe, 0xf9, 0xfc, 0x13, 0xfc, 0xd9, 0xfa, 0x22, 0xfa, 0x86, 0xf9, 
-0x64, 0xf8, 0xa1, 0xf8, 0x32, 0xf8, 0x85, 0xf7, 0x88, 0xf8, 0x4e, 0xf7, 0xcf, 0xf7, 0x1e, 0xf8, 
-0x86, 0xf6, 0x69, 0xf8, 0x7b, 0xf8, 0x1f, 0xf9, 0x5b, 0xfb, 0xf0, 0xfb, 0xda, 0xfe, 0xce, 0x00, 
-0x62, 0x03, 0xb3, 0x06, 0xa3, 0x07, 0xcf, 0x0a, 0x7f, 0x0c, 0x6e, 0x0c, 0xa3, 0x0d, 0x3c, 0x0d, 
-0x0a, 0x0c, 0xbe, 0x0a, 0x69, 0x09, 0x70, 0x07, 0x8f, 0x04, 0x06, 0x04, 0xf1, 0x01, 0xc8, 0xff, 
-0x80, 0x00, 0x31, 0xfe, 0x9e, 0xfe, 0x4e, 0xff, 0x10, 0xfe, 0x4d, 0x00, 0xd9, 0xff, 0x65, 0x00, 
-0x29, 0x01, 0xaa, 0x00, 0x8b, 0x01, 0x2a, 0x00, 0x5a, 0x00, 0x7f, 0xff, 0x1b, 0xfe, 0x9f, 0xfd, 
-0xf1, 0xfb, 0x85, 0xfb, 0x32, 0xfa, 0x2e, 0xf9, 0x96, 0xf9, 0x72, 0xf8, 0x5d, 0xf8, 0x17, 0xf9, 
-0x2c, 0xf8, 0xf6, 0xf7, 0x95, 0xf8, 0xd1, 0xf7, 0x7d, 0xf7, 0x3c, 0xf8, 0xf2, 0xf7, 0x23, 0xf9, 
-0x39, 0xfa, 0x61, 0xfb, 0x63, 0xfe, 0xbf, 0xff, 0x58, 0x02, 0x9d, 0x05, 0x58, 0x07, 0x59, 0x09, 
-0xb0, 0x0b, 0xe1, 0x0c, 0xc1, 0x0c, 0x2a, 0x0d, 0xa0, 0x0c, 0xd2, 0x0a, 0x93, 0x09, 0x07, 0x08, 
-0x9e, 0x05, 0x34, 0x04, 0x48, 0x02, 0xb0, 0x00, 0x23, 0x00, 0x7e, 0xfe, 0x6e, 0xfe, 0x96, 0xfe, 
-0xd3, 0xfe, 0x58, 0xff, 0xa6, 0xff, 0xac, 0x00, 0x7f, 0x00, 0x11, 0x01, 0x35, 0x01, 0xbb, 0x00, 
-0xe6, 0xff, 0x4f, 0xff, 0xbe, 0xfe, 0x5e, 0xfc, 0xcb, 0xfc, 0x89, 0xfc, 0xe7, 0xf9, 0xc7, 0xfa, 
-0x61, 0xfa, 0x41, 0xf8, 0xa3, 0xf9, 0xa7, 0xf8, 0xac, 0xf7, 0xde, 0xf8, 0xfd, 0xf7, 0xce, 0xf7, 
-0x78, 0xf8, 0xf5, 0xf8, 0x5b, 0xf8, 0x4d, 0xfa, 0x09, 0xfc, 0xb8, 0xfb, 0x16, 0xff, 0x24, 0x01, 
-0x8d, 0x01, 0x3a, 0x05, 0xb4, 0x06, 0x5f, 0x07, 0x30, 0x0a, 0x40, 0x0a, 0xa1, 0x0a, 0x8e, 0x0b, 
-0x88, 0x0a, 0xa8, 0x09, 0x19, 0x09, 0xc3, 0x07, 0x9e, 0x05, 0x01, 0x05, 0xb5, 0x03, 0x0a, 0x02, 
-0xa0, 0x01, 0xf1, 0x00, 0x60, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x43, 0x00, 0xc9, 0xff, 
-0xb3, 0x00, 0x68, 0x00, 0x88, 0xff, 0x4f, 0x00, 0x7a, 0xff, 0x9c, 0xfe, 0xd8, 0xfd, 0xd6, 0xfd, 
-0x48, 0xfc, 0xff, 0xfa, 0x80, 0xfb, 0xee, 0xf9, 0x41, 0xf9, 0x72, 0xf9, 0xa3, 0xf9, 0x0a, 0xf9, 
-0xe7, 0xf8, 0x85, 0xfa, 0x9a, 0xf9, 0xd9, 0xf8, 0x2e, 0xfb, 0xa3, 0xfa, 0x36, 0xf9, 0x04, 0xfc, 
-0xd5, 0xfc, 0x84, 0xfb, 0x90, 0xfd, 0xbb, 0x00, 0x1a, 0xff, 0x35, 0x00, 0xda, 0x04, 0xa2, 0x03, 
-0x89, 0x03, 0x4f, 0x08, 0x15, 0x08, 0x9a, 0x06, 0x77, 0x09, 0xb7, 0x09, 0x3f, 0x07, 0x2d, 0x07, 
-0x74, 0x08, 0x79, 0x05, 0x3f, 0x04, 0xcf, 0x05, 0xe2, 0x02, 0x73, 0x02, 0xd0, 0x01, 0xea, 0x00, 
-0x72, 0x00, 0xe7, 0xfe, 0x1e, 0x00, 0x39, 0xff, 0xb5, 0xff, 0xce, 0xff, 0x29, 0x00, 0x9b, 0x00, 
-0x6f, 0xff, 0xc4, 0xff, 0x3f, 0xff, 0x4c, 0xfe, 0x20, 0xfd, 0x21, 0xfd, 0xb9, 0xfc, 0xc5, 0xfa, 
-0x6e, 0xfb, 0x90, 0xfb, 0x0d, 0xfa, 0xe9, 0xf9, 0xa0, 0xfb, 0xe3, 0xfa, 0xdb, 0xf9, 0xc3, 0xfc, 
-0x68, 0xfc, 0xc7, 0xfa, 0x5a, 0xfd, 0xaa, 0xfd, 0x5b, 0xfc, 0xbf, 0xfd, 0x88, 0xff, 0x51, 0xff, 
-0x49, 0xff, 0xbe, 0x01, 0x47, 0x01, 0x59, 0x01, 0xf3, 0x02, 0x22, 0x03, 0x77, 0x03, 0x90, 0x04, 
-0xf4, 0x04, 0x9a, 0x05, 0x64, 0x05, 0x14, 0x05, 0x6d, 0x05, 0x22, 0x04, 0x78, 0x04, 0xca, 0x03, 
-0x91, 0x02, 0xaf, 0x03, 0x90, 0x02, 0x07, 0x02, 0xa5, 0x01, 0x25, 0x02, 0x5b, 0x00, 0x01, 0xff, 
-0x01, 0x02, 0x65, 0xfe, 0x1d, 0xfe, 0xcc, 0x00, 0x3c, 0xfe, 0x8e, 0xfd, 0x0f, 0xfe, 0x8d, 0xfe, 
-0xc1, 0xfc, 0xcb, 0xfb, 0x3d, 0xfe, 0x26, 0xfc, 0x5d, 0xfc, 0x43, 0xfd, 0x2f, 0xfd, 0x1c, 0xfe, 
-0x44, 0xfc, 0x69, 0xfe, 0x51, 0xff, 0x7d, 0xfc, 0x65, 0xfe, 0x4e, 0x00, 0x3d, 0xfe, 0xcb, 0xfc, 
-0xe2, 0xff, 0x74, 0xff, 0xf9, 0xfb, 0x29, 0xff, 0xc9, 0x00, 0xee, 0xfc, 0x7d, 0xff, 0xe6, 0x02, 
-0xed, 0x00, 0xfe, 0x00, 0x7d, 0x02, 0x0d, 0x04, 0xa2, 0x01, 0x55, 0x02, 0x6d, 0x05, 0x68, 0x02, 
-0x6f, 0x02, 0x10, 0x03, 0xf7, 0x02, 0xe1, 0x01, 0x40, 0x00, 0xd6, 0x02, 0x6c, 0x00, 0xbe, 0xff, 
-0xf1, 0x01, 0xc7, 0x00, 0x94, 0x00, 0xb7, 0xff, 0x99, 0x00, 0x2a, 0x00, 0x2d, 0xfe, 0x25, 0x01, 
-0x0a, 0x00, 0x10, 0xff, 0xdd, 0x00, 0x03, 0x01, 0x27, 0x00, 0xea, 0xfe, 0x5b, 0x00, 0xc8, 0xfe, 
-0x43, 0xfd, 0x7d, 0xff, 0x00, 0xff, 0x89, 0xfd, 0xb2, 0xfe, 0xea, 0xfe, 0x07, 0xfe, 0xa6, 0xfe, 
-0x9a, 0xfe, 0x71, 0xfe, 0x39, 0xfe, 0xd1, 0xfe, 0xcf, 0xff, 0x85, 0xff, 0xea, 0x00, 0x74, 0xff, 
-0xa8, 0xff, 0x1c, 0x00, 0x5c, 0xff, 0x9b, 0x00, 0x04, 0x00, 0x70, 0xff, 0x77, 0x00, 0x16, 0x01, 
-0x68, 0x00, 0x35, 0x01, 0x90, 0x01, 0xbb, 0x00, 0xcd, 0x00, 0x54, 0x01, 0xb4, 0x00, 0xc1, 0xff, 
-0x4e, 0x00, 0x80, 0x00, 0xcd, 0xff, 0x12, 0x00, 0x97, 0x00, 0x94, 0x00, 0xe2, 0xff, 0x79, 0xff, 
-0x85, 0xff, 0xfd, 0xfe, 0x55, 0xff, 0x5e, 0xff, 0x56, 0xff, 0x44, 0x00, 0x55, 0xff, 0x91, 0x00, 
-0xbe, 0xff, 0x13, 0xff, 0xbb, 0x00, 0xaf, 0xfe, 0xb6, 0xff, 0xa8, 0xff, 0xbf, 0xff, 0xa2, 0xff, 
-0x18, 0x00, 0xc1, 0xff, 0xef, 0xfd, 0x01, 0x00, 0xb7, 0xff, 0x4b, 0xff, 0xf7, 0xff, 0xc3, 0x00, 
-0x8d, 0x00, 0xcf, 0xff, 0x6e, 0x01, 0x04, 0x00, 0x2c, 0xff, 0xfb, 0x00, 0xa0, 0x00, 0x90, 0xff, 
-0xd6, 0xff, 0xf2, 0xff, 0x64, 0x00, 0xeb, 0x00, 0xcd, 0xff, 0x73, 0x01, 0x4a, 0x01, 0x04, 0x00, 
-0xdc, 0x00, 0x5a, 0x01, 0x57, 0xff, 0xfa, 0xfe, 0x2d, 0x01, 0xb8, 0xff, 0x27, 0xff, 0x40, 0xff, 
-0xfa, 0xfe, 0x09, 0x00, 0x64, 0xff, 0xb4, 0x00, 0x8a, 0x00, 0x67, 0xff, 0x29, 0x00, 0x2d, 0xff, 
-0x31, 0x00, 0x7c, 0xff, 0x57, 0xff, 0x23, 0x00, 0x01, 0x00, 0xf8, 0xff, 0x72, 0xff, 0x48, 0x00, 
-0x83, 0xff, 0xc3, 0xff, 0xf0, 0xfe, 0x03, 0x00, 0x98, 0x00, 0xa6, 0xfe, 0x8c, 0x00, 0xdd, 0xff, 
-0x62, 0xfe, 0xfb, 0xff, 0xd1, 0x00, 0xce, 0xfe, 0xe8, 0xff, 0x61, 0x01, 0xeb, 0xfe, 0xef, 0xff, 
-0xa6, 0x00, 0x2e, 0x00, 0x95, 0xff, 0xb3, 0x00, 0xad, 0x00, 0x0f, 0x00, 0xe4, 0x00, 0xc5, 0x00, 
-0xa7, 0x01, 0x9d, 0xff, 0x95, 0x00, 0xad, 0x00, 0xa8, 0xff, 0x8b, 0xff, 0x64, 0xff, 0xc5, 0x00, 
-0x30, 0xff, 0x90, 0xff, 0xa0, 0x00, 0x8c, 0xff, 0x94, 0xff, 0xaf, 0x00, 0xfe, 0xff, 0x34, 0xff, 
-0x3e, 0x00, 0x6c, 0x00, 0x3b, 0x00, 0xd9, 0xfe, 0xc0, 0xff, 0x20, 0x00, 0x9e, 0xfe, 0x4b, 0xff, 
-0x90, 0x00, 0x35, 0xff, 0x5c, 0xfe, 0x67, 0x00, 0x83, 0xff, 0x86, 0xfe, 0x99, 0xff, 0xe4, 0xff, 
-0x4a, 0xff, 0x1a, 0x00, 0xbf, 0xff, 0x7a, 0xff, 0xfd, 0xff, 0xeb, 0xfe, 0x07, 0x00, 0x47, 0x00, 
-0xc3, 0xfe, 0x35, 0xff, 0x18, 0x00, 0xfa, 0xff, 0x45, 0xff, 0x87, 0xff, 0x57, 0x00, 0x4d, 0xff, 
-0xba, 0xff, 0x3c, 0x01, 0xd7, 0xff, 0x94, 0x00, 0x18, 0x00, 0x65, 0x00, 0x07, 0x01, 0x14, 0xff, 
-0xf7, 0x00, 0xc2, 0x00, 0xc1, 0xff, 0xd9, 0x00, 0x00, 0x01, 0x7f, 0x00, 0x00, 0x00, 0x2c, 0x01, 
-0x58, 0x00, 0xc2, 0xff, 0xfe, 0x00, 0x67, 0x00, 0x45, 0xff, 0xce, 0xff, 0x76, 0xff, 0x6c, 0xff, 
-0xf2, 0xff, 0xef, 0xff, 0x31, 0x00, 0xa6, 0x00, 0x65, 0x00, 0xf8, 0xff, 0xe4, 0x00, 0xcc, 0xff, 
-0xc4, 0xff, 0xf7, 0xff, 0x48, 0x00, 0x5f, 0x00, 0x58, 0xff, 0xff, 0xff, 0x20, 0x00, 0x60, 0xff, 
-0xd1, 0xff, 0xec, 0xff, 0xd0, 0xff, 0x03, 0xff, 0x96, 0xff, 0x34, 0x00, 0x32, 0xff, 0xc5, 0xff, 
-0xf1, 0xff, 0xc6, 0xff, 0x56, 0x00, 0x95, 0xff, 0x70, 0x00, 0xa2, 0x00, 0xf2, 0xff, 0xf8, 0xff, 
-0x5a, 0xff, 0xa6, 0x00, 0xd3, 0xff, 0x5a, 0x00, 0x4d, 0x00, 0x60, 0x00, 0xc5, 0x00, 0x9b, 0xff, 
-0x8f, 0x00, 0x72, 0x00, 0xd5, 0xff, 0x95, 0x00, 0x95, 0x00, 0xd2, 0xff, 0xe3, 0xff, 0x48, 0x00, 
-0xfb, 0xff, 0x8b, 0xff, 0xc3, 0x00, 0xef, 0xff, 0xf5, 0xff, 0x18, 0x00, 0x89, 0xff, 0x4b, 0x00, 
-0x4c, 0x00, 0x66, 0xff, 0x31, 0x00, 0x8e, 0x00, 0xf8, 0xfe, 0x97, 0xff, 0xa9, 0x00, 0xe6, 0xff, 
-0xcd, 0xff, 0x87, 0xff, 0x1a, 0x00, 0x48, 0x00, 0x28, 0xff, 0x38, 0x00, 0x4d, 0x00, 0x19, 0x00, 
-0x8d, 0xff, 0xf7, 0xff, 0xab, 0xff, 0x7a, 0xff, 0xbd, 0xff, 0xb7, 0xff, 0x2a, 0x00, 0x9a, 0xff, 
-0xd2, 0xff, 0xa4, 0x00, 0xe9, 0x00, 0xb9, 0xff, 0xa5, 0xff, 0x12, 0x01, 0xb5, 0xff, 0xb5, 0xff, 
-0x37, 0x01, 0x7c, 0x00, 0xbb, 0xff, 0xd6, 0xff, 0x61, 0x00, 0x68, 0x00, 0xda, 0xff, 0xa4, 0x00, 
-0xb5, 0x00, 0x14, 0x00, 0x0d, 0x00, 0x71, 0x00, 0xcc, 0x00, 0xc9, 0xff, 0xed, 0xff, 0xa7, 0x00, 
-0xfb, 0xff, 0x8f, 0xff, 0x24, 0x00, 0xb3, 0x00, 0x59, 0x00, 0x36, 0xff, 0xd8, 0xff, 0x30, 0x00, 
-0xa8, 0xff, 0xf4, 0xff, 0x5a, 0x00, 0x7a, 0x00, 0x47, 0xff, 0xbc, 0xff, 0x65, 0x00, 0xfb, 0xff, 
-0x70, 0xff, 0xe0, 0xff, 0x18, 0x00, 0x5d, 0xff, 0x88, 0xff, 0x99, 0x00, 0x1b, 0x00, 0xb4, 0xff, 
-0xda, 0xff, 0x95, 0x00, 0xfe, 0xff, 0x40, 0xff, 0x8f, 0x00, 0xf2, 0xff, 0xc8, 0xff, 0x68, 0xff, 
-0xbf, 0x00, 0x41, 0x00, 0x8b, 0xff, 0x78, 0x00, 0xb5, 0xff, 0x14, 0x00, 0x31, 0x00, 0x7b, 0xff, 
-0x63, 0x00, 0xc3, 0xff, 0x38, 0x00, 0x8e, 0x00, 0x57, 0x00, 0x6b, 0x00, 0x49, 0xff, 0x6a, 0x00, 
-0x4b, 0x00, 0xd0, 0xff, 0xea, 0xff, 0x39, 0x00, 0x0e, 0x01, 0x0a, 0x00, 0xd7, 0xff, 0x27, 0x00, 
-0x8c, 0x00, 0x93, 0xff, 0x16, 0x00, 0x59, 0x00, 0x63, 0xff, 0xf7, 0xff, 0x6e, 0x00, 0x26, 0x00, 
-0xe8, 0xff, 0x3d, 0xff, 0xb9, 0xff, 0x18, 0x01, 0x94, 0xff, 0x02, 0x00, 0x01, 0x00, 0x0b, 0x00, 
-0xb8, 0xff, 0xd2, 0xff, 0x4f, 0x00, 0x3c, 0x00, 0x39, 0x00, 0x35, 0x00, 0xc1, 0xff, 0xac, 0xff, 
-0x0a, 0x00, 0x3d, 0x00, 0x95, 0x00, 0x33, 0xff, 0xe8, 0xff, 0x1b, 0x00, 0x70, 0xff, 0xbd, 0xff, 
-0x4a, 0x00, 0x31, 0x00, 0x75, 0xff, 0x2a, 0x00, 0x15, 0x00, 0xa5, 0x00, 0x3b, 0x00, 0x1a, 0x00, 
-0xcb, 0xff, 0xd1, 0xff, 0xba, 0xff, 0xc9, 0xff, 0x5a, 0x00, 0xdf, 0xff, 0xce, 0xff, 0x23, 0x00, 
-0xa3, 0xff, 0xa9, 0xff, 0x95, 0x00, 0x0b, 0x00, 0x19, 0x00, 0x94, 0xff, 0x25, 0x01, 0x58, 0x00, 
-0x9d, 0xff, 0x0d, 0x00, 0x47, 0x00, 0x75, 0xff, 0xb8, 0xff, 0xb2, 0x00, 0x84, 0xff, 0x2b, 0x00, 
-0x86, 0x00, 0xb0, 0xff, 0xb2, 0xff, 0xe9, 0xff, 0x0f, 0x00, 0x6d, 0x00, 0xd6, 0xff, 0xad, 0xff, 
-0xad, 0xff, 0x26, 0x00, 0x01, 0x00, 0xdd, 0xff, 0x4c, 0x00, 0x7b, 0x00, 0x98, 0xff, 0xc1, 0xff, 
-0x62, 0x00, 0xc1, 0xff, 0xdc, 0xff, 0xdb, 0x00, 0xc9, 0xff, 0xe2, 0xff, 0x16, 0xff, 0x63, 0x00, 
-0xd2, 0xff, 0x07, 0xff, 0x83, 0x00, 0x1f, 0x00, 0xf7, 0xff, 0xbc, 0xff, 0xcb, 0xff, 0x81, 0xff, 
-0xa8, 0xff, 0x29, 0x00, 0xda, 0x00, 0x32, 0xff, 0x5b, 0x00, 0x12, 0x00, 0xa5, 0xff, 0x9b, 0xff, 
-0x07, 0x00, 0x0f, 0x01, 0x1e, 0xff, 0xc7, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xc2, 0x00, 0xe5, 0xff, 
-0x14, 0x00, 0xca, 0xff, 0xdb, 0xfe, 0x40, 0x00, 0x1a, 0x00, 0xef, 0xff, 0xf2, 0xff, 0x8b, 0xff, 
-0x9b, 0x00, 0x9c, 0xff, 0xaf, 0xff, 0x45, 0x00, 0x78, 0x00, 0x03, 0x00, 0xea, 0xff, 0xb2, 0xff, 
-0x2a, 0x00, 0xf0, 0xff, 0x97, 0xff, 0x52, 0x00, 0xe8, 0xff, 0xb8, 0xff, 0xad, 0xff, 0x01, 0x01, 
-0x6f, 0xff, 0x67, 0xff, 0x32, 0x00, 0xe2, 0xff, 0x69, 0x00, 0x9e, 0x00, 0x83, 0xff, 0x10, 0x00, 
-0x51, 0xff, 0x8c, 0xff, 0x2d, 0x00, 0x96, 0xff, 0xb2, 0x00, 0x74, 0xff, 0x6a, 0xff, 0x6e, 0x00, 
-0x01, 0x00, 0x7c, 0xff, 0x0c, 0x00, 0x42, 0x00, 0xbf, 0xfe, 0x81, 0xff, 0x11, 0x01, 0x12, 0x00, 
-0x46, 0x00, 0x6b, 0x00, 0xf5, 0xff, 0x1f, 0x00, 0x44, 0x00, 0x93, 0xff, 0xbb, 0xff, 0xec, 0xff, 
-0x1b, 0x00, 0xb6, 0xff, 0x3d, 0x00, 0x28, 0x00, 0x9a, 0xff, 0xd9, 0xff, 0x93, 0xff, 0xe6, 0xff, 
-0x37, 0x00, 0xec, 0xff, 0xef, 0xff, 0x04, 0x00, 0x7c, 0xff, 0x7c, 0x00, 0x83, 0x00, 0xc9, 0xff, 
-0x08, 0x00, 0x6e, 0x00, 0x34, 0x00, 0x7f, 0x00, 0x9c, 0xff, 0x50, 0x00, 0xe0, 0xff, 0xbc, 0xfe, 
-0x61, 0x00, 0xff, 0xff, 0x4f, 0x00, 0x5f, 0xff, 0x1f, 0x00, 0xe0, 0xff, 0x8e, 0xff, 0xa5, 0x00, 
-0x62, 0xff, 0xb7, 0x00, 0xcc, 0xff, 0xbc, 0xff, 0xdf, 0x00, 0x16, 0x00, 0x0a, 0x00, 0xc5, 0xff, 
-0x47, 0xff, 0xc6, 0xff, 0x7a, 0x00, 0xea, 0xff, 0xd9, 0x00, 0x93, 0xff, 0xb5, 0xff, 0x1b, 0x00, 
-0x8a, 0x00, 0x88, 0xff, 0x36, 0x00, 0xde, 0x00, 0xba, 0xfe, 0xef, 0xff, 0xd5, 0xff, 0x54, 0x00, 
-0x8b, 0xff, 0x0d, 0x00, 0x54, 0x00, 0x49, 0xff, 0x8c, 0xff, 0xf4, 0x00, 0x4a, 0x00, 0x9b, 0xff, 
-0x6a, 0x00, 0x70, 0xff, 0xd2, 0xff, 0xb6, 0xff, 0x8d, 0x00, 0x3f, 0x00, 0x88, 0xff, 0xe6, 0xff, 
-0x11, 0x00, 0x46, 0x00, 0xd8, 0xff, 0xfc, 0xff, 0xc1, 0xff, 0x24, 0x01, 0x29, 0x00, 0x8a, 0xff, 
-0x7c, 0x00, 0x0f, 0xff, 0xa6, 0xff, 0xad, 0x00, 0x7c, 0x00, 0xfb, 0xff, 0x00, 0x00, 0x98, 0xff, 
-0xa8, 0xff, 0xef, 0xff, 0xe6, 0xff, 0x46, 0x00, 0xa1, 0x00, 0x4a, 0x00, 0xf3, 0xff, 0x7d, 0xff, 
-0x07, 0x01, 0x94, 0x00, 0xd8, 0xff, 0x2e, 0x00, 0x17, 0xff, 0x61, 0xff, 0x77, 0x00, 0x8d, 0x00, 
-0xaf, 0xff, 0xac, 0x00, 0x28, 0xff, 0x5d, 0x00, 0x29, 0x00, 0x1a, 0xff, 0xb3, 0x00, 0xbb, 0xff, 
-0x9c, 0x00, 0xb1, 0x00, 0x4d, 0xff, 0x3f, 0x00, 0x85, 0xff, 0xe2, 0xff, 0x3f, 0x00, 0xad, 0xff, 
-0x81, 0x00, 0xa7, 0xff, 0x1d, 0x00, 0x70, 0x00, 0x98, 0xff, 0x8a, 0x00, 0xec, 0xff, 0xc2, 0xff, 
-0x1d, 0x00, 0x4c, 0x00, 0x3f, 0x00, 0x4c, 0xff, 0x67, 0x00, 0x9e, 0xff, 0xc9, 0xfe, 0x27, 0x00, 
-0x2e, 0x00, 0xb7, 0xff, 0x1f, 0x00, 0xa8, 0x00, 0x45, 0x00, 0x08, 0x00, 0xc7, 0x00, 0x38, 0xff, 
-0x8a, 0xff, 0x32, 0x00, 0x11, 0xff, 0xaf, 0x00, 0x62, 0x00, 0x6d, 0xff, 0x41, 0x00, 0xb1, 0xff, 
-0xb4, 0xff, 0xe6, 0xff, 0x03, 0x00, 0x40, 0x00, 0x54, 0x00, 0x77, 0x00, 0xfd, 0xff, 0x21, 0x00, 
-0xcf, 0xff, 0xfe, 0xff, 0x8c, 0x00, 0x70, 0x00, 0xa1, 0x00, 0x5d, 0xff, 0xe3, 0xff, 0xfb, 0xff, 
-0x70, 0xff, 0xe2, 0x00, 0x6f, 0xff, 0x6d, 0x00, 0xb9, 0x00, 0x7c, 0xff, 0x64, 0x00, 0x50, 0x00, 
-0x55, 0x00, 0xc1, 0xff, 0x6b, 0x00, 0x79, 0x00, 0xe1, 0x00, 0xa0, 0xff, 0x8e, 0x00, 0xea, 0xff, 
-0x13, 0xff, 0x16, 0x01, 0x85, 0xff, 0x59, 0x00, 0xfd, 0xff, 0x4e, 0x00, 0x4e, 0x00, 0xfb, 0xff, 
-0xe2, 0xff, 0xca, 0xff, 0xe0, 0xff, 0x95, 0xff, 0x4a, 0x00, 0xf5, 0xff, 0x3b, 0x00, 0xdd, 0xff, 
-0xfa, 0xff, 0xf5, 0xff, 0x83, 0xff, 0xb8, 0xff, 0x2c, 0x00, 0x43, 0x00, 0x57, 0x00, 0x92, 0x00, 
-0xd5, 0xff, 0xe7, 0xff, 0x70, 0xff, 0x5e, 0x00, 0xee, 0xfe, 0x30, 0xff, 0x3b, 0x00, 0xe4, 0xfe, 
-0x7d, 0x00, 0x93, 0x00, 0x13, 0x00, 0xa0, 0x00, 0x1c, 0x00, 0xcf, 0xff, 0x66, 0x00, 0xb7, 0xff, 
-0x91, 0x00, 0x30, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x7a, 0x00, 0x1c, 0x00, 0x90, 0xff, 0x18, 0x00, 
-0xa4, 0xff, 0xec, 0xff, 0x4e, 0x00, 0x57, 0xff, 0x9b, 0x00, 0x4f, 0x00, 0x9e, 0xff, 0x4a, 0x00, 
-0x79, 0xff, 0xc0, 0x00, 0x9c, 0xff, 0xf4, 0xff, 0xd3, 0x00, 0x20, 0x00, 0x02, 0x00, 0xa3, 0xff, 
-0x4b, 0x00, 0xa8, 0xff, 0xad, 0x00, 0xa7, 0x00, 0x06, 0xff, 0x0b, 0x00, 0xf2, 0xff, 0x36, 0x00, 
-0x0a, 0x00, 0xf5, 0xff, 0x40, 0x00, 0x75, 0xff, 0xe0, 0xff, 0xe7, 0xff, 0x72, 0x00, 0xf7, 0xff, 
-0xbe, 0xff, 0xb1, 0x00, 0xdd, 0xff, 0x1c, 0x00, 0x0c, 0x00, 0x26, 0x00, 0xe6, 0xff, 0xe1, 0xff, 
-0xc8, 0xff, 0x75, 0xff, 0x5c, 0x00, 0xdb, 0xff, 0x26, 0x00, 0xec, 0xff, 0x36, 0x00, 0x11, 0x00, 
-0x28, 0x00, 0x7b, 0x00, 0x58, 0xff, 0xc5, 0xff, 0x2d, 0x00, 0x7a, 0xff, 0xea, 0xff, 0x64, 0x00, 
-0xa9, 0xff, 0xb7, 0x00, 0xc3, 0xff, 0xd5, 0xff, 0x22, 0x00, 0x25, 0xff, 0x8b, 0x00, 0x74, 0x00, 
-0xc8, 0xff, 0x94, 0x00, 0x27, 0x00, 0x78, 0xff, 0xf6, 0xff, 0x01, 0x00, 0xa8, 0xff, 0xb6, 0xff, 
-0x0c, 0x00, 0xc5, 0xff, 0x00, 0x00, 0x55, 0x00, 0xc0, 0xff, 0xc2, 0xff, 0x2c, 0x00, 0x44, 0x00, 
-0x42, 0x00, 0x89, 0xff, 0x32, 0x00, 0x8d, 0x00, 0x7d, 0xff, 0xb8, 0xff, 0x30, 0x00, 0xc2, 0xff, 
-0xcf, 0xff, 0x03, 0x00, 0xba, 0xff, 0x36, 0x00, 0xc9, 0xff, 0xfe, 0xff, 0x1f, 0x00, 0x13, 0x00, 
-0x57, 0x00, 0x9a, 0xff, 0x05, 0x00, 0xfc, 0xff, 0xde, 0xff, 0xe3, 0xff, 0x7d, 0xff, 0x04, 0x00, 
-0xef, 0xff, 0xb7, 0xff, 0xec, 0xff, 0x32, 0x00, 0x0d, 0x00, 0x82, 0xff, 0xea, 0xff, 0xc9, 0x00, 
-0x62, 0x00, 0x7e, 0xff, 0xc7, 0xff, 0x55, 0x00, 0xbd, 0xff, 0x6c, 0xff, 0x89, 0x00, 0x04, 0x00, 
-0xfe, 0xff, 0x8d, 0xff, 0xa2, 0xff, 0x57, 0x00, 0x8f, 0xff, 0xca, 0xff, 0xcb, 0xff, 0x43, 0x00, 
-0x42, 0x00, 0xd0, 0xff, 0x6a, 0x00, 0x07, 0x00, 0x66, 0xff, 0xc9, 0xff, 0xf1, 0xff, 0x6d, 0x00, 
-0x3c, 0x00, 0x3b, 0xff, 0x7b, 0xff, 0x53, 0x00, 0xb0, 0xff, 0x46, 0x00, 0x03, 0x00, 0x48, 0xff, 
-0x74, 0x00, 0xac, 0xff, 0x23, 0x00, 0xa6, 0x00, 0x37, 0x00, 0x2d, 0x00, 0x1a, 0x00, 0x11, 0x00, 
-0xff, 0xff, 0x1f, 0x00, 0x7c, 0x00, 0x9a, 0x00, 0x42, 0x00, 0x53, 0x00, 0xff, 0xff, 0xf7, 0xff, 
-0x1d, 0x00, 0xff, 0xff, 0x1d, 0x00, 0xf4, 0xfe, 0xf1, 0xfe, 0x98, 0xff, 0x2d, 0xff, 0xbe, 0xff, 
-0x6c, 0xff, 0x5d, 0xff, 0x23, 0x00, 0x3a, 0x00, 0x58, 0x00, 0x3b, 0x00, 0xfb, 0xff, 0xaf, 0xff, 
-0xd1, 0xff, 0xbf, 0xff, 0xf1, 0xff, 0xa5, 0xff, 0x49, 0xff, 0x69, 0xff, 0x26, 0xff, 0x6f, 0xff, 
-0xa9, 0xff, 0x54, 0xff, 0x41, 0xff, 0x7b, 0xff, 0x62, 0xff, 0x70, 0xff, 0xf4, 0xff, 0xfd, 0xff, 
-0xa8, 0xff, 0xd4, 0xff, 0xd5, 0xff, 0xe0, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xb3, 0xff, 0xd6, 0xff, 
-0x69, 0x00, 0x6e, 0x00, 0x7f, 0xff, 0x1c, 0x00, 0x4c, 0x00, 0x7a, 0xff, 0x99, 0xff, 0x2c, 0x00, 
-0xc1, 0x00, 0xcd, 0xff, 0x5e, 0xff, 0x83, 0x00, 0x3e, 0x00, 0xcd, 0xff, 0x82, 0x00, 0xb7, 0x00, 
-0xb4, 0x00, 0x3b, 0x00, 0x57, 0x00, 0x6e, 0x01, 0x15, 0x01, 0x94, 0x00, 0xa8, 0x00, 0xb2, 0x00, 
-0x4b, 0x00, 0xad, 0xff, 0xad, 0x00, 0x44, 0x00, 0x47, 0xff, 0xa2, 0xff, 0x82, 0xff, 0x60, 0xff, 
-0x59, 0xff, 0x74, 0xff, 0x53, 0xff, 0xfc, 0xfe, 0xf4, 0xff, 0x3b, 0x00, 0x2a, 0x00, 0x7b, 0x00, 
-0x5f, 0x00, 0xfd, 0xff, 0xfe, 0xff, 0x43, 0x00, 0x08, 0x00, 0xe4, 0xff, 0xd2, 0xff, 0x5c, 0xff, 
-0x50, 0xff, 0xca, 0xff, 0x57, 0xff, 0x54, 0xff, 0x43, 0xff, 0x53, 0xff, 0xdd, 0xff, 0xe0, 0xff, 
-0x50, 0x00, 0xd1, 0x00, 0x0d, 0x01, 0x78, 0x01, 0x86, 0x01, 0x74, 0x01, 0x37, 0x01, 0x06, 0x01, 
-0x0c, 0x01, 0x16, 0x01, 0x39, 0x01, 0xc0, 0x00, 0x94, 0xff, 0xee, 0xfe, 0x7b, 0xfe, 0xf6, 0xfd, 
-0xd2, 0xfd, 0xfc, 0xfd, 0x70, 0xfe, 0xc2, 0xfe, 0x25, 0xff, 0x7d, 0xff, 0xc8, 0xff, 0x2b, 0x00, 
-0xdf, 0xff, 0x24, 0x00, 0xc0, 0x00, 0x96, 0x00, 0x67, 0x00, 0x33, 0x00, 0x22, 0x00, 0x94, 0xff, 
-0x4a, 0xff, 0x4c, 0xff, 0xf9, 0xfe, 0x06, 0xff, 0xe5, 0xfe, 0xe9, 0xfe, 0x42, 0xff, 0x80, 0xff, 
-0xbc, 0xff, 0x18, 0x00, 0x6c, 0x00, 0x28, 0x00, 0x63, 0x00, 0x99, 0x00, 0x70, 0x00, 0xa7, 0x00, 
-0xb4, 0x00, 0xcd, 0x00, 0xa7, 0x00, 0x6d, 0x00, 0xb8, 0x00, 0x40, 0x00, 0xec, 0xff, 0x12, 0x00, 
-0xee, 0xff, 0xef, 0xff, 0xf3, 0xff, 0x12, 0x00, 0x13, 0x00, 0x32, 0x00, 0x5b, 0x00, 0x71, 0x00, 
-0x79, 0x00, 0x91, 0x00, 0x89, 0x00, 0x86, 0x00, 0x99, 0x00, 0xa0, 0x00, 0x9a, 0x00, 0x70, 0x00, 
-0x56, 0x00, 0x37, 0x00, 0xee, 0xff, 0xd0, 0xff, 0xfd, 0xff, 0xe5, 0xff, 0xd8, 0xff, 0x2d, 0x00, 
-0x1a, 0x00, 0x02, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x70, 0x00, 0x66, 0x00, 0x8c, 0x00, 0xa1, 0x00, 
-0x5b, 0x00, 0x9f, 0x00, 0x76, 0x00, 0x51, 0x00, 0x72, 0x00, 0x1e, 0x00, 0xf2, 0xff, 0xd5, 0xff, 
-0xbb, 0xff, 0xb1, 0xff, 0xb4, 0xff, 0xde, 0xff, 0xee, 0xff, 0xe2, 0xff, 0x02, 0x00, 0xf6, 0xff, 
-0x1d, 0x00, 0x36, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x31, 0x00, 0x18, 0x00, 0xfb, 0xff, 0x0f, 0x00, 
-0x04, 0x00, 0xed, 0xff, 0xfe, 0xff, 0xf5, 0xff, 0xcc, 0xff, 0xc2, 0xff, 0xb7, 0xff, 0xb8, 0xff, 
-0xba, 0xff, 0xe1, 0xff, 0xeb, 0xff, 0xd9, 0xff, 0xf0, 0xff, 0x11, 0x00, 0x13, 0x00, 0x12, 0x00, 
-0x16, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0xf7, 0xff, 
-0xfc, 0xff, 0x02, 0x00, 0x03, 0x00, 0xfd, 0xff, 0xf4, 0xff, 0x0b, 0x00, 0xfe, 0xff, 0x01, 0x00, 
-0x0c, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x13, 0x00, 
-0x0a, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xf9, 0xff, 0x01, 0x00, 0xfa, 0xff, 0xf1, 0xff, 
-0x04, 0x00, 0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf2, 0xff, 0xf5, 0xff, 
-0xf4, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0x07, 0x00, 0xf7, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xf9, 0xff, 0x02, 0x00, 0x0b, 0x00, 0xfd, 0xff, 0xfb, 0xff, 0x05, 0x00, 0xfe, 0xff, 0xfd, 0xff, 
-0x08, 0x00, 0x01, 0x00, 0xf3, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xfc, 0xff, 
-0xfd, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x0a, 0x00, 
-0x0f, 0x00, 0xff, 0xff, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x06, 0x00, 0x12, 0x00, 0x0c, 0x00, 
-0x08, 0x00, 0x12, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x03, 0x00, 
-0x0a, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 
-0xfe, 0xff, 0x05, 0x00, 0x09, 0x00, 0x01, 0x00, 0xfc, 0xff, 0x05, 0x00, 0x05, 0x00, 0xfa, 0xff, 
-0x00, 0x00, 0xfa, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf7, 0xff, 
-};
-
@@ -1,1311 +0,0 @@
-#include <stdio.h>
-const unsigned char me_17_degrees[] = {
-0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 
-0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xfb, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x04, 0x00, 
-0x03, 0x00, 0xff, 0xff, 0x04, 0x00, 0x07, 0x00, 0x02, 0x00, 0x09, 0x00, 0x07, 0x00, 0xfa, 0xff, 
-0xfb, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x03, 0x00, 0xfe, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x04, 0x00, 
-0xfe, 0xff, 0x02, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xf3, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xf2, 0xff, 
-0x01, 0x00, 0xf4, 0xff, 0xfa, 0xff, 0x12, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x1f, 0x00, 0x0a, 0x00, 
-0xfc, 0xff, 0xdd, 0xff, 0x0f, 0x00, 0xfa, 0xff, 0x08, 0x00, 0x59, 0x00, 0x0c, 0x00, 0xe2, 0xff, 
-0xec, 0xff, 0x0e, 0x00, 0x14, 0x00, 0x17, 0x00, 0x26, 0x00, 0x6c, 0x00, 0x1b, 0x00, 0xff, 0xff, 
-0x5a, 0x00, 0x14, 0x00, 0xf2, 0xff, 0xfb, 0xff, 0x4a, 0x00, 0xc1, 0xff, 0xb1, 0xff, 0x3b, 0x00, 
-0xef, 0xff, 0x10, 0x00, 0xfa, 0xff, 0x22, 0x00, 0xe3, 0xff, 0x04, 0x00, 0x41, 0x00, 0xb2, 0xff, 
-0xb1, 0xff, 0x42, 0x00, 0xe7, 0xff, 0xc8, 0xff, 0x38, 0x00, 0xe3, 0xff, 0xc4, 0xff, 0x30, 0x00, 
-0x79, 0x00, 0xbc, 0xff, 0xbe, 0xff, 0xef, 0xff, 0x20, 0xff, 0x36, 0x00, 0x6c, 0x00, 0xa2, 0xff, 
-0xca, 0x00, 0x0d, 0x00, 0xaf, 0xff, 0x65, 0x00, 0x75, 0xff, 0xc7, 0xff, 0x19, 0x00, 0xa0, 0xff, 
-0x4c, 0x00, 0xf8, 0xff, 0x16, 0x00, 0xfe, 0xff, 0xd2, 0xff, 0x21, 0x00, 0xde, 0xff, 0x09, 0x00, 
-0x0f, 0x00, 0x87, 0xff, 0x50, 0x00, 0xdd, 0xff, 0x40, 0xff, 0x4a, 0x00, 0xaa, 0xff, 0xb3, 0xff, 
-0xe6, 0xff, 0xd0, 0xff, 0x02, 0x00, 0x07, 0x00, 0x49, 0x00, 0x28, 0x00, 0x1f, 0x00, 0x46, 0x00, 
-0x32, 0xff, 0xca, 0xff, 0x0d, 0x00, 0xa4, 0xff, 0x23, 0x00, 0xef, 0xff, 0xae, 0xff, 0xd9, 0xff, 
-0xfa, 0xff, 0x26, 0x00, 0x55, 0x00, 0x1c, 0x00, 0x28, 0x00, 0x26, 0x00, 0x0f, 0x00, 0x49, 0xff, 
-0x3d, 0x00, 0x8c, 0x00, 0x9f, 0xff, 0x79, 0x00, 0xc7, 0x00, 0xaa, 0xff, 0x22, 0x00, 0x16, 0x00, 
-0x8b, 0xff, 0x27, 0x00, 0x97, 0x00, 0x9f, 0xff, 0x22, 0x00, 0x4d, 0x00, 0xc5, 0xfe, 0xd6, 0x00, 
-0xc1, 0xff, 0xf0, 0xff, 0xef, 0x00, 0x52, 0xff, 0xf4, 0xff, 0x88, 0x00, 0x42, 0xff, 0xec, 0xff, 
-0x39, 0x00, 0x5f, 0xff, 0x2c, 0x00, 0xab, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x0d, 0x00, 
-0xc8, 0xff, 0x3e, 0x00, 0x45, 0xff, 0xe9, 0xff, 0xad, 0xff, 0x6a, 0xff, 0xad, 0xff, 0x89, 0xff, 
-0x97, 0x00, 0x10, 0x00, 0xd4, 0xff, 0x3a, 0x00, 0x87, 0xff, 0xef, 0xff, 0x1f, 0x00, 0x17, 0xff, 
-0x82, 0x00, 0x00, 0xff, 0xb2, 0xff, 0xaa, 0x00, 0xfd, 0xfe, 0xcd, 0x00, 0x9b, 0xff, 0x56, 0x00, 
-0x55, 0x00, 0x1c, 0xff, 0x39, 0x00, 0x4f, 0xff, 0xf5, 0xff, 0x7c, 0x00, 0x90, 0xff, 0xfd, 0xff, 
-0xc7, 0xff, 0xa7, 0xff, 0x69, 0x00, 0xf1, 0xff, 0xbf, 0xff, 0xd3, 0xff, 0x13, 0x00, 0x6a, 0xff, 
-0x6a, 0x00, 0xd9, 0xff, 0x42, 0xff, 0x33, 0x00, 0x7a, 0xff, 0xeb, 0xff, 0x5c, 0x00, 0xd5, 0xff, 
-0xe0, 0x00, 0xa5, 0xff, 0x6e, 0x00, 0x8f, 0x00, 0xae, 0xff, 0x9c, 0x00, 0x9b, 0xfe, 0x67, 0x00, 
-0x65, 0x00, 0x44, 0xff, 0x0d, 0x00, 0xc0, 0xff, 0xe3, 0xff, 0x7d, 0x00, 0x19, 0x00, 0xa2, 0xff, 
-0xd3, 0xff, 0xa4, 0xff, 0xb0, 0xff, 0x5d, 0x00, 0x8b, 0x00, 0x4b, 0x00, 0x2d, 0x00, 0x14, 0x00, 
-0xb6, 0xff, 0x17, 0x00, 0x43, 0x00, 0x18, 0xff, 0x4e, 0x00, 0x24, 0x00, 0xa2, 0xff, 0xa1, 0xff, 
-0x75, 0x00, 0x41, 0x00, 0x5c, 0x00, 0xb7, 0x00, 0x0d, 0xff, 0x55, 0x01, 0xef, 0xff, 0x23, 0xff, 
-0xd1, 0x00, 0x9d, 0xff, 0xcf, 0xff, 0xd1, 0x00, 0xa9, 0xff, 0x4d, 0x00, 0x0b, 0x00, 0x65, 0xff, 
-0xe1, 0x00, 0xc7, 0xff, 0xaf, 0xff, 0x1a, 0x00, 0x2a, 0x00, 0x17, 0x00, 0x44, 0xff, 0xf5, 0xff, 
-0x50, 0x00, 0x42, 0x00, 0xb4, 0xff, 0xcb, 0xff, 0xad, 0x00, 0x7c, 0xff, 0x17, 0x00, 0x85, 0xff, 
-0x4f, 0xff, 0x45, 0x00, 0x06, 0x00, 0x14, 0x00, 0x6c, 0x00, 0x95, 0xff, 0xe9, 0xff, 0xa1, 0x00, 
-0xb5, 0xff, 0x15, 0x00, 0x25, 0x00, 0x43, 0xff, 0x23, 0x00, 0xda, 0xff, 0x4a, 0x00, 0xa4, 0x00, 
-0x2d, 0xff, 0x38, 0x00, 0x6a, 0xff, 0x48, 0x00, 0x2f, 0x00, 0x9b, 0xff, 0xa7, 0x00, 0x29, 0x00, 
-0x2f, 0x00, 0x86, 0x00, 0x5f, 0xff, 0x4c, 0xff, 0x4f, 0x00, 0xa2, 0xff, 0x65, 0x00, 0x26, 0x00, 
-0xf6, 0xff, 0x1d, 0x00, 0x23, 0x00, 0xf7, 0xff, 0x17, 0x00, 0x77, 0x00, 0xf3, 0xfe, 0x14, 0x00, 
-0x59, 0x00, 0xa2, 0xff, 0xbe, 0xff, 0x45, 0x00, 0x56, 0x00, 0x7b, 0xff, 0xa5, 0xff, 0xfb, 0xff, 
-0x92, 0xff, 0x2e, 0x00, 0x67, 0xff, 0xc2, 0xff, 0xf7, 0x00, 0xde, 0xff, 0xb9, 0xff, 0x05, 0x00, 
-0xec, 0xff, 0x17, 0x00, 0xa4, 0x00, 0xce, 0xff, 0x84, 0xff, 0x88, 0x00, 0x2d, 0x00, 0x97, 0xff, 
-0xef, 0xff, 0xa0, 0xff, 0x89, 0x00, 0x86, 0x00, 0x0b, 0x00, 0x4e, 0x00, 0x92, 0xff, 0xfc, 0xff, 
-0x5b, 0x00, 0x22, 0x00, 0xc3, 0xff, 0x20, 0x00, 0xac, 0x00, 0xa1, 0xff, 0x45, 0x00, 0x5b, 0xff, 
-0xfe, 0xff, 0x9e, 0x00, 0x77, 0xff, 0x9f, 0x00, 0xe4, 0xff, 0xdb, 0xff, 0xc5, 0x00, 0xda, 0xff, 
-0x5c, 0x00, 0x9d, 0xff, 0x4c, 0xff, 0xa4, 0x00, 0x73, 0x00, 0xd2, 0xff, 0xf9, 0xff, 0x24, 0x00, 
-0x4c, 0xff, 0x1e, 0x01, 0xc2, 0xff, 0xa3, 0xff, 0x3e, 0x00, 0x1c, 0x00, 0x23, 0x00, 0xc7, 0xff, 
-0x84, 0x00, 0x50, 0x00, 0x92, 0xff, 0x40, 0x00, 0xe7, 0xff, 0x65, 0x00, 0xe1, 0x00, 0x3f, 0xff, 
-0x82, 0x00, 0xae, 0xff, 0x12, 0x00, 0x9c, 0xff, 0x6b, 0xff, 0x29, 0x00, 0xeb, 0xff, 0xc0, 0x00, 
-0x9e, 0x00, 0xc9, 0xff, 0x0e, 0x00, 0x11, 0x00, 0x50, 0x00, 0x52, 0x00, 0xda, 0xff, 0x60, 0x00, 
-0x6b, 0xff, 0x26, 0x00, 0x1a, 0xff, 0xb7, 0xff, 0xb8, 0x00, 0x37, 0x00, 0x48, 0x00, 0x7b, 0xff, 
-0x9e, 0x00, 0x11, 0x00, 0x4b, 0x00, 0x91, 0x00, 0xfd, 0xff, 0xac, 0xff, 0xd3, 0xff, 0x51, 0x00, 
-0x95, 0xff, 0x34, 0xff, 0xf0, 0xff, 0x89, 0xff, 0x4a, 0x01, 0x69, 0x00, 0xc5, 0xff, 0x6a, 0x00, 
-0x89, 0xff, 0x2c, 0x00, 0x2a, 0x00, 0xc4, 0x00, 0x9b, 0xff, 0x66, 0x00, 0xe9, 0xff, 0x88, 0xff, 
-0x23, 0x00, 0xa6, 0xff, 0xf6, 0xff, 0xa5, 0xff, 0xca, 0x00, 0xdc, 0xff, 0xed, 0xff, 0xca, 0x00, 
-0xb7, 0xff, 0xdb, 0xff, 0x44, 0x01, 0xa7, 0x00, 0x63, 0xff, 0x75, 0xff, 0xc9, 0xff, 0x23, 0x00, 
-0xd6, 0xff, 0x20, 0x00, 0x39, 0x00, 0x56, 0x00, 0x03, 0x00, 0xa8, 0xff, 0x0e, 0x00, 0xe9, 0xff, 
-0x9f, 0xff, 0x2b, 0x00, 0x2f, 0x00, 0x34, 0x00, 0x4a, 0x00, 0x19, 0x00, 0xb0, 0xff, 0x2d, 0x00, 
-0x67, 0xff, 0x35, 0x00, 0x8a, 0x00, 0x50, 0x00, 0x0e, 0x00, 0xd0, 0xfe, 0x28, 0x00, 0x4f, 0xff, 
-0xfd, 0xff, 0x58, 0x00, 0x80, 0xff, 0x5d, 0x00, 0x4c, 0x00, 0x66, 0x00, 0xae, 0xff, 0xd9, 0xff, 
-0x4d, 0x00, 0x7a, 0xff, 0xeb, 0xff, 0x8a, 0xff, 0x02, 0x00, 0x11, 0x00, 0xb4, 0xff, 0x9e, 0x00, 
-0x43, 0xff, 0xdd, 0xff, 0xa3, 0x00, 0xb4, 0xff, 0xf0, 0x00, 0x82, 0xff, 0x06, 0x00, 0x0c, 0x00, 
-0x15, 0xff, 0x1c, 0x01, 0x42, 0xff, 0xce, 0xff, 0x1e, 0x00, 0xa6, 0xff, 0x0a, 0x00, 0x9b, 0xff, 
-0x24, 0x00, 0xc8, 0xff, 0xb6, 0x00, 0xd6, 0xff, 0xd9, 0xff, 0xee, 0x00, 0xa4, 0xff, 0x6a, 0x00, 
-0xcc, 0xff, 0xa9, 0xff, 0x5e, 0xff, 0x08, 0x00, 0x69, 0x00, 0xa2, 0xff, 0xb0, 0x00, 0x22, 0x00, 
-0xc4, 0xff, 0x9a, 0xff, 0x40, 0x00, 0xee, 0xff, 0x74, 0xff, 0xff, 0xff, 0x6c, 0x00, 0x46, 0x00, 
-0xf7, 0xff, 0xa2, 0xff, 0x7f, 0x00, 0x44, 0x00, 0xbf, 0xff, 0x27, 0x00, 0xe0, 0xff, 0x64, 0xff, 
-0x7b, 0xff, 0x03, 0x00, 0x8d, 0xff, 0xc8, 0xff, 0x7e, 0x00, 0x3f, 0x00, 0xdb, 0xff, 0x53, 0x00, 
-0x66, 0x00, 0x76, 0xff, 0x35, 0xff, 0x50, 0x00, 0x21, 0x00, 0x1f, 0xff, 0xbb, 0x00, 0xd9, 0xff, 
-0x32, 0xff, 0xa0, 0x00, 0xa6, 0xff, 0xae, 0xff, 0x99, 0x00, 0x3a, 0x00, 0xa2, 0xff, 0xec, 0x00, 
-0x55, 0xff, 0x70, 0xff, 0x55, 0x00, 0x8b, 0xff, 0x3a, 0x00, 0x69, 0xff, 0x91, 0xff, 0x97, 0x00, 
-0x74, 0xff, 0x18, 0x00, 0x6e, 0x00, 0x12, 0xff, 0x80, 0x00, 0x72, 0xff, 0xf9, 0xff, 0x73, 0x00, 
-0x28, 0x00, 0x68, 0x00, 0xbe, 0xff, 0xd6, 0xff, 0x93, 0xff, 0x96, 0xff, 0xa3, 0xff, 0xc3, 0xff, 
-0x76, 0x00, 0x61, 0x00, 0xfb, 0xff, 0x6d, 0x00, 0x30, 0x00, 0xc9, 0xff, 0x62, 0xff, 0x5f, 0x00, 
-0x74, 0xff, 0x33, 0x00, 0x99, 0x00, 0x03, 0x00, 0x12, 0x00, 0x7a, 0xff, 0xc1, 0xff, 0x1a, 0xff, 
-0x03, 0x00, 0xc8, 0xff, 0x64, 0x00, 0x3a, 0x00, 0x5c, 0x00, 0x67, 0x00, 0x20, 0xff, 0xdb, 0xff, 
-0x2f, 0x00, 0x3f, 0x00, 0x2e, 0xff, 0x5e, 0x00, 0xac, 0xff, 0x3c, 0xff, 0x73, 0x00, 0x2b, 0xff, 
-0x7a, 0x00, 0x2c, 0x00, 0x3f, 0xff, 0x23, 0x00, 0x40, 0x00, 0xcb, 0xff, 0x1e, 0x00, 0xda, 0xff, 
-0x78, 0x00, 0x93, 0xff, 0xeb, 0xff, 0xd6, 0x00, 0xf5, 0xff, 0x1f, 0x00, 0xb3, 0xff, 0xf8, 0xff, 
-0x48, 0xff, 0x29, 0xff, 0xb2, 0xff, 0xd8, 0xff, 0x92, 0xff, 0x13, 0x00, 0xb3, 0x00, 0x5f, 0x00, 
-0x3a, 0x00, 0xbe, 0x00, 0x31, 0x00, 0xd2, 0xff, 0x94, 0xff, 0xe4, 0x00, 0x33, 0x00, 0x78, 0xff, 
-0x9c, 0x00, 0xe5, 0xfe, 0x7f, 0xff, 0xad, 0xff, 0x9c, 0xff, 0x1b, 0x00, 0x14, 0x01, 0x3c, 0x00, 
-0x7b, 0x00, 0x07, 0x00, 0x66, 0xff, 0x18, 0x01, 0x87, 0xff, 0x0c, 0x00, 0xfb, 0xff, 0x9f, 0xff, 
-0xef, 0xff, 0x88, 0x00, 0x35, 0xff, 0xa5, 0xff, 0x2c, 0x00, 0x5f, 0xff, 0xd5, 0x00, 0x68, 0x00, 
-0xcd, 0xff, 0x5d, 0x00, 0xe0, 0x00, 0xde, 0xff, 0xe3, 0xff, 0x93, 0xff, 0x71, 0x00, 0xe2, 0xfe, 
-0x93, 0xff, 0x74, 0x00, 0x6c, 0xff, 0x17, 0x01, 0xae, 0xff, 0x8f, 0x00, 0xac, 0x00, 0xf7, 0xfe, 
-0x6f, 0x00, 0x32, 0x00, 0xf5, 0xff, 0xda, 0xfe, 0xd9, 0xff, 0xfb, 0xff, 0x51, 0xff, 0x15, 0x01, 
-0x75, 0xff, 0xe9, 0x00, 0x61, 0x00, 0x3e, 0xff, 0x4b, 0x00, 0x62, 0x00, 0xd7, 0xff, 0xa0, 0x00, 
-0x8a, 0x00, 0x38, 0xff, 0x69, 0x00, 0xdf, 0xff, 0x89, 0x00, 0x81, 0xff, 0x5b, 0xff, 0xf7, 0x00, 
-0x9a, 0xff, 0xcb, 0x00, 0xfa, 0xff, 0x50, 0xfe, 0xa7, 0x00, 0x6b, 0x00, 0xb1, 0xff, 0x0d, 0x00, 
-0x72, 0xff, 0x13, 0x00, 0x0e, 0x00, 0xe9, 0xff, 0x47, 0x00, 0xdc, 0xff, 0x24, 0x00, 0xe6, 0x00, 
-0x40, 0x00, 0x6e, 0xff, 0x9e, 0xff, 0x69, 0x00, 0xb3, 0xff, 0x52, 0x00, 0x95, 0x00, 0x3a, 0x00, 
-0xa7, 0xff, 0xeb, 0xff, 0x54, 0x00, 0x3a, 0xff, 0x96, 0xff, 0x4a, 0x00, 0x80, 0x00, 0x15, 0x00, 
-0xe5, 0xff, 0xc8, 0x00, 0xee, 0xff, 0x02, 0xff, 0x5e, 0x00, 0xae, 0xff, 0x81, 0x00, 0xbc, 0x00, 
-0xec, 0xff, 0x36, 0x00, 0xf1, 0xff, 0x3e, 0x00, 0xe7, 0x00, 0x98, 0xff, 0xe2, 0xff, 0xeb, 0xff, 
-0x84, 0xff, 0x73, 0x00, 0xd6, 0xff, 0x72, 0x01, 0x5d, 0xff, 0xa1, 0x00, 0x82, 0x00, 0xf0, 0xfd, 
-0x6f, 0x01, 0xf3, 0xff, 0x04, 0x00, 0x22, 0x01, 0xe3, 0xfe, 0xc2, 0x00, 0x0a, 0xff, 0xea, 0xfe, 
-0x6b, 0x00, 0x0c, 0x00, 0xd7, 0x00, 0x54, 0x00, 0x6a, 0x01, 0x4a, 0xff, 0x97, 0xff, 0x9c, 0x00, 
-0x80, 0xff, 0xe7, 0xff, 0xb1, 0xff, 0xd2, 0x00, 0xaa, 0xfe, 0x02, 0x00, 0xba, 0x00, 0x3c, 0xff, 
-0x0d, 0x00, 0x5b, 0x00, 0xbe, 0x00, 0x6e, 0x00, 0x69, 0x00, 0xcb, 0xff, 0x24, 0x00, 0x44, 0xff, 
-0x48, 0x01, 0x3c, 0xff, 0x15, 0xff, 0xa8, 0x00, 0x82, 0xff, 0x3f, 0x00, 0x86, 0x00, 0x6d, 0xff, 
-0xde, 0xff, 0xaa, 0x00, 0x2b, 0xff, 0x2b, 0x00, 0xf7, 0x00, 0xe8, 0xff, 0x9c, 0x00, 0x50, 0x00, 
-0x55, 0xff, 0x2b, 0x00, 0x46, 0xff, 0xd7, 0xff, 0x88, 0x00, 0xd6, 0xff, 0x67, 0x00, 0xa3, 0xff, 
-0x03, 0x00, 0x18, 0x00, 0x97, 0x00, 0x15, 0x01, 0x11, 0xff, 0x25, 0x00, 0xdf, 0xff, 0x48, 0xff, 
-0x7e, 0xff, 0x1e, 0x00, 0x24, 0x00, 0x3f, 0x01, 0x5d, 0xff, 0x8c, 0x00, 0xc7, 0x00, 0x42, 0xfe, 
-0x8d, 0x00, 0x93, 0xfe, 0x9d, 0x00, 0x72, 0x00, 0xff, 0x00, 0x12, 0x00, 0xce, 0xfe, 0xf1, 0x00, 
-0xd0, 0xfe, 0xfc, 0xff, 0x1d, 0x01, 0x01, 0x00, 0x2f, 0x01, 0x68, 0x01, 0x8d, 0xff, 0xeb, 0xfe, 
-0x85, 0xff, 0x2f, 0x00, 0x68, 0xff, 0x3d, 0x00, 0xa6, 0x00, 0x6e, 0xff, 0xec, 0xff, 0xa6, 0xff, 
-0xd1, 0xff, 0xf3, 0x00, 0x94, 0xff, 0xdb, 0xff, 0x34, 0x01, 0x3f, 0x00, 0xcd, 0xff, 0x32, 0xff, 
-0x60, 0x00, 0xe5, 0xff, 0x5d, 0xfe, 0xbc, 0x01, 0xc3, 0xff, 0xcb, 0xff, 0x4e, 0x00, 0x01, 0x00, 
-0xc6, 0xff, 0x49, 0xff, 0xae, 0x00, 0x26, 0x00, 0x9f, 0x00, 0x06, 0xff, 0xe8, 0xff, 0xa4, 0x00, 
-0x36, 0xfe, 0x4d, 0x00, 0xb1, 0x00, 0x8a, 0xff, 0x60, 0x00, 0x9b, 0x00, 0x80, 0xff, 0xc4, 0xff, 
-0x57, 0x00, 0xc4, 0xff, 0x80, 0x00, 0x22, 0x00, 0xa6, 0x00, 0xb3, 0xff, 0x3a, 0x00, 0xd6, 0xff, 
-0x26, 0xff, 0xb0, 0x00, 0x36, 0x00, 0x2e, 0xff, 0xd3, 0x00, 0xc6, 0xff, 0x7e, 0xff, 0xb9, 0x00, 
-0x61, 0xff, 0x21, 0x00, 0x1c, 0x00, 0x51, 0x00, 0x13, 0x00, 0x87, 0xff, 0x04, 0x00, 0x2d, 0xff, 
-0x9d, 0xff, 0x9a, 0x00, 0x4f, 0xff, 0xdd, 0x00, 0xf4, 0xff, 0x7d, 0xff, 0xf4, 0xff, 0xa5, 0xff, 
-0xfb, 0x00, 0xaf, 0xff, 0x6c, 0x00, 0xa9, 0x00, 0x87, 0x00, 0x2d, 0x00, 0x7a, 0xfe, 0xf3, 0xff, 
-0xe5, 0xff, 0x98, 0xff, 0x79, 0x00, 0xb4, 0xff, 0x2e, 0x00, 0xc0, 0xff, 0x49, 0x00, 0xbe, 0xff, 
-0x37, 0xff, 0x7e, 0x00, 0xa4, 0x00, 0xab, 0xff, 0x0c, 0x00, 0x1e, 0x00, 0x71, 0xff, 0x9d, 0x00, 
-0xb4, 0xff, 0xef, 0x00, 0x5d, 0xff, 0x34, 0xff, 0xe0, 0x00, 0x7c, 0xfe, 0x52, 0x00, 0x06, 0x00, 
-0x7c, 0x00, 0x1e, 0x00, 0xef, 0xfe, 0xc1, 0x00, 0x1b, 0x00, 0x89, 0xff, 0x24, 0x00, 0xf8, 0xff, 
-0x13, 0x00, 0xdb, 0xff, 0x54, 0x00, 0x27, 0x01, 0x02, 0xff, 0x64, 0xff, 0x2b, 0xff, 0x2d, 0x00, 
-0x38, 0x00, 0x22, 0xfe, 0xf6, 0x00, 0xf5, 0x00, 0x6a, 0x00, 0x98, 0x00, 0x38, 0xff, 0x7a, 0x00, 
-0x3d, 0x00, 0xdd, 0x00, 0x90, 0x01, 0x99, 0xff, 0x1b, 0xff, 0xc8, 0xff, 0xcb, 0xff, 0xb3, 0x00, 
-0x17, 0x00, 0x85, 0x00, 0xd6, 0x00, 0x93, 0xff, 0x19, 0x00, 0x9d, 0xff, 0x64, 0x01, 0x44, 0x00, 
-0x6f, 0xfe, 0x67, 0xff, 0x48, 0xff, 0xf5, 0xff, 0x77, 0xff, 0xc5, 0xfe, 0xf6, 0xfe, 0x9d, 0xfe, 
-0xed, 0xff, 0xa3, 0x00, 0x9c, 0x00, 0xa0, 0x00, 0xb2, 0xff, 0x99, 0xff, 0xc8, 0x00, 0x05, 0x00, 
-0x15, 0xff, 0xee, 0x00, 0x46, 0x00, 0x64, 0xff, 0x8d, 0x00, 0x45, 0xff, 0x4f, 0xff, 0x6b, 0xfe, 
-0x55, 0x00, 0x1f, 0x01, 0x7c, 0x00, 0x24, 0x02, 0x51, 0x00, 0x2a, 0x01, 0xc5, 0x02, 0x48, 0x00, 
-0xef, 0xfd, 0xf9, 0xff, 0xf5, 0xff, 0x8b, 0xfe, 0x8e, 0xfe, 0x77, 0x00, 0x08, 0xff, 0x13, 0xfe, 
-0xe4, 0xff, 0xed, 0x00, 0x1d, 0x00, 0x5b, 0xfe, 0xfc, 0x00, 0xd9, 0x00, 0xb5, 0xff, 0x4c, 0xff, 
-0x8b, 0xff, 0xf1, 0x01, 0x38, 0xff, 0x71, 0x00, 0x5f, 0x01, 0x84, 0x00, 0xca, 0x01, 0x37, 0x00, 
-0x54, 0x02, 0xe9, 0xfe, 0x12, 0xfe, 0x0a, 0x01, 0x8f, 0x00, 0x27, 0x00, 0x6d, 0xfd, 0x62, 0xff, 
-0xa4, 0x00, 0x62, 0xfe, 0xc6, 0x00, 0x4f, 0x01, 0xc7, 0x00, 0xd2, 0x00, 0x2d, 0x00, 0x12, 0x01, 
-0xd0, 0xfe, 0x79, 0xff, 0xcf, 0xff, 0x87, 0xff, 0x5a, 0xff, 0xae, 0xfd, 0x9f, 0xff, 0x19, 0xff, 
-0xda, 0xfe, 0xdf, 0xff, 0xfd, 0x00, 0x94, 0x00, 0xc7, 0xfd, 0x07, 0xff, 0x60, 0x00, 0x22, 0xff, 
-0x03, 0x00, 0x81, 0x00, 0xb9, 0x00, 0xeb, 0xff, 0x5d, 0x00, 0xa5, 0xff, 0x58, 0xff, 0xec, 0x00, 
-0xe1, 0xff, 0xcf, 0x00, 0x08, 0x01, 0x9d, 0x00, 0xe9, 0xff, 0xe2, 0xff, 0xf0, 0xff, 0x35, 0xff, 
-0x4e, 0xff, 0xe2, 0xff, 0x38, 0x00, 0x4b, 0xff, 0x1e, 0x01, 0x67, 0x01, 0xb3, 0x00, 0x23, 0x01, 
-0x53, 0xff, 0x8e, 0x00, 0xbc, 0xff, 0x12, 0x00, 0x42, 0x02, 0x63, 0x00, 0x35, 0xff, 0xc0, 0xfe, 
-0x6b, 0xfe, 0xfd, 0xfe, 0x6e, 0xfe, 0xe5, 0xff, 0xe7, 0x00, 0x04, 0x00, 0x38, 0x02, 0xdd, 0x01, 
-0xda, 0x00, 0x67, 0x00, 0x17, 0x00, 0x7e, 0x01, 0x8f, 0x00, 0x55, 0x01, 0xc2, 0x01, 0x98, 0x01, 
-0xfc, 0x01, 0x5a, 0x01, 0xd8, 0x01, 0xa1, 0x01, 0x4c, 0x02, 0xe7, 0x01, 0x1a, 0x02, 0xb5, 0x01, 
-0x85, 0xff, 0x6f, 0xff, 0xce, 0xfd, 0xa0, 0xfd, 0x5d, 0xfd, 0x65, 0xfa, 0xec, 0xf9, 0x17, 0xf7, 
-0x80, 0xf6, 0x8a, 0xf4, 0x6e, 0xf0, 0xb9, 0xf1, 0xee, 0xf0, 0x3c, 0xf4, 0x70, 0xfb, 0x31, 0xfe, 
-0xaf, 0x00, 0xb7, 0x06, 0x74, 0x0d, 0x5e, 0x11, 0xb0, 0x13, 0x54, 0x16, 0x71, 0x15, 0x04, 0x12, 
-0x8e, 0x10, 0xcc, 0x0d, 0xa9, 0x09, 0x99, 0x07, 0x43, 0x06, 0x57, 0x03, 0x05, 0x01, 0x5c, 0xff, 
-0xde, 0xfd, 0x52, 0xfc, 0xba, 0xfa, 0x9b, 0xf7, 0xa3, 0xf8, 0x9e, 0xf5, 0x19, 0xec, 0x78, 0xe6, 
-0x76, 0xe1, 0xe4, 0xde, 0xe0, 0xdc, 0x97, 0xe4, 0x76, 0xf1, 0x30, 0xf6, 0xdf, 0x00, 0x23, 0x0d, 
-0x4a, 0x15, 0xde, 0x1c, 0xe2, 0x1c, 0x3e, 0x1c, 0x5b, 0x19, 0x6c, 0x11, 0xa4, 0x08, 0xad, 0x01, 
-0x9d, 0xfd, 0x26, 0xf8, 0xf8, 0xf5, 0x6d, 0xfc, 0x47, 0x01, 0x71, 0x05, 0x0d, 0x0d, 0x60, 0x12, 
-0x28, 0x14, 0xf8, 0x13, 0x85, 0x12, 0xd3, 0x0d, 0x1a, 0x06, 0x55, 0xfd, 0x99, 0xf7, 0x1d, 0xf1, 
-0x01, 0xec, 0xf4, 0xe5, 0xc6, 0xe1, 0x32, 0xdf, 0x41, 0xd7, 0x87, 0xd5, 0xf4, 0xdc, 0xb6, 0xeb, 
-0x06, 0xfa, 0x8b, 0x04, 0x71, 0x11, 0xb4, 0x1c, 0xa7, 0x21, 0x48, 0x20, 0x91, 0x19, 0xff, 0x12, 
-0x7d, 0x0a, 0xbc, 0xff, 0xbc, 0xf7, 0x47, 0xf3, 0x04, 0xf3, 0x40, 0xf5, 0xcd, 0xf9, 0xdb, 0x01, 
-0x32, 0x0d, 0x6c, 0x15, 0x4f, 0x1a, 0xcc, 0x1c, 0xf8, 0x19, 0x68, 0x14, 0x02, 0x0d, 0x11, 0x05, 
-0xf7, 0xfd, 0x3e, 0xf8, 0x35, 0xf7, 0x89, 0xf3, 0xa3, 0xf0, 0x85, 0xf0, 0x1e, 0xed, 0xc5, 0xe8, 
-0xf4, 0xdd, 0xab, 0xd5, 0x68, 0xda, 0x75, 0xe6, 0x5b, 0xf5, 0xf2, 0x01, 0x2b, 0x0e, 0x65, 0x18, 
-0x06, 0x1b, 0xae, 0x1b, 0x3e, 0x16, 0x48, 0x0d, 0xc4, 0x05, 0x32, 0xfd, 0x9a, 0xf6, 0x2e, 0xf3, 
-0xcb, 0xf1, 0x85, 0xf4, 0x83, 0xfd, 0x49, 0x07, 0x47, 0x0f, 0xed, 0x17, 0x90, 0x1f, 0x62, 0x1d, 
-0xd6, 0x14, 0x3d, 0x10, 0x24, 0x0a, 0x83, 0x00, 0x7a, 0xfb, 0x57, 0xfa, 0xf8, 0xfb, 0xbf, 0xfa, 
-0x7f, 0xf7, 0xd7, 0xf9, 0x10, 0xf5, 0x70, 0xef, 0xe8, 0xe9, 0xf9, 0xde, 0x95, 0xd5, 0x4d, 0xd4, 
-0xe6, 0xe6, 0xd4, 0xf8, 0xb2, 0x00, 0x18, 0x11, 0xec, 0x1d, 0x4c, 0x21, 0xdf, 0x1c, 0x9a, 0x11, 
-0x11, 0x0b, 0x51, 0x00, 0xc4, 0xf5, 0x5a, 0xf2, 0xf5, 0xf0, 0xb4, 0xf5, 0x18, 0xfb, 0x83, 0x04, 
-0x70, 0x10, 0xd6, 0x14, 0xac, 0x16, 0xf5, 0x15, 0x9a, 0x12, 0x50, 0x0a, 0xad, 0x04, 0xc3, 0x02, 
-0x90, 0xfe, 0x1d, 0x00, 0x32, 0x02, 0x78, 0x02, 0xe5, 0x02, 0xf1, 0xfd, 0x54, 0xfb, 0xe3, 0xfa, 
-0x8a, 0xf1, 0xf8, 0xea, 0x02, 0xe5, 0x0b, 0xdb, 0xb8, 0xce, 0x97, 0xd3, 0x2f, 0xf6, 0x79, 0x05, 
-0x5a, 0x0a, 0x7a, 0x1d, 0xa1, 0x28, 0xe7, 0x20, 0x77, 0x0e, 0xaf, 0x05, 0xc7, 0xfe, 0xfa, 0xf1, 
-0x38, 0xed, 0x40, 0xf3, 0x9c, 0xfc, 0xbd, 0xff, 0xe1, 0x05, 0x43, 0x14, 0x44, 0x15, 0x50, 0x0f, 
-0x26, 0x0e, 0x47, 0x0d, 0x90, 0x06, 0x0b, 0xfb, 0x5d, 0xff, 0x8e, 0x04, 0x3f, 0x01, 0x1d, 0x05, 
-0xfa, 0x08, 0xbd, 0x09, 0x76, 0x04, 0xfd, 0xfb, 0xe5, 0xf7, 0xc6, 0xf5, 0xba, 0xee, 0xc9, 0xec, 
-0x1c, 0xe8, 0x42, 0xdc, 0x05, 0xd4, 0xc7, 0xda, 0xb0, 0xff, 0x9d, 0x0e, 0x20, 0x0c, 0xe5, 0x1d, 
-0x5d, 0x24, 0xb3, 0x16, 0x70, 0x02, 0x73, 0xfd, 0xca, 0xfc, 0x6f, 0xf0, 0xf9, 0xef, 0xb4, 0xf9, 
-0x47, 0x03, 0x50, 0x07, 0xf1, 0x08, 0xc8, 0x14, 0x71, 0x14, 0xe6, 0x09, 0x63, 0x06, 0x33, 0x05, 
-0x9b, 0x00, 0x3f, 0xfa, 0x04, 0x03, 0x23, 0x0a, 0xef, 0x06, 0xdf, 0x0b, 0xaf, 0x0e, 0xc6, 0x08, 
-0x73, 0xfe, 0x32, 0xf8, 0x8c, 0xf4, 0x79, 0xf0, 0x9b, 0xef, 0xec, 0xf1, 0x4c, 0xf1, 0x95, 0xe4, 
-0xe4, 0xd8, 0x3c, 0xda, 0x6e, 0xf7, 0x47, 0x0c, 0x69, 0x09, 0x14, 0x15, 0xe4, 0x1c, 0x77, 0x12, 
-0xc1, 0x02, 0x5a, 0xfd, 0x9c, 0xfd, 0x85, 0xf3, 0x70, 0xf2, 0x24, 0xfc, 0x95, 0x03, 0x24, 0x09, 
-0x87, 0x08, 0x18, 0x10, 0x4a, 0x15, 0xf6, 0x0a, 0xc4, 0x04, 0x4d, 0x03, 0x5d, 0xff, 0xfe, 0xfc, 
-0x57, 0x04, 0x65, 0x0b, 0xe5, 0x0a, 0x5b, 0x0a, 0x35, 0x0b, 0x4a, 0x06, 0x97, 0xfd, 0xd8, 0xfa, 
-0x39, 0xf7, 0x9a, 0xf5, 0xcb, 0xf6, 0xc8, 0xf4, 0x18, 0xf5, 0x58, 0xea, 0x4b, 0xdb, 0xcd, 0xd8, 
-0xa6, 0xe5, 0xf1, 0x00, 0x6d, 0x0b, 0x2d, 0x0f, 0x91, 0x19, 0x86, 0x18, 0x64, 0x0f, 0xe7, 0x01, 
-0xa2, 0xfb, 0x2f, 0xf7, 0x9e, 0xf0, 0x00, 0xf6, 0x4a, 0xfe, 0x9a, 0x06, 0x9e, 0x0b, 0xed, 0x0e, 
-0x12, 0x16, 0xab, 0x10, 0x10, 0x05, 0x21, 0xff, 0xf0, 0xfb, 0x8e, 0xfc, 0x03, 0xfe, 0xde, 0x04, 
-0x27, 0x0e, 0x9a, 0x0e, 0x51, 0x09, 0x53, 0x07, 0x55, 0x03, 0xcc, 0xfb, 0x58, 0xf9, 0x61, 0xf8, 
-0xf1, 0xf9, 0x2c, 0xfa, 0x2a, 0xf6, 0x1c, 0xf3, 0xb8, 0xe6, 0xb6, 0xdc, 0xb7, 0xdb, 0x42, 0xe8, 
-0x9f, 0x01, 0xed, 0x09, 0x60, 0x12, 0xa8, 0x1c, 0xd9, 0x16, 0xcc, 0x0b, 0x2c, 0x00, 0xef, 0xfb, 
-0x0e, 0xf8, 0xb6, 0xf2, 0xde, 0xf8, 0xb4, 0x02, 0x41, 0x09, 0xc2, 0x0b, 0x7e, 0x0e, 0xf7, 0x11, 
-0x94, 0x0b, 0x4e, 0x02, 0x04, 0xff, 0x90, 0xfc, 0x66, 0xfb, 0x6c, 0x00, 0x15, 0x09, 0xff, 0x0d, 
-0x6b, 0x0e, 0x51, 0x0b, 0xf6, 0x06, 0xc9, 0xff, 0xd3, 0xf8, 0xde, 0xf8, 0xd6, 0xf7, 0x04, 0xf9, 
-0x85, 0xfb, 0x64, 0xf6, 0xc5, 0xf1, 0xa8, 0xe5, 0x04, 0xd9, 0xf4, 0xdb, 0x46, 0xeb, 0x8b, 0x03, 
-0xd9, 0x0e, 0xf5, 0x12, 0x52, 0x19, 0x68, 0x14, 0x68, 0x0b, 0x36, 0x02, 0x06, 0xfc, 0xc5, 0xf7, 
-0x2f, 0xf3, 0xfe, 0xf8, 0xf2, 0x02, 0x55, 0x07, 0xbb, 0x0a, 0x8a, 0x0f, 0x1f, 0x10, 0x21, 0x0a, 
-0x8b, 0x03, 0x15, 0x00, 0x43, 0xfe, 0x86, 0xfd, 0x74, 0x00, 0x5f, 0x07, 0x6e, 0x0b, 0xd6, 0x09, 
-0xa7, 0x0a, 0x8a, 0x09, 0x98, 0x03, 0x4c, 0x00, 0x4c, 0xfd, 0xb3, 0xf9, 0x5c, 0xf6, 0xa7, 0xf3, 
-0x34, 0xf1, 0xfd, 0xea, 0xfe, 0xe1, 0x94, 0xdb, 0xbb, 0xdd, 0x9e, 0xf0, 0x4f, 0x05, 0x8a, 0x0d, 
-0x62, 0x13, 0xa6, 0x1b, 0x7c, 0x1a, 0xc1, 0x0b, 0xe1, 0x00, 0xcc, 0xfe, 0x5f, 0xf8, 0x94, 0xf1, 
-0x1c, 0xf7, 0xc2, 0x01, 0xa2, 0x06, 0x17, 0x09, 0x62, 0x10, 0xde, 0x10, 0x0b, 0x0b, 0xa1, 0x03, 
-0x6c, 0xff, 0x66, 0xfe, 0x5a, 0xfb, 0x7d, 0xfe, 0x24, 0x06, 0x8e, 0x0b, 0x3e, 0x09, 0xb3, 0x08, 
-0x20, 0x0a, 0xbc, 0x05, 0xe1, 0xfe, 0xeb, 0xfa, 0x83, 0xfa, 0xfa, 0xf7, 0x17, 0xf5, 0x3b, 0xf6, 
-0x3a, 0xf3, 0x95, 0xea, 0x76, 0xe1, 0x8e, 0xda, 0xae, 0xe3, 0x5e, 0xf6, 0x90, 0x05, 0xb6, 0x0f, 
-0x0f, 0x16, 0x70, 0x1a, 0x53, 0x14, 0x76, 0x08, 0x0c, 0x00, 0x94, 0xfb, 0x5d, 0xf8, 0x93, 0xf6, 
-0x55, 0xfa, 0x11, 0x00, 0x00, 0x07, 0xc5, 0x0c, 0x7f, 0x0d, 0xc5, 0x0d, 0xff, 0x09, 0x57, 0x04, 
-0x1a, 0x02, 0x01, 0xfd, 0xce, 0x00, 0x43, 0x03, 0x67, 0x05, 0xd3, 0x0a, 0xa5, 0x07, 0x1c, 0x0b, 
-0x30, 0x07, 0xe9, 0x00, 0xd2, 0xfe, 0xc0, 0xf9, 0x8f, 0xfb, 0xeb, 0xf8, 0x83, 0xf6, 0xc5, 0xf8, 
-0xc0, 0xf0, 0x3c, 0xe8, 0xa0, 0xde, 0x6d, 0xda, 0x09, 0xe8, 0xab, 0xf8, 0xae, 0x09, 0xc9, 0x12, 
-0x9b, 0x16, 0xf6, 0x19, 0xed, 0x10, 0x43, 0x03, 0xce, 0xfb, 0x24, 0xf8, 0x3c, 0xf6, 0xfa, 0xf5, 
-0xc4, 0xfb, 0x2b, 0x05, 0xf4, 0x08, 0x55, 0x0b, 0x38, 0x0f, 0xe8, 0x0e, 0xdc, 0x07, 0x68, 0x02, 
-0x46, 0x01, 0x70, 0x00, 0x3d, 0x01, 0x34, 0x02, 0xce, 0x08, 0x4c, 0x0c, 0x0f, 0x09, 0x14, 0x09, 
-0xe2, 0x04, 0xef, 0xff, 0x48, 0xfb, 0xa6, 0xf9, 0xe8, 0xfb, 0xa6, 0xfa, 0x12, 0xf9, 0xb3, 0xf6, 
-0xe6, 0xef, 0xa6, 0xe7, 0x9e, 0xdf, 0x82, 0xdd, 0x39, 0xe8, 0x22, 0xfc, 0x4d, 0x0b, 0xa7, 0x10, 
-0x36, 0x15, 0xca, 0x16, 0x60, 0x0f, 0x6d, 0x01, 0xec, 0xfa, 0x5c, 0xfa, 0x8a, 0xf7, 0xcd, 0xf7, 
-0x4f, 0xfe, 0x6b, 0x06, 0x39, 0x0a, 0x0f, 0x0b, 0xb9, 0x0c, 0x88, 0x0c, 0x55, 0x08, 0xcf, 0x03, 
-0x66, 0x01, 0x3a, 0x02, 0x9a, 0x02, 0xee, 0x04, 0xaf, 0x08, 0x75, 0x09, 0x3a, 0x08, 0x37, 0x07, 
-0x9f, 0x02, 0xe0, 0xfd, 0x4e, 0xfc, 0x02, 0xfd, 0x55, 0xfd, 0x4b, 0xfa, 0x0d, 0xf9, 0x2f, 0xf5, 
-0x9b, 0xec, 0x37, 0xe3, 0x54, 0xdc, 0x0d, 0xdb, 0x4b, 0xea, 0x84, 0xfe, 0x9b, 0x0b, 0x9a, 0x14, 
-0x57, 0x17, 0x14, 0x18, 0x6b, 0x0f, 0x91, 0x01, 0x04, 0xfb, 0x08, 0xf7, 0xdc, 0xf5, 0x45, 0xfa, 
-0x21, 0xfe, 0xe8, 0x07, 0x64, 0x0e, 0xf1, 0x0c, 0xc2, 0x0d, 0x60, 0x0a, 0xf4, 0x06, 0x3d, 0x02, 
-0x51, 0xfd, 0x77, 0x00, 0x9a, 0x03, 0x5e, 0x06, 0xbb, 0x0a, 0xf1, 0x0a, 0x94, 0x0b, 0xcd, 0x06, 
-0xf1, 0xff, 0xef, 0xfd, 0xf4, 0xfa, 0x2f, 0xfb, 0x7f, 0xf9, 0x68, 0xf9, 0xfe, 0xf8, 0xec, 0xf1, 
-0x25, 0xeb, 0xfb, 0xe2, 0x72, 0xdb, 0x3b, 0xe0, 0xb2, 0xf1, 0xd5, 0x03, 0x87, 0x0f, 0x9a, 0x13, 
-0x84, 0x18, 0x58, 0x18, 0x90, 0x0a, 0xc1, 0xfd, 0x41, 0xf8, 0x25, 0xf7, 0xe6, 0xf7, 0x84, 0xf9, 
-0xb5, 0x01, 0x98, 0x0a, 0xc6, 0x0c, 0x83, 0x0d, 0xcb, 0x0c, 0xa6, 0x09, 0xad, 0x04, 0xe4, 0xfe, 
-0xaa, 0xfe, 0x50, 0x02, 0x36, 0x04, 0x04, 0x07, 0x2f, 0x09, 0x85, 0x0b, 0x52, 0x0a, 0x35, 0x03, 
-0xd9, 0xff, 0x55, 0xfd, 0xb9, 0xfb, 0x43, 0xfa, 0x86, 0xf8, 0x77, 0xf9, 0xfd, 0xf6, 0xec, 0xf0, 
-0xad, 0xe8, 0x9b, 0xe0, 0xd8, 0xdc, 0x54, 0xe5, 0x1d, 0xfa, 0x14, 0x09, 0x04, 0x0f, 0x4c, 0x13, 
-0x95, 0x18, 0x36, 0x15, 0xfe, 0x04, 0x62, 0xfb, 0x0a, 0xfa, 0xe3, 0xf8, 0x90, 0xf9, 0x8c, 0xfc, 
-0x72, 0x03, 0x1d, 0x09, 0x23, 0x0b, 0xf8, 0x0c, 0x43, 0x0b, 0x15, 0x08, 0xd9, 0x05, 0x6f, 0x01, 
-0xd9, 0x01, 0xff, 0x03, 0x62, 0x04, 0x73, 0x07, 0xcc, 0x06, 0x15, 0x08, 0xb6, 0x07, 0x8a, 0x01, 
-0xca, 0xff, 0x31, 0xfd, 0x08, 0xfc, 0x6d, 0xfc, 0x8e, 0xf9, 0xcc, 0xf8, 0x79, 0xf4, 0x7a, 0xec, 
-0x5a, 0xe7, 0x31, 0xe1, 0x8d, 0xde, 0xcc, 0xeb, 0x0c, 0xfe, 0x8a, 0x07, 0x7b, 0x0d, 0x79, 0x12, 
-0x26, 0x16, 0x99, 0x10, 0x1a, 0x03, 0x8d, 0xfe, 0x14, 0xfd, 0x1c, 0xfa, 0x3c, 0xfb, 0x3a, 0xfc, 
-0xe5, 0x01, 0xb1, 0x08, 0xe1, 0x09, 0xd8, 0x0a, 0xeb, 0x09, 0xaa, 0x09, 0xb4, 0x07, 0xde, 0x02, 
-0xc1, 0x02, 0xa3, 0x03, 0xa7, 0x05, 0x93, 0x06, 0xeb, 0x04, 0xb3, 0x07, 0x55, 0x06, 0x2e, 0x00, 
-0xac, 0xfd, 0x34, 0xfc, 0xfc, 0xfc, 0x1f, 0xfc, 0x28, 0xf8, 0x84, 0xf7, 0xff, 0xf4, 0xd1, 0xef, 
-0xdb, 0xeb, 0x85, 0xe5, 0x58, 0xe5, 0x9c, 0xf1, 0x0d, 0xfe, 0xcf, 0x03, 0x69, 0x07, 0x4b, 0x0c, 
-0x7e, 0x11, 0x56, 0x0f, 0x76, 0x06, 0xe2, 0x01, 0xf3, 0xff, 0xe6, 0xfd, 0x6a, 0xfc, 0x2b, 0xfb, 
-0xe9, 0x00, 0x55, 0x06, 0x20, 0x07, 0xfd, 0x07, 0xd6, 0x07, 0xa7, 0x08, 0x04, 0x07, 0xa0, 0x03, 
-0xde, 0x03, 0xda, 0x05, 0x9b, 0x05, 0xa5, 0x04, 0x6c, 0x05, 0x2e, 0x05, 0xcd, 0x02, 0x54, 0xff, 
-0xad, 0xfd, 0xc6, 0xfd, 0x18, 0xfd, 0xfc, 0xfa, 0xdc, 0xf9, 0x8d, 0xf9, 0xc4, 0xf5, 0x21, 0xf3, 
-0xd6, 0xef, 0x71, 0xeb, 0x1c, 0xee, 0xd2, 0xf3, 0xd4, 0xfa, 0xdc, 0xff, 0xcb, 0x01, 0xa3, 0x05, 
-0x06, 0x09, 0xb0, 0x09, 0x37, 0x07, 0x31, 0x04, 0xfb, 0x03, 0xbd, 0x03, 0x3b, 0x01, 0x95, 0x00, 
-0x66, 0x02, 0x75, 0x03, 0xf9, 0x03, 0x1b, 0x04, 0x3a, 0x04, 0xd8, 0x04, 0x74, 0x04, 0x31, 0x05, 
-0xf1, 0x06, 0x22, 0x06, 0x1f, 0x05, 0x69, 0x05, 0xc5, 0x02, 0xf6, 0x01, 0x83, 0x02, 0x31, 0x00, 
-0x27, 0x00, 0x20, 0xff, 0xa2, 0xfd, 0x3b, 0xfe, 0xaa, 0xfc, 0xef, 0xfa, 0x45, 0xf9, 0x9a, 0xf6, 
-0x45, 0xf5, 0x98, 0xf3, 0x7f, 0xf1, 0x31, 0xf2, 0xb4, 0xf5, 0xc2, 0xf9, 0x2a, 0xfd, 0x55, 0xff, 
-0x5b, 0x01, 0xc9, 0x04, 0xf3, 0x06, 0xd8, 0x06, 0x12, 0x06, 0x2b, 0x05, 0x2b, 0x05, 0xc0, 0x04, 
-0xa1, 0x02, 0x74, 0x02, 0x1d, 0x03, 0xa3, 0x02, 0x9c, 0x02, 0xac, 0x02, 0x19, 0x03, 0x88, 0x04, 
-0x7e, 0x04, 0x9b, 0x03, 0x16, 0x04, 0x43, 0x04, 0x3d, 0x04, 0x9b, 0x03, 0x15, 0x02, 0x78, 0x01, 
-0x72, 0x01, 0x48, 0x00, 0x66, 0xff, 0xcc, 0xfe, 0x95, 0xfe, 0x77, 0xfe, 0x1d, 0xfd, 0x51, 0xfb, 
-0x9b, 0xf8, 0x97, 0xf6, 0x68, 0xf6, 0xbf, 0xf4, 0x2c, 0xf3, 0xa4, 0xf4, 0x84, 0xf6, 0x9d, 0xfa, 
-0x54, 0xfe, 0x77, 0xfe, 0xb1, 0x00, 0x38, 0x04, 0xc5, 0x04, 0xec, 0x04, 0xa5, 0x04, 0x0d, 0x04, 
-0x33, 0x05, 0x33, 0x05, 0x0d, 0x04, 0xd1, 0x03, 0xa9, 0x03, 0xe8, 0x03, 0x0f, 0x05, 0x33, 0x04, 
-0x98, 0x03, 0x52, 0x04, 0xd6, 0x03, 0x6c, 0x03, 0x6d, 0x03, 0x59, 0x03, 0xef, 0x02, 0xc7, 0x01, 
-0x4e, 0x01, 0x83, 0x01, 0x8c, 0x00, 0x4b, 0x00, 0xf3, 0xff, 0x45, 0xff, 0xec, 0xfe, 0x58, 0xfd, 
-0x2b, 0xfc, 0x4c, 0xfb, 0xf7, 0xf8, 0xb6, 0xf7, 0x39, 0xf7, 0xbf, 0xf5, 0x64, 0xf5, 0x9d, 0xf6, 
-0xd2, 0xf8, 0xab, 0xfb, 0x1b, 0xfd, 0x2e, 0xfe, 0x88, 0x00, 0xf3, 0x02, 0xa0, 0x04, 0xb6, 0x04, 
-0x25, 0x04, 0x6f, 0x04, 0x29, 0x05, 0xc7, 0x04, 0xdd, 0x03, 0x66, 0x03, 0xa2, 0x03, 0x1b, 0x04, 
-0xe1, 0x03, 0x30, 0x03, 0xf9, 0x02, 0x4a, 0x03, 0x36, 0x03, 0x43, 0x02, 0x5f, 0x02, 0x1d, 0x03, 
-0x44, 0x02, 0xc1, 0x01, 0xf1, 0x01, 0x69, 0x01, 0x52, 0x01, 0x07, 0x01, 0xf7, 0xff, 0x9d, 0xff, 
-0xf9, 0xfe, 0xb1, 0xfd, 0x5e, 0xfc, 0x2f, 0xfb, 0xa0, 0xf9, 0x33, 0xf8, 0x46, 0xf8, 0x5f, 0xf7, 
-0x9d, 0xf6, 0x01, 0xf8, 0x04, 0xfa, 0x6c, 0xfb, 0xaa, 0xfc, 0xa5, 0xfd, 0x43, 0xff, 0x98, 0x01, 
-0xdd, 0x02, 0x4a, 0x03, 0x23, 0x04, 0x06, 0x05, 0x51, 0x05, 0x04, 0x05, 0x5f, 0x04, 0xa5, 0x04, 
-0xe0, 0x04, 0x19, 0x04, 0x0e, 0x04, 0x54, 0x04, 0xea, 0x03, 0x70, 0x03, 0xc8, 0x02, 0xc9, 0x02, 
-0xec, 0x02, 0xb9, 0x02, 0x24, 0x02, 0xe6, 0x01, 0xa5, 0x01, 0x12, 0x01, 0x5f, 0x00, 0xac, 0xff, 
-0x53, 0xff, 0x8d, 0xfe, 0x51, 0xfd, 0x7f, 0xfc, 0x89, 0xfb, 0x3b, 0xfa, 0xcc, 0xf8, 0xaa, 0xf7, 
-0xb1, 0xf7, 0xab, 0xf7, 0xf2, 0xf7, 0x26, 0xf8, 0xf4, 0xf8, 0x7d, 0xfa, 0xbb, 0xfb, 0x0e, 0xfe, 
-0x50, 0x00, 0xcf, 0x01, 0x41, 0x03, 0x8c, 0x04, 0x36, 0x05, 0xc4, 0x05, 0x22, 0x06, 0x8e, 0x06, 
-0xc8, 0x05, 0x49, 0x05, 0xb2, 0x05, 0xd9, 0x04, 0x9b, 0x04, 0x27, 0x04, 0x67, 0x03, 0x4a, 0x03, 
-0x26, 0x03, 0x40, 0x02, 0x85, 0x02, 0x4e, 0x02, 0x95, 0x01, 0x03, 0x02, 0xea, 0x00, 0xea, 0x00, 
-0xb1, 0x00, 0x28, 0xff, 0x86, 0xfe, 0xc6, 0xfd, 0x76, 0xfc, 0x81, 0xfb, 0x4c, 0xfa, 0x2b, 0xf8, 
-0xdd, 0xf6, 0xc3, 0xf6, 0x46, 0xf7, 0x01, 0xf7, 0x56, 0xf8, 0xf2, 0xf8, 0x70, 0xf9, 0xac, 0xfc, 
-0x8c, 0xfe, 0x16, 0x00, 0x04, 0x02, 0xf1, 0x03, 0xf7, 0x04, 0x6c, 0x05, 0x85, 0x06, 0x19, 0x07, 
-0xec, 0x06, 0x01, 0x06, 0x22, 0x06, 0xdb, 0x05, 0x3a, 0x05, 0xbf, 0x04, 0xb4, 0x03, 0x3d, 0x03, 
-0x1d, 0x03, 0x86, 0x02, 0x97, 0x02, 0x52, 0x02, 0xca, 0x00, 0x77, 0x01, 0xdb, 0x00, 0x4f, 0x00, 
-0xa2, 0x00, 0x5e, 0xff, 0x4e, 0xff, 0xc5, 0xfd, 0x6c, 0xfc, 0xc8, 0xfb, 0x22, 0xfa, 0x36, 0xf8, 
-0x22, 0xf7, 0x66, 0xf6, 0x66, 0xf6, 0xa6, 0xf7, 0x58, 0xf8, 0x06, 0xf9, 0x2d, 0xfa, 0x83, 0xfc, 
-0xa7, 0xfe, 0x14, 0x01, 0x8c, 0x02, 0x4c, 0x04, 0x2d, 0x06, 0xd1, 0x06, 0x4f, 0x07, 0x6b, 0x07, 
-0x20, 0x07, 0xfa, 0x06, 0x7f, 0x06, 0x99, 0x05, 0xc6, 0x04, 0x4e, 0x04, 0xbc, 0x03, 0x23, 0x03, 
-0xd8, 0x02, 0xba, 0x02, 0x4d, 0x02, 0xba, 0x01, 0xe0, 0x01, 0xeb, 0x00, 0xb2, 0x00, 0x3f, 0x00, 
-0x4c, 0xff, 0x40, 0xff, 0x90, 0xfe, 0xf1, 0xfc, 0xf0, 0xfa, 0xcc, 0xf9, 0x35, 0xf9, 0xdc, 0xf6, 
-0xa4, 0xf4, 0x4f, 0xf5, 0xc6, 0xf5, 0xde, 0xf6, 0x5e, 0xf8, 0xf1, 0xf8, 0xd9, 0xfa, 0x2a, 0xfe, 
-0xf7, 0x00, 0x6e, 0x02, 0x6f, 0x04, 0x4b, 0x06, 0xef, 0x07, 0x5a, 0x08, 0x12, 0x08, 0xf4, 0x08, 
-0x19, 0x08, 0xc8, 0x06, 0xeb, 0x06, 0x17, 0x05, 0xf3, 0x04, 0x0f, 0x05, 0xcc, 0x03, 0xeb, 0x03, 
-0x48, 0x03, 0x84, 0x02, 0x9e, 0x02, 0x8c, 0x01, 0x04, 0x01, 0xeb, 0x00, 0x19, 0xff, 0xf7, 0xfe, 
-0xe3, 0xfe, 0x5d, 0xfd, 0x7d, 0xfb, 0xa2, 0xfa, 0x36, 0xf8, 0xe1, 0xf6, 0x9f, 0xf5, 0x69, 0xf3, 
-0x4e, 0xf3, 0x07, 0xf4, 0xa6, 0xf6, 0x1e, 0xf8, 0x08, 0xf9, 0x95, 0xfc, 0x92, 0xff, 0x7c, 0x01, 
-0x7f, 0x04, 0x0d, 0x06, 0xe2, 0x07, 0x4b, 0x09, 0x80, 0x08, 0xb6, 0x08, 0x62, 0x08, 0xeb, 0x07, 
-0xdc, 0x06, 0xd1, 0x05, 0x49, 0x05, 0x90, 0x04, 0x7d, 0x04, 0x0f, 0x04, 0x46, 0x03, 0xb8, 0x02, 
-0xd4, 0x02, 0x83, 0x02, 0x37, 0x02, 0x78, 0x01, 0x07, 0x01, 0x2b, 0x00, 0x91, 0xff, 0xab, 0xfe, 
-0x73, 0xfc, 0xc1, 0xfa, 0xf9, 0xf8, 0x4b, 0xf6, 0x89, 0xf3, 0x91, 0xf1, 0xd6, 0xf0, 0x93, 0xf1, 
-0x38, 0xf4, 0x54, 0xf6, 0x19, 0xf8, 0xae, 0xfb, 0x7a, 0xff, 0xc4, 0x02, 0x7e, 0x05, 0x40, 0x07, 
-0xfc, 0x09, 0xe1, 0x0a, 0x91, 0x09, 0xe8, 0x09, 0xd5, 0x08, 0x1b, 0x08, 0xec, 0x05, 0xd9, 0x03, 
-0x1f, 0x05, 0x4f, 0x04, 0xdb, 0x03, 0x5c, 0x04, 0x88, 0x03, 0x82, 0x04, 0x14, 0x04, 0x7d, 0x03, 
-0x9c, 0x04, 0xcb, 0x02, 0x20, 0x02, 0xe6, 0x00, 0xc7, 0xfe, 0xbe, 0xfe, 0xfd, 0xfb, 0xc7, 0xf8, 
-0x4d, 0xf6, 0x6e, 0xf3, 0xb2, 0xef, 0x67, 0xed, 0x6d, 0xed, 0xb7, 0xee, 0x82, 0xf2, 0xcd, 0xf6, 
-0x7b, 0xf9, 0xd2, 0xfd, 0x47, 0x04, 0x12, 0x08, 0xeb, 0x09, 0x36, 0x0c, 0x0a, 0x0e, 0x6d, 0x0c, 
-0x80, 0x0a, 0x5d, 0x08, 0x1d, 0x07, 0xd4, 0x05, 0xe2, 0x02, 0xaf, 0x03, 0xb2, 0x03, 0x61, 0x03, 
-0xe1, 0x04, 0x71, 0x04, 0xc6, 0x05, 0x82, 0x06, 0x81, 0x04, 0x44, 0x05, 0xae, 0x04, 0xf3, 0x02, 
-0x07, 0x02, 0x4e, 0xfe, 0x4c, 0xfd, 0x38, 0xfa, 0xaf, 0xf5, 0x46, 0xf4, 0xb5, 0xef, 0x9d, 0xeb, 
-0x6f, 0xeb, 0x59, 0xea, 0x85, 0xeb, 0x23, 0xf2, 0xfb, 0xf6, 0xd3, 0xfa, 0x9d, 0x00, 0x08, 0x07, 
-0x75, 0x0c, 0xcb, 0x0e, 0x84, 0x0f, 0x6a, 0x10, 0xfc, 0x0d, 0xea, 0x09, 0x28, 0x07, 0xf4, 0x04, 
-0x53, 0x04, 0x42, 0x01, 0x0f, 0x00, 0x49, 0x03, 0x84, 0x03, 0x01, 0x05, 0x96, 0x06, 0xb6, 0x07, 
-0x22, 0x09, 0xdf, 0x06, 0x42, 0x06, 0x36, 0x06, 0x2f, 0x03, 0x80, 0x01, 0x38, 0xfe, 0x56, 0xfc, 
-0x9c, 0xf9, 0xc7, 0xf2, 0x90, 0xf0, 0xe1, 0xea, 0x17, 0xe6, 0x48, 0xe8, 0x13, 0xe7, 0x34, 0xec, 
-0xff, 0xf4, 0x99, 0xf8, 0xcb, 0x00, 0xb8, 0x07, 0x12, 0x0d, 0xe0, 0x12, 0x10, 0x12, 0xf8, 0x12, 
-0x0e, 0x11, 0x2e, 0x0b, 0xb7, 0x07, 0x87, 0x01, 0x4b, 0x00, 0xea, 0xfe, 0x5f, 0xfb, 0x0b, 0xff, 
-0x96, 0x00, 0x84, 0x03, 0xb2, 0x08, 0x40, 0x09, 0xa7, 0x0c, 0x0e, 0x0c, 0xe3, 0x09, 0x6a, 0x09, 
-0x7d, 0x04, 0xe9, 0x01, 0x41, 0xfe, 0x9f, 0xfb, 0xb3, 0xf9, 0xbd, 0xf1, 0x8a, 0xef, 0x13, 0xea, 
-0xd2, 0xe1, 0xfb, 0xe3, 0xf6, 0xe3, 0x7e, 0xe8, 0x54, 0xf3, 0xec, 0xf8, 0x16, 0x03, 0xf3, 0x0b, 
-0xf8, 0x10, 0xf3, 0x16, 0x0c, 0x16, 0xf1, 0x16, 0x50, 0x13, 0x34, 0x0b, 0x06, 0x08, 0x84, 0x00, 
-0x02, 0xfc, 0x87, 0xfa, 0xe6, 0xf6, 0xf0, 0xfb, 0x1a, 0xff, 0x97, 0x01, 0xe7, 0x08, 0xe5, 0x0b, 
-0x56, 0x10, 0xd6, 0x0e, 0xf8, 0x0b, 0x4f, 0x0c, 0x7b, 0x05, 0xfc, 0x00, 0xda, 0xfc, 0x3c, 0xf9, 
-0xfb, 0xf6, 0xf1, 0xee, 0x1f, 0xec, 0xe4, 0xe6, 0xa5, 0xe1, 0xf8, 0xe3, 0x36, 0xe3, 0x1e, 0xea, 
-0x17, 0xf5, 0x77, 0xfb, 0x6a, 0x06, 0x61, 0x0d, 0xbd, 0x14, 0x8e, 0x18, 0x94, 0x15, 0x92, 0x16, 
-0x86, 0x11, 0xce, 0x0a, 0x17, 0x05, 0x4f, 0xfe, 0x06, 0xfc, 0xa1, 0xf9, 0x43, 0xf8, 0x7c, 0xfc, 
-0x91, 0x00, 0x7a, 0x05, 0x8f, 0x0a, 0x8f, 0x0e, 0x76, 0x11, 0xbc, 0x0f, 0x21, 0x0d, 0xaa, 0x08, 
-0x61, 0x04, 0xea, 0xfe, 0xf8, 0xf8, 0x91, 0xf7, 0x13, 0xf3, 0x50, 0xee, 0xb3, 0xea, 0x1e, 0xe4, 
-0xe5, 0xe1, 0x74, 0xe1, 0xf5, 0xe2, 0x5b, 0xed, 0x24, 0xf5, 0xe4, 0xfe, 0xaf, 0x09, 0xa4, 0x0f, 
-0xf9, 0x16, 0xd7, 0x18, 0xba, 0x19, 0xd2, 0x16, 0x0d, 0x10, 0x5f, 0x0c, 0xd6, 0x04, 0x61, 0xfe, 
-0xdc, 0xfb, 0x86, 0xf9, 0x96, 0xf9, 0x60, 0xfc, 0xdb, 0x00, 0x59, 0x05, 0x0b, 0x0a, 0xc9, 0x0e, 
-0xc0, 0x0f, 0x05, 0x10, 0xf8, 0x0c, 0x7c, 0x07, 0x86, 0x03, 0x28, 0xfc, 0x2d, 0xf8, 0x72, 0xf5, 
-0x84, 0xf1, 0xdf, 0xed, 0x45, 0xe9, 0x40, 0xe4, 0x52, 0xe2, 0xf7, 0xe1, 0x11, 0xe5, 0xfc, 0xee, 
-0x43, 0xf7, 0x4e, 0x01, 0x0e, 0x09, 0xe6, 0x10, 0xed, 0x16, 0xfd, 0x16, 0x6b, 0x17, 0xc9, 0x14, 
-0x20, 0x0f, 0xcc, 0x09, 0xf2, 0x02, 0xbe, 0xff, 0x09, 0xfd, 0x3d, 0xfa, 0x54, 0xfc, 0x7a, 0xfe, 
-0x1d, 0x02, 0xf2, 0x04, 0xf3, 0x09, 0xff, 0x0d, 0x30, 0x0d, 0x22, 0x0e, 0x0e, 0x0b, 0x45, 0x07, 
-0xcc, 0x02, 0x81, 0xfc, 0x19, 0xfa, 0x56, 0xf6, 0xf6, 0xf2, 0x85, 0xee, 0x3b, 0xea, 0x00, 0xe6, 
-0x88, 0xe4, 0x91, 0xe4, 0xf9, 0xe7, 0x94, 0xf0, 0x83, 0xf8, 0xfe, 0xff, 0xfe, 0x06, 0x27, 0x0d, 
-0x2b, 0x12, 0x92, 0x13, 0x3d, 0x13, 0x62, 0x12, 0xdc, 0x0d, 0xd5, 0x0a, 0xaa, 0x05, 0xad, 0x02, 
-0xea, 0x00, 0x86, 0xfe, 0xe8, 0xff, 0xf4, 0x00, 0xc9, 0x02, 0x75, 0x05, 0xc5, 0x07, 0x6b, 0x09, 
-0xc8, 0x09, 0xf2, 0x08, 0xec, 0x06, 0xf0, 0x03, 0xf5, 0xff, 0xca, 0xfc, 0x2e, 0xfa, 0x59, 0xf8, 
-0xf3, 0xf5, 0x7c, 0xf2, 0x7c, 0xf0, 0xab, 0xec, 0x60, 0xec, 0xa8, 0xec, 0x58, 0xed, 0x70, 0xf2, 
-0x44, 0xf7, 0x7e, 0xfb, 0xb9, 0xff, 0x39, 0x04, 0xe5, 0x08, 0xd5, 0x0a, 0x36, 0x0d, 0xf1, 0x0d, 
-0xe6, 0x0c, 0xaa, 0x0c, 0xfa, 0x09, 0x9e, 0x08, 0x84, 0x06, 0x6e, 0x05, 0x4d, 0x05, 0x8e, 0x04, 
-0x9b, 0x04, 0xb0, 0x03, 0x25, 0x04, 0xea, 0x03, 0x64, 0x03, 0x4b, 0x02, 0x71, 0x00, 0xfc, 0x00, 
-0x6f, 0xff, 0x90, 0xfd, 0x7f, 0xfd, 0xd2, 0xfc, 0x84, 0xfb, 0x16, 0xf9, 0x7f, 0xf8, 0x4b, 0xf6, 
-0x8f, 0xf4, 0x48, 0xf4, 0xbc, 0xf2, 0xbe, 0xf4, 0x88, 0xf5, 0xcd, 0xf6, 0x93, 0xf8, 0xf3, 0xf8, 
-0x27, 0xfd, 0xe2, 0xff, 0x12, 0x02, 0x4c, 0x05, 0x12, 0x07, 0xb8, 0x09, 0xf8, 0x09, 0xe5, 0x0a, 
-0xc4, 0x0b, 0x3e, 0x0b, 0x01, 0x0c, 0x52, 0x0a, 0xe1, 0x09, 0x99, 0x08, 0x8c, 0x05, 0x50, 0x05, 
-0x25, 0x03, 0x3e, 0x02, 0xc0, 0x00, 0xcd, 0xfe, 0xfa, 0xfe, 0x1c, 0xfd, 0xc2, 0xfc, 0x71, 0xfc, 
-0x92, 0xfb, 0xb4, 0xfb, 0x05, 0xfb, 0xaa, 0xfb, 0xed, 0xfb, 0x28, 0xf9, 0x04, 0xf7, 0x42, 0xf4, 
-0x4d, 0xf2, 0xde, 0xf1, 0xe9, 0xf1, 0x33, 0xf3, 0x4d, 0xf5, 0xb3, 0xf9, 0x01, 0xfe, 0x47, 0x01, 
-0xae, 0x03, 0x14, 0x06, 0x4e, 0x09, 0x1a, 0x0c, 0x4e, 0x0e, 0xcb, 0x0f, 0x01, 0x10, 0xc2, 0x0f, 
-0x8c, 0x0e, 0x50, 0x0c, 0xef, 0x0a, 0x91, 0x08, 0xd1, 0x05, 0x2b, 0x04, 0xbb, 0x02, 0x5d, 0x02, 
-0x4a, 0x01, 0x59, 0xff, 0x9d, 0xfd, 0x2c, 0xfc, 0x40, 0xfb, 0x5e, 0xf9, 0xd1, 0xf7, 0x82, 0xf5, 
-0x7e, 0xf2, 0x85, 0xf0, 0xf1, 0xec, 0xe3, 0xea, 0x5a, 0xec, 0x57, 0xee, 0x5d, 0xf0, 0x24, 0xf3, 
-0xd7, 0xf7, 0x00, 0xfc, 0x5e, 0xff, 0xfd, 0x03, 0xc3, 0x08, 0x37, 0x0d, 0x5c, 0x10, 0x36, 0x13, 
-0x08, 0x16, 0xa4, 0x16, 0x88, 0x16, 0x92, 0x14, 0x91, 0x11, 0x7e, 0x0e, 0xe1, 0x0a, 0xab, 0x07, 
-0x7c, 0x04, 0xb1, 0x01, 0xb2, 0xfe, 0x14, 0xfc, 0xca, 0xf9, 0x15, 0xf8, 0x97, 0xf6, 0x92, 0xf5, 
-0x6a, 0xf5, 0xb4, 0xf4, 0x62, 0xf4, 0x08, 0xf4, 0x56, 0xf2, 0x16, 0xf0, 0xda, 0xed, 0xde, 0xeb, 
-0x6d, 0xeb, 0x7d, 0xec, 0x15, 0xef, 0x91, 0xf3, 0xbf, 0xf8, 0xdc, 0xfd, 0x0e, 0x04, 0xf3, 0x09, 
-0x83, 0x0e, 0xc4, 0x12, 0x20, 0x16, 0x11, 0x19, 0x48, 0x1a, 0xf4, 0x19, 0x3e, 0x18, 0xfc, 0x14, 
-0x5b, 0x11, 0x39, 0x0d, 0x9b, 0x09, 0x3a, 0x06, 0x85, 0x02, 0xf6, 0xff, 0x45, 0xfd, 0x6b, 0xfa, 
-0x56, 0xf8, 0x55, 0xf6, 0x50, 0xf5, 0x90, 0xf4, 0x47, 0xf4, 0x0c, 0xf4, 0x6e, 0xf3, 0xe8, 0xf2, 
-0x52, 0xf1, 0x0c, 0xef, 0xf7, 0xec, 0x12, 0xeb, 0x60, 0xeb, 0x33, 0xed, 0xac, 0xef, 0x85, 0xf4, 
-0x88, 0xf9, 0xee, 0xfe, 0x14, 0x05, 0xd3, 0x0a, 0x18, 0x10, 0xed, 0x13, 0x39, 0x17, 0xc0, 0x19, 
-0x37, 0x1a, 0xf8, 0x19, 0xf0, 0x17, 0x6d, 0x14, 0xac, 0x10, 0xab, 0x0c, 0xee, 0x08, 0x51, 0x05, 
-0x4f, 0x02, 0x79, 0xff, 0x66, 0xfc, 0xf6, 0xf9, 0xc4, 0xf7, 0x2d, 0xf6, 0x8b, 0xf5, 0xa2, 0xf4, 
-0xa6, 0xf4, 0x92, 0xf4, 0x33, 0xf4, 0xeb, 0xf3, 0x4b, 0xf2, 0x66, 0xf0, 0x9a, 0xee, 0x9d, 0xec, 
-0x5b, 0xec, 0x3f, 0xed, 0x12, 0xf0, 0x6a, 0xf4, 0xaf, 0xf8, 0x83, 0xfe, 0x36, 0x04, 0x9c, 0x09, 
-0xdf, 0x0e, 0x3b, 0x12, 0x99, 0x15, 0x4a, 0x18, 0x22, 0x19, 0x40, 0x19, 0xaa, 0x17, 0xf4, 0x14, 
-0x48, 0x11, 0x60, 0x0d, 0xc1, 0x09, 0x58, 0x06, 0x2f, 0x03, 0x9d, 0xff, 0xcf, 0xfc, 0x87, 0xfa, 
-0xed, 0xf7, 0x9a, 0xf6, 0x7f, 0xf5, 0x71, 0xf4, 0x63, 0xf4, 0xed, 0xf3, 0xba, 0xf3, 0x33, 0xf3, 
-0x06, 0xf2, 0xa2, 0xf0, 0x6f, 0xee, 0xbf, 0xec, 0x53, 0xec, 0x20, 0xed, 0xdb, 0xef, 0xef, 0xf3, 
-0xab, 0xf8, 0xe7, 0xfd, 0x9c, 0x03, 0x5b, 0x09, 0x39, 0x0e, 0x27, 0x12, 0x59, 0x15, 0x08, 0x18, 
-0x52, 0x19, 0x6d, 0x19, 0x73, 0x18, 0xf3, 0x15, 0xc0, 0x12, 0xef, 0x0e, 0xf8, 0x0a, 0x7d, 0x07, 
-0xcb, 0x03, 0x06, 0x00, 0x18, 0xfd, 0x5e, 0xfa, 0xd1, 0xf7, 0x31, 0xf6, 0xe4, 0xf4, 0xbe, 0xf3, 
-0x57, 0xf3, 0x0d, 0xf3, 0xd3, 0xf2, 0xa1, 0xf2, 0xb5, 0xf1, 0x51, 0xf0, 0xb7, 0xee, 0x5f, 0xed, 
-0xd1, 0xec, 0xce, 0xed, 0x73, 0xf0, 0x02, 0xf4, 0x83, 0xf8, 0xc2, 0xfd, 0x23, 0x03, 0x95, 0x08, 
-0xb5, 0x0d, 0xbd, 0x11, 0x08, 0x15, 0xab, 0x17, 0x0f, 0x19, 0x33, 0x19, 0x15, 0x18, 0xb4, 0x15, 
-0x8d, 0x12, 0xfa, 0x0e, 0x24, 0x0b, 0x48, 0x07, 0x95, 0x03, 0x14, 0x00, 0xc3, 0xfc, 0xf0, 0xf9, 
-0xa3, 0xf7, 0xda, 0xf5, 0xae, 0xf4, 0xcb, 0xf3, 0x67, 0xf3, 0x6f, 0xf3, 0x7a, 0xf3, 0x9c, 0xf3, 
-0x60, 0xf3, 0x76, 0xf2, 0x27, 0xf1, 0xe2, 0xef, 0x4d, 0xef, 0x95, 0xef, 0x40, 0xf1, 0x65, 0xf4, 
-0x1c, 0xf8, 0xba, 0xfc, 0xed, 0x01, 0xdf, 0x06, 0xe9, 0x0b, 0x1f, 0x10, 0x2f, 0x13, 0xc8, 0x15, 
-0x4b, 0x17, 0xc6, 0x17, 0x27, 0x17, 0x3d, 0x15, 0xa5, 0x12, 0x32, 0x0f, 0x5b, 0x0b, 0xae, 0x07, 
-0xec, 0x03, 0x5c, 0x00, 0x12, 0xfd, 0x3b, 0xfa, 0x05, 0xf8, 0x37, 0xf6, 0xde, 0xf4, 0xea, 0xf3, 
-0x66, 0xf3, 0x1c, 0xf3, 0x04, 0xf3, 0x35, 0xf3, 0xee, 0xf2, 0x60, 0xf2, 0x8c, 0xf1, 0x64, 0xf0, 
-0xe6, 0xef, 0x2a, 0xf0, 0x9d, 0xf1, 0x89, 0xf4, 0x4c, 0xf8, 0xb0, 0xfc, 0x9d, 0x01, 0xaf, 0x06, 
-0x5f, 0x0b, 0x6c, 0x0f, 0x93, 0x12, 0xdb, 0x14, 0x9c, 0x16, 0x60, 0x17, 0x0f, 0x17, 0xc2, 0x15, 
-0x3b, 0x13, 0x15, 0x10, 0x75, 0x0c, 0x8b, 0x08, 0xba, 0x04, 0xfe, 0x00, 0xae, 0xfd, 0xb0, 0xfa, 
-0x2c, 0xf8, 0x4c, 0xf6, 0xa4, 0xf4, 0x97, 0xf3, 0xed, 0xf2, 0x49, 0xf2, 0x3c, 0xf2, 0x5a, 0xf2, 
-0x67, 0xf2, 0x77, 0xf2, 0xf4, 0xf1, 0x4f, 0xf1, 0x01, 0xf1, 0x1c, 0xf1, 0x4f, 0xf2, 0xc4, 0xf4, 
-0x04, 0xf8, 0x16, 0xfc, 0xc6, 0x00, 0x51, 0x05, 0xcc, 0x09, 0x12, 0x0e, 0x35, 0x11, 0xa6, 0x13, 
-0xc2, 0x15, 0xc0, 0x16, 0xc5, 0x16, 0xd4, 0x15, 0xb7, 0x13, 0xa7, 0x10, 0x30, 0x0d, 0x78, 0x09, 
-0x92, 0x05, 0x11, 0x02, 0x9b, 0xfe, 0x5e, 0xfb, 0xea, 0xf8, 0xa8, 0xf6, 0xd9, 0xf4, 0xb5, 0xf3, 
-0xcb, 0xf2, 0x44, 0xf2, 0x36, 0xf2, 0x4c, 0xf2, 0x69, 0xf2, 0xc5, 0xf2, 0xa8, 0xf2, 0x52, 0xf2, 
-0x3d, 0xf2, 0x43, 0xf2, 0x21, 0xf3, 0xed, 0xf4, 0x77, 0xf7, 0xe0, 0xfa, 0xf1, 0xfe, 0x1c, 0x03, 
-0x3c, 0x07, 0x58, 0x0b, 0xc1, 0x0e, 0x79, 0x11, 0xa4, 0x13, 0x06, 0x15, 0xa6, 0x15, 0x0d, 0x15, 
-0x86, 0x13, 0x45, 0x11, 0x1d, 0x0e, 0x9f, 0x0a, 0xf3, 0x06, 0x63, 0x03, 0xf4, 0xff, 0xd1, 0xfc, 
-0x60, 0xfa, 0x1c, 0xf8, 0x48, 0xf6, 0xf8, 0xf4, 0xee, 0xf3, 0x3b, 0xf3, 0xeb, 0xf2, 0x11, 0xf3, 
-0x90, 0xf3, 0x33, 0xf4, 0xe7, 0xf4, 0x44, 0xf5, 0x63, 0xf5, 0x98, 0xf5, 0xc6, 0xf5, 0x8b, 0xf6, 
-0x20, 0xf8, 0x35, 0xfa, 0x0c, 0xfd, 0x8d, 0x00, 0xf9, 0x03, 0x60, 0x07, 0x9b, 0x0a, 0x46, 0x0d, 
-0x96, 0x0f, 0x6d, 0x11, 0x9d, 0x12, 0x23, 0x13, 0xef, 0x12, 0xb7, 0x11, 0xaf, 0x0f, 0x12, 0x0d, 
-0xdb, 0x09, 0x8e, 0x06, 0x36, 0x03, 0x07, 0x00, 0x3e, 0xfd, 0xb8, 0xfa, 0x9f, 0xf8, 0xa3, 0xf6, 
-0xf0, 0xf4, 0xc7, 0xf3, 0x12, 0xf3, 0xda, 0xf2, 0x10, 0xf3, 0xa1, 0xf3, 0x9b, 0xf4, 0x95, 0xf5, 
-0x57, 0xf6, 0x01, 0xf7, 0x6f, 0xf7, 0xee, 0xf7, 0xce, 0xf8, 0x4f, 0xfa, 0x56, 0xfc, 0x8b, 0xfe, 
-0x70, 0x01, 0x3f, 0x04, 0xd4, 0x06, 0x8b, 0x09, 0xb7, 0x0b, 0x72, 0x0d, 0xa2, 0x0e, 0x86, 0x0f, 
-0xe7, 0x0f, 0xbd, 0x0f, 0xc6, 0x0e, 0x0d, 0x0d, 0xd3, 0x0a, 0x26, 0x08, 0x5a, 0x05, 0x64, 0x02, 
-0x81, 0xff, 0xd5, 0xfc, 0xa2, 0xfa, 0xaf, 0xf8, 0x15, 0xf7, 0xc1, 0xf5, 0xd4, 0xf4, 0x7a, 0xf4, 
-0x75, 0xf4, 0xe9, 0xf4, 0xe3, 0xf5, 0x30, 0xf7, 0x71, 0xf8, 0x97, 0xf9, 0x8f, 0xfa, 0x80, 0xfb, 
-0xfc, 0xfb, 0x22, 0xfc, 0xb7, 0xfc, 0xdf, 0xfd, 0xfe, 0xfe, 0x46, 0x00, 0x2b, 0x02, 0x81, 0x03, 
-0x07, 0x05, 0x9e, 0x06, 0xa9, 0x07, 0xe9, 0x08, 0xfd, 0x09, 0xb2, 0x0a, 0x69, 0x0b, 0xb3, 0x0b, 
-0xff, 0x0a, 0x1a, 0x0a, 0x5d, 0x08, 0xfb, 0x05, 0x00, 0x04, 0x7d, 0x01, 0x19, 0xff, 0x1e, 0xfd, 
-0x26, 0xfb, 0xb8, 0xf9, 0x0f, 0xf8, 0xf5, 0xf6, 0x83, 0xf6, 0x16, 0xf6, 0x0e, 0xf6, 0xb8, 0xf6, 
-0x89, 0xf7, 0xbe, 0xf8, 0xaa, 0xfa, 0xbb, 0xfb, 0x17, 0xfd, 0x63, 0xfe, 0xec, 0xfe, 0xae, 0xff, 
-0x4b, 0x00, 0xa1, 0x00, 0x0e, 0x01, 0xfd, 0x01, 0xa8, 0x02, 0x52, 0x03, 0x2a, 0x04, 0x5b, 0x04, 
-0xdd, 0x04, 0xfd, 0x04, 0xcd, 0x04, 0x50, 0x05, 0x2d, 0x05, 0x08, 0x05, 0x12, 0x05, 0x9c, 0x04, 
-0x21, 0x04, 0x3d, 0x03, 0x8e, 0x01, 0x3c, 0x00, 0x0a, 0xff, 0xfd, 0xfd, 0x60, 0xfd, 0x9e, 0xfc, 
-0xdc, 0xfb, 0x13, 0xfb, 0xab, 0xfa, 0xd6, 0xfa, 0xbe, 0xfa, 0x8e, 0xfb, 0x6b, 0xfc, 0xce, 0xfc, 
-0xaf, 0xfe, 0xf8, 0xff, 0x9b, 0x00, 0x9a, 0x01, 0x83, 0x01, 0x8b, 0x01, 0x17, 0x02, 0xf3, 0x01, 
-0x0a, 0x02, 0x19, 0x02, 0xa4, 0x01, 0x71, 0x01, 0x6e, 0x01, 0x1f, 0x00, 0xef, 0xff, 0xfc, 0xff, 
-0x33, 0xff, 0x52, 0xff, 0x3c, 0xff, 0xea, 0xfe, 0x75, 0xff, 0x85, 0xff, 0x16, 0xff, 0x5c, 0xff, 
-0x87, 0xff, 0x8f, 0xff, 0xd1, 0xff, 0xc8, 0xff, 0xe1, 0xff, 0x0c, 0x00, 0x38, 0x00, 0x5b, 0x00, 
-0xe8, 0xff, 0x0c, 0x00, 0x5f, 0x00, 0x24, 0x00, 0xfa, 0xff, 0x4d, 0x00, 0x8f, 0x00, 0x38, 0x01, 
-0x9f, 0x01, 0x67, 0x01, 0xd6, 0x01, 0xcc, 0x01, 0x73, 0x01, 0xda, 0x01, 0x7b, 0x01, 0xc8, 0x00, 
-0x23, 0x00, 0xd6, 0xff, 0xed, 0xff, 0x58, 0xff, 0x12, 0xff, 0xab, 0xfe, 0x0a, 0xfe, 0x6d, 0xfe, 
-0x78, 0xfe, 0x1d, 0xfe, 0x3a, 0xfe, 0x32, 0xfe, 0x79, 0xfe, 0xee, 0xfe, 0xe6, 0xfe, 0x53, 0xff, 
-0xd1, 0xff, 0xdd, 0xff, 0xfb, 0xff, 0x10, 0x00, 0x3b, 0x00, 0x4e, 0x00, 0x01, 0x00, 0xfd, 0xff, 
-0x61, 0x00, 0x7c, 0x00, 0x84, 0x00, 0xb3, 0x00, 0xca, 0x00, 0xf4, 0x00, 0x3b, 0x01, 0x4a, 0x01, 
-0x4e, 0x01, 0x64, 0x01, 0x18, 0x01, 0xd7, 0x00, 0xbb, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x43, 0x00, 
-0x09, 0x00, 0x14, 0x00, 0x01, 0x00, 0x98, 0xff, 0x4a, 0xff, 0x0d, 0xff, 0xae, 0xfe, 0xe4, 0xfe, 
-0xc2, 0xfe, 0xbb, 0xfe, 0x1b, 0xff, 0xf3, 0xfe, 0xcc, 0xfe, 0xf3, 0xfe, 0x16, 0xff, 0x1e, 0xff, 
-0x4e, 0xff, 0x26, 0xff, 0x72, 0xff, 0xf9, 0xff, 0x23, 0x00, 0x7d, 0x00, 0x8a, 0x00, 0xf0, 0x00, 
-0x3d, 0x01, 0x26, 0x01, 0x49, 0x01, 0x66, 0x01, 0x6a, 0x01, 0x88, 0x01, 0x15, 0x01, 0xdc, 0x00, 
-0xf8, 0x00, 0x8c, 0x00, 0x49, 0x00, 0x2d, 0x00, 0xd1, 0xff, 0xb2, 0xff, 0xe2, 0xff, 0xce, 0xff, 
-0xad, 0xff, 0x93, 0xff, 0x83, 0xff, 0x73, 0xff, 0xc8, 0xff, 0xda, 0xff, 0xe7, 0xff, 0xe0, 0xff, 
-0xbf, 0xff, 0xb2, 0xff, 0xb6, 0xff, 0xac, 0xff, 0x9b, 0xff, 0xce, 0xff, 0xc3, 0xff, 0x99, 0xff, 
-0x7a, 0xff, 0x6a, 0xff, 0x9a, 0xff, 0xdf, 0xff, 0xb9, 0xff, 0xef, 0xff, 0x2b, 0x00, 0x52, 0x00, 
-0x97, 0x00, 0xe1, 0x00, 0xe5, 0x00, 0xe8, 0x00, 0x0e, 0x01, 0xc5, 0x00, 0xc6, 0x00, 0xbe, 0x00, 
-0x7e, 0x00, 0x3e, 0x00, 0x2c, 0x00, 0x51, 0x00, 0x18, 0x00, 0xca, 0xff, 0x9d, 0xff, 0x68, 0xff, 
-0x59, 0xff, 0x88, 0xff, 0x49, 0xff, 0x37, 0xff, 0x4d, 0xff, 0x52, 0xff, 0x29, 0xff, 0x5a, 0xff, 
-0xb2, 0xff, 0x67, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xbe, 0xff, 0x21, 0x00, 0x12, 0x00, 0x0b, 0x00, 
-0x45, 0x00, 0x9e, 0x00, 0xa0, 0x00, 0x7e, 0x00, 0x85, 0x00, 0x82, 0x00, 0xb4, 0x00, 0xe0, 0x00, 
-0xd0, 0x00, 0x8b, 0x00, 0x50, 0x00, 0xff, 0xff, 0xf9, 0xff, 0x28, 0x00, 0x1f, 0x00, 0xe9, 0xff, 
-0xbf, 0xff, 0xc4, 0xff, 0xe2, 0xff, 0xea, 0xff, 0xfb, 0xff, 0xa5, 0xff, 0x15, 0x00, 0xdc, 0xff, 
-0xc3, 0x00, 0xf6, 0x00, 0xea, 0x01, 0xe0, 0x02, 0x6f, 0xfe, 0xac, 0xfd, 0x95, 0xfd, 0x1e, 0xfe, 
-0xbf, 0xfe, 0x7a, 0xfd, 0xb1, 0xfd, 0x3c, 0xfe, 0x2d, 0xff, 0x5d, 0xff, 0xfa, 0xff, 0x45, 0x01, 
-0x47, 0x01, 0xc9, 0x01, 0x06, 0x02, 0xa6, 0x01, 0xb2, 0x01, 0x12, 0x01, 0x1b, 0x01, 0xf3, 0x00, 
-0xa2, 0x00, 0x3d, 0x00, 0x33, 0x00, 0x32, 0x00, 0xcf, 0xff, 0x12, 0x00, 0xae, 0xff, 0x7f, 0xff, 
-0x7d, 0xff, 0x19, 0xff, 0x06, 0xff, 0xb9, 0xfe, 0xc8, 0xfe, 0xe4, 0xfe, 0x5c, 0xff, 0x3e, 0xff, 
-0x66, 0xff, 0xc5, 0xff, 0x79, 0xff, 0xa4, 0xff, 0x6e, 0xff, 0x5e, 0xff, 0xba, 0xff, 0xbc, 0xff, 
-0xa0, 0xff, 0x0c, 0x00, 0x40, 0x00, 0x94, 0x00, 0x5b, 0x00, 0x83, 0x00, 0xd1, 0x00, 0xf8, 0x00, 
-0xec, 0x00, 0x0a, 0x01, 0xdf, 0x00, 0x19, 0x01, 0x60, 0x01, 0xed, 0x00, 0x2e, 0x01, 0x70, 0x00, 
-0xae, 0x00, 0x5e, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0xcf, 0xff, 0xcb, 0xff, 0x5f, 0xff, 0xdd, 0xff, 
-0x7b, 0xff, 0x86, 0xff, 0xae, 0xff, 0x48, 0xff, 0xbe, 0xff, 0x74, 0xff, 0x5e, 0xff, 0x8d, 0xff, 
-0x9d, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xf8, 0xff, 0x18, 0x00, 0x1a, 0x00, 0x02, 0x00, 
-0xdd, 0xff, 0x33, 0x00, 0x19, 0x00, 0xf3, 0xff, 0x52, 0x00, 0x19, 0x00, 0x7b, 0x00, 0x48, 0x00, 
-0xa0, 0x00, 0x6a, 0x00, 0x88, 0x00, 0x9d, 0x00, 0x6f, 0x00, 0x9c, 0x00, 0x62, 0x00, 0xa1, 0x00, 
-0x6b, 0x00, 0x02, 0x00, 0x12, 0x00, 0x0e, 0x00, 0x91, 0xff, 0x0f, 0x00, 0xaa, 0xff, 0x8b, 0xff, 
-0x87, 0xff, 0x21, 0xff, 0x81, 0xff, 0x9a, 0xff, 0x63, 0xff, 0xbb, 0xff, 0x98, 0xff, 0xc4, 0xff, 
-0x95, 0xff, 0xea, 0xff, 0x96, 0xff, 0xf8, 0xff, 0x1a, 0x00, 0x57, 0x00, 0x48, 0x00, 0x07, 0x00, 
-0x8f, 0x00, 0x3e, 0x00, 0x4d, 0x00, 0xdd, 0xff, 0x54, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x25, 0x00, 
-0x0f, 0x00, 0xe6, 0xff, 0x39, 0x00, 0xc1, 0xff, 0x47, 0x00, 0x30, 0x00, 0x30, 0x00, 0xf1, 0xff, 
-0x2b, 0x00, 0x88, 0x00, 0xc3, 0xff, 0x77, 0x00, 0x41, 0x00, 0x45, 0x00, 0x23, 0x00, 0x14, 0x00, 
-0x31, 0x00, 0xe0, 0xff, 0x3e, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x3b, 0x00, 0xea, 0xff, 0x6c, 0x00, 
-0xce, 0xff, 0x48, 0x00, 0x8d, 0x00, 0x4b, 0xff, 0xc9, 0xff, 0xf3, 0xff, 0x14, 0xff, 0x20, 0xff, 
-0x99, 0xff, 0x2b, 0xff, 0xed, 0xfe, 0x38, 0x00, 0x95, 0xff, 0x1d, 0xff, 0x9f, 0x00, 0x89, 0xff, 
-0xac, 0xff, 0x65, 0x00, 0x30, 0x00, 0xf8, 0xff, 0x33, 0x00, 0x65, 0x00, 0x32, 0x00, 0xf9, 0xfe, 
-0x90, 0x00, 0x3c, 0xff, 0x56, 0xff, 0x20, 0x00, 0xfd, 0xfe, 0xd8, 0x00, 0x70, 0xfe, 0xd5, 0x00, 
-0x35, 0xff, 0xe4, 0xff, 0xd9, 0x00, 0x3c, 0xff, 0xab, 0x01, 0xbd, 0xff, 0x1e, 0x00, 0xc5, 0x00, 
-0x84, 0x00, 0xc4, 0xff, 0xa7, 0x00, 0x66, 0x00, 0xab, 0xff, 0x37, 0x00, 0xf8, 0xff, 0x29, 0xff, 
-0xb1, 0xff, 0x31, 0x00, 0xb6, 0xfe, 0x6c, 0x00, 0xfd, 0xff, 0xd8, 0xfe, 0x82, 0x00, 0xb2, 0xff, 
-0xad, 0xff, 0x88, 0x00, 0x23, 0x00, 0x26, 0x00, 0x8a, 0xff, 0xfc, 0x00, 0x43, 0xff, 0xcf, 0xff, 
-0xc4, 0x00, 0xa7, 0xff, 0x34, 0x00, 0x54, 0xff, 0x4d, 0x01, 0x44, 0xff, 0x70, 0xff, 0xe3, 0xff, 
-0x8a, 0x00, 0x54, 0xff, 0x03, 0xff, 0x09, 0x02, 0xda, 0xfd, 0x68, 0x00, 0x0f, 0x00, 0xa3, 0x00, 
-0x8b, 0xff, 0xd6, 0xff, 0xa3, 0x01, 0x09, 0xfd, 0x7f, 0x01, 0x90, 0x00, 0x78, 0xfe, 0xf3, 0x00, 
-0x86, 0x00, 0xfb, 0xfe, 0x65, 0xff, 0x1d, 0x01, 0x4b, 0xff, 0x40, 0xfe, 0xd0, 0x01, 0xc1, 0xff, 
-0x57, 0xff, 0x52, 0x01, 0xbe, 0xff, 0xaa, 0xff, 0x08, 0x01, 0xc3, 0xff, 0x45, 0xff, 0xe1, 0xff, 
-0x19, 0x00, 0x41, 0xff, 0x95, 0xff, 0x32, 0x01, 0x21, 0xff, 0xca, 0xff, 0xb1, 0x00, 0x01, 0x00, 
-0x98, 0xff, 0x09, 0x01, 0x6d, 0x00, 0xa3, 0xff, 0x23, 0x00, 0x2b, 0x00, 0xf1, 0xff, 0xc9, 0xff, 
-0xc0, 0x00, 0x9c, 0xfe, 0x56, 0x00, 0x17, 0x01, 0x0b, 0xfe, 0x12, 0x02, 0x11, 0xff, 0x81, 0xff, 
-0x4f, 0x00, 0x4c, 0x00, 0x15, 0x00, 0x6b, 0xfe, 0x51, 0x01, 0x6e, 0xfe, 0x30, 0x00, 0x98, 0x00, 
-0x13, 0xfe, 0x35, 0x01, 0xa6, 0xff, 0xf9, 0xfe, 0x04, 0x00, 0x55, 0x00, 0x10, 0x00, 0x37, 0xff, 
-0x9b, 0x00, 0xad, 0xff, 0x7d, 0x00, 0x48, 0xff, 0x5f, 0x01, 0xcd, 0xff, 0x4c, 0xff, 0x8c, 0x00, 
-0x39, 0x00, 0xb2, 0xfe, 0x33, 0x00, 0x24, 0x01, 0xd4, 0xfd, 0xab, 0x00, 0x26, 0x01, 0x43, 0xfe, 
-0xe1, 0xff, 0x3f, 0x01, 0x5a, 0xff, 0x90, 0xff, 0x97, 0x01, 0x4d, 0xff, 0xb1, 0xff, 0x6f, 0x00, 
-0x61, 0xff, 0x05, 0x01, 0xa9, 0xfe, 0xaa, 0x01, 0xfd, 0xfe, 0xfd, 0xfe, 0x6e, 0x01, 0xde, 0xfe, 
-0x00, 0x00, 0x05, 0xff, 0x4f, 0x01, 0xde, 0xfe, 0x81, 0xff, 0x77, 0x03, 0x78, 0xfc, 0x9e, 0x01, 
-0x0c, 0x01, 0x8d, 0xfd, 0xaa, 0x00, 0xc3, 0xff, 0x92, 0xff, 0xe5, 0xfe, 0x2d, 0x01, 0x0a, 0x00, 
-0x74, 0xfe, 0xc9, 0x01, 0xa8, 0xfe, 0xd8, 0xff, 0x70, 0x02, 0xbd, 0xfd, 0x4c, 0x01, 0xe5, 0x00, 
-0x29, 0xff, 0xf5, 0xff, 0xef, 0x01, 0xc5, 0xfe, 0xce, 0xff, 0x37, 0x02, 0xe4, 0xfd, 0xae, 0xff, 
-0xe2, 0x01, 0x7f, 0xfd, 0x3a, 0xfe, 0x2d, 0x02, 0x93, 0xfd, 0x25, 0xff, 0x47, 0x02, 0xe3, 0xfd, 
-0x18, 0x00, 0x6e, 0x02, 0x91, 0xfe, 0xb4, 0xff, 0xcd, 0x02, 0x2f, 0xfd, 0x96, 0xfe, 0xe1, 0x02, 
-0x96, 0xfd, 0xff, 0xfe, 0xf6, 0x01, 0x57, 0xff, 0x21, 0xfe, 0xba, 0x01, 0x0d, 0x00, 0x31, 0xfe, 
-0xa2, 0x03, 0x57, 0xff, 0x96, 0xfd, 0x66, 0x03, 0x31, 0xfe, 0xda, 0xff, 0x4b, 0x02, 0xa3, 0xff, 
-0x0e, 0xfd, 0x95, 0x02, 0x27, 0x01, 0x5e, 0xfa, 0x38, 0x06, 0xe5, 0xff, 0xea, 0xfa, 0x3f, 0x05, 
-0xef, 0xff, 0x4d, 0xfc, 0x93, 0x03, 0xc4, 0x00, 0x89, 0xfc, 0x0e, 0x04, 0x3e, 0x00, 0xbe, 0xfa, 
-0x69, 0x03, 0xe6, 0xff, 0x17, 0xfc, 0xfc, 0x04, 0xf6, 0xfe, 0x93, 0xfd, 0xc1, 0x04, 0x29, 0xfd, 
-0x2d, 0xfd, 0x66, 0x04, 0x6a, 0xfc, 0xc8, 0xfd, 0x79, 0x05, 0xba, 0xfc, 0x4f, 0xff, 0xb5, 0x03, 
-0xbf, 0xfe, 0xea, 0xfd, 0xdf, 0x03, 0x13, 0xfe, 0x17, 0xfc, 0x0e, 0x06, 0x67, 0xfb, 0xc0, 0x00, 
-0x49, 0x04, 0xa7, 0xfb, 0xfd, 0x00, 0xb5, 0x01, 0x53, 0xff, 0x6d, 0xfd, 0x64, 0x03, 0x97, 0xff, 
-0xe6, 0xfd, 0x24, 0x05, 0xe4, 0xfb, 0x39, 0x00, 0x96, 0x03, 0x78, 0xfb, 0x62, 0x02, 0x56, 0x00, 
-0x7f, 0xfd, 0xc1, 0x00, 0x0d, 0x03, 0xa3, 0xfc, 0x83, 0xff, 0x54, 0x06, 0x5c, 0xf8, 0x3a, 0x02, 
-0x84, 0x04, 0x03, 0xfa, 0x5b, 0x03, 0xf3, 0x01, 0xc5, 0xfa, 0xeb, 0x00, 0x1a, 0x04, 0x9a, 0xf9, 
-0x7f, 0x01, 0x03, 0x06, 0x2a, 0xf9, 0x0c, 0x03, 0x94, 0x03, 0xe9, 0xf9, 0x9f, 0x03, 0x86, 0x01, 
-0x26, 0xfc, 0x75, 0x02, 0xa1, 0xff, 0x63, 0xfd, 0x76, 0x02, 0x81, 0x01, 0x4c, 0xfc, 0x17, 0x03, 
-0x99, 0x00, 0xa6, 0xfb, 0x34, 0x04, 0xd6, 0xfd, 0x33, 0xff, 0xf1, 0x03, 0x55, 0xfc, 0x4e, 0x00, 
-0xf2, 0x01, 0x7f, 0xfd, 0x24, 0xff, 0x33, 0x03, 0x00, 0xff, 0x60, 0xfe, 0x20, 0x06, 0xfe, 0xfc, 
-0x9d, 0xfe, 0x2f, 0x04, 0xb2, 0xfc, 0x71, 0x00, 0x3b, 0x01, 0xbe, 0xff, 0x85, 0xfe, 0xdb, 0xff, 
-0x4b, 0x00, 0x6b, 0xfc, 0xdb, 0x02, 0x7f, 0xfe, 0x92, 0xfd, 0x60, 0x03, 0x10, 0xfe, 0xea, 0xff, 
-0x0e, 0x00, 0x61, 0x01, 0xda, 0xff, 0xc6, 0xfe, 0x24, 0x02, 0x74, 0xfe, 0x81, 0x00, 0x0b, 0x00, 
-0xa2, 0xff, 0x4a, 0x00, 0x06, 0x00, 0xc7, 0x00, 0xee, 0xfe, 0x04, 0x01, 0x42, 0x00, 0xa6, 0xfe, 
-0x28, 0x00, 0xd9, 0x00, 0xac, 0xfe, 0x28, 0x00, 0x54, 0x01, 0xec, 0xfd, 0x0c, 0x01, 0xd7, 0x01, 
-0xd3, 0xfd, 0x58, 0x01, 0xd0, 0x01, 0x92, 0xfe, 0xfa, 0x00, 0xc5, 0x00, 0xdb, 0xfd, 0x6e, 0x00, 
-0x4c, 0x01, 0xe3, 0xfd, 0x4c, 0x02, 0xd6, 0xff, 0x51, 0xfe, 0x74, 0x02, 0xe4, 0xfe, 0x00, 0x00, 
-0xb3, 0x00, 0x8d, 0xfe, 0x79, 0xfe, 0xec, 0x01, 0x1c, 0xff, 0xd7, 0xfe, 0x96, 0x03, 0xbb, 0xfe, 
-0x41, 0xff, 0xd4, 0x02, 0x4f, 0xfe, 0xcc, 0xfe, 0x21, 0x03, 0xe3, 0xfd, 0x57, 0xff, 0x46, 0x02, 
-0x83, 0xfe, 0x8a, 0xff, 0x95, 0x01, 0x08, 0x00, 0xbf, 0xfe, 0xd0, 0x01, 0xc3, 0xff, 0x06, 0xff, 
-0xd6, 0xff, 0x4f, 0xff, 0xa7, 0xff, 0x2a, 0xff, 0x05, 0x01, 0xad, 0x00, 0xae, 0x00, 0x00, 0x01, 
-0x85, 0x00, 0x0f, 0x01, 0x31, 0x00, 0x73, 0x00, 0x59, 0x00, 0x51, 0xff, 0xa8, 0x00, 0xc1, 0xfe, 
-0xe2, 0xff, 0x1e, 0x00, 0x5c, 0xfe, 0x9e, 0x01, 0xbd, 0xfe, 0x7b, 0x00, 0x7e, 0x00, 0x50, 0xfe, 
-0xb1, 0x01, 0xe3, 0xfe, 0x7c, 0xff, 0x1a, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x4a, 0x00, 0x79, 0x01, 
-0x75, 0xff, 0x77, 0x00, 0xf4, 0xfe, 0x3d, 0xff, 0xe6, 0xff, 0xc2, 0xfe, 0x46, 0x00, 0x28, 0x00, 
-0x6d, 0x00, 0xb1, 0x00, 0x12, 0x01, 0x1c, 0x00, 0x66, 0x00, 0x76, 0x00, 0x6f, 0xff, 0x21, 0x00, 
-0xe2, 0xfe, 0x50, 0xff, 0xe6, 0xff, 0xcf, 0xfe, 0x0d, 0xff, 0x19, 0x00, 0x05, 0x00, 0x04, 0xff, 
-0x47, 0x00, 0xbc, 0xff, 0xb6, 0xff, 0x2d, 0x00, 0xba, 0xff, 0x64, 0x00, 0x1f, 0x00, 0xed, 0x00, 
-0xc7, 0xff, 0x2a, 0x00, 0xeb, 0x00, 0x41, 0xff, 0x2b, 0xff, 0x83, 0x00, 0x86, 0xff, 0x26, 0xff, 
-0xfb, 0x01, 0x4e, 0xff, 0xaf, 0x00, 0x60, 0x01, 0x4f, 0xff, 0xcb, 0x01, 0xf9, 0xfe, 0x21, 0x00, 
-0x91, 0x00, 0xe9, 0xfe, 0x41, 0x00, 0x3d, 0xff, 0x71, 0x00, 0x84, 0xff, 0x7e, 0x00, 0xaa, 0x00, 
-0x75, 0xff, 0x0f, 0x01, 0xe1, 0xfe, 0xbe, 0xff, 0x5c, 0x00, 0x2d, 0xff, 0x3b, 0x00, 0x3c, 0x00, 
-0xc7, 0xff, 0x49, 0x00, 0xaf, 0x00, 0xac, 0xff, 0x63, 0x00, 0x56, 0xff, 0x90, 0xff, 0xdb, 0xff, 
-0x6a, 0xfe, 0x98, 0x00, 0xa5, 0xfe, 0x1e, 0xff, 0x49, 0x00, 0xa9, 0xfe, 0xb9, 0x00, 0x64, 0x00, 
-0x05, 0x00, 0x26, 0x01, 0x93, 0x00, 0xd4, 0xff, 0xb2, 0x00, 0x87, 0x00, 0xcf, 0x00, 0x1a, 0x01, 
-0x17, 0x01, 0x3e, 0x01, 0x74, 0x01, 0x51, 0x01, 0x50, 0x00, 0x7c, 0x01, 0xc3, 0xff, 0x93, 0xff, 
-0xf9, 0xff, 0x92, 0xfe, 0x95, 0xff, 0xa6, 0xfe, 0x01, 0xff, 0xc8, 0xfe, 0xf2, 0xfd, 0xb6, 0xfe, 
-0x75, 0xfd, 0x1f, 0xfe, 0xd8, 0xfd, 0x3a, 0xfd, 0xd6, 0xfd, 0xe5, 0xfc, 0x32, 0xfd, 0x4e, 0xfd, 
-0xab, 0xfd, 0x29, 0xfe, 0xe3, 0xfe, 0xf1, 0xff, 0x4a, 0x00, 0x71, 0x01, 0xbb, 0x02, 0x12, 0x02, 
-0x3b, 0x04, 0xc6, 0x04, 0x4c, 0x04, 0x58, 0x07, 0xff, 0x05, 0x4b, 0x07, 0x6e, 0x07, 0x5c, 0x06, 
-0xad, 0x07, 0x8c, 0x05, 0x79, 0x05, 0x6e, 0x04, 0x1d, 0x03, 0x25, 0x02, 0x2a, 0x00, 0x15, 0xff, 
-0x95, 0xfc, 0x45, 0xfb, 0xa5, 0xf9, 0x65, 0xf7, 0xb4, 0xf6, 0x24, 0xf6, 0xa9, 0xf4, 0xdd, 0xf4, 
-0x86, 0xf4, 0x3f, 0xf4, 0x3c, 0xf4, 0xad, 0xf2, 0x08, 0xf6, 0xd4, 0xf4, 0xa6, 0xf7, 0xf6, 0xfc, 
-0x41, 0xfc, 0x4f, 0x03, 0x91, 0x06, 0x70, 0x07, 0x76, 0x0d, 0xc0, 0x0d, 0xa8, 0x0d, 0xd0, 0x10, 
-0x34, 0x0e, 0xae, 0x0d, 0xde, 0x0d, 0xd5, 0x0a, 0x06, 0x0a, 0xab, 0x08, 0x26, 0x06, 0xb1, 0x04, 
-0x78, 0x03, 0xe3, 0x00, 0x93, 0x00, 0x14, 0xff, 0x5c, 0xfe, 0x99, 0xfe, 0x27, 0xfd, 0x02, 0xfd, 
-0x15, 0xfd, 0x5e, 0xfb, 0x70, 0xfa, 0xf2, 0xf9, 0xc5, 0xf7, 0xe4, 0xf5, 0x97, 0xf5, 0x64, 0xf2, 
-0x46, 0xef, 0xb1, 0xf0, 0x75, 0xec, 0x47, 0xef, 0x00, 0xf2, 0xa7, 0xf1, 0x66, 0xfa, 0x75, 0xfb, 
-0x5e, 0x00, 0x23, 0x07, 0x5e, 0x07, 0x6b, 0x0d, 0xe0, 0x0e, 0xd6, 0x0e, 0xab, 0x11, 0x89, 0x0f, 
-0xfb, 0x0f, 0x09, 0x0f, 0x0c, 0x0d, 0x8e, 0x0c, 0x6e, 0x09, 0xb9, 0x07, 0xd7, 0x04, 0x82, 0x03, 
-0xd1, 0x00, 0xcd, 0xff, 0x32, 0x00, 0x82, 0xfd, 0x40, 0xff, 0xc9, 0xfe, 0xb2, 0xfe, 0x04, 0x00, 
-0x17, 0xff, 0x65, 0xff, 0x05, 0xfe, 0xdf, 0xfc, 0x7c, 0xfb, 0x7e, 0xf7, 0xf3, 0xf5, 0x98, 0xf0, 
-0xb2, 0xec, 0x36, 0xec, 0x7a, 0xe8, 0xea, 0xea, 0xdf, 0xed, 0x0f, 0xf0, 0xca, 0xf5, 0xc9, 0xfb, 
-0x37, 0xff, 0x04, 0x06, 0x66, 0x0b, 0x36, 0x0d, 0x0b, 0x12, 0xad, 0x12, 0x79, 0x12, 0x9b, 0x13, 
-0x0e, 0x12, 0x67, 0x10, 0xa1, 0x0f, 0x7b, 0x0b, 0xf3, 0x08, 0x2f, 0x06, 0x52, 0x02, 0x0a, 0x01, 
-0x4b, 0xff, 0x36, 0xfd, 0x50, 0xfd, 0xf5, 0xfc, 0x93, 0xfc, 0x60, 0xfe, 0x27, 0xfe, 0xb9, 0xff, 
-0x2c, 0xff, 0x36, 0xff, 0xf5, 0xfe, 0xf9, 0xfc, 0xf0, 0xfb, 0xc5, 0xf7, 0xe9, 0xf3, 0x34, 0xf0, 
-0x81, 0xeb, 0x76, 0xea, 0xb7, 0xea, 0x09, 0xeb, 0xe8, 0xf0, 0x05, 0xf4, 0x2e, 0xf9, 0x50, 0x00, 
-0xc8, 0x03, 0x4a, 0x0a, 0x23, 0x0e, 0x22, 0x10, 0x82, 0x12, 0x67, 0x12, 0xc1, 0x12, 0xa3, 0x12, 
-0x23, 0x11, 0x67, 0x0f, 0x03, 0x0d, 0x0c, 0x09, 0xf7, 0x05, 0xf5, 0x02, 0xd0, 0xff, 0x2e, 0xff, 
-0xa1, 0xfc, 0x0b, 0xfc, 0x11, 0xfc, 0x4e, 0xfb, 0xd5, 0xfc, 0x5f, 0xfd, 0xdf, 0xfd, 0xcd, 0xfe, 
-0xe3, 0xfe, 0x4d, 0xfe, 0x97, 0xfe, 0x80, 0xfb, 0x73, 0xf9, 0x95, 0xf5, 0x99, 0xef, 0x64, 0xee, 
-0x68, 0xea, 0x08, 0xea, 0x53, 0xee, 0xa8, 0xee, 0x27, 0xf4, 0xe5, 0xfa, 0xf6, 0xfb, 0x0d, 0x05, 
-0x18, 0x09, 0x5a, 0x0a, 0x40, 0x12, 0x07, 0x10, 0x78, 0x12, 0xfc, 0x15, 0x9a, 0x11, 0x6d, 0x14, 
-0xa3, 0x11, 0xb9, 0x0c, 0xe3, 0x0b, 0x49, 0x06, 0x75, 0x03, 0xf2, 0x01, 0xf1, 0xfe, 0x66, 0xfd, 
-0x30, 0xfc, 0x5a, 0xfb, 0x9c, 0xfa, 0xf7, 0xfb, 0x1b, 0xfc, 0x9c, 0xfc, 0xb5, 0xfe, 0xfb, 0xfd, 
-0x4f, 0xff, 0x33, 0xff, 0x58, 0xfc, 0x7a, 0xfb, 0x1c, 0xf6, 0xc8, 0xf0, 0xf4, 0xee, 0x75, 0xe9, 
-0x88, 0xea, 0x09, 0xec, 0x0c, 0xed, 0x76, 0xf3, 0xbf, 0xf6, 0x58, 0xfb, 0x00, 0x02, 0xf5, 0x05, 
-0xc9, 0x0a, 0x57, 0x0f, 0xe7, 0x10, 0x54, 0x13, 0x17, 0x15, 0x7d, 0x14, 0x61, 0x14, 0x06, 0x13, 
-0x94, 0x0e, 0x22, 0x0c, 0x33, 0x08, 0xb4, 0x03, 0xf1, 0x02, 0x79, 0xff, 0x89, 0xfd, 0x37, 0xfd, 
-0x46, 0xfa, 0x52, 0xfb, 0x7a, 0xfb, 0x23, 0xfb, 0x24, 0xfe, 0xcb, 0xfd, 0xf2, 0xfe, 0xd6, 0x00, 
-0x3d, 0xff, 0xd8, 0xfe, 0x8d, 0xfc, 0xcf, 0xf7, 0xe3, 0xf2, 0x29, 0xef, 0xf4, 0xe9, 0x20, 0xe9, 
-0x49, 0xea, 0x66, 0xea, 0x92, 0xf0, 0x9c, 0xf3, 0x4e, 0xf8, 0x27, 0xff, 0x47, 0x02, 0x30, 0x09, 
-0xf7, 0x0c, 0x52, 0x0f, 0x42, 0x14, 0xbe, 0x13, 0xb7, 0x15, 0x5e, 0x16, 0x3f, 0x13, 0xfd, 0x12, 
-0x43, 0x0e, 0x3a, 0x0a, 0x8e, 0x07, 0xda, 0x02, 0x85, 0x01, 0xda, 0xfe, 0xaf, 0xfc, 0x64, 0xfc, 
-0x98, 0xfa, 0x18, 0xfb, 0xd0, 0xfb, 0x74, 0xfc, 0x19, 0xfe, 0x43, 0xff, 0x0c, 0x00, 0x42, 0x00, 
-0xda, 0xff, 0x9f, 0xfd, 0xa1, 0xfa, 0xab, 0xf5, 0x59, 0xf1, 0xff, 0xeb, 0x17, 0xe9, 0x54, 0xe9, 
-0x4a, 0xe8, 0x8b, 0xed, 0xa3, 0xf0, 0x5e, 0xf4, 0x91, 0xfb, 0x16, 0xfe, 0xc4, 0x04, 0xef, 0x09, 
-0xbe, 0x0b, 0xf5, 0x11, 0x66, 0x12, 0x56, 0x14, 0x2c, 0x17, 0xf1, 0x13, 0x38, 0x15, 0x36, 0x11, 
-0xfe, 0x0c, 0xd4, 0x0a, 0x75, 0x05, 0xf8, 0x03, 0x91, 0x00, 0x9d, 0xfe, 0x92, 0xfd, 0x0d, 0xfb, 
-0x72, 0xfc, 0xd4, 0xfa, 0x2e, 0xfc, 0x07, 0xfe, 0xf6, 0xfc, 0x03, 0x01, 0x9a, 0xff, 0x3e, 0x00, 
-0xa4, 0x00, 0xaa, 0xfb, 0x54, 0xfa, 0xd1, 0xf4, 0x07, 0xef, 0x3d, 0xec, 0xbb, 0xe8, 0x45, 0xe8, 
-0x52, 0xea, 0x97, 0xed, 0x86, 0xf1, 0xb2, 0xf6, 0x13, 0xfc, 0x38, 0x00, 0x91, 0x06, 0xb0, 0x0a, 
-0x87, 0x0d, 0x49, 0x12, 0x96, 0x12, 0x38, 0x15, 0x9a, 0x15, 0xf6, 0x13, 0x89, 0x13, 0xa0, 0x0e, 
-0x28, 0x0c, 0x12, 0x08, 0xbc, 0x04, 0x14, 0x03, 0x28, 0xff, 0xcc, 0xfe, 0x93, 0xfc, 0x65, 0xfb, 
-0xe4, 0xfc, 0x18, 0xfb, 0xb6, 0xfd, 0x6a, 0xfe, 0xb1, 0xfe, 0x9f, 0x01, 0xaf, 0x00, 0x50, 0x01, 
-0xf5, 0xff, 0x76, 0xfc, 0xc1, 0xf9, 0x3c, 0xf4, 0xfa, 0xef, 0xa6, 0xeb, 0xd1, 0xe8, 0x85, 0xe9, 
-0x75, 0xe9, 0x5f, 0xee, 0xf5, 0xf1, 0xbb, 0xf5, 0xe2, 0xfc, 0x24, 0x00, 0x85, 0x06, 0x90, 0x0b, 
-0x0e, 0x0e, 0x9c, 0x12, 0xd7, 0x13, 0xe9, 0x14, 0x1d, 0x16, 0x1f, 0x14, 0x41, 0x12, 0x42, 0x0f, 
-0xa2, 0x0a, 0xba, 0x07, 0x78, 0x04, 0xa0, 0x01, 0x34, 0xff, 0xee, 0xfd, 0x9a, 0xfb, 0x64, 0xfb, 
-0xc3, 0xfb, 0xd7, 0xfa, 0x6c, 0xfd, 0x2d, 0xfe, 0xf9, 0xfe, 0x94, 0x01, 0x59, 0x01, 0xe4, 0x00, 
-0xba, 0x00, 0xda, 0xfc, 0xbf, 0xf9, 0xb6, 0xf5, 0x46, 0xf0, 0x53, 0xec, 0x7c, 0xe9, 0xf4, 0xe8, 
-0x59, 0xe9, 0x7c, 0xed, 0x6b, 0xf1, 0xbf, 0xf4, 0x90, 0xfb, 0x8d, 0xff, 0x02, 0x05, 0x2f, 0x0b, 
-0x67, 0x0d, 0xc9, 0x11, 0xf5, 0x13, 0x35, 0x14, 0xa8, 0x16, 0xce, 0x14, 0xed, 0x12, 0xc1, 0x10, 
-0x94, 0x0b, 0xb3, 0x08, 0x32, 0x05, 0xc9, 0x01, 0xd5, 0xff, 0x84, 0xfd, 0xae, 0xfb, 0xdc, 0xfa, 
-0xf3, 0xfa, 0xaa, 0xfa, 0x47, 0xfc, 0x78, 0xfd, 0x72, 0xfe, 0xec, 0x00, 0xcc, 0x00, 0x83, 0x01, 
-0x40, 0x00, 0xca, 0xfd, 0x9d, 0xfa, 0xac, 0xf5, 0x1b, 0xf2, 0x5e, 0xec, 0xb1, 0xe9, 0x9c, 0xe9, 
-0xed, 0xe7, 0x3b, 0xed, 0x34, 0xf1, 0xf9, 0xf2, 0x75, 0xfb, 0x48, 0xfe, 0x9d, 0x03, 0x07, 0x0b, 
-0x0c, 0x0c, 0x41, 0x11, 0xd5, 0x13, 0xe1, 0x13, 0xcf, 0x16, 0xf9, 0x15, 0x99, 0x13, 0xbf, 0x11, 
-0x9c, 0x0d, 0x23, 0x09, 0xdc, 0x06, 0x5e, 0x03, 0x33, 0x00, 0x0f, 0xff, 0x87, 0xfc, 0xf0, 0xfa, 
-0x1b, 0xfc, 0xb2, 0xfa, 0xfa, 0xfb, 0x51, 0xfe, 0xd4, 0xfd, 0xeb, 0x00, 0xa1, 0x01, 0x2f, 0x01, 
-0xd3, 0x00, 0x26, 0xfe, 0xcc, 0xfa, 0x67, 0xf6, 0x6b, 0xf2, 0x2c, 0xed, 0x8c, 0xe9, 0x04, 0xe9, 
-0xb7, 0xe7, 0x29, 0xeb, 0x1a, 0xf0, 0xec, 0xf1, 0xf8, 0xf8, 0xb0, 0xfd, 0x9d, 0x01, 0x15, 0x0a, 
-0x05, 0x0c, 0xf4, 0x0f, 0x9b, 0x14, 0xc4, 0x13, 0xc3, 0x16, 0xef, 0x16, 0x4d, 0x14, 0xf1, 0x12, 
-0xbb, 0x0e, 0x31, 0x0b, 0xf8, 0x07, 0x9d, 0x04, 0x1b, 0x02, 0x35, 0xff, 0x8b, 0xfd, 0x2e, 0xfc, 
-0x88, 0xfb, 0xf5, 0xfb, 0xef, 0xfb, 0xb6, 0xfd, 0x45, 0xfe, 0xc1, 0xff, 0x8b, 0x01, 0xe9, 0x00, 
-0xa0, 0x00, 0x16, 0xfe, 0x21, 0xfb, 0xad, 0xf6, 0xff, 0xf2, 0x85, 0xee, 0x5a, 0xe9, 0xe4, 0xe8, 
-0x6c, 0xe7, 0x45, 0xe8, 0x2f, 0xee, 0x77, 0xf0, 0x58, 0xf5, 0x31, 0xfc, 0xb1, 0xff, 0xc1, 0x06, 
-0x55, 0x0b, 0x2f, 0x0e, 0xca, 0x12, 0x3c, 0x14, 0xc3, 0x15, 0xe5, 0x16, 0xd5, 0x15, 0xa0, 0x13, 
-0x70, 0x10, 0x31, 0x0d, 0xb4, 0x08, 0xe9, 0x05, 0xb6, 0x02, 0x94, 0xff, 0x03, 0xfe, 0xfb, 0xfb, 
-0x84, 0xfb, 0xe7, 0xfb, 0xd1, 0xfb, 0xfa, 0xfc, 0xc1, 0xfe, 0x5e, 0xff, 0x76, 0x01, 0x65, 0x02, 
-0x56, 0x01, 0x39, 0x00, 0x9d, 0xfd, 0x47, 0xf9, 0xe8, 0xf5, 0x18, 0xf1, 0xc3, 0xeb, 0x54, 0xe9, 
-0x9c, 0xe7, 0x27, 0xe8, 0x6f, 0xeb, 0x57, 0xf0, 0xb3, 0xf3, 0x89, 0xf9, 0x0f, 0x00, 0x18, 0x04, 
-0x6b, 0x0a, 0x34, 0x0e, 0xf3, 0x10, 0x62, 0x14, 0x5b, 0x15, 0xad, 0x16, 0x31, 0x16, 0x21, 0x14, 
-0x86, 0x11, 0x81, 0x0d, 0x46, 0x0a, 0xac, 0x06, 0xbc, 0x03, 0x40, 0x01, 0x63, 0xfe, 0xa7, 0xfc, 
-0xe6, 0xfb, 0x01, 0xfb, 0x9f, 0xfb, 0x94, 0xfc, 0x18, 0xfd, 0xea, 0xfe, 0x7c, 0x00, 0x48, 0x01, 
-0xc9, 0x01, 0xbc, 0x00, 0x82, 0xfe, 0x87, 0xfb, 0xf4, 0xf6, 0x26, 0xf3, 0xcf, 0xed, 0xc8, 0xe8, 
-0x57, 0xe7, 0xf7, 0xe6, 0xd7, 0xe7, 0x3e, 0xed, 0x9a, 0xf1, 0x7e, 0xf4, 0x17, 0xfc, 0x49, 0x01, 
-0xe4, 0x05, 0x25, 0x0c, 0x75, 0x0f, 0x63, 0x12, 0x15, 0x15, 0xf8, 0x16, 0x17, 0x17, 0x5b, 0x16, 
-0xec, 0x14, 0x8a, 0x10, 0x85, 0x0d, 0x62, 0x0a, 0x82, 0x06, 0xef, 0x03, 0xab, 0x00, 0x31, 0xfe, 
-0x86, 0xfc, 0x5c, 0xfb, 0x78, 0xfb, 0xb2, 0xfb, 0x6b, 0xfc, 0x27, 0xfe, 0x99, 0xff, 0x00, 0x01, 
-0xca, 0x01, 0x84, 0x01, 0x69, 0xff, 0xe8, 0xfc, 0x82, 0xf9, 0x04, 0xf5, 0xb3, 0xf0, 0xbd, 0xeb, 
-0x4c, 0xe8, 0xe0, 0xe7, 0x85, 0xe8, 0x20, 0xeb, 0xf8, 0xf0, 0x15, 0xf4, 0x5b, 0xf8, 0xae, 0xff, 
-0x70, 0x04, 0xfb, 0x08, 0x06, 0x0e, 0x3e, 0x11, 0xbe, 0x12, 0xf1, 0x14, 0x74, 0x16, 0x80, 0x15, 
-0x09, 0x14, 0x87, 0x11, 0x97, 0x0d, 0x13, 0x0a, 0x2c, 0x07, 0xbd, 0x03, 0xf1, 0x00, 0xb4, 0xfe, 
-0x7b, 0xfc, 0x0a, 0xfc, 0x54, 0xfb, 0xad, 0xfb, 0xbf, 0xfc, 0xe8, 0xfc, 0x58, 0xff, 0xfe, 0x00, 
-0x3c, 0x01, 0x55, 0x02, 0xb0, 0x00, 0x0d, 0xfe, 0x8f, 0xfb, 0x0a, 0xf7, 0x12, 0xf3, 0x90, 0xee, 
-0xb7, 0xe9, 0x53, 0xe7, 0x04, 0xe8, 0x04, 0xe9, 0x44, 0xec, 0xc4, 0xf1, 0x80, 0xf5, 0xa1, 0xfa, 
-0x27, 0x01, 0x42, 0x07, 0x7e, 0x0b, 0x3c, 0x0f, 0x07, 0x13, 0x85, 0x14, 0xf4, 0x15, 0xe9, 0x16, 
-0x35, 0x16, 0x03, 0x14, 0x3d, 0x10, 0x3e, 0x0d, 0xbd, 0x09, 0xc0, 0x05, 0x2b, 0x03, 0x5a, 0x00, 
-0xf2, 0xfd, 0xa4, 0xfc, 0x15, 0xfc, 0x15, 0xfc, 0xe2, 0xfb, 0xdd, 0xfc, 0x03, 0xfe, 0xf8, 0xfe, 
-0xc7, 0x00, 0x6b, 0x01, 0x72, 0x01, 0x10, 0x00, 0x02, 0xfe, 0xad, 0xfb, 0xb4, 0xf7, 0xc7, 0xf3, 
-0xde, 0xef, 0xa2, 0xeb, 0xe5, 0xe8, 0xd8, 0xe8, 0x23, 0xea, 0x8e, 0xec, 0x6d, 0xf0, 0xe2, 0xf4, 
-0xb3, 0xf9, 0x93, 0xff, 0xdf, 0x04, 0x35, 0x09, 0x25, 0x0d, 0xff, 0x0f, 0x4d, 0x12, 0xf2, 0x13, 
-0xe3, 0x14, 0x60, 0x14, 0x9b, 0x12, 0x4b, 0x10, 0x79, 0x0d, 0x26, 0x0b, 0x92, 0x08, 0x3e, 0x06, 
-0x8e, 0x04, 0x77, 0x02, 0x0e, 0x01, 0x13, 0x00, 0xff, 0xfe, 0x4a, 0xfe, 0xe3, 0xfd, 0xcb, 0xfd, 
-0x28, 0xfe, 0x4b, 0xfe, 0x6a, 0xfe, 0x2a, 0xfe, 0xd0, 0xfc, 0x4a, 0xfb, 0x7a, 0xf9, 0xbd, 0xf6, 
-0x28, 0xf3, 0xda, 0xef, 0x91, 0xec, 0x6d, 0xe9, 0x82, 0xe8, 0x5a, 0xe9, 0x37, 0xeb, 0x89, 0xee, 
-0x51, 0xf2, 0x5e, 0xf7, 0x34, 0xfd, 0x51, 0x02, 0xc9, 0x07, 0x8a, 0x0c, 0x44, 0x10, 0x7c, 0x13, 
-0xc9, 0x15, 0x1e, 0x17, 0x77, 0x16, 0x7a, 0x14, 0xf4, 0x11, 0x3b, 0x0e, 0xc7, 0x0a, 0xef, 0x07, 
-0xee, 0x04, 0x47, 0x02, 0x03, 0x00, 0x65, 0xfe, 0x57, 0xfd, 0x92, 0xfc, 0xf1, 0xfc, 0xcd, 0xfd, 
-0xf7, 0xfe, 0xe5, 0x00, 0x56, 0x02, 0x45, 0x03, 0x14, 0x03, 0xc7, 0x01, 0xe4, 0xff, 0xb6, 0xfc, 
-0xfc, 0xf8, 0xbf, 0xf4, 0xfc, 0xef, 0x76, 0xec, 0xfc, 0xe9, 0x1f, 0xe9, 0x95, 0xea, 0x80, 0xed, 
-0xd6, 0xf1, 0x64, 0xf6, 0x85, 0xfb, 0xa4, 0x01, 0x9e, 0x06, 0x89, 0x0a, 0x40, 0x0e, 0xfa, 0x10, 
-0x08, 0x13, 0x1a, 0x14, 0xba, 0x13, 0x46, 0x12, 0xa9, 0x0f, 0x72, 0x0c, 0xc6, 0x08, 0x80, 0x05, 
-0x30, 0x03, 0x99, 0x00, 0x6e, 0xfe, 0x24, 0xfd, 0x58, 0xfc, 0x1d, 0xfc, 0xef, 0xfb, 0xa8, 0xfc, 
-0xfe, 0xfd, 0x6a, 0xff, 0x6a, 0x01, 0x32, 0x03, 0x85, 0x04, 0x93, 0x04, 0x2f, 0x03, 0x69, 0x01, 
-0x53, 0xfe, 0x1c, 0xfa, 0xde, 0xf5, 0x61, 0xf1, 0x53, 0xed, 0xa3, 0xea, 0x54, 0xe9, 0xd0, 0xe9, 
-0x8c, 0xec, 0x39, 0xf0, 0xa3, 0xf4, 0x0f, 0xfa, 0xca, 0xff, 0x67, 0x05, 0xc3, 0x09, 0x8b, 0x0d, 
-0xfc, 0x10, 0x20, 0x13, 0x16, 0x14, 0x1a, 0x14, 0x04, 0x13, 0x77, 0x10, 0x27, 0x0d, 0x71, 0x09, 
-0x11, 0x06, 0x41, 0x03, 0xb7, 0x00, 0x94, 0xfe, 0x04, 0xfd, 0x61, 0xfc, 0xef, 0xfb, 0x24, 0xfc, 
-0x13, 0xfd, 0xd8, 0xfd, 0x49, 0xff, 0x17, 0x01, 0xcc, 0x02, 0x64, 0x04, 0x90, 0x04, 0xbc, 0x03, 
-0xc4, 0x01, 0x44, 0xfe, 0x5f, 0xfa, 0xfd, 0xf5, 0x62, 0xf1, 0x0b, 0xed, 0x28, 0xea, 0x02, 0xe9, 
-0x66, 0xe9, 0xdd, 0xeb, 0x7d, 0xef, 0x5f, 0xf4, 0x96, 0xf9, 0x25, 0xff, 0x7c, 0x05, 0x8d, 0x0a, 
-0xba, 0x0e, 0x34, 0x12, 0x81, 0x14, 0xb1, 0x15, 0x5e, 0x15, 0xc5, 0x13, 0x3b, 0x11, 0x77, 0x0d, 
-0x45, 0x09, 0x9e, 0x05, 0x87, 0x02, 0xe8, 0xff, 0x7f, 0xfd, 0xf9, 0xfb, 0x38, 0xfb, 0xe6, 0xfa, 
-0x29, 0xfb, 0x07, 0xfc, 0x21, 0xfd, 0x7f, 0xfe, 0x6b, 0x00, 0x58, 0x02, 0x0f, 0x04, 0xd4, 0x04, 
-0x50, 0x04, 0xbf, 0x02, 0xea, 0xff, 0xe4, 0xfb, 0x2b, 0xf7, 0x43, 0xf2, 0xa4, 0xed, 0x3e, 0xea, 
-0x6e, 0xe8, 0x63, 0xe8, 0x5b, 0xea, 0xee, 0xed, 0x9a, 0xf2, 0xe8, 0xf7, 0x04, 0xfe, 0x58, 0x04, 
-0xc7, 0x09, 0x84, 0x0e, 0xb1, 0x12, 0x5d, 0x15, 0x81, 0x16, 0x6c, 0x16, 0xed, 0x14, 0x13, 0x12, 
-0x45, 0x0e, 0x36, 0x0a, 0x28, 0x06, 0xcc, 0x02, 0xed, 0xff, 0xad, 0xfd, 0x6a, 0xfc, 0x77, 0xfb, 
-0x5d, 0xfb, 0xf5, 0xfb, 0xc3, 0xfc, 0xd5, 0xfd, 0x52, 0xff, 0x0f, 0x01, 0xaf, 0x02, 0x3c, 0x04, 
-0xf3, 0x04, 0x6e, 0x04, 0xed, 0x02, 0x10, 0x00, 0x22, 0xfc, 0xbc, 0xf7, 0xde, 0xf2, 0x5b, 0xee, 
-0x28, 0xeb, 0x34, 0xe9, 0x09, 0xe9, 0x0d, 0xeb, 0x43, 0xee, 0xa6, 0xf2, 0xe2, 0xf7, 0x72, 0xfd, 
-0x9a, 0x03, 0x24, 0x09, 0xb5, 0x0d, 0xcc, 0x11, 0x8e, 0x14, 0xbe, 0x15, 0xc1, 0x15, 0x8e, 0x14, 
-0xfe, 0x11, 0x66, 0x0e, 0x4f, 0x0a, 0x38, 0x06, 0xb9, 0x02, 0xba, 0xff, 0x17, 0xfd, 0x77, 0xfb, 
-0x88, 0xfa, 0x0b, 0xfa, 0x87, 0xfa, 0x8e, 0xfb, 0xb3, 0xfc, 0x12, 0xfe, 0xc5, 0xff, 0x9f, 0x01, 
-0x45, 0x03, 0x38, 0x04, 0x10, 0x04, 0xd6, 0x02, 0x65, 0x00, 0xc8, 0xfc, 0xa5, 0xf8, 0x0e, 0xf4, 
-0x8c, 0xef, 0x1b, 0xec, 0xcc, 0xe9, 0x31, 0xe9, 0xae, 0xea, 0x7d, 0xed, 0xa9, 0xf1, 0xb2, 0xf6, 
-0x57, 0xfc, 0x9e, 0x02, 0x55, 0x08, 0x46, 0x0d, 0xb6, 0x11, 0xd2, 0x14, 0x62, 0x16, 0xaa, 0x16, 
-0x94, 0x15, 0x36, 0x13, 0xab, 0x0f, 0x6a, 0x0b, 0x18, 0x07, 0x22, 0x03, 0xaa, 0xff, 0xfb, 0xfc, 
-0x41, 0xfb, 0x34, 0xfa, 0xf6, 0xf9, 0x71, 0xfa, 0x71, 0xfb, 0xd5, 0xfc, 0x33, 0xfe, 0xaa, 0xff, 
-0x62, 0x01, 0xd4, 0x02, 0xc5, 0x03, 0xf6, 0x03, 0x3c, 0x03, 0x82, 0x01, 0xb3, 0xfe, 0x5b, 0xfb, 
-0x97, 0xf7, 0xa8, 0xf3, 0x68, 0xf0, 0xff, 0xed, 0xd6, 0xec, 0x43, 0xed, 0xf6, 0xee, 0x0b, 0xf2, 
-0xfc, 0xf5, 0x75, 0xfa, 0xbf, 0xff, 0xf6, 0x04, 0xa1, 0x09, 0xfb, 0x0d, 0x5d, 0x11, 0x88, 0x13, 
-0x63, 0x14, 0xda, 0x13, 0x4b, 0x12, 0x9f, 0x0f, 0x0a, 0x0c, 0x34, 0x08, 0x94, 0x04, 0x6a, 0x01, 
-0xb2, 0xfe, 0xac, 0xfc, 0x83, 0xfb, 0xbf, 0xfa, 0x83, 0xfa, 0x02, 0xfb, 0xd1, 0xfb, 0xf1, 0xfc, 
-0x31, 0xfe, 0x7d, 0xff, 0xfc, 0x00, 0x37, 0x02, 0xda, 0x02, 0xd9, 0x02, 0x09, 0x02, 0x53, 0x00, 
-0xe9, 0xfd, 0x1a, 0xfb, 0x0a, 0xf8, 0x04, 0xf5, 0x62, 0xf2, 0x7f, 0xf0, 0xa1, 0xef, 0xd6, 0xef, 
-0xdf, 0xf0, 0x00, 0xf3, 0x21, 0xf6, 0xaf, 0xf9, 0xd9, 0xfd, 0x23, 0x02, 0x68, 0x06, 0xf9, 0x09, 
-0x96, 0x0c, 0xb1, 0x0e, 0xa2, 0x0f, 0x97, 0x0f, 0xe9, 0x0e, 0x81, 0x0d, 0x6a, 0x0b, 0xe8, 0x08, 
-0x5a, 0x06, 0x0a, 0x04, 0xae, 0x01, 0xcc, 0xff, 0x53, 0xfe, 0x0d, 0xfd, 0x6f, 0xfc, 0x1c, 0xfc, 
-0x3b, 0xfc, 0xe4, 0xfc, 0xbd, 0xfd, 0xb9, 0xfe, 0xdc, 0xff, 0xd9, 0x00, 0x86, 0x01, 0xd0, 0x01, 
-0xd5, 0x01, 0x54, 0x01, 0x1c, 0x00, 0x96, 0xfe, 0xd0, 0xfc, 0x97, 0xfa, 0x82, 0xf8, 0xab, 0xf6, 
-0x0f, 0xf5, 0x0d, 0xf4, 0x72, 0xf3, 0xa4, 0xf3, 0xc5, 0xf4, 0x5b, 0xf6, 0xae, 0xf8, 0xaf, 0xfb, 
-0xdb, 0xfe, 0x44, 0x02, 0x6e, 0x05, 0x43, 0x08, 0xcf, 0x0a, 0x58, 0x0c, 0x14, 0x0d, 0x21, 0x0d, 
-0x7a, 0x0c, 0x1b, 0x0b, 0x19, 0x09, 0x01, 0x07, 0xfa, 0x04, 0xec, 0x02, 0x09, 0x01, 0x7a, 0xff, 
-0x30, 0xfe, 0x5a, 0xfd, 0xc0, 0xfc, 0x7b, 0xfc, 0xab, 0xfc, 0x33, 0xfd, 0x17, 0xfe, 0xf3, 0xfe, 
-0xaa, 0xff, 0x57, 0x00, 0xc2, 0x00, 0xfa, 0x00, 0xed, 0x00, 0x78, 0x00, 0xb0, 0xff, 0x9c, 0xfe, 
-0x56, 0xfd, 0x10, 0xfc, 0xdb, 0xfa, 0x82, 0xf9, 0x72, 0xf8, 0xcb, 0xf7, 0x61, 0xf7, 0xa5, 0xf7, 
-0x75, 0xf8, 0x99, 0xf9, 0x3c, 0xfb, 0x2b, 0xfd, 0x2d, 0xff, 0x4a, 0x01, 0x4b, 0x03, 0xed, 0x04, 
-0x62, 0x06, 0x70, 0x07, 0xe9, 0x07, 0x03, 0x08, 0xaf, 0x07, 0xf6, 0x06, 0x0f, 0x06, 0xe2, 0x04, 
-0xb0, 0x03, 0xb9, 0x02, 0x87, 0x01, 0x8e, 0x00, 0xd9, 0xff, 0x75, 0xff, 0x34, 0xff, 0x19, 0xff, 
-0x41, 0xff, 0x5a, 0xff, 0xc4, 0xff, 0x23, 0x00, 0x7e, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x21, 0x01, 
-0x3d, 0x01, 0xf7, 0x00, 0xa5, 0x00, 0x06, 0x00, 0xef, 0xfe, 0xfe, 0xfd, 0xbd, 0xfc, 0x7b, 0xfb, 
-0x75, 0xfa, 0x95, 0xf9, 0xd9, 0xf8, 0xc3, 0xf8, 0xfb, 0xf8, 0x7e, 0xf9, 0x7d, 0xfa, 0xa7, 0xfb, 
-0x21, 0xfd, 0x94, 0xfe, 0x3a, 0x00, 0x19, 0x02, 0x55, 0x03, 0xac, 0x06, 0x6e, 0x0c, 0x51, 0x0c, 
-0x3a, 0x0a, 0x16, 0x09, 0xb0, 0x06, 0x92, 0x05, 0x91, 0x03, 0x22, 0x03, 0x8e, 0x01, 0x58, 0xff, 
-0xad, 0xff, 0xc8, 0xfe, 0x75, 0xfe, 0x7f, 0xfe, 0x5a, 0xfe, 0x22, 0xff, 0x8f, 0xfe, 0x72, 0xff, 
-0xb9, 0x00, 0xcb, 0xff, 0xec, 0xff, 0x3f, 0xff, 0xff, 0xfe, 0x86, 0xfd, 0xc8, 0xfb, 0x01, 0xfb, 
-0x3a, 0xf9, 0xdc, 0xf7, 0xb8, 0xf7, 0xb1, 0xf7, 0xd1, 0xf8, 0x0e, 0xfa, 0x2a, 0xfb, 0xea, 0xfd, 
-0x6c, 0xff, 0xce, 0x01, 0xc4, 0x03, 0xf5, 0x04, 0xd4, 0x06, 0xd3, 0x06, 0xee, 0x06, 0x3b, 0x07, 
-0x1c, 0x06, 0xdf, 0x05, 0x26, 0x05, 0xbd, 0x03, 0x09, 0x03, 0x4a, 0x02, 0x37, 0x02, 0x42, 0x02, 
-0x3d, 0x01, 0x6c, 0x01, 0x84, 0x01, 0x92, 0x01, 0x45, 0x02, 0xc2, 0x01, 0xe5, 0x02, 0xa4, 0x02, 
-0xe5, 0x01, 0x86, 0x02, 0x2c, 0x00, 0x18, 0xff, 0x83, 0xfc, 0x1b, 0xfa, 0xa6, 0xf7, 0x0e, 0xf4, 
-0x6b, 0xf1, 0x45, 0xf0, 0x1e, 0xf1, 0xd2, 0xf1, 0xd7, 0xf5, 0xdb, 0xf8, 0xfc, 0xfc, 0x5c, 0x02, 
-0x38, 0x05, 0x43, 0x09, 0xe8, 0x0b, 0xfd, 0x0b, 0x91, 0x0c, 0xe6, 0x0a, 0x80, 0x08, 0x87, 0x06, 
-0x38, 0x03, 0x48, 0x01, 0x41, 0xff, 0xbe, 0xfd, 0x46, 0xff, 0x82, 0xfe, 0x06, 0xff, 0x4f, 0x02, 
-0x5c, 0x02, 0x73, 0x04, 0x3f, 0x06, 0x16, 0x06, 0x37, 0x08, 0x1a, 0x06, 0x8c, 0x05, 0x7b, 0x06, 
-0x0f, 0x02, 0x47, 0x01, 0x7e, 0xff, 0x1c, 0xfc, 0xd8, 0xfa, 0xcf, 0xf5, 0xf6, 0xf3, 0x2d, 0xf0, 
-0x02, 0xea, 0x03, 0xec, 0x8d, 0xea, 0x85, 0xed, 0xce, 0xf5, 0xdd, 0xf7, 0xae, 0x00, 0x6b, 0x07, 
-0xed, 0x09, 0xa5, 0x0f, 0xfb, 0x0e, 0xc6, 0x0f, 0xb1, 0x0e, 0x95, 0x08, 0x63, 0x07, 0xc1, 0x02, 
-0x75, 0xfe, 0xc2, 0xfd, 0xc2, 0xfa, 0x22, 0xfc, 0x52, 0xfd, 0x09, 0xfe, 0x5a, 0x02, 0xce, 0x03, 
-0x71, 0x06, 0x69, 0x09, 0x1f, 0x09, 0x50, 0x0a, 0xf8, 0x08, 0xa8, 0x06, 0x0d, 0x05, 0x68, 0x02, 
-0x49, 0x01, 0x72, 0xfe, 0xa1, 0xfd, 0xc5, 0xfc, 0xb8, 0xf8, 0x59, 0xf6, 0xdf, 0xf3, 0xb4, 0xee, 
-0x7e, 0xea, 0xdf, 0xea, 0x20, 0xeb, 0x31, 0xf0, 0x03, 0xf8, 0xc4, 0xfb, 0xc3, 0x03, 0x3d, 0x0a, 
-0xf7, 0x0c, 0xe7, 0x10, 0xec, 0x10, 0xe2, 0x10, 0xd9, 0x0d, 0xff, 0x07, 0xd9, 0x05, 0x06, 0x00, 
-0x1e, 0xfc, 0xee, 0xfa, 0x5d, 0xf8, 0xd2, 0xf9, 0xdb, 0xfa, 0xec, 0xfc, 0xc8, 0x01, 0x34, 0x05, 
-0x8d, 0x09, 0xbe, 0x0c, 0xe9, 0x0d, 0xd4, 0x0f, 0x8f, 0x0d, 0x53, 0x0a, 0x93, 0x08, 0x6f, 0x04, 
-0xa4, 0x00, 0x46, 0xfc, 0xd6, 0xf7, 0xf4, 0xf4, 0xbf, 0xef, 0xc3, 0xe9, 0x7f, 0xe6, 0x20, 0xe4, 
-0x51, 0xe5, 0xcf, 0xe8, 0x64, 0xed, 0xc7, 0xf5, 0xc4, 0xfb, 0xdc, 0x01, 0x88, 0x09, 0x36, 0x0e, 
-0x24, 0x12, 0x92, 0x14, 0x5d, 0x15, 0xcf, 0x13, 0xc7, 0x0f, 0x6b, 0x0b, 0xd7, 0x06, 0x15, 0x01, 
-0x6a, 0xfc, 0xc1, 0xf9, 0x32, 0xf6, 0xd3, 0xf5, 0xb5, 0xf6, 0x92, 0xf8, 0x9d, 0xfc, 0x8e, 0x00, 
-0x3f, 0x07, 0x65, 0x0a, 0x52, 0x0c, 0x57, 0x11, 0x80, 0x10, 0x61, 0x0c, 0x57, 0x0c, 0xa2, 0x08, 
-0x80, 0x01, 0xd5, 0xfc, 0xec, 0xf8, 0xc4, 0xf4, 0xc1, 0xed, 0x81, 0xea, 0xdf, 0xe6, 0x5b, 0xe3, 
-0x14, 0xe6, 0x79, 0xe7, 0xb0, 0xec, 0xc2, 0xf4, 0x77, 0xfa, 0x02, 0x01, 0x2b, 0x09, 0x35, 0x0e, 
-0x5b, 0x11, 0x15, 0x16, 0x90, 0x16, 0x0e, 0x15, 0x57, 0x13, 0xb2, 0x0e, 0x32, 0x0a, 0x8b, 0x05, 
-0xf6, 0xff, 0x4a, 0xfc, 0x17, 0xf9, 0x55, 0xf6, 0x61, 0xf6, 0x7b, 0xf7, 0x44, 0xf9, 0x81, 0xfd, 
-0x7b, 0x03, 0x41, 0x07, 0xf3, 0x09, 0xa4, 0x0e, 0x8b, 0x0f, 0xb8, 0x0c, 0x1d, 0x0c, 0x1e, 0x0a, 
-0x5c, 0x04, 0x9c, 0xff, 0xd3, 0xfc, 0x3f, 0xf8, 0xbb, 0xf2, 0xdc, 0xee, 0xfd, 0xea, 0x59, 0xe6, 
-0xb1, 0xe5, 0x13, 0xe8, 0x9c, 0xe9, 0x56, 0xee, 0xdf, 0xf4, 0xae, 0xfa, 0x14, 0x01, 0x5e, 0x07, 
-0xb7, 0x0c, 0x3c, 0x11, 0xd4, 0x13, 0xc3, 0x14, 0x9c, 0x14, 0xde, 0x11, 0x17, 0x0f, 0x73, 0x0b, 
-0x80, 0x06, 0xe8, 0x02, 0xbe, 0xfe, 0x05, 0xfb, 0xdf, 0xf8, 0x67, 0xf7, 0xcf, 0xf7, 0xd3, 0xf8, 
-0x1d, 0xfc, 0x8f, 0x00, 0xac, 0x02, 0x97, 0x06, 0x5e, 0x0a, 0x65, 0x0a, 0x6d, 0x0a, 0x77, 0x0b, 
-0xb0, 0x08, 0xec, 0x04, 0x77, 0x02, 0x38, 0xfe, 0x03, 0xfa, 0x57, 0xf5, 0x5f, 0xf1, 0xb1, 0xed, 
-0xbb, 0xea, 0x4c, 0xea, 0xe6, 0xea, 0x94, 0xed, 0xcd, 0xf0, 0x45, 0xf4, 0xa2, 0xf9, 0x5b, 0xfe, 
-0x24, 0x02, 0x0f, 0x07, 0x5d, 0x0b, 0x1a, 0x0e, 0xbd, 0x0f, 0xb5, 0x10, 0x83, 0x10, 0xbf, 0x0e, 
-0xc8, 0x0c, 0x53, 0x0a, 0x18, 0x07, 0xae, 0x03, 0x13, 0x01, 0x0f, 0xff, 0xe6, 0xfc, 0x85, 0xfb, 
-0x61, 0xfc, 0x8e, 0xfd, 0xad, 0xfd, 0xe8, 0xff, 0x3f, 0x02, 0x18, 0x03, 0x20, 0x04, 0x49, 0x04, 
-0x13, 0x04, 0x6b, 0x03, 0xdb, 0x01, 0x1b, 0x00, 0xb5, 0xfe, 0x31, 0xfd, 0x5e, 0xfb, 0xb6, 0xf9, 
-0xfb, 0xf7, 0xd4, 0xf6, 0x16, 0xf6, 0xc4, 0xf5, 0x9b, 0xf5, 0x53, 0xf6, 0x9e, 0xf7, 0x0b, 0xf8, 
-0xc5, 0xf9, 0xfc, 0xfb, 0x48, 0xfd, 0x5d, 0xff, 0xc1, 0x01, 0x68, 0x03, 0x34, 0x05, 0xb9, 0x06, 
-0xb8, 0x07, 0x76, 0x08, 0x52, 0x08, 0xea, 0x07, 0x32, 0x07, 0x8c, 0x06, 0x99, 0x05, 0x27, 0x04, 
-0xfd, 0x03, 0xa5, 0x03, 0x82, 0x02, 0x4a, 0x02, 0x0c, 0x02, 0xc1, 0x01, 0xc5, 0x01, 0x5f, 0x01, 
-0x6c, 0x01, 0x96, 0x01, 0x35, 0x01, 0x05, 0x01, 0xc8, 0x00, 0x1c, 0x00, 0x84, 0xff, 0x1e, 0xff, 
-0x4e, 0xfe, 0x21, 0xfd, 0x3d, 0xfc, 0x5f, 0xfb, 0x0a, 0xfa, 0x11, 0xf9, 0xe8, 0xf8, 0x64, 0xf8, 
-0x20, 0xf8, 0x9a, 0xf8, 0xce, 0xf8, 0x53, 0xf9, 0x4c, 0xfa, 0x22, 0xfb, 0x70, 0xfc, 0x1a, 0xfe, 
-0x3f, 0xff, 0x92, 0x00, 0xcb, 0x01, 0xbe, 0x02, 0xce, 0x03, 0x76, 0x04, 0x34, 0x05, 0xcf, 0x05, 
-0x46, 0x06, 0xd0, 0x06, 0xc9, 0x06, 0xc6, 0x06, 0x9e, 0x06, 0x15, 0x06, 0xbe, 0x05, 0x2f, 0x05, 
-0xa5, 0x04, 0x0b, 0x04, 0x57, 0x03, 0xb2, 0x02, 0xcc, 0x01, 0xe3, 0x00, 0xce, 0xff, 0xf5, 0xfe, 
-0x2e, 0xfe, 0x87, 0xfd, 0x00, 0xfd, 0x52, 0xfc, 0x14, 0xfc, 0xbd, 0xfb, 0x2c, 0xfb, 0xe1, 0xfa, 
-0xbb, 0xfa, 0x5e, 0xfa, 0x21, 0xfa, 0x54, 0xfa, 0x44, 0xfa, 0x59, 0xfa, 0xcb, 0xfa, 0x33, 0xfb, 
-0xdb, 0xfb, 0x78, 0xfc, 0x3e, 0xfd, 0x5e, 0xfe, 0x71, 0xff, 0x82, 0x00, 0x98, 0x01, 0xc5, 0x02, 
-0xa8, 0x03, 0x6b, 0x04, 0x32, 0x05, 0xb1, 0x05, 0x08, 0x06, 0x36, 0x06, 0x34, 0x06, 0x30, 0x06, 
-0x41, 0x06, 0xcd, 0x05, 0x5c, 0x05, 0x31, 0x05, 0x82, 0x04, 0xe2, 0x03, 0x65, 0x03, 0xa8, 0x02, 
-0xd8, 0x01, 0x1a, 0x01, 0x4e, 0x00, 0x6e, 0xff, 0xa9, 0xfe, 0xe6, 0xfd, 0x28, 0xfd, 0xbe, 0xfc, 
-0x5c, 0xfc, 0xbd, 0xfb, 0xac, 0xfb, 0xaa, 0xfb, 0x6c, 0xfb, 0x5c, 0xfb, 0x55, 0xfb, 0x48, 0xfb, 
-0x2a, 0xfb, 0x17, 0xfb, 0x05, 0xfb, 0x42, 0xfb, 0x82, 0xfb, 0xd5, 0xfb, 0x6a, 0xfc, 0x08, 0xfd, 
-0xde, 0xfd, 0xba, 0xfe, 0xa8, 0xff, 0x90, 0x00, 0x80, 0x01, 0x6f, 0x02, 0x08, 0x03, 0xb2, 0x03, 
-0x65, 0x04, 0xbc, 0x04, 0x03, 0x05, 0x39, 0x05, 0x41, 0x05, 0x44, 0x05, 0x1c, 0x05, 0xd8, 0x04, 
-0x95, 0x04, 0x42, 0x04, 0xc2, 0x03, 0x37, 0x03, 0xb7, 0x02, 0x0a, 0x02, 0x40, 0x01, 0x94, 0x00, 
-0xea, 0xff, 0x39, 0xff, 0xad, 0xfe, 0x3c, 0xfe, 0xe2, 0xfd, 0x98, 0xfd, 0x58, 0xfd, 0x37, 0xfd, 
-0x29, 0xfd, 0x2d, 0xfd, 0x1c, 0xfd, 0x06, 0xfd, 0xfc, 0xfc, 0xd8, 0xfc, 0x9b, 0xfc, 0x78, 0xfc, 
-0x5f, 0xfc, 0x30, 0xfc, 0x26, 0xfc, 0x46, 0xfc, 0x72, 0xfc, 0xba, 0xfc, 0x3b, 0xfd, 0xdc, 0xfd, 
-0x98, 0xfe, 0x75, 0xff, 0x56, 0x00, 0x38, 0x01, 0x19, 0x02, 0xdd, 0x02, 0x86, 0x03, 0x14, 0x04, 
-0x7e, 0x04, 0xc0, 0x04, 0xdc, 0x04, 0xe4, 0x04, 0xc9, 0x04, 0x8f, 0x04, 0x4e, 0x04, 0xf3, 0x03, 
-0x88, 0x03, 0x0d, 0x03, 0x88, 0x02, 0x01, 0x02, 0x76, 0x01, 0xf4, 0x00, 0x7f, 0x00, 0x19, 0x00, 
-0xc2, 0xff, 0x7a, 0xff, 0x3b, 0xff, 0xfd, 0xfe, 0xc8, 0xfe, 0x8d, 0xfe, 0x4d, 0xfe, 0x11, 0xfe, 
-0xcc, 0xfd, 0x80, 0xfd, 0x32, 0xfd, 0xe9, 0xfc, 0xa1, 0xfc, 0x60, 0xfc, 0x2f, 0xfc, 0x0f, 0xfc, 
-0x07, 0xfc, 0x1a, 0xfc, 0x46, 0xfc, 0x90, 0xfc, 0xf8, 0xfc, 0x7b, 0xfd, 0x0d, 0xfe, 0xb2, 0xfe, 
-0x61, 0xff, 0x11, 0x00, 0xba, 0x00, 0x53, 0x01, 0xdf, 0x01, 0x56, 0x02, 0xb9, 0x02, 0x09, 0x03, 
-0x44, 0x03, 0x6e, 0x03, 0x83, 0x03, 0x8a, 0x03, 0x89, 0x03, 0x7a, 0x03, 0x5e, 0x03, 0x3e, 0x03, 
-0x11, 0x03, 0xdb, 0x02, 0x9d, 0x02, 0x50, 0x02, 0x00, 0x02, 0xa5, 0x01, 0x40, 0x01, 0xda, 0x00, 
-0x71, 0x00, 0xff, 0xff, 0x8b, 0xff, 0x1a, 0xff, 0xaa, 0xfe, 0x3f, 0xfe, 0xdf, 0xfd, 0x87, 0xfd, 
-0x39, 0xfd, 0xf5, 0xfc, 0xc3, 0xfc, 0x9d, 0xfc, 0x8a, 0xfc, 0x87, 0xfc, 0x93, 0xfc, 0xb2, 0xfc, 
-0xde, 0xfc, 0x18, 0xfd, 0x69, 0xfd, 0xc4, 0xfd, 0x27, 0xfe, 0x89, 0xfe, 0xf4, 0xfe, 0x69, 0xff, 
-0xd7, 0xff, 0x3e, 0x00, 0x98, 0x00, 0xf6, 0x00, 0x48, 0x01, 0x85, 0x01, 0xc3, 0x01, 0xf7, 0x01, 
-0x1f, 0x02, 0x43, 0x02, 0x60, 0x02, 0x7b, 0x02, 0x8d, 0x02, 0x9c, 0x02, 0xa6, 0x02, 0xa5, 0x02, 
-0x96, 0x02, 0x7f, 0x02, 0x61, 0x02, 0x31, 0x02, 0xea, 0x01, 0x9c, 0x01, 0x3e, 0x01, 0xd8, 0x00, 
-0x70, 0x00, 0x00, 0x00, 0x8e, 0xff, 0x21, 0xff, 0xba, 0xfe, 0x5d, 0xfe, 0x17, 0xfe, 0xe2, 0xfd, 
-0xb6, 0xfd, 0x96, 0xfd, 0x89, 0xfd, 0x8c, 0xfd, 0x9d, 0xfd, 0xc4, 0xfd, 0xef, 0xfd, 0x25, 0xfe, 
-0x62, 0xfe, 0xa6, 0xfe, 0xfd, 0xfe, 0x4e, 0xff, 0x97, 0xff, 0xe3, 0xff, 0x21, 0x00, 0x52, 0x00, 
-0x80, 0x00, 0xac, 0x00, 0xd4, 0x00, 0xff, 0x00, 0x1d, 0x01, 0x3f, 0x01, 0x54, 0x01, 0x4e, 0x01, 
-0x58, 0x01, 0x61, 0x01, 0x6c, 0x01, 0x63, 0x01, 0x4e, 0x01, 0x35, 0x01, 0x18, 0x01, 0x02, 0x01, 
-0xe6, 0x00, 0xc9, 0x00, 0xb9, 0x00, 0xaf, 0x00, 0x66, 0x00, 0x15, 0x00, 0xd4, 0xff, 0xb7, 0xff, 
-0xc7, 0xff, 0x9c, 0xff, 0x64, 0xff, 0x16, 0xff, 0xf2, 0xfe, 0x06, 0xff, 0x13, 0xff, 0x0f, 0xff, 
-0xf5, 0xfe, 0xd8, 0xfe, 0xd2, 0xfe, 0xf1, 0xfe, 0xdc, 0xfe, 0xd1, 0xfe, 0x03, 0xff, 0x57, 0xff, 
-0x6f, 0xff, 0x7b, 0xff, 0xa9, 0xff, 0xc5, 0xff, 0x42, 0x00, 0x8c, 0x00, 0x84, 0x00, 0x6a, 0x00, 
-0x8e, 0x00, 0x83, 0x00, 0x7c, 0x00, 0xec, 0x00, 0xe6, 0x00, 0x3a, 0x04, 0xe0, 0x05, 0xea, 0x00, 
-0x4e, 0xfc, 0x46, 0xfd, 0x11, 0x02, 0x38, 0x03, 0xd9, 0xff, 0x0c, 0xfd, 0x0b, 0xfe, 0xb5, 0x00, 
-0x24, 0x01, 0x4d, 0xff, 0xef, 0xfd, 0x27, 0xff, 0x36, 0x01, 0x1f, 0x01, 0x83, 0xff, 0xe3, 0xfe, 
-0x1c, 0x00, 0x3a, 0x01, 0x78, 0x00, 0xc4, 0xfe, 0x76, 0xfe, 0xb5, 0xff, 0x78, 0x00, 0x0c, 0x00, 
-0x39, 0xff, 0xe2, 0xfe, 0x53, 0xff, 0xa3, 0xff, 0x60, 0xff, 0x1c, 0xff, 0x28, 0xff, 0xb1, 0xff, 
-0x05, 0x00, 0xed, 0xff, 0xda, 0xff, 0xef, 0xff, 0x02, 0x00, 0x21, 0x00, 0x57, 0x00, 0x6f, 0x00, 
-0xad, 0x00, 0xea, 0x00, 0xa5, 0x00, 0x47, 0x00, 0x4f, 0x00, 0xc5, 0x00, 0xca, 0x00, 0x13, 0x00, 
-0xa8, 0xff, 0x99, 0xff, 0x99, 0x00, 0x11, 0x01, 0x51, 0x00, 0x43, 0xff, 0x58, 0xfe, 0xb1, 0xff, 
-0x0e, 0x01, 0xa6, 0x00, 0xc8, 0xff, 0xf1, 0xfe, 0x30, 0x00, 0xfc, 0x04, 0x10, 0x07, 0xd1, 0x01, 
-0x9a, 0xfb, 0xf6, 0xfb, 0x90, 0x00, 0x2b, 0x02, 0x09, 0xff, 0x96, 0xfb, 0xea, 0xfc, 0x3e, 0x00, 
-0xbb, 0x01, 0xdd, 0xff, 0x3f, 0xfd, 0xb2, 0xfd, 0xa3, 0xff, 0xdb, 0x00, 0xb9, 0xfd, 0x08, 0xfd, 
-0xa1, 0x00, 0x7a, 0x02, 0x40, 0x03, 0x94, 0x02, 0x57, 0x03, 0x2d, 0x04, 0xd0, 0x02, 0x2c, 0x00, 
-0x7f, 0xfd, 0xda, 0xfc, 0x43, 0xfe, 0x2e, 0x00, 0xf2, 0x00, 0xba, 0xff, 0xf6, 0xfe, 0x45, 0xff, 
-0xd3, 0x00, 0xae, 0x03, 0xd2, 0x02, 0xa4, 0xfe, 0x94, 0xfb, 0x3f, 0xfd, 0xc8, 0x00, 0xa4, 0x01, 
-0x42, 0x00, 0xa9, 0xfe, 0xee, 0xfe, 0x90, 0xff, 0xc7, 0xff, 0x46, 0x00, 0x41, 0x00, 0x7f, 0x00, 
-0x09, 0x01, 0x0c, 0x02, 0x7a, 0x06, 0x4e, 0x0b, 0x3c, 0x08, 0xd6, 0xfd, 0x89, 0xf6, 0xca, 0xf8, 
-0xd3, 0xfe, 0xb9, 0xff, 0x5e, 0xfb, 0xee, 0xf8, 0xb9, 0xfc, 0x19, 0x01, 0x4f, 0x00, 0x28, 0xfc, 
-0xc3, 0xfb, 0x3d, 0x01, 0x34, 0x06, 0xe9, 0x05, 0xfe, 0x00, 0x73, 0xfd, 0x6f, 0xfe, 0x13, 0x01, 
-0x0a, 0x01, 0x72, 0xfe, 0x30, 0xfd, 0x25, 0xff, 0x23, 0x01, 0x19, 0x00, 0x0c, 0xfe, 0x24, 0xfd, 
-0x58, 0xfe, 0xbc, 0xff, 0xaa, 0x00, 0x57, 0x00, 0xf8, 0xfe, 0x1d, 0xff, 0x0c, 0x00, 0xd0, 0x00, 
-0x6d, 0x00, 0x53, 0xff, 0xcf, 0xfe, 0x08, 0x00, 0xf6, 0x00, 0xc7, 0x00, 0x39, 0x00, 0x51, 0xff, 
-0xab, 0x00, 0xbc, 0x01, 0x72, 0x00, 0x38, 0xff, 0x7b, 0xff, 0xcc, 0x00, 0xad, 0x01, 0xda, 0x00, 
-0x3f, 0xff, 0x01, 0xff, 0xe7, 0xff, 0xd1, 0x00, 0x1c, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x52, 0x00, 
-0xd9, 0xff, 0x3e, 0xff, 0x62, 0x00, 0xc0, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xee, 0xff, 0x58, 0x00, 
-0xe9, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x2c, 0x00, 0x58, 0x00, 0x82, 0x00, 0x00, 0x00, 0xf2, 0xff, 
-0xfe, 0xff, 0x61, 0x00, 0x92, 0x00, 0x73, 0x00, 0x80, 0x00, 0x52, 0x00, 0xb1, 0x00, 0x65, 0x01, 
-0x7c, 0x00, 0x5d, 0x00, 0x1f, 0x00, 0xd2, 0xff, 0x00, 0x01, 0x9f, 0x00, 0xbb, 0xff, 0x32, 0xff, 
-0x3f, 0xff, 0x33, 0x00, 0x09, 0x00, 0x70, 0xff, 0x78, 0xff, 0x81, 0xff, 0x6f, 0xff, 0x72, 0xff, 
-0xd6, 0xff, 0xd9, 0xff, 0x63, 0xff, 0x1a, 0xff, 0x79, 0xff, 0xcc, 0xff, 0xac, 0x00, 0xd5, 0x01, 
-0x4a, 0x01, 0x61, 0xff, 0x27, 0xff, 0x25, 0x00, 0xf1, 0xff, 0x7c, 0xff, 0x08, 0xff, 0x48, 0xff, 
-0xc6, 0xff, 0x17, 0x00, 0x5c, 0x00, 0x27, 0x00, 0x8b, 0xff, 0xbb, 0x00, 0x9b, 0x01, 0x69, 0x00, 
-0x79, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xd0, 0xff, 0xed, 0x00, 0x3c, 0x00, 0x53, 0xff, 0x2f, 0xff, 
-0xec, 0xff, 0xdd, 0x00, 0xfa, 0xff, 0x86, 0xfe, 0x2f, 0xff, 0xb8, 0xff, 0x86, 0xff, 0xf0, 0x00, 
-0xb3, 0x00, 0x0c, 0xff, 0x92, 0xff, 0xce, 0x01, 0x4b, 0x01, 0x7f, 0xfd, 0x9f, 0xfd, 0x27, 0x01, 
-0xb9, 0x01, 0xd1, 0xfe, 0x01, 0xfc, 0x74, 0xfd, 0x52, 0x00, 0xf7, 0x01, 0x4b, 0x00, 0x1c, 0xfd, 
-0xf7, 0xfc, 0x1e, 0x01, 0x15, 0x03, 0x1a, 0x01, 0xc5, 0xff, 0x48, 0xfe, 0xe2, 0xff, 0x62, 0x02, 
-0x95, 0x02, 0x4b, 0x00, 0xf9, 0xfd, 0x32, 0xfe, 0xa5, 0x01, 0x2e, 0x02, 0xc3, 0xfe, 0x1c, 0xfe, 
-0xcd, 0xfe, 0xc7, 0xff, 0x5f, 0x00, 0x4c, 0x01, 0x56, 0x00, 0xc9, 0xfe, 0x9f, 0xff, 0x12, 0x01, 
-0x6d, 0x01, 0xf5, 0x00, 0xb0, 0x00, 0xa5, 0xff, 0xa3, 0xff, 0x60, 0x01, 0x2e, 0x02, 0x37, 0x01, 
-0xbc, 0xff, 0x56, 0xff, 0xed, 0xff, 0xd2, 0x00, 0xd4, 0x01, 0xbb, 0x00, 0x38, 0xff, 0x7f, 0xfe, 
-0xac, 0x00, 0xa4, 0x01, 0xd5, 0xff, 0xc2, 0xfd, 0x3e, 0xfe, 0x22, 0x02, 0xdf, 0x00, 0x3e, 0xff, 
-0x9e, 0xfd, 0x15, 0xfe, 0x00, 0x00, 0x3b, 0xfe, 0x7b, 0xfd, 0xb4, 0xfe, 0xe0, 0xfe, 0xa2, 0xfc, 
-0x0b, 0xfc, 0xe8, 0xfb, 0x53, 0xfd, 0x90, 0xfe, 0x0c, 0xfe, 0x3b, 0xfe, 0x42, 0xff, 0xd3, 0x00, 
-0x1e, 0x02, 0xe3, 0x03, 0x4f, 0x04, 0xa5, 0x04, 0x09, 0x05, 0x6c, 0x05, 0x37, 0x07, 0xc1, 0x07, 
-0x70, 0x06, 0xbc, 0x04, 0x2c, 0x05, 0x40, 0x05, 0xe4, 0x02, 0x52, 0x02, 0xcc, 0x01, 0x3e, 0x00, 
-0x90, 0xff, 0x34, 0xfe, 0xd5, 0xfd, 0xac, 0xfd, 0x99, 0xfb, 0xc2, 0xf9, 0x78, 0xf8, 0x19, 0xf8, 
-0xf4, 0xf6, 0x8a, 0xf4, 0x7b, 0xf3, 0x44, 0xf4, 0x3a, 0xf5, 0x9c, 0xf5, 0xae, 0xf6, 0x42, 0xf9, 
-0x83, 0xfd, 0xba, 0x00, 0x54, 0x02, 0xa3, 0x04, 0x4c, 0x07, 0xd7, 0x0b, 0xe7, 0x0d, 0xb7, 0x0c, 
-0xbc, 0x0b, 0x86, 0x0a, 0xf8, 0x0b, 0x7d, 0x0b, 0x52, 0x08, 0xb0, 0x03, 0xe5, 0x01, 0xdb, 0x03, 
-0x00, 0x03, 0x86, 0x00, 0x57, 0xff, 0xff, 0x00, 0x6f, 0x02, 0x0f, 0x02, 0x03, 0x02, 0x69, 0x02, 
-0x3e, 0x01, 0xb9, 0xff, 0xf2, 0xfe, 0x60, 0xfe, 0x1e, 0xfb, 0xda, 0xf7, 0x54, 0xf5, 0x8f, 0xf2, 
-0xc8, 0xef, 0xe8, 0xed, 0xad, 0xee, 0x8c, 0xed, 0xde, 0xed, 0x14, 0xf2, 0x8e, 0xf7, 0x23, 0xfc, 
-0xe5, 0xff, 0x9f, 0x03, 0x04, 0x08, 0xe6, 0x0c, 0xcf, 0x0f, 0xb9, 0x10, 0x15, 0x10, 0x92, 0x0e, 
-0x00, 0x0d, 0x2e, 0x0b, 0x82, 0x08, 0x52, 0x04, 0x03, 0x01, 0x34, 0xff, 0x1c, 0xfe, 0x4c, 0xfe, 
-0xb7, 0xff, 0xf7, 0x00, 0x6c, 0x01, 0xad, 0x03, 0xe9, 0x06, 0xb6, 0x08, 0xc8, 0x08, 0x67, 0x08, 
-0xc9, 0x06, 0xae, 0x04, 0xfa, 0x03, 0x7b, 0x01, 0xc9, 0xfb, 0x59, 0xf7, 0xf5, 0xf4, 0xf3, 0xf2, 
-0xc6, 0xf0, 0x6e, 0xed, 0x21, 0xea, 0x22, 0xe8, 0xce, 0xe8, 0x24, 0xed, 0xf4, 0xf1, 0x6a, 0xf6, 
-0x76, 0xfa, 0x23, 0xff, 0x25, 0x06, 0xea, 0x0b, 0x61, 0x0f, 0xca, 0x10, 0x6c, 0x10, 0x9b, 0x0f, 
-0xb1, 0x0f, 0x5a, 0x0e, 0xfd, 0x09, 0x4d, 0x05, 0xc7, 0x01, 0xc4, 0xfe, 0xa2, 0xfd, 0x4d, 0xfd, 
-0xf7, 0xfb, 0xfb, 0xfb, 0x85, 0xfe, 0xfe, 0x02, 0x5e, 0x06, 0x89, 0x08, 0xc8, 0x0a, 0xd9, 0x0b, 
-0x44, 0x0c, 0x8b, 0x0b, 0x2e, 0x0a, 0x30, 0x07, 0xad, 0x02, 0xab, 0xff, 0xf1, 0xfb, 0x10, 0xf8, 
-0xc7, 0xf4, 0x1f, 0xf1, 0xf6, 0xee, 0x8d, 0xed, 0x55, 0xea, 0x94, 0xe7, 0x0d, 0xe8, 0x94, 0xeb, 
-0x52, 0xf1, 0x20, 0xf7, 0xae, 0xfb, 0x9d, 0xff, 0x27, 0x04, 0x4c, 0x0a, 0xb4, 0x0f, 0xa9, 0x11, 
-0x3a, 0x11, 0xcf, 0x0e, 0xee, 0x0c, 0x9b, 0x0c, 0x43, 0x0a, 0x78, 0x05, 0xff, 0xff, 0x61, 0xfc, 
-0xab, 0xfb, 0xf8, 0xfb, 0x5e, 0xfc, 0x36, 0xfc, 0x6b, 0xfd, 0x32, 0x01, 0xdf, 0x05, 0x9a, 0x0a, 
-0xca, 0x0c, 0x22, 0x0d, 0xdc, 0x0c, 0x1e, 0x0c, 0x05, 0x0b, 0x31, 0x08, 0x19, 0x04, 0xf4, 0xfe, 
-0x35, 0xfc, 0xed, 0xf9, 0x06, 0xf6, 0x81, 0xf3, 0x3c, 0xf1, 0x5b, 0xef, 0xf5, 0xeb, 0x03, 0xe8, 
-0x7b, 0xe8, 0x8e, 0xeb, 0x9a, 0xef, 0xcb, 0xf4, 0x1c, 0xfa, 0x79, 0xfe, 0x55, 0x02, 0x2e, 0x08, 
-0x6b, 0x0d, 0x40, 0x10, 0x5b, 0x11, 0x8b, 0x10, 0x8e, 0x0f, 0xa5, 0x0d, 0xa9, 0x0a, 0xcd, 0x06, 
-0xf4, 0x01, 0x6d, 0xfe, 0xe2, 0xfb, 0x63, 0xfa, 0xf6, 0xf9, 0x49, 0xfa, 0xff, 0xfb, 0x41, 0xfe, 
-0x9e, 0x02, 0xb6, 0x07, 0x50, 0x0b, 0xb0, 0x0d, 0xc1, 0x0e, 0xae, 0x0e, 0x06, 0x0d, 0x13, 0x0a, 
-0x0a, 0x06, 0xa1, 0x01, 0x82, 0xfd, 0x09, 0xfa, 0x37, 0xf7, 0x64, 0xf5, 0x70, 0xf3, 0x5f, 0xf0, 
-0x85, 0xed, 0xcb, 0xea, 0xde, 0xe7, 0x5d, 0xe7, 0xcc, 0xeb, 0x2c, 0xf2, 0x65, 0xf7, 0xb8, 0xfb, 
-0x4a, 0x00, 0xa0, 0x05, 0x00, 0x0b, 0x28, 0x0f, 0x31, 0x11, 0x24, 0x11, 0xf8, 0x0f, 0x3e, 0x0e, 
-0xe2, 0x0b, 0x61, 0x08, 0xb9, 0x03, 0x3c, 0xff, 0x2b, 0xfc, 0x25, 0xfb, 0x1f, 0xfb, 0xf0, 0xfa, 
-0xf4, 0xfa, 0xd1, 0xfc, 0xc5, 0x00, 0x68, 0x05, 0x85, 0x09, 0xdd, 0x0c, 0x19, 0x0f, 0xaf, 0x0f, 
-0xe5, 0x0e, 0x27, 0x0d, 0x95, 0x09, 0x45, 0x04, 0x63, 0xff, 0xff, 0xfb, 0x2b, 0xf9, 0x63, 0xf6, 
-0xcb, 0xf4, 0x4c, 0xf3, 0x22, 0xf1, 0x11, 0xef, 0x86, 0xeb, 0xbd, 0xe7, 0x67, 0xe7, 0x35, 0xeb, 
-0x09, 0xf2, 0xd8, 0xf8, 0x77, 0xfd, 0x70, 0x00, 0x81, 0x04, 0xa8, 0x0a, 0xc7, 0x0f, 0xb3, 0x11, 
-0xb0, 0x10, 0xe6, 0x0e, 0x25, 0x0d, 0x0a, 0x0b, 0x23, 0x08, 0x60, 0x03, 0xd3, 0xfd, 0x83, 0xfa, 
-0x64, 0xfa, 0xfd, 0xfa, 0xdd, 0xfa, 0xd8, 0xfa, 0xcf, 0xfc, 0x3b, 0x01, 0x33, 0x06, 0x47, 0x0a, 
-0x5d, 0x0d, 0x72, 0x0f, 0x06, 0x10, 0x51, 0x0f, 0x36, 0x0d, 0x12, 0x09, 0xfd, 0x03, 0xbc, 0xff, 
-0xd5, 0xfc, 0x81, 0xf9, 0xe0, 0xf5, 0xd0, 0xf3, 0x06, 0xf3, 0x35, 0xf2, 0xd7, 0xef, 0xb0, 0xeb, 
-0x08, 0xe7, 0x78, 0xe5, 0x3e, 0xea, 0xba, 0xf2, 0x19, 0xf9, 0x5a, 0xfc, 0x9d, 0xff, 0x18, 0x05, 
-0xa5, 0x0b, 0xc6, 0x10, 0x44, 0x12, 0x4d, 0x10, 0x4f, 0x0e, 0xb5, 0x0d, 0x4a, 0x0c, 0xf5, 0x07, 
-0xaf, 0x01, 0x35, 0xfd, 0xe3, 0xfb, 0xd8, 0xfb, 0x91, 0xfb, 0xed, 0xfa, 0x1f, 0xfb, 0x80, 0xfd, 
-0x4b, 0x02, 0xcf, 0x06, 0x7d, 0x09, 0x46, 0x0c, 0x62, 0x0f, 0x8b, 0x10, 0x2e, 0x0f, 0x4a, 0x0c, 
-0x11, 0x08, 0x7f, 0x03, 0x4f, 0x00, 0x99, 0xfd, 0xb1, 0xf9, 0xbc, 0xf5, 0x47, 0xf4, 0x6b, 0xf4, 
-0x05, 0xf3, 0xf7, 0xef, 0x8f, 0xeb, 0xa4, 0xe6, 0x6f, 0xe4, 0xf9, 0xe7, 0x10, 0xf0, 0x13, 0xf7, 
-0x13, 0xfb, 0x4d, 0xff, 0x08, 0x06, 0x4e, 0x0d, 0xe7, 0x11, 0xe5, 0x12, 0x5e, 0x11, 0x12, 0x0f, 
-0x8b, 0x0d, 0x9a, 0x0b, 0x57, 0x06, 0x4d, 0xff, 0x0f, 0xfb, 0x8d, 0xfa, 0x09, 0xfb, 0x95, 0xfa, 
-0xf7, 0xf9, 0x67, 0xfb, 0x71, 0xff, 0x56, 0x04, 0xeb, 0x07, 0xa9, 0x09, 0xff, 0x0b, 0xdf, 0x0f, 
-0xd4, 0x11, 0xbc, 0x0f, 0xfb, 0x0b, 0x8a, 0x08, 0xfe, 0x04, 0x0d, 0x01, 0x5e, 0xfd, 0x23, 0xfa, 
-0x6b, 0xf7, 0x1f, 0xf6, 0x5d, 0xf6, 0x13, 0xf6, 0x9b, 0xf3, 0x06, 0xf0, 0xc7, 0xea, 0xcf, 0xe5, 
-0x74, 0xe6, 0xd6, 0xec, 0x0c, 0xf4, 0x91, 0xf8, 0xc0, 0xfc, 0x02, 0x03, 0xbe, 0x09, 0x9d, 0x0e, 
-0x6e, 0x10, 0xbb, 0x0f, 0x86, 0x0e, 0xc3, 0x0d, 0xc6, 0x0b, 0xf6, 0x06, 0xae, 0x00, 0x05, 0xfc, 
-0xa1, 0xfa, 0x8f, 0xfa, 0xa7, 0xf9, 0xb3, 0xf8, 0x8e, 0xf9, 0x78, 0xfd, 0x7c, 0x03, 0xfe, 0x07, 
-0x5d, 0x09, 0x8d, 0x0a, 0x1f, 0x0e, 0xe2, 0x11, 0x6d, 0x11, 0xe2, 0x0c, 0xbb, 0x08, 0x92, 0x06, 
-0x35, 0x04, 0x57, 0x00, 0x37, 0xfc, 0x28, 0xf9, 0xd1, 0xf7, 0x3d, 0xf8, 0x67, 0xf8, 0x38, 0xf6, 
-0x7d, 0xf2, 0x2c, 0xee, 0xe7, 0xe8, 0x1c, 0xe5, 0x48, 0xe7, 0xef, 0xee, 0xd0, 0xf5, 0x83, 0xf9, 
-0xbd, 0xfd, 0x03, 0x05, 0xad, 0x0c, 0x16, 0x11, 0x05, 0x12, 0x22, 0x11, 0x5b, 0x10, 0xa4, 0x0f, 
-0x4b, 0x0c, 0xee, 0x05, 0x0e, 0x00, 0x6b, 0xfd, 0x8e, 0xfc, 0x02, 0xfb, 0x8e, 0xf9, 0x7c, 0xf9, 
-0x26, 0xfb, 0x9e, 0xfe, 0xc0, 0x02, 0xe7, 0x05, 0x92, 0x07, 0x9c, 0x09, 0x05, 0x0c, 0x85, 0x0c, 
-0xd4, 0x0a, 0xd1, 0x08, 0x75, 0x07, 0x87, 0x05, 0xd7, 0x02, 0x90, 0x00, 0xa6, 0xfe, 0xda, 0xfc, 
-0xd3, 0xfb, 0x12, 0xfb, 0x91, 0xf9, 0xd9, 0xf7, 0x6b, 0xf5, 0xe5, 0xf0, 0x91, 0xeb, 0xf6, 0xe7, 
-0xb3, 0xe5, 0x09, 0xe6, 0x58, 0xeb, 0x73, 0xf2, 0x31, 0xf7, 0x80, 0xfb, 0x55, 0x03, 0x64, 0x0d, 
-0xa9, 0x14, 0x92, 0x16, 0x95, 0x15, 0x90, 0x14, 0x2b, 0x13, 0xd1, 0x0e, 0x82, 0x07, 0x30, 0x01, 
-0x30, 0xfe, 0xce, 0xfb, 0xac, 0xf8, 0x52, 0xf7, 0x06, 0xf9, 0xcf, 0xfc, 0x66, 0x01, 0xc3, 0x04, 
-0xa6, 0x06, 0x38, 0x09, 0x48, 0x0c, 0x87, 0x0d, 0x50, 0x0b, 0x22, 0x08, 0xd5, 0x06, 0xd0, 0x05, 
-0x71, 0x03, 0xf0, 0xff, 0xee, 0xfc, 0x3a, 0xfc, 0x8c, 0xfc, 0x5f, 0xfb, 0x14, 0xf9, 0x58, 0xf7, 
-0xd4, 0xf5, 0x54, 0xf2, 0xf6, 0xec, 0x9e, 0xe8, 0x93, 0xe6, 0x95, 0xe7, 0x5a, 0xec, 0x4e, 0xf2, 
-0x80, 0xf6, 0x3a, 0xfb, 0x0e, 0x04, 0xd2, 0x0d, 0x17, 0x13, 0x16, 0x14, 0x5d, 0x14, 0x18, 0x15, 
-0x7e, 0x13, 0x11, 0x0e, 0x4c, 0x07, 0xaf, 0x02, 0x7e, 0xff, 0x67, 0xfb, 0xcd, 0xf7, 0x24, 0xf7, 
-0x78, 0xf9, 0xb3, 0xfc, 0xf5, 0xff, 0xf3, 0x03, 0xe5, 0x07, 0xff, 0x0a, 0xd8, 0x0c, 0xe5, 0x0c, 
-0x4f, 0x0c, 0x21, 0x0b, 0x44, 0x08, 0xbf, 0x04, 0xf7, 0x01, 0xec, 0xff, 0xa3, 0xfd, 0x5e, 0xfb, 
-0xb6, 0xfa, 0xcc, 0xfa, 0x46, 0xfa, 0x49, 0xf8, 0x41, 0xf5, 0xdf, 0xf2, 0x03, 0xf0, 0xe3, 0xeb, 
-0x71, 0xe8, 0x3b, 0xe7, 0xe7, 0xe9, 0xad, 0xef, 0x71, 0xf4, 0xc5, 0xf8, 0x69, 0x00, 0x42, 0x09, 
-0x5e, 0x0f, 0xa2, 0x12, 0x60, 0x15, 0x04, 0x17, 0xc4, 0x14, 0xaf, 0x0f, 0x93, 0x0a, 0x3c, 0x06, 
-0x87, 0x01, 0xec, 0xfb, 0x99, 0xf8, 0xb1, 0xf8, 0xf2, 0xf8, 0x12, 0xf9, 0x1e, 0xfc, 0x6c, 0x01, 
-0x4c, 0x05, 0x18, 0x08, 0x26, 0x0b, 0x05, 0x0d, 0x39, 0x0d, 0x50, 0x0c, 0x2e, 0x0a, 0x7a, 0x08, 
-0x5a, 0x06, 0xc3, 0x02, 0x57, 0x00, 0x1d, 0xff, 0x96, 0xfc, 0x2e, 0xfb, 0xf3, 0xfb, 0xdb, 0xfa, 
-0x54, 0xf8, 0x9b, 0xf6, 0xfc, 0xf3, 0x7a, 0xef, 0xec, 0xea, 0xd2, 0xe7, 0xd2, 0xe5, 0xb9, 0xe6, 
-0x99, 0xeb, 0x25, 0xf0, 0x6b, 0xf4, 0x2a, 0xfc, 0xc7, 0x05, 0x8b, 0x0c, 0x30, 0x11, 0xac, 0x15, 
-0x8c, 0x17, 0xf5, 0x16, 0x4f, 0x15, 0x77, 0x10, 0xca, 0x0a, 0x03, 0x06, 0xd3, 0xff, 0x88, 0xfb, 
-0xf6, 0xf9, 0xc0, 0xf7, 0x1f, 0xf8, 0x1d, 0xfc, 0x8b, 0xfe, 0x3a, 0x00, 0xf8, 0x04, 0xf2, 0x08, 
-0x27, 0x0a, 0x2f, 0x0c, 0x79, 0x0c, 0x4d, 0x0a, 0x85, 0x09, 0x02, 0x08, 0x6e, 0x04, 0xf3, 0x01, 
-0x1e, 0x00, 0xd4, 0xfd, 0x53, 0xfc, 0xb5, 0xfb, 0x7a, 0xfa, 0x6a, 0xf9, 0xd0, 0xf8, 0xef, 0xf6, 
-0x61, 0xf3, 0x65, 0xef, 0xbf, 0xec, 0x47, 0xea, 0xff, 0xe6, 0x62, 0xe8, 0x4d, 0xed, 0x47, 0xf0, 
-0x95, 0xf5, 0x82, 0xfe, 0x47, 0x05, 0xe6, 0x09, 0x4b, 0x10, 0xe6, 0x15, 0xfa, 0x16, 0xe8, 0x15, 
-0x39, 0x14, 0xc5, 0x10, 0x75, 0x0c, 0x0d, 0x07, 0x5e, 0x01, 0x8b, 0xfd, 0x07, 0xfb, 0x01, 0xf9, 
-0x1a, 0xf9, 0x57, 0xfa, 0xef, 0xfb, 0xd5, 0xff, 0x26, 0x04, 0x24, 0x06, 0xcb, 0x08, 0x64, 0x0b, 
-0xf6, 0x0a, 0x90, 0x0a, 0x4c, 0x0a, 0xdf, 0x07, 0x10, 0x05, 0x4c, 0x03, 0x37, 0x01, 0x7b, 0xfe, 
-0x10, 0xfd, 0xa4, 0xfc, 0x38, 0xfb, 0x52, 0xfa, 0x8b, 0xf9, 0x51, 0xf7, 0x8b, 0xf4, 0x2b, 0xf1, 
-0x23, 0xed, 0xac, 0xea, 0x75, 0xe8, 0x49, 0xe6, 0xe6, 0xe9, 0x50, 0xef, 0xbd, 0xf0, 0x61, 0xf7, 
-0x34, 0x01, 0xba, 0x05, 0xc7, 0x0c, 0xa3, 0x13, 0x23, 0x14, 0x8e, 0x16, 0x0d, 0x18, 0x82, 0x13, 
-0x41, 0x10, 0x74, 0x0d, 0x28, 0x07, 0xa5, 0x02, 0x66, 0xff, 0x06, 0xfb, 0xc1, 0xf9, 0x68, 0xf9, 
-0xa8, 0xf9, 0x16, 0xfd, 0x67, 0xff, 0xb6, 0x01, 0xda, 0x05, 0x08, 0x08, 0x3f, 0x0a, 0xe5, 0x0b, 
-0x8e, 0x0a, 0xa7, 0x0a, 0x5d, 0x0a, 0x6c, 0x06, 0x2d, 0x04, 0x96, 0x02, 0x9f, 0xff, 0xa5, 0xfe, 
-0x40, 0xfd, 0xfb, 0xfa, 0xe4, 0xf9, 0xba, 0xf7, 0x29, 0xf5, 0xe8, 0xf2, 0x8a, 0xef, 0xb6, 0xeb, 
-0x9a, 0xe8, 0xc5, 0xe6, 0xa0, 0xe6, 0xa5, 0xe9, 0x42, 0xed, 0xd1, 0xf0, 0x6f, 0xf8, 0xe1, 0xff, 
-0x40, 0x05, 0x49, 0x0d, 0x0e, 0x13, 0x0d, 0x15, 0xd9, 0x17, 0x10, 0x18, 0xe9, 0x14, 0x13, 0x12, 
-0x61, 0x0e, 0x03, 0x09, 0xd6, 0x03, 0x5b, 0x00, 0xf8, 0xfc, 0x9a, 0xf9, 0x17, 0xf9, 0x9c, 0xf9, 
-0x27, 0xfa, 0xbf, 0xfc, 0x5d, 0x00, 0xd9, 0x03, 0x12, 0x06, 0x7c, 0x08, 0x62, 0x0b, 0xcc, 0x0a, 
-0x6c, 0x0a, 0xc3, 0x0a, 0x7e, 0x07, 0x99, 0x05, 0xd8, 0x03, 0x76, 0xff, 0x51, 0xfe, 0x8a, 0xfc, 
-0xd8, 0xf8, 0xbc, 0xf8, 0x8b, 0xf6, 0x8d, 0xf3, 0x8a, 0xf3, 0x6b, 0xf0, 0x58, 0xed, 0x2a, 0xec, 
-0x6d, 0xe9, 0xda, 0xe8, 0xf9, 0xea, 0x81, 0xed, 0x24, 0xf1, 0xf6, 0xf5, 0x53, 0xfc, 0xb7, 0x02, 
-0xb3, 0x08, 0x42, 0x0f, 0xbb, 0x13, 0x4a, 0x16, 0xaf, 0x18, 0xdd, 0x17, 0x68, 0x15, 0x5c, 0x13, 
-0x16, 0x0e, 0x04, 0x09, 0x96, 0x05, 0x04, 0x00, 0x33, 0xfc, 0x00, 0xfb, 0x42, 0xf8, 0x97, 0xf7, 
-0xef, 0xfa, 0x2d, 0xfc, 0xb3, 0xfd, 0xd6, 0x02, 0xad, 0x04, 0xeb, 0x06, 0x57, 0x0a, 0xb5, 0x09, 
-0xa5, 0x0a, 0x27, 0x0a, 0xaa, 0x07, 0xe4, 0x06, 0x14, 0x03, 0xd8, 0x00, 0x60, 0xff, 0xcd, 0xfa, 
-0xd1, 0xf9, 0x54, 0xf8, 0xa3, 0xf4, 0x7f, 0xf4, 0x89, 0xf2, 0x33, 0xef, 0x59, 0xef, 0x1d, 0xec, 
-0xfe, 0xe8, 0xe7, 0xea, 0xb9, 0xe9, 0x9f, 0xeb, 0xd5, 0xf1, 0xb3, 0xf3, 0x24, 0xfa, 0x87, 0x01, 
-0x1b, 0x05, 0xa1, 0x0c, 0xb8, 0x11, 0x5d, 0x14, 0xb4, 0x18, 0x60, 0x18, 0x0a, 0x17, 0x25, 0x16, 
-0xce, 0x10, 0xeb, 0x0c, 0x2c, 0x09, 0xab, 0x02, 0x84, 0xff, 0x29, 0xfc, 0xc5, 0xf8, 0x3f, 0xf9, 
-0xa4, 0xf8, 0xca, 0xf9, 0xb4, 0xfd, 0x5c, 0xff, 0x9e, 0x02, 0xe9, 0x06, 0xaa, 0x08, 0x5b, 0x0a, 
-0xa7, 0x0b, 0xc3, 0x0a, 0xc1, 0x09, 0x0b, 0x08, 0xa3, 0x03, 0xb3, 0x01, 0xad, 0xfe, 0x24, 0xfa, 
-0x0c, 0xf9, 0xa2, 0xf6, 0xd4, 0xf4, 0x92, 0xf4, 0x18, 0xf3, 0x6b, 0xf2, 0xff, 0xf1, 0xf6, 0xef, 
-0x96, 0xed, 0x12, 0xed, 0xad, 0xec, 0x6a, 0xec, 0xd4, 0xef, 0x1b, 0xf2, 0x60, 0xf5, 0xd8, 0xfb, 
-0xa1, 0xff, 0x69, 0x06, 0xd1, 0x0c, 0xd3, 0x0f, 0x38, 0x15, 0x87, 0x17, 0x98, 0x16, 0xbe, 0x16, 
-0x13, 0x14, 0x4f, 0x0f, 0x42, 0x0c, 0x8b, 0x06, 0xcb, 0x01, 0xf9, 0xfe, 0xe7, 0xf9, 0xef, 0xf8, 
-0xad, 0xf8, 0x9c, 0xf7, 0xf0, 0xfa, 0xa5, 0xfc, 0x64, 0xff, 0xd6, 0x03, 0x36, 0x05, 0x20, 0x09, 
-0x58, 0x0a, 0x50, 0x0a, 0xf9, 0x0a, 0x98, 0x08, 0xdd, 0x07, 0x11, 0x04, 0x45, 0x01, 0xb2, 0xff, 
-0x65, 0xfa, 0x1a, 0xfa, 0x08, 0xf8, 0x56, 0xf4, 0xb1, 0xf6, 0xfd, 0xf3, 0x89, 0xf2, 0x88, 0xf4, 
-0xdd, 0xef, 0xfd, 0xef, 0xd9, 0xef, 0xf9, 0xeb, 0xc9, 0xee, 0xcb, 0xef, 0xa3, 0xf0, 0x24, 0xf6, 
-0xa8, 0xf9, 0xc7, 0xfe, 0x58, 0x05, 0x14, 0x0a, 0xcf, 0x0f, 0x8d, 0x13, 0x7a, 0x16, 0x5d, 0x17, 
-0x3b, 0x16, 0x20, 0x15, 0xc5, 0x10, 0x1e, 0x0d, 0x16, 0x09, 0xfe, 0x03, 0x0c, 0x00, 0x77, 0xfc, 
-0xdc, 0xf9, 0x46, 0xf8, 0x76, 0xf8, 0x09, 0xf9, 0xa3, 0xfa, 0x40, 0xfe, 0x42, 0x00, 0x54, 0x03, 
-0xa9, 0x06, 0x7a, 0x07, 0xba, 0x09, 0x87, 0x08, 0x99, 0x08, 0xd2, 0x07, 0x59, 0x03, 0x4b, 0x04, 
-0x4f, 0xff, 0x17, 0xfc, 0xeb, 0xfd, 0x2a, 0xf7, 0xaa, 0xf7, 0x59, 0xf8, 0x7a, 0xf2, 0x23, 0xf6, 
-0x0a, 0xf4, 0xab, 0xf0, 0x47, 0xf3, 0x31, 0xee, 0xad, 0xee, 0x60, 0xef, 0x7f, 0xed, 0x31, 0xf3, 
-0xca, 0xf3, 0x7f, 0xf7, 0x9b, 0xff, 0xa1, 0x00, 0x4b, 0x08, 0x19, 0x0f, 0xc3, 0x0e, 0x21, 0x16, 
-0x87, 0x17, 0x93, 0x14, 0x92, 0x17, 0xf6, 0x12, 0x7e, 0x0e, 0x82, 0x0d, 0xd5, 0x06, 0xff, 0x02, 
-0x65, 0x00, 0x2a, 0xfb, 0x3b, 0xfa, 0x62, 0xf8, 0xc3, 0xf7, 0x06, 0xfa, 0x2d, 0xfa, 0x2c, 0xfd, 
-0xf0, 0xff, 0x6f, 0x01, 0x60, 0x04, 0xdc, 0x05, 0x54, 0x06, 0x18, 0x07, 0xa3, 0x06, 0x5c, 0x05, 
-0xe1, 0x03, 0xf6, 0x01, 0x1b, 0x00, 0x2c, 0xfd, 0x17, 0xfc, 0xfb, 0xf9, 0x6a, 0xf7, 0xb1, 0xf7, 
-0x00, 0xf5, 0xf1, 0xf3, 0x5b, 0xf4, 0xad, 0xf1, 0x3e, 0xf1, 0xd5, 0xef, 0x20, 0xee, 0xbc, 0xef, 
-0x77, 0xef, 0x23, 0xf2, 0x62, 0xf5, 0x80, 0xf8, 0xb1, 0xfe, 0x7e, 0x02, 0x54, 0x08, 0xe2, 0x0d, 
-0xae, 0x10, 0x09, 0x15, 0xa6, 0x16, 0x74, 0x16, 0x84, 0x16, 0x6e, 0x13, 0xc1, 0x10, 0x1a, 0x0d, 
-0x83, 0x08, 0x0a, 0x05, 0x98, 0x00, 0x73, 0xfd, 0x16, 0xfb, 0x5f, 0xf9, 0xca, 0xf8, 0xf2, 0xf8, 
-0x59, 0xfa, 0x31, 0xfc, 0xd0, 0xfd, 0x82, 0x00, 0x59, 0x02, 0x4b, 0x03, 0xdb, 0x05, 0x09, 0x05, 
-0xd8, 0x04, 0xb5, 0x05, 0xfc, 0x01, 0x0e, 0x02, 0x4d, 0x00, 0xc2, 0xfc, 0x41, 0xfd, 0x3a, 0xfa, 
-0xdd, 0xf8, 0x23, 0xf9, 0xc7, 0xf6, 0xe4, 0xf6, 0x7a, 0xf6, 0x3e, 0xf5, 0xc4, 0xf4, 0x89, 0xf3, 
-0x03, 0xf2, 0xa6, 0xf0, 0x7c, 0xf2, 0x4d, 0xf2, 0x5e, 0xf3, 0x6d, 0xf8, 0x25, 0xfa, 0x74, 0xfe, 
-0x40, 0x05, 0x64, 0x07, 0xb1, 0x0c, 0xeb, 0x11, 0x7e, 0x11, 0x28, 0x15, 0x31, 0x15, 0xd4, 0x11, 
-0x51, 0x12, 0x04, 0x0e, 0x85, 0x09, 0xf1, 0x07, 0x0e, 0x02, 0x2a, 0xff, 0x76, 0xfd, 0x0c, 0xf9, 
-0xb4, 0xf9, 0x0e, 0xf9, 0x45, 0xf8, 0x3b, 0xfb, 0xa7, 0xfb, 0x8b, 0xfd, 0x63, 0x00, 0x42, 0x01, 
-0x7a, 0x03, 0xc6, 0x04, 0x97, 0x04, 0x42, 0x05, 0x05, 0x05, 0xc2, 0x03, 0x02, 0x03, 0xf0, 0x00, 
-0x84, 0xff, 0xf5, 0xfd, 0xd3, 0xfb, 0x0b, 0xfb, 0xae, 0xf8, 0x2c, 0xf8, 0x30, 0xf7, 0x22, 0xf5, 
-0xfd, 0xf5, 0x74, 0xf3, 0xdd, 0xf2, 0x5e, 0xf2, 0xc5, 0xef, 0x33, 0xf4, 0x73, 0xf3, 0xf6, 0xf4, 
-0x0f, 0xfc, 0x57, 0xfb, 0x09, 0x02, 0x4d, 0x08, 0xee, 0x07, 0xd6, 0x0f, 0x36, 0x12, 0x0d, 0x11, 
-0x09, 0x16, 0xda, 0x12, 0xd4, 0x10, 0x37, 0x11, 0xec, 0x0a, 0x43, 0x09, 0xea, 0x05, 0x65, 0x00, 
-0x32, 0xff, 0xf3, 0xfb, 0x6b, 0xf9, 0xf9, 0xf9, 0xa9, 0xf8, 0x7c, 0xf9, 0x15, 0xfc, 0xfb, 0xfb, 
-0xfe, 0xff, 0x88, 0x01, 0x9f, 0x02, 0x74, 0x06, 0xa2, 0x05, 0x36, 0x07, 0xa8, 0x07, 0x39, 0x05, 
-0x68, 0x04, 0x2c, 0x02, 0xc9, 0xfe, 0x90, 0xfc, 0x97, 0xf9, 0xdd, 0xf6, 0x6a, 0xf5, 0xdc, 0xf2, 
-0x9a, 0xf2, 0xbc, 0xf1, 0x8a, 0xf0, 0xb2, 0xf1, 0x9f, 0xf0, 0x88, 0xf0, 0x7d, 0xf2, 0x7b, 0xf2, 
-0x49, 0xf4, 0x6e, 0xf7, 0x3f, 0xf8, 0x61, 0xfc, 0xff, 0xff, 0x7b, 0x02, 0x8b, 0x08, 0xc2, 0x0a, 
-0x6b, 0x0e, 0x52, 0x12, 0x4b, 0x12, 0xb4, 0x14, 0x85, 0x13, 0xd2, 0x11, 0x78, 0x10, 0x6d, 0x0c, 
-0x7d, 0x09, 0xb6, 0x05, 0xbf, 0x01, 0x07, 0xff, 0x83, 0xfc, 0x5e, 0xfa, 0xd8, 0xf9, 0xdb, 0xf9, 
-0x99, 0xfa, 0x97, 0xfb, 0xab, 0xfe, 0x9d, 0xff, 0xa9, 0x01, 0x95, 0x05, 0xf1, 0x03, 0xb6, 0x07, 
-0x68, 0x07, 0x7a, 0x05, 0x5b, 0x07, 0x14, 0x03, 0x4a, 0x02, 0xf5, 0xff, 0xf0, 0xfb, 0x10, 0xfb, 
-0x95, 0xf7, 0x29, 0xf5, 0xa9, 0xf4, 0x71, 0xf2, 0x52, 0xf2, 0xfd, 0xf1, 0x5f, 0xf1, 0x84, 0xf1, 
-0xe5, 0xf0, 0x63, 0xf2, 0xda, 0xf1, 0xd6, 0xf4, 0x62, 0xf6, 0xa4, 0xf7, 0x28, 0xfd, 0x6c, 0xfd, 
-0xf0, 0x02, 0xa3, 0x06, 0x21, 0x08, 0x57, 0x0e, 0x05, 0x0f, 0x89, 0x11, 0x41, 0x13, 0xb7, 0x11, 
-0x6e, 0x11, 0x6f, 0x0f, 0x0b, 0x0d, 0xda, 0x09, 0xf8, 0x06, 0x8e, 0x03, 0xe7, 0x00, 0xa9, 0xfe, 
-0xdf, 0xfc, 0x2a, 0xfc, 0x6a, 0xfb, 0x1f, 0xfc, 0xf1, 0xfc, 0x0b, 0xff, 0x03, 0x00, 0xbd, 0x02, 
-0x21, 0x04, 0x77, 0x04, 0x44, 0x07, 0x0c, 0x06, 0xe5, 0x06, 0x65, 0x06, 0x17, 0x04, 0x7a, 0x03, 
-0x07, 0x00, 0x95, 0xfd, 0xd4, 0xfb, 0xdf, 0xf7, 0xb0, 0xf6, 0xf8, 0xf4, 0x63, 0xf2, 0xb7, 0xf3, 
-0x39, 0xf1, 0xfc, 0xf1, 0x54, 0xf2, 0x78, 0xf0, 0x38, 0xf3, 0x9b, 0xf1, 0xf0, 0xf3, 0x0f, 0xf6, 
-0xa1, 0xf6, 0x2b, 0xfb, 0x87, 0xfc, 0x9c, 0x00, 0x40, 0x04, 0x2a, 0x07, 0xab, 0x0b, 0xd9, 0x0d, 
-0x9b, 0x10, 0xe0, 0x11, 0x67, 0x12, 0x8a, 0x11, 0x34, 0x10, 0x75, 0x0e, 0xdf, 0x0a, 0xc6, 0x08, 
-0x2d, 0x05, 0x6d, 0x02, 0x3a, 0x00, 0x9b, 0xfd, 0xe6, 0xfc, 0x7e, 0xfb, 0x8d, 0xfb, 0xa7, 0xfd, 
-0x56, 0xfd, 0x0d, 0x00, 0xba, 0x02, 0xd8, 0x01, 0xb2, 0x06, 0xda, 0x05, 0x43, 0x06, 0xc0, 0x08, 
-0xe6, 0x04, 0x9b, 0x06, 0x2a, 0x03, 0xe8, 0x00, 0x95, 0xff, 0xec, 0xfa, 0x4c, 0xfa, 0x41, 0xf6, 
-0x0f, 0xf5, 0x76, 0xf3, 0xc2, 0xf1, 0x2c, 0xf2, 0xde, 0xf0, 0x6e, 0xf2, 0xa5, 0xf1, 0x09, 0xf2, 
-0x2e, 0xf3, 0x70, 0xf2, 0xba, 0xf5, 0x98, 0xf6, 0x21, 0xf8, 0x88, 0xfc, 0x4d, 0xfd, 0x5c, 0x01, 
-0x3e, 0x05, 0x4d, 0x06, 0x8f, 0x0b, 0x2c, 0x0d, 0x5f, 0x0e, 0x95, 0x11, 0x05, 0x10, 0xad, 0x10, 
-0xd7, 0x0f, 0xb8, 0x0c, 0x4e, 0x0c, 0xcd, 0x08, 0xd7, 0x05, 0xac, 0x04, 0x99, 0x00, 0xa5, 0xff, 
-0x76, 0xfe, 0x03, 0xfc, 0xbf, 0xfd, 0x11, 0xfc, 0x71, 0xfe, 0x13, 0x00, 0x8e, 0xff, 0xff, 0x04, 
-0x0c, 0x03, 0xad, 0x05, 0xb2, 0x07, 0xdb, 0x04, 0x1d, 0x08, 0x8c, 0x04, 0x66, 0x03, 0xb2, 0x02, 
-0xfe, 0xfd, 0xb0, 0xfd, 0xd3, 0xf9, 0xee, 0xf6, 0x38, 0xf6, 0x1c, 0xf3, 0xca, 0xf2, 0x62, 0xf2, 
-0xb0, 0xf0, 0xfb, 0xf1, 0x4f, 0xf1, 0x96, 0xf0, 0x7a, 0xf2, 0x3f, 0xf2, 0x01, 0xf4, 0x25, 0xf6, 
-0x9d, 0xf7, 0x9f, 0xfa, 0x3a, 0xfd, 0x7a, 0x00, 0xe8, 0x03, 0x7d, 0x07, 0x49, 0x0a, 0x4b, 0x0d, 
-0x5b, 0x0f, 0x65, 0x10, 0xd2, 0x11, 0xd3, 0x10, 0x06, 0x10, 0x85, 0x0e, 0xd5, 0x0b, 0x8d, 0x09, 
-0x61, 0x06, 0xd0, 0x03, 0x84, 0x01, 0x07, 0xff, 0xe9, 0xfd, 0x5b, 0xfc, 0x1c, 0xfc, 0xb1, 0xfd, 
-0xac, 0xfc, 0x9a, 0xff, 0xd9, 0x00, 0xb8, 0x00, 0x26, 0x05, 0x56, 0x03, 0x81, 0x05, 0x77, 0x06, 
-0x96, 0x03, 0xa5, 0x05, 0x08, 0x02, 0xde, 0x00, 0x4a, 0xff, 0xb2, 0xfb, 0xce, 0xfa, 0x55, 0xf7, 
-0x69, 0xf6, 0x9c, 0xf4, 0xdf, 0xf2, 0x7e, 0xf2, 0x7b, 0xf1, 0x77, 0xf1, 0x45, 0xf1, 0xc3, 0xf1, 
-0xf1, 0xf1, 0x2c, 0xf3, 0x38, 0xf4, 0x90, 0xf6, 0x33, 0xf9, 0x1b, 0xfb, 0x80, 0xff, 0xe7, 0x01, 
-0x4b, 0x05, 0x74, 0x09, 0x4a, 0x0b, 0x93, 0x0e, 0x5c, 0x10, 0xb5, 0x10, 0xfb, 0x11, 0xea, 0x10, 
-0x6f, 0x0f, 0x2c, 0x0e, 0x1d, 0x0b, 0x84, 0x08, 0xaf, 0x05, 0x01, 0x03, 0x4f, 0x00, 0x6e, 0xfe, 
-0x23, 0xfd, 0xd4, 0xfb, 0x62, 0xfc, 0xbb, 0xfb, 0x0b, 0xfe, 0x40, 0xff, 0xf4, 0xff, 0xc6, 0x03, 
-0x0a, 0x03, 0x1a, 0x06, 0x89, 0x06, 0xfc, 0x05, 0xb2, 0x07, 0xee, 0x03, 0xcb, 0x04, 0x66, 0x01, 
-0x7f, 0xfe, 0xba, 0xfd, 0x94, 0xf8, 0x18, 0xf8, 0x06, 0xf5, 0x7a, 0xf3, 0xac, 0xf2, 0x66, 0xf1, 
-0x95, 0xf1, 0x03, 0xf1, 0xc5, 0xf2, 0xe5, 0xf0, 0x2f, 0xf3, 0xc7, 0xf3, 0x99, 0xf3, 0x9e, 0xf8, 
-0x86, 0xf7, 0x1f, 0xfc, 0x10, 0xff, 0xf3, 0xff, 0x65, 0x06, 0x1e, 0x07, 0x10, 0x0b, 0x55, 0x0e, 
-0x8c, 0x0e, 0x63, 0x11, 0xe6, 0x10, 0x84, 0x10, 0xb1, 0x0f, 0x13, 0x0d, 0x12, 0x0b, 0x5d, 0x08, 
-0x28, 0x05, 0xaf, 0x02, 0x3b, 0x00, 0xb9, 0xfd, 0x10, 0xfd, 0x94, 0xfb, 0x7c, 0xfb, 0xdf, 0xfc, 
-0x43, 0xfc, 0x2e, 0xff, 0x69, 0x00, 0xfa, 0x00, 0x9d, 0x04, 0xd9, 0x03, 0xbe, 0x05, 0xa2, 0x06, 
-0xe8, 0x04, 0x39, 0x06, 0xa6, 0x03, 0x3a, 0x02, 0xe5, 0x00, 0x5a, 0xfd, 0x04, 0xfc, 0x30, 0xf9, 
-0xe6, 0xf6, 0xfb, 0xf5, 0xe7, 0xf3, 0x10, 0xf3, 0x33, 0xf3, 0xc3, 0xf1, 0xee, 0xf2, 0xcf, 0xf2, 
-0xe2, 0xf1, 0xb6, 0xf4, 0x2c, 0xf3, 0x68, 0xf6, 0xbe, 0xf8, 0x12, 0xf8, 0x9b, 0xfe, 0x89, 0xfe, 
-0x28, 0x02, 0x72, 0x07, 0x01, 0x07, 0xb0, 0x0c, 0xf1, 0x0d, 0xc3, 0x0e, 0xba, 0x11, 0xf1, 0x0f, 
-0x39, 0x10, 0x04, 0x0f, 0x14, 0x0c, 0x7b, 0x0a, 0x66, 0x07, 0x68, 0x04, 0x29, 0x02, 0x6b, 0xff, 
-0xbe, 0xfd, 0x70, 0xfc, 0x7e, 0xfb, 0x82, 0xfb, 0x91, 0xfb, 0x1a, 0xfd, 0x17, 0xfe, 0xc8, 0xff, 
-0xb8, 0x01, 0x09, 0x03, 0x8d, 0x04, 0x58, 0x05, 0x10, 0x06, 0x69, 0x05, 0x99, 0x05, 0x17, 0x04, 
-0xc5, 0x01, 0xe3, 0x00, 0x1b, 0xfd, 0x5a, 0xfb, 0x07, 0xf9, 0x04, 0xf6, 0x70, 0xf5, 0x42, 0xf3, 
-0x05, 0xf3, 0x65, 0xf2, 0x7c, 0xf2, 0xac, 0xf2, 0x6e, 0xf2, 0xed, 0xf3, 0x8e, 0xf3, 0x24, 0xf6, 
-0x23, 0xf7, 0x82, 0xf8, 0x43, 0xfc, 0xf9, 0xfc, 0xff, 0x00, 0xf9, 0x03, 0x21, 0x06, 0x12, 0x0a, 
-0xc0, 0x0b, 0x6f, 0x0e, 0x9e, 0x0f, 0x55, 0x10, 0x57, 0x10, 0xff, 0x0e, 0x09, 0x0e, 0x5f, 0x0b, 
-0x64, 0x09, 0x5d, 0x06, 0xd6, 0x03, 0xa9, 0x01, 0x32, 0xff, 0xff, 0xfd, 0x94, 0xfc, 0xa9, 0xfc, 
-0x9a, 0xfc, 0x35, 0xfd, 0xdc, 0xfe, 0x76, 0xff, 0x5f, 0x01, 0xaf, 0x02, 0x5f, 0x03, 0xd7, 0x04, 
-0xbf, 0x04, 0xab, 0x04, 0x85, 0x04, 0x32, 0x03, 0xde, 0x01, 0x76, 0x00, 0xba, 0xfd, 0x0e, 0xfc, 
-0x28, 0xfa, 0xce, 0xf7, 0x02, 0xf7, 0x53, 0xf5, 0xd1, 0xf4, 0x56, 0xf4, 0xf7, 0xf3, 0x73, 0xf4, 
-0x17, 0xf4, 0x7e, 0xf4, 0x8f, 0xf4, 0x1a, 0xf5, 0x2b, 0xf6, 0xed, 0xf6, 0x0c, 0xf9, 0x7d, 0xfa, 
-0x03, 0xfd, 0xc6, 0xff, 0x52, 0x02, 0xc1, 0x05, 0x1c, 0x08, 0x61, 0x0b, 0x1c, 0x0d, 0x84, 0x0e, 
-0xe6, 0x0f, 0x4b, 0x0f, 0x0f, 0x0f, 0xa6, 0x0d, 0xd0, 0x0b, 0xaf, 0x09, 0xfb, 0x06, 0xc0, 0x04, 
-0xd7, 0x01, 0x34, 0x00, 0x6d, 0xfe, 0x1f, 0xfd, 0x25, 0xfd, 0x33, 0xfc, 0x8e, 0xfd, 0xe1, 0xfd, 
-0xc9, 0xfe, 0xe4, 0x00, 0x0e, 0x01, 0xb4, 0x02, 0x93, 0x03, 0xfa, 0x03, 0x6d, 0x04, 0xf9, 0x03, 
-0x92, 0x03, 0xd2, 0x01, 0xf4, 0x00, 0xea, 0xfe, 0x89, 0xfc, 0x77, 0xfb, 0x99, 0xf8, 0x90, 0xf7, 
-0x41, 0xf6, 0xcd, 0xf4, 0xb4, 0xf4, 0x49, 0xf4, 0x5c, 0xf4, 0x8b, 0xf4, 0x9e, 0xf4, 0x77, 0xf4, 
-0xa5, 0xf5, 0x3b, 0xf6, 0x11, 0xf7, 0xab, 0xf9, 0x8c, 0xfa, 0xe1, 0xfc, 0x54, 0x00, 0x8a, 0x01, 
-0x59, 0x05, 0x35, 0x08, 0x9b, 0x09, 0x3b, 0x0d, 0x27, 0x0e, 0xb1, 0x0e, 0x27, 0x10, 0x7a, 0x0e, 
-0xd0, 0x0d, 0xbd, 0x0c, 0xa1, 0x09, 0xda, 0x07, 0x66, 0x05, 0xb4, 0x02, 0xb2, 0x00, 0xcc, 0xff, 
-0xcd, 0xfd, 0x73, 0xfd, 0xfe, 0xfd, 0xc8, 0xfc, 0xe4, 0xfe, 0x2f, 0xff, 0xa2, 0xff, 0xcb, 0x01, 
-0x08, 0x01, 0xbf, 0x02, 0x08, 0x03, 0x39, 0x02, 0x21, 0x03, 0x57, 0x01, 0xac, 0x00, 0x63, 0xff, 
-0xc0, 0xfd, 0xcc, 0xfb, 0xbc, 0xf9, 0x35, 0xf9, 0xd6, 0xf6, 0x86, 0xf6, 0x30, 0xf6, 0x07, 0xf5, 
-0x26, 0xf6, 0x16, 0xf6, 0xf6, 0xf5, 0xb5, 0xf6, 0x43, 0xf6, 0xd1, 0xf6, 0x2b, 0xf8, 0x7f, 0xf8, 
-0x1e, 0xfa, 0x4e, 0xfc, 0xf2, 0xfc, 0x18, 0x00, 0xaa, 0x02, 0xf4, 0x03, 0xd4, 0x07, 0x37, 0x09, 
-0x3f, 0x0b, 0x7c, 0x0d, 0x6c, 0x0d, 0x52, 0x0e, 0x1b, 0x0e, 0xcb, 0x0c, 0x89, 0x0b, 0xeb, 0x09, 
-0x8a, 0x07, 0x4d, 0x05, 0xd5, 0x03, 0x46, 0x01, 0x25, 0x00, 0x63, 0xff, 0xe1, 0xfd, 0xc4, 0xfe, 
-0x27, 0xfe, 0xa3, 0xfe, 0xc9, 0xff, 0xaf, 0xff, 0x33, 0x01, 0x80, 0x01, 0xc1, 0x01, 0x26, 0x02, 
-0x03, 0x02, 0xc2, 0x01, 0xaa, 0x00, 0x0c, 0x00, 0x63, 0xfe, 0xb4, 0xfc, 0xb3, 0xfb, 0x81, 0xf9, 
-0xd2, 0xf8, 0xe7, 0xf7, 0xe2, 0xf6, 0xe1, 0xf6, 0x4a, 0xf6, 0xdb, 0xf6, 0xd9, 0xf6, 0x7b, 0xf6, 
-0xce, 0xf6, 0xb1, 0xf6, 0x0c, 0xf7, 0xc3, 0xf7, 0x87, 0xf8, 0x09, 0xfa, 0x3a, 0xfb, 0x9d, 0xfd, 
-0x06, 0x00, 0x80, 0x01, 0xf1, 0x04, 0x7e, 0x07, 0x2c, 0x09, 0xb5, 0x0b, 0xb5, 0x0c, 0x95, 0x0d, 
-0xf6, 0x0d, 0xf5, 0x0c, 0x92, 0x0c, 0x97, 0x0a, 0x6c, 0x08, 0x0a, 0x07, 0x45, 0x04, 0xc2, 0x02, 
-0x48, 0x01, 0x43, 0xff, 0x1b, 0xff, 0x50, 0xfe, 0x38, 0xfe, 0x03, 0xff, 0xbc, 0xfe, 0x4a, 0x00, 
-0xad, 0x00, 0xf4, 0x00, 0x22, 0x02, 0xc3, 0x01, 0xf0, 0x01, 0x6c, 0x01, 0x92, 0x00, 0xca, 0xff, 
-0xac, 0xfe, 0x63, 0xfd, 0x1e, 0xfc, 0x2a, 0xfb, 0x1e, 0xfa, 0x70, 0xf9, 0x3d, 0xf8, 0x73, 0xf8, 
-0x2f, 0xf8, 0x28, 0xf7, 0x3e, 0xf8, 0x0c, 0xf7, 0x51, 0xf7, 0xef, 0xf7, 0x1c, 0xf6, 0x6d, 0xf8, 
-0x72, 0xf8, 0x95, 0xf8, 0x5c, 0xfb, 0x98, 0xfb, 0x3e, 0xfe, 0x97, 0x00, 0x1e, 0x03, 0x35, 0x06, 
-0x8b, 0x07, 0xf0, 0x0a, 0x85, 0x0c, 0x84, 0x0c, 0x41, 0x0e, 0x21, 0x0d, 0x1a, 0x0c, 0x62, 0x0b, 
-0x3a, 0x09, 0xb1, 0x07, 0x00, 0x05, 0x21, 0x04, 0x2e, 0x02, 0xf9, 0xff, 0xa9, 0x00, 0x4c, 0xfe, 
-0x4f, 0xfe, 0x38, 0xff, 0x8a, 0xfe, 0x07, 0x00, 0xda, 0xff, 0xf1, 0x00, 0x02, 0x01, 0x02, 0x01, 
-0x7e, 0x01, 0x49, 0x00, 0x9a, 0x00, 0x50, 0xff, 0x6d, 0xfe, 0x39, 0xfd, 0xcf, 0xfb, 0xce, 0xfb, 
-0xa0, 0xf9, 0x82, 0xf9, 0xfc, 0xf9, 0x47, 0xf8, 0xef, 0xf8, 0x29, 0xf9, 0x3c, 0xf8, 0x12, 0xf8, 
-0x66, 0xf8, 0x07, 0xf8, 0x66, 0xf7, 0x52, 0xf8, 0x20, 0xf8, 0xd8, 0xf8, 0x19, 0xfa, 0x2b, 0xfb, 
-0xc0, 0xfd, 0x43, 0xff, 0xf5, 0x01, 0x0e, 0x05, 0x71, 0x06, 0xcc, 0x08, 0x1e, 0x0b, 0xed, 0x0b, 
-0x9f, 0x0c, 0xff, 0x0c, 0x8c, 0x0c, 0xb6, 0x0a, 0xe8, 0x09, 0x52, 0x08, 0x94, 0x05, 0x26, 0x05, 
-0xd0, 0x02, 0x4a, 0x01, 0xd4, 0x00, 0x1b, 0xff, 0x57, 0xff, 0x1c, 0xff, 0x6d, 0xff, 0xe4, 0xff, 
-0x3b, 0x00, 0xb9, 0x00, 0xb5, 0x00, 0x66, 0x01, 0xb9, 0x00, 0xb6, 0x00, 0x17, 0x00, 0xbf, 0xfe, 
-0x5b, 0xfe, 0x57, 0xfc, 0x08, 0xfc, 0xa4, 0xfb, 0xc0, 0xf9, 0xab, 0xfa, 0xab, 0xf9, 0x71, 0xf8, 
-0xd7, 0xf9, 0x21, 0xf8, 0xde, 0xf7, 0x06, 0xf9, 0xad, 0xf7, 0xca, 0xf7, 0xb8, 0xf8, 0xb8, 0xf8, 
-0x34, 0xf8, 0x77, 0xfa, 0xd6, 0xfb, 0x6a, 0xfb, 0xd2, 0xfe, 0xa8, 0x00, 0x63, 0x00, 0x87, 0x04, 
-0x81, 0x06, 0x65, 0x06, 0x21, 0x0a, 0xc4, 0x0a, 0x50, 0x0a, 0x9d, 0x0b, 0xe4, 0x0a, 0x43, 0x09, 
-0x37, 0x09, 0xec, 0x07, 0x49, 0x06, 0x37, 0x05, 0x0c, 0x04, 0xd7, 0x02, 0x39, 0x01, 0x5b, 0x01, 
-0x5f, 0x00, 0x96, 0xff, 0x35, 0x00, 0xaf, 0xff, 0x9a, 0xff, 0xea, 0xff, 0x73, 0x00, 0x48, 0x00, 
-0x13, 0x00, 0x84, 0x00, 0xd6, 0xff, 0xfd, 0xfe, 0x66, 0xfe, 0x3f, 0xfe, 0xa3, 0xfc, 0xd4, 0xfb, 
-0x8c, 0xfb, 0x47, 0xfa, 0xbd, 0xf9, 0xf9, 0xf8, 0x1f, 0xfa, 0x70, 0xf9, 0x8f, 0xf8, 0x23, 0xfb, 
-0xe1, 0xf9, 0x37, 0xf8, 0x3d, 0xfb, 0x7a, 0xfa, 0xfc, 0xf8, 0xfa, 0xfb, 0xe0, 0xfc, 0x94, 0xfb, 
-0x79, 0xfd, 0x72, 0x00, 0x22, 0xff, 0x98, 0x00, 0x7d, 0x04, 0x3b, 0x04, 0x52, 0x04, 0x40, 0x08, 
-0x58, 0x08, 0x2d, 0x07, 0xa0, 0x09, 0xe0, 0x09, 0x99, 0x07, 0x8d, 0x07, 0x68, 0x08, 0x78, 0x05, 
-0xba, 0x04, 0x9a, 0x05, 0x34, 0x03, 0x1d, 0x02, 0x61, 0x02, 0x11, 0x01, 0xa9, 0xff, 0x53, 0x00, 
-0x8d, 0x00, 0x4b, 0xff, 0x59, 0x01, 0x74, 0x00, 0xe0, 0xff, 0xe5, 0x00, 0x0d, 0xff, 0x0d, 0xff, 
-0xb8, 0xfe, 0xde, 0xfd, 0xfb, 0xfc, 0x94, 0xfc, 0x47, 0xfc, 0xdd, 0xfa, 0xd2, 0xfa, 0x5f, 0xfb, 
-0xda, 0xf9, 0x59, 0xfa, 0x30, 0xfb, 0x6f, 0xfa, 0x43, 0xfa, 0xd8, 0xfb, 0x37, 0xfc, 0x80, 0xfb, 
-0xa5, 0xfc, 0x1e, 0xfd, 0x90, 0xfc, 0x0f, 0xfd, 0x0d, 0xff, 0x65, 0xfe, 0xc6, 0xfe, 0xcc, 0x00, 
-0xa8, 0x00, 0xa7, 0x01, 0x65, 0x02, 0x6c, 0x03, 0xfd, 0x03, 0x7d, 0x04, 0x70, 0x05, 0xaa, 0x05, 
-0xe4, 0x05, 0x91, 0x05, 0x51, 0x05, 0xed, 0x04, 0x94, 0x04, 0x18, 0x04, 0x75, 0x03, 0x9c, 0x03, 
-0xef, 0x02, 0x7b, 0x02, 0xd4, 0x01, 0xae, 0x02, 0xc3, 0x00, 0xb7, 0xff, 0x97, 0x01, 0xd6, 0xfe, 
-0x10, 0xfe, 0x5e, 0xff, 0xdd, 0xfe, 0x90, 0xfc, 0x6b, 0xfd, 0xa9, 0xfe, 0x34, 0xfc, 0xa9, 0xfb, 
-0xe6, 0xfd, 0x4e, 0xfc, 0x57, 0xfc, 0xa9, 0xfd, 0x9b, 0xfd, 0x81, 0xfd, 0xda, 0xfc, 0xc4, 0xfe, 
-0xdc, 0xff, 0x9d, 0xfd, 0x5f, 0xfe, 0x54, 0x00, 0x21, 0xfe, 0xd5, 0xfc, 0x82, 0xff, 0xab, 0xff, 
-0x2d, 0xfc, 0xaf, 0xfe, 0x16, 0x01, 0xf5, 0xfc, 0x43, 0xff, 0xca, 0x02, 0x87, 0x00, 0x40, 0x00, 
-0xa2, 0x02, 0x60, 0x03, 0x38, 0x00, 0x3b, 0x02, 0x9a, 0x04, 0x7f, 0x01, 0x8f, 0x02, 0x9f, 0x02, 
-0xf1, 0x01, 0x2f, 0x01, 0x05, 0x01, 0x8a, 0x02, 0x6d, 0x00, 0x18, 0x01, 0x0c, 0x02, 0xea, 0x01, 
-0x64, 0x01, 0xfb, 0xff, 0x18, 0x01, 0x89, 0x00, 0xed, 0xfe, 0x96, 0x00, 0xc8, 0x00, 0x96, 0xff, 
-0x50, 0x00, 0x6c, 0x01, 0xc9, 0xff, 0x81, 0xff, 0xa3, 0x00, 0x6b, 0xff, 0x31, 0xfe, 0xab, 0xff, 
-0x66, 0xff, 0xe4, 0xfd, 0xa1, 0xff, 0xbb, 0xff, 0x4f, 0xfe, 0x67, 0xff, 0x4d, 0xff, 0xf5, 0xfd, 
-0xbe, 0xfe, 0x62, 0xff, 0xca, 0xff, 0xab, 0xff, 0x35, 0x00, 0xa3, 0xff, 0x9e, 0xfe, 0xf0, 0xfe, 
-0x77, 0xfe, 0xf4, 0xff, 0x66, 0xff, 0x2d, 0xfe, 0x2c, 0x00, 0x39, 0x00, 0xe9, 0xff, 0x29, 0x01, 
-0x23, 0x01, 0xf7, 0xff, 0x5d, 0x00, 0xb2, 0x01, 0xaf, 0x00, 0x94, 0xff, 0x7e, 0x00, 0x30, 0x00, 
-0x93, 0xff, 0xf4, 0xff, 0xe0, 0xff, 0x40, 0x00, 0x5a, 0x00, 0x3b, 0xff, 0x8f, 0x00, 0xe6, 0xff, 
-0x52, 0xff, 0xae, 0x00, 0x60, 0x00, 0xdc, 0x00, 0xd5, 0xff, 0xbd, 0x01, 0x95, 0x00, 0xf1, 0xfe, 
-0x82, 0x01, 0x2e, 0xff, 0x82, 0xff, 0xb7, 0xff, 0x07, 0x00, 0xe3, 0xff, 0x4c, 0xff, 0x82, 0x00, 
-0x3a, 0xfe, 0xae, 0xff, 0x86, 0x00, 0x10, 0xff, 0x77, 0xff, 0x28, 0x00, 0xd4, 0xff, 0xf3, 0xff, 
-0x53, 0x00, 0xff, 0xff, 0xb9, 0xff, 0x9c, 0xff, 0x75, 0x00, 0x1d, 0xff, 0xa3, 0xff, 0x3c, 0xff, 
-0xa3, 0xff, 0x9c, 0x00, 0x2d, 0xff, 0xa6, 0x00, 0x7a, 0x00, 0x1e, 0x00, 0xb4, 0xff, 0x5b, 0x00, 
-0xfe, 0xff, 0xbc, 0xfe, 0x90, 0x00, 0x45, 0x00, 0x2e, 0xff, 0xe9, 0xfe, 0xba, 0xff, 0xc8, 0xff, 
-0xed, 0xff, 0x65, 0x01, 0x71, 0x00, 0x47, 0x00, 0xd4, 0xff, 0xd4, 0xff, 0x94, 0x00, 0x44, 0xff, 
-0xe5, 0xff, 0xe3, 0xff, 0x7e, 0x00, 0x3a, 0x00, 0x8c, 0xff, 0xa8, 0x01, 0x25, 0x00, 0xff, 0xff, 
-0x75, 0x00, 0x71, 0x00, 0x44, 0x00, 0x3b, 0xff, 0x16, 0x01, 0x56, 0xff, 0x8f, 0xfe, 0x20, 0x00, 
-0x6e, 0x00, 0x1a, 0xff, 0x3f, 0xff, 0xe0, 0x00, 0x28, 0xff, 0xd7, 0xfe, 0x30, 0x00, 0x81, 0x00, 
-0x36, 0xff, 0x10, 0x01, 0xb9, 0x00, 0x2b, 0x00, 0x27, 0x01, 0x9a, 0x00, 0x14, 0x01, 0xbb, 0xff, 
-0x91, 0x00, 0xdc, 0xff, 0x37, 0xff, 0xb4, 0xff, 0x1e, 0xff, 0xe7, 0xff, 0xb0, 0xff, 0xa9, 0xff, 
-0x4f, 0x00, 0xbe, 0xff, 0xfb, 0xff, 0xda, 0x00, 0x92, 0xff, 0xe0, 0xff, 0x0e, 0x00, 0x00, 0x00, 
-0x19, 0x00, 0xee, 0xfe, 0x72, 0x00, 0xa6, 0xff, 0x68, 0xff, 0x46, 0x00, 0x09, 0x00, 0x91, 0xff, 
-0x7e, 0xff, 0x0b, 0x00, 0xb8, 0xff, 0x15, 0xff, 0x90, 0xff, 0xd9, 0xff, 0xca, 0xff, 0x6f, 0x00, 
-0x6b, 0xff, 0xda, 0xff, 0xe1, 0xff, 0x23, 0xff, 0xc0, 0xff, 0x13, 0x00, 0x10, 0xff, 0xf0, 0xfe, 
-0x80, 0x00, 0xf8, 0xff, 0xc6, 0xff, 0xf1, 0xff, 0x1c, 0x00, 0x81, 0xff, 0x8c, 0xff, 0xfc, 0x00, 
-0xbb, 0xff, 0x41, 0x00, 0xd9, 0xff, 0x72, 0x00, 0x6b, 0x00, 0x79, 0xff, 0x2c, 0x01, 0x1f, 0x00, 
-0x96, 0xff, 0x84, 0x01, 0x00, 0x01, 0x5e, 0x00, 0x36, 0x00, 0x09, 0x01, 0x3f, 0x00, 0xd0, 0xff, 
-0x9d, 0x01, 0x91, 0xff, 0x42, 0xff, 0x0a, 0x00, 0x1a, 0xff, 0x83, 0xff, 0x90, 0xff, 0xe2, 0xff, 
-0xec, 0xff, 0xe5, 0x00, 0x22, 0x00, 0xcc, 0xff, 0xcc, 0x00, 0x85, 0xff, 0xf7, 0xff, 0x0f, 0x00, 
-0x17, 0x00, 0x25, 0x00, 0xf8, 0xff, 0x05, 0x00, 0x0d, 0x00, 0x98, 0xff, 0xe9, 0xff, 0xf6, 0xff, 
-0x32, 0x00, 0x9b, 0xff, 0x0a, 0xff, 0x63, 0x00, 0x80, 0xff, 0x72, 0xff, 0x13, 0x00, 0xa2, 0xff, 
-0x67, 0x00, 0x58, 0xff, 0xd3, 0x00, 0x37, 0x01, 0x63, 0xff, 0x3c, 0x00, 0x22, 0x00, 0xe9, 0xff, 
-0x2b, 0x00, 0xed, 0x00, 0x29, 0x00, 0xd9, 0x00, 0x02, 0x01, 0xd7, 0xff, 0x67, 0x00, 0xdb, 0x00, 
-0xc7, 0xff, 0x40, 0x00, 0xcf, 0x00, 0xcf, 0xff, 0xc9, 0xff, 0x47, 0x00, 0x9f, 0xff, 0xa0, 0xff, 
-0xcd, 0x00, 0x5d, 0xff, 0x2e, 0x00, 0x08, 0x00, 0x80, 0xff, 0x2a, 0x00, 0x3c, 0x00, 0x5d, 0xff, 
-0x08, 0x00, 0xd2, 0x00, 0x1d, 0xff, 0x7c, 0xff, 0x98, 0x00, 0xf5, 0xff, 0x77, 0xff, 0x8f, 0xff, 
-0xf4, 0xff, 0xf2, 0xff, 0x4b, 0xff, 0x1a, 0x00, 0x47, 0x00, 0xec, 0xff, 0xc5, 0xff, 0x0c, 0x00, 
-0xac, 0xff, 0xa6, 0xff, 0x8e, 0xff, 0xa3, 0xff, 0x12, 0x00, 0xb9, 0xff, 0xa4, 0xff, 0x64, 0x00, 
-0x29, 0x01, 0xba, 0xff, 0x8a, 0xff, 0x47, 0x01, 0xa2, 0xff, 0xc1, 0xff, 0x14, 0x01, 0xb8, 0x00, 
-0x0f, 0x00, 0x9e, 0xff, 0x2b, 0x00, 0x53, 0x00, 0x27, 0x00, 0x40, 0x00, 0xc7, 0x00, 0x1f, 0x00, 
-0xe1, 0xff, 0x75, 0x00, 0xb6, 0x00, 0xbf, 0xff, 0xef, 0xff, 0xc6, 0x00, 0x01, 0x00, 0x68, 0xff, 
-0x72, 0x00, 0x80, 0x00, 0x47, 0x00, 0x90, 0xff, 0xaf, 0xff, 0x5b, 0x00, 0x92, 0xff, 0xd7, 0xff, 
-0x2c, 0x00, 0xa4, 0x00, 0x4e, 0xff, 0xc1, 0xff, 0x46, 0x00, 0x2e, 0x00, 0x7e, 0xff, 0xca, 0xff, 
-0x1a, 0x00, 0x5f, 0xff, 0xd0, 0xff, 0x42, 0x00, 0x45, 0x00, 0xfc, 0xff, 0xa6, 0xff, 0x91, 0x00, 
-0x1b, 0x00, 0x5f, 0xff, 0x94, 0x00, 0xfe, 0xff, 0x0f, 0x00, 0x44, 0xff, 0x92, 0x00, 0x1a, 0x00, 
-0x77, 0xff, 0xa3, 0x00, 0xdc, 0xff, 0x2e, 0x00, 0x0b, 0x00, 0x7e, 0xff, 0x2f, 0x00, 0xbb, 0xff, 
-0x26, 0x00, 0x99, 0x00, 0x50, 0x00, 0x50, 0x00, 0x8c, 0xff, 0xf5, 0xff, 0x61, 0x00, 0xfe, 0xff, 
-0xd6, 0xff, 0x5a, 0x00, 0xd4, 0x00, 0xf4, 0xff, 0x05, 0x00, 0x3e, 0x00, 0x73, 0x00, 0xb5, 0xff, 
-0xd2, 0xff, 0xb8, 0x00, 0x46, 0xff, 0xc3, 0xff, 0x96, 0x00, 0x3e, 0x00, 0xcc, 0xff, 0x44, 0xff, 
-0xe7, 0xff, 0x1e, 0x01, 0xb2, 0xff, 0x06, 0x00, 0x20, 0x00, 0xdf, 0xff, 0xc2, 0xff, 0xbf, 0xff, 
-0x75, 0x00, 0x1e, 0x00, 0x77, 0x00, 0xf4, 0xff, 0xae, 0xff, 0xba, 0xff, 0xb8, 0xff, 0x54, 0x00, 
-0xdd, 0x00, 0x2d, 0xff, 0xb8, 0xff, 0x5c, 0x00, 0x74, 0xff, 0x70, 0xff, 0x77, 0x00, 0x32, 0x00, 
-0x0f, 0xff, 0x6a, 0x00, 0xdc, 0xff, 0x9d, 0x00, 0x80, 0x00, 0xba, 0xff, 0xf8, 0xff, 0xc7, 0xff, 
-0x46, 0xff, 0xfa, 0xff, 0x3e, 0x00, 0xd1, 0xff, 0x07, 0x00, 0x24, 0x00, 0x77, 0xff, 0x89, 0xff, 
-0x95, 0x00, 0xf8, 0xff, 0xdd, 0xff, 0xa2, 0xff, 0x36, 0x01, 0x4c, 0x00, 0x6f, 0xff, 0xe7, 0xff, 
-0x0f, 0x00, 0xa7, 0xff, 0x91, 0xff, 0x8a, 0x00, 0xe6, 0xff, 0xfe, 0xff, 0x40, 0x00, 0xd4, 0xff, 
-0xe0, 0xff, 0xdc, 0xff, 0x38, 0x00, 0x27, 0x00, 0xab, 0xff, 0xc1, 0xff, 0x72, 0xff, 0x40, 0x00, 
-0x0c, 0x00, 0xcc, 0xff, 0x32, 0x00, 0x78, 0x00, 0x9c, 0xff, 0x93, 0xff, 0x76, 0x00, 0xa7, 0xff, 
-0xf6, 0xff, 0xdf, 0x00, 0xd8, 0xff, 0xbf, 0xff, 0x65, 0xff, 0x2c, 0x00, 0x0a, 0x00, 0x1b, 0xff, 
-0x42, 0x00, 0x2a, 0x00, 0xa7, 0xff, 0x9f, 0xff, 0xc4, 0xff, 0xc4, 0xff, 0x9b, 0xff, 0x32, 0x00, 
-0xe4, 0x00, 0x47, 0xff, 0x3d, 0x00, 0x16, 0x00, 0xbd, 0xff, 0xf2, 0xff, 0xcb, 0xff, 0xec, 0x00, 
-0x4a, 0xff, 0x45, 0xff, 0x1a, 0x00, 0x38, 0x00, 0xf1, 0x00, 0x85, 0xff, 0x28, 0x00, 0x2d, 0x00, 
-0x8f, 0xfe, 0x3a, 0x00, 0x12, 0x00, 0x31, 0x00, 0x20, 0x00, 0x7c, 0xff, 0x61, 0x00, 0xcb, 0xff, 
-0x9c, 0xff, 0x12, 0x00, 0x89, 0x00, 0x27, 0x00, 0xd0, 0xff, 0x96, 0xff, 0x2b, 0x00, 0x21, 0x00, 
-0x47, 0xff, 0x84, 0x00, 0x15, 0x00, 0x3f, 0xff, 0x04, 0x00, 0x07, 0x01, 0x4f, 0xff, 0x5d, 0xff, 
-0x68, 0x00, 0xc1, 0xff, 0x43, 0x00, 0x95, 0x00, 0xb6, 0xff, 0xf1, 0xff, 0x14, 0xff, 0xc3, 0xff, 
-0x3a, 0x00, 0xae, 0xff, 0x90, 0x00, 0xbc, 0xff, 0x51, 0xff, 0x01, 0x00, 0x50, 0x00, 0x5f, 0xff, 
-0x2c, 0x00, 0xe7, 0xff, 0x06, 0xff, 0x8d, 0xff, 0x9e, 0x00, 0x7b, 0x00, 0x13, 0x00, 0x7f, 0x00, 
-0x20, 0x00, 0x18, 0x00, 0x4a, 0x00, 0x95, 0xff, 0xbf, 0xff, 0x0b, 0x00, 0xfe, 0xff, 0xd4, 0xff, 
-0xf9, 0xff, 0x54, 0x00, 0x7e, 0xff, 0xc8, 0xff, 0x97, 0xff, 0x2d, 0x00, 0x51, 0x00, 0x9f, 0xff, 
-0x32, 0x00, 0x58, 0x00, 0x53, 0xff, 0x47, 0x00, 0xb9, 0x00, 0x55, 0xff, 0x1d, 0x00, 0xa9, 0x00, 
-0x43, 0x00, 0x52, 0x00, 0xd7, 0xff, 0x4d, 0x00, 0x9e, 0xff, 0xe8, 0xfe, 0xfc, 0xff, 0x01, 0x00, 
-0x4a, 0x00, 0x50, 0xff, 0x39, 0x00, 0xf6, 0xff, 0xad, 0xff, 0x96, 0x00, 0x3e, 0xff, 0x9f, 0x00, 
-0x0f, 0x00, 0xa0, 0xff, 0x08, 0x01, 0xdf, 0xff, 0xda, 0xff, 0xdc, 0xff, 0x66, 0xff, 0xc7, 0xff, 
-0x62, 0x00, 0x1d, 0x00, 0x5f, 0x00, 0xd0, 0xff, 0x9e, 0xff, 0x13, 0x00, 0x8f, 0x00, 0x70, 0xff, 
-0x81, 0x00, 0x7c, 0x00, 0xe7, 0xfe, 0xef, 0xff, 0xda, 0xff, 0x6f, 0x00, 0x98, 0xff, 0x0f, 0x00, 
-0x55, 0x00, 0x74, 0xff, 0x64, 0xff, 0x31, 0x01, 0x40, 0x00, 0x5a, 0xff, 0x8c, 0x00, 0x4a, 0xff, 
-0x00, 0x00, 0x7e, 0xff, 0x85, 0x00, 0x61, 0x00, 0xa3, 0xff, 0xfd, 0xff, 0xd3, 0xff, 0x65, 0x00, 
-0xbb, 0xff, 0x1e, 0x00, 0xdc, 0xff, 0xf9, 0x00, 0x6c, 0x00, 0x85, 0xff, 0x43, 0x00, 0x30, 0xff, 
-0xc0, 0xff, 0x59, 0x00, 0xba, 0x00, 0xea, 0xff, 0x01, 0x00, 0xbc, 0xff, 0x75, 0xff, 0x13, 0x00, 
-0xf4, 0xff, 0x15, 0x00, 0x98, 0x00, 0x6f, 0x00, 0xe8, 0xff, 0xb7, 0xff, 0xa1, 0x00, 0xdf, 0x00, 
-0xe7, 0xff, 0x39, 0x00, 0x24, 0xff, 0x2c, 0xff, 0x7f, 0x00, 0x28, 0x00, 0xfe, 0xff, 0x86, 0x00, 
-0x42, 0xff, 0x4f, 0x00, 0x45, 0x00, 0x1f, 0xff, 0x58, 0x00, 0xcb, 0xff, 0x51, 0x00, 0xf5, 0x00, 
-0x3c, 0xff, 0x81, 0x00, 0x89, 0xff, 0xb6, 0xff, 0x42, 0x00, 0xa6, 0xff, 0x4e, 0x00, 0xb3, 0xff, 
-0x80, 0x00, 0x0a, 0x00, 0xd0, 0xff, 0x93, 0x00, 0xd3, 0xff, 0x18, 0x00, 0xef, 0xff, 0x58, 0x00, 
-0x5b, 0x00, 0x0b, 0xff, 0x74, 0x00, 0xad, 0xff, 0xc9, 0xfe, 0x09, 0x00, 0x0c, 0x00, 0xe2, 0xff, 
-0xf2, 0xff, 0xcf, 0x00, 0x4f, 0x00, 0x01, 0x00, 0xe8, 0x00, 0x78, 0xff, 0x72, 0xff, 0xf9, 0xff, 
-0x89, 0xff, 0x6a, 0x00, 0x09, 0x00, 0xdc, 0xff, 0x58, 0x00, 0x6d, 0xff, 0xdc, 0xff, 0xf2, 0xff, 
-0xd7, 0xff, 0x38, 0x00, 0x31, 0x00, 0x86, 0x00, 0x04, 0x00, 0x06, 0x00, 0xc1, 0xff, 0x12, 0x00, 
-0x88, 0x00, 0x97, 0x00, 0x9b, 0x00, 0x48, 0xff, 0xd9, 0xff, 0x07, 0x00, 0x68, 0xff, 0x9f, 0x00, 
-0xbb, 0xff, 0x89, 0x00, 0x66, 0x00, 0xde, 0xff, 0x75, 0x00, 0xf5, 0xff, 0xb6, 0x00, 0x93, 0xff, 
-0x60, 0x00, 0x51, 0x00, 0xc1, 0x00, 0xfb, 0xff, 0xdb, 0xff, 0x51, 0x00, 0x49, 0xff, 0x9d, 0x00, 
-0xde, 0xff, 0x1f, 0x00, 0xe3, 0xff, 0xf6, 0xff, 0x76, 0x00, 0x68, 0x00, 0x9b, 0xff, 0x03, 0x00, 
-0xd9, 0xff, 0x6c, 0xff, 0x84, 0x00, 0xbf, 0xff, 0x70, 0x00, 0xe7, 0xff, 0xd4, 0xff, 0x1d, 0x00, 
-0x2a, 0xff, 0x91, 0xff, 0x3a, 0x00, 0x50, 0x00, 0x46, 0x00, 0x76, 0x00, 0xfb, 0xff, 0xd2, 0xff, 
-0xae, 0xff, 0x02, 0x00, 0x45, 0xff, 0x53, 0xff, 0x10, 0x00, 0xf3, 0xfe, 0x89, 0x00, 0xdc, 0x00, 
-0xaa, 0xff, 0xd0, 0x00, 0x32, 0x00, 0x97, 0xff, 0x95, 0x00, 0xa1, 0xff, 0x87, 0x00, 0x22, 0x00, 
-0x08, 0x00, 0xbd, 0x00, 0x7e, 0x00, 0x15, 0x00, 0xdc, 0xff, 0x1a, 0x00, 0xa5, 0xff, 0x06, 0x00, 
-0x29, 0x00, 0x5a, 0xff, 0x9c, 0x00, 0x3d, 0x00, 0xa2, 0xff, 0x5e, 0x00, 0xae, 0xff, 0xa2, 0x00, 
-0xb5, 0xff, 0xe1, 0xff, 0xa6, 0x00, 0x39, 0x00, 0xdf, 0xff, 0x97, 0xff, 0x30, 0x00, 0xb1, 0xff, 
-0x4f, 0x00, 0x7a, 0x00, 0x6e, 0xff, 0xda, 0xff, 0xf9, 0xff, 0x4a, 0x00, 0xd9, 0xff, 0x07, 0x00, 
-0x22, 0x00, 0x67, 0xff, 0xe4, 0xff, 0xec, 0xff, 0x7d, 0x00, 0xf9, 0xff, 0xd7, 0xff, 0xe8, 0x00, 
-0xbf, 0xff, 0xfc, 0xff, 0x1a, 0x00, 0xe4, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xe9, 0xff, 0x85, 0xff, 
-0x19, 0x00, 0xf3, 0xff, 0xad, 0xff, 0x21, 0x00, 0x83, 0x00, 0x1f, 0x00, 0x6e, 0x00, 0x6d, 0x00, 
-0xc7, 0xff, 0xb4, 0xff, 0x2f, 0x00, 0x78, 0xff, 0xcd, 0xff, 0xa9, 0x00, 0x85, 0xff, 0x95, 0x00, 
-0xc2, 0xff, 0xaa, 0xff, 0x29, 0x00, 0x1b, 0xff, 0x85, 0x00, 0x57, 0x00, 0xc9, 0xff, 0xa2, 0x00, 
-0x37, 0x00, 0xaa, 0xff, 0xe2, 0xff, 0xfc, 0xff, 0x9e, 0xff, 0xb8, 0xff, 0x25, 0x00, 0x7e, 0xff, 
-0x23, 0x00, 0x3c, 0x00, 0x98, 0xff, 0xa1, 0xff, 0xf2, 0xff, 0x37, 0x00, 0xf9, 0xff, 0xce, 0xff, 
-0xe2, 0xff, 0x8d, 0x00, 0xcd, 0xff, 0x8f, 0xff, 0x33, 0x00, 0xd2, 0xff, 0xeb, 0xff, 0xf1, 0xff, 
-0xf0, 0xff, 0x28, 0x00, 0xc4, 0xff, 0x0c, 0x00, 0x22, 0x00, 0xd9, 0xff, 0x58, 0x00, 0xdf, 0xff, 
-0xbf, 0xff, 0x2c, 0x00, 0xcd, 0xff, 0xf1, 0xff, 0x9e, 0xff, 0x1d, 0x00, 0x0f, 0x00, 0xa1, 0xff, 
-0x50, 0x00, 0x0a, 0x00, 0xdd, 0xff, 0x84, 0xff, 0xba, 0xff, 0xce, 0x00, 0x40, 0x00, 0x7a, 0xff, 
-0xec, 0xff, 0x48, 0x00, 0x22, 0x00, 0x62, 0xff, 0x60, 0x00, 0x3a, 0x00, 0xf1, 0xff, 0xc2, 0xff, 
-0x95, 0xff, 0x3f, 0x00, 0xcf, 0xff, 0x98, 0xff, 0xb0, 0xff, 0x83, 0x00, 0x38, 0x00, 0x94, 0xff, 
-0x54, 0x00, 0x1b, 0x00, 0x7d, 0xff, 0xa3, 0xff, 0x00, 0x00, 0x80, 0x00, 0x0f, 0x00, 0x66, 0xff, 
-0x95, 0xff, 0x50, 0x00, 0xc5, 0xff, 0x3b, 0x00, 0x37, 0x00, 0x3d, 0xff, 0x55, 0x00, 0xa7, 0xff, 
-0x06, 0x00, 0x75, 0x00, 0x47, 0x00, 0x41, 0x00, 0xcf, 0xff, 0x15, 0x00, 0x05, 0x00, 0xf5, 0xff, 
-0x80, 0x00, 0xdc, 0x00, 0x1a, 0x00, 0x72, 0x00, 0x31, 0x00, 0xcf, 0xff, 0x27, 0x00, 0x57, 0x00, 
-0x20, 0x00, 0x06, 0xff, 0xfe, 0xfe, 0xa7, 0xff, 0x42, 0xff, 0x94, 0xff, 0x87, 0xff, 0x71, 0xff, 
-0x11, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x16, 0x00, 0x16, 0x00, 0xe9, 0xff, 0x06, 0x00, 0xc6, 0xff, 
-0xfb, 0xff, 0x94, 0xff, 0x48, 0xff, 0x8b, 0xff, 0x35, 0xff, 0x92, 0xff, 0x7a, 0xff, 0x3e, 0xff, 
-0x23, 0xff, 0x4d, 0xff, 0x8d, 0xff, 0x6f, 0xff, 0xcc, 0xff, 0xef, 0xff, 0xbd, 0xff, 0xa3, 0xff, 
-0xcb, 0xff, 0x00, 0x00, 0x08, 0x00, 0xff, 0xff, 0x8c, 0xff, 0xf9, 0xff, 0x69, 0x00, 0x3a, 0x00, 
-0xa4, 0xff, 0xfd, 0xff, 0x5c, 0x00, 0x6a, 0xff, 0x66, 0xff, 0x3e, 0x00, 0xb4, 0x00, 0x1e, 0x00, 
-0x50, 0xff, 0x7c, 0x00, 0x68, 0x00, 0x9a, 0xff, 0x6f, 0x00, 0xbf, 0x00, 0x8c, 0x00, 0x19, 0x00, 
-0x2e, 0x00, 0x47, 0x01, 0x2c, 0x01, 0xa6, 0x00, 0xb5, 0x00, 0xaa, 0x00, 0x64, 0x00, 0xd5, 0xff, 
-0x7d, 0x00, 0x68, 0x00, 0x84, 0xff, 0x89, 0xff, 0x8c, 0xff, 0x4a, 0xff, 0x34, 0xff, 0x5f, 0xff, 
-0x50, 0xff, 0x17, 0xff, 0xd2, 0xff, 0x2c, 0x00, 0x17, 0x00, 0x83, 0x00, 0x55, 0x00, 0xd7, 0xff, 
-0x25, 0x00, 0x2f, 0x00, 0x1e, 0x00, 0x08, 0x00, 0xe3, 0xff, 0x70, 0xff, 0x5a, 0xff, 0xdb, 0xff, 
-0x71, 0xff, 0x68, 0xff, 0x4e, 0xff, 0x42, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x6a, 0x00, 0xbf, 0x00, 
-0x00, 0x01, 0x6d, 0x01, 0x81, 0x01, 0x8f, 0x01, 0x5d, 0x01, 0x30, 0x01, 0xfe, 0x00, 0x1f, 0x01, 
-0x34, 0x01, 0xb1, 0x00, 0xd1, 0xff, 0xe7, 0xfe, 0x6a, 0xfe, 0x0b, 0xfe, 0xad, 0xfd, 0x04, 0xfe, 
-0x7c, 0xfe, 0xb6, 0xfe, 0x35, 0xff, 0x7d, 0xff, 0xca, 0xff, 0x28, 0x00, 0xeb, 0xff, 0x42, 0x00, 
-0x9a, 0x00, 0x7c, 0x00, 0x75, 0x00, 0x4d, 0x00, 0x07, 0x00, 0x84, 0xff, 0x49, 0xff, 0x35, 0xff, 
-0xf7, 0xfe, 0xf2, 0xfe, 0xe3, 0xfe, 0xdf, 0xfe, 0x46, 0xff, 0x56, 0xff, 0xb7, 0xff, 0x29, 0x00, 
-0x50, 0x00, 0x33, 0x00, 0x5f, 0x00, 0x9c, 0x00, 0x81, 0x00, 0x8b, 0x00, 0xaa, 0x00, 0xa8, 0x00, 
-0x99, 0x00, 0x8a, 0x00, 0x87, 0x00, 0x42, 0x00, 0xfe, 0xff, 0x06, 0x00, 0xe6, 0xff, 0x09, 0x00, 
-0x19, 0x00, 0x00, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x50, 0x00, 0x8d, 0x00, 0x68, 0x00, 0x96, 0x00, 
-0x9b, 0x00, 0x84, 0x00, 0xc0, 0x00, 0x98, 0x00, 0x97, 0x00, 0x6b, 0x00, 0x2b, 0x00, 0x2e, 0x00, 
-0xd3, 0xff, 0xc0, 0xff, 0x00, 0x00, 0xee, 0xff, 0xf8, 0xff, 0x36, 0x00, 0x1c, 0x00, 0x0f, 0x00, 
-0x1d, 0x00, 0x52, 0x00, 0x7e, 0x00, 0x61, 0x00, 0x92, 0x00, 0x95, 0x00, 0x74, 0x00, 0x94, 0x00, 
-0x70, 0x00, 0x4b, 0x00, 0x4e, 0x00, 0x29, 0x00, 0xe4, 0xff, 0xcc, 0xff, 0xcb, 0xff, 0xb3, 0xff, 
-0xa8, 0xff, 0xd9, 0xff, 0x01, 0x00, 0xef, 0xff, 0x07, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x35, 0x00, 
-0x1a, 0x00, 0x1d, 0x00, 0x37, 0x00, 0x1b, 0x00, 0xf8, 0xff, 0x14, 0x00, 0x18, 0x00, 0xf6, 0xff, 
-0xf0, 0xff, 0xfe, 0xff, 0xce, 0xff, 0xbb, 0xff, 0xca, 0xff, 0xba, 0xff, 0xb1, 0xff, 0xc1, 0xff, 
-0xe0, 0xff, 0xd8, 0xff, 0xde, 0xff, 0x19, 0x00, 0x07, 0x00, 0x01, 0x00, 0x10, 0x00, 0x18, 0x00, 
-0x27, 0x00, 0x0e, 0x00, 0xfd, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xf8, 0xff, 
-0x04, 0x00, 0xf9, 0xff, 0xfd, 0xff, 0x0a, 0x00, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf5, 0xff, 
-0x06, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x12, 0x00, 0x05, 0x00, 0xf9, 0xff, 
-0xfa, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 
-0x0e, 0x00, 0xff, 0xff, 0xf4, 0xff, 0x07, 0x00, 0x02, 0x00, 0xfb, 0xff, 0x03, 0x00, 0x0c, 0x00, 
-0x05, 0x00, 0xf8, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf1, 0xff, 0x04, 0x00, 0xfd, 0xff, 
-0xfc, 0xff, 0xf7, 0xff, 0xf0, 0xff, 0x0c, 0x00, 0x02, 0x00, 0xfb, 0xff, 0xf5, 0xff, 0xf0, 0xff, 
-0xfc, 0xff, 0xe9, 0xff, 0xf4, 0xff, 0x08, 0x00, 0xf1, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0x05, 0x00, 
-0x01, 0x00, 0xf4, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xf6, 0xff, 0x07, 0x00, 
-0xf9, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0x07, 0x00, 
-0xfa, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0x01, 0x00, 0x02, 0x00, 0xee, 0xff, 0x03, 0x00, 0x00, 0x00, 
-0xff, 0xff, 
-};
-
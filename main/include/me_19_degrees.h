@@ -1,1206 +0,0 @@
-#include <stdio.h>
-const unsigned char me_19_degrees[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0xff, 0xf7, 0xff, 
-0xf1, 0xff, 0xec, 0xff, 0xe0, 0xff, 0xdc, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xb5, 0xff, 0xa5, 0xff, 
-0xa8, 0xff, 0xa5, 0xff, 0xa7, 0xff, 0xbc, 0xff, 0xbf, 0xff, 0xd3, 0xff, 0xe4, 0xff, 0xee, 0xff, 
-0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x67, 0x00, 
-0x6b, 0x00, 0x55, 0x00, 0x47, 0x00, 0x3a, 0x00, 0x20, 0x00, 0x11, 0x00, 0x04, 0x00, 0xfd, 0xff, 
-0xeb, 0xff, 0xd4, 0xff, 0xce, 0xff, 0xb9, 0xff, 0xac, 0xff, 0xb2, 0xff, 0xb0, 0xff, 0xc4, 0xff, 
-0xd3, 0xff, 0xdc, 0xff, 0xfb, 0xff, 0x05, 0x00, 0x12, 0x00, 0x25, 0x00, 0x31, 0x00, 0x47, 0x00, 
-0x4d, 0x00, 0x58, 0x00, 0x65, 0x00, 0x5d, 0x00, 0x5b, 0x00, 0x4c, 0x00, 0x41, 0x00, 0x39, 0x00, 
-0x22, 0x00, 0x24, 0x00, 0x1a, 0x00, 0x09, 0x00, 0x05, 0x00, 0xfb, 0xff, 0xf5, 0xff, 0xe7, 0xff, 
-0xe0, 0xff, 0xe4, 0xff, 0xde, 0xff, 0xe3, 0xff, 0xe7, 0xff, 0xeb, 0xff, 0xf8, 0xff, 0xfb, 0xff, 
-0x04, 0x00, 0x0d, 0x00, 0x10, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x21, 0x00, 0x1f, 0x00, 
-0x27, 0x00, 0x23, 0x00, 0x17, 0x00, 0x16, 0x00, 0x0a, 0x00, 0xfb, 0xff, 0xf6, 0xff, 0xea, 0xff, 
-0xe4, 0xff, 0xe1, 0xff, 0xe2, 0xff, 0xe7, 0xff, 0xdd, 0xff, 0xdf, 0xff, 0xe5, 0xff, 0xdb, 0xff, 
-0xe7, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x09, 0x00, 0x0a, 0x00, 
-0x12, 0x00, 0x12, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x1d, 0x00, 0x1b, 0x00, 
-0x17, 0x00, 0x0f, 0x00, 0x07, 0x00, 0xfe, 0xff, 0xf3, 0xff, 0xec, 0xff, 0xe7, 0xff, 0xd8, 0xff, 
-0xd5, 0xff, 0xdd, 0xff, 0xd1, 0xff, 0xdb, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xf8, 0xff, 0x0d, 0x00, 
-0x2b, 0x00, 0x40, 0x00, 0x50, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x5c, 0x00, 
-0x5c, 0x00, 0x46, 0x00, 0x42, 0x00, 0x27, 0x00, 0x0e, 0x00, 0x05, 0x00, 0xf1, 0xff, 0xf8, 0xff, 
-0xf9, 0xff, 0xf9, 0xff, 0x0b, 0x00, 0x19, 0x00, 0x36, 0x00, 0x47, 0x00, 0x5d, 0x00, 0x71, 0x00, 
-0x74, 0x00, 0x80, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x58, 0x00, 0x4d, 0x00, 0x1e, 0x00, 
-0xf3, 0xff, 0xe0, 0xff, 0xc7, 0xff, 0xbd, 0xff, 0xb3, 0xff, 0xaa, 0xff, 0xff, 0xff, 0x5b, 0x00, 
-0x36, 0x00, 0x5a, 0x00, 0x80, 0x00, 0x34, 0x00, 0x62, 0x00, 0x4d, 0x00, 0x07, 0x00, 0xd5, 0xff, 
-0x5f, 0xff, 0xa6, 0xff, 0x69, 0xff, 0xbd, 0xfe, 0xb9, 0xfe, 0x2e, 0xfe, 0xe5, 0xfd, 0xd9, 0xfd, 
-0x29, 0xfe, 0x16, 0xff, 0x4d, 0xff, 0x76, 0x00, 0xe0, 0x01, 0x6d, 0x02, 0x52, 0x03, 0xa8, 0x03, 
-0x02, 0x04, 0xfd, 0x03, 0x65, 0x03, 0x83, 0x03, 0xdc, 0x02, 0xdb, 0x01, 0x31, 0x01, 0x26, 0x00, 
-0x19, 0xff, 0xe0, 0xfd, 0xd2, 0xfc, 0x9c, 0xfb, 0xc4, 0xf9, 0x14, 0xf8, 0x2f, 0xf6, 0xc6, 0xf3, 
-0x99, 0xf1, 0x12, 0xf0, 0xba, 0xef, 0x96, 0xf0, 0x29, 0xf2, 0x9b, 0xf4, 0x6f, 0xf7, 0x96, 0xfa, 
-0x82, 0xfe, 0x21, 0x02, 0x9d, 0x05, 0x0e, 0x09, 0xe7, 0x0b, 0xce, 0x0e, 0xe9, 0x10, 0xcd, 0x11, 
-0xd8, 0x11, 0xcd, 0x10, 0x60, 0x0f, 0x90, 0x0d, 0x79, 0x0b, 0x4b, 0x09, 0xf4, 0x06, 0x2b, 0x05, 
-0xd2, 0x03, 0x8f, 0x02, 0x68, 0x01, 0x64, 0x00, 0x6c, 0xff, 0x4e, 0xfe, 0x73, 0xfd, 0xaf, 0xfc, 
-0xeb, 0xfb, 0x38, 0xfb, 0x88, 0xfa, 0xf0, 0xf9, 0xed, 0xf8, 0xeb, 0xf7, 0xfe, 0xf6, 0xd9, 0xf5, 
-0x28, 0xf5, 0xbe, 0xf4, 0x29, 0xf5, 0x34, 0xf6, 0x28, 0xf7, 0xf4, 0xf8, 0xf6, 0xfa, 0xec, 0xfc, 
-0x31, 0xff, 0x7e, 0x01, 0x03, 0x04, 0x0a, 0x06, 0xf6, 0x07, 0xc0, 0x09, 0xab, 0x0a, 0x71, 0x0b, 
-0x89, 0x0b, 0x65, 0x0b, 0x6d, 0x0b, 0xd3, 0x0a, 0xc4, 0x0a, 0x89, 0x0a, 0xc0, 0x09, 0x5f, 0x09, 
-0x19, 0x08, 0x47, 0x06, 0x25, 0x04, 0x47, 0x01, 0x3e, 0xfe, 0x88, 0xfa, 0xc3, 0xf6, 0x2d, 0xf3, 
-0x3d, 0xef, 0xca, 0xeb, 0x60, 0xe8, 0xd5, 0xe4, 0xd1, 0xe3, 0x10, 0xe5, 0xda, 0xe6, 0xf1, 0xea, 
-0xeb, 0xef, 0xa2, 0xf4, 0xae, 0xfa, 0x7a, 0x00, 0x44, 0x06, 0x3a, 0x0b, 0xbd, 0x0e, 0x66, 0x13, 
-0x9e, 0x16, 0x0d, 0x18, 0x6a, 0x19, 0xbf, 0x18, 0x19, 0x17, 0xaa, 0x14, 0xc4, 0x11, 0x04, 0x0f, 
-0xec, 0x0a, 0x84, 0x07, 0xdd, 0x04, 0xb6, 0x01, 0x5d, 0xff, 0x7b, 0xfd, 0x2c, 0xfc, 0x1a, 0xfb, 
-0x05, 0xfa, 0x04, 0xfa, 0x18, 0xfa, 0xd5, 0xf9, 0x0c, 0xfa, 0x36, 0xfa, 0x05, 0xfa, 0x3d, 0xf9, 
-0xd6, 0xf7, 0x5e, 0xf6, 0xef, 0xf3, 0x5c, 0xf1, 0xdd, 0xf0, 0x35, 0xf1, 0xe5, 0xf1, 0x10, 0xf4, 
-0x95, 0xf6, 0x4f, 0xf9, 0xdb, 0xfc, 0x7a, 0x00, 0x29, 0x04, 0x30, 0x07, 0x1a, 0x0a, 0x82, 0x0d, 
-0xaa, 0x0f, 0x15, 0x11, 0x4e, 0x11, 0x15, 0x10, 0x92, 0x0e, 0x45, 0x0c, 0x5e, 0x0a, 0x5a, 0x08, 
-0xf6, 0x05, 0x89, 0x04, 0x20, 0x03, 0xdc, 0x01, 0x87, 0x00, 0x62, 0xff, 0xa8, 0xfe, 0x6a, 0xfd, 
-0xf4, 0xfc, 0xda, 0xfc, 0x2f, 0xfc, 0x99, 0xfb, 0x6e, 0xfa, 0xc9, 0xf8, 0xa1, 0xf6, 0x3c, 0xf3, 
-0x3b, 0xf0, 0xc0, 0xec, 0x6a, 0xe9, 0xfc, 0xe9, 0xa1, 0xea, 0xef, 0xeb, 0x29, 0xf0, 0xe3, 0xf2, 
-0x91, 0xf7, 0xd4, 0xfc, 0xa1, 0x00, 0x40, 0x06, 0xa8, 0x09, 0xdd, 0x0d, 0xcc, 0x12, 0xbc, 0x14, 
-0x02, 0x17, 0xc3, 0x16, 0x5d, 0x15, 0xc9, 0x13, 0x5c, 0x10, 0xdf, 0x0e, 0x27, 0x0c, 0xe9, 0x08, 
-0xd3, 0x07, 0x63, 0x05, 0x55, 0x03, 0x6d, 0x01, 0x5d, 0xff, 0x43, 0xfe, 0xed, 0xfb, 0xfd, 0xfa, 
-0x87, 0xfa, 0xbc, 0xf8, 0x50, 0xf8, 0xfb, 0xf6, 0x24, 0xf5, 0xa9, 0xf2, 0xbc, 0xee, 0x6b, 0xeb, 
-0xdb, 0xe7, 0x66, 0xe7, 0xb0, 0xe8, 0x49, 0xea, 0xe4, 0xee, 0x30, 0xf2, 0x07, 0xf7, 0xd8, 0xfc, 
-0x54, 0x00, 0xa9, 0x05, 0x91, 0x09, 0xe7, 0x0d, 0x6f, 0x13, 0x06, 0x16, 0xe3, 0x18, 0xa0, 0x19, 
-0x3f, 0x18, 0xd2, 0x16, 0xa5, 0x13, 0xe7, 0x10, 0x78, 0x0d, 0x40, 0x0a, 0x9f, 0x08, 0x0a, 0x06, 
-0xd3, 0x03, 0x8a, 0x01, 0x70, 0xff, 0x03, 0xfe, 0xf1, 0xfb, 0x18, 0xfb, 0x59, 0xfa, 0x5d, 0xf9, 
-0x07, 0xf9, 0xd7, 0xf7, 0x83, 0xf6, 0xd8, 0xf3, 0x38, 0xf0, 0x9c, 0xec, 0x3d, 0xe8, 0xbf, 0xe6, 
-0x5b, 0xe7, 0x60, 0xe8, 0x71, 0xeb, 0xae, 0xee, 0xd9, 0xf2, 0xc7, 0xf7, 0x52, 0xfc, 0xc2, 0x01, 
-0x5e, 0x06, 0x19, 0x0b, 0xb8, 0x10, 0x03, 0x15, 0x37, 0x18, 0x94, 0x19, 0x54, 0x19, 0xfc, 0x17, 
-0x6a, 0x15, 0x15, 0x13, 0xfb, 0x0f, 0x72, 0x0c, 0xe9, 0x09, 0x78, 0x07, 0x0f, 0x05, 0x68, 0x02, 
-0x25, 0x00, 0xba, 0xfe, 0x27, 0xfd, 0x33, 0xfc, 0xbc, 0xfb, 0xdc, 0xfa, 0x24, 0xfa, 0x72, 0xf9, 
-0x82, 0xf8, 0x93, 0xf6, 0x12, 0xf3, 0x24, 0xef, 0x88, 0xea, 0x82, 0xe6, 0x9f, 0xe4, 0x09, 0xe4, 
-0xe7, 0xe5, 0x06, 0xe9, 0x09, 0xed, 0xb1, 0xf2, 0xae, 0xf7, 0xfc, 0xfc, 0x2d, 0x02, 0x30, 0x07, 
-0x20, 0x0d, 0x62, 0x12, 0x85, 0x17, 0xec, 0x1a, 0xe4, 0x1b, 0xd5, 0x1b, 0x14, 0x1a, 0xa4, 0x17, 
-0xb8, 0x14, 0x4b, 0x11, 0x66, 0x0e, 0xc4, 0x0b, 0x1a, 0x09, 0xc9, 0x06, 0x3c, 0x04, 0x82, 0x01, 
-0xbf, 0xff, 0x26, 0xfe, 0xdf, 0xfc, 0xe1, 0xfb, 0xc4, 0xfa, 0x5f, 0xfa, 0x5b, 0xf9, 0xc2, 0xf7, 
-0x8f, 0xf5, 0xdf, 0xf1, 0x8d, 0xed, 0xa0, 0xe8, 0xe3, 0xe4, 0x3a, 0xe3, 0x2c, 0xe3, 0xb1, 0xe5, 
-0x54, 0xe9, 0xc4, 0xed, 0x1a, 0xf3, 0x56, 0xf8, 0xcc, 0xfd, 0x1f, 0x03, 0xe6, 0x08, 0xd9, 0x0e, 
-0x70, 0x14, 0x66, 0x19, 0xfc, 0x1b, 0xd9, 0x1c, 0x04, 0x1c, 0x71, 0x19, 0x71, 0x16, 0x1f, 0x13, 
-0xa2, 0x0f, 0x2f, 0x0c, 0x66, 0x09, 0xc8, 0x06, 0xe5, 0x03, 0x57, 0x01, 0x28, 0xff, 0xa3, 0xfd, 
-0x6b, 0xfc, 0xc1, 0xfb, 0x81, 0xfb, 0xfa, 0xfa, 0xc1, 0xfa, 0x44, 0xfa, 0xe0, 0xf8, 0xa7, 0xf6, 
-0x64, 0xf3, 0x53, 0xef, 0xa3, 0xea, 0x74, 0xe6, 0x21, 0xe4, 0xbf, 0xe3, 0x5b, 0xe5, 0x02, 0xe8, 
-0x9b, 0xeb, 0x87, 0xf0, 0x71, 0xf5, 0xb6, 0xfa, 0x7a, 0x00, 0xa4, 0x06, 0xda, 0x0c, 0xa9, 0x12, 
-0x43, 0x18, 0x89, 0x1b, 0x03, 0x1d, 0x01, 0x1d, 0x1b, 0x1b, 0x9e, 0x18, 0x38, 0x15, 0x80, 0x11, 
-0xdb, 0x0d, 0x18, 0x0b, 0x64, 0x08, 0x56, 0x05, 0x0c, 0x03, 0x81, 0x00, 0xff, 0xfe, 0x7c, 0xfd, 
-0x77, 0xfc, 0xf6, 0xfc, 0xe6, 0xfc, 0x5c, 0xfd, 0x22, 0xfd, 0x0a, 0xfd, 0x12, 0xfc, 0xa2, 0xf8, 
-0x7a, 0xf5, 0xb4, 0xf0, 0xe1, 0xeb, 0x75, 0xe7, 0x7f, 0xe3, 0x3b, 0xe3, 0x75, 0xe3, 0x87, 0xe5, 
-0x27, 0xea, 0x2d, 0xef, 0xf6, 0xf5, 0x0b, 0xfc, 0xba, 0x02, 0x15, 0x0a, 0xbc, 0x0f, 0x9b, 0x15, 
-0xbc, 0x19, 0xd2, 0x1c, 0xb7, 0x1e, 0x80, 0x1d, 0x44, 0x1b, 0x89, 0x17, 0x54, 0x13, 0x16, 0x0f, 
-0x27, 0x0b, 0x06, 0x08, 0x64, 0x04, 0xe1, 0x01, 0x4e, 0xff, 0x0a, 0xfd, 0xee, 0xfb, 0xc6, 0xfa, 
-0x3a, 0xfb, 0x00, 0xfc, 0x8b, 0xfc, 0xfd, 0xfc, 0xcb, 0xfc, 0xf8, 0xfb, 0x29, 0xf9, 0xd1, 0xf5, 
-0xe1, 0xf1, 0xb3, 0xec, 0xc3, 0xe7, 0x88, 0xe3, 0x07, 0xe2, 0x22, 0xe2, 0xd7, 0xe2, 0xf6, 0xe6, 
-0xac, 0xec, 0x9c, 0xf2, 0x1a, 0xf9, 0xbd, 0xff, 0x15, 0x07, 0x3e, 0x0d, 0xc4, 0x12, 0x22, 0x18, 
-0xdb, 0x1b, 0x5c, 0x1e, 0x68, 0x1e, 0x72, 0x1c, 0x6a, 0x19, 0x16, 0x15, 0xa1, 0x10, 0xf4, 0x0c, 
-0xb9, 0x09, 0x6d, 0x06, 0xda, 0x03, 0x6f, 0x01, 0x70, 0xff, 0x0b, 0xfe, 0xa9, 0xfc, 0xb7, 0xfc, 
-0x17, 0xfd, 0x9b, 0xfd, 0x1b, 0xfe, 0xa8, 0xfd, 0x5b, 0xfd, 0x33, 0xfb, 0xbc, 0xf7, 0x40, 0xf4, 
-0x33, 0xef, 0x68, 0xea, 0x04, 0xe6, 0xff, 0xe2, 0x1b, 0xe3, 0xc8, 0xe3, 0x74, 0xe6, 0xd4, 0xeb, 
-0x95, 0xf1, 0x99, 0xf7, 0x0b, 0xfe, 0x0a, 0x05, 0x6c, 0x0b, 0x5f, 0x11, 0xa6, 0x16, 0xa8, 0x1a, 
-0xca, 0x1d, 0x9a, 0x1e, 0x22, 0x1d, 0x14, 0x1a, 0x27, 0x16, 0xc4, 0x11, 0xb1, 0x0d, 0xba, 0x0a, 
-0x7a, 0x07, 0xaa, 0x04, 0x0d, 0x02, 0xb9, 0xff, 0x5c, 0xfe, 0x99, 0xfc, 0x01, 0xfc, 0x35, 0xfc, 
-0x83, 0xfc, 0x2d, 0xfd, 0xa2, 0xfc, 0x76, 0xfc, 0x43, 0xfb, 0xac, 0xf7, 0x6a, 0xf4, 0xaf, 0xef, 
-0x67, 0xea, 0x4d, 0xe6, 0x64, 0xe2, 0x9d, 0xe1, 0xd7, 0xe2, 0xbf, 0xe4, 0x9a, 0xe9, 0xb9, 0xef, 
-0xd5, 0xf5, 0x2d, 0xfc, 0xd3, 0x02, 0x4d, 0x09, 0x95, 0x0f, 0xe9, 0x14, 0x91, 0x18, 0xc6, 0x1b, 
-0x91, 0x1d, 0xee, 0x1c, 0x19, 0x1a, 0x3b, 0x16, 0x7c, 0x12, 0xbd, 0x0e, 0x60, 0x0b, 0x85, 0x08, 
-0xc1, 0x05, 0x49, 0x03, 0xe8, 0x00, 0xc8, 0xfe, 0x53, 0xfd, 0x8c, 0xfc, 0x69, 0xfc, 0xd2, 0xfc, 
-0xeb, 0xfd, 0x43, 0xfe, 0x1d, 0xfe, 0x7d, 0xfe, 0x05, 0xfc, 0x72, 0xf8, 0xee, 0xf4, 0xec, 0xee, 
-0xe4, 0xe9, 0xec, 0xe4, 0xb3, 0xe1, 0xf5, 0xe1, 0x9a, 0xe2, 0xd0, 0xe5, 0x07, 0xeb, 0xf3, 0xf0, 
-0x40, 0xf7, 0x7b, 0xfd, 0x4a, 0x04, 0x25, 0x0b, 0x31, 0x11, 0x18, 0x16, 0x82, 0x1a, 0xa7, 0x1d, 
-0x40, 0x1e, 0xed, 0x1c, 0xff, 0x19, 0xe8, 0x15, 0xc0, 0x11, 0x25, 0x0e, 0xa4, 0x0a, 0x91, 0x07, 
-0x98, 0x04, 0xcf, 0x01, 0xe9, 0xff, 0xcd, 0xfd, 0x92, 0xfc, 0x03, 0xfc, 0x29, 0xfc, 0xf8, 0xfc, 
-0x7a, 0xfd, 0xec, 0xfd, 0x88, 0xfd, 0x75, 0xfc, 0xa8, 0xf9, 0x32, 0xf6, 0xfb, 0xf1, 0x4a, 0xec, 
-0xbe, 0xe7, 0x9f, 0xe3, 0xe4, 0xe1, 0x88, 0xe2, 0x39, 0xe4, 0x89, 0xe8, 0xa9, 0xed, 0x7a, 0xf4, 
-0x25, 0xfb, 0xad, 0x01, 0x6a, 0x08, 0x39, 0x0e, 0xa9, 0x14, 0x82, 0x18, 0x80, 0x1b, 0xaf, 0x1d, 
-0x1d, 0x1d, 0x11, 0x1b, 0x2a, 0x17, 0x50, 0x13, 0x46, 0x0f, 0x2b, 0x0c, 0x3e, 0x09, 0x42, 0x06, 
-0x5e, 0x04, 0x43, 0x01, 0x66, 0xff, 0x8f, 0xfd, 0xf8, 0xfb, 0x50, 0xfc, 0x79, 0xfc, 0x66, 0xfd, 
-0x06, 0xfe, 0x4f, 0xfe, 0x5c, 0xfe, 0x99, 0xfc, 0x7e, 0xf9, 0xbb, 0xf5, 0x18, 0xf1, 0x4e, 0xeb, 
-0x61, 0xe6, 0x0a, 0xe3, 0x4e, 0xe2, 0xd7, 0xe2, 0xc6, 0xe4, 0xf1, 0xe9, 0xb6, 0xef, 0xe7, 0xf5, 
-0xbe, 0xfb, 0x46, 0x02, 0x40, 0x09, 0x85, 0x0f, 0x13, 0x15, 0x93, 0x18, 0x28, 0x1c, 0x54, 0x1e, 
-0x52, 0x1d, 0x84, 0x1a, 0x1f, 0x16, 0xab, 0x11, 0xea, 0x0d, 0xce, 0x0a, 0xc4, 0x07, 0xee, 0x04, 
-0x5d, 0x02, 0x01, 0x00, 0x8c, 0xfe, 0x02, 0xfd, 0xb0, 0xfb, 0xf6, 0xfb, 0x80, 0xfd, 0xb2, 0xfe, 
-0xdb, 0xfe, 0x1e, 0xff, 0x01, 0xff, 0x09, 0xfd, 0x66, 0xf9, 0x05, 0xf5, 0x12, 0xf0, 0xaf, 0xea, 
-0x8d, 0xe5, 0xf8, 0xe2, 0xbf, 0xe3, 0x84, 0xe4, 0x48, 0xe7, 0xdb, 0xec, 0x4a, 0xf3, 0x97, 0xf9, 
-0xbb, 0xfe, 0x62, 0x05, 0x36, 0x0c, 0x37, 0x12, 0xdf, 0x16, 0x95, 0x19, 0x96, 0x1c, 0xe2, 0x1c, 
-0x06, 0x1b, 0x1d, 0x18, 0x64, 0x13, 0x09, 0x0f, 0x70, 0x0b, 0xd5, 0x08, 0x9f, 0x06, 0x46, 0x04, 
-0x45, 0x01, 0x41, 0xff, 0x86, 0xfe, 0xac, 0xfc, 0xfb, 0xfb, 0x6a, 0xfc, 0x23, 0xfd, 0x01, 0xfe, 
-0xe7, 0xfd, 0x06, 0xfe, 0x73, 0xfd, 0x17, 0xfb, 0xf3, 0xf6, 0x00, 0xf2, 0x12, 0xed, 0xf5, 0xe7, 
-0x4b, 0xe3, 0xde, 0xe0, 0x28, 0xe1, 0x78, 0xe2, 0xe4, 0xe5, 0x2a, 0xec, 0xa1, 0xf2, 0x37, 0xf9, 
-0xb7, 0xff, 0x09, 0x05, 0x6d, 0x0b, 0xd5, 0x11, 0xad, 0x16, 0x52, 0x1a, 0xd3, 0x1c, 0x66, 0x1d, 
-0xfe, 0x1b, 0x66, 0x19, 0x5c, 0x15, 0xd6, 0x10, 0x66, 0x0d, 0xb4, 0x0a, 0xef, 0x07, 0x47, 0x05, 
-0xfd, 0x01, 0xf8, 0xff, 0x34, 0xfe, 0x92, 0xfd, 0xac, 0xfd, 0x99, 0xfd, 0xcc, 0xfe, 0xe3, 0xff, 
-0xe5, 0xff, 0x9d, 0xff, 0x83, 0xff, 0xc6, 0xfc, 0xff, 0xf7, 0x21, 0xf1, 0x53, 0xea, 0x01, 0xe4, 
-0xbf, 0xdd, 0x44, 0xd8, 0x33, 0xe0, 0xe0, 0xe6, 0x31, 0xea, 0xe4, 0xf4, 0xe9, 0xff, 0x1d, 0x09, 
-0x93, 0x0c, 0x85, 0x10, 0x5d, 0x14, 0x3b, 0x1b, 0x45, 0x1b, 0x4e, 0x18, 0x82, 0x16, 0x3e, 0x14, 
-0x74, 0x11, 0x56, 0x0a, 0x24, 0x05, 0x4c, 0x00, 0xd9, 0xfc, 0x53, 0xf9, 0x1b, 0xf8, 0x7e, 0xf9, 
-0xe2, 0xfc, 0x42, 0x01, 0x53, 0x04, 0xbb, 0x08, 0xa8, 0x0c, 0x49, 0x0e, 0x35, 0x0d, 0xfb, 0x0c, 
-0xcb, 0x0b, 0x36, 0x08, 0x5a, 0x04, 0xc9, 0xfe, 0x72, 0xf6, 0xe4, 0xec, 0x4e, 0xe0, 0xa7, 0xd5, 
-0x99, 0xcd, 0x16, 0xcc, 0x98, 0xd7, 0xab, 0xe5, 0xe6, 0xf2, 0x40, 0xf9, 0x25, 0x02, 0x81, 0x0c, 
-0xdc, 0x13, 0x2e, 0x17, 0xeb, 0x15, 0x1d, 0x19, 0x2b, 0x19, 0xd3, 0x16, 0x3e, 0x12, 0x93, 0x0e, 
-0xd5, 0x0b, 0xd3, 0x07, 0xd7, 0x01, 0x1e, 0xfb, 0xc0, 0xf7, 0xc6, 0xf4, 0x7c, 0xf1, 0xd3, 0xf4, 
-0xd6, 0xfb, 0x74, 0x04, 0x60, 0x0d, 0x47, 0x0f, 0x61, 0x13, 0xdb, 0x14, 0x34, 0x15, 0x01, 0x12, 
-0x34, 0x0d, 0x57, 0x0c, 0x35, 0x06, 0xf6, 0xff, 0xac, 0xf8, 0xdc, 0xf0, 0x7a, 0xea, 0x61, 0xe0, 
-0x3c, 0xd7, 0x99, 0xce, 0xf1, 0xcd, 0xc3, 0xd6, 0x0f, 0xe8, 0xb8, 0xf9, 0x6b, 0x01, 0xf6, 0x08, 
-0x82, 0x0d, 0x95, 0x16, 0xf0, 0x18, 0xc6, 0x17, 0x95, 0x16, 0x0a, 0x15, 0x5d, 0x14, 0xd8, 0x0c, 
-0xc5, 0x07, 0x51, 0x03, 0xbc, 0x02, 0x43, 0xff, 0x5b, 0xfb, 0x90, 0xf8, 0x02, 0xf5, 0x09, 0xf4, 
-0xec, 0xf2, 0xa8, 0xfb, 0x80, 0x06, 0xaf, 0x0f, 0x66, 0x12, 0x42, 0x13, 0x72, 0x15, 0x07, 0x14, 
-0xcd, 0x11, 0xe5, 0x0b, 0xfa, 0x09, 0x7d, 0x07, 0x9e, 0xff, 0xf2, 0xf7, 0x2a, 0xf1, 0xac, 0xea, 
-0xa2, 0xe4, 0x33, 0xdb, 0x6a, 0xd5, 0xd8, 0xcf, 0x3a, 0xd5, 0xdd, 0xe6, 0xc5, 0xf9, 0x80, 0x05, 
-0x1d, 0x08, 0x6a, 0x0e, 0x82, 0x12, 0x67, 0x17, 0xe5, 0x14, 0xf5, 0x13, 0x40, 0x14, 0x10, 0x12, 
-0x1f, 0x0d, 0xc3, 0x03, 0xd7, 0x02, 0xb1, 0x02, 0xac, 0x02, 0x3e, 0xfe, 0x2e, 0xf9, 0xf4, 0xf7, 
-0xf7, 0xf5, 0x14, 0xf7, 0x83, 0xfb, 0x50, 0x06, 0x46, 0x11, 0x8d, 0x14, 0x33, 0x11, 0x58, 0x0e, 
-0xb7, 0x0f, 0x70, 0x0f, 0x6a, 0x0b, 0x95, 0x06, 0x30, 0x04, 0x5b, 0x01, 0xd1, 0xf8, 0xf4, 0xf1, 
-0x0f, 0xed, 0xbd, 0xe8, 0x41, 0xe3, 0xd1, 0xd6, 0xa8, 0xd2, 0x33, 0xd1, 0xcf, 0xdf, 0x71, 0xf7, 
-0x1f, 0x05, 0xa3, 0x0b, 0x34, 0x09, 0x6e, 0x0f, 0x12, 0x14, 0xa0, 0x15, 0x37, 0x10, 0x99, 0x0e, 
-0x5d, 0x10, 0xb5, 0x0d, 0xf5, 0x06, 0xfa, 0xfe, 0xf9, 0x00, 0xec, 0x04, 0xa0, 0x03, 0x01, 0xfd, 
-0x9a, 0xf8, 0x67, 0xf6, 0x7f, 0xf6, 0xca, 0xf8, 0xeb, 0xff, 0x2d, 0x0e, 0xed, 0x17, 0x7b, 0x14, 
-0x0a, 0x0f, 0x20, 0x0d, 0x92, 0x10, 0x6b, 0x0f, 0x33, 0x0a, 0x2e, 0x06, 0x44, 0x03, 0x33, 0xfe, 
-0x12, 0xf4, 0x89, 0xef, 0x02, 0xee, 0x05, 0xec, 0xa5, 0xe4, 0x77, 0xda, 0x20, 0xd6, 0xf8, 0xd9, 
-0xa9, 0xe6, 0x22, 0xff, 0xdb, 0x0a, 0x65, 0x0d, 0xfa, 0x0b, 0x96, 0x0e, 0xf3, 0x13, 0x86, 0x10, 
-0x8a, 0x0e, 0xa2, 0x0a, 0x0f, 0x0e, 0x71, 0x09, 0xd4, 0x02, 0x51, 0xfd, 0x75, 0xff, 0x55, 0x04, 
-0xa9, 0xff, 0x1a, 0xfd, 0x20, 0xf8, 0x96, 0xf7, 0xa8, 0xf9, 0xec, 0xf9, 0xe7, 0x03, 0xc2, 0x11, 
-0x30, 0x16, 0xb7, 0x11, 0x24, 0x0b, 0xb6, 0x0d, 0xaf, 0x0e, 0x0f, 0x0b, 0x59, 0x05, 0xe5, 0x02, 
-0x53, 0x02, 0x23, 0xfa, 0x55, 0xf2, 0x23, 0xef, 0xc4, 0xed, 0x16, 0xe9, 0xf4, 0xe0, 0x2d, 0xd9, 
-0x56, 0xda, 0x34, 0xdb, 0x22, 0xeb, 0xb4, 0x05, 0x28, 0x0f, 0x29, 0x0d, 0xbd, 0x08, 0x91, 0x0d, 
-0xe6, 0x13, 0x14, 0x12, 0xb5, 0x0d, 0x9e, 0x0b, 0x96, 0x0b, 0x23, 0x07, 0x10, 0x00, 0x53, 0x00, 
-0xde, 0x05, 0x76, 0x07, 0x9b, 0x01, 0x7b, 0xf9, 0x81, 0xf8, 0xe2, 0xf7, 0x74, 0xfa, 0xc9, 0xfd, 
-0xdb, 0x06, 0xeb, 0x14, 0xe9, 0x15, 0xab, 0x0d, 0x4f, 0x08, 0x70, 0x0c, 0x3b, 0x0f, 0xfd, 0x0a, 
-0xa4, 0x04, 0xa2, 0x04, 0x12, 0x02, 0x6f, 0xf8, 0x08, 0xef, 0x39, 0xef, 0xdd, 0xf0, 0x62, 0xed, 
-0xc4, 0xe2, 0xad, 0xd9, 0xec, 0xd8, 0x5a, 0xd9, 0xf2, 0xed, 0x47, 0x07, 0xd5, 0x11, 0x18, 0x0d, 
-0x9b, 0x07, 0xf4, 0x0c, 0x7f, 0x12, 0xa7, 0x10, 0x99, 0x0b, 0x40, 0x0d, 0xba, 0x0e, 0xc5, 0x06, 
-0x6a, 0xfd, 0xf7, 0xfc, 0x40, 0x03, 0x33, 0x04, 0xb5, 0xfe, 0x87, 0xfb, 0x72, 0xf9, 0x35, 0xf8, 
-0xcc, 0xf6, 0x72, 0xfb, 0x4b, 0x06, 0x12, 0x16, 0x26, 0x18, 0xb4, 0x0e, 0xd5, 0x09, 0x99, 0x0a, 
-0x63, 0x0e, 0x9f, 0x09, 0x63, 0x07, 0x67, 0x05, 0xef, 0x02, 0xe4, 0xf7, 0x9b, 0xed, 0xcf, 0xef, 
-0x66, 0xf2, 0xef, 0xef, 0x29, 0xe2, 0xb9, 0xda, 0x3b, 0xdb, 0xa4, 0xdb, 0x8d, 0xed, 0x5b, 0x07, 
-0x7d, 0x10, 0x02, 0x0d, 0xfd, 0x05, 0x09, 0x0c, 0x49, 0x11, 0x60, 0x0f, 0xc6, 0x0d, 0xbf, 0x0e, 
-0xe4, 0x0e, 0xf1, 0x04, 0x27, 0xfc, 0x44, 0xfb, 0x2b, 0x00, 0xd4, 0x02, 0xca, 0x00, 0xdb, 0xfc, 
-0xde, 0xf8, 0x4e, 0xf6, 0xae, 0xf6, 0x65, 0xfb, 0x37, 0x08, 0x9d, 0x14, 0xbf, 0x17, 0xcd, 0x0e, 
-0xf1, 0x0a, 0x97, 0x0d, 0x60, 0x0c, 0xd2, 0x0a, 0xa1, 0x07, 0xfe, 0x07, 0x18, 0x02, 0x04, 0xf6, 
-0x6c, 0xf1, 0xb2, 0xef, 0x40, 0xf0, 0x9b, 0xee, 0xd9, 0xe4, 0xb6, 0xe1, 0x6f, 0xdb, 0x66, 0xdb, 
-0x94, 0xeb, 0x1f, 0x05, 0x70, 0x12, 0x90, 0x0a, 0x3d, 0x09, 0xbb, 0x0a, 0x1c, 0x12, 0x73, 0x10, 
-0x4b, 0x0b, 0x83, 0x0e, 0xc9, 0x0c, 0x80, 0x07, 0xa6, 0xfd, 0x9d, 0xfc, 0x9c, 0x01, 0xba, 0x01, 
-0x4d, 0xff, 0xc4, 0xfb, 0xb0, 0xfb, 0xd6, 0xf5, 0x60, 0xf4, 0xba, 0xf8, 0x77, 0x04, 0xd2, 0x13, 
-0x08, 0x14, 0x72, 0x12, 0x4c, 0x0d, 0x12, 0x0e, 0x1f, 0x0e, 0xc5, 0x08, 0x8a, 0x0a, 0xb4, 0x07, 
-0x94, 0x04, 0x6b, 0xf9, 0xfd, 0xef, 0x15, 0xf1, 0xb6, 0xee, 0x1b, 0xee, 0xd0, 0xe7, 0xf5, 0xde, 
-0x83, 0xdd, 0x5e, 0xd5, 0x9a, 0xe4, 0xdf, 0x03, 0x09, 0x0d, 0x70, 0x0d, 0x72, 0x06, 0x38, 0x10, 
-0x42, 0x10, 0x8e, 0x0b, 0x93, 0x0b, 0xa8, 0x0d, 0x9c, 0x11, 0xc0, 0x05, 0x95, 0x00, 0x75, 0xfd, 
-0xb3, 0x01, 0x2c, 0x02, 0x77, 0xff, 0x40, 0xff, 0x46, 0xfc, 0x9e, 0xf8, 0xb7, 0xf3, 0xea, 0xf7, 
-0x32, 0x03, 0xf0, 0x11, 0x90, 0x15, 0x7a, 0x11, 0x41, 0x0f, 0x4c, 0x0e, 0x93, 0x0d, 0x36, 0x0a, 
-0x81, 0x0a, 0x5f, 0x09, 0x10, 0x05, 0x54, 0xf9, 0x30, 0xf1, 0x08, 0xf1, 0x63, 0xee, 0xc0, 0xed, 
-0xee, 0xe8, 0x28, 0xe2, 0x8b, 0xda, 0xd2, 0xd7, 0x4a, 0xe2, 0xde, 0xfd, 0x39, 0x0c, 0xd4, 0x0b, 
-0x8b, 0x0b, 0x87, 0x0d, 0x72, 0x11, 0x79, 0x0c, 0xcf, 0x0c, 0xc9, 0x0f, 0x55, 0x11, 0xf3, 0x06, 
-0xe1, 0xfe, 0x6f, 0xfe, 0x15, 0x00, 0xbc, 0x00, 0xd7, 0xfd, 0xa1, 0xfe, 0x8b, 0xfb, 0x73, 0xf6, 
-0xfd, 0xf5, 0xd0, 0xf8, 0xdb, 0x05, 0x5a, 0x10, 0xec, 0x12, 0x2f, 0x12, 0xf3, 0x0d, 0xf4, 0x10, 
-0x41, 0x0d, 0xc2, 0x0c, 0x14, 0x0c, 0xf3, 0x05, 0xa1, 0x02, 0xdb, 0xf8, 0xea, 0xf3, 0x4e, 0xf2, 
-0x47, 0xed, 0xb8, 0xec, 0x62, 0xe8, 0x43, 0xdf, 0x97, 0xdc, 0x95, 0xda, 0x90, 0xe6, 0xe4, 0xfa, 
-0x8e, 0x07, 0x33, 0x0c, 0x4e, 0x09, 0x48, 0x10, 0x0a, 0x12, 0x7b, 0x0d, 0x21, 0x10, 0x6a, 0x10, 
-0x04, 0x0e, 0x7f, 0x06, 0x05, 0x02, 0x1c, 0x03, 0x68, 0xff, 0x6f, 0xff, 0xbf, 0xff, 0x21, 0xfd, 
-0x80, 0xfb, 0x72, 0xf4, 0x0b, 0xf8, 0x12, 0xfa, 0x4d, 0x02, 0xbf, 0x0d, 0x97, 0x0e, 0xe4, 0x11, 
-0x19, 0x0f, 0xce, 0x0f, 0xdd, 0x0d, 0x42, 0x0b, 0xc0, 0x0c, 0x4a, 0x08, 0x92, 0x02, 0xa4, 0xfc, 
-0xb9, 0xf6, 0xf0, 0xf4, 0x7e, 0xed, 0x73, 0xeb, 0x11, 0xe9, 0xd8, 0xdf, 0xd3, 0xd9, 0x87, 0xd8, 
-0x2b, 0xe8, 0x0d, 0xf8, 0xf4, 0x00, 0xde, 0x08, 0x10, 0x0d, 0x34, 0x11, 0x76, 0x0e, 0xd4, 0x0c, 
-0x5d, 0x12, 0x23, 0x10, 0xba, 0x0c, 0xbf, 0x09, 0xb9, 0x07, 0x48, 0x03, 0x40, 0xfd, 0x54, 0xff, 
-0x33, 0x00, 0x7d, 0xfc, 0xea, 0xfa, 0xa1, 0xf6, 0xaa, 0xf6, 0xec, 0xf6, 0x9e, 0xfe, 0xed, 0x0b, 
-0xbb, 0x0d, 0x85, 0x12, 0x71, 0x12, 0xba, 0x11, 0x50, 0x0e, 0x68, 0x0b, 0x3d, 0x0f, 0xec, 0x0a, 
-0x5b, 0x04, 0xd2, 0xfe, 0x73, 0xf8, 0x50, 0xf3, 0xc8, 0xeb, 0x1d, 0xea, 0x4e, 0xe8, 0x22, 0xdf, 
-0x61, 0xd7, 0xcb, 0xd8, 0x7e, 0xe8, 0x62, 0xf9, 0xbd, 0xfd, 0x75, 0x08, 0x64, 0x12, 0xf7, 0x0e, 
-0x7e, 0x0e, 0x1d, 0x10, 0x9b, 0x14, 0xec, 0x0e, 0xd6, 0x0a, 0x6d, 0x0c, 0x9c, 0x08, 0x5f, 0x01, 
-0x84, 0xff, 0xf6, 0xff, 0x9d, 0xfd, 0x87, 0xfb, 0xf7, 0xf9, 0x7e, 0xf7, 0x34, 0xf6, 0x3d, 0xf6, 
-0x07, 0x01, 0x77, 0x0a, 0xd5, 0x0b, 0x33, 0x11, 0x7f, 0x13, 0x46, 0x11, 0x27, 0x0d, 0x48, 0x0e, 
-0xb6, 0x0f, 0x1f, 0x08, 0x07, 0x02, 0x27, 0xfd, 0x3c, 0xf7, 0xa4, 0xf3, 0x9b, 0xea, 0x2f, 0xeb, 
-0x4a, 0xe4, 0x4e, 0xdb, 0x59, 0xdc, 0x8d, 0xda, 0x69, 0xee, 0x14, 0xf9, 0xdf, 0xfe, 0x00, 0x0e, 
-0x5e, 0x0c, 0x72, 0x11, 0xab, 0x10, 0x9c, 0x11, 0x34, 0x13, 0xd2, 0x0d, 0xf3, 0x0b, 0xf4, 0x0a, 
-0xf6, 0x07, 0x56, 0x02, 0x20, 0x00, 0x2c, 0xfe, 0x9d, 0xfa, 0x49, 0xf9, 0x04, 0xf7, 0xf6, 0xf6, 
-0xf5, 0xf6, 0x09, 0xf7, 0xe0, 0x02, 0x8a, 0x09, 0xf2, 0x09, 0xbb, 0x11, 0x88, 0x12, 0x7f, 0x0f, 
-0x42, 0x10, 0x27, 0x0f, 0x9f, 0x0d, 0xce, 0x07, 0xee, 0x03, 0xd0, 0xfe, 0x5d, 0xf7, 0x16, 0xf4, 
-0x31, 0xed, 0xe8, 0xe8, 0x62, 0xe0, 0x60, 0xdd, 0xae, 0xdc, 0x39, 0xdd, 0x1b, 0xf2, 0xc0, 0xf5, 
-0x53, 0xff, 0x87, 0x0d, 0x75, 0x0c, 0x12, 0x10, 0xac, 0x11, 0x4f, 0x15, 0xd9, 0x12, 0x96, 0x0d, 
-0x68, 0x0e, 0xc1, 0x0c, 0xf8, 0x05, 0x7c, 0x03, 0xab, 0x01, 0x91, 0xfb, 0x08, 0xf8, 0x31, 0xf8, 
-0xb1, 0xf4, 0xef, 0xf3, 0x23, 0xf8, 0xe4, 0xf8, 0x4a, 0x03, 0xc7, 0x06, 0x85, 0x0b, 0x0c, 0x15, 
-0x67, 0x0e, 0x12, 0x12, 0xdf, 0x12, 0xe6, 0x0e, 0x49, 0x0b, 0x1b, 0x08, 0x7d, 0x06, 0xb2, 0xfa, 
-0x2c, 0xf8, 0xc0, 0xf4, 0x51, 0xe9, 0xee, 0xe8, 0x9a, 0xdf, 0x0a, 0xda, 0x74, 0xdb, 0x09, 0xe6, 
-0x29, 0xf0, 0x8e, 0xf1, 0x7f, 0x05, 0x91, 0x0a, 0x1a, 0x08, 0x9f, 0x12, 0x27, 0x17, 0x26, 0x12, 
-0xc8, 0x11, 0xba, 0x14, 0xc4, 0x0d, 0xdf, 0x08, 0x5a, 0x0b, 0xe1, 0x03, 0x30, 0xfd, 0xa7, 0xfd, 
-0x28, 0xf9, 0xd0, 0xf6, 0x95, 0xf6, 0xbf, 0xf4, 0x7d, 0xf6, 0xf1, 0xfa, 0xad, 0x01, 0x4b, 0x04, 
-0xa1, 0x0d, 0xdd, 0x10, 0xa7, 0x0f, 0x6f, 0x13, 0xd7, 0x11, 0x9d, 0x10, 0x57, 0x0b, 0xd7, 0x08, 
-0x4c, 0x02, 0x71, 0xf9, 0xe2, 0xf9, 0x78, 0xec, 0x83, 0xe7, 0x03, 0xe6, 0x62, 0xd7, 0x66, 0xdb, 
-0x8d, 0xe3, 0x3f, 0xe9, 0xed, 0xf1, 0x7d, 0xfd, 0x16, 0x06, 0xf0, 0x07, 0x64, 0x0f, 0xcf, 0x14, 
-0x77, 0x12, 0x9b, 0x14, 0xd0, 0x15, 0xa7, 0x0f, 0xa7, 0x0e, 0x77, 0x0e, 0x19, 0x05, 0x9f, 0x01, 
-0x93, 0xfe, 0x5b, 0xf8, 0x6a, 0xf6, 0x9f, 0xf6, 0xce, 0xf3, 0xf4, 0xf3, 0x26, 0xf9, 0x56, 0xfe, 
-0x03, 0x00, 0x72, 0x09, 0xc3, 0x0e, 0xda, 0x0b, 0x7f, 0x13, 0x44, 0x13, 0xa7, 0x0f, 0xfa, 0x10, 
-0xc3, 0x09, 0x38, 0x05, 0xb7, 0xff, 0x3e, 0xf9, 0x13, 0xf2, 0x93, 0xe8, 0x8c, 0xe3, 0xc1, 0xd9, 
-0xaf, 0xd9, 0x48, 0xe2, 0xf6, 0xe5, 0x3a, 0xf0, 0x1a, 0xfb, 0x06, 0xff, 0x5b, 0x06, 0x29, 0x0d, 
-0xb8, 0x10, 0x1a, 0x12, 0xc9, 0x14, 0xd5, 0x16, 0xa5, 0x13, 0xc4, 0x12, 0x1c, 0x12, 0x4f, 0x0b, 
-0x9b, 0x05, 0xdb, 0x00, 0xa0, 0xfa, 0x89, 0xf7, 0xae, 0xf5, 0xef, 0xf2, 0xa6, 0xf4, 0x13, 0xf8, 
-0x3e, 0xfb, 0x53, 0xff, 0x90, 0x06, 0xa9, 0x07, 0x55, 0x0a, 0xd2, 0x0f, 0xe9, 0x0e, 0xa0, 0x0f, 
-0x64, 0x0f, 0xba, 0x0a, 0xc3, 0x07, 0x40, 0x02, 0xfe, 0xfa, 0xbf, 0xf4, 0xdb, 0xea, 0xfd, 0xe2, 
-0x63, 0xdf, 0x4a, 0xde, 0x8e, 0xe3, 0x59, 0xe8, 0xbc, 0xef, 0xb6, 0xf9, 0xe2, 0xfc, 0xd1, 0x05, 
-0xeb, 0x0d, 0xd0, 0x0d, 0x72, 0x12, 0xf2, 0x15, 0x6a, 0x14, 0x1e, 0x15, 0x87, 0x14, 0xe7, 0x0f, 
-0x3c, 0x0b, 0xb3, 0x06, 0x90, 0xff, 0x61, 0xfc, 0x2c, 0xf8, 0x71, 0xf4, 0xfc, 0xf4, 0x1a, 0xf5, 
-0xb4, 0xf6, 0x38, 0xfa, 0xf4, 0xfd, 0xd8, 0x01, 0x22, 0x05, 0xe4, 0x08, 0x7e, 0x0d, 0x9b, 0x0d, 
-0x07, 0x0f, 0xee, 0x0d, 0x29, 0x0a, 0xcc, 0x04, 0xdd, 0xfd, 0x82, 0xf8, 0xef, 0xec, 0x47, 0xe9, 
-0x38, 0xe5, 0xed, 0xe0, 0x1c, 0xe8, 0x64, 0xe9, 0xfb, 0xee, 0xc6, 0xf7, 0x0d, 0xfb, 0x62, 0x03, 
-0x34, 0x09, 0x68, 0x0c, 0x23, 0x10, 0xfb, 0x12, 0x92, 0x13, 0x65, 0x15, 0x1a, 0x15, 0x4a, 0x12, 
-0x08, 0x0f, 0x41, 0x08, 0xa9, 0x04, 0x51, 0xff, 0x91, 0xfa, 0x1e, 0xf9, 0x68, 0xf5, 0xf3, 0xf4, 
-0x39, 0xf7, 0xc0, 0xf7, 0x6b, 0xfb, 0x0d, 0xfe, 0xfd, 0x00, 0x37, 0x05, 0xc0, 0x06, 0xf3, 0x0a, 
-0xe2, 0x0a, 0xaf, 0x09, 0xed, 0x07, 0xb2, 0x01, 0xab, 0xfe, 0xb2, 0xf5, 0x8e, 0xf0, 0xf1, 0xed, 
-0x54, 0xe8, 0x06, 0xec, 0x0e, 0xed, 0x1c, 0xef, 0x21, 0xf5, 0xd2, 0xf7, 0xb7, 0xfb, 0x47, 0x02, 
-0x44, 0x06, 0x6c, 0x09, 0xf9, 0x0d, 0x0d, 0x10, 0xab, 0x11, 0xce, 0x13, 0x4b, 0x12, 0xc1, 0x0f, 
-0x20, 0x0d, 0x3b, 0x07, 0xaa, 0x04, 0xb5, 0x00, 0xb3, 0xfc, 0xf3, 0xfb, 0x89, 0xf9, 0xa5, 0xf8, 
-0x61, 0xf9, 0xd5, 0xfa, 0x9b, 0xfb, 0xe3, 0xfd, 0xc2, 0x00, 0xda, 0x01, 0xfe, 0x04, 0xf2, 0x05, 
-0x49, 0x05, 0xf4, 0x03, 0x5f, 0x00, 0x82, 0xfa, 0x35, 0xf6, 0x1f, 0xf3, 0x81, 0xee, 0x28, 0xf1, 
-0x88, 0xf1, 0x1b, 0xf2, 0xad, 0xf7, 0x7e, 0xf8, 0x34, 0xfb, 0x21, 0x01, 0xa3, 0x01, 0x6f, 0x05, 
-0xd1, 0x09, 0x0f, 0x0a, 0xbc, 0x0e, 0x07, 0x10, 0x24, 0x0f, 0x8e, 0x0f, 0xfd, 0x0b, 0x0d, 0x08, 
-0x82, 0x06, 0xe6, 0x02, 0x9d, 0x00, 0x84, 0xff, 0x6f, 0xfd, 0x78, 0xfc, 0x34, 0xfb, 0xf4, 0xfb, 
-0x7a, 0xfc, 0x9c, 0xfc, 0x44, 0xff, 0x58, 0xff, 0x01, 0x01, 0xb0, 0x01, 0xce, 0x00, 0x60, 0x00, 
-0x50, 0xfd, 0x70, 0xf9, 0xe2, 0xf6, 0xdf, 0xf4, 0xf1, 0xf0, 0x0d, 0xf4, 0x2b, 0xf4, 0x1e, 0xf4, 
-0x86, 0xfa, 0x4b, 0xfa, 0xaf, 0xfd, 0xc7, 0x02, 0x96, 0x01, 0xf0, 0x05, 0x30, 0x08, 0x01, 0x08, 
-0xd1, 0x0c, 0xbb, 0x0c, 0xc4, 0x0c, 0x35, 0x0d, 0x03, 0x0a, 0x30, 0x08, 0xf8, 0x05, 0x65, 0x03, 
-0xae, 0x01, 0x25, 0x01, 0x33, 0xff, 0xfc, 0xfe, 0x4b, 0xff, 0xaf, 0xfd, 0x54, 0xff, 0x79, 0xfe, 
-0xd8, 0xfe, 0x5e, 0x00, 0x1c, 0xff, 0x6f, 0xff, 0x6e, 0xfe, 0xff, 0xfa, 0x11, 0xf7, 0xe4, 0xf5, 
-0x55, 0xf1, 0x95, 0xf0, 0x98, 0xf3, 0x88, 0xf2, 0x0b, 0xf7, 0xe0, 0xfa, 0xdb, 0xfb, 0x3f, 0x01, 
-0x65, 0x02, 0x18, 0x04, 0x4d, 0x08, 0x68, 0x07, 0x09, 0x0b, 0xb0, 0x0c, 0x4a, 0x0b, 0x20, 0x0d, 
-0xc6, 0x0a, 0x07, 0x08, 0xf6, 0x06, 0x3a, 0x04, 0xb4, 0x02, 0x0e, 0x02, 0x97, 0x00, 0xf6, 0xff, 
-0xa5, 0xff, 0xef, 0xfd, 0xc6, 0xfe, 0x6a, 0xfe, 0x31, 0xfe, 0xb6, 0xff, 0xce, 0xff, 0x10, 0x00, 
-0xbf, 0xff, 0xf8, 0xfe, 0x59, 0xfc, 0x23, 0xf9, 0xfb, 0xf5, 0x24, 0xf4, 0x97, 0xf1, 0x71, 0xf2, 
-0x7d, 0xf4, 0x8c, 0xf4, 0x41, 0xf9, 0x64, 0xfb, 0xb6, 0xfd, 0x74, 0x02, 0x4f, 0x03, 0x71, 0x06, 
-0x48, 0x09, 0x95, 0x09, 0xbf, 0x0c, 0x20, 0x0d, 0xc8, 0x0b, 0xea, 0x0b, 0x59, 0x08, 0x21, 0x06, 
-0xd7, 0x04, 0x50, 0x01, 0x8c, 0x01, 0xf5, 0xff, 0xb0, 0xfe, 0xad, 0xff, 0x6b, 0xfe, 0x85, 0xfe, 
-0x64, 0xff, 0xa5, 0xfe, 0x63, 0xff, 0x69, 0x00, 0x52, 0xff, 0xcc, 0xff, 0x5c, 0xfe, 0x3e, 0xfa, 
-0xa1, 0xf8, 0x99, 0xf5, 0xb3, 0xf1, 0xed, 0xf3, 0x6b, 0xf3, 0x9d, 0xf3, 0xb3, 0xf9, 0x20, 0xfa, 
-0x68, 0xfd, 0xb6, 0x02, 0xd1, 0x01, 0xbe, 0x05, 0x1f, 0x08, 0x70, 0x07, 0x09, 0x0c, 0xe1, 0x0b, 
-0xef, 0x0a, 0x8a, 0x0c, 0x7a, 0x08, 0x55, 0x07, 0xcd, 0x05, 0xc0, 0x01, 0x1f, 0x02, 0xab, 0xff, 
-0xa7, 0xfe, 0xfd, 0xfe, 0x27, 0xfd, 0xa3, 0xfd, 0x37, 0xfd, 0xf1, 0xfc, 0xb3, 0xfd, 0x0d, 0xfe, 
-0x5a, 0xfe, 0xdf, 0xfe, 0x0f, 0xff, 0xe0, 0xfd, 0x02, 0xfd, 0x26, 0xfb, 0xf4, 0xf8, 0xb5, 0xf8, 
-0x8a, 0xf7, 0xdf, 0xf7, 0xe2, 0xf9, 0x08, 0xfa, 0xce, 0xfb, 0x8d, 0xfe, 0x6d, 0xff, 0x90, 0x01, 
-0x7d, 0x04, 0xec, 0x04, 0xe4, 0x06, 0xaf, 0x08, 0x48, 0x08, 0x4a, 0x09, 0xa8, 0x08, 0x0a, 0x07, 
-0x3d, 0x06, 0xc1, 0x04, 0x6c, 0x03, 0xd0, 0x02, 0x51, 0x02, 0xa4, 0x01, 0x81, 0x01, 0xfd, 0x00, 
-0x9c, 0x00, 0xe7, 0xff, 0xd4, 0xfe, 0xb4, 0xfd, 0xbe, 0xfb, 0x65, 0xfa, 0xbe, 0xf7, 0xd8, 0xf5, 
-0xe0, 0xf4, 0xe2, 0xf2, 0x93, 0xf3, 0x92, 0xf4, 0xd5, 0xf5, 0xf0, 0xf8, 0x05, 0xfc, 0xa2, 0xff, 
-0xd7, 0x02, 0x1e, 0x06, 0xde, 0x08, 0x06, 0x0a, 0xc1, 0x0b, 0x86, 0x0c, 0x04, 0x0c, 0xf5, 0x0b, 
-0x92, 0x0a, 0x64, 0x08, 0x80, 0x06, 0xf2, 0x03, 0x55, 0x01, 0x3b, 0xff, 0x00, 0xfd, 0x68, 0xfb, 
-0x97, 0xfa, 0x08, 0xfa, 0x70, 0xfa, 0x37, 0xfb, 0xda, 0xfb, 0xec, 0xfc, 0x19, 0xfe, 0x9c, 0xfe, 
-0xcc, 0xff, 0xcc, 0x00, 0x74, 0x00, 0x2f, 0x01, 0xb1, 0x00, 0x99, 0xff, 0x61, 0xff, 0xa7, 0xfd, 
-0xac, 0xfc, 0x9d, 0xfb, 0x44, 0xfa, 0x81, 0xfa, 0x1e, 0xfa, 0xba, 0xfa, 0x46, 0xfc, 0xc0, 0xfc, 
-0xa3, 0xfe, 0x71, 0x00, 0x67, 0x01, 0x59, 0x03, 0x79, 0x04, 0x4f, 0x05, 0x81, 0x06, 0xf4, 0x06, 
-0x54, 0x07, 0x5a, 0x07, 0xc2, 0x06, 0x35, 0x06, 0xb7, 0x05, 0xea, 0x04, 0x10, 0x04, 0x26, 0x03, 
-0xfc, 0x01, 0x74, 0x00, 0x6c, 0xfe, 0x75, 0xfc, 0xae, 0xf9, 0x84, 0xf6, 0x43, 0xf4, 0xd2, 0xf1, 
-0xc9, 0xf0, 0x3a, 0xf1, 0x9f, 0xf1, 0xc4, 0xf3, 0xb2, 0xf6, 0xa5, 0xf9, 0x50, 0xfd, 0xfb, 0x00, 
-0x85, 0x04, 0x98, 0x07, 0x6a, 0x0a, 0xba, 0x0c, 0x20, 0x0e, 0xeb, 0x0e, 0xd4, 0x0e, 0x9c, 0x0d, 
-0x06, 0x0c, 0xf4, 0x09, 0x26, 0x07, 0xe0, 0x04, 0xa2, 0x02, 0x2e, 0x00, 0xa0, 0xfe, 0x2e, 0xfd, 
-0xc9, 0xfb, 0x49, 0xfb, 0xc2, 0xfa, 0xac, 0xfa, 0x24, 0xfb, 0x56, 0xfb, 0x35, 0xfc, 0xfd, 0xfc, 
-0xbb, 0xfd, 0xb0, 0xfe, 0x26, 0xff, 0xcb, 0xff, 0x15, 0x00, 0xfc, 0xff, 0xe2, 0xff, 0x47, 0xff, 
-0xb6, 0xfe, 0xf2, 0xfd, 0x1f, 0xfd, 0x93, 0xfc, 0xef, 0xfb, 0xe4, 0xfb, 0x15, 0xfc, 0x4b, 0xfc, 
-0x39, 0xfd, 0x06, 0xfe, 0x2b, 0xff, 0x6a, 0x00, 0x6a, 0x01, 0xe4, 0x02, 0xd5, 0x03, 0xe3, 0x04, 
-0xec, 0x05, 0x79, 0x06, 0x23, 0x07, 0x26, 0x07, 0x13, 0x07, 0xb4, 0x06, 0xe7, 0x05, 0xda, 0x04, 
-0xeb, 0x02, 0xdc, 0x00, 0x83, 0xfe, 0xb2, 0xfb, 0x1f, 0xf9, 0x5f, 0xf6, 0xc7, 0xf3, 0xd1, 0xf1, 
-0xac, 0xf0, 0x82, 0xf0, 0x38, 0xf1, 0x08, 0xf3, 0x91, 0xf5, 0xb1, 0xf8, 0x60, 0xfc, 0x52, 0x00, 
-0x44, 0x04, 0xc4, 0x07, 0xb2, 0x0a, 0x1a, 0x0d, 0xb5, 0x0e, 0x8d, 0x0f, 0x70, 0x0f, 0x76, 0x0e, 
-0xe8, 0x0c, 0xa8, 0x0a, 0x2e, 0x08, 0x99, 0x05, 0x11, 0x03, 0xbd, 0x00, 0x84, 0xfe, 0xbd, 0xfc, 
-0x68, 0xfb, 0x6f, 0xfa, 0x0a, 0xfa, 0x15, 0xfa, 0x62, 0xfa, 0x2c, 0xfb, 0x27, 0xfc, 0x30, 0xfd, 
-0x51, 0xfe, 0x58, 0xff, 0x1a, 0x00, 0x9c, 0x00, 0xc7, 0x00, 0x7b, 0x00, 0xec, 0xff, 0x12, 0xff, 
-0xdd, 0xfd, 0xc7, 0xfc, 0xba, 0xfb, 0xbc, 0xfa, 0x41, 0xfa, 0x10, 0xfa, 0x40, 0xfa, 0xf8, 0xfa, 
-0xef, 0xfb, 0x40, 0xfd, 0xbc, 0xfe, 0x55, 0x00, 0x07, 0x02, 0x79, 0x03, 0xe4, 0x04, 0xee, 0x05, 
-0x8a, 0x06, 0x06, 0x07, 0x02, 0x07, 0xa2, 0x06, 0x2f, 0x06, 0x94, 0x05, 0xc6, 0x04, 0x09, 0x04, 
-0x4d, 0x03, 0x81, 0x02, 0xae, 0x01, 0xce, 0x00, 0xe1, 0xff, 0xd6, 0xfe, 0xc3, 0xfd, 0xa0, 0xfc, 
-0x82, 0xfb, 0x72, 0xfa, 0x70, 0xf9, 0x8e, 0xf8, 0xcc, 0xf7, 0x40, 0xf7, 0x0c, 0xf7, 0x2e, 0xf7, 
-0xe6, 0xf7, 0x12, 0xf9, 0x9e, 0xfa, 0xbd, 0xfc, 0x01, 0xff, 0x64, 0x01, 0xc2, 0x03, 0xd0, 0x05, 
-0xb0, 0x07, 0x02, 0x09, 0xdb, 0x09, 0x70, 0x0a, 0x5f, 0x0a, 0xb5, 0x09, 0xa3, 0x08, 0x20, 0x07, 
-0x5d, 0x05, 0x76, 0x03, 0x88, 0x01, 0xd4, 0xff, 0x46, 0xfe, 0x21, 0xfd, 0x67, 0xfc, 0xe9, 0xfb, 
-0xe6, 0xfb, 0xf2, 0xfb, 0x1e, 0xfc, 0x95, 0xfc, 0x16, 0xfd, 0x7f, 0xfd, 0xe6, 0xfd, 0x5d, 0xfe, 
-0x95, 0xfe, 0xc6, 0xfe, 0xf0, 0xfe, 0xe3, 0xfe, 0xcc, 0xfe, 0x91, 0xfe, 0x56, 0xfe, 0x3f, 0xfe, 
-0x4b, 0xfe, 0x81, 0xfe, 0xdc, 0xfe, 0x6b, 0xff, 0x11, 0x00, 0xb1, 0x00, 0x5f, 0x01, 0x18, 0x02, 
-0xb6, 0x02, 0x3e, 0x03, 0x9d, 0x03, 0xd8, 0x03, 0xf4, 0x03, 0xbf, 0x03, 0x52, 0x03, 0xb6, 0x02, 
-0xd9, 0x01, 0xc8, 0x00, 0xb0, 0xff, 0x90, 0xfe, 0x67, 0xfd, 0x6a, 0xfc, 0x98, 0xfb, 0x12, 0xfb, 
-0xd0, 0xfa, 0xc7, 0xfa, 0xfa, 0xfa, 0x59, 0xfb, 0xfb, 0xfb, 0xb4, 0xfc, 0x85, 0xfd, 0x76, 0xfe, 
-0x56, 0xff, 0x3c, 0x00, 0x0c, 0x01, 0xcd, 0x01, 0x71, 0x02, 0xd0, 0x02, 0x1c, 0x03, 0x4c, 0x03, 
-0x5d, 0x03, 0x62, 0x03, 0x5d, 0x03, 0x44, 0x03, 0x1c, 0x03, 0xe7, 0x02, 0xae, 0x02, 0x7c, 0x02, 
-0x3b, 0x02, 0xe8, 0x01, 0x86, 0x01, 0x2b, 0x01, 0xc3, 0x00, 0x48, 0x00, 0xdc, 0xff, 0x58, 0xff, 
-0xe9, 0xfe, 0x6a, 0xfe, 0xd9, 0xfd, 0x9e, 0xfd, 0x77, 0xfd, 0x61, 0xfd, 0x70, 0xfd, 0x89, 0xfd, 
-0xcc, 0xfd, 0x1f, 0xfe, 0x79, 0xfe, 0xe8, 0xfe, 0x48, 0xff, 0x99, 0xff, 0xf1, 0xff, 0x47, 0x00, 
-0x92, 0x00, 0xc2, 0x00, 0xdb, 0x00, 0xeb, 0x00, 0xe8, 0x00, 0xda, 0x00, 0xc9, 0x00, 0xbd, 0x00, 
-0xac, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0xa5, 0x00, 0xab, 0x00, 0xaf, 0x00, 0xb4, 0x00, 0xb3, 0x00, 
-0xb3, 0x00, 0xb2, 0x00, 0xa0, 0x00, 0x96, 0x00, 0x7f, 0x00, 0x5b, 0x00, 0x35, 0x00, 0x03, 0x00, 
-0xca, 0xff, 0x96, 0xff, 0x69, 0xff, 0x3d, 0xff, 0x20, 0xff, 0xfd, 0xfe, 0xed, 0xfe, 0xdf, 0xfe, 
-0xd0, 0xfe, 0xd5, 0xfe, 0xd5, 0xfe, 0xe9, 0xfe, 0x0b, 0xff, 0x30, 0xff, 0x5a, 0xff, 0x87, 0xff, 
-0xc0, 0xff, 0x0e, 0x00, 0x5e, 0x00, 0x99, 0x00, 0xcb, 0x00, 0xfa, 0x00, 0x13, 0x01, 0x28, 0x01, 
-0x26, 0x01, 0x0c, 0x01, 0xf1, 0x00, 0xc8, 0x00, 0x99, 0x00, 0x67, 0x00, 0x30, 0x00, 0xf5, 0xff, 
-0xb7, 0xff, 0x7d, 0xff, 0x4e, 0xff, 0x2a, 0xff, 0x17, 0xff, 0x08, 0xff, 0x08, 0xff, 0x17, 0xff, 
-0x2e, 0xff, 0x65, 0xff, 0x98, 0xff, 0xcb, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x5a, 0x00, 0x7a, 0x00, 
-0x96, 0x00, 0xad, 0x00, 0xb7, 0x00, 0xc3, 0x00, 0xbe, 0x00, 0xa7, 0x00, 0x8d, 0x00, 0x67, 0x00, 
-0x3a, 0x00, 0x0e, 0x00, 0xe0, 0xff, 0xca, 0xff, 0xc0, 0xff, 0xac, 0xff, 0xac, 0xff, 0xa3, 0xff, 
-0x9f, 0xff, 0xa7, 0xff, 0xa4, 0xff, 0xaf, 0xff, 0xba, 0xff, 0xc7, 0xff, 0xd6, 0xff, 0xe4, 0xff, 
-0xe8, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xe3, 0xff, 0xe2, 0xff, 0xeb, 0xff, 0xf3, 0xff, 0x00, 0x00, 
-0x11, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x41, 0x00, 0x43, 0x00, 0x42, 0x00, 
-0x3b, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x30, 0x00, 
-0x2b, 0x00, 0x27, 0x00, 0x23, 0x00, 0x21, 0x00, 0x1b, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1d, 0x00, 
-0x1e, 0x00, 0x18, 0x00, 0x12, 0x00, 0x01, 0x00, 0xed, 0xff, 0xdb, 0xff, 0xc9, 0xff, 0xba, 0xff, 
-0xad, 0xff, 0xa9, 0xff, 0xa5, 0xff, 0xaa, 0xff, 0xb7, 0xff, 0xc5, 0xff, 0xdd, 0xff, 0xf6, 0xff, 
-0x0b, 0x00, 0x22, 0x00, 0x32, 0x00, 0x44, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x51, 0x00, 0x45, 0x00, 
-0x42, 0x00, 0x3e, 0x00, 0x2f, 0x00, 0x2c, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x0f, 0x00, 
-0x13, 0x00, 0x0f, 0x00, 0x14, 0x00, 0x05, 0x00, 0x04, 0x00, 0xf7, 0xff, 0xf6, 0xff, 0xee, 0xff, 
-0xd8, 0xff, 0xdd, 0xff, 0xc9, 0xff, 0xbb, 0xff, 0xb4, 0xff, 0xb3, 0xff, 0xb6, 0xff, 0xbe, 0xff, 
-0xc4, 0xff, 0xba, 0xff, 0xcb, 0xff, 0xe4, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x32, 0x00, 
-0x3b, 0x00, 0x38, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x6e, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x6d, 0x00, 
-0x46, 0x00, 0x47, 0x00, 0x25, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x15, 0x00, 0xf6, 0xff, 0xe4, 0xff, 
-0xda, 0xff, 0xe3, 0xff, 0xea, 0xff, 0xc5, 0xff, 0x9c, 0xff, 0xc7, 0xff, 0xe0, 0xff, 0xcf, 0xff, 
-0xc5, 0xff, 0x83, 0xff, 0xbe, 0xff, 0xfa, 0xff, 0xd0, 0xff, 0xe6, 0xff, 0xcf, 0xff, 0x13, 0x00, 
-0x05, 0x00, 0xb8, 0xff, 0xf9, 0xff, 0x06, 0x00, 0x06, 0x00, 0xec, 0xff, 0xf2, 0xff, 0x00, 0x00, 
-0xe0, 0xff, 0x06, 0x00, 0xf5, 0xff, 0xdb, 0xff, 0x02, 0x00, 0x37, 0x00, 0x14, 0x00, 0xe5, 0xff, 
-0x3c, 0x00, 0xda, 0xff, 0xee, 0xff, 0x2b, 0x00, 0xff, 0xff, 0x0e, 0x00, 0xe7, 0xff, 0xe6, 0xff, 
-0x22, 0x00, 0xec, 0xff, 0xf9, 0xff, 0x23, 0x00, 0x08, 0x00, 0xe5, 0xff, 0xb5, 0xff, 0xc3, 0xff, 
-0x9e, 0xff, 0xcd, 0xff, 0xc4, 0xff, 0xb7, 0xff, 0xd9, 0xff, 0xc0, 0xff, 0xe2, 0xff, 0xce, 0xff, 
-0xe8, 0xff, 0xee, 0xff, 0xe0, 0xff, 0xf3, 0xff, 0xe1, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0x0e, 0x00, 
-0x07, 0x00, 0x0a, 0x00, 0xbe, 0x00, 0xde, 0x00, 0x23, 0x04, 0xfc, 0x02, 0xe3, 0xfe, 0xae, 0xff, 
-0x3d, 0xff, 0x82, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xe5, 0xfe, 0x9a, 0xff, 0xd7, 0xff, 0xf2, 0xfe, 
-0x71, 0xff, 0xcc, 0xff, 0x38, 0xff, 0x81, 0xfe, 0x2f, 0x00, 0x84, 0xff, 0x61, 0xff, 0x7f, 0x00, 
-0xc6, 0xff, 0xd8, 0xff, 0xbd, 0xff, 0x22, 0x00, 0x02, 0x00, 0xc5, 0xff, 0xfe, 0xff, 0xec, 0xff, 
-0x99, 0xff, 0xc8, 0xff, 0xe4, 0xff, 0x46, 0xff, 0x90, 0xff, 0x7f, 0xff, 0x66, 0xff, 0x77, 0xff, 
-0x5c, 0xff, 0x92, 0xff, 0x70, 0xff, 0x93, 0xff, 0xeb, 0xff, 0xd3, 0xff, 0xf3, 0xff, 0xf8, 0xff, 
-0x4c, 0x00, 0xbb, 0xff, 0x42, 0x00, 0x41, 0x00, 0xc1, 0xff, 0x85, 0x00, 0xaa, 0x00, 0x07, 0x00, 
-0xf0, 0xff, 0x90, 0x00, 0x08, 0x00, 0xc5, 0xff, 0xa3, 0x00, 0xa7, 0xff, 0xdb, 0xff, 0x6b, 0x00, 
-0x3c, 0xff, 0x6c, 0x00, 0xba, 0xff, 0x2e, 0x00, 0xba, 0xff, 0xc3, 0xff, 0x1a, 0x01, 0x6d, 0xff, 
-0xd3, 0x00, 0x50, 0x00, 0x3c, 0x00, 0x70, 0x00, 0xe0, 0xff, 0x33, 0x00, 0xf1, 0xff, 0x87, 0x00, 
-0x2c, 0x00, 0x1e, 0x00, 0x49, 0x00, 0x4c, 0x00, 0xe5, 0xff, 0x67, 0x00, 0x16, 0x00, 0xcd, 0xff, 
-0x30, 0x00, 0xbe, 0xff, 0x20, 0x00, 0x83, 0xff, 0x4d, 0x00, 0x04, 0x00, 0xe3, 0x00, 0x74, 0x00, 
-0xe5, 0x02, 0x51, 0x03, 0x74, 0x01, 0x7a, 0x01, 0xed, 0xff, 0x12, 0x00, 0x9c, 0xff, 0xe4, 0xff, 
-0x9b, 0xfe, 0x6f, 0xfe, 0x86, 0xff, 0x9f, 0xfe, 0x65, 0xfe, 0xb0, 0xff, 0xa5, 0xff, 0x89, 0xff, 
-0x66, 0xff, 0xdf, 0xff, 0xba, 0x00, 0x00, 0x00, 0x80, 0x00, 0x69, 0x01, 0xfa, 0xfe, 0xb7, 0x00, 
-0x6f, 0x00, 0x15, 0xff, 0x23, 0x01, 0x69, 0xfe, 0x77, 0xff, 0x8c, 0x00, 0x60, 0xff, 0x95, 0xff, 
-0xc9, 0xff, 0x19, 0x01, 0xc3, 0xfc, 0x3d, 0x01, 0xaf, 0x00, 0x6a, 0xfb, 0xa0, 0x02, 0x27, 0xff, 
-0xf3, 0xfd, 0xd8, 0xff, 0x76, 0x01, 0x6e, 0xff, 0x01, 0xfe, 0x4a, 0x03, 0xd9, 0xfd, 0x4d, 0xfe, 
-0xf2, 0x03, 0x50, 0xfe, 0x42, 0xff, 0x42, 0x02, 0xda, 0xfe, 0x5a, 0xff, 0xef, 0x02, 0x47, 0x00, 
-0x95, 0xfc, 0x63, 0x03, 0x40, 0x01, 0x2b, 0xfd, 0x30, 0x02, 0xd8, 0x00, 0x2d, 0xfe, 0xb4, 0x01, 
-0x80, 0x00, 0xdd, 0xfe, 0xb4, 0x01, 0xc8, 0x00, 0x08, 0xff, 0x82, 0x00, 0x64, 0x01, 0xd6, 0xfd, 
-0x57, 0x00, 0xea, 0x02, 0x50, 0xfe, 0xca, 0x00, 0xac, 0x01, 0xdf, 0xff, 0x97, 0xff, 0xdb, 0x00, 
-0x3d, 0xff, 0xb5, 0xff, 0x31, 0x01, 0xb6, 0xfe, 0xd0, 0xff, 0x7b, 0x01, 0xce, 0xfe, 0x85, 0x00, 
-0x98, 0x01, 0x3a, 0x00, 0xac, 0xff, 0x25, 0xff, 0xe9, 0xff, 0xda, 0xff, 0x8e, 0xff, 0xb3, 0xfd, 
-0xa0, 0x01, 0xc5, 0xfe, 0xd8, 0xfe, 0x6b, 0x02, 0x5b, 0xff, 0x22, 0xff, 0xef, 0x02, 0x8f, 0xff, 
-0xda, 0xfd, 0x65, 0x02, 0x9a, 0xfe, 0xd9, 0xfd, 0xff, 0x03, 0xda, 0xff, 0xa2, 0xfb, 0xcc, 0x02, 
-0x32, 0x02, 0x15, 0xfb, 0xe4, 0x01, 0x89, 0x02, 0x1e, 0xfc, 0xaf, 0x00, 0x08, 0x02, 0x54, 0xfd, 
-0xc3, 0x00, 0xbc, 0x02, 0xa8, 0xfd, 0xb9, 0xfe, 0xdb, 0x04, 0xb4, 0xfd, 0x97, 0xfe, 0xcb, 0x03, 
-0x4e, 0xfc, 0xa4, 0x00, 0x92, 0x02, 0x2c, 0xfc, 0xdf, 0xff, 0xc9, 0x05, 0xf7, 0xfa, 0xb2, 0xfe, 
-0x84, 0x06, 0x98, 0xfb, 0x60, 0xfc, 0xc7, 0x05, 0x25, 0xfd, 0x2d, 0xfd, 0x84, 0x06, 0x4a, 0xfd, 
-0xe1, 0xfc, 0xdf, 0x04, 0xb1, 0xfb, 0x1e, 0xff, 0x29, 0x04, 0xfe, 0xfb, 0x66, 0x00, 0x6c, 0x02, 
-0xbc, 0xfe, 0xc7, 0xfd, 0x4f, 0x03, 0xd4, 0xff, 0x87, 0xfc, 0x93, 0x04, 0xd6, 0xfc, 0x7a, 0x00, 
-0xd2, 0x02, 0x48, 0xfc, 0x09, 0x02, 0x1b, 0xff, 0x97, 0x00, 0x0f, 0x01, 0xef, 0xfe, 0x60, 0x03, 
-0x53, 0xfd, 0xa6, 0xfe, 0xcd, 0x02, 0xbd, 0xfd, 0x6c, 0x01, 0xe8, 0xfe, 0x50, 0x02, 0x52, 0xff, 
-0x9a, 0xfe, 0xe8, 0x04, 0xa0, 0xfb, 0xbd, 0x01, 0xbb, 0x00, 0x17, 0xfc, 0xf3, 0x02, 0x80, 0xfb, 
-0xa7, 0x02, 0xc0, 0xff, 0x66, 0xfc, 0x78, 0x05, 0x40, 0xfa, 0x1c, 0x01, 0x1f, 0x01, 0x82, 0xff, 
-0x68, 0x00, 0x5c, 0xfc, 0xf5, 0x03, 0x46, 0xfb, 0xce, 0x03, 0x77, 0x01, 0x6d, 0xfa, 0x27, 0x07, 
-0xbc, 0xfc, 0x0d, 0xff, 0xa0, 0x01, 0x46, 0xff, 0x18, 0x01, 0x17, 0xfe, 0x2b, 0x03, 0x6b, 0xff, 
-0x4b, 0xff, 0x8b, 0x01, 0xdb, 0xfe, 0xb2, 0x01, 0x00, 0xff, 0x76, 0xfe, 0x5a, 0xff, 0xb4, 0xff, 
-0x94, 0x00, 0xfa, 0xfe, 0x13, 0x02, 0xb7, 0x00, 0x1d, 0xfe, 0x91, 0x03, 0x1a, 0xfe, 0xdb, 0xfe, 
-0xb7, 0x03, 0x91, 0xfd, 0x6c, 0x00, 0x27, 0x03, 0x2b, 0x00, 0x91, 0xfd, 0x22, 0x04, 0x1a, 0xff, 
-0xf5, 0xfd, 0xb6, 0x04, 0x08, 0xfc, 0x28, 0x00, 0x2f, 0x01, 0x84, 0xfd, 0x17, 0xff, 0x76, 0xff, 
-0xfa, 0xfe, 0xe5, 0xfe, 0x4f, 0x00, 0x18, 0xfe, 0xc2, 0x01, 0xa4, 0xff, 0x9c, 0xfe, 0xec, 0x03, 
-0xc5, 0xfe, 0x2d, 0xff, 0xab, 0x03, 0xbf, 0xfe, 0x14, 0xff, 0x30, 0x03, 0x62, 0xfd, 0x39, 0xfe, 
-0x4a, 0x02, 0xc8, 0xfc, 0xe8, 0xfe, 0xf9, 0x02, 0xf9, 0xfd, 0x4d, 0xfe, 0xb0, 0x02, 0x09, 0xff, 
-0x1d, 0xfe, 0xce, 0x01, 0x34, 0x00, 0x72, 0xfe, 0xd7, 0x00, 0xec, 0xff, 0x03, 0xfe, 0x53, 0x01, 
-0x34, 0x00, 0x6d, 0xff, 0xeb, 0x00, 0x6d, 0x00, 0x66, 0xff, 0xb3, 0x01, 0xae, 0x00, 0x4f, 0xfe, 
-0xd3, 0x01, 0xb9, 0xff, 0xaf, 0xfd, 0xbf, 0xff, 0xe1, 0x00, 0x0c, 0xfd, 0xfd, 0x01, 0xf3, 0xff, 
-0x75, 0xfe, 0xee, 0x04, 0x44, 0xfe, 0xf3, 0x00, 0x8f, 0x00, 0xee, 0xff, 0xdd, 0xff, 0xfe, 0xfe, 
-0x4c, 0x01, 0x63, 0xfc, 0x44, 0x03, 0xbd, 0x00, 0xcf, 0xfd, 0xea, 0x03, 0xa9, 0xfe, 0x81, 0x01, 
-0xab, 0x00, 0x1c, 0xff, 0x83, 0x01, 0xec, 0xfd, 0xf4, 0x00, 0x7b, 0xff, 0x3c, 0x00, 0x4d, 0x00, 
-0xca, 0xfd, 0x14, 0x01, 0xf6, 0xfe, 0xb3, 0xff, 0x55, 0xff, 0xe5, 0xfe, 0x63, 0x01, 0x7c, 0xff, 
-0x37, 0x00, 0x3b, 0x01, 0x2e, 0x01, 0xd5, 0x00, 0x4a, 0xff, 0x34, 0x01, 0xbe, 0x00, 0xe1, 0xfe, 
-0x8b, 0x00, 0x53, 0x01, 0x3b, 0xfe, 0xa0, 0x00, 0xb4, 0x00, 0x73, 0xff, 0xfd, 0x00, 0x42, 0xff, 
-0x41, 0x00, 0xee, 0xfe, 0x20, 0x01, 0x76, 0xfe, 0xdd, 0xfe, 0xa8, 0x02, 0x12, 0xff, 0x2e, 0xff, 
-0x68, 0x00, 0x5a, 0x01, 0x40, 0xfe, 0x6d, 0x00, 0x03, 0x02, 0x82, 0xfe, 0xd1, 0x00, 0x14, 0x03, 
-0xbd, 0xfd, 0x73, 0xfe, 0xaa, 0x01, 0x4c, 0xfd, 0x9f, 0xfe, 0x51, 0x00, 0x31, 0x00, 0x33, 0xfe, 
-0x2d, 0x00, 0x38, 0x01, 0x14, 0xff, 0xae, 0x00, 0xe4, 0xff, 0x45, 0x01, 0x00, 0xff, 0xea, 0x00, 
-0x30, 0x01, 0x7e, 0xfe, 0x50, 0x02, 0xcb, 0xfe, 0x20, 0xff, 0x7d, 0x00, 0xc0, 0xff, 0xa5, 0xfe, 
-0x1b, 0xff, 0x57, 0x01, 0x68, 0xfc, 0x0e, 0x02, 0x55, 0x00, 0x93, 0xff, 0x71, 0x03, 0x60, 0xfe, 
-0x69, 0x02, 0x20, 0x00, 0x38, 0xff, 0x62, 0x00, 0xc9, 0xff, 0x49, 0x00, 0x49, 0xff, 0x91, 0x01, 
-0x47, 0xff, 0xc8, 0x00, 0x0a, 0x01, 0x72, 0xfe, 0x51, 0x03, 0xcb, 0xfe, 0xbc, 0xfd, 0x0c, 0x02, 
-0x39, 0xfe, 0x1a, 0xff, 0x82, 0x00, 0x4d, 0xfe, 0x87, 0xff, 0xd8, 0x00, 0xc9, 0xfe, 0x99, 0xff, 
-0x4f, 0x00, 0x17, 0xff, 0xc1, 0xff, 0x99, 0xff, 0x3c, 0xff, 0xd2, 0xff, 0x89, 0x01, 0x60, 0x00, 
-0xe1, 0x01, 0xd4, 0x00, 0x73, 0x00, 0x49, 0x03, 0xd8, 0xfe, 0x59, 0x00, 0x94, 0x01, 0xea, 0xfe, 
-0xf9, 0x00, 0x38, 0x01, 0xc8, 0x01, 0x1e, 0x00, 0x90, 0xfe, 0x8f, 0x00, 0x51, 0xfd, 0x45, 0xfe, 
-0xb3, 0xfd, 0xcd, 0xfd, 0xb8, 0xfe, 0x32, 0xfd, 0x81, 0x01, 0x1e, 0xff, 0x9d, 0x00, 0x41, 0x03, 
-0x96, 0xfe, 0xbb, 0x01, 0xb9, 0x01, 0xaf, 0xff, 0x25, 0x01, 0x79, 0x00, 0xd2, 0xff, 0x5f, 0xff, 
-0x92, 0xff, 0x31, 0xff, 0x8d, 0xfe, 0x3f, 0xff, 0x48, 0xff, 0xb0, 0xfd, 0xf3, 0xff, 0x0c, 0x00, 
-0x08, 0xfe, 0xdf, 0x01, 0xbb, 0x00, 0xf1, 0xff, 0x3f, 0x03, 0x26, 0x02, 0xc7, 0x01, 0xc3, 0x02, 
-0x39, 0x02, 0x63, 0x02, 0x22, 0x02, 0x6a, 0x01, 0x34, 0x02, 0x34, 0x00, 0x71, 0x00, 0x65, 0x00, 
-0xf4, 0xfe, 0xc3, 0xff, 0xca, 0xff, 0x22, 0xff, 0xfc, 0xfd, 0xc7, 0xfe, 0xa5, 0xfd, 0xda, 0xfc, 
-0x22, 0xfd, 0xb7, 0xfb, 0xa0, 0xfc, 0xa5, 0xfb, 0x21, 0xfc, 0x03, 0xfd, 0xfa, 0xfb, 0x2b, 0xfe, 
-0x2f, 0xfc, 0x0d, 0xff, 0xd7, 0xff, 0x2b, 0xfd, 0x89, 0x03, 0xd7, 0xff, 0x18, 0x02, 0x40, 0x05, 
-0x97, 0x01, 0xb2, 0x07, 0x45, 0x04, 0xea, 0x06, 0x9b, 0x08, 0xcc, 0x03, 0x6f, 0x09, 0x1c, 0x05, 
-0x06, 0x04, 0x0d, 0x07, 0x96, 0x01, 0xf1, 0x02, 0xb7, 0x03, 0x18, 0xff, 0x20, 0x00, 0x87, 0xff, 
-0x39, 0xfc, 0x25, 0xfc, 0xb7, 0xfa, 0xa9, 0xf9, 0xf4, 0xf7, 0x14, 0xf7, 0x82, 0xf7, 0x4b, 0xf4, 
-0x12, 0xf6, 0x2e, 0xf6, 0x36, 0xf5, 0x9e, 0xf7, 0x90, 0xf7, 0x73, 0xf9, 0xc5, 0xfa, 0xea, 0xfd, 
-0x75, 0xff, 0xd0, 0x01, 0xd9, 0x05, 0x8a, 0x06, 0x00, 0x0a, 0xcc, 0x0b, 0xaa, 0x0d, 0x35, 0x0e, 
-0x1f, 0x0f, 0x08, 0x0f, 0xb2, 0x0c, 0x4f, 0x0d, 0xbd, 0x09, 0x8a, 0x08, 0xeb, 0x06, 0x1d, 0x04, 
-0xd6, 0x02, 0x41, 0x00, 0x8c, 0xfe, 0x09, 0xfc, 0x38, 0xfb, 0x17, 0xf8, 0x87, 0xf6, 0x1b, 0xf7, 
-0xd4, 0xf2, 0x9d, 0xf4, 0x7f, 0xf3, 0x4a, 0xf1, 0x3b, 0xf4, 0xc3, 0xf1, 0xac, 0xf3, 0x7c, 0xf4, 
-0x3c, 0xf3, 0x12, 0xf8, 0x2f, 0xf8, 0xbf, 0xfa, 0xd9, 0x00, 0xe0, 0x00, 0x9b, 0x05, 0xed, 0x09, 
-0x33, 0x09, 0x2f, 0x0d, 0xae, 0x0d, 0x31, 0x0d, 0x47, 0x0e, 0x54, 0x0c, 0xeb, 0x0c, 0x68, 0x0b, 
-0xab, 0x09, 0x01, 0x0a, 0x40, 0x08, 0x8c, 0x06, 0x86, 0x06, 0xc0, 0x04, 0xce, 0x02, 0x83, 0x02, 
-0xf9, 0x00, 0x41, 0xff, 0xba, 0xfe, 0xf4, 0xfc, 0x8a, 0xfa, 0x39, 0xfa, 0x93, 0xf7, 0x9d, 0xf5, 
-0x88, 0xf5, 0x88, 0xf1, 0x64, 0xf1, 0x55, 0xef, 0x01, 0xed, 0xf7, 0xed, 0xf4, 0xec, 0x2b, 0xf0, 
-0x1a, 0xf2, 0x2b, 0xf6, 0xac, 0xfc, 0x16, 0xff, 0x22, 0x06, 0xba, 0x09, 0xdb, 0x0c, 0x29, 0x10, 
-0x74, 0x10, 0x0b, 0x13, 0x7e, 0x10, 0x2d, 0x11, 0xcc, 0x0f, 0xbe, 0x0c, 0xda, 0x0c, 0xb3, 0x09, 
-0x73, 0x07, 0x88, 0x06, 0x7e, 0x03, 0x7c, 0x02, 0x98, 0x01, 0x22, 0xff, 0x7c, 0x00, 0xcb, 0xfe, 
-0x7c, 0xfe, 0x3b, 0xff, 0x42, 0xfc, 0xbd, 0xfd, 0x00, 0xfb, 0xa2, 0xf8, 0xd5, 0xf8, 0x82, 0xf3, 
-0xaa, 0xf2, 0x30, 0xef, 0x08, 0xeb, 0xaa, 0xec, 0x1e, 0xe9, 0x7d, 0xec, 0x21, 0xf0, 0x7c, 0xf1, 
-0x9c, 0xfa, 0x53, 0xfd, 0x42, 0x03, 0xfd, 0x09, 0x6e, 0x0b, 0xf8, 0x10, 0x24, 0x12, 0xfd, 0x12, 
-0x78, 0x14, 0x72, 0x12, 0x56, 0x12, 0xb9, 0x10, 0xde, 0x0d, 0xa3, 0x0b, 0x21, 0x09, 0x20, 0x05, 
-0x36, 0x03, 0xa4, 0x01, 0x89, 0xfe, 0xdd, 0xfe, 0x0d, 0xfe, 0x2d, 0xfd, 0xf4, 0xfd, 0xc1, 0xfe, 
-0x81, 0xfc, 0xd9, 0xfd, 0xf3, 0xfc, 0x7b, 0xf8, 0xde, 0xfa, 0x6c, 0xf5, 0x11, 0xf2, 0x6e, 0xf1, 
-0x39, 0xea, 0x81, 0xea, 0xe5, 0xea, 0xc7, 0xe8, 0xab, 0xef, 0x40, 0xf2, 0x03, 0xf6, 0x46, 0xff, 
-0xf3, 0x01, 0x12, 0x08, 0x94, 0x0e, 0x8d, 0x0f, 0xa2, 0x13, 0x98, 0x14, 0xfd, 0x13, 0xb9, 0x15, 
-0xbf, 0x12, 0x59, 0x12, 0x46, 0x10, 0x98, 0x0b, 0xb8, 0x09, 0x1c, 0x05, 0x1c, 0x02, 0x3c, 0x00, 
-0xa1, 0xfd, 0x00, 0xfd, 0xae, 0xfb, 0xbe, 0xfc, 0x66, 0xfc, 0xfc, 0xfc, 0xc7, 0xfd, 0xfe, 0xfb, 
-0x4b, 0xfd, 0x86, 0xfa, 0x29, 0xf9, 0x8e, 0xf8, 0xbf, 0xf2, 0x85, 0xf0, 0x24, 0xed, 0x02, 0xe9, 
-0x4a, 0xea, 0x47, 0xeb, 0x4c, 0xec, 0x4a, 0xf3, 0x23, 0xf7, 0x49, 0xfc, 0x84, 0x04, 0xd3, 0x07, 
-0x94, 0x0d, 0x0a, 0x11, 0xb6, 0x12, 0xf7, 0x13, 0xd5, 0x14, 0xf1, 0x14, 0x78, 0x13, 0x8b, 0x13, 
-0x44, 0x0f, 0xd0, 0x0c, 0xcd, 0x09, 0xcc, 0x03, 0xe9, 0x03, 0x42, 0xff, 0x0f, 0xfd, 0x73, 0xfe, 
-0x18, 0xfa, 0x52, 0xfc, 0xbb, 0xfc, 0x49, 0xfb, 0xaa, 0xfd, 0xe1, 0xfb, 0x47, 0xfc, 0x5b, 0xfb, 
-0x11, 0xf9, 0x7b, 0xf8, 0x8e, 0xf2, 0xcb, 0xef, 0xd1, 0xec, 0x2e, 0xe8, 0xbe, 0xea, 0xbb, 0xea, 
-0x7c, 0xed, 0x06, 0xf5, 0xa8, 0xf7, 0xa5, 0xfe, 0x33, 0x06, 0x17, 0x08, 0x44, 0x0f, 0x4a, 0x11, 
-0xad, 0x11, 0x94, 0x15, 0x99, 0x13, 0xfb, 0x14, 0x3b, 0x14, 0x76, 0x11, 0xd4, 0x0f, 0x4f, 0x0b, 
-0xd3, 0x07, 0x00, 0x04, 0x88, 0x01, 0xf2, 0xfe, 0xbb, 0xfc, 0xe5, 0xfc, 0xfd, 0xfa, 0xf1, 0xfb, 
-0x2d, 0xfd, 0x15, 0xfc, 0x79, 0xfe, 0x08, 0xfd, 0x04, 0xfd, 0x1c, 0xfd, 0x95, 0xf8, 0x77, 0xf9, 
-0xfa, 0xf1, 0x49, 0xee, 0x59, 0xed, 0x6e, 0xe5, 0xfb, 0xea, 0xef, 0xea, 0xf6, 0xeb, 0xf7, 0xf6, 
-0x4a, 0xf7, 0x0a, 0xff, 0xf1, 0x06, 0xe9, 0x07, 0xae, 0x0f, 0xe7, 0x10, 0x1d, 0x12, 0xc9, 0x15, 
-0x6b, 0x14, 0xe6, 0x15, 0xf2, 0x14, 0x83, 0x11, 0xe2, 0x0f, 0xb3, 0x0a, 0x29, 0x07, 0xc4, 0x03, 
-0x84, 0x00, 0x42, 0xfe, 0xc2, 0xfb, 0x52, 0xfc, 0x5d, 0xfa, 0x53, 0xfb, 0xe9, 0xfc, 0x4e, 0xfb, 
-0x87, 0xfe, 0x0c, 0xfd, 0x32, 0xfd, 0xa0, 0xfe, 0x52, 0xf8, 0x77, 0xf9, 0xd7, 0xf2, 0x03, 0xed, 
-0x4b, 0xed, 0x64, 0xe6, 0x8f, 0xea, 0x20, 0xec, 0xfd, 0xed, 0x76, 0xf7, 0x4b, 0xf9, 0xf0, 0xff, 
-0x78, 0x06, 0xea, 0x08, 0x3c, 0x0e, 0xcd, 0x0f, 0x8a, 0x12, 0x04, 0x14, 0x93, 0x14, 0x1f, 0x16, 
-0xa8, 0x13, 0x04, 0x12, 0xc9, 0x0e, 0xf2, 0x09, 0x4b, 0x07, 0x14, 0x03, 0x02, 0x01, 0x81, 0xfe, 
-0xe8, 0xfb, 0xc2, 0xfc, 0x4b, 0xfa, 0x63, 0xfb, 0xc8, 0xfc, 0x80, 0xfb, 0xef, 0xfd, 0x3a, 0xfd, 
-0x7b, 0xfd, 0x3f, 0xfd, 0x4e, 0xf9, 0x58, 0xf8, 0x93, 0xf1, 0xbc, 0xed, 0x64, 0xeb, 0xa2, 0xe7, 
-0xc8, 0xeb, 0xf5, 0xeb, 0xa5, 0xf1, 0x3b, 0xf7, 0x2b, 0xfa, 0xe0, 0x02, 0x6b, 0x05, 0xe5, 0x0a, 
-0x37, 0x0f, 0x19, 0x0f, 0xab, 0x13, 0x89, 0x13, 0x35, 0x14, 0xb0, 0x15, 0xf0, 0x11, 0xcd, 0x10, 
-0x09, 0x0d, 0x55, 0x08, 0x3b, 0x06, 0x37, 0x02, 0x78, 0xff, 0x84, 0xfd, 0x28, 0xfb, 0xa6, 0xfa, 
-0x83, 0xfa, 0x94, 0xfa, 0xdd, 0xfb, 0x0f, 0xfd, 0x39, 0xfe, 0xe8, 0xfe, 0x58, 0xff, 0xe8, 0xfe, 
-0xd5, 0xfa, 0x35, 0xf9, 0xe7, 0xf3, 0x31, 0xee, 0x96, 0xec, 0x4a, 0xe8, 0x43, 0xeb, 0x00, 0xec, 
-0xfa, 0xef, 0xe0, 0xf6, 0xb1, 0xf8, 0x85, 0x00, 0x3b, 0x05, 0x59, 0x09, 0xd1, 0x0e, 0x38, 0x10, 
-0xfe, 0x12, 0x70, 0x14, 0x4e, 0x14, 0x4d, 0x15, 0x81, 0x13, 0x4d, 0x10, 0xbd, 0x0d, 0xa9, 0x09, 
-0x96, 0x05, 0xc8, 0x03, 0xce, 0xff, 0x0e, 0xfd, 0xf2, 0xfb, 0x30, 0xf9, 0x69, 0xfa, 0x3c, 0xfa, 
-0x0f, 0xfb, 0xff, 0xfd, 0xbb, 0xfd, 0x5f, 0x00, 0xe3, 0xff, 0x7a, 0xff, 0xe1, 0xfd, 0x41, 0xf8, 
-0x64, 0xf6, 0x9b, 0xef, 0x88, 0xeb, 0x50, 0xea, 0xa1, 0xe8, 0x3b, 0xeb, 0x48, 0xee, 0x90, 0xf3, 
-0x67, 0xf8, 0x35, 0xfd, 0xee, 0x03, 0x37, 0x08, 0x5a, 0x0c, 0xaf, 0x10, 0x1a, 0x12, 0xde, 0x13, 
-0x16, 0x15, 0x0f, 0x15, 0x6d, 0x14, 0x5b, 0x12, 0x0a, 0x0f, 0x95, 0x0b, 0xb5, 0x07, 0x17, 0x04, 
-0x3a, 0x01, 0xfc, 0xfd, 0xee, 0xfb, 0x15, 0xfa, 0x08, 0xfa, 0x43, 0xfa, 0xae, 0xfa, 0xc8, 0xfd, 
-0xa5, 0xfe, 0x97, 0x00, 0x6a, 0x01, 0x49, 0x00, 0x4c, 0xff, 0xdd, 0xf9, 0x91, 0xf6, 0x25, 0xf1, 
-0x06, 0xeb, 0x93, 0xe9, 0xd4, 0xe7, 0x3e, 0xe9, 0x18, 0xed, 0x76, 0xf1, 0xaf, 0xf6, 0x2f, 0xfb, 
-0x15, 0x01, 0x57, 0x06, 0x2c, 0x0a, 0xcf, 0x0e, 0x6a, 0x11, 0xc4, 0x13, 0xfd, 0x14, 0xb5, 0x15, 
-0x17, 0x16, 0x63, 0x13, 0xc8, 0x10, 0xe5, 0x0c, 0xc4, 0x08, 0xc3, 0x04, 0xdf, 0x00, 0xe7, 0xfe, 
-0xd4, 0xfa, 0x0c, 0xfa, 0x1e, 0xfa, 0xa7, 0xf8, 0x81, 0xfb, 0x7e, 0xfc, 0x58, 0xfe, 0x79, 0x01, 
-0xfd, 0x01, 0x16, 0x02, 0x75, 0x01, 0xc5, 0xfd, 0x4d, 0xf9, 0xdd, 0xf4, 0x35, 0xef, 0xd0, 0xea, 
-0x75, 0xe8, 0x00, 0xea, 0xd8, 0xea, 0xcd, 0xee, 0xd3, 0xf5, 0xd2, 0xf7, 0x66, 0xfe, 0xbb, 0x04, 
-0x50, 0x07, 0xca, 0x0c, 0x00, 0x10, 0xbf, 0x11, 0x73, 0x13, 0x0c, 0x15, 0xdf, 0x14, 0xee, 0x12, 
-0x7a, 0x11, 0xf4, 0x0d, 0xad, 0x08, 0x1e, 0x06, 0x97, 0x02, 0xbd, 0xfd, 0xdb, 0xfb, 0x9b, 0xf9, 
-0xad, 0xf8, 0x47, 0xf8, 0x09, 0xfa, 0x67, 0xfc, 0x4c, 0xfd, 0xf8, 0x00, 0x02, 0x03, 0x26, 0x03, 
-0x93, 0x02, 0x39, 0x01, 0xc9, 0xfc, 0x98, 0xf7, 0xfd, 0xf3, 0x0e, 0xee, 0xa3, 0xe9, 0x2e, 0xe9, 
-0x5d, 0xea, 0x7a, 0xeb, 0xb3, 0xf0, 0x59, 0xf6, 0xfa, 0xf9, 0x83, 0xff, 0x7f, 0x05, 0xdf, 0x09, 
-0xc8, 0x0c, 0xc2, 0x10, 0xb9, 0x12, 0xef, 0x13, 0xbb, 0x14, 0xf9, 0x14, 0xa1, 0x13, 0x8c, 0x0f, 
-0x83, 0x0d, 0xb6, 0x09, 0x13, 0x05, 0xcd, 0x02, 0x11, 0xff, 0x05, 0xfc, 0x2e, 0xfa, 0xd0, 0xf9, 
-0xee, 0xf9, 0x85, 0xfa, 0xf7, 0xfc, 0x21, 0xfe, 0xf1, 0xff, 0x70, 0x02, 0x1b, 0x02, 0x94, 0x00, 
-0x56, 0xff, 0xda, 0xfa, 0xd4, 0xf6, 0xf7, 0xf2, 0x1e, 0xee, 0xfd, 0xea, 0x70, 0xe9, 0xc9, 0xea, 
-0xcb, 0xec, 0xb6, 0xf0, 0xae, 0xf5, 0xa6, 0xf9, 0xbd, 0xfe, 0x20, 0x04, 0x00, 0x08, 0x75, 0x0c, 
-0x72, 0x0f, 0x55, 0x11, 0x94, 0x13, 0xa8, 0x14, 0x86, 0x14, 0xba, 0x12, 0x35, 0x10, 0xd4, 0x0c, 
-0xdb, 0x08, 0x8c, 0x05, 0x06, 0x03, 0x9e, 0xff, 0x52, 0xfd, 0xf0, 0xfb, 0x46, 0xfb, 0xac, 0xfb, 
-0x15, 0xfc, 0x67, 0xfd, 0xfe, 0xfe, 0x80, 0x00, 0x78, 0x02, 0x3a, 0x03, 0x65, 0x02, 0x0f, 0x01, 
-0xec, 0xfd, 0x31, 0xfa, 0x1e, 0xf6, 0xc1, 0xf1, 0xb3, 0xed, 0xfd, 0xea, 0xc3, 0xea, 0xf2, 0xeb, 
-0xdc, 0xed, 0x70, 0xf1, 0xc1, 0xf4, 0xf7, 0xf7, 0xe8, 0xfc, 0x12, 0x01, 0xf7, 0x04, 0x0c, 0x09, 
-0x6b, 0x0c, 0x83, 0x0f, 0x2e, 0x12, 0x96, 0x13, 0x5b, 0x14, 0x09, 0x13, 0xe3, 0x10, 0x12, 0x0f, 
-0x46, 0x0c, 0x51, 0x0a, 0xee, 0x07, 0x58, 0x05, 0x73, 0x03, 0x01, 0x02, 0xaa, 0x00, 0x0a, 0xff, 
-0x5f, 0xfe, 0x26, 0xfe, 0xa1, 0xfd, 0xc1, 0xfd, 0x2b, 0xfe, 0x43, 0xfd, 0xdf, 0xfb, 0x49, 0xfa, 
-0x94, 0xf7, 0x4e, 0xf4, 0xa9, 0xf0, 0xa0, 0xec, 0x8a, 0xe9, 0x22, 0xe8, 0x69, 0xe8, 0x29, 0xea, 
-0xe1, 0xec, 0xde, 0xf0, 0xc3, 0xf5, 0xf3, 0xfa, 0x8a, 0x00, 0x16, 0x06, 0x36, 0x0b, 0x8e, 0x0f, 
-0x05, 0x13, 0xff, 0x15, 0xf2, 0x17, 0x4f, 0x18, 0x54, 0x17, 0xdc, 0x14, 0xe2, 0x11, 0xd9, 0x0e, 
-0x69, 0x0b, 0x37, 0x08, 0x11, 0x05, 0x4c, 0x02, 0x10, 0x00, 0x25, 0xfe, 0xd3, 0xfc, 0x0a, 0xfc, 
-0x59, 0xfb, 0x61, 0xfb, 0xa5, 0xfb, 0xeb, 0xfb, 0x6d, 0xfc, 0xd1, 0xfb, 0xa7, 0xfa, 0x0c, 0xf9, 
-0x9c, 0xf6, 0x24, 0xf4, 0x3e, 0xf1, 0xc0, 0xed, 0xb8, 0xeb, 0x51, 0xeb, 0xf0, 0xeb, 0x02, 0xee, 
-0xe1, 0xf0, 0xd2, 0xf4, 0x82, 0xf9, 0x2c, 0xfe, 0xa9, 0x03, 0xbf, 0x08, 0x09, 0x0d, 0xd7, 0x10, 
-0xa1, 0x13, 0x0d, 0x16, 0x2d, 0x17, 0xa9, 0x16, 0x07, 0x15, 0x22, 0x12, 0xe8, 0x0e, 0x27, 0x0c, 
-0xc6, 0x08, 0xe6, 0x05, 0x56, 0x03, 0xbd, 0x00, 0x1a, 0xff, 0x9a, 0xfd, 0xcf, 0xfc, 0x0b, 0xfc, 
-0x91, 0xfb, 0xd9, 0xfb, 0x18, 0xfc, 0x8a, 0xfc, 0xd8, 0xfc, 0xd3, 0xfb, 0x4f, 0xfa, 0x70, 0xf8, 
-0xba, 0xf5, 0xee, 0xf2, 0x91, 0xef, 0xf1, 0xec, 0x89, 0xeb, 0x6e, 0xeb, 0x38, 0xed, 0xa7, 0xef, 
-0x05, 0xf3, 0xa8, 0xf7, 0x3d, 0xfc, 0x46, 0x01, 0xba, 0x06, 0x30, 0x0b, 0x0a, 0x0f, 0x6d, 0x12, 
-0xeb, 0x14, 0x5d, 0x16, 0x6b, 0x16, 0x54, 0x15, 0x0a, 0x13, 0xd9, 0x0f, 0xa9, 0x0c, 0x72, 0x09, 
-0x79, 0x06, 0x87, 0x03, 0xd2, 0x00, 0xbf, 0xfe, 0xef, 0xfc, 0xd5, 0xfb, 0x12, 0xfb, 0x66, 0xfa, 
-0xa4, 0xfa, 0x1d, 0xfb, 0x76, 0xfb, 0x1d, 0xfc, 0xf6, 0xfb, 0xf5, 0xfa, 0x4e, 0xf9, 0xec, 0xf6, 
-0x7d, 0xf4, 0x63, 0xf1, 0x3f, 0xee, 0x88, 0xec, 0xe3, 0xeb, 0xd7, 0xec, 0x27, 0xef, 0x3b, 0xf2, 
-0x8c, 0xf6, 0x14, 0xfb, 0xe2, 0xff, 0x58, 0x05, 0x3b, 0x0a, 0x73, 0x0e, 0xee, 0x11, 0xad, 0x14, 
-0xc6, 0x16, 0x2a, 0x17, 0x6d, 0x16, 0xcc, 0x14, 0xab, 0x11, 0x3e, 0x0e, 0xbe, 0x0a, 0x42, 0x07, 
-0x40, 0x04, 0x5a, 0x01, 0x1f, 0xff, 0x41, 0xfd, 0xe4, 0xfb, 0x5b, 0xfb, 0xd4, 0xfa, 0xd8, 0xfa, 
-0x84, 0xfb, 0xc1, 0xfb, 0x37, 0xfc, 0x73, 0xfc, 0x92, 0xfb, 0x3c, 0xfa, 0x02, 0xf8, 0x97, 0xf5, 
-0xa0, 0xf2, 0x15, 0xef, 0xad, 0xec, 0x6e, 0xeb, 0x72, 0xeb, 0x1b, 0xed, 0xff, 0xef, 0xc2, 0xf3, 
-0x37, 0xf8, 0xf5, 0xfc, 0x3d, 0x02, 0x7c, 0x07, 0x07, 0x0c, 0xb4, 0x0f, 0xd1, 0x12, 0x58, 0x15, 
-0x66, 0x16, 0x60, 0x16, 0x4e, 0x15, 0xee, 0x12, 0xa2, 0x0f, 0xf1, 0x0b, 0x86, 0x08, 0x6a, 0x05, 
-0x5c, 0x02, 0x10, 0x00, 0x77, 0xfe, 0x27, 0xfd, 0x6e, 0xfc, 0x2e, 0xfc, 0x46, 0xfc, 0x96, 0xfc, 
-0xe2, 0xfc, 0x4c, 0xfd, 0x86, 0xfd, 0x2d, 0xfd, 0x1a, 0xfc, 0x48, 0xfa, 0x19, 0xf8, 0x7f, 0xf5, 
-0x43, 0xf2, 0x06, 0xef, 0x07, 0xed, 0x50, 0xec, 0xb2, 0xec, 0xbe, 0xee, 0x0f, 0xf2, 0xf5, 0xf5, 
-0x60, 0xfa, 0x4d, 0xff, 0x70, 0x04, 0x22, 0x09, 0x04, 0x0d, 0x5a, 0x10, 0x14, 0x13, 0xc2, 0x14, 
-0x3a, 0x15, 0xba, 0x14, 0x0d, 0x13, 0x18, 0x10, 0x99, 0x0c, 0x1a, 0x09, 0xd1, 0x05, 0xcc, 0x02, 
-0x47, 0x00, 0x8c, 0xfe, 0x2c, 0xfd, 0x3d, 0xfc, 0x03, 0xfc, 0xff, 0xfb, 0x37, 0xfc, 0xa9, 0xfc, 
-0x3f, 0xfd, 0xf8, 0xfd, 0x13, 0xfe, 0x7c, 0xfd, 0x4a, 0xfc, 0x3a, 0xfa, 0xa0, 0xf7, 0x7e, 0xf4, 
-0x01, 0xf1, 0x11, 0xee, 0x32, 0xec, 0xa3, 0xeb, 0x9c, 0xec, 0x18, 0xef, 0x9e, 0xf2, 0xd5, 0xf6, 
-0xc2, 0xfb, 0xf5, 0x00, 0x08, 0x06, 0x98, 0x0a, 0x6b, 0x0e, 0xbb, 0x11, 0x21, 0x14, 0x34, 0x15, 
-0x5a, 0x15, 0x5a, 0x14, 0x18, 0x12, 0x09, 0x0f, 0x99, 0x0b, 0x50, 0x08, 0x30, 0x05, 0x4f, 0x02, 
-0x22, 0x00, 0x7d, 0xfe, 0x34, 0xfd, 0x70, 0xfc, 0x2c, 0xfc, 0x37, 0xfc, 0x4d, 0xfc, 0x99, 0xfc, 
-0x2c, 0xfd, 0x8b, 0xfd, 0x82, 0xfd, 0x08, 0xfd, 0xe3, 0xfb, 0x1a, 0xfa, 0xe4, 0xf7, 0x25, 0xf5, 
-0x35, 0xf2, 0xf5, 0xef, 0x87, 0xee, 0x3e, 0xee, 0x7c, 0xef, 0xd4, 0xf1, 0x07, 0xf5, 0x25, 0xf9, 
-0xcf, 0xfd, 0x7d, 0x02, 0x12, 0x07, 0x3f, 0x0b, 0xbf, 0x0e, 0x9e, 0x11, 0xa3, 0x13, 0x9d, 0x14, 
-0x89, 0x14, 0x38, 0x13, 0xf5, 0x10, 0x0e, 0x0e, 0xa9, 0x0a, 0x60, 0x07, 0x3f, 0x04, 0x89, 0x01, 
-0x90, 0xff, 0xe3, 0xfd, 0xb5, 0xfc, 0xfa, 0xfb, 0x90, 0xfb, 0x80, 0xfb, 0x7c, 0xfb, 0xdb, 0xfb, 
-0x47, 0xfc, 0x63, 0xfc, 0x7e, 0xfc, 0x2e, 0xfc, 0x17, 0xfb, 0x7c, 0xf9, 0x79, 0xf7, 0x10, 0xf5, 
-0xa0, 0xf2, 0xc8, 0xf0, 0xdd, 0xef, 0xd3, 0xef, 0xef, 0xf0, 0x32, 0xf3, 0x00, 0xf6, 0xa0, 0xf9, 
-0xc6, 0xfd, 0x0c, 0x02, 0x6d, 0x06, 0x3a, 0x0a, 0xad, 0x0d, 0x7f, 0x10, 0x41, 0x12, 0x45, 0x13, 
-0x07, 0x13, 0xca, 0x11, 0xd0, 0x0f, 0x0c, 0x0d, 0x1f, 0x0a, 0xf4, 0x06, 0xfa, 0x03, 0x8b, 0x01, 
-0x48, 0xff, 0x88, 0xfd, 0x56, 0xfc, 0x75, 0xfb, 0x14, 0xfb, 0x0b, 0xfb, 0x6c, 0xfb, 0xf9, 0xfb, 
-0x57, 0xfc, 0xb2, 0xfc, 0xce, 0xfc, 0x8a, 0xfc, 0xc3, 0xfb, 0x7e, 0xfa, 0x13, 0xf9, 0x21, 0xf7, 
-0x16, 0xf5, 0xa6, 0xf3, 0xb9, 0xf2, 0x5d, 0xf2, 0xdc, 0xf2, 0x4f, 0xf4, 0x63, 0xf6, 0x22, 0xf9, 
-0x7d, 0xfc, 0x4c, 0x00, 0x08, 0x04, 0x6b, 0x07, 0xec, 0x0a, 0xda, 0x0d, 0xcc, 0x0f, 0x24, 0x11, 
-0x82, 0x11, 0xec, 0x10, 0x69, 0x0f, 0x3c, 0x0d, 0xe7, 0x0a, 0x3a, 0x08, 0x8b, 0x05, 0x1b, 0x03, 
-0xda, 0x00, 0x1f, 0xff, 0xb4, 0xfd, 0xa7, 0xfc, 0x31, 0xfc, 0xca, 0xfb, 0xc0, 0xfb, 0x0c, 0xfc, 
-0x5c, 0xfc, 0xa7, 0xfc, 0xcb, 0xfc, 0xc8, 0xfc, 0x82, 0xfc, 0xf0, 0xfb, 0x1d, 0xfb, 0xd1, 0xf9, 
-0x67, 0xf8, 0x06, 0xf7, 0xad, 0xf5, 0x17, 0xf5, 0xf0, 0xf4, 0x3a, 0xf5, 0x2d, 0xf6, 0xc3, 0xf7, 
-0xf6, 0xf9, 0xb3, 0xfc, 0xed, 0xff, 0xf2, 0x02, 0xed, 0x05, 0xb7, 0x08, 0xea, 0x0a, 0xaf, 0x0c, 
-0xc0, 0x0d, 0xf2, 0x0d, 0x6d, 0x0d, 0x31, 0x0c, 0x8f, 0x0a, 0xae, 0x08, 0x77, 0x06, 0x56, 0x04, 
-0x58, 0x02, 0x91, 0x00, 0x17, 0xff, 0xf3, 0xfd, 0x19, 0xfd, 0x69, 0xfc, 0x19, 0xfc, 0x03, 0xfc, 
-0x46, 0xfc, 0xc3, 0xfc, 0x15, 0xfd, 0x65, 0xfd, 0x88, 0xfd, 0x92, 0xfd, 0x59, 0xfd, 0xc9, 0xfc, 
-0x55, 0xfc, 0x32, 0xfb, 0x1a, 0xfa, 0x0f, 0xf9, 0x2d, 0xf8, 0xca, 0xf7, 0x36, 0xf7, 0x9f, 0xf7, 
-0x6b, 0xf8, 0x8d, 0xf9, 0x8e, 0xfb, 0xe9, 0xfd, 0x99, 0x00, 0xff, 0x02, 0xae, 0x05, 0xf0, 0x07, 
-0xce, 0x09, 0x80, 0x0b, 0xf4, 0x0b, 0xfe, 0x0b, 0x51, 0x0b, 0xd9, 0x09, 0x39, 0x08, 0x5d, 0x06, 
-0x28, 0x04, 0x80, 0x02, 0xb5, 0x00, 0x20, 0xff, 0x48, 0xfe, 0x78, 0xfd, 0x57, 0xfd, 0x5f, 0xfd, 
-0xba, 0xfd, 0x78, 0xfe, 0x4d, 0xff, 0xf4, 0xff, 0x75, 0x00, 0xd0, 0x00, 0x9a, 0x00, 0xd1, 0xff, 
-0xa1, 0xfe, 0x24, 0xfd, 0x0d, 0xfb, 0x04, 0xf9, 0x5e, 0xf7, 0xac, 0xf5, 0x5c, 0xf4, 0xa6, 0xf3, 
-0x78, 0xf3, 0x7a, 0xf4, 0xf6, 0xf5, 0xf4, 0xf7, 0xf1, 0xfa, 0x0a, 0xfe, 0x68, 0x01, 0xd6, 0x04, 
-0xa1, 0x07, 0x29, 0x0a, 0x19, 0x0c, 0xf8, 0x0c, 0x19, 0x0d, 0x9d, 0x0c, 0x7d, 0x0b, 0x94, 0x09, 
-0x4b, 0x07, 0x64, 0x05, 0x7a, 0x03, 0x66, 0x01, 0xe3, 0xff, 0x82, 0xfe, 0x58, 0xfd, 0xae, 0xfc, 
-0x9d, 0xfc, 0xe1, 0xfc, 0x07, 0xfd, 0xda, 0xfd, 0xc1, 0xfe, 0x78, 0xff, 0x27, 0x00, 0xa7, 0x00, 
-0xdc, 0x00, 0xc9, 0x00, 0x6f, 0x00, 0x9f, 0xff, 0xb1, 0xfe, 0x47, 0xfd, 0xfc, 0xfb, 0x1f, 0xfb, 
-0xe5, 0xf9, 0xb6, 0xf8, 0xff, 0xf7, 0xa3, 0xf7, 0xa3, 0xf7, 0x2d, 0xf8, 0x3b, 0xf9, 0xb9, 0xfa, 
-0x73, 0xfc, 0x8d, 0xfe, 0xc3, 0x00, 0xc3, 0x02, 0x74, 0x04, 0x01, 0x06, 0x30, 0x07, 0x89, 0x07, 
-0xd0, 0x07, 0x8c, 0x07, 0xc9, 0x06, 0x1c, 0x06, 0x24, 0x05, 0x3e, 0x04, 0x34, 0x03, 0xed, 0x01, 
-0xec, 0x00, 0x47, 0x00, 0xa6, 0xff, 0x54, 0xff, 0x65, 0xff, 0x71, 0xff, 0x2e, 0xff, 0x24, 0xff, 
-0xb1, 0xff, 0x02, 0x00, 0x20, 0x00, 0x74, 0x00, 0x82, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0x72, 0x00, 
-0x14, 0x00, 0xe4, 0xfe, 0x2e, 0xfe, 0x16, 0xfd, 0xb3, 0xfb, 0xf0, 0xfa, 0x10, 0xfa, 0x43, 0xf9, 
-0x20, 0xf9, 0x36, 0xf9, 0x34, 0xf9, 0x3e, 0xfa, 0x21, 0xfb, 0x65, 0xfc, 0xe5, 0xfd, 0x42, 0xff, 
-0x5c, 0x01, 0xdf, 0x02, 0xdd, 0x04, 0xb5, 0x0a, 0xc7, 0x0c, 0x63, 0x0a, 0x87, 0x09, 0x2a, 0x07, 
-0xf9, 0x05, 0x26, 0x04, 0x06, 0x03, 0x21, 0x02, 0x51, 0xff, 0x6b, 0xff, 0x0f, 0xff, 0x2b, 0xfe, 
-0x4f, 0xfe, 0xf0, 0xfd, 0x97, 0xfe, 0xba, 0xfe, 0xd1, 0xfe, 0x8f, 0x00, 0x24, 0x00, 0x7e, 0xff, 
-0x21, 0xff, 0xcc, 0xfe, 0xd2, 0xfd, 0xf3, 0xfb, 0x2d, 0xfb, 0xe8, 0xf9, 0x5f, 0xf8, 0xc1, 0xf7, 
-0x27, 0xf8, 0xb4, 0xf8, 0x23, 0xfa, 0x31, 0xfb, 0x65, 0xfd, 0x43, 0xff, 0x14, 0x01, 0x63, 0x03, 
-0xa7, 0x04, 0x67, 0x06, 0xf3, 0x06, 0xeb, 0x06, 0x50, 0x07, 0xb5, 0x06, 0xef, 0x05, 0xdd, 0x05, 
-0xad, 0x04, 0x7c, 0x03, 0xfb, 0x02, 0x1d, 0x02, 0x8d, 0x02, 0x60, 0x01, 0xa1, 0x00, 0x6e, 0x01, 
-0xe8, 0x00, 0x77, 0x01, 0x24, 0x01, 0xd7, 0x01, 0xe4, 0x02, 0xbf, 0x01, 0x65, 0x02, 0x8a, 0x00, 
-0xd3, 0xfe, 0x25, 0xfd, 0x6f, 0xfa, 0xc9, 0xf8, 0x1f, 0xf5, 0x66, 0xf2, 0x7e, 0xf0, 0x05, 0xf1, 
-0xaf, 0xf1, 0x7f, 0xf4, 0x02, 0xf8, 0x6a, 0xfb, 0xee, 0x00, 0x21, 0x04, 0x8e, 0x07, 0x3a, 0x0b, 
-0x94, 0x0b, 0xfc, 0x0b, 0x8d, 0x0b, 0x2c, 0x09, 0x56, 0x07, 0x90, 0x04, 0x25, 0x02, 0x45, 0x00, 
-0xf5, 0xfd, 0xa2, 0xfe, 0x21, 0xff, 0xb6, 0xfe, 0xd3, 0x01, 0xae, 0x02, 0xd8, 0x03, 0x89, 0x06, 
-0x84, 0x05, 0x68, 0x07, 0xe2, 0x06, 0x76, 0x04, 0xe5, 0x05, 0x80, 0x02, 0x68, 0x00, 0xab, 0xff, 
-0x63, 0xfc, 0x10, 0xfb, 0xf1, 0xf6, 0x7f, 0xf4, 0x7d, 0xf2, 0xe8, 0xea, 0x4a, 0xeb, 0xb4, 0xeb, 
-0x8e, 0xeb, 0x24, 0xf4, 0x9c, 0xf7, 0xf7, 0xfd, 0xd6, 0x06, 0x68, 0x09, 0x8f, 0x0e, 0xd8, 0x0f, 
-0x34, 0x0f, 0xa5, 0x0f, 0x27, 0x0a, 0x79, 0x07, 0x9c, 0x04, 0xd5, 0xfe, 0xae, 0xfd, 0x39, 0xfb, 
-0xe5, 0xfa, 0xad, 0xfc, 0x8c, 0xfc, 0xe9, 0x00, 0xb5, 0x03, 0x7d, 0x05, 0x76, 0x09, 0xab, 0x09, 
-0x99, 0x0a, 0x43, 0x0a, 0x8a, 0x07, 0x29, 0x06, 0x39, 0x03, 0xe8, 0x01, 0x84, 0xff, 0x7a, 0xfd, 
-0xec, 0xfd, 0xaa, 0xfa, 0xf4, 0xf6, 0x55, 0xf5, 0xf8, 0xf0, 0xc8, 0xea, 0xca, 0xea, 0xc7, 0xea, 
-0x72, 0xed, 0x60, 0xf6, 0x53, 0xfa, 0x7b, 0x01, 0xbf, 0x09, 0xb1, 0x0c, 0xda, 0x10, 0x97, 0x11, 
-0x21, 0x11, 0xf4, 0x0f, 0x60, 0x09, 0x82, 0x06, 0x07, 0x02, 0x4d, 0xfc, 0xf1, 0xfa, 0x63, 0xf8, 
-0xba, 0xf8, 0x09, 0xfa, 0x19, 0xfb, 0xcb, 0xff, 0x03, 0x04, 0xd3, 0x07, 0xa8, 0x0b, 0x30, 0x0d, 
-0x54, 0x0f, 0x06, 0x0f, 0xaf, 0x0b, 0x91, 0x09, 0x7b, 0x06, 0x41, 0x02, 0xd4, 0xfd, 0xb5, 0xf9, 
-0x5b, 0xf6, 0x77, 0xf1, 0x78, 0xeb, 0xe3, 0xe6, 0x33, 0xe4, 0x66, 0xe4, 0x6f, 0xe7, 0xd7, 0xea, 
-0x93, 0xf2, 0x6e, 0xfa, 0xe9, 0xff, 0xad, 0x07, 0x0d, 0x0e, 0xd2, 0x11, 0x0a, 0x15, 0xff, 0x15, 
-0x19, 0x15, 0xce, 0x11, 0xd0, 0x0c, 0x5d, 0x08, 0x1f, 0x03, 0x41, 0xfd, 0xf2, 0xf9, 0x15, 0xf7, 
-0x65, 0xf5, 0x74, 0xf6, 0xa1, 0xf7, 0x81, 0xfb, 0xa0, 0xff, 0x7d, 0x05, 0x15, 0x0a, 0x8b, 0x0b, 
-0x2b, 0x10, 0x5e, 0x11, 0x1b, 0x0d, 0x37, 0x0c, 0x44, 0x0a, 0x64, 0x03, 0x8d, 0xfe, 0x9a, 0xfa, 
-0x7f, 0xf6, 0xff, 0xef, 0xa9, 0xea, 0x80, 0xe7, 0xf6, 0xe2, 0x6f, 0xe4, 0xc1, 0xe6, 0x0d, 0xea, 
-0x2f, 0xf2, 0xea, 0xf8, 0xaf, 0xfe, 0x5e, 0x07, 0xa1, 0x0d, 0xd6, 0x10, 0x60, 0x15, 0xd3, 0x16, 
-0x9a, 0x15, 0x02, 0x14, 0x19, 0x10, 0x44, 0x0b, 0x10, 0x07, 0x7c, 0x01, 0x38, 0xfd, 0x07, 0xfa, 
-0x8c, 0xf6, 0x50, 0xf6, 0x79, 0xf7, 0xc3, 0xf8, 0x90, 0xfc, 0x6d, 0x02, 0xf3, 0x06, 0x89, 0x09, 
-0x81, 0x0d, 0x42, 0x10, 0xb3, 0x0d, 0x1f, 0x0c, 0x97, 0x0b, 0xfb, 0x05, 0xf5, 0x00, 0xec, 0xfd, 
-0x36, 0xf9, 0x15, 0xf4, 0x71, 0xef, 0xd0, 0xeb, 0x47, 0xe7, 0xfe, 0xe4, 0x5c, 0xe7, 0xc3, 0xe8, 
-0xf9, 0xec, 0xa7, 0xf3, 0x24, 0xf9, 0xc1, 0xff, 0x13, 0x06, 0x68, 0x0b, 0xe0, 0x0f, 0x02, 0x13, 
-0x69, 0x14, 0x9e, 0x14, 0xec, 0x12, 0xb4, 0x0f, 0xa7, 0x0c, 0x58, 0x08, 0x94, 0x03, 0xf0, 0xff, 
-0x02, 0xfc, 0x6d, 0xf9, 0x3d, 0xf8, 0xce, 0xf7, 0xb9, 0xf8, 0x2b, 0xfb, 0x7e, 0xff, 0x51, 0x02, 
-0x08, 0x05, 0x6c, 0x09, 0xd9, 0x0a, 0x17, 0x0a, 0x51, 0x0b, 0xff, 0x09, 0xcb, 0x05, 0xec, 0x02, 
-0xf9, 0xfe, 0xea, 0xfa, 0x8a, 0xf6, 0x39, 0xf2, 0xc4, 0xee, 0x9f, 0xeb, 0x82, 0xea, 0xc2, 0xea, 
-0x09, 0xed, 0x68, 0xf0, 0x06, 0xf3, 0xb9, 0xf7, 0x0d, 0xfd, 0x87, 0x00, 0x59, 0x05, 0xe1, 0x09, 
-0xf2, 0x0c, 0x11, 0x0f, 0x59, 0x10, 0xf7, 0x10, 0x93, 0x0f, 0xbe, 0x0d, 0x52, 0x0b, 0x4c, 0x08, 
-0xd6, 0x04, 0xac, 0x01, 0xe9, 0xff, 0xcd, 0xfd, 0x1b, 0xfc, 0x3b, 0xfc, 0x62, 0xfd, 0xd4, 0xfd, 
-0x2b, 0xff, 0xc1, 0x01, 0xe5, 0x02, 0xc9, 0x03, 0x73, 0x04, 0x81, 0x04, 0xa1, 0x03, 0x1c, 0x02, 
-0x54, 0x00, 0xb7, 0xfe, 0x76, 0xfd, 0x69, 0xfb, 0xda, 0xf9, 0x97, 0xf8, 0x3f, 0xf7, 0x4f, 0xf6, 
-0xed, 0xf5, 0xfc, 0xf5, 0xe6, 0xf5, 0xe3, 0xf6, 0xdb, 0xf7, 0x1d, 0xf9, 0x50, 0xfb, 0xee, 0xfc, 
-0xcb, 0xfe, 0x33, 0x01, 0xec, 0x02, 0xbe, 0x04, 0x77, 0x06, 0x59, 0x07, 0x35, 0x08, 0x6e, 0x08, 
-0x2c, 0x08, 0x61, 0x07, 0xb8, 0x06, 0x30, 0x06, 0xb1, 0x04, 0xfc, 0x03, 0xc6, 0x03, 0xd5, 0x02, 
-0x50, 0x02, 0x19, 0x02, 0xbf, 0x01, 0xc0, 0x01, 0x82, 0x01, 0x27, 0x01, 0x90, 0x01, 0x33, 0x01, 
-0x91, 0x00, 0x95, 0x00, 0x2f, 0x00, 0x62, 0xff, 0xf9, 0xfe, 0x8c, 0xfe, 0x82, 0xfd, 0x7a, 0xfc, 
-0xbf, 0xfb, 0xc5, 0xfa, 0x6b, 0xf9, 0xf2, 0xf8, 0xa3, 0xf8, 0x18, 0xf8, 0x87, 0xf8, 0xc7, 0xf8, 
-0x1c, 0xf9, 0x3d, 0xfa, 0xf8, 0xfa, 0xfa, 0xfb, 0xa9, 0xfd, 0xe4, 0xfe, 0x03, 0x00, 0x5e, 0x01, 
-0x7b, 0x02, 0x79, 0x03, 0x2b, 0x04, 0xd2, 0x04, 0x93, 0x05, 0xec, 0x05, 0x72, 0x06, 0xd3, 0x06, 
-0xbc, 0x06, 0xcb, 0x06, 0x50, 0x06, 0x01, 0x06, 0x95, 0x05, 0xe1, 0x04, 0x73, 0x04, 0xaf, 0x03, 
-0xd5, 0x02, 0x02, 0x02, 0x2c, 0x01, 0x1e, 0x00, 0x42, 0xff, 0x7b, 0xfe, 0xc5, 0xfd, 0x38, 0xfd, 
-0x84, 0xfc, 0x2d, 0xfc, 0xe8, 0xfb, 0x6c, 0xfb, 0xff, 0xfa, 0xcb, 0xfa, 0x98, 0xfa, 0x3b, 0xfa, 
-0x48, 0xfa, 0x4a, 0xfa, 0x40, 0xfa, 0x9b, 0xfa, 0xf6, 0xfa, 0xa4, 0xfb, 0x3f, 0xfc, 0xd2, 0xfc, 
-0xeb, 0xfd, 0xf7, 0xfe, 0x0f, 0x00, 0x2b, 0x01, 0x5a, 0x02, 0x6a, 0x03, 0x2b, 0x04, 0x19, 0x05, 
-0x9c, 0x05, 0xe5, 0x05, 0x43, 0x06, 0x4a, 0x06, 0x34, 0x06, 0x27, 0x06, 0xef, 0x05, 0x65, 0x05, 
-0x1c, 0x05, 0xb2, 0x04, 0x03, 0x04, 0x89, 0x03, 0xe0, 0x02, 0x22, 0x02, 0x50, 0x01, 0x79, 0x00, 
-0x94, 0xff, 0xbe, 0xfe, 0x15, 0xfe, 0x5d, 0xfd, 0xcb, 0xfc, 0x63, 0xfc, 0x0d, 0xfc, 0xba, 0xfb, 
-0x98, 0xfb, 0x89, 0xfb, 0x70, 0xfb, 0x65, 0xfb, 0x3a, 0xfb, 0x3a, 0xfb, 0x3f, 0xfb, 0x05, 0xfb, 
-0x16, 0xfb, 0x5a, 0xfb, 0x9f, 0xfb, 0x14, 0xfc, 0xa8, 0xfc, 0x8d, 0xfd, 0x68, 0xfe, 0x45, 0xff, 
-0x55, 0x00, 0x3f, 0x01, 0x24, 0x02, 0xe8, 0x02, 0xa6, 0x03, 0x3b, 0x04, 0x9d, 0x04, 0x00, 0x05, 
-0x2d, 0x05, 0x32, 0x05, 0x3b, 0x05, 0x33, 0x05, 0xfe, 0x04, 0xc4, 0x04, 0x6d, 0x04, 0x04, 0x04, 
-0x79, 0x03, 0xdb, 0x02, 0x3b, 0x02, 0x8b, 0x01, 0xdd, 0x00, 0x14, 0x00, 0x72, 0xff, 0xe2, 0xfe, 
-0x4c, 0xfe, 0xe2, 0xfd, 0xa7, 0xfd, 0x77, 0xfd, 0x45, 0xfd, 0x43, 0xfd, 0x35, 0xfd, 0x2f, 0xfd, 
-0x28, 0xfd, 0x0f, 0xfd, 0xfa, 0xfc, 0xcd, 0xfc, 0x9f, 0xfc, 0x6a, 0xfc, 0x42, 0xfc, 0x2a, 0xfc, 
-0x20, 0xfc, 0x41, 0xfc, 0x95, 0xfc, 0x04, 0xfd, 0x9f, 0xfd, 0x63, 0xfe, 0x2b, 0xff, 0x02, 0x00, 
-0xdf, 0x00, 0xbe, 0x01, 0x8d, 0x02, 0x43, 0x03, 0xd7, 0x03, 0x4e, 0x04, 0xa3, 0x04, 0xd7, 0x04, 
-0xe8, 0x04, 0xcd, 0x04, 0xad, 0x04, 0x6d, 0x04, 0x1d, 0x04, 0xbc, 0x03, 0x34, 0x03, 0xac, 0x02, 
-0x2b, 0x02, 0xa6, 0x01, 0x17, 0x01, 0xa4, 0x00, 0x43, 0x00, 0xde, 0xff, 0x82, 0xff, 0x48, 0xff, 
-0x13, 0xff, 0xcd, 0xfe, 0x9f, 0xfe, 0x60, 0xfe, 0x1f, 0xfe, 0xe4, 0xfd, 0x87, 0xfd, 0x41, 0xfd, 
-0x01, 0xfd, 0xb6, 0xfc, 0x71, 0xfc, 0x37, 0xfc, 0x1f, 0xfc, 0x0e, 0xfc, 0x12, 0xfc, 0x3c, 0xfc, 
-0x79, 0xfc, 0xe1, 0xfc, 0x5c, 0xfd, 0xe5, 0xfd, 0x89, 0xfe, 0x37, 0xff, 0xe3, 0xff, 0x87, 0x00, 
-0x28, 0x01, 0xbc, 0x01, 0x35, 0x02, 0xa0, 0x02, 0xf7, 0x02, 0x37, 0x03, 0x5f, 0x03, 0x7c, 0x03, 
-0x88, 0x03, 0x88, 0x03, 0x7d, 0x03, 0x5f, 0x03, 0x3b, 0x03, 0x1a, 0x03, 0xe4, 0x02, 0xa6, 0x02, 
-0x68, 0x02, 0x1b, 0x02, 0xc1, 0x01, 0x5d, 0x01, 0xf6, 0x00, 0x8f, 0x00, 0x1e, 0x00, 0xaa, 0xff, 
-0x3b, 0xff, 0xc9, 0xfe, 0x5d, 0xfe, 0xfb, 0xfd, 0xa1, 0xfd, 0x4d, 0xfd, 0x06, 0xfd, 0xd0, 0xfc, 
-0xa5, 0xfc, 0x8e, 0xfc, 0x87, 0xfc, 0x8d, 0xfc, 0xa9, 0xfc, 0xd2, 0xfc, 0x08, 0xfd, 0x54, 0xfd, 
-0xac, 0xfd, 0x0e, 0xfe, 0x6f, 0xfe, 0xd5, 0xfe, 0x4a, 0xff, 0xb9, 0xff, 0x21, 0x00, 0x7e, 0x00, 
-0xd9, 0x00, 0x31, 0x01, 0x70, 0x01, 0xac, 0x01, 0xe4, 0x01, 0x10, 0x02, 0x35, 0x02, 0x52, 0x02, 
-0x70, 0x02, 0x83, 0x02, 0x8d, 0x02, 0x9c, 0x02, 0xa0, 0x02, 0x99, 0x02, 0x85, 0x02, 0x68, 0x02, 
-0x3d, 0x02, 0xfb, 0x01, 0xb1, 0x01, 0x5c, 0x01, 0xf8, 0x00, 0x91, 0x00, 0x26, 0x00, 0xb2, 0xff, 
-0x3e, 0xff, 0xda, 0xfe, 0x79, 0xfe, 0x2c, 0xfe, 0xf2, 0xfd, 0xc6, 0xfd, 0xa2, 0xfd, 0x8d, 0xfd, 
-0x8e, 0xfd, 0x99, 0xfd, 0xbf, 0xfd, 0xea, 0xfd, 0x19, 0xfe, 0x57, 0xfe, 0x91, 0xfe, 0xe6, 0xfe, 
-0x3d, 0xff, 0x85, 0xff, 0xd1, 0xff, 0x0f, 0x00, 0x45, 0x00, 0x76, 0x00, 0x9f, 0x00, 0xc6, 0x00, 
-0xf1, 0x00, 0x13, 0x01, 0x34, 0x01, 0x51, 0x01, 0x46, 0x01, 0x53, 0x01, 0x5f, 0x01, 0x60, 0x01, 
-0x5b, 0x01, 0x4d, 0x01, 0x43, 0x01, 0x22, 0x01, 0xfb, 0x00, 0xdc, 0x00, 0xcb, 0x00, 0xbe, 0x00, 
-0xb9, 0x00, 0x7f, 0x00, 0x21, 0x00, 0xe6, 0xff, 0xc7, 0xff, 0xbf, 0xff, 0xac, 0xff, 0x81, 0xff, 
-0x2c, 0xff, 0xf1, 0xfe, 0xfb, 0xfe, 0x09, 0xff, 0x0e, 0xff, 0x09, 0xff, 0xf1, 0xfe, 0xcb, 0xfe, 
-0xcc, 0xfe, 0xca, 0xfe, 0xe7, 0xfe, 0x05, 0xff, 0x32, 0xff, 0x69, 0xff, 0x63, 0xff, 0x98, 0xff, 
-0xcd, 0xff, 0x0b, 0x00, 0x6b, 0x00, 0xab, 0x00, 0x9e, 0x00, 0x74, 0x00, 0x8c, 0x00, 0x83, 0x00, 
-0xf4, 0x00, 0xb0, 0x00, 0xea, 0x02, 0x0e, 0x06, 0xe2, 0x02, 0x7b, 0xfd, 0x3d, 0xfc, 0x78, 0x00, 
-0x7a, 0x03, 0x2e, 0x01, 0x96, 0xfd, 0x51, 0xfd, 0xfd, 0xff, 0x3e, 0x01, 0xc1, 0xff, 0xe4, 0xfd, 
-0x8f, 0xfe, 0xb5, 0x00, 0x5c, 0x01, 0x16, 0x00, 0x00, 0xff, 0xcf, 0xff, 0x0c, 0x01, 0xbc, 0x00, 
-0x32, 0xff, 0x8d, 0xfe, 0x80, 0xff, 0x71, 0x00, 0x18, 0x00, 0x21, 0xff, 0xf5, 0xfe, 0xa8, 0xff, 
-0xe5, 0xff, 0x53, 0xff, 0x0e, 0xff, 0x38, 0xff, 0xa7, 0xff, 0xb8, 0xff, 0x7d, 0xff, 0xa0, 0xff, 
-0x24, 0x00, 0x3d, 0x00, 0x35, 0x00, 0x22, 0x00, 0x25, 0x00, 0xe1, 0x00, 0x21, 0x01, 0x91, 0x00, 
-0xf7, 0xff, 0x38, 0x00, 0xff, 0x00, 0x5a, 0x01, 0x33, 0x00, 0x5b, 0xff, 0x46, 0xff, 0x63, 0x00, 
-0x48, 0x01, 0x49, 0x00, 0x8c, 0xff, 0xac, 0xfe, 0x81, 0xff, 0x06, 0x01, 0xbb, 0x00, 0x5c, 0xff, 
-0xab, 0xfe, 0x93, 0xff, 0xa4, 0x03, 0xca, 0x06, 0x01, 0x03, 0xfe, 0xfc, 0xd1, 0xfb, 0x78, 0xff, 
-0xa7, 0x01, 0xae, 0xff, 0x36, 0xfc, 0x61, 0xfc, 0xb0, 0xff, 0x40, 0x01, 0xee, 0xff, 0xba, 0xfd, 
-0x23, 0xfe, 0x9d, 0xff, 0xe1, 0x00, 0x96, 0xfe, 0x72, 0xfc, 0xed, 0xff, 0x63, 0x02, 0x2e, 0x03, 
-0xad, 0x02, 0xa9, 0x02, 0xf6, 0x03, 0x44, 0x03, 0xa2, 0x00, 0xc9, 0xfd, 0xae, 0xfc, 0xd1, 0xfd, 
-0xde, 0xff, 0x9a, 0x00, 0x97, 0xff, 0xd2, 0xfe, 0xc3, 0xff, 0x44, 0x01, 0x54, 0x03, 0xd6, 0x02, 
-0x52, 0xff, 0x58, 0xfc, 0x4d, 0xfd, 0x2f, 0x00, 0xcc, 0x00, 0x29, 0x00, 0x55, 0xff, 0xe0, 0xff, 
-0xeb, 0xff, 0xee, 0xfe, 0x12, 0xff, 0x23, 0x00, 0xe4, 0x00, 0x22, 0x01, 0x5a, 0x01, 0xb2, 0x04, 
-0x92, 0x0a, 0x28, 0x0a, 0xff, 0x00, 0x44, 0xf8, 0x06, 0xf8, 0x4f, 0xfd, 0x49, 0xff, 0x03, 0xfc, 
-0x38, 0xf9, 0xf4, 0xfb, 0xf5, 0x00, 0x45, 0x01, 0x7c, 0xfd, 0x94, 0xfb, 0xa5, 0xff, 0x30, 0x05, 
-0x7b, 0x06, 0xa1, 0x02, 0x20, 0xfe, 0x52, 0xfd, 0xb4, 0xff, 0xa1, 0x01, 0xed, 0xff, 0x28, 0xfd, 
-0x51, 0xfd, 0x8b, 0xff, 0xa8, 0x00, 0xda, 0xff, 0x8f, 0xfd, 0x59, 0xfd, 0xbd, 0xfe, 0x84, 0x00, 
-0x21, 0x01, 0x83, 0xff, 0x5c, 0xff, 0xe6, 0xff, 0x93, 0x00, 0xc3, 0x00, 0xe0, 0xff, 0x2b, 0xff, 
-0xa8, 0xff, 0x8e, 0x00, 0x9f, 0x00, 0xab, 0x00, 0xd3, 0xff, 0x9a, 0x00, 0xee, 0x01, 0x28, 0x01, 
-0x98, 0xff, 0xb0, 0xfe, 0xff, 0xff, 0x4f, 0x01, 0x6b, 0x01, 0x05, 0x00, 0xe9, 0xfe, 0x0d, 0xff, 
-0x56, 0x00, 0xcd, 0x00, 0x04, 0x00, 0xa8, 0xff, 0x70, 0xff, 0x68, 0xff, 0x38, 0xff, 0x75, 0x00, 
-0xe6, 0x00, 0xf7, 0xff, 0xf8, 0xff, 0x69, 0x00, 0x76, 0x00, 0xe1, 0x00, 0x28, 0x00, 0xb8, 0xff, 
-0x3a, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x70, 0x00, 0x87, 0x00, 0x6a, 0x00, 0x43, 0x00, 0x1f, 0x00, 
-0x64, 0x00, 0xf5, 0x00, 0xa4, 0x00, 0x5e, 0x00, 0x04, 0x01, 0xbb, 0x00, 0x0b, 0x00, 0xd5, 0xff, 
-0x7c, 0xff, 0xbd, 0x00, 0x30, 0x01, 0xf6, 0xff, 0xd5, 0xfe, 0x96, 0xfe, 0xb1, 0xff, 0x53, 0x00, 
-0x4e, 0x00, 0x2e, 0x00, 0x25, 0xff, 0x87, 0xfe, 0xb9, 0xfe, 0xe8, 0xff, 0x5e, 0x00, 0x60, 0xff, 
-0x82, 0xfe, 0xa6, 0xfe, 0xb5, 0xff, 0xba, 0x00, 0x89, 0x01, 0x49, 0x01, 0x49, 0x00, 0x88, 0xff, 
-0x85, 0x00, 0xb9, 0x00, 0xd2, 0xff, 0x1b, 0xff, 0x35, 0xff, 0x85, 0x00, 0xc5, 0x00, 0x5b, 0x00, 
-0x11, 0x00, 0x72, 0xff, 0x14, 0x00, 0xd8, 0x00, 0x40, 0x00, 0x85, 0xff, 0xaa, 0xff, 0x58, 0x00, 
-0x4a, 0x00, 0xf6, 0x00, 0x79, 0x00, 0x30, 0xff, 0xd7, 0xfe, 0x26, 0xff, 0x7f, 0x00, 0x9b, 0x00, 
-0xa8, 0xfe, 0xb0, 0xfe, 0x54, 0xff, 0xdf, 0xfe, 0x34, 0x00, 0xe3, 0x00, 0x93, 0xff, 0xc1, 0xfe, 
-0x89, 0x00, 0xb8, 0x01, 0x9c, 0xfe, 0x31, 0xfd, 0x55, 0x00, 0x43, 0x02, 0x56, 0x00, 0x84, 0xfc, 
-0xb0, 0xfc, 0x83, 0xff, 0xcf, 0x01, 0xa8, 0x01, 0x9d, 0xfe, 0x87, 0xfc, 0x1d, 0xff, 0x22, 0x03, 
-0xff, 0x01, 0x61, 0x00, 0x5c, 0xfe, 0xc9, 0xfe, 0x58, 0x02, 0x74, 0x03, 0x98, 0x01, 0xd2, 0xfe, 
-0x16, 0xfe, 0x7a, 0x00, 0x59, 0x02, 0xe2, 0xff, 0xcf, 0xfe, 0xbe, 0xfe, 0x6f, 0xff, 0x84, 0x00, 
-0x34, 0x01, 0xde, 0x00, 0xff, 0xfe, 0x5f, 0xff, 0x07, 0x01, 0x72, 0x01, 0xf6, 0x00, 0xb7, 0x00, 
-0x79, 0xff, 0x17, 0xff, 0xc1, 0x00, 0x33, 0x02, 0x94, 0x01, 0xe8, 0xff, 0xa3, 0xfe, 0x28, 0xff, 
-0x56, 0x00, 0x7d, 0x01, 0xb0, 0x00, 0x36, 0xff, 0x76, 0xfe, 0x80, 0xff, 0x2e, 0x01, 0x61, 0x00, 
-0x36, 0xff, 0x41, 0xfe, 0x44, 0x01, 0x5b, 0x01, 0x82, 0xff, 0xb4, 0xfe, 0xc3, 0xfd, 0xcb, 0xff, 
-0x0a, 0xff, 0xa2, 0xfd, 0xb2, 0xfe, 0x39, 0xff, 0x56, 0xfd, 0x86, 0xfc, 0x90, 0xfc, 0x37, 0xfd, 
-0xe6, 0xfe, 0x70, 0xfe, 0x26, 0xfe, 0xda, 0xfe, 0x2f, 0x00, 0x90, 0x01, 0x44, 0x03, 0x20, 0x04, 
-0xee, 0x03, 0x4f, 0x04, 0xe0, 0x04, 0x43, 0x06, 0x5c, 0x07, 0xb5, 0x06, 0x26, 0x05, 0xdb, 0x04, 
-0x47, 0x05, 0x97, 0x03, 0x27, 0x02, 0x15, 0x02, 0x9b, 0x00, 0x0b, 0x00, 0xcd, 0xfe, 0xcb, 0xfd, 
-0x1f, 0xfe, 0x68, 0xfc, 0x93, 0xfa, 0x90, 0xf8, 0x0a, 0xf8, 0xa8, 0xf7, 0x2b, 0xf5, 0xb4, 0xf3, 
-0x1a, 0xf4, 0x18, 0xf5, 0x73, 0xf5, 0x59, 0xf6, 0x18, 0xf9, 0xc1, 0xfc, 0x4b, 0x00, 0xe5, 0x01, 
-0x60, 0x03, 0x66, 0x06, 0x7c, 0x0a, 0x94, 0x0d, 0xa2, 0x0c, 0x68, 0x0b, 0x7c, 0x0a, 0x6a, 0x0b, 
-0xd5, 0x0b, 0x3f, 0x09, 0x04, 0x05, 0x0c, 0x02, 0x66, 0x03, 0x5c, 0x03, 0x49, 0x01, 0x7e, 0xff, 
-0x54, 0x00, 0x02, 0x02, 0x5e, 0x02, 0xeb, 0x01, 0x25, 0x02, 0xb8, 0x01, 0x86, 0x00, 0x5c, 0xff, 
-0xcf, 0xfe, 0x8b, 0xfc, 0xdc, 0xf8, 0xb1, 0xf6, 0xbc, 0xf3, 0x10, 0xf1, 0xf4, 0xed, 0xfa, 0xed, 
-0xc9, 0xed, 0x66, 0xed, 0xda, 0xf0, 0xc1, 0xf5, 0xe0, 0xfa, 0xec, 0xfe, 0x87, 0x02, 0xd8, 0x06, 
-0xda, 0x0b, 0x0b, 0x0f, 0x44, 0x10, 0x49, 0x10, 0x30, 0x0f, 0xb3, 0x0d, 0xe8, 0x0b, 0x7c, 0x09, 
-0x7c, 0x05, 0xbc, 0x01, 0x71, 0xff, 0x3f, 0xfe, 0x7f, 0xfe, 0x07, 0xff, 0x77, 0x00, 0x36, 0x01, 
-0x78, 0x02, 0xa5, 0x05, 0x29, 0x08, 0xde, 0x08, 0x53, 0x08, 0x31, 0x07, 0x11, 0x05, 0x12, 0x04, 
-0x8e, 0x02, 0x5f, 0xfd, 0x83, 0xf8, 0xba, 0xf5, 0xaa, 0xf3, 0xad, 0xf1, 0x81, 0xee, 0xff, 0xea, 
-0xa8, 0xe8, 0xf0, 0xe7, 0x25, 0xeb, 0x7b, 0xf0, 0x14, 0xf5, 0x66, 0xf9, 0x98, 0xfd, 0x00, 0x04, 
-0x7a, 0x0a, 0xc2, 0x0e, 0x0f, 0x11, 0xd2, 0x10, 0xc4, 0x0f, 0xb5, 0x0f, 0xdf, 0x0e, 0x7d, 0x0b, 
-0xa0, 0x06, 0xb1, 0x02, 0x51, 0xff, 0x5b, 0xfd, 0x5c, 0xfd, 0x3b, 0xfc, 0xc2, 0xfb, 0xbf, 0xfd, 
-0xa7, 0x01, 0x3e, 0x05, 0xb3, 0x07, 0x31, 0x0a, 0xc7, 0x0b, 0x70, 0x0c, 0xec, 0x0b, 0xc0, 0x0a, 
-0x7f, 0x08, 0x3d, 0x04, 0x7f, 0x00, 0xde, 0xfc, 0x03, 0xf9, 0x8d, 0xf5, 0x18, 0xf2, 0x6d, 0xef, 
-0x1f, 0xee, 0x07, 0xeb, 0x8f, 0xe7, 0x7b, 0xe7, 0xe6, 0xe9, 0x20, 0xef, 0x3e, 0xf5, 0xa0, 0xfa, 
-0x9b, 0xfe, 0xba, 0x02, 0xc3, 0x08, 0xa3, 0x0e, 0xfb, 0x11, 0xd8, 0x11, 0x0b, 0x10, 0xe3, 0x0d, 
-0xb8, 0x0c, 0xf2, 0x0a, 0xe1, 0x06, 0xa3, 0x01, 0x0e, 0xfd, 0x55, 0xfb, 0xa1, 0xfb, 0x37, 0xfc, 
-0x09, 0xfc, 0xd5, 0xfc, 0x0b, 0x00, 0x56, 0x04, 0x14, 0x09, 0x45, 0x0c, 0x10, 0x0d, 0x21, 0x0d, 
-0x5f, 0x0c, 0x56, 0x0b, 0x08, 0x09, 0x9c, 0x05, 0x74, 0x00, 0x96, 0xfc, 0xb6, 0xfa, 0x01, 0xf7, 
-0x32, 0xf4, 0xea, 0xf1, 0xd4, 0xef, 0xe8, 0xec, 0x84, 0xe8, 0xa0, 0xe7, 0x10, 0xea, 0xc2, 0xed, 
-0xf0, 0xf2, 0x63, 0xf8, 0x25, 0xfd, 0x16, 0x01, 0x81, 0x06, 0x3d, 0x0c, 0xc6, 0x0f, 0x80, 0x11, 
-0x52, 0x11, 0x3e, 0x10, 0x9b, 0x0e, 0xa5, 0x0b, 0x0a, 0x08, 0xa5, 0x03, 0x76, 0xff, 0xc4, 0xfc, 
-0xf2, 0xfa, 0xfe, 0xf9, 0x12, 0xfa, 0x54, 0xfb, 0xb3, 0xfd, 0x9f, 0x01, 0x82, 0x06, 0x9a, 0x0a, 
-0x4d, 0x0d, 0xb8, 0x0e, 0x18, 0x0f, 0xf2, 0x0d, 0x4a, 0x0b, 0x48, 0x07, 0xb3, 0x02, 0xa0, 0xfe, 
-0x36, 0xfb, 0x12, 0xf8, 0x80, 0xf5, 0xce, 0xf3, 0x29, 0xf1, 0xe2, 0xed, 0x29, 0xeb, 0x43, 0xe8, 
-0x0d, 0xe7, 0x07, 0xea, 0x25, 0xf0, 0xe5, 0xf5, 0x6d, 0xfa, 0x1c, 0xff, 0x28, 0x04, 0x67, 0x09, 
-0x95, 0x0d, 0x48, 0x10, 0x20, 0x11, 0x09, 0x10, 0x58, 0x0e, 0x3b, 0x0c, 0x21, 0x09, 0x12, 0x05, 
-0x76, 0x00, 0x1c, 0xfd, 0xc3, 0xfb, 0x7b, 0xfb, 0x5b, 0xfb, 0x0d, 0xfb, 0x3b, 0xfc, 0xaf, 0xff, 
-0x5d, 0x04, 0x8b, 0x08, 0xf0, 0x0b, 0x7c, 0x0e, 0xb8, 0x0f, 0x50, 0x0f, 0x9a, 0x0d, 0xbc, 0x0a, 
-0xd8, 0x05, 0xbf, 0x00, 0x5c, 0xfd, 0x90, 0xfa, 0x69, 0xf7, 0x33, 0xf5, 0x12, 0xf4, 0x40, 0xf2, 
-0xfb, 0xef, 0x9f, 0xec, 0x50, 0xe8, 0xdc, 0xe6, 0x68, 0xe9, 0x95, 0xef, 0x96, 0xf6, 0xa1, 0xfb, 
-0x02, 0xff, 0xd5, 0x02, 0x97, 0x08, 0xd0, 0x0d, 0xb1, 0x10, 0x07, 0x11, 0x97, 0x0f, 0xa7, 0x0d, 
-0x98, 0x0b, 0x4c, 0x09, 0x48, 0x05, 0xc5, 0xff, 0xa2, 0xfb, 0x98, 0xfa, 0xdd, 0xfa, 0xde, 0xfa, 
-0xd4, 0xfa, 0xf0, 0xfb, 0xb4, 0xff, 0x7a, 0x04, 0xe5, 0x08, 0x9e, 0x0c, 0x4b, 0x0f, 0x94, 0x10, 
-0x30, 0x10, 0x62, 0x0e, 0x09, 0x0b, 0x7f, 0x06, 0xd0, 0x01, 0x29, 0xfe, 0xd9, 0xfa, 0x3b, 0xf7, 
-0xa6, 0xf4, 0x6d, 0xf3, 0xb5, 0xf2, 0xc1, 0xf0, 0xd4, 0xec, 0x97, 0xe7, 0xb2, 0xe4, 0xce, 0xe7, 
-0xb2, 0xef, 0x47, 0xf7, 0x61, 0xfb, 0x5a, 0xfe, 0x2e, 0x03, 0xd5, 0x09, 0x67, 0x0f, 0xec, 0x11, 
-0x21, 0x11, 0x0e, 0x0f, 0xf1, 0x0d, 0x6c, 0x0c, 0xfa, 0x08, 0x9b, 0x03, 0x3b, 0xfe, 0x84, 0xfb, 
-0x2b, 0xfb, 0x48, 0xfb, 0xbb, 0xfa, 0xae, 0xfa, 0x9c, 0xfc, 0x58, 0x00, 0xf7, 0x04, 0xa2, 0x08, 
-0xb0, 0x0b, 0x0d, 0x0f, 0xd0, 0x10, 0xb7, 0x0f, 0x1c, 0x0d, 0xcd, 0x09, 0x98, 0x05, 0xde, 0x01, 
-0xe4, 0xfe, 0x0a, 0xfb, 0xd2, 0xf6, 0xf7, 0xf4, 0x2c, 0xf5, 0x4e, 0xf4, 0x7e, 0xf1, 0x40, 0xed, 
-0x46, 0xe8, 0x3d, 0xe5, 0x55, 0xe7, 0x87, 0xee, 0xd4, 0xf5, 0x56, 0xfa, 0x35, 0xfe, 0x1a, 0x04, 
-0x65, 0x0b, 0xc0, 0x10, 0x83, 0x12, 0x8e, 0x11, 0x87, 0x0f, 0xb8, 0x0d, 0xfb, 0x0b, 0xa3, 0x07, 
-0xe8, 0x00, 0xe9, 0xfb, 0x86, 0xfa, 0xe8, 0xfa, 0xc3, 0xfa, 0x1d, 0xfa, 0xb0, 0xfa, 0xfe, 0xfd, 
-0xf2, 0x02, 0x45, 0x07, 0x51, 0x09, 0xf3, 0x0a, 0x8a, 0x0e, 0x3f, 0x11, 0x28, 0x10, 0xc8, 0x0c, 
-0x4f, 0x09, 0xd1, 0x05, 0x10, 0x02, 0x6c, 0xfe, 0x0b, 0xfb, 0xd9, 0xf7, 0xe5, 0xf5, 0x09, 0xf6, 
-0x7c, 0xf6, 0xca, 0xf4, 0xc6, 0xf1, 0x67, 0xed, 0xe6, 0xe7, 0x42, 0xe6, 0x10, 0xeb, 0x80, 0xf2, 
-0xcb, 0xf7, 0xb1, 0xfb, 0x23, 0x01, 0x0a, 0x08, 0xb9, 0x0d, 0x48, 0x10, 0x33, 0x10, 0x22, 0x0f, 
-0x1e, 0x0e, 0x37, 0x0c, 0x43, 0x08, 0x81, 0x02, 0x60, 0xfd, 0xf8, 0xfa, 0x6b, 0xfa, 0xdd, 0xf9, 
-0x2d, 0xf9, 0xa8, 0xf9, 0x9e, 0xfc, 0xfc, 0x01, 0x2f, 0x07, 0xb8, 0x09, 0xf0, 0x0a, 0xa0, 0x0d, 
-0x83, 0x11, 0x62, 0x12, 0x5a, 0x0e, 0x75, 0x09, 0x96, 0x06, 0x3f, 0x04, 0x95, 0x00, 0x50, 0xfc, 
-0xd6, 0xf8, 0xa6, 0xf6, 0x33, 0xf6, 0x95, 0xf6, 0xf5, 0xf5, 0xb2, 0xf3, 0xdd, 0xef, 0x93, 0xea, 
-0xf9, 0xe5, 0xbd, 0xe6, 0xf2, 0xed, 0xb8, 0xf5, 0xad, 0xf9, 0xb5, 0xfc, 0x30, 0x03, 0x4a, 0x0b, 
-0x93, 0x10, 0x06, 0x12, 0x0a, 0x11, 0x9d, 0x0f, 0xcb, 0x0e, 0xf0, 0x0c, 0xb0, 0x07, 0x45, 0x01, 
-0x79, 0xfd, 0x23, 0xfc, 0xcb, 0xfa, 0x86, 0xf9, 0x8d, 0xf9, 0xe4, 0xfa, 0xc5, 0xfd, 0xc8, 0x01, 
-0x7c, 0x05, 0xcf, 0x07, 0x16, 0x0a, 0x7a, 0x0c, 0x0f, 0x0d, 0xe4, 0x0b, 0x34, 0x0a, 0x5b, 0x08, 
-0x1f, 0x06, 0x82, 0x03, 0x2a, 0x01, 0x0a, 0xff, 0xc4, 0xfc, 0x20, 0xfb, 0x87, 0xfa, 0x81, 0xf9, 
-0xc8, 0xf7, 0xa1, 0xf5, 0x14, 0xf2, 0x9a, 0xed, 0xe7, 0xe9, 0x28, 0xe7, 0x17, 0xe6, 0x37, 0xea, 
-0xeb, 0xf1, 0x73, 0xf7, 0x14, 0xfb, 0xcb, 0x01, 0xd9, 0x0b, 0x01, 0x14, 0xe3, 0x16, 0x0e, 0x16, 
-0x4e, 0x14, 0xea, 0x12, 0xdb, 0x0f, 0x7c, 0x09, 0x5f, 0x02, 0xe8, 0xfd, 0x6e, 0xfb, 0xcd, 0xf8, 
-0x4c, 0xf7, 0x59, 0xf8, 0x73, 0xfb, 0x70, 0xff, 0x7c, 0x03, 0x63, 0x06, 0x0b, 0x09, 0xeb, 0x0b, 
-0xa8, 0x0d, 0x8c, 0x0c, 0x73, 0x09, 0x7a, 0x07, 0xf4, 0x05, 0xa2, 0x03, 0x6f, 0x00, 0x38, 0xfd, 
-0xb8, 0xfb, 0xe1, 0xfb, 0x6c, 0xfb, 0x56, 0xf9, 0x35, 0xf7, 0xdc, 0xf5, 0x34, 0xf3, 0x53, 0xee, 
-0x09, 0xea, 0xa0, 0xe7, 0x31, 0xe7, 0xf7, 0xea, 0xb9, 0xf1, 0x8b, 0xf6, 0x15, 0xfa, 0x92, 0x01, 
-0xa0, 0x0b, 0x43, 0x12, 0x30, 0x14, 0x79, 0x14, 0x14, 0x15, 0xed, 0x13, 0x66, 0x0f, 0xdf, 0x08, 
-0x98, 0x03, 0x75, 0x00, 0xb5, 0xfc, 0x3a, 0xf8, 0x41, 0xf6, 0x2f, 0xf8, 0x9e, 0xfb, 0x60, 0xfe, 
-0x94, 0x01, 0x03, 0x06, 0x55, 0x0a, 0xf1, 0x0c, 0xe8, 0x0c, 0xbd, 0x0b, 0x38, 0x0b, 0xba, 0x09, 
-0x21, 0x06, 0x9c, 0x02, 0x73, 0x00, 0x9b, 0xfe, 0x93, 0xfc, 0xe8, 0xfa, 0xec, 0xf9, 0xaf, 0xf9, 
-0x5b, 0xf9, 0x05, 0xf7, 0x96, 0xf3, 0x47, 0xf0, 0x5a, 0xec, 0x02, 0xe9, 0x62, 0xe7, 0xf0, 0xe8, 
-0x50, 0xee, 0x3f, 0xf4, 0xcb, 0xf8, 0xdc, 0xfe, 0x19, 0x07, 0xcd, 0x0d, 0x86, 0x11, 0xc6, 0x14, 
-0x5c, 0x17, 0xca, 0x15, 0xfb, 0x10, 0x12, 0x0c, 0xc6, 0x07, 0x6f, 0x03, 0xa4, 0xfd, 0xc2, 0xf8, 
-0x19, 0xf8, 0x44, 0xf9, 0x32, 0xf9, 0x94, 0xfa, 0x7a, 0xff, 0xf4, 0x03, 0xd7, 0x06, 0xc4, 0x09, 
-0x2c, 0x0c, 0xce, 0x0c, 0x00, 0x0c, 0x20, 0x0a, 0x9d, 0x08, 0x13, 0x07, 0xc3, 0x03, 0x27, 0x01, 
-0x1d, 0x00, 0xe0, 0xfd, 0x74, 0xfb, 0xc2, 0xfb, 0x70, 0xfb, 0xde, 0xf8, 0x38, 0xf7, 0x16, 0xf5, 
-0x7d, 0xf0, 0xa8, 0xeb, 0x4f, 0xe8, 0xdc, 0xe5, 0xfa, 0xe5, 0xac, 0xea, 0xc0, 0xef, 0x94, 0xf3, 
-0x46, 0xfa, 0x9f, 0x03, 0x18, 0x0b, 0xd2, 0x0f, 0x4a, 0x14, 0x7a, 0x17, 0x44, 0x17, 0x29, 0x15, 
-0x29, 0x11, 0x0f, 0x0c, 0x9c, 0x07, 0x86, 0x01, 0xf1, 0xfb, 0x42, 0xfa, 0xee, 0xf8, 0x02, 0xf8, 
-0x79, 0xfa, 0x83, 0xfd, 0xae, 0xff, 0xec, 0x03, 0x67, 0x08, 0xd7, 0x09, 0x71, 0x0b, 0xc0, 0x0c, 
-0x58, 0x0b, 0x10, 0x0a, 0x85, 0x08, 0x28, 0x05, 0x82, 0x02, 0xf2, 0x00, 0xce, 0xfe, 0xbd, 0xfc, 
-0xe2, 0xfb, 0x48, 0xfb, 0x2b, 0xfa, 0x9d, 0xf8, 0xd1, 0xf6, 0x18, 0xf4, 0x37, 0xf0, 0x3f, 0xed, 
-0xbd, 0xea, 0x1a, 0xe7, 0x23, 0xe7, 0x60, 0xec, 0x03, 0xf0, 0x3f, 0xf3, 0x5c, 0xfb, 0xeb, 0x03, 
-0x99, 0x08, 0x52, 0x0e, 0xf6, 0x14, 0xee, 0x16, 0x15, 0x16, 0x07, 0x15, 0xfb, 0x11, 0x8a, 0x0d, 
-0x64, 0x08, 0xaa, 0x02, 0x53, 0xfe, 0x5b, 0xfb, 0xab, 0xf8, 0x3e, 0xf8, 0x93, 0xf9, 0x9e, 0xfa, 
-0xbe, 0xfd, 0xa9, 0x02, 0x9b, 0x05, 0xde, 0x07, 0xe5, 0x0a, 0xf9, 0x0b, 0x9e, 0x0b, 0x06, 0x0b, 
-0x28, 0x09, 0xe1, 0x06, 0xba, 0x04, 0x3b, 0x02, 0xd6, 0xff, 0xe6, 0xfd, 0xed, 0xfc, 0xce, 0xfb, 
-0x7b, 0xfa, 0x81, 0xf9, 0xb5, 0xf7, 0x12, 0xf5, 0x44, 0xf2, 0x4c, 0xee, 0xc8, 0xea, 0x7b, 0xe8, 
-0xe9, 0xe5, 0x1a, 0xe8, 0x08, 0xee, 0xb2, 0xef, 0x44, 0xf4, 0x98, 0xfe, 0x2e, 0x04, 0x05, 0x0a, 
-0x64, 0x12, 0x56, 0x14, 0x8f, 0x15, 0x3a, 0x18, 0x3b, 0x15, 0x8d, 0x11, 0x2d, 0x0f, 0x0c, 0x09, 
-0xfc, 0x03, 0x34, 0x01, 0x57, 0xfc, 0x28, 0xfa, 0x26, 0xfa, 0x76, 0xf9, 0xf6, 0xfb, 0xf7, 0xfe, 
-0x06, 0x01, 0x20, 0x05, 0x0c, 0x08, 0x81, 0x09, 0x74, 0x0b, 0x54, 0x0b, 0x9c, 0x0a, 0x4c, 0x0a, 
-0x9c, 0x07, 0xf5, 0x04, 0x76, 0x03, 0x5c, 0x00, 0x3c, 0xfe, 0x1b, 0xfd, 0x08, 0xfb, 0xc1, 0xf9, 
-0x1f, 0xf8, 0xf3, 0xf5, 0xe1, 0xf3, 0x9a, 0xf0, 0xe1, 0xec, 0x62, 0xe9, 0x9f, 0xe6, 0xbd, 0xe5, 
-0x0d, 0xe8, 0x8e, 0xeb, 0x92, 0xee, 0x42, 0xf5, 0xc3, 0xfd, 0x2d, 0x03, 0x52, 0x0a, 0xcd, 0x11, 
-0xcc, 0x14, 0x8e, 0x17, 0x52, 0x19, 0x04, 0x17, 0xe4, 0x13, 0x95, 0x10, 0xa6, 0x0b, 0x5e, 0x06, 
-0xed, 0x01, 0x1d, 0xfe, 0x88, 0xfa, 0xfe, 0xf8, 0x1b, 0xf9, 0x69, 0xf9, 0x8b, 0xfb, 0xf5, 0xfe, 
-0x3c, 0x02, 0x31, 0x05, 0xc9, 0x07, 0xb8, 0x0a, 0x8a, 0x0b, 0xcb, 0x0a, 0x62, 0x0b, 0x33, 0x09, 
-0x24, 0x06, 0xf8, 0x04, 0xbd, 0x00, 0x3e, 0xfe, 0x7e, 0xfd, 0x20, 0xf9, 0x47, 0xf8, 0xed, 0xf7, 
-0xe9, 0xf3, 0x63, 0xf3, 0xe3, 0xf1, 0x15, 0xee, 0x93, 0xec, 0xb0, 0xe9, 0x0b, 0xe8, 0xc9, 0xe9, 
-0xc0, 0xeb, 0x10, 0xef, 0xb6, 0xf3, 0x0b, 0xf9, 0xb8, 0xff, 0x53, 0x06, 0x74, 0x0c, 0x03, 0x12, 
-0x89, 0x15, 0x52, 0x18, 0x1b, 0x19, 0xdb, 0x16, 0xf3, 0x14, 0xe0, 0x10, 0x14, 0x0b, 0x7a, 0x07, 
-0x25, 0x02, 0xfc, 0xfc, 0x79, 0xfb, 0xa6, 0xf8, 0x9f, 0xf6, 0x80, 0xf9, 0x81, 0xfb, 0xa6, 0xfc, 
-0x99, 0x01, 0x9d, 0x04, 0x6f, 0x06, 0xb8, 0x0a, 0xe7, 0x0a, 0x0a, 0x0b, 0xb4, 0x0b, 0xdb, 0x08, 
-0xd6, 0x07, 0xf8, 0x04, 0x2d, 0x01, 0x06, 0x00, 0xc4, 0xfb, 0x07, 0xf9, 0x72, 0xf8, 0x80, 0xf4, 
-0x46, 0xf3, 0xd4, 0xf2, 0x16, 0xef, 0x8c, 0xee, 0xf1, 0xec, 0xa1, 0xe8, 0xf4, 0xe9, 0x46, 0xea, 
-0x2c, 0xea, 0x49, 0xf0, 0x19, 0xf3, 0xd7, 0xf7, 0x59, 0x00, 0x11, 0x04, 0xe8, 0x0a, 0xad, 0x11, 
-0xe4, 0x13, 0x4b, 0x18, 0xfc, 0x19, 0x34, 0x18, 0x67, 0x17, 0xca, 0x12, 0xe1, 0x0d, 0x98, 0x0a, 
-0xe0, 0x03, 0xb0, 0xff, 0x0a, 0xfd, 0x77, 0xf8, 0x27, 0xf8, 0xb6, 0xf8, 0x66, 0xf8, 0x2a, 0xfc, 
-0x0c, 0xff, 0x74, 0x01, 0xec, 0x05, 0x97, 0x08, 0x82, 0x0a, 0x22, 0x0c, 0x95, 0x0b, 0x61, 0x0a, 
-0x89, 0x09, 0x87, 0x05, 0x49, 0x02, 0x4d, 0x00, 0x7f, 0xfb, 0x45, 0xf9, 0x85, 0xf7, 0xdc, 0xf4, 
-0x55, 0xf4, 0x4b, 0xf3, 0xc3, 0xf1, 0x09, 0xf1, 0xab, 0xef, 0x00, 0xed, 0x81, 0xeb, 0x9c, 0xeb, 
-0x4d, 0xeb, 0xd7, 0xed, 0x3a, 0xf1, 0x1c, 0xf4, 0xb0, 0xfa, 0x67, 0xff, 0x57, 0x05, 0xdd, 0x0c, 
-0x54, 0x10, 0x6a, 0x15, 0xe3, 0x18, 0x57, 0x18, 0x9a, 0x18, 0xb9, 0x16, 0x53, 0x11, 0xf2, 0x0d, 
-0x66, 0x09, 0xf9, 0x02, 0x1a, 0x00, 0xbf, 0xfb, 0x24, 0xf8, 0x68, 0xf8, 0x72, 0xf7, 0xf3, 0xf8, 
-0xed, 0xfb, 0x8e, 0xfd, 0xb7, 0x01, 0x7b, 0x04, 0x3d, 0x07, 0x6e, 0x09, 0xbc, 0x09, 0xab, 0x0a, 
-0x90, 0x08, 0x0f, 0x08, 0xb6, 0x05, 0xce, 0x01, 0xf6, 0x00, 0x4e, 0xfc, 0x3e, 0xfa, 0xb6, 0xf9, 
-0x2d, 0xf5, 0xeb, 0xf5, 0x29, 0xf5, 0xcb, 0xf1, 0xb0, 0xf3, 0x83, 0xf0, 0x3c, 0xee, 0x18, 0xef, 
-0x9b, 0xeb, 0x9d, 0xec, 0x02, 0xef, 0x8f, 0xef, 0x67, 0xf4, 0xf1, 0xf8, 0x9f, 0xfd, 0x9b, 0x04, 
-0xc8, 0x09, 0x9c, 0x0f, 0xd6, 0x13, 0xd4, 0x16, 0xea, 0x18, 0xbe, 0x17, 0xe8, 0x16, 0x23, 0x13, 
-0x1b, 0x0f, 0xb0, 0x0b, 0x55, 0x06, 0x1f, 0x02, 0x44, 0xfe, 0x3f, 0xfb, 0xd4, 0xf8, 0x02, 0xf8, 
-0x07, 0xf9, 0x7a, 0xf9, 0x11, 0xfc, 0x2c, 0xff, 0x1a, 0x01, 0x97, 0x04, 0x81, 0x06, 0x62, 0x08, 
-0x6c, 0x08, 0x31, 0x08, 0xa7, 0x08, 0x86, 0x04, 0x26, 0x05, 0x1c, 0x02, 0xe8, 0xfc, 0x31, 0xff, 
-0xa2, 0xf9, 0x1c, 0xf7, 0x63, 0xf9, 0x4b, 0xf3, 0x40, 0xf4, 0x9a, 0xf4, 0xd1, 0xef, 0xf8, 0xf1, 
-0xa8, 0xee, 0xfc, 0xec, 0xd5, 0xee, 0x8a, 0xec, 0x23, 0xf1, 0x92, 0xf3, 0x3a, 0xf5, 0xd3, 0xfd, 
-0x40, 0x00, 0x08, 0x05, 0x8c, 0x0e, 0xab, 0x0e, 0xc3, 0x13, 0x2d, 0x19, 0xbd, 0x14, 0x65, 0x17, 
-0x14, 0x16, 0xf2, 0x0e, 0xfb, 0x0e, 0x6a, 0x09, 0x38, 0x03, 0x1b, 0x02, 0x14, 0xfc, 0xde, 0xf9, 
-0x3f, 0xf9, 0x6e, 0xf6, 0xe0, 0xf8, 0xb9, 0xf9, 0x26, 0xfb, 0x02, 0xff, 0x98, 0x00, 0x36, 0x03, 
-0xc6, 0x05, 0xca, 0x06, 0x79, 0x07, 0x9a, 0x07, 0x01, 0x07, 0x62, 0x05, 0xad, 0x03, 0x4d, 0x02, 
-0x0f, 0xff, 0x53, 0xfd, 0x17, 0xfc, 0x9c, 0xf8, 0x4d, 0xf8, 0xb0, 0xf6, 0x15, 0xf4, 0x02, 0xf5, 
-0xbd, 0xf2, 0x30, 0xf1, 0x0a, 0xf1, 0x2e, 0xee, 0x79, 0xef, 0xc3, 0xef, 0xe0, 0xf0, 0x29, 0xf5, 
-0x4c, 0xf7, 0x09, 0xfd, 0x03, 0x02, 0xd7, 0x06, 0x01, 0x0d, 0x6f, 0x10, 0x93, 0x14, 0xda, 0x16, 
-0xc9, 0x16, 0x01, 0x17, 0x4a, 0x14, 0x14, 0x11, 0x07, 0x0e, 0xc3, 0x08, 0x0e, 0x05, 0x1e, 0x01, 
-0xd1, 0xfc, 0xbc, 0xfa, 0xb0, 0xf8, 0xb9, 0xf7, 0xeb, 0xf7, 0x93, 0xf8, 0xbf, 0xfa, 0x52, 0xfc, 
-0x84, 0xfe, 0x5d, 0x01, 0x06, 0x02, 0xa1, 0x04, 0x96, 0x05, 0x65, 0x04, 0x3c, 0x06, 0xc3, 0x03, 
-0x84, 0x02, 0x5c, 0x02, 0x3c, 0xfe, 0x31, 0xfe, 0x41, 0xfc, 0x34, 0xf9, 0xe2, 0xf9, 0xc7, 0xf7, 
-0xaa, 0xf6, 0xfc, 0xf6, 0x73, 0xf5, 0xab, 0xf4, 0xaf, 0xf3, 0x20, 0xf2, 0x59, 0xf0, 0xac, 0xf1, 
-0x38, 0xf2, 0x73, 0xf2, 0x0b, 0xf7, 0xbe, 0xf9, 0xfc, 0xfc, 0xd3, 0x03, 0x4e, 0x07, 0x54, 0x0b, 
-0xa0, 0x11, 0x6e, 0x12, 0xa7, 0x14, 0xc0, 0x16, 0x53, 0x13, 0xb2, 0x12, 0x6a, 0x10, 0x6c, 0x0a, 
-0xbe, 0x08, 0xdd, 0x03, 0xdd, 0xfe, 0x14, 0xfe, 0x7e, 0xf9, 0x4d, 0xf8, 0x30, 0xf9, 0x45, 0xf7, 
-0xa6, 0xf9, 0xd6, 0xfb, 0xf3, 0xfb, 0x89, 0xff, 0x5a, 0x01, 0x19, 0x02, 0xd1, 0x04, 0xa7, 0x04, 
-0xb5, 0x04, 0x87, 0x05, 0x9a, 0x03, 0x71, 0x03, 0xcc, 0x01, 0x54, 0xff, 0x1d, 0xff, 0x5e, 0xfc, 
-0x12, 0xfb, 0x42, 0xfa, 0x24, 0xf8, 0x83, 0xf7, 0x18, 0xf6, 0xcb, 0xf5, 0x1a, 0xf4, 0xe5, 0xf2, 
-0xdd, 0xf2, 0x87, 0xef, 0xf7, 0xf2, 0x6e, 0xf4, 0x4a, 0xf3, 0x11, 0xfb, 0x04, 0xfc, 0x1c, 0xff, 
-0x42, 0x08, 0xa7, 0x07, 0x67, 0x0d, 0xce, 0x12, 0x65, 0x10, 0xfa, 0x14, 0x25, 0x14, 0x5c, 0x10, 
-0x8e, 0x11, 0x56, 0x0c, 0x01, 0x09, 0x4e, 0x07, 0x29, 0x01, 0x93, 0xff, 0x05, 0xfd, 0x79, 0xf9, 
-0x02, 0xfa, 0x29, 0xf9, 0xb1, 0xf8, 0x20, 0xfc, 0x45, 0xfc, 0x94, 0xfe, 0x6e, 0x02, 0x07, 0x02, 
-0xdc, 0x05, 0xa6, 0x06, 0x52, 0x06, 0x1b, 0x08, 0xe3, 0x05, 0x32, 0x04, 0x33, 0x03, 0x16, 0xff, 
-0xac, 0xfc, 0xb6, 0xfa, 0x7c, 0xf6, 0xc9, 0xf5, 0x88, 0xf3, 0xec, 0xf1, 0x74, 0xf2, 0xf9, 0xf0, 
-0x5e, 0xf1, 0x14, 0xf1, 0xb6, 0xf0, 0xd0, 0xf1, 0x60, 0xf2, 0xed, 0xf3, 0x85, 0xf6, 0xee, 0xf7, 
-0x55, 0xfb, 0x45, 0xff, 0xb1, 0x01, 0x7d, 0x07, 0xa9, 0x0a, 0xcd, 0x0d, 0x60, 0x12, 0x9d, 0x12, 
-0xbc, 0x14, 0xbd, 0x14, 0x5b, 0x12, 0x5a, 0x11, 0xc6, 0x0d, 0x06, 0x0a, 0xc4, 0x06, 0xea, 0x02, 
-0x41, 0xff, 0x07, 0xfd, 0x31, 0xfb, 0x7a, 0xf9, 0xb9, 0xf9, 0xea, 0xfa, 0xdb, 0xfa, 0x11, 0xfe, 
-0x51, 0x00, 0x51, 0x00, 0x91, 0x05, 0x97, 0x04, 0xf5, 0x05, 0x92, 0x08, 0xee, 0x04, 0xfa, 0x06, 
-0x0b, 0x04, 0x4e, 0x01, 0xd5, 0x00, 0xd8, 0xfb, 0xd7, 0xfa, 0x35, 0xf8, 0xb2, 0xf4, 0xbd, 0xf4, 
-0x5d, 0xf2, 0xed, 0xf1, 0x30, 0xf2, 0x37, 0xf1, 0x9d, 0xf1, 0x2c, 0xf1, 0x64, 0xf2, 0xd4, 0xf1, 
-0x71, 0xf4, 0x99, 0xf6, 0x83, 0xf6, 0xb9, 0xfc, 0x58, 0xfd, 0xb7, 0x00, 0xbc, 0x06, 0xeb, 0x06, 
-0x9b, 0x0c, 0x7a, 0x0f, 0x23, 0x10, 0x65, 0x13, 0x70, 0x12, 0x55, 0x11, 0x8d, 0x10, 0x7a, 0x0d, 
-0xae, 0x0a, 0x0f, 0x08, 0xfd, 0x03, 0x86, 0x01, 0x16, 0xff, 0xbc, 0xfc, 0x32, 0xfc, 0x4a, 0xfb, 
-0x98, 0xfb, 0xb2, 0xfc, 0x79, 0xfe, 0xc7, 0xff, 0x56, 0x02, 0xee, 0x03, 0x7d, 0x04, 0x07, 0x07, 
-0x71, 0x06, 0x8d, 0x06, 0xb4, 0x06, 0x3e, 0x04, 0x33, 0x03, 0x21, 0x01, 0xa3, 0xfd, 0x0d, 0xfc, 
-0xe4, 0xf8, 0x40, 0xf6, 0x55, 0xf5, 0x8c, 0xf2, 0x13, 0xf3, 0xcc, 0xf1, 0x17, 0xf1, 0x91, 0xf2, 
-0x5d, 0xf0, 0x44, 0xf2, 0x41, 0xf2, 0x57, 0xf2, 0xa7, 0xf5, 0xe2, 0xf5, 0x80, 0xf9, 0x39, 0xfc, 
-0xf8, 0xfe, 0x57, 0x03, 0x21, 0x06, 0x9b, 0x0a, 0x63, 0x0d, 0x09, 0x10, 0x16, 0x12, 0x94, 0x12, 
-0x8c, 0x12, 0x2e, 0x11, 0x47, 0x0f, 0x6a, 0x0c, 0x96, 0x09, 0x48, 0x06, 0x00, 0x03, 0x57, 0x00, 
-0x18, 0xfe, 0x48, 0xfc, 0x76, 0xfb, 0xf8, 0xfa, 0x5a, 0xfc, 0x33, 0xfd, 0x98, 0xfe, 0x3a, 0x02, 
-0x9b, 0x01, 0x68, 0x05, 0x76, 0x06, 0x7c, 0x05, 0x29, 0x09, 0x7e, 0x05, 0x3e, 0x06, 0x06, 0x05, 
-0xe1, 0x00, 0xf4, 0x00, 0x48, 0xfc, 0x9a, 0xfa, 0xd8, 0xf7, 0x5b, 0xf5, 0x79, 0xf4, 0x0e, 0xf2, 
-0x63, 0xf2, 0x45, 0xf1, 0xc1, 0xf1, 0x1c, 0xf2, 0xa8, 0xf1, 0x92, 0xf2, 0x37, 0xf2, 0x52, 0xf4, 
-0x47, 0xf6, 0xee, 0xf6, 0x2c, 0xfb, 0xf8, 0xfc, 0x2c, 0xff, 0xc2, 0x04, 0x69, 0x05, 0xe0, 0x09, 
-0xab, 0x0d, 0x8c, 0x0d, 0xac, 0x11, 0x12, 0x11, 0xd1, 0x10, 0x01, 0x11, 0xf1, 0x0d, 0xe8, 0x0c, 
-0x11, 0x0a, 0x14, 0x07, 0x08, 0x05, 0xc5, 0x01, 0xd6, 0xff, 0x81, 0xfe, 0x56, 0xfc, 0x19, 0xfd, 
-0x8b, 0xfc, 0x2e, 0xfd, 0x0b, 0x00, 0x38, 0xff, 0x45, 0x03, 0xf1, 0x03, 0x28, 0x04, 0xd7, 0x07, 
-0x50, 0x05, 0x45, 0x07, 0xee, 0x05, 0x64, 0x03, 0xa8, 0x03, 0x3f, 0xff, 0x32, 0xfe, 0x29, 0xfb, 
-0xe9, 0xf7, 0x7f, 0xf6, 0xf0, 0xf3, 0x5d, 0xf3, 0x08, 0xf2, 0x8a, 0xf1, 0xb1, 0xf1, 0x2b, 0xf1, 
-0x34, 0xf1, 0xe9, 0xf1, 0x73, 0xf2, 0xd1, 0xf3, 0xdb, 0xf5, 0x91, 0xf7, 0x10, 0xfa, 0xa7, 0xfc, 
-0xf9, 0xff, 0xe2, 0x02, 0x95, 0x06, 0xc6, 0x09, 0x07, 0x0c, 0x13, 0x0f, 0xf5, 0x0f, 0x8a, 0x11, 
-0x64, 0x11, 0x23, 0x10, 0x66, 0x0f, 0x8b, 0x0c, 0x6e, 0x0a, 0x43, 0x07, 0x45, 0x04, 0x2c, 0x02, 
-0x23, 0xff, 0xd8, 0xfd, 0x95, 0xfc, 0x0f, 0xfb, 0x2c, 0xfd, 0x9d, 0xfc, 0xb0, 0xfd, 0x63, 0x01, 
-0xe7, 0xff, 0xf4, 0x03, 0xa1, 0x04, 0x1f, 0x04, 0x48, 0x07, 0x11, 0x04, 0x54, 0x05, 0x5a, 0x03, 
-0xe7, 0x00, 0x6b, 0x00, 0x0f, 0xfc, 0x9d, 0xfb, 0xec, 0xf7, 0x74, 0xf6, 0xae, 0xf5, 0xbf, 0xf2, 
-0x1a, 0xf3, 0xb7, 0xf1, 0x5d, 0xf1, 0x9b, 0xf1, 0xc0, 0xf1, 0xd2, 0xf1, 0xfc, 0xf2, 0x08, 0xf4, 
-0x8b, 0xf5, 0xee, 0xf8, 0x54, 0xfa, 0x63, 0xfe, 0x9e, 0x01, 0x2f, 0x04, 0xab, 0x08, 0x12, 0x0b, 
-0xf7, 0x0d, 0x77, 0x10, 0x70, 0x11, 0x22, 0x12, 0x25, 0x12, 0x71, 0x10, 0x37, 0x0f, 0xaf, 0x0c, 
-0x83, 0x09, 0x54, 0x07, 0x94, 0x03, 0x4b, 0x01, 0xe0, 0xfe, 0x02, 0xfd, 0x12, 0xfc, 0x80, 0xfb, 
-0x4c, 0xfb, 0x6f, 0xfc, 0x6e, 0xfe, 0x80, 0xfe, 0x3f, 0x02, 0x92, 0x02, 0x1e, 0x04, 0xe6, 0x06, 
-0xbb, 0x04, 0x73, 0x07, 0xbd, 0x04, 0xd8, 0x03, 0x3b, 0x03, 0x3f, 0xfe, 0xa6, 0xfe, 0xd0, 0xf9, 
-0xa2, 0xf7, 0x54, 0xf6, 0x28, 0xf3, 0xd9, 0xf2, 0x88, 0xf1, 0x7c, 0xf1, 0xad, 0xf0, 0xad, 0xf2, 
-0x70, 0xf1, 0x42, 0xf2, 0xe0, 0xf4, 0xd7, 0xf2, 0x32, 0xf8, 0x77, 0xf8, 0x38, 0xfa, 0xfb, 0xff, 
-0x48, 0xff, 0x22, 0x05, 0xfa, 0x07, 0x8d, 0x09, 0x9e, 0x0e, 0xcd, 0x0e, 0x15, 0x11, 0xf7, 0x11, 
-0xd8, 0x10, 0xc8, 0x10, 0x0e, 0x0e, 0x0e, 0x0c, 0x89, 0x09, 0xfe, 0x05, 0x9e, 0x03, 0xf6, 0x00, 
-0x24, 0xfe, 0x15, 0xfd, 0xdd, 0xfb, 0x6c, 0xfa, 0x71, 0xfc, 0xb0, 0xfb, 0xeb, 0xfc, 0x6e, 0x00, 
-0xfb, 0xfe, 0x10, 0x03, 0x12, 0x04, 0x3a, 0x03, 0x00, 0x07, 0x79, 0x04, 0x56, 0x05, 0xfa, 0x04, 
-0xb0, 0x01, 0xee, 0x01, 0x14, 0xfe, 0x37, 0xfc, 0x84, 0xfa, 0x06, 0xf7, 0x9a, 0xf6, 0x90, 0xf4, 
-0xe3, 0xf2, 0xc1, 0xf3, 0xed, 0xf1, 0x98, 0xf2, 0xb5, 0xf3, 0x7b, 0xf1, 0xb6, 0xf4, 0xe9, 0xf3, 
-0xd0, 0xf4, 0x79, 0xf9, 0x8d, 0xf7, 0x17, 0xfd, 0x57, 0xff, 0x71, 0x00, 0x2a, 0x07, 0x02, 0x07, 
-0x5f, 0x0b, 0x52, 0x0e, 0x7c, 0x0e, 0xa2, 0x11, 0x77, 0x10, 0x82, 0x10, 0xa6, 0x0f, 0xdb, 0x0c, 
-0x43, 0x0b, 0x39, 0x08, 0x26, 0x05, 0xc8, 0x02, 0xfe, 0xff, 0xf5, 0xfd, 0x9b, 0xfc, 0x79, 0xfb, 
-0x33, 0xfb, 0x0e, 0xfb, 0x85, 0xfc, 0x6e, 0xfd, 0xe7, 0xfe, 0x35, 0x01, 0x19, 0x02, 0x50, 0x04, 
-0xd1, 0x04, 0xe8, 0x05, 0xd4, 0x05, 0x0b, 0x05, 0x3f, 0x05, 0xe4, 0x01, 0x4a, 0x01, 0x79, 0xfe, 
-0x2a, 0xfb, 0x34, 0xfa, 0x52, 0xf6, 0x9d, 0xf5, 0xc8, 0xf3, 0xc2, 0xf2, 0xa2, 0xf2, 0xf2, 0xf1, 
-0xc5, 0xf2, 0x02, 0xf2, 0xc5, 0xf3, 0x60, 0xf3, 0x3f, 0xf5, 0x7d, 0xf7, 0x4e, 0xf7, 0x0c, 0xfc, 
-0xc0, 0xfc, 0x9b, 0xff, 0x12, 0x04, 0x1d, 0x05, 0x78, 0x09, 0x8d, 0x0b, 0x82, 0x0d, 0xb9, 0x0f, 
-0xea, 0x0f, 0x85, 0x10, 0x62, 0x0f, 0x27, 0x0e, 0x54, 0x0c, 0xb0, 0x09, 0x32, 0x07, 0xad, 0x04, 
-0xe2, 0x01, 0xe9, 0xff, 0x52, 0xfe, 0x86, 0xfc, 0xe0, 0xfc, 0x5b, 0xfc, 0xcb, 0xfc, 0xab, 0xfe, 
-0xe9, 0xfe, 0xec, 0x00, 0x7b, 0x02, 0xc5, 0x02, 0xc7, 0x04, 0xbc, 0x04, 0x75, 0x04, 0xea, 0x04, 
-0x5b, 0x03, 0x46, 0x02, 0xf2, 0x00, 0x42, 0xfe, 0x85, 0xfc, 0xa8, 0xfa, 0x32, 0xf8, 0x48, 0xf7, 
-0x87, 0xf5, 0xd0, 0xf4, 0x6e, 0xf4, 0xb4, 0xf3, 0x71, 0xf4, 0x00, 0xf4, 0x7a, 0xf4, 0xc5, 0xf4, 
-0xeb, 0xf4, 0x82, 0xf6, 0xf2, 0xf6, 0xf3, 0xf8, 0xdc, 0xfa, 0x65, 0xfc, 0xbe, 0xff, 0xd4, 0x01, 
-0x20, 0x05, 0xcd, 0x07, 0x41, 0x0a, 0xd5, 0x0c, 0xce, 0x0d, 0x4f, 0x0f, 0x5b, 0x0f, 0xae, 0x0e, 
-0xd0, 0x0d, 0x1a, 0x0c, 0x04, 0x0a, 0x85, 0x07, 0x3f, 0x05, 0xaf, 0x02, 0x68, 0x00, 0x0a, 0xff, 
-0x5b, 0xfd, 0x03, 0xfd, 0x77, 0xfc, 0xf2, 0xfc, 0xe2, 0xfd, 0x38, 0xfe, 0x57, 0x00, 0x03, 0x01, 
-0x05, 0x02, 0x64, 0x03, 0xf3, 0x03, 0x4d, 0x04, 0x3f, 0x04, 0xef, 0x03, 0x6c, 0x02, 0x82, 0x01, 
-0xce, 0xff, 0x3a, 0xfd, 0x2c, 0xfc, 0x52, 0xf9, 0xd8, 0xf7, 0xd2, 0xf6, 0xd0, 0xf4, 0xec, 0xf4, 
-0x09, 0xf4, 0x12, 0xf4, 0x5b, 0xf4, 0x6a, 0xf4, 0x83, 0xf4, 0x41, 0xf5, 0x7e, 0xf6, 0xdb, 0xf6, 
-0x72, 0xf9, 0x0c, 0xfb, 0x79, 0xfc, 0x5b, 0x00, 0xab, 0x01, 0xb3, 0x04, 0x62, 0x08, 0x42, 0x09, 
-0xa3, 0x0c, 0xe8, 0x0d, 0x4b, 0x0e, 0xa2, 0x0f, 0x45, 0x0e, 0x8b, 0x0d, 0x80, 0x0c, 0x98, 0x09, 
-0xb3, 0x07, 0x72, 0x05, 0xbb, 0x02, 0xa4, 0x00, 0x98, 0xff, 0xda, 0xfd, 0xd2, 0xfc, 0xec, 0xfd, 
-0x99, 0xfc, 0xff, 0xfd, 0x4e, 0xff, 0xd9, 0xfe, 0x64, 0x01, 0x75, 0x01, 0x19, 0x02, 0x88, 0x03, 
-0x97, 0x02, 0x39, 0x03, 0x70, 0x02, 0x1c, 0x01, 0x67, 0x00, 0xb4, 0xfe, 0xdf, 0xfc, 0xa5, 0xfa, 
-0xe7, 0xf9, 0xda, 0xf7, 0xdc, 0xf6, 0xd1, 0xf6, 0x8b, 0xf5, 0x18, 0xf6, 0x93, 0xf6, 0x2f, 0xf6, 
-0xa0, 0xf6, 0xd2, 0xf6, 0xa4, 0xf6, 0xf5, 0xf7, 0x8f, 0xf8, 0x52, 0xf9, 0xee, 0xfb, 0x85, 0xfc, 
-0xc4, 0xfe, 0x23, 0x02, 0xaf, 0x02, 0xa0, 0x06, 0x8f, 0x08, 0xc6, 0x09, 0xe2, 0x0c, 0xc1, 0x0c, 
-0xc1, 0x0d, 0xdd, 0x0d, 0xa9, 0x0c, 0xbd, 0x0b, 0xcf, 0x09, 0x06, 0x08, 0xac, 0x05, 0xdd, 0x03, 
-0xea, 0x01, 0x07, 0x00, 0x9c, 0xff, 0xee, 0xfd, 0x6f, 0xfe, 0x5f, 0xfe, 0x2e, 0xfe, 0xd1, 0xff, 
-0x56, 0xff, 0xa8, 0x00, 0x5f, 0x01, 0x7d, 0x01, 0x3c, 0x02, 0xfb, 0x01, 0x4f, 0x02, 0x17, 0x01, 
-0x73, 0x00, 0xd7, 0xff, 0x42, 0xfd, 0xe0, 0xfc, 0xdc, 0xfa, 0x52, 0xf9, 0x3c, 0xf9, 0x53, 0xf7, 
-0xa1, 0xf7, 0x19, 0xf7, 0xbe, 0xf6, 0xd3, 0xf7, 0xb4, 0xf6, 0xbf, 0xf6, 0x77, 0xf7, 0x76, 0xf6, 
-0xfa, 0xf7, 0x60, 0xf8, 0xd4, 0xf8, 0x61, 0xfb, 0x27, 0xfc, 0xc1, 0xfe, 0x2c, 0x01, 0xfe, 0x02, 
-0x5b, 0x06, 0x4c, 0x08, 0x3c, 0x0a, 0x1b, 0x0c, 0xf0, 0x0c, 0xcd, 0x0d, 0xe6, 0x0c, 0x97, 0x0c, 
-0x72, 0x0b, 0xf4, 0x08, 0xa5, 0x07, 0x3c, 0x05, 0x2b, 0x03, 0xf1, 0x01, 0xc2, 0xff, 0xe3, 0xfe, 
-0xb2, 0xfe, 0x81, 0xfd, 0x7a, 0xfe, 0xbe, 0xfe, 0xfe, 0xfe, 0x47, 0x00, 0x73, 0x00, 0x47, 0x01, 
-0x92, 0x01, 0x91, 0x01, 0x9c, 0x01, 0xae, 0x00, 0x1c, 0x00, 0x85, 0xff, 0x02, 0xfe, 0x06, 0xfd, 
-0x36, 0xfc, 0xe5, 0xfa, 0x3c, 0xfa, 0x71, 0xf9, 0x9c, 0xf8, 0xcf, 0xf8, 0xc1, 0xf7, 0xfb, 0xf7, 
-0xed, 0xf7, 0x21, 0xf7, 0x36, 0xf8, 0xc1, 0xf6, 0x6a, 0xf7, 0xb2, 0xf8, 0x8c, 0xf8, 0xa3, 0xfa, 
-0x98, 0xfb, 0xb2, 0xfd, 0x05, 0x00, 0xf2, 0x01, 0x87, 0x05, 0xb0, 0x06, 0x23, 0x09, 0xfd, 0x0b, 
-0xa9, 0x0b, 0x26, 0x0d, 0x5a, 0x0d, 0x21, 0x0c, 0x66, 0x0b, 0xef, 0x09, 0x83, 0x08, 0xab, 0x05, 
-0x6a, 0x04, 0x1f, 0x03, 0x08, 0x00, 0x3f, 0x00, 0xd9, 0xfe, 0xba, 0xfd, 0xec, 0xfe, 0xcc, 0xfd, 
-0x00, 0xff, 0x72, 0xff, 0x97, 0xff, 0xb1, 0x00, 0x74, 0x00, 0x3d, 0x01, 0x69, 0x00, 0x61, 0x00, 
-0x3d, 0x00, 0x6d, 0xfe, 0x5b, 0xfe, 0xcb, 0xfc, 0x5a, 0xfc, 0x9a, 0xfb, 0xac, 0xf9, 0xd9, 0xfa, 
-0xb6, 0xf9, 0xf2, 0xf8, 0x44, 0xfa, 0x5d, 0xf9, 0x7a, 0xf8, 0x1d, 0xf9, 0xbd, 0xf8, 0x96, 0xf7, 
-0x34, 0xf8, 0x55, 0xf8, 0x6c, 0xf8, 0xaa, 0xf9, 0xfa, 0xfa, 0xc4, 0xfc, 0xdd, 0xfe, 0xf8, 0x00, 
-0xaa, 0x03, 0x28, 0x06, 0xc2, 0x07, 0x1b, 0x0a, 0x70, 0x0b, 0xd5, 0x0b, 0x4a, 0x0c, 0x42, 0x0c, 
-0xf8, 0x0a, 0xbc, 0x09, 0xf5, 0x08, 0x0c, 0x06, 0x3f, 0x05, 0xf5, 0x03, 0x25, 0x01, 0x63, 0x01, 
-0x18, 0x00, 0xd1, 0xfe, 0x62, 0xff, 0x8c, 0xff, 0x53, 0xff, 0x43, 0xff, 0xac, 0x00, 0x4c, 0x00, 
-0xda, 0xff, 0xf7, 0x00, 0x60, 0x00, 0x1a, 0xff, 0x05, 0xff, 0x94, 0xfe, 0x2b, 0xfc, 0x4f, 0xfc, 
-0xd7, 0xfc, 0xb7, 0xfa, 0xb4, 0xfa, 0x87, 0xfa, 0x69, 0xf9, 0xde, 0xf9, 0x7a, 0xf9, 0xec, 0xf8, 
-0x98, 0xf9, 0x44, 0xf9, 0x35, 0xf8, 0x60, 0xf9, 0xcd, 0xf9, 0xe0, 0xf7, 0xe9, 0xf9, 0xe9, 0xfb, 
-0xf4, 0xfa, 0xa5, 0xfd, 0x75, 0x00, 0x4b, 0x00, 0x53, 0x03, 0xe2, 0x05, 0x5a, 0x06, 0xd7, 0x08, 
-0x9d, 0x09, 0xe7, 0x09, 0x1c, 0x0a, 0x41, 0x0a, 0x97, 0x09, 0x4e, 0x08, 0x28, 0x08, 0xa9, 0x06, 
-0x5e, 0x05, 0x58, 0x04, 0x77, 0x03, 0x03, 0x03, 0x7a, 0x01, 0x73, 0x01, 0x4b, 0x01, 0xf2, 0xff, 
-0x85, 0x00, 0x73, 0x00, 0xfd, 0xff, 0xa0, 0x00, 0x50, 0x00, 0xeb, 0xff, 0x3f, 0x00, 0xb2, 0xff, 
-0x9d, 0xfe, 0xbd, 0xfd, 0x03, 0xfe, 0x89, 0xfc, 0xb9, 0xfa, 0x63, 0xfb, 0x02, 0xfa, 0x08, 0xf9, 
-0x0c, 0xf9, 0x96, 0xf9, 0x53, 0xf9, 0x50, 0xf8, 0xe1, 0xfa, 0xd2, 0xfa, 0xd6, 0xf8, 0x7c, 0xfb, 
-0x59, 0xfb, 0xa8, 0xf9, 0x86, 0xfb, 0x08, 0xfc, 0xc1, 0xfb, 0xdb, 0xfb, 0x08, 0xff, 0xcf, 0xfe, 
-0x02, 0xfe, 0xef, 0x02, 0x70, 0x03, 0x22, 0x03, 0xc2, 0x06, 0x34, 0x08, 0x5c, 0x07, 0x52, 0x08, 
-0xeb, 0x09, 0x72, 0x08, 0xca, 0x06, 0xbb, 0x08, 0x85, 0x06, 0x66, 0x04, 0x55, 0x06, 0x08, 0x04, 
-0x0a, 0x03, 0xdd, 0x03, 0x33, 0x02, 0xb3, 0x01, 0x75, 0x01, 0x20, 0x02, 0xb2, 0x00, 0x87, 0x01, 
-0x40, 0x02, 0xd0, 0xff, 0x7d, 0x01, 0x39, 0x00, 0x7b, 0xfe, 0xe8, 0xfe, 0xdf, 0xfd, 0x06, 0xfc, 
-0xb7, 0xfb, 0x99, 0xfb, 0xca, 0xf9, 0x07, 0xf9, 0x02, 0xfa, 0x98, 0xf8, 0xdd, 0xf7, 0x3d, 0xfa, 
-0xe2, 0xf9, 0x6c, 0xf9, 0xa0, 0xfb, 0xcd, 0xfc, 0x5b, 0xfc, 0x03, 0xfd, 0x21, 0xfe, 0xf1, 0xfd, 
-0xe1, 0xfd, 0xce, 0xff, 0x98, 0xff, 0xce, 0xfe, 0xaf, 0x00, 0x40, 0x01, 0x57, 0x01, 0x4a, 0x01, 
-0x4e, 0x02, 0xb6, 0x02, 0xb5, 0x02, 0x4d, 0x04, 0xab, 0x04, 0xc8, 0x04, 0xf6, 0x04, 0x20, 0x05, 
-0xa5, 0x04, 0xbd, 0x04, 0xa9, 0x05, 0x5c, 0x04, 0x20, 0x05, 0xd8, 0x04, 0xd0, 0x03, 0x81, 0x03, 
-0x88, 0x03, 0x8c, 0x02, 0x33, 0x00, 0x72, 0x02, 0x47, 0x00, 0x49, 0xfe, 0x99, 0xff, 0x14, 0xff, 
-0xa3, 0xfd, 0xc5, 0xfc, 0x16, 0xfe, 0xdb, 0xfc, 0x8e, 0xfa, 0xd3, 0xfc, 0x8d, 0xfc, 0x9c, 0xfb, 
-0xb7, 0xfc, 0xed, 0xfc, 0x6e, 0xfd, 0x0c, 0xfc, 0x13, 0xfe, 0x3e, 0x00, 0x9e, 0xfd, 0x56, 0xfe, 
-0x61, 0x00, 0xfc, 0xff, 0x20, 0xfd, 0x5a, 0xfe, 0xb3, 0x00, 0x9a, 0xfc, 0x33, 0xfe, 0x3b, 0x01, 
-0xe6, 0xfd, 0xe1, 0xfd, 0x22, 0x01, 0x77, 0x01, 0x19, 0x00, 0x8f, 0x00, 0x58, 0x03, 0x25, 0x01, 
-0x85, 0x00, 0x6f, 0x04, 0x38, 0x02, 0xe1, 0x01, 0xd0, 0x02, 0xef, 0x02, 0x9e, 0x02, 0x3f, 0x01, 
-0x6f, 0x03, 0xd3, 0x01, 0xfb, 0x00, 0x33, 0x03, 0xa7, 0x02, 0xa6, 0x01, 0x48, 0x01, 0x69, 0x01, 
-0xc7, 0x00, 0xde, 0xfe, 0xda, 0x00, 0x44, 0x00, 0xa5, 0xfe, 0xbf, 0x00, 0x3d, 0x00, 0x93, 0xff, 
-0x47, 0xff, 0x5a, 0xff, 0xb4, 0xfe, 0x0c, 0xfd, 0x10, 0xfe, 0x6b, 0xfe, 0x4a, 0xfd, 0x1b, 0xfe, 
-0xb3, 0xfe, 0xad, 0xfd, 0xd7, 0xfe, 0x33, 0xff, 0xa9, 0xfe, 0x6d, 0xff, 0x31, 0xff, 0xcc, 0xff, 
-0x10, 0x00, 0xff, 0x00, 0x74, 0xff, 0x1f, 0xff, 0x0f, 0x00, 0x44, 0xfe, 0x9a, 0xff, 0x2d, 0x00, 
-0x51, 0xff, 0xa8, 0xff, 0xde, 0x00, 0xf2, 0x00, 0x10, 0x00, 0xde, 0x01, 0x2b, 0x01, 0x9f, 0xff, 
-0xcf, 0x00, 0xd9, 0x00, 0x74, 0xff, 0xa4, 0xff, 0xfe, 0x00, 0x31, 0xff, 0xf7, 0xfe, 0x1c, 0x01, 
-0x0d, 0x00, 0xa7, 0xff, 0xef, 0xff, 0x82, 0xff, 0xc7, 0xff, 0xe3, 0xff, 0xf5, 0xff, 0x03, 0x01, 
-0x06, 0x01, 0x37, 0x00, 0x9e, 0x01, 0x6f, 0x01, 0x6b, 0xff, 0xd1, 0x00, 0x94, 0x00, 0x57, 0xff, 
-0x34, 0xff, 0xe8, 0xff, 0x9a, 0xff, 0xac, 0xfe, 0xc3, 0xff, 0x02, 0xfe, 0x55, 0xfe, 0x68, 0xff, 
-0xf9, 0xfe, 0x0a, 0xff, 0xbd, 0xff, 0x7d, 0x00, 0xb7, 0xff, 0x81, 0x00, 0xaa, 0x00, 0x57, 0xff, 
-0x4d, 0x00, 0xc9, 0x00, 0xe3, 0xff, 0x50, 0x00, 0x6b, 0xff, 0xe1, 0xff, 0x22, 0x02, 0xea, 0xfe, 
-0xcc, 0x00, 0x25, 0x02, 0x42, 0xff, 0xc8, 0x00, 0x0c, 0x01, 0x3e, 0x00, 0xf4, 0xfe, 0x91, 0x00, 
-0xed, 0x00, 0x43, 0xff, 0x9c, 0xff, 0x25, 0xff, 0x1f, 0x00, 0x10, 0x00, 0x5d, 0x00, 0x62, 0x01, 
-0xbc, 0xff, 0xb9, 0xff, 0x41, 0x00, 0x37, 0x00, 0xad, 0xff, 0x61, 0xff, 0x65, 0x00, 0xbd, 0xff, 
-0x06, 0x00, 0x0a, 0x00, 0x22, 0x00, 0x91, 0xff, 0x2f, 0x00, 0xed, 0xff, 0x04, 0xff, 0x2f, 0x01, 
-0xc6, 0xfe, 0x97, 0xff, 0x97, 0x00, 0xa3, 0xfe, 0xae, 0xff, 0x38, 0x00, 0x31, 0xff, 0x3f, 0xff, 
-0xd7, 0x00, 0x70, 0xff, 0xca, 0xff, 0x47, 0x00, 0xa2, 0xff, 0x91, 0x00, 0xcc, 0xff, 0x7e, 0x00, 
-0x6e, 0x00, 0x77, 0x00, 0x35, 0x00, 0x54, 0x01, 0x03, 0x00, 0x5a, 0xff, 0x06, 0x01, 0x96, 0xff, 
-0x5e, 0xff, 0x86, 0xff, 0x8e, 0x00, 0xa0, 0xff, 0x3a, 0xff, 0xfe, 0x00, 0xc8, 0xff, 0x30, 0xff, 
-0xc9, 0x00, 0xf4, 0xff, 0x4c, 0xff, 0x06, 0x00, 0xe5, 0xff, 0x1f, 0x00, 0x62, 0xff, 0x51, 0xff, 
-0x49, 0x00, 0x84, 0xff, 0x87, 0xff, 0xd6, 0xff, 0xe7, 0xff, 0x0a, 0xff, 0x6a, 0xff, 0x62, 0x00, 
-0xc7, 0xfe, 0x8d, 0xff, 0x29, 0x00, 0x68, 0xff, 0x58, 0x00, 0x92, 0xff, 0x95, 0xff, 0xe2, 0xff, 
-0x15, 0xff, 0xf2, 0xff, 0xb7, 0xff, 0x2b, 0xff, 0x43, 0xff, 0x9f, 0xff, 0x90, 0x00, 0xc7, 0xff, 
-0x61, 0xff, 0x51, 0x00, 0xaf, 0xff, 0xd4, 0xff, 0x0e, 0x01, 0xe7, 0xff, 0x0a, 0x00, 0x14, 0x00, 
-0x6b, 0x00, 0xc9, 0x00, 0x93, 0xff, 0xa6, 0x00, 0xa6, 0x00, 0xac, 0xff, 0xef, 0x00, 0xeb, 0x00, 
-0xd8, 0x00, 0x1b, 0x00, 0xd3, 0xff, 0x8c, 0x00, 0xd9, 0xff, 0xb3, 0x00, 0x22, 0x00, 0xa3, 0xff, 
-0xae, 0xff, 0x34, 0xff, 0xdd, 0xff, 0x8d, 0xff, 0x89, 0xff, 0xc0, 0xff, 0xd7, 0x00, 0x8d, 0x00, 
-0x89, 0xff, 0xca, 0x00, 0x3e, 0x00, 0xad, 0xff, 0xf1, 0xff, 0x50, 0x00, 0xb6, 0x00, 0xfd, 0xff, 
-0x56, 0xff, 0x5a, 0x00, 0x64, 0xff, 0xee, 0xff, 0xd8, 0xff, 0x4f, 0x00, 0xfc, 0xff, 0x92, 0xfe, 
-0x75, 0x00, 0x99, 0xff, 0xbf, 0xff, 0x6a, 0x00, 0x52, 0xff, 0xc4, 0x00, 0xb5, 0xff, 0xa4, 0xff, 
-0xb4, 0x01, 0x6a, 0xff, 0x46, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x51, 0x00, 0xcc, 0xff, 0xef, 0x00, 
-0xa0, 0x00, 0x9c, 0x00, 0xd7, 0xff, 0x2c, 0x00, 0x8f, 0x00, 0xd5, 0xff, 0x59, 0x00, 0xe5, 0x00, 
-0xcf, 0xff, 0x85, 0xff, 0x07, 0x00, 0xf6, 0xff, 0x6a, 0xff, 0x79, 0x00, 0x1e, 0x00, 0xd1, 0xff, 
-0x05, 0x00, 0x75, 0xff, 0x3c, 0x00, 0x3a, 0x00, 0xb1, 0xff, 0xf2, 0xff, 0x01, 0x01, 0x68, 0xff, 
-0x08, 0xff, 0xac, 0x00, 0x29, 0x00, 0x51, 0xff, 0xdb, 0xff, 0x12, 0x00, 0x1b, 0x00, 0x81, 0xff, 
-0xf2, 0xff, 0x1d, 0x00, 0x2e, 0x00, 0x42, 0x00, 0xb9, 0xff, 0xdf, 0xff, 0x87, 0xff, 0xa4, 0xff, 
-0xd8, 0xff, 0x0f, 0x00, 0xd7, 0xff, 0xb5, 0xff, 0x61, 0x00, 0xd9, 0x00, 0x1e, 0x00, 0x7b, 0xff, 
-0xc6, 0x00, 0x54, 0x00, 0x3a, 0xff, 0xae, 0x00, 0x16, 0x01, 0x01, 0x00, 0xae, 0xff, 0x18, 0x00, 
-0x58, 0x00, 0x14, 0x00, 0x70, 0x00, 0x88, 0x00, 0x27, 0x00, 0x0a, 0x00, 0x3b, 0x00, 0xb3, 0x00, 
-0x28, 0x00, 0xa1, 0xff, 0x85, 0x00, 0x6f, 0x00, 0x68, 0xff, 0x1d, 0x00, 0x78, 0x00, 0x8f, 0x00, 
-0x91, 0xff, 0x73, 0xff, 0x7f, 0x00, 0xb4, 0xff, 0xb2, 0xff, 0x2a, 0x00, 0x9f, 0x00, 0x99, 0xff, 
-0x12, 0xff, 0x83, 0x00, 0x4f, 0x00, 0x59, 0xff, 0xd1, 0xff, 0x44, 0x00, 0xa0, 0xff, 0x4d, 0xff, 
-0x52, 0x00, 0x75, 0x00, 0xc4, 0xff, 0xb0, 0xff, 0x4b, 0x00, 0x81, 0x00, 0x10, 0xff, 0x32, 0x00, 
-0x22, 0x00, 0xff, 0xff, 0x77, 0xff, 0x0d, 0x00, 0xe1, 0x00, 0x75, 0xff, 0x3d, 0x00, 0x71, 0x00, 
-0xac, 0xff, 0x07, 0x00, 0xca, 0xff, 0xf0, 0xff, 0x1e, 0x00, 0xda, 0xff, 0x6c, 0x00, 0x89, 0x00, 
-0x6b, 0x00, 0xa0, 0xff, 0xc6, 0xff, 0x5c, 0x00, 0xf3, 0xff, 0xe7, 0xff, 0x40, 0x00, 0xb6, 0x00, 
-0x44, 0x00, 0x0f, 0x00, 0xea, 0xff, 0x82, 0x00, 0xb2, 0xff, 0xb1, 0xff, 0xdd, 0x00, 0x63, 0xff, 
-0xd0, 0xff, 0x93, 0x00, 0x2f, 0x00, 0xb5, 0xff, 0x6d, 0xff, 0x73, 0xff, 0xee, 0x00, 0x20, 0x00, 
-0xe7, 0xff, 0x45, 0x00, 0xc3, 0xff, 0xcf, 0xff, 0xca, 0xff, 0x5d, 0x00, 0x44, 0x00, 0x19, 0x00, 
-0x51, 0x00, 0xc1, 0xff, 0x7e, 0xff, 0x08, 0x00, 0x06, 0x00, 0xa8, 0x00, 0xa1, 0xff, 0x87, 0xff, 
-0x5b, 0x00, 0x64, 0xff, 0x5c, 0xff, 0x51, 0x00, 0x9c, 0x00, 0xfc, 0xfe, 0x03, 0x00, 0x40, 0x00, 
-0x44, 0x00, 0x95, 0x00, 0xd0, 0xff, 0xd1, 0xff, 0xda, 0xff, 0x97, 0xff, 0x59, 0xff, 0x92, 0x00, 
-0xc6, 0xff, 0xdb, 0xff, 0x04, 0x00, 0xc6, 0xff, 0x99, 0xff, 0x23, 0x00, 0x61, 0x00, 0xfa, 0xff, 
-0x67, 0xff, 0xcc, 0x00, 0xc2, 0x00, 0xa0, 0xff, 0x15, 0x00, 0xf4, 0xff, 0xd4, 0xff, 0x54, 0xff, 
-0x79, 0x00, 0x0c, 0x00, 0xef, 0xff, 0x67, 0x00, 0xfb, 0xff, 0xa2, 0xff, 0xc2, 0xff, 0x06, 0x00, 
-0x99, 0x00, 0xf6, 0xff, 0x84, 0xff, 0xcf, 0xff, 0x18, 0x00, 0xe3, 0xff, 0xf5, 0xff, 0x21, 0x00, 
-0x77, 0x00, 0x19, 0x00, 0x7f, 0xff, 0x6f, 0x00, 0xdb, 0xff, 0x99, 0xff, 0xc6, 0x00, 0x31, 0x00, 
-0xdd, 0xff, 0x6e, 0xff, 0x9e, 0xff, 0x7e, 0x00, 0x21, 0xff, 0xab, 0xff, 0x2a, 0x00, 0x0b, 0x00, 
-0xc5, 0xff, 0x97, 0xff, 0x7a, 0xff, 0xeb, 0xff, 0xc0, 0xff, 0xd9, 0x00, 0x94, 0xff, 0xe8, 0xff, 
-0xaa, 0x00, 0x56, 0xff, 0x29, 0x00, 0x93, 0xff, 0xc5, 0x00, 0xa5, 0xff, 0x41, 0xff, 0x44, 0x00, 
-0xe6, 0xff, 0xa2, 0x00, 0x0e, 0x00, 0xba, 0xff, 0x47, 0x00, 0xbd, 0xfe, 0xd1, 0xff, 0x51, 0x00, 
-0xf8, 0xff, 0x9d, 0x00, 0x42, 0xff, 0x28, 0x00, 0x51, 0x00, 0x8e, 0xff, 0xf1, 0xff, 0x38, 0x00, 
-0x3c, 0x00, 0x12, 0x00, 0xf9, 0xff, 0xda, 0xff, 0x3b, 0x00, 0xb3, 0xff, 0xec, 0xff, 0x55, 0x00, 
-0xad, 0xff, 0x18, 0xff, 0x32, 0x01, 0x0b, 0x00, 0xb9, 0xfe, 0x67, 0x00, 0xd4, 0xff, 0xea, 0xff, 
-0x05, 0x01, 0xcc, 0xff, 0xb1, 0xff, 0xf6, 0xff, 0x08, 0xff, 0x84, 0x00, 0x9d, 0xff, 0x27, 0x00, 
-0x25, 0x00, 0x41, 0xff, 0xfc, 0xff, 0x3f, 0x00, 0x55, 0xff, 0x34, 0x00, 0x26, 0x00, 0x39, 0xff, 
-0x44, 0xff, 0x25, 0x00, 0x94, 0x00, 0x11, 0x00, 0xb7, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x65, 0x00, 
-0xca, 0xff, 0x9d, 0xff, 0xbe, 0xff, 0x48, 0x00, 0x0f, 0x00, 0xa8, 0xff, 0x71, 0x00, 0xba, 0xff, 
-0xea, 0xff, 0x88, 0xff, 0xd1, 0xff, 0x6e, 0x00, 0xae, 0xff, 0x0c, 0x00, 0x53, 0x00, 0x7d, 0xff, 
-0xfa, 0xff, 0x89, 0x00, 0xfb, 0xff, 0xd0, 0xff, 0x91, 0x00, 0x62, 0x00, 0x45, 0x00, 0x39, 0x00, 
-0xef, 0xff, 0x1a, 0x00, 0xdc, 0xfe, 0xbd, 0xff, 0x2c, 0x00, 0x20, 0x00, 0xd0, 0xff, 0xe5, 0xff, 
-0x1e, 0x00, 0x76, 0xff, 0x67, 0x00, 0xa2, 0xff, 0xf5, 0xff, 0x61, 0x00, 0xb7, 0xff, 0xcc, 0x00, 
-0x2c, 0x00, 0xd2, 0xff, 0xe4, 0xff, 0x94, 0xff, 0x6d, 0xff, 0x62, 0x00, 0xf8, 0xff, 0x68, 0x00, 
-0x04, 0x00, 0x84, 0xff, 0x1e, 0x00, 0x36, 0x00, 0x12, 0x00, 0xad, 0xff, 0x24, 0x01, 0x40, 0xff, 
-0x29, 0xff, 0x43, 0x00, 0x2a, 0x00, 0xb2, 0xff, 0xc4, 0xff, 0x6e, 0x00, 0xad, 0xff, 0x04, 0xff, 
-0x8b, 0x00, 0xe2, 0x00, 0x59, 0xff, 0x82, 0x00, 0xb8, 0xff, 0xba, 0xff, 0x8f, 0xff, 0x33, 0x00, 
-0x8f, 0x00, 0x63, 0xff, 0x40, 0x00, 0xc3, 0xff, 0xe7, 0xff, 0x6e, 0x00, 0xb5, 0xff, 0xd3, 0xff, 
-0xa0, 0x00, 0xc2, 0x00, 0x6c, 0xff, 0x1f, 0x00, 0xd4, 0xff, 0xfe, 0xfe, 0x58, 0x00, 0xf4, 0x00, 
-0x01, 0x00, 0xf9, 0xff, 0xe5, 0xff, 0x82, 0xff, 0xdc, 0xff, 0xa5, 0xff, 0x36, 0x00, 0x5b, 0x00, 
-0x89, 0x00, 0x28, 0x00, 0x7e, 0xff, 0x49, 0x00, 0x18, 0x01, 0xc6, 0xff, 0x62, 0x00, 0x6f, 0xff, 
-0xc7, 0xfe, 0x2a, 0x00, 0xa1, 0x00, 0xe3, 0xff, 0x8f, 0x00, 0x9f, 0xff, 0xa9, 0xff, 0x85, 0x00, 
-0x52, 0xff, 0x41, 0x00, 0x36, 0x00, 0xf2, 0xff, 0x2a, 0x01, 0x56, 0xff, 0xc9, 0xff, 0x14, 0x00, 
-0x45, 0xff, 0x56, 0x00, 0xae, 0xff, 0x52, 0x00, 0xdb, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x8e, 0xff, 
-0x30, 0x00, 0x7f, 0x00, 0x86, 0xff, 0x2f, 0x00, 0x52, 0x00, 0x62, 0x00, 0xae, 0xff, 0x06, 0x00, 
-0x2f, 0x00, 0xa0, 0xfe, 0xa1, 0xff, 0x79, 0x00, 0x96, 0xff, 0x0d, 0x00, 0x69, 0x00, 0x8f, 0x00, 
-0xfb, 0xff, 0xae, 0x00, 0x04, 0x00, 0xef, 0xfe, 0xb6, 0x00, 0x24, 0xff, 0x00, 0x00, 0x0c, 0x01, 
-0x41, 0xff, 0x54, 0x00, 0xd2, 0xff, 0x77, 0xff, 0x09, 0x00, 0xb9, 0xff, 0x61, 0x00, 0x08, 0x00, 
-0x6d, 0x00, 0x48, 0x00, 0x99, 0xff, 0x3b, 0x00, 0xc0, 0xff, 0x5c, 0x00, 0xa9, 0x00, 0x83, 0x00, 
-0xdc, 0xff, 0x4b, 0xff, 0x65, 0x00, 0x07, 0xff, 0x95, 0x00, 0x2a, 0x00, 0x8c, 0xff, 0x51, 0x01, 
-0x5b, 0xff, 0x66, 0x00, 0x4c, 0x00, 0x6a, 0x00, 0xf5, 0xff, 0xf3, 0xff, 0xae, 0x00, 0x80, 0x00, 
-0x51, 0x00, 0xda, 0xff, 0x60, 0x00, 0x14, 0xff, 0x7e, 0x00, 0xfe, 0xff, 0xdf, 0xff, 0x30, 0x00, 
-0xd7, 0xff, 0x4f, 0x00, 0x41, 0x00, 0xf8, 0xff, 0x97, 0xff, 0x12, 0x00, 0x57, 0xff, 0x7a, 0x00, 
-0x49, 0x00, 0x26, 0x00, 0x0d, 0x00, 0xe7, 0xff, 0x06, 0x00, 0x5e, 0xff, 0xbb, 0xff, 0xe2, 0xff, 
-0x55, 0x00, 0x14, 0x00, 0x9f, 0x00, 0x34, 0x00, 0x7b, 0xff, 0xf3, 0xff, 0xd8, 0xff, 0x51, 0xff, 
-0x5b, 0xff, 0x01, 0x00, 0x49, 0xff, 0x2d, 0x00, 0x8b, 0x00, 0x3b, 0x00, 0x5d, 0x00, 0x71, 0x00, 
-0xbb, 0xff, 0x5c, 0x00, 0xd2, 0xff, 0x50, 0x00, 0xa2, 0x00, 0xc3, 0xff, 0xdb, 0x00, 0x61, 0x00, 
-0x57, 0x00, 0xae, 0xff, 0xfa, 0xff, 0xae, 0xff, 0xa8, 0xff, 0x9d, 0x00, 0x7e, 0xff, 0x09, 0x00, 
-0xa7, 0x00, 0xb5, 0xff, 0x82, 0x00, 0x91, 0xff, 0x56, 0x00, 0x54, 0x00, 0x17, 0xff, 0x8c, 0x00, 
-0x93, 0x00, 0x0c, 0x00, 0x90, 0xff, 0x28, 0x00, 0xf7, 0xff, 0xca, 0xff, 0xf1, 0x00, 0x97, 0xff, 
-0x99, 0xff, 0x38, 0x00, 0x05, 0x00, 0x1f, 0x00, 0xe1, 0xff, 0x41, 0x00, 0x80, 0xff, 0xb4, 0xff, 
-0xf0, 0xff, 0x18, 0x00, 0x6a, 0x00, 0xd3, 0xff, 0x67, 0x00, 0x76, 0x00, 0xa5, 0xff, 0x1b, 0x00, 
-0x44, 0x00, 0xbd, 0xff, 0xda, 0xff, 0x1e, 0x00, 0x6c, 0xff, 0x23, 0x00, 0x2a, 0x00, 0xa9, 0xff, 
-0x33, 0x00, 0x18, 0x00, 0x33, 0x00, 0x53, 0x00, 0x80, 0x00, 0xe0, 0xff, 0x8a, 0xff, 0x54, 0x00, 
-0x05, 0x00, 0x2f, 0xff, 0x71, 0x00, 0xac, 0xff, 0x30, 0x00, 0x6b, 0x00, 0x00, 0xff, 0x7f, 0x00, 
-0x33, 0xff, 0xf3, 0xff, 0xd2, 0x00, 0x80, 0xff, 0x8f, 0x00, 0x4f, 0x00, 0xd4, 0xff, 0xc6, 0xff, 
-0x74, 0x00, 0xcd, 0xff, 0x50, 0xff, 0x63, 0x00, 0xa3, 0xff, 0xe8, 0xff, 0x4e, 0x00, 0xae, 0xff, 
-0x9f, 0xff, 0xaa, 0xff, 0x4f, 0x00, 0x12, 0x00, 0xca, 0xff, 0xc5, 0xff, 0x8d, 0x00, 0x05, 0x00, 
-0xa9, 0xff, 0x6c, 0x00, 0xe1, 0xff, 0xcd, 0xff, 0x0b, 0x00, 0xdd, 0xff, 0x0f, 0x00, 0x16, 0x00, 
-0xa2, 0xff, 0x13, 0x00, 0x19, 0x00, 0x06, 0x00, 0xe1, 0xff, 0xc3, 0xff, 0xfe, 0xff, 0xf1, 0xff, 
-0xd7, 0xff, 0x6c, 0xff, 0xec, 0xff, 0x3a, 0x00, 0x9e, 0xff, 0x0d, 0x00, 0x4d, 0x00, 0x49, 0x00, 
-0xbc, 0xff, 0x9e, 0xff, 0x93, 0x00, 0x9b, 0x00, 0x9b, 0xff, 0xb4, 0xff, 0x40, 0x00, 0x37, 0x00, 
-0x3e, 0xff, 0xfb, 0xff, 0x61, 0x00, 0xa4, 0xff, 0xf5, 0xff, 0x60, 0xff, 0x1a, 0x00, 0x2b, 0x00, 
-0x73, 0xff, 0xe8, 0xff, 0x06, 0x00, 0x6b, 0x00, 0xc7, 0xff, 0x15, 0x00, 0x6c, 0x00, 0x74, 0xff, 
-0x97, 0xff, 0xb2, 0xff, 0x49, 0x00, 0x72, 0x00, 0x65, 0xff, 0x5c, 0xff, 0x0f, 0x00, 0xcf, 0xff, 
-0xf8, 0xff, 0x85, 0x00, 0x34, 0xff, 0x0c, 0x00, 0x0b, 0x00, 0xce, 0xff, 0xa4, 0x00, 0x2d, 0x00, 
-0x3f, 0x00, 0xdd, 0xff, 0xfa, 0xff, 0x07, 0x00, 0xee, 0xff, 0x7d, 0x00, 0xed, 0x00, 0x18, 0x00, 
-0x74, 0x00, 0x5b, 0x00, 0xd3, 0xff, 0x3c, 0x00, 0xee, 0xff, 0xfc, 0xff, 0x95, 0xff, 0xac, 0xfe, 
-0x55, 0xff, 0x76, 0xff, 0x78, 0xff, 0x79, 0xff, 0x7d, 0xff, 0xf1, 0xff, 0x24, 0x00, 0x58, 0x00, 
-0x27, 0x00, 0x3a, 0x00, 0xf3, 0xff, 0xf3, 0xff, 0xcb, 0xff, 0xd0, 0xff, 0xa4, 0xff, 0x44, 0xff, 
-0x8c, 0xff, 0x4a, 0xff, 0x74, 0xff, 0x7f, 0xff, 0x58, 0xff, 0x54, 0xff, 0x61, 0xff, 0x8b, 0xff, 
-0x64, 0xff, 0xb1, 0xff, 0xf2, 0xff, 0xc5, 0xff, 0xb8, 0xff, 0xf2, 0xff, 0x07, 0x00, 0xf0, 0xff, 
-0x29, 0x00, 0xcd, 0xff, 0xd1, 0xff, 0x6c, 0x00, 0x6b, 0x00, 0xf3, 0xff, 0xc3, 0xff, 0x5d, 0x00, 
-0xec, 0xff, 0x5e, 0xff, 0x01, 0x00, 0xb3, 0x00, 0x55, 0x00, 0x59, 0xff, 0xef, 0xff, 0x95, 0x00, 
-0xe5, 0xff, 0x19, 0x00, 0xa5, 0x00, 0x9f, 0x00, 0x21, 0x00, 0xf5, 0xff, 0x31, 0x01, 0x6b, 0x01, 
-0xab, 0x00, 0xca, 0x00, 0x93, 0x00, 0x91, 0x00, 0x1a, 0x00, 0x0c, 0x00, 0xac, 0x00, 0x82, 0xff, 
-0x4a, 0xff, 0xed, 0xff, 0x1b, 0xff, 0x38, 0xff, 0x99, 0xff, 0x2a, 0xff, 0x19, 0xff, 0x73, 0xff, 
-0x21, 0x00, 0xf4, 0xff, 0x4b, 0x00, 0x7b, 0x00, 0xf0, 0xff, 0x32, 0x00, 0x37, 0x00, 0x03, 0x00, 
-0xfd, 0xff, 0xe8, 0xff, 0x95, 0xff, 0x0a, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0x2e, 0xff, 0x49, 0xff, 
-0x55, 0xff, 0xc9, 0xff, 0xdf, 0xff, 0x4f, 0x00, 0x90, 0x00, 0xd8, 0x00, 0x3d, 0x01, 0x68, 0x01, 
-0x9b, 0x01, 0x5a, 0x01, 0x22, 0x01, 0x24, 0x01, 0x25, 0x01, 0x0a, 0x01, 0xf3, 0x00, 0x0f, 0x00, 
-0x11, 0xff, 0xa7, 0xfe, 0x25, 0xfe, 0xeb, 0xfd, 0xe8, 0xfd, 0x55, 0xfe, 0xb5, 0xfe, 0xd2, 0xfe, 
-0x70, 0xff, 0x9e, 0xff, 0x16, 0x00, 0xf8, 0xff, 0x13, 0x00, 0xbd, 0x00, 0x7c, 0x00, 0x9a, 0x00, 
-0x3c, 0x00, 0x22, 0x00, 0xc1, 0xff, 0x5f, 0xff, 0x58, 0xff, 0xfc, 0xfe, 0x0a, 0xff, 0xe9, 0xfe, 
-0xdf, 0xfe, 0x33, 0xff, 0x5d, 0xff, 0xaa, 0xff, 0xeb, 0xff, 0x53, 0x00, 0x48, 0x00, 0x34, 0x00, 
-0x9b, 0x00, 0x92, 0x00, 0xa6, 0x00, 0xa0, 0x00, 0xb1, 0x00, 0xac, 0x00, 0x80, 0x00, 0x86, 0x00, 
-0x52, 0x00, 0xf8, 0xff, 0x01, 0x00, 0xf0, 0xff, 0xf3, 0xff, 0x16, 0x00, 0x08, 0x00, 0x0c, 0x00, 
-0x17, 0x00, 0x54, 0x00, 0x7f, 0x00, 0x6d, 0x00, 0x76, 0x00, 0xa2, 0x00, 0x7a, 0x00, 0x96, 0x00, 
-0xc5, 0x00, 0x7e, 0x00, 0x87, 0x00, 0x48, 0x00, 0x29, 0x00, 0x0f, 0x00, 0xb9, 0xff, 0xfb, 0xff, 
-0x00, 0x00, 0xe3, 0xff, 0x23, 0x00, 0x23, 0x00, 0x1c, 0x00, 0x10, 0x00, 0x20, 0x00, 0x6b, 0x00, 
-0x65, 0x00, 0x7f, 0x00, 0x99, 0x00, 0x66, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x45, 0x00, 0x77, 0x00, 
-0x3b, 0x00, 0x08, 0x00, 0xe6, 0xff, 0xbf, 0xff, 0xdb, 0xff, 0xbb, 0xff, 0xc6, 0xff, 0xe3, 0xff, 
-0xe1, 0xff, 0xde, 0xff, 0xf2, 0xff, 0x12, 0x00, 0x3b, 0x00, 0x1e, 0x00, 0x19, 0x00, 0x32, 0x00, 
-0x35, 0x00, 0x06, 0x00, 0xed, 0xff, 0xf3, 0xff, 0xed, 0xff, 0xe6, 0xff, 0xfc, 0xff, 0xe6, 0xff, 
-0xc0, 0xff, 0xc9, 0xff, 0xbc, 0xff, 0xc2, 0xff, 0xd8, 0xff, 0xe4, 0xff, 0xea, 0xff, 0xf1, 0xff, 
-0x01, 0x00, 0x27, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x14, 0x00, 0xf8, 0xff, 
-0xfa, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe3, 0xff, 
-0xff, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0x03, 0x00, 
-0x02, 0x00, 0xf9, 0xff, 0x01, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf6, 0xff, 0xf4, 0xff, 
-0xf6, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xf2, 0xff, 
-0xee, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xff, 
-0x06, 0x00, 0x07, 0x00, 0xfc, 0xff, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xf4, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x06, 0x00, 
-0x03, 0x00, 0x11, 0x00, 0x0d, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x02, 0x00, 
-0x07, 0x00, 0x05, 0x00, 0xf9, 0xff, 0x07, 0x00, 0x04, 0x00, 0x01, 0x00, 0xfa, 0xff, 0xf6, 0xff, 
-0xfb, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xf6, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf7, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0x06, 0x00, 0x07, 0x00, 0xff, 0xff, 
-0x08, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0a, 0x00, 0xfe, 0xff, 
-0x02, 0x00, 0x08, 0x00, 0xfc, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 
-0x0e, 0x00, 0xff, 0xff, 0x04, 0x00, 0x08, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0x05, 0x00, 0x02, 0x00, 
-0xff, 0xff, 0x06, 0x00, 0x03, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x05, 0x00, 0x09, 0x00, 0x03, 0x00, 
-0x0a, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0x00, 0xff, 0xff, 
-0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xfc, 0xff, 
-0x02, 0x00, 0x00, 0x00, 0xfa, 0xff, 0x03, 0x00, 0x05, 0x00, 
-};
-
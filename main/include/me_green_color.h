@@ -1,814 +0,0 @@
-#include <stdio.h>
-const unsigned char me_green_color[] = {
-0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x02, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 
-0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0xfc, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 
-0x04, 0x00, 0x04, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x01, 0x00, 
-0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0xff, 
-0xf7, 0xff, 0xfa, 0xff, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x06, 0x00, 0xff, 0xff, 
-0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x01, 0x00, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0xfb, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 
-0xfe, 0xff, 0x01, 0x00, 0x02, 0x00, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xff, 
-0xf8, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xfb, 0xff, 0x04, 0x00, 0x02, 0x00, 0xfd, 0xff, 
-0xf6, 0xff, 0xf9, 0xff, 0x04, 0x00, 0x0a, 0x00, 0xfa, 0xff, 0xf2, 0xff, 0x01, 0x00, 0x05, 0x00, 
-0xfe, 0xff, 0xfc, 0xff, 0x05, 0x00, 0x03, 0x00, 0x03, 0x00, 0x11, 0x00, 0x09, 0x00, 0xf0, 0xff, 
-0xed, 0xff, 0xf3, 0xff, 0xff, 0xff, 0x05, 0x00, 0x03, 0x00, 0xf9, 0xff, 0x04, 0x00, 0xfc, 0xff, 
-0xdd, 0xff, 0xe8, 0xff, 0x0f, 0x00, 0x3a, 0x00, 0x18, 0x00, 0xe6, 0xff, 0x20, 0x00, 0x1d, 0x00, 
-0xf1, 0xff, 0xe1, 0xff, 0xea, 0xff, 0xe7, 0xff, 0xf0, 0xff, 0x22, 0x00, 0x30, 0x00, 0x01, 0x00, 
-0x1b, 0x00, 0xd0, 0xff, 0x75, 0xff, 0xc4, 0xff, 0xc7, 0xff, 0x21, 0x00, 0x43, 0x00, 0xef, 0xff, 
-0xae, 0xff, 0x04, 0x00, 0x20, 0x00, 0x84, 0x00, 0x92, 0x00, 0xd6, 0xff, 0xf9, 0xff, 0xed, 0xff, 
-0xcf, 0xff, 0x19, 0x00, 0x26, 0x00, 0x10, 0x00, 0x34, 0x00, 0x43, 0x00, 0xc1, 0xff, 0x48, 0xff, 
-0xc4, 0xff, 0xd8, 0xff, 0x56, 0xff, 0x3f, 0xff, 0x9c, 0xff, 0x61, 0x00, 0x70, 0x00, 0x1f, 0x00, 
-0x55, 0x00, 0xf8, 0xff, 0x8d, 0xff, 0x9e, 0xff, 0xc5, 0x00, 0x9d, 0x01, 0x2f, 0x01, 0x10, 0x02, 
-0xda, 0x01, 0xe1, 0x00, 0xde, 0x00, 0xe7, 0xff, 0x9c, 0xfe, 0xf7, 0xfd, 0x36, 0xff, 0x0a, 0x00, 
-0x31, 0xff, 0x43, 0xfe, 0x61, 0xfe, 0x6f, 0xff, 0x5b, 0x01, 0x94, 0x02, 0xdc, 0x01, 0xe3, 0x00, 
-0xc6, 0xff, 0xe6, 0xff, 0x6a, 0x00, 0x0f, 0x00, 0x30, 0xfe, 0x15, 0xfc, 0xf7, 0xfc, 0x24, 0xfe, 
-0x62, 0xfe, 0xd7, 0xfd, 0xf0, 0xfc, 0x06, 0xfe, 0x59, 0xff, 0xab, 0xff, 0x35, 0xff, 0x42, 0xfe, 
-0xee, 0xfd, 0x9b, 0xfe, 0x1e, 0xff, 0xe0, 0xff, 0x2d, 0x04, 0x30, 0x0c, 0x53, 0x07, 0x93, 0xff, 
-0x42, 0x04, 0xfa, 0x08, 0xd3, 0x06, 0xd9, 0xfe, 0xb9, 0xf9, 0x7a, 0xfa, 0x4e, 0xfd, 0x95, 0xfc, 
-0xa1, 0xf9, 0xc6, 0xf8, 0x48, 0xfb, 0x4e, 0xfe, 0xd0, 0xfe, 0x00, 0xfd, 0x49, 0xfd, 0xf4, 0xff, 
-0x84, 0x02, 0xc6, 0x01, 0x11, 0xfe, 0x88, 0xfd, 0x82, 0xfd, 0x9e, 0xfd, 0xfe, 0xfd, 0x6b, 0xfe, 
-0xb4, 0x00, 0xf0, 0x01, 0xc0, 0x02, 0xed, 0x04, 0xd9, 0x0b, 0x16, 0x11, 0xe0, 0x0a, 0xcf, 0x00, 
-0x25, 0xfa, 0x59, 0xfc, 0xb0, 0x02, 0x9b, 0x02, 0x6f, 0xfd, 0xb1, 0xf8, 0x6f, 0xfa, 0x58, 0x00, 
-0xea, 0x03, 0x5f, 0x01, 0x44, 0xfc, 0xd6, 0xfc, 0x31, 0x01, 0x11, 0x03, 0x51, 0xff, 0xf7, 0xfb, 
-0x13, 0xfd, 0x2d, 0x00, 0x1a, 0xff, 0xc0, 0xf9, 0xbf, 0xf5, 0xa6, 0xf8, 0xdf, 0x06, 0x91, 0x0f, 
-0x51, 0x06, 0xe4, 0xf6, 0xc8, 0xf4, 0xfc, 0x00, 0xf7, 0x09, 0x99, 0x04, 0x7d, 0xf8, 0xd0, 0xf5, 
-0x59, 0xfd, 0xe0, 0x01, 0x66, 0x01, 0x77, 0x01, 0xf4, 0x02, 0x56, 0x04, 0x58, 0x02, 0xad, 0xfe, 
-0x8f, 0xfc, 0xb2, 0xff, 0x8d, 0x06, 0x74, 0x09, 0x5a, 0x03, 0x3b, 0xfa, 0xb3, 0xf8, 0x6d, 0xfe, 
-0x48, 0x03, 0xb1, 0x00, 0xd3, 0xfb, 0x00, 0xfc, 0xd9, 0xff, 0xd3, 0x02, 0x59, 0x01, 0x31, 0xfe, 
-0x6b, 0xfd, 0x87, 0x00, 0xc5, 0x02, 0x99, 0xff, 0xdf, 0xfa, 0xa8, 0xfb, 0x08, 0x00, 0x93, 0x00, 
-0x95, 0xfe, 0x85, 0xfb, 0x33, 0xfd, 0x62, 0x02, 0xca, 0x05, 0x36, 0x02, 0xe5, 0xfd, 0xec, 0x00, 
-0x26, 0x04, 0x7c, 0x02, 0xe0, 0xfe, 0x0f, 0x00, 0xde, 0x02, 0x6b, 0x03, 0x94, 0x00, 0xe4, 0xff, 
-0xf8, 0x01, 0x65, 0x02, 0xea, 0x03, 0xb0, 0x06, 0x10, 0x03, 0xaa, 0x01, 0x94, 0x05, 0xe7, 0x04, 
-0x99, 0x02, 0x0a, 0x01, 0x69, 0x01, 0x0b, 0x04, 0x4d, 0xfe, 0xb7, 0xf9, 0x56, 0xfe, 0x52, 0xff, 
-0x1d, 0xfe, 0xd1, 0xf9, 0x67, 0xf6, 0xd6, 0xf5, 0xfd, 0xfa, 0x41, 0xff, 0x40, 0xf9, 0x77, 0xf2, 
-0x8b, 0xf3, 0x4d, 0xfc, 0xea, 0x01, 0xdd, 0xfd, 0xb6, 0xf9, 0x98, 0xfa, 0x42, 0x01, 0xed, 0x08, 
-0x9c, 0x07, 0x2f, 0x04, 0x63, 0x03, 0xec, 0x07, 0xa1, 0x0c, 0x68, 0x0d, 0x9c, 0x08, 0xc7, 0x03, 
-0x32, 0x06, 0x70, 0x09, 0xef, 0x08, 0xdd, 0x04, 0x1a, 0x02, 0x29, 0x01, 0xbe, 0x03, 0xcc, 0x05, 
-0xd2, 0x03, 0x3c, 0xfe, 0xbc, 0xfa, 0xff, 0x00, 0x36, 0x03, 0x5a, 0xfd, 0xd6, 0xf7, 0x77, 0xf5, 
-0x77, 0xf9, 0xb1, 0xfa, 0x99, 0xf5, 0xe0, 0xf0, 0x6f, 0xef, 0x26, 0xf0, 0x0f, 0xf4, 0x01, 0xf7, 
-0x01, 0xf3, 0x2d, 0xf3, 0xbd, 0xf9, 0x7a, 0x01, 0x6c, 0x04, 0x9a, 0x02, 0x16, 0x04, 0x78, 0x09, 
-0x8b, 0x0f, 0xbc, 0x10, 0xc6, 0x0b, 0x64, 0x09, 0x58, 0x0c, 0xf6, 0x0d, 0x09, 0x0a, 0xb0, 0x04, 
-0xbb, 0x01, 0xcc, 0x02, 0xd2, 0x06, 0x1e, 0x03, 0xa4, 0xfd, 0xcc, 0xfd, 0xd9, 0x02, 0xc7, 0x05, 
-0x44, 0x04, 0xc4, 0x02, 0x22, 0x01, 0xea, 0x01, 0xb2, 0x04, 0x37, 0x03, 0xce, 0xfd, 0xa6, 0xfc, 
-0x01, 0xf9, 0x3c, 0xf7, 0xfb, 0xf5, 0x58, 0xf1, 0xfe, 0xf0, 0x67, 0xed, 0x5f, 0xec, 0x31, 0xed, 
-0x91, 0xef, 0x66, 0xf3, 0xcb, 0xf4, 0x40, 0xf7, 0xa2, 0xfc, 0x18, 0x03, 0x62, 0x07, 0x78, 0x0b, 
-0xf6, 0x0d, 0xd9, 0x0e, 0xe7, 0x10, 0x5c, 0x13, 0xd3, 0x10, 0xbc, 0x0c, 0xe3, 0x0a, 0x5a, 0x0a, 
-0xaa, 0x07, 0x4b, 0x02, 0xb0, 0x00, 0xaa, 0xff, 0xf5, 0xff, 0xdb, 0x01, 0xbb, 0xff, 0xd7, 0xfe, 
-0x1c, 0x01, 0x70, 0x04, 0x1f, 0x05, 0x7f, 0x05, 0x1c, 0x05, 0x48, 0x02, 0xab, 0x02, 0x02, 0x05, 
-0x34, 0x00, 0x09, 0xf9, 0x12, 0xf8, 0x90, 0xf5, 0xb5, 0xf3, 0x7b, 0xf0, 0xd6, 0xe8, 0x88, 0xe6, 
-0x32, 0xe8, 0x5c, 0xec, 0x77, 0xee, 0x1d, 0xef, 0xb5, 0xf4, 0x99, 0xfb, 0x55, 0x03, 0xf0, 0x0a, 
-0x96, 0x0d, 0x3f, 0x0e, 0x4a, 0x13, 0x6f, 0x18, 0xe8, 0x17, 0x7a, 0x11, 0xe1, 0x0b, 0x0f, 0x0b, 
-0x96, 0x0a, 0x09, 0x06, 0x47, 0xff, 0xd8, 0xfc, 0xbb, 0xfc, 0xa5, 0xfd, 0xf8, 0xff, 0x0c, 0x01, 
-0x88, 0x00, 0x95, 0x01, 0x54, 0x05, 0xd9, 0x09, 0x59, 0x0b, 0xcf, 0x07, 0x7a, 0x04, 0x4e, 0x05, 
-0x19, 0x06, 0x9f, 0x00, 0xd7, 0xfa, 0x6b, 0xf6, 0x0f, 0xf2, 0x0a, 0xef, 0x7b, 0xea, 0xc7, 0xe7, 
-0x69, 0xe5, 0xaa, 0xe3, 0x1b, 0xe6, 0xf7, 0xea, 0xb3, 0xf1, 0x05, 0xf8, 0x4a, 0xfd, 0xa6, 0x02, 
-0x90, 0x09, 0x89, 0x11, 0x69, 0x16, 0xf5, 0x16, 0x3d, 0x16, 0xdd, 0x14, 0xf3, 0x13, 0xcf, 0x11, 
-0xb1, 0x0b, 0x16, 0x06, 0x1d, 0x02, 0x87, 0xff, 0xdf, 0xfd, 0x83, 0xfb, 0xa1, 0xfa, 0x7a, 0xfc, 
-0x50, 0x00, 0x23, 0x02, 0x67, 0x03, 0xff, 0x05, 0xac, 0x07, 0x94, 0x09, 0xd5, 0x0a, 0xb0, 0x0a, 
-0x14, 0x08, 0x39, 0x04, 0xaf, 0xff, 0xcc, 0xfc, 0x2e, 0xfa, 0x54, 0xf2, 0x2b, 0xec, 0xd1, 0xe7, 
-0x53, 0xe3, 0x2d, 0xe3, 0xdc, 0xe2, 0x80, 0xe3, 0xba, 0xe6, 0x06, 0xee, 0xd5, 0xf7, 0xb2, 0xfe, 
-0x4f, 0x04, 0x99, 0x0a, 0x48, 0x12, 0x2a, 0x19, 0x3d, 0x1b, 0x09, 0x1a, 0x23, 0x17, 0x30, 0x14, 
-0xfd, 0x10, 0x37, 0x0c, 0x0b, 0x07, 0x3c, 0x01, 0x25, 0xfd, 0x50, 0xfc, 0x17, 0xfd, 0xce, 0xfc, 
-0xe5, 0xfc, 0x57, 0xff, 0xa6, 0x03, 0x5e, 0x06, 0x06, 0x08, 0xad, 0x08, 0x1f, 0x08, 0xa2, 0x08, 
-0xc7, 0x08, 0x91, 0x06, 0x37, 0x02, 0xd4, 0xfd, 0x94, 0xfa, 0x0f, 0xf6, 0xa1, 0xf0, 0x47, 0xec, 
-0x9f, 0xe8, 0xbc, 0xe4, 0x7b, 0xe1, 0x9c, 0xe0, 0x2b, 0xe3, 0x6b, 0xe8, 0x60, 0xf0, 0xa9, 0xf8, 
-0x5a, 0xfe, 0x01, 0x05, 0xfa, 0x0c, 0xb8, 0x15, 0x60, 0x1b, 0x09, 0x1c, 0xae, 0x1a, 0xa9, 0x18, 
-0x15, 0x16, 0x2d, 0x11, 0xf5, 0x09, 0x71, 0x03, 0x35, 0xff, 0x46, 0xfd, 0x79, 0xfb, 0x77, 0xfa, 
-0x77, 0xfb, 0x21, 0xfe, 0x85, 0x02, 0xeb, 0x05, 0xbb, 0x07, 0x52, 0x09, 0x1c, 0x0b, 0x74, 0x0b, 
-0xcf, 0x09, 0x19, 0x07, 0xde, 0x04, 0x49, 0x01, 0x7c, 0xfc, 0x6a, 0xf8, 0x00, 0xf3, 0x7d, 0xed, 
-0x22, 0xea, 0xd0, 0xe7, 0x9f, 0xe4, 0x3f, 0xe1, 0x63, 0xdf, 0x64, 0xe2, 0x88, 0xea, 0x42, 0xf3, 
-0x59, 0xf9, 0x95, 0xfd, 0xd5, 0x04, 0x79, 0x0e, 0x8d, 0x16, 0x83, 0x1a, 0x7f, 0x1a, 0xbc, 0x19, 
-0x80, 0x18, 0x36, 0x16, 0x31, 0x11, 0xd2, 0x09, 0xba, 0x03, 0x97, 0xff, 0x13, 0xfd, 0x2a, 0xfb, 
-0xda, 0xf9, 0x87, 0xfa, 0x9d, 0xfd, 0xf7, 0x00, 0xff, 0x04, 0xe8, 0x08, 0xbe, 0x0a, 0x96, 0x0b, 
-0xe2, 0x0b, 0x94, 0x0b, 0x9f, 0x0a, 0xfe, 0x07, 0x17, 0x05, 0xcd, 0x00, 0x4e, 0xfb, 0xbb, 0xf6, 
-0xb6, 0xf2, 0x52, 0xed, 0x42, 0xe6, 0x3f, 0xe2, 0x13, 0xe0, 0x2d, 0xde, 0x5b, 0xde, 0xf9, 0xe2, 
-0x73, 0xeb, 0xb9, 0xf4, 0xf9, 0xfb, 0xa4, 0x01, 0x1a, 0x09, 0x84, 0x12, 0x90, 0x19, 0xdb, 0x1b, 
-0x69, 0x1b, 0x8a, 0x19, 0x0c, 0x17, 0x94, 0x13, 0xcd, 0x0d, 0x0d, 0x07, 0xc8, 0x00, 0x9e, 0xfd, 
-0x55, 0xfc, 0x54, 0xfb, 0x9b, 0xfa, 0x76, 0xfb, 0xb3, 0xff, 0xcd, 0x04, 0x4f, 0x08, 0xe8, 0x09, 
-0x53, 0x0a, 0xba, 0x0a, 0x8b, 0x0b, 0xe8, 0x09, 0x1e, 0x07, 0x28, 0x04, 0x9f, 0x00, 0x24, 0xfd, 
-0x5d, 0xf8, 0x0d, 0xf2, 0x43, 0xeb, 0xee, 0xe6, 0x3d, 0xe4, 0x3d, 0xdf, 0x3b, 0xdb, 0xdf, 0xdc, 
-0xcb, 0xe3, 0x37, 0xed, 0x86, 0xf5, 0x22, 0xfc, 0xb6, 0x03, 0x7c, 0x0d, 0x31, 0x17, 0x6e, 0x1c, 
-0xee, 0x1c, 0x20, 0x1c, 0x1a, 0x1c, 0x53, 0x1a, 0x8c, 0x13, 0x68, 0x0a, 0x88, 0x04, 0x77, 0x01, 
-0xd8, 0xfe, 0x11, 0xfb, 0x80, 0xf7, 0x9e, 0xf7, 0xf4, 0xfb, 0x0c, 0x01, 0x85, 0x03, 0x73, 0x05, 
-0x2e, 0x08, 0x87, 0x0a, 0x07, 0x0b, 0xf7, 0x09, 0x1a, 0x08, 0x33, 0x06, 0x20, 0x04, 0x33, 0x01, 
-0x24, 0xfd, 0x8b, 0xf8, 0x1d, 0xf3, 0x8f, 0xed, 0xbc, 0xe8, 0x44, 0xe4, 0x88, 0xde, 0xa0, 0xda, 
-0x03, 0xdc, 0x15, 0xe3, 0x03, 0xeb, 0x93, 0xf1, 0x93, 0xf9, 0xfe, 0x03, 0x97, 0x0e, 0x14, 0x17, 
-0x31, 0x1c, 0x35, 0x1e, 0x6d, 0x1f, 0x40, 0x1f, 0x87, 0x1b, 0xee, 0x13, 0x34, 0x0d, 0x48, 0x08, 
-0xb6, 0x03, 0xda, 0xfe, 0x61, 0xfa, 0x2a, 0xf8, 0x37, 0xf9, 0x8a, 0xfb, 0x40, 0xfe, 0xd2, 0x01, 
-0x3f, 0x05, 0x13, 0x08, 0x6e, 0x09, 0x3d, 0x09, 0xec, 0x08, 0x18, 0x09, 0x2c, 0x08, 0x03, 0x05, 
-0x33, 0x01, 0x2f, 0xfd, 0x2a, 0xfa, 0xaf, 0xf5, 0x7a, 0xed, 0x6c, 0xe6, 0x5c, 0xe3, 0x92, 0xde, 
-0x33, 0xd8, 0x98, 0xd8, 0x72, 0xe0, 0xa1, 0xe9, 0x38, 0xf0, 0xae, 0xf7, 0x32, 0x02, 0xd5, 0x0e, 
-0xe9, 0x18, 0xf7, 0x1c, 0x68, 0x1e, 0x16, 0x20, 0xfc, 0x20, 0xed, 0x1c, 0x98, 0x14, 0x73, 0x0d, 
-0xab, 0x09, 0x85, 0x05, 0x44, 0xff, 0x97, 0xf9, 0xe3, 0xf7, 0x91, 0xf9, 0x5f, 0xfb, 0x88, 0xfd, 
-0x61, 0x00, 0x29, 0x04, 0x10, 0x07, 0x0f, 0x08, 0xc5, 0x07, 0x18, 0x08, 0x34, 0x09, 0x74, 0x08, 
-0x35, 0x04, 0xff, 0xff, 0x8d, 0xfe, 0x2f, 0xfc, 0x60, 0xf5, 0x8b, 0xed, 0xe2, 0xe9, 0xdc, 0xe5, 
-0xab, 0xdd, 0x2a, 0xd9, 0xb2, 0xdd, 0x4f, 0xe5, 0x16, 0xea, 0xfb, 0xef, 0xe4, 0xf9, 0x62, 0x05, 
-0xc8, 0x0f, 0x9f, 0x16, 0x7f, 0x1a, 0x42, 0x1e, 0xd7, 0x20, 0x49, 0x1e, 0x41, 0x18, 0x64, 0x13, 
-0x1e, 0x10, 0xe0, 0x0a, 0x6c, 0x03, 0x16, 0xfe, 0xa4, 0xfb, 0xad, 0xf9, 0x7d, 0xf8, 0xc9, 0xf8, 
-0x6c, 0xfb, 0x43, 0xff, 0x59, 0x02, 0xfc, 0x02, 0x4c, 0x04, 0x5c, 0x07, 0x6e, 0x09, 0x32, 0x08, 
-0xd3, 0x05, 0xdd, 0x04, 0x17, 0x03, 0x02, 0xff, 0xab, 0xfa, 0xcf, 0xf5, 0xd0, 0xee, 0xeb, 0xe7, 
-0x9c, 0xe2, 0x86, 0xdc, 0x14, 0xda, 0x8a, 0xde, 0x67, 0xe5, 0x3e, 0xeb, 0x3e, 0xf2, 0x0b, 0xfe, 
-0xd4, 0x09, 0xf6, 0x11, 0x4a, 0x17, 0xaf, 0x1c, 0x24, 0x21, 0x13, 0x21, 0x8f, 0x1c, 0x35, 0x18, 
-0x3e, 0x16, 0x0c, 0x11, 0xde, 0x08, 0xde, 0x03, 0x94, 0x01, 0x89, 0xfc, 0x39, 0xf8, 0xf0, 0xf7, 
-0xd1, 0xf9, 0xdd, 0xfc, 0x92, 0xfd, 0xda, 0xfe, 0x62, 0x02, 0xa1, 0x04, 0xe5, 0x04, 0x78, 0x06, 
-0x94, 0x07, 0xea, 0x05, 0x88, 0x04, 0x4c, 0x03, 0xd0, 0xff, 0xb1, 0xfb, 0xda, 0xf4, 0x8a, 0xec, 
-0x00, 0xe7, 0x1e, 0xe0, 0xef, 0xd8, 0x70, 0xd9, 0x2e, 0xdf, 0xf1, 0xe4, 0x73, 0xeb, 0x2e, 0xf5, 
-0x50, 0x01, 0x52, 0x0b, 0x33, 0x12, 0xd9, 0x17, 0xe2, 0x1d, 0x06, 0x21, 0x15, 0x1e, 0xb3, 0x1a, 
-0xfa, 0x18, 0xeb, 0x14, 0x14, 0x0e, 0x7a, 0x08, 0xff, 0x04, 0xec, 0xff, 0xcd, 0xfa, 0x37, 0xf9, 
-0x81, 0xfa, 0x41, 0xfc, 0x1d, 0xfd, 0xfd, 0xfe, 0x01, 0x02, 0xc2, 0x03, 0xa1, 0x03, 0x48, 0x05, 
-0xb2, 0x07, 0x2c, 0x06, 0x58, 0x04, 0x04, 0x04, 0x5f, 0x02, 0x61, 0xfd, 0x8c, 0xf7, 0xf9, 0xef, 
-0xd6, 0xea, 0xb0, 0xe2, 0x1c, 0xda, 0x8b, 0xda, 0x64, 0xde, 0xc1, 0xe2, 0x8e, 0xe8, 0xd6, 0xf2, 
-0xab, 0xfe, 0xb1, 0x07, 0x3c, 0x0e, 0x55, 0x16, 0x32, 0x1c, 0xed, 0x1c, 0x51, 0x1c, 0x17, 0x1c, 
-0xce, 0x18, 0xdf, 0x13, 0x80, 0x10, 0xf5, 0x0b, 0x39, 0x06, 0x43, 0x01, 0xb7, 0xfc, 0x09, 0xfb, 
-0x89, 0xf9, 0x30, 0xfa, 0xb3, 0xfb, 0x77, 0xfc, 0xad, 0xff, 0x16, 0x02, 0x5b, 0x02, 0x00, 0x05, 
-0x71, 0x07, 0xbf, 0x05, 0x28, 0x05, 0x0e, 0x07, 0x3d, 0x04, 0x1a, 0xff, 0x67, 0xfc, 0x5d, 0xf4, 
-0xbb, 0xec, 0x2f, 0xe6, 0x6f, 0xdc, 0x6f, 0xda, 0xa7, 0xdd, 0xb5, 0xde, 0x3c, 0xe5, 0x9d, 0xf0, 
-0xcd, 0xf9, 0x78, 0x01, 0xfe, 0x0b, 0x3b, 0x15, 0xdb, 0x17, 0x9f, 0x1b, 0x0c, 0x20, 0x47, 0x1b, 
-0xba, 0x18, 0x23, 0x19, 0x14, 0x13, 0x05, 0x0c, 0x52, 0x0a, 0xca, 0x04, 0xb7, 0xfc, 0x3c, 0xfb, 
-0xa8, 0xfa, 0x8e, 0xf9, 0xd7, 0xf9, 0x29, 0xfc, 0x22, 0xfe, 0x37, 0x00, 0xf0, 0x01, 0x2a, 0x05, 
-0x6e, 0x07, 0x06, 0x07, 0x0f, 0x08, 0x4b, 0x08, 0x61, 0x05, 0x90, 0x02, 0x36, 0xfe, 0x90, 0xf4, 
-0xcf, 0xed, 0x5b, 0xe6, 0xf0, 0xdb, 0x0a, 0xda, 0x63, 0xda, 0x01, 0xde, 0x2c, 0xe5, 0xac, 0xeb, 
-0xa4, 0xf6, 0xc6, 0x01, 0x63, 0x08, 0x36, 0x11, 0x0d, 0x1a, 0x3d, 0x1b, 0xfc, 0x1c, 0xfa, 0x1e, 
-0x97, 0x1b, 0xd5, 0x17, 0xd2, 0x15, 0xdb, 0x10, 0x20, 0x0b, 0x0a, 0x06, 0x72, 0x00, 0x61, 0xfd, 
-0x34, 0xfa, 0x84, 0xfa, 0xca, 0xfb, 0x30, 0xf9, 0x28, 0xfd, 0x06, 0x01, 0xe0, 0xfd, 0x0a, 0x02, 
-0x21, 0x07, 0x22, 0x03, 0xd9, 0x03, 0x4c, 0x07, 0x79, 0x03, 0x99, 0xfe, 0x76, 0xfd, 0xac, 0xf5, 
-0x2d, 0xec, 0xcf, 0xe7, 0x5b, 0xdc, 0x50, 0xdb, 0xaf, 0xe0, 0x1b, 0xdf, 0xcc, 0xe7, 0x09, 0xf3, 
-0x37, 0xf7, 0x94, 0x00, 0x22, 0x0c, 0xa2, 0x10, 0x3c, 0x15, 0x99, 0x1c, 0x4d, 0x1c, 0x92, 0x19, 
-0xa3, 0x1b, 0xad, 0x19, 0x17, 0x14, 0x85, 0x11, 0x16, 0x0d, 0x8a, 0x04, 0x76, 0x00, 0x93, 0xff, 
-0x18, 0xfb, 0x97, 0xfa, 0x4e, 0xfc, 0xf2, 0xf9, 0xca, 0xfc, 0x97, 0xfe, 0x27, 0xfe, 0x5a, 0x01, 
-0xc5, 0x03, 0xcc, 0x03, 0xa5, 0x03, 0x36, 0x04, 0x63, 0x02, 0xf1, 0xfe, 0x0d, 0xfa, 0x93, 0xf1, 
-0x05, 0xeb, 0x0d, 0xe3, 0x2b, 0xdd, 0xb7, 0xdf, 0xcd, 0xe0, 0x39, 0xe3, 0x7c, 0xee, 0x9e, 0xf5, 
-0xc1, 0xf9, 0xb5, 0x06, 0x6f, 0x0e, 0xc3, 0x0f, 0x8c, 0x19, 0x90, 0x1c, 0xce, 0x18, 0x02, 0x1d, 
-0x52, 0x1b, 0x2b, 0x15, 0x34, 0x15, 0xd7, 0x0f, 0x92, 0x06, 0x64, 0x04, 0x59, 0x01, 0x48, 0xfd, 
-0x9c, 0xfc, 0x04, 0xfc, 0x65, 0xfa, 0x78, 0xfb, 0x38, 0xfc, 0x84, 0xfc, 0x16, 0xff, 0x4a, 0x01, 
-0xca, 0x02, 0xfd, 0x03, 0xf6, 0x03, 0x0d, 0x02, 0x77, 0x00, 0xea, 0xfa, 0x0f, 0xf3, 0xa1, 0xed, 
-0x60, 0xe4, 0xe9, 0xdf, 0x27, 0xe1, 0x80, 0xe1, 0x23, 0xe5, 0xf4, 0xea, 0x4a, 0xf3, 0xe4, 0xf9, 
-0x8b, 0x00, 0xea, 0x09, 0x83, 0x0f, 0x01, 0x15, 0xfb, 0x18, 0x0c, 0x1a, 0x99, 0x1b, 0x46, 0x1b, 
-0x8d, 0x18, 0xe2, 0x14, 0xaa, 0x10, 0xcd, 0x0a, 0xac, 0x06, 0x54, 0x04, 0x1b, 0x01, 0x5d, 0xff, 
-0x45, 0xfe, 0x62, 0xfc, 0xc1, 0xfb, 0x03, 0xfc, 0xde, 0xfc, 0xaa, 0xfd, 0x19, 0xff, 0x5f, 0x00, 
-0x6b, 0x01, 0x2e, 0x02, 0xe9, 0xff, 0x84, 0xfd, 0x9c, 0xf7, 0xbb, 0xf1, 0x18, 0xeb, 0x62, 0xe4, 
-0x3e, 0xe4, 0xc5, 0xe2, 0x7c, 0xe4, 0x4a, 0xeb, 0xbd, 0xee, 0x83, 0xf4, 0x3d, 0xfd, 0xb9, 0x02, 
-0x32, 0x09, 0xff, 0x0f, 0x06, 0x14, 0x02, 0x17, 0xba, 0x18, 0x5f, 0x19, 0xbd, 0x18, 0x65, 0x16, 
-0x62, 0x13, 0x7b, 0x0e, 0xd4, 0x09, 0xb9, 0x06, 0x12, 0x04, 0x35, 0x02, 0x1e, 0x00, 0x56, 0xfe, 
-0x88, 0xfd, 0x0f, 0xfc, 0x90, 0xfc, 0xe8, 0xfc, 0x37, 0xfd, 0x9d, 0xff, 0x0f, 0x00, 0xdf, 0x00, 
-0xb2, 0x00, 0x5c, 0xfd, 0x76, 0xf9, 0xc2, 0xf3, 0xc2, 0xed, 0x25, 0xe6, 0x08, 0xe4, 0x59, 0xe3, 
-0x6e, 0xe3, 0x7e, 0xe9, 0x07, 0xee, 0xab, 0xf3, 0x6e, 0xf9, 0x3a, 0x01, 0x77, 0x07, 0x7a, 0x0c, 
-0xba, 0x12, 0xde, 0x14, 0x41, 0x17, 0xe2, 0x19, 0xa4, 0x19, 0x8e, 0x18, 0xb0, 0x16, 0x02, 0x12, 
-0x00, 0x0d, 0x70, 0x09, 0xdf, 0x05, 0xc1, 0x03, 0x14, 0x01, 0xfb, 0xfe, 0x86, 0xfe, 0xf8, 0xfb, 
-0x24, 0xfc, 0x50, 0xfd, 0x49, 0xfc, 0xc2, 0xfe, 0x4a, 0x00, 0x2d, 0xff, 0x96, 0xff, 0xb0, 0xfd, 
-0x97, 0xf7, 0x12, 0xf3, 0xff, 0xec, 0xeb, 0xe4, 0x14, 0xe4, 0x74, 0xe3, 0xa7, 0xe3, 0xc9, 0xea, 
-0x68, 0xee, 0xbe, 0xf2, 0xb3, 0xfa, 0xfd, 0xff, 0xa1, 0x05, 0x90, 0x0c, 0x8b, 0x10, 0xec, 0x12, 
-0xa8, 0x17, 0xbb, 0x18, 0x05, 0x19, 0x80, 0x19, 0x06, 0x16, 0x9e, 0x11, 0x06, 0x0e, 0x58, 0x09, 
-0x7d, 0x05, 0x82, 0x04, 0x67, 0x00, 0xbb, 0xfe, 0x11, 0xfe, 0x63, 0xfc, 0x91, 0xfc, 0x2a, 0xfd, 
-0x2f, 0xfe, 0x6e, 0xfe, 0x34, 0x00, 0x8f, 0x00, 0xd1, 0xfe, 0x70, 0xfc, 0x9b, 0xf7, 0x0f, 0xf2, 
-0x0f, 0xeb, 0x2a, 0xe8, 0x40, 0xe6, 0x2f, 0xe4, 0x1e, 0xea, 0x79, 0xec, 0x69, 0xef, 0x94, 0xf7, 
-0x24, 0xfb, 0x6c, 0x01, 0x7b, 0x08, 0xc9, 0x0b, 0xc6, 0x10, 0x98, 0x13, 0x99, 0x15, 0xa1, 0x17, 
-0xd8, 0x16, 0x49, 0x15, 0x99, 0x12, 0x60, 0x0e, 0x01, 0x0b, 0x9b, 0x07, 0xa9, 0x04, 0xe6, 0x01, 
-0xf8, 0xff, 0xa4, 0xfe, 0x5d, 0xfd, 0x60, 0xfd, 0x99, 0xfd, 0x18, 0xfd, 0xcb, 0xfd, 0x06, 0xff, 
-0xd3, 0xfe, 0x3a, 0xff, 0x0f, 0xfd, 0xd6, 0xf8, 0x53, 0xf4, 0xb8, 0xed, 0x2e, 0xe9, 0x57, 0xe7, 
-0xdf, 0xe5, 0xee, 0xe7, 0x15, 0xec, 0xeb, 0xf0, 0xce, 0xf4, 0xfd, 0xfb, 0xfe, 0x01, 0x73, 0x06, 
-0x6d, 0x0d, 0x79, 0x10, 0x8e, 0x13, 0x33, 0x17, 0x71, 0x18, 0xc8, 0x17, 0xc3, 0x16, 0x92, 0x13, 
-0xc2, 0x0e, 0xa9, 0x0b, 0xf8, 0x07, 0x79, 0x04, 0x50, 0x02, 0x62, 0xff, 0x43, 0xfd, 0x9c, 0xfc, 
-0x2a, 0xfb, 0xcc, 0xfa, 0x8c, 0xfc, 0x77, 0xfc, 0xa8, 0xfd, 0xaf, 0xff, 0x2b, 0xfe, 0x43, 0xfc, 
-0xb3, 0xf9, 0x0e, 0xf3, 0xae, 0xed, 0x16, 0xea, 0xf9, 0xe6, 0xf4, 0xe6, 0x08, 0xea, 0x38, 0xed, 
-0x58, 0xf1, 0xbc, 0xf7, 0x08, 0xfc, 0x97, 0x02, 0x7c, 0x08, 0xab, 0x0c, 0xa1, 0x11, 0x6f, 0x14, 
-0x1d, 0x17, 0x7b, 0x18, 0xa3, 0x17, 0x01, 0x16, 0x1f, 0x12, 0x1f, 0x0e, 0x9c, 0x0a, 0xc1, 0x06, 
-0xf4, 0x02, 0xd6, 0x00, 0x2e, 0xfd, 0xea, 0xfa, 0x0b, 0xfb, 0xdf, 0xf8, 0xd3, 0xf9, 0x7f, 0xfa, 
-0xf0, 0xfa, 0x33, 0xfc, 0x55, 0xfd, 0xfb, 0xfb, 0xfc, 0xf9, 0x66, 0xf6, 0xac, 0xf1, 0xf6, 0xed, 
-0x2a, 0xea, 0x0b, 0xeb, 0xc0, 0xea, 0x5b, 0xee, 0x53, 0xf3, 0xe2, 0xf5, 0x14, 0xfc, 0xed, 0x01, 
-0x86, 0x06, 0x97, 0x0c, 0xec, 0x10, 0xb4, 0x13, 0xe4, 0x16, 0x26, 0x19, 0xef, 0x18, 0x65, 0x18, 
-0x8d, 0x15, 0x76, 0x10, 0xdf, 0x0c, 0xf9, 0x07, 0x99, 0x04, 0xb1, 0x01, 0xed, 0xfd, 0xc2, 0xfb, 
-0xfa, 0xf9, 0x9a, 0xf7, 0x34, 0xf7, 0x3a, 0xf7, 0x8e, 0xf6, 0xc0, 0xf7, 0xb6, 0xf8, 0x92, 0xf8, 
-0x0d, 0xf7, 0x7e, 0xf4, 0x90, 0xf0, 0x2a, 0xec, 0xa6, 0xea, 0x52, 0xeb, 0x1e, 0xec, 0x57, 0xf1, 
-0x3d, 0xf5, 0x27, 0xf8, 0x8f, 0xfe, 0xa3, 0x03, 0x91, 0x08, 0x62, 0x0d, 0xfa, 0x11, 0xd2, 0x13, 
-0xc1, 0x17, 0x6d, 0x19, 0x56, 0x19, 0x37, 0x19, 0x05, 0x15, 0x89, 0x10, 0x07, 0x0c, 0x23, 0x07, 
-0xaf, 0x03, 0x36, 0x01, 0xc2, 0xfd, 0x1c, 0xfc, 0xaa, 0xfa, 0xed, 0xf7, 0xc9, 0xf7, 0x29, 0xf7, 
-0x31, 0xf6, 0x07, 0xf7, 0xef, 0xf6, 0x82, 0xf6, 0xf6, 0xf3, 0x6a, 0xf1, 0xd2, 0xec, 0x4c, 0xe9, 
-0x5d, 0xe9, 0x8f, 0xe9, 0x66, 0xed, 0x14, 0xf2, 0x71, 0xf6, 0x85, 0xfb, 0xc3, 0x01, 0x47, 0x07, 
-0x02, 0x0c, 0x36, 0x11, 0x36, 0x14, 0x5c, 0x17, 0xe0, 0x1a, 0x2e, 0x1b, 0x45, 0x1b, 0x6b, 0x19, 
-0xd4, 0x14, 0xff, 0x10, 0xd3, 0x0b, 0xad, 0x07, 0x4a, 0x04, 0xd4, 0xff, 0xe0, 0xfc, 0x4e, 0xfa, 
-0x78, 0xf7, 0xef, 0xf5, 0xd1, 0xf4, 0x83, 0xf3, 0x4e, 0xf3, 0x17, 0xf3, 0xb5, 0xf2, 0x21, 0xf1, 
-0x17, 0xef, 0x81, 0xeb, 0xd6, 0xe7, 0xde, 0xe7, 0xd4, 0xe7, 0x9b, 0xeb, 0xe6, 0xf0, 0x9e, 0xf5, 
-0xbf, 0xfb, 0x95, 0x01, 0xf7, 0x07, 0x8e, 0x0d, 0xe6, 0x11, 0x7e, 0x15, 0x97, 0x18, 0xc6, 0x1b, 
-0x38, 0x1d, 0xc2, 0x1d, 0x60, 0x1c, 0x92, 0x17, 0x0d, 0x14, 0x11, 0x0f, 0xbd, 0x09, 0x39, 0x07, 
-0x46, 0x02, 0x14, 0xfe, 0x47, 0xfb, 0xd9, 0xf7, 0x31, 0xf6, 0x41, 0xf4, 0xa6, 0xf3, 0x8b, 0xf2, 
-0xfc, 0xf1, 0x1f, 0xf2, 0x96, 0xef, 0xd3, 0xed, 0xb9, 0xe9, 0x17, 0xe6, 0x59, 0xe5, 0xb5, 0xe4, 
-0x84, 0xe9, 0xb1, 0xed, 0x1c, 0xf2, 0x7e, 0xfa, 0x77, 0xff, 0x44, 0x06, 0x91, 0x0d, 0xfd, 0x10, 
-0x07, 0x15, 0x0e, 0x19, 0x46, 0x1b, 0xf7, 0x1d, 0xb4, 0x1e, 0x3a, 0x1c, 0xa5, 0x19, 0x85, 0x14, 
-0x65, 0x0f, 0x79, 0x0b, 0xb4, 0x06, 0xee, 0x02, 0xca, 0xff, 0xed, 0xfb, 0xeb, 0xf9, 0x1b, 0xf8, 
-0x67, 0xf5, 0xae, 0xf4, 0x3a, 0xf3, 0xf6, 0xf1, 0x7e, 0xf1, 0xb4, 0xee, 0xf5, 0xeb, 0x75, 0xe8, 
-0x5d, 0xe4, 0x0e, 0xe5, 0xca, 0xe5, 0x10, 0xe9, 0xb9, 0xef, 0x74, 0xf3, 0xa0, 0xfa, 0x10, 0x02, 
-0x44, 0x07, 0x8b, 0x0e, 0xba, 0x12, 0xac, 0x15, 0x1a, 0x1a, 0x66, 0x1c, 0xdf, 0x1d, 0x9f, 0x1e, 
-0xc8, 0x1b, 0xaf, 0x17, 0x5d, 0x13, 0x24, 0x0e, 0x64, 0x09, 0xd7, 0x05, 0x57, 0x01, 0xb5, 0xfd, 
-0xdd, 0xfb, 0x73, 0xf8, 0xf7, 0xf6, 0xa0, 0xf5, 0xca, 0xf2, 0x35, 0xf2, 0x32, 0xf1, 0xe8, 0xed, 
-0x98, 0xec, 0x2b, 0xe9, 0x50, 0xe4, 0x42, 0xe5, 0x94, 0xe4, 0xdb, 0xe6, 0xa0, 0xed, 0xfc, 0xef, 
-0x49, 0xf7, 0x84, 0xff, 0x47, 0x04, 0x25, 0x0d, 0x2c, 0x12, 0xd7, 0x14, 0x77, 0x1a, 0x2b, 0x1c, 
-0x1c, 0x1e, 0xe5, 0x1f, 0x5a, 0x1c, 0x48, 0x19, 0x15, 0x15, 0xf5, 0x0e, 0x3e, 0x0b, 0xb0, 0x06, 
-0x44, 0x02, 0x3a, 0xff, 0x6e, 0xfb, 0xad, 0xf9, 0x4a, 0xf7, 0x1a, 0xf5, 0xf9, 0xf3, 0x65, 0xf2, 
-0x33, 0xf1, 0x38, 0xef, 0xfd, 0xec, 0xec, 0xe8, 0xa5, 0xe6, 0x22, 0xe5, 0xb3, 0xe4, 0xce, 0xe8, 
-0x1b, 0xec, 0x8f, 0xf0, 0xc2, 0xf7, 0xb5, 0xfd, 0xbf, 0x04, 0x70, 0x0c, 0xba, 0x10, 0x12, 0x15, 
-0x48, 0x19, 0x59, 0x1b, 0x0c, 0x1e, 0xc2, 0x1e, 0xd6, 0x1b, 0x26, 0x19, 0x39, 0x14, 0x79, 0x0e, 
-0xb7, 0x0b, 0x12, 0x06, 0x38, 0x02, 0x9a, 0xff, 0x85, 0xfa, 0x80, 0xf9, 0x11, 0xf7, 0x20, 0xf4, 
-0x19, 0xf4, 0xc4, 0xf1, 0x47, 0xf0, 0x89, 0xef, 0xce, 0xeb, 0x32, 0xe9, 0x3d, 0xe7, 0x04, 0xe5, 
-0xd1, 0xe6, 0x34, 0xea, 0x72, 0xed, 0x87, 0xf3, 0xd8, 0xf9, 0xe9, 0xfe, 0x02, 0x07, 0x16, 0x0d, 
-0xb0, 0x10, 0x36, 0x16, 0x9e, 0x18, 0x21, 0x1b, 0x6e, 0x1e, 0x9f, 0x1d, 0xc1, 0x1b, 0x98, 0x18, 
-0xd5, 0x12, 0x3e, 0x0e, 0xd3, 0x09, 0xd5, 0x04, 0x41, 0x01, 0x31, 0xfd, 0x2b, 0xfa, 0x3b, 0xf8, 
-0xba, 0xf5, 0xde, 0xf3, 0x26, 0xf2, 0x0b, 0xf0, 0x8b, 0xee, 0xcf, 0xec, 0xb4, 0xe9, 0xed, 0xe7, 
-0x55, 0xe6, 0x30, 0xe6, 0x61, 0xe9, 0x6b, 0xec, 0x73, 0xf1, 0x37, 0xf7, 0x47, 0xfc, 0x42, 0x03, 
-0x99, 0x09, 0xc6, 0x0e, 0xae, 0x13, 0xfd, 0x16, 0x78, 0x19, 0x48, 0x1c, 0x5d, 0x1d, 0x29, 0x1c, 
-0x0a, 0x1a, 0xb3, 0x15, 0x71, 0x10, 0x45, 0x0c, 0xca, 0x07, 0x81, 0x03, 0xe2, 0xff, 0x5b, 0xfc, 
-0xdd, 0xf9, 0xce, 0xf7, 0x96, 0xf5, 0x9d, 0xf3, 0x3c, 0xf1, 0x2c, 0xef, 0x33, 0xed, 0xe6, 0xea, 
-0xd3, 0xe8, 0xf7, 0xe6, 0xa0, 0xe6, 0x5b, 0xe8, 0x69, 0xeb, 0x6e, 0xef, 0x5d, 0xf4, 0xbc, 0xf9, 
-0x6c, 0xff, 0x9e, 0x05, 0xab, 0x0b, 0xc4, 0x10, 0x8e, 0x14, 0xb6, 0x17, 0x52, 0x1a, 0xc7, 0x1b, 
-0xf1, 0x1b, 0x57, 0x1a, 0xd7, 0x16, 0xb8, 0x12, 0xcb, 0x0e, 0xc4, 0x0a, 0x44, 0x07, 0xf1, 0x03, 
-0x5d, 0x00, 0x66, 0xfd, 0x8f, 0xfa, 0xd0, 0xf7, 0x65, 0xf5, 0xc3, 0xf2, 0x29, 0xf0, 0xa7, 0xed, 
-0x48, 0xeb, 0x95, 0xe8, 0x3e, 0xe6, 0x31, 0xe5, 0x33, 0xe5, 0x6c, 0xe7, 0xd7, 0xea, 0xf4, 0xee, 
-0xba, 0xf4, 0x91, 0xfa, 0xf6, 0x00, 0xdf, 0x07, 0x72, 0x0d, 0x74, 0x12, 0xf0, 0x16, 0x69, 0x1a, 
-0x22, 0x1d, 0x52, 0x1e, 0xb8, 0x1d, 0x6d, 0x1b, 0xab, 0x17, 0x89, 0x13, 0x59, 0x0f, 0x7c, 0x0b, 
-0xc7, 0x07, 0xd6, 0x03, 0x4c, 0x00, 0x89, 0xfc, 0xb9, 0xf8, 0x70, 0xf5, 0x35, 0xf2, 0x10, 0xef, 
-0x01, 0xec, 0x72, 0xe9, 0xe5, 0xe6, 0x23, 0xe4, 0x9a, 0xe2, 0xfd, 0xe2, 0xd9, 0xe4, 0x26, 0xe8, 
-0xf1, 0xec, 0xd0, 0xf2, 0x9f, 0xf9, 0xd6, 0x00, 0xf7, 0x07, 0x75, 0x0e, 0x02, 0x14, 0xc1, 0x18, 
-0xd1, 0x1c, 0xb5, 0x1f, 0xb7, 0x20, 0x87, 0x20, 0x2a, 0x1e, 0xc1, 0x19, 0x5a, 0x15, 0x55, 0x10, 
-0x8a, 0x0b, 0x86, 0x07, 0xe6, 0x02, 0xb0, 0xfe, 0x01, 0xfb, 0x0c, 0xf7, 0x63, 0xf3, 0xd4, 0xef, 
-0x73, 0xec, 0x8a, 0xe9, 0x01, 0xe7, 0x9b, 0xe4, 0x80, 0xe2, 0x65, 0xe1, 0xdb, 0xe1, 0x44, 0xe4, 
-0x0c, 0xe8, 0x50, 0xed, 0xcd, 0xf3, 0x96, 0xfa, 0x1b, 0x02, 0x92, 0x09, 0x0d, 0x10, 0xdf, 0x15, 
-0xac, 0x1a, 0x59, 0x1e, 0xe8, 0x20, 0xcb, 0x21, 0x02, 0x21, 0x77, 0x1e, 0x06, 0x1a, 0xce, 0x14, 
-0xc5, 0x0f, 0xb3, 0x0a, 0xe0, 0x05, 0x89, 0x01, 0x61, 0xfd, 0xa5, 0xf9, 0x65, 0xf6, 0x26, 0xf3, 
-0xd6, 0xef, 0xbe, 0xec, 0xc3, 0xe9, 0x22, 0xe7, 0xc9, 0xe4, 0xcb, 0xe2, 0xfd, 0xe1, 0xba, 0xe2, 
-0x18, 0xe5, 0x0d, 0xe9, 0x77, 0xee, 0x9f, 0xf4, 0x34, 0xfb, 0x2f, 0x02, 0x1e, 0x09, 0xe6, 0x0f, 
-0x90, 0x15, 0xf6, 0x19, 0xd5, 0x1d, 0x26, 0x20, 0xe8, 0x20, 0x53, 0x20, 0x91, 0x1d, 0x6c, 0x19, 
-0xa7, 0x14, 0x78, 0x0f, 0x94, 0x0a, 0xe6, 0x05, 0x28, 0x01, 0xf2, 0xfc, 0x42, 0xf9, 0xb9, 0xf5, 
-0x90, 0xf2, 0x9c, 0xef, 0x76, 0xec, 0xa8, 0xe9, 0x53, 0xe7, 0xf2, 0xe4, 0x54, 0xe3, 0xd6, 0xe2, 
-0xb7, 0xe3, 0x7d, 0xe6, 0x86, 0xea, 0x8b, 0xef, 0xb9, 0xf5, 0x42, 0xfc, 0x0d, 0x03, 0x3d, 0x0a, 
-0x7f, 0x10, 0xc6, 0x15, 0x3e, 0x1a, 0x81, 0x1d, 0x9a, 0x1f, 0x53, 0x20, 0x6f, 0x1f, 0xaf, 0x1c, 
-0x55, 0x18, 0x84, 0x13, 0xa9, 0x0e, 0xd0, 0x09, 0x25, 0x05, 0x83, 0x00, 0x83, 0xfc, 0xea, 0xf8, 
-0x7d, 0xf5, 0x7e, 0xf2, 0x77, 0xef, 0x8a, 0xec, 0xdc, 0xe9, 0x27, 0xe7, 0xd6, 0xe4, 0x52, 0xe3, 
-0xdf, 0xe2, 0x1f, 0xe4, 0xce, 0xe6, 0xe2, 0xea, 0x65, 0xf0, 0xac, 0xf6, 0x6e, 0xfd, 0x82, 0x04, 
-0x5f, 0x0b, 0x55, 0x11, 0x00, 0x16, 0xa4, 0x19, 0x59, 0x1c, 0x92, 0x1d, 0x6c, 0x1d, 0x9c, 0x1b, 
-0x1e, 0x18, 0x04, 0x14, 0x63, 0x0f, 0x95, 0x0a, 0x78, 0x06, 0xca, 0x02, 0x3d, 0xff, 0xf4, 0xfb, 
-0x03, 0xf9, 0x84, 0xf6, 0x12, 0xf4, 0x25, 0xf2, 0x6a, 0xf0, 0x44, 0xee, 0x7c, 0xec, 0x55, 0xea, 
-0x4c, 0xe8, 0x95, 0xe8, 0xae, 0xea, 0xc9, 0xed, 0x52, 0xf2, 0xfa, 0xf6, 0x6b, 0xfc, 0x25, 0x03, 
-0x93, 0x08, 0xdb, 0x0c, 0xce, 0x10, 0xa4, 0x13, 0x0b, 0x16, 0x29, 0x18, 0xc1, 0x18, 0xbf, 0x17, 
-0xb8, 0x15, 0x5c, 0x13, 0x37, 0x10, 0x60, 0x0c, 0xa6, 0x08, 0xc7, 0x04, 0x37, 0x01, 0x1c, 0xfe, 
-0xb2, 0xfa, 0x46, 0xf7, 0x5b, 0xf4, 0xfb, 0xf1, 0xdd, 0xef, 0xeb, 0xed, 0x28, 0xec, 0x23, 0xea, 
-0x60, 0xe8, 0xf6, 0xe7, 0x47, 0xe9, 0x00, 0xec, 0xe5, 0xef, 0xb3, 0xf4, 0xbe, 0xf9, 0x63, 0xff, 
-0x5c, 0x05, 0x39, 0x0a, 0x7b, 0x0e, 0x1e, 0x12, 0xa6, 0x14, 0xd8, 0x16, 0x0f, 0x18, 0x5a, 0x18, 
-0x6b, 0x17, 0xad, 0x14, 0x8f, 0x11, 0x6e, 0x0e, 0xf0, 0x0a, 0x46, 0x07, 0x61, 0x03, 0xa1, 0xff, 
-0x71, 0xfc, 0x69, 0xf9, 0x78, 0xf6, 0xf6, 0xf3, 0xf6, 0xf1, 0x12, 0xf0, 0x7c, 0xee, 0xba, 0xec, 
-0x8c, 0xea, 0x9e, 0xe9, 0xe5, 0xe9, 0x5e, 0xeb, 0x29, 0xee, 0xfc, 0xf1, 0xf1, 0xf6, 0x43, 0xfc, 
-0x53, 0x01, 0x3d, 0x06, 0xf5, 0x0a, 0x33, 0x0f, 0x90, 0x12, 0x2e, 0x15, 0xe1, 0x16, 0x2b, 0x17, 
-0x9b, 0x17, 0x79, 0x16, 0x79, 0x12, 0xed, 0x0e, 0xcc, 0x0b, 0x21, 0x08, 0xb0, 0x04, 0xdd, 0x00, 
-0xd5, 0xfc, 0xb5, 0xf9, 0x55, 0xf7, 0x6d, 0xf5, 0x7e, 0xf3, 0xe6, 0xf1, 0x0e, 0xf1, 0x3a, 0xf0, 
-0x1f, 0xef, 0xbe, 0xed, 0x22, 0xed, 0xa4, 0xed, 0x16, 0xef, 0xb2, 0xf1, 0x27, 0xf5, 0x08, 0xf9, 
-0x4e, 0xfd, 0xd9, 0x01, 0x1e, 0x06, 0xc7, 0x09, 0x18, 0x0d, 0x12, 0x10, 0x4e, 0x12, 0xab, 0x13, 
-0x4d, 0x14, 0x67, 0x14, 0x1d, 0x13, 0x77, 0x10, 0xbc, 0x0d, 0xb2, 0x0a, 0xba, 0x07, 0x00, 0x05, 
-0x8f, 0x01, 0x5f, 0xfe, 0x8f, 0xfb, 0xfa, 0xf8, 0x59, 0xf7, 0x8c, 0xf5, 0xad, 0xf3, 0x66, 0xf2, 
-0xea, 0xf0, 0x8b, 0xef, 0x70, 0xee, 0x9b, 0xed, 0x94, 0xed, 0x6f, 0xee, 0xb0, 0xf0, 0xca, 0xf3, 
-0x20, 0xf7, 0x56, 0xfb, 0xeb, 0xff, 0x5b, 0x04, 0xb0, 0x08, 0x7c, 0x0c, 0xd4, 0x0f, 0x8b, 0x12, 
-0x47, 0x14, 0x5e, 0x15, 0x39, 0x15, 0xf7, 0x13, 0x23, 0x12, 0x26, 0x0f, 0xe4, 0x0b, 0xb9, 0x08, 
-0x43, 0x05, 0xf0, 0x01, 0xd2, 0xfe, 0xb0, 0xfb, 0x04, 0xf9, 0x11, 0xf7, 0x91, 0xf5, 0x59, 0xf4, 
-0x5d, 0xf3, 0xb7, 0xf2, 0x11, 0xf2, 0xad, 0xf1, 0x05, 0xf1, 0x71, 0xf0, 0xe0, 0xf0, 0xd2, 0xf1, 
-0xa3, 0xf3, 0x0f, 0xf6, 0xdc, 0xf8, 0x63, 0xfc, 0xfb, 0xff, 0x5f, 0x03, 0xbf, 0x06, 0xe6, 0x09, 
-0xae, 0x0c, 0xd7, 0x0e, 0x9f, 0x10, 0xc4, 0x11, 0xcd, 0x11, 0x3e, 0x11, 0xf7, 0x0f, 0xf9, 0x0d, 
-0xb1, 0x0b, 0x1a, 0x09, 0x6e, 0x06, 0xce, 0x03, 0xd2, 0x00, 0x33, 0xfe, 0xbb, 0xfb, 0x73, 0xf9, 
-0xdb, 0xf7, 0x4d, 0xf6, 0x6a, 0xf5, 0xb9, 0xf4, 0xde, 0xf3, 0x2b, 0xf3, 0x6c, 0xf2, 0x26, 0xf2, 
-0x37, 0xf2, 0xbd, 0xf2, 0x06, 0xf4, 0x12, 0xf6, 0x6c, 0xf8, 0x07, 0xfb, 0xed, 0xfd, 0xbc, 0x00, 
-0x76, 0x03, 0x1a, 0x06, 0xb6, 0x08, 0xf5, 0x0a, 0xac, 0x0c, 0x10, 0x0e, 0xb7, 0x0e, 0xa3, 0x0e, 
-0x2c, 0x0e, 0xb7, 0x0c, 0xff, 0x0a, 0x0b, 0x09, 0xf2, 0x06, 0xb4, 0x04, 0x7c, 0x02, 0x81, 0x00, 
-0x7b, 0xfe, 0xb9, 0xfc, 0x4c, 0xfb, 0x09, 0xfa, 0xd9, 0xf8, 0x1a, 0xf8, 0x81, 0xf7, 0xe6, 0xf6, 
-0x8f, 0xf6, 0x91, 0xf6, 0xa0, 0xf6, 0xfd, 0xf6, 0xe8, 0xf7, 0xf0, 0xf8, 0x46, 0xfa, 0xd5, 0xfb, 
-0x38, 0xfd, 0xf2, 0xfe, 0x80, 0x00, 0xd2, 0x01, 0x23, 0x03, 0x24, 0x04, 0xdb, 0x04, 0x6c, 0x05, 
-0x10, 0x06, 0x63, 0x06, 0x8c, 0x06, 0xd6, 0x06, 0xa8, 0x06, 0x64, 0x06, 0x52, 0x06, 0xa3, 0x05, 
-0xf6, 0x04, 0x72, 0x04, 0x88, 0x03, 0xa4, 0x02, 0xeb, 0x01, 0xfa, 0x00, 0xcf, 0xff, 0x92, 0xfe, 
-0x8b, 0xfd, 0x82, 0xfc, 0xd5, 0xfb, 0x5f, 0xfb, 0x96, 0xfa, 0x7b, 0xfa, 0x93, 0xfa, 0x46, 0xfa, 
-0x81, 0xfa, 0xf0, 0xfa, 0x51, 0xfb, 0x9c, 0xfb, 0x6e, 0xfc, 0x7c, 0xfd, 0x2e, 0xfe, 0x3f, 0xff, 
-0x1b, 0x00, 0x84, 0x00, 0xc2, 0x00, 0x92, 0x01, 0xe1, 0x01, 0x32, 0x02, 0xb1, 0x02, 0xe8, 0x02, 
-0x1f, 0x03, 0x8e, 0x03, 0x9b, 0x03, 0x3a, 0x03, 0x27, 0x03, 0xd1, 0x02, 0x51, 0x02, 0xdc, 0x01, 
-0x6d, 0x01, 0xc2, 0x00, 0xdf, 0x00, 0xaf, 0x00, 0xde, 0xff, 0xb3, 0xff, 0x80, 0xff, 0xd9, 0xfe, 
-0x8d, 0xfe, 0x69, 0xfe, 0x2f, 0xfe, 0x63, 0xfe, 0xb3, 0xfe, 0x27, 0xff, 0xcd, 0xfe, 0xac, 0xfe, 
-0xa9, 0xfe, 0x44, 0xfe, 0x64, 0xfe, 0x40, 0xfe, 0x79, 0xfe, 0x5f, 0xfe, 0xe3, 0xfe, 0xcd, 0xff, 
-0x14, 0x00, 0x8c, 0x00, 0xf6, 0x00, 0x08, 0x01, 0xf7, 0x00, 0x7d, 0x01, 0x7b, 0x01, 0x3c, 0x01, 
-0x52, 0x01, 0x55, 0x01, 0xb4, 0x00, 0xac, 0x00, 0xf0, 0x00, 0x46, 0x00, 0xfd, 0xff, 0x1b, 0x00, 
-0xf1, 0xff, 0xa2, 0xff, 0xb8, 0xff, 0x4d, 0xff, 0x2a, 0xff, 0xbb, 0xff, 0xb8, 0xff, 0x6c, 0xff, 
-0x78, 0xff, 0xbe, 0xff, 0xb0, 0xff, 0xb2, 0xff, 0x22, 0x00, 0xdd, 0xff, 0xc2, 0xff, 0x24, 0x00, 
-0xcf, 0xff, 0x38, 0xff, 0x91, 0xff, 0xc2, 0xff, 0x1f, 0xff, 0x84, 0xff, 0x1c, 0x00, 0x2c, 0x00, 
-0xc6, 0x00, 0x4a, 0x01, 0x22, 0x01, 0x33, 0x01, 0x6f, 0x01, 0x2d, 0x01, 0x0f, 0x01, 0xd3, 0x00, 
-0x77, 0x00, 0xcc, 0x00, 0x15, 0x01, 0x90, 0x00, 0x6a, 0x00, 0xc3, 0x00, 0xbf, 0x00, 0xb9, 0x00, 
-0xb3, 0x00, 0x41, 0x00, 0x08, 0x00, 0x11, 0x00, 0xe4, 0xff, 0xca, 0xff, 0xa0, 0xff, 0x88, 0xff, 
-0x74, 0xff, 0x80, 0xff, 0x6f, 0xff, 0x83, 0xff, 0xa2, 0xff, 0xb1, 0xff, 0xcc, 0xff, 0xe9, 0xff, 
-0x25, 0x00, 0xf6, 0xff, 0xfb, 0xff, 0xdc, 0xff, 0xa1, 0xff, 0xab, 0xff, 0x76, 0xff, 0x47, 0xff, 
-0x76, 0xff, 0x96, 0xff, 0xd3, 0xff, 0xef, 0xff, 0xa1, 0xff, 0xab, 0xff, 0xa0, 0xff, 0x47, 0xff, 
-0xe2, 0xfe, 0xa9, 0xfe, 0x7a, 0xfe, 0x7e, 0xfe, 0x0c, 0xff, 0x88, 0xff, 0x2b, 0x00, 0x0b, 0x01, 
-0x5e, 0x01, 0x5f, 0x01, 0x59, 0x01, 0x33, 0x01, 0xd4, 0x00, 0xa0, 0x00, 0xac, 0x00, 0xbd, 0x00, 
-0x2d, 0x01, 0x9a, 0x01, 0xdd, 0x01, 0xa7, 0x01, 0x61, 0x01, 0xbc, 0x00, 0x85, 0xff, 0x03, 0xff, 
-0xf5, 0xfe, 0xa3, 0xfe, 0x3b, 0xfe, 0x23, 0xfe, 0xff, 0xfd, 0xec, 0xfd, 0xf0, 0xfd, 0x2c, 0xfe, 
-0xea, 0xfd, 0x4c, 0xfd, 0x61, 0xfd, 0xd9, 0xfd, 0x4d, 0xfe, 0x67, 0xfe, 0x85, 0xfe, 0x1a, 0xfe, 
-0xdc, 0xfd, 0x98, 0xfe, 0x01, 0xff, 0x5f, 0xff, 0x08, 0x00, 0x39, 0x00, 0x70, 0x00, 0x48, 0x01, 
-0xf2, 0x01, 0x06, 0x02, 0xe4, 0x01, 0xa1, 0x01, 0x63, 0x01, 0xd3, 0x01, 0x75, 0x02, 0xa5, 0x02, 
-0x89, 0x02, 0x68, 0x02, 0x3f, 0x02, 0x31, 0x02, 0x4a, 0x02, 0xa9, 0x01, 0xfa, 0x00, 0xbd, 0x00, 
-0x56, 0x00, 0x2a, 0x00, 0x47, 0x00, 0x00, 0x00, 0x42, 0xff, 0xc0, 0xfe, 0x86, 0xfe, 0x2d, 0xfe, 
-0x1a, 0xfe, 0x08, 0xfe, 0xe6, 0xfd, 0x18, 0xfe, 0x31, 0xfe, 0x72, 0xfe, 0xac, 0xfe, 0x86, 0xfe, 
-0x94, 0xfe, 0xbd, 0xfe, 0xaf, 0xfe, 0xd2, 0xfe, 0x0c, 0xff, 0x1d, 0xff, 0x6f, 0xff, 0x9e, 0xff, 
-0xd8, 0xff, 0x6c, 0x00, 0x8b, 0x00, 0xa5, 0x00, 0x08, 0x01, 0x56, 0x01, 0x46, 0x01, 0x34, 0x01, 
-0x7b, 0x01, 0x66, 0x01, 0x43, 0x01, 0x47, 0x01, 0x32, 0x01, 0xf8, 0x00, 0xb5, 0x00, 0x9b, 0x00, 
-0x63, 0x00, 0x39, 0x00, 0x15, 0x00, 0xd8, 0xff, 0xbb, 0xff, 0x83, 0xff, 0x2e, 0xff, 0x1a, 0xff, 
-0x18, 0xff, 0xcc, 0xfe, 0xb9, 0xfe, 0xcd, 0xfe, 0xa4, 0xfe, 0xe3, 0xfe, 0x01, 0xff, 0xd4, 0xfe, 
-0xe5, 0xfe, 0xe3, 0xfe, 0xe1, 0xfe, 0x02, 0xff, 0x6a, 0xff, 0xc6, 0xff, 0xbb, 0xff, 0xd1, 0xff, 
-0x2b, 0x00, 0x61, 0x00, 0x7c, 0x00, 0xbd, 0x00, 0xc4, 0x00, 0xd0, 0x00, 0x02, 0x01, 0xea, 0x00, 
-0xe7, 0x00, 0x93, 0x00, 0x57, 0x00, 0x3d, 0x00, 0xd3, 0xff, 0xa0, 0xff, 0x8c, 0xff, 0x56, 0xff, 
-0x61, 0xff, 0x29, 0xff, 0x17, 0xff, 0x2e, 0xff, 0x28, 0xff, 0x4c, 0xff, 0x20, 0xff, 0x69, 0xff, 
-0x5f, 0xff, 0x86, 0xff, 0xfb, 0xff, 0x25, 0x00, 0x4c, 0x00, 0x68, 0x00, 0xa9, 0x00, 0xb1, 0x00, 
-0xb6, 0x00, 0xc0, 0x00, 0x89, 0x00, 0x58, 0x00, 0x44, 0x00, 0x2b, 0x00, 0x1e, 0x00, 0xed, 0xff, 
-0xf5, 0xff, 0x03, 0x00, 0xa2, 0xff, 0x96, 0xff, 0xbf, 0xff, 0xa8, 0xff, 0x8e, 0xff, 0x11, 0x00, 
-0xbb, 0xff, 0x10, 0x00, 0x8e, 0x00, 0xf5, 0xff, 0x97, 0x00, 0x1b, 0x01, 0x53, 0x00, 0x2f, 0x01, 
-0x50, 0x01, 0x51, 0x00, 0x23, 0x01, 0xa1, 0x00, 0x34, 0x00, 0x60, 0x00, 0x60, 0x00, 0xaa, 0xff, 
-0xa3, 0xff, 0xc2, 0xff, 0x02, 0xff, 0x29, 0xff, 0xb4, 0xff, 0xe9, 0xfe, 0x1e, 0xff, 0x9e, 0xff, 
-0xc0, 0xfe, 0xbe, 0xff, 0x78, 0x00, 0xa4, 0xff, 0x7b, 0x00, 0xcb, 0x00, 0x4d, 0x00, 0x5f, 0x01, 
-0x5c, 0x00, 0x61, 0x01, 0x6d, 0x01, 0x5b, 0x00, 0x1b, 0x01, 0x94, 0x00, 0x1e, 0x00, 0x9b, 0x00, 
-0x39, 0x00, 0x96, 0x00, 0x9a, 0xff, 0x95, 0x01, 0x9d, 0xff, 0xa9, 0xff, 0xa4, 0x00, 0x18, 0x01, 
-0x49, 0x05, 0x8a, 0xfa, 0x12, 0xff, 0xaa, 0x07, 0xfc, 0xfd, 0x91, 0xfd, 0x67, 0x03, 0x23, 0xfd, 
-0x21, 0xff, 0xdc, 0x01, 0xf6, 0xfd, 0xaa, 0x01, 0xd9, 0xfe, 0x87, 0xfd, 0x7d, 0x08, 0x21, 0xfd, 
-0xec, 0xfc, 0xa1, 0x03, 0x9f, 0xfb, 0x82, 0x02, 0x22, 0x00, 0x95, 0xfd, 0x72, 0x05, 0xb4, 0x04, 
-0x6a, 0xfc, 0xea, 0x02, 0x8e, 0xfc, 0x5d, 0xfd, 0xe0, 0x00, 0xae, 0xfc, 0x9f, 0x00, 0xdd, 0xfc, 
-0xf5, 0xff, 0xf8, 0xfe, 0x65, 0xfe, 0xda, 0x01, 0x27, 0x00, 0x89, 0x00, 0xe7, 0x00, 0xd0, 0xfe, 
-0xc3, 0x00, 0x3e, 0x01, 0x66, 0xfd, 0xcb, 0x00, 0x3e, 0xfe, 0x0c, 0x00, 0xef, 0xfe, 0x9a, 0xfd, 
-0x0a, 0x01, 0xe1, 0xfd, 0x00, 0x02, 0xa9, 0xfe, 0x8c, 0xff, 0xfd, 0xfd, 0x94, 0xfd, 0x70, 0xff, 
-0x8f, 0xfe, 0x7b, 0xff, 0xfa, 0xfe, 0xf0, 0xfe, 0x1b, 0xff, 0x26, 0x00, 0x68, 0xfe, 0xf7, 0x01, 
-0x3f, 0x00, 0x0f, 0x01, 0x80, 0x01, 0xc4, 0xfe, 0xb2, 0x01, 0x50, 0x00, 0xe4, 0xff, 0x47, 0x00, 
-0x98, 0xfe, 0xdd, 0x00, 0xd8, 0xff, 0xc3, 0xff, 0xa4, 0xff, 0x0d, 0x01, 0x6c, 0x00, 0xd9, 0xff, 
-0x19, 0x02, 0x52, 0xff, 0xee, 0x00, 0x09, 0x01, 0x52, 0x00, 0x0b, 0x00, 0xb3, 0x01, 0x7e, 0xff, 
-0x2e, 0x00, 0xe0, 0x00, 0xd4, 0xff, 0x52, 0x00, 0x14, 0x01, 0x81, 0xff, 0xe6, 0xff, 0x6f, 0x01, 
-0x7b, 0xfe, 0x88, 0x01, 0xfc, 0xff, 0xdc, 0xff, 0xaa, 0x00, 0xd6, 0xff, 0x29, 0x00, 0xcd, 0x01, 
-0x30, 0xfe, 0x08, 0x02, 0x49, 0x00, 0x45, 0xff, 0xaa, 0x01, 0x66, 0xff, 0xe3, 0x00, 0x0b, 0xff, 
-0xf7, 0x01, 0x6a, 0xfe, 0x0f, 0x02, 0xb5, 0xff, 0x30, 0xff, 0x5a, 0x02, 0xcc, 0xff, 0xd8, 0xff, 
-0x1d, 0x00, 0xec, 0x00, 0x10, 0xfe, 0xb1, 0x01, 0xae, 0xff, 0xa7, 0xfb, 0x65, 0x01, 0x14, 0xfd, 
-0x48, 0xff, 0x7e, 0x02, 0xac, 0xff, 0x99, 0x04, 0x7b, 0x02, 0xc2, 0x00, 0x79, 0x00, 0x08, 0xff, 
-0xec, 0xff, 0xa7, 0xfe, 0x5c, 0x00, 0x62, 0xff, 0x51, 0xff, 0x53, 0xff, 0x0b, 0xff, 0x30, 0x01, 
-0x29, 0xff, 0x81, 0x02, 0xd3, 0xff, 0x5d, 0x01, 0x44, 0x01, 0xb3, 0x00, 0x45, 0x01, 0x1a, 0xff, 
-0xfc, 0xff, 0xf1, 0xfd, 0xc3, 0x00, 0x36, 0xfe, 0x42, 0x00, 0x4b, 0xff, 0x4c, 0xff, 0x47, 0xff, 
-0xc5, 0xfd, 0x7e, 0x01, 0x3e, 0xfd, 0xc2, 0x00, 0xdd, 0x00, 0x59, 0xfd, 0x9c, 0x03, 0xa1, 0xfc, 
-0xe3, 0x01, 0xe0, 0xfd, 0xc1, 0x00, 0xb7, 0xfe, 0x74, 0xfe, 0xee, 0x01, 0xfa, 0xfa, 0x01, 0x04, 
-0xd4, 0xfd, 0x2c, 0x01, 0xfb, 0xfe, 0xae, 0x00, 0x66, 0xfe, 0x2f, 0x01, 0xb9, 0xff, 0xb2, 0xfe, 
-0xf9, 0x01, 0x60, 0xfd, 0x07, 0x01, 0xc3, 0xff, 0x3c, 0x02, 0xd6, 0xfe, 0x25, 0x01, 0x1b, 0x01, 
-0x6a, 0xfd, 0xce, 0x01, 0xc3, 0xff, 0x60, 0xff, 0x8b, 0x00, 0x74, 0x01, 0xa0, 0xfd, 0x04, 0x02, 
-0x9b, 0xfe, 0x49, 0xff, 0xbd, 0x02, 0x35, 0xfc, 0x40, 0x01, 0x81, 0x00, 0x5a, 0xfe, 0x59, 0x01, 
-0xe9, 0xff, 0xb6, 0xff, 0xb8, 0x00, 0x95, 0xff, 0x6e, 0xff, 0x2b, 0x00, 0x21, 0x00, 0xdb, 0x00, 
-0xae, 0x00, 0xf0, 0x00, 0x77, 0xff, 0x9f, 0xfe, 0x5d, 0x01, 0x51, 0x00, 0x23, 0x01, 0xe7, 0xfe, 
-0x29, 0xff, 0xa5, 0x00, 0x54, 0x01, 0x97, 0x01, 0x7f, 0x02, 0x88, 0x03, 0x87, 0x01, 0x2c, 0x00, 
-0xd5, 0xfe, 0x0e, 0xfe, 0x92, 0xff, 0x75, 0xfe, 0xc6, 0xfe, 0x70, 0x00, 0x62, 0x00, 0xcc, 0xff, 
-0x24, 0xff, 0xff, 0xff, 0x2e, 0x01, 0x59, 0x00, 0xe6, 0xfe, 0x0a, 0xff, 0xf5, 0xfd, 0x89, 0xfe, 
-0xda, 0xfe, 0xbc, 0xfe, 0x07, 0x00, 0x22, 0xfe, 0x38, 0xff, 0xc6, 0x00, 0x59, 0xff, 0xbb, 0xff, 
-0xc8, 0xff, 0xb4, 0x00, 0x93, 0x00, 0x78, 0xff, 0xbf, 0xff, 0xd3, 0x00, 0x95, 0x01, 0x34, 0xff, 
-0x09, 0xfd, 0x8f, 0xff, 0x1f, 0x00, 0x42, 0xff, 0xbb, 0xfd, 0xaf, 0xfc, 0xcb, 0x00, 0x08, 0x02, 
-0x19, 0xff, 0x88, 0xfe, 0x58, 0x01, 0x62, 0x03, 0xd9, 0x02, 0x05, 0x00, 0xcc, 0xfe, 0x7e, 0x01, 
-0xd8, 0x00, 0xdb, 0xfe, 0x1d, 0xff, 0x3a, 0x00, 0x33, 0x01, 0x58, 0xff, 0x06, 0x00, 0x4a, 0x00, 
-0x66, 0x01, 0xd8, 0xff, 0xdc, 0xfe, 0x00, 0x01, 0x1a, 0x02, 0x30, 0x03, 0x14, 0x00, 0x6c, 0xfe, 
-0xed, 0xfc, 0xf8, 0xfe, 0x5e, 0x01, 0x28, 0xff, 0x17, 0xfe, 0x6a, 0xff, 0xbd, 0x03, 0x35, 0x04, 
-0x09, 0x01, 0x66, 0xff, 0x2c, 0x00, 0xe6, 0x02, 0x01, 0x02, 0x76, 0x00, 0x06, 0x00, 0x22, 0x00, 
-0x6f, 0xfe, 0xa5, 0xfb, 0x38, 0x00, 0x05, 0x05, 0xfd, 0x04, 0x4a, 0x00, 0x4b, 0xfd, 0x43, 0x01, 
-0xce, 0x01, 0x0c, 0x01, 0xfe, 0xff, 0x47, 0x02, 0x86, 0x02, 0x92, 0xff, 0x7a, 0xfe, 0xcb, 0xfe, 
-0x70, 0x01, 0xcd, 0x00, 0x38, 0x00, 0x9d, 0xff, 0xc8, 0x00, 0x5d, 0x00, 0x7f, 0x00, 0xc8, 0x00, 
-0x4f, 0xfe, 0xe3, 0xfe, 0xd3, 0xfe, 0x86, 0xff, 0xad, 0x01, 0x8e, 0xff, 0xc8, 0xfe, 0x9d, 0xff, 
-0xc4, 0xfe, 0x6a, 0xff, 0xd4, 0xfe, 0x7b, 0x00, 0x63, 0x02, 0xe0, 0x00, 0x41, 0xfd, 0x5c, 0xfb, 
-0x07, 0xff, 0x0b, 0x02, 0xee, 0xff, 0x4b, 0xfd, 0x30, 0xff, 0x17, 0x01, 0x88, 0x00, 0xd8, 0xfd, 
-0xc5, 0xfc, 0x29, 0x00, 0x03, 0x04, 0xff, 0x02, 0x4e, 0xfd, 0x03, 0xfd, 0xfc, 0x01, 0x33, 0x03, 
-0xf7, 0xfd, 0x15, 0xfb, 0xa7, 0xfe, 0xcf, 0x03, 0x49, 0xff, 0xb0, 0xf8, 0x0e, 0xfc, 0xdb, 0x03, 
-0x1e, 0x05, 0xb5, 0xfb, 0x60, 0xf9, 0x00, 0x02, 0xcc, 0x09, 0x64, 0x02, 0x68, 0xf8, 0x81, 0xf9, 
-0x40, 0x01, 0xda, 0x04, 0x91, 0xfe, 0x9f, 0xfb, 0x2a, 0xfe, 0x2d, 0x03, 0x8e, 0x01, 0xdd, 0xfe, 
-0x68, 0x01, 0xb8, 0x03, 0x9e, 0x02, 0x64, 0xfd, 0x6e, 0xfe, 0xcf, 0x00, 0xdb, 0x00, 0xff, 0xff, 
-0xf2, 0xfe, 0x34, 0xff, 0xd1, 0x01, 0xfb, 0x03, 0x5d, 0x02, 0xd6, 0x02, 0x3f, 0x02, 0x95, 0x00, 
-0xc3, 0x01, 0xe1, 0x02, 0x41, 0x01, 0x65, 0xff, 0x61, 0xfe, 0x9e, 0x00, 0x4f, 0x00, 0xca, 0x00, 
-0x93, 0xff, 0x64, 0x00, 0x30, 0x03, 0xb0, 0x01, 0xb2, 0xff, 0x66, 0xfe, 0xa0, 0x02, 0x01, 0x06, 
-0x18, 0x02, 0x74, 0xfb, 0x75, 0xfc, 0xbe, 0x02, 0xbd, 0x04, 0xfc, 0x01, 0x03, 0xfe, 0x8c, 0xff, 
-0xb8, 0x04, 0x56, 0x01, 0x06, 0xfd, 0xe5, 0xfd, 0x3e, 0x01, 0xe9, 0x02, 0xa6, 0xff, 0x4a, 0xfd, 
-0x6d, 0xfd, 0x2a, 0xff, 0xeb, 0xfe, 0x94, 0xfe, 0xeb, 0xfe, 0xb1, 0xfe, 0xef, 0xff, 0x92, 0xfc, 
-0x0c, 0xfd, 0xca, 0x00, 0x67, 0x01, 0x67, 0xfd, 0xf4, 0xfa, 0xa8, 0xfc, 0x3b, 0x02, 0x95, 0x03, 
-0xeb, 0xfb, 0xce, 0xf9, 0x80, 0xfe, 0x27, 0x01, 0x95, 0xfe, 0x5a, 0xfd, 0x76, 0xfe, 0x2b, 0x01, 
-0xa2, 0x00, 0x35, 0xfe, 0x82, 0xff, 0x1c, 0x02, 0x70, 0xff, 0xae, 0xfc, 0xaf, 0x00, 0xbc, 0x03, 
-0xe6, 0x03, 0xf4, 0xfd, 0x0f, 0xf9, 0xc5, 0xfe, 0x42, 0x05, 0x83, 0x04, 0x28, 0xff, 0xd4, 0xfc, 
-0x58, 0x00, 0x1a, 0x06, 0xfc, 0x03, 0x82, 0xfd, 0x3c, 0xfc, 0x16, 0x00, 0xf0, 0x05, 0xb4, 0x03, 
-0x5e, 0xfd, 0x5b, 0xfc, 0xb2, 0x01, 0xd8, 0x04, 0x87, 0x00, 0x1f, 0xfc, 0x4b, 0xfd, 0xc5, 0x04, 
-0xe0, 0x04, 0xa6, 0xfe, 0x57, 0xfc, 0x5e, 0xfe, 0xf9, 0x03, 0x16, 0x04, 0x6c, 0x00, 0xea, 0xfd, 
-0x3c, 0xfe, 0x87, 0x00, 0x5d, 0x00, 0x27, 0x00, 0x9b, 0xff, 0xd9, 0xfe, 0x23, 0xfe, 0x81, 0xfe, 
-0x52, 0xff, 0x46, 0x00, 0x75, 0x00, 0xe4, 0xfe, 0x97, 0xfd, 0x9f, 0xfb, 0x01, 0xfe, 0xc9, 0x01, 
-0x15, 0x01, 0x60, 0xfe, 0x46, 0xfc, 0x00, 0xff, 0x5c, 0x02, 0x50, 0x01, 0xe2, 0xfe, 0x4c, 0xfe, 
-0x46, 0x00, 0x81, 0x01, 0x0a, 0x00, 0xab, 0xff, 0x60, 0x00, 0x52, 0xff, 0x6e, 0xff, 0x3a, 0x00, 
-0x3e, 0x01, 0xf8, 0x01, 0x03, 0x01, 0x7b, 0x00, 0x37, 0x00, 0x77, 0x02, 0x67, 0x01, 0xb8, 0xfe, 
-0x41, 0x00, 0xd8, 0x01, 0x39, 0x03, 0x56, 0xff, 0x97, 0xfd, 0xb3, 0x01, 0x26, 0x04, 0x46, 0x03, 
-0x87, 0xfe, 0xce, 0xfc, 0x11, 0xff, 0x9a, 0x02, 0x1b, 0x02, 0x7a, 0xff, 0xbb, 0xfe, 0xef, 0xff, 
-0xfe, 0x02, 0x0f, 0x02, 0x38, 0xff, 0x61, 0xfd, 0xa9, 0xff, 0xc9, 0x03, 0x18, 0x02, 0x99, 0xfd, 
-0xff, 0xfb, 0x3f, 0xfe, 0x3e, 0x01, 0x33, 0x01, 0x08, 0xff, 0xe6, 0xfc, 0xe6, 0xfe, 0x95, 0xff, 
-0xcd, 0xfd, 0x5e, 0xfd, 0x51, 0xfd, 0x40, 0xff, 0x8c, 0xff, 0xcc, 0xfd, 0x15, 0xfd, 0xf2, 0xfd, 
-0xf5, 0xff, 0x2f, 0x00, 0xdb, 0xfe, 0xb7, 0xff, 0xa2, 0x00, 0x89, 0x01, 0xb4, 0x00, 0xd8, 0xfd, 
-0x5c, 0xff, 0xc0, 0x01, 0x19, 0x01, 0xa0, 0xff, 0x49, 0xfe, 0x72, 0xff, 0xd4, 0xff, 0xfe, 0xfd, 
-0xf5, 0xfd, 0xdf, 0xfe, 0x63, 0x00, 0x8f, 0x01, 0x48, 0x00, 0xc0, 0xff, 0x19, 0x02, 0xa6, 0x01, 
-0xe9, 0x00, 0xee, 0xff, 0x6b, 0xfd, 0x03, 0xfe, 0x9b, 0xfd, 0xbb, 0xfe, 0x91, 0xff, 0x95, 0xff, 
-0xae, 0x00, 0x55, 0x01, 0x30, 0x02, 0xf8, 0x02, 0x05, 0x01, 0x2b, 0xfd, 0xf3, 0xfe, 0x06, 0x03, 
-0x17, 0x05, 0xd4, 0x01, 0xb2, 0xfb, 0x4b, 0xfc, 0x0c, 0x02, 0x70, 0x07, 0x5e, 0x08, 0x5f, 0x03, 
-0xde, 0x00, 0x25, 0x02, 0x70, 0x02, 0xd2, 0x02, 0x6f, 0x00, 0xdf, 0xff, 0x53, 0x02, 0xf9, 0x03, 
-0x51, 0x03, 0x1f, 0xfe, 0x1d, 0xfc, 0x7e, 0xfe, 0x4d, 0xfd, 0xd2, 0xfc, 0x52, 0xfc, 0xe1, 0xf9, 
-0x74, 0xfb, 0x06, 0xf9, 0x03, 0xf6, 0x7b, 0xf6, 0xbb, 0xf7, 0x87, 0xfb, 0xc8, 0xfc, 0x77, 0xfb, 
-0x3a, 0xfa, 0x77, 0xf9, 0xd9, 0xfe, 0x7c, 0x03, 0x05, 0x06, 0x04, 0x0a, 0x7f, 0x09, 0xa9, 0x09, 
-0x61, 0x09, 0xec, 0x08, 0xb7, 0x0a, 0x7f, 0x08, 0xcc, 0x05, 0xc3, 0x05, 0xd0, 0x03, 0xfa, 0x05, 
-0x84, 0x05, 0xde, 0x01, 0xdb, 0x04, 0xbf, 0x02, 0xbb, 0xff, 0x01, 0xff, 0xac, 0xfc, 0x74, 0xfe, 
-0x45, 0xfe, 0x0c, 0xfc, 0x70, 0xf9, 0x42, 0xf8, 0xef, 0xfb, 0x00, 0xfb, 0x98, 0xf9, 0x2d, 0xf9, 
-0xa2, 0xf5, 0xed, 0xf4, 0xb4, 0xf5, 0xad, 0xf3, 0x7a, 0xf1, 0x05, 0xf1, 0xbf, 0xf1, 0x8d, 0xfb, 
-0xc7, 0x05, 0xae, 0x07, 0xcd, 0x06, 0xba, 0x02, 0x38, 0x07, 0xc2, 0x0b, 0x5f, 0x09, 0xb8, 0x06, 
-0xc1, 0x00, 0xe0, 0x04, 0x87, 0x0b, 0x75, 0x0d, 0x2f, 0x0b, 0xa4, 0x05, 0x66, 0x04, 0x9f, 0x07, 
-0x63, 0x0b, 0x18, 0x08, 0x62, 0x02, 0xe5, 0xfe, 0xf4, 0x01, 0x59, 0x04, 0xed, 0x01, 0x5c, 0xfc, 
-0x45, 0xf6, 0x14, 0xfa, 0x51, 0xff, 0x2f, 0x01, 0x79, 0xfe, 0x56, 0xf7, 0x0f, 0xf4, 0x11, 0xf2, 
-0xf6, 0xf0, 0x63, 0xf1, 0x77, 0xf0, 0xcf, 0xf3, 0x33, 0xf0, 0x93, 0xea, 0x0e, 0xf0, 0xff, 0xfd, 
-0x4c, 0x12, 0x6b, 0x18, 0xc0, 0x0d, 0x2a, 0x01, 0xb8, 0xfc, 0x6a, 0x03, 0xaa, 0x05, 0x80, 0x03, 
-0x47, 0x04, 0x36, 0x06, 0xc2, 0x0b, 0x9c, 0x0a, 0xce, 0x03, 0x40, 0x02, 0xf0, 0x06, 0x10, 0x0d, 
-0x6b, 0x10, 0x69, 0x0b, 0x2c, 0x05, 0xdc, 0x03, 0xc8, 0x03, 0x9c, 0x06, 0x76, 0x03, 0xd3, 0xfe, 
-0x9b, 0xfd, 0xea, 0xfb, 0xff, 0xfb, 0x81, 0xfa, 0xad, 0xf9, 0xbb, 0xfa, 0xd7, 0xf9, 0xa9, 0xf6, 
-0x68, 0xf1, 0x18, 0xec, 0xc4, 0xe7, 0xa8, 0xe5, 0x2e, 0xe7, 0x6f, 0xf0, 0xf4, 0xff, 0x7e, 0x0e, 
-0x5f, 0x15, 0x79, 0x11, 0x5c, 0x06, 0x23, 0xfe, 0x86, 0xfd, 0x82, 0x01, 0xe5, 0x06, 0xa2, 0x08, 
-0xed, 0x07, 0xce, 0x06, 0xad, 0x04, 0x85, 0x01, 0xf8, 0xff, 0xdc, 0x00, 0x9f, 0x05, 0x5f, 0x0a, 
-0x9e, 0x0b, 0x32, 0x0b, 0x46, 0x08, 0x02, 0x07, 0x64, 0x05, 0x3f, 0x03, 0xd7, 0x01, 0xa0, 0x02, 
-0x44, 0x05, 0x1c, 0x06, 0x28, 0x03, 0xf5, 0xfd, 0x55, 0xf8, 0x49, 0xf6, 0x1e, 0xfa, 0x11, 0xfb, 
-0x6f, 0xfa, 0xe3, 0xf5, 0xd5, 0xed, 0x93, 0xe7, 0x58, 0xe4, 0x90, 0xe3, 0x94, 0xea, 0xe3, 0xf9, 
-0xa4, 0x09, 0x59, 0x15, 0x76, 0x15, 0xc4, 0x0b, 0xac, 0x00, 0x24, 0xfa, 0xe1, 0xfb, 0x70, 0x01, 
-0xb3, 0x03, 0x07, 0x05, 0x84, 0x05, 0x5c, 0x07, 0x54, 0x09, 0x3a, 0x05, 0xd3, 0xfe, 0x47, 0xfe, 
-0x1a, 0x03, 0xed, 0x0b, 0xfb, 0x0e, 0xd3, 0x09, 0x39, 0x03, 0xb3, 0x00, 0x78, 0x05, 0x39, 0x09, 
-0x55, 0x08, 0xac, 0x02, 0x3f, 0xff, 0xbc, 0x00, 0x4e, 0x02, 0x13, 0x00, 0xe6, 0xf9, 0xf3, 0xf7, 
-0x27, 0xfb, 0xe7, 0xfc, 0x2a, 0xf9, 0x57, 0xf0, 0xb3, 0xe5, 0x0b, 0xe1, 0x7f, 0xe1, 0x3b, 0xe7, 
-0x89, 0xf5, 0x73, 0x05, 0x7c, 0x14, 0x2d, 0x19, 0x6c, 0x12, 0xbc, 0x05, 0xb6, 0xf9, 0x47, 0xf8, 
-0xad, 0xfd, 0x80, 0x04, 0x55, 0x08, 0x44, 0x07, 0x11, 0x04, 0xf6, 0x01, 0xeb, 0x00, 0x36, 0x02, 
-0xa5, 0x02, 0x02, 0x03, 0xfc, 0x06, 0x86, 0x08, 0xc0, 0x09, 0x41, 0x06, 0x16, 0x02, 0x83, 0x01, 
-0x39, 0x03, 0x12, 0x07, 0x6f, 0x06, 0xef, 0x05, 0x12, 0x05, 0x3a, 0x04, 0xf3, 0x01, 0x81, 0xfd, 
-0x9e, 0xfa, 0x52, 0xfc, 0x2b, 0xfe, 0xe1, 0xfb, 0x9b, 0xf4, 0x9b, 0xec, 0xf4, 0xea, 0x9a, 0xe8, 
-0x57, 0xe5, 0x61, 0xe5, 0x4e, 0xf0, 0xa5, 0x03, 0xfb, 0x13, 0x69, 0x19, 0x4a, 0x11, 0xf7, 0x03, 
-0x30, 0xfc, 0x86, 0xfb, 0xad, 0xff, 0x10, 0x03, 0xda, 0x02, 0x72, 0x03, 0x29, 0x05, 0xa4, 0x05, 
-0x18, 0x04, 0x3d, 0x01, 0xaa, 0x01, 0x40, 0x04, 0x4c, 0x07, 0x40, 0x08, 0x30, 0x06, 0x81, 0x04, 
-0xb6, 0x03, 0xd9, 0x05, 0x25, 0x06, 0xff, 0x04, 0x1c, 0x04, 0xe7, 0x02, 0xde, 0x03, 0x2b, 0x05, 
-0x19, 0x04, 0x05, 0x02, 0xdf, 0xfe, 0xa5, 0xfc, 0xf3, 0xfc, 0xaa, 0xfb, 0x59, 0xf7, 0xbd, 0xef, 
-0x2e, 0xea, 0x1f, 0xe9, 0xbd, 0xe7, 0xfb, 0xe5, 0x8a, 0xe6, 0xe9, 0xf0, 0xa2, 0x05, 0xd9, 0x19, 
-0xec, 0x1e, 0xa5, 0x12, 0x22, 0x00, 0xd7, 0xf5, 0xc8, 0xf8, 0xf6, 0x00, 0x4f, 0x04, 0x14, 0x03, 
-0xba, 0x03, 0xc6, 0x05, 0x12, 0x09, 0xba, 0x07, 0x05, 0x03, 0x29, 0x00, 0x38, 0x00, 0x00, 0x05, 
-0x79, 0x09, 0x89, 0x09, 0x0f, 0x07, 0x08, 0x04, 0xf2, 0x01, 0xb2, 0x01, 0x2b, 0x02, 0xb8, 0x03, 
-0x85, 0x05, 0x6f, 0x07, 0x18, 0x08, 0xfe, 0x05, 0x0f, 0x02, 0x0e, 0xfe, 0x5a, 0xfb, 0xec, 0xfa, 
-0x91, 0xfa, 0x7d, 0xf8, 0xf6, 0xf2, 0x92, 0xec, 0x56, 0xe8, 0xc8, 0xe6, 0x3b, 0xe6, 0xc2, 0xe8, 
-0xc9, 0xf4, 0x5b, 0x07, 0x4b, 0x18, 0xa9, 0x1b, 0x4c, 0x10, 0xa3, 0x00, 0x8d, 0xf8, 0xc8, 0xf9, 
-0x69, 0xfe, 0x41, 0x01, 0xb1, 0x01, 0x09, 0x03, 0xd6, 0x05, 0xa7, 0x07, 0x22, 0x07, 0xc4, 0x04, 
-0xfc, 0x01, 0xc4, 0x01, 0xa7, 0x02, 0xb1, 0x03, 0xc0, 0x04, 0x1d, 0x05, 0x19, 0x06, 0x18, 0x07, 
-0x37, 0x07, 0xad, 0x06, 0x0e, 0x05, 0x42, 0x04, 0x63, 0x04, 0x0f, 0x04, 0xd3, 0x03, 0x55, 0x01, 
-0xbc, 0xfe, 0x47, 0xfc, 0xb1, 0xfa, 0x41, 0xfb, 0xa7, 0xfa, 0xdb, 0xf5, 0x10, 0xef, 0x4f, 0xea, 
-0x16, 0xe8, 0xb8, 0xe7, 0x79, 0xe7, 0x8c, 0xee, 0xf5, 0xfd, 0x4a, 0x11, 0x9b, 0x1c, 0x3d, 0x18, 
-0x2e, 0x0a, 0x92, 0xfc, 0xc7, 0xf8, 0x2c, 0xfc, 0xf2, 0xff, 0xb5, 0x01, 0x08, 0x02, 0x6b, 0x03, 
-0xde, 0x06, 0xa6, 0x08, 0x9e, 0x07, 0x0c, 0x04, 0x7a, 0x00, 0x16, 0x00, 0x71, 0x02, 0xff, 0x04, 
-0x56, 0x05, 0x82, 0x03, 0xb9, 0x02, 0x4a, 0x03, 0x76, 0x05, 0x82, 0x06, 0xed, 0x05, 0x9e, 0x05, 
-0x4b, 0x05, 0x2d, 0x05, 0x7d, 0x04, 0x5a, 0x02, 0xc4, 0xfe, 0x22, 0xfc, 0xa0, 0xfa, 0xba, 0xfa, 
-0xfc, 0xf9, 0xd7, 0xf6, 0xf8, 0xf1, 0x19, 0xee, 0x19, 0xec, 0x02, 0xea, 0x82, 0xe8, 0xea, 0xea, 
-0x9b, 0xf4, 0x61, 0x06, 0xaa, 0x16, 0xbf, 0x1a, 0x2f, 0x12, 0x24, 0x03, 0xab, 0xf9, 0x4a, 0xf8, 
-0x51, 0xfb, 0xd0, 0xfe, 0x0b, 0x00, 0x01, 0x02, 0xdc, 0x05, 0x8e, 0x09, 0xc4, 0x0a, 0x2f, 0x07, 
-0x40, 0x02, 0x33, 0xff, 0x4e, 0xff, 0x37, 0x03, 0x9b, 0x05, 0x3d, 0x06, 0x29, 0x05, 0xf5, 0x02, 
-0x72, 0x02, 0xa6, 0x02, 0x61, 0x04, 0xd9, 0x05, 0xee, 0x06, 0xd1, 0x06, 0xc0, 0x05, 0x06, 0x05, 
-0x9f, 0x03, 0x63, 0x02, 0xc6, 0xff, 0xa4, 0xfb, 0x24, 0xf8, 0x45, 0xf5, 0x6e, 0xf4, 0xba, 0xf2, 
-0x53, 0xf0, 0xdc, 0xec, 0x0c, 0xe9, 0x93, 0xe7, 0x93, 0xea, 0xc1, 0xf5, 0xa7, 0x05, 0x23, 0x14, 
-0x4f, 0x18, 0x0f, 0x11, 0x40, 0x04, 0xdb, 0xfa, 0xa3, 0xf9, 0x07, 0xfd, 0x4c, 0x00, 0x00, 0x01, 
-0x71, 0x00, 0xa2, 0x02, 0x14, 0x07, 0x4f, 0x0a, 0x7a, 0x09, 0x37, 0x04, 0x0f, 0xff, 0xe2, 0xfd, 
-0xab, 0x00, 0xdf, 0x04, 0x76, 0x07, 0xfa, 0x06, 0xde, 0x04, 0x9e, 0x03, 0x6e, 0x03, 0xd6, 0x04, 
-0xb8, 0x05, 0x90, 0x05, 0xb8, 0x05, 0xf8, 0x04, 0x63, 0x04, 0xb9, 0x03, 0xda, 0x02, 0xc0, 0x01, 
-0xdb, 0xfe, 0xec, 0xfb, 0xe6, 0xf8, 0x58, 0xf6, 0x1a, 0xf5, 0x31, 0xf2, 0xc1, 0xef, 0x62, 0xed, 
-0x8b, 0xea, 0x63, 0xe9, 0x1b, 0xeb, 0x15, 0xf4, 0x3a, 0x02, 0x20, 0x10, 0xb8, 0x16, 0xcc, 0x11, 
-0xbc, 0x07, 0xec, 0xfd, 0x7d, 0xf9, 0x83, 0xfa, 0xb2, 0xfc, 0x5c, 0xff, 0xba, 0x01, 0xf5, 0x03, 
-0xc0, 0x06, 0x31, 0x09, 0x49, 0x0a, 0x68, 0x09, 0x2a, 0x06, 0xf2, 0x01, 0x74, 0xff, 0xca, 0x00, 
-0xbd, 0x03, 0xcb, 0x06, 0x42, 0x07, 0x3c, 0x06, 0x6a, 0x05, 0xd0, 0x04, 0xbc, 0x04, 0xe7, 0x03, 
-0x83, 0x03, 0xe8, 0x03, 0x61, 0x05, 0xd8, 0x05, 0x8c, 0x03, 0xe4, 0xfe, 0xa6, 0xfa, 0xae, 0xf8, 
-0xa3, 0xf8, 0xae, 0xf8, 0x45, 0xf7, 0x0f, 0xf4, 0x55, 0xf1, 0xa2, 0xed, 0x0b, 0xeb, 0x91, 0xe9, 
-0xaa, 0xe8, 0xc8, 0xed, 0x8c, 0xf9, 0x6a, 0x08, 0x44, 0x13, 0xfd, 0x13, 0xd5, 0x0c, 0x76, 0x04, 
-0x9e, 0xff, 0x7b, 0xfe, 0x4a, 0xff, 0xe0, 0xff, 0x4e, 0xff, 0xe2, 0xff, 0xf9, 0x01, 0xa2, 0x06, 
-0xbb, 0x0b, 0xfe, 0x0d, 0xea, 0x0b, 0xfc, 0x05, 0x63, 0x00, 0x16, 0xfe, 0xa0, 0x00, 0xc8, 0x04, 
-0x56, 0x07, 0xe9, 0x07, 0x44, 0x06, 0x1c, 0x05, 0x69, 0x04, 0x9a, 0x04, 0x60, 0x05, 0x71, 0x05, 
-0x7b, 0x05, 0xee, 0x04, 0x11, 0x04, 0x61, 0x02, 0x77, 0xff, 0x0b, 0xfc, 0x6a, 0xf9, 0xee, 0xf7, 
-0x20, 0xf7, 0xee, 0xf5, 0x37, 0xf3, 0x82, 0xf0, 0x10, 0xee, 0x24, 0xec, 0x3f, 0xea, 0x45, 0xe9, 
-0x4a, 0xeb, 0x7f, 0xf2, 0xcd, 0xfe, 0x9d, 0x0b, 0x06, 0x14, 0xff, 0x13, 0x44, 0x0d, 0x64, 0x04, 
-0x62, 0xfe, 0x3d, 0xfd, 0x8c, 0xfe, 0xff, 0x00, 0x3d, 0x02, 0x53, 0x03, 0xe3, 0x04, 0xf2, 0x06, 
-0x53, 0x09, 0x01, 0x0a, 0xfd, 0x07, 0x63, 0x04, 0x1c, 0x01, 0x1f, 0x00, 0x0b, 0x02, 0x5b, 0x04, 
-0xd4, 0x05, 0x32, 0x06, 0x52, 0x05, 0xd9, 0x04, 0x40, 0x05, 0xf4, 0x05, 0x13, 0x06, 0x87, 0x05, 
-0x8f, 0x04, 0x9f, 0x03, 0xef, 0x02, 0x3a, 0x01, 0xe9, 0xfe, 0x13, 0xfc, 0x5b, 0xf9, 0x64, 0xf7, 
-0xbb, 0xf5, 0xf2, 0xf3, 0xdd, 0xf1, 0xbe, 0xef, 0x2c, 0xee, 0x69, 0xec, 0x85, 0xea, 0xdc, 0xe8, 
-0xf2, 0xeb, 0xed, 0xf4, 0xed, 0x01, 0x79, 0x0e, 0x11, 0x14, 0xe2, 0x12, 0x18, 0x0d, 0x6c, 0x06, 
-0xfd, 0x01, 0xa8, 0xff, 0x42, 0xff, 0x8a, 0xff, 0xfe, 0xff, 0xaa, 0x01, 0x09, 0x04, 0xf7, 0x06, 
-0xe9, 0x09, 0x0b, 0x0b, 0x67, 0x09, 0xad, 0x05, 0x93, 0x01, 0x11, 0x00, 0x2e, 0x01, 0xd5, 0x03, 
-0xb4, 0x05, 0x1c, 0x06, 0xa9, 0x05, 0xd2, 0x05, 0xcf, 0x06, 0x8a, 0x07, 0x41, 0x06, 0x0c, 0x03, 
-0x88, 0x00, 0xee, 0xff, 0xc8, 0x01, 0xd6, 0x02, 0xec, 0x00, 0xc8, 0xfc, 0x13, 0xf8, 0xec, 0xf5, 
-0x85, 0xf5, 0x63, 0xf5, 0x12, 0xf3, 0x04, 0xf0, 0x74, 0xed, 0xe6, 0xea, 0x0f, 0xeb, 0x13, 0xeb, 
-0xd4, 0xed, 0x8f, 0xf4, 0xd2, 0xfd, 0x41, 0x09, 0xf4, 0x10, 0xfb, 0x12, 0x91, 0x0f, 0x62, 0x09, 
-0x9d, 0x04, 0x68, 0x02, 0xa3, 0x02, 0x29, 0x03, 0xd2, 0x02, 0x92, 0x02, 0xd0, 0x02, 0x87, 0x04, 
-0xa2, 0x06, 0xcf, 0x07, 0xbf, 0x07, 0x29, 0x06, 0x4f, 0x04, 0x40, 0x03, 0x0b, 0x03, 0xce, 0x03, 
-0x77, 0x04, 0xd7, 0x04, 0xcb, 0x04, 0x81, 0x04, 0xc3, 0x04, 0x75, 0x05, 0xb3, 0x05, 0xb8, 0x04, 
-0x0a, 0x03, 0xcd, 0x00, 0x87, 0xff, 0xc1, 0xfe, 0xd8, 0xfd, 0x29, 0xfc, 0xf4, 0xf9, 0x16, 0xf8, 
-0xc8, 0xf6, 0xa6, 0xf5, 0x67, 0xf3, 0xd7, 0xf0, 0x2c, 0xef, 0x8c, 0xed, 0x7d, 0xed, 0x09, 0xed, 
-0x7a, 0xed, 0x4b, 0xf2, 0xd1, 0xf9, 0x4f, 0x05, 0x51, 0x0e, 0xbe, 0x11, 0xab, 0x10, 0x71, 0x0b, 
-0xaa, 0x07, 0x3c, 0x05, 0x54, 0x03, 0xa3, 0x02, 0x1a, 0x01, 0x67, 0x00, 0xe8, 0x00, 0x48, 0x02, 
-0x43, 0x05, 0xb5, 0x07, 0x23, 0x09, 0x8f, 0x08, 0x0d, 0x06, 0x9d, 0x04, 0x50, 0x04, 0xa3, 0x04, 
-0xfd, 0x04, 0x0d, 0x04, 0x5f, 0x03, 0x57, 0x03, 0xf4, 0x03, 0x5f, 0x05, 0x5d, 0x05, 0xad, 0x04, 
-0xbf, 0x02, 0xbc, 0x00, 0xc9, 0xff, 0x06, 0xff, 0xb7, 0xfe, 0x76, 0xfd, 0xa6, 0xfb, 0xe6, 0xf9, 
-0xdb, 0xf7, 0x27, 0xf6, 0x24, 0xf4, 0xd8, 0xf1, 0x2e, 0xf0, 0x63, 0xef, 0xe3, 0xee, 0x46, 0xee, 
-0x3f, 0xee, 0x22, 0xef, 0x52, 0xf3, 0xd2, 0xfa, 0x4e, 0x04, 0xc6, 0x0c, 0xd5, 0x10, 0x15, 0x10, 
-0x92, 0x0c, 0xd5, 0x08, 0x43, 0x06, 0x78, 0x04, 0xae, 0x02, 0xc9, 0x00, 0x87, 0xff, 0x3f, 0x00, 
-0xf7, 0x02, 0xb4, 0x06, 0x74, 0x09, 0x18, 0x0a, 0x31, 0x09, 0xed, 0x06, 0x4b, 0x05, 0x4b, 0x04, 
-0x8a, 0x03, 0xe1, 0x03, 0xe8, 0x03, 0xdf, 0x03, 0x74, 0x03, 0x41, 0x03, 0x2f, 0x04, 0x71, 0x05, 
-0x2f, 0x05, 0x48, 0x03, 0x70, 0x00, 0x95, 0xfe, 0x86, 0xfe, 0x32, 0xfe, 0x2c, 0xfd, 0x05, 0xfb, 
-0xc9, 0xf8, 0xa5, 0xf7, 0xbd, 0xf6, 0x60, 0xf5, 0x24, 0xf3, 0x8b, 0xf0, 0x39, 0xef, 0xe7, 0xed, 
-0x98, 0xed, 0x84, 0xed, 0x0d, 0xef, 0x58, 0xf4, 0x5d, 0xfc, 0xd9, 0x06, 0x8b, 0x0e, 0xb4, 0x11, 
-0x89, 0x10, 0xfc, 0x0c, 0x8a, 0x09, 0x4a, 0x06, 0xd2, 0x03, 0x61, 0x01, 0x59, 0xff, 0x11, 0xff, 
-0x11, 0x00, 0x95, 0x02, 0x83, 0x05, 0x9f, 0x07, 0xda, 0x08, 0xbd, 0x08, 0x8f, 0x07, 0xbe, 0x05, 
-0x1c, 0x04, 0xb8, 0x02, 0x01, 0x02, 0x00, 0x02, 0xee, 0x01, 0x08, 0x02, 0x4e, 0x02, 0xb7, 0x02, 
-0x1e, 0x03, 0xd7, 0x02, 0xf8, 0x01, 0x1c, 0x01, 0x32, 0x00, 0x01, 0xff, 0x01, 0xfe, 0x01, 0xfd, 
-0xdc, 0xfb, 0x43, 0xfa, 0x4d, 0xf8, 0x6a, 0xf6, 0xd7, 0xf4, 0xeb, 0xf2, 0x49, 0xf1, 0x4d, 0xee, 
-0xb3, 0xea, 0x34, 0xe9, 0xe1, 0xeb, 0xdb, 0xf4, 0xfe, 0xff, 0x15, 0x0a, 0x11, 0x0f, 0x43, 0x0f, 
-0xd7, 0x0d, 0x72, 0x0b, 0x95, 0x09, 0x87, 0x06, 0x28, 0x02, 0xa3, 0xfe, 0x07, 0xfd, 0xa7, 0xfe, 
-0x6e, 0x01, 0x64, 0x03, 0x8e, 0x04, 0x7c, 0x05, 0xd3, 0x06, 0xf9, 0x07, 0x0f, 0x08, 0xb3, 0x06, 
-0x1f, 0x04, 0x6d, 0x01, 0x65, 0xff, 0xc1, 0xfe, 0xac, 0xfe, 0x14, 0xff, 0x3a, 0x01, 0x96, 0x03, 
-0x47, 0x06, 0x01, 0x08, 0x33, 0x07, 0x5e, 0x05, 0x4b, 0x03, 0x2f, 0x02, 0xf2, 0x00, 0x3b, 0xff, 
-0x76, 0xfd, 0x86, 0xfb, 0x61, 0xfa, 0xd8, 0xf8, 0x63, 0xf6, 0x7c, 0xf3, 0x0e, 0xf2, 0x9e, 0xf1, 
-0x4f, 0xf1, 0xb4, 0xed, 0xa9, 0xe8, 0x7d, 0xe7, 0x68, 0xed, 0xf7, 0xfa, 0xcf, 0x07, 0xdf, 0x0e, 
-0x25, 0x10, 0xe2, 0x0d, 0x03, 0x0c, 0xbf, 0x09, 0x84, 0x06, 0x53, 0x02, 0xf6, 0xfe, 0xf5, 0xfe, 
-0xd1, 0x00, 0xcb, 0x03, 0xab, 0x05, 0x1f, 0x06, 0xe3, 0x06, 0xef, 0x07, 0xa1, 0x08, 0x13, 0x08, 
-0xf4, 0x05, 0xef, 0x03, 0x61, 0x02, 0xa8, 0x01, 0xbb, 0x01, 0x03, 0x02, 0xa3, 0x02, 0x70, 0x03, 
-0x79, 0x04, 0x66, 0x04, 0x83, 0x03, 0x22, 0x03, 0xbd, 0x02, 0x00, 0x03, 0x33, 0x02, 0x22, 0x01, 
-0xf4, 0xff, 0xb2, 0xfe, 0x9d, 0xfd, 0xb8, 0xfb, 0xe3, 0xf9, 0xff, 0xf7, 0x8e, 0xf6, 0x9e, 0xf5, 
-0x3e, 0xf4, 0x61, 0xf3, 0xb0, 0xf1, 0x69, 0xed, 0xf7, 0xe8, 0xb2, 0xe7, 0x33, 0xee, 0xcf, 0xfa, 
-0x52, 0x06, 0xf4, 0x0c, 0x5d, 0x0e, 0xea, 0x0c, 0x45, 0x0b, 0xe5, 0x08, 0xff, 0x04, 0xdc, 0x00, 
-0x82, 0xfe, 0x61, 0xff, 0x8a, 0x02, 0xf0, 0x04, 0x1b, 0x06, 0x71, 0x06, 0xfa, 0x07, 0x30, 0x09, 
-0x6c, 0x08, 0x73, 0x06, 0x6e, 0x03, 0x3d, 0x02, 0xa4, 0x01, 0x42, 0x01, 0xaa, 0x01, 0xf7, 0x02, 
-0x87, 0x04, 0x2e, 0x05, 0x31, 0x05, 0x72, 0x04, 0xf6, 0x03, 0x4e, 0x03, 0x6d, 0x02, 0xfb, 0x01, 
-0x7f, 0x01, 0x94, 0x00, 0x62, 0x00, 0xbf, 0xff, 0xcf, 0xfe, 0x80, 0xfd, 0x44, 0xfa, 0x84, 0xf7, 
-0x0d, 0xf5, 0x85, 0xf3, 0x47, 0xf4, 0xa9, 0xf4, 0x35, 0xf4, 0xd5, 0xef, 0x5a, 0xe8, 0xf3, 0xe4, 
-0x95, 0xe9, 0xd3, 0xf7, 0x05, 0x07, 0x17, 0x0f, 0x33, 0x11, 0x02, 0x0f, 0x04, 0x0c, 0xba, 0x08, 
-0x1d, 0x03, 0x3a, 0xfe, 0xd4, 0xfc, 0x9a, 0xff, 0x76, 0x03, 0x7c, 0x05, 0x8b, 0x06, 0xc1, 0x07, 
-0xd1, 0x08, 0x3e, 0x09, 0x98, 0x07, 0xbf, 0x04, 0x3a, 0x03, 0x76, 0x02, 0x86, 0x02, 0x2e, 0x02, 
-0xcb, 0x01, 0x21, 0x02, 0x79, 0x03, 0x0e, 0x05, 0x07, 0x06, 0xa7, 0x05, 0x5e, 0x04, 0x04, 0x05, 
-0x9e, 0x04, 0xb7, 0x02, 0x2a, 0x01, 0x5e, 0x00, 0xd0, 0x00, 0x45, 0x01, 0xb9, 0xff, 0xbc, 0xfc, 
-0x12, 0xfa, 0x28, 0xf8, 0xdf, 0xf6, 0xa7, 0xf4, 0x14, 0xf3, 0xd7, 0xf3, 0x5a, 0xf4, 0x46, 0xf2, 
-0x1c, 0xeb, 0x6e, 0xe5, 0x90, 0xe9, 0x67, 0xf6, 0xb2, 0x05, 0xd9, 0x0d, 0x9c, 0x0f, 0xc6, 0x0e, 
-0x70, 0x0c, 0xe7, 0x08, 0xc3, 0x02, 0xa3, 0xfc, 0x5f, 0xfb, 0x9a, 0xfe, 0xa6, 0x03, 0x93, 0x06, 
-0x81, 0x07, 0xeb, 0x08, 0x88, 0x0a, 0x22, 0x0a, 0xd9, 0x06, 0x5f, 0x03, 0xe1, 0x00, 0x50, 0x00, 
-0xe8, 0x00, 0x6e, 0x01, 0x3c, 0x02, 0x3f, 0x03, 0xda, 0x04, 0xe5, 0x05, 0x68, 0x04, 0x6d, 0x02, 
-0x92, 0x01, 0xa1, 0x01, 0x54, 0x03, 0x78, 0x04, 0x35, 0x04, 0xb3, 0x03, 0x8b, 0x03, 0x05, 0x03, 
-0x12, 0x00, 0x80, 0xfc, 0x4d, 0xf9, 0xa5, 0xf7, 0xbc, 0xf7, 0x30, 0xf7, 0xa2, 0xf6, 0xc4, 0xf6, 
-0xb1, 0xf6, 0x2f, 0xf4, 0xd8, 0xee, 0x46, 0xe8, 0xe0, 0xe5, 0xce, 0xec, 0x71, 0xf9, 0xb9, 0x05, 
-0x53, 0x0c, 0xb2, 0x0e, 0xf7, 0x0d, 0x12, 0x0b, 0x2e, 0x06, 0x18, 0x00, 0x84, 0xfc, 0x93, 0xfc, 
-0x9f, 0xff, 0x95, 0x03, 0x84, 0x06, 0xb4, 0x07, 0x30, 0x08, 0x7b, 0x08, 0xf8, 0x07, 0xf4, 0x05, 
-0xa0, 0x03, 0xe7, 0x01, 0x0e, 0x01, 0xc5, 0x00, 0xcf, 0x00, 0x34, 0x02, 0xda, 0x03, 0xd3, 0x03, 
-0xe6, 0x03, 0xf0, 0x03, 0x7d, 0x03, 0x02, 0x03, 0x1d, 0x03, 0x0a, 0x05, 0x48, 0x05, 0xae, 0x03, 
-0x98, 0x02, 0xfa, 0x01, 0x4a, 0x01, 0xbb, 0xff, 0x29, 0xfd, 0xe3, 0xf9, 0xe6, 0xf7, 0x3b, 0xf7, 
-0x40, 0xf6, 0x1f, 0xf6, 0x4d, 0xf6, 0x05, 0xf7, 0x8e, 0xf5, 0x99, 0xf0, 0xf3, 0xe9, 0x89, 0xe6, 
-0x00, 0xed, 0xde, 0xf8, 0x02, 0x05, 0x72, 0x0c, 0xd6, 0x0d, 0xc8, 0x0c, 0x7c, 0x0a, 0xc2, 0x06, 
-0xf4, 0x01, 0x82, 0xfe, 0xd1, 0xfd, 0x58, 0x00, 0xbc, 0x03, 0x71, 0x05, 0x81, 0x06, 0xb1, 0x07, 
-0x9e, 0x08, 0xcc, 0x07, 0x17, 0x06, 0x61, 0x04, 0x96, 0x02, 0xe6, 0x01, 0xb2, 0x01, 0xbf, 0x00, 
-0xc8, 0x00, 0xa1, 0x02, 0x25, 0x04, 0xc2, 0x04, 0xcc, 0x04, 0x26, 0x04, 0xb1, 0x03, 0x10, 0x04, 
-0xe6, 0x03, 0x25, 0x03, 0x9c, 0x02, 0x8d, 0x02, 0x07, 0x03, 0x21, 0x02, 0xc0, 0xff, 0x5c, 0xfd, 
-0xae, 0xfb, 0xc4, 0xf9, 0x6d, 0xf7, 0x9d, 0xf5, 0x50, 0xf5, 0x86, 0xf6, 0x56, 0xf7, 0x58, 0xf6, 
-0x27, 0xf2, 0x8c, 0xec, 0xec, 0xe8, 0xb7, 0xec, 0xe0, 0xf7, 0xce, 0x02, 0x13, 0x0a, 0xcd, 0x0d, 
-0x62, 0x0e, 0x95, 0x0b, 0xd4, 0x06, 0xa7, 0x01, 0x59, 0xfd, 0xe7, 0xfc, 0x1f, 0x00, 0x07, 0x03, 
-0xf5, 0x04, 0xda, 0x06, 0x91, 0x08, 0x89, 0x09, 0x46, 0x08, 0x85, 0x05, 0x28, 0x03, 0xe5, 0x01, 
-0xef, 0x00, 0x8e, 0x00, 0x8e, 0x00, 0x57, 0x01, 0x69, 0x02, 0xfc, 0x01, 0x0a, 0x03, 0x02, 0x05, 
-0xfe, 0x04, 0x1c, 0x03, 0x3f, 0x03, 0x34, 0x05, 0x56, 0x04, 0xaa, 0x03, 0x7d, 0x04, 0x2b, 0x03, 
-0xb5, 0x00, 0xfe, 0xfe, 0xbf, 0xfc, 0x52, 0xfa, 0x85, 0xf9, 0x5c, 0xf8, 0x17, 0xf7, 0x00, 0xf7, 
-0x22, 0xf7, 0xa9, 0xf6, 0xed, 0xf4, 0x32, 0xf2, 0x7f, 0xee, 0x08, 0xec, 0x1e, 0xed, 0x51, 0xf3, 
-0x0a, 0xfd, 0x2a, 0x06, 0xac, 0x0b, 0xb4, 0x0d, 0xeb, 0x0b, 0x00, 0x07, 0x26, 0x02, 0x9b, 0xfe, 
-0xfa, 0xfc, 0xf0, 0xfe, 0xd0, 0x02, 0xeb, 0x05, 0x44, 0x08, 0x5e, 0x09, 0x28, 0x09, 0xe1, 0x08, 
-0x63, 0x07, 0x73, 0x04, 0xcd, 0x01, 0xe8, 0x00, 0xbe, 0x00, 0xb1, 0x00, 0x1c, 0x01, 0x3f, 0x02, 
-0x6f, 0x03, 0x8d, 0x03, 0xee, 0x02, 0xd8, 0x03, 0xaa, 0x05, 0xe0, 0x04, 0xf9, 0x02, 0xa7, 0x03, 
-0xc7, 0x04, 0x95, 0x03, 0x2d, 0x02, 0x02, 0x02, 0xcf, 0x01, 0xcd, 0xff, 0xcf, 0xfc, 0xee, 0xf9, 
-0x5b, 0xf8, 0x7c, 0xf7, 0xae, 0xf6, 0xd7, 0xf5, 0x4d, 0xf6, 0xab, 0xf6, 0xca, 0xf6, 0x69, 0xf4, 
-0xaf, 0xf0, 0x83, 0xed, 0x8f, 0xec, 0xd1, 0xf1, 0x86, 0xfc, 0x89, 0x05, 0xa0, 0x09, 0xbc, 0x0b, 
-0x5f, 0x0b, 0x54, 0x08, 0xef, 0x03, 0xac, 0x00, 0x35, 0xff, 0xf5, 0xff, 0x8f, 0x01, 0x0f, 0x03, 
-0xa8, 0x05, 0x05, 0x09, 0xbf, 0x0a, 0x0a, 0x0b, 0x85, 0x09, 0x4f, 0x06, 0x27, 0x03, 0x78, 0x00, 
-0x53, 0xff, 0x27, 0x00, 0xd2, 0x01, 0xa6, 0x02, 0x4b, 0x03, 0x42, 0x04, 0xe1, 0x04, 0xaa, 0x05, 
-0xf7, 0x05, 0x17, 0x05, 0xcb, 0x03, 0xfb, 0x01, 0x1e, 0x01, 0xe1, 0x01, 0xc9, 0x01, 0x53, 0x00, 
-0xb8, 0xff, 0x56, 0x00, 0xdd, 0xfe, 0x78, 0xfb, 0x21, 0xf9, 0xab, 0xf7, 0xe9, 0xf5, 0x43, 0xf4, 
-0x4a, 0xf4, 0x3c, 0xf7, 0x73, 0xf9, 0xee, 0xf4, 0xe1, 0xed, 0x4b, 0xea, 0xb2, 0xeb, 0xaf, 0xf3, 
-0xd7, 0xff, 0x6f, 0x08, 0xac, 0x0a, 0x6e, 0x0b, 0x6b, 0x0b, 0x7f, 0x07, 0x6d, 0x01, 0xaa, 0xfe, 
-0x91, 0xff, 0xc3, 0x01, 0x14, 0x04, 0x76, 0x06, 0xec, 0x07, 0x54, 0x08, 0x24, 0x08, 0x0e, 0x07, 
-0xc7, 0x05, 0x8c, 0x04, 0x08, 0x03, 0xc7, 0x01, 0x05, 0x01, 0x1a, 0x00, 0xeb, 0xff, 0x97, 0x01, 
-0xb7, 0x03, 0xd7, 0x04, 0x47, 0x05, 0x5f, 0x05, 0x10, 0x04, 0x91, 0x01, 0x9f, 0x00, 0xef, 0x02, 
-0x2d, 0x05, 0x46, 0x04, 0x28, 0x02, 0x1a, 0x02, 0xe6, 0x01, 0x92, 0xfe, 0x1c, 0xfb, 0x3c, 0xf9, 
-0xa6, 0xf8, 0x35, 0xf8, 0x86, 0xf7, 0x3c, 0xf7, 0xaf, 0xf8, 0xaa, 0xf9, 0x4b, 0xf7, 0x48, 0xf3, 
-0x24, 0xf1, 0xbb, 0xed, 0xb1, 0xe9, 0xac, 0xed, 0xd1, 0xf9, 0xe7, 0x03, 0xa8, 0x07, 0xcc, 0x09, 
-0x2e, 0x0c, 0x0f, 0x0c, 0x18, 0x07, 0xab, 0x01, 0x96, 0xff, 0x26, 0x01, 0xa3, 0x03, 0xc8, 0x04, 
-0x61, 0x05, 0x36, 0x07, 0xa8, 0x09, 0x6e, 0x09, 0xc7, 0x06, 0xc6, 0x04, 0x1b, 0x04, 0x27, 0x03, 
-0x93, 0x01, 0xd9, 0x00, 0x05, 0x01, 0x75, 0x01, 0x28, 0x02, 0x5c, 0x03, 0x71, 0x04, 0xd6, 0x04, 
-0x02, 0x04, 0x52, 0x03, 0x5b, 0x03, 0xdb, 0x02, 0xa5, 0x02, 0x1a, 0x03, 0x5b, 0x02, 0xcf, 0x00, 
-0x10, 0x01, 0x55, 0x01, 0x57, 0xff, 0xdd, 0xfc, 0x67, 0xfb, 0xb2, 0xf9, 0x3c, 0xf8, 0xa3, 0xf6, 
-0x48, 0xf5, 0x7c, 0xf5, 0xd1, 0xf6, 0x73, 0xf6, 0x6e, 0xf3, 0xe9, 0xef, 0xfc, 0xec, 0x3c, 0xee, 
-0x99, 0xf4, 0xe3, 0xfd, 0x37, 0x05, 0x25, 0x09, 0xc0, 0x0a, 0x1e, 0x0b, 0x20, 0x09, 0xb7, 0x04, 
-0x31, 0x01, 0xc4, 0x00, 0x85, 0x02, 0x92, 0x03, 0x24, 0x04, 0x61, 0x05, 0x46, 0x07, 0x3f, 0x08, 
-0xd8, 0x07, 0xdd, 0x05, 0xf2, 0x03, 0xff, 0x02, 0x6e, 0x02, 0x74, 0x01, 0xd9, 0x00, 0x6b, 0x01, 
-0x6e, 0x02, 0x3b, 0x03, 0x8c, 0x03, 0x60, 0x03, 0xec, 0x02, 0x2f, 0x02, 0xb6, 0x01, 0xb6, 0x01, 
-0x0d, 0x03, 0xe2, 0x04, 0x16, 0x04, 0xab, 0x01, 0x4d, 0x01, 0x35, 0x02, 0x54, 0x00, 0xd6, 0xfc, 
-0x26, 0xfb, 0xd0, 0xfa, 0x25, 0xf9, 0x7d, 0xf7, 0x43, 0xf7, 0x6b, 0xf8, 0x6f, 0xf9, 0xb8, 0xf8, 
-0x94, 0xf6, 0x0f, 0xf4, 0x39, 0xf1, 0xdc, 0xed, 0x39, 0xed, 0x71, 0xf1, 0x75, 0xf9, 0x39, 0x02, 
-0x67, 0x08, 0x15, 0x0b, 0x93, 0x0b, 0x5d, 0x0a, 0xa6, 0x06, 0x00, 0x03, 0xeb, 0x01, 0xd5, 0x01, 
-0x54, 0x02, 0xd0, 0x03, 0x70, 0x05, 0xbc, 0x06, 0x1d, 0x08, 0x4e, 0x08, 0xa5, 0x06, 0xb3, 0x04, 
-0x05, 0x03, 0xde, 0x01, 0x6e, 0x01, 0x40, 0x01, 0xbe, 0x01, 0xfe, 0x02, 0xe7, 0x03, 0x9f, 0x03, 
-0x4f, 0x03, 0x9e, 0x03, 0xdb, 0x03, 0xb1, 0x03, 0x0a, 0x03, 0x5a, 0x02, 0x48, 0x02, 0xbf, 0x02, 
-0x72, 0x02, 0x9c, 0x01, 0x17, 0x01, 0x50, 0x00, 0x64, 0xfe, 0x2e, 0xfc, 0xa8, 0xfa, 0x50, 0xf9, 
-0xba, 0xf7, 0xf9, 0xf5, 0x93, 0xf5, 0x75, 0xf6, 0xba, 0xf6, 0x21, 0xf6, 0xa3, 0xf4, 0xed, 0xf1, 
-0xd7, 0xee, 0xf7, 0xef, 0xf8, 0xf6, 0x59, 0xff, 0x3c, 0x04, 0xe7, 0x05, 0x45, 0x08, 0x9f, 0x0a, 
-0x56, 0x09, 0xcb, 0x04, 0xbc, 0x01, 0xe0, 0x01, 0x28, 0x03, 0xea, 0x03, 0x18, 0x04, 0x25, 0x05, 
-0x26, 0x07, 0xef, 0x07, 0xb6, 0x06, 0xaa, 0x05, 0xa1, 0x05, 0xbd, 0x04, 0x98, 0x02, 0x1e, 0x01, 
-0x64, 0x01, 0x55, 0x02, 0xc7, 0x02, 0xfe, 0x02, 0x98, 0x03, 0xe7, 0x03, 0xd3, 0x03, 0xb4, 0x03, 
-0x40, 0x03, 0x2d, 0x02, 0xf8, 0x01, 0xf9, 0x02, 0x48, 0x02, 0x1e, 0x00, 0x82, 0xff, 0x72, 0x00, 
-0x9e, 0xff, 0x87, 0xfc, 0xfb, 0xf9, 0xe2, 0xf8, 0x2b, 0xf8, 0x75, 0xf7, 0x8c, 0xf7, 0x37, 0xf9, 
-0xd4, 0xfa, 0x9d, 0xf9, 0x2a, 0xf6, 0x9e, 0xf3, 0x90, 0xf2, 0xb0, 0xf0, 0x27, 0xf0, 0x0b, 0xf5, 
-0xbe, 0xfd, 0x0f, 0x05, 0x49, 0x08, 0x62, 0x09, 0xcf, 0x09, 0x9c, 0x08, 0x2f, 0x05, 0xf7, 0x01, 
-0x5d, 0x01, 0x03, 0x02, 0x7b, 0x02, 0x96, 0x03, 0x73, 0x05, 0x9e, 0x06, 0xb0, 0x06, 0xc8, 0x06, 
-0xac, 0x06, 0x9f, 0x05, 0x23, 0x04, 0x46, 0x03, 0xb0, 0x02, 0xb4, 0x01, 0x18, 0x01, 0xb0, 0x01, 
-0xc2, 0x02, 0xc0, 0x02, 0x6a, 0x02, 0x54, 0x03, 0xb9, 0x04, 0x7c, 0x04, 0x0f, 0x03, 0x5d, 0x02, 
-0xf0, 0x01, 0xb2, 0x00, 0xdd, 0xff, 0x37, 0x00, 0x87, 0x00, 0x0e, 0xff, 0x63, 0xfc, 0x41, 0xfa, 
-0x97, 0xf9, 0x45, 0xf9, 0x22, 0xf8, 0x67, 0xf7, 0x19, 0xf8, 0xe8, 0xf8, 0x6b, 0xf8, 0x37, 0xf7, 
-0x65, 0xf5, 0xee, 0xf2, 0x44, 0xf1, 0x32, 0xf3, 0x2d, 0xf8, 0xde, 0xfd, 0xcf, 0x02, 0x43, 0x06, 
-0xea, 0x07, 0xc8, 0x07, 0x23, 0x07, 0x05, 0x06, 0x26, 0x04, 0x95, 0x02, 0xda, 0x02, 0xe6, 0x04, 
-0xcc, 0x05, 0x38, 0x05, 0x50, 0x05, 0x23, 0x06, 0xcb, 0x05, 0x42, 0x04, 0xce, 0x03, 0x97, 0x04, 
-0xaa, 0x04, 0x0d, 0x03, 0x84, 0x01, 0x76, 0x01, 0x77, 0x01, 0x42, 0x01, 0x36, 0x02, 0xe1, 0x03, 
-0x73, 0x04, 0xc0, 0x03, 0xee, 0x02, 0x31, 0x02, 0x8a, 0x01, 0x9c, 0x00, 0x43, 0xff, 0xb0, 0xfe, 
-0x31, 0xff, 0x4b, 0xff, 0xef, 0xfd, 0xf4, 0xfb, 0xb0, 0xfa, 0x94, 0xfa, 0x98, 0xfa, 0xa5, 0xf9, 
-0x7c, 0xf9, 0x68, 0xfa, 0x81, 0xf9, 0x25, 0xf7, 0x5c, 0xf6, 0x79, 0xf6, 0xbb, 0xf4, 0x59, 0xf3, 
-0x6c, 0xf6, 0x7c, 0xfb, 0x43, 0xfe, 0x5e, 0x00, 0xa2, 0x04, 0x09, 0x08, 0x46, 0x07, 0x45, 0x05, 
-0x82, 0x05, 0x29, 0x06, 0xda, 0x04, 0x9f, 0x03, 0x8c, 0x04, 0xd5, 0x05, 0xa2, 0x05, 0x26, 0x05, 
-0x4e, 0x05, 0xa9, 0x05, 0x67, 0x05, 0x6e, 0x04, 0x73, 0x03, 0x1c, 0x03, 0xb6, 0x02, 0x3e, 0x02, 
-0xe6, 0x01, 0xe2, 0x01, 0x52, 0x02, 0x03, 0x03, 0x0e, 0x03, 0x05, 0x02, 0xa2, 0x01, 0x60, 0x02, 
-0x8d, 0x02, 0xa2, 0x00, 0xe0, 0xfe, 0xd6, 0xff, 0xd0, 0x00, 0x56, 0xfe, 0x1d, 0xfb, 0xed, 0xfa, 
-0x84, 0xfb, 0x3b, 0xf9, 0xa0, 0xf6, 0xcd, 0xf6, 0x4c, 0xf8, 0xee, 0xf7, 0x69, 0xf6, 0x55, 0xf6, 
-0xa7, 0xf6, 0x67, 0xf6, 0xf3, 0xf5, 0x7c, 0xf5, 0xb1, 0xf6, 0xbc, 0xfa, 0xa9, 0xfe, 0xca, 0x00, 
-0x18, 0x04, 0xfc, 0x07, 0x6e, 0x08, 0x59, 0x06, 0x0a, 0x06, 0xa7, 0x07, 0x35, 0x07, 0x8f, 0x04, 
-0x29, 0x04, 0x9a, 0x06, 0x99, 0x07, 0x65, 0x06, 0x41, 0x05, 0x50, 0x05, 0xd0, 0x05, 0x3b, 0x05, 
-0x74, 0x03, 0x73, 0x02, 0x5b, 0x03, 0xf6, 0x03, 0x9a, 0x02, 0x47, 0x01, 0x79, 0x02, 0x24, 0x04, 
-0xd0, 0x02, 0xf8, 0xff, 0x81, 0x00, 0x88, 0x03, 0xd5, 0x03, 0xa9, 0x00, 0x38, 0xff, 0xf7, 0x00, 
-0x83, 0x00, 0xad, 0xfc, 0x21, 0xfa, 0x32, 0xfb, 0x91, 0xfb, 0x5a, 0xf9, 0xeb, 0xf7, 0xa9, 0xf8, 
-0xf0, 0xf8, 0x62, 0xf7, 0x21, 0xf6, 0x01, 0xf7, 0x0b, 0xf8, 0x14, 0xf7, 0xaa, 0xf5, 0xba, 0xf6, 
-0xca, 0xf9, 0xba, 0xfb, 0x5d, 0xfc, 0x67, 0xfe, 0x31, 0x03, 0x97, 0x06, 0xe8, 0x05, 0xb6, 0x04, 
-0x73, 0x06, 0x39, 0x08, 0xff, 0x06, 0x5a, 0x04, 0x94, 0x03, 0x68, 0x05, 0xcb, 0x06, 0x6d, 0x05, 
-0x9c, 0x03, 0x27, 0x04, 0x3b, 0x05, 0x6f, 0x04, 0x58, 0x03, 0xd0, 0x03, 0x54, 0x04, 0xdc, 0x03, 
-0x9d, 0x02, 0xf1, 0x01, 0x57, 0x02, 0x61, 0x02, 0xc3, 0x01, 0x9d, 0x01, 0x0b, 0x02, 0xa8, 0x02, 
-0x53, 0x02, 0xb1, 0x00, 0x9d, 0xff, 0xac, 0xff, 0xf7, 0xfe, 0x31, 0xfd, 0xec, 0xfb, 0x33, 0xfb, 
-0x40, 0xfa, 0x85, 0xf9, 0xeb, 0xf8, 0x2f, 0xf8, 0x3c, 0xf8, 0xbf, 0xf8, 0x57, 0xf8, 0x6d, 0xf7, 
-0x2c, 0xf8, 0x09, 0xfa, 0x42, 0xfa, 0x33, 0xf9, 0x04, 0xf9, 0x9b, 0xfa, 0x05, 0xfd, 0x95, 0xfe, 
-0xfc, 0xff, 0xe4, 0x02, 0xdf, 0x05, 0xd3, 0x05, 0x45, 0x05, 0xd9, 0x05, 0x09, 0x06, 0xb8, 0x04, 
-0x0e, 0x04, 0x68, 0x05, 0x0f, 0x06, 0xa7, 0x04, 0x58, 0x03, 0xc2, 0x04, 0xb1, 0x05, 0xba, 0x03, 
-0x6b, 0x02, 0xca, 0x03, 0x1c, 0x04, 0x27, 0x02, 0x3f, 0x02, 0xd5, 0x04, 0x06, 0x04, 0xfb, 0x00, 
-0x9b, 0x01, 0x2b, 0x04, 0xc5, 0x03, 0xd0, 0x01, 0xfd, 0x01, 0xb2, 0x02, 0x38, 0x01, 0x9a, 0xff, 
-0x78, 0xff, 0xc3, 0xfe, 0xa4, 0xfc, 0xaa, 0xfa, 0xf3, 0xf9, 0x28, 0xfa, 0x14, 0xfa, 0x6e, 0xf9, 
-0x39, 0xf9, 0xa0, 0xf9, 0xdb, 0xf9, 0x29, 0xf9, 0x61, 0xf9, 0xa2, 0xfa, 0xa5, 0xfa, 0x12, 0xf9, 
-0xcb, 0xf8, 0xc9, 0xfa, 0x2d, 0xfd, 0x41, 0xfe, 0x1c, 0xff, 0x75, 0x01, 0x20, 0x03, 0xd5, 0x02, 
-0xf1, 0x01, 0x40, 0x02, 0x75, 0x04, 0x22, 0x06, 0x5c, 0x05, 0x00, 0x04, 0xae, 0x04, 0xb1, 0x05, 
-0x89, 0x04, 0x47, 0x03, 0xf3, 0x03, 0xf7, 0x05, 0xcf, 0x05, 0x11, 0x03, 0x77, 0x02, 0x75, 0x05, 
-0x71, 0x06, 0x7a, 0x02, 0xe8, 0xff, 0x19, 0x02, 0x87, 0x03, 0xec, 0x00, 0xa5, 0xfe, 0xab, 0x00, 
-0x43, 0x03, 0xc5, 0x01, 0x56, 0xfe, 0xc4, 0xfd, 0x12, 0xff, 0x2f, 0xfe, 0xd8, 0xfa, 0xeb, 0xf8, 
-0x8d, 0xfa, 0xa6, 0xfc, 0xe3, 0xfb, 0x17, 0xfa, 0x64, 0xfa, 0x9d, 0xfb, 0x12, 0xfb, 0x18, 0xfa, 
-0xff, 0xf9, 0xa9, 0xfa, 0x26, 0xfc, 0x6c, 0xfd, 0xb7, 0xfc, 0x80, 0xfc, 0x71, 0xfe, 0x0e, 0x00, 
-0xd3, 0xff, 0x5c, 0x00, 0xd2, 0x02, 0x56, 0x03, 0xe2, 0x01, 0xd3, 0x01, 0x6c, 0x03, 0xdd, 0x03, 
-0xf5, 0x02, 0xb3, 0x02, 0x75, 0x04, 0x99, 0x05, 0xe9, 0x03, 0x86, 0x02, 0xcd, 0x03, 0xad, 0x04, 
-0xb7, 0x03, 0x85, 0x03, 0x81, 0x04, 0xeb, 0x04, 0x63, 0x03, 0xf1, 0x01, 0x65, 0x02, 0xec, 0x02, 
-0x14, 0x02, 0x4b, 0x01, 0xcb, 0x01, 0x71, 0x01, 0x0b, 0x00, 0x3c, 0xff, 0xed, 0xfe, 0x4d, 0xfe, 
-0x78, 0xfd, 0xf8, 0xfc, 0x94, 0xfc, 0xa4, 0xfb, 0x3d, 0xfb, 0x66, 0xfc, 0x11, 0xfd, 0xcf, 0xfb, 
-0x4d, 0xfb, 0xb6, 0xfc, 0x42, 0xfd, 0x0b, 0xfc, 0x78, 0xfb, 0xea, 0xfb, 0x8b, 0xfc, 0x22, 0xfc, 
-0x7c, 0xfb, 0xcd, 0xfc, 0x0a, 0xff, 0x46, 0xff, 0xeb, 0xfe, 0x5f, 0x01, 0x12, 0x03, 0xb2, 0x00, 
-0xc4, 0xfe, 0xba, 0x00, 0x35, 0x02, 0x62, 0x00, 0x29, 0xff, 0x29, 0x01, 0x4b, 0x03, 0xb6, 0x02, 
-0x88, 0x00, 0xbe, 0x01, 0xf5, 0x04, 0x78, 0x04, 0xd2, 0x01, 0x55, 0x02, 0xf5, 0x03, 0x3a, 0x03, 
-0x52, 0x02, 0x17, 0x03, 0x58, 0x03, 0xa3, 0x02, 0xcb, 0x02, 0xe1, 0x02, 0x96, 0x02, 0x48, 0x02, 
-0x9f, 0x01, 0xa7, 0x00, 0x6a, 0x00, 0xf7, 0xff, 0x25, 0xff, 0x9f, 0xfe, 0x18, 0xfe, 0xbc, 0xfd, 
-0x69, 0xfe, 0x81, 0xfe, 0xef, 0xfc, 0x49, 0xfc, 0x21, 0xfd, 0x2c, 0xfd, 0x40, 0xfc, 0x6c, 0xfc, 
-0x80, 0xfd, 0x4f, 0xfe, 0x8e, 0xfe, 0xca, 0xfd, 0xa7, 0xfc, 0x8e, 0xfc, 0x25, 0xfe, 0x6b, 0xff, 
-0x71, 0xfe, 0xe7, 0xfd, 0xb2, 0xff, 0xc0, 0x00, 0x6d, 0xff, 0xcb, 0xfd, 0x4b, 0xfe, 0xa4, 0x00, 
-0x30, 0x02, 0x51, 0x01, 0x42, 0x00, 0xc8, 0x00, 0x37, 0x02, 0x78, 0x02, 0x6b, 0x01, 0x68, 0x00, 
-0x25, 0x01, 0x4b, 0x02, 0x91, 0x01, 0x51, 0x00, 0xa3, 0x00, 0xc4, 0x01, 0x94, 0x01, 0xf5, 0x00, 
-0x0c, 0x01, 0xd8, 0x01, 0x38, 0x02, 0xd2, 0x01, 0x48, 0x01, 0x88, 0x01, 0xae, 0x01, 0x83, 0x01, 
-0x15, 0x01, 0x80, 0x00, 0x67, 0x00, 0x31, 0x01, 0x32, 0x01, 0xd7, 0xff, 0xc2, 0xff, 0x04, 0x01, 
-0x30, 0x00, 0x05, 0xfe, 0xdf, 0xfd, 0xa3, 0xfe, 0xf9, 0xfd, 0x80, 0xfc, 0x51, 0xfc, 0xf6, 0xfc, 
-0x18, 0xfd, 0xda, 0xfc, 0x53, 0xfd, 0x1d, 0xfe, 0xf8, 0xfd, 0xfe, 0xfd, 0x2c, 0xff, 0x24, 0x00, 
-0xb8, 0xff, 0xe0, 0xfe, 0xf7, 0xfe, 0xdd, 0xff, 0x8f, 0x00, 0x72, 0x01, 0x91, 0x02, 0x4b, 0x02, 
-0x39, 0x01, 0x4b, 0x01, 0xb0, 0x01, 0xd6, 0x00, 0x4d, 0x00, 0xd1, 0x00, 0xd9, 0x00, 0x5b, 0x00, 
-0x19, 0x00, 0x3b, 0x00, 0x53, 0x00, 0xa3, 0x00, 0xd7, 0x00, 0xa7, 0x00, 0x9d, 0x00, 0xb6, 0x00, 
-0xbc, 0x00, 0x6f, 0x00, 0xd6, 0xff, 0xe6, 0xff, 0x93, 0x00, 0xa9, 0x00, 0xd7, 0x00, 0x7f, 0x01, 
-0x16, 0x02, 0xbc, 0x01, 0x6f, 0x00, 0xcc, 0xff, 0x40, 0x00, 0x38, 0x00, 0x0e, 0xff, 0x38, 0xfe, 
-0xe3, 0xfe, 0x6f, 0xff, 0xe7, 0xfe, 0x5b, 0xfe, 0x9b, 0xfe, 0x1f, 0xff, 0x57, 0xff, 0xda, 0xfe, 
-0x24, 0xfe, 0x23, 0xfe, 0x8d, 0xfe, 0xf0, 0xfe, 0x16, 0xff, 0x64, 0xff, 0x25, 0x00, 0x27, 0x01, 
-0x85, 0x01, 0x5c, 0x01, 0x06, 0x01, 0xd9, 0x00, 0x91, 0x00, 0x40, 0x00, 0x69, 0x00, 0xa5, 0x00, 
-0xcb, 0x00, 0xbe, 0x00, 0x65, 0x00, 0x75, 0x00, 0xff, 0x00, 0x21, 0x01, 0xb6, 0x00, 0x09, 0x00, 
-0x10, 0x00, 0xab, 0x00, 0xc2, 0x00, 0x29, 0x00, 0xfd, 0xff, 0x88, 0x00, 0xe6, 0x00, 0xa0, 0x00, 
-0x5a, 0x00, 0x87, 0x00, 0x82, 0x00, 0xed, 0xff, 0x46, 0xff, 0x34, 0xff, 0x48, 0xff, 0x79, 0xff, 
-0xa3, 0xff, 0x80, 0xff, 0x5e, 0xff, 0x33, 0xff, 0xee, 0xfe, 0xac, 0xfe, 0xe0, 0xfe, 0x00, 0xff, 
-0x78, 0xff, 0xea, 0xff, 0xec, 0xff, 0xd4, 0xff, 0x44, 0x00, 0x8a, 0x00, 0x21, 0x00, 0xff, 0xff, 
-0x71, 0x00, 0x2a, 0x01, 0x53, 0x01, 0x64, 0x01, 0x89, 0x01, 0xdf, 0x01, 0x76, 0x01, 0xb4, 0x00, 
-0x60, 0x00, 0xdc, 0x00, 0x7a, 0x01, 0xfb, 0x00, 0x8b, 0xff, 0xed, 0xfe, 0x9b, 0xff, 0xc9, 0xff, 
-0x09, 0xff, 0xb5, 0xfe, 0x68, 0xff, 0x28, 0x00, 0x5a, 0x00, 0xe5, 0xff, 0x82, 0xff, 0xda, 0xff, 
-0x91, 0x00, 0xc9, 0x00, 0x66, 0x00, 0xf7, 0xff, 0x15, 0x00, 0x6d, 0x00, 0x08, 0x00, 0x46, 0xff, 
-0x20, 0xff, 0x60, 0xff, 0x51, 0xff, 0x47, 0xff, 0xfe, 0xfe, 0x70, 0xfe, 0x6c, 0xfe, 0x06, 0xff, 
-0x7a, 0xff, 0x5f, 0xff, 0x97, 0xff, 0x19, 0x00, 0x1c, 0x00, 0x90, 0xff, 0xa6, 0xff, 0x3f, 0x00, 
-0xbe, 0x00, 0x83, 0x00, 0x5d, 0x00, 0xe2, 0x00, 0xdc, 0x00, 0x0f, 0x00, 0xce, 0xff, 0x7c, 0x00, 
-0x00, 0x01, 0xe7, 0x00, 0xa3, 0x00, 0x63, 0x00, 0x27, 0x00, 0x6d, 0x00, 0xc6, 0x00, 0x92, 0x00, 
-0x4f, 0x00, 0x5d, 0x00, 0x89, 0x00, 0x72, 0x00, 0x40, 0x00, 0x4c, 0x00, 0x6a, 0x00, 0x84, 0x00, 
-0x87, 0x00, 0x66, 0x00, 0x22, 0x00, 0xcb, 0xff, 0xad, 0xff, 0xe9, 0xff, 0x0b, 0x00, 0xd0, 0xff, 
-0x8c, 0xff, 0x98, 0xff, 0xcc, 0xff, 0xde, 0xff, 0xca, 0xff, 0xbf, 0xff, 0xb4, 0xff, 0x80, 0xff, 
-0x5b, 0xff, 0xc6, 0xff, 0x11, 0x00, 0xca, 0xff, 0x8e, 0xff, 0xce, 0xff, 0xe7, 0xff, 0xcf, 0xff, 
-0xee, 0xff, 0x10, 0x00, 0xfc, 0xff, 0x00, 0x00, 0x1d, 0x00, 0x0f, 0x00, 0xfc, 0xff, 0x0d, 0x00, 
-0x35, 0x00, 0x46, 0x00, 0x13, 0x00, 0xe0, 0xff, 0x01, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xbc, 0xff, 
-0xdf, 0xff, 0x4c, 0x00, 0x63, 0x00, 0x1b, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x15, 0x00, 
-0x07, 0x00, 0x29, 0x00, 0x33, 0x00, 0xff, 0xff, 0xe5, 0xff, 0xf3, 0xff, 0xf0, 0xff, 0xe6, 0xff, 
-0xd6, 0xff, 0xd4, 0xff, 0xfc, 0xff, 0x0c, 0x00, 0xd9, 0xff, 0xca, 0xff, 0xfb, 0xff, 0x11, 0x00, 
-0x04, 0x00, 0xee, 0xff, 0xe3, 0xff, 0xf9, 0xff, 0x13, 0x00, 0x05, 0x00, 0xf3, 0xff, 0x00, 0x00, 
-0x04, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x24, 0x00, 0x1a, 0x00, 0xfa, 0xff, 0xf9, 0xff, 
-0x02, 0x00, 0x07, 0x00, 0xfa, 0xff, 0xf6, 0xff, 0x0d, 0x00, 0x09, 0x00, 0xfb, 0xff, 0x0c, 0x00, 
-0x13, 0x00, 0x01, 0x00, 0xea, 0xff, 0xfb, 0xff, 0x0a, 0x00, 0xfc, 0xff, 0xf8, 0xff, 0x07, 0x00, 
-0x0b, 0x00, 0xf9, 0xff, 0xef, 0xff, 0xfe, 0xff, 0x02, 0x00, 0xfa, 0xff, 0x04, 0x00, 0x05, 0x00, 
-0xfc, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0x03, 0x00, 0x02, 0x00, 0xfa, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x02, 0x00, 
-0x06, 0x00, 0x02, 0x00, 0xf5, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xfa, 0xff, 0xfc, 0xff, 0x07, 0x00, 0x07, 0x00, 0x05, 0x00, 0x06, 0x00, 0x01, 0x00, 0xfa, 0xff, 
-0xfe, 0xff, 0x03, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x08, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x02, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0xfb, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x07, 0x00, 0x03, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 
-0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-};
-
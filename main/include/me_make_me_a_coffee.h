@@ -1,1102 +0,0 @@
-#include <stdio.h>
-const unsigned char me_make_me_a_coffee[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 
-0xfe, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 
-0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 
-0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0xfe, 0xff, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 0x02, 0x00, 
-0xff, 0xff, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0xfd, 0xff, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x02, 0x00, 0x06, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 
-0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0xff, 0xff, 0x02, 0x00, 
-0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0xfd, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfb, 0xff, 0xfc, 0xff, 
-0xf9, 0xff, 0xfe, 0xff, 0x01, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0f, 0x00, 
-0x0d, 0x00, 0x09, 0x00, 0x12, 0x00, 0x15, 0x00, 0x12, 0x00, 0x13, 0x00, 0x13, 0x00, 0x14, 0x00, 
-0x11, 0x00, 0x11, 0x00, 0x09, 0x00, 0xfb, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xec, 0xff, 0xdc, 0xff, 
-0xdd, 0xff, 0xe2, 0xff, 0xd8, 0xff, 0xcd, 0xff, 0xc7, 0xff, 0xcd, 0xff, 0xd9, 0xff, 0xd7, 0xff, 
-0xda, 0xff, 0xde, 0xff, 0xed, 0xff, 0x12, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x33, 0x00, 
-0x48, 0x00, 0x45, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x45, 0x00, 0x33, 0x00, 
-0x35, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0xec, 0xff, 0xd1, 0xff, 0xc9, 0xff, 0xad, 0xff, 0x7b, 0xff, 
-0x6c, 0xff, 0x5d, 0xff, 0x57, 0xff, 0x5d, 0xff, 0x4e, 0xff, 0x5c, 0xff, 0x87, 0xff, 0xab, 0xff, 
-0xd5, 0xff, 0xf0, 0xff, 0x26, 0x00, 0x81, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xe2, 0x00, 0xfb, 0x00, 
-0xfe, 0x00, 0x01, 0x01, 0xda, 0x00, 0xb4, 0x00, 0xa3, 0x00, 0x6a, 0x00, 0x29, 0x00, 0xfd, 0xff, 
-0xca, 0xff, 0xa2, 0xff, 0x86, 0xff, 0x61, 0xff, 0x47, 0xff, 0x4c, 0xff, 0x50, 0xff, 0x3d, 0xff, 
-0x37, 0xff, 0x41, 0xff, 0x5a, 0xff, 0x80, 0xff, 0x82, 0xff, 0x89, 0xff, 0xc4, 0xff, 0xfc, 0xff, 
-0x25, 0x00, 0x33, 0x00, 0x39, 0x00, 0x69, 0x00, 0x94, 0x00, 0x96, 0x00, 0x8f, 0x00, 0x95, 0x00, 
-0xb5, 0x00, 0xc0, 0x00, 0xac, 0x00, 0x95, 0x00, 0x8a, 0x00, 0x95, 0x00, 0x92, 0x00, 0x69, 0x00, 
-0x4f, 0x00, 0x55, 0x00, 0x54, 0x00, 0x2b, 0x00, 0xf4, 0xff, 0xd4, 0xff, 0xbf, 0xff, 0x9c, 0xff, 
-0x5a, 0xff, 0x1d, 0xff, 0x06, 0xff, 0xdf, 0xfe, 0xa2, 0xfe, 0x6b, 0xfe, 0x2c, 0xfe, 0xfe, 0xfd, 
-0xda, 0xfd, 0xbc, 0xfd, 0xb6, 0xfd, 0xba, 0xfd, 0xe6, 0xfd, 0x3a, 0xfe, 0x7d, 0xfe, 0xd6, 0xfe, 
-0x56, 0xff, 0xd0, 0xff, 0x54, 0x00, 0xf2, 0x00, 0x8b, 0x01, 0x1e, 0x02, 0xad, 0x02, 0x13, 0x03, 
-0x63, 0x03, 0xad, 0x03, 0xd4, 0x03, 0xdb, 0x03, 0xc0, 0x03, 0x8f, 0x03, 0x5c, 0x03, 0x0a, 0x03, 
-0x8e, 0x02, 0xf8, 0x01, 0x67, 0x01, 0xdb, 0x00, 0x3a, 0x00, 0x91, 0xff, 0xd7, 0xfe, 0x06, 0xfe, 
-0x4b, 0xfd, 0x6d, 0xfc, 0x5a, 0xfb, 0x78, 0xfa, 0x94, 0xf9, 0xa1, 0xf8, 0xf3, 0xf7, 0x50, 0xf7, 
-0xe9, 0xf6, 0xed, 0xf6, 0x03, 0xf7, 0xa5, 0xf7, 0xd6, 0xf8, 0x31, 0xfa, 0x37, 0xfc, 0x93, 0xfe, 
-0x0b, 0x01, 0x0b, 0x04, 0xef, 0x06, 0x83, 0x09, 0x09, 0x0c, 0x25, 0x0e, 0xb2, 0x0f, 0x9f, 0x10, 
-0xdb, 0x10, 0x8b, 0x10, 0xaa, 0x0f, 0x20, 0x0e, 0xf9, 0x0b, 0x80, 0x09, 0xe4, 0x06, 0x0d, 0x04, 
-0x0a, 0x01, 0x1c, 0xfe, 0x6f, 0xfb, 0xff, 0xf8, 0xc2, 0xf6, 0xaa, 0xf4, 0xfb, 0xf2, 0xeb, 0xf1, 
-0x00, 0xf1, 0x2e, 0xf0, 0xdb, 0xef, 0xc5, 0xef, 0xdd, 0xef, 0x2d, 0xf0, 0x79, 0xf0, 0x33, 0xf1, 
-0xe3, 0xf2, 0x12, 0xf5, 0x74, 0xf7, 0x78, 0xfa, 0x1f, 0xfe, 0x2c, 0x02, 0x47, 0x06, 0xc7, 0x09, 
-0xf9, 0x0c, 0x3c, 0x10, 0xd6, 0x12, 0x66, 0x14, 0x1a, 0x15, 0x0a, 0x15, 0x64, 0x14, 0x0d, 0x13, 
-0x9e, 0x10, 0xa8, 0x0d, 0xd5, 0x0a, 0xd0, 0x07, 0xcd, 0x04, 0x14, 0x02, 0x67, 0xff, 0x63, 0xfd, 
-0xe4, 0xfb, 0x6b, 0xfa, 0x7f, 0xf9, 0xfe, 0xf8, 0xc4, 0xf8, 0x00, 0xf9, 0x07, 0xf9, 0xc8, 0xf8, 
-0x00, 0xf9, 0x41, 0xf9, 0xac, 0xf8, 0xbb, 0xf7, 0xbc, 0xf6, 0x7b, 0xf5, 0x65, 0xf4, 0xdd, 0xf2, 
-0x0f, 0xf1, 0xbf, 0xf0, 0x3b, 0xf1, 0xc2, 0xf1, 0x73, 0xf3, 0x35, 0xf6, 0xe3, 0xf9, 0x44, 0xfe, 
-0xea, 0x01, 0x86, 0x05, 0x04, 0x0a, 0xb7, 0x0d, 0x53, 0x10, 0x52, 0x12, 0x26, 0x13, 0x9c, 0x13, 
-0x64, 0x13, 0x9a, 0x11, 0x68, 0x0f, 0xf9, 0x0c, 0x5f, 0x0a, 0x28, 0x08, 0xa1, 0x05, 0x40, 0x03, 
-0x88, 0x01, 0xe8, 0xff, 0x8c, 0xfe, 0x3b, 0xfd, 0x1e, 0xfc, 0xd6, 0xfb, 0x94, 0xfb, 0x21, 0xfb, 
-0xe4, 0xfa, 0x75, 0xfa, 0x2e, 0xfa, 0xdb, 0xf9, 0x6e, 0xf8, 0xfa, 0xf6, 0xc5, 0xf5, 0xf2, 0xf3, 
-0x2f, 0xf2, 0x1a, 0xf0, 0x38, 0xee, 0x04, 0xee, 0x30, 0xee, 0xbb, 0xee, 0xf7, 0xf0, 0x6c, 0xf4, 
-0xf4, 0xf8, 0xc0, 0xfd, 0x0f, 0x02, 0xe2, 0x06, 0xf7, 0x0b, 0x16, 0x10, 0x10, 0x13, 0x0b, 0x15, 
-0x36, 0x16, 0xb1, 0x16, 0xf7, 0x15, 0xe1, 0x13, 0x5d, 0x11, 0xe4, 0x0e, 0x43, 0x0c, 0x85, 0x09, 
-0xc0, 0x06, 0x62, 0x04, 0x95, 0x02, 0xe5, 0x00, 0x2c, 0xff, 0xef, 0xfd, 0x44, 0xfd, 0xc0, 0xfc, 
-0x53, 0xfc, 0xfc, 0xfb, 0xba, 0xfb, 0x95, 0xfb, 0x00, 0xfb, 0x2e, 0xfa, 0x57, 0xf9, 0xe3, 0xf7, 
-0x19, 0xf6, 0x3c, 0xf4, 0xf5, 0xf1, 0x7b, 0xef, 0x3f, 0xed, 0xa7, 0xeb, 0x19, 0xeb, 0x84, 0xeb, 
-0xdd, 0xec, 0xe7, 0xef, 0x62, 0xf4, 0x2b, 0xf9, 0x43, 0xfe, 0x88, 0x03, 0xcc, 0x08, 0xdc, 0x0d, 
-0xbb, 0x11, 0x96, 0x14, 0xb4, 0x16, 0x98, 0x17, 0x96, 0x17, 0x62, 0x16, 0xf7, 0x13, 0x4f, 0x11, 
-0x9c, 0x0e, 0xa3, 0x0b, 0x9c, 0x08, 0xe4, 0x05, 0x9d, 0x03, 0xa0, 0x01, 0xc7, 0xff, 0x0b, 0xfe, 
-0x11, 0xfd, 0xb4, 0xfc, 0x50, 0xfc, 0x30, 0xfc, 0x2c, 0xfc, 0x1b, 0xfc, 0x2a, 0xfc, 0x7e, 0xfb, 
-0x6e, 0xfa, 0xa3, 0xf9, 0x17, 0xf8, 0x28, 0xf6, 0x42, 0xf4, 0x82, 0xf1, 0xeb, 0xee, 0xba, 0xec, 
-0x75, 0xea, 0xd1, 0xe9, 0x45, 0xea, 0x6f, 0xeb, 0xfd, 0xee, 0x7b, 0xf3, 0x45, 0xf8, 0xf3, 0xfd, 
-0x1a, 0x03, 0x96, 0x08, 0x43, 0x0e, 0x04, 0x12, 0xf5, 0x14, 0x78, 0x17, 0x4b, 0x18, 0x24, 0x18, 
-0xa6, 0x16, 0xa6, 0x13, 0x2f, 0x11, 0x9a, 0x0e, 0xf5, 0x0a, 0x12, 0x08, 0xb6, 0x05, 0x79, 0x03, 
-0xda, 0x01, 0xcd, 0xff, 0x2c, 0xfe, 0xdf, 0xfd, 0x8d, 0xfd, 0x4b, 0xfd, 0x38, 0xfd, 0x06, 0xfd, 
-0x5f, 0xfd, 0x75, 0xfd, 0x7f, 0xfc, 0x84, 0xfb, 0xc9, 0xfa, 0x5b, 0xf9, 0x55, 0xf7, 0xd8, 0xf4, 
-0xcc, 0xf1, 0xf8, 0xee, 0x23, 0xec, 0x7b, 0xe9, 0x7b, 0xe8, 0xa4, 0xe8, 0xfd, 0xe9, 0x80, 0xed, 
-0x33, 0xf2, 0x7f, 0xf7, 0x9a, 0xfd, 0x98, 0x03, 0x83, 0x09, 0x51, 0x0f, 0xce, 0x13, 0x46, 0x17, 
-0xc7, 0x19, 0x89, 0x1a, 0x60, 0x1a, 0x26, 0x19, 0x48, 0x16, 0x00, 0x13, 0xc5, 0x0f, 0x5b, 0x0c, 
-0xdd, 0x08, 0xc8, 0x05, 0x6d, 0x03, 0x54, 0x01, 0x91, 0xff, 0xfd, 0xfd, 0xd1, 0xfc, 0xda, 0xfc, 
-0x9d, 0xfc, 0x0d, 0xfc, 0x3b, 0xfc, 0x45, 0xfc, 0x64, 0xfc, 0x3d, 0xfc, 0xf4, 0xfa, 0x11, 0xfa, 
-0x10, 0xf9, 0xdd, 0xf6, 0x7d, 0xf4, 0x9a, 0xf1, 0x63, 0xee, 0xf1, 0xeb, 0x55, 0xe9, 0x82, 0xe7, 
-0xac, 0xe7, 0x97, 0xe8, 0x50, 0xeb, 0xf2, 0xef, 0xbc, 0xf4, 0xc2, 0xfa, 0x2b, 0x01, 0xda, 0x06, 
-0xec, 0x0c, 0xe4, 0x11, 0x99, 0x15, 0xe6, 0x18, 0x2a, 0x1a, 0x36, 0x1a, 0x9c, 0x19, 0x11, 0x17, 
-0xe6, 0x13, 0x89, 0x10, 0x91, 0x0c, 0x29, 0x09, 0x26, 0x06, 0x53, 0x03, 0x6e, 0x01, 0xe6, 0xff, 
-0xb9, 0xfe, 0x28, 0xfe, 0xc7, 0xfd, 0xcc, 0xfd, 0x08, 0xfe, 0x03, 0xfe, 0x29, 0xfe, 0x41, 0xfe, 
-0xee, 0xfd, 0x2d, 0xfd, 0x10, 0xfc, 0x80, 0xfa, 0x48, 0xf8, 0xe8, 0xf5, 0x11, 0xf3, 0x7f, 0xef, 
-0x39, 0xec, 0x25, 0xe9, 0x02, 0xe7, 0x79, 0xe6, 0x80, 0xe6, 0x4d, 0xe8, 0x8b, 0xec, 0x8c, 0xf1, 
-0x2e, 0xf7, 0x83, 0xfd, 0xd1, 0x03, 0x4c, 0x0a, 0x50, 0x10, 0xc7, 0x14, 0x3b, 0x18, 0xbd, 0x1a, 
-0xc5, 0x1b, 0x80, 0x1b, 0xa0, 0x19, 0x95, 0x16, 0x53, 0x13, 0xc4, 0x0f, 0xf0, 0x0b, 0x50, 0x08, 
-0x2f, 0x05, 0xc8, 0x02, 0xe0, 0x00, 0x48, 0xff, 0x31, 0xfe, 0x98, 0xfd, 0x73, 0xfd, 0x83, 0xfd, 
-0x65, 0xfd, 0x6f, 0xfd, 0xe1, 0xfd, 0x04, 0xfe, 0x7e, 0xfd, 0xde, 0xfc, 0xf8, 0xfb, 0x70, 0xfa, 
-0x88, 0xf8, 0xd5, 0xf5, 0x6e, 0xf2, 0x15, 0xef, 0xb1, 0xeb, 0x8c, 0xe8, 0x10, 0xe7, 0x03, 0xe7, 
-0xc7, 0xe7, 0xbb, 0xea, 0x81, 0xef, 0xcb, 0xf4, 0x17, 0xfb, 0x6d, 0x01, 0x8b, 0x07, 0x16, 0x0e, 
-0x52, 0x13, 0xc0, 0x16, 0x6f, 0x19, 0xfe, 0x1a, 0xef, 0x1a, 0x9b, 0x19, 0xec, 0x16, 0x4b, 0x13, 
-0xe9, 0x0f, 0x86, 0x0c, 0xcf, 0x08, 0x9f, 0x05, 0x1e, 0x03, 0x47, 0x01, 0x00, 0x00, 0xbe, 0xfe, 
-0xbd, 0xfd, 0x8c, 0xfd, 0x9d, 0xfd, 0x63, 0xfd, 0x20, 0xfd, 0x04, 0xfd, 0xdc, 0xfc, 0x8e, 0xfc, 
-0xc4, 0xfb, 0x52, 0xfa, 0xbc, 0xf8, 0xec, 0xf6, 0x49, 0xf4, 0xf0, 0xf0, 0x74, 0xed, 0x5e, 0xea, 
-0xad, 0xe7, 0xfa, 0xe5, 0xd1, 0xe5, 0xff, 0xe6, 0xe7, 0xe9, 0x4c, 0xee, 0x95, 0xf3, 0xcf, 0xf9, 
-0x5a, 0x00, 0xce, 0x06, 0x42, 0x0d, 0xe8, 0x12, 0x08, 0x17, 0x15, 0x1a, 0xc9, 0x1b, 0xdf, 0x1b, 
-0xdd, 0x1a, 0x58, 0x18, 0xd6, 0x14, 0x3c, 0x11, 0x74, 0x0d, 0x14, 0x0a, 0x41, 0x07, 0x87, 0x04, 
-0x5a, 0x02, 0xdf, 0x00, 0xb4, 0xff, 0xb8, 0xfe, 0x09, 0xfe, 0x9f, 0xfd, 0x4c, 0xfd, 0xfa, 0xfc, 
-0x93, 0xfc, 0x27, 0xfc, 0xd6, 0xfb, 0x2a, 0xfb, 0xe2, 0xf9, 0x40, 0xf8, 0x52, 0xf6, 0xe1, 0xf3, 
-0xc3, 0xf0, 0x6d, 0xed, 0x1d, 0xea, 0x87, 0xe7, 0xd6, 0xe6, 0xfd, 0xe6, 0x29, 0xe8, 0xc6, 0xeb, 
-0xac, 0xf0, 0xa9, 0xf6, 0x60, 0xfd, 0x8d, 0x03, 0x66, 0x0a, 0x84, 0x11, 0x98, 0x16, 0x40, 0x1a, 
-0xf1, 0x1c, 0x0b, 0x1e, 0x3b, 0x1e, 0x8a, 0x1c, 0x9b, 0x18, 0xbf, 0x14, 0xb9, 0x10, 0x12, 0x0c, 
-0xe7, 0x07, 0xd5, 0x03, 0x6f, 0x00, 0x3c, 0xfe, 0x1b, 0xfc, 0x70, 0xfa, 0xba, 0xf9, 0x68, 0xf9, 
-0xa5, 0xf9, 0xe0, 0xf9, 0x0c, 0xfa, 0xcb, 0xfa, 0x75, 0xfb, 0xe7, 0xfb, 0xd1, 0xfb, 0xfe, 0xfa, 
-0x2a, 0xfa, 0x9a, 0xf8, 0xd9, 0xf5, 0xbe, 0xf2, 0x63, 0xef, 0x12, 0xec, 0x0f, 0xea, 0x34, 0xe9, 
-0x52, 0xe9, 0x42, 0xeb, 0xd6, 0xee, 0xd8, 0xf3, 0x99, 0xf9, 0x2d, 0xff, 0x26, 0x05, 0x8c, 0x0b, 
-0x0f, 0x11, 0x23, 0x15, 0x6e, 0x18, 0xb6, 0x1a, 0xb4, 0x1b, 0x9c, 0x1b, 0xb7, 0x19, 0x6b, 0x16, 
-0xef, 0x12, 0xe2, 0x0e, 0x83, 0x0a, 0x65, 0x06, 0x8e, 0x02, 0x5f, 0xff, 0xe0, 0xfc, 0xeb, 0xfa, 
-0x91, 0xf9, 0xf9, 0xf8, 0xe1, 0xf8, 0xfd, 0xf8, 0x3f, 0xf9, 0xbf, 0xf9, 0x88, 0xfa, 0x1b, 0xfb, 
-0x69, 0xfb, 0x5f, 0xfb, 0x9b, 0xfa, 0x35, 0xf9, 0x3c, 0xf7, 0x2d, 0xf4, 0x6f, 0xf0, 0xf7, 0xec, 
-0xe7, 0xe9, 0x28, 0xe8, 0x35, 0xe8, 0x4d, 0xe9, 0x04, 0xec, 0xf5, 0xf0, 0xdf, 0xf6, 0xdf, 0xfc, 
-0x58, 0x03, 0xc4, 0x09, 0xc9, 0x0f, 0x84, 0x15, 0x9f, 0x19, 0x17, 0x1c, 0x98, 0x1d, 0x0e, 0x1e, 
-0xa2, 0x1c, 0x68, 0x19, 0xb9, 0x15, 0x4a, 0x11, 0x7a, 0x0c, 0x74, 0x08, 0x51, 0x04, 0x4c, 0x00, 
-0xb0, 0xfd, 0xb4, 0xfb, 0x2a, 0xfa, 0x6b, 0xf9, 0x05, 0xf9, 0x1b, 0xf9, 0x9a, 0xf9, 0xf2, 0xf9, 
-0x6b, 0xfa, 0x37, 0xfb, 0x8b, 0xfb, 0x9b, 0xfb, 0x53, 0xfb, 0x0a, 0xfa, 0x69, 0xf8, 0x44, 0xf6, 
-0x19, 0xf3, 0xb5, 0xef, 0x60, 0xec, 0x18, 0xea, 0x9e, 0xe9, 0xe6, 0xe9, 0x9f, 0xeb, 0x37, 0xef, 
-0x85, 0xf4, 0xa7, 0xfa, 0x6e, 0x00, 0x83, 0x06, 0xfc, 0x0c, 0xdd, 0x12, 0x75, 0x17, 0x91, 0x1a, 
-0x76, 0x1c, 0x44, 0x1d, 0x82, 0x1c, 0xce, 0x19, 0xe4, 0x15, 0xb1, 0x11, 0x47, 0x0d, 0xf0, 0x08, 
-0xdb, 0x04, 0xeb, 0x00, 0xfa, 0xfd, 0x31, 0xfc, 0x6a, 0xfa, 0x53, 0xf9, 0x03, 0xf9, 0xdf, 0xf8, 
-0x45, 0xf9, 0x9f, 0xf9, 0x0a, 0xfa, 0xb5, 0xfa, 0x35, 0xfb, 0x5b, 0xfb, 0xfb, 0xfa, 0xfa, 0xf9, 
-0x57, 0xf8, 0x39, 0xf6, 0x28, 0xf3, 0x87, 0xef, 0xd2, 0xeb, 0xc4, 0xe8, 0xb5, 0xe7, 0x9c, 0xe7, 
-0x00, 0xe8, 0x17, 0xeb, 0x82, 0xf0, 0xb9, 0xf6, 0x18, 0xfd, 0x7d, 0x03, 0xb9, 0x0a, 0xc4, 0x11, 
-0x22, 0x17, 0xf6, 0x1a, 0x3a, 0x1d, 0x0e, 0x1e, 0x00, 0x1e, 0xe7, 0x1b, 0x8c, 0x17, 0xe8, 0x12, 
-0x50, 0x0e, 0xd4, 0x09, 0x1a, 0x05, 0x60, 0x00, 0x16, 0xfd, 0x26, 0xfb, 0xcf, 0xf9, 0xdf, 0xf8, 
-0xb8, 0xf8, 0x26, 0xf9, 0x66, 0xfa, 0xd1, 0xfb, 0x3e, 0xfc, 0xcc, 0xfc, 0xc4, 0xfd, 0x4c, 0xfe, 
-0x95, 0xfd, 0xb8, 0xfb, 0xb2, 0xf9, 0x1b, 0xf7, 0xe4, 0xf3, 0x87, 0xf0, 0x3f, 0xec, 0x61, 0xe8, 
-0xed, 0xe7, 0x2a, 0xe8, 0x69, 0xe8, 0x33, 0xeb, 0x2b, 0xf0, 0x9a, 0xf6, 0x2c, 0xfd, 0x1f, 0x03, 
-0xab, 0x09, 0x12, 0x10, 0xf3, 0x15, 0x3d, 0x1a, 0x8d, 0x1c, 0xd8, 0x1d, 0xd7, 0x1d, 0x35, 0x1d, 
-0x5e, 0x1a, 0x07, 0x15, 0x43, 0x10, 0xd0, 0x0b, 0xc4, 0x06, 0x87, 0x02, 0x29, 0xfe, 0x25, 0xfb, 
-0x1d, 0xfa, 0x3c, 0xf9, 0x24, 0xf9, 0x1e, 0xf9, 0x56, 0xf9, 0x07, 0xfb, 0x8a, 0xfc, 0xc9, 0xfc, 
-0x7f, 0xfd, 0xdc, 0xfe, 0xe8, 0xfe, 0x32, 0xfe, 0xa0, 0xfc, 0x19, 0xfa, 0xed, 0xf6, 0xd1, 0xf3, 
-0x42, 0xf0, 0x1d, 0xeb, 0xf1, 0xe7, 0xff, 0xe7, 0xa0, 0xe7, 0x54, 0xe8, 0x58, 0xec, 0x8e, 0xf1, 
-0x39, 0xf8, 0xff, 0xfe, 0xd8, 0x04, 0xd9, 0x0a, 0xd2, 0x10, 0x2a, 0x16, 0x41, 0x19, 0x38, 0x1b, 
-0xe7, 0x1b, 0x3c, 0x1b, 0x86, 0x19, 0x3e, 0x15, 0x75, 0x10, 0x5c, 0x0b, 0x7e, 0x06, 0xa8, 0x02, 
-0x46, 0xfe, 0xcb, 0xfa, 0x91, 0xf9, 0xa0, 0xf8, 0x17, 0xf8, 0x16, 0xf9, 0xa2, 0xf9, 0x82, 0xf9, 
-0x05, 0xfc, 0xa8, 0xfe, 0xe4, 0xfe, 0x18, 0xff, 0x38, 0xff, 0xb4, 0xfe, 0x64, 0xfd, 0x70, 0xf9, 
-0xbc, 0xf3, 0x78, 0xee, 0xc8, 0xe8, 0xe0, 0xe2, 0x05, 0xe1, 0xec, 0xe5, 0x8d, 0xea, 0x70, 0xed, 
-0xe8, 0xf4, 0x2a, 0xff, 0x8d, 0x07, 0x80, 0x0e, 0xff, 0x13, 0xe4, 0x19, 0x27, 0x1e, 0x78, 0x1c, 
-0xbb, 0x19, 0xed, 0x17, 0x88, 0x14, 0x01, 0x0f, 0xa6, 0x07, 0x9b, 0x01, 0x94, 0xfd, 0x75, 0xf8, 
-0x46, 0xf3, 0xfc, 0xf4, 0x56, 0xf8, 0xc6, 0xf8, 0x49, 0xfc, 0x1b, 0x03, 0x5c, 0x09, 0x52, 0x0c, 
-0x28, 0x0e, 0x89, 0x11, 0x94, 0x11, 0x0b, 0x0e, 0x80, 0x09, 0xdd, 0x04, 0xec, 0x00, 0xdd, 0xf8, 
-0x0d, 0xf1, 0xb2, 0xeb, 0x21, 0xe0, 0x56, 0xd9, 0x02, 0xd6, 0xe9, 0xd1, 0xdf, 0xd2, 0x40, 0xe2, 
-0x82, 0xf3, 0xd4, 0xf8, 0x80, 0x08, 0x58, 0x19, 0x5d, 0x1e, 0x3d, 0x20, 0xa4, 0x21, 0x14, 0x21, 
-0xb4, 0x19, 0x6a, 0x0f, 0x73, 0x0c, 0x55, 0x08, 0x03, 0x00, 0xc3, 0xfd, 0xd1, 0xfd, 0x76, 0xf9, 
-0x0d, 0xf7, 0x13, 0xf6, 0xdf, 0xf8, 0xd9, 0xf9, 0x0f, 0xf8, 0x1c, 0x02, 0xbd, 0x05, 0x19, 0x07, 
-0x6e, 0x11, 0x21, 0x13, 0x79, 0x12, 0xfa, 0x12, 0x8e, 0x12, 0xd5, 0x0f, 0xf0, 0x07, 0x16, 0x02, 
-0xc5, 0xfd, 0xa5, 0xf6, 0x21, 0xee, 0xf4, 0xe7, 0x76, 0xe2, 0x84, 0xd6, 0x5d, 0xd1, 0x91, 0xd5, 
-0x7d, 0xd3, 0x0f, 0xd7, 0x36, 0xf4, 0xf2, 0x01, 0x6b, 0x04, 0x45, 0x1f, 0xf9, 0x25, 0x58, 0x20, 
-0x5d, 0x25, 0xfe, 0x20, 0x0a, 0x17, 0xa8, 0x0a, 0x50, 0x07, 0xae, 0x04, 0x88, 0xf9, 0xad, 0xf9, 
-0x8e, 0xfb, 0xc6, 0xf6, 0x5f, 0xf7, 0x9c, 0xf8, 0x5e, 0xfa, 0x3d, 0xfb, 0x6b, 0xf9, 0x73, 0x00, 
-0xc5, 0x06, 0x1d, 0x08, 0x2f, 0x0e, 0x13, 0x14, 0x76, 0x12, 0xb8, 0x12, 0x15, 0x13, 0x68, 0x0e, 
-0xec, 0x08, 0xe6, 0x04, 0x74, 0xfd, 0xe4, 0xf4, 0xa9, 0xf0, 0x1b, 0xea, 0xf6, 0xe2, 0x21, 0xdb, 
-0xd1, 0xd6, 0xc4, 0xd7, 0x9b, 0xda, 0xfa, 0xdb, 0xbd, 0xef, 0x05, 0x05, 0xbc, 0x05, 0x40, 0x17, 
-0x2d, 0x25, 0x82, 0x1e, 0x2b, 0x1f, 0xa8, 0x1f, 0xcd, 0x15, 0x35, 0x0a, 0x95, 0x06, 0x49, 0x03, 
-0xdb, 0xf8, 0x7c, 0xfb, 0xf9, 0xfc, 0x0f, 0xf8, 0x6c, 0xfb, 0x28, 0xfd, 0x83, 0xfc, 0x0c, 0xf9, 
-0xf4, 0xfb, 0xcd, 0xfd, 0x0b, 0xfc, 0x55, 0x09, 0x7e, 0x0a, 0xbc, 0x0a, 0xd1, 0x15, 0xc4, 0x13, 
-0x2f, 0x14, 0x64, 0x12, 0x73, 0x0e, 0x35, 0x07, 0xf3, 0xfe, 0x26, 0xfd, 0x54, 0xf1, 0x61, 0xeb, 
-0xf4, 0xe8, 0xb9, 0xe1, 0x29, 0xdb, 0xd2, 0xd8, 0xfd, 0xde, 0xb8, 0xd7, 0x48, 0xea, 0x52, 0x01, 
-0x7f, 0xfb, 0x46, 0x11, 0xa0, 0x1f, 0xfc, 0x1a, 0xdf, 0x1f, 0xdf, 0x1e, 0x22, 0x18, 0xfb, 0x0a, 
-0xbb, 0x07, 0x0f, 0x05, 0x3a, 0xf7, 0x4b, 0xfc, 0x5a, 0xfe, 0x04, 0xf9, 0x59, 0xfd, 0xc9, 0xfe, 
-0xd0, 0xfd, 0x76, 0xfb, 0xeb, 0xff, 0xdf, 0xff, 0xc7, 0xfb, 0xf7, 0x06, 0x53, 0x09, 0x37, 0x0a, 
-0xb5, 0x11, 0xcd, 0x11, 0xf1, 0x11, 0x5b, 0x0f, 0xde, 0x0d, 0x19, 0x05, 0xb1, 0xfd, 0x4a, 0xfc, 
-0x2b, 0xf2, 0xb1, 0xec, 0xfd, 0xe9, 0x8b, 0xe3, 0xac, 0xd8, 0x2c, 0xd9, 0x02, 0xdd, 0xf7, 0xd6, 
-0x4b, 0xef, 0x14, 0xff, 0x7b, 0xfe, 0xd6, 0x16, 0x6e, 0x1d, 0xf5, 0x1a, 0xe2, 0x1f, 0x4e, 0x1b, 
-0xef, 0x14, 0x62, 0x09, 0x55, 0x07, 0xbb, 0x01, 0xd0, 0xf6, 0x2a, 0xff, 0x6b, 0xfb, 0x31, 0xf8, 
-0xde, 0xff, 0xed, 0xfd, 0xf9, 0xfd, 0x7e, 0xfc, 0x70, 0xfe, 0xcd, 0xfc, 0x7b, 0xfb, 0x46, 0x06, 
-0x63, 0x05, 0xd5, 0x09, 0x5f, 0x11, 0x47, 0x11, 0x03, 0x12, 0xc6, 0x0f, 0x98, 0x0f, 0x71, 0x07, 
-0xb7, 0x00, 0x42, 0xfd, 0x0b, 0xf2, 0x3e, 0xec, 0xdc, 0xe9, 0xff, 0xe1, 0xf3, 0xd7, 0xd5, 0xd9, 
-0x6a, 0xd8, 0xe3, 0xde, 0x1b, 0xf7, 0x2f, 0xfc, 0x5b, 0x09, 0x66, 0x1c, 0x5d, 0x1c, 0x01, 0x1e, 
-0xed, 0x1f, 0x75, 0x19, 0x66, 0x0e, 0x31, 0x0b, 0x7d, 0x06, 0x17, 0xfa, 0xb0, 0xfb, 0xb5, 0xfc, 
-0x30, 0xf9, 0xa9, 0xfd, 0xc6, 0x00, 0x41, 0xff, 0x2d, 0xfe, 0x89, 0xfe, 0x68, 0xfa, 0xaf, 0xfa, 
-0x79, 0x00, 0x5f, 0x00, 0x68, 0x05, 0xad, 0x0c, 0x2e, 0x0d, 0x22, 0x10, 0x14, 0x11, 0x17, 0x10, 
-0x15, 0x0a, 0x94, 0x06, 0x3c, 0x00, 0x4b, 0xf6, 0x7d, 0xf4, 0x2a, 0xec, 0x66, 0xe6, 0x81, 0xe0, 
-0x57, 0xd9, 0x0c, 0xd9, 0x4e, 0xda, 0xd7, 0xec, 0xfd, 0xf7, 0x86, 0x01, 0x26, 0x15, 0xf4, 0x17, 
-0x2c, 0x1d, 0x1d, 0x1e, 0x0d, 0x1a, 0x04, 0x14, 0x69, 0x0c, 0x79, 0x09, 0xab, 0xfc, 0xc0, 0xfb, 
-0xf8, 0xfc, 0x11, 0xf7, 0x89, 0xfd, 0x0d, 0xff, 0xa0, 0xff, 0x15, 0x01, 0x59, 0xff, 0x0b, 0x00, 
-0x13, 0xfd, 0x19, 0x00, 0x5b, 0x03, 0x70, 0x01, 0x1b, 0x08, 0xa1, 0x0a, 0x56, 0x0a, 0xa7, 0x0d, 
-0x11, 0x0f, 0x8f, 0x0b, 0xd4, 0x08, 0xa3, 0x06, 0x69, 0xfd, 0x16, 0xf7, 0x5e, 0xf2, 0x0a, 0xe9, 
-0xfe, 0xde, 0x50, 0xd9, 0x0e, 0xd7, 0x8f, 0xd7, 0xf4, 0xe9, 0x40, 0xf7, 0xb7, 0xfd, 0x79, 0x14, 
-0x47, 0x19, 0x92, 0x1a, 0x10, 0x20, 0x27, 0x1a, 0xa7, 0x12, 0xd9, 0x0b, 0x2a, 0x09, 0x46, 0xfe, 
-0xf8, 0xf9, 0xef, 0xfe, 0xd4, 0xf8, 0x51, 0xfc, 0xa8, 0x00, 0x3b, 0xfd, 0xf1, 0x00, 0x3c, 0x01, 
-0x5c, 0x00, 0xa1, 0xfe, 0x78, 0x01, 0x00, 0x02, 0xa2, 0x00, 0x94, 0x07, 0x45, 0x08, 0x96, 0x08, 
-0x0e, 0x0c, 0xc5, 0x0c, 0xb1, 0x0a, 0x18, 0x09, 0x52, 0x06, 0x07, 0xff, 0x80, 0xfb, 0x80, 0xf4, 
-0x46, 0xec, 0x57, 0xe4, 0xb0, 0xd9, 0x7d, 0xd7, 0x11, 0xd9, 0x64, 0xe7, 0xde, 0xf1, 0x62, 0xfc, 
-0x71, 0x11, 0x84, 0x14, 0x2f, 0x1a, 0xad, 0x20, 0x9c, 0x19, 0x1d, 0x15, 0xf4, 0x0f, 0x9e, 0x07, 
-0x0b, 0xff, 0x34, 0xfc, 0x48, 0xfb, 0x87, 0xf7, 0x11, 0xfc, 0x21, 0xfe, 0x57, 0xfc, 0x21, 0x01, 
-0x28, 0x02, 0xcf, 0xff, 0x2c, 0x00, 0x92, 0x02, 0x07, 0xff, 0x77, 0x02, 0x0e, 0x07, 0x1e, 0x05, 
-0x4b, 0x0a, 0xeb, 0x0b, 0x89, 0x0c, 0x30, 0x0b, 0x75, 0x09, 0x46, 0x07, 0xdf, 0xfe, 0x42, 0xfd, 
-0x59, 0xf4, 0x47, 0xec, 0x53, 0xe5, 0x84, 0xd9, 0x76, 0xd8, 0xb5, 0xd9, 0x09, 0xe8, 0x6b, 0xf0, 
-0x93, 0xfc, 0x08, 0x10, 0x50, 0x14, 0xdc, 0x1b, 0xa4, 0x1e, 0x28, 0x1c, 0xca, 0x15, 0x91, 0x0e, 
-0x71, 0x09, 0x6c, 0xfd, 0x8a, 0xfc, 0x82, 0xfb, 0xc3, 0xf6, 0xc2, 0xfc, 0x9e, 0xfd, 0xf5, 0xfd, 
-0x9c, 0x00, 0x02, 0x04, 0xd5, 0x01, 0x47, 0x01, 0x27, 0x05, 0xb0, 0xfe, 0x09, 0x03, 0xbf, 0x05, 
-0x47, 0x02, 0x18, 0x08, 0x70, 0x08, 0xb3, 0x07, 0xb0, 0x07, 0xef, 0x08, 0x9c, 0x06, 0x25, 0xff, 
-0xc8, 0xfd, 0x02, 0xf3, 0x13, 0xeb, 0x4a, 0xe4, 0x1f, 0xda, 0xc4, 0xd9, 0x85, 0xdf, 0x4a, 0xe9, 
-0xc2, 0xf0, 0xae, 0x02, 0x16, 0x0f, 0xe4, 0x13, 0xb4, 0x1e, 0x99, 0x1e, 0x80, 0x19, 0xc3, 0x16, 
-0xfd, 0x0e, 0x9e, 0x05, 0xbb, 0xff, 0xb0, 0xfc, 0x65, 0xf8, 0x96, 0xf8, 0xd5, 0xfc, 0x69, 0xfc, 
-0x95, 0xfe, 0xee, 0x02, 0xdd, 0x02, 0xb1, 0x03, 0xe9, 0x05, 0x2b, 0x02, 0x69, 0x02, 0x48, 0x04, 
-0x6b, 0x00, 0x98, 0x02, 0xa5, 0x05, 0xee, 0x03, 0xd7, 0x05, 0x60, 0x09, 0x8f, 0x07, 0xf0, 0x04, 
-0x04, 0x01, 0xb7, 0xf9, 0xb0, 0xf0, 0x02, 0xea, 0x00, 0xe1, 0xa2, 0xda, 0x93, 0xdf, 0xee, 0xe6, 
-0x4c, 0xeb, 0x30, 0xfb, 0x9a, 0x08, 0x46, 0x0c, 0xda, 0x19, 0x08, 0x1d, 0x52, 0x18, 0x95, 0x19, 
-0xfa, 0x13, 0xe1, 0x09, 0x2c, 0x05, 0x5a, 0x00, 0x77, 0xf9, 0x06, 0xf9, 0xab, 0xfa, 0x7a, 0xf9, 
-0x43, 0xfc, 0x3c, 0x00, 0xe4, 0x00, 0x9c, 0x03, 0xe8, 0x06, 0x53, 0x04, 0x12, 0x04, 0xa9, 0x05, 
-0xe9, 0x01, 0x22, 0x03, 0x21, 0x03, 0x7d, 0x02, 0x8c, 0x04, 0x9a, 0x03, 0x6c, 0x04, 0x18, 0x02, 
-0x7e, 0xff, 0x62, 0xfb, 0xfc, 0xf1, 0x1a, 0xed, 0xc0, 0xe5, 0x79, 0xdd, 0x8e, 0xe4, 0x94, 0xe9, 
-0x6f, 0xec, 0x40, 0xfb, 0x45, 0x05, 0x42, 0x0b, 0x44, 0x16, 0x2e, 0x1a, 0x1d, 0x18, 0x4f, 0x18, 
-0x76, 0x15, 0x27, 0x0b, 0xd8, 0x05, 0xa4, 0x03, 0x5d, 0xfa, 0xbc, 0xf9, 0xdf, 0xfa, 0x5e, 0xf7, 
-0x40, 0xfb, 0xaf, 0xfe, 0x57, 0x00, 0xcf, 0x03, 0x0b, 0x06, 0xe2, 0x05, 0xca, 0x05, 0x8d, 0x05, 
-0x5d, 0x03, 0xc3, 0x03, 0x85, 0x02, 0x8e, 0x00, 0x43, 0x02, 0x65, 0x01, 0xf8, 0x00, 0x85, 0xff, 
-0x93, 0xfd, 0xd3, 0xf7, 0xba, 0xf0, 0x3a, 0xee, 0xf3, 0xe3, 0xc0, 0xe4, 0xdd, 0xeb, 0x3a, 0xe9, 
-0x08, 0xf5, 0x56, 0xff, 0x98, 0x02, 0x42, 0x0f, 0x06, 0x15, 0x39, 0x15, 0xa6, 0x17, 0x02, 0x17, 
-0x04, 0x10, 0x37, 0x0a, 0x57, 0x08, 0x27, 0xff, 0xfd, 0xfb, 0x87, 0xfd, 0x6f, 0xf7, 0x51, 0xfa, 
-0x2c, 0xfd, 0x9f, 0xfc, 0x2c, 0x02, 0x61, 0x04, 0x3f, 0x05, 0x4c, 0x07, 0xd6, 0x06, 0xbf, 0x04, 
-0x7f, 0x04, 0x68, 0x03, 0x90, 0x00, 0x28, 0x01, 0x3f, 0xff, 0x0e, 0xfe, 0x75, 0xfe, 0x53, 0xfa, 
-0x3b, 0xf8, 0x81, 0xf2, 0x13, 0xee, 0x2b, 0xeb, 0xd4, 0xe6, 0xfe, 0xec, 0x45, 0xee, 0x77, 0xf2, 
-0xa6, 0xfe, 0xfa, 0x00, 0x73, 0x09, 0x1c, 0x12, 0xf8, 0x11, 0x05, 0x15, 0x2d, 0x15, 0xda, 0x10, 
-0x89, 0x0b, 0x66, 0x09, 0x7a, 0x04, 0xe9, 0xfd, 0xc6, 0xfe, 0x02, 0xfb, 0xc4, 0xf8, 0x20, 0xfd, 
-0x84, 0xfc, 0xaf, 0xff, 0x09, 0x05, 0x38, 0x05, 0x84, 0x07, 0xbf, 0x08, 0xbb, 0x06, 0x16, 0x06, 
-0xd4, 0x05, 0x9c, 0x01, 0xfb, 0x00, 0xb8, 0xff, 0x74, 0xfa, 0x9e, 0xfb, 0x6d, 0xf8, 0x37, 0xf3, 
-0x5b, 0xf1, 0x62, 0xec, 0x45, 0xea, 0x98, 0xea, 0x31, 0xed, 0x65, 0xf1, 0x98, 0xf5, 0xff, 0xfd, 
-0xbf, 0x03, 0xd6, 0x08, 0x45, 0x10, 0x18, 0x12, 0x0e, 0x13, 0x07, 0x14, 0x1c, 0x10, 0xfc, 0x0b, 
-0x3f, 0x09, 0x79, 0x04, 0x99, 0xff, 0x87, 0xfe, 0x9c, 0xfb, 0x10, 0xfa, 0xe1, 0xfd, 0x13, 0xfd, 
-0xc9, 0xff, 0xc1, 0x04, 0x98, 0x04, 0x24, 0x07, 0xf6, 0x07, 0x12, 0x07, 0x2a, 0x06, 0x96, 0x04, 
-0x5e, 0x02, 0x1d, 0xff, 0x51, 0xfd, 0x57, 0xfa, 0xef, 0xf7, 0xa2, 0xf5, 0x3d, 0xf1, 0xd3, 0xee, 
-0x95, 0xeb, 0x89, 0xea, 0x70, 0xee, 0x9b, 0xef, 0x2d, 0xf4, 0xc6, 0xfb, 0xe3, 0xff, 0x8d, 0x06, 
-0xc2, 0x0d, 0xea, 0x0f, 0x0b, 0x12, 0xe6, 0x14, 0x1a, 0x11, 0x21, 0x0e, 0xf8, 0x0b, 0xea, 0x04, 
-0xea, 0x01, 0x9e, 0xff, 0x40, 0xfb, 0xaa, 0xfb, 0xd1, 0xfb, 0x36, 0xfc, 0x7b, 0xff, 0x0d, 0x01, 
-0x09, 0x04, 0xdb, 0x05, 0x1b, 0x07, 0x4d, 0x08, 0xee, 0x06, 0x88, 0x06, 0xad, 0x03, 0x9b, 0x01, 
-0x38, 0xff, 0xf4, 0xfa, 0x33, 0xf9, 0x9d, 0xf4, 0x7f, 0xf0, 0x67, 0xee, 0x16, 0xea, 0xea, 0xe9, 
-0xb8, 0xed, 0xb2, 0xee, 0x98, 0xf4, 0xce, 0xfa, 0xcb, 0xfe, 0x7b, 0x06, 0xc0, 0x0b, 0x3e, 0x0f, 
-0x18, 0x12, 0xf0, 0x13, 0x05, 0x12, 0x0e, 0x10, 0x5f, 0x0d, 0x8d, 0x07, 0xa4, 0x04, 0x7c, 0x00, 
-0xa8, 0xfc, 0x8d, 0xfb, 0xc4, 0xfa, 0xe4, 0xfa, 0x89, 0xfc, 0xd8, 0xfe, 0x6d, 0x01, 0xf1, 0x03, 
-0x88, 0x06, 0x04, 0x08, 0xdf, 0x07, 0xc4, 0x08, 0x1c, 0x06, 0x1e, 0x04, 0x15, 0x02, 0x81, 0xfc, 
-0x28, 0xfa, 0xe4, 0xf4, 0x98, 0xef, 0xf8, 0xec, 0x32, 0xe9, 0xc1, 0xe8, 0x2f, 0xeb, 0xbd, 0xed, 
-0xcd, 0xf2, 0x6b, 0xf9, 0xeb, 0xfe, 0x19, 0x05, 0x14, 0x0b, 0xfc, 0x0e, 0xe8, 0x11, 0xfd, 0x13, 
-0x92, 0x13, 0xdd, 0x11, 0x20, 0x0f, 0x8a, 0x0b, 0x0b, 0x07, 0x5a, 0x03, 0xc0, 0xff, 0xc9, 0xfb, 
-0x5b, 0xfa, 0x26, 0xf9, 0x2c, 0xf9, 0xbb, 0xfb, 0xad, 0xfd, 0xfc, 0xff, 0x17, 0x04, 0xc9, 0x05, 
-0x7f, 0x07, 0x8a, 0x09, 0xe5, 0x06, 0x26, 0x06, 0x33, 0x03, 0x5b, 0xfd, 0x0d, 0xfb, 0x57, 0xf5, 
-0x17, 0xf0, 0x82, 0xee, 0x73, 0xea, 0x4a, 0xea, 0x76, 0xed, 0x39, 0xee, 0xdd, 0xf4, 0x11, 0xfa, 
-0xc1, 0xfe, 0x96, 0x06, 0x14, 0x0a, 0xbf, 0x0f, 0x2a, 0x12, 0x94, 0x12, 0xa5, 0x13, 0xad, 0x10, 
-0x8f, 0x0e, 0x60, 0x0b, 0x9c, 0x06, 0xe9, 0x02, 0xfe, 0xfe, 0xe3, 0xfb, 0x81, 0xf9, 0x86, 0xf8, 
-0x1e, 0xf9, 0x46, 0xf9, 0x25, 0xfc, 0x68, 0xfe, 0x28, 0x00, 0xec, 0x04, 0xe0, 0x04, 0x89, 0x06, 
-0x5a, 0x07, 0x83, 0x03, 0xd9, 0x02, 0xbe, 0xfe, 0xc2, 0xf9, 0x9f, 0xf7, 0x9a, 0xf3, 0x45, 0xf0, 
-0x72, 0xf1, 0x02, 0xf1, 0xaf, 0xf1, 0xfa, 0xf6, 0x88, 0xf8, 0xc0, 0xfc, 0x2c, 0x03, 0x3d, 0x04, 
-0x17, 0x09, 0xbb, 0x0c, 0xda, 0x0b, 0xc9, 0x0e, 0xd5, 0x0d, 0x0d, 0x0b, 0xe6, 0x0a, 0x75, 0x06, 
-0xe4, 0x03, 0xee, 0x01, 0x8f, 0xfd, 0x05, 0xfd, 0x06, 0xfb, 0xf4, 0xf9, 0xc2, 0xfb, 0xa8, 0xfb, 
-0x4a, 0xfd, 0x19, 0xff, 0xcf, 0xff, 0xc3, 0x01, 0xad, 0x02, 0x9b, 0x02, 0xaa, 0x02, 0x80, 0x01, 
-0x1c, 0x00, 0xea, 0xfe, 0xcc, 0xfc, 0x74, 0xfb, 0x45, 0xfa, 0x14, 0xf9, 0xe9, 0xf8, 0xf8, 0xf8, 
-0x6d, 0xf9, 0x53, 0xfa, 0x45, 0xfc, 0xab, 0xfd, 0x73, 0xff, 0x1a, 0x02, 0x3a, 0x03, 0xdf, 0x04, 
-0x78, 0x06, 0x00, 0x06, 0x68, 0x06, 0xf4, 0x05, 0x2d, 0x04, 0x0a, 0x04, 0x63, 0x02, 0x1e, 0x01, 
-0xf3, 0x00, 0x62, 0xff, 0xcc, 0xff, 0x0a, 0xff, 0xd9, 0xfe, 0xf8, 0xff, 0x33, 0xff, 0x5d, 0x00, 
-0x63, 0x00, 0x49, 0x00, 0x47, 0x01, 0x27, 0x01, 0x60, 0x01, 0x3f, 0x01, 0x12, 0x01, 0xbc, 0x00, 
-0x3c, 0x00, 0xd4, 0xff, 0xdc, 0xfe, 0x0f, 0xfe, 0x58, 0xfd, 0x90, 0xfc, 0x28, 0xfc, 0x30, 0xfc, 
-0x17, 0xfc, 0x93, 0xfc, 0x4e, 0xfd, 0x94, 0xfd, 0xa4, 0xfe, 0x60, 0xff, 0xf0, 0xff, 0xb9, 0x00, 
-0xfd, 0x00, 0x40, 0x01, 0x8d, 0x01, 0x9d, 0x01, 0x94, 0x01, 0x9b, 0x01, 0x4a, 0x01, 0x78, 0x01, 
-0x0a, 0x01, 0xe4, 0x00, 0x56, 0x01, 0xc8, 0x00, 0x54, 0x01, 0x75, 0x01, 0x32, 0x01, 0xdf, 0x01, 
-0xba, 0x01, 0xc7, 0x01, 0xef, 0x01, 0x7e, 0x01, 0x6e, 0x01, 0xd6, 0x00, 0x67, 0x00, 0xff, 0xff, 
-0x2d, 0xff, 0xed, 0xfe, 0x63, 0xfe, 0xf6, 0xfd, 0xec, 0xfd, 0xc8, 0xfd, 0xb7, 0xfd, 0xec, 0xfd, 
-0x08, 0xfe, 0x42, 0xfe, 0x6b, 0xfe, 0x98, 0xfe, 0xf7, 0xfe, 0xf8, 0xfe, 0x43, 0xff, 0x91, 0xff, 
-0x84, 0xff, 0xd0, 0xff, 0xda, 0xff, 0xde, 0xff, 0x13, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x3d, 0x00, 
-0x86, 0x00, 0x60, 0x00, 0xa1, 0x00, 0xf1, 0x00, 0x1a, 0x01, 0x63, 0x01, 0x97, 0x01, 0xd5, 0x01, 
-0xc8, 0x01, 0xe2, 0x01, 0xb5, 0x01, 0x4a, 0x01, 0x11, 0x01, 0xa6, 0x00, 0x44, 0x00, 0xe1, 0xff, 
-0xac, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x43, 0xff, 0x28, 0xff, 0x6a, 0xff, 0x7f, 0xff, 0xaf, 0xff, 
-0xd1, 0xff, 0xe4, 0xff, 0x0d, 0x00, 0xdb, 0xff, 0xf6, 0xff, 0xd8, 0xff, 0xa2, 0xff, 0xa9, 0xff, 
-0x61, 0xff, 0x48, 0xff, 0x23, 0xff, 0xe8, 0xfe, 0xe5, 0xfe, 0xc2, 0xfe, 0xb5, 0xfe, 0xfd, 0xfe, 
-0x07, 0xff, 0x67, 0xff, 0xd6, 0xff, 0x19, 0x00, 0x9d, 0x00, 0xfa, 0x00, 0x25, 0x01, 0xa0, 0x01, 
-0xb6, 0x01, 0x9d, 0x01, 0xf8, 0x01, 0x73, 0x01, 0x6c, 0x01, 0x53, 0x01, 0xc1, 0x00, 0xbd, 0x00, 
-0x79, 0x00, 0x23, 0x00, 0x33, 0x00, 0x27, 0x00, 0x06, 0x00, 0x50, 0x00, 0x3f, 0x00, 0x13, 0x00, 
-0x3b, 0x00, 0x0d, 0x00, 0xbf, 0xff, 0xe8, 0xff, 0x45, 0xff, 0x21, 0xff, 0x20, 0xff, 0x59, 0xfe, 
-0xaa, 0xfe, 0x5b, 0xfe, 0x12, 0xfe, 0x99, 0xfe, 0x5e, 0xfe, 0x99, 0xfe, 0x19, 0xff, 0x15, 0xff, 
-0x96, 0xff, 0x25, 0x00, 0x3f, 0x00, 0xbf, 0x00, 0x10, 0x01, 0x13, 0x01, 0x6f, 0x01, 0x5d, 0x01, 
-0x50, 0x01, 0x51, 0x01, 0x20, 0x01, 0xef, 0x00, 0xa7, 0x00, 0x8c, 0x00, 0x4d, 0x00, 0x22, 0x00, 
-0x29, 0x00, 0xfb, 0xff, 0x0a, 0x00, 0x22, 0x00, 0xe9, 0xff, 0xf5, 0xff, 0x04, 0x00, 0xb0, 0xff, 
-0xac, 0xff, 0x9a, 0xff, 0x2f, 0xff, 0x57, 0xff, 0x26, 0xff, 0xe6, 0xfe, 0x1a, 0xff, 0xcf, 0xfe, 
-0xe2, 0xfe, 0xed, 0xfe, 0xd8, 0xfe, 0x25, 0xff, 0x4e, 0xff, 0x88, 0xff, 0xe6, 0xff, 0x2c, 0x00, 
-0x63, 0x00, 0xbd, 0x00, 0xe3, 0x00, 0xfb, 0x00, 0x2f, 0x01, 0x20, 0x01, 0x12, 0x01, 0x10, 0x01, 
-0xcf, 0x00, 0xb3, 0x00, 0x91, 0x00, 0x4c, 0x00, 0x35, 0x00, 0x0a, 0x00, 0xee, 0xff, 0xe2, 0xff, 
-0xcd, 0xff, 0xc2, 0xff, 0xbe, 0xff, 0xbc, 0xff, 0xb5, 0xff, 0xb2, 0xff, 0xb3, 0xff, 0xb0, 0xff, 
-0xac, 0xff, 0xa2, 0xff, 0x90, 0xff, 0x80, 0xff, 0x70, 0xff, 0x59, 0xff, 0x4f, 0xff, 0x52, 0xff, 
-0x4f, 0xff, 0x67, 0xff, 0x84, 0xff, 0xab, 0xff, 0xdf, 0xff, 0x0a, 0x00, 0x3d, 0x00, 0x6a, 0x00, 
-0x87, 0x00, 0xa3, 0x00, 0xb1, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0xbb, 0x00, 0xb2, 0x00, 0xa8, 0x00, 
-0x96, 0x00, 0x7f, 0x00, 0x64, 0x00, 0x43, 0x00, 0x23, 0x00, 0x05, 0x00, 0xe5, 0xff, 0xd2, 0xff, 
-0xbf, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb3, 0xff, 0xb7, 0xff, 0xb9, 0xff, 0xbd, 0xff, 0xb9, 0xff, 
-0xac, 0xff, 0xa6, 0xff, 0x93, 0xff, 0x80, 0xff, 0x77, 0xff, 0x68, 0xff, 0x64, 0xff, 0x6b, 0xff, 
-0x76, 0xff, 0x8e, 0xff, 0xad, 0xff, 0xcc, 0xff, 0xf2, 0xff, 0x19, 0x00, 0x3b, 0x00, 0x56, 0x00, 
-0x6f, 0x00, 0x82, 0x00, 0x93, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0xa1, 0x00, 0x99, 0x00, 0x8d, 0x00, 
-0x81, 0x00, 0x73, 0x00, 0x5e, 0x00, 0x48, 0x00, 0x36, 0x00, 0x1e, 0x00, 0x0b, 0x00, 0xf6, 0xff, 
-0xdf, 0xff, 0xd3, 0xff, 0xc7, 0xff, 0xbd, 0xff, 0xb0, 0xff, 0xa3, 0xff, 0x9a, 0xff, 0x8c, 0xff, 
-0x74, 0xff, 0x65, 0xff, 0x57, 0xff, 0x48, 0xff, 0x49, 0xff, 0x4a, 0xff, 0x57, 0xff, 0x70, 0xff, 
-0x8b, 0xff, 0xae, 0xff, 0xcc, 0xff, 0xe8, 0xff, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x3c, 0x00, 
-0x47, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x64, 0x00, 0x62, 0x00, 0x5a, 0x00, 
-0x54, 0x00, 0x4a, 0x00, 0x40, 0x00, 0x2d, 0x00, 0x1e, 0x00, 0x17, 0x00, 0xfb, 0xff, 0xed, 0xff, 
-0xde, 0xff, 0xcc, 0xff, 0xc1, 0xff, 0xbc, 0xff, 0xba, 0xff, 0xa9, 0xff, 0xb3, 0xff, 0xb5, 0xff, 
-0xaa, 0xff, 0xb8, 0xff, 0xb7, 0xff, 0xbc, 0xff, 0xba, 0xff, 0xb8, 0xff, 0xd6, 0xff, 0xe6, 0xff, 
-0xea, 0xff, 0xfa, 0xff, 0x07, 0x00, 0xf7, 0xff, 0x0a, 0x00, 0x19, 0x00, 0x26, 0x00, 0x46, 0x00, 
-0x35, 0x00, 0x3e, 0x00, 0x48, 0x00, 0x26, 0x00, 0x37, 0x00, 0x48, 0x00, 0x50, 0x00, 0x48, 0x00, 
-0x22, 0x00, 0x46, 0x00, 0x31, 0x00, 0xf9, 0xff, 0x31, 0x00, 0x1b, 0x00, 0x0c, 0x00, 0x11, 0x00, 
-0xf9, 0xff, 0xf2, 0xff, 0xd1, 0xff, 0xc8, 0xff, 0xbd, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xb8, 0xff, 
-0xcd, 0xff, 0xc4, 0xff, 0xc0, 0xff, 0x0b, 0x00, 0xba, 0xff, 0xc6, 0xff, 0xf4, 0xff, 0xbb, 0xff, 
-0x06, 0x00, 0x17, 0x00, 0x0c, 0x00, 0x45, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x06, 0x00, 0xd4, 0xff, 
-0x53, 0x00, 0x27, 0x00, 0x16, 0x00, 0x1d, 0x00, 0xbf, 0xff, 0x1b, 0x00, 0x46, 0x00, 0x56, 0x00, 
-0x11, 0x00, 0x4e, 0x00, 0x7d, 0x00, 0xd8, 0xff, 0x0e, 0x00, 0x71, 0x00, 0x11, 0x00, 0xae, 0xff, 
-0x99, 0xff, 0x13, 0x00, 0xd1, 0xff, 0x5f, 0xff, 0x4a, 0xff, 0xc8, 0xff, 0xd1, 0xff, 0x1a, 0xff, 
-0xda, 0xff, 0xd9, 0xff, 0x68, 0xff, 0x76, 0x00, 0xc0, 0xff, 0x80, 0x00, 0x6d, 0x00, 0xc6, 0x01, 
-0x03, 0x04, 0xa6, 0xfc, 0xe2, 0xfc, 0xd5, 0x01, 0x2a, 0xff, 0xb6, 0xfe, 0x8a, 0x00, 0xc1, 0xfe, 
-0x93, 0xfe, 0x12, 0x01, 0xcf, 0xff, 0xf3, 0xfe, 0x8e, 0x00, 0xdb, 0x00, 0x77, 0x00, 0x5c, 0x00, 
-0x69, 0x00, 0x9e, 0x00, 0x5c, 0x00, 0x08, 0x00, 0xf6, 0xff, 0x31, 0x00, 0x05, 0x00, 0x92, 0xff, 
-0x95, 0xff, 0xc0, 0xff, 0x86, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x3f, 0xff, 0x6f, 0xff, 0xd6, 0xff, 
-0x71, 0xff, 0xd6, 0xff, 0xb6, 0xff, 0xd3, 0xff, 0xf4, 0xff, 0x1e, 0x00, 0xd4, 0xff, 0xdf, 0xff, 
-0xc7, 0x00, 0xc6, 0x00, 0x3b, 0x00, 0x1b, 0x00, 0x72, 0x00, 0x13, 0x00, 0xba, 0x00, 0x65, 0x00, 
-0x6e, 0x00, 0xd0, 0x00, 0x56, 0x01, 0x69, 0xff, 0x69, 0xfd, 0xd9, 0xff, 0x7f, 0x00, 0x9c, 0x01, 
-0xf6, 0x00, 0xfc, 0xfd, 0xc3, 0xfd, 0xc8, 0xfe, 0x5a, 0xff, 0x1f, 0xff, 0x84, 0xff, 0xed, 0xff, 
-0xba, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0x68, 0xff, 0xc6, 0xff, 0xd0, 0xff, 0x54, 0x00, 0xb9, 0xfe, 
-0x02, 0xfc, 0xe0, 0x03, 0xd3, 0x05, 0x0b, 0xfc, 0xa4, 0xfc, 0x73, 0x02, 0x3a, 0x02, 0x2c, 0xfe, 
-0xf0, 0xff, 0xff, 0x06, 0xb0, 0x01, 0xb7, 0xfb, 0x02, 0x00, 0x1b, 0xff, 0x1b, 0xfb, 0x49, 0xff, 
-0x39, 0x03, 0xbc, 0xfe, 0x76, 0xfc, 0x2d, 0x00, 0x43, 0x01, 0xcf, 0xfe, 0xc9, 0xff, 0x28, 0x02, 
-0x15, 0x01, 0xc1, 0xff, 0xef, 0xff, 0xd4, 0x00, 0xa5, 0xff, 0x81, 0x02, 0x9e, 0x06, 0x0d, 0x02, 
-0x1a, 0xfd, 0xe7, 0xfd, 0xf9, 0x00, 0x13, 0xff, 0x24, 0xfc, 0xc1, 0xfe, 0x5e, 0xff, 0x6b, 0xfd, 
-0x5b, 0xfd, 0xb1, 0xfe, 0x54, 0xff, 0x15, 0xff, 0xa0, 0xff, 0xdd, 0x00, 0x87, 0x01, 0x37, 0x01, 
-0x51, 0x01, 0x35, 0x01, 0x59, 0x01, 0xa4, 0x00, 0xc4, 0xff, 0x79, 0x00, 0x49, 0x00, 0x6c, 0x00, 
-0xdf, 0xff, 0xd6, 0x00, 0x5c, 0x03, 0x70, 0x01, 0xa5, 0xfe, 0xcc, 0xfd, 0xa8, 0xff, 0x1a, 0x01, 
-0x4c, 0xff, 0x09, 0xfe, 0xb2, 0xff, 0xd1, 0x00, 0xc2, 0xfe, 0x23, 0xfe, 0x2c, 0x00, 0x4b, 0x01, 
-0xd6, 0x00, 0x71, 0xff, 0x86, 0x00, 0xcc, 0x01, 0x69, 0x00, 0x72, 0x00, 0xcb, 0x00, 0x50, 0xff, 
-0x1e, 0x00, 0xe6, 0x00, 0x28, 0xfe, 0x98, 0xfe, 0xb5, 0x00, 0x9d, 0xff, 0xf9, 0xfe, 0x85, 0xff, 
-0x16, 0x00, 0x09, 0x00, 0xd0, 0xff, 0xe3, 0xff, 0x04, 0xff, 0x5e, 0x00, 0x22, 0x01, 0x31, 0xff, 
-0x0c, 0xff, 0xfe, 0xff, 0xd4, 0x00, 0x26, 0x01, 0xbb, 0xff, 0xff, 0xfe, 0x41, 0xff, 0xbf, 0x00, 
-0x9e, 0x01, 0x36, 0x01, 0xd3, 0xfe, 0x57, 0xff, 0x9c, 0x00, 0x43, 0xff, 0xb8, 0x00, 0xe1, 0x00, 
-0xef, 0xff, 0xe5, 0xfe, 0x7a, 0xff, 0xfc, 0xff, 0xe6, 0xff, 0x94, 0x00, 0x93, 0x00, 0x49, 0x00, 
-0x08, 0x00, 0x61, 0x00, 0x79, 0x00, 0xf2, 0x00, 0x12, 0x01, 0x03, 0x01, 0x48, 0x01, 0x95, 0x00, 
-0x1a, 0x01, 0x4c, 0x01, 0x59, 0x01, 0x79, 0x01, 0x72, 0x00, 0x31, 0x00, 0x80, 0x00, 0xac, 0x00, 
-0x4f, 0x00, 0xbf, 0xff, 0xd8, 0xff, 0x16, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x27, 0x00, 0x91, 0xff, 
-0xb8, 0xff, 0x4d, 0x00, 0xe6, 0xff, 0xd1, 0xff, 0x9a, 0xff, 0xa0, 0xff, 0xc9, 0xff, 0x5a, 0xff, 
-0x4a, 0xff, 0x75, 0xff, 0xe7, 0xff, 0xd9, 0xff, 0x43, 0xff, 0x93, 0xff, 0xab, 0xff, 0x81, 0xff, 
-0x04, 0xff, 0x47, 0xff, 0xb9, 0xff, 0x7e, 0xfe, 0x67, 0xfe, 0x69, 0xff, 0x72, 0xff, 0x54, 0xff, 
-0x73, 0xff, 0x40, 0xff, 0x94, 0xff, 0x2d, 0x00, 0x0b, 0x00, 0xd1, 0xff, 0xe3, 0xff, 0x6b, 0x00, 
-0x83, 0x00, 0x9d, 0xff, 0xb4, 0xff, 0x6a, 0x00, 0x68, 0x00, 0x07, 0x00, 0xa7, 0xff, 0x3b, 0x00, 
-0x97, 0x00, 0x8e, 0x00, 0x1e, 0x00, 0x67, 0x00, 0xea, 0xff, 0x14, 0x00, 0xa7, 0x00, 0xf0, 0xff, 
-0x5c, 0x00, 0xbc, 0x00, 0x18, 0x00, 0xfc, 0xff, 0x92, 0x00, 0x26, 0x00, 0xb7, 0xff, 0xed, 0xff, 
-0x4a, 0x00, 0x45, 0x00, 0x04, 0x00, 0xc8, 0xff, 0x0f, 0x00, 0x56, 0x00, 0x44, 0x00, 0x06, 0x00, 
-0x0d, 0x00, 0x14, 0x00, 0x08, 0x00, 0x6f, 0x00, 0xf5, 0xff, 0xe3, 0xff, 0x53, 0x00, 0x64, 0x00, 
-0x8b, 0x00, 0xb3, 0xff, 0x07, 0x00, 0xbc, 0x00, 0x5e, 0x00, 0x46, 0x00, 0x69, 0x00, 0x1a, 0x00, 
-0xe9, 0xff, 0x35, 0x00, 0x3f, 0x00, 0x53, 0x00, 0x30, 0x00, 0xdd, 0xff, 0xfd, 0xff, 0x7d, 0x00, 
-0x51, 0x00, 0x27, 0x00, 0x29, 0x00, 0xed, 0xff, 0x97, 0x00, 0xe9, 0x00, 0x43, 0x00, 0x02, 0x00, 
-0x7a, 0x00, 0x92, 0x00, 0x8c, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x0b, 0x00, 
-0x7f, 0x00, 0x8d, 0x00, 0xdf, 0xff, 0x57, 0x00, 0x72, 0x00, 0x60, 0x00, 0xa3, 0x00, 0xa8, 0x00, 
-0xbb, 0x00, 0x3c, 0x00, 0xf5, 0xff, 0x0a, 0x00, 0x60, 0x00, 0x40, 0x00, 0xc6, 0xff, 0xea, 0xff, 
-0x42, 0x00, 0x7d, 0x00, 0xaf, 0x00, 0xa3, 0xff, 0x40, 0xfe, 0xe9, 0xfd, 0x26, 0xfe, 0xa3, 0xfd, 
-0x0c, 0xfd, 0x88, 0xfd, 0xba, 0xfd, 0x2b, 0xfe, 0xc7, 0xfe, 0xa5, 0xfe, 0xea, 0xfe, 0xb2, 0xfe, 
-0xb3, 0xfe, 0x3a, 0xff, 0x9f, 0xff, 0x6e, 0x00, 0xeb, 0x00, 0x6c, 0x01, 0xf1, 0x01, 0x59, 0x02, 
-0xb3, 0x01, 0x94, 0x01, 0x82, 0x01, 0x5a, 0x01, 0x34, 0x01, 0x6e, 0x00, 0x8e, 0x00, 0x9c, 0x00, 
-0x25, 0x00, 0xc7, 0xff, 0xbc, 0xff, 0xbc, 0xff, 0xa1, 0xff, 0x60, 0xff, 0x40, 0xff, 0x34, 0xff, 
-0x35, 0xff, 0x3f, 0xff, 0x53, 0xff, 0x05, 0x00, 0x60, 0x00, 0xa5, 0x00, 0x20, 0x01, 0x23, 0x01, 
-0x6d, 0x01, 0x80, 0x01, 0xf3, 0x00, 0xfa, 0x00, 0x1b, 0x01, 0xbc, 0x00, 0xe8, 0x00, 0x91, 0x00, 
-0x12, 0x00, 0xe2, 0xff, 0x9a, 0xff, 0x69, 0xff, 0x67, 0xff, 0x8d, 0xff, 0xc8, 0xff, 0x24, 0x00, 
-0xaa, 0x00, 0x77, 0x01, 0x2e, 0x02, 0xb5, 0x02, 0x10, 0x03, 0x8a, 0x03, 0xeb, 0x03, 0x6d, 0x04, 
-0x62, 0x04, 0x7d, 0x03, 0xf7, 0x01, 0x23, 0x00, 0xc1, 0xfe, 0x78, 0xfd, 0xf8, 0xfb, 0xa1, 0xfa, 
-0xe9, 0xf9, 0x7c, 0xf9, 0x7d, 0xf9, 0xd0, 0xf9, 0x4a, 0xfa, 0xe4, 0xfa, 0x39, 0xfb, 0xd2, 0xfb, 
-0xf0, 0xfc, 0x18, 0xfe, 0xac, 0xff, 0xcc, 0x00, 0x7a, 0x01, 0x3a, 0x02, 0x7b, 0x02, 0xc4, 0x02, 
-0xc8, 0x02, 0x66, 0x02, 0x27, 0x02, 0xc5, 0x01, 0xcb, 0x01, 0xc6, 0x01, 0x7c, 0x01, 0x6d, 0x01, 
-0xd0, 0x00, 0x59, 0x00, 0x2d, 0x00, 0xdf, 0xff, 0xcf, 0xff, 0x02, 0x00, 0xfc, 0xff, 0xfd, 0xff, 
-0x01, 0x00, 0xea, 0xff, 0xa4, 0xff, 0x46, 0xff, 0x03, 0xff, 0x6d, 0xfe, 0xcb, 0xfd, 0x53, 0xfd, 
-0xc9, 0xfc, 0x6e, 0xfc, 0x3e, 0xfc, 0x17, 0xfc, 0x3f, 0xfc, 0x66, 0xfc, 0xc2, 0xfc, 0x62, 0xfd, 
-0x14, 0xfe, 0x38, 0xff, 0x37, 0x00, 0x41, 0x01, 0x80, 0x02, 0xc9, 0x03, 0x2a, 0x05, 0x0d, 0x06, 
-0x84, 0x06, 0xfb, 0x06, 0x4c, 0x07, 0x21, 0x07, 0xcb, 0x06, 0x13, 0x06, 0x20, 0x05, 0x4f, 0x04, 
-0x67, 0x03, 0x29, 0x02, 0xe4, 0x00, 0xd3, 0xff, 0xc4, 0xfe, 0xa6, 0xfd, 0x6d, 0xfc, 0x40, 0xfb, 
-0x7f, 0xfa, 0xdf, 0xf9, 0x54, 0xf9, 0x21, 0xf9, 0xa8, 0xf8, 0x01, 0xf8, 0xdd, 0xf7, 0xbb, 0xf7, 
-0x96, 0xf7, 0xc0, 0xf7, 0xf9, 0xf7, 0xb1, 0xf8, 0x22, 0xfa, 0xcd, 0xfb, 0xb0, 0xfd, 0xb1, 0xff, 
-0xb4, 0x01, 0x1f, 0x04, 0x71, 0x06, 0x5c, 0x08, 0x11, 0x0a, 0x6f, 0x0b, 0x14, 0x0c, 0x72, 0x0c, 
-0x5b, 0x0c, 0xae, 0x0b, 0x92, 0x0a, 0xc6, 0x08, 0xd6, 0x06, 0xe0, 0x04, 0x0b, 0x03, 0x5a, 0x01, 
-0xd5, 0xff, 0x7f, 0xfe, 0x85, 0xfd, 0xd9, 0xfc, 0x2c, 0xfc, 0xc8, 0xfb, 0x87, 0xfb, 0x56, 0xfb, 
-0x47, 0xfb, 0x43, 0xfb, 0xe0, 0xfa, 0x45, 0xfa, 0x80, 0xf9, 0x65, 0xf8, 0x09, 0xf7, 0x97, 0xf5, 
-0x90, 0xf4, 0x16, 0xf4, 0x84, 0xf4, 0x7a, 0xf5, 0xfa, 0xf6, 0x34, 0xf9, 0x0c, 0xfc, 0x80, 0xff, 
-0x16, 0x03, 0x85, 0x06, 0xa9, 0x09, 0x88, 0x0c, 0xb8, 0x0e, 0x36, 0x10, 0xb5, 0x10, 0x57, 0x10, 
-0x3f, 0x0f, 0x88, 0x0d, 0x4c, 0x0b, 0x04, 0x09, 0x89, 0x06, 0xf9, 0x03, 0x12, 0x02, 0x29, 0x00, 
-0x60, 0xfe, 0x03, 0xfd, 0xd8, 0xfb, 0x15, 0xfb, 0xce, 0xfa, 0xba, 0xfa, 0xe0, 0xfa, 0x30, 0xfb, 
-0x5c, 0xfb, 0x72, 0xfb, 0x1e, 0xfb, 0x1b, 0xfa, 0xa3, 0xf8, 0x8d, 0xf6, 0x62, 0xf4, 0x68, 0xf2, 
-0x59, 0xf1, 0xf8, 0xf0, 0x4b, 0xf1, 0xdf, 0xf2, 0x4d, 0xf5, 0xb2, 0xf8, 0xdf, 0xfc, 0x20, 0x01, 
-0x64, 0x05, 0xb6, 0x09, 0x31, 0x0d, 0x0e, 0x10, 0x24, 0x12, 0xe8, 0x12, 0xc7, 0x12, 0xd2, 0x11, 
-0xe8, 0x0f, 0xc4, 0x0d, 0x2d, 0x0b, 0x54, 0x08, 0xc1, 0x05, 0x1e, 0x03, 0x01, 0x01, 0x11, 0xff, 
-0x86, 0xfd, 0x79, 0xfc, 0xab, 0xfb, 0xe5, 0xfa, 0x29, 0xfa, 0xec, 0xf9, 0xa8, 0xf9, 0x6d, 0xf9, 
-0xe6, 0xf8, 0xca, 0xf7, 0x72, 0xf6, 0xcd, 0xf4, 0x3a, 0xf3, 0x1e, 0xf2, 0x51, 0xf1, 0xd2, 0xf0, 
-0xfc, 0xf0, 0x52, 0xf2, 0x67, 0xf4, 0x35, 0xf7, 0xf1, 0xfa, 0xcf, 0xfe, 0xd0, 0x02, 0x32, 0x07, 
-0xf1, 0x0a, 0x0a, 0x0e, 0x76, 0x10, 0x9b, 0x11, 0x4e, 0x12, 0x57, 0x12, 0x6c, 0x11, 0x11, 0x10, 
-0x0b, 0x0e, 0x8a, 0x0b, 0x04, 0x09, 0x7d, 0x06, 0x25, 0x04, 0x25, 0x02, 0x71, 0x00, 0xd3, 0xfe, 
-0xa3, 0xfd, 0xc2, 0xfc, 0xea, 0xfb, 0x8a, 0xfb, 0xe4, 0xfa, 0x19, 0xfa, 0xa3, 0xf9, 0xfc, 0xf8, 
-0xfc, 0xf6, 0x71, 0xf5, 0xc5, 0xf3, 0x31, 0xf1, 0x87, 0xef, 0x46, 0xee, 0x8c, 0xee, 0x58, 0xef, 
-0x93, 0xf0, 0xca, 0xf2, 0x52, 0xf6, 0xb9, 0xfa, 0x15, 0xff, 0xa3, 0x03, 0x23, 0x08, 0xb7, 0x0c, 
-0xf8, 0x0f, 0x61, 0x12, 0xd3, 0x13, 0x66, 0x14, 0x19, 0x14, 0x67, 0x12, 0x42, 0x10, 0xf7, 0x0d, 
-0x7b, 0x0b, 0x8c, 0x08, 0xfd, 0x05, 0x0e, 0x04, 0xad, 0x02, 0x1d, 0x01, 0xe3, 0xff, 0xfe, 0xfe, 
-0x52, 0xfe, 0xe7, 0xfd, 0x22, 0xfd, 0x6b, 0xfc, 0xcb, 0xfa, 0x39, 0xf9, 0x25, 0xf7, 0x4f, 0xf4, 
-0x28, 0xf1, 0x7f, 0xed, 0x5d, 0xea, 0xa1, 0xe8, 0xae, 0xe8, 0x98, 0xe9, 0xf5, 0xeb, 0xc1, 0xef, 
-0x95, 0xf4, 0xe6, 0xf9, 0xd1, 0xff, 0x64, 0x05, 0x67, 0x0a, 0x4a, 0x0f, 0xcd, 0x12, 0x6c, 0x15, 
-0x06, 0x17, 0x19, 0x18, 0xe6, 0x17, 0x99, 0x16, 0x39, 0x14, 0xf2, 0x10, 0x6c, 0x0d, 0xa1, 0x09, 
-0x37, 0x06, 0xcd, 0x02, 0xd7, 0x00, 0x0e, 0xff, 0x33, 0xfd, 0x42, 0xfc, 0xcd, 0xfb, 0xe7, 0xfb, 
-0xb6, 0xfb, 0x0a, 0xfb, 0xa7, 0xf9, 0x9a, 0xf8, 0xb2, 0xf6, 0x75, 0xf3, 0xba, 0xef, 0x04, 0xec, 
-0x17, 0xe9, 0xbe, 0xe7, 0x51, 0xe8, 0x99, 0xe9, 0xe3, 0xec, 0x55, 0xf1, 0x64, 0xf6, 0x6d, 0xfc, 
-0x62, 0x02, 0x02, 0x08, 0x4e, 0x0d, 0x74, 0x11, 0x8f, 0x14, 0xc6, 0x16, 0x25, 0x18, 0xed, 0x18, 
-0x1c, 0x18, 0xe7, 0x15, 0xeb, 0x12, 0xe8, 0x0f, 0xd9, 0x0b, 0x1c, 0x08, 0xf9, 0x04, 0xe6, 0x01, 
-0xb4, 0xff, 0xb9, 0xfd, 0xfd, 0xfb, 0xe5, 0xfa, 0xda, 0xfa, 0x8a, 0xfa, 0x28, 0xfa, 0xf0, 0xf9, 
-0x5b, 0xf9, 0x31, 0xf8, 0xca, 0xf5, 0x29, 0xf2, 0xdd, 0xed, 0x14, 0xea, 0xbe, 0xe7, 0x6c, 0xe7, 
-0x6d, 0xe8, 0x09, 0xeb, 0x21, 0xef, 0x0c, 0xf4, 0x04, 0xfa, 0x32, 0xff, 0x74, 0x05, 0x2e, 0x0b, 
-0x45, 0x0f, 0x0c, 0x13, 0x8b, 0x15, 0x88, 0x17, 0xa5, 0x18, 0xa5, 0x18, 0xf1, 0x16, 0x1e, 0x15, 
-0x15, 0x11, 0xe7, 0x0c, 0x98, 0x09, 0x9e, 0x05, 0xb1, 0x02, 0x28, 0x00, 0x05, 0xfe, 0x3d, 0xfc, 
-0x6a, 0xfb, 0x1c, 0xfb, 0x87, 0xfb, 0x68, 0xfb, 0xb7, 0xfb, 0x8a, 0xfb, 0x83, 0xfa, 0xa8, 0xf9, 
-0x33, 0xf6, 0x1e, 0xf2, 0xaa, 0xed, 0x23, 0xe9, 0xaf, 0xe7, 0x2c, 0xe7, 0x92, 0xe7, 0x55, 0xeb, 
-0xe3, 0xef, 0x0f, 0xf4, 0x0a, 0xfa, 0x7f, 0x00, 0x34, 0x06, 0x99, 0x0b, 0xdf, 0x0f, 0xbc, 0x13, 
-0x98, 0x16, 0xb0, 0x17, 0x12, 0x19, 0x63, 0x19, 0xc4, 0x16, 0x64, 0x14, 0x66, 0x10, 0xfb, 0x0b, 
-0x6b, 0x08, 0x29, 0x04, 0x61, 0x01, 0x80, 0xff, 0x78, 0xfc, 0xe5, 0xfa, 0x7b, 0xfb, 0x8f, 0xfa, 
-0x47, 0xfb, 0xfb, 0xfb, 0x1d, 0xfc, 0xb0, 0xfc, 0x1c, 0xfb, 0x8d, 0xf8, 0x8a, 0xf6, 0xc2, 0xf0, 
-0x84, 0xeb, 0x19, 0xea, 0x4d, 0xe6, 0x46, 0xe7, 0x8d, 0xe9, 0xcd, 0xeb, 0x7f, 0xf2, 0x77, 0xf6, 
-0x3d, 0xfb, 0x7c, 0x03, 0x2e, 0x08, 0xb2, 0x0b, 0xcb, 0x11, 0x09, 0x15, 0x67, 0x16, 0x76, 0x18, 
-0x6c, 0x19, 0x3f, 0x19, 0x21, 0x16, 0xe7, 0x12, 0xa7, 0x0f, 0x72, 0x0a, 0x74, 0x06, 0xdd, 0x03, 
-0x46, 0x00, 0xfd, 0xfd, 0x64, 0xfc, 0x93, 0xfa, 0x56, 0xfb, 0xad, 0xfa, 0x5b, 0xfb, 0x66, 0xfc, 
-0x2b, 0xfc, 0x45, 0xfc, 0xa9, 0xfa, 0xcf, 0xf8, 0x7f, 0xf4, 0xdf, 0xef, 0x89, 0xec, 0x15, 0xe8, 
-0x95, 0xe6, 0xff, 0xe8, 0xbf, 0xe9, 0xa6, 0xec, 0x67, 0xf3, 0xa8, 0xf7, 0x91, 0xfc, 0x07, 0x04, 
-0x0f, 0x09, 0xad, 0x0d, 0xcc, 0x11, 0x8c, 0x14, 0x8e, 0x17, 0x9e, 0x17, 0xff, 0x18, 0xd6, 0x18, 
-0x4a, 0x14, 0x15, 0x12, 0x03, 0x0e, 0x3f, 0x08, 0x66, 0x06, 0x73, 0x02, 0x99, 0xfe, 0x91, 0xfd, 
-0x2a, 0xfb, 0xe1, 0xf9, 0x5c, 0xfa, 0x5b, 0xfa, 0xd3, 0xfa, 0xac, 0xfb, 0x6c, 0xfc, 0x51, 0xfc, 
-0x2a, 0xfb, 0x6f, 0xf9, 0xa3, 0xf6, 0x07, 0xf0, 0x70, 0xec, 0x24, 0xeb, 0x35, 0xe6, 0xed, 0xe8, 
-0xe5, 0xec, 0x3b, 0xed, 0x65, 0xf3, 0xfe, 0xf9, 0x95, 0xfd, 0x19, 0x04, 0x03, 0x0a, 0x49, 0x0d, 
-0x75, 0x11, 0xbc, 0x13, 0x66, 0x16, 0x62, 0x17, 0x07, 0x18, 0xc5, 0x17, 0x2d, 0x14, 0x5e, 0x11, 
-0xf0, 0x0d, 0x47, 0x08, 0xc3, 0x05, 0xd1, 0x02, 0xef, 0xfd, 0xde, 0xfd, 0x74, 0xfb, 0xb7, 0xf9, 
-0x32, 0xfb, 0x1f, 0xfa, 0x08, 0xfb, 0x5c, 0xfc, 0x46, 0xfc, 0x41, 0xfc, 0x7d, 0xfb, 0xed, 0xf9, 
-0x46, 0xf5, 0xa3, 0xf0, 0x5c, 0xed, 0x94, 0xe8, 0xad, 0xe6, 0x95, 0xea, 0x71, 0xea, 0x4c, 0xed, 
-0x56, 0xf6, 0x39, 0xf8, 0x9c, 0xfc, 0x75, 0x07, 0xf3, 0x08, 0x27, 0x0c, 0x22, 0x15, 0xd0, 0x13, 
-0xb4, 0x15, 0xec, 0x19, 0x6e, 0x17, 0xb8, 0x16, 0xbb, 0x14, 0xc7, 0x10, 0xc8, 0x0c, 0x0c, 0x08, 
-0x48, 0x05, 0xdd, 0x01, 0x60, 0xfd, 0xa9, 0xfd, 0x9a, 0xfa, 0xf4, 0xf8, 0x3c, 0xfb, 0x91, 0xf9, 
-0x2d, 0xfb, 0xd7, 0xfc, 0xc2, 0xfc, 0x70, 0xfd, 0x85, 0xfc, 0xf0, 0xfb, 0xda, 0xf6, 0x87, 0xf1, 
-0xe0, 0xee, 0x9a, 0xe8, 0x88, 0xe6, 0x76, 0xe9, 0x12, 0xe9, 0x31, 0xed, 0x27, 0xf3, 0x93, 0xf6, 
-0x41, 0xfd, 0x2d, 0x03, 0xe0, 0x07, 0x22, 0x0d, 0x6b, 0x11, 0x4b, 0x13, 0xba, 0x15, 0xbb, 0x17, 
-0x6d, 0x17, 0xa1, 0x16, 0x12, 0x15, 0xbb, 0x11, 0xdb, 0x0c, 0xcc, 0x09, 0x84, 0x06, 0xf9, 0x00, 
-0x44, 0x00, 0xc8, 0xfd, 0xd0, 0xf9, 0xd2, 0xfb, 0x8a, 0xfa, 0xeb, 0xf9, 0x29, 0xfd, 0x60, 0xfc, 
-0x58, 0xfd, 0x1b, 0xfe, 0xa1, 0xfc, 0x3d, 0xfc, 0x09, 0xf7, 0x6f, 0xf3, 0x1e, 0xef, 0xd2, 0xe8, 
-0x29, 0xe9, 0x78, 0xe9, 0x5d, 0xe9, 0x84, 0xef, 0xd3, 0xf3, 0xe9, 0xf6, 0x04, 0xff, 0xf8, 0x03, 
-0x55, 0x08, 0x3a, 0x0e, 0xce, 0x11, 0x54, 0x14, 0x47, 0x16, 0x7b, 0x17, 0x38, 0x18, 0xb1, 0x15, 
-0xa2, 0x13, 0xda, 0x10, 0xf0, 0x0a, 0x14, 0x07, 0xc7, 0x04, 0xa3, 0xff, 0x06, 0xfd, 0xbb, 0xfc, 
-0xed, 0xf8, 0xef, 0xf8, 0x50, 0xfa, 0xb9, 0xf9, 0x74, 0xfb, 0xa1, 0xfd, 0xcc, 0xfd, 0x84, 0xfe, 
-0x20, 0xfe, 0xce, 0xfc, 0xf9, 0xf8, 0x1d, 0xf4, 0x73, 0xef, 0x1d, 0xeb, 0xa9, 0xe7, 0xf9, 0xe7, 
-0xfd, 0xea, 0x74, 0xeb, 0xf9, 0xf1, 0xcb, 0xf7, 0xe9, 0xf9, 0xd3, 0x02, 0x3e, 0x07, 0xa0, 0x09, 
-0x63, 0x11, 0x33, 0x12, 0xa1, 0x14, 0xd8, 0x17, 0xc6, 0x16, 0x89, 0x17, 0x7b, 0x14, 0x6c, 0x12, 
-0xc7, 0x0e, 0x50, 0x08, 0xa0, 0x07, 0x00, 0x02, 0x6a, 0xfd, 0x89, 0xfe, 0x3e, 0xf9, 0xa4, 0xf8, 
-0x2a, 0xfb, 0x22, 0xf9, 0x70, 0xfb, 0xb4, 0xfe, 0x52, 0xfd, 0x85, 0xff, 0xa4, 0xfe, 0x5f, 0xfc, 
-0x8c, 0xf9, 0x60, 0xf3, 0xcb, 0xef, 0xce, 0xea, 0x8e, 0xe7, 0x32, 0xe8, 0x74, 0xea, 0x95, 0xeb, 
-0x5c, 0xf1, 0x35, 0xf8, 0x3d, 0xfa, 0x96, 0x01, 0xa8, 0x09, 0x95, 0x09, 0x7a, 0x10, 0xa5, 0x15, 
-0xd9, 0x12, 0x27, 0x17, 0xed, 0x18, 0x92, 0x15, 0xbc, 0x14, 0xfc, 0x12, 0x68, 0x0e, 0xd0, 0x08, 
-0x54, 0x07, 0x0b, 0x04, 0xd4, 0xfd, 0x29, 0xff, 0xa6, 0xfc, 0xbd, 0xf8, 0x82, 0xfb, 0xee, 0xfa, 
-0x3f, 0xfa, 0x37, 0xfe, 0x39, 0xfe, 0xae, 0xfe, 0xde, 0xff, 0xa5, 0xfe, 0x32, 0xfb, 0x96, 0xf6, 
-0xb6, 0xf1, 0x78, 0xea, 0x9a, 0xe8, 0x7b, 0xe5, 0x99, 0xe8, 0x58, 0xeb, 0x0d, 0xee, 0xde, 0xf7, 
-0xdc, 0xf8, 0x74, 0xff, 0x31, 0x08, 0xcb, 0x07, 0x91, 0x0f, 0x83, 0x13, 0x1d, 0x11, 0xaf, 0x16, 
-0xd3, 0x15, 0x9c, 0x14, 0x42, 0x15, 0xe4, 0x10, 0xf5, 0x0e, 0xff, 0x09, 0xa6, 0x05, 0x80, 0x05, 
-0x8f, 0xfe, 0x59, 0xfe, 0xce, 0xfd, 0x72, 0xf8, 0x10, 0xfb, 0xbe, 0xfa, 0x67, 0xfa, 0x88, 0xfd, 
-0xca, 0xfe, 0xb7, 0xff, 0xc0, 0xff, 0xc7, 0xfe, 0x3d, 0xfd, 0x33, 0xf7, 0xd3, 0xf2, 0xeb, 0xec, 
-0x46, 0xe8, 0x00, 0xe6, 0xb7, 0xe7, 0x46, 0xeb, 0xf6, 0xec, 0xfa, 0xf6, 0xa5, 0xfa, 0x2e, 0xfe, 
-0xce, 0x07, 0x53, 0x0a, 0x2a, 0x0d, 0xf5, 0x12, 0x57, 0x13, 0x78, 0x14, 0xae, 0x15, 0xaf, 0x15, 
-0xaf, 0x15, 0xd3, 0x10, 0x84, 0x10, 0x73, 0x0c, 0x07, 0x05, 0x72, 0x06, 0x2c, 0x01, 0xd9, 0xfc, 
-0x7c, 0xfe, 0x6f, 0xfa, 0x5e, 0xfa, 0xf3, 0xfa, 0x94, 0xfb, 0x00, 0xfe, 0x88, 0xfd, 0x17, 0x00, 
-0xfc, 0x00, 0x2c, 0xfd, 0xca, 0xfc, 0x8e, 0xf9, 0x63, 0xf1, 0xb7, 0xeb, 0xe5, 0xe9, 0x76, 0xe4, 
-0x44, 0xe3, 0xdb, 0xeb, 0x1e, 0xeb, 0x57, 0xf0, 0x97, 0xfb, 0x02, 0xfb, 0xc1, 0x01, 0xa8, 0x0a, 
-0xa2, 0x0a, 0xdf, 0x0f, 0xfb, 0x12, 0xd3, 0x13, 0xe7, 0x14, 0x38, 0x14, 0xe0, 0x15, 0x20, 0x11, 
-0x8d, 0x0f, 0xd1, 0x0d, 0x5a, 0x06, 0x3d, 0x06, 0x80, 0x03, 0x21, 0xfe, 0x08, 0xff, 0x72, 0xfc, 
-0x7d, 0xfa, 0xe0, 0xfb, 0x95, 0xfc, 0xe8, 0xfd, 0x38, 0xff, 0xcd, 0x01, 0x66, 0x01, 0x4e, 0x00, 
-0x3d, 0x00, 0xc1, 0xfa, 0xa7, 0xf4, 0x93, 0xef, 0x3d, 0xe8, 0x39, 0xe6, 0xfb, 0xe3, 0x24, 0xe8, 
-0x43, 0xee, 0xd3, 0xef, 0x87, 0xfa, 0x62, 0xfd, 0x2d, 0x01, 0xe3, 0x09, 0x8b, 0x09, 0x1e, 0x0f, 
-0x19, 0x12, 0xca, 0x10, 0x05, 0x14, 0x25, 0x14, 0xa3, 0x13, 0x0e, 0x12, 0xc9, 0x0f, 0x5c, 0x0d, 
-0xcd, 0x06, 0x57, 0x04, 0xd3, 0x03, 0xd7, 0xfc, 0x67, 0xfe, 0xef, 0xfd, 0x0a, 0xfa, 0x01, 0xfe, 
-0x16, 0xfc, 0xd1, 0xfd, 0x43, 0x01, 0x07, 0x00, 0x41, 0x03, 0x1c, 0x02, 0xbc, 0xff, 0x4a, 0xfe, 
-0x4e, 0xf6, 0x6a, 0xf1, 0x0b, 0xea, 0x16, 0xe5, 0x2d, 0xe4, 0x5d, 0xe4, 0xb6, 0xeb, 0x7d, 0xf0, 
-0x99, 0xf4, 0x87, 0xfd, 0x86, 0x03, 0x6e, 0x04, 0x5b, 0x0a, 0x30, 0x0f, 0xe3, 0x0e, 0x7c, 0x11, 
-0x5d, 0x15, 0x1d, 0x13, 0xbd, 0x13, 0x6e, 0x15, 0xb4, 0x10, 0x8c, 0x0f, 0x9f, 0x0c, 0x6f, 0x07, 
-0x42, 0x05, 0xf4, 0x02, 0xb7, 0xfe, 0xca, 0xfc, 0x13, 0xfd, 0xd2, 0xfa, 0x51, 0xfa, 0x79, 0xfe, 
-0xbc, 0xff, 0xe1, 0xfe, 0x99, 0x02, 0x72, 0x01, 0x7d, 0xfd, 0x11, 0xfd, 0x4d, 0xf7, 0x76, 0xef, 
-0x0e, 0xea, 0x6d, 0xe7, 0x85, 0xe2, 0x42, 0xe6, 0x7f, 0xef, 0x42, 0xee, 0xe5, 0xf7, 0x8c, 0x00, 
-0x9e, 0xff, 0x66, 0x06, 0xb5, 0x0b, 0xb6, 0x0b, 0x10, 0x0f, 0x11, 0x11, 0xf5, 0x11, 0x0e, 0x11, 
-0x50, 0x10, 0xca, 0x14, 0xc7, 0x0e, 0x0b, 0x0b, 0xeb, 0x0c, 0x35, 0x05, 0x16, 0x01, 0x38, 0x02, 
-0x79, 0xfe, 0xa4, 0xf9, 0xae, 0xfb, 0x97, 0xfd, 0x74, 0xfa, 0x5c, 0xfd, 0xae, 0x01, 0x3e, 0x02, 
-0xab, 0x02, 0xf1, 0x03, 0x1a, 0x03, 0xb7, 0xfd, 0xa1, 0xf9, 0x0d, 0xf4, 0xef, 0xeb, 0xc5, 0xe4, 
-0x0a, 0xe4, 0x5b, 0xe6, 0x7b, 0xec, 0xab, 0xef, 0x72, 0xf3, 0x01, 0x01, 0xef, 0x02, 0xfc, 0x03, 
-0x21, 0x0a, 0x74, 0x0d, 0xd9, 0x0e, 0x96, 0x0d, 0x47, 0x11, 0x69, 0x13, 0x41, 0x10, 0x7f, 0x10, 
-0xfb, 0x10, 0xf6, 0x0c, 0x39, 0x09, 0xff, 0x05, 0x56, 0x03, 0x8e, 0x01, 0xb3, 0xfe, 0x7c, 0xfc, 
-0x7b, 0xfb, 0x9e, 0xfb, 0x45, 0xfb, 0x0e, 0xfc, 0xb2, 0xfe, 0x84, 0x01, 0xee, 0x03, 0x05, 0x04, 
-0x8d, 0x03, 0xa8, 0x00, 0xd3, 0xfa, 0x1a, 0xf5, 0x2f, 0xee, 0x27, 0xe5, 0x58, 0xe3, 0xb7, 0xe4, 
-0x5f, 0xe6, 0xf9, 0xed, 0x2e, 0xf5, 0xfc, 0xfb, 0x96, 0x01, 0x68, 0x06, 0xef, 0x09, 0x99, 0x0a, 
-0xf5, 0x0c, 0xc8, 0x0d, 0x5a, 0x0e, 0x7c, 0x10, 0x80, 0x0e, 0xae, 0x0f, 0xba, 0x10, 0x4d, 0x0d, 
-0x02, 0x0b, 0x42, 0x08, 0x10, 0x05, 0x80, 0x03, 0x37, 0x00, 0x0e, 0xfd, 0x2b, 0xfe, 0x6a, 0xfc, 
-0x1b, 0xfb, 0x6b, 0xfd, 0xf0, 0xfe, 0x4e, 0x01, 0x63, 0x03, 0xc3, 0x04, 0x5d, 0x04, 0xe9, 0x00, 
-0x48, 0xfc, 0x7e, 0xf6, 0xc5, 0xef, 0xd4, 0xe6, 0x5a, 0xe3, 0x25, 0xe3, 0x73, 0xe5, 0xc9, 0xec, 
-0xb5, 0xf3, 0x61, 0xfc, 0xc3, 0x02, 0x35, 0x05, 0x62, 0x08, 0x0b, 0x0c, 0x7e, 0x0b, 0xe5, 0x0b, 
-0xfa, 0x0d, 0xa9, 0x0e, 0xf3, 0x0e, 0x87, 0x0e, 0x1a, 0x10, 0x16, 0x0f, 0x8a, 0x0c, 0xb6, 0x0a, 
-0xe9, 0x06, 0xaf, 0x03, 0x72, 0x01, 0x8b, 0xfe, 0xe4, 0xfd, 0x94, 0xfc, 0x72, 0xfc, 0x94, 0xfd, 
-0x8b, 0xfe, 0x37, 0x01, 0x0d, 0x03, 0xe7, 0x03, 0xd7, 0x04, 0x89, 0x03, 0xa2, 0xfe, 0xa8, 0xf9, 
-0xcf, 0xf2, 0x60, 0xeb, 0x97, 0xe3, 0x15, 0xe1, 0x73, 0xe3, 0x79, 0xe9, 0x79, 0xf0, 0x2a, 0xf8, 
-0x0f, 0x01, 0x81, 0x03, 0x7d, 0x05, 0x88, 0x07, 0xfd, 0x08, 0x53, 0x0a, 0x2b, 0x0b, 0x98, 0x0c, 
-0x2d, 0x0f, 0xf7, 0x0f, 0xf2, 0x0e, 0xcf, 0x0f, 0x70, 0x0d, 0x45, 0x0b, 0x8d, 0x08, 0x6e, 0x05, 
-0xc9, 0x04, 0xc3, 0x03, 0x8c, 0x00, 0xc7, 0xfe, 0x03, 0xfe, 0xc8, 0xfc, 0x71, 0xfd, 0xaa, 0xfe, 
-0x6e, 0x02, 0x51, 0x06, 0x90, 0x06, 0xc3, 0x04, 0x5a, 0x02, 0xe2, 0xfd, 0x9d, 0xf7, 0x78, 0xf0, 
-0x6f, 0xe8, 0xc1, 0xe2, 0xd6, 0xe2, 0xea, 0xe3, 0xb6, 0xea, 0x5a, 0xf4, 0x1b, 0xfc, 0xf4, 0x01, 
-0xa2, 0x04, 0x4e, 0x07, 0xeb, 0x07, 0x97, 0x08, 0xcf, 0x09, 0x86, 0x09, 0xd7, 0x0b, 0xd2, 0x0d, 
-0x2c, 0x0d, 0x0a, 0x0d, 0x2c, 0x0c, 0x1b, 0x0b, 0xd0, 0x08, 0x76, 0x05, 0xc7, 0x03, 0x96, 0x01, 
-0x38, 0x01, 0x65, 0x01, 0xe4, 0xff, 0xb3, 0x00, 0x16, 0x00, 0x01, 0x01, 0x99, 0x02, 0x61, 0x02, 
-0x47, 0x02, 0x98, 0x00, 0xe6, 0xfd, 0x0f, 0xfa, 0x87, 0xf5, 0xeb, 0xef, 0x75, 0xec, 0xba, 0xeb, 
-0xcb, 0xeb, 0xda, 0xef, 0xdf, 0xf4, 0x3e, 0xf8, 0xa0, 0xfe, 0x6d, 0x03, 0xa1, 0x05, 0xee, 0x07, 
-0x56, 0x09, 0xe1, 0x09, 0x8f, 0x07, 0x08, 0x07, 0xa1, 0x06, 0x96, 0x05, 0x37, 0x06, 0x04, 0x07, 
-0x3f, 0x07, 0xb3, 0x06, 0x2e, 0x06, 0xaf, 0x05, 0xd8, 0x03, 0x9d, 0x03, 0xb6, 0x03, 0x19, 0x02, 
-0xcb, 0x02, 0x0c, 0x03, 0x91, 0x01, 0x3a, 0x01, 0x98, 0x01, 0xb2, 0x01, 0x53, 0x00, 0x37, 0xfe, 
-0xc5, 0xfb, 0x82, 0xf9, 0x8a, 0xf5, 0x21, 0xf2, 0x93, 0xf1, 0x93, 0xee, 0xcd, 0xef, 0xb2, 0xf2, 
-0xeb, 0xf3, 0x4b, 0xf8, 0x20, 0xfd, 0x59, 0x00, 0x67, 0x03, 0x3b, 0x06, 0x10, 0x08, 0xd7, 0x08, 
-0x14, 0x09, 0xf9, 0x08, 0x4e, 0x08, 0xa9, 0x07, 0x31, 0x07, 0xaa, 0x06, 0x80, 0x06, 0x33, 0x06, 
-0x91, 0x05, 0x85, 0x04, 0x73, 0x03, 0x98, 0x03, 0xeb, 0x01, 0x69, 0x01, 0xed, 0x01, 0x8a, 0x00, 
-0x6c, 0x00, 0x6c, 0x01, 0x59, 0x00, 0xe3, 0xff, 0xf8, 0xff, 0x0b, 0xfe, 0x73, 0xfc, 0xaa, 0xfa, 
-0x4a, 0xf9, 0x8e, 0xf7, 0x15, 0xf6, 0x20, 0xf6, 0x57, 0xf5, 0x4e, 0xf5, 0x75, 0xf6, 0x1f, 0xf8, 
-0x3c, 0xfa, 0x34, 0xfc, 0x11, 0xfe, 0x1a, 0x00, 0x55, 0x02, 0x89, 0x03, 0x8e, 0x05, 0xfa, 0x06, 
-0x38, 0x07, 0xfc, 0x07, 0xb2, 0x07, 0x11, 0x07, 0x48, 0x07, 0x74, 0x06, 0x32, 0x05, 0x60, 0x04, 
-0x55, 0x03, 0xbe, 0x02, 0xc2, 0x01, 0xc8, 0x01, 0xc1, 0x01, 0x25, 0x01, 0x9c, 0x01, 0x40, 0x01, 
-0xfe, 0x00, 0x46, 0x01, 0x73, 0x00, 0x92, 0xff, 0x23, 0xff, 0x22, 0xfe, 0x06, 0xfd, 0x4c, 0xfc, 
-0xc3, 0xfb, 0xcf, 0xfa, 0x1c, 0xfa, 0xa7, 0xf9, 0xff, 0xf8, 0xf1, 0xf8, 0x2d, 0xf9, 0xa5, 0xf9, 
-0x74, 0xfa, 0xbe, 0xfb, 0x20, 0xfd, 0x69, 0xfe, 0x0e, 0x00, 0x65, 0x01, 0xa2, 0x02, 0xe7, 0x03, 
-0x24, 0x04, 0x0c, 0x05, 0xc3, 0x05, 0x3e, 0x05, 0x72, 0x05, 0x6c, 0x05, 0x7d, 0x04, 0x06, 0x04, 
-0x94, 0x03, 0x8c, 0x02, 0x17, 0x02, 0xda, 0x01, 0x02, 0x01, 0x7f, 0x00, 0x00, 0x00, 0x92, 0xff, 
-0x39, 0xff, 0xb5, 0xfe, 0xc4, 0xfe, 0x9b, 0xfe, 0x3a, 0xfe, 0x47, 0xfe, 0x4b, 0xfe, 0x2c, 0xfe, 
-0x2e, 0xfe, 0x30, 0xfe, 0x2e, 0xfe, 0x42, 0xfe, 0x8f, 0xfe, 0xc5, 0xfe, 0x15, 0xff, 0x6a, 0xff, 
-0x77, 0xff, 0x8f, 0xff, 0xb3, 0xff, 0xdb, 0xff, 0x00, 0x00, 0x22, 0x00, 0x0c, 0x00, 0xff, 0xff, 
-0xfa, 0xff, 0xff, 0xff, 0xee, 0xff, 0xbf, 0xff, 0xa5, 0xff, 0x43, 0xff, 0x2b, 0xff, 0x3c, 0xff, 
-0x53, 0xff, 0xb4, 0xff, 0xd3, 0xff, 0x33, 0x00, 0x8c, 0x00, 0x75, 0x00, 0xff, 0x00, 0x76, 0x01, 
-0x7c, 0x01, 0xe9, 0x01, 0xc6, 0x01, 0x70, 0x01, 0xa1, 0x01, 0x2b, 0x01, 0x27, 0x01, 0x54, 0x01, 
-0xe3, 0x00, 0xee, 0x00, 0xd2, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x37, 0x00, 0xe6, 0xff, 0xfe, 0xff, 
-0xaf, 0xff, 0x5e, 0xff, 0x36, 0xff, 0xc9, 0xfe, 0xaf, 0xfe, 0x93, 0xfe, 0x54, 0xfe, 0x62, 0xfe, 
-0x59, 0xfe, 0x36, 0xfe, 0x6b, 0xfe, 0xa9, 0xfe, 0xc0, 0xfe, 0x17, 0xff, 0x8a, 0xff, 0xdb, 0xff, 
-0x19, 0x00, 0x4f, 0x00, 0x68, 0x00, 0x7f, 0x00, 0xe8, 0x00, 0x53, 0x01, 0x81, 0x01, 0xb8, 0x01, 
-0xa9, 0x01, 0x5a, 0x01, 0x41, 0x01, 0x24, 0x01, 0xcf, 0x00, 0x81, 0x00, 0x19, 0x00, 0xd0, 0xff, 
-0xb9, 0xff, 0x74, 0xff, 0x66, 0xff, 0x72, 0xff, 0x62, 0xff, 0x50, 0xff, 0x52, 0xff, 0x1e, 0xff, 
-0x9e, 0xfe, 0xac, 0xfe, 0x16, 0xff, 0x9a, 0xff, 0x1a, 0x00, 0x27, 0x00, 0x5d, 0x00, 0x93, 0x00, 
-0x7e, 0x00, 0x95, 0x00, 0x77, 0x00, 0x65, 0x00, 0x68, 0x00, 0x62, 0x00, 0xa8, 0x00, 0xd7, 0x00, 
-0xd7, 0x00, 0xe0, 0x00, 0xc2, 0x00, 0x5a, 0x00, 0x20, 0x00, 0xe0, 0xff, 0x89, 0xff, 0x38, 0xff, 
-0xf1, 0xfe, 0xe7, 0xfe, 0xdf, 0xfe, 0xfd, 0xfe, 0x4f, 0xff, 0xb6, 0xff, 0x0e, 0x00, 0x32, 0x00, 
-0x69, 0x00, 0xad, 0x00, 0xe3, 0x00, 0x15, 0x01, 0x0f, 0x01, 0xe8, 0x00, 0xb9, 0x00, 0x86, 0x00, 
-0x66, 0x00, 0x3c, 0x00, 0xe8, 0xff, 0x4f, 0xff, 0xcb, 0xfe, 0x5d, 0xfe, 0x0d, 0xfe, 0xad, 0xfd, 
-0xd1, 0xfd, 0x95, 0xfe, 0xf4, 0xfe, 0x5c, 0xff, 0x8c, 0xff, 0xc3, 0xff, 0x68, 0x00, 0x90, 0x00, 
-0xa6, 0x00, 0xf8, 0x00, 0xf2, 0x00, 0xf9, 0x00, 0x0d, 0x01, 0x20, 0x01, 0x61, 0x01, 0x5e, 0x01, 
-0x51, 0x01, 0x4c, 0x01, 0x21, 0x01, 0xec, 0x00, 0xe8, 0x00, 0xc8, 0x00, 0x6d, 0x00, 0x3f, 0x00, 
-0xef, 0xff, 0x7f, 0xff, 0x46, 0xff, 0x34, 0xff, 0x1a, 0xff, 0x35, 0xff, 0x36, 0xff, 0x19, 0xff, 
-0x69, 0xff, 0xb2, 0xff, 0xee, 0xff, 0x25, 0x00, 0x3a, 0x00, 0x36, 0x00, 0x2c, 0x00, 0x22, 0x00, 
-0x1b, 0x00, 0x0f, 0x00, 0xcc, 0xff, 0x84, 0xff, 0x45, 0xff, 0x12, 0xff, 0xee, 0xfe, 0xb0, 0xfe, 
-0x8a, 0xfe, 0x4f, 0xfe, 0x66, 0xfe, 0x18, 0xff, 0x84, 0xff, 0xca, 0xff, 0x03, 0x00, 0x50, 0x00, 
-0xa1, 0x00, 0xb3, 0x00, 0xfc, 0x00, 0x41, 0x01, 0x57, 0x01, 0x60, 0x01, 0x85, 0x01, 0xad, 0x01, 
-0xb6, 0x01, 0x97, 0x01, 0x4e, 0x01, 0xfa, 0x00, 0x9d, 0x00, 0x4a, 0x00, 0x16, 0x00, 0xe5, 0xff, 
-0xa4, 0xff, 0x8e, 0xff, 0x6f, 0xff, 0x41, 0xff, 0x3b, 0xff, 0x4e, 0xff, 0x54, 0xff, 0x57, 0xff, 
-0x35, 0xff, 0x0b, 0xff, 0x0a, 0xff, 0x00, 0xff, 0x22, 0xff, 0x5c, 0xff, 0x8f, 0xff, 0xb9, 0xff, 
-0xe3, 0xff, 0xf1, 0xff, 0xce, 0xff, 0xe5, 0xff, 0x1e, 0x00, 0x5a, 0x00, 0x68, 0x00, 0x5d, 0x00, 
-0x7e, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xb1, 0x00, 0xba, 0x00, 0xa4, 0x00, 0x83, 0x00, 0x6a, 0x00, 
-0x57, 0x00, 0x62, 0x00, 0x6e, 0x00, 0x4c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x53, 0x00, 0x93, 0x00, 
-0x4f, 0x00, 0xd8, 0xff, 0x73, 0xff, 0x06, 0xff, 0xba, 0xfe, 0x6e, 0xfe, 0x55, 0xfe, 0x75, 0xfe, 
-0xdf, 0xfe, 0x3c, 0xff, 0x74, 0xff, 0xbc, 0xff, 0xdc, 0xff, 0x05, 0x00, 0x18, 0x00, 0x14, 0x00, 
-0x4f, 0x00, 0x79, 0x00, 0x91, 0x00, 0xd6, 0x00, 0x15, 0x01, 0x4e, 0x01, 0x68, 0x01, 0x59, 0x01, 
-0x27, 0x01, 0xd6, 0x00, 0x76, 0x00, 0x28, 0x00, 0xee, 0xff, 0xad, 0xff, 0x8d, 0xff, 0x6d, 0xff, 
-0x61, 0xff, 0x5e, 0xff, 0x6a, 0xff, 0x80, 0xff, 0x7d, 0xff, 0x86, 0xff, 0x86, 0xff, 0x9f, 0xff, 
-0xc2, 0xff, 0xdc, 0xff, 0x0f, 0x00, 0x36, 0x00, 0x45, 0x00, 0x48, 0x00, 0x3c, 0x00, 0x2a, 0x00, 
-0x22, 0x00, 0x25, 0x00, 0x05, 0x00, 0xe8, 0xff, 0xd6, 0xff, 0xb8, 0xff, 0xc1, 0xff, 0xd3, 0xff, 
-0xda, 0xff, 0xcb, 0xff, 0xe3, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x10, 0x00, 0x0c, 0x00, 0x1b, 0x00, 
-0x39, 0x00, 0x33, 0x00, 0x32, 0x00, 0x42, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x52, 0x00, 0x56, 0x00, 
-0x47, 0x00, 0x1e, 0x00, 0x36, 0x00, 0x3b, 0x00, 0xfa, 0xff, 0xfc, 0xff, 0x05, 0x00, 0xda, 0xff, 
-0xd6, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0xa4, 0xff, 0xaf, 0xff, 0x8f, 0xff, 0x7c, 0xff, 0x9b, 0xff, 
-0xa7, 0xff, 0xa5, 0xff, 0xc9, 0xff, 0xd5, 0xff, 0xe1, 0xff, 0x08, 0x00, 0x22, 0x00, 0x22, 0x00, 
-0x3d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x7f, 0x00, 0x94, 0x00, 0x5e, 0x00, 0x56, 0x00, 0x83, 0x00, 
-0x62, 0x00, 0x83, 0x00, 0x82, 0x00, 0x41, 0x00, 0x0e, 0x00, 0x34, 0x00, 0x67, 0x00, 0xd9, 0xff, 
-0xdb, 0xff, 0x01, 0x00, 0xe9, 0xff, 0x09, 0x00, 0x05, 0x00, 0xeb, 0xff, 0xc2, 0xff, 0xbc, 0xff, 
-0x09, 0x00, 0xf8, 0xff, 0xd9, 0xff, 0x32, 0x00, 0x40, 0x00, 0x28, 0x00, 0x25, 0x00, 0xfb, 0xff, 
-0x1f, 0x00, 0x11, 0x00, 0x1b, 0x00, 0x9a, 0x00, 0xf6, 0xff, 0xce, 0xff, 0x4b, 0x00, 0x26, 0x00, 
-0xe8, 0xff, 0xd9, 0xff, 0x0c, 0x00, 0xec, 0xff, 0x07, 0x00, 0x35, 0x00, 0x23, 0x00, 0x90, 0xff, 
-0xd9, 0xff, 0x60, 0x00, 0x0c, 0x00, 0x20, 0x00, 0xff, 0xff, 0xc1, 0x00, 0xc5, 0xfe, 0xa0, 0x04, 
-0xb1, 0x03, 0x15, 0xfb, 0xb4, 0x00, 0x1b, 0xff, 0x4f, 0xfe, 0x2d, 0x01, 0x2c, 0xff, 0x12, 0x00, 
-0x46, 0xff, 0xa8, 0xff, 0x43, 0x00, 0xd9, 0xff, 0x81, 0x00, 0xb9, 0xff, 0x9b, 0x00, 0xd8, 0x00, 
-0xfa, 0xff, 0x99, 0x00, 0xf4, 0xff, 0xc7, 0xff, 0xe6, 0xff, 0xa9, 0xff, 0x7b, 0x00, 0xd0, 0xff, 
-0xfe, 0xfe, 0x0f, 0x00, 0xcf, 0xff, 0xbc, 0xff, 0xa7, 0xff, 0xfe, 0xff, 0xf4, 0xff, 0x2b, 0x00, 
-0xf1, 0xff, 0x6a, 0x00, 0xa6, 0x00, 0xd2, 0x01, 0x0a, 0x05, 0x89, 0xff, 0xec, 0xff, 0x74, 0xff, 
-0xc0, 0xfb, 0xac, 0xff, 0x80, 0xfe, 0x1c, 0xff, 0x27, 0x00, 0x1f, 0xff, 0xce, 0xff, 0xd6, 0xfe, 
-0x5f, 0xff, 0x2d, 0x00, 0xa7, 0x00, 0x0b, 0x01, 0x1e, 0x00, 0x2b, 0x00, 0x92, 0x00, 0xed, 0xff, 
-0x54, 0x00, 0x63, 0x00, 0x8b, 0xff, 0xc7, 0x00, 0x69, 0xff, 0xd0, 0xfe, 0x51, 0xff, 0xd6, 0xff, 
-0xa0, 0x00, 0x84, 0x01, 0x6b, 0x02, 0xbf, 0xfd, 0x54, 0x01, 0x85, 0x01, 0x10, 0x00, 0x69, 0x03, 
-0x4a, 0xfc, 0x0e, 0xfe, 0x5c, 0x00, 0xf2, 0x00, 0x04, 0x02, 0xb5, 0xfc, 0xbe, 0xfc, 0xce, 0xfe, 
-0xf4, 0x01, 0x94, 0x04, 0xa6, 0x03, 0xbb, 0x00, 0x23, 0xfb, 0x01, 0xfa, 0x75, 0xfe, 0xb2, 0x03, 
-0xd7, 0x03, 0x0b, 0xff, 0x84, 0xff, 0xd9, 0x00, 0xcc, 0xff, 0x37, 0xff, 0xe2, 0x04, 0xda, 0x0c, 
-0x01, 0x09, 0x49, 0xfb, 0x06, 0xf1, 0xa3, 0xf4, 0x00, 0x03, 0x7c, 0x0b, 0xc3, 0x04, 0x2c, 0xf8, 
-0x96, 0xf3, 0x6e, 0xfb, 0x1b, 0x06, 0xf1, 0x06, 0x4a, 0xff, 0x57, 0xfa, 0x80, 0xfd, 0xff, 0x03, 
-0x52, 0x05, 0xd0, 0x01, 0x70, 0xfe, 0x92, 0xfd, 0xc8, 0xfc, 0xa1, 0xfb, 0xe9, 0xfc, 0x72, 0xff, 
-0x7f, 0x01, 0xc3, 0x00, 0x36, 0xfe, 0x87, 0xfc, 0x12, 0xfe, 0xdc, 0x00, 0xef, 0xff, 0x21, 0xfd, 
-0x5e, 0xfc, 0x72, 0xfe, 0x50, 0x02, 0x11, 0x03, 0x9a, 0xff, 0xc2, 0xfc, 0xf8, 0xfb, 0xc2, 0xfe, 
-0xff, 0x01, 0x79, 0x02, 0xab, 0x04, 0xdb, 0x05, 0x9d, 0x02, 0x7e, 0xfc, 0xb9, 0xfa, 0x3d, 0x01, 
-0x39, 0x06, 0x9b, 0x05, 0xf1, 0xfe, 0x5b, 0xf9, 0x13, 0xfc, 0xe9, 0x01, 0x39, 0x04, 0x90, 0x01, 
-0x89, 0xff, 0x16, 0x02, 0x99, 0x04, 0x76, 0x03, 0x8e, 0xff, 0x1a, 0xfc, 0x20, 0xfd, 0x27, 0x00, 
-0xd4, 0x00, 0x36, 0xff, 0x65, 0xfd, 0xea, 0xfc, 0x16, 0xfd, 0x4f, 0xfe, 0xa4, 0xfe, 0x75, 0xfc, 
-0xc1, 0xfc, 0x6e, 0xfe, 0xc6, 0x00, 0x34, 0x01, 0x92, 0xfe, 0x7e, 0xfc, 0x84, 0xfc, 0x51, 0xfd, 
-0x2d, 0x00, 0x61, 0x02, 0x4d, 0x00, 0xce, 0xfd, 0x0e, 0xfd, 0x88, 0xff, 0x59, 0x01, 0x2e, 0x01, 
-0x17, 0xff, 0x9f, 0xfe, 0x13, 0x01, 0xf5, 0x02, 0x62, 0x01, 0x5a, 0xfe, 0x23, 0xfe, 0xd6, 0xfe, 
-0xa0, 0x02, 0x0d, 0x04, 0x16, 0x01, 0x35, 0xff, 0xfa, 0xfe, 0x17, 0x02, 0x85, 0x03, 0x6c, 0x01, 
-0x4e, 0xff, 0x66, 0xfe, 0xa5, 0x00, 0x6e, 0x02, 0xff, 0x01, 0x3f, 0xff, 0x77, 0xfd, 0x3c, 0xfe, 
-0x9b, 0x00, 0x62, 0x02, 0x51, 0x01, 0xbc, 0x00, 0xa0, 0x00, 0x81, 0x00, 0xec, 0x00, 0xee, 0x00, 
-0x23, 0x00, 0x98, 0xff, 0x6e, 0x00, 0xfe, 0x01, 0xb4, 0x01, 0x39, 0xff, 0x0a, 0xfe, 0x24, 0xff, 
-0x05, 0x01, 0xe2, 0x02, 0x5f, 0x02, 0x25, 0x00, 0x8a, 0xff, 0x87, 0xff, 0x13, 0x00, 0x6c, 0xff, 
-0x77, 0xfe, 0x68, 0xff, 0xc5, 0x00, 0x1d, 0x02, 0x34, 0x00, 0xc7, 0xfc, 0xac, 0xfc, 0x58, 0xff, 
-0x2c, 0x02, 0x1f, 0x03, 0xa6, 0x00, 0x12, 0xff, 0xfa, 0xfe, 0xa5, 0x00, 0x1c, 0x01, 0xd2, 0xff, 
-0x08, 0x00, 0xea, 0xff, 0xe7, 0x00, 0xf6, 0xff, 0xcb, 0xfe, 0x76, 0xfe, 0x84, 0x00, 0x1f, 0x02, 
-0xa9, 0x00, 0x14, 0x00, 0x94, 0xff, 0x49, 0x02, 0xde, 0x03, 0xd6, 0x00, 0xe5, 0xfd, 0x37, 0xfd, 
-0xda, 0xff, 0xcb, 0x03, 0x6d, 0x02, 0x45, 0xfe, 0xb4, 0xfd, 0xdf, 0xfe, 0x70, 0x02, 0xb5, 0x02, 
-0x18, 0x01, 0xf0, 0x00, 0xb7, 0xff, 0x26, 0x02, 0xe6, 0xff, 0xe1, 0xfc, 0xb6, 0xfe, 0xb3, 0x01, 
-0xef, 0x01, 0x23, 0xfe, 0x60, 0xfb, 0xed, 0xfa, 0x33, 0xff, 0x77, 0x03, 0xad, 0x03, 0x5b, 0x00, 
-0xaa, 0xfc, 0x7f, 0xfb, 0xd7, 0xfc, 0x67, 0x00, 0x47, 0x02, 0x43, 0x00, 0x9c, 0xfe, 0x67, 0x00, 
-0x91, 0x01, 0xca, 0x00, 0x5a, 0xfe, 0x82, 0xfb, 0x65, 0xfe, 0xc1, 0x02, 0x8c, 0x03, 0x90, 0x00, 
-0x0d, 0xfe, 0x93, 0xff, 0xc9, 0xff, 0x06, 0x01, 0x99, 0x01, 0x4b, 0xff, 0x5c, 0xfe, 0x6a, 0xff, 
-0xee, 0x00, 0x9f, 0x02, 0x94, 0x01, 0xb8, 0xfe, 0x26, 0xfe, 0x21, 0xff, 0x84, 0x01, 0x8b, 0x01, 
-0xcb, 0xfe, 0x2f, 0xfd, 0xc3, 0xfd, 0x22, 0x01, 0x49, 0x02, 0x80, 0xff, 0xe1, 0xfd, 0x64, 0xfe, 
-0x71, 0x01, 0xad, 0x01, 0xe0, 0xfe, 0x56, 0xfd, 0x72, 0xfe, 0x72, 0x01, 0x90, 0x02, 0x8c, 0x00, 
-0x77, 0x00, 0x8e, 0x01, 0x07, 0x01, 0xc7, 0x00, 0xc8, 0xfd, 0xaa, 0xfc, 0xb9, 0xfe, 0x30, 0x02, 
-0x7f, 0x04, 0xfd, 0x03, 0xc0, 0xff, 0x97, 0xfd, 0xaa, 0xff, 0x6c, 0x00, 0xbe, 0x02, 0x4e, 0x00, 
-0x74, 0xff, 0x88, 0x00, 0x84, 0xff, 0x21, 0x01, 0x92, 0xff, 0x93, 0xfd, 0x84, 0xfe, 0xc1, 0xff, 
-0x9c, 0xfe, 0x03, 0xfe, 0x32, 0x00, 0x0e, 0x01, 0xdd, 0x02, 0x08, 0x01, 0x09, 0xfe, 0xb7, 0xfe, 
-0xc6, 0xfe, 0x76, 0x02, 0x45, 0x04, 0x8a, 0x01, 0xa7, 0xfb, 0x19, 0xfa, 0xce, 0xff, 0xdd, 0x02, 
-0x87, 0x02, 0xe1, 0x00, 0x58, 0xfe, 0x82, 0xfc, 0xf6, 0x00, 0xfa, 0x04, 0xde, 0x04, 0xd0, 0x01, 
-0xf1, 0xfc, 0xd1, 0xfd, 0x34, 0xff, 0xcd, 0xfd, 0x23, 0xff, 0x3a, 0xfe, 0xee, 0x00, 0xbe, 0x05, 
-0xa2, 0x01, 0xc3, 0xfe, 0x19, 0xfd, 0x81, 0xfe, 0x3e, 0x02, 0xb3, 0x01, 0xc4, 0xff, 0xed, 0xfc, 
-0xe6, 0xfd, 0xdc, 0x01, 0x07, 0xff, 0x4b, 0xfd, 0x4b, 0xff, 0x41, 0xfe, 0x7a, 0x03, 0xf2, 0x05, 
-0xda, 0x00, 0x50, 0xff, 0xeb, 0xfb, 0xe5, 0xfb, 0x59, 0x02, 0x8e, 0x00, 0xc8, 0xfe, 0xcb, 0x00, 
-0x25, 0x02, 0x64, 0x03, 0xe9, 0x00, 0xbc, 0xfe, 0x2e, 0xfe, 0x9b, 0xfe, 0x7f, 0xff, 0xf9, 0xff, 
-0x6b, 0xff, 0x05, 0x00, 0xac, 0xfd, 0x4d, 0xff, 0x5f, 0x01, 0x21, 0x01, 0x87, 0x02, 0x19, 0x02, 
-0xca, 0x02, 0x21, 0xff, 0xa5, 0xfe, 0x2a, 0xfb, 0xb2, 0xfa, 0x76, 0x01, 0xd6, 0xff, 0x11, 0x02, 
-0x46, 0x04, 0xcc, 0xff, 0xe5, 0xff, 0x3c, 0xfe, 0x3c, 0xfa, 0xf1, 0xfc, 0x89, 0x00, 0xd4, 0x03, 
-0xcb, 0x07, 0x40, 0x02, 0xc3, 0xfb, 0x02, 0xfa, 0x35, 0xf8, 0x41, 0x01, 0xe1, 0x05, 0x5a, 0x04, 
-0x2b, 0x04, 0x34, 0x02, 0x8c, 0x01, 0x22, 0xff, 0x4b, 0xfe, 0xb5, 0xfb, 0xc7, 0xfd, 0x6c, 0x03, 
-0xaf, 0x05, 0xb4, 0x07, 0xdf, 0x00, 0x72, 0xf8, 0xbd, 0xfc, 0xc1, 0xfe, 0x4e, 0x01, 0x83, 0x02, 
-0xeb, 0xfc, 0xfd, 0xff, 0x55, 0x02, 0xdc, 0x01, 0x7b, 0xff, 0x83, 0xf9, 0x85, 0xfa, 0xc4, 0x02, 
-0x78, 0x05, 0x8b, 0x04, 0xf3, 0xfd, 0xc1, 0xf6, 0x36, 0xfd, 0xf0, 0x02, 0x49, 0x07, 0xf7, 0x06, 
-0xec, 0xfc, 0x78, 0xfb, 0xa9, 0xfd, 0xb4, 0xfb, 0x47, 0xfd, 0xf2, 0x02, 0x45, 0x08, 0xe7, 0x08, 
-0xf6, 0x06, 0x5f, 0xfd, 0x59, 0xf7, 0xb5, 0xfc, 0x7c, 0x01, 0x3f, 0x04, 0x7c, 0x05, 0xf6, 0x01, 
-0xf3, 0xff, 0x56, 0x00, 0xdd, 0xfa, 0xf0, 0xfa, 0x9d, 0xfa, 0x70, 0xfc, 0xb3, 0x00, 0x2c, 0xfe, 
-0xa7, 0xfa, 0xd8, 0xf5, 0x93, 0xf5, 0x2f, 0xf9, 0x84, 0xfe, 0x88, 0x01, 0x76, 0x01, 0x73, 0xfc, 
-0x34, 0xfc, 0xa7, 0xff, 0x77, 0xff, 0x68, 0x04, 0x58, 0x02, 0xb2, 0x03, 0x7e, 0x09, 0x62, 0x06, 
-0x27, 0x0a, 0xb3, 0x09, 0x69, 0x05, 0x23, 0x06, 0x2d, 0x01, 0x21, 0x03, 0x5a, 0x07, 0x44, 0x06, 
-0x0e, 0x09, 0x7e, 0x06, 0x41, 0x01, 0x44, 0x02, 0xf1, 0xfc, 0xff, 0xfc, 0xfa, 0x01, 0x23, 0xfc, 
-0x5e, 0xfb, 0x1c, 0xf9, 0xd6, 0xf4, 0xc4, 0xf8, 0x61, 0xf7, 0x2c, 0xf7, 0x83, 0xf6, 0x7f, 0xf0, 
-0xde, 0xf3, 0x35, 0xf4, 0x6b, 0xf7, 0xe0, 0xfc, 0xe5, 0xf9, 0x0b, 0xfb, 0x25, 0xfb, 0xa1, 0x01, 
-0x8f, 0x09, 0xb8, 0x0a, 0xb1, 0x0e, 0xf0, 0x0d, 0x70, 0x09, 0xa5, 0x0a, 0x8d, 0x08, 0x7a, 0x07, 
-0x15, 0x0b, 0x9c, 0x08, 0xde, 0x09, 0x8e, 0x0a, 0x28, 0x06, 0x25, 0x06, 0x66, 0x02, 0x4f, 0xff, 
-0x24, 0x02, 0x02, 0x01, 0x46, 0x01, 0x13, 0x01, 0x66, 0xfd, 0x63, 0xfa, 0xa7, 0xf6, 0x9b, 0xf4, 
-0x4f, 0xf5, 0x62, 0xf5, 0x94, 0xf3, 0x5f, 0xf3, 0x25, 0xf1, 0x4b, 0xee, 0x50, 0xeb, 0xa5, 0xe8, 
-0xd3, 0xef, 0xdf, 0x00, 0x27, 0x10, 0x68, 0x12, 0xb2, 0x09, 0x02, 0xff, 0xae, 0xf9, 0x67, 0xfe, 
-0xd9, 0x07, 0xc9, 0x0e, 0x23, 0x12, 0x3a, 0x0f, 0xc1, 0x0a, 0xd2, 0x07, 0x67, 0x04, 0xf3, 0x06, 
-0x03, 0x0c, 0x6b, 0x10, 0xba, 0x12, 0x5e, 0x0b, 0x93, 0x04, 0x85, 0xfe, 0x4b, 0xf9, 0x3f, 0xfb, 
-0x24, 0xfb, 0x2e, 0xfe, 0x13, 0x02, 0xb2, 0xff, 0xab, 0xfb, 0x70, 0xf6, 0xb0, 0xf1, 0x17, 0xef, 
-0xe4, 0xeb, 0x4b, 0xeb, 0xa8, 0xed, 0x6a, 0xec, 0xfe, 0xea, 0xb3, 0xee, 0xa4, 0xfb, 0x4e, 0x0d, 
-0x35, 0x18, 0x92, 0x11, 0x97, 0x00, 0x27, 0xf3, 0x4d, 0xf2, 0xef, 0x01, 0xc3, 0x0f, 0xdd, 0x12, 
-0x0e, 0x0d, 0x48, 0x02, 0xf0, 0xff, 0x06, 0x06, 0xcd, 0x0b, 0x55, 0x12, 0xce, 0x10, 0x3f, 0x0c, 
-0x9e, 0x0c, 0x61, 0x06, 0xc1, 0x01, 0x20, 0xff, 0xc3, 0xfc, 0x6e, 0x02, 0x92, 0x05, 0xcc, 0x02, 
-0x67, 0xff, 0x51, 0xfa, 0x75, 0xf8, 0x7d, 0xf8, 0x5c, 0xf6, 0x02, 0xf4, 0x4e, 0xef, 0xdc, 0xea, 
-0x79, 0xe6, 0x44, 0xe1, 0xb4, 0xe3, 0xb2, 0xf1, 0x07, 0x09, 0xf8, 0x1a, 0x67, 0x1a, 0x0b, 0x0c, 
-0x98, 0xf7, 0xae, 0xed, 0x5a, 0xf5, 0xd5, 0x03, 0x90, 0x11, 0x4e, 0x15, 0x0e, 0x0d, 0xa5, 0x04, 
-0x7e, 0xfe, 0xc1, 0xfd, 0x4b, 0x04, 0x92, 0x09, 0x89, 0x0f, 0xfd, 0x12, 0x53, 0x11, 0x31, 0x0c, 
-0xb6, 0x02, 0x00, 0xfa, 0x8a, 0xf8, 0xd7, 0xfd, 0xac, 0x05, 0xa7, 0x09, 0x2f, 0x04, 0xec, 0xfa, 
-0xb4, 0xf3, 0x62, 0xf2, 0xbd, 0xf4, 0xe2, 0xf5, 0x33, 0xf1, 0x9f, 0xe8, 0x1f, 0xe2, 0x55, 0xe1, 
-0x57, 0xeb, 0x6e, 0x00, 0x43, 0x17, 0xfe, 0x1e, 0xe7, 0x14, 0xed, 0xff, 0xc5, 0xed, 0xc8, 0xec, 
-0xeb, 0xf9, 0x2c, 0x0c, 0x9f, 0x17, 0x20, 0x13, 0x1d, 0x08, 0x87, 0xfe, 0x58, 0xfa, 0xac, 0x00, 
-0x99, 0x07, 0xd7, 0x0c, 0x7c, 0x12, 0x7a, 0x11, 0x81, 0x0b, 0xab, 0x02, 0xf2, 0xfa, 0x49, 0xfa, 
-0x42, 0xff, 0x12, 0x07, 0xb0, 0x0a, 0xea, 0x06, 0xc2, 0xfc, 0x81, 0xf3, 0x6b, 0xf2, 0x9e, 0xf4, 
-0xfb, 0xf7, 0xf1, 0xf7, 0x11, 0xf1, 0x5b, 0xe8, 0x43, 0xde, 0xbe, 0xdc, 0x50, 0xee, 0x8b, 0x08, 
-0x59, 0x21, 0x65, 0x26, 0xfa, 0x10, 0x30, 0xf6, 0xa3, 0xe5, 0xc3, 0xea, 0xa1, 0x00, 0xd9, 0x12, 
-0xcb, 0x17, 0x72, 0x10, 0x95, 0x04, 0x24, 0xfe, 0x67, 0xfd, 0x10, 0x01, 0x31, 0x07, 0x91, 0x0b, 
-0xda, 0x0d, 0x41, 0x0d, 0x7a, 0x07, 0x40, 0x00, 0x99, 0xfd, 0xc3, 0xfe, 0x84, 0x04, 0x97, 0x09, 
-0xed, 0x09, 0x38, 0x06, 0x8a, 0xfc, 0x5d, 0xf3, 0x39, 0xf1, 0x59, 0xf5, 0x46, 0xfc, 0x7a, 0xfe, 
-0xaf, 0xf7, 0xa6, 0xea, 0xe9, 0xdb, 0x97, 0xd6, 0x55, 0xe5, 0x61, 0x06, 0x00, 0x24, 0x1b, 0x2a, 
-0xf1, 0x16, 0xaa, 0xf4, 0x96, 0xdf, 0xff, 0xe5, 0x5f, 0xfd, 0xc7, 0x16, 0x7b, 0x1d, 0x0c, 0x11, 
-0x05, 0x01, 0x88, 0xf7, 0x64, 0xfc, 0x93, 0x05, 0x18, 0x09, 0xac, 0x09, 0xd5, 0x07, 0xed, 0x07, 
-0x77, 0x09, 0x39, 0x05, 0xbb, 0xff, 0x46, 0xfd, 0x74, 0x00, 0x5a, 0x08, 0x4f, 0x0b, 0x63, 0x07, 
-0x9d, 0xff, 0xe2, 0xf8, 0x1c, 0xf5, 0xb9, 0xf6, 0x8e, 0xfa, 0x8d, 0xfc, 0xe2, 0xfb, 0x3c, 0xf3, 
-0x76, 0xe4, 0x01, 0xda, 0x65, 0xdb, 0xb9, 0xf0, 0x72, 0x14, 0x9d, 0x29, 0x15, 0x24, 0xde, 0x08, 
-0xc5, 0xe9, 0x72, 0xe0, 0xcd, 0xee, 0x79, 0x06, 0xdf, 0x17, 0xd4, 0x17, 0xf7, 0x0b, 0xf8, 0x00, 
-0x6b, 0xfb, 0x2a, 0xfe, 0x9b, 0x02, 0xf1, 0x04, 0x3f, 0x07, 0xfc, 0x08, 0x72, 0x0b, 0x68, 0x0a, 
-0xf6, 0x03, 0x16, 0xfd, 0x10, 0xfb, 0xce, 0x00, 0x08, 0x0b, 0x57, 0x0e, 0x73, 0x09, 0x5a, 0x00, 
-0x7a, 0xf7, 0x8b, 0xf3, 0x68, 0xf5, 0xb8, 0xfa, 0xaa, 0xfe, 0x39, 0xfd, 0xda, 0xf2, 0xb5, 0xe3, 
-0x9d, 0xd8, 0xe1, 0xdc, 0x8e, 0xf4, 0x99, 0x14, 0x13, 0x27, 0xc3, 0x20, 0x35, 0x08, 0xf0, 0xec, 
-0x3c, 0xe3, 0x0c, 0xed, 0x06, 0x02, 0x48, 0x14, 0x75, 0x18, 0x1e, 0x0f, 0x3c, 0x02, 0x33, 0xf9, 
-0xd3, 0xf8, 0x63, 0xff, 0x69, 0x06, 0xa3, 0x0c, 0x76, 0x0c, 0xa9, 0x0a, 0xb3, 0x06, 0x94, 0x00, 
-0xd5, 0xfd, 0xa4, 0xfd, 0xf3, 0x01, 0x58, 0x08, 0x5d, 0x0b, 0xbb, 0x09, 0xda, 0x02, 0x52, 0xfa, 
-0xbf, 0xf5, 0x70, 0xf5, 0xe2, 0xfa, 0xff, 0xff, 0x17, 0xfe, 0x3e, 0xf5, 0x9b, 0xe5, 0x74, 0xda, 
-0x51, 0xdc, 0x90, 0xf0, 0xe7, 0x0f, 0xba, 0x23, 0x75, 0x22, 0xfa, 0x0c, 0xc6, 0xf1, 0x3c, 0xe5, 
-0x1f, 0xeb, 0xad, 0xfe, 0x9e, 0x11, 0x6d, 0x17, 0xb5, 0x10, 0xa2, 0x03, 0x54, 0xfa, 0xd4, 0xf9, 
-0xd2, 0xfe, 0x76, 0x05, 0xf9, 0x09, 0x2f, 0x0a, 0x3b, 0x09, 0x60, 0x07, 0x3b, 0x03, 0x1d, 0xff, 
-0x7d, 0xfc, 0x83, 0xfd, 0xc1, 0x02, 0x75, 0x08, 0x1e, 0x0b, 0x18, 0x08, 0x2f, 0x00, 0x5d, 0xf9, 
-0xe9, 0xf5, 0xdf, 0xf6, 0x96, 0xfb, 0xa2, 0xfc, 0xfd, 0xf8, 0xa9, 0xef, 0x8e, 0xe2, 0xdb, 0xdc, 
-0xee, 0xe6, 0x2b, 0x01, 0x9b, 0x1d, 0xb8, 0x26, 0x01, 0x19, 0x69, 0xfc, 0x74, 0xe5, 0xba, 0xe4, 
-0x14, 0xf5, 0x4e, 0x0b, 0x46, 0x18, 0x10, 0x16, 0x91, 0x0a, 0xb4, 0xfd, 0x6d, 0xf7, 0xd4, 0xf8, 
-0xaf, 0xff, 0x70, 0x07, 0xe8, 0x0a, 0x8d, 0x0b, 0xd4, 0x08, 0x59, 0x04, 0x19, 0x01, 0x6d, 0xfe, 
-0x48, 0xff, 0x1e, 0x02, 0x33, 0x05, 0x25, 0x08, 0xff, 0x06, 0xfb, 0x02, 0x50, 0xfe, 0xbc, 0xfa, 
-0x2b, 0xfa, 0x49, 0xfb, 0x04, 0xfc, 0xd1, 0xf8, 0xe4, 0xf1, 0x0a, 0xe9, 0xfb, 0xe0, 0xdb, 0xe0, 
-0xef, 0xf0, 0x68, 0x0b, 0xd3, 0x1f, 0x03, 0x22, 0x3c, 0x0e, 0x49, 0xf5, 0x48, 0xe7, 0xc1, 0xeb, 
-0x72, 0xfd, 0x8b, 0x0d, 0xd6, 0x13, 0xef, 0x0e, 0xd1, 0x05, 0xb5, 0xfe, 0xfc, 0xfb, 0x84, 0xfd, 
-0x26, 0x01, 0x86, 0x04, 0x82, 0x07, 0x9b, 0x0a, 0x82, 0x0a, 0x40, 0x07, 0x59, 0x01, 0x01, 0xfc, 
-0x81, 0xfc, 0x76, 0x01, 0x30, 0x08, 0x5f, 0x0b, 0x78, 0x08, 0x9c, 0x01, 0x92, 0xfb, 0x51, 0xf9, 
-0x44, 0xfa, 0x68, 0xfc, 0xb2, 0xfb, 0x11, 0xf6, 0xb8, 0xee, 0xa4, 0xe7, 0xa0, 0xe2, 0xc3, 0xe6, 
-0x49, 0xf7, 0x0e, 0x0f, 0x99, 0x1e, 0xd4, 0x1b, 0x27, 0x08, 0x29, 0xf1, 0xaf, 0xe7, 0x3f, 0xef, 
-0x36, 0x02, 0x8c, 0x11, 0x02, 0x14, 0xbe, 0x0c, 0x78, 0x01, 0x12, 0xfb, 0x48, 0xfb, 0xdc, 0xff, 
-0xc3, 0x05, 0x7c, 0x08, 0x6c, 0x08, 0x5c, 0x07, 0xde, 0x05, 0xd8, 0x03, 0x72, 0x01, 0xed, 0xfe, 
-0x02, 0x00, 0x12, 0x04, 0x79, 0x08, 0x5f, 0x0a, 0xf9, 0x05, 0x30, 0xfe, 0x4d, 0xf8, 0x55, 0xf7, 
-0x10, 0xfb, 0xf3, 0xfe, 0x28, 0xfe, 0x10, 0xf8, 0xe6, 0xed, 0xe8, 0xe4, 0x8a, 0xdf, 0x40, 0xe5, 
-0x7a, 0xf9, 0x75, 0x12, 0x9e, 0x22, 0x1a, 0x1e, 0x7e, 0x07, 0x66, 0xee, 0xab, 0xe3, 0x73, 0xed, 
-0xa8, 0x03, 0x88, 0x15, 0x0a, 0x18, 0xd3, 0x0c, 0x20, 0xfe, 0x5e, 0xf6, 0xca, 0xf8, 0xea, 0x00, 
-0x36, 0x08, 0x82, 0x0a, 0x0f, 0x09, 0xd9, 0x05, 0x6d, 0x04, 0xfe, 0x03, 0xc3, 0x02, 0x23, 0x01, 
-0x02, 0x00, 0xf9, 0x02, 0xf6, 0x06, 0x35, 0x09, 0xfc, 0x06, 0x3c, 0x00, 0x90, 0xfa, 0xc4, 0xf8, 
-0x3e, 0xfa, 0x73, 0xfd, 0x93, 0xfd, 0x60, 0xf9, 0x31, 0xf2, 0x69, 0xe8, 0xa6, 0xe1, 0x72, 0xe3, 
-0xdc, 0xf3, 0xe5, 0x0b, 0x63, 0x1d, 0x96, 0x1e, 0x5a, 0x0d, 0xa9, 0xf6, 0x3e, 0xe9, 0x2c, 0xec, 
-0x45, 0xfc, 0x79, 0x0d, 0x63, 0x14, 0xca, 0x0e, 0x89, 0x03, 0x17, 0xfb, 0x9d, 0xfa, 0x3e, 0x00, 
-0xb3, 0x05, 0x94, 0x07, 0x82, 0x06, 0xe3, 0x04, 0x54, 0x05, 0xc8, 0x05, 0x02, 0x04, 0x4d, 0x01, 
-0xc3, 0xfe, 0x96, 0x00, 0x5a, 0x05, 0xba, 0x08, 0xd1, 0x08, 0xa3, 0x03, 0xcb, 0xfd, 0x75, 0xfa, 
-0x45, 0xf9, 0xeb, 0xf9, 0x94, 0xfa, 0x60, 0xf9, 0xe6, 0xf5, 0x82, 0xef, 0x4e, 0xe7, 0x69, 0xe3, 
-0xc0, 0xea, 0x12, 0xff, 0x16, 0x15, 0xb6, 0x1f, 0x2e, 0x17, 0x76, 0x00, 0xc6, 0xec, 0xdd, 0xe7, 
-0x40, 0xf4, 0xfc, 0x07, 0xae, 0x14, 0x06, 0x14, 0xe0, 0x08, 0xf9, 0xfb, 0x5d, 0xf7, 0x88, 0xfb, 
-0xbd, 0x03, 0x2a, 0x0a, 0xe7, 0x0a, 0xc9, 0x08, 0xf4, 0x05, 0x8e, 0x03, 0x8d, 0x01, 0xff, 0xff, 
-0xbf, 0xff, 0xb2, 0x01, 0xd5, 0x05, 0x5a, 0x09, 0x54, 0x09, 0x01, 0x05, 0x71, 0xfd, 0xba, 0xf8, 
-0x16, 0xf8, 0x72, 0xfa, 0xaa, 0xfe, 0xf6, 0xfd, 0x07, 0xf8, 0x27, 0xf0, 0x34, 0xe7, 0x59, 0xe3, 
-0x1c, 0xe7, 0xf0, 0xf3, 0xfe, 0x09, 0x20, 0x1a, 0x41, 0x1c, 0xdb, 0x0d, 0x11, 0xf7, 0x02, 0xea, 
-0x66, 0xec, 0x3e, 0xfc, 0x3d, 0x0d, 0x44, 0x13, 0x5c, 0x0f, 0x07, 0x05, 0x6e, 0xfc, 0xc3, 0xfb, 
-0x24, 0xff, 0xe2, 0x04, 0x6c, 0x08, 0x35, 0x09, 0x44, 0x08, 0xa3, 0x05, 0x4b, 0x04, 0x37, 0x02, 
-0x94, 0x00, 0xb9, 0x00, 0x60, 0x01, 0x9a, 0x04, 0xc8, 0x07, 0xbe, 0x07, 0xd3, 0x04, 0x55, 0xfe, 
-0x5a, 0xf9, 0x3b, 0xf8, 0x3c, 0xfa, 0xd8, 0xfd, 0x1c, 0xfd, 0x67, 0xf7, 0x9c, 0xf0, 0xfb, 0xe8, 
-0x6a, 0xe5, 0xb2, 0xe7, 0x25, 0xf3, 0xb7, 0x06, 0x93, 0x15, 0xf8, 0x19, 0x4a, 0x0e, 0xd7, 0xfb, 
-0x81, 0xef, 0x2a, 0xef, 0x57, 0xfb, 0x4e, 0x08, 0xed, 0x0f, 0x96, 0x0f, 0x17, 0x08, 0x23, 0x01, 
-0x7f, 0xfd, 0x56, 0xfd, 0x0d, 0x01, 0x1c, 0x05, 0x81, 0x08, 0x25, 0x0a, 0x3a, 0x09, 0x1c, 0x06, 
-0x49, 0x03, 0x60, 0x01, 0x3f, 0x00, 0xf9, 0x01, 0xbe, 0x03, 0xca, 0x05, 0xd0, 0x06, 0x6b, 0x04, 
-0x39, 0x01, 0x8d, 0xfc, 0x83, 0xf9, 0x8a, 0xf9, 0x77, 0xfa, 0x21, 0xfa, 0xeb, 0xf6, 0x44, 0xf2, 
-0xd9, 0xeb, 0x3a, 0xe8, 0x6a, 0xe7, 0x80, 0xf0, 0x2d, 0x01, 0xc5, 0x0e, 0x84, 0x16, 0x53, 0x0f, 
-0x7d, 0x01, 0x09, 0xf6, 0x5b, 0xf2, 0x07, 0xfa, 0x77, 0x04, 0xc7, 0x0c, 0xe2, 0x0d, 0x51, 0x08, 
-0x4b, 0x03, 0x3f, 0xff, 0xcd, 0xfe, 0x62, 0x01, 0x69, 0x03, 0xac, 0x07, 0xe6, 0x09, 0x52, 0x0a, 
-0x15, 0x09, 0x06, 0x05, 0x97, 0x02, 0x2c, 0x00, 0x0b, 0x00, 0xa6, 0x02, 0x2a, 0x05, 0xae, 0x07, 
-0x16, 0x07, 0xd7, 0x02, 0xdc, 0xfc, 0x5f, 0xf8, 0xde, 0xf6, 0x1e, 0xf8, 0x91, 0xf9, 0xa9, 0xf8, 
-0xff, 0xf4, 0xa4, 0xee, 0x3e, 0xe8, 0x64, 0xe6, 0x32, 0xee, 0xc7, 0xfc, 0xf8, 0x0b, 0x6a, 0x13, 
-0x8f, 0x0f, 0x42, 0x05, 0x2e, 0xfa, 0x73, 0xf5, 0x0d, 0xf8, 0x0b, 0x00, 0xcf, 0x08, 0xd3, 0x0c, 
-0x79, 0x0b, 0x75, 0x06, 0xe2, 0x01, 0xdb, 0xff, 0x06, 0x00, 0xbf, 0x02, 0x5f, 0x06, 0xe0, 0x09, 
-0x46, 0x0b, 0x39, 0x09, 0x02, 0x06, 0x40, 0x02, 0x3b, 0x00, 0x93, 0x00, 0x8c, 0x02, 0x98, 0x05, 
-0x85, 0x07, 0x5e, 0x06, 0x34, 0x02, 0x93, 0xfc, 0x97, 0xf8, 0x3b, 0xf7, 0xfb, 0xf7, 0x1a, 0xf9, 
-0x4e, 0xf8, 0xc4, 0xf6, 0x4b, 0xf2, 0xae, 0xeb, 0xe2, 0xe6, 0xd7, 0xe8, 0xb3, 0xf5, 0xd5, 0x05, 
-0xaf, 0x11, 0xd7, 0x12, 0xa6, 0x09, 0xe0, 0xfd, 0xb4, 0xf5, 0x59, 0xf6, 0xdf, 0xfc, 0xd3, 0x04, 
-0xb8, 0x0a, 0x41, 0x0b, 0x18, 0x09, 0xea, 0x05, 0x28, 0x02, 0x33, 0x01, 0xa3, 0x00, 0xf2, 0x02, 
-0x69, 0x07, 0x9a, 0x09, 0x8b, 0x0b, 0xd2, 0x08, 0xf1, 0x04, 0xe1, 0x01, 0x43, 0xff, 0x41, 0x01, 
-0x42, 0x04, 0x03, 0x07, 0x29, 0x07, 0x24, 0x03, 0x05, 0xff, 0x46, 0xfb, 0xcc, 0xf8, 0x14, 0xf8, 
-0x26, 0xf8, 0xa9, 0xf8, 0x8d, 0xf8, 0x62, 0xf5, 0xfc, 0xef, 0x5b, 0xe9, 0x5d, 0xe7, 0x5e, 0xef, 
-0x66, 0xfb, 0x75, 0x08, 0xec, 0x0d, 0xcb, 0x0b, 0x99, 0x06, 0xae, 0xff, 0xf1, 0xfc, 0x3b, 0xfd, 
-0x89, 0xfe, 0x72, 0x02, 0xcf, 0x06, 0xee, 0x09, 0x2a, 0x0b, 0x96, 0x07, 0x81, 0x03, 0xf9, 0x00, 
-0x71, 0x01, 0x87, 0x04, 0xfe, 0x06, 0xe1, 0x08, 0x3f, 0x09, 0x8d, 0x08, 0xcf, 0x05, 0xa6, 0x02, 
-0x6d, 0x00, 0x4a, 0x00, 0x4a, 0x02, 0x84, 0x03, 0x89, 0x03, 0xbf, 0x01, 0xf6, 0xfe, 0x0d, 0xfc, 
-0x01, 0xf9, 0xa4, 0xf6, 0xc6, 0xf5, 0xa1, 0xf6, 0x36, 0xf7, 0xc5, 0xf5, 0x74, 0xf0, 0x13, 0xec, 
-0x32, 0xea, 0xc3, 0xef, 0xd8, 0xfa, 0x85, 0x03, 0xb1, 0x0a, 0x2f, 0x0b, 0x28, 0x08, 0x70, 0x04, 
-0x8c, 0xff, 0xbd, 0xfd, 0xd5, 0xfd, 0x30, 0x00, 0x6f, 0x06, 0x44, 0x0a, 0x40, 0x0c, 0xf2, 0x0a, 
-0xa5, 0x05, 0x01, 0x02, 0xc6, 0x00, 0x2d, 0x03, 0xd9, 0x07, 0x65, 0x0c, 0x4e, 0x0d, 0x7d, 0x0a, 
-0x1b, 0x05, 0xa9, 0x00, 0x61, 0xfe, 0xd6, 0xfe, 0x2e, 0x01, 0x63, 0x02, 0x24, 0x03, 0xc8, 0x00, 
-0xcf, 0xfd, 0x0e, 0xfb, 0x75, 0xf7, 0xff, 0xf5, 0x4a, 0xf5, 0xe8, 0xf5, 0xfd, 0xf6, 0x01, 0xf5, 
-0x47, 0xf2, 0x1d, 0xef, 0x76, 0xee, 0x8e, 0xf2, 0xea, 0xf8, 0xbf, 0x02, 0x2e, 0x0a, 0x0d, 0x0c, 
-0x88, 0x09, 0x9e, 0x02, 0x2e, 0xfe, 0xef, 0xfb, 0x6f, 0xfe, 0x8d, 0x03, 0x33, 0x07, 0x40, 0x0a, 
-0xd5, 0x09, 0x67, 0x07, 0x3c, 0x05, 0xc7, 0x02, 0x86, 0x02, 0xeb, 0x04, 0x5d, 0x07, 0xe2, 0x0a, 
-0x26, 0x0b, 0x4c, 0x08, 0x8d, 0x03, 0x5d, 0xff, 0x32, 0xff, 0x78, 0xff, 0x4b, 0x00, 0xdd, 0x00, 
-0xc4, 0xff, 0xc3, 0xff, 0xe9, 0xfe, 0xd6, 0xfc, 0x6c, 0xfa, 0x2e, 0xf7, 0xe7, 0xf5, 0x44, 0xf5, 
-0xc0, 0xf4, 0x4d, 0xf5, 0x05, 0xf5, 0x64, 0xf2, 0xac, 0xf2, 0x4e, 0xf5, 0xd9, 0xfa, 0x8d, 0x02, 
-0xc8, 0x06, 0x84, 0x06, 0x1e, 0x04, 0x3f, 0x02, 0x1f, 0x01, 0x75, 0x00, 0xe2, 0xff, 0xee, 0x01, 
-0x38, 0x05, 0x66, 0x08, 0x75, 0x0a, 0x85, 0x08, 0x1c, 0x05, 0x54, 0x04, 0x24, 0x04, 0x31, 0x06, 
-0xe8, 0x07, 0xd7, 0x06, 0x4a, 0x06, 0x76, 0x05, 0xde, 0x03, 0x22, 0x02, 0x79, 0x00, 0xa3, 0xff, 
-0xeb, 0xff, 0xce, 0xff, 0x35, 0xff, 0x79, 0xfe, 0xbc, 0xfe, 0x9b, 0xfe, 0x79, 0xfd, 0xa5, 0xfb, 
-0xba, 0xf9, 0xc3, 0xf8, 0xe0, 0xf7, 0xe7, 0xf6, 0xb3, 0xf6, 0xa9, 0xf6, 0xe3, 0xf6, 0x51, 0xf9, 
-0x56, 0xf9, 0xcb, 0xfa, 0xb7, 0xfe, 0x23, 0x00, 0x88, 0x02, 0xa0, 0x01, 0x04, 0x00, 0xd0, 0x00, 
-0x35, 0x00, 0xd0, 0x02, 0x9b, 0x04, 0x44, 0x04, 0x82, 0x05, 0x80, 0x05, 0x47, 0x05, 0x67, 0x06, 
-0x5e, 0x05, 0x9f, 0x04, 0x04, 0x05, 0x31, 0x04, 0x0e, 0x05, 0xda, 0x04, 0xc9, 0x03, 0xae, 0x02, 
-0x86, 0x01, 0xb1, 0x01, 0x64, 0x01, 0x06, 0x01, 0x44, 0x00, 0xe0, 0xfe, 0x47, 0xfe, 0x2f, 0xfe, 
-0x67, 0xfd, 0x07, 0xfe, 0xc8, 0xfd, 0xf2, 0xfc, 0xd0, 0xfc, 0x2a, 0xfb, 0xec, 0xfa, 0xb4, 0xfa, 
-0xbe, 0xfa, 0x36, 0xfc, 0x31, 0xfc, 0x72, 0xfc, 0x86, 0xfd, 0xae, 0xfd, 0x68, 0xfd, 0xb2, 0xfd, 
-0xd8, 0xfd, 0x18, 0xff, 0xff, 0xff, 0x85, 0x00, 0xac, 0x00, 0xd5, 0xff, 0xf7, 0xff, 0x06, 0x00, 
-0x42, 0x01, 0x7f, 0x02, 0x90, 0x02, 0xdd, 0x02, 0x07, 0x03, 0xc9, 0x02, 0xb9, 0x02, 0xe3, 0x02, 
-0x8a, 0x02, 0x95, 0x02, 0x07, 0x03, 0x90, 0x03, 0x6f, 0x03, 0x17, 0x03, 0x25, 0x04, 0x07, 0x02, 
-0xf9, 0xff, 0x23, 0x00, 0x5c, 0xff, 0xeb, 0xfe, 0x57, 0xff, 0x5d, 0xff, 0xc4, 0xff, 0xe6, 0xff, 
-0x6c, 0xfe, 0x14, 0xfe, 0xf4, 0xfe, 0xed, 0xff, 0x8a, 0xff, 0x88, 0xfe, 0x11, 0xff, 0xc2, 0xfe, 
-0xe4, 0xfd, 0xe6, 0xfd, 0x93, 0xfd, 0xd6, 0xfe, 0x3f, 0xff, 0x61, 0xfe, 0xcd, 0xfe, 0x81, 0xff, 
-0x14, 0xff, 0xe1, 0xfe, 0x0f, 0xff, 0x78, 0xff, 0xed, 0xfe, 0x16, 0xff, 0x35, 0x00, 0x13, 0x00, 
-0x1b, 0x00, 0xc9, 0xff, 0x7f, 0x00, 0x4d, 0x00, 0x37, 0x00, 0x17, 0x00, 0x81, 0x00, 0xd2, 0x01, 
-0x54, 0x01, 0xf7, 0x00, 0xdc, 0x00, 0xec, 0x00, 0x1a, 0x01, 0x3f, 0x01, 0xce, 0x01, 0x25, 0x01, 
-0x49, 0x00, 0xe6, 0xff, 0x31, 0x01, 0x35, 0x02, 0xdd, 0x00, 0xac, 0x01, 0x2b, 0x01, 0x92, 0x00, 
-0x17, 0x00, 0xb6, 0xff, 0x7c, 0xff, 0x13, 0xff, 0x50, 0xff, 0x31, 0xff, 0xd4, 0xff, 0xf1, 0xfe, 
-0xc3, 0xfd, 0x1b, 0xff, 0x91, 0x00, 0xdf, 0xff, 0x49, 0xff, 0xd3, 0xfe, 0x71, 0xff, 0x7f, 0xff, 
-0x46, 0xfe, 0x6c, 0xfe, 0x21, 0xff, 0xb3, 0xff, 0x51, 0x00, 0x3f, 0x01, 0x61, 0x00, 0xb2, 0x00, 
-0x05, 0x01, 0x63, 0xff, 0x27, 0x00, 0xf3, 0xff, 0x5b, 0x00, 0xd2, 0x00, 0x7d, 0x00, 0x54, 0x00, 
-0xdd, 0x00, 0xe3, 0x00, 0x54, 0xff, 0x65, 0x00, 0xf0, 0x00, 0x5a, 0x01, 0x47, 0x01, 0x72, 0x00, 
-0xd4, 0x01, 0xea, 0x01, 0x3d, 0x00, 0x76, 0x00, 0x92, 0x00, 0x1a, 0x00, 0x3f, 0x01, 0xe3, 0xff, 
-0x70, 0xff, 0x83, 0x00, 0x41, 0x00, 0x41, 0xff, 0x2d, 0x00, 0xec, 0xfe, 0x63, 0xff, 0x5e, 0x00, 
-0x31, 0xfe, 0x05, 0xff, 0xb3, 0xfe, 0x59, 0xff, 0x78, 0xff, 0xcd, 0xfe, 0xc2, 0xfe, 0xd5, 0xff, 
-0x88, 0xff, 0xba, 0xfe, 0x48, 0xff, 0x17, 0xff, 0xe9, 0xff, 0xda, 0x00, 0xbd, 0xfe, 0x20, 0xfe, 
-0xf6, 0xff, 0xe2, 0x00, 0xb1, 0x00, 0xa3, 0xff, 0x08, 0x00, 0x48, 0x01, 0x53, 0x00, 0xf5, 0xff, 
-0x52, 0x01, 0x8b, 0x01, 0x15, 0x00, 0x36, 0x00, 0x5e, 0x00, 0x5b, 0x00, 0x81, 0x00, 0xb8, 0x00, 
-0x12, 0x01, 0x4e, 0x00, 0x78, 0xff, 0x3e, 0xff, 0x3a, 0x00, 0x55, 0x00, 0xb1, 0xff, 0x74, 0xfe, 
-0xa9, 0xff, 0xc1, 0xff, 0x64, 0xff, 0xa8, 0xfe, 0x8e, 0xff, 0xb4, 0xfe, 0x8f, 0xfe, 0x10, 0x00, 
-0xa2, 0xff, 0xcb, 0xff, 0xea, 0xfe, 0x2f, 0xff, 0x5a, 0xff, 0xab, 0xff, 0x16, 0xff, 0x09, 0x00, 
-0x97, 0x00, 0x5d, 0xff, 0xb2, 0xff, 0xa9, 0x00, 0x4d, 0x00, 0xe7, 0xfe, 0x2a, 0x00, 0x6b, 0x01, 
-0xa3, 0x00, 0x49, 0xff, 0x5e, 0x00, 0x6b, 0x01, 0x66, 0x01, 0xd5, 0x00, 0xdc, 0xff, 0xff, 0xff, 
-0x32, 0x01, 0x4e, 0x02, 0xa5, 0x00, 0x8d, 0xff, 0xe4, 0xff, 0x48, 0x00, 0x92, 0x00, 0xbb, 0xff, 
-0xec, 0xff, 0x34, 0x00, 0x28, 0x00, 0xa8, 0xff, 0xd1, 0xfe, 0x46, 0xff, 0x02, 0x00, 0x3f, 0x00, 
-0xdc, 0xfe, 0xf6, 0xfe, 0xd1, 0xff, 0xc0, 0x00, 0x14, 0xff, 0xae, 0xfd, 0xea, 0xff, 0xe6, 0xff, 
-0x88, 0xff, 0x75, 0x00, 0xe2, 0x00, 0x10, 0xfe, 0x7d, 0xff, 0x5f, 0x01, 0xf3, 0xff, 0x0f, 0xff, 
-0x01, 0xff, 0x57, 0x01, 0xcc, 0x00, 0xc9, 0xff, 0x78, 0xff, 0x20, 0x01, 0xa3, 0x00, 0x8d, 0xff, 
-0xed, 0x00, 0x0a, 0x01, 0x13, 0x01, 0xb8, 0xff, 0x96, 0x00, 0x27, 0x00, 0xb9, 0xff, 0x44, 0x01, 
-0xe8, 0xff, 0xa0, 0xff, 0xa2, 0xff, 0xfa, 0x00, 0xc8, 0xff, 0xd9, 0xfe, 0xd4, 0xfe, 0xdf, 0xfe, 
-0xe0, 0x00, 0x19, 0xff, 0xf3, 0xfd, 0xb1, 0xff, 0x79, 0x00, 0x77, 0x00, 0x5f, 0x00, 0xc5, 0xff, 
-0x20, 0xff, 0xdb, 0xff, 0x98, 0xff, 0x3d, 0x00, 0xbc, 0x00, 0x70, 0xff, 0x6d, 0xff, 0x01, 0x01, 
-0x2f, 0x00, 0x4e, 0xff, 0x0e, 0x01, 0xfc, 0xff, 0xb5, 0x00, 0xdb, 0xff, 0xbe, 0xff, 0x02, 0x01, 
-0xe3, 0x00, 0x9b, 0xff, 0x27, 0x00, 0x9c, 0xff, 0x94, 0xff, 0xc5, 0x01, 0x36, 0x00, 0x55, 0x00, 
-0x6e, 0x00, 0x1f, 0xff, 0xf4, 0xff, 0x99, 0xff, 0x23, 0x00, 0xf4, 0xff, 0xb0, 0xff, 0x3d, 0x01, 
-0x79, 0xfe, 0x68, 0xff, 0x4a, 0x00, 0xdb, 0xff, 0x3c, 0x00, 0xe0, 0xff, 0x4f, 0xff, 0x80, 0xfe, 
-0x14, 0xff, 0xf9, 0x00, 0x98, 0x00, 0x47, 0x00, 0xfb, 0xfe, 0x6c, 0xfe, 0xbf, 0x00, 0xdd, 0x00, 
-0x61, 0x01, 0x00, 0x00, 0xfb, 0xfe, 0xad, 0xff, 0x15, 0x00, 0x4d, 0xff, 0xf8, 0xff, 0xb6, 0x00, 
-0x4c, 0x00, 0x90, 0x01, 0xc5, 0xff, 0xf5, 0xfe, 0x74, 0x01, 0xdd, 0x01, 0x78, 0xff, 0x7e, 0x00, 
-0x17, 0x01, 0x3e, 0xff, 0xfb, 0xff, 0xf8, 0xfe, 0x2c, 0xff, 0x8d, 0xff, 0x34, 0x00, 0x7b, 0x00, 
-0xa9, 0xff, 0xbd, 0xff, 0x41, 0x00, 0x1b, 0x00, 0xd9, 0xff, 0x7d, 0xff, 0x1c, 0x00, 0x35, 0xff, 
-0x21, 0xff, 0xe0, 0x00, 0x3d, 0x00, 0xbc, 0xff, 0x34, 0xff, 0xb9, 0x00, 0xbb, 0x00, 0xf8, 0xff, 
-0x48, 0x00, 0xc3, 0x00, 0x5f, 0x00, 0xe9, 0xff, 0x47, 0x00, 0x46, 0x00, 0xe3, 0xfe, 0x21, 0x00, 
-0x2a, 0x01, 0x95, 0xff, 0xfd, 0xff, 0x2a, 0x00, 0x8b, 0x00, 0x98, 0x00, 0x2a, 0x00, 0x4d, 0x00, 
-0x02, 0x00, 0x0d, 0x00, 0x13, 0x00, 0xb0, 0x00, 0x2f, 0x00, 0x10, 0xff, 0xf7, 0xff, 0xa0, 0xff, 
-0x41, 0x00, 0x4b, 0xff, 0x73, 0xff, 0x30, 0x00, 0x53, 0x00, 0xf7, 0xff, 0xfd, 0xfe, 0xf0, 0x00, 
-0x27, 0x00, 0x52, 0xff, 0xc8, 0xff, 0x17, 0x00, 0x73, 0xff, 0xee, 0xff, 0x09, 0x00, 0xca, 0xff, 
-0x1e, 0x00, 0x9a, 0xff, 0x0d, 0x00, 0x56, 0xff, 0xc8, 0xff, 0xb4, 0xff, 0xd0, 0xff, 0x1d, 0x00, 
-0xb2, 0xff, 0xe7, 0xff, 0xd3, 0xff, 0x21, 0x00, 0x45, 0x00, 0xdf, 0xff, 0xf4, 0xff, 0x99, 0x00, 
-0x0d, 0x00, 0x30, 0x00, 0x9b, 0x00, 0x7d, 0x00, 0x3e, 0x00, 0x11, 0x00, 0xb1, 0x00, 0xd5, 0x00, 
-0x22, 0x00, 0x7f, 0x00, 0x02, 0x01, 0x59, 0x00, 0x45, 0x00, 0x32, 0x01, 0x26, 0x00, 0x35, 0x00, 
-0xc2, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x3e, 0x00, 0x8d, 0x00, 0x3a, 0xff, 0x37, 0x00, 0x1a, 0x00, 
-0xa4, 0xff, 0x98, 0xff, 0x53, 0xff, 0x9f, 0xff, 0x82, 0xff, 0x56, 0xff, 0x51, 0xff, 0x63, 0xff, 
-0x4b, 0xff, 0x93, 0xff, 0x59, 0xff, 0x14, 0xff, 0xb2, 0xff, 0xdb, 0xff, 0x62, 0xff, 0xc1, 0xff, 
-0x9b, 0xff, 0xf7, 0xff, 0x24, 0x00, 0x72, 0xff, 0x80, 0x00, 0x36, 0x00, 0x64, 0x00, 0xa4, 0x00, 
-0x0b, 0x00, 0x8d, 0x00, 0x79, 0x00, 0xff, 0x00, 0x48, 0x00, 0x86, 0x00, 0xf5, 0x00, 0x08, 0x00, 
-0x96, 0x00, 0xc3, 0x00, 0x8e, 0x00, 0x58, 0x00, 0x22, 0x00, 0x8a, 0x00, 0x66, 0x00, 0x8f, 0x00, 
-0x4c, 0x00, 0xad, 0xff, 0x64, 0x00, 0x21, 0x00, 0xe2, 0xff, 0xac, 0xff, 0xc8, 0xff, 0x74, 0xff, 
-0x85, 0xff, 0xfe, 0xff, 0x48, 0xff, 0xfe, 0xfe, 0x64, 0xff, 0x96, 0xff, 0x3c, 0xff, 0xa0, 0xff, 
-0x6d, 0xff, 0x48, 0xff, 0xa2, 0xff, 0x7a, 0xff, 0x4f, 0xff, 0x51, 0x00, 0x62, 0xff, 0x86, 0xff, 
-0x40, 0x00, 0xd7, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x56, 0x00, 0x26, 0x00, 0x84, 0x00, 
-0xa7, 0x00, 0x46, 0x00, 0xfd, 0x00, 0x91, 0x00, 0x54, 0x00, 0x4f, 0x00, 0xb9, 0x00, 0x90, 0x00, 
-0x35, 0x00, 0x7d, 0x00, 0x02, 0x00, 0xcc, 0x00, 0x03, 0x00, 0xa8, 0xff, 0x8c, 0x00, 0x0a, 0x00, 
-0x13, 0x00, 0x16, 0x00, 0xea, 0xff, 0x35, 0x00, 0x38, 0x00, 0x11, 0xff, 0x41, 0xff, 0x3f, 0x00, 
-0xf5, 0xff, 0xaf, 0xfe, 0x56, 0xff, 0x14, 0x00, 0xff, 0xfe, 0x6c, 0xff, 0xe8, 0xfe, 0x79, 0xff, 
-0x9f, 0xff, 0x24, 0x00, 0xde, 0xff, 0x29, 0xff, 0x02, 0x00, 0x55, 0x00, 0xd4, 0xff, 0x44, 0xff, 
-0x2d, 0x00, 0x64, 0x00, 0x3b, 0x00, 0xdd, 0xff, 0xfc, 0xff, 0x45, 0x00, 0x04, 0x01, 0x97, 0x00, 
-0xdd, 0xff, 0xbd, 0x00, 0xf9, 0xff, 0xbc, 0xff, 0xc9, 0x00, 0x6c, 0x00, 0xf5, 0xff, 0x2f, 0x00, 
-0x48, 0x00, 0xdf, 0xff, 0xbc, 0xff, 0x8c, 0x00, 0x38, 0x00, 0x6d, 0xff, 0x65, 0x00, 0x66, 0x00, 
-0xff, 0xff, 0x05, 0x00, 0x97, 0xff, 0x26, 0x00, 0x26, 0xff, 0x58, 0xff, 0x6e, 0x00, 0xba, 0xfe, 
-0x6d, 0xff, 0xba, 0xff, 0x54, 0xff, 0x54, 0xff, 0x36, 0xff, 0xa1, 0xff, 0x09, 0x00, 0x21, 0xff, 
-0x12, 0x00, 0x3e, 0x00, 0xed, 0xff, 0xe9, 0xff, 0xc1, 0xff, 0x78, 0x00, 0x7f, 0xff, 0x98, 0x00, 
-0x33, 0x00, 0x91, 0xff, 0xe1, 0xff, 0x07, 0x01, 0xe8, 0xff, 0xb1, 0xff, 0x6b, 0x00, 0x67, 0xff, 
-0x3c, 0x00, 0x80, 0x00, 0x07, 0x00, 0x59, 0xff, 0x14, 0x01, 0xbd, 0x00, 0x94, 0xff, 0xce, 0x00, 
-0xd0, 0xff, 0x47, 0x00, 0x69, 0x00, 0x4c, 0x00, 0xa6, 0x00, 0xf6, 0xfe, 0x64, 0x00, 0x3b, 0x00, 
-0x0c, 0xff, 0x83, 0x00, 0xef, 0xff, 0xd3, 0xff, 0x29, 0x00, 0xf8, 0xfe, 0x24, 0xff, 0xd5, 0xff, 
-0x5b, 0xff, 0x2e, 0xff, 0x3a, 0xff, 0x5f, 0x00, 0xa6, 0xff, 0x20, 0xff, 0xbf, 0x00, 0xc3, 0xff, 
-0xd7, 0xff, 0xfd, 0xff, 0xa5, 0xff, 0x1e, 0x00, 0x2c, 0x00, 0x8a, 0x00, 0x81, 0xff, 0xa0, 0xff, 
-0x8f, 0x00, 0xd7, 0xff, 0x87, 0xff, 0x46, 0x00, 0x2b, 0x00, 0x1e, 0x00, 0x31, 0x00, 0x89, 0x00, 
-0xc7, 0x00, 0xd5, 0xff, 0x3e, 0x00, 0xac, 0xff, 0xc3, 0xff, 0x3b, 0x00, 0xd5, 0xff, 0x23, 0x00, 
-0x34, 0x00, 0xe4, 0xfe, 0x93, 0x00, 0x9c, 0x00, 0xc2, 0xfe, 0x3c, 0x00, 0x96, 0xff, 0x43, 0x00, 
-0x75, 0xff, 0x32, 0xff, 0xb3, 0xff, 0xa2, 0x00, 0x1c, 0xff, 0x03, 0xfe, 0x9f, 0x00, 0x19, 0x00, 
-0xb1, 0xfe, 0x46, 0xff, 0xe7, 0x00, 0x2c, 0xff, 0xd6, 0xfe, 0xa5, 0x01, 0x7b, 0xff, 0xaa, 0xff, 
-0x3d, 0x01, 0xc1, 0xff, 0x51, 0x00, 0x47, 0x01, 0x92, 0x00, 0x89, 0x00, 0xd1, 0x00, 0xf7, 0xff, 
-0x51, 0x01, 0xd7, 0x00, 0xeb, 0xff, 0x16, 0x00, 0x74, 0x01, 0x7e, 0x00, 0x3b, 0x00, 0x7e, 0x01, 
-0x68, 0x00, 0x05, 0x00, 0x7e, 0x00, 0x0d, 0x00, 0x35, 0x00, 0x1a, 0x00, 0x05, 0xff, 0x37, 0xff, 
-0xde, 0xff, 0x3a, 0x00, 0xdc, 0xfe, 0x68, 0x00, 0x5b, 0x00, 0x7c, 0xff, 0x35, 0xff, 0x7d, 0xff, 
-0xa1, 0x00, 0xc5, 0xfe, 0xdb, 0xfe, 0x44, 0x00, 0x77, 0xff, 0xef, 0xfe, 0x4c, 0x00, 0xcd, 0xfe, 
-0xa3, 0xff, 0x63, 0x01, 0xb7, 0x00, 0x95, 0x00, 0x3b, 0x01, 0x09, 0x01, 0xdd, 0x00, 0x39, 0x00, 
-0x4c, 0xff, 0xb8, 0xff, 0x95, 0xff, 0x29, 0xff, 0x26, 0xff, 0x41, 0x00, 0x5a, 0xff, 0x71, 0xff, 
-0x4a, 0xff, 0x11, 0xff, 0x19, 0xff, 0x03, 0xfe, 0x92, 0xfe, 0x29, 0x00, 0x06, 0x00, 0xbb, 0xfe, 
-0x93, 0xff, 0x99, 0x00, 0xa2, 0xff, 0x1a, 0x00, 0x9e, 0xff, 0xa1, 0xff, 0xeb, 0x00, 0x65, 0x00, 
-0x75, 0xff, 0xbd, 0x00, 0x1e, 0x01, 0xe3, 0xfe, 0x25, 0x00, 0x8b, 0x00, 0x0e, 0x00, 0xff, 0xff, 
-0x33, 0x01, 0xa7, 0x00, 0xf3, 0xff, 0x9e, 0xff, 0x0e, 0x00, 0x90, 0xff, 0x1a, 0xff, 0x87, 0x00, 
-0x1a, 0xff, 0x6c, 0xff, 0x11, 0x01, 0x75, 0x00, 0xf7, 0xff, 0x3c, 0x01, 0x15, 0x01, 0xee, 0xff, 
-0x0f, 0x01, 0x10, 0x02, 0x8b, 0xff, 0xfb, 0x00, 0x7f, 0x02, 0x61, 0x00, 0xd0, 0x01, 0xc1, 0x01, 
-0xb1, 0xff, 0x13, 0x00, 0xe0, 0xff, 0x04, 0xff, 0x5f, 0xfe, 0xc7, 0xff, 0x67, 0xff, 0x0d, 0xff, 
-0x2a, 0x01, 0x26, 0xff, 0x14, 0xff, 0x2a, 0x01, 0x5b, 0xff, 0x05, 0xff, 0x08, 0x00, 0x57, 0xff, 
-0x25, 0x00, 0x26, 0x00, 0x3b, 0x00, 0xb7, 0xff, 0x9c, 0xff, 0x7d, 0x00, 0x5c, 0xfd, 0x52, 0xff, 
-0xff, 0x00, 0x65, 0xfe, 0x6d, 0xff, 0xc3, 0x00, 0x5e, 0xff, 0x70, 0xff, 0xb7, 0x00, 0xde, 0xff, 
-0x29, 0xff, 0xcd, 0x00, 0xae, 0x01, 0xb2, 0x00, 0x47, 0x01, 0x9d, 0x01, 0xe9, 0x00, 0xd6, 0xff, 
-0x6d, 0x00, 0x1e, 0x00, 0x83, 0xfe, 0xb8, 0xff, 0xbe, 0x00, 0x27, 0x00, 0x80, 0x01, 0x8c, 0x01, 
-0x31, 0x01, 0xb6, 0x00, 0x8d, 0x00, 0xaa, 0x01, 0xb7, 0xff, 0xc7, 0xfe, 0xfb, 0x00, 0x6a, 0xff, 
-0x75, 0xff, 0x7c, 0x00, 0x3f, 0xff, 0x13, 0xff, 0x7e, 0xfb, 0x6e, 0xfa, 0xaa, 0xfa, 0x40, 0xf6, 
-0x49, 0xf5, 0xad, 0xf6, 0x01, 0xf2, 0xd7, 0xf3, 0x9d, 0xf8, 0xce, 0xf7, 0x9a, 0xfc, 0x02, 0x03, 
-0xcd, 0x04, 0x33, 0x07, 0x09, 0x0c, 0x6e, 0x0e, 0xb0, 0x0c, 0x36, 0x0d, 0xb4, 0x0e, 0xe6, 0x09, 
-0x69, 0x08, 0x51, 0x09, 0x4a, 0x04, 0xa5, 0x03, 0xd8, 0x04, 0x26, 0x04, 0x4f, 0x04, 0x09, 0x04, 
-0x32, 0x06, 0xe1, 0x04, 0xef, 0x03, 0x6f, 0x05, 0xbf, 0x02, 0xfd, 0x01, 0xfe, 0x00, 0x2c, 0xff, 
-0x98, 0xfe, 0xae, 0xfb, 0x75, 0xf9, 0x60, 0xf8, 0x5e, 0xf6, 0x75, 0xf3, 0x23, 0xf3, 0xa2, 0xf1, 
-0x6c, 0xec, 0x7c, 0xed, 0x6e, 0xec, 0x5c, 0xe9, 0xf7, 0xef, 0x47, 0xf3, 0x69, 0xf5, 0x70, 0xfe, 
-0xaf, 0x03, 0xe5, 0x06, 0x68, 0x0c, 0x7d, 0x0f, 0xf1, 0x0f, 0xfa, 0x0e, 0x47, 0x0f, 0xd9, 0x0a, 
-0x98, 0x06, 0x69, 0x07, 0x74, 0x01, 0xc2, 0xff, 0x54, 0x01, 0x57, 0xfe, 0xa2, 0x00, 0x1a, 0x03, 
-0xa4, 0x02, 0xdb, 0x05, 0xc6, 0x07, 0x02, 0x07, 0x6d, 0x08, 0x8a, 0x07, 0xb6, 0x06, 0x2f, 0x06, 
-0x2a, 0x03, 0xca, 0x04, 0x64, 0x02, 0x0e, 0x01, 0x02, 0x03, 0x63, 0xff, 0x24, 0x00, 0x53, 0xff, 
-0x6e, 0xfc, 0xa3, 0xfc, 0xe1, 0xfa, 0x39, 0xf9, 0xab, 0xf6, 0x9a, 0xf4, 0xdd, 0xf1, 0x03, 0xed, 
-0xa1, 0xe8, 0x06, 0xe7, 0x43, 0xea, 0x25, 0xea, 0x28, 0xef, 0xb7, 0xf7, 0x02, 0xfb, 0x8b, 0x03, 
-0x46, 0x0b, 0xf0, 0x0d, 0x76, 0x12, 0x98, 0x14, 0x6c, 0x12, 0xd8, 0x10, 0x99, 0x0e, 0xe3, 0x09, 
-0xaa, 0x05, 0x0c, 0x03, 0xcd, 0xff, 0x1d, 0xfd, 0x07, 0xfd, 0x96, 0xfd, 0x74, 0xff, 0xc6, 0x01, 
-0x44, 0x04, 0x24, 0x08, 0xcd, 0x07, 0x0c, 0x09, 0x6c, 0x0b, 0x4d, 0x08, 0xdf, 0x08, 0xeb, 0x07, 
-0x5b, 0x03, 0x2a, 0x03, 0x1a, 0x02, 0xec, 0xfd, 0xdd, 0xfe, 0xda, 0xfd, 0x02, 0xfb, 0x01, 0xfd, 
-0x17, 0xfb, 0x9d, 0xfa, 0x34, 0xfa, 0x4c, 0xf7, 0x72, 0xf6, 0x86, 0xf1, 0xfe, 0xef, 0x9c, 0xeb, 
-0xe8, 0xe6, 0xbc, 0xea, 0x84, 0xe9, 0x3e, 0xed, 0xb3, 0xf4, 0x84, 0xf8, 0xba, 0xff, 0x21, 0x07, 
-0x34, 0x0c, 0x09, 0x11, 0xd7, 0x14, 0x09, 0x15, 0x35, 0x14, 0xa7, 0x12, 0xa4, 0x0d, 0xff, 0x09, 
-0xa2, 0x05, 0xb1, 0x00, 0x80, 0xfe, 0xfe, 0xfb, 0x65, 0xfb, 0xf4, 0xfb, 0x13, 0xfd, 0xcf, 0x00, 
-0x35, 0x03, 0x57, 0x05, 0xea, 0x08, 0xf4, 0x08, 0x27, 0x0a, 0xf6, 0x09, 0x81, 0x07, 0x0c, 0x08, 
-0xfd, 0x03, 0x4f, 0x02, 0xf7, 0x01, 0xb0, 0xfd, 0x3d, 0xfe, 0x51, 0xfe, 0x01, 0xfc, 0x7a, 0xfc, 
-0xc5, 0xfc, 0xe7, 0xfa, 0x88, 0xf9, 0x61, 0xf9, 0x68, 0xf6, 0x84, 0xf3, 0x42, 0xf2, 0xce, 0xed, 
-0x8b, 0xe8, 0x16, 0xeb, 0x4b, 0xea, 0xd7, 0xea, 0x2c, 0xf4, 0xa1, 0xf4, 0x35, 0xfc, 0x32, 0x06, 
-0xd9, 0x06, 0x0e, 0x10, 0xcb, 0x13, 0x05, 0x13, 0xdd, 0x16, 0xca, 0x12, 0x74, 0x0f, 0xdf, 0x0c, 
-0x63, 0x07, 0x87, 0x03, 0x75, 0x00, 0x43, 0xfd, 0xad, 0xfb, 0xaa, 0xfb, 0x00, 0xfc, 0x17, 0xff, 
-0x86, 0x01, 0x26, 0x04, 0xee, 0x07, 0xe0, 0x07, 0x67, 0x0a, 0xf7, 0x0b, 0x7e, 0x08, 0x08, 0x0a, 
-0x58, 0x07, 0x37, 0x03, 0xdc, 0x03, 0x16, 0xff, 0x67, 0xfd, 0x6e, 0xfd, 0x69, 0xfa, 0x17, 0xfb, 
-0x28, 0xf9, 0x0f, 0xf9, 0x33, 0xf9, 0xd5, 0xf6, 0xb3, 0xf7, 0x63, 0xf5, 0xac, 0xf2, 0x5e, 0xf1, 
-0xff, 0xed, 0xc0, 0xeb, 0x55, 0xed, 0x7e, 0xed, 0xa3, 0xef, 0x47, 0xf5, 0xf7, 0xf7, 0x6d, 0xfe, 
-0xe4, 0x04, 0x50, 0x08, 0x07, 0x0f, 0xe4, 0x10, 0x4c, 0x13, 0x78, 0x14, 0x3c, 0x12, 0x56, 0x10, 
-0x0e, 0x0c, 0x2a, 0x09, 0x1d, 0x04, 0x4a, 0x01, 0x04, 0xff, 0x4d, 0xfc, 0xc7, 0xfc, 0xf4, 0xfc, 
-0xd1, 0xff, 0xf0, 0x01, 0x6e, 0x03, 0x27, 0x07, 0x0f, 0x08, 0x9e, 0x09, 0x4b, 0x0a, 0xdc, 0x09, 
-0x3a, 0x08, 0x24, 0x06, 0x10, 0x04, 0xaa, 0x00, 0xb9, 0xff, 0x39, 0xfd, 0x5f, 0xfb, 0xb4, 0xfb, 
-0x5a, 0xf9, 0x0a, 0xf9, 0x19, 0xf9, 0x2a, 0xf7, 0x40, 0xf8, 0x8f, 0xf7, 0x1e, 0xf7, 0xd5, 0xf5, 
-0x62, 0xf3, 0x66, 0xf2, 0xa4, 0xed, 0xc0, 0xee, 0x7f, 0xee, 0x1c, 0xee, 0x76, 0xf4, 0x32, 0xf5, 
-0xf9, 0xfa, 0xe0, 0x01, 0x8c, 0x04, 0x34, 0x0c, 0xbd, 0x0e, 0x81, 0x11, 0x56, 0x14, 0x84, 0x12, 
-0xb7, 0x12, 0xd3, 0x0e, 0xd8, 0x0b, 0x7b, 0x08, 0x9e, 0x03, 0xa3, 0x01, 0x81, 0xfe, 0x37, 0xfd, 
-0xc2, 0xfc, 0x5e, 0xfd, 0x2a, 0x00, 0xf3, 0xff, 0x20, 0x04, 0xc9, 0x05, 0x4c, 0x06, 0xc0, 0x09, 
-0xe4, 0x07, 0xbd, 0x08, 0xcd, 0x06, 0xc4, 0x04, 0x7a, 0x03, 0x22, 0x00, 0x1f, 0xff, 0xb8, 0xfc, 
-0x32, 0xfb, 0x83, 0xfa, 0xbb, 0xf8, 0x73, 0xf8, 0xdc, 0xf7, 0xaf, 0xf7, 0x4e, 0xf7, 0xb1, 0xf7, 
-0xaa, 0xf7, 0x0b, 0xf6, 0x11, 0xf6, 0x9e, 0xf3, 0x26, 0xf0, 0x91, 0xf1, 0xac, 0xf0, 0xf5, 0xef, 
-0x63, 0xf6, 0x8c, 0xf6, 0xca, 0xfa, 0x2b, 0x02, 0x69, 0x03, 0x1a, 0x0a, 0x69, 0x0e, 0xe7, 0x0f, 
-0x25, 0x13, 0xd7, 0x12, 0x55, 0x11, 0xab, 0x0f, 0x4b, 0x0c, 0xcd, 0x08, 0xe3, 0x05, 0xe2, 0x02, 
-0x0b, 0x00, 0xd3, 0xfe, 0x5f, 0xfd, 0xa9, 0xfd, 0xc9, 0xff, 0xe0, 0xfe, 0x63, 0x02, 0x08, 0x04, 
-0x98, 0x02, 0x45, 0x07, 0x48, 0x05, 0x74, 0x04, 0x17, 0x07, 0xff, 0x01, 0xe3, 0x01, 0x69, 0x01, 
-0x09, 0xfd, 0x6a, 0xfd, 0x5c, 0xfc, 0xf9, 0xf9, 0x62, 0xfa, 0xb1, 0xf9, 0x51, 0xf8, 0xc8, 0xf8, 
-0xce, 0xf7, 0xd4, 0xf7, 0x2c, 0xf7, 0xf9, 0xf6, 0x56, 0xf5, 0xf0, 0xf3, 0xf6, 0xf2, 0x04, 0xf1, 
-0xd2, 0xf2, 0x34, 0xf2, 0x93, 0xf5, 0x11, 0xf9, 0x22, 0xfb, 0x29, 0x02, 0xb2, 0x04, 0xdc, 0x08, 
-0xee, 0x0d, 0x1e, 0x0f, 0x9c, 0x11, 0xb4, 0x11, 0x27, 0x11, 0xe1, 0x0e, 0x04, 0x0d, 0x15, 0x0a, 
-0x57, 0x06, 0xd5, 0x04, 0x5c, 0x01, 0xae, 0xff, 0x63, 0xff, 0x5d, 0xfe, 0xc1, 0xfe, 0x13, 0x00, 
-0xe9, 0x00, 0x1b, 0x02, 0x57, 0x03, 0x62, 0x04, 0x8f, 0x04, 0xc8, 0x04, 0x3b, 0x04, 0xf8, 0x02, 
-0x57, 0x02, 0x62, 0x00, 0xeb, 0xfe, 0x13, 0xfe, 0x2e, 0xfc, 0x2f, 0xfb, 0xd8, 0xfa, 0x87, 0xf9, 
-0x2c, 0xf9, 0x0d, 0xf9, 0xe6, 0xf7, 0x27, 0xf8, 0x1d, 0xf7, 0x13, 0xf7, 0xe4, 0xf5, 0xe8, 0xf4, 
-0x50, 0xf4, 0x2e, 0xf1, 0x95, 0xf4, 0xf8, 0xf2, 0x73, 0xf4, 0x2f, 0xfb, 0x08, 0xf9, 0x28, 0x01, 
-0xc1, 0x04, 0x1d, 0x05, 0xc7, 0x0d, 0x85, 0x0c, 0x83, 0x0f, 0x0c, 0x12, 0xe1, 0x0e, 0xd8, 0x0f, 
-0x92, 0x0d, 0x12, 0x0a, 0xc9, 0x08, 0x95, 0x05, 0xb0, 0x02, 0x80, 0x01, 0x71, 0xff, 0xae, 0xfe, 
-0x19, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x38, 0x01, 0xc3, 0x01, 0xaf, 0x02, 0x5e, 0x03, 0x44, 0x03, 
-0x48, 0x03, 0x6a, 0x02, 0xdc, 0x01, 0x86, 0x01, 0x00, 0x00, 0x79, 0xff, 0xa9, 0xfe, 0xae, 0xfd, 
-0x4f, 0xfc, 0x3a, 0xfc, 0xec, 0xfa, 0xb7, 0xf9, 0x37, 0xfa, 0x0b, 0xf8, 0x17, 0xf8, 0x51, 0xf8, 
-0x67, 0xf6, 0x7a, 0xf6, 0x85, 0xf6, 0x27, 0xf3, 0x5c, 0xf3, 0x4c, 0xf5, 0xaa, 0xf2, 0xd3, 0xf7, 
-0xf7, 0xf9, 0x8e, 0xfa, 0x9c, 0x02, 0x6b, 0x02, 0x21, 0x07, 0xc5, 0x0b, 0x14, 0x0b, 0xed, 0x0e, 
-0xdc, 0x0e, 0x08, 0x0e, 0x6d, 0x0d, 0xa9, 0x0b, 0x5b, 0x09, 0x00, 0x07, 0x65, 0x05, 0x18, 0x02, 
-0x22, 0x01, 0xcd, 0xff, 0xf8, 0xfd, 0xeb, 0xfe, 0xb7, 0xfe, 0xb0, 0xfe, 0x3b, 0x00, 0xd5, 0x00, 
-0x64, 0x01, 0x03, 0x03, 0x9b, 0x02, 0x81, 0x03, 0x3d, 0x03, 0x4f, 0x02, 0x54, 0x03, 0xb8, 0x00, 
-0x06, 0x01, 0x52, 0x00, 0x32, 0xfd, 0xfb, 0xfd, 0x5a, 0xfb, 0xff, 0xf9, 0x46, 0xfa, 0x77, 0xf8, 
-0x45, 0xf8, 0x39, 0xf8, 0xd2, 0xf7, 0x8e, 0xf7, 0x01, 0xf8, 0x57, 0xf7, 0x9b, 0xf6, 0x43, 0xf6, 
-0xce, 0xf5, 0xa2, 0xf6, 0x1c, 0xf7, 0xd6, 0xf9, 0xff, 0xfb, 0x66, 0xfe, 0x12, 0x03, 0xbd, 0x04, 
-0x7e, 0x08, 0x08, 0x0b, 0x71, 0x0b, 0xb9, 0x0d, 0x08, 0x0d, 0x7b, 0x0c, 0xcd, 0x0b, 0x9d, 0x09, 
-0x34, 0x08, 0x25, 0x06, 0x50, 0x04, 0x83, 0x02, 0x36, 0x01, 0xfc, 0xff, 0xce, 0xfe, 0x08, 0xff, 
-0xd3, 0xfe, 0xe1, 0xfe, 0xf9, 0xff, 0x62, 0x00, 0xb0, 0x00, 0xbd, 0x01, 0x13, 0x02, 0xe6, 0x01, 
-0x5e, 0x02, 0x65, 0x02, 0xf5, 0x00, 0xb4, 0x01, 0x8b, 0x00, 0x8b, 0xfe, 0x7e, 0xff, 0xb2, 0xfc, 
-0x23, 0xfc, 0xf0, 0xfb, 0xcd, 0xf9, 0xba, 0xf9, 0xdb, 0xf8, 0x15, 0xf8, 0x89, 0xf7, 0xba, 0xf7, 
-0xc5, 0xf6, 0xf0, 0xf6, 0xd8, 0xf6, 0xa1, 0xf5, 0xaa, 0xf7, 0x7e, 0xf7, 0x31, 0xf9, 0x95, 0xfc, 
-0x54, 0xfd, 0x85, 0x01, 0xe8, 0x03, 0xb7, 0x05, 0x2c, 0x09, 0x08, 0x0a, 0xed, 0x0a, 0x40, 0x0c, 
-0x85, 0x0b, 0xaa, 0x0a, 0x63, 0x0a, 0xe4, 0x07, 0xde, 0x06, 0x9e, 0x05, 0xfb, 0x02, 0x8a, 0x02, 
-0x2e, 0x01, 0x45, 0xff, 0xd6, 0xff, 0xb7, 0xfe, 0x8f, 0xfe, 0xba, 0xff, 0xab, 0xfe, 0x7a, 0x00, 
-0xa3, 0x00, 0xce, 0x00, 0xb9, 0x02, 0xb3, 0x01, 0xe4, 0x02, 0x00, 0x03, 0xf8, 0x01, 0xee, 0x02, 
-0xd3, 0x00, 0x63, 0x00, 0xa6, 0xff, 0x41, 0xfd, 0x11, 0xfd, 0x56, 0xfb, 0x07, 0xfa, 0x6a, 0xf9, 
-0x6b, 0xf8, 0x8d, 0xf7, 0xbe, 0xf7, 0xec, 0xf6, 0x75, 0xf6, 0xc1, 0xf7, 0x01, 0xf6, 0x89, 0xf6, 
-0x56, 0xf8, 0xca, 0xf6, 0xa9, 0xfa, 0xe3, 0xfb, 0xb8, 0xfc, 0x97, 0x01, 0x70, 0x01, 0x15, 0x05, 
-0x8f, 0x07, 0xe2, 0x07, 0x29, 0x0a, 0xd0, 0x0a, 0x1a, 0x0a, 0x8a, 0x0a, 0xc7, 0x09, 0xd8, 0x07, 
-0xde, 0x07, 0x9a, 0x05, 0x1b, 0x04, 0x82, 0x03, 0x0e, 0x01, 0x86, 0x00, 0x1d, 0x00, 0x8e, 0xfe, 
-0xb6, 0xff, 0x55, 0xff, 0xc0, 0xff, 0x06, 0x01, 0xd2, 0x00, 0xe4, 0x01, 0x0b, 0x02, 0xf9, 0x01, 
-0xd3, 0x02, 0x62, 0x02, 0x69, 0x02, 0x7d, 0x02, 0x4f, 0x01, 0xed, 0x00, 0x7d, 0xff, 0x04, 0xfe, 
-0xc9, 0xfc, 0x00, 0xfb, 0xae, 0xf9, 0xf7, 0xf8, 0xa4, 0xf7, 0x32, 0xf7, 0x7f, 0xf7, 0xfc, 0xf6, 
-0x57, 0xf7, 0x60, 0xf8, 0x6c, 0xf7, 0xbe, 0xf8, 0x47, 0xf8, 0x0b, 0xf9, 0xe5, 0xfa, 0x64, 0xfa, 
-0x1e, 0xfe, 0xe1, 0xfd, 0xa2, 0x01, 0x40, 0x04, 0x39, 0x05, 0x7b, 0x09, 0x57, 0x09, 0x94, 0x0a, 
-0xec, 0x0b, 0x4d, 0x0a, 0x25, 0x0a, 0x71, 0x09, 0x6b, 0x06, 0xf0, 0x06, 0xbb, 0x04, 0x80, 0x03, 
-0x78, 0x03, 0xc1, 0x00, 0xd0, 0x00, 0x1c, 0x00, 0x1a, 0xff, 0xa8, 0xff, 0x86, 0xff, 0x73, 0xff, 
-0x45, 0x00, 0xc9, 0x00, 0x21, 0x01, 0xa1, 0x02, 0x43, 0x02, 0xeb, 0x02, 0x60, 0x03, 0x50, 0x02, 
-0xd3, 0x02, 0x09, 0x01, 0x62, 0x00, 0x8a, 0xfe, 0xcc, 0xfc, 0xd9, 0xfb, 0xca, 0xf9, 0xf9, 0xf8, 
-0xa0, 0xf7, 0x7b, 0xf6, 0x02, 0xf6, 0xd4, 0xf4, 0x6f, 0xf4, 0x39, 0xf4, 0xbe, 0xf3, 0x62, 0xf3, 
-0x31, 0xf4, 0x6b, 0xf5, 0x54, 0xf6, 0x9b, 0xfa, 0xc8, 0xfc, 0x85, 0x00, 0xcd, 0x04, 0xaf, 0x06, 
-0x31, 0x0a, 0x1c, 0x0c, 0x9e, 0x0c, 0x6e, 0x0e, 0xd3, 0x0d, 0xe3, 0x0c, 0x94, 0x0d, 0xa7, 0x0a, 
-0x7a, 0x0a, 0xaf, 0x08, 0x8d, 0x05, 0x36, 0x05, 0x41, 0x01, 0x51, 0x00, 0xa1, 0xff, 0x62, 0xfd, 
-0xe5, 0xfe, 0xdc, 0xfd, 0x77, 0xfe, 0x14, 0x00, 0xdc, 0xff, 0x99, 0x01, 0x90, 0x02, 0x46, 0x02, 
-0xf7, 0x03, 0x97, 0x03, 0xc4, 0x02, 0x95, 0x03, 0xc6, 0x00, 0x05, 0x00, 0x25, 0xfe, 0xa8, 0xfb, 
-0xe8, 0xfa, 0x8d, 0xf8, 0xe6, 0xf7, 0xf4, 0xf6, 0xb8, 0xf5, 0xf4, 0xf5, 0xf2, 0xf4, 0xfc, 0xf4, 
-0x3f, 0xf5, 0x89, 0xf4, 0xa4, 0xf5, 0xd8, 0xf5, 0x1f, 0xf6, 0x91, 0xf8, 0xb0, 0xf9, 0xed, 0xfb, 
-0xe7, 0xff, 0x80, 0x01, 0x53, 0x05, 0x00, 0x08, 0x3f, 0x09, 0xe2, 0x0b, 0x05, 0x0c, 0x00, 0x0c, 
-0x64, 0x0c, 0x01, 0x0b, 0xfa, 0x09, 0x93, 0x09, 0x93, 0x07, 0xcb, 0x06, 0x66, 0x05, 0xa4, 0x03, 
-0xd8, 0x02, 0x20, 0x01, 0x96, 0x00, 0xd7, 0xff, 0xbb, 0xff, 0xa9, 0xff, 0x36, 0x00, 0xb8, 0x00, 
-0xde, 0x00, 0x5a, 0x02, 0xa7, 0x01, 0x8b, 0x02, 0xc7, 0x02, 0x56, 0x01, 0x02, 0x02, 0x7e, 0x00, 
-0xae, 0xfe, 0x96, 0xfe, 0xa6, 0xfb, 0xa7, 0xfa, 0x61, 0xf9, 0x83, 0xf7, 0x1a, 0xf7, 0x04, 0xf6, 
-0x16, 0xf6, 0xf5, 0xf4, 0xcf, 0xf5, 0xb3, 0xf4, 0x59, 0xf5, 0x15, 0xf5, 0xfc, 0xf4, 0x50, 0xf7, 
-0xcd, 0xf6, 0x3c, 0xfb, 0x55, 0xfd, 0xe5, 0xff, 0xfb, 0x04, 0x5e, 0x06, 0x8c, 0x09, 0xf4, 0x0b, 
-0xfd, 0x0b, 0x67, 0x0d, 0xec, 0x0c, 0x30, 0x0c, 0x32, 0x0c, 0xc3, 0x0a, 0x8a, 0x09, 0x43, 0x08, 
-0xc3, 0x05, 0xea, 0x03, 0x3f, 0x02, 0xa9, 0xff, 0x71, 0xff, 0xe9, 0xfd, 0x93, 0xfd, 0x70, 0xfe, 
-0xc5, 0xfd, 0x57, 0xff, 0xe6, 0xff, 0x11, 0x00, 0xfa, 0x01, 0xc1, 0x01, 0x93, 0x02, 0x94, 0x03, 
-0x4f, 0x02, 0x08, 0x03, 0x58, 0x01, 0x24, 0x00, 0x09, 0xff, 0xb2, 0xfc, 0x92, 0xfb, 0xdb, 0xf9, 
-0x8a, 0xf8, 0x08, 0xf8, 0x59, 0xf7, 0x0e, 0xf7, 0x7e, 0xf7, 0xdd, 0xf6, 0xda, 0xf7, 0x69, 0xf7, 
-0xcc, 0xf7, 0x66, 0xf8, 0x86, 0xf8, 0x65, 0xf9, 0x2a, 0xfa, 0xb0, 0xfb, 0xf3, 0xfc, 0xa1, 0xff, 
-0x3a, 0x01, 0xbf, 0x03, 0xa1, 0x05, 0xe2, 0x06, 0x77, 0x08, 0x14, 0x09, 0x32, 0x09, 0x00, 0x0a, 
-0x82, 0x09, 0xdb, 0x08, 0x42, 0x09, 0xce, 0x07, 0xa6, 0x07, 0xa8, 0x06, 0x7c, 0x05, 0x97, 0x04, 
-0x3b, 0x03, 0x01, 0x02, 0x70, 0x01, 0x09, 0x00, 0xae, 0xff, 0xc7, 0xff, 0x65, 0xfe, 0xcc, 0xff, 
-0x0f, 0xff, 0x13, 0xff, 0xa4, 0x00, 0x5c, 0xff, 0x7b, 0x00, 0xc4, 0x00, 0x57, 0xff, 0x24, 0x00, 
-0xc2, 0xfe, 0xb2, 0xfd, 0x0f, 0xfd, 0x8a, 0xfb, 0x9d, 0xfa, 0x8b, 0xf9, 0xd9, 0xf8, 0xf5, 0xf7, 
-0x6a, 0xf7, 0xc9, 0xf6, 0x66, 0xf6, 0x95, 0xf5, 0xb8, 0xf5, 0xd2, 0xf5, 0x78, 0xf6, 0x0d, 0xf8, 
-0x41, 0xfa, 0x29, 0xfd, 0xb2, 0xff, 0xa1, 0x03, 0xab, 0x05, 0x0f, 0x08, 0xa3, 0x0a, 0x56, 0x0a, 
-0xfe, 0x0b, 0xbe, 0x0b, 0xa1, 0x0a, 0xab, 0x0b, 0x4e, 0x09, 0x27, 0x09, 0xbb, 0x07, 0x8d, 0x05, 
-0x8e, 0x04, 0x18, 0x02, 0x3a, 0x01, 0x12, 0xff, 0x1b, 0xff, 0x96, 0xfd, 0x1a, 0xfe, 0x96, 0xfe, 
-0xf7, 0xfd, 0x67, 0x00, 0x76, 0xff, 0xd9, 0x00, 0x54, 0x01, 0xfc, 0x00, 0xb9, 0x01, 0x23, 0x01, 
-0x09, 0x01, 0x24, 0x00, 0xac, 0xff, 0x77, 0xfe, 0x9f, 0xfd, 0xc5, 0xfc, 0x55, 0xfb, 0x4c, 0xfb, 
-0xc7, 0xf9, 0x36, 0xf9, 0x07, 0xf9, 0xda, 0xf7, 0x29, 0xf8, 0xef, 0xf7, 0xfe, 0xf7, 0x79, 0xf8, 
-0x2c, 0xf9, 0xff, 0xf9, 0x41, 0xfb, 0x88, 0xfc, 0x8a, 0xfd, 0x1d, 0xff, 0x15, 0x00, 0x4d, 0x01, 
-0x23, 0x03, 0x82, 0x03, 0xa0, 0x05, 0x6b, 0x06, 0xc4, 0x06, 0xcf, 0x08, 0xbb, 0x07, 0xf7, 0x08, 
-0x42, 0x08, 0xa7, 0x07, 0x9c, 0x07, 0x71, 0x06, 0x4f, 0x06, 0x48, 0x05, 0xbf, 0x04, 0x99, 0x03, 
-0x4d, 0x03, 0xd3, 0x01, 0x77, 0x01, 0x74, 0x00, 0xb7, 0xff, 0x38, 0xff, 0x94, 0xfe, 0x74, 0xfe, 
-0xac, 0xfd, 0xf3, 0xfd, 0x98, 0xfc, 0xc0, 0xfc, 0xe7, 0xfb, 0x07, 0xfb, 0xe8, 0xfa, 0x05, 0xfa, 
-0xa1, 0xf9, 0x34, 0xf9, 0x19, 0xf9, 0xb6, 0xf8, 0xe7, 0xf8, 0xf5, 0xf8, 0x16, 0xf9, 0x78, 0xf9, 
-0x3c, 0xfa, 0x96, 0xfa, 0xca, 0xfb, 0xee, 0xfc, 0xf9, 0xfd, 0xda, 0xff, 0x14, 0x01, 0x99, 0x02, 
-0xe0, 0x03, 0x2d, 0x05, 0xcf, 0x05, 0xf3, 0x06, 0x42, 0x07, 0x53, 0x07, 0x12, 0x08, 0x17, 0x07, 
-0x65, 0x07, 0x06, 0x07, 0xdf, 0x05, 0x05, 0x06, 0xb2, 0x04, 0x4f, 0x04, 0xff, 0x03, 0xd7, 0x02, 
-0x4d, 0x03, 0x12, 0x02, 0x41, 0x02, 0xe6, 0x01, 0x47, 0x01, 0xe3, 0x01, 0xaa, 0x00, 0x5f, 0x01, 
-0x8c, 0x00, 0x1b, 0x00, 0x5e, 0x00, 0xfb, 0xfe, 0x07, 0xff, 0x1c, 0xfe, 0xae, 0xfc, 0x97, 0xfc, 
-0xb2, 0xfa, 0x2a, 0xfa, 0x63, 0xf9, 0xcd, 0xf7, 0x70, 0xf8, 0xfa, 0xf6, 0x9a, 0xf7, 0xc6, 0xf7, 
-0xaa, 0xf7, 0x1a, 0xf9, 0x22, 0xf9, 0x71, 0xfa, 0xb3, 0xfb, 0x62, 0xfc, 0x39, 0xfe, 0x94, 0xff, 
-0x8d, 0x00, 0x55, 0x02, 0xe6, 0x02, 0xe2, 0x03, 0x4b, 0x04, 0xd3, 0x04, 0x25, 0x05, 0x3b, 0x05, 
-0x88, 0x05, 0x52, 0x05, 0x9a, 0x05, 0x31, 0x05, 0x4b, 0x05, 0xe0, 0x04, 0x86, 0x04, 0x8a, 0x04, 
-0x08, 0x04, 0x58, 0x04, 0x32, 0x04, 0xb3, 0x03, 0x41, 0x04, 0xd3, 0x02, 0x06, 0x03, 0x78, 0x02, 
-0xba, 0x00, 0xb0, 0x01, 0x86, 0xff, 0x79, 0xff, 0x72, 0xff, 0x79, 0xfd, 0x0f, 0xfe, 0xa4, 0xfc, 
-0x94, 0xfb, 0xaf, 0xfb, 0x44, 0xfa, 0x65, 0xfa, 0x3a, 0xfa, 0xc8, 0xf9, 0x52, 0xfa, 0x44, 0xfa, 
-0xcc, 0xfa, 0x0c, 0xfb, 0x47, 0xfb, 0xd2, 0xfb, 0xe3, 0xfb, 0x94, 0xfc, 0x41, 0xfd, 0x93, 0xfd, 
-0x02, 0xff, 0x67, 0xff, 0x5f, 0x00, 0xba, 0x01, 0x49, 0x01, 0xce, 0x02, 0x9f, 0x02, 0x43, 0x02, 
-0xb5, 0x03, 0x64, 0x02, 0xa7, 0x03, 0xd0, 0x03, 0x51, 0x03, 0xf0, 0x04, 0xc1, 0x03, 0x92, 0x04, 
-0x59, 0x04, 0x9e, 0x03, 0x02, 0x04, 0x8a, 0x03, 0x71, 0x03, 0x8e, 0x03, 0xa3, 0x03, 0xdc, 0x02, 
-0x7e, 0x03, 0x53, 0x02, 0xdf, 0x01, 0x0e, 0x02, 0x29, 0x00, 0xae, 0x00, 0x8c, 0xff, 0x8f, 0xfe, 
-0xfc, 0xfe, 0x3e, 0xfd, 0x4e, 0xfd, 0xb0, 0xfc, 0x8c, 0xfb, 0xd0, 0xfb, 0xfb, 0xfa, 0x32, 0xfb, 
-0x34, 0xfb, 0x36, 0xfb, 0xa5, 0xfb, 0x86, 0xfb, 0x1f, 0xfc, 0x1e, 0xfc, 0x8c, 0xfc, 0x08, 0xfd, 
-0x35, 0xfd, 0x1a, 0xfe, 0x7c, 0xfe, 0x53, 0xff, 0x01, 0x00, 0xa1, 0x00, 0x3d, 0x01, 0xa1, 0x01, 
-0x13, 0x02, 0x20, 0x02, 0x85, 0x02, 0x4d, 0x02, 0x77, 0x02, 0x94, 0x02, 0x28, 0x02, 0x99, 0x02, 
-0x2d, 0x02, 0x35, 0x02, 0x81, 0x02, 0xf2, 0x01, 0x93, 0x02, 0x44, 0x02, 0x4b, 0x02, 0x9e, 0x02, 
-0x2c, 0x02, 0x79, 0x02, 0x3b, 0x02, 0x35, 0x02, 0xf2, 0x01, 0xfe, 0x01, 0x82, 0x01, 0x62, 0x01, 
-0x41, 0x01, 0x3a, 0x00, 0xa2, 0x00, 0x65, 0xff, 0x22, 0xff, 0xe4, 0xfe, 0x90, 0xfd, 0xfa, 0xfd, 
-0x13, 0xfd, 0xd7, 0xfc, 0xf5, 0xfc, 0x6e, 0xfc, 0xb0, 0xfc, 0xc9, 0xfc, 0xc6, 0xfc, 0x29, 0xfd, 
-0x52, 0xfd, 0x40, 0xfd, 0xd3, 0xfd, 0xcd, 0xfd, 0x40, 0xfe, 0xc6, 0xfe, 0xe3, 0xfe, 0x9b, 0xff, 
-0xb9, 0xff, 0x53, 0x00, 0xb4, 0x00, 0xe7, 0x00, 0x6b, 0x01, 0x3a, 0x01, 0x9e, 0x01, 0x89, 0x01, 
-0x7b, 0x01, 0xc3, 0x01, 0x39, 0x01, 0x97, 0x01, 0x66, 0x01, 0x39, 0x01, 0xd4, 0x01, 0x3d, 0x01, 
-0xa8, 0x01, 0x97, 0x01, 0x0c, 0x01, 0x95, 0x01, 0xe1, 0x00, 0xf0, 0x00, 0x1c, 0x01, 0x8f, 0x00, 
-0x2c, 0x01, 0xce, 0x00, 0xbf, 0x00, 0xfc, 0x00, 0x4d, 0x00, 0xba, 0x00, 0x2e, 0x00, 0x1e, 0x00, 
-0x31, 0x00, 0x65, 0xff, 0xcf, 0xff, 0x13, 0xff, 0x16, 0xff, 0xf3, 0xfe, 0x47, 0xfe, 0x9d, 0xfe, 
-0xe6, 0xfd, 0xfc, 0xfd, 0xce, 0xfd, 0x81, 0xfd, 0xaa, 0xfd, 0x92, 0xfd, 0xf2, 0xfd, 0x48, 0xfe, 
-0xf3, 0xfe, 0x61, 0xff, 0xe3, 0xff, 0x32, 0x00, 0x4f, 0x00, 0x8a, 0x00, 0x60, 0x00, 0x82, 0x00, 
-0x92, 0x00, 0xa3, 0x00, 0xef, 0x00, 0x05, 0x01, 0x11, 0x01, 0x0d, 0x01, 0xdc, 0x00, 0xb2, 0x00, 
-0x73, 0x00, 0x67, 0x00, 0x25, 0x00, 0x36, 0x00, 0x53, 0x00, 0x20, 0x00, 0xad, 0x00, 0x66, 0x00, 
-0xb1, 0x00, 0xf2, 0x00, 0xa8, 0x00, 0x4a, 0x01, 0xfc, 0x00, 0x1c, 0x01, 0x4c, 0x01, 0xdd, 0x00, 
-0x10, 0x01, 0xd1, 0x00, 0x8a, 0x00, 0x9c, 0x00, 0x28, 0x00, 0xe8, 0xff, 0xc3, 0xff, 0x3d, 0xff, 
-0x34, 0xff, 0xee, 0xfe, 0xb4, 0xfe, 0xe5, 0xfe, 0xae, 0xfe, 0xd5, 0xfe, 0xff, 0xfe, 0xf1, 0xfe, 
-0x40, 0xff, 0x65, 0xff, 0x86, 0xff, 0xe4, 0xff, 0xf2, 0xff, 0x1b, 0x00, 0x2f, 0x00, 0x1d, 0x00, 
-0x2a, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x11, 0x00, 0x12, 0x00, 0x02, 0x00, 
-0xf4, 0xff, 0xe8, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xd5, 0xff, 0xed, 0xff, 0xe3, 0xff, 0xf6, 0xff, 
-0xf3, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xf1, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0x05, 0x00, 0x00, 0x00, 
-0x0f, 0x00, 0x07, 0x00, 0x11, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x15, 0x00, 0xfd, 0xff, 0x0a, 0x00, 
-0xfc, 0xff, 0xf4, 0xff, 0x05, 0x00, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf2, 0xff, 0x00, 0x00, 
-0xfd, 0xff, 0xf5, 0xff, 0x05, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00, 
-0x0e, 0x00, 0x04, 0x00, 0x08, 0x00, 0x09, 0x00, 0xfc, 0xff, 0x08, 0x00, 0x02, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0xfc, 0xff, 0x01, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0xff, 0xff, 0x06, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x0d, 0x00, 
-0x09, 0x00, 0x01, 0x00, 0x02, 0x00, 0xfa, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x01, 0x00, 
-0x03, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x04, 0x00, 
-0x03, 0x00, 
-};
-
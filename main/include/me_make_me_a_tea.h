@@ -1,997 +0,0 @@
-#include <stdio.h>
-const unsigned char me_make_me_a_tea[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 
-0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0xff, 0xff, 
-0xfe, 0xff, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xfe, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 
-0x02, 0x00, 0x03, 0x00, 0xfd, 0xff, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfe, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x03, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x06, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 
-0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x03, 0x00, 0xfe, 0xff, 0x03, 0x00, 
-0x04, 0x00, 0xff, 0xff, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0xfd, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfb, 0xff, 0xfb, 0xff, 
-0xfa, 0xff, 0xfe, 0xff, 0x01, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0f, 0x00, 
-0x0d, 0x00, 0x09, 0x00, 0x12, 0x00, 0x14, 0x00, 0x13, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 
-0x11, 0x00, 0x11, 0x00, 0x08, 0x00, 0xfc, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xec, 0xff, 0xdc, 0xff, 
-0xdd, 0xff, 0xe2, 0xff, 0xd8, 0xff, 0xcd, 0xff, 0xc8, 0xff, 0xcd, 0xff, 0xd9, 0xff, 0xd7, 0xff, 
-0xda, 0xff, 0xde, 0xff, 0xed, 0xff, 0x12, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x21, 0x00, 0x33, 0x00, 
-0x47, 0x00, 0x46, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x51, 0x00, 0x45, 0x00, 0x33, 0x00, 
-0x35, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0xec, 0xff, 0xd2, 0xff, 0xc9, 0xff, 0xad, 0xff, 0x7b, 0xff, 
-0x6b, 0xff, 0x5d, 0xff, 0x57, 0xff, 0x5d, 0xff, 0x4e, 0xff, 0x5b, 0xff, 0x87, 0xff, 0xab, 0xff, 
-0xd4, 0xff, 0xf1, 0xff, 0x25, 0x00, 0x81, 0x00, 0xa7, 0x00, 0xb0, 0x00, 0xe1, 0x00, 0xfb, 0x00, 
-0xff, 0x00, 0x01, 0x01, 0xd9, 0x00, 0xb4, 0x00, 0xa3, 0x00, 0x6b, 0x00, 0x29, 0x00, 0xfd, 0xff, 
-0xca, 0xff, 0xa2, 0xff, 0x86, 0xff, 0x62, 0xff, 0x46, 0xff, 0x4b, 0xff, 0x51, 0xff, 0x3d, 0xff, 
-0x37, 0xff, 0x41, 0xff, 0x5a, 0xff, 0x80, 0xff, 0x81, 0xff, 0x8a, 0xff, 0xc4, 0xff, 0xfd, 0xff, 
-0x25, 0x00, 0x32, 0x00, 0x3a, 0x00, 0x69, 0x00, 0x94, 0x00, 0x96, 0x00, 0x8f, 0x00, 0x95, 0x00, 
-0xb5, 0x00, 0xc0, 0x00, 0xac, 0x00, 0x95, 0x00, 0x8a, 0x00, 0x95, 0x00, 0x92, 0x00, 0x6a, 0x00, 
-0x4f, 0x00, 0x56, 0x00, 0x53, 0x00, 0x2b, 0x00, 0xf3, 0xff, 0xd4, 0xff, 0xc1, 0xff, 0x9c, 0xff, 
-0x5a, 0xff, 0x1e, 0xff, 0x06, 0xff, 0xde, 0xfe, 0xa3, 0xfe, 0x6b, 0xfe, 0x2c, 0xfe, 0xfe, 0xfd, 
-0xdb, 0xfd, 0xbb, 0xfd, 0xb6, 0xfd, 0xba, 0xfd, 0xe7, 0xfd, 0x3a, 0xfe, 0x7d, 0xfe, 0xd6, 0xfe, 
-0x56, 0xff, 0xd0, 0xff, 0x53, 0x00, 0xf2, 0x00, 0x8c, 0x01, 0x1e, 0x02, 0xad, 0x02, 0x13, 0x03, 
-0x63, 0x03, 0xac, 0x03, 0xd4, 0x03, 0xdc, 0x03, 0xc0, 0x03, 0x8f, 0x03, 0x5b, 0x03, 0x0a, 0x03, 
-0x8e, 0x02, 0xf8, 0x01, 0x67, 0x01, 0xdb, 0x00, 0x3a, 0x00, 0x91, 0xff, 0xd7, 0xfe, 0x06, 0xfe, 
-0x4b, 0xfd, 0x6c, 0xfc, 0x5a, 0xfb, 0x79, 0xfa, 0x94, 0xf9, 0xa0, 0xf8, 0xf2, 0xf7, 0x50, 0xf7, 
-0xe9, 0xf6, 0xed, 0xf6, 0x03, 0xf7, 0xa4, 0xf7, 0xd6, 0xf8, 0x31, 0xfa, 0x36, 0xfc, 0x94, 0xfe, 
-0x0b, 0x01, 0x0b, 0x04, 0xef, 0x06, 0x82, 0x09, 0x09, 0x0c, 0x25, 0x0e, 0xb2, 0x0f, 0x9f, 0x10, 
-0xdb, 0x10, 0x8b, 0x10, 0xaa, 0x0f, 0x20, 0x0e, 0xf9, 0x0b, 0x80, 0x09, 0xe5, 0x06, 0x0c, 0x04, 
-0x0a, 0x01, 0x1c, 0xfe, 0x6e, 0xfb, 0x00, 0xf9, 0xc2, 0xf6, 0xa9, 0xf4, 0xfb, 0xf2, 0xec, 0xf1, 
-0x00, 0xf1, 0x2e, 0xf0, 0xdb, 0xef, 0xc5, 0xef, 0xdd, 0xef, 0x2d, 0xf0, 0x79, 0xf0, 0x33, 0xf1, 
-0xe3, 0xf2, 0x12, 0xf5, 0x73, 0xf7, 0x79, 0xfa, 0x1f, 0xfe, 0x2d, 0x02, 0x47, 0x06, 0xc6, 0x09, 
-0xf9, 0x0c, 0x3c, 0x10, 0xd6, 0x12, 0x66, 0x14, 0x1b, 0x15, 0x09, 0x15, 0x65, 0x14, 0x0c, 0x13, 
-0x9f, 0x10, 0xa8, 0x0d, 0xd5, 0x0a, 0xd0, 0x07, 0xce, 0x04, 0x14, 0x02, 0x67, 0xff, 0x63, 0xfd, 
-0xe4, 0xfb, 0x6b, 0xfa, 0x7e, 0xf9, 0xfe, 0xf8, 0xc4, 0xf8, 0x01, 0xf9, 0x08, 0xf9, 0xc8, 0xf8, 
-0xff, 0xf8, 0x42, 0xf9, 0xac, 0xf8, 0xbb, 0xf7, 0xbd, 0xf6, 0x7b, 0xf5, 0x65, 0xf4, 0xdd, 0xf2, 
-0x0f, 0xf1, 0xbe, 0xf0, 0x3b, 0xf1, 0xc2, 0xf1, 0x73, 0xf3, 0x35, 0xf6, 0xe3, 0xf9, 0x44, 0xfe, 
-0xea, 0x01, 0x86, 0x05, 0x04, 0x0a, 0xb7, 0x0d, 0x53, 0x10, 0x51, 0x12, 0x26, 0x13, 0x9d, 0x13, 
-0x64, 0x13, 0x9a, 0x11, 0x68, 0x0f, 0xf9, 0x0c, 0x5f, 0x0a, 0x28, 0x08, 0xa1, 0x05, 0x41, 0x03, 
-0x86, 0x01, 0xe8, 0xff, 0x8d, 0xfe, 0x3b, 0xfd, 0x1e, 0xfc, 0xd7, 0xfb, 0x94, 0xfb, 0x21, 0xfb, 
-0xe5, 0xfa, 0x74, 0xfa, 0x2e, 0xfa, 0xdb, 0xf9, 0x6e, 0xf8, 0xfa, 0xf6, 0xc5, 0xf5, 0xf2, 0xf3, 
-0x2e, 0xf2, 0x1b, 0xf0, 0x38, 0xee, 0x04, 0xee, 0x30, 0xee, 0xbb, 0xee, 0xf7, 0xf0, 0x6c, 0xf4, 
-0xf4, 0xf8, 0xbf, 0xfd, 0x10, 0x02, 0xe1, 0x06, 0xf7, 0x0b, 0x17, 0x10, 0x0f, 0x13, 0x0b, 0x15, 
-0x36, 0x16, 0xb1, 0x16, 0xf7, 0x15, 0xe2, 0x13, 0x5c, 0x11, 0xe4, 0x0e, 0x44, 0x0c, 0x85, 0x09, 
-0xc0, 0x06, 0x62, 0x04, 0x96, 0x02, 0xe4, 0x00, 0x2c, 0xff, 0xef, 0xfd, 0x44, 0xfd, 0xc0, 0xfc, 
-0x54, 0xfc, 0xfb, 0xfb, 0xba, 0xfb, 0x95, 0xfb, 0x00, 0xfb, 0x2e, 0xfa, 0x56, 0xf9, 0xe4, 0xf7, 
-0x18, 0xf6, 0x3c, 0xf4, 0xf5, 0xf1, 0x7b, 0xef, 0x40, 0xed, 0xa7, 0xeb, 0x1a, 0xeb, 0x84, 0xeb, 
-0xdd, 0xec, 0xe6, 0xef, 0x61, 0xf4, 0x2b, 0xf9, 0x43, 0xfe, 0x88, 0x03, 0xcb, 0x08, 0xdc, 0x0d, 
-0xbb, 0x11, 0x96, 0x14, 0xb4, 0x16, 0x98, 0x17, 0x96, 0x17, 0x61, 0x16, 0xf7, 0x13, 0x4f, 0x11, 
-0x9b, 0x0e, 0xa3, 0x0b, 0x9d, 0x08, 0xe4, 0x05, 0x9d, 0x03, 0xa0, 0x01, 0xc8, 0xff, 0x0c, 0xfe, 
-0x11, 0xfd, 0xb4, 0xfc, 0x50, 0xfc, 0x31, 0xfc, 0x2b, 0xfc, 0x1b, 0xfc, 0x2a, 0xfc, 0x7d, 0xfb, 
-0x6f, 0xfa, 0xa3, 0xf9, 0x17, 0xf8, 0x27, 0xf6, 0x42, 0xf4, 0x82, 0xf1, 0xec, 0xee, 0xba, 0xec, 
-0x75, 0xea, 0xd1, 0xe9, 0x45, 0xea, 0x6e, 0xeb, 0xfe, 0xee, 0x7a, 0xf3, 0x45, 0xf8, 0xf4, 0xfd, 
-0x19, 0x03, 0x96, 0x08, 0x44, 0x0e, 0x04, 0x12, 0xf5, 0x14, 0x78, 0x17, 0x4a, 0x18, 0x24, 0x18, 
-0xa5, 0x16, 0xa7, 0x13, 0x30, 0x11, 0x99, 0x0e, 0xf6, 0x0a, 0x11, 0x08, 0xb6, 0x05, 0x79, 0x03, 
-0xda, 0x01, 0xce, 0xff, 0x2c, 0xfe, 0xdf, 0xfd, 0x8d, 0xfd, 0x4b, 0xfd, 0x38, 0xfd, 0x07, 0xfd, 
-0x5f, 0xfd, 0x75, 0xfd, 0x7f, 0xfc, 0x83, 0xfb, 0xc9, 0xfa, 0x5b, 0xf9, 0x55, 0xf7, 0xd8, 0xf4, 
-0xcc, 0xf1, 0xf8, 0xee, 0x23, 0xec, 0x7b, 0xe9, 0x7a, 0xe8, 0xa4, 0xe8, 0xfd, 0xe9, 0x80, 0xed, 
-0x33, 0xf2, 0x7f, 0xf7, 0x9b, 0xfd, 0x97, 0x03, 0x84, 0x09, 0x50, 0x0f, 0xcf, 0x13, 0x45, 0x17, 
-0xc7, 0x19, 0x89, 0x1a, 0x60, 0x1a, 0x26, 0x19, 0x48, 0x16, 0xff, 0x12, 0xc6, 0x0f, 0x5b, 0x0c, 
-0xdd, 0x08, 0xc8, 0x05, 0x6d, 0x03, 0x54, 0x01, 0x91, 0xff, 0xfd, 0xfd, 0xd2, 0xfc, 0xda, 0xfc, 
-0x9c, 0xfc, 0x0d, 0xfc, 0x3b, 0xfc, 0x46, 0xfc, 0x63, 0xfc, 0x3d, 0xfc, 0xf3, 0xfa, 0x12, 0xfa, 
-0x10, 0xf9, 0xdc, 0xf6, 0x7d, 0xf4, 0x9a, 0xf1, 0x62, 0xee, 0xf1, 0xeb, 0x55, 0xe9, 0x82, 0xe7, 
-0xad, 0xe7, 0x98, 0xe8, 0x50, 0xeb, 0xf2, 0xef, 0xbc, 0xf4, 0xc2, 0xfa, 0x2b, 0x01, 0xda, 0x06, 
-0xed, 0x0c, 0xe4, 0x11, 0x99, 0x15, 0xe6, 0x18, 0x2a, 0x1a, 0x37, 0x1a, 0x9b, 0x19, 0x12, 0x17, 
-0xe6, 0x13, 0x8a, 0x10, 0x90, 0x0c, 0x2a, 0x09, 0x26, 0x06, 0x53, 0x03, 0x6e, 0x01, 0xe7, 0xff, 
-0xb8, 0xfe, 0x28, 0xfe, 0xc7, 0xfd, 0xcc, 0xfd, 0x09, 0xfe, 0x03, 0xfe, 0x28, 0xfe, 0x42, 0xfe, 
-0xee, 0xfd, 0x2d, 0xfd, 0x10, 0xfc, 0x80, 0xfa, 0x48, 0xf8, 0xe9, 0xf5, 0x11, 0xf3, 0x7f, 0xef, 
-0x38, 0xec, 0x25, 0xe9, 0x02, 0xe7, 0x7a, 0xe6, 0x80, 0xe6, 0x4c, 0xe8, 0x8b, 0xec, 0x8c, 0xf1, 
-0x2e, 0xf7, 0x83, 0xfd, 0xd1, 0x03, 0x4c, 0x0a, 0x51, 0x10, 0xc7, 0x14, 0x3c, 0x18, 0xbd, 0x1a, 
-0xc5, 0x1b, 0x7f, 0x1b, 0xa0, 0x19, 0x95, 0x16, 0x53, 0x13, 0xc5, 0x0f, 0xf0, 0x0b, 0x50, 0x08, 
-0x2f, 0x05, 0xc9, 0x02, 0xe0, 0x00, 0x48, 0xff, 0x31, 0xfe, 0x97, 0xfd, 0x73, 0xfd, 0x83, 0xfd, 
-0x65, 0xfd, 0x6f, 0xfd, 0xe2, 0xfd, 0x03, 0xfe, 0x7e, 0xfd, 0xde, 0xfc, 0xf9, 0xfb, 0x70, 0xfa, 
-0x87, 0xf8, 0xd5, 0xf5, 0x6e, 0xf2, 0x15, 0xef, 0xb1, 0xeb, 0x8b, 0xe8, 0x0f, 0xe7, 0x03, 0xe7, 
-0xc7, 0xe7, 0xbc, 0xea, 0x80, 0xef, 0xca, 0xf4, 0x18, 0xfb, 0x6c, 0x01, 0x8b, 0x07, 0x16, 0x0e, 
-0x51, 0x13, 0xc1, 0x16, 0x6e, 0x19, 0xfe, 0x1a, 0xef, 0x1a, 0x9b, 0x19, 0xed, 0x16, 0x4b, 0x13, 
-0xe9, 0x0f, 0x86, 0x0c, 0xcf, 0x08, 0x9f, 0x05, 0x1f, 0x03, 0x47, 0x01, 0x01, 0x00, 0xbe, 0xfe, 
-0xbc, 0xfd, 0x8d, 0xfd, 0x9c, 0xfd, 0x64, 0xfd, 0x20, 0xfd, 0x04, 0xfd, 0xdc, 0xfc, 0x8f, 0xfc, 
-0xc4, 0xfb, 0x52, 0xfa, 0xbc, 0xf8, 0xec, 0xf6, 0x48, 0xf4, 0xf1, 0xf0, 0x73, 0xed, 0x5e, 0xea, 
-0xad, 0xe7, 0xfa, 0xe5, 0xd1, 0xe5, 0x00, 0xe7, 0xe8, 0xe9, 0x4c, 0xee, 0x95, 0xf3, 0xcf, 0xf9, 
-0x5a, 0x00, 0xcd, 0x06, 0x43, 0x0d, 0xe8, 0x12, 0x07, 0x17, 0x15, 0x1a, 0xca, 0x1b, 0xdf, 0x1b, 
-0xdd, 0x1a, 0x59, 0x18, 0xd6, 0x14, 0x3d, 0x11, 0x74, 0x0d, 0x14, 0x0a, 0x42, 0x07, 0x86, 0x04, 
-0x5a, 0x02, 0xdf, 0x00, 0xb4, 0xff, 0xb7, 0xfe, 0x09, 0xfe, 0x9f, 0xfd, 0x4d, 0xfd, 0xfa, 0xfc, 
-0x94, 0xfc, 0x26, 0xfc, 0xd7, 0xfb, 0x2a, 0xfb, 0xe1, 0xf9, 0x40, 0xf8, 0x52, 0xf6, 0xe1, 0xf3, 
-0xc2, 0xf0, 0x6d, 0xed, 0x1e, 0xea, 0x87, 0xe7, 0xd6, 0xe6, 0xfc, 0xe6, 0x2a, 0xe8, 0xc5, 0xeb, 
-0xac, 0xf0, 0xa9, 0xf6, 0x60, 0xfd, 0x8c, 0x03, 0x67, 0x0a, 0x84, 0x11, 0x97, 0x16, 0x40, 0x1a, 
-0xf0, 0x1c, 0x0b, 0x1e, 0x3a, 0x1e, 0x8b, 0x1c, 0x9a, 0x18, 0xbf, 0x14, 0xb8, 0x10, 0x12, 0x0c, 
-0xe8, 0x07, 0xd5, 0x03, 0x6f, 0x00, 0x3c, 0xfe, 0x1c, 0xfc, 0x6f, 0xfa, 0xba, 0xf9, 0x68, 0xf9, 
-0xa4, 0xf9, 0xdf, 0xf9, 0x0d, 0xfa, 0xcc, 0xfa, 0x76, 0xfb, 0xe7, 0xfb, 0xd1, 0xfb, 0xfd, 0xfa, 
-0x2b, 0xfa, 0x99, 0xf8, 0xd9, 0xf5, 0xbe, 0xf2, 0x62, 0xef, 0x13, 0xec, 0x0e, 0xea, 0x35, 0xe9, 
-0x52, 0xe9, 0x41, 0xeb, 0xd7, 0xee, 0xd8, 0xf3, 0x99, 0xf9, 0x2d, 0xff, 0x25, 0x05, 0x8c, 0x0b, 
-0x0e, 0x11, 0x24, 0x15, 0x6e, 0x18, 0xb7, 0x1a, 0xb4, 0x1b, 0x9c, 0x1b, 0xb7, 0x19, 0x6b, 0x16, 
-0xef, 0x12, 0xe2, 0x0e, 0x83, 0x0a, 0x65, 0x06, 0x8e, 0x02, 0x5f, 0xff, 0xe0, 0xfc, 0xec, 0xfa, 
-0x91, 0xf9, 0xf9, 0xf8, 0xe1, 0xf8, 0xfd, 0xf8, 0x3e, 0xf9, 0xbf, 0xf9, 0x89, 0xfa, 0x1b, 0xfb, 
-0x69, 0xfb, 0x5e, 0xfb, 0x9c, 0xfa, 0x34, 0xf9, 0x3c, 0xf7, 0x2e, 0xf4, 0x70, 0xf0, 0xf8, 0xec, 
-0xe7, 0xe9, 0x28, 0xe8, 0x34, 0xe8, 0x4e, 0xe9, 0x05, 0xec, 0xf4, 0xf0, 0xdf, 0xf6, 0xe0, 0xfc, 
-0x57, 0x03, 0xc4, 0x09, 0xc9, 0x0f, 0x84, 0x15, 0x9f, 0x19, 0x17, 0x1c, 0x98, 0x1d, 0x0d, 0x1e, 
-0xa2, 0x1c, 0x68, 0x19, 0xb9, 0x15, 0x4a, 0x11, 0x7a, 0x0c, 0x74, 0x08, 0x51, 0x04, 0x4c, 0x00, 
-0xb0, 0xfd, 0xb4, 0xfb, 0x2a, 0xfa, 0x6b, 0xf9, 0x04, 0xf9, 0x1c, 0xf9, 0x99, 0xf9, 0xf2, 0xf9, 
-0x6b, 0xfa, 0x38, 0xfb, 0x8b, 0xfb, 0x9b, 0xfb, 0x53, 0xfb, 0x0a, 0xfa, 0x69, 0xf8, 0x44, 0xf6, 
-0x18, 0xf3, 0xb5, 0xef, 0x60, 0xec, 0x18, 0xea, 0x9e, 0xe9, 0xe7, 0xe9, 0xa0, 0xeb, 0x36, 0xef, 
-0x85, 0xf4, 0xa7, 0xfa, 0x6d, 0x00, 0x84, 0x06, 0xfc, 0x0c, 0xdd, 0x12, 0x76, 0x17, 0x91, 0x1a, 
-0x77, 0x1c, 0x44, 0x1d, 0x81, 0x1c, 0xce, 0x19, 0xe3, 0x15, 0xb2, 0x11, 0x47, 0x0d, 0xef, 0x08, 
-0xda, 0x04, 0xec, 0x00, 0xfa, 0xfd, 0x31, 0xfc, 0x6a, 0xfa, 0x53, 0xf9, 0x02, 0xf9, 0xdf, 0xf8, 
-0x46, 0xf9, 0x9f, 0xf9, 0x0a, 0xfa, 0xb5, 0xfa, 0x35, 0xfb, 0x5b, 0xfb, 0xfc, 0xfa, 0xfa, 0xf9, 
-0x57, 0xf8, 0x39, 0xf6, 0x29, 0xf3, 0x86, 0xef, 0xd2, 0xeb, 0xc4, 0xe8, 0xb5, 0xe7, 0x9c, 0xe7, 
-0x00, 0xe8, 0x17, 0xeb, 0x82, 0xf0, 0xba, 0xf6, 0x17, 0xfd, 0x7d, 0x03, 0xb9, 0x0a, 0xc4, 0x11, 
-0x23, 0x17, 0xf5, 0x1a, 0x3b, 0x1d, 0x0e, 0x1e, 0x00, 0x1e, 0xe7, 0x1b, 0x8c, 0x17, 0xe8, 0x12, 
-0x50, 0x0e, 0xd4, 0x09, 0x19, 0x05, 0x61, 0x00, 0x15, 0xfd, 0x27, 0xfb, 0xce, 0xf9, 0xde, 0xf8, 
-0xb8, 0xf8, 0x26, 0xf9, 0x65, 0xfa, 0xd2, 0xfb, 0x3e, 0xfc, 0xcc, 0xfc, 0xc4, 0xfd, 0x4b, 0xfe, 
-0x96, 0xfd, 0xb8, 0xfb, 0xb2, 0xf9, 0x1b, 0xf7, 0xe4, 0xf3, 0x87, 0xf0, 0x3e, 0xec, 0x62, 0xe8, 
-0xec, 0xe7, 0x2a, 0xe8, 0x69, 0xe8, 0x33, 0xeb, 0x2c, 0xf0, 0x9a, 0xf6, 0x2d, 0xfd, 0x1f, 0x03, 
-0xab, 0x09, 0x12, 0x10, 0xf3, 0x15, 0x3d, 0x1a, 0x8d, 0x1c, 0xd8, 0x1d, 0xd7, 0x1d, 0x36, 0x1d, 
-0x5e, 0x1a, 0x07, 0x15, 0x43, 0x10, 0xd0, 0x0b, 0xc4, 0x06, 0x87, 0x02, 0x2a, 0xfe, 0x25, 0xfb, 
-0x1d, 0xfa, 0x3b, 0xf9, 0x24, 0xf9, 0x1f, 0xf9, 0x56, 0xf9, 0x07, 0xfb, 0x8b, 0xfc, 0xc8, 0xfc, 
-0x80, 0xfd, 0xdc, 0xfe, 0xe9, 0xfe, 0x31, 0xfe, 0xa1, 0xfc, 0x19, 0xfa, 0xed, 0xf6, 0xd2, 0xf3, 
-0x41, 0xf0, 0x1d, 0xeb, 0xf1, 0xe7, 0xff, 0xe7, 0xa0, 0xe7, 0x53, 0xe8, 0x58, 0xec, 0x8e, 0xf1, 
-0x39, 0xf8, 0xff, 0xfe, 0xd8, 0x04, 0xd9, 0x0a, 0xd1, 0x10, 0x2a, 0x16, 0x41, 0x19, 0x38, 0x1b, 
-0xe7, 0x1b, 0x3b, 0x1b, 0x87, 0x19, 0x3f, 0x15, 0x74, 0x10, 0x5d, 0x0b, 0x7d, 0x06, 0xa9, 0x02, 
-0x45, 0xfe, 0xcb, 0xfa, 0x90, 0xf9, 0xa1, 0xf8, 0x16, 0xf8, 0x17, 0xf9, 0xa2, 0xf9, 0x83, 0xf9, 
-0x04, 0xfc, 0xa8, 0xfe, 0xe3, 0xfe, 0x18, 0xff, 0x38, 0xff, 0xb4, 0xfe, 0x64, 0xfd, 0x70, 0xf9, 
-0xbc, 0xf3, 0x77, 0xee, 0xc8, 0xe8, 0xdf, 0xe2, 0x05, 0xe1, 0xec, 0xe5, 0x8c, 0xea, 0x70, 0xed, 
-0xe8, 0xf4, 0x2a, 0xff, 0x8d, 0x07, 0x81, 0x0e, 0xff, 0x13, 0xe4, 0x19, 0x27, 0x1e, 0x78, 0x1c, 
-0xbb, 0x19, 0xec, 0x17, 0x89, 0x14, 0x00, 0x0f, 0xa7, 0x07, 0x9b, 0x01, 0x95, 0xfd, 0x74, 0xf8, 
-0x46, 0xf3, 0xfc, 0xf4, 0x56, 0xf8, 0xc7, 0xf8, 0x49, 0xfc, 0x1a, 0x03, 0x5c, 0x09, 0x52, 0x0c, 
-0x27, 0x0e, 0x8a, 0x11, 0x94, 0x11, 0x0a, 0x0e, 0x81, 0x09, 0xde, 0x04, 0xea, 0x00, 0xde, 0xf8, 
-0x0d, 0xf1, 0xb1, 0xeb, 0x21, 0xe0, 0x56, 0xd9, 0x03, 0xd6, 0xe9, 0xd1, 0xde, 0xd2, 0x40, 0xe2, 
-0x82, 0xf3, 0xd5, 0xf8, 0x7f, 0x08, 0x58, 0x19, 0x5d, 0x1e, 0x3d, 0x20, 0xa4, 0x21, 0x14, 0x21, 
-0xb5, 0x19, 0x69, 0x0f, 0x73, 0x0c, 0x54, 0x08, 0x03, 0x00, 0xc3, 0xfd, 0xd1, 0xfd, 0x75, 0xf9, 
-0x0d, 0xf7, 0x13, 0xf6, 0xe0, 0xf8, 0xd8, 0xf9, 0x0e, 0xf8, 0x1c, 0x02, 0xbd, 0x05, 0x1a, 0x07, 
-0x6d, 0x11, 0x21, 0x13, 0x78, 0x12, 0xfb, 0x12, 0x8e, 0x12, 0xd6, 0x0f, 0xef, 0x07, 0x17, 0x02, 
-0xc6, 0xfd, 0xa4, 0xf6, 0x22, 0xee, 0xf3, 0xe7, 0x76, 0xe2, 0x84, 0xd6, 0x5d, 0xd1, 0x91, 0xd5, 
-0x7d, 0xd3, 0x0f, 0xd7, 0x36, 0xf4, 0xf2, 0x01, 0x6b, 0x04, 0x44, 0x1f, 0xf9, 0x25, 0x58, 0x20, 
-0x5c, 0x25, 0xff, 0x20, 0x0a, 0x17, 0xa7, 0x0a, 0x50, 0x07, 0xaf, 0x04, 0x88, 0xf9, 0xae, 0xf9, 
-0x8d, 0xfb, 0xc6, 0xf6, 0x5f, 0xf7, 0x9d, 0xf8, 0x5e, 0xfa, 0x3d, 0xfb, 0x6b, 0xf9, 0x74, 0x00, 
-0xc5, 0x06, 0x1d, 0x08, 0x30, 0x0e, 0x13, 0x14, 0x77, 0x12, 0xb8, 0x12, 0x16, 0x13, 0x67, 0x0e, 
-0xed, 0x08, 0xe5, 0x04, 0x73, 0xfd, 0xe4, 0xf4, 0xa9, 0xf0, 0x1b, 0xea, 0xf5, 0xe2, 0x21, 0xdb, 
-0xd2, 0xd6, 0xc3, 0xd7, 0x9b, 0xda, 0xfa, 0xdb, 0xbc, 0xef, 0x07, 0x05, 0xbc, 0x05, 0x40, 0x17, 
-0x2e, 0x25, 0x81, 0x1e, 0x2c, 0x1f, 0xa8, 0x1f, 0xcc, 0x15, 0x35, 0x0a, 0x95, 0x06, 0x48, 0x03, 
-0xdc, 0xf8, 0x7c, 0xfb, 0xf9, 0xfc, 0x0f, 0xf8, 0x6c, 0xfb, 0x27, 0xfd, 0x84, 0xfc, 0x0c, 0xf9, 
-0xf4, 0xfb, 0xcc, 0xfd, 0x0c, 0xfc, 0x55, 0x09, 0x7d, 0x0a, 0xbc, 0x0a, 0xd1, 0x15, 0xc3, 0x13, 
-0x2f, 0x14, 0x64, 0x12, 0x73, 0x0e, 0x35, 0x07, 0xf2, 0xfe, 0x27, 0xfd, 0x53, 0xf1, 0x61, 0xeb, 
-0xf3, 0xe8, 0xba, 0xe1, 0x29, 0xdb, 0xd1, 0xd8, 0xfd, 0xde, 0xb8, 0xd7, 0x49, 0xea, 0x51, 0x01, 
-0x7f, 0xfb, 0x46, 0x11, 0xa0, 0x1f, 0xfc, 0x1a, 0xde, 0x1f, 0xe0, 0x1e, 0x21, 0x18, 0xfc, 0x0a, 
-0xbb, 0x07, 0x0f, 0x05, 0x3a, 0xf7, 0x4b, 0xfc, 0x5a, 0xfe, 0x03, 0xf9, 0x5a, 0xfd, 0xca, 0xfe, 
-0xd0, 0xfd, 0x76, 0xfb, 0xeb, 0xff, 0xdf, 0xff, 0xc7, 0xfb, 0xf7, 0x06, 0x52, 0x09, 0x38, 0x0a, 
-0xb4, 0x11, 0xcd, 0x11, 0xf0, 0x11, 0x5c, 0x0f, 0xdd, 0x0d, 0x19, 0x05, 0xb0, 0xfd, 0x4b, 0xfc, 
-0x2b, 0xf2, 0xb1, 0xec, 0xfd, 0xe9, 0x8b, 0xe3, 0xad, 0xd8, 0x2b, 0xd9, 0x02, 0xdd, 0xf8, 0xd6, 
-0x4b, 0xef, 0x14, 0xff, 0x7a, 0xfe, 0xd7, 0x16, 0x6e, 0x1d, 0xf5, 0x1a, 0xe2, 0x1f, 0x4f, 0x1b, 
-0xef, 0x14, 0x63, 0x09, 0x55, 0x07, 0xbb, 0x01, 0xd0, 0xf6, 0x29, 0xff, 0x6b, 0xfb, 0x31, 0xf8, 
-0xde, 0xff, 0xed, 0xfd, 0xfa, 0xfd, 0x7e, 0xfc, 0x6f, 0xfe, 0xcd, 0xfc, 0x7b, 0xfb, 0x45, 0x06, 
-0x63, 0x05, 0xd5, 0x09, 0x60, 0x11, 0x47, 0x11, 0x02, 0x12, 0xc7, 0x0f, 0x97, 0x0f, 0x71, 0x07, 
-0xb7, 0x00, 0x42, 0xfd, 0x0c, 0xf2, 0x3e, 0xec, 0xdd, 0xe9, 0xfe, 0xe1, 0xf3, 0xd7, 0xd5, 0xd9, 
-0x6a, 0xd8, 0xe2, 0xde, 0x1c, 0xf7, 0x30, 0xfc, 0x5a, 0x09, 0x66, 0x1c, 0x5c, 0x1c, 0x02, 0x1e, 
-0xed, 0x1f, 0x75, 0x19, 0x65, 0x0e, 0x31, 0x0b, 0x7d, 0x06, 0x16, 0xfa, 0xb1, 0xfb, 0xb6, 0xfc, 
-0x2f, 0xf9, 0xa9, 0xfd, 0xc6, 0x00, 0x41, 0xff, 0x2c, 0xfe, 0x8a, 0xfe, 0x68, 0xfa, 0xae, 0xfa, 
-0x7a, 0x00, 0x5e, 0x00, 0x68, 0x05, 0xad, 0x0c, 0x2f, 0x0d, 0x22, 0x10, 0x14, 0x11, 0x16, 0x10, 
-0x16, 0x0a, 0x94, 0x06, 0x3c, 0x00, 0x4c, 0xf6, 0x7d, 0xf4, 0x29, 0xec, 0x67, 0xe6, 0x80, 0xe0, 
-0x57, 0xd9, 0x0c, 0xd9, 0x4e, 0xda, 0xd7, 0xec, 0xfd, 0xf7, 0x85, 0x01, 0x27, 0x15, 0xf4, 0x17, 
-0x2b, 0x1d, 0x1e, 0x1e, 0x0c, 0x1a, 0x04, 0x14, 0x69, 0x0c, 0x79, 0x09, 0xab, 0xfc, 0xc0, 0xfb, 
-0xf8, 0xfc, 0x11, 0xf7, 0x8a, 0xfd, 0x0d, 0xff, 0xa0, 0xff, 0x14, 0x01, 0x5a, 0xff, 0x0a, 0x00, 
-0x13, 0xfd, 0x19, 0x00, 0x5c, 0x03, 0x70, 0x01, 0x1a, 0x08, 0xa2, 0x0a, 0x56, 0x0a, 0xa7, 0x0d, 
-0x12, 0x0f, 0x8f, 0x0b, 0xd3, 0x08, 0xa3, 0x06, 0x6a, 0xfd, 0x16, 0xf7, 0x5e, 0xf2, 0x09, 0xe9, 
-0xfd, 0xde, 0x50, 0xd9, 0x0e, 0xd7, 0x8e, 0xd7, 0xf4, 0xe9, 0x40, 0xf7, 0xb7, 0xfd, 0x79, 0x14, 
-0x46, 0x19, 0x93, 0x1a, 0x10, 0x20, 0x28, 0x1a, 0xa6, 0x12, 0xda, 0x0b, 0x2a, 0x09, 0x46, 0xfe, 
-0xf9, 0xf9, 0xef, 0xfe, 0xd4, 0xf8, 0x51, 0xfc, 0xa7, 0x00, 0x3a, 0xfd, 0xf2, 0x00, 0x3c, 0x01, 
-0x5c, 0x00, 0xa1, 0xfe, 0x79, 0x01, 0xff, 0x01, 0xa2, 0x00, 0x94, 0x07, 0x44, 0x08, 0x96, 0x08, 
-0x0f, 0x0c, 0xc5, 0x0c, 0xb1, 0x0a, 0x18, 0x09, 0x52, 0x06, 0x06, 0xff, 0x80, 0xfb, 0x81, 0xf4, 
-0x46, 0xec, 0x57, 0xe4, 0xb1, 0xd9, 0x7d, 0xd7, 0x10, 0xd9, 0x64, 0xe7, 0xdd, 0xf1, 0x62, 0xfc, 
-0x71, 0x11, 0x84, 0x14, 0x30, 0x1a, 0xad, 0x20, 0x9c, 0x19, 0x1d, 0x15, 0xf4, 0x0f, 0x9e, 0x07, 
-0x0b, 0xff, 0x34, 0xfc, 0x48, 0xfb, 0x87, 0xf7, 0x10, 0xfc, 0x22, 0xfe, 0x57, 0xfc, 0x21, 0x01, 
-0x29, 0x02, 0xce, 0xff, 0x2d, 0x00, 0x91, 0x02, 0x07, 0xff, 0x77, 0x02, 0x0e, 0x07, 0x1e, 0x05, 
-0x4b, 0x0a, 0xeb, 0x0b, 0x89, 0x0c, 0x30, 0x0b, 0x76, 0x09, 0x46, 0x07, 0xdf, 0xfe, 0x42, 0xfd, 
-0x59, 0xf4, 0x47, 0xec, 0x53, 0xe5, 0x84, 0xd9, 0x76, 0xd8, 0xb5, 0xd9, 0x09, 0xe8, 0x6c, 0xf0, 
-0x93, 0xfc, 0x07, 0x10, 0x50, 0x14, 0xdb, 0x1b, 0xa4, 0x1e, 0x28, 0x1c, 0xca, 0x15, 0x91, 0x0e, 
-0x71, 0x09, 0x6c, 0xfd, 0x8a, 0xfc, 0x81, 0xfb, 0xc4, 0xf6, 0xc3, 0xfc, 0x9d, 0xfd, 0xf5, 0xfd, 
-0x9c, 0x00, 0x03, 0x04, 0xd5, 0x01, 0x48, 0x01, 0x27, 0x05, 0xb0, 0xfe, 0x09, 0x03, 0xc0, 0x05, 
-0x46, 0x02, 0x18, 0x08, 0x6f, 0x08, 0xb3, 0x07, 0xb0, 0x07, 0xef, 0x08, 0x9d, 0x06, 0x24, 0xff, 
-0xc8, 0xfd, 0x01, 0xf3, 0x13, 0xeb, 0x4a, 0xe4, 0x20, 0xda, 0xc4, 0xd9, 0x86, 0xdf, 0x49, 0xe9, 
-0xc3, 0xf0, 0xae, 0x02, 0x16, 0x0f, 0xe5, 0x13, 0xb3, 0x1e, 0x99, 0x1e, 0x80, 0x19, 0xc2, 0x16, 
-0xfe, 0x0e, 0x9e, 0x05, 0xbb, 0xff, 0xb1, 0xfc, 0x65, 0xf8, 0x96, 0xf8, 0xd5, 0xfc, 0x69, 0xfc, 
-0x95, 0xfe, 0xef, 0x02, 0xdd, 0x02, 0xb1, 0x03, 0xe9, 0x05, 0x2b, 0x02, 0x69, 0x02, 0x49, 0x04, 
-0x6b, 0x00, 0x98, 0x02, 0xa5, 0x05, 0xee, 0x03, 0xd6, 0x05, 0x61, 0x09, 0x90, 0x07, 0xf0, 0x04, 
-0x05, 0x01, 0xb7, 0xf9, 0xb0, 0xf0, 0x02, 0xea, 0x01, 0xe1, 0xa0, 0xda, 0x93, 0xdf, 0xee, 0xe6, 
-0x4b, 0xeb, 0x30, 0xfb, 0x9a, 0x08, 0x46, 0x0c, 0xda, 0x19, 0x08, 0x1d, 0x52, 0x18, 0x95, 0x19, 
-0xfa, 0x13, 0xe2, 0x09, 0x2c, 0x05, 0x59, 0x00, 0x78, 0xf9, 0x05, 0xf9, 0xab, 0xfa, 0x7b, 0xf9, 
-0x42, 0xfc, 0x3d, 0x00, 0xe4, 0x00, 0x9c, 0x03, 0xe8, 0x06, 0x53, 0x04, 0x11, 0x04, 0xa9, 0x05, 
-0xe9, 0x01, 0x23, 0x03, 0x21, 0x03, 0x7d, 0x02, 0x8c, 0x04, 0x9a, 0x03, 0x6c, 0x04, 0x18, 0x02, 
-0x7d, 0xff, 0x62, 0xfb, 0xfc, 0xf1, 0x1a, 0xed, 0xc0, 0xe5, 0x78, 0xdd, 0x8e, 0xe4, 0x94, 0xe9, 
-0x6f, 0xec, 0x3f, 0xfb, 0x45, 0x05, 0x43, 0x0b, 0x44, 0x16, 0x2e, 0x1a, 0x1c, 0x18, 0x50, 0x18, 
-0x76, 0x15, 0x26, 0x0b, 0xd9, 0x05, 0xa4, 0x03, 0x5c, 0xfa, 0xbc, 0xf9, 0xdf, 0xfa, 0x5e, 0xf7, 
-0x40, 0xfb, 0xb0, 0xfe, 0x56, 0x00, 0xd0, 0x03, 0x0b, 0x06, 0xe3, 0x05, 0xc9, 0x05, 0x8e, 0x05, 
-0x5c, 0x03, 0xc4, 0x03, 0x84, 0x02, 0x8d, 0x00, 0x43, 0x02, 0x65, 0x01, 0xf8, 0x00, 0x85, 0xff, 
-0x93, 0xfd, 0xd2, 0xf7, 0xbb, 0xf0, 0x39, 0xee, 0xf3, 0xe3, 0xc0, 0xe4, 0xdd, 0xeb, 0x3a, 0xe9, 
-0x08, 0xf5, 0x56, 0xff, 0x97, 0x02, 0x43, 0x0f, 0x05, 0x15, 0x38, 0x15, 0xa6, 0x17, 0x02, 0x17, 
-0x04, 0x10, 0x37, 0x0a, 0x57, 0x08, 0x28, 0xff, 0xfd, 0xfb, 0x87, 0xfd, 0x70, 0xf7, 0x50, 0xfa, 
-0x2d, 0xfd, 0x9f, 0xfc, 0x2d, 0x02, 0x60, 0x04, 0x40, 0x05, 0x4b, 0x07, 0xd6, 0x06, 0xbe, 0x04, 
-0x80, 0x04, 0x68, 0x03, 0x90, 0x00, 0x28, 0x01, 0x3f, 0xff, 0x0f, 0xfe, 0x76, 0xfe, 0x52, 0xfa, 
-0x3b, 0xf8, 0x81, 0xf2, 0x13, 0xee, 0x2b, 0xeb, 0xd5, 0xe6, 0xfe, 0xec, 0x44, 0xee, 0x78, 0xf2, 
-0xa6, 0xfe, 0xf9, 0x00, 0x73, 0x09, 0x1b, 0x12, 0xf9, 0x11, 0x05, 0x15, 0x2c, 0x15, 0xdb, 0x10, 
-0x89, 0x0b, 0x65, 0x09, 0x7a, 0x04, 0xe9, 0xfd, 0xc5, 0xfe, 0x02, 0xfb, 0xc5, 0xf8, 0x20, 0xfd, 
-0x84, 0xfc, 0xaf, 0xff, 0x09, 0x05, 0x38, 0x05, 0x84, 0x07, 0xbf, 0x08, 0xbb, 0x06, 0x16, 0x06, 
-0xd4, 0x05, 0x9b, 0x01, 0xfb, 0x00, 0xb9, 0xff, 0x75, 0xfa, 0x9d, 0xfb, 0x6c, 0xf8, 0x37, 0xf3, 
-0x5b, 0xf1, 0x62, 0xec, 0x44, 0xea, 0x99, 0xea, 0x31, 0xed, 0x65, 0xf1, 0x97, 0xf5, 0xfe, 0xfd, 
-0xc0, 0x03, 0xd6, 0x08, 0x45, 0x10, 0x19, 0x12, 0x0e, 0x13, 0x07, 0x14, 0x1c, 0x10, 0xfc, 0x0b, 
-0x3f, 0x09, 0x79, 0x04, 0x99, 0xff, 0x87, 0xfe, 0x9d, 0xfb, 0x11, 0xfa, 0xe1, 0xfd, 0x13, 0xfd, 
-0xca, 0xff, 0xc0, 0x04, 0x99, 0x04, 0x24, 0x07, 0xf5, 0x07, 0x12, 0x07, 0x29, 0x06, 0x96, 0x04, 
-0x5f, 0x02, 0x1d, 0xff, 0x50, 0xfd, 0x58, 0xfa, 0xee, 0xf7, 0xa3, 0xf5, 0x3d, 0xf1, 0xd3, 0xee, 
-0x96, 0xeb, 0x89, 0xea, 0x6f, 0xee, 0x9b, 0xef, 0x2e, 0xf4, 0xc6, 0xfb, 0xe4, 0xff, 0x8d, 0x06, 
-0xc1, 0x0d, 0xea, 0x0f, 0x0b, 0x12, 0xe6, 0x14, 0x1b, 0x11, 0x21, 0x0e, 0xf8, 0x0b, 0xea, 0x04, 
-0xe9, 0x01, 0x9e, 0xff, 0x41, 0xfb, 0xa9, 0xfb, 0xd2, 0xfb, 0x36, 0xfc, 0x7b, 0xff, 0x0d, 0x01, 
-0x0a, 0x04, 0xdb, 0x05, 0x1b, 0x07, 0x4d, 0x08, 0xee, 0x06, 0x88, 0x06, 0xae, 0x03, 0x9a, 0x01, 
-0x38, 0xff, 0xf4, 0xfa, 0x34, 0xf9, 0x9d, 0xf4, 0x7e, 0xf0, 0x67, 0xee, 0x17, 0xea, 0xe9, 0xe9, 
-0xb8, 0xed, 0xb2, 0xee, 0x98, 0xf4, 0xce, 0xfa, 0xcc, 0xfe, 0x7b, 0x06, 0xc0, 0x0b, 0x3e, 0x0f, 
-0x17, 0x12, 0xf1, 0x13, 0x05, 0x12, 0x0e, 0x10, 0x5f, 0x0d, 0x8d, 0x07, 0xa4, 0x04, 0x7c, 0x00, 
-0xa9, 0xfc, 0x8d, 0xfb, 0xc3, 0xfa, 0xe4, 0xfa, 0x89, 0xfc, 0xd8, 0xfe, 0x6d, 0x01, 0xf1, 0x03, 
-0x88, 0x06, 0x05, 0x08, 0xdf, 0x07, 0xc4, 0x08, 0x1c, 0x06, 0x1d, 0x04, 0x16, 0x02, 0x81, 0xfc, 
-0x29, 0xfa, 0xe3, 0xf4, 0x99, 0xef, 0xf8, 0xec, 0x33, 0xe9, 0xc3, 0xe8, 0x2e, 0xeb, 0xbd, 0xed, 
-0xcd, 0xf2, 0x6c, 0xf9, 0xeb, 0xfe, 0x18, 0x05, 0x13, 0x0b, 0xfb, 0x0e, 0xe9, 0x11, 0xfd, 0x13, 
-0x92, 0x13, 0xdd, 0x11, 0x20, 0x0f, 0x8a, 0x0b, 0x0b, 0x07, 0x5a, 0x03, 0xc0, 0xff, 0xca, 0xfb, 
-0x5b, 0xfa, 0x26, 0xf9, 0x2b, 0xf9, 0xbc, 0xfb, 0xad, 0xfd, 0xfc, 0xff, 0x17, 0x04, 0xc8, 0x05, 
-0x7f, 0x07, 0x8b, 0x09, 0xe5, 0x06, 0x26, 0x06, 0x33, 0x03, 0x5b, 0xfd, 0x0d, 0xfb, 0x57, 0xf5, 
-0x17, 0xf0, 0x82, 0xee, 0x72, 0xea, 0x4a, 0xea, 0x77, 0xed, 0x39, 0xee, 0xde, 0xf4, 0x10, 0xfa, 
-0xc1, 0xfe, 0x96, 0x06, 0x14, 0x0a, 0xbf, 0x0f, 0x2a, 0x12, 0x94, 0x12, 0xa5, 0x13, 0xae, 0x10, 
-0x8f, 0x0e, 0x5f, 0x0b, 0x9d, 0x06, 0xe8, 0x02, 0xfe, 0xfe, 0xe2, 0xfb, 0x81, 0xf9, 0x87, 0xf8, 
-0x1e, 0xf9, 0x46, 0xf9, 0x25, 0xfc, 0x68, 0xfe, 0x28, 0x00, 0xec, 0x04, 0xe1, 0x04, 0x88, 0x06, 
-0x5b, 0x07, 0x83, 0x03, 0xd9, 0x02, 0xbe, 0xfe, 0xc1, 0xf9, 0xa0, 0xf7, 0x99, 0xf3, 0x46, 0xf0, 
-0x72, 0xf1, 0x02, 0xf1, 0xaf, 0xf1, 0xfb, 0xf6, 0x88, 0xf8, 0xc1, 0xfc, 0x2c, 0x03, 0x3d, 0x04, 
-0x18, 0x09, 0xba, 0x0c, 0xda, 0x0b, 0xca, 0x0e, 0xd5, 0x0d, 0x0d, 0x0b, 0xe6, 0x0a, 0x76, 0x06, 
-0xe4, 0x03, 0xed, 0x01, 0x8f, 0xfd, 0x05, 0xfd, 0x07, 0xfb, 0xf4, 0xf9, 0xc2, 0xfb, 0xa8, 0xfb, 
-0x4b, 0xfd, 0x18, 0xff, 0xd0, 0xff, 0xc3, 0x01, 0xae, 0x02, 0x9b, 0x02, 0xa9, 0x02, 0x80, 0x01, 
-0x1b, 0x00, 0xea, 0xfe, 0xcc, 0xfc, 0x75, 0xfb, 0x44, 0xfa, 0x14, 0xf9, 0xe8, 0xf8, 0xf8, 0xf8, 
-0x6e, 0xf9, 0x53, 0xfa, 0x45, 0xfc, 0xab, 0xfd, 0x73, 0xff, 0x19, 0x02, 0x3b, 0x03, 0xde, 0x04, 
-0x78, 0x06, 0x00, 0x06, 0x69, 0x06, 0xf3, 0x05, 0x2d, 0x04, 0x0a, 0x04, 0x63, 0x02, 0x1e, 0x01, 
-0xf3, 0x00, 0x61, 0xff, 0xcc, 0xff, 0x0b, 0xff, 0xd8, 0xfe, 0xf9, 0xff, 0x32, 0xff, 0x5d, 0x00, 
-0x63, 0x00, 0x4a, 0x00, 0x46, 0x01, 0x27, 0x01, 0x60, 0x01, 0x3f, 0x01, 0x11, 0x01, 0xbd, 0x00, 
-0x3d, 0x00, 0xd4, 0xff, 0xdc, 0xfe, 0x0f, 0xfe, 0x57, 0xfd, 0x91, 0xfc, 0x27, 0xfc, 0x31, 0xfc, 
-0x17, 0xfc, 0x93, 0xfc, 0x4e, 0xfd, 0x93, 0xfd, 0xa6, 0xfe, 0x5f, 0xff, 0xf0, 0xff, 0xb9, 0x00, 
-0xfd, 0x00, 0x3f, 0x01, 0x8e, 0x01, 0x9c, 0x01, 0x95, 0x01, 0x9b, 0x01, 0x49, 0x01, 0x77, 0x01, 
-0x0a, 0x01, 0xe4, 0x00, 0x57, 0x01, 0xc7, 0x00, 0x54, 0x01, 0x74, 0x01, 0x32, 0x01, 0xdf, 0x01, 
-0xba, 0x01, 0xc7, 0x01, 0xee, 0x01, 0x7e, 0x01, 0x6f, 0x01, 0xd6, 0x00, 0x67, 0x00, 0xff, 0xff, 
-0x2d, 0xff, 0xed, 0xfe, 0x63, 0xfe, 0xf6, 0xfd, 0xed, 0xfd, 0xc8, 0xfd, 0xb6, 0xfd, 0xec, 0xfd, 
-0x08, 0xfe, 0x41, 0xfe, 0x6b, 0xfe, 0x99, 0xfe, 0xf7, 0xfe, 0xf7, 0xfe, 0x43, 0xff, 0x91, 0xff, 
-0x83, 0xff, 0xd0, 0xff, 0xdb, 0xff, 0xdd, 0xff, 0x13, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x3d, 0x00, 
-0x87, 0x00, 0x61, 0x00, 0xa0, 0x00, 0xf0, 0x00, 0x1a, 0x01, 0x64, 0x01, 0x97, 0x01, 0xd5, 0x01, 
-0xc8, 0x01, 0xe2, 0x01, 0xb5, 0x01, 0x4b, 0x01, 0x11, 0x01, 0xa6, 0x00, 0x44, 0x00, 0xe0, 0xff, 
-0xac, 0xff, 0x5a, 0xff, 0x3b, 0xff, 0x43, 0xff, 0x27, 0xff, 0x6b, 0xff, 0x7f, 0xff, 0xaf, 0xff, 
-0xd1, 0xff, 0xe4, 0xff, 0x0c, 0x00, 0xdb, 0xff, 0xf6, 0xff, 0xd8, 0xff, 0xa2, 0xff, 0xa8, 0xff, 
-0x61, 0xff, 0x47, 0xff, 0x23, 0xff, 0xe8, 0xfe, 0xe5, 0xfe, 0xc1, 0xfe, 0xb4, 0xfe, 0xfe, 0xfe, 
-0x07, 0xff, 0x67, 0xff, 0xd6, 0xff, 0x19, 0x00, 0x9d, 0x00, 0xfb, 0x00, 0x25, 0x01, 0x9f, 0x01, 
-0xb6, 0x01, 0x9d, 0x01, 0xf8, 0x01, 0x73, 0x01, 0x6d, 0x01, 0x52, 0x01, 0xc0, 0x00, 0xbc, 0x00, 
-0x79, 0x00, 0x22, 0x00, 0x33, 0x00, 0x26, 0x00, 0x06, 0x00, 0x50, 0x00, 0x3e, 0x00, 0x13, 0x00, 
-0x3b, 0x00, 0x0e, 0x00, 0xc0, 0xff, 0xe7, 0xff, 0x46, 0xff, 0x23, 0xff, 0x21, 0xff, 0x59, 0xfe, 
-0xaa, 0xfe, 0x5b, 0xfe, 0x12, 0xfe, 0x99, 0xfe, 0x5c, 0xfe, 0x97, 0xfe, 0x18, 0xff, 0x15, 0xff, 
-0x96, 0xff, 0x26, 0x00, 0x3f, 0x00, 0xc2, 0x00, 0x14, 0x01, 0x15, 0x01, 0x71, 0x01, 0x5d, 0x01, 
-0x4f, 0x01, 0x51, 0x01, 0x1d, 0x01, 0xeb, 0x00, 0xa3, 0x00, 0x89, 0x00, 0x4a, 0x00, 0x1f, 0x00, 
-0x28, 0x00, 0xfd, 0xff, 0x0c, 0x00, 0x25, 0x00, 0xec, 0xff, 0xf6, 0xff, 0x06, 0x00, 0xb1, 0xff, 
-0xad, 0xff, 0x99, 0xff, 0x2c, 0xff, 0x56, 0xff, 0x24, 0xff, 0xe4, 0xfe, 0x17, 0xff, 0xcd, 0xfe, 
-0xe1, 0xfe, 0xee, 0xfe, 0xd8, 0xfe, 0x24, 0xff, 0x50, 0xff, 0x89, 0xff, 0xe7, 0xff, 0x2c, 0x00, 
-0x64, 0x00, 0xbe, 0x00, 0xe5, 0x00, 0xfb, 0x00, 0x2e, 0x01, 0x1f, 0x01, 0x11, 0x01, 0x0e, 0x01, 
-0xcd, 0x00, 0xb5, 0x00, 0x92, 0x00, 0x4c, 0x00, 0x32, 0x00, 0x08, 0x00, 0xe9, 0xff, 0xda, 0xff, 
-0xc8, 0xff, 0xc0, 0xff, 0xbe, 0xff, 0xbb, 0xff, 0xb6, 0xff, 0xb4, 0xff, 0xb7, 0xff, 0xb4, 0xff, 
-0xb1, 0xff, 0xa5, 0xff, 0x93, 0xff, 0x82, 0xff, 0x72, 0xff, 0x59, 0xff, 0x4e, 0xff, 0x52, 0xff, 
-0x50, 0xff, 0x6c, 0xff, 0x87, 0xff, 0xad, 0xff, 0xe4, 0xff, 0x0e, 0x00, 0x3f, 0x00, 0x69, 0x00, 
-0x84, 0x00, 0xa2, 0x00, 0xb1, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xc0, 0x00, 0xb5, 0x00, 0xad, 0x00, 
-0x9a, 0x00, 0x81, 0x00, 0x67, 0x00, 0x44, 0x00, 0x24, 0x00, 0x08, 0x00, 0xe7, 0xff, 0xd3, 0xff, 
-0xc4, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xb5, 0xff, 
-0xa9, 0xff, 0xa4, 0xff, 0x8f, 0xff, 0x7e, 0xff, 0x77, 0xff, 0x65, 0xff, 0x62, 0xff, 0x68, 0xff, 
-0x76, 0xff, 0x8c, 0xff, 0xac, 0xff, 0xcd, 0xff, 0xf2, 0xff, 0x1b, 0x00, 0x3d, 0x00, 0x57, 0x00, 
-0x6e, 0x00, 0x80, 0x00, 0x90, 0x00, 0x9d, 0x00, 0x9c, 0x00, 0xa0, 0x00, 0x9a, 0x00, 0x8b, 0x00, 
-0x84, 0x00, 0x74, 0x00, 0x5d, 0x00, 0x49, 0x00, 0x34, 0x00, 0x1d, 0x00, 0x06, 0x00, 0xf3, 0xff, 
-0xdd, 0xff, 0xcf, 0xff, 0xc7, 0xff, 0xbd, 0xff, 0xaf, 0xff, 0xa4, 0xff, 0x9e, 0xff, 0x8f, 0xff, 
-0x7a, 0xff, 0x67, 0xff, 0x57, 0xff, 0x47, 0xff, 0x46, 0xff, 0x48, 0xff, 0x51, 0xff, 0x6c, 0xff, 
-0x8a, 0xff, 0xa7, 0xff, 0xc7, 0xff, 0xe5, 0xff, 0xfc, 0xff, 0x14, 0x00, 0x2b, 0x00, 0x3a, 0x00, 
-0x47, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x65, 0x00, 0x64, 0x00, 0x5b, 0x00, 
-0x55, 0x00, 0x49, 0x00, 0x3e, 0x00, 0x32, 0x00, 0x24, 0x00, 0x1a, 0x00, 0x02, 0x00, 0xf0, 0xff, 
-0xda, 0xff, 0xcd, 0xff, 0xc5, 0xff, 0xbb, 0xff, 0xbc, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 
-0xb2, 0xff, 0xb7, 0xff, 0xac, 0xff, 0xb5, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xc9, 0xff, 0xe2, 0xff, 
-0xe6, 0xff, 0xe6, 0xff, 0xfc, 0xff, 0x04, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x2a, 0x00, 
-0x2d, 0x00, 0x39, 0x00, 0x4b, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x2e, 0x00, 0x34, 0x00, 
-0x39, 0x00, 0x34, 0x00, 0x34, 0x00, 0x22, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x09, 0x00, 0xfa, 0xff, 
-0xf7, 0xff, 0xe7, 0xff, 0xe0, 0xff, 0xd3, 0xff, 0xd4, 0xff, 0xe3, 0xff, 0xd8, 0xff, 0xed, 0xff, 
-0xde, 0xff, 0xe0, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0xea, 0xff, 0xf1, 0xff, 0xc3, 0xff, 0x02, 0x00, 
-0xdf, 0xff, 0xb5, 0xff, 0x07, 0x00, 0xc7, 0xff, 0xf5, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0x21, 0x00, 
-0xf2, 0xff, 0x2d, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x4c, 0x00, 0x28, 0x00, 0x33, 0x00, 0x0b, 0x00, 
-0x2e, 0x00, 0x07, 0x00, 0xb0, 0xff, 0x60, 0x00, 0x81, 0xff, 0xce, 0xff, 0x0c, 0x00, 0x48, 0xff, 
-0x0d, 0x00, 0x84, 0xff, 0xdf, 0xff, 0xc4, 0xff, 0xba, 0xff, 0xaf, 0xff, 0xdc, 0xff, 0x00, 0x00, 
-0xa2, 0xff, 0x21, 0x00, 0xf0, 0xff, 0x00, 0x00, 0x1c, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x2e, 0x00, 
-0x1e, 0x00, 0x32, 0x00, 0x29, 0x00, 0x76, 0x00, 0xfc, 0xff, 0xc3, 0xff, 0xc3, 0x00, 0xa5, 0xff, 
-0x58, 0x00, 0xb3, 0x00, 0x8f, 0xff, 0x91, 0x00, 0x59, 0x00, 0xc4, 0xff, 0x9f, 0x00, 0x3d, 0x00, 
-0xb3, 0xff, 0xba, 0x00, 0x9d, 0xff, 0xe8, 0xff, 0x62, 0x00, 0x52, 0xff, 0x67, 0x00, 0xb2, 0xff, 
-0xbb, 0xff, 0xef, 0xff, 0xb4, 0xff, 0x9d, 0xff, 0x80, 0xff, 0x31, 0x00, 0x02, 0xff, 0x6e, 0xff, 
-0x43, 0x00, 0x1e, 0xff, 0xc3, 0xff, 0xd3, 0xff, 0x7d, 0xff, 0xb6, 0xff, 0xc0, 0xff, 0x37, 0x00, 
-0xc6, 0xff, 0xce, 0xff, 0x20, 0x00, 0x30, 0x00, 0x08, 0x00, 0x7a, 0x00, 0x29, 0x00, 0xf3, 0xff, 
-0x6c, 0x00, 0x6e, 0x00, 0x05, 0x00, 0x6a, 0x00, 0xa3, 0x00, 0x04, 0x00, 0x0a, 0x00, 0xf1, 0x00, 
-0x05, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x16, 0x00, 0xcb, 0x00, 0xe1, 0xff, 0x6c, 0x00, 0x2e, 0x00, 
-0xa9, 0xff, 0x74, 0x00, 0x93, 0x00, 0x21, 0xff, 0x64, 0x00, 0xc2, 0xff, 0x6e, 0xff, 0x73, 0x00, 
-0xde, 0xff, 0xbc, 0xff, 0xd3, 0xff, 0x35, 0x00, 0xf7, 0xfe, 0xf6, 0xff, 0x43, 0x00, 0x67, 0xff, 
-0xd3, 0xff, 0x1a, 0x00, 0xa6, 0xff, 0xfb, 0xff, 0x8f, 0x00, 0x54, 0xff, 0xbe, 0xff, 0x22, 0x00, 
-0x84, 0xff, 0x49, 0x00, 0x3a, 0x00, 0xc3, 0xff, 0xf7, 0xff, 0xed, 0xff, 0xd4, 0xff, 0xa7, 0x00, 
-0x0c, 0x00, 0x23, 0x00, 0xcb, 0x00, 0x42, 0x00, 0x91, 0x00, 0x25, 0x01, 0x85, 0x00, 0xd8, 0x00, 
-0x4f, 0x01, 0xe4, 0xff, 0xda, 0x00, 0x1a, 0x01, 0xc2, 0xff, 0x4e, 0x00, 0x47, 0x00, 0x61, 0xff, 
-0x83, 0x00, 0x93, 0xff, 0xa4, 0xfe, 0x39, 0x00, 0xf8, 0xff, 0xa0, 0xff, 0xf2, 0xff, 0xd5, 0xff, 
-0x75, 0xff, 0x3b, 0x00, 0xbb, 0xff, 0xdc, 0xff, 0x3b, 0x01, 0xfb, 0xff, 0x29, 0x00, 0xda, 0xff, 
-0xe7, 0xff, 0x3c, 0x00, 0xfa, 0xff, 0xd3, 0x00, 0x24, 0xff, 0x91, 0xff, 0xe3, 0xff, 0x24, 0xff, 
-0x66, 0x00, 0x1a, 0x00, 0xa6, 0xff, 0xb5, 0xff, 0x68, 0x00, 0xc5, 0xff, 0xb0, 0x00, 0x8f, 0x00, 
-0x6f, 0x00, 0xaa, 0xff, 0x24, 0x00, 0x51, 0x00, 0x07, 0x02, 0x90, 0x02, 0xce, 0xfd, 0x56, 0x01, 
-0x3b, 0x03, 0x17, 0x00, 0x11, 0x00, 0x74, 0x00, 0xb3, 0xfe, 0x84, 0xfe, 0x30, 0x00, 0x35, 0xfe, 
-0x84, 0xfd, 0x98, 0xff, 0x04, 0xff, 0xed, 0xfe, 0x1a, 0xff, 0x5a, 0xff, 0x96, 0x00, 0xde, 0x00, 
-0xad, 0x00, 0x0f, 0x02, 0x0d, 0x03, 0x90, 0x02, 0xcb, 0x01, 0x10, 0x01, 0x6b, 0x00, 0x82, 0x00, 
-0xeb, 0xfe, 0x3a, 0xfe, 0xdf, 0xfe, 0x28, 0xfd, 0x3f, 0xfe, 0xfd, 0xff, 0x35, 0xfe, 0xfa, 0xfc, 
-0xb8, 0xfd, 0x9b, 0xfe, 0x7f, 0xfd, 0x28, 0xfc, 0x07, 0xfe, 0x9c, 0xfe, 0x54, 0xfe, 0x10, 0xff, 
-0xa0, 0xff, 0x77, 0x01, 0xc6, 0x02, 0x33, 0x02, 0x63, 0x01, 0xe1, 0x02, 0xd2, 0x03, 0xb8, 0x02, 
-0x4d, 0x01, 0xab, 0x00, 0x14, 0x02, 0xfd, 0x00, 0xc5, 0xfe, 0x67, 0xff, 0xc4, 0xff, 0x43, 0xfe, 
-0xd3, 0xfd, 0x95, 0xff, 0xad, 0xfd, 0x82, 0xfd, 0x52, 0x00, 0x71, 0x00, 0xcb, 0xff, 0xb6, 0xff, 
-0x50, 0x01, 0xec, 0x02, 0x51, 0x01, 0x0f, 0x00, 0xa5, 0x02, 0xd7, 0x02, 0x2d, 0x01, 0x54, 0x01, 
-0x84, 0x01, 0x31, 0x01, 0x05, 0x01, 0x2c, 0x01, 0xcd, 0x00, 0x9b, 0xff, 0xa8, 0xff, 0x5b, 0x00, 
-0x6a, 0xff, 0xec, 0xfe, 0x7c, 0xff, 0x49, 0xff, 0x5c, 0xff, 0x31, 0xff, 0x56, 0xff, 0xd4, 0xff, 
-0xe0, 0xff, 0xe0, 0xff, 0xbf, 0xff, 0x25, 0x00, 0x2f, 0x00, 0xd2, 0xff, 0x4b, 0x00, 0xd4, 0xff, 
-0xaf, 0xff, 0x1b, 0x00, 0x4c, 0xff, 0x20, 0xff, 0xec, 0xff, 0x19, 0x00, 0x27, 0xff, 0x06, 0xff, 
-0x69, 0xff, 0xda, 0xff, 0x40, 0xff, 0x27, 0xff, 0xb4, 0xff, 0x7b, 0xff, 0x83, 0xff, 0xcf, 0xff, 
-0xff, 0xff, 0xd2, 0xff, 0xa2, 0xff, 0x01, 0x00, 0x35, 0x00, 0x82, 0xff, 0xf2, 0xff, 0x02, 0x00, 
-0xcd, 0xff, 0x7d, 0xff, 0x88, 0xff, 0xa6, 0x00, 0x30, 0x00, 0xa4, 0xff, 0x24, 0x00, 0x28, 0x00, 
-0xf4, 0xff, 0x8c, 0x00, 0x24, 0x00, 0xdc, 0xff, 0x5d, 0x00, 0x02, 0x00, 0xa1, 0xff, 0xf2, 0xff, 
-0x2b, 0x00, 0xd9, 0xff, 0x2d, 0xff, 0x6b, 0xff, 0x2b, 0x00, 0x24, 0x00, 0x0f, 0x00, 0x47, 0xff, 
-0x86, 0xff, 0x44, 0x00, 0xf4, 0x00, 0x51, 0x01, 0x59, 0x01, 0xd1, 0x01, 0xe8, 0x01, 0x7f, 0x01, 
-0xee, 0x00, 0xa4, 0x01, 0xf1, 0x01, 0x9c, 0x00, 0xc2, 0xff, 0x5a, 0x00, 0xd8, 0x00, 0x1f, 0x00, 
-0x86, 0xff, 0x1d, 0xff, 0x88, 0xfe, 0x36, 0xfe, 0x89, 0xfd, 0x76, 0xfd, 0x2f, 0xfd, 0x08, 0xfd, 
-0x6e, 0xfd, 0x29, 0xfd, 0x6d, 0xfd, 0x50, 0xfe, 0xb5, 0xfe, 0x07, 0xff, 0xe6, 0xff, 0x54, 0x00, 
-0xd0, 0x00, 0xa9, 0x01, 0xeb, 0x01, 0x9f, 0x01, 0x39, 0x01, 0x92, 0x01, 0xb9, 0x01, 0xbe, 0x00, 
-0x9b, 0x00, 0xa4, 0x00, 0x3c, 0x00, 0x1b, 0x00, 0x36, 0x00, 0x11, 0x00, 0xea, 0xff, 0xf6, 0xff, 
-0xc6, 0xff, 0xc0, 0xff, 0xe8, 0xff, 0xf4, 0xff, 0x2e, 0x00, 0x0d, 0x00, 0xbc, 0xff, 0x5a, 0x00, 
-0x4b, 0x00, 0x60, 0x00, 0x98, 0x00, 0xa7, 0x00, 0x27, 0x00, 0x0e, 0x00, 0x78, 0x00, 0x24, 0x00, 
-0x31, 0x00, 0x1e, 0x00, 0x15, 0x00, 0xdc, 0xff, 0x9e, 0xff, 0xfc, 0xff, 0xde, 0xff, 0xbd, 0xff, 
-0xc2, 0xff, 0xb7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x33, 0x00, 0xa3, 0x00, 0xaf, 0x00, 
-0x66, 0x00, 0xa7, 0x00, 0xf5, 0x00, 0xca, 0x00, 0xb5, 0x00, 0xbb, 0x00, 0x60, 0x00, 0x5a, 0x00, 
-0x51, 0x00, 0x0c, 0x00, 0xbe, 0xff, 0x92, 0xff, 0x30, 0xff, 0x28, 0xff, 0xf9, 0xfe, 0x9a, 0xfe, 
-0x73, 0xfe, 0x91, 0xfe, 0x29, 0xfe, 0x20, 0xfe, 0x57, 0xfe, 0x2d, 0xfe, 0x09, 0xfe, 0x49, 0xfe, 
-0xa2, 0xfe, 0x95, 0xfe, 0xc5, 0xfe, 0x71, 0xff, 0xa2, 0xff, 0x9b, 0xff, 0xa8, 0x00, 0xd1, 0x00, 
-0x31, 0x01, 0x16, 0x02, 0x27, 0x02, 0x22, 0x02, 0x91, 0x02, 0xf3, 0x02, 0xda, 0x02, 0xaf, 0x02, 
-0xa4, 0x02, 0xae, 0x02, 0x68, 0x02, 0x26, 0x02, 0xdd, 0x01, 0x81, 0x01, 0x41, 0x01, 0xd7, 0x00, 
-0x56, 0x00, 0x3e, 0x00, 0xde, 0xff, 0x75, 0xff, 0x3b, 0xff, 0x71, 0xfe, 0xf7, 0xfd, 0x2c, 0xfd, 
-0x8e, 0xfc, 0x57, 0xfc, 0xc7, 0xfb, 0x5d, 0xfb, 0x67, 0xfa, 0xe5, 0xf9, 0xdd, 0xf9, 0xac, 0xf9, 
-0x11, 0xfa, 0x76, 0xfa, 0x13, 0xfb, 0x30, 0xfc, 0x68, 0xfd, 0x2b, 0xff, 0xe0, 0x00, 0x7f, 0x02, 
-0x1b, 0x04, 0xa8, 0x05, 0x4a, 0x07, 0xa5, 0x08, 0xa6, 0x09, 0x49, 0x0a, 0xb3, 0x0a, 0xac, 0x0a, 
-0x44, 0x0a, 0x70, 0x09, 0x66, 0x08, 0x2d, 0x07, 0x65, 0x05, 0x9a, 0x03, 0xcf, 0x01, 0x09, 0x00, 
-0x60, 0xfe, 0xb1, 0xfc, 0x0a, 0xfb, 0xaa, 0xf9, 0xa1, 0xf8, 0xe9, 0xf7, 0x5e, 0xf7, 0xa4, 0xf6, 
-0x1f, 0xf6, 0x05, 0xf6, 0x01, 0xf6, 0xf4, 0xf5, 0xec, 0xf5, 0x03, 0xf6, 0x2c, 0xf6, 0xf0, 0xf6, 
-0x7a, 0xf8, 0x26, 0xfa, 0x35, 0xfc, 0x6c, 0xfe, 0xbd, 0x00, 0x7d, 0x03, 0x24, 0x06, 0xa6, 0x08, 
-0x98, 0x0a, 0x27, 0x0c, 0x1f, 0x0d, 0xae, 0x0d, 0x1e, 0x0e, 0xc3, 0x0d, 0xcc, 0x0c, 0x40, 0x0b, 
-0x53, 0x09, 0x79, 0x07, 0x95, 0x05, 0xbe, 0x03, 0xd8, 0x01, 0x1f, 0x00, 0xd7, 0xfe, 0xc0, 0xfd, 
-0x11, 0xfd, 0x9b, 0xfc, 0x29, 0xfc, 0xb6, 0xfb, 0x6f, 0xfb, 0x42, 0xfb, 0x12, 0xfb, 0xc0, 0xfa, 
-0x3f, 0xfa, 0x7d, 0xf9, 0x66, 0xf8, 0x2c, 0xf7, 0xb9, 0xf5, 0x7e, 0xf4, 0x64, 0xf3, 0xae, 0xf2, 
-0x18, 0xf3, 0x27, 0xf4, 0xc5, 0xf5, 0x48, 0xf8, 0x27, 0xfb, 0x7d, 0xfe, 0x77, 0x02, 0x11, 0x06, 
-0x43, 0x09, 0x41, 0x0c, 0x6b, 0x0e, 0xfd, 0x0f, 0x0c, 0x11, 0x28, 0x11, 0x72, 0x10, 0xe7, 0x0e, 
-0xd9, 0x0c, 0x93, 0x0a, 0x05, 0x08, 0x63, 0x05, 0xf2, 0x02, 0xd1, 0x00, 0xee, 0xfe, 0x65, 0xfd, 
-0x40, 0xfc, 0xb7, 0xfb, 0x78, 0xfb, 0x5d, 0xfb, 0xc2, 0xfb, 0x28, 0xfc, 0x74, 0xfc, 0xe4, 0xfc, 
-0x03, 0xfd, 0x9e, 0xfc, 0xaf, 0xfb, 0x15, 0xfa, 0x26, 0xf8, 0xde, 0xf5, 0x8d, 0xf3, 0xae, 0xf1, 
-0x7d, 0xf0, 0x40, 0xf0, 0x2a, 0xf1, 0xcf, 0xf2, 0x7c, 0xf5, 0x2a, 0xf9, 0x06, 0xfd, 0x9a, 0x01, 
-0x1c, 0x06, 0xe7, 0x09, 0x88, 0x0d, 0x3f, 0x10, 0x07, 0x12, 0x02, 0x13, 0xec, 0x12, 0xfb, 0x11, 
-0x63, 0x10, 0x2a, 0x0e, 0x62, 0x0b, 0x71, 0x08, 0xc5, 0x05, 0x40, 0x03, 0x06, 0x01, 0x26, 0xff, 
-0x7b, 0xfd, 0x31, 0xfc, 0xb5, 0xfb, 0xbf, 0xfb, 0xcd, 0xfb, 0x16, 0xfc, 0x1b, 0xfc, 0x22, 0xfc, 
-0x49, 0xfc, 0xf5, 0xfb, 0x00, 0xfb, 0x75, 0xf9, 0x69, 0xf7, 0x01, 0xf5, 0x4a, 0xf2, 0xbd, 0xef, 
-0xff, 0xed, 0x05, 0xed, 0xf9, 0xec, 0x6b, 0xee, 0x6c, 0xf1, 0x72, 0xf5, 0x33, 0xfa, 0x17, 0xff, 
-0x4f, 0x04, 0x58, 0x09, 0x95, 0x0d, 0x5c, 0x11, 0x3a, 0x14, 0x0b, 0x16, 0x8e, 0x16, 0xde, 0x15, 
-0x75, 0x14, 0x30, 0x12, 0x2a, 0x0f, 0xb3, 0x0b, 0xfb, 0x07, 0xa4, 0x04, 0xf2, 0x01, 0x6f, 0xff, 
-0x6d, 0xfd, 0xd0, 0xfb, 0x7f, 0xfa, 0x26, 0xfa, 0x27, 0xfa, 0x57, 0xfa, 0xe7, 0xfa, 0x5f, 0xfb, 
-0xb7, 0xfb, 0xe2, 0xfb, 0x96, 0xfb, 0xda, 0xfa, 0x85, 0xf9, 0x49, 0xf7, 0xbc, 0xf4, 0xff, 0xf1, 
-0x48, 0xef, 0xab, 0xed, 0x3f, 0xed, 0x02, 0xee, 0x35, 0xf0, 0x72, 0xf3, 0x93, 0xf7, 0x88, 0xfc, 
-0xa9, 0x01, 0xd3, 0x06, 0xaf, 0x0b, 0xaf, 0x0f, 0xf0, 0x12, 0x0d, 0x15, 0x24, 0x16, 0x51, 0x16, 
-0x55, 0x15, 0x73, 0x13, 0xe1, 0x10, 0xeb, 0x0d, 0xa4, 0x0a, 0x4c, 0x07, 0x32, 0x04, 0x77, 0x01, 
-0x18, 0xff, 0xe4, 0xfc, 0x5a, 0xfb, 0x92, 0xfa, 0x30, 0xfa, 0x27, 0xfa, 0xb6, 0xfa, 0x71, 0xfb, 
-0x15, 0xfc, 0x8b, 0xfc, 0x8c, 0xfc, 0x0a, 0xfc, 0xcc, 0xfa, 0x20, 0xf9, 0x5e, 0xf6, 0x5b, 0xf3, 
-0x62, 0xf0, 0xb7, 0xed, 0x2c, 0xec, 0x93, 0xeb, 0x5a, 0xec, 0xab, 0xee, 0x20, 0xf2, 0x8c, 0xf6, 
-0xb8, 0xfb, 0x6b, 0x01, 0x19, 0x07, 0xfd, 0x0b, 0x19, 0x10, 0x9b, 0x13, 0x29, 0x16, 0x5a, 0x17, 
-0x4e, 0x17, 0x80, 0x16, 0xab, 0x14, 0xb9, 0x11, 0x47, 0x0e, 0xc0, 0x0a, 0x63, 0x07, 0xe1, 0x03, 
-0xaa, 0x00, 0x4c, 0xfe, 0x5d, 0xfc, 0xc8, 0xfa, 0xb1, 0xf9, 0x4b, 0xf9, 0x9d, 0xf9, 0x73, 0xfa, 
-0x24, 0xfb, 0xac, 0xfb, 0x50, 0xfc, 0x66, 0xfc, 0x13, 0xfc, 0x26, 0xfb, 0x31, 0xf9, 0x80, 0xf6, 
-0x3e, 0xf3, 0xf7, 0xef, 0x7f, 0xed, 0x52, 0xec, 0x29, 0xec, 0x60, 0xed, 0x39, 0xf0, 0x09, 0xf4, 
-0xad, 0xf8, 0x0c, 0xfe, 0xff, 0x03, 0x9c, 0x09, 0x2c, 0x0e, 0x26, 0x12, 0x44, 0x15, 0x0b, 0x17, 
-0xbc, 0x17, 0x87, 0x17, 0x42, 0x16, 0xdb, 0x13, 0xa2, 0x10, 0xf8, 0x0c, 0x34, 0x09, 0x41, 0x05, 
-0xe2, 0x01, 0xf4, 0xfe, 0x80, 0xfc, 0xf2, 0xfa, 0xad, 0xf9, 0xfe, 0xf8, 0x08, 0xf9, 0x56, 0xf9, 
-0x37, 0xfa, 0x90, 0xfb, 0x83, 0xfc, 0xe0, 0xfc, 0xae, 0xfc, 0x4a, 0xfc, 0xf6, 0xfa, 0x84, 0xf8, 
-0x58, 0xf5, 0xab, 0xf1, 0x25, 0xee, 0x67, 0xeb, 0xc2, 0xe9, 0xd5, 0xe9, 0xc7, 0xeb, 0xc7, 0xee, 
-0xaa, 0xf2, 0x92, 0xf7, 0x35, 0xfd, 0xfe, 0x02, 0xa3, 0x08, 0xe2, 0x0d, 0xeb, 0x11, 0x0e, 0x15, 
-0xe1, 0x16, 0xd9, 0x17, 0x57, 0x1a, 0xe2, 0x19, 0x86, 0x15, 0xd5, 0x11, 0x0d, 0x0f, 0x0e, 0x0b, 
-0x21, 0x06, 0x75, 0x00, 0x23, 0xfc, 0xe4, 0xfa, 0x8b, 0xfa, 0xe3, 0xf9, 0x2f, 0xf9, 0x06, 0xf9, 
-0x91, 0xfa, 0x21, 0xfe, 0xd1, 0xfe, 0x3c, 0xfd, 0x27, 0xfd, 0x45, 0xfe, 0x8d, 0xfd, 0xfb, 0xf8, 
-0xe9, 0xf3, 0x42, 0xf0, 0xc8, 0xec, 0xc4, 0xe9, 0xb6, 0xe7, 0xa3, 0xe9, 0x13, 0xef, 0xb0, 0xf3, 
-0xb0, 0xf7, 0x20, 0xfe, 0x72, 0x05, 0x47, 0x0b, 0x74, 0x0e, 0xb8, 0x10, 0xb4, 0x14, 0xf9, 0x16, 
-0xbf, 0x15, 0x99, 0x14, 0x09, 0x15, 0x94, 0x13, 0x79, 0x0f, 0x35, 0x0a, 0xfa, 0x06, 0x16, 0x04, 
-0xf3, 0xfe, 0x4a, 0xfb, 0x33, 0xf9, 0x99, 0xf7, 0x8b, 0xf7, 0x4c, 0xf8, 0xe6, 0xf9, 0x47, 0xfc, 
-0x9f, 0xfe, 0xfb, 0x01, 0x58, 0x04, 0x56, 0x05, 0x17, 0x06, 0xd1, 0x04, 0xd8, 0x01, 0x02, 0xfd, 
-0xca, 0xf7, 0xe6, 0xf2, 0x8a, 0xec, 0x1b, 0xe7, 0x1c, 0xe4, 0xa2, 0xe3, 0xfa, 0xe5, 0x72, 0xea, 
-0xcc, 0xef, 0x4f, 0xf6, 0x35, 0xfe, 0x58, 0x04, 0x57, 0x0a, 0x3c, 0x10, 0x44, 0x13, 0xd7, 0x15, 
-0x99, 0x17, 0x58, 0x17, 0x2a, 0x17, 0xfa, 0x15, 0xbb, 0x12, 0x3f, 0x0e, 0x65, 0x09, 0x41, 0x05, 
-0xe4, 0x00, 0x2a, 0xfc, 0x53, 0xf9, 0x7c, 0xf7, 0x87, 0xf5, 0xd7, 0xf6, 0xcc, 0xf8, 0xc0, 0xfa, 
-0x23, 0xfe, 0x31, 0x01, 0x86, 0x04, 0x26, 0x07, 0xca, 0x08, 0x84, 0x08, 0x18, 0x06, 0xbd, 0x02, 
-0xf5, 0xfc, 0x96, 0xf7, 0xe0, 0xf1, 0x62, 0xeb, 0x86, 0xe6, 0xd8, 0xe3, 0x23, 0xe4, 0x75, 0xe6, 
-0xc1, 0xea, 0x89, 0xf0, 0x9c, 0xf8, 0xc5, 0xfe, 0x1f, 0x05, 0x31, 0x0e, 0xc0, 0x11, 0x9a, 0x14, 
-0x77, 0x19, 0x5b, 0x19, 0x0d, 0x19, 0x8a, 0x19, 0x22, 0x16, 0xcf, 0x11, 0x0d, 0x0e, 0x33, 0x09, 
-0xc5, 0x03, 0x5f, 0xff, 0x55, 0xfc, 0x23, 0xf8, 0x09, 0xf6, 0x9d, 0xf5, 0x9d, 0xf5, 0xa4, 0xf7, 
-0x5f, 0xf9, 0x4d, 0xfc, 0x53, 0xff, 0xa5, 0x02, 0x7d, 0x05, 0xb8, 0x06, 0x8f, 0x06, 0xdc, 0x04, 
-0x5d, 0x01, 0xe6, 0xfb, 0x4d, 0xf7, 0x44, 0xf1, 0x35, 0xeb, 0xbf, 0xe7, 0x50, 0xe4, 0x1b, 0xe5, 
-0x9e, 0xe8, 0xa0, 0xec, 0xda, 0xf2, 0x99, 0xf9, 0x56, 0x00, 0x22, 0x07, 0x8e, 0x0d, 0xdd, 0x11, 
-0xe3, 0x14, 0x3a, 0x18, 0xad, 0x18, 0x04, 0x18, 0xdd, 0x18, 0x9e, 0x15, 0x10, 0x12, 0x3f, 0x0e, 
-0x63, 0x08, 0x15, 0x04, 0x6b, 0x00, 0x9d, 0xfb, 0xa4, 0xf7, 0x3b, 0xf7, 0x3c, 0xf5, 0x4c, 0xf5, 
-0xc4, 0xf8, 0xfc, 0xf8, 0x4d, 0xfc, 0x7d, 0x00, 0xf1, 0x01, 0x71, 0x05, 0xd3, 0x07, 0x24, 0x07, 
-0x79, 0x05, 0x8f, 0x02, 0x83, 0xfd, 0x65, 0xf8, 0xf9, 0xf2, 0xd5, 0xec, 0xba, 0xe7, 0xb1, 0xe5, 
-0x35, 0xe5, 0x4d, 0xe7, 0x53, 0xec, 0xfd, 0xf1, 0x93, 0xf7, 0x4b, 0xff, 0x3d, 0x06, 0xea, 0x0a, 
-0xba, 0x11, 0x00, 0x14, 0x56, 0x15, 0x95, 0x18, 0x75, 0x16, 0xc5, 0x16, 0x74, 0x16, 0x93, 0x10, 
-0x09, 0x0e, 0xce, 0x09, 0x66, 0x03, 0xdf, 0x00, 0x2a, 0xfc, 0x00, 0xf8, 0x3d, 0xf7, 0x81, 0xf4, 
-0x84, 0xf5, 0x7d, 0xf7, 0x4e, 0xf8, 0xc4, 0xfb, 0x32, 0xff, 0xd6, 0x01, 0xc6, 0x04, 0xe7, 0x07, 
-0xbd, 0x07, 0xaf, 0x06, 0xd4, 0x04, 0xbc, 0xff, 0x61, 0xfb, 0x00, 0xf6, 0x12, 0xef, 0xea, 0xea, 
-0x41, 0xe6, 0xcf, 0xe4, 0x55, 0xe6, 0x49, 0xe8, 0x50, 0xee, 0x15, 0xf3, 0x59, 0xfa, 0xc6, 0x01, 
-0xe9, 0x06, 0x02, 0x0f, 0x51, 0x11, 0x41, 0x15, 0x44, 0x18, 0x76, 0x16, 0x66, 0x19, 0xd1, 0x16, 
-0x3f, 0x13, 0xcd, 0x11, 0x05, 0x0b, 0xbb, 0x06, 0x68, 0x03, 0x4a, 0xfd, 0x91, 0xfa, 0x1f, 0xf8, 
-0xc1, 0xf5, 0xd8, 0xf5, 0xc8, 0xf7, 0xdd, 0xf8, 0xf0, 0xfa, 0x13, 0x00, 0x57, 0x01, 0x02, 0x05, 
-0x9c, 0x08, 0x7f, 0x07, 0xcd, 0x08, 0xd4, 0x05, 0x0a, 0x01, 0xbc, 0xfd, 0xe9, 0xf6, 0xaf, 0xf0, 
-0x2a, 0xec, 0xaf, 0xe6, 0xf2, 0xe4, 0x9b, 0xe6, 0x79, 0xe7, 0x00, 0xed, 0x8f, 0xf3, 0xc8, 0xf8, 
-0x9f, 0x00, 0xc7, 0x07, 0x7b, 0x0c, 0xe6, 0x11, 0x53, 0x15, 0x28, 0x16, 0x25, 0x18, 0xda, 0x17, 
-0xb9, 0x15, 0x40, 0x14, 0xfc, 0x0f, 0x83, 0x0a, 0xa6, 0x07, 0xc7, 0x01, 0x6a, 0xfd, 0x12, 0xfb, 
-0xd1, 0xf6, 0x38, 0xf6, 0x89, 0xf5, 0xd8, 0xf5, 0xe0, 0xf8, 0x44, 0xfa, 0xd4, 0xfd, 0x72, 0x01, 
-0xe6, 0x03, 0x1c, 0x07, 0xdb, 0x07, 0x40, 0x07, 0x42, 0x05, 0xe9, 0x00, 0xb8, 0xfc, 0x65, 0xf6, 
-0x4c, 0xf0, 0x16, 0xec, 0x81, 0xe6, 0xf1, 0xe5, 0x95, 0xe7, 0x4c, 0xe8, 0x50, 0xef, 0x4e, 0xf5, 
-0x7d, 0xf9, 0x65, 0x03, 0x3c, 0x08, 0x42, 0x0d, 0x82, 0x13, 0x09, 0x14, 0xf5, 0x16, 0x93, 0x17, 
-0x44, 0x16, 0x05, 0x16, 0xb6, 0x12, 0x01, 0x0f, 0xb9, 0x0a, 0x2c, 0x06, 0xb0, 0x01, 0x73, 0xfd, 
-0x66, 0xfa, 0x08, 0xf7, 0x09, 0xf6, 0x7e, 0xf5, 0xe8, 0xf5, 0x66, 0xf9, 0x9c, 0xfa, 0x7c, 0xfe, 
-0xdc, 0x02, 0x5c, 0x04, 0x5b, 0x08, 0x00, 0x09, 0x90, 0x07, 0x7d, 0x06, 0x71, 0x01, 0xc6, 0xfc, 
-0xbd, 0xf7, 0x0d, 0xf0, 0x0a, 0xec, 0x87, 0xe7, 0x89, 0xe4, 0xdd, 0xe7, 0x5d, 0xe8, 0x75, 0xee, 
-0x89, 0xf5, 0x45, 0xf9, 0xf3, 0x02, 0x08, 0x08, 0x1e, 0x0d, 0x31, 0x13, 0xeb, 0x13, 0x6c, 0x16, 
-0xfe, 0x16, 0x8b, 0x15, 0x3e, 0x15, 0xcd, 0x11, 0x72, 0x0e, 0x08, 0x0a, 0x41, 0x05, 0x9f, 0x01, 
-0x75, 0xfd, 0x7e, 0xfa, 0x07, 0xf8, 0x71, 0xf6, 0x07, 0xf6, 0x59, 0xf7, 0xbb, 0xf8, 0x6c, 0xfb, 
-0xb2, 0xfe, 0xb6, 0x00, 0xcf, 0x04, 0x7b, 0x06, 0x2f, 0x07, 0x26, 0x08, 0x13, 0x04, 0x58, 0x02, 
-0x3a, 0xfd, 0xc4, 0xf7, 0xac, 0xf3, 0xca, 0xec, 0x16, 0xeb, 0x3e, 0xe7, 0x26, 0xe8, 0x14, 0xec, 
-0x8c, 0xed, 0x81, 0xf5, 0xf8, 0xfa, 0xc5, 0xfe, 0x70, 0x08, 0x57, 0x0b, 0xec, 0x0e, 0xcd, 0x14, 
-0x3d, 0x13, 0xb3, 0x14, 0xe9, 0x15, 0x68, 0x12, 0x9a, 0x11, 0x35, 0x0f, 0x6c, 0x09, 0x87, 0x06, 
-0xd9, 0x02, 0xda, 0xfd, 0xf3, 0xfb, 0x3c, 0xf9, 0x9c, 0xf6, 0xc4, 0xf6, 0xac, 0xf6, 0x45, 0xf8, 
-0xae, 0xfa, 0xa9, 0xfd, 0x5e, 0x00, 0x83, 0x03, 0x8b, 0x06, 0x6b, 0x07, 0x8a, 0x08, 0x9c, 0x06, 
-0xc5, 0x03, 0x55, 0x00, 0xef, 0xf9, 0xf7, 0xf6, 0xb0, 0xef, 0xc1, 0xeb, 0x3e, 0xea, 0xe9, 0xe5, 
-0xc5, 0xea, 0xa5, 0xec, 0x5f, 0xf0, 0x2a, 0xf9, 0x5c, 0xfc, 0x59, 0x03, 0x03, 0x0a, 0xab, 0x0c, 
-0x6d, 0x12, 0x5e, 0x13, 0x81, 0x14, 0x31, 0x15, 0xc5, 0x13, 0xf8, 0x12, 0x29, 0x10, 0xe8, 0x0c, 
-0x12, 0x09, 0x8d, 0x04, 0xb3, 0x00, 0xb3, 0xfd, 0xa1, 0xf9, 0x18, 0xf8, 0x0e, 0xf6, 0x63, 0xf5, 
-0x7d, 0xf7, 0x56, 0xf8, 0x9e, 0xfb, 0xdb, 0xfe, 0x43, 0x01, 0x0f, 0x05, 0xb8, 0x06, 0x35, 0x08, 
-0x76, 0x07, 0xbf, 0x04, 0x41, 0x02, 0xff, 0xfb, 0x5b, 0xf8, 0x36, 0xf3, 0x91, 0xeb, 0xe6, 0xeb, 
-0xa7, 0xe6, 0xb8, 0xe7, 0xb5, 0xed, 0x3b, 0xed, 0xae, 0xf7, 0x4e, 0xfc, 0x53, 0x00, 0x09, 0x0a, 
-0x14, 0x0c, 0x37, 0x10, 0x3a, 0x14, 0x75, 0x13, 0xb4, 0x13, 0x3c, 0x14, 0x7f, 0x11, 0x70, 0x0f, 
-0x0e, 0x0e, 0x21, 0x09, 0x3e, 0x05, 0xc9, 0x02, 0x84, 0xfe, 0xe4, 0xfa, 0x13, 0xfa, 0x08, 0xf7, 
-0xd0, 0xf5, 0xbc, 0xf8, 0x38, 0xf8, 0x0b, 0xfb, 0xfd, 0xff, 0x9d, 0x00, 0xcf, 0x04, 0x9d, 0x08, 
-0xc3, 0x07, 0x0d, 0x0a, 0x2a, 0x07, 0xaf, 0x03, 0xf1, 0xff, 0x6a, 0xf9, 0xba, 0xf5, 0x22, 0xec, 
-0xc0, 0xeb, 0x51, 0xe6, 0x5f, 0xe3, 0x15, 0xec, 0x55, 0xe9, 0x36, 0xf2, 0x51, 0xfb, 0x4c, 0xfc, 
-0x09, 0x07, 0x91, 0x0c, 0xef, 0x0d, 0x81, 0x14, 0x5a, 0x14, 0x82, 0x14, 0xd4, 0x13, 0x39, 0x13, 
-0xf5, 0x10, 0x93, 0x0c, 0x7a, 0x0c, 0x77, 0x05, 0xa8, 0x01, 0xc2, 0x00, 0xac, 0xfa, 0x28, 0xf9, 
-0x2f, 0xf9, 0x7a, 0xf5, 0xf4, 0xf7, 0xf6, 0xf9, 0x61, 0xfa, 0x83, 0xff, 0x27, 0x02, 0xb7, 0x03, 
-0x24, 0x08, 0xbd, 0x08, 0xf5, 0x08, 0x7b, 0x07, 0x34, 0x04, 0xdf, 0xff, 0xda, 0xf8, 0xf6, 0xf5, 
-0xf1, 0xec, 0xfb, 0xe8, 0xaf, 0xe8, 0x90, 0xe2, 0x7b, 0xe9, 0x7a, 0xee, 0xe0, 0xef, 0x23, 0xfd, 
-0x67, 0x01, 0x9b, 0x05, 0x2b, 0x0f, 0x83, 0x10, 0x75, 0x13, 0xc8, 0x14, 0x8f, 0x14, 0xe7, 0x12, 
-0x80, 0x10, 0x89, 0x10, 0x81, 0x0b, 0x78, 0x08, 0xc3, 0x06, 0x16, 0xff, 0x09, 0xfe, 0x24, 0xfc, 
-0x12, 0xf7, 0x8a, 0xf8, 0xe6, 0xf6, 0xf8, 0xf6, 0x68, 0xf9, 0x40, 0xfb, 0x08, 0xff, 0x49, 0x01, 
-0x95, 0x04, 0x06, 0x07, 0x6e, 0x08, 0x7a, 0x09, 0x03, 0x07, 0x98, 0x04, 0x28, 0x00, 0xc5, 0xf8, 
-0x39, 0xf5, 0xeb, 0xed, 0x1c, 0xe8, 0x5b, 0xe7, 0xb1, 0xe4, 0xda, 0xe7, 0x97, 0xed, 0xf8, 0xf3, 
-0xd0, 0xfa, 0xf3, 0x02, 0x9c, 0x08, 0xc4, 0x0c, 0x75, 0x12, 0xca, 0x12, 0xbb, 0x13, 0x0a, 0x14, 
-0x1f, 0x12, 0x21, 0x10, 0x7c, 0x0e, 0xbd, 0x0c, 0x88, 0x08, 0x53, 0x05, 0x22, 0x03, 0x91, 0xfd, 
-0x8c, 0xfb, 0x45, 0xfb, 0x2d, 0xf6, 0x57, 0xf8, 0x8c, 0xf8, 0x31, 0xf8, 0x4d, 0xfd, 0xaa, 0xfe, 
-0x9f, 0x02, 0x5c, 0x05, 0x7a, 0x07, 0xf5, 0x09, 0xf6, 0x08, 0x52, 0x08, 0x1b, 0x04, 0x60, 0xff, 
-0x49, 0xfa, 0x59, 0xf3, 0xd5, 0xed, 0xce, 0xe8, 0xb7, 0xe4, 0xc2, 0xe5, 0xed, 0xe6, 0xbb, 0xeb, 
-0x55, 0xf5, 0x2e, 0xf9, 0x1b, 0x02, 0xdf, 0x08, 0x53, 0x0c, 0x76, 0x11, 0x82, 0x12, 0x03, 0x14, 
-0x8c, 0x12, 0x76, 0x11, 0xa3, 0x10, 0x59, 0x0d, 0x69, 0x0c, 0x16, 0x09, 0x2a, 0x05, 0xb2, 0x03, 
-0x61, 0xfe, 0xab, 0xfc, 0x5a, 0xfb, 0x93, 0xf7, 0xea, 0xf8, 0xa0, 0xf8, 0xb6, 0xf9, 0xc8, 0xfc, 
-0x7d, 0xff, 0x72, 0x02, 0xcb, 0x04, 0x3f, 0x07, 0x24, 0x08, 0xc8, 0x08, 0xc3, 0x06, 0x3e, 0x02, 
-0xd4, 0xff, 0xa2, 0xf8, 0xe5, 0xf2, 0x92, 0xee, 0x93, 0xe7, 0xe9, 0xe6, 0x17, 0xe5, 0x3c, 0xe7, 
-0xd2, 0xee, 0x97, 0xf3, 0x48, 0xfc, 0x59, 0x03, 0x09, 0x09, 0xed, 0x0d, 0x58, 0x10, 0xc1, 0x13, 
-0x47, 0x12, 0x7a, 0x12, 0xa4, 0x11, 0x51, 0x0e, 0x8c, 0x0e, 0x22, 0x0c, 0x81, 0x09, 0x2b, 0x08, 
-0xdd, 0x03, 0x0c, 0x00, 0x18, 0xfe, 0x52, 0xfa, 0x35, 0xf8, 0x2d, 0xf8, 0x1a, 0xf7, 0x27, 0xf8, 
-0xaa, 0xfb, 0x10, 0xfe, 0xe3, 0x00, 0xea, 0x04, 0x1f, 0x06, 0x90, 0x07, 0xf8, 0x07, 0x5c, 0x05, 
-0x1e, 0x02, 0xd5, 0xfd, 0xfa, 0xf7, 0xbc, 0xf2, 0x1d, 0xed, 0x97, 0xe7, 0x27, 0xe7, 0xc2, 0xe6, 
-0x88, 0xe8, 0xdf, 0xf1, 0xe3, 0xf6, 0x3d, 0xfd, 0x01, 0x06, 0x41, 0x09, 0x14, 0x0d, 0xf5, 0x0f, 
-0xbf, 0x11, 0x00, 0x11, 0xa4, 0x10, 0xb2, 0x10, 0x1e, 0x0e, 0xd8, 0x0d, 0x53, 0x0c, 0x5f, 0x0a, 
-0x88, 0x07, 0xb8, 0x03, 0x31, 0x01, 0x61, 0xfd, 0x46, 0xfb, 0x6d, 0xf9, 0xfe, 0xf8, 0xba, 0xf8, 
-0xc9, 0xf9, 0x74, 0xfd, 0x83, 0xff, 0x09, 0x02, 0x44, 0x05, 0x6e, 0x06, 0x78, 0x06, 0x99, 0x06, 
-0x55, 0x03, 0x91, 0xfe, 0xa4, 0xfa, 0xd9, 0xf4, 0x20, 0xef, 0xa0, 0xe9, 0x4a, 0xe6, 0xe5, 0xe5, 
-0x8f, 0xe7, 0x3c, 0xec, 0x95, 0xf4, 0x4e, 0xfb, 0x47, 0x01, 0x2a, 0x08, 0x81, 0x0b, 0xcd, 0x0e, 
-0x6c, 0x0f, 0x89, 0x10, 0x5b, 0x11, 0x33, 0x0e, 0xde, 0x0e, 0xfa, 0x0d, 0xf9, 0x0a, 0x23, 0x0b, 
-0xd7, 0x09, 0x8e, 0x05, 0x27, 0x03, 0x36, 0x01, 0xb5, 0xfc, 0x47, 0xfb, 0x55, 0xfa, 0x15, 0xf9, 
-0x86, 0xfa, 0xce, 0xfa, 0xa2, 0xfe, 0x8c, 0x01, 0xac, 0x02, 0x12, 0x06, 0x76, 0x06, 0x11, 0x06, 
-0xe7, 0x03, 0x32, 0x00, 0xb8, 0xfb, 0x39, 0xf6, 0x67, 0xf0, 0x4b, 0xec, 0xa2, 0xe5, 0xd9, 0xe5, 
-0x31, 0xe9, 0xcb, 0xe9, 0x09, 0xf5, 0xf7, 0xfa, 0xdf, 0xff, 0x87, 0x09, 0xda, 0x0a, 0xe4, 0x0d, 
-0xcc, 0x0f, 0x4d, 0x0e, 0xe4, 0x0e, 0xf3, 0x0c, 0x48, 0x0d, 0x35, 0x0c, 0x58, 0x0a, 0xe6, 0x0b, 
-0x4f, 0x08, 0x73, 0x07, 0xea, 0x05, 0x32, 0x01, 0xe8, 0xfe, 0xc5, 0xfc, 0x8e, 0xfa, 0x38, 0xf9, 
-0x58, 0xfb, 0xe5, 0xfa, 0xda, 0xfc, 0x33, 0x02, 0xee, 0x01, 0xc9, 0x04, 0x1f, 0x06, 0xdb, 0x04, 
-0x65, 0x05, 0x3f, 0xff, 0x9c, 0xfc, 0x71, 0xf7, 0x6c, 0xf0, 0x81, 0xed, 0x0e, 0xe6, 0x4e, 0xe8, 
-0xe8, 0xe8, 0xcd, 0xea, 0xbf, 0xf6, 0x70, 0xfa, 0x0c, 0x02, 0x4e, 0x09, 0xd6, 0x0b, 0xf0, 0x0d, 
-0xbc, 0x0d, 0xdd, 0x0e, 0x62, 0x0c, 0x48, 0x0a, 0x54, 0x0a, 0x9d, 0x07, 0xa5, 0x05, 0x74, 0x05, 
-0x4e, 0x04, 0x25, 0x03, 0x91, 0x03, 0x7e, 0x04, 0x0e, 0x04, 0xaa, 0x06, 0x8d, 0x07, 0x2a, 0x07, 
-0xfe, 0x08, 0x77, 0x07, 0xb8, 0x05, 0xbe, 0x04, 0xb2, 0x01, 0x06, 0xfe, 0xd9, 0xfb, 0x53, 0xf8, 
-0xe0, 0xf4, 0x9c, 0xf1, 0x75, 0xef, 0x08, 0xeb, 0x43, 0xe7, 0x56, 0xe7, 0x5c, 0xe7, 0x2d, 0xec, 
-0xd6, 0xf3, 0x18, 0xf8, 0xe3, 0xff, 0xc1, 0x09, 0xad, 0x0b, 0x5e, 0x11, 0xf6, 0x14, 0x9d, 0x12, 
-0x58, 0x12, 0xa9, 0x0e, 0x75, 0x0a, 0xaa, 0x05, 0x1d, 0x00, 0x89, 0xfd, 0x01, 0xfa, 0xd9, 0xf7, 
-0x2a, 0xfa, 0x73, 0xfb, 0x87, 0xff, 0xaf, 0x03, 0x6b, 0x07, 0xdd, 0x0c, 0x23, 0x0c, 0x6c, 0x0d, 
-0x0b, 0x0e, 0x95, 0x09, 0x43, 0x08, 0x27, 0x05, 0xfd, 0xff, 0x3b, 0xfd, 0xa4, 0xf9, 0x4e, 0xf6, 
-0xa5, 0xf2, 0x4c, 0xf0, 0xc8, 0xed, 0xba, 0xe8, 0x43, 0xe8, 0x25, 0xe6, 0x59, 0xe9, 0x64, 0xf0, 
-0x76, 0xf4, 0xef, 0xfb, 0x98, 0x04, 0x8e, 0x0a, 0xc2, 0x0c, 0xf2, 0x12, 0xff, 0x13, 0x1b, 0x10, 
-0x71, 0x11, 0xdf, 0x0d, 0x0e, 0x07, 0x4f, 0x06, 0x17, 0x01, 0x17, 0xfd, 0x19, 0xfd, 0x58, 0xfa, 
-0xc0, 0xfc, 0xf5, 0xfd, 0x4a, 0x01, 0x3a, 0x06, 0xae, 0x07, 0x48, 0x0c, 0x06, 0x0d, 0xf9, 0x0b, 
-0xeb, 0x0c, 0x20, 0x09, 0xf9, 0x05, 0x49, 0x04, 0x9f, 0xfe, 0xff, 0xfb, 0x5e, 0xf9, 0x04, 0xf5, 
-0x9a, 0xf2, 0xad, 0xf0, 0x88, 0xee, 0x46, 0xea, 0xf4, 0xe8, 0xaa, 0xe9, 0x37, 0xec, 0x7b, 0xf0, 
-0xde, 0xf5, 0x66, 0xfc, 0x2b, 0x02, 0xdb, 0x07, 0x8b, 0x0b, 0x04, 0x0f, 0x93, 0x10, 0xcd, 0x0f, 
-0xf8, 0x0f, 0x0c, 0x0d, 0x32, 0x09, 0x0d, 0x08, 0xaf, 0x02, 0xd9, 0xff, 0x49, 0xff, 0x40, 0xfc, 
-0x47, 0xfd, 0xc7, 0xfd, 0x5c, 0x00, 0x2d, 0x04, 0xeb, 0x04, 0xef, 0x09, 0x02, 0x0b, 0x62, 0x09, 
-0x4d, 0x0c, 0x74, 0x08, 0xe7, 0x04, 0xd1, 0x04, 0x0d, 0xff, 0xb3, 0xfb, 0xea, 0xf9, 0x80, 0xf4, 
-0x67, 0xf2, 0x5e, 0xf0, 0xea, 0xed, 0x36, 0xeb, 0x5b, 0xea, 0xc0, 0xeb, 0x6a, 0xed, 0xe1, 0xf2, 
-0xe8, 0xf6, 0x75, 0xfb, 0x4c, 0x03, 0xd5, 0x06, 0x08, 0x0a, 0x0d, 0x0f, 0xcc, 0x0f, 0xb7, 0x0f, 
-0x38, 0x0f, 0xfa, 0x0d, 0xc4, 0x0a, 0x5b, 0x06, 0xf2, 0x05, 0x4f, 0x02, 0x65, 0xfe, 0x3e, 0x00, 
-0x99, 0xfe, 0xa3, 0xfd, 0xa5, 0x00, 0x07, 0x02, 0xa2, 0x03, 0x48, 0x05, 0xac, 0x06, 0x7e, 0x07, 
-0xf6, 0x05, 0x7a, 0x05, 0xda, 0x03, 0xfc, 0x00, 0x13, 0xff, 0x0c, 0xfc, 0xfd, 0xfa, 0x7c, 0xf7, 
-0x66, 0xf6, 0x13, 0xf7, 0x9b, 0xf3, 0x22, 0xf4, 0xaa, 0xf4, 0x02, 0xf3, 0x26, 0xf6, 0xc8, 0xf7, 
-0x59, 0xf8, 0x06, 0xfc, 0xae, 0xfc, 0x11, 0xff, 0xc0, 0x01, 0xa1, 0x02, 0x45, 0x05, 0xf0, 0x06, 
-0x6b, 0x07, 0x54, 0x09, 0x54, 0x09, 0xb3, 0x08, 0xb4, 0x08, 0xc6, 0x06, 0x08, 0x06, 0xb8, 0x04, 
-0xc9, 0x02, 0x22, 0x02, 0x15, 0x01, 0xa7, 0x00, 0xda, 0x00, 0x97, 0x00, 0xe8, 0x00, 0xc3, 0x00, 
-0xf1, 0x00, 0xa1, 0x01, 0x9a, 0x00, 0xa8, 0x00, 0xc4, 0x00, 0x91, 0xff, 0x94, 0xff, 0x8a, 0xfe, 
-0x64, 0xfd, 0x8a, 0xfd, 0x68, 0xfc, 0x19, 0xfc, 0xed, 0xfb, 0xec, 0xfa, 0x20, 0xfb, 0xcc, 0xfa, 
-0xbc, 0xfa, 0xdb, 0xfa, 0xb5, 0xfa, 0x84, 0xfb, 0xa9, 0xfb, 0xe5, 0xfb, 0x5b, 0xfd, 0x86, 0xfe, 
-0xfd, 0xfe, 0x02, 0x01, 0x5a, 0x02, 0x70, 0x02, 0x2c, 0x04, 0x42, 0x04, 0x22, 0x04, 0xa1, 0x04, 
-0xe7, 0x03, 0x40, 0x04, 0xd3, 0x03, 0x69, 0x03, 0x14, 0x04, 0xcd, 0x02, 0xac, 0x02, 0x1c, 0x03, 
-0x41, 0x02, 0x39, 0x02, 0xd5, 0x01, 0x94, 0x01, 0x22, 0x01, 0xb4, 0x00, 0x57, 0x00, 0x91, 0xff, 
-0x26, 0xff, 0xed, 0xfe, 0x99, 0xfe, 0x36, 0xfe, 0x6d, 0xfe, 0x03, 0xfe, 0x02, 0xfe, 0x07, 0xfe, 
-0xb0, 0xfd, 0xda, 0xfd, 0x93, 0xfd, 0x73, 0xfd, 0xac, 0xfd, 0x89, 0xfd, 0xc4, 0xfd, 0xea, 0xfd, 
-0x12, 0xfe, 0xad, 0xfe, 0xcd, 0xfe, 0x47, 0xff, 0x9c, 0xff, 0xf0, 0xff, 0x63, 0x00, 0xaa, 0x00, 
-0x18, 0x01, 0x5f, 0x01, 0x7a, 0x01, 0xd4, 0x01, 0x13, 0x02, 0x0b, 0x02, 0x3f, 0x02, 0x60, 0x02, 
-0x2d, 0x02, 0x47, 0x02, 0x2b, 0x02, 0xc4, 0x01, 0x90, 0x01, 0x5b, 0x01, 0x2f, 0x01, 0xab, 0x00, 
-0x90, 0x00, 0x7c, 0x00, 0x25, 0x00, 0x38, 0x00, 0x0e, 0x00, 0xb9, 0xff, 0x75, 0xff, 0x53, 0xff, 
-0xde, 0xfe, 0x8f, 0xfe, 0x6f, 0xfe, 0x46, 0xfe, 0x44, 0xfe, 0x51, 0xfe, 0x96, 0xfe, 0xdd, 0xfe, 
-0x30, 0xff, 0x79, 0xff, 0xc1, 0xff, 0x14, 0x00, 0x45, 0x00, 0x5e, 0x00, 0xb9, 0x00, 0x9f, 0x00, 
-0x9d, 0x00, 0x96, 0x00, 0x46, 0x00, 0x3b, 0x00, 0x06, 0x00, 0xe9, 0xff, 0xa0, 0xff, 0xb0, 0xff, 
-0xbc, 0xff, 0xa7, 0xff, 0xd8, 0xff, 0xec, 0xff, 0xf2, 0xff, 0x13, 0x00, 0x35, 0x00, 0x43, 0x00, 
-0x4b, 0x00, 0x7a, 0x00, 0x9f, 0x00, 0x81, 0x00, 0x84, 0x00, 0xaa, 0x00, 0x82, 0x00, 0x20, 0x00, 
-0x3c, 0x00, 0x22, 0x00, 0xc1, 0xff, 0xb8, 0xff, 0xb6, 0xff, 0xa4, 0xff, 0xb9, 0xff, 0xee, 0xff, 
-0x08, 0x00, 0x3c, 0x00, 0x97, 0x00, 0xa8, 0x00, 0xd2, 0x00, 0x07, 0x01, 0xd8, 0x00, 0xbb, 0x00, 
-0xb3, 0x00, 0x84, 0x00, 0x28, 0x00, 0x17, 0x00, 0xc3, 0xff, 0x7e, 0xff, 0x8f, 0xff, 0x2e, 0xff, 
-0x0a, 0xff, 0x14, 0xff, 0x00, 0xff, 0xf4, 0xfe, 0x0d, 0xff, 0x41, 0xff, 0x4a, 0xff, 0x78, 0xff, 
-0xb7, 0xff, 0xb9, 0xff, 0xee, 0xff, 0x01, 0x00, 0xfe, 0xff, 0x1f, 0x00, 0xf6, 0xff, 0xfe, 0xff, 
-0x0e, 0x00, 0xe9, 0xff, 0xe6, 0xff, 0xdb, 0xff, 0xbd, 0xff, 0xb2, 0xff, 0xea, 0xff, 0xe9, 0xff, 
-0x0b, 0x00, 0x6e, 0x00, 0x83, 0x00, 0xa2, 0x00, 0xea, 0x00, 0x0f, 0x01, 0x13, 0x01, 0x1c, 0x01, 
-0x27, 0x01, 0xf3, 0x00, 0xaa, 0x00, 0xa9, 0x00, 0x63, 0x00, 0x1a, 0x00, 0x0e, 0x00, 0xce, 0xff, 
-0x8f, 0xff, 0x74, 0xff, 0x54, 0xff, 0x2b, 0xff, 0x3d, 0xff, 0x3d, 0xff, 0x2f, 0xff, 0x49, 0xff, 
-0x47, 0xff, 0x4c, 0xff, 0x60, 0xff, 0x61, 0xff, 0x69, 0xff, 0x74, 0xff, 0x79, 0xff, 0x89, 0xff, 
-0x9b, 0xff, 0xaa, 0xff, 0xb9, 0xff, 0xcc, 0xff, 0xdc, 0xff, 0xf2, 0xff, 0x0b, 0x00, 0x17, 0x00, 
-0x30, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x7e, 0x00, 0x94, 0x00, 0xa6, 0x00, 0xb4, 0x00, 0xb9, 0x00, 
-0xb8, 0x00, 0xb0, 0x00, 0xa6, 0x00, 0x94, 0x00, 0x80, 0x00, 0x6d, 0x00, 0x4e, 0x00, 0x32, 0x00, 
-0x14, 0x00, 0xf5, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0x91, 0xff, 0x75, 0xff, 0x5a, 0xff, 0x4b, 0xff, 
-0x3c, 0xff, 0x2c, 0xff, 0x28, 0xff, 0x27, 0xff, 0x2a, 0xff, 0x37, 0xff, 0x4b, 0xff, 0x60, 0xff, 
-0x7b, 0xff, 0x96, 0xff, 0xae, 0xff, 0xcc, 0xff, 0xe2, 0xff, 0xec, 0xff, 0xfb, 0xff, 0x0c, 0x00, 
-0x17, 0x00, 0x26, 0x00, 0x37, 0x00, 0x49, 0x00, 0x61, 0x00, 0x75, 0x00, 0x85, 0x00, 0x93, 0x00, 
-0x9e, 0x00, 0xa7, 0x00, 0xa6, 0x00, 0xa4, 0x00, 0x9c, 0x00, 0x8e, 0x00, 0x7c, 0x00, 0x63, 0x00, 
-0x4b, 0x00, 0x33, 0x00, 0x16, 0x00, 0xfe, 0xff, 0xe2, 0xff, 0xcd, 0xff, 0xb8, 0xff, 0x9f, 0xff, 
-0x8c, 0xff, 0x75, 0xff, 0x64, 0xff, 0x53, 0xff, 0x46, 0xff, 0x46, 0xff, 0x43, 0xff, 0x49, 0xff, 
-0x58, 0xff, 0x65, 0xff, 0x79, 0xff, 0x95, 0xff, 0xab, 0xff, 0xc5, 0xff, 0xd9, 0xff, 0xee, 0xff, 
-0x04, 0x00, 0x17, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x41, 0x00, 0x50, 0x00, 0x59, 0x00, 0x61, 0x00, 
-0x6d, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x80, 0x00, 0x84, 0x00, 0x7d, 0x00, 0x76, 0x00, 0x6d, 0x00, 
-0x5b, 0x00, 0x4c, 0x00, 0x2c, 0x00, 0x1b, 0x00, 0x03, 0x00, 0xe0, 0xff, 0xcb, 0xff, 0xb8, 0xff, 
-0xa0, 0xff, 0x8c, 0xff, 0x89, 0xff, 0x7b, 0xff, 0x7c, 0xff, 0x7f, 0xff, 0x78, 0xff, 0x87, 0xff, 
-0x95, 0xff, 0xa9, 0xff, 0xae, 0xff, 0xc2, 0xff, 0xcf, 0xff, 0xdf, 0xff, 0xf4, 0xff, 0x06, 0x00, 
-0x0d, 0x00, 0x19, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x33, 0x00, 0x44, 0x00, 0x56, 0x00, 0x43, 0x00, 
-0x4c, 0x00, 0x59, 0x00, 0x56, 0x00, 0x68, 0x00, 0x67, 0x00, 0x5f, 0x00, 0x63, 0x00, 0x6a, 0x00, 
-0x49, 0x00, 0x3e, 0x00, 0x44, 0x00, 0x20, 0x00, 0x21, 0x00, 0x0b, 0x00, 0x07, 0x00, 0xf6, 0xff, 
-0xe2, 0xff, 0xea, 0xff, 0xcc, 0xff, 0xc9, 0xff, 0xcb, 0xff, 0xcc, 0xff, 0xcf, 0xff, 0xc1, 0xff, 
-0xdf, 0xff, 0xc4, 0xff, 0xc7, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0x07, 0x00, 0xf0, 0xff, 0x06, 0x00, 
-0x16, 0x00, 0x23, 0x00, 0x22, 0x00, 0x10, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x15, 0x00, 
-0x25, 0x00, 0x1c, 0x00, 0x17, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x20, 0x00, 0x32, 0x00, 
-0x2e, 0x00, 0x45, 0x00, 0x44, 0x00, 0x37, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x29, 0x00, 0x10, 0x00, 
-0x0c, 0x00, 0x15, 0x00, 0xe3, 0xff, 0x2c, 0x00, 0xc6, 0xff, 0x82, 0x00, 0x49, 0xff, 0xf8, 0x00, 
-0x90, 0x00, 0xb5, 0xfe, 0x94, 0x00, 0xd1, 0xfe, 0x6d, 0x00, 0x8b, 0xff, 0x20, 0x00, 0xf6, 0xff, 
-0x9a, 0xff, 0x76, 0x00, 0xb1, 0xff, 0x35, 0x00, 0x13, 0x00, 0x45, 0x00, 0xfb, 0xff, 0x27, 0x00, 
-0x01, 0x00, 0x21, 0x00, 0xfa, 0xff, 0x10, 0x00, 0xc5, 0xff, 0xfd, 0xff, 0xea, 0xff, 0xf1, 0xff, 
-0xe5, 0xff, 0xef, 0xff, 0xae, 0xff, 0x16, 0x00, 0xcf, 0xff, 0x7e, 0xff, 0xe1, 0xff, 0xb5, 0xff, 
-0x26, 0x00, 0xb8, 0xff, 0xf3, 0xff, 0x39, 0x00, 0xea, 0xff, 0xe8, 0xff, 0xc3, 0xff, 0x2c, 0x00, 
-0x6d, 0x00, 0x1c, 0x00, 0x37, 0x00, 0xff, 0xff, 0x09, 0x00, 0x14, 0x00, 0x4e, 0x00, 0x84, 0x00, 
-0xf6, 0xff, 0x84, 0x00, 0xe2, 0xff, 0x50, 0x00, 0xe7, 0xff, 0x71, 0x00, 0xee, 0xff, 0x1a, 0x00, 
-0xc0, 0x06, 0x17, 0xfd, 0xc3, 0x00, 0x49, 0xff, 0x64, 0xfe, 0x44, 0x01, 0x35, 0xfe, 0xb7, 0x01, 
-0x81, 0xfd, 0x9b, 0x00, 0xc9, 0xfe, 0xb6, 0xff, 0xa1, 0xff, 0xeb, 0xff, 0xd0, 0xff, 0xde, 0xff, 
-0xad, 0x00, 0x92, 0xff, 0xb6, 0x00, 0xbf, 0xff, 0x11, 0x00, 0x23, 0x00, 0xf1, 0xff, 0x85, 0xff, 
-0x66, 0x00, 0x94, 0xff, 0xfa, 0xff, 0xbb, 0xff, 0xe8, 0xff, 0x30, 0x00, 0x0f, 0xff, 0x96, 0x00, 
-0x2c, 0xff, 0x2c, 0x01, 0xc1, 0xff, 0x39, 0x00, 0x52, 0x00, 0xf7, 0xff, 0x90, 0x00, 0x50, 0xff, 
-0xa5, 0x01, 0x54, 0xff, 0xa4, 0x00, 0x55, 0x00, 0xfa, 0x00, 0x66, 0xff, 0xd4, 0x00, 0xef, 0xff, 
-0x87, 0x00, 0xf1, 0xff, 0x49, 0x00, 0x80, 0x00, 0xc5, 0x01, 0x2a, 0x02, 0xa0, 0xfd, 0x8a, 0x00, 
-0x2a, 0xfc, 0xfc, 0xff, 0x40, 0xfd, 0xd7, 0x01, 0xa1, 0xfd, 0x74, 0xff, 0xf5, 0xff, 0x0c, 0xfe, 
-0xa1, 0x01, 0x57, 0xfe, 0x2b, 0x02, 0xfa, 0xfe, 0x73, 0x01, 0x3b, 0x00, 0x43, 0x00, 0xc3, 0x00, 
-0x15, 0x00, 0x70, 0x00, 0xdc, 0xff, 0x9e, 0x00, 0xba, 0xfe, 0x4a, 0x00, 0xa4, 0xff, 0x51, 0xff, 
-0xda, 0x00, 0x3a, 0xff, 0x3d, 0x00, 0x6b, 0xff, 0xfb, 0xff, 0x11, 0x00, 0x04, 0x00, 0x8a, 0x00, 
-0xd8, 0xff, 0x18, 0x00, 0xde, 0xff, 0x1f, 0x00, 0xfb, 0xff, 0x4c, 0x00, 0x33, 0x00, 0xd9, 0xff, 
-0x67, 0x00, 0x0e, 0x00, 0xc1, 0xff, 0x08, 0x00, 0x81, 0x00, 0x49, 0x00, 0x3b, 0x00, 0x31, 0x00, 
-0xef, 0xff, 0x59, 0x00, 0xf3, 0xff, 0x2f, 0x00, 0x3b, 0x00, 0x19, 0x00, 0x70, 0x00, 0x11, 0x00, 
-0x6d, 0x00, 0xb3, 0xff, 0x20, 0x00, 0xfb, 0xff, 0x9e, 0xff, 0x7e, 0x00, 0xb0, 0xff, 0xbd, 0xff, 
-0xf6, 0xff, 0xc6, 0xff, 0x24, 0x00, 0x51, 0x00, 0x4e, 0x01, 0xef, 0xff, 0x29, 0xff, 0x2d, 0x00, 
-0x16, 0xff, 0x46, 0x01, 0x73, 0x00, 0xe2, 0xfe, 0xdf, 0xff, 0xc9, 0xfe, 0x3d, 0xff, 0xe4, 0xff, 
-0xd6, 0x00, 0x70, 0xff, 0x88, 0xff, 0x13, 0x00, 0x87, 0xff, 0x7a, 0xff, 0xbf, 0x00, 0x30, 0x00, 
-0x6b, 0x00, 0xa1, 0x00, 0xf7, 0xff, 0xd4, 0x00, 0xdd, 0x00, 0x34, 0x00, 0x7b, 0xff, 0x0e, 0x00, 
-0x00, 0x00, 0x72, 0xff, 0xb1, 0xff, 0x67, 0x00, 0xeb, 0xff, 0x43, 0x00, 0x3b, 0x00, 0x08, 0x00, 
-0x38, 0xff, 0xf5, 0xff, 0x1a, 0x00, 0xe1, 0xff, 0xa0, 0x00, 0xbc, 0xff, 0x33, 0x00, 0x70, 0x00, 
-0x5e, 0x00, 0x0a, 0x00, 0xa6, 0xff, 0x42, 0xff, 0x9e, 0xff, 0xeb, 0x00, 0x80, 0xff, 0x62, 0xff, 
-0xc0, 0xff, 0x7d, 0xff, 0x1b, 0xff, 0x7d, 0x00, 0x6e, 0x00, 0x57, 0x00, 0x50, 0x01, 0xa6, 0xff, 
-0x80, 0x00, 0x17, 0x00, 0xbe, 0xfe, 0x5b, 0xff, 0x0f, 0x00, 0xcd, 0xff, 0x62, 0xff, 0x3f, 0x01, 
-0x9c, 0x00, 0xa5, 0x00, 0xf5, 0xff, 0x70, 0x00, 0x8e, 0xff, 0x18, 0x00, 0xaa, 0x00, 0x2c, 0x00, 
-0x9c, 0x01, 0xcd, 0xfe, 0x29, 0x01, 0xaf, 0x00, 0xc0, 0xff, 0x21, 0x01, 0x51, 0xfe, 0x02, 0xff, 
-0xe4, 0xff, 0x98, 0x00, 0x83, 0x00, 0x8c, 0xff, 0x59, 0x01, 0xa7, 0xff, 0x67, 0xff, 0xeb, 0x00, 
-0x98, 0xff, 0xfa, 0xfe, 0x99, 0xff, 0x1a, 0xff, 0xfe, 0xff, 0xe8, 0xff, 0xf1, 0x01, 0xe3, 0x00, 
-0x6d, 0xff, 0xd0, 0x00, 0x9a, 0xff, 0xe9, 0xfe, 0x8e, 0xff, 0xdb, 0x00, 0x0e, 0x00, 0x70, 0x00, 
-0x87, 0x00, 0xa4, 0xff, 0xc7, 0xff, 0x98, 0xff, 0x5f, 0x01, 0xc2, 0x00, 0x3d, 0x00, 0x1e, 0x00, 
-0xa9, 0xff, 0xa0, 0x00, 0x72, 0xfe, 0x4d, 0xff, 0xa1, 0x00, 0x52, 0xff, 0xae, 0x00, 0xe5, 0xff, 
-0xc5, 0x00, 0xd7, 0xff, 0x15, 0xff, 0xc1, 0x00, 0xc5, 0xfe, 0x7a, 0x00, 0xd7, 0x00, 0x2f, 0xff, 
-0x32, 0xff, 0xef, 0xff, 0x20, 0x00, 0x1b, 0xff, 0x2b, 0x02, 0xff, 0xff, 0x7f, 0xfe, 0xa4, 0x00, 
-0x26, 0xff, 0xb2, 0xff, 0x54, 0x00, 0x8b, 0x01, 0xf0, 0xfe, 0x4d, 0x00, 0xb4, 0x00, 0x11, 0xfe, 
-0xe0, 0x00, 0x66, 0x01, 0x0e, 0x00, 0xc3, 0x00, 0x54, 0x00, 0x97, 0xff, 0x23, 0xff, 0x85, 0x00, 
-0x82, 0x00, 0x9d, 0xff, 0x6e, 0x00, 0xb4, 0x00, 0x5b, 0xff, 0x1b, 0x00, 0x58, 0x01, 0x40, 0xff, 
-0xcc, 0xff, 0xd0, 0x00, 0x79, 0x00, 0x7b, 0xff, 0xf8, 0xfe, 0x03, 0x01, 0x2e, 0xff, 0x6c, 0xfe, 
-0x3e, 0x01, 0x26, 0x00, 0xd2, 0xff, 0xff, 0xfe, 0x38, 0x01, 0x39, 0x00, 0x2f, 0xfe, 0xeb, 0x01, 
-0x07, 0xff, 0xab, 0xfe, 0x13, 0x01, 0x53, 0xff, 0x43, 0xff, 0x68, 0x00, 0x52, 0x01, 0x49, 0xff, 
-0x00, 0x00, 0x5f, 0x00, 0x62, 0xfe, 0x31, 0x01, 0xd6, 0xff, 0x62, 0x00, 0x52, 0x01, 0x41, 0x00, 
-0xd0, 0xff, 0x16, 0xff, 0x70, 0x00, 0xe8, 0xfd, 0x9f, 0x00, 0xd2, 0x00, 0x77, 0xff, 0x32, 0x02, 
-0x49, 0xff, 0x5e, 0xff, 0x71, 0xff, 0xcf, 0xff, 0xac, 0xff, 0x45, 0x00, 0x82, 0x01, 0x6a, 0xff, 
-0xee, 0xff, 0xaa, 0xfe, 0x7e, 0xff, 0x89, 0x00, 0x41, 0x00, 0xee, 0xff, 0x80, 0xff, 0x1b, 0x00, 
-0x72, 0xfe, 0xc7, 0x00, 0x59, 0x01, 0x01, 0x00, 0xc6, 0x00, 0x1b, 0x01, 0x4c, 0x00, 0xd0, 0xff, 
-0xc9, 0xfe, 0x63, 0x00, 0x48, 0x00, 0x3d, 0xff, 0xa0, 0x00, 0xc8, 0xfe, 0x79, 0x00, 0x4b, 0x00, 
-0xde, 0xff, 0x92, 0x01, 0x96, 0xff, 0x3f, 0x01, 0x80, 0x00, 0x0e, 0xff, 0x83, 0x00, 0x95, 0x00, 
-0x0c, 0x01, 0x66, 0xff, 0xa6, 0xff, 0x5d, 0x00, 0xd7, 0xfd, 0x1a, 0xfe, 0xdc, 0x00, 0x09, 0xfe, 
-0xb6, 0x00, 0x3f, 0x01, 0x41, 0x00, 0x22, 0x01, 0x60, 0xfe, 0xb0, 0x00, 0xd4, 0xff, 0x79, 0xff, 
-0x70, 0x00, 0x0d, 0xff, 0xf8, 0xff, 0xba, 0xfe, 0x71, 0x01, 0x17, 0xff, 0x26, 0xfe, 0xe4, 0x01, 
-0x0d, 0x00, 0x7a, 0xff, 0x6e, 0x01, 0xa8, 0x00, 0x87, 0xfd, 0xaa, 0x01, 0xa1, 0x00, 0x71, 0xfe, 
-0x07, 0x02, 0x76, 0xfe, 0xf4, 0xff, 0x64, 0x00, 0xef, 0xff, 0xf2, 0xff, 0xf7, 0xfe, 0x89, 0x00, 
-0x1f, 0xfe, 0x8d, 0x02, 0xc8, 0x00, 0xdc, 0xfd, 0x72, 0x01, 0xc1, 0xfe, 0xf8, 0xff, 0x1c, 0x00, 
-0x80, 0xff, 0x7e, 0xff, 0x3b, 0xff, 0x34, 0x00, 0x83, 0xff, 0x79, 0x00, 0x07, 0xff, 0xa5, 0x01, 
-0x16, 0xff, 0xef, 0xfe, 0xcf, 0x01, 0xfb, 0xfe, 0x64, 0x00, 0xbf, 0xff, 0xc0, 0x00, 0x0f, 0xff, 
-0x68, 0xfe, 0x0c, 0x02, 0x28, 0xfd, 0xa2, 0x01, 0x44, 0x01, 0x91, 0xfd, 0x89, 0x01, 0xe1, 0xfe, 
-0x87, 0x00, 0xe6, 0x00, 0xfc, 0xff, 0xfc, 0x00, 0xec, 0xfd, 0xd4, 0x01, 0x4f, 0xfe, 0x84, 0xfd, 
-0xc2, 0x02, 0x29, 0xfe, 0x16, 0x01, 0x75, 0x00, 0xf6, 0xfe, 0xf0, 0x00, 0x3d, 0x00, 0x9f, 0x00, 
-0xae, 0xfe, 0xaf, 0x00, 0x41, 0xff, 0x7b, 0xff, 0x31, 0x01, 0xa2, 0xff, 0x67, 0x00, 0x80, 0xff, 
-0x81, 0xff, 0x4e, 0xfe, 0x7b, 0x01, 0xc6, 0x00, 0xaa, 0x00, 0x2b, 0x00, 0xc2, 0xfd, 0x20, 0x00, 
-0xcb, 0xfe, 0xb3, 0xff, 0xe2, 0x00, 0xbb, 0x00, 0x7d, 0x00, 0x35, 0x00, 0x50, 0xfe, 0x46, 0x00, 
-0x61, 0x01, 0xc5, 0xfd, 0xb6, 0x02, 0x39, 0xff, 0xdb, 0xff, 0xdd, 0xfe, 0xff, 0xff, 0xc2, 0x02, 
-0xb2, 0xfd, 0x60, 0x03, 0x53, 0xfe, 0x52, 0x01, 0x64, 0x00, 0x05, 0xfd, 0x83, 0x03, 0xfb, 0xfc, 
-0xac, 0x01, 0xfc, 0xff, 0x22, 0x00, 0x0f, 0x01, 0x86, 0xfe, 0x36, 0x02, 0xbb, 0xfd, 0x40, 0x03, 
-0x14, 0xff, 0x63, 0xff, 0x43, 0x02, 0x48, 0xfc, 0x36, 0x02, 0x90, 0xff, 0x7a, 0x00, 0xe9, 0x00, 
-0xe0, 0xfe, 0xd0, 0x01, 0x0e, 0xfd, 0x46, 0x01, 0x63, 0x00, 0x29, 0xfd, 0xbc, 0x02, 0x2a, 0x00, 
-0x0c, 0xff, 0x58, 0x00, 0xe7, 0xfe, 0xb4, 0x00, 0x6d, 0xfe, 0xae, 0x02, 0x87, 0x01, 0xa1, 0xfb, 
-0x61, 0x03, 0xaf, 0xfe, 0x02, 0xfe, 0xf3, 0x02, 0xb9, 0xfd, 0xdf, 0x00, 0x61, 0xfe, 0x48, 0x01, 
-0x9e, 0x01, 0x25, 0xfd, 0x92, 0x01, 0xda, 0xfd, 0x91, 0x01, 0xa3, 0xff, 0x1e, 0x00, 0x98, 0x03, 
-0x5a, 0xfb, 0xc6, 0x02, 0x9a, 0xff, 0x92, 0xfc, 0xbd, 0x01, 0x69, 0xff, 0xfc, 0xff, 0xc9, 0xfc, 
-0xd8, 0x03, 0xd3, 0xff, 0xbf, 0xfb, 0xd9, 0x04, 0xb2, 0xfd, 0x93, 0xfe, 0x3a, 0x03, 0x96, 0xff, 
-0xe0, 0x00, 0x9e, 0xfe, 0x30, 0x02, 0x23, 0xff, 0x7d, 0xfd, 0xdc, 0x03, 0x3a, 0xfb, 0x6f, 0x01, 
-0x20, 0x01, 0x44, 0xfb, 0xae, 0x04, 0x2c, 0xfe, 0x53, 0x00, 0x45, 0x02, 0x9f, 0xff, 0x89, 0xff, 
-0xcb, 0x00, 0x99, 0x03, 0x09, 0xfc, 0x05, 0x01, 0x60, 0x01, 0x73, 0xfb, 0xa2, 0x01, 0xf7, 0x00, 
-0x52, 0xfd, 0x96, 0x01, 0xba, 0x01, 0x61, 0xfd, 0xbf, 0x01, 0x80, 0xff, 0x7b, 0xfd, 0x07, 0x02, 
-0xc9, 0xff, 0x09, 0xfe, 0xf8, 0xff, 0x4c, 0x01, 0xd5, 0xfd, 0xa7, 0x01, 0x5f, 0x00, 0x44, 0xfe, 
-0x98, 0x04, 0x2b, 0xff, 0x19, 0xff, 0xbf, 0x01, 0x0b, 0x00, 0x17, 0xfe, 0x76, 0xff, 0xc7, 0x03, 
-0x21, 0xfc, 0x82, 0xff, 0xd7, 0x03, 0x92, 0xfd, 0xa9, 0x00, 0x8e, 0x01, 0x22, 0x00, 0xac, 0xff, 
-0x20, 0xff, 0xf3, 0x01, 0xb5, 0xfe, 0x32, 0x01, 0x36, 0x02, 0xc2, 0xfd, 0xa9, 0x02, 0xb9, 0xff, 
-0xbb, 0xff, 0x34, 0x00, 0x7c, 0xfd, 0x19, 0x02, 0xfe, 0xfe, 0xeb, 0xfe, 0x14, 0x01, 0x28, 0x00, 
-0x15, 0x00, 0xde, 0x00, 0x1e, 0x02, 0x53, 0xff, 0x30, 0x00, 0x20, 0x01, 0xed, 0xfd, 0x08, 0x00, 
-0x4c, 0x00, 0x6c, 0xfd, 0x07, 0x01, 0xf0, 0xff, 0x48, 0xfe, 0x38, 0x00, 0x5e, 0x00, 0xeb, 0xff, 
-0xa1, 0x00, 0xf3, 0x01, 0x8d, 0xff, 0xde, 0x01, 0xb5, 0xff, 0x21, 0xfd, 0x42, 0x02, 0x3c, 0xff, 
-0x1b, 0xfe, 0x23, 0x01, 0x2b, 0x01, 0x5d, 0xff, 0xb2, 0xff, 0xcd, 0x00, 0x33, 0xfe, 0xfa, 0xfe, 
-0x62, 0xff, 0x58, 0xff, 0xeb, 0xfe, 0x17, 0xff, 0x3b, 0x00, 0xa8, 0xff, 0x8e, 0x00, 0x23, 0xff, 
-0xbe, 0x00, 0x0a, 0xff, 0x41, 0x00, 0xdf, 0x00, 0x59, 0xfd, 0x9b, 0x02, 0x52, 0xff, 0xa4, 0xff, 
-0xca, 0x01, 0x65, 0x00, 0xd7, 0x00, 0x16, 0x00, 0xe5, 0x02, 0x8d, 0xfe, 0x6c, 0x00, 0x2d, 0x02, 
-0x7d, 0xfe, 0xc4, 0x01, 0x7d, 0x01, 0x00, 0x00, 0x9e, 0x00, 0x53, 0x01, 0xa8, 0x00, 0x49, 0xff, 
-0xfb, 0x01, 0xd7, 0x00, 0x0c, 0xff, 0x21, 0x02, 0xdd, 0xfe, 0xdf, 0xfe, 0x93, 0x00, 0xb5, 0xff, 
-0xc5, 0xfe, 0x85, 0xfe, 0x03, 0x00, 0xf7, 0xfc, 0xea, 0xfe, 0xf6, 0xfd, 0xb8, 0xfc, 0xf9, 0xfd, 
-0x1c, 0xfc, 0x77, 0xfe, 0x07, 0xfe, 0xf4, 0xfe, 0x20, 0xff, 0x80, 0x00, 0xa5, 0x00, 0x11, 0x00, 
-0x57, 0x03, 0x16, 0x01, 0x1d, 0x03, 0x9f, 0x03, 0xa6, 0x02, 0xae, 0x04, 0x26, 0x04, 0xba, 0x04, 
-0xaa, 0x03, 0x89, 0x04, 0xe4, 0x02, 0x93, 0x02, 0x6a, 0x04, 0xec, 0x01, 0x1f, 0x02, 0x09, 0x01, 
-0xcf, 0x00, 0x16, 0xff, 0xf7, 0xfe, 0x12, 0xff, 0x1c, 0xfb, 0xa0, 0xfb, 0x56, 0xfa, 0x66, 0xf8, 
-0x70, 0xf7, 0xd9, 0xf6, 0x94, 0xf5, 0xab, 0xf3, 0x27, 0xf5, 0xf9, 0xf1, 0xfe, 0xf2, 0x7c, 0xf9, 
-0x84, 0xf7, 0x18, 0xfc, 0x61, 0x03, 0xbc, 0x02, 0x3d, 0x07, 0x33, 0x0c, 0x7d, 0x0d, 0xf7, 0x0e, 
-0xbc, 0x11, 0xe5, 0x10, 0x7f, 0x10, 0x56, 0x10, 0xc1, 0x0b, 0x30, 0x0c, 0x7d, 0x09, 0xa8, 0x05, 
-0x0d, 0x05, 0xa9, 0x02, 0xa0, 0x00, 0x0b, 0x00, 0xc8, 0xfe, 0x98, 0xfd, 0x1b, 0xfc, 0xee, 0xfa, 
-0x2f, 0xfb, 0x20, 0xf6, 0x65, 0xf7, 0x95, 0xf6, 0x02, 0xf2, 0x30, 0xf2, 0xc5, 0xef, 0x71, 0xeb, 
-0x27, 0xe8, 0xa2, 0xee, 0x41, 0xed, 0x61, 0xf0, 0xd4, 0xfa, 0x06, 0xf9, 0x84, 0x01, 0x15, 0x09, 
-0x66, 0x0b, 0x7f, 0x10, 0x6a, 0x13, 0xa5, 0x14, 0xf0, 0x12, 0x9f, 0x13, 0x20, 0x0f, 0xa9, 0x0a, 
-0x65, 0x0a, 0x9a, 0x03, 0x34, 0x02, 0x5e, 0x01, 0x56, 0xfd, 0xea, 0x00, 0x39, 0x00, 0x04, 0x01, 
-0x57, 0x04, 0x3d, 0x04, 0x4c, 0x05, 0x1f, 0x06, 0x3e, 0x05, 0x52, 0x02, 0x9a, 0x01, 0x6f, 0xfe, 
-0xb2, 0xf8, 0x19, 0xf7, 0x56, 0xf1, 0x28, 0xec, 0xd1, 0xea, 0x73, 0xe4, 0x26, 0xe5, 0x3c, 0xe9, 
-0xd3, 0xea, 0x79, 0xf2, 0x59, 0xf7, 0x76, 0xff, 0x5f, 0x05, 0xa7, 0x0a, 0xe1, 0x12, 0x6f, 0x13, 
-0x88, 0x17, 0x83, 0x16, 0x16, 0x14, 0xfb, 0x11, 0x6f, 0x0b, 0xcd, 0x09, 0xcd, 0x03, 0x91, 0xff, 
-0x9f, 0xfd, 0xd2, 0xfa, 0xf1, 0xfc, 0x6c, 0xfb, 0xa7, 0xfe, 0x8f, 0x02, 0x11, 0x04, 0x45, 0x08, 
-0x33, 0x09, 0xba, 0x09, 0xec, 0x08, 0x79, 0x07, 0x8a, 0x04, 0x00, 0x00, 0xd3, 0xfb, 0xd6, 0xf6, 
-0x3d, 0xf3, 0xf9, 0xef, 0x32, 0xeb, 0x39, 0xe6, 0xd4, 0xe5, 0xf9, 0xe4, 0x13, 0xe9, 0x68, 0xef, 
-0x82, 0xf2, 0x36, 0xfc, 0x9a, 0x01, 0x24, 0x07, 0x5a, 0x10, 0xa2, 0x12, 0x7d, 0x15, 0x41, 0x18, 
-0x76, 0x15, 0xf6, 0x13, 0x05, 0x10, 0xf5, 0x09, 0xdc, 0x05, 0xaf, 0x01, 0x57, 0xfc, 0x96, 0xf9, 
-0x32, 0xfa, 0x3b, 0xf7, 0x43, 0xfa, 0x50, 0xfe, 0x9e, 0xfe, 0xa9, 0x05, 0x29, 0x08, 0x00, 0x09, 
-0x8c, 0x0c, 0x71, 0x0a, 0x63, 0x09, 0xda, 0x07, 0x22, 0x02, 0xa4, 0xfe, 0xfa, 0xf9, 0x61, 0xf4, 
-0x50, 0xf0, 0x5e, 0xed, 0x8a, 0xe8, 0xf8, 0xe4, 0x26, 0xe5, 0x57, 0xe7, 0xf9, 0xed, 0xe1, 0xf0, 
-0x71, 0xf9, 0xe9, 0x00, 0x5b, 0x04, 0x09, 0x0e, 0x3f, 0x11, 0x5f, 0x14, 0x58, 0x17, 0x83, 0x16, 
-0xc2, 0x14, 0xbc, 0x10, 0xf7, 0x0c, 0xf4, 0x06, 0x9f, 0x01, 0xfa, 0xfe, 0xec, 0xf9, 0x1a, 0xf8, 
-0xf7, 0xf7, 0x28, 0xf8, 0x76, 0xfb, 0x01, 0xfe, 0x77, 0x03, 0x58, 0x06, 0xff, 0x08, 0xb5, 0x0c, 
-0xc4, 0x0b, 0x02, 0x0c, 0x65, 0x0a, 0xc1, 0x06, 0x15, 0x03, 0x8d, 0xfe, 0xa7, 0xf9, 0x4f, 0xf5, 
-0xd0, 0xf0, 0xd8, 0xec, 0x25, 0xe9, 0x42, 0xe5, 0x26, 0xe4, 0xe8, 0xe6, 0x60, 0xeb, 0xab, 0xee, 
-0x66, 0xf6, 0xa3, 0xfe, 0x10, 0x03, 0xf8, 0x0b, 0x5d, 0x12, 0x05, 0x13, 0x65, 0x18, 0x27, 0x17, 
-0x76, 0x14, 0x24, 0x14, 0xb3, 0x0d, 0x57, 0x09, 0x3f, 0x04, 0xe4, 0xfe, 0x04, 0xfb, 0xb5, 0xf8, 
-0x98, 0xf7, 0xa4, 0xf7, 0x2d, 0xfa, 0xd8, 0xfb, 0x92, 0x00, 0xdc, 0x03, 0x97, 0x06, 0x69, 0x0b, 
-0x8b, 0x0b, 0xfa, 0x0b, 0xfa, 0x0b, 0x1d, 0x08, 0x68, 0x05, 0x18, 0x02, 0x3b, 0xfd, 0x48, 0xf9, 
-0x14, 0xf7, 0xf8, 0xf1, 0x21, 0xee, 0xbf, 0xeb, 0x04, 0xe5, 0x3a, 0xe7, 0x9c, 0xe8, 0x09, 0xeb, 
-0xdd, 0xf1, 0x91, 0xf6, 0x26, 0xfe, 0x80, 0x02, 0x11, 0x0a, 0x93, 0x0e, 0x7f, 0x10, 0x27, 0x16, 
-0x9b, 0x14, 0x98, 0x14, 0x3e, 0x13, 0xcf, 0x0c, 0xff, 0x09, 0xd4, 0x04, 0xbc, 0xff, 0x11, 0xfd, 
-0xb0, 0xf8, 0x57, 0xf6, 0x9b, 0xf6, 0xa6, 0xf8, 0x79, 0xfa, 0xc1, 0xfe, 0xc1, 0x02, 0x0b, 0x05, 
-0xa1, 0x09, 0x3b, 0x0a, 0xa9, 0x0b, 0x21, 0x0c, 0x23, 0x09, 0xfd, 0x07, 0x6b, 0x04, 0xe7, 0xff, 
-0xb7, 0xfc, 0x3c, 0xf9, 0xeb, 0xf4, 0xb4, 0xf1, 0xa8, 0xef, 0xf9, 0xea, 0x10, 0xe9, 0x6b, 0xe9, 
-0x9b, 0xec, 0x3e, 0xf0, 0xd1, 0xf2, 0x6b, 0xfb, 0x6d, 0xfe, 0x82, 0x03, 0x63, 0x0c, 0xaf, 0x0c, 
-0x84, 0x12, 0xbe, 0x14, 0x95, 0x11, 0x0f, 0x14, 0xab, 0x0e, 0x4c, 0x0a, 0x50, 0x08, 0x1a, 0x01, 
-0xaf, 0xfe, 0x9b, 0xfb, 0x9e, 0xf8, 0xb6, 0xf7, 0x44, 0xf8, 0xe5, 0xf8, 0x99, 0xfc, 0x2b, 0x01, 
-0xa7, 0x01, 0x45, 0x09, 0x8a, 0x09, 0x73, 0x0a, 0xa4, 0x0e, 0x8f, 0x09, 0x6c, 0x0a, 0xbf, 0x06, 
-0x56, 0x02, 0xd9, 0x00, 0x29, 0xfb, 0x60, 0xf9, 0x98, 0xf5, 0x8e, 0xf1, 0xb6, 0xf0, 0x81, 0xed, 
-0xd4, 0xea, 0x0d, 0xea, 0x74, 0xea, 0x5f, 0xee, 0x03, 0xf2, 0x87, 0xf5, 0x0f, 0xfd, 0xeb, 0x00, 
-0x75, 0x05, 0xb3, 0x0b, 0xa5, 0x0c, 0x64, 0x11, 0x9f, 0x12, 0x1d, 0x11, 0xa1, 0x11, 0xec, 0x0d, 
-0x15, 0x0b, 0x8e, 0x07, 0x22, 0x03, 0x75, 0xff, 0x61, 0xfc, 0x3e, 0xfa, 0x06, 0xf9, 0xa4, 0xf9, 
-0x5c, 0xfa, 0xd1, 0xfc, 0x25, 0x00, 0xfe, 0x01, 0x5c, 0x06, 0x14, 0x09, 0xc4, 0x09, 0x79, 0x0c, 
-0x96, 0x0b, 0x0b, 0x0a, 0xfd, 0x08, 0x65, 0x05, 0x13, 0x02, 0x1c, 0xff, 0xa2, 0xfa, 0x8d, 0xf8, 
-0x37, 0xf5, 0xc3, 0xf1, 0x0e, 0xf1, 0xbb, 0xed, 0xb6, 0xeb, 0x96, 0xea, 0xb9, 0xec, 0x7c, 0xef, 
-0xb1, 0xf1, 0x5e, 0xf8, 0x8a, 0xfb, 0x95, 0xff, 0x04, 0x07, 0x9b, 0x08, 0xeb, 0x0c, 0xf6, 0x10, 
-0xcc, 0x0e, 0xba, 0x11, 0xc4, 0x0f, 0x53, 0x0c, 0xa3, 0x0b, 0x05, 0x07, 0x6f, 0x04, 0x14, 0x01, 
-0x92, 0xfe, 0xbb, 0xfb, 0x86, 0xfa, 0x0e, 0xfb, 0x53, 0xfa, 0xeb, 0xfc, 0x4e, 0xff, 0xf4, 0x01, 
-0x67, 0x04, 0x1a, 0x07, 0x8c, 0x09, 0x99, 0x0a, 0x65, 0x0b, 0xdb, 0x09, 0x17, 0x08, 0x56, 0x05, 
-0x91, 0x01, 0x9d, 0xfe, 0xb2, 0xfa, 0x34, 0xf7, 0x49, 0xf6, 0xc3, 0xf3, 0x66, 0xf2, 0x85, 0xf2, 
-0x94, 0xee, 0x9e, 0xed, 0x19, 0xed, 0x22, 0xee, 0xc2, 0xf2, 0x9f, 0xf3, 0x42, 0xf9, 0xfd, 0xfc, 
-0x84, 0xff, 0xf4, 0x06, 0xd3, 0x08, 0x40, 0x0b, 0xa9, 0x0f, 0x48, 0x0f, 0x1b, 0x0f, 0x18, 0x10, 
-0x79, 0x0b, 0xb6, 0x0a, 0xc0, 0x08, 0x20, 0x03, 0x37, 0x03, 0xe3, 0xfe, 0x2a, 0xfc, 0x06, 0xfd, 
-0xa8, 0xfa, 0xac, 0xfb, 0x98, 0xfd, 0x31, 0xff, 0x52, 0x02, 0x68, 0x04, 0x95, 0x07, 0x28, 0x08, 
-0x8a, 0x0a, 0xbe, 0x09, 0x39, 0x07, 0x15, 0x08, 0x81, 0x03, 0xc6, 0x01, 0x04, 0xff, 0xb4, 0xfb, 
-0x98, 0xf9, 0x94, 0xf7, 0xd9, 0xf5, 0xa5, 0xf3, 0x8a, 0xf4, 0xfe, 0xf0, 0x2d, 0xf1, 0xa6, 0xf0, 
-0xc4, 0xed, 0x32, 0xf3, 0x26, 0xf3, 0x50, 0xf4, 0xca, 0xfb, 0x10, 0xfb, 0xe9, 0xff, 0x41, 0x06, 
-0x27, 0x05, 0x2d, 0x0c, 0xf1, 0x0c, 0xcc, 0x0c, 0xc5, 0x10, 0xe9, 0x0c, 0xcc, 0x0d, 0x64, 0x0b, 
-0x8d, 0x07, 0xeb, 0x05, 0x5f, 0x02, 0x28, 0x00, 0xb7, 0xfd, 0x76, 0xfd, 0x53, 0xfb, 0x58, 0xfc, 
-0x54, 0xfd, 0x0f, 0xfe, 0x21, 0x02, 0x3a, 0x02, 0x06, 0x07, 0x15, 0x07, 0x83, 0x07, 0x8f, 0x0a, 
-0x88, 0x05, 0xb7, 0x07, 0x61, 0x04, 0xaf, 0x00, 0x17, 0x02, 0x01, 0xfc, 0x6a, 0xfb, 0x00, 0xfb, 
-0xf3, 0xf5, 0x93, 0xf7, 0x13, 0xf6, 0x4b, 0xf2, 0x2a, 0xf4, 0x81, 0xef, 0xba, 0xee, 0xc4, 0xf1, 
-0xda, 0xf1, 0xd8, 0xf3, 0x04, 0xf8, 0xbe, 0xfa, 0x19, 0xfd, 0x9a, 0x03, 0x32, 0x05, 0xbb, 0x08, 
-0x49, 0x0d, 0x99, 0x0c, 0xdf, 0x0e, 0x30, 0x0f, 0x2c, 0x0c, 0x5f, 0x0c, 0x11, 0x09, 0x5f, 0x06, 
-0xe6, 0x04, 0xcb, 0x00, 0x35, 0xff, 0xa6, 0xfd, 0x00, 0xfc, 0xac, 0xfb, 0xcb, 0xfc, 0x9c, 0xfd, 
-0xb0, 0xff, 0x90, 0x01, 0x20, 0x04, 0xce, 0x06, 0x14, 0x07, 0x55, 0x09, 0x67, 0x09, 0x3a, 0x07, 
-0x5a, 0x07, 0xcd, 0x04, 0x47, 0x02, 0x4b, 0x01, 0x2b, 0xfd, 0xb4, 0xfb, 0x0b, 0xf9, 0x4c, 0xf6, 
-0xbb, 0xf5, 0xf5, 0xf2, 0xc1, 0xf1, 0x97, 0xef, 0xce, 0xec, 0xff, 0xec, 0x93, 0xee, 0xf8, 0xf0, 
-0xf7, 0xf2, 0xf0, 0xf6, 0x13, 0xfb, 0x8f, 0xfe, 0x02, 0x04, 0xd5, 0x07, 0x42, 0x0b, 0x70, 0x0e, 
-0xfb, 0x0f, 0x99, 0x10, 0x83, 0x0f, 0x11, 0x0f, 0x02, 0x0c, 0x94, 0x09, 0x77, 0x07, 0x2a, 0x03, 
-0x4d, 0x01, 0xbc, 0xfd, 0x75, 0xfd, 0x6c, 0xfb, 0x29, 0xfc, 0x24, 0xfd, 0x61, 0xfd, 0xad, 0x02, 
-0xd4, 0x00, 0xf3, 0x06, 0x88, 0x08, 0xfd, 0x06, 0xcc, 0x0c, 0xb2, 0x08, 0x81, 0x08, 0x0f, 0x09, 
-0x68, 0x03, 0xa8, 0x02, 0x81, 0xff, 0x34, 0xfb, 0x3b, 0xfa, 0x6a, 0xf7, 0x28, 0xf5, 0x50, 0xf4, 
-0x50, 0xf2, 0xe8, 0xef, 0x24, 0xf0, 0xb1, 0xec, 0xae, 0xec, 0x93, 0xee, 0x19, 0xef, 0xa5, 0xf2, 
-0xf2, 0xf5, 0x3d, 0xfa, 0xa3, 0xfd, 0x3c, 0x03, 0x46, 0x07, 0xd5, 0x09, 0x67, 0x0e, 0xb6, 0x0f, 
-0x25, 0x10, 0x9a, 0x11, 0x1c, 0x0f, 0xd8, 0x0d, 0x8e, 0x0b, 0xa9, 0x07, 0x0e, 0x05, 0xb3, 0x01, 
-0x6e, 0xff, 0x0e, 0xfd, 0x17, 0xfd, 0xa2, 0xfb, 0x9a, 0xfc, 0x69, 0xfe, 0x3d, 0xff, 0x1a, 0x02, 
-0xd5, 0x04, 0xc0, 0x06, 0x7b, 0x07, 0x65, 0x0a, 0x91, 0x08, 0xcd, 0x07, 0xc6, 0x08, 0xf1, 0x02, 
-0x16, 0x03, 0x92, 0x00, 0x41, 0xfb, 0x49, 0xfc, 0x18, 0xf8, 0x18, 0xf6, 0xcc, 0xf5, 0xc7, 0xf2, 
-0xf0, 0xf2, 0xdf, 0xf1, 0x77, 0xef, 0x16, 0xef, 0x94, 0xee, 0xbb, 0xef, 0xcf, 0xf2, 0x72, 0xf4, 
-0x73, 0xf8, 0x9f, 0xfc, 0x7f, 0xff, 0xc9, 0x04, 0x65, 0x08, 0x58, 0x0b, 0xaa, 0x0e, 0xdc, 0x0f, 
-0xce, 0x10, 0x7a, 0x10, 0xe3, 0x0e, 0x36, 0x0d, 0x71, 0x0a, 0x1d, 0x07, 0x15, 0x05, 0x5f, 0x01, 
-0x16, 0xff, 0x35, 0xfe, 0x1f, 0xfc, 0x26, 0xfc, 0x79, 0xfd, 0x5d, 0xfd, 0xf6, 0xfe, 0x22, 0x03, 
-0xb7, 0x01, 0x8b, 0x06, 0x6f, 0x07, 0xea, 0x05, 0x9b, 0x0a, 0x5f, 0x05, 0x97, 0x06, 0x47, 0x05, 
-0xf1, 0xff, 0x35, 0x01, 0x2f, 0xfc, 0x2a, 0xfa, 0xc9, 0xf8, 0x67, 0xf5, 0x0b, 0xf5, 0xc4, 0xf3, 
-0x7e, 0xf2, 0xe5, 0xf1, 0xeb, 0xf0, 0xb9, 0xee, 0x0b, 0xef, 0xda, 0xef, 0x08, 0xf1, 0x2c, 0xf5, 
-0xf4, 0xf6, 0x16, 0xfb, 0xd7, 0xff, 0x57, 0x02, 0x75, 0x08, 0x27, 0x0b, 0xc1, 0x0d, 0x2a, 0x12, 
-0x04, 0x11, 0x89, 0x12, 0xa1, 0x11, 0x89, 0x0e, 0x7d, 0x0d, 0x92, 0x09, 0xad, 0x06, 0x38, 0x03, 
-0x66, 0x00, 0x8b, 0xfd, 0x5f, 0xfc, 0x63, 0xfb, 0xee, 0xfa, 0xa6, 0xfc, 0x7f, 0xfc, 0x25, 0x00, 
-0x15, 0x02, 0xc5, 0x02, 0x23, 0x07, 0xb7, 0x06, 0xea, 0x07, 0xf3, 0x08, 0x19, 0x06, 0xb9, 0x06, 
-0x44, 0x03, 0x49, 0x01, 0x84, 0xff, 0x27, 0xfb, 0x81, 0xfa, 0x59, 0xf7, 0x3c, 0xf6, 0xe0, 0xf4, 
-0x78, 0xf3, 0x33, 0xf3, 0xf9, 0xf1, 0x93, 0xf1, 0xf9, 0xee, 0xd7, 0xef, 0x19, 0xef, 0x79, 0xf1, 
-0x9f, 0xf4, 0xfd, 0xf4, 0x6e, 0xfc, 0x66, 0xfd, 0x34, 0x03, 0x9d, 0x09, 0xb0, 0x09, 0xd8, 0x10, 
-0xbe, 0x11, 0x2e, 0x12, 0x4a, 0x14, 0x92, 0x11, 0x12, 0x10, 0x8c, 0x0d, 0x4f, 0x09, 0x96, 0x06, 
-0x22, 0x03, 0x67, 0xff, 0x3e, 0xfe, 0x7f, 0xfb, 0xe7, 0xfa, 0x59, 0xfb, 0xb1, 0xfa, 0xe9, 0xfc, 
-0x70, 0xff, 0x28, 0x00, 0x67, 0x03, 0x2b, 0x06, 0x7f, 0x05, 0xe8, 0x08, 0xdf, 0x07, 0x8e, 0x06, 
-0x02, 0x08, 0x5c, 0x03, 0xb5, 0x03, 0xfc, 0x00, 0x25, 0xfd, 0x95, 0xfd, 0x69, 0xf8, 0xdd, 0xf7, 
-0xb8, 0xf6, 0xc1, 0xf2, 0x8c, 0xf4, 0xdb, 0xf1, 0x0b, 0xf1, 0x60, 0xf1, 0xa1, 0xed, 0x65, 0xef, 
-0x46, 0xef, 0x02, 0xf1, 0x10, 0xf5, 0x8e, 0xf6, 0x13, 0xfc, 0xfa, 0xff, 0x12, 0x04, 0xc2, 0x09, 
-0x9e, 0x0b, 0x47, 0x10, 0x81, 0x11, 0xe2, 0x11, 0x3f, 0x13, 0xe0, 0x0f, 0x52, 0x0f, 0x97, 0x0b, 
-0xee, 0x07, 0x11, 0x06, 0x75, 0x01, 0x08, 0x00, 0x3f, 0xfd, 0x64, 0xfb, 0xfc, 0xfa, 0x63, 0xfa, 
-0xeb, 0xfb, 0xe6, 0xfc, 0x32, 0x00, 0x01, 0x01, 0x61, 0x04, 0x96, 0x06, 0xcd, 0x05, 0x34, 0x0a, 
-0x0d, 0x07, 0x5d, 0x07, 0x11, 0x08, 0x76, 0x02, 0x2a, 0x04, 0xad, 0xff, 0x9a, 0xfc, 0x07, 0xfd, 
-0x3b, 0xf7, 0x00, 0xf8, 0x64, 0xf6, 0xaa, 0xf2, 0x81, 0xf5, 0x74, 0xf1, 0x74, 0xf1, 0x22, 0xf2, 
-0xfa, 0xec, 0x0c, 0xf1, 0x67, 0xef, 0xa3, 0xf1, 0x60, 0xf6, 0xdf, 0xf6, 0x6e, 0xfd, 0xfd, 0x00, 
-0xa6, 0x04, 0xb4, 0x0a, 0x0b, 0x0d, 0x1b, 0x10, 0x39, 0x13, 0x2e, 0x12, 0x15, 0x13, 0xdc, 0x11, 
-0x6d, 0x0e, 0x91, 0x0c, 0xdd, 0x08, 0xa9, 0x04, 0x7d, 0x02, 0xf0, 0xfe, 0x89, 0xfc, 0x18, 0xfc, 
-0xb6, 0xf9, 0x2a, 0xfb, 0x22, 0xfb, 0x40, 0xfc, 0x05, 0x00, 0x9e, 0xff, 0x39, 0x04, 0xe8, 0x04, 
-0xa3, 0x05, 0x70, 0x08, 0x00, 0x06, 0xf7, 0x06, 0xb9, 0x05, 0xf0, 0x02, 0x9f, 0x02, 0xb6, 0xff, 
-0x5e, 0xfd, 0xed, 0xfb, 0xfd, 0xf8, 0xfb, 0xf7, 0xa5, 0xf6, 0xb8, 0xf4, 0xee, 0xf4, 0x77, 0xf3, 
-0x5a, 0xf2, 0xe9, 0xf2, 0xbe, 0xef, 0x11, 0xf0, 0xc3, 0xf0, 0x5c, 0xf1, 0x30, 0xf5, 0x38, 0xf7, 
-0x55, 0xfb, 0x07, 0x00, 0x52, 0x03, 0xe4, 0x08, 0x0b, 0x0c, 0xb4, 0x0e, 0x4c, 0x12, 0x8f, 0x11, 
-0x9e, 0x12, 0x93, 0x11, 0x42, 0x0e, 0xdb, 0x0c, 0x00, 0x09, 0x09, 0x05, 0x74, 0x02, 0xdf, 0xfe, 
-0x99, 0xfc, 0x6c, 0xfb, 0x17, 0xfa, 0x42, 0xfa, 0xeb, 0xfa, 0x40, 0xfb, 0x5f, 0xfe, 0xf0, 0xff, 
-0x15, 0x01, 0xcc, 0x05, 0x6d, 0x04, 0x5c, 0x07, 0xc3, 0x08, 0x4e, 0x05, 0x07, 0x09, 0xdf, 0x03, 
-0xf6, 0x03, 0x1a, 0x03, 0x8c, 0xfd, 0xc7, 0xff, 0xf6, 0xf9, 0x74, 0xf9, 0xa9, 0xf8, 0xf0, 0xf4, 
-0xb8, 0xf5, 0xf9, 0xf3, 0xe7, 0xf2, 0x02, 0xf3, 0xa6, 0xf1, 0x14, 0xf0, 0xcf, 0xf0, 0xad, 0xf0, 
-0xa8, 0xf2, 0x48, 0xf6, 0x26, 0xf8, 0x63, 0xfd, 0xad, 0x01, 0xdd, 0x04, 0xf2, 0x0a, 0xd7, 0x0c, 
-0xef, 0x0f, 0xc6, 0x12, 0x5f, 0x11, 0x4d, 0x12, 0x2e, 0x10, 0xe8, 0x0c, 0x25, 0x0b, 0xd2, 0x06, 
-0xc8, 0x03, 0x1d, 0x01, 0x4f, 0xfd, 0x33, 0xfc, 0x80, 0xfa, 0x91, 0xf9, 0x7c, 0xfa, 0xc7, 0xfa, 
-0x02, 0xfc, 0x1d, 0xfe, 0x0c, 0x01, 0xfc, 0x00, 0x34, 0x05, 0x1a, 0x05, 0x10, 0x06, 0xca, 0x08, 
-0xd2, 0x04, 0x6f, 0x08, 0x80, 0x04, 0x94, 0x03, 0x26, 0x04, 0xc4, 0xfe, 0x61, 0x00, 0xc3, 0xfc, 
-0xc3, 0xfa, 0x8e, 0xfa, 0xa2, 0xf7, 0x11, 0xf7, 0x45, 0xf6, 0x7c, 0xf4, 0x56, 0xf3, 0x2e, 0xf3, 
-0x24, 0xf0, 0xc5, 0xf0, 0x79, 0xf0, 0xf7, 0xf0, 0xcb, 0xf5, 0xd7, 0xf6, 0x3b, 0xfd, 0xeb, 0x01, 
-0xad, 0x05, 0xef, 0x0b, 0xd4, 0x0d, 0xd5, 0x10, 0x33, 0x12, 0x7c, 0x11, 0x5a, 0x10, 0x41, 0x0e, 
-0xd9, 0x0a, 0x41, 0x08, 0x30, 0x05, 0x8d, 0x01, 0x16, 0x00, 0xf2, 0xfc, 0xf0, 0xfb, 0x85, 0xfb, 
-0x58, 0xfa, 0x5e, 0xfb, 0xb5, 0xfb, 0xa6, 0xfc, 0xc1, 0xfe, 0xb3, 0xff, 0xf5, 0x01, 0x80, 0x03, 
-0x47, 0x04, 0xa6, 0x05, 0x8b, 0x05, 0xdd, 0x05, 0x6a, 0x05, 0xe3, 0x04, 0x2c, 0x04, 0x17, 0x03, 
-0x12, 0x02, 0x83, 0x00, 0xab, 0xfe, 0x0b, 0xfd, 0x5e, 0xfa, 0xa5, 0xf8, 0x75, 0xf6, 0x2d, 0xf4, 
-0xbc, 0xf3, 0x32, 0xf1, 0x5d, 0xf1, 0x27, 0xf0, 0xf8, 0xee, 0x41, 0xf0, 0x93, 0xf0, 0x58, 0xf4, 
-0x91, 0xf7, 0x01, 0xfc, 0xcf, 0x01, 0x26, 0x06, 0x17, 0x0b, 0xa4, 0x0e, 0x31, 0x11, 0x5d, 0x12, 
-0x49, 0x12, 0x01, 0x11, 0x80, 0x0e, 0x0d, 0x0c, 0xc2, 0x08, 0xd3, 0x05, 0xf5, 0x02, 0x21, 0x00, 
-0x5b, 0xfe, 0x9a, 0xfc, 0xb7, 0xfb, 0x76, 0xfb, 0x9f, 0xfb, 0x25, 0xfc, 0x3a, 0xfd, 0x57, 0xfe, 
-0xcf, 0xff, 0x6e, 0x01, 0xcd, 0x02, 0x28, 0x04, 0x32, 0x05, 0x8f, 0x05, 0x1a, 0x06, 0x3f, 0x06, 
-0x5f, 0x05, 0x07, 0x06, 0x79, 0x04, 0xac, 0x03, 0xd6, 0x02, 0x13, 0x00, 0xdd, 0xfe, 0xfe, 0xfb, 
-0x45, 0xf9, 0x8a, 0xf7, 0x9a, 0xf4, 0x03, 0xf3, 0x4a, 0xf2, 0x07, 0xf0, 0x83, 0xf0, 0x45, 0xef, 
-0x98, 0xee, 0xab, 0xf0, 0x31, 0xf1, 0x31, 0xf5, 0x6a, 0xf9, 0x88, 0xfd, 0xb8, 0x03, 0xbc, 0x07, 
-0x1a, 0x0c, 0xb8, 0x0f, 0xc3, 0x10, 0x20, 0x12, 0x03, 0x11, 0x20, 0x0f, 0x3d, 0x0d, 0x0c, 0x0a, 
-0x8e, 0x07, 0xe7, 0x04, 0x94, 0x02, 0x7e, 0x00, 0x8f, 0xfe, 0xc6, 0xfd, 0x5a, 0xfc, 0x72, 0xfc, 
-0x20, 0xfc, 0x2a, 0xfc, 0x6e, 0xfd, 0x7e, 0xfd, 0xb7, 0xff, 0x7c, 0x00, 0xe8, 0x01, 0xdc, 0x03, 
-0x19, 0x04, 0xbd, 0x05, 0xdb, 0x05, 0x36, 0x06, 0x32, 0x06, 0xe8, 0x05, 0x5e, 0x05, 0x13, 0x04, 
-0xf0, 0x02, 0x78, 0x00, 0x61, 0xfe, 0x8f, 0xfb, 0x8f, 0xf8, 0x7b, 0xf6, 0xd1, 0xf3, 0x26, 0xf2, 
-0x45, 0xf1, 0xbf, 0xef, 0x2f, 0xf0, 0xd5, 0xef, 0xe2, 0xef, 0xc0, 0xf1, 0xfb, 0xf2, 0x3e, 0xf6, 
-0x80, 0xfa, 0x13, 0xfe, 0x32, 0x03, 0x8b, 0x07, 0x86, 0x0a, 0x8f, 0x0e, 0x81, 0x0f, 0x77, 0x10, 
-0xe0, 0x10, 0x55, 0x0e, 0x7c, 0x0d, 0xd3, 0x0a, 0xad, 0x07, 0xa3, 0x06, 0x3d, 0x03, 0xa9, 0x01, 
-0x3a, 0x00, 0xde, 0xfd, 0xd8, 0xfd, 0xd6, 0xfc, 0x87, 0xfc, 0x4e, 0xfd, 0x32, 0xfd, 0x61, 0xfe, 
-0xa4, 0xff, 0x95, 0x00, 0x41, 0x02, 0x5e, 0x03, 0x4b, 0x04, 0xfe, 0x04, 0xb2, 0x05, 0x58, 0x05, 
-0xc1, 0x05, 0x42, 0x05, 0x08, 0x04, 0xd1, 0x03, 0x4c, 0x01, 0xd5, 0xff, 0xb2, 0xfd, 0x9d, 0xfa, 
-0x49, 0xf9, 0xb3, 0xf6, 0xf1, 0xf4, 0xef, 0xf3, 0x4e, 0xf2, 0x87, 0xf1, 0x8b, 0xf1, 0x16, 0xf0, 
-0xe5, 0xf0, 0x56, 0xf1, 0xeb, 0xf1, 0x1b, 0xf6, 0x07, 0xf8, 0x37, 0xfd, 0xf4, 0x01, 0x31, 0x05, 
-0xa2, 0x0a, 0x64, 0x0c, 0xff, 0x0e, 0x80, 0x10, 0x6c, 0x0f, 0x93, 0x0f, 0x56, 0x0d, 0x50, 0x0b, 
-0xb2, 0x09, 0xef, 0x06, 0x3e, 0x05, 0xe6, 0x02, 0x1a, 0x01, 0x5e, 0xff, 0x0d, 0xfe, 0x55, 0xfd, 
-0xb1, 0xfc, 0x0d, 0xfd, 0x14, 0xfd, 0x3a, 0xfe, 0x21, 0xff, 0x03, 0x00, 0x9b, 0x01, 0x5a, 0x02, 
-0x27, 0x03, 0x44, 0x04, 0x49, 0x04, 0xe0, 0x04, 0x65, 0x05, 0x85, 0x04, 0x44, 0x05, 0xa1, 0x03, 
-0x6b, 0x02, 0x2d, 0x01, 0xbc, 0xfd, 0x9f, 0xfc, 0x3d, 0xf9, 0x54, 0xf7, 0xe8, 0xf5, 0x92, 0xf3, 
-0x59, 0xf3, 0x3b, 0xf2, 0x9f, 0xf1, 0xa7, 0xf1, 0x16, 0xf1, 0xc9, 0xf1, 0xed, 0xf2, 0x0b, 0xf5, 
-0x8a, 0xf8, 0x40, 0xfc, 0xa4, 0x00, 0xba, 0x04, 0x4e, 0x08, 0x33, 0x0b, 0x2c, 0x0d, 0x3a, 0x0e, 
-0x68, 0x0e, 0xe8, 0x0d, 0xbe, 0x0c, 0x78, 0x0b, 0xe5, 0x09, 0x33, 0x08, 0x70, 0x06, 0x6e, 0x04, 
-0xa0, 0x02, 0xcc, 0x00, 0x5b, 0xff, 0x3c, 0xfe, 0x91, 0xfd, 0x51, 0xfd, 0x8e, 0xfd, 0x10, 0xfe, 
-0xfb, 0xfe, 0xe7, 0xff, 0xcf, 0x00, 0xff, 0x01, 0x86, 0x02, 0x8e, 0x03, 0x2a, 0x04, 0x34, 0x04, 
-0x10, 0x05, 0x3a, 0x04, 0x42, 0x04, 0x47, 0x03, 0x78, 0x01, 0x91, 0x00, 0x6e, 0xfd, 0x08, 0xfc, 
-0xd1, 0xf9, 0x5a, 0xf7, 0xb2, 0xf6, 0x67, 0xf4, 0x21, 0xf4, 0x2f, 0xf3, 0x78, 0xf2, 0x5f, 0xf2, 
-0x9f, 0xf1, 0x5e, 0xf2, 0x2c, 0xf3, 0x88, 0xf5, 0x7b, 0xf8, 0x94, 0xfc, 0x4f, 0x00, 0x33, 0x04, 
-0xe2, 0x07, 0xf3, 0x09, 0x7c, 0x0c, 0xf9, 0x0c, 0x5a, 0x0d, 0x23, 0x0d, 0xdb, 0x0b, 0x52, 0x0b, 
-0x80, 0x09, 0x2a, 0x08, 0x7d, 0x06, 0x4b, 0x04, 0xd1, 0x02, 0x2c, 0x01, 0x8d, 0xff, 0x09, 0xff, 
-0x01, 0xfe, 0x0f, 0xfe, 0x64, 0xfe, 0x69, 0xfe, 0xd4, 0xff, 0xb2, 0xff, 0x34, 0x01, 0xe1, 0x01, 
-0x27, 0x02, 0xcb, 0x03, 0x31, 0x03, 0x72, 0x04, 0x02, 0x04, 0xb5, 0x03, 0xc1, 0x03, 0xf2, 0x01, 
-0x6b, 0x01, 0x3e, 0xff, 0x9d, 0xfd, 0xd5, 0xfb, 0xa8, 0xf9, 0xdc, 0xf7, 0x5c, 0xf6, 0xe8, 0xf4, 
-0xe2, 0xf3, 0xb5, 0xf3, 0x78, 0xf2, 0x10, 0xf3, 0x46, 0xf2, 0x10, 0xf3, 0x13, 0xf5, 0x25, 0xf6, 
-0xf8, 0xfa, 0x54, 0xfd, 0xf2, 0x01, 0xd7, 0x05, 0xd5, 0x07, 0xad, 0x0b, 0xbb, 0x0b, 0x3d, 0x0d, 
-0x39, 0x0d, 0xfd, 0x0b, 0x36, 0x0c, 0x03, 0x0a, 0x23, 0x09, 0x7f, 0x07, 0x23, 0x05, 0x16, 0x04, 
-0xb3, 0x01, 0x96, 0x00, 0x8b, 0xff, 0x7b, 0xfe, 0x95, 0xfe, 0x47, 0xfe, 0xa1, 0xfe, 0xff, 0xfe, 
-0x92, 0xff, 0xfe, 0xff, 0xe7, 0x00, 0x1b, 0x01, 0xd0, 0x01, 0x71, 0x02, 0x38, 0x02, 0x50, 0x03, 
-0xa0, 0x02, 0xb4, 0x02, 0x55, 0x02, 0xa2, 0x00, 0x46, 0x00, 0x29, 0xfe, 0xe9, 0xfc, 0xae, 0xfb, 
-0xa6, 0xf9, 0x13, 0xf9, 0x49, 0xf7, 0x5a, 0xf6, 0x58, 0xf5, 0x1e, 0xf4, 0x6c, 0xf3, 0xe9, 0xf2, 
-0x26, 0xf3, 0x0f, 0xf4, 0x2d, 0xf6, 0xca, 0xf8, 0x40, 0xfc, 0x08, 0x00, 0x4b, 0x03, 0xa1, 0x06, 
-0x06, 0x09, 0xda, 0x0a, 0x66, 0x0c, 0x6b, 0x0c, 0xd6, 0x0c, 0xff, 0x0b, 0xda, 0x0a, 0xf0, 0x09, 
-0x06, 0x08, 0xc3, 0x06, 0xbb, 0x04, 0x51, 0x03, 0x8a, 0x01, 0x6e, 0x00, 0x56, 0xff, 0x6c, 0xfe, 
-0x6c, 0xfe, 0x8e, 0xfd, 0x5d, 0xfe, 0x34, 0xfe, 0xa4, 0xfe, 0xe2, 0xff, 0x87, 0xff, 0x35, 0x01, 
-0x69, 0x01, 0xe4, 0x01, 0x22, 0x03, 0x73, 0x02, 0x35, 0x03, 0x82, 0x02, 0xa3, 0x01, 0xf6, 0x00, 
-0x28, 0xff, 0xc0, 0xfd, 0x78, 0xfc, 0x84, 0xfa, 0x7c, 0xf9, 0x73, 0xf8, 0xf4, 0xf6, 0xaa, 0xf6, 
-0x73, 0xf5, 0xf3, 0xf4, 0x98, 0xf4, 0x1f, 0xf4, 0xbf, 0xf4, 0xb9, 0xf5, 0xb5, 0xf7, 0x48, 0xfa, 
-0xa3, 0xfd, 0x76, 0x00, 0xe6, 0x03, 0x6f, 0x06, 0x29, 0x08, 0xb7, 0x0a, 0xa5, 0x0a, 0xde, 0x0b, 
-0xd6, 0x0b, 0xb6, 0x0a, 0x54, 0x0b, 0x2e, 0x09, 0xb9, 0x08, 0x4d, 0x07, 0x2d, 0x05, 0x69, 0x04, 
-0x3c, 0x02, 0x4a, 0x01, 0x66, 0x00, 0x61, 0xff, 0x1c, 0xff, 0xf3, 0xfe, 0xaa, 0xfe, 0xff, 0xfe, 
-0x34, 0xff, 0x37, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0x60, 0x00, 0xe4, 0x00, 0xfe, 0x00, 0x3c, 0x01, 
-0x3e, 0x01, 0x9f, 0x00, 0xa8, 0xff, 0xc4, 0xfe, 0xb4, 0xfc, 0xd3, 0xfb, 0xfc, 0xf9, 0x99, 0xf8, 
-0x4f, 0xf8, 0x65, 0xf6, 0xa4, 0xf6, 0xb8, 0xf5, 0x91, 0xf4, 0x2c, 0xf5, 0x1d, 0xf4, 0x65, 0xf5, 
-0x3c, 0xf7, 0xe8, 0xf8, 0xe5, 0xfc, 0x8a, 0xff, 0xd0, 0x02, 0x12, 0x06, 0x99, 0x07, 0xe6, 0x09, 
-0xbb, 0x0a, 0xdc, 0x0a, 0xa8, 0x0b, 0xd6, 0x0a, 0x85, 0x0a, 0x03, 0x0a, 0x53, 0x08, 0xab, 0x07, 
-0xee, 0x05, 0xa0, 0x04, 0x7b, 0x03, 0xeb, 0x01, 0x21, 0x01, 0x13, 0x00, 0x6e, 0xff, 0x41, 0xff, 
-0x18, 0xff, 0x4f, 0xff, 0x8e, 0xff, 0xd0, 0xff, 0x31, 0x00, 0x51, 0x00, 0xc6, 0x00, 0xcf, 0x00, 
-0xee, 0x00, 0xd9, 0x00, 0x79, 0x00, 0xf2, 0xff, 0x25, 0xff, 0xfb, 0xfd, 0xfd, 0xfc, 0xb2, 0xfb, 
-0x7c, 0xfa, 0xc9, 0xf9, 0x63, 0xf8, 0xf8, 0xf7, 0x22, 0xf7, 0x35, 0xf6, 0x4f, 0xf6, 0xa9, 0xf5, 
-0xa8, 0xf5, 0xbe, 0xf6, 0x31, 0xf7, 0x81, 0xf9, 0xd2, 0xfb, 0xe3, 0xfd, 0x80, 0x01, 0xec, 0x02, 
-0xac, 0x05, 0x86, 0x07, 0x31, 0x08, 0x0b, 0x0a, 0xba, 0x09, 0x0c, 0x0a, 0x4f, 0x0a, 0x47, 0x09, 
-0x30, 0x09, 0xfe, 0x07, 0xb4, 0x06, 0xc0, 0x05, 0x17, 0x04, 0x1d, 0x03, 0xee, 0x01, 0x01, 0x01, 
-0x68, 0x00, 0xc1, 0xff, 0x88, 0xff, 0x63, 0xff, 0x38, 0xff, 0x75, 0xff, 0x70, 0xff, 0xa7, 0xff, 
-0xc2, 0xff, 0xd4, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xdf, 0xff, 0x75, 0xff, 0x30, 0xff, 0x62, 0xfe, 
-0xde, 0xfd, 0xc3, 0xfc, 0x0f, 0xfc, 0xdd, 0xfa, 0x88, 0xf9, 0x03, 0xf9, 0x97, 0xf7, 0x7e, 0xf7, 
-0xfb, 0xf6, 0xc3, 0xf6, 0x51, 0xf7, 0x57, 0xf7, 0xc1, 0xf8, 0x9a, 0xf9, 0x3c, 0xfb, 0xa1, 0xfd, 
-0xe8, 0xfe, 0x1c, 0x02, 0x8f, 0x03, 0x72, 0x05, 0x70, 0x07, 0xa1, 0x07, 0x57, 0x09, 0x0a, 0x09, 
-0x3d, 0x09, 0x4b, 0x09, 0x26, 0x08, 0x26, 0x08, 0xec, 0x06, 0xf7, 0x05, 0x24, 0x05, 0xc5, 0x03, 
-0xe4, 0x02, 0x34, 0x02, 0x66, 0x01, 0xca, 0x00, 0x72, 0x00, 0x88, 0xff, 0x8b, 0xff, 0x47, 0xff, 
-0x25, 0xff, 0x58, 0xff, 0x28, 0xff, 0x58, 0xff, 0x51, 0xff, 0x95, 0xff, 0x3a, 0xff, 0x2e, 0xff, 
-0x95, 0xfe, 0x0e, 0xfe, 0x9d, 0xfd, 0xad, 0xfc, 0x71, 0xfc, 0x24, 0xfb, 0xb7, 0xfa, 0x20, 0xfa, 
-0x6e, 0xf9, 0xb2, 0xf9, 0x05, 0xf9, 0x50, 0xf9, 0x2a, 0xf9, 0x8a, 0xf9, 0x46, 0xfa, 0xa2, 0xfa, 
-0x28, 0xfc, 0x02, 0xfd, 0xa5, 0xfe, 0x88, 0x00, 0xc8, 0x01, 0x88, 0x03, 0xa9, 0x04, 0x99, 0x05, 
-0x92, 0x06, 0x2e, 0x07, 0x94, 0x07, 0xd4, 0x07, 0xdd, 0x07, 0x9c, 0x07, 0xa0, 0x07, 0xd4, 0x06, 
-0x75, 0x06, 0x9b, 0x05, 0x9f, 0x04, 0x23, 0x04, 0xdd, 0x02, 0x50, 0x02, 0x3d, 0x01, 0x7f, 0x00, 
-0xc6, 0xff, 0x28, 0xff, 0xad, 0xfe, 0xd6, 0xfd, 0xaa, 0xfd, 0xce, 0xfc, 0x8a, 0xfc, 0x49, 0xfc, 
-0x85, 0xfb, 0xc3, 0xfb, 0x61, 0xfb, 0x6a, 0xfb, 0xea, 0xfb, 0xa0, 0xfb, 0x1b, 0xfc, 0x27, 0xfc, 
-0x0d, 0xfc, 0x58, 0xfc, 0xf5, 0xfb, 0xd3, 0xfb, 0xdd, 0xfb, 0x88, 0xfb, 0x09, 0xfc, 0x38, 0xfc, 
-0xd6, 0xfc, 0xbf, 0xfd, 0x90, 0xfe, 0xa4, 0xff, 0x72, 0x00, 0x61, 0x01, 0xf6, 0x01, 0xdc, 0x02, 
-0x6e, 0x03, 0x21, 0x04, 0xb3, 0x04, 0x24, 0x05, 0x85, 0x05, 0x97, 0x05, 0xc2, 0x05, 0x80, 0x05, 
-0x48, 0x05, 0x2d, 0x05, 0xbe, 0x04, 0xac, 0x04, 0x40, 0x04, 0x87, 0x03, 0x3e, 0x03, 0x25, 0x02, 
-0xd4, 0x01, 0x22, 0x01, 0x54, 0x00, 0x4a, 0x00, 0x4d, 0xff, 0x37, 0xff, 0xba, 0xfe, 0x0e, 0xfe, 
-0xef, 0xfd, 0x4a, 0xfd, 0x1d, 0xfd, 0xcd, 0xfc, 0x9c, 0xfc, 0x54, 0xfc, 0x20, 0xfc, 0xe4, 0xfb, 
-0x82, 0xfb, 0x90, 0xfb, 0x59, 0xfb, 0x87, 0xfb, 0xd0, 0xfb, 0xe9, 0xfb, 0x62, 0xfc, 0x99, 0xfc, 
-0xea, 0xfc, 0x71, 0xfd, 0xd1, 0xfd, 0x8b, 0xfe, 0x20, 0xff, 0xfd, 0xff, 0xb1, 0x00, 0x94, 0x01, 
-0x44, 0x02, 0xbd, 0x02, 0x51, 0x03, 0x37, 0x03, 0x90, 0x03, 0x5b, 0x03, 0x19, 0x03, 0x2e, 0x03, 
-0xa8, 0x02, 0xcd, 0x02, 0xb2, 0x02, 0xa5, 0x02, 0xb8, 0x02, 0x9a, 0x02, 0x82, 0x02, 0x57, 0x02, 
-0x45, 0x02, 0x0b, 0x02, 0x13, 0x02, 0xe7, 0x01, 0xea, 0x01, 0xbf, 0x01, 0x94, 0x01, 0x5c, 0x01, 
-0xeb, 0x00, 0xa1, 0x00, 0xfd, 0xff, 0xa8, 0xff, 0x18, 0xff, 0x8f, 0xfe, 0x35, 0xfe, 0x8d, 0xfd, 
-0x3b, 0xfd, 0xe9, 0xfc, 0x6a, 0xfc, 0x43, 0xfc, 0xcd, 0xfb, 0x9b, 0xfb, 0xb4, 0xfb, 0xaa, 0xfb, 
-0x3d, 0xfc, 0x7c, 0xfc, 0x24, 0xfd, 0xaa, 0xfd, 0x22, 0xfe, 0x8d, 0xfe, 0xc2, 0xfe, 0x66, 0xff, 
-0x88, 0xff, 0x97, 0x00, 0x1e, 0x01, 0xd2, 0x01, 0xba, 0x02, 0x99, 0x02, 0x06, 0x03, 0xb7, 0x02, 
-0x7a, 0x02, 0x5d, 0x02, 0xed, 0x01, 0xe0, 0x01, 0xbd, 0x01, 0x97, 0x01, 0xa6, 0x01, 0x66, 0x01, 
-0x25, 0x01, 0x12, 0x01, 0x9d, 0x00, 0xbe, 0x00, 0x92, 0x00, 0x91, 0x00, 0xc1, 0x00, 0x82, 0x00, 
-0xfc, 0x00, 0xcc, 0x00, 0x0d, 0x01, 0x18, 0x01, 0xd2, 0x00, 0x0a, 0x01, 0xa3, 0x00, 0x85, 0x00, 
-0x69, 0x00, 0xba, 0xff, 0x9b, 0xff, 0x13, 0xff, 0x77, 0xfe, 0x8e, 0xfe, 0xba, 0xfd, 0xc3, 0xfd, 
-0x78, 0xfd, 0x08, 0xfd, 0x5a, 0xfd, 0xc4, 0xfc, 0x1f, 0xfd, 0x18, 0xfd, 0x2e, 0xfd, 0xdd, 0xfd, 
-0xf9, 0xfd, 0xca, 0xfe, 0x2f, 0xff, 0x9e, 0xff, 0x3c, 0x00, 0x7e, 0x00, 0x0e, 0x01, 0x5e, 0x01, 
-0x8f, 0x01, 0x16, 0x02, 0x18, 0x02, 0x68, 0x02, 0x60, 0x02, 0xfd, 0x01, 0x26, 0x02, 0x76, 0x01, 
-0x8c, 0x01, 0x1d, 0x01, 0xa9, 0x00, 0xc1, 0x00, 0x36, 0x00, 0x88, 0x00, 0x2f, 0x00, 0x30, 0x00, 
-0x1f, 0x00, 0xdd, 0xff, 0x2e, 0x00, 0xc1, 0xff, 0x20, 0x00, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x00, 
-0x48, 0x00, 0xb2, 0x00, 0x56, 0x00, 0x68, 0x00, 0x40, 0x00, 0xd1, 0xff, 0xec, 0xff, 0x6b, 0xff, 
-0x59, 0xff, 0x27, 0xff, 0xcc, 0xfe, 0xb8, 0xfe, 0x53, 0xfe, 0x37, 0xfe, 0x01, 0xfe, 0xf0, 0xfd, 
-0x22, 0xfe, 0x1c, 0xfe, 0x77, 0xfe, 0xd2, 0xfe, 0x1a, 0xff, 0xaf, 0xff, 0xdf, 0xff, 0x30, 0x00, 
-0x64, 0x00, 0x96, 0x00, 0xe7, 0x00, 0x1b, 0x01, 0x53, 0x01, 0x98, 0x01, 0xae, 0x01, 0xaa, 0x01, 
-0xca, 0x01, 0x3f, 0x01, 0x53, 0x01, 0xdf, 0x00, 0x96, 0x00, 0xab, 0x00, 0x1a, 0x00, 0x72, 0x00, 
-0xfc, 0xff, 0xe8, 0xff, 0xf3, 0xff, 0x7e, 0xff, 0xdf, 0xff, 0x98, 0xff, 0xc6, 0xff, 0xd5, 0xff, 
-0xa0, 0xff, 0xea, 0xff, 0xa8, 0xff, 0xe4, 0xff, 0xd9, 0xff, 0xc5, 0xff, 0xf8, 0xff, 0xe6, 0xff, 
-0x1a, 0x00, 0xfd, 0xff, 0xe4, 0xff, 0xb4, 0xff, 0x90, 0xff, 0x84, 0xff, 0x6b, 0xff, 0x4c, 0xff, 
-0x26, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x73, 0xff, 0x88, 0xff, 0xa9, 0xff, 0xd8, 0xff, 0x15, 0x00, 
-0x41, 0x00, 0x6a, 0x00, 0x7e, 0x00, 0x72, 0x00, 0xa1, 0x00, 0x7f, 0x00, 0x9d, 0x00, 0x76, 0x00, 
-0x5e, 0x00, 0x4a, 0x00, 0x2e, 0x00, 0x2b, 0x00, 0x13, 0x00, 0x25, 0x00, 0xfd, 0xff, 0x24, 0x00, 
-0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0xe0, 0xff, 0x04, 0x00, 0xd9, 0xff, 0xfb, 0xff, 0xf6, 0xff, 
-0xf3, 0xff, 0x11, 0x00, 0xe8, 0xff, 0x04, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x20, 0x00, 0x0e, 0x00, 
-0x15, 0x00, 0x17, 0x00, 0xfe, 0xff, 0xed, 0xff, 0xd3, 0xff, 0xb3, 0xff, 0xad, 0xff, 0xa7, 0xff, 
-0xa7, 0xff, 0xb8, 0xff, 0xbf, 0xff, 0xd6, 0xff, 0xe1, 0xff, 0xf1, 0xff, 0x09, 0x00, 0x0e, 0x00, 
-0x2d, 0x00, 0x2b, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x2a, 0x00, 0x22, 0x00, 
-0x21, 0x00, 0x18, 0x00, 0x15, 0x00, 0x0d, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfb, 0xff, 
-0xf8, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x03, 0x00, 0x04, 0x00, 
-0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x05, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x02, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfd, 0xff, 
-0x02, 0x00, 0x03, 0x00, 0xff, 0xff, 0x05, 0x00, 0xfc, 0xff, 0x02, 0x00, 0xfe, 0xff, 0xfd, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 
-0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfa, 0xff, 
-0xfd, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0x00, 0x00, 
-0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 
-};
-
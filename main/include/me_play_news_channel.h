@@ -1,1023 +0,0 @@
-#include <stdio.h>
-const unsigned char me_play_news_channel[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xff, 0xff, 
-0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x03, 0x00, 
-0x05, 0x00, 0x04, 0x00, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0x01, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x03, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0xf6, 0xff, 
-0xf9, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf8, 0xff, 
-0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0xfc, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x04, 0x00, 0x08, 0x00, 
-0x06, 0x00, 0xff, 0xff, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x07, 0x00, 
-0x04, 0x00, 0x03, 0x00, 0x04, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x05, 0x00, 0x06, 0x00, 0x0d, 0x00, 
-0x07, 0x00, 0xff, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfc, 0xff, 0xf4, 0xff, 0xfd, 0xff, 
-0xfe, 0xff, 0x04, 0x00, 0xfe, 0xff, 0x02, 0x00, 0xf7, 0xff, 0xec, 0xff, 0x03, 0x00, 0x0a, 0x00, 
-0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x09, 0x00, 0x02, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0x06, 0x00, 
-0x08, 0x00, 0x0e, 0x00, 0x09, 0x00, 0xfd, 0xff, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x03, 0x00, 0x0c, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 
-0x05, 0x00, 0x07, 0x00, 0x11, 0x00, 0x07, 0x00, 0xf2, 0xff, 0xd9, 0xff, 0xc1, 0xff, 0xd1, 0xff, 
-0xcf, 0xff, 0xf3, 0xff, 0x12, 0x00, 0xa6, 0xff, 0x57, 0xff, 0x79, 0xff, 0xf7, 0xff, 0x85, 0x00, 
-0xd8, 0x00, 0x59, 0x00, 0x5b, 0xff, 0x12, 0xff, 0xe2, 0xfe, 0xe3, 0xfe, 0xd2, 0xfe, 0x54, 0xfe, 
-0x7d, 0xfe, 0x0a, 0xff, 0x7b, 0xff, 0x9e, 0xff, 0x09, 0xff, 0xb7, 0xfe, 0x7d, 0xff, 0x60, 0x00, 
-0xe7, 0x00, 0x93, 0x00, 0xde, 0xff, 0xaf, 0xfe, 0xc6, 0xfe, 0x34, 0x00, 0xe1, 0xff, 0x5c, 0xff, 
-0xcf, 0xfe, 0xc6, 0xfe, 0xbe, 0xff, 0x09, 0x00, 0x8b, 0xff, 0x38, 0xff, 0x39, 0x00, 0x59, 0x00, 
-0xc8, 0xff, 0xcc, 0xff, 0xae, 0xff, 0x3d, 0x00, 0x14, 0x00, 0x07, 0x00, 0xb6, 0xff, 0xda, 0xff, 
-0x24, 0x00, 0x5b, 0xff, 0xa5, 0xff, 0x5e, 0xff, 0xf5, 0xff, 0x47, 0x01, 0x57, 0x01, 0x59, 0x01, 
-0xbd, 0x00, 0x23, 0x00, 0x4b, 0x00, 0x1f, 0x00, 0x25, 0x00, 0x42, 0x00, 0xe5, 0xff, 0x62, 0x00, 
-0xeb, 0xff, 0x7c, 0x00, 0xda, 0x00, 0x8e, 0x00, 0xbf, 0x00, 0xd2, 0xff, 0x48, 0x00, 0x75, 0x00, 
-0x1d, 0x02, 0x8e, 0x02, 0x4c, 0x00, 0x76, 0xff, 0x2d, 0x00, 0x35, 0x01, 0xd2, 0x01, 0xa8, 0x00, 
-0xa4, 0xff, 0x49, 0xff, 0xa6, 0xff, 0xac, 0x00, 0xf3, 0x00, 0xd2, 0x01, 0x20, 0x01, 0xb1, 0xff, 
-0xc0, 0xff, 0x64, 0xff, 0x68, 0xff, 0xb9, 0xfe, 0x95, 0xfe, 0x75, 0x00, 0x45, 0x01, 0x7f, 0x01, 
-0x23, 0x00, 0x0a, 0x01, 0x90, 0x01, 0x0c, 0x00, 0x9f, 0xff, 0x8e, 0xfe, 0x85, 0xff, 0x14, 0x00, 
-0x39, 0xff, 0x24, 0x00, 0x16, 0xff, 0x7f, 0xfe, 0x1c, 0x00, 0x6a, 0x00, 0x68, 0x00, 0x0a, 0xff, 
-0x63, 0xff, 0x94, 0xff, 0x3d, 0xff, 0xf2, 0xff, 0x7d, 0xff, 0x87, 0xff, 0x0f, 0xfe, 0xdc, 0xfe, 
-0x1c, 0x01, 0xf1, 0x00, 0x18, 0x00, 0xca, 0xff, 0x07, 0x01, 0x2e, 0x00, 0xeb, 0xff, 0x07, 0x00, 
-0xfe, 0xfe, 0xe5, 0xff, 0x7a, 0x00, 0x9a, 0x00, 0xee, 0xff, 0x65, 0xfe, 0xe3, 0xfe, 0x10, 0x00, 
-0x67, 0x00, 0x7c, 0xff, 0x80, 0xff, 0x1f, 0x00, 0x05, 0x00, 0x7c, 0x00, 0xaf, 0xff, 0xc3, 0xff, 
-0x8a, 0xff, 0x1f, 0xff, 0x6a, 0xff, 0x25, 0xff, 0x4c, 0xff, 0x46, 0xff, 0x23, 0xff, 0x78, 0xff, 
-0xa0, 0xff, 0x03, 0x00, 0xfd, 0xff, 0x19, 0x00, 0xde, 0x00, 0xa6, 0x00, 0x36, 0x00, 0x59, 0xff, 
-0x60, 0x00, 0x76, 0x00, 0x3e, 0xff, 0x0d, 0xff, 0x08, 0xff, 0xe9, 0xff, 0x43, 0xff, 0xf9, 0xff, 
-0x2c, 0x00, 0x97, 0xff, 0x51, 0x00, 0x22, 0xff, 0x4e, 0xff, 0x8c, 0x00, 0xdb, 0x00, 0xac, 0x00, 
-0xfb, 0xff, 0x2b, 0x00, 0x72, 0xff, 0x1e, 0x00, 0x71, 0x01, 0x10, 0x01, 0x64, 0x01, 0x3e, 0x00, 
-0xca, 0xff, 0x7f, 0xff, 0x7f, 0x00, 0xfb, 0x00, 0x06, 0xff, 0xf6, 0xfe, 0x14, 0x00, 0x2c, 0x01, 
-0x01, 0x01, 0x7b, 0x00, 0x35, 0x01, 0x28, 0x01, 0x94, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x91, 0xff, 
-0xa4, 0xff, 0x3d, 0x00, 0xff, 0xff, 0x30, 0x01, 0xe8, 0x00, 0x1d, 0x01, 0xdc, 0x00, 0x11, 0x00, 
-0xe3, 0x00, 0x6d, 0x00, 0x16, 0x00, 0xe1, 0xfe, 0xb1, 0xff, 0xd4, 0x00, 0x5b, 0x00, 0x80, 0x00, 
-0xfe, 0xfe, 0x0a, 0xff, 0xbb, 0xff, 0xd0, 0x00, 0x27, 0x01, 0x66, 0x00, 0xea, 0xff, 0x2f, 0xff, 
-0x62, 0x00, 0x88, 0x00, 0x1a, 0xff, 0xf7, 0xfe, 0x43, 0xfe, 0x40, 0xff, 0xda, 0x00, 0x29, 0x00, 
-0x59, 0xff, 0x4f, 0xff, 0xa9, 0x00, 0x19, 0x00, 0x51, 0x00, 0x01, 0x00, 0x38, 0xff, 0x55, 0xfe, 
-0xa9, 0xfe, 0x9c, 0x00, 0xb3, 0xff, 0xf6, 0xfe, 0x19, 0xff, 0x31, 0x00, 0x20, 0x00, 0x3e, 0x00, 
-0x48, 0x00, 0x36, 0x00, 0x5c, 0x00, 0xe9, 0xff, 0xd8, 0xff, 0x2f, 0x00, 0x47, 0xff, 0x25, 0xff, 
-0x24, 0xff, 0x7b, 0x00, 0x75, 0x00, 0x2a, 0x00, 0x29, 0x00, 0xe7, 0xfe, 0xab, 0x00, 0x71, 0x00, 
-0x6d, 0x00, 0x1f, 0x00, 0x04, 0xff, 0xb4, 0xff, 0x95, 0xff, 0x75, 0x00, 0x8c, 0x01, 0xbc, 0x01, 
-0x17, 0xff, 0x73, 0xfe, 0xb1, 0xff, 0xe5, 0xff, 0x16, 0x00, 0x19, 0xff, 0x01, 0x00, 0x83, 0xff, 
-0x0d, 0x00, 0xfe, 0xff, 0x60, 0xff, 0x63, 0x01, 0x9a, 0x00, 0xb6, 0xff, 0x3d, 0xff, 0x85, 0xff, 
-0x78, 0x00, 0x78, 0xff, 0x4b, 0xff, 0xa9, 0xfe, 0xdf, 0xfe, 0xd4, 0xff, 0xc2, 0xff, 0xe2, 0x00, 
-0xc2, 0x00, 0x43, 0x00, 0x71, 0x00, 0xb1, 0x00, 0x24, 0x01, 0xc3, 0x01, 0x3d, 0x01, 0xbd, 0xff, 
-0x8a, 0xfe, 0xd0, 0xfe, 0xb6, 0xff, 0xd1, 0xff, 0x8e, 0x00, 0xb9, 0xff, 0x45, 0xff, 0xba, 0x00, 
-0x40, 0x00, 0x1b, 0x00, 0x8d, 0x00, 0x13, 0x00, 0x9d, 0x00, 0xb0, 0xff, 0x9a, 0x00, 0x24, 0x01, 
-0x2e, 0x00, 0x40, 0x00, 0x50, 0x00, 0x88, 0x00, 0x2b, 0x01, 0x8d, 0x00, 0xd5, 0x00, 0xf0, 0xff, 
-0xc5, 0xff, 0x6b, 0xff, 0x99, 0xfe, 0x97, 0xff, 0xf3, 0xfe, 0x9b, 0xff, 0xf8, 0xff, 0x9c, 0x00, 
-0xb3, 0x00, 0x54, 0x01, 0xb7, 0x00, 0x26, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x99, 0x00, 0x7c, 0x00, 
-0x24, 0x00, 0xe7, 0xfd, 0xa6, 0xfe, 0x11, 0xff, 0xb3, 0xfe, 0x6a, 0xff, 0x0e, 0xff, 0x5c, 0x00, 
-0xd2, 0x00, 0xec, 0x00, 0x81, 0x01, 0xd5, 0x00, 0xd2, 0x00, 0xbd, 0xff, 0x0d, 0xff, 0x9a, 0xff, 
-0x49, 0xff, 0xac, 0xfe, 0xfe, 0xfe, 0x34, 0xff, 0x06, 0x00, 0xf7, 0x00, 0x0d, 0x00, 0x49, 0x00, 
-0x54, 0x01, 0xd3, 0x00, 0x38, 0xff, 0x0e, 0x00, 0x52, 0x01, 0xf1, 0xff, 0x00, 0xff, 0x2d, 0xff, 
-0x5d, 0xff, 0xea, 0xff, 0x01, 0x00, 0xc5, 0xff, 0xea, 0xfe, 0xe0, 0xff, 0xd6, 0xff, 0xdb, 0xff, 
-0x24, 0x01, 0xc0, 0x01, 0xff, 0x01, 0x7b, 0xff, 0xdd, 0xfe, 0x39, 0xff, 0x64, 0xff, 0x52, 0x00, 
-0x0d, 0x01, 0xd3, 0x00, 0xb1, 0x00, 0xf6, 0xff, 0x84, 0xfe, 0xd6, 0xff, 0x50, 0x00, 0x8b, 0x00, 
-0xb8, 0x00, 0xa6, 0xff, 0x8a, 0xff, 0xab, 0xff, 0xac, 0xff, 0x82, 0xff, 0x14, 0x00, 0xfb, 0xff, 
-0xd9, 0xff, 0xbf, 0x00, 0xc5, 0x00, 0x39, 0x00, 0x60, 0x00, 0x32, 0x00, 0x4c, 0x00, 0x6e, 0x00, 
-0x34, 0x00, 0x4c, 0xff, 0x70, 0xff, 0x8e, 0xff, 0xd5, 0xff, 0xce, 0x01, 0xcb, 0x00, 0xcb, 0xff, 
-0x79, 0xff, 0x98, 0xff, 0x3e, 0x00, 0xc0, 0x00, 0x31, 0x01, 0x4e, 0x00, 0x98, 0x00, 0x08, 0x00, 
-0x64, 0xfe, 0x23, 0xff, 0x10, 0x00, 0x2c, 0x00, 0xba, 0xff, 0xf9, 0xff, 0x4f, 0xff, 0xa8, 0xff, 
-0x47, 0x00, 0xcb, 0x00, 0x08, 0x01, 0x39, 0x00, 0x75, 0xff, 0xda, 0xfe, 0x22, 0x00, 0x50, 0x00, 
-0x32, 0x00, 0xa6, 0xff, 0xb4, 0xff, 0x73, 0x00, 0x88, 0x00, 0x53, 0x00, 0x4c, 0x00, 0x88, 0xff, 
-0x59, 0xff, 0x45, 0x00, 0x95, 0x00, 0x9e, 0x00, 0x13, 0x00, 0x95, 0xff, 0xc7, 0xff, 0xbc, 0xff, 
-0x81, 0xff, 0xfb, 0xff, 0x1d, 0x00, 0x7f, 0xff, 0x46, 0x00, 0x27, 0x00, 0xbe, 0xff, 0xac, 0x00, 
-0xfe, 0x00, 0x16, 0x01, 0x21, 0x00, 0xec, 0xff, 0x9b, 0xff, 0x98, 0xff, 0x8a, 0xff, 0x5c, 0xff, 
-0xc9, 0xff, 0x82, 0xff, 0xd3, 0xff, 0x23, 0x00, 0xbd, 0xff, 0xaa, 0xff, 0x25, 0x01, 0xf2, 0x00, 
-0x23, 0x00, 0xee, 0xff, 0x1a, 0x00, 0x92, 0x00, 0xbd, 0xff, 0x64, 0xff, 0x06, 0xff, 0xe0, 0xfe, 
-0x6e, 0xff, 0xa1, 0xff, 0x32, 0xff, 0x7d, 0xff, 0xc2, 0x00, 0x3a, 0x01, 0xa6, 0x00, 0x6e, 0x00, 
-0x16, 0x00, 0x82, 0x00, 0x04, 0x01, 0x06, 0x01, 0x87, 0x00, 0x30, 0x00, 0xfc, 0xff, 0x15, 0xff, 
-0xc2, 0xfe, 0x18, 0xff, 0x66, 0x00, 0x74, 0x00, 0x22, 0xff, 0x1f, 0xff, 0xb8, 0xff, 0xed, 0xff, 
-0xf1, 0x00, 0x17, 0x01, 0x23, 0x00, 0x1c, 0xff, 0x3c, 0xff, 0x87, 0xff, 0x09, 0x00, 0x2a, 0x00, 
-0xdb, 0xff, 0x37, 0xff, 0x2d, 0xff, 0xc8, 0xff, 0xa5, 0xff, 0xcc, 0x00, 0x20, 0x01, 0xd3, 0x00, 
-0xc6, 0xff, 0x89, 0xff, 0x34, 0x00, 0x91, 0x00, 0x1f, 0x01, 0x49, 0x00, 0x0d, 0xff, 0x74, 0xfe, 
-0xe3, 0xfe, 0xe7, 0xff, 0xca, 0xff, 0x1e, 0x00, 0x32, 0x00, 0x95, 0xff, 0x39, 0xff, 0x9a, 0xfe, 
-0xaa, 0xff, 0x99, 0x00, 0xc3, 0x00, 0x34, 0x00, 0x87, 0xff, 0x4a, 0xff, 0xb3, 0xff, 0xed, 0x00, 
-0x99, 0x00, 0x60, 0x00, 0xa7, 0xff, 0x78, 0xff, 0x8d, 0xfe, 0xcf, 0xfe, 0x1b, 0x00, 0x71, 0x00, 
-0x0b, 0x00, 0x97, 0xfe, 0xff, 0xfe, 0x68, 0xff, 0x4f, 0x00, 0x27, 0x01, 0x62, 0x01, 0xef, 0x00, 
-0x4a, 0x00, 0x4f, 0x00, 0xd4, 0xff, 0xe7, 0xff, 0x4e, 0x00, 0xab, 0x00, 0x36, 0x01, 0x62, 0x00, 
-0x9a, 0xff, 0x9e, 0xfe, 0x0b, 0xff, 0xf2, 0xff, 0x11, 0x00, 0x8e, 0xff, 0x1d, 0xff, 0xdd, 0xfe, 
-0xe6, 0xfe, 0x0f, 0x00, 0x7d, 0x00, 0x2b, 0x00, 0x26, 0xff, 0x9e, 0xfe, 0xdc, 0xfe, 0x52, 0x00, 
-0xe7, 0x00, 0xb5, 0x00, 0xbc, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xba, 0x00, 0x08, 0x00, 0x71, 0xff, 
-0x4b, 0xff, 0x8e, 0xff, 0xac, 0xff, 0x2c, 0xff, 0x3a, 0xff, 0xab, 0xff, 0x5d, 0x00, 0x9a, 0x00, 
-0x4e, 0x00, 0x28, 0x00, 0xee, 0xff, 0x9e, 0x00, 0xf9, 0x01, 0xbc, 0x01, 0xfb, 0x00, 0x82, 0xff, 
-0x2a, 0xfe, 0xa7, 0xfe, 0x67, 0xff, 0x0a, 0x00, 0x3d, 0x00, 0x9c, 0xff, 0x2c, 0xff, 0xf2, 0xfe, 
-0x68, 0xff, 0xee, 0xff, 0x18, 0x00, 0xd2, 0xff, 0xf3, 0xff, 0xad, 0xff, 0x2a, 0xff, 0x2c, 0xfe, 
-0xcb, 0xfd, 0x94, 0xff, 0x41, 0x00, 0xd2, 0x00, 0x92, 0x00, 0x1c, 0x00, 0xd8, 0x00, 0x18, 0x02, 
-0xb4, 0x02, 0x40, 0x02, 0x13, 0x02, 0x06, 0x02, 0x45, 0x02, 0x32, 0x02, 0xa9, 0x02, 0xab, 0x02, 
-0x50, 0x02, 0x8f, 0x01, 0x8a, 0xff, 0xb5, 0xfe, 0x01, 0xfe, 0x14, 0xff, 0x11, 0x00, 0x91, 0xfd, 
-0x22, 0xfc, 0x91, 0xfb, 0xbf, 0xfb, 0xc5, 0xfb, 0xde, 0xfa, 0xee, 0xf9, 0x8b, 0xf9, 0x2a, 0xf9, 
-0x43, 0xf9, 0x3f, 0xfa, 0x32, 0xfa, 0x31, 0xfb, 0xcf, 0xfc, 0xfa, 0xff, 0xcd, 0x02, 0xe0, 0x05, 
-0x54, 0x09, 0xe6, 0x0b, 0x35, 0x0e, 0x59, 0x0f, 0x61, 0x0f, 0xe2, 0x0d, 0x2d, 0x0b, 0xfa, 0x07, 
-0x31, 0x06, 0x9d, 0x04, 0xc3, 0x03, 0x2e, 0x02, 0x2f, 0x00, 0x6e, 0xfe, 0x65, 0xfc, 0xff, 0xfa, 
-0xbc, 0xf9, 0x1a, 0xf9, 0xdb, 0xf7, 0x91, 0xf6, 0x35, 0xf4, 0xef, 0xf1, 0xc6, 0xef, 0xf7, 0xed, 
-0x89, 0xed, 0x4b, 0xed, 0xe3, 0xee, 0x10, 0xf2, 0x2c, 0xf7, 0xd7, 0xfd, 0xa9, 0x04, 0x45, 0x0a, 
-0x90, 0x0e, 0x62, 0x11, 0xc1, 0x11, 0x81, 0x10, 0x2e, 0x0f, 0x98, 0x0d, 0x91, 0x0b, 0xae, 0x09, 
-0x0b, 0x07, 0x0a, 0x05, 0xe2, 0x03, 0xe7, 0x02, 0x00, 0x03, 0x54, 0x04, 0x0f, 0x06, 0xca, 0x06, 
-0x11, 0x06, 0x33, 0x04, 0xdd, 0x01, 0x1b, 0x00, 0xbd, 0xfe, 0xc3, 0xfd, 0x56, 0xfc, 0xcf, 0xf9, 
-0x7d, 0xf7, 0x12, 0xf5, 0xfa, 0xf2, 0xd5, 0xf0, 0x0e, 0xee, 0xb4, 0xea, 0xfc, 0xe7, 0x49, 0xe7, 
-0xf4, 0xe9, 0x86, 0xf0, 0xce, 0xf9, 0x9d, 0x03, 0x7a, 0x0b, 0xb1, 0x10, 0x0d, 0x13, 0x81, 0x13, 
-0x53, 0x12, 0xb2, 0x0f, 0xf0, 0x0c, 0x2d, 0x0a, 0x36, 0x06, 0x84, 0x02, 0x7d, 0xff, 0x79, 0xff, 
-0xcd, 0x01, 0x93, 0x04, 0x9f, 0x06, 0x01, 0x06, 0xd4, 0x04, 0xcb, 0x03, 0xa1, 0x03, 0xf4, 0x03, 
-0x16, 0x04, 0xaa, 0x03, 0xdf, 0x02, 0x06, 0x02, 0xb3, 0x00, 0x87, 0xff, 0x42, 0xfe, 0x66, 0xfc, 
-0x92, 0xf9, 0x75, 0xf5, 0xd1, 0xf0, 0x19, 0xec, 0x0f, 0xe7, 0xdf, 0xe3, 0x0f, 0xe4, 0xc3, 0xe8, 
-0x43, 0xf2, 0xc7, 0xfc, 0xe8, 0x06, 0x1d, 0x0d, 0x0b, 0x11, 0x57, 0x12, 0x5a, 0x12, 0xc8, 0x11, 
-0xfd, 0x0e, 0x5a, 0x0c, 0x26, 0x08, 0x46, 0x04, 0xee, 0xff, 0x91, 0xfd, 0xc9, 0xfd, 0xc3, 0x00, 
-0xb0, 0x03, 0xe0, 0x03, 0x31, 0x03, 0x61, 0x02, 0xe0, 0x02, 0xa3, 0x03, 0xfa, 0x02, 0xd1, 0x01, 
-0x5d, 0x01, 0x51, 0x02, 0x8f, 0x03, 0x02, 0x05, 0x00, 0x06, 0x6b, 0x05, 0x34, 0x04, 0x5c, 0x00, 
-0xfb, 0xfc, 0x61, 0xf7, 0x57, 0xf0, 0x80, 0xe9, 0xb9, 0xe3, 0x12, 0xe0, 0xa4, 0xe0, 0x67, 0xe7, 
-0x5d, 0xf3, 0x16, 0x01, 0x43, 0x0b, 0x5e, 0x11, 0x36, 0x12, 0x2f, 0x11, 0x0d, 0x0f, 0xc4, 0x0d, 
-0x25, 0x0b, 0xe4, 0x07, 0x4e, 0x04, 0xc7, 0x01, 0xf1, 0x00, 0x39, 0x01, 0x90, 0x02, 0x09, 0x03, 
-0x68, 0x03, 0x6f, 0x02, 0x4c, 0x03, 0xb9, 0x03, 0x37, 0x04, 0x8a, 0x02, 0x9a, 0x00, 0x0c, 0x00, 
-0x87, 0x01, 0x79, 0x05, 0x72, 0x08, 0xba, 0x09, 0xfa, 0x06, 0x0f, 0x04, 0x8e, 0x00, 0x2d, 0xfe, 
-0xde, 0xf9, 0x94, 0xf2, 0xf8, 0xe9, 0x86, 0xe0, 0x69, 0xdb, 0xa9, 0xdc, 0xa7, 0xe5, 0x12, 0xf4, 
-0x37, 0x02, 0x50, 0x0b, 0x89, 0x0e, 0x28, 0x0f, 0x5f, 0x10, 0xac, 0x10, 0x4b, 0x0e, 0x8c, 0x08, 
-0x48, 0x04, 0x85, 0x03, 0xa9, 0x05, 0xc5, 0x07, 0x25, 0x07, 0x52, 0x05, 0x51, 0x03, 0x6c, 0x03, 
-0x1f, 0x03, 0xac, 0x01, 0xe4, 0xfe, 0x3b, 0xfd, 0x59, 0xfe, 0x97, 0x00, 0xe7, 0x02, 0x33, 0x03, 
-0x0b, 0x04, 0x1c, 0x06, 0x7a, 0x08, 0xb5, 0x09, 0xdd, 0x07, 0xf3, 0x04, 0x65, 0x01, 0xe4, 0xfc, 
-0x35, 0xf8, 0x9e, 0xf1, 0x3b, 0xea, 0xff, 0xe2, 0x1b, 0xdd, 0x63, 0xdd, 0x17, 0xe5, 0x5d, 0xf4, 
-0x4c, 0x04, 0x38, 0x0c, 0xc6, 0x0d, 0x64, 0x0c, 0x48, 0x0d, 0x52, 0x0e, 0x0f, 0x0c, 0xee, 0x07, 
-0xf9, 0x04, 0x08, 0x06, 0xe7, 0x08, 0xb5, 0x0a, 0xaa, 0x07, 0x48, 0x04, 0x8f, 0x03, 0xe4, 0x02, 
-0x68, 0x01, 0xac, 0xfc, 0x10, 0xfa, 0xb7, 0xfb, 0x5b, 0x00, 0x40, 0x03, 0xea, 0x01, 0x23, 0x01, 
-0xbb, 0x03, 0x88, 0x0a, 0x1d, 0x0d, 0xda, 0x0a, 0xd9, 0x05, 0x07, 0x03, 0xde, 0x02, 0x81, 0x00, 
-0x29, 0xfb, 0xaf, 0xf2, 0xf8, 0xeb, 0xae, 0xe5, 0xc0, 0xdd, 0xec, 0xda, 0xfa, 0xe0, 0xf5, 0xf0, 
-0x9e, 0x02, 0xbe, 0x0a, 0x8a, 0x0b, 0x69, 0x0a, 0x30, 0x0d, 0xe7, 0x0e, 0xa9, 0x0b, 0xb2, 0x06, 
-0xcd, 0x05, 0xc6, 0x08, 0xf8, 0x0a, 0x21, 0x09, 0xfc, 0x04, 0xa5, 0x04, 0x38, 0x06, 0xee, 0x05, 
-0x37, 0x00, 0xd4, 0xfa, 0x83, 0xf9, 0x51, 0xfc, 0x5d, 0x00, 0x72, 0x00, 0xa4, 0x00, 0x89, 0x02, 
-0x18, 0x06, 0x53, 0x0a, 0x41, 0x0b, 0x4e, 0x0a, 0xb9, 0x09, 0x73, 0x08, 0xb7, 0x05, 0x79, 0xff, 
-0x27, 0xf9, 0xca, 0xf4, 0x40, 0xf0, 0xfe, 0xe8, 0xa1, 0xdf, 0x9e, 0xda, 0xab, 0xdd, 0xfb, 0xeb, 
-0x77, 0xfb, 0xbc, 0x03, 0xa6, 0x06, 0x54, 0x0a, 0x36, 0x0e, 0xd8, 0x0e, 0x1d, 0x0b, 0x2c, 0x06, 
-0x29, 0x09, 0x8b, 0x0c, 0x21, 0x0d, 0x2f, 0x0a, 0x54, 0x08, 0x0c, 0x09, 0x9b, 0x07, 0x48, 0x03, 
-0xa2, 0xfe, 0x6a, 0xfc, 0x53, 0xfc, 0x91, 0xfc, 0x96, 0xfb, 0x67, 0xfc, 0x24, 0x00, 0x4d, 0x03, 
-0x96, 0x04, 0x71, 0x06, 0xbb, 0x08, 0x32, 0x0b, 0x49, 0x0a, 0x33, 0x07, 0x13, 0x05, 0x98, 0x02, 
-0x8c, 0xfe, 0xcf, 0xf8, 0x64, 0xf2, 0x7f, 0xec, 0xdb, 0xe5, 0x09, 0xde, 0xb2, 0xda, 0xb8, 0xe3, 
-0xe9, 0xf3, 0x38, 0x00, 0x80, 0x04, 0x75, 0x07, 0xb6, 0x0c, 0x81, 0x10, 0x66, 0x0c, 0x64, 0x07, 
-0x21, 0x08, 0x05, 0x0c, 0x78, 0x0c, 0x1d, 0x09, 0xc0, 0x09, 0xad, 0x0b, 0x4d, 0x0a, 0x9a, 0x03, 
-0xea, 0xfe, 0xa1, 0xfe, 0x17, 0xfe, 0x19, 0xfb, 0xec, 0xf9, 0x51, 0xfc, 0x89, 0xff, 0x93, 0x01, 
-0x59, 0x02, 0xea, 0x05, 0xde, 0x0a, 0x17, 0x0d, 0xc2, 0x0a, 0xbe, 0x08, 0xb7, 0x08, 0xad, 0x05, 
-0xb7, 0xff, 0xf1, 0xf9, 0xe9, 0xf5, 0xfe, 0xf0, 0x6a, 0xe9, 0x15, 0xdf, 0x74, 0xd9, 0xdb, 0xde, 
-0xf3, 0xea, 0x2f, 0xf8, 0x05, 0x00, 0x38, 0x07, 0x98, 0x0b, 0x4c, 0x0e, 0x1a, 0x0d, 0x89, 0x09, 
-0x8b, 0x0a, 0xe0, 0x0b, 0xde, 0x0c, 0xa9, 0x0a, 0xe3, 0x0b, 0x4d, 0x0b, 0x38, 0x08, 0x63, 0x04, 
-0xbf, 0x00, 0xfb, 0x00, 0xa6, 0xfd, 0x08, 0xfa, 0x47, 0xf9, 0xe6, 0xfa, 0xf3, 0xfc, 0x78, 0xfe, 
-0x9b, 0x00, 0x99, 0x04, 0x7b, 0x0a, 0x47, 0x0c, 0x27, 0x0d, 0x40, 0x0b, 0x20, 0x0a, 0xb1, 0x07, 
-0x15, 0x03, 0xc6, 0xfc, 0x93, 0xf7, 0x06, 0xf3, 0x69, 0xed, 0x70, 0xe5, 0x09, 0xdc, 0xc0, 0xdb, 
-0xbe, 0xe2, 0xd9, 0xef, 0xb9, 0xfa, 0xe2, 0x01, 0x7c, 0x07, 0x4a, 0x0c, 0xf8, 0x0e, 0x9b, 0x0c, 
-0xa0, 0x0b, 0xf5, 0x0d, 0x13, 0x0f, 0xb2, 0x0d, 0xeb, 0x0c, 0x8c, 0x0b, 0xe1, 0x08, 0xe3, 0x04, 
-0x3f, 0x02, 0xb0, 0x00, 0x55, 0xfe, 0x29, 0xfb, 0x75, 0xf9, 0xbe, 0xfa, 0xbc, 0xfb, 0x91, 0xfc, 
-0xbd, 0xfe, 0x82, 0x04, 0xa8, 0x08, 0xb4, 0x0a, 0x0f, 0x0c, 0xe5, 0x0b, 0x40, 0x0b, 0x56, 0x08, 
-0x73, 0x04, 0x6f, 0xff, 0xfd, 0xfa, 0x8b, 0xf6, 0xb6, 0xef, 0x20, 0xea, 0xd1, 0xe2, 0xf4, 0xdb, 
-0x22, 0xde, 0x3d, 0xe7, 0x79, 0xf3, 0xc0, 0xfc, 0x7f, 0x03, 0x18, 0x0a, 0x40, 0x0d, 0x88, 0x0f, 
-0x68, 0x0d, 0x61, 0x0e, 0x89, 0x0f, 0x54, 0x0f, 0x8b, 0x0d, 0x1f, 0x0c, 0xa3, 0x0a, 0x40, 0x06, 
-0xc2, 0x03, 0x03, 0x00, 0x44, 0xfe, 0x59, 0xfb, 0xd8, 0xf8, 0x38, 0xf9, 0x72, 0xfa, 0x41, 0xfc, 
-0x7f, 0xfe, 0x77, 0x04, 0x5e, 0x07, 0xd9, 0x09, 0x55, 0x0c, 0x64, 0x0d, 0xc9, 0x0c, 0xf7, 0x09, 
-0x67, 0x07, 0x2c, 0x03, 0xe6, 0xfd, 0x44, 0xf9, 0xac, 0xf4, 0x6c, 0xed, 0x75, 0xe8, 0x3f, 0xe0, 
-0x28, 0xdb, 0x80, 0xe0, 0x46, 0xea, 0xa2, 0xf6, 0x99, 0xfd, 0x0d, 0x05, 0x18, 0x0c, 0x2d, 0x0d, 
-0xec, 0x0d, 0xe1, 0x0e, 0x81, 0x0f, 0xcd, 0x0e, 0x99, 0x0e, 0x51, 0x0d, 0xf9, 0x0b, 0x6e, 0x08, 
-0x77, 0x05, 0x48, 0x03, 0xde, 0xfe, 0x6f, 0xfc, 0x88, 0xf9, 0x2b, 0xf9, 0x8e, 0xfb, 0x2d, 0xfa, 
-0xf7, 0xfc, 0x8a, 0x01, 0x85, 0x04, 0x81, 0x08, 0x97, 0x0a, 0xec, 0x0c, 0x01, 0x0e, 0x95, 0x0c, 
-0xf0, 0x09, 0xa5, 0x06, 0x49, 0x01, 0x93, 0xfb, 0x69, 0xf9, 0xd7, 0xf1, 0xdf, 0xeb, 0xe0, 0xe6, 
-0x1d, 0xdd, 0xd7, 0xda, 0xf1, 0xe1, 0x31, 0xed, 0xd2, 0xf6, 0x6c, 0xff, 0xd6, 0x08, 0xa5, 0x0d, 
-0x30, 0x0f, 0x8b, 0x10, 0xba, 0x10, 0xf0, 0x0f, 0xb9, 0x0f, 0x93, 0x0e, 0x4c, 0x0d, 0xaf, 0x0a, 
-0xba, 0x07, 0xd9, 0x05, 0x9d, 0x01, 0x99, 0xfe, 0xc6, 0xfb, 0x90, 0xf9, 0xf0, 0xf8, 0xe8, 0xf8, 
-0x3b, 0xfa, 0x93, 0xfc, 0x93, 0x01, 0x08, 0x05, 0x1b, 0x08, 0x1d, 0x0b, 0x45, 0x0d, 0xb8, 0x0c, 
-0x14, 0x0b, 0xa5, 0x08, 0x2a, 0x04, 0xd6, 0xff, 0xff, 0xf9, 0x4b, 0xf8, 0x65, 0xef, 0x1f, 0xeb, 
-0x01, 0xe3, 0x8e, 0xd8, 0x46, 0xdf, 0x7a, 0xe1, 0x8f, 0xee, 0x51, 0xfa, 0x19, 0x00, 0x5b, 0x0c, 
-0xc9, 0x0e, 0x84, 0x11, 0xcf, 0x13, 0x4a, 0x12, 0x45, 0x12, 0xd1, 0x10, 0x72, 0x0e, 0xbb, 0x0c, 
-0x26, 0x09, 0x83, 0x07, 0x66, 0x04, 0x05, 0x01, 0xd6, 0xff, 0xa2, 0xfa, 0xb6, 0xf9, 0x07, 0xfa, 
-0x9e, 0xf8, 0x88, 0xfb, 0x7a, 0xff, 0xee, 0x01, 0xa6, 0x06, 0x76, 0x09, 0x3c, 0x0b, 0xdb, 0x0c, 
-0x03, 0x0c, 0xc7, 0x0a, 0xa3, 0x06, 0x0a, 0x04, 0x47, 0xfd, 0xc9, 0xf9, 0x72, 0xf4, 0x53, 0xed, 
-0x05, 0xe9, 0xa3, 0xdd, 0xa2, 0xdc, 0xa3, 0xdf, 0x84, 0xe5, 0x1f, 0xf2, 0xe6, 0xf9, 0x52, 0x04, 
-0x41, 0x0b, 0x72, 0x0e, 0x51, 0x12, 0x5c, 0x12, 0xfb, 0x11, 0x1f, 0x11, 0x6e, 0x0f, 0x7c, 0x0d, 
-0x44, 0x0b, 0x0b, 0x09, 0xaf, 0x05, 0x16, 0x03, 0xef, 0xff, 0x32, 0xfc, 0x45, 0xfb, 0x99, 0xf9, 
-0x50, 0xf9, 0x36, 0xfb, 0x04, 0xfe, 0xfc, 0x00, 0x89, 0x04, 0xc1, 0x07, 0x40, 0x09, 0xcd, 0x0b, 
-0x33, 0x0b, 0xe7, 0x0b, 0x53, 0x09, 0x6b, 0x06, 0xf7, 0x01, 0xf3, 0xfb, 0xb1, 0xf8, 0xa0, 0xee, 
-0x1b, 0xed, 0x07, 0xe4, 0x7c, 0xda, 0xbd, 0xe1, 0xfb, 0xdf, 0xb5, 0xeb, 0xc2, 0xf6, 0xda, 0xfb, 
-0x59, 0x09, 0xc1, 0x0a, 0xa9, 0x11, 0x76, 0x14, 0x24, 0x13, 0xc6, 0x15, 0x8c, 0x11, 0x2d, 0x11, 
-0xda, 0x0e, 0x43, 0x0a, 0xb8, 0x08, 0x06, 0x04, 0xb2, 0xff, 0xf4, 0xfd, 0xc5, 0xfa, 0xdc, 0xf8, 
-0xdd, 0xf8, 0xba, 0xf8, 0x40, 0xfa, 0xb5, 0xfe, 0xec, 0x00, 0x75, 0x04, 0x0b, 0x08, 0x8f, 0x08, 
-0x4c, 0x0b, 0x9e, 0x0a, 0x3f, 0x0a, 0xfa, 0x08, 0x20, 0x04, 0x42, 0x00, 0xb8, 0xfb, 0x8f, 0xf4, 
-0xc2, 0xef, 0x7b, 0xe8, 0xcc, 0xdf, 0x0f, 0xde, 0x3f, 0xde, 0x0e, 0xe6, 0xfd, 0xef, 0x1b, 0xf6, 
-0x7b, 0x03, 0x2e, 0x09, 0x8f, 0x0d, 0x35, 0x15, 0x8e, 0x14, 0x25, 0x16, 0xfc, 0x15, 0x44, 0x13, 
-0xab, 0x10, 0x4b, 0x0d, 0xf0, 0x09, 0xa5, 0x05, 0xd6, 0x01, 0x93, 0xfe, 0x0d, 0xfc, 0xe2, 0xf9, 
-0x47, 0xf9, 0x33, 0xf8, 0x8e, 0xf8, 0x31, 0xfc, 0x7f, 0xfd, 0xd8, 0x02, 0x64, 0x06, 0x79, 0x07, 
-0xb3, 0x0b, 0x04, 0x0a, 0xc6, 0x0b, 0xd3, 0x09, 0xfa, 0x06, 0x8b, 0x03, 0xb2, 0xfe, 0x32, 0xfa, 
-0x03, 0xf2, 0xc2, 0xee, 0x1e, 0xe3, 0xb8, 0xde, 0x30, 0xdf, 0xba, 0xde, 0x98, 0xec, 0xa1, 0xf0, 
-0x78, 0xfa, 0x5e, 0x07, 0xea, 0x07, 0xd8, 0x11, 0x3e, 0x14, 0x34, 0x15, 0xf8, 0x16, 0x18, 0x15, 
-0x77, 0x13, 0x89, 0x0f, 0x14, 0x0e, 0x6a, 0x08, 0xf8, 0x04, 0x24, 0x01, 0x4d, 0xfc, 0x8c, 0xfa, 
-0x12, 0xf8, 0xda, 0xf7, 0xaa, 0xf7, 0x50, 0xf9, 0x26, 0xfc, 0x4d, 0xff, 0xb1, 0x03, 0x50, 0x06, 
-0x9f, 0x09, 0x3e, 0x0b, 0x84, 0x0b, 0xbf, 0x0c, 0x39, 0x0b, 0xfb, 0x05, 0x03, 0x04, 0x4f, 0xfe, 
-0x6a, 0xf4, 0xcc, 0xf2, 0xbb, 0xe7, 0x0c, 0xdf, 0xc1, 0xdf, 0x73, 0xdc, 0x07, 0xe5, 0xeb, 0xec, 
-0x84, 0xf2, 0x9f, 0x00, 0x17, 0x04, 0x23, 0x0c, 0x28, 0x13, 0xef, 0x12, 0x31, 0x18, 0x30, 0x16, 
-0xfa, 0x14, 0x92, 0x13, 0x76, 0x10, 0x02, 0x0d, 0xa6, 0x08, 0x8e, 0x04, 0xaf, 0xfe, 0xae, 0xfb, 
-0xb5, 0xf8, 0x0c, 0xf7, 0x69, 0xf7, 0x32, 0xf7, 0x24, 0xfa, 0x96, 0xfc, 0xe4, 0x00, 0xf9, 0x04, 
-0x08, 0x07, 0x1d, 0x0b, 0xac, 0x0b, 0x4e, 0x0c, 0x1a, 0x0d, 0xd0, 0x08, 0x51, 0x05, 0xe3, 0x01, 
-0x57, 0xf8, 0x0f, 0xf4, 0xdc, 0xed, 0xc3, 0xe1, 0x7d, 0xe1, 0x3d, 0xdd, 0xec, 0xdf, 0x7d, 0xe9, 
-0x53, 0xeb, 0xb1, 0xfa, 0x23, 0x00, 0x89, 0x06, 0xf1, 0x11, 0x45, 0x11, 0xad, 0x17, 0x79, 0x17, 
-0x8a, 0x15, 0x27, 0x15, 0x20, 0x12, 0xd2, 0x0f, 0xe2, 0x0b, 0x6f, 0x07, 0xe6, 0x01, 0x70, 0xfe, 
-0xe0, 0xf9, 0x65, 0xf7, 0x65, 0xf7, 0xd1, 0xf5, 0x94, 0xf8, 0xae, 0xfa, 0x11, 0xfe, 0x48, 0x02, 
-0x14, 0x04, 0x32, 0x08, 0x05, 0x09, 0x16, 0x0b, 0x1b, 0x0c, 0xb9, 0x09, 0x4a, 0x07, 0x46, 0x04, 
-0x07, 0xfc, 0xb2, 0xf7, 0xfb, 0xf1, 0xb6, 0xe4, 0xbf, 0xe4, 0x0c, 0xdf, 0x30, 0xdf, 0xe2, 0xe9, 
-0xb9, 0xe9, 0x91, 0xf7, 0x79, 0xff, 0xe0, 0x03, 0x62, 0x0f, 0x21, 0x11, 0xa8, 0x15, 0xe6, 0x16, 
-0x33, 0x16, 0x13, 0x15, 0xee, 0x12, 0x6e, 0x11, 0x98, 0x0d, 0x87, 0x09, 0x88, 0x04, 0xd0, 0xff, 
-0x04, 0xfc, 0x97, 0xf8, 0x7c, 0xf7, 0x5b, 0xf6, 0xd6, 0xf7, 0x19, 0xf9, 0xe5, 0xfb, 0x3c, 0x00, 
-0xfe, 0x00, 0x79, 0x05, 0xe2, 0x06, 0xc2, 0x07, 0x31, 0x0a, 0x3b, 0x08, 0x89, 0x05, 0x24, 0x04, 
-0x14, 0xfc, 0x14, 0xf9, 0xfb, 0xf2, 0x2a, 0xe8, 0x00, 0xe8, 0x89, 0xe0, 0x77, 0xe4, 0xe1, 0xe9, 
-0x42, 0xeb, 0xa7, 0xf9, 0x45, 0xfc, 0xaa, 0x04, 0x72, 0x0e, 0x92, 0x0e, 0xeb, 0x16, 0x57, 0x15, 
-0x83, 0x15, 0x16, 0x16, 0xc9, 0x11, 0xd8, 0x11, 0x5a, 0x0d, 0xb4, 0x09, 0xea, 0x04, 0x1a, 0x00, 
-0xa6, 0xfd, 0x77, 0xf9, 0x51, 0xf8, 0xe8, 0xf7, 0x3b, 0xf7, 0x78, 0xf9, 0xc9, 0xfb, 0xf8, 0xfd, 
-0xce, 0x01, 0x2c, 0x04, 0x03, 0x05, 0x8b, 0x08, 0x39, 0x07, 0x8f, 0x06, 0xda, 0x05, 0x6c, 0x01, 
-0x0a, 0xfc, 0x2a, 0xf9, 0x90, 0xf0, 0xef, 0xe9, 0x34, 0xe8, 0xef, 0xe0, 0xc9, 0xe6, 0x63, 0xe8, 
-0xee, 0xec, 0x05, 0xf9, 0x5f, 0xfb, 0x8d, 0x05, 0x53, 0x0c, 0x5f, 0x0f, 0x05, 0x16, 0xf5, 0x14, 
-0xda, 0x16, 0x1e, 0x15, 0x46, 0x13, 0x95, 0x12, 0xcd, 0x0c, 0xa1, 0x0a, 0xae, 0x04, 0xd7, 0xff, 
-0xb9, 0xfd, 0x5b, 0xfa, 0x58, 0xf8, 0x70, 0xf9, 0xbb, 0xf8, 0xec, 0xf9, 0x05, 0xfe, 0xa0, 0xfe, 
-0xd4, 0x01, 0x1b, 0x05, 0xc2, 0x04, 0xb2, 0x07, 0x64, 0x08, 0xf4, 0x04, 0x4f, 0x05, 0x43, 0x00, 
-0xb2, 0xf9, 0x01, 0xf8, 0x90, 0xed, 0xce, 0xe9, 0xfe, 0xe6, 0x64, 0xe2, 0x8f, 0xe8, 0x32, 0xe9, 
-0x66, 0xf1, 0x0c, 0xf9, 0x1e, 0xfd, 0x12, 0x07, 0x3b, 0x0b, 0xe0, 0x0f, 0x58, 0x14, 0x71, 0x13, 
-0x2f, 0x15, 0x11, 0x14, 0xa8, 0x11, 0x11, 0x11, 0xf0, 0x0b, 0x06, 0x08, 0x03, 0x04, 0x91, 0xff, 
-0x20, 0xfd, 0x91, 0xfb, 0xfb, 0xf9, 0xb1, 0xfa, 0xd5, 0xfa, 0xde, 0xfc, 0x33, 0xff, 0x7e, 0x00, 
-0x6d, 0x03, 0x20, 0x04, 0x74, 0x05, 0xca, 0x07, 0xbc, 0x05, 0xa1, 0x05, 0x4c, 0x03, 0x2a, 0xfc, 
-0x78, 0xfa, 0xa3, 0xf1, 0xca, 0xeb, 0x0a, 0xea, 0x20, 0xe4, 0xe0, 0xe7, 0xbf, 0xe9, 0xe0, 0xed, 
-0xb7, 0xf6, 0x71, 0xfa, 0x52, 0x02, 0x97, 0x08, 0x88, 0x0c, 0x71, 0x11, 0x47, 0x12, 0xe3, 0x12, 
-0xd0, 0x13, 0xbc, 0x10, 0x0d, 0x11, 0x50, 0x0d, 0xb8, 0x08, 0xc1, 0x06, 0x24, 0x00, 0x39, 0xff, 
-0x85, 0xfc, 0x17, 0xfb, 0xad, 0xfb, 0x9d, 0xfb, 0x42, 0xfd, 0x92, 0xfe, 0x32, 0x01, 0x01, 0x02, 
-0x4c, 0x03, 0x49, 0x05, 0x92, 0x04, 0xa9, 0x05, 0x76, 0x04, 0x35, 0x01, 0x79, 0xfe, 0x90, 0xf8, 
-0x20, 0xf3, 0xe6, 0xec, 0x69, 0xe9, 0x08, 0xe6, 0x13, 0xe7, 0x2a, 0xea, 0x4c, 0xed, 0xba, 0xf5, 
-0x0e, 0xfa, 0xa3, 0x01, 0xa9, 0x08, 0xab, 0x0c, 0x35, 0x12, 0x68, 0x13, 0xb8, 0x14, 0xa7, 0x14, 
-0x6b, 0x13, 0x02, 0x12, 0xd3, 0x0e, 0xff, 0x0a, 0x76, 0x06, 0xac, 0x01, 0x0b, 0xff, 0x25, 0xfd, 
-0x3b, 0xfb, 0x3f, 0xfc, 0xac, 0xfb, 0x55, 0xfc, 0xc7, 0xfe, 0xec, 0xfe, 0x1c, 0x01, 0xe7, 0x02, 
-0xf6, 0x01, 0xad, 0x04, 0x0c, 0x03, 0x86, 0x02, 0x68, 0x01, 0x08, 0xfb, 0xab, 0xf9, 0xe9, 0xef, 
-0x76, 0xed, 0x56, 0xe9, 0xe6, 0xe4, 0xe1, 0xeb, 0xf7, 0xe7, 0xe8, 0xf1, 0xdf, 0xf6, 0xdd, 0xf8, 
-0x97, 0x06, 0xec, 0x05, 0xb3, 0x0d, 0xc8, 0x12, 0x68, 0x0f, 0xdb, 0x15, 0x13, 0x13, 0x7b, 0x11, 
-0x48, 0x13, 0x78, 0x0c, 0xdc, 0x0a, 0x88, 0x06, 0x76, 0x01, 0xad, 0x00, 0x7d, 0xfe, 0x4a, 0xfd, 
-0x38, 0xfe, 0xc0, 0xfd, 0xc2, 0xfd, 0xa1, 0x00, 0x3a, 0xff, 0x62, 0x02, 0x9d, 0x02, 0xb1, 0x01, 
-0xbf, 0x04, 0xef, 0x00, 0x1e, 0x01, 0xf3, 0xfd, 0xb1, 0xf7, 0xfe, 0xf4, 0xf3, 0xec, 0x42, 0xea, 
-0x04, 0xe8, 0x05, 0xe7, 0x68, 0xeb, 0xad, 0xed, 0xf3, 0xf4, 0xd3, 0xf9, 0x0c, 0x00, 0x83, 0x07, 
-0x8a, 0x0a, 0xc4, 0x10, 0xc8, 0x11, 0xad, 0x12, 0x78, 0x14, 0x9d, 0x11, 0xf1, 0x11, 0xd8, 0x0e, 
-0x62, 0x0a, 0x53, 0x07, 0x63, 0x02, 0x8f, 0xff, 0x24, 0xfe, 0x81, 0xfc, 0x82, 0xfc, 0x4c, 0xfd, 
-0xda, 0xfc, 0x6c, 0xff, 0x56, 0x00, 0xcd, 0x01, 0xc1, 0x03, 0xa6, 0x03, 0xb5, 0x04, 0x62, 0x03, 
-0x19, 0x02, 0xb3, 0xfe, 0xb6, 0xfa, 0xf4, 0xf4, 0xe7, 0xef, 0x5b, 0xeb, 0x28, 0xe8, 0x16, 0xe9, 
-0xaf, 0xe8, 0x7b, 0xee, 0x71, 0xf2, 0x6a, 0xf7, 0xa5, 0xff, 0x6a, 0x03, 0x7f, 0x0a, 0x43, 0x0f, 
-0xac, 0x10, 0x73, 0x14, 0x08, 0x14, 0x17, 0x13, 0x75, 0x13, 0xe9, 0x0e, 0x53, 0x0c, 0xb9, 0x07, 
-0x96, 0x02, 0x4b, 0x00, 0x40, 0xfd, 0x54, 0xfc, 0xd5, 0xfb, 0x54, 0xfc, 0xd3, 0xfc, 0x44, 0xfe, 
-0x25, 0x00, 0x36, 0x01, 0xfc, 0x02, 0xc7, 0x03, 0x46, 0x04, 0x81, 0x03, 0xb6, 0x02, 0x7e, 0xff, 
-0xa9, 0xfa, 0x0a, 0xf7, 0x62, 0xef, 0xfd, 0xeb, 0xf2, 0xe9, 0x8e, 0xe6, 0xfe, 0xea, 0x43, 0xed, 
-0x55, 0xf1, 0xa2, 0xf9, 0x39, 0xfd, 0x8d, 0x04, 0xeb, 0x0a, 0x86, 0x0d, 0x42, 0x12, 0xc8, 0x13, 
-0xb9, 0x13, 0x8c, 0x14, 0x3d, 0x12, 0x44, 0x0f, 0x46, 0x0c, 0x74, 0x06, 0x05, 0x03, 0x5e, 0xff, 
-0x27, 0xfd, 0x56, 0xfc, 0x53, 0xfb, 0xbc, 0xfc, 0x29, 0xfc, 0x99, 0xfe, 0x9f, 0xff, 0xd8, 0x00, 
-0x32, 0x03, 0xf7, 0x02, 0xb9, 0x04, 0xb0, 0x03, 0xf3, 0x02, 0x59, 0x00, 0x56, 0xfb, 0xbf, 0xf6, 
-0x73, 0xf0, 0x6d, 0xeb, 0x3d, 0xe9, 0x31, 0xe8, 0xd8, 0xe8, 0xcd, 0xee, 0xb5, 0xf1, 0xad, 0xf7, 
-0xe5, 0xff, 0x75, 0x02, 0xe1, 0x0a, 0xc1, 0x0e, 0xd7, 0x0f, 0x01, 0x15, 0x6a, 0x14, 0x16, 0x14, 
-0x5c, 0x14, 0xd9, 0x0f, 0x8e, 0x0b, 0x0a, 0x08, 0xb5, 0x01, 0x1a, 0xff, 0xd6, 0xfd, 0x53, 0xfa, 
-0xda, 0xfb, 0x86, 0xfb, 0x76, 0xfb, 0xb2, 0xfe, 0xe2, 0xfe, 0xed, 0x00, 0xa5, 0x02, 0x71, 0x03, 
-0x0f, 0x04, 0x29, 0x04, 0xf6, 0x02, 0x34, 0xff, 0xaa, 0xfb, 0x6e, 0xf5, 0xfb, 0xef, 0x0a, 0xec, 
-0x36, 0xe9, 0x44, 0xe9, 0x65, 0xeb, 0x97, 0xef, 0xf6, 0xf3, 0x36, 0xfa, 0xe8, 0xff, 0x97, 0x05, 
-0x6f, 0x0b, 0xbb, 0x0e, 0xf7, 0x11, 0x13, 0x14, 0xcb, 0x14, 0x89, 0x14, 0xa1, 0x12, 0xa4, 0x0e, 
-0x2f, 0x0a, 0x08, 0x05, 0x7c, 0x00, 0x58, 0xfe, 0x83, 0xfb, 0xf5, 0xfa, 0x17, 0xfb, 0xc4, 0xfa, 
-0x40, 0xfc, 0xab, 0xfd, 0xc6, 0xfe, 0x61, 0x00, 0xf7, 0x01, 0x99, 0x02, 0xdf, 0x03, 0xde, 0x03, 
-0x47, 0x02, 0xcf, 0xff, 0xa8, 0xfb, 0x03, 0xf6, 0x6f, 0xf1, 0x7f, 0xed, 0xf7, 0xea, 0xc3, 0xeb, 
-0xb2, 0xec, 0x5b, 0xf0, 0xa3, 0xf4, 0xed, 0xf8, 0x89, 0xfe, 0xe3, 0x03, 0x64, 0x08, 0x01, 0x0c, 
-0xa3, 0x0f, 0x3d, 0x11, 0x55, 0x13, 0x31, 0x13, 0x2e, 0x11, 0x43, 0x0f, 0xd7, 0x0a, 0x3e, 0x07, 
-0x3b, 0x04, 0x20, 0x02, 0x55, 0x00, 0x71, 0xff, 0x53, 0xff, 0x2b, 0xfe, 0x1a, 0xff, 0xfa, 0xfe, 
-0xee, 0xfe, 0x4d, 0x00, 0x13, 0x00, 0xfd, 0x00, 0x50, 0x01, 0x61, 0x00, 0x14, 0xff, 0xea, 0xfb, 
-0xb9, 0xf7, 0x39, 0xf3, 0x73, 0xee, 0x17, 0xeb, 0x27, 0xea, 0xee, 0xe9, 0x43, 0xec, 0xe5, 0xef, 
-0xfb, 0xf3, 0x20, 0xfa, 0x7f, 0xff, 0xcf, 0x05, 0x38, 0x0b, 0x3f, 0x0f, 0x74, 0x13, 0xaa, 0x15, 
-0x23, 0x17, 0xbc, 0x16, 0x90, 0x14, 0x43, 0x11, 0x37, 0x0d, 0xc3, 0x08, 0x20, 0x05, 0x3e, 0x02, 
-0x44, 0xff, 0xa4, 0xfd, 0x0d, 0xfc, 0x4c, 0xfb, 0x20, 0xfb, 0x4a, 0xfb, 0x98, 0xfb, 0x1e, 0xfc, 
-0x57, 0xfd, 0xe2, 0xfd, 0x7c, 0xfe, 0x45, 0xfe, 0x0c, 0xfd, 0x5f, 0xfa, 0x2d, 0xf7, 0x3a, 0xf3, 
-0x6f, 0xef, 0xec, 0xed, 0xed, 0xec, 0xf2, 0xed, 0x69, 0xf0, 0x20, 0xf4, 0x06, 0xf9, 0x88, 0xfe, 
-0x32, 0x04, 0x4b, 0x09, 0xcf, 0x0d, 0x00, 0x11, 0x3d, 0x14, 0xb2, 0x15, 0x25, 0x16, 0xff, 0x14, 
-0xd4, 0x11, 0x93, 0x0e, 0xa3, 0x09, 0xb6, 0x05, 0x21, 0x02, 0xc4, 0xfe, 0xb5, 0xfc, 0xd9, 0xfa, 
-0x49, 0xfa, 0x38, 0xfa, 0x79, 0xfa, 0x16, 0xfb, 0xe9, 0xfb, 0x9b, 0xfc, 0xd0, 0xfd, 0xa5, 0xfe, 
-0x3e, 0xfe, 0xf3, 0xfd, 0xb1, 0xfb, 0x9c, 0xf8, 0x32, 0xf5, 0xe4, 0xf0, 0x2e, 0xee, 0x2d, 0xed, 
-0x9c, 0xed, 0x3e, 0xef, 0xc2, 0xf2, 0x1a, 0xf7, 0x06, 0xfc, 0xf1, 0x01, 0xef, 0x06, 0xa0, 0x0b, 
-0x69, 0x0f, 0x63, 0x12, 0xf8, 0x14, 0x2f, 0x16, 0xd4, 0x15, 0xbd, 0x13, 0x6c, 0x10, 0x14, 0x0c, 
-0xba, 0x07, 0xf3, 0x03, 0xce, 0x00, 0x1c, 0xfe, 0x33, 0xfc, 0x01, 0xfb, 0x3e, 0xfa, 0x5a, 0xfa, 
-0x74, 0xfa, 0xf7, 0xfa, 0xc8, 0xfb, 0xb2, 0xfc, 0x1d, 0xfe, 0xa4, 0xfe, 0x2f, 0xfe, 0xf2, 0xfc, 
-0x2a, 0xfa, 0x6e, 0xf6, 0x7b, 0xf2, 0xfe, 0xee, 0x94, 0xed, 0xc5, 0xed, 0x30, 0xef, 0x59, 0xf2, 
-0x5c, 0xf6, 0x65, 0xfb, 0x15, 0x01, 0x82, 0x06, 0xa1, 0x0b, 0xc7, 0x0f, 0x52, 0x13, 0x39, 0x16, 
-0xa8, 0x17, 0x96, 0x17, 0xa5, 0x15, 0x58, 0x12, 0x6d, 0x0e, 0x19, 0x0a, 0x3e, 0x06, 0x29, 0x03, 
-0x49, 0x00, 0x00, 0xfe, 0x6e, 0xfc, 0xc0, 0xfa, 0xca, 0xf9, 0x26, 0xf9, 0x9f, 0xf8, 0xae, 0xf8, 
-0xd9, 0xf8, 0x10, 0xf9, 0xbc, 0xf8, 0xa3, 0xf7, 0x5c, 0xf5, 0x73, 0xf2, 0x90, 0xee, 0x29, 0xea, 
-0x69, 0xe7, 0x3c, 0xe6, 0x63, 0xe7, 0x85, 0xea, 0xb5, 0xee, 0x59, 0xf4, 0x90, 0xfa, 0x4d, 0x01, 
-0xa5, 0x08, 0x18, 0x0f, 0x31, 0x14, 0x65, 0x18, 0xd9, 0x1b, 0xfa, 0x1d, 0x06, 0x1e, 0x5a, 0x1c, 
-0xb9, 0x18, 0x2f, 0x14, 0x88, 0x0f, 0xdc, 0x0a, 0x2d, 0x07, 0xba, 0x03, 0x7d, 0x00, 0xeb, 0xfd, 
-0xfb, 0xfb, 0x2a, 0xfa, 0xc8, 0xf8, 0x0f, 0xf8, 0x7e, 0xf7, 0xad, 0xf7, 0x3d, 0xf8, 0xb1, 0xf8, 
-0xbb, 0xf8, 0x80, 0xf7, 0xff, 0xf4, 0x28, 0xf2, 0x49, 0xee, 0x19, 0xea, 0x89, 0xe7, 0x48, 0xe6, 
-0x70, 0xe7, 0x87, 0xea, 0x87, 0xee, 0xe6, 0xf3, 0x13, 0xfa, 0x15, 0x01, 0x5f, 0x08, 0x1e, 0x0f, 
-0x7a, 0x14, 0xd4, 0x18, 0x72, 0x1c, 0x34, 0x1e, 0x26, 0x1e, 0x46, 0x1c, 0x80, 0x18, 0xe9, 0x13, 
-0x43, 0x0f, 0xf0, 0x0a, 0x13, 0x07, 0x75, 0x03, 0x2e, 0x00, 0x5e, 0xfd, 0x3f, 0xfb, 0xb4, 0xf9, 
-0x76, 0xf8, 0xc9, 0xf7, 0xda, 0xf7, 0x73, 0xf8, 0x82, 0xf9, 0x59, 0xfa, 0x5e, 0xfa, 0x4a, 0xf9, 
-0xff, 0xf6, 0xff, 0xf3, 0x41, 0xf0, 0x2d, 0xec, 0xfc, 0xe8, 0x88, 0xe7, 0x0c, 0xe8, 0x58, 0xea, 
-0xf3, 0xed, 0xa8, 0xf2, 0x83, 0xf8, 0x60, 0xff, 0x96, 0x06, 0x6b, 0x0d, 0xfe, 0x12, 0x3d, 0x17, 
-0xb6, 0x1a, 0xb6, 0x1c, 0xc6, 0x1c, 0x24, 0x1b, 0xa3, 0x17, 0x51, 0x13, 0xc5, 0x0e, 0x55, 0x0a, 
-0x0b, 0x07, 0xbd, 0x03, 0xa5, 0x00, 0x2e, 0xfe, 0xd0, 0xfb, 0x56, 0xfa, 0x6e, 0xf9, 0xcf, 0xf8, 
-0x98, 0xf8, 0x93, 0xf8, 0x38, 0xf9, 0x8f, 0xf9, 0x27, 0xf9, 0xe9, 0xf7, 0x62, 0xf5, 0x8c, 0xf2, 
-0x6e, 0xee, 0x18, 0xea, 0xa7, 0xe7, 0xd4, 0xe6, 0x48, 0xe8, 0xfc, 0xea, 0x9d, 0xee, 0xf6, 0xf3, 
-0x07, 0xfa, 0x33, 0x01, 0xcf, 0x08, 0xe1, 0x0e, 0x13, 0x14, 0x70, 0x18, 0xef, 0x1b, 0x27, 0x1e, 
-0x3e, 0x1e, 0x53, 0x1c, 0x43, 0x18, 0x8b, 0x13, 0x00, 0x0f, 0x76, 0x0a, 0x99, 0x06, 0xf0, 0x02, 
-0xa4, 0xff, 0x26, 0xfd, 0x4d, 0xfb, 0xf3, 0xf9, 0xcb, 0xf8, 0x3a, 0xf8, 0x3c, 0xf8, 0xd1, 0xf8, 
-0xe4, 0xf9, 0x9d, 0xfa, 0x87, 0xfa, 0x2e, 0xf9, 0x89, 0xf6, 0xa3, 0xf3, 0xe5, 0xef, 0x6f, 0xeb, 
-0x3c, 0xe8, 0xf6, 0xe6, 0xc2, 0xe7, 0x84, 0xea, 0x33, 0xee, 0xdf, 0xf2, 0x8a, 0xf8, 0x16, 0xff, 
-0x89, 0x06, 0x27, 0x0d, 0x8e, 0x12, 0x08, 0x17, 0x8e, 0x1a, 0x36, 0x1d, 0xf7, 0x1d, 0xb5, 0x1c, 
-0xa2, 0x19, 0xcf, 0x14, 0x2e, 0x10, 0x1b, 0x0c, 0xe2, 0x07, 0x3b, 0x04, 0xed, 0x00, 0x0f, 0xfe, 
-0x24, 0xfc, 0x32, 0xfa, 0x07, 0xf9, 0xfd, 0xf8, 0xd2, 0xf8, 0x4f, 0xf9, 0x58, 0xfa, 0x0f, 0xfb, 
-0x53, 0xfb, 0x4c, 0xfa, 0x56, 0xf8, 0x26, 0xf5, 0x5d, 0xf1, 0xbc, 0xed, 0xe6, 0xe9, 0xe4, 0xe7, 
-0xf4, 0xe7, 0x5d, 0xe9, 0x90, 0xec, 0xca, 0xf0, 0xd3, 0xf5, 0x12, 0xfc, 0x02, 0x03, 0xd7, 0x09, 
-0xc6, 0x0f, 0x3b, 0x14, 0x16, 0x18, 0xeb, 0x1a, 0x87, 0x1b, 0xf0, 0x1a, 0xb4, 0x18, 0xaa, 0x14, 
-0x22, 0x10, 0xea, 0x0b, 0x49, 0x08, 0x45, 0x05, 0x7a, 0x02, 0x89, 0xff, 0x51, 0xfd, 0x03, 0xfc, 
-0xa8, 0xfa, 0x16, 0xfa, 0x09, 0xfa, 0xe3, 0xf9, 0xb5, 0xfa, 0x99, 0xfb, 0x64, 0xfb, 0xe4, 0xfa, 
-0xe5, 0xf8, 0xc6, 0xf5, 0x76, 0xf2, 0x1f, 0xee, 0x2a, 0xea, 0x3b, 0xe7, 0x85, 0xe6, 0x33, 0xe8, 
-0xe5, 0xea, 0x34, 0xef, 0x40, 0xf4, 0xeb, 0xf9, 0xe7, 0x00, 0x8d, 0x07, 0x16, 0x0e, 0x4d, 0x13, 
-0x51, 0x17, 0xa0, 0x1a, 0x41, 0x1c, 0x8f, 0x1c, 0xd8, 0x1a, 0xf1, 0x16, 0x65, 0x12, 0x0a, 0x0e, 
-0xcd, 0x09, 0x7c, 0x06, 0x10, 0x03, 0xd8, 0xff, 0xef, 0xfd, 0x7c, 0xfb, 0xeb, 0xf9, 0xa7, 0xf9, 
-0x4f, 0xf9, 0x96, 0xf9, 0x11, 0xfa, 0xc6, 0xfa, 0xc6, 0xfa, 0x37, 0xfa, 0x0d, 0xf9, 0x05, 0xf6, 
-0x6e, 0xf2, 0xe6, 0xee, 0xc9, 0xea, 0x6d, 0xe7, 0x2d, 0xe6, 0xe5, 0xe6, 0x5c, 0xe9, 0x8f, 0xed, 
-0x60, 0xf2, 0xcf, 0xf7, 0x8f, 0xfe, 0xe2, 0x05, 0x29, 0x0c, 0x79, 0x11, 0xce, 0x15, 0x67, 0x19, 
-0x54, 0x1c, 0x88, 0x1c, 0x0f, 0x1b, 0x77, 0x18, 0x1d, 0x14, 0x85, 0x0f, 0x76, 0x0b, 0xa8, 0x07, 
-0x1f, 0x04, 0xa5, 0x01, 0x75, 0xff, 0x03, 0xfd, 0xc7, 0xfb, 0x42, 0xfb, 0xf1, 0xfa, 0xfb, 0xfa, 
-0xde, 0xfa, 0x13, 0xfc, 0x25, 0xfd, 0x6c, 0xfc, 0x2f, 0xfb, 0xef, 0xf8, 0x6b, 0xf5, 0x00, 0xf2, 
-0x1d, 0xed, 0x6e, 0xe9, 0xb7, 0xe6, 0x98, 0xe7, 0x9a, 0xe6, 0x24, 0xec, 0xe3, 0xec, 0x33, 0xee, 
-0x45, 0xff, 0x78, 0xff, 0x55, 0x0f, 0xb2, 0x14, 0xad, 0x16, 0xb9, 0x20, 0xdd, 0x1d, 0x10, 0x24, 
-0x61, 0x1d, 0x01, 0x1c, 0xbe, 0x16, 0x81, 0x0c, 0xc4, 0x09, 0xd9, 0x00, 0x6a, 0xfe, 0xe8, 0xfa, 
-0xcd, 0xf6, 0x0e, 0xf8, 0x8d, 0xf5, 0xf5, 0xf7, 0x2f, 0xfa, 0x4a, 0xfa, 0x25, 0xfe, 0x78, 0xff, 
-0x15, 0x01, 0x4e, 0x02, 0x3a, 0xff, 0xa2, 0xfe, 0xf3, 0xf7, 0xc0, 0xf2, 0x7f, 0xee, 0xc1, 0xe5, 
-0xcc, 0xe5, 0x20, 0xe7, 0xcd, 0xe6, 0x99, 0xec, 0x78, 0xf3, 0x21, 0xf9, 0x47, 0x00, 0x6c, 0x07, 
-0x4d, 0x0f, 0xd9, 0x12, 0x9c, 0x16, 0x4d, 0x19, 0x21, 0x18, 0xb8, 0x17, 0xd9, 0x15, 0x9c, 0x12, 
-0x56, 0x0e, 0x9f, 0x09, 0xcb, 0x05, 0x92, 0x00, 0x66, 0xff, 0xfb, 0xfd, 0x90, 0xfb, 0x58, 0xfc, 
-0xa4, 0xfa, 0x87, 0xfc, 0x29, 0xfe, 0x19, 0xff, 0x7f, 0x01, 0xa0, 0x02, 0x09, 0x04, 0x70, 0x04, 
-0xff, 0x02, 0xfd, 0x01, 0x30, 0xfc, 0x12, 0xf6, 0x46, 0xf2, 0x8e, 0xe8, 0xc6, 0xe4, 0x77, 0xe4, 
-0x78, 0xe4, 0x9c, 0xe6, 0x3b, 0xeb, 0xa1, 0xf4, 0x15, 0xf9, 0x9e, 0xff, 0xf2, 0x09, 0x39, 0x0e, 
-0x34, 0x13, 0x21, 0x18, 0x5b, 0x19, 0xd1, 0x19, 0xcb, 0x17, 0x88, 0x16, 0x35, 0x12, 0x43, 0x0b, 
-0xfc, 0x06, 0x02, 0x01, 0x83, 0xfd, 0x71, 0xfb, 0xf4, 0xf8, 0xc3, 0xf9, 0x59, 0xf8, 0x51, 0xf9, 
-0x37, 0xfc, 0xd4, 0xfc, 0xfa, 0xff, 0x1d, 0x02, 0x28, 0x03, 0x60, 0x04, 0xc9, 0x04, 0xe8, 0x02, 
-0x6d, 0xff, 0xd0, 0xf9, 0x92, 0xf3, 0x5b, 0xec, 0xff, 0xe4, 0xab, 0xe2, 0xae, 0xe0, 0x25, 0xe5, 
-0xab, 0xe7, 0xb6, 0xec, 0xf4, 0xf7, 0x29, 0xfc, 0x28, 0x05, 0x05, 0x10, 0x13, 0x13, 0x04, 0x19, 
-0x2a, 0x1c, 0x88, 0x1b, 0xac, 0x1c, 0xbb, 0x17, 0xfc, 0x15, 0x61, 0x10, 0x1a, 0x08, 0xa7, 0x04, 
-0xcc, 0xfd, 0xa1, 0xfa, 0xbb, 0xfa, 0x69, 0xf6, 0x97, 0xf9, 0x14, 0xfa, 0x54, 0xfa, 0x85, 0x00, 
-0x10, 0x01, 0x13, 0x04, 0x63, 0x08, 0x83, 0x07, 0xeb, 0x09, 0x7d, 0x08, 0x2f, 0x05, 0x05, 0x01, 
-0xb7, 0xf7, 0x39, 0xf3, 0xc4, 0xe7, 0x44, 0xe1, 0xbd, 0xdf, 0xa2, 0xde, 0xf5, 0xe2, 0xd2, 0xe5, 
-0x73, 0xef, 0xb3, 0xf7, 0x77, 0xfe, 0x9e, 0x09, 0xce, 0x10, 0x53, 0x15, 0x64, 0x1a, 0x7c, 0x1b, 
-0xbc, 0x1a, 0xa4, 0x18, 0x7f, 0x16, 0x3c, 0x12, 0x1b, 0x0b, 0x84, 0x06, 0x5a, 0x00, 0xfd, 0xf9, 
-0x54, 0xf9, 0xd8, 0xf8, 0x40, 0xf5, 0x96, 0xfa, 0xc4, 0xfb, 0x33, 0xfc, 0xb3, 0x02, 0x86, 0x03, 
-0xdc, 0x05, 0x72, 0x08, 0xbe, 0x07, 0xfc, 0x08, 0xb1, 0x04, 0x89, 0x02, 0xb4, 0xfc, 0xf0, 0xf3, 
-0xfd, 0xee, 0x01, 0xe4, 0xe4, 0xdf, 0x2a, 0xe1, 0xad, 0xe1, 0xf9, 0xe3, 0xf8, 0xed, 0x55, 0xf5, 
-0x8d, 0xfc, 0xe8, 0x07, 0x45, 0x0f, 0x17, 0x15, 0x29, 0x1a, 0x35, 0x1c, 0x73, 0x1b, 0x12, 0x1a, 
-0x67, 0x17, 0x04, 0x14, 0xa3, 0x0d, 0xe9, 0x07, 0x0f, 0x02, 0x54, 0xfb, 0x72, 0xf8, 0x8d, 0xf7, 
-0x85, 0xf5, 0x71, 0xf8, 0x17, 0xfa, 0x1d, 0xfb, 0x01, 0x01, 0x9e, 0x01, 0xe6, 0x05, 0xc3, 0x07, 
-0x01, 0x06, 0x64, 0x09, 0x21, 0x05, 0xa4, 0x02, 0xcc, 0xfe, 0x1e, 0xf5, 0x7f, 0xf0, 0x09, 0xe5, 
-0x43, 0xdf, 0x05, 0xe0, 0xa9, 0xdf, 0x63, 0xe4, 0xd3, 0xea, 0x67, 0xf4, 0x1f, 0xfc, 0x1a, 0x06, 
-0x3b, 0x0f, 0xe9, 0x15, 0x8f, 0x19, 0x02, 0x1c, 0xfe, 0x1c, 0xe9, 0x19, 0xfa, 0x17, 0x08, 0x14, 
-0xec, 0x0d, 0x95, 0x08, 0xb3, 0x01, 0xc1, 0xfc, 0xd7, 0xf8, 0xa1, 0xf7, 0x71, 0xf9, 0x20, 0xf7, 
-0xe6, 0xfa, 0x6b, 0xfd, 0x0f, 0xfe, 0x22, 0x03, 0xda, 0x04, 0xee, 0x06, 0xdb, 0x07, 0x77, 0x07, 
-0xb6, 0x07, 0x7d, 0x03, 0x8d, 0xff, 0xc8, 0xf9, 0x28, 0xf2, 0x1d, 0xe9, 0x1c, 0xe2, 0x4e, 0xe0, 
-0x4b, 0xe2, 0x69, 0xe4, 0xff, 0xe8, 0xde, 0xf3, 0x6d, 0xfa, 0xd9, 0x01, 0x66, 0x0d, 0xbf, 0x12, 
-0x3f, 0x17, 0x88, 0x1a, 0x88, 0x1b, 0xc5, 0x19, 0x21, 0x17, 0xae, 0x14, 0x7e, 0x0e, 0xe3, 0x07, 
-0x7c, 0x03, 0x71, 0xfd, 0x53, 0xf8, 0xb4, 0xf8, 0x7a, 0xf7, 0xc4, 0xf6, 0xb0, 0xf9, 0x7d, 0xfb, 
-0x98, 0xfd, 0x23, 0x01, 0x12, 0x04, 0x57, 0x07, 0x7a, 0x06, 0xad, 0x08, 0x4c, 0x08, 0x59, 0x03, 
-0x52, 0x02, 0x8c, 0xfb, 0x0a, 0xf3, 0x91, 0xed, 0x8a, 0xe3, 0x08, 0xe1, 0xda, 0xe1, 0xb9, 0xe2, 
-0x92, 0xe8, 0x82, 0xf0, 0x91, 0xf7, 0x8e, 0x00, 0x05, 0x0a, 0x90, 0x11, 0x72, 0x16, 0x05, 0x1a, 
-0xdc, 0x1b, 0x37, 0x1a, 0x1a, 0x18, 0xe2, 0x14, 0x35, 0x10, 0x2c, 0x0a, 0x3e, 0x04, 0x76, 0xff, 
-0x9c, 0xfa, 0xb2, 0xf6, 0xef, 0xf8, 0x56, 0xf7, 0x1f, 0xf8, 0xc1, 0xfc, 0x4a, 0xfd, 0xe5, 0xff, 
-0x42, 0x05, 0x1c, 0x05, 0xf0, 0x06, 0x64, 0x08, 0x70, 0x06, 0x72, 0x04, 0x1a, 0x01, 0x11, 0xfc, 
-0x62, 0xf4, 0x2f, 0xec, 0x03, 0xe6, 0xe2, 0xe0, 0xab, 0xdf, 0x4f, 0xe4, 0xaf, 0xe7, 0x17, 0xee, 
-0x9e, 0xf8, 0x51, 0x01, 0x55, 0x09, 0x33, 0x12, 0xd2, 0x17, 0xdc, 0x1b, 0xcd, 0x1b, 0xef, 0x1a, 
-0x62, 0x19, 0x6b, 0x14, 0x92, 0x10, 0xcd, 0x0b, 0xed, 0x03, 0x2e, 0x00, 0xda, 0xfa, 0xb5, 0xf6, 
-0xd9, 0xf7, 0x38, 0xf6, 0xad, 0xf8, 0xeb, 0xfa, 0xcd, 0xfb, 0x2f, 0x01, 0x4c, 0x03, 0xf1, 0x03, 
-0x58, 0x07, 0xb9, 0x06, 0x61, 0x06, 0xb9, 0x04, 0x51, 0x00, 0x41, 0xfc, 0x1d, 0xf4, 0xcf, 0xec, 
-0xd4, 0xe6, 0x8e, 0xe0, 0xd3, 0xe2, 0x95, 0xe5, 0x93, 0xe6, 0x6c, 0xf1, 0x54, 0xfa, 0x56, 0xff, 
-0x85, 0x0a, 0x65, 0x13, 0x23, 0x16, 0xeb, 0x1a, 0x6a, 0x1c, 0xbc, 0x19, 0xe5, 0x17, 0x02, 0x15, 
-0x58, 0x10, 0x40, 0x0b, 0xc5, 0x04, 0x52, 0x00, 0x9d, 0xfa, 0x86, 0xf5, 0xc9, 0xf7, 0xed, 0xf6, 
-0x65, 0xf6, 0x55, 0xfb, 0xda, 0xfc, 0x6b, 0xff, 0xca, 0x03, 0xbe, 0x04, 0xc5, 0x07, 0x3a, 0x08, 
-0xe7, 0x06, 0xd0, 0x04, 0xaf, 0xff, 0xc2, 0xfa, 0x7a, 0xf3, 0x9f, 0xea, 0x36, 0xe5, 0x9f, 0xe0, 
-0x9d, 0xe2, 0x6a, 0xe5, 0xb4, 0xe7, 0xf5, 0xf2, 0x09, 0xfb, 0xed, 0x00, 0xc1, 0x0b, 0x29, 0x13, 
-0x73, 0x17, 0xea, 0x1a, 0x08, 0x1b, 0xe7, 0x1a, 0x31, 0x18, 0xcf, 0x13, 0xd4, 0x10, 0xaf, 0x0a, 
-0xed, 0x03, 0xd2, 0xff, 0x5d, 0xfa, 0x84, 0xf7, 0x6e, 0xf7, 0xda, 0xf7, 0xc5, 0xf8, 0x27, 0xfa, 
-0x7c, 0xfd, 0x52, 0x00, 0x53, 0x02, 0xe8, 0x05, 0x47, 0x07, 0x50, 0x06, 0x38, 0x05, 0x4d, 0x02, 
-0x09, 0xfd, 0xc9, 0xf7, 0xb2, 0xf0, 0x7f, 0xe6, 0xb5, 0xe2, 0x1d, 0xe3, 0x3c, 0xe3, 0x20, 0xe6, 
-0x97, 0xed, 0xab, 0xf6, 0xe7, 0xfd, 0x17, 0x06, 0x3a, 0x10, 0xf4, 0x15, 0x07, 0x19, 0x39, 0x1c, 
-0x7e, 0x1b, 0x35, 0x18, 0xb6, 0x14, 0xc3, 0x11, 0x2c, 0x0c, 0x52, 0x06, 0x66, 0x02, 0xf0, 0xfc, 
-0x02, 0xf9, 0x3b, 0xf8, 0xf0, 0xf7, 0xb5, 0xf8, 0x2f, 0xf9, 0x4f, 0xfb, 0xde, 0xff, 0xb1, 0x00, 
-0x00, 0x03, 0xc6, 0x06, 0x2b, 0x06, 0xef, 0x04, 0x12, 0x04, 0x88, 0x00, 0x7b, 0xfa, 0x86, 0xf3, 
-0xa4, 0xeb, 0x76, 0xe5, 0x20, 0xe3, 0x3f, 0xe5, 0x39, 0xe6, 0x0d, 0xea, 0x44, 0xf4, 0xcc, 0xfb, 
-0x4c, 0x03, 0xbd, 0x0d, 0xef, 0x13, 0x87, 0x18, 0xd9, 0x1a, 0xcc, 0x19, 0xd3, 0x18, 0xe2, 0x14, 
-0xdb, 0x10, 0x15, 0x0e, 0x72, 0x08, 0x0b, 0x02, 0xf0, 0xfe, 0xe7, 0xfa, 0x5a, 0xf8, 0x4a, 0xf9, 
-0x24, 0xf8, 0xce, 0xf9, 0x48, 0xfb, 0xf1, 0xfc, 0x70, 0x00, 0xa7, 0x01, 0xb0, 0x03, 0x9f, 0x05, 
-0x11, 0x03, 0x7f, 0x01, 0x2a, 0xff, 0xd1, 0xf8, 0xc1, 0xf3, 0xde, 0xeb, 0x51, 0xe5, 0x87, 0xe6, 
-0x2b, 0xe6, 0x03, 0xe7, 0x5d, 0xef, 0x7d, 0xf5, 0x0d, 0xfd, 0x9f, 0x06, 0x1a, 0x0e, 0xcc, 0x15, 
-0xc0, 0x19, 0x5c, 0x1b, 0xc5, 0x1b, 0x6f, 0x18, 0x46, 0x14, 0x0a, 0x11, 0x6d, 0x0b, 0x6a, 0x06, 
-0x0d, 0x02, 0xd2, 0xfd, 0xac, 0xfa, 0xbf, 0xf7, 0x3c, 0xf9, 0xa8, 0xf9, 0xb4, 0xf8, 0x85, 0xfb, 
-0x6b, 0xfd, 0x3e, 0xfe, 0x7e, 0x01, 0x71, 0x02, 0x33, 0x02, 0x17, 0x01, 0xa0, 0xfe, 0x29, 0xfb, 
-0x5d, 0xf5, 0x1d, 0xef, 0x3c, 0xea, 0xc6, 0xe6, 0x72, 0xe6, 0x8b, 0xe9, 0x28, 0xec, 0xf0, 0xf2, 
-0xbe, 0xfb, 0xc6, 0x01, 0x47, 0x0a, 0xb5, 0x12, 0x51, 0x17, 0xee, 0x1a, 0xe7, 0x1b, 0x0f, 0x1a, 
-0x36, 0x17, 0x96, 0x11, 0x0c, 0x0e, 0xa9, 0x09, 0x54, 0x03, 0xf4, 0x00, 0x7f, 0xfd, 0xf9, 0xf9, 
-0x84, 0xfa, 0xaf, 0xfa, 0xef, 0xf9, 0x79, 0xfb, 0xea, 0xfb, 0x46, 0xfd, 0x23, 0xff, 0xa3, 0xff, 
-0xcb, 0x00, 0xaf, 0xff, 0x52, 0xfd, 0xb5, 0xfa, 0x4c, 0xf5, 0xfd, 0xef, 0x5f, 0xeb, 0x90, 0xe7, 
-0x96, 0xe7, 0xb0, 0xe9, 0x43, 0xec, 0xdf, 0xf1, 0x2e, 0xfb, 0x71, 0x02, 0x89, 0x08, 0xf2, 0x11, 
-0xfd, 0x16, 0x4f, 0x19, 0x7e, 0x1b, 0x28, 0x19, 0xbd, 0x15, 0x26, 0x12, 0x57, 0x0d, 0xf2, 0x08, 
-0xdd, 0x04, 0xc2, 0x00, 0xc5, 0xfd, 0xe0, 0xfb, 0xb6, 0xfb, 0x5f, 0xfc, 0x1a, 0xfd, 0x61, 0xfd, 
-0xf1, 0xfd, 0xd1, 0xfe, 0x71, 0xff, 0x64, 0xff, 0x6a, 0xff, 0xa1, 0xfe, 0x77, 0xfb, 0x3c, 0xf8, 
-0xb6, 0xf2, 0x14, 0xee, 0x26, 0xea, 0xf8, 0xe5, 0x93, 0xe7, 0x0b, 0xeb, 0xe4, 0xec, 0xab, 0xf2, 
-0xc3, 0xfc, 0xa0, 0x03, 0x9f, 0x0a, 0x91, 0x12, 0xfb, 0x17, 0x3c, 0x1a, 0x34, 0x1b, 0x0d, 0x1a, 
-0x3d, 0x15, 0x05, 0x11, 0x84, 0x0c, 0x9f, 0x08, 0xc4, 0x03, 0x92, 0x00, 0x91, 0xfe, 0xf4, 0xfb, 
-0x7d, 0xfc, 0xec, 0xfc, 0x73, 0xfd, 0x9f, 0xfe, 0x11, 0xfe, 0x87, 0xfe, 0x5e, 0xff, 0x00, 0xfe, 
-0xa9, 0xfd, 0xf0, 0xfb, 0x51, 0xf8, 0x92, 0xf4, 0x4c, 0xef, 0x70, 0xea, 0x14, 0xe8, 0xdc, 0xe6, 
-0x27, 0xe9, 0x80, 0xed, 0x37, 0xf1, 0x71, 0xf8, 0x1f, 0x01, 0x75, 0x09, 0x42, 0x0f, 0x46, 0x15, 
-0x16, 0x1a, 0x60, 0x1a, 0xd3, 0x19, 0xb4, 0x17, 0xa6, 0x12, 0xbe, 0x0d, 0x4c, 0x09, 0x8d, 0x04, 
-0x6e, 0x02, 0x65, 0xfe, 0xcb, 0xfc, 0x9c, 0xfd, 0xf0, 0xfb, 0x56, 0xfd, 0x07, 0xff, 0xf8, 0xfe, 
-0x22, 0xff, 0xf5, 0xfe, 0x9a, 0xfe, 0xc4, 0xfd, 0x5d, 0xfb, 0x44, 0xf9, 0x09, 0xf5, 0x41, 0xee, 
-0x12, 0xea, 0x45, 0xe7, 0xa9, 0xe5, 0x14, 0xe7, 0xeb, 0xeb, 0x63, 0xf1, 0xc3, 0xf6, 0x39, 0x00, 
-0xca, 0x09, 0x7e, 0x0f, 0x2b, 0x16, 0xeb, 0x1a, 0x38, 0x1b, 0x62, 0x1b, 0xee, 0x18, 0x9b, 0x13, 
-0x61, 0x0f, 0x2d, 0x0a, 0xfc, 0x04, 0x17, 0x02, 0x7b, 0xff, 0xa4, 0xfd, 0xc9, 0xfc, 0xbe, 0xfd, 
-0xaf, 0xfe, 0x5e, 0xff, 0xd0, 0x00, 0xc4, 0x00, 0x2f, 0xff, 0xc0, 0xfe, 0xbd, 0xfd, 0x86, 0xf9, 
-0xe6, 0xf6, 0xc0, 0xf2, 0x7d, 0xeb, 0xaa, 0xe7, 0x84, 0xe4, 0x76, 0xe2, 0x9c, 0xe5, 0x42, 0xea, 
-0x53, 0xef, 0xf2, 0xf6, 0x25, 0x00, 0x13, 0x09, 0x13, 0x11, 0x9f, 0x17, 0x1b, 0x1c, 0xad, 0x1d, 
-0x10, 0x1d, 0x1a, 0x1a, 0x2d, 0x16, 0x84, 0x10, 0xa3, 0x09, 0xf4, 0x05, 0x86, 0x01, 0xc7, 0xfd, 
-0x81, 0xfc, 0x73, 0xfc, 0x42, 0xfd, 0xae, 0xfd, 0x96, 0xff, 0xb6, 0x01, 0xa9, 0x01, 0x32, 0x00, 
-0x0d, 0x00, 0xd3, 0xfd, 0x6e, 0xfa, 0xe3, 0xf6, 0x97, 0xf1, 0x80, 0xeb, 0x79, 0xe7, 0x6e, 0xe5, 
-0x18, 0xe3, 0xe2, 0xe6, 0xb1, 0xeb, 0x77, 0xef, 0x9a, 0xf8, 0x74, 0x01, 0xbd, 0x08, 0x34, 0x11, 
-0x34, 0x17, 0x30, 0x1b, 0xf3, 0x1c, 0xdb, 0x1b, 0x2d, 0x1a, 0xd6, 0x14, 0x9d, 0x0f, 0x1d, 0x0b, 
-0xb8, 0x04, 0x81, 0x01, 0xb9, 0xfe, 0xb2, 0xfb, 0x09, 0xfd, 0x26, 0xfd, 0x5e, 0xfd, 0x5c, 0x00, 
-0xe8, 0xff, 0x33, 0x00, 0x40, 0x00, 0x8e, 0xfe, 0xf0, 0xfb, 0xff, 0xf7, 0xea, 0xf3, 0xdb, 0xee, 
-0xa9, 0xe9, 0xfc, 0xe7, 0x2a, 0xe5, 0x71, 0xe4, 0xc1, 0xea, 0x88, 0xed, 0x7d, 0xf4, 0x9a, 0xfc, 
-0x8d, 0x03, 0x44, 0x0d, 0xad, 0x12, 0x15, 0x18, 0xca, 0x1c, 0xde, 0x1b, 0x9f, 0x1a, 0x45, 0x18, 
-0x31, 0x13, 0xea, 0x0d, 0xef, 0x07, 0xd3, 0x03, 0x94, 0x00, 0x6e, 0xfc, 0xec, 0xfb, 0xc9, 0xfc, 
-0x78, 0xfc, 0xba, 0xfd, 0xf5, 0xfe, 0xb2, 0xff, 0xcf, 0xff, 0xf1, 0xfe, 0xa7, 0xfc, 0x16, 0xf9, 
-0x9a, 0xf5, 0x28, 0xf1, 0x3f, 0xec, 0x25, 0xea, 0x7c, 0xe7, 0xf7, 0xe5, 0xb8, 0xe9, 0x05, 0xef, 
-0xfd, 0xf4, 0xb5, 0xfa, 0xb0, 0x02, 0xb5, 0x0b, 0x19, 0x0f, 0x5f, 0x15, 0xd3, 0x19, 0xe3, 0x18, 
-0x10, 0x1a, 0x79, 0x16, 0x83, 0x12, 0x54, 0x0f, 0xb4, 0x08, 0x67, 0x05, 0xd9, 0x01, 0xe5, 0xfd, 
-0xdd, 0xfd, 0xbb, 0xfc, 0xa8, 0xfc, 0x9d, 0xfc, 0x45, 0xfd, 0xc3, 0xfe, 0x93, 0xfc, 0x5d, 0xfb, 
-0x34, 0xfa, 0x84, 0xf6, 0x67, 0xf4, 0x4b, 0xf0, 0xe9, 0xed, 0x44, 0xec, 0xcb, 0xe9, 0x0c, 0xed, 
-0x17, 0xed, 0x16, 0xf2, 0xdd, 0xf8, 0xc5, 0xfb, 0x2e, 0x04, 0xa9, 0x09, 0xf0, 0x0d, 0xda, 0x13, 
-0x00, 0x15, 0x8c, 0x16, 0x96, 0x16, 0xf9, 0x12, 0x17, 0x11, 0xa8, 0x0c, 0x71, 0x08, 0x7f, 0x06, 
-0xbc, 0x02, 0x97, 0x00, 0xfa, 0xfe, 0x72, 0xfd, 0x2c, 0xfe, 0x30, 0xfd, 0x45, 0xfe, 0x06, 0xfe, 
-0xc4, 0xfc, 0xd3, 0xfc, 0x18, 0xfa, 0x3b, 0xf9, 0xea, 0xf6, 0x40, 0xf3, 0xf1, 0xf2, 0xdd, 0xef, 
-0x04, 0xee, 0x9a, 0xef, 0x25, 0xef, 0x62, 0xf3, 0xe9, 0xf6, 0x7b, 0xfa, 0xe6, 0x00, 0x84, 0x03, 
-0x01, 0x0a, 0x5f, 0x0e, 0xa6, 0x0f, 0xf5, 0x12, 0xd5, 0x11, 0x90, 0x11, 0xaf, 0x0f, 0x9f, 0x0c, 
-0x7f, 0x0a, 0x18, 0x07, 0x47, 0x04, 0x53, 0x02, 0x1d, 0x00, 0xd0, 0xfe, 0x16, 0xff, 0x1d, 0xfe, 
-0xa3, 0xfe, 0x79, 0xfd, 0xba, 0xfd, 0x46, 0xfd, 0x7c, 0xfa, 0xc7, 0xfa, 0x04, 0xf9, 0xe1, 0xf7, 
-0xd0, 0xf5, 0xf1, 0xf3, 0x6c, 0xf4, 0x37, 0xf2, 0xbe, 0xf3, 0x7c, 0xf5, 0x8e, 0xf7, 0xcc, 0xfb, 
-0x7b, 0xfd, 0xa4, 0x01, 0x0b, 0x05, 0xaa, 0x07, 0x0b, 0x0b, 0xac, 0x0b, 0xa3, 0x0d, 0x86, 0x0d, 
-0xaf, 0x0b, 0x8b, 0x0b, 0x95, 0x08, 0x5c, 0x06, 0x62, 0x05, 0x73, 0x02, 0x5f, 0x02, 0x91, 0x00, 
-0xf1, 0xff, 0x49, 0x00, 0x94, 0xfe, 0x30, 0xff, 0xe6, 0xfd, 0x44, 0xfd, 0x13, 0xfd, 0xb6, 0xfb, 
-0x1a, 0xfb, 0xb8, 0xfa, 0x95, 0xf9, 0x5d, 0xfa, 0x7a, 0xf9, 0x1b, 0xf9, 0x05, 0xfa, 0xe8, 0xf8, 
-0xd0, 0xf9, 0xde, 0xfa, 0x4a, 0xfc, 0x72, 0xfd, 0xc5, 0xfe, 0x6b, 0x01, 0x8c, 0x02, 0x89, 0x03, 
-0xc8, 0x04, 0xb9, 0x05, 0x89, 0x05, 0xb6, 0x05, 0x21, 0x06, 0xb6, 0x05, 0x78, 0x05, 0xef, 0x04, 
-0x32, 0x04, 0x18, 0x03, 0x86, 0x02, 0xe1, 0x01, 0x83, 0x01, 0x34, 0x01, 0xe1, 0xff, 0xe5, 0xff, 
-0x1d, 0xfe, 0xeb, 0xfd, 0x92, 0xfd, 0xa1, 0xfd, 0x5c, 0xfd, 0x03, 0xfe, 0x69, 0xfe, 0xe6, 0xfc, 
-0x5d, 0xfd, 0x78, 0xfd, 0x77, 0xfe, 0x55, 0xfc, 0x34, 0xfd, 0x20, 0xfe, 0x19, 0xfd, 0x19, 0xfd, 
-0x60, 0xfd, 0xcb, 0xfe, 0x99, 0xfe, 0xa9, 0xff, 0x4c, 0x01, 0x49, 0x01, 0x62, 0x02, 0xb2, 0x01, 
-0xa5, 0x03, 0xd3, 0x03, 0x3f, 0x02, 0x9b, 0x03, 0xc6, 0x02, 0x5b, 0x02, 0x4a, 0x00, 0x10, 0x01, 
-0x51, 0x01, 0x2c, 0x00, 0x8f, 0xff, 0x34, 0xff, 0x87, 0xff, 0xdd, 0xfe, 0x56, 0xff, 0x75, 0xff, 
-0x50, 0x00, 0x97, 0xff, 0x63, 0x00, 0xac, 0x00, 0xe8, 0xff, 0x85, 0xff, 0x27, 0xff, 0x9f, 0xff, 
-0x81, 0xfe, 0xcf, 0xfe, 0x8a, 0xfe, 0xe1, 0xfd, 0xc2, 0xfe, 0x9d, 0xfe, 0x14, 0xff, 0x20, 0xff, 
-0x08, 0x00, 0x28, 0x00, 0xa9, 0x00, 0x42, 0x01, 0xb7, 0x00, 0x8b, 0x01, 0xaf, 0x01, 0xf7, 0x01, 
-0xcb, 0x00, 0x4b, 0x01, 0x73, 0x00, 0xc5, 0x00, 0xdb, 0x00, 0x90, 0x00, 0x51, 0x00, 0x30, 0xff, 
-0xf5, 0x00, 0x31, 0x00, 0xaf, 0xff, 0xf6, 0xff, 0x26, 0x00, 0x59, 0xff, 0x3d, 0xfe, 0x6a, 0xff, 
-0xca, 0xfe, 0xde, 0xfd, 0x6d, 0xff, 0xd8, 0xfe, 0xfc, 0xfe, 0xcf, 0xfe, 0xe5, 0xfe, 0xe1, 0xff, 
-0x53, 0xff, 0x97, 0x00, 0x37, 0x00, 0xdc, 0x00, 0x06, 0x01, 0x7b, 0xff, 0x18, 0x01, 0x9e, 0x00, 
-0x89, 0xff, 0x3e, 0x00, 0x88, 0x00, 0x98, 0x00, 0x19, 0x00, 0xbd, 0x00, 0x5f, 0x00, 0x60, 0xff, 
-0x6d, 0x00, 0xe1, 0x00, 0x58, 0x00, 0x98, 0x00, 0x34, 0x00, 0x9e, 0xff, 0x7d, 0xff, 0xee, 0xfe, 
-0x2c, 0xff, 0xfb, 0xfe, 0x53, 0xff, 0x22, 0xff, 0xba, 0xff, 0x75, 0xff, 0xad, 0xff, 0x04, 0x00, 
-0x02, 0x00, 0x1d, 0x00, 0x79, 0x00, 0x30, 0x00, 0xa0, 0xff, 0xa3, 0x00, 0x9c, 0xff, 0x93, 0xff, 
-0xe2, 0xff, 0xe7, 0xff, 0xe5, 0xff, 0x69, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x3d, 0x00, 0x28, 0x01, 
-0x65, 0x00, 0x59, 0x01, 0x0d, 0x00, 0x1f, 0x00, 0xfe, 0xff, 0x50, 0xff, 0xda, 0xff, 0x0d, 0xff, 
-0x7c, 0xff, 0xf2, 0xfe, 0xb6, 0xff, 0xd6, 0xfe, 0xd9, 0xff, 0x48, 0x00, 0x84, 0xff, 0xc0, 0x00, 
-0xb0, 0x00, 0x93, 0x00, 0x8f, 0x00, 0x5e, 0x00, 0x46, 0x00, 0x65, 0xff, 0x9e, 0xff, 0x70, 0xff, 
-0xec, 0xfe, 0x88, 0xff, 0x2e, 0xff, 0xb8, 0xff, 0x37, 0x00, 0x6a, 0xff, 0x1f, 0x01, 0x1f, 0x00, 
-0x1a, 0x01, 0x5f, 0x00, 0xf3, 0x00, 0x15, 0x00, 0x2d, 0x01, 0xee, 0xff, 0xad, 0xff, 0x58, 0x00, 
-0x23, 0xff, 0x01, 0x00, 0xd3, 0xfe, 0xda, 0x00, 0xec, 0xfe, 0xa7, 0x00, 0x4c, 0xff, 0x59, 0x00, 
-0xf0, 0xff, 0x1a, 0x00, 0x45, 0x00, 0xb3, 0xff, 0x87, 0x00, 0x38, 0xff, 0x9f, 0x00, 0xe0, 0xfe, 
-0xe8, 0xff, 0x85, 0xff, 0xac, 0xff, 0x91, 0xff, 0x01, 0x00, 0xba, 0xff, 0xee, 0xff, 0x6c, 0x00, 
-0x33, 0x00, 0x92, 0x00, 0xd2, 0xff, 0xb0, 0x00, 0x71, 0xff, 0xe8, 0xff, 0x07, 0x00, 0x08, 0x00, 
-0xf1, 0xff, 0xb5, 0xff, 0x08, 0x00, 0xf5, 0xfe, 0x38, 0x00, 0xb1, 0xff, 0x97, 0xff, 0x4c, 0x00, 
-0xed, 0xff, 0xe4, 0xff, 0xaa, 0xff, 0x9b, 0x00, 0x66, 0xff, 0x43, 0x00, 0x08, 0x00, 0x3a, 0x00, 
-0xa3, 0xff, 0x79, 0xff, 0xb0, 0x00, 0xa5, 0xfe, 0xf6, 0x00, 0x42, 0xff, 0x3c, 0x00, 0x40, 0x00, 
-0x25, 0xff, 0x16, 0x01, 0x51, 0xff, 0x71, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x99, 0xff, 0x9d, 0x00, 
-0x9c, 0xff, 0xaa, 0xff, 0x3e, 0x00, 0x57, 0xff, 0x50, 0x00, 0x73, 0xff, 0x0c, 0x00, 0xff, 0xff, 
-0x03, 0x00, 0xb1, 0xff, 0xdd, 0xff, 0x69, 0x00, 0xef, 0xff, 0x04, 0x00, 0x28, 0x00, 0x56, 0x00, 
-0x96, 0xff, 0x40, 0x00, 0xac, 0xff, 0x1f, 0x00, 0xd0, 0xff, 0x8f, 0xff, 0xf5, 0xff, 0xe0, 0xff, 
-0x08, 0x00, 0xbd, 0xff, 0x82, 0x00, 0x4d, 0xff, 0x5e, 0x00, 0xdd, 0xff, 0x04, 0x00, 0xf2, 0xff, 
-0xc0, 0xff, 0x20, 0x00, 0x5b, 0xff, 0x73, 0x00, 0x46, 0xff, 0x0c, 0x00, 0xc8, 0xff, 0xaa, 0xff, 
-0xd6, 0xff, 0xf8, 0xff, 0x14, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x5e, 0x00, 0xef, 0xff, 
-0xd0, 0xff, 0x56, 0x00, 0x15, 0x00, 0x8f, 0xff, 0xd1, 0x00, 0xfb, 0xfe, 0x91, 0x00, 0x6c, 0xff, 
-0x1c, 0x00, 0x43, 0x00, 0x87, 0xff, 0x4d, 0x00, 0xb9, 0xff, 0xe4, 0xff, 0x91, 0xff, 0xd8, 0x00, 
-0xd4, 0xfe, 0xf7, 0x00, 0xf1, 0xfe, 0x63, 0x00, 0xc7, 0xff, 0x53, 0xff, 0x20, 0x01, 0x9d, 0xfe, 
-0x9c, 0x00, 0x59, 0xff, 0x43, 0x00, 0x8f, 0xff, 0x86, 0x00, 0x5d, 0xff, 0x95, 0x00, 0x7d, 0xff, 
-0x44, 0x00, 0xd7, 0xff, 0xf4, 0xff, 0x94, 0x00, 0x2c, 0xff, 0xa7, 0x00, 0x45, 0xff, 0xb8, 0x00, 
-0x4e, 0xff, 0x43, 0x00, 0xb4, 0xff, 0x6b, 0x00, 0xa5, 0xff, 0x18, 0x00, 0x0c, 0x00, 0x87, 0xff, 
-0xe0, 0x00, 0x1c, 0xff, 0xcf, 0x00, 0x2b, 0xff, 0x65, 0x00, 0xf8, 0xff, 0xe1, 0xff, 0x14, 0x00, 
-0xe7, 0xff, 0xdf, 0xff, 0x05, 0x00, 0x19, 0x00, 0xd3, 0xff, 0x63, 0x00, 0xac, 0xff, 0x82, 0x00, 
-0xdf, 0xff, 0xa3, 0x00, 0x27, 0xff, 0x0f, 0x01, 0x9d, 0xff, 0x2d, 0x00, 0x07, 0x00, 0xe8, 0xff, 
-0x36, 0x00, 0xab, 0xff, 0x74, 0x00, 0x68, 0xff, 0x72, 0x00, 0x85, 0xff, 0x89, 0x00, 0x5b, 0xff, 
-0xb0, 0x00, 0xaa, 0xff, 0xd9, 0xff, 0x9f, 0x00, 0x14, 0xff, 0x6a, 0x00, 0x91, 0xff, 0x51, 0x00, 
-0x5e, 0xff, 0x71, 0x00, 0xc3, 0xff, 0xda, 0xff, 0xff, 0xff, 0x13, 0x00, 0xc2, 0xff, 0x4d, 0x00, 
-0xf0, 0xff, 0xed, 0xff, 0x8f, 0x00, 0x4f, 0xff, 0xf3, 0x00, 0x35, 0xff, 0x8b, 0x00, 0xbf, 0xff, 
-0x07, 0x00, 0x4b, 0x00, 0xa3, 0xff, 0x00, 0x00, 0x1f, 0x00, 0xc0, 0xff, 0x21, 0x00, 0x59, 0x00, 
-0x6f, 0xff, 0x93, 0x00, 0x8a, 0xff, 0x6d, 0x00, 0xc7, 0xff, 0x0e, 0x00, 0xff, 0xff, 0xc9, 0xff, 
-0x36, 0x00, 0xcc, 0xff, 0x57, 0x00, 0x9d, 0xff, 0x28, 0x00, 0x16, 0x00, 0xd3, 0xff, 0x72, 0x00, 
-0xed, 0xff, 0xce, 0xff, 0xb7, 0x00, 0xa2, 0xff, 0x16, 0x00, 0x78, 0x00, 0x97, 0xff, 0x48, 0x00, 
-0xb5, 0xff, 0x57, 0x00, 0x80, 0xff, 0x60, 0x00, 0xfb, 0xff, 0xc9, 0xff, 0xff, 0xff, 0x2f, 0x00, 
-0xe5, 0xff, 0xbc, 0xff, 0x82, 0x00, 0x94, 0xff, 0x2d, 0x00, 0x23, 0x00, 0x94, 0xff, 0x32, 0x00, 
-0x30, 0x00, 0x65, 0xff, 0xbf, 0x00, 0x3d, 0xff, 0x4c, 0x00, 0x1e, 0x00, 0xdd, 0xff, 0x1e, 0x00, 
-0x22, 0x00, 0xde, 0xff, 0x72, 0x00, 0xdb, 0xff, 0xef, 0xff, 0xa3, 0x00, 0x93, 0xff, 0x2b, 0x00, 
-0x32, 0x00, 0xeb, 0xff, 0x36, 0x00, 0xd1, 0xff, 0x34, 0x00, 0x42, 0x00, 0x73, 0xff, 0xcc, 0x00, 
-0xa0, 0xff, 0x24, 0x00, 0x6b, 0x00, 0xa4, 0xff, 0x59, 0x00, 0xee, 0xff, 0x37, 0x00, 0xfb, 0xff, 
-0xe8, 0xff, 0x7b, 0x00, 0x77, 0xff, 0x63, 0x00, 0xf0, 0xff, 0xf7, 0xff, 0x2f, 0x00, 0xd1, 0xff, 
-0x3c, 0x00, 0x14, 0x00, 0xbb, 0xff, 0xb6, 0x00, 0x5e, 0xff, 0x9b, 0x00, 0xd6, 0xff, 0xd2, 0xff, 
-0xbd, 0x00, 0x07, 0xff, 0xe8, 0x00, 0x88, 0xff, 0x3b, 0x00, 0xfe, 0xff, 0xef, 0xff, 0x37, 0x00, 
-0x00, 0x00, 0xf3, 0xff, 0x43, 0x00, 0xdf, 0xff, 0x52, 0x00, 0xff, 0xff, 0xdc, 0xff, 0x68, 0x00, 
-0xb2, 0xff, 0x43, 0x00, 0xe9, 0xff, 0x2a, 0x00, 0xee, 0xff, 0xf1, 0xff, 0x35, 0x00, 0xf7, 0xff, 
-0x28, 0x00, 0xc6, 0xff, 0x5e, 0x00, 0xfe, 0xff, 0xe8, 0xff, 0x66, 0x00, 0xa0, 0xff, 0xae, 0x00, 
-0x83, 0xff, 0x4e, 0x00, 0x0f, 0x00, 0xd7, 0xff, 0x3b, 0x00, 0xf7, 0xff, 0xd8, 0xff, 0x78, 0x00, 
-0xd5, 0xff, 0xeb, 0xff, 0x77, 0x00, 0xa6, 0xff, 0x9b, 0x00, 0x9b, 0xff, 0x7e, 0x00, 0xc7, 0xff, 
-0x70, 0x00, 0xb8, 0xff, 0x47, 0x00, 0x16, 0x00, 0xd0, 0xff, 0x60, 0x00, 0xe3, 0xff, 0x33, 0x00, 
-0xcb, 0xff, 0x70, 0x00, 0xc3, 0xff, 0x2b, 0x00, 0x2f, 0x00, 0xe2, 0xff, 0xff, 0xff, 0x2b, 0x00, 
-0xc4, 0xff, 0x47, 0x00, 0xc5, 0xff, 0x11, 0x00, 0x15, 0x00, 0xe0, 0xff, 0xf1, 0xff, 0x16, 0x00, 
-0xf8, 0xff, 0xd3, 0xff, 0x31, 0x00, 0xd4, 0xff, 0x23, 0x00, 0xdd, 0xff, 0x20, 0x00, 0xf0, 0xff, 
-0xf9, 0xff, 0x12, 0x00, 0xf4, 0xff, 0x10, 0x00, 0xd7, 0xff, 0x05, 0x00, 0x0a, 0x00, 0xe2, 0xff, 
-0xf9, 0xff, 0x24, 0x00, 0xd7, 0xff, 0x13, 0x00, 0xf6, 0xff, 0xe0, 0xff, 0x26, 0x00, 0xeb, 0xff, 
-0x0a, 0x00, 0xe3, 0xff, 0x1a, 0x00, 0xd1, 0xff, 0x22, 0x00, 0xd7, 0xff, 0xfb, 0xff, 0xf2, 0xff, 
-0x07, 0x00, 0xda, 0xff, 0xf0, 0xff, 0x12, 0x00, 0xc6, 0xff, 0x0c, 0x00, 0xd6, 0xff, 0x1d, 0x00, 
-0xcd, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xec, 0xff, 0xee, 0xff, 0xef, 0xff, 0x0a, 0x00, 0xbf, 0xff, 
-0x17, 0x00, 0xf0, 0xff, 0xa3, 0xff, 0x5a, 0x00, 0x96, 0xff, 0x21, 0x00, 0xf1, 0xff, 0xdb, 0xff, 
-0x1b, 0x00, 0xad, 0xff, 0x32, 0x00, 0xd0, 0xff, 0xea, 0xff, 0x14, 0x00, 0xb8, 0xff, 0x0a, 0x00, 
-0xdb, 0xff, 0xeb, 0xff, 0xf7, 0xff, 0xdf, 0xff, 0xe5, 0xff, 0x01, 0x00, 0xe9, 0xff, 0xe3, 0xff, 
-0x06, 0x00, 0xdb, 0xff, 0x09, 0x00, 0xbe, 0xff, 0x08, 0x00, 0xcf, 0xff, 0x12, 0x00, 0xbe, 0xff, 
-0xfa, 0xff, 0xf9, 0xff, 0xb0, 0xff, 0x13, 0x00, 0xc6, 0xff, 0x06, 0x00, 0xba, 0xff, 0x1b, 0x00, 
-0xcd, 0xff, 0xd8, 0xff, 0x07, 0x00, 0xa3, 0xff, 0x28, 0x00, 0xd3, 0xff, 0xd9, 0xff, 0xed, 0xff, 
-0xe7, 0xff, 0xed, 0xff, 0xdd, 0xff, 0x11, 0x00, 0xbc, 0xff, 0x15, 0x00, 0xe8, 0xff, 0xe1, 0xff, 
-0x0b, 0x00, 0xf4, 0xff, 0xdb, 0xff, 0x1d, 0x00, 0xfc, 0xff, 0xd6, 0xff, 0x1e, 0x00, 0xed, 0xff, 
-0x11, 0x00, 0xef, 0xff, 0xfe, 0xff, 0xf2, 0xff, 0x20, 0x00, 0xcb, 0xff, 0x21, 0x00, 0xec, 0xff, 
-0x03, 0x00, 0xf8, 0xff, 0xf3, 0xff, 0x0d, 0x00, 0xe5, 0xff, 0x14, 0x00, 0xc0, 0xff, 0x30, 0x00, 
-0xd2, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0x0d, 0x00, 0xd0, 0xff, 0x30, 0x00, 0xca, 0xff, 0x09, 0x00, 
-0x07, 0x00, 0xd6, 0xff, 0x05, 0x00, 0xf9, 0xff, 0x06, 0x00, 0xb5, 0xff, 0x88, 0x00, 0x5c, 0xff, 
-0x6b, 0x00, 0xea, 0xff, 0xe5, 0xff, 0x2f, 0x00, 0xbb, 0xff, 0x46, 0x00, 0xcb, 0xff, 0x42, 0x00, 
-0x80, 0xff, 0x61, 0x00, 0xeb, 0xff, 0xd7, 0xff, 0x29, 0x00, 0xe5, 0xff, 0x25, 0x00, 0xb8, 0xff, 
-0x47, 0x00, 0xc7, 0xff, 0x47, 0x00, 0xc1, 0xff, 0xfc, 0xff, 0x1e, 0x00, 0xf3, 0xff, 0xd9, 0xff, 
-0xeb, 0xff, 0x63, 0x00, 0x7b, 0xff, 0x9f, 0x00, 0xaa, 0xff, 0xf8, 0xff, 0x28, 0x00, 0xb7, 0xff, 
-0xed, 0xff, 0x02, 0x00, 0x39, 0x00, 0x8d, 0xff, 0x2f, 0x00, 0x29, 0x00, 0x73, 0xff, 0x80, 0x00, 
-0xc2, 0xff, 0xa5, 0xff, 0xdb, 0x00, 0x05, 0xff, 0xd9, 0x00, 0x68, 0xff, 0x58, 0x00, 0x36, 0x00, 
-0xd4, 0xff, 0x0c, 0x00, 0xf8, 0xff, 0x61, 0x00, 0xaf, 0xff, 0x37, 0x00, 0xb1, 0xff, 0x24, 0x00, 
-0xdb, 0xff, 0x32, 0x00, 0xe0, 0xff, 0x2e, 0x00, 0x97, 0xff, 0xb7, 0x00, 0x45, 0xff, 0xfe, 0x00, 
-0x47, 0xff, 0x73, 0x00, 0x18, 0x00, 0x7d, 0xff, 0x26, 0x01, 0xd5, 0xfe, 0xb0, 0x00, 0xbb, 0xff, 
-0xcf, 0xff, 0x42, 0x00, 0x28, 0xff, 0x19, 0x01, 0xd7, 0xfe, 0xac, 0x00, 0x58, 0x00, 0x64, 0xff, 
-0x0b, 0x01, 0xd3, 0xfe, 0x45, 0x01, 0x9b, 0xfe, 0x75, 0x01, 0xeb, 0xfe, 0x5a, 0x00, 0x3c, 0x00, 
-0x68, 0xff, 0xfc, 0x00, 0xe2, 0xfe, 0xb4, 0x00, 0xc8, 0xff, 0xf4, 0xff, 0xe8, 0xff, 0xcc, 0x00, 
-0xc0, 0xfe, 0x35, 0x01, 0xe1, 0xfe, 0xc7, 0x00, 0xf3, 0xff, 0x90, 0xff, 0x5e, 0x00, 0x9c, 0xff, 
-0xcc, 0xff, 0xa3, 0x00, 0xa3, 0xff, 0x5d, 0xff, 0x55, 0x01, 0x70, 0xfe, 0x15, 0x02, 0x52, 0xfe, 
-0xb5, 0x00, 0xa3, 0x00, 0x0d, 0xff, 0xe8, 0x00, 0x05, 0x00, 0x23, 0x00, 0xb3, 0xff, 0xe5, 0x01, 
-0x8a, 0xff, 0x2c, 0x00, 0x97, 0xff, 0x86, 0x00, 0x7f, 0xfe, 0xb7, 0x01, 0x7e, 0xfe, 0xe9, 0xff, 
-0x94, 0x00, 0xb1, 0xfe, 0x9a, 0x01, 0xcc, 0xfd, 0xbf, 0x02, 0x12, 0xfd, 0x40, 0x02, 0x44, 0xff, 
-0x7c, 0xff, 0x81, 0x01, 0xf6, 0xfd, 0x35, 0x02, 0x98, 0xfe, 0x74, 0x00, 0xf4, 0xff, 0xbb, 0xff, 
-0x5b, 0x00, 0xc2, 0xfe, 0x35, 0x01, 0xf5, 0xfe, 0xf0, 0xff, 0xb1, 0xff, 0x96, 0xff, 0xaa, 0x00, 
-0xdc, 0xfe, 0x43, 0x00, 0xa4, 0xff, 0x71, 0x00, 0x23, 0xff, 0x6a, 0x00, 0xb7, 0x00, 0xc0, 0xfe, 
-0xa1, 0x00, 0x93, 0x00, 0xfb, 0xfe, 0x13, 0x00, 0x88, 0x00, 0x72, 0xfe, 0xcf, 0x01, 0x38, 0xff, 
-0xb1, 0xfe, 0xd0, 0x02, 0x1d, 0xfd, 0xcf, 0x01, 0x04, 0xff, 0xf9, 0xff, 0x33, 0x01, 0x0f, 0xfe, 
-0xfe, 0x01, 0x47, 0xff, 0x58, 0x00, 0x13, 0x00, 0xad, 0xff, 0xe8, 0x00, 0xe7, 0xff, 0x1a, 0x00, 
-0xb2, 0xff, 0x3d, 0x01, 0xc2, 0xfe, 0x72, 0x01, 0xb3, 0xfe, 0x31, 0x01, 0xe0, 0xff, 0x62, 0xff, 
-0x5a, 0x00, 0xa4, 0x00, 0x9c, 0xff, 0xce, 0xff, 0xda, 0x00, 0x74, 0xfe, 0x8e, 0x01, 0x5a, 0xfe, 
-0xb6, 0x01, 0x1e, 0xfe, 0x52, 0x02, 0x4d, 0xfe, 0x01, 0x01, 0xe4, 0xff, 0x0f, 0x00, 0x5c, 0x00, 
-0x8e, 0xff, 0xca, 0x00, 0x03, 0xff, 0x9d, 0x00, 0x1e, 0x00, 0xb1, 0xff, 0x22, 0x00, 0x86, 0x00, 
-0xe2, 0xff, 0x76, 0xff, 0x84, 0x00, 0xd5, 0xff, 0xdb, 0xff, 0xb1, 0xff, 0x24, 0x01, 0x90, 0xfe, 
-0x04, 0x01, 0x3e, 0x00, 0x23, 0xff, 0x60, 0x01, 0x57, 0xfe, 0x0e, 0x02, 0x14, 0xff, 0x78, 0xff, 
-0xb2, 0x00, 0x76, 0x00, 0x69, 0xfe, 0x02, 0x01, 0x66, 0xff, 0x2a, 0x00, 0x03, 0xff, 0xda, 0x00, 
-0xe7, 0xfe, 0xf1, 0xff, 0xda, 0x00, 0xc2, 0xfe, 0x0d, 0x00, 0x80, 0xff, 0xc9, 0x01, 0x81, 0xfd, 
-0x5f, 0x01, 0x67, 0xff, 0x55, 0x00, 0x29, 0x00, 0xe6, 0xfe, 0x92, 0xff, 0x44, 0x02, 0x6a, 0xfd, 
-0x8f, 0xff, 0xa8, 0x02, 0x77, 0xfd, 0xc0, 0xff, 0xf0, 0x01, 0x2b, 0xfe, 0x56, 0x01, 0xbf, 0xff, 
-0x7e, 0x00, 0xc1, 0xff, 0x3d, 0x00, 0xff, 0x00, 0x70, 0xfe, 0x42, 0x03, 0x0f, 0xfd, 0x49, 0x02, 
-0xa5, 0x00, 0x6c, 0xfe, 0x51, 0x01, 0xdb, 0x00, 0x26, 0xfe, 0xdc, 0x02, 0x1a, 0xfd, 0x70, 0x02, 
-0x31, 0xfd, 0xf8, 0x01, 0x89, 0xff, 0xb2, 0xfd, 0xbe, 0x03, 0x3a, 0xfd, 0xcb, 0x00, 0xfa, 0x01, 
-0x83, 0xfd, 0xc1, 0x02, 0xc0, 0xff, 0xbb, 0x01, 0x2e, 0x01, 0x7a, 0xfb, 0x3b, 0x04, 0xde, 0xfa, 
-0x78, 0x01, 0x86, 0xff, 0x0d, 0xfe, 0x25, 0x00, 0xc9, 0xfe, 0xcd, 0x01, 0x99, 0xff, 0xaf, 0xff, 
-0x8e, 0x02, 0x80, 0xfe, 0xe5, 0x00, 0x6e, 0x02, 0xb2, 0xfe, 0x90, 0x01, 0xd7, 0xff, 0xa2, 0xff, 
-0x81, 0x00, 0x51, 0x01, 0x2b, 0xfd, 0x9b, 0x00, 0xa1, 0xff, 0xcb, 0xfc, 0xab, 0x00, 0xd7, 0xff, 
-0xe3, 0xfd, 0xc0, 0xff, 0xae, 0x00, 0xb4, 0xfe, 0x2e, 0x00, 0xa5, 0x00, 0xb3, 0xff, 0x82, 0x00, 
-0xb7, 0x00, 0xda, 0xfe, 0x48, 0x02, 0x85, 0xfe, 0x1e, 0x00, 0x2f, 0x00, 0xdd, 0xfe, 0xf1, 0x00, 
-0xb2, 0xfd, 0x28, 0x02, 0xf1, 0xfd, 0x2e, 0x01, 0x14, 0xfe, 0x90, 0xff, 0x92, 0x01, 0x2c, 0xfd, 
-0x26, 0x01, 0xa2, 0x01, 0x19, 0xfe, 0xc8, 0x01, 0x00, 0x00, 0x96, 0x00, 0x37, 0x00, 0x6d, 0xff, 
-0x5f, 0x02, 0x03, 0xfd, 0xca, 0x04, 0xfa, 0xfb, 0x69, 0x01, 0x0c, 0x01, 0xf6, 0xfe, 0x82, 0x00, 
-0x84, 0xff, 0xc0, 0x01, 0x90, 0xfe, 0x06, 0x00, 0x73, 0x03, 0x73, 0xfc, 0xa3, 0x02, 0xe3, 0xff, 
-0xc2, 0xfd, 0x4c, 0x04, 0xe7, 0xfb, 0x46, 0x03, 0x2d, 0xff, 0x2b, 0x00, 0xc5, 0x01, 0xa1, 0xfc, 
-0x17, 0x03, 0x07, 0xff, 0xac, 0xff, 0x55, 0x01, 0x3d, 0xfe, 0x1d, 0x03, 0x01, 0xfd, 0x79, 0x01, 
-0x75, 0x01, 0x54, 0xfd, 0x67, 0x03, 0x7c, 0xfd, 0x0a, 0x00, 0x0c, 0x01, 0x7d, 0xfd, 0xb0, 0x02, 
-0x33, 0xfd, 0xd5, 0x01, 0x7b, 0xff, 0x42, 0xff, 0x09, 0x02, 0x91, 0xfe, 0x3e, 0x00, 0x53, 0x01, 
-0x25, 0xfd, 0x95, 0x01, 0xe6, 0x00, 0x7b, 0xfe, 0xb3, 0x00, 0xf7, 0xff, 0x5a, 0xff, 0xdf, 0xfe, 
-0x06, 0x01, 0x42, 0xff, 0xeb, 0x00, 0x92, 0xff, 0x69, 0x01, 0xbd, 0xfd, 0xf5, 0x02, 0x43, 0xfe, 
-0x6b, 0x00, 0xc5, 0x00, 0x8c, 0xfc, 0x3a, 0x03, 0x57, 0xff, 0xbe, 0xfc, 0x83, 0x03, 0x24, 0xfe, 
-0xa8, 0xfe, 0x30, 0x02, 0x90, 0xfd, 0x4d, 0x01, 0x06, 0x01, 0x93, 0x00, 0xa2, 0xfc, 0x5c, 0x03, 
-0x22, 0xfe, 0x5d, 0xfe, 0x42, 0x03, 0x8c, 0xfb, 0x53, 0x01, 0x8a, 0xff, 0x7a, 0xff, 0x37, 0x01, 
-0xc5, 0xfb, 0xe2, 0x03, 0x03, 0xff, 0xd0, 0xfd, 0x3b, 0x05, 0xc6, 0xfa, 0x77, 0x04, 0x29, 0xff, 
-0xd6, 0xfe, 0xd7, 0x04, 0x0d, 0xfa, 0x75, 0x04, 0x53, 0xff, 0x40, 0xfd, 0xd0, 0x04, 0x54, 0xfb, 
-0x84, 0x02, 0x58, 0x00, 0xd7, 0xfc, 0xcc, 0x04, 0x30, 0xfb, 0xda, 0x01, 0x05, 0x02, 0x21, 0xfd, 
-0xe8, 0x04, 0x36, 0xfd, 0x60, 0x00, 0x70, 0x02, 0x55, 0xfc, 0xb5, 0x01, 0x6d, 0x00, 0x17, 0xfd, 
-0xba, 0x04, 0xdd, 0xfc, 0x7d, 0x00, 0xdd, 0x02, 0x43, 0xfc, 0x92, 0x02, 0x8f, 0x00, 0x9c, 0xfc, 
-0x86, 0x03, 0x94, 0xfd, 0x49, 0x00, 0xc2, 0x01, 0xab, 0xfb, 0x29, 0x04, 0x2b, 0xfe, 0x42, 0xfe, 
-0xdc, 0x00, 0x38, 0x00, 0x19, 0xff, 0xa0, 0x01, 0xf2, 0x00, 0xfe, 0xfd, 0xa2, 0x02, 0xdf, 0x00, 
-0x93, 0xfb, 0x18, 0x05, 0x9a, 0xfd, 0x7b, 0xfc, 0x2f, 0x05, 0xbd, 0xfb, 0xc2, 0x02, 0xff, 0xff, 
-0x49, 0xff, 0x70, 0x01, 0x96, 0xfd, 0xc9, 0x00, 0x0f, 0xff, 0x8c, 0xfe, 0x5d, 0x02, 0x95, 0xff, 
-0xfb, 0xfd, 0xb7, 0x01, 0xc3, 0x01, 0x76, 0xfe, 0x0e, 0xfe, 0xe9, 0x04, 0x48, 0xfe, 0xdb, 0xff, 
-0xb4, 0xff, 0x48, 0x01, 0xb0, 0xff, 0x24, 0xfe, 0x41, 0x03, 0xc1, 0xfe, 0x14, 0xfe, 0x67, 0x02, 
-0x2a, 0xff, 0x67, 0xff, 0x07, 0x02, 0xa2, 0xfd, 0x2c, 0x01, 0xfe, 0xff, 0xdd, 0xfd, 0xb0, 0x00, 
-0xd6, 0x00, 0xea, 0x00, 0x01, 0xff, 0x86, 0xff, 0x04, 0x03, 0xb8, 0xfd, 0x31, 0xff, 0x47, 0x01, 
-0xa7, 0xfd, 0x8f, 0x02, 0x76, 0xfd, 0xcb, 0x00, 0x07, 0x01, 0x36, 0xfc, 0xaf, 0x04, 0xc1, 0xfd, 
-0xf6, 0x00, 0x56, 0x01, 0x60, 0xfc, 0xae, 0x04, 0xb2, 0xfb, 0x93, 0xff, 0x0b, 0x03, 0xce, 0xf8, 
-0xa8, 0x05, 0x4c, 0xfd, 0x20, 0xfe, 0xa4, 0x04, 0x0f, 0xf9, 0xf1, 0x02, 0x11, 0x03, 0x89, 0xfb, 
-0x3f, 0x03, 0x3b, 0xff, 0x3a, 0xff, 0x8a, 0x00, 0x5c, 0xff, 0x88, 0x00, 0xa8, 0xfd, 0x6f, 0x01, 
-0x84, 0xfe, 0x12, 0xfe, 0x3a, 0x01, 0x5f, 0xfd, 0x67, 0x01, 0xc0, 0x03, 0xff, 0xfa, 0x74, 0x04, 
-0xd9, 0x01, 0x06, 0xfd, 0x2e, 0x03, 0x53, 0xff, 0x2b, 0xff, 0xf7, 0xfe, 0x65, 0x00, 0x9d, 0xff, 
-0x58, 0xfd, 0xb7, 0x00, 0x54, 0xfe, 0x5a, 0x00, 0xaa, 0x01, 0xa5, 0xfc, 0xd1, 0x04, 0xf2, 0xfe, 
-0xa7, 0x00, 0xca, 0x03, 0x5d, 0xfb, 0xe1, 0x02, 0x25, 0xff, 0x6c, 0xfe, 0xe8, 0x01, 0x1f, 0xfe, 
-0x3d, 0x00, 0x92, 0x00, 0x49, 0xff, 0xbb, 0xff, 0x43, 0x01, 0x18, 0x01, 0xe8, 0xfd, 0xce, 0x00, 
-0xf0, 0x02, 0xa6, 0xff, 0x39, 0xff, 0xb0, 0x01, 0x25, 0xff, 0x10, 0xfc, 0xd2, 0x02, 0x93, 0xfe, 
-0x50, 0xfd, 0x1e, 0x02, 0xc8, 0xfd, 0x46, 0x01, 0x79, 0xfe, 0x4f, 0x00, 0x97, 0x00, 0x81, 0xfe, 
-0x1e, 0x02, 0xfd, 0xfe, 0x0c, 0x01, 0x0a, 0x01, 0x0e, 0xff, 0xf0, 0xff, 0x98, 0xfd, 0x21, 0xff, 
-0xd5, 0xff, 0xad, 0xfe, 0xf8, 0xff, 0xa3, 0xfd, 0x2c, 0x00, 0xf1, 0xff, 0x8a, 0xff, 0x45, 0x01, 
-0x3f, 0x01, 0xf4, 0x01, 0x96, 0xff, 0x9e, 0x01, 0x0d, 0x01, 0x6d, 0xff, 0x2e, 0xff, 0xcf, 0x01, 
-0xad, 0xff, 0x73, 0xfb, 0x5c, 0x01, 0x0c, 0x00, 0xab, 0xfe, 0x82, 0x00, 0xc6, 0x00, 0xe3, 0xff, 
-0x37, 0x00, 0xa6, 0x01, 0x07, 0x00, 0xa0, 0x00, 0x23, 0x03, 0x9f, 0xfe, 0x83, 0xff, 0xdb, 0x00, 
-0xaf, 0xfd, 0xe6, 0x00, 0xf4, 0xfe, 0x7f, 0xfe, 0xd2, 0x00, 0x8e, 0xff, 0x87, 0xff, 0x0f, 0x00, 
-0xb1, 0x00, 0xe8, 0xfe, 0x0a, 0x01, 0x43, 0x00, 0xae, 0x00, 0x82, 0x00, 0xef, 0xfe, 0x99, 0xff, 
-0x58, 0x00, 0x88, 0xfe, 0xe3, 0xff, 0x40, 0xff, 0xfb, 0xfe, 0xb1, 0xff, 0xd0, 0xfe, 0x0a, 0x01, 
-0xe7, 0xff, 0x34, 0x00, 0x6d, 0x01, 0x80, 0x00, 0x1e, 0x02, 0x37, 0x00, 0xd0, 0x00, 0xa6, 0x01, 
-0xdc, 0xfe, 0xdf, 0xff, 0x55, 0xff, 0x11, 0x00, 0x75, 0xff, 0xfb, 0x00, 0x16, 0x02, 0x7d, 0xff, 
-0xc5, 0x03, 0xf5, 0x03, 0x74, 0xfd, 0x88, 0x04, 0x2a, 0xfe, 0xd0, 0xfa, 0x20, 0x00, 0x2c, 0xfe, 
-0xb8, 0xfc, 0x08, 0xfe, 0x16, 0x00, 0x6a, 0xfc, 0xf9, 0xfe, 0xb7, 0x00, 0xe4, 0xfd, 0xe5, 0xff, 
-0x50, 0x01, 0xa9, 0x00, 0xc4, 0x01, 0x05, 0x02, 0xa7, 0x02, 0xab, 0x00, 0xf6, 0xff, 0x36, 0x00, 
-0x66, 0xfe, 0x9d, 0xff, 0x5d, 0x00, 0x65, 0x01, 0x4b, 0x00, 0x46, 0x02, 0xf2, 0xff, 0x20, 0x00, 
-0xca, 0x01, 0xe7, 0xfd, 0x72, 0x01, 0x46, 0xfe, 0x3b, 0x00, 0xd4, 0x01, 0xab, 0xfe, 0xf0, 0x00, 
-0x90, 0x00, 0x27, 0x01, 0x53, 0xff, 0x19, 0x01, 0xf9, 0x01, 0xc9, 0xfd, 0xaa, 0x01, 0xee, 0x00, 
-0xce, 0xfc, 0x5d, 0x01, 0x7b, 0xff, 0x7e, 0xff, 0x1d, 0x00, 0x21, 0x01, 0xd4, 0x00, 0xbc, 0xff, 
-0x27, 0x02, 0x0f, 0xfe, 0xd9, 0xfe, 0x0a, 0x00, 0xa3, 0xfd, 0xf2, 0xfd, 0x12, 0x02, 0x0e, 0x01, 
-0x2c, 0xff, 0xb8, 0x02, 0xed, 0x00, 0x73, 0xff, 0x09, 0x01, 0xae, 0x01, 0xee, 0xff, 0x15, 0x01, 
-0xda, 0x01, 0x61, 0x00, 0xc6, 0x02, 0xc1, 0xff, 0xd4, 0x00, 0x81, 0x01, 0x5a, 0xfe, 0x20, 0x02, 
-0x1c, 0xff, 0xd6, 0xfe, 0x99, 0x02, 0xf6, 0xfd, 0xaf, 0x01, 0x41, 0x01, 0xf1, 0xfb, 0x40, 0xfd, 
-0x66, 0xfb, 0x39, 0xfa, 0x05, 0xfa, 0x56, 0xfc, 0xb1, 0xfa, 0x4b, 0xfb, 0x5a, 0xfd, 0xeb, 0xf9, 
-0x25, 0xfd, 0x92, 0xfd, 0xaf, 0xfc, 0xf2, 0xfe, 0x4d, 0x02, 0x05, 0x01, 0x0c, 0x04, 0xfc, 0x05, 
-0x23, 0x05, 0x8a, 0x04, 0xa7, 0x08, 0x20, 0x0a, 0x9c, 0x06, 0x0f, 0x0c, 0x58, 0x09, 0xa2, 0x05, 
-0x7b, 0x08, 0x27, 0x04, 0x25, 0x02, 0x0e, 0x04, 0xdb, 0xff, 0x60, 0x00, 0x1e, 0xfe, 0xe5, 0xff, 
-0xb0, 0xfd, 0x61, 0xfc, 0x7b, 0xfd, 0x2e, 0xf9, 0x14, 0xfb, 0xe5, 0xf9, 0xec, 0xf8, 0xe0, 0xfc, 
-0xda, 0xfa, 0x46, 0xf9, 0xf2, 0xf7, 0x13, 0xf5, 0xc8, 0xf4, 0xd7, 0xf2, 0x36, 0xf1, 0x2c, 0xf6, 
-0x19, 0xf7, 0x3f, 0xf9, 0x28, 0x02, 0x1e, 0x00, 0x71, 0x01, 0x02, 0x08, 0x96, 0x08, 0x27, 0x06, 
-0x7a, 0x0d, 0x83, 0x0e, 0x3f, 0x0b, 0x93, 0x0e, 0xb7, 0x0d, 0x66, 0x08, 0x33, 0x0a, 0x9e, 0x0a, 
-0x6c, 0x07, 0xd8, 0x08, 0x70, 0x07, 0x5c, 0x04, 0x57, 0x02, 0x3f, 0x01, 0x95, 0xfc, 0xe3, 0xfb, 
-0xff, 0xfa, 0xbc, 0xfb, 0x4f, 0xf9, 0x34, 0xfa, 0x93, 0xfc, 0xee, 0xf8, 0x51, 0xfc, 0xf3, 0xf9, 
-0x1c, 0xf7, 0x42, 0xf7, 0x4f, 0xf4, 0xa1, 0xf4, 0xfa, 0xed, 0x73, 0xf0, 0xc1, 0xf2, 0xee, 0xec, 
-0x16, 0xfa, 0xef, 0xf9, 0x37, 0xfd, 0x7f, 0x06, 0xb6, 0x05, 0x13, 0x0c, 0x34, 0x0a, 0x84, 0x0c, 
-0xdc, 0x0d, 0xc5, 0x09, 0x6c, 0x0c, 0x05, 0x0b, 0x14, 0x09, 0x5a, 0x09, 0x3d, 0x0c, 0x17, 0x0b, 
-0x49, 0x05, 0x36, 0x09, 0x80, 0x05, 0xf8, 0xff, 0xc6, 0x01, 0x35, 0x00, 0x53, 0xfd, 0xd0, 0xfc, 
-0xbd, 0x00, 0xf7, 0xfd, 0x9a, 0xfd, 0x4e, 0x01, 0x9c, 0xfe, 0xdc, 0xff, 0x1a, 0xfe, 0xe7, 0xfb, 
-0x86, 0xfc, 0x15, 0xf6, 0xbe, 0xf3, 0x13, 0xf0, 0x9c, 0xeb, 0x9d, 0xea, 0xe9, 0xe7, 0x38, 0xed, 
-0xce, 0xf3, 0xe1, 0xfc, 0x68, 0x01, 0x2d, 0x07, 0x8d, 0x0b, 0xc0, 0x05, 0x18, 0x0d, 0xa2, 0x0d, 
-0x4a, 0x08, 0x32, 0x0d, 0x4d, 0x0b, 0xf0, 0x0a, 0x3a, 0x0b, 0x59, 0x09, 0x01, 0x09, 0xd1, 0x05, 
-0x5e, 0x07, 0xf5, 0x02, 0x06, 0x01, 0xac, 0x02, 0xeb, 0xfd, 0x99, 0xff, 0xdc, 0xff, 0xd6, 0x00, 
-0xaa, 0x03, 0xb4, 0x03, 0xa0, 0x04, 0x5d, 0x04, 0xb2, 0x04, 0xcb, 0xfd, 0x12, 0x00, 0xb6, 0xfd, 
-0xe7, 0xf6, 0x18, 0xfb, 0xca, 0xf3, 0xf3, 0xf0, 0x74, 0xed, 0xb2, 0xe5, 0x3e, 0xe7, 0x38, 0xe5, 
-0xda, 0xec, 0x23, 0xf8, 0x57, 0xfc, 0xda, 0x03, 0x8a, 0x0a, 0x46, 0x0c, 0x4f, 0x09, 0xf6, 0x0e, 
-0x24, 0x0d, 0x22, 0x0d, 0xaa, 0x0c, 0x1b, 0x0b, 0x94, 0x0a, 0xcb, 0x05, 0x02, 0x05, 0xcb, 0x04, 
-0x1d, 0x04, 0x86, 0x00, 0xaf, 0x00, 0x4a, 0xff, 0x93, 0xfe, 0x65, 0xfd, 0xc8, 0xfe, 0x5c, 0x01, 
-0x50, 0x03, 0x7f, 0x07, 0xaa, 0x0a, 0x2f, 0x09, 0xe1, 0x09, 0x4d, 0x07, 0x98, 0x02, 0x4f, 0x01, 
-0x61, 0xfc, 0x7b, 0xfd, 0x35, 0xf9, 0xd1, 0xf4, 0x35, 0xf1, 0x56, 0xe9, 0xad, 0xe6, 0xb3, 0xe0, 
-0x49, 0xdf, 0x65, 0xed, 0x9d, 0xf6, 0x8b, 0xfd, 0x70, 0x07, 0x9f, 0x0a, 0x8e, 0x0b, 0x5a, 0x0c, 
-0x03, 0x0d, 0x83, 0x0e, 0x9d, 0x0c, 0x3c, 0x0d, 0x5f, 0x0c, 0x07, 0x05, 0xa9, 0x05, 0x91, 0x04, 
-0xb7, 0x03, 0x6a, 0x03, 0x0e, 0x03, 0xa9, 0x02, 0xbb, 0xfd, 0x58, 0xfd, 0xe2, 0xfb, 0x0d, 0xfd, 
-0xc4, 0xff, 0xb8, 0x03, 0x02, 0x0a, 0xdf, 0x0a, 0xf9, 0x0a, 0x24, 0x0a, 0x64, 0x06, 0x3a, 0x04, 
-0x21, 0x03, 0x40, 0x00, 0x0e, 0xfc, 0x4d, 0xfc, 0x3a, 0xf6, 0xfb, 0xee, 0xfa, 0xeb, 0xea, 0xe4, 
-0x1e, 0xe4, 0xf0, 0xde, 0x20, 0xe6, 0xf2, 0xf5, 0x24, 0xfb, 0x2e, 0x04, 0x99, 0x0a, 0x97, 0x0b, 
-0x6a, 0x0a, 0x0c, 0x0c, 0x9c, 0x0c, 0x3a, 0x0d, 0xfc, 0x0e, 0xe4, 0x0b, 0x82, 0x07, 0xc1, 0x06, 
-0x57, 0x03, 0x1c, 0x02, 0x76, 0x05, 0x11, 0x01, 0xb7, 0x01, 0xfc, 0xff, 0x58, 0xfc, 0x8b, 0xf9, 
-0x44, 0xfb, 0x4f, 0x00, 0x23, 0x02, 0x5c, 0x08, 0xf1, 0x0b, 0x7b, 0x0c, 0xee, 0x0a, 0xf5, 0x08, 
-0x62, 0x07, 0x6d, 0x06, 0x7e, 0x05, 0x1a, 0x04, 0x4a, 0xfe, 0xec, 0xf7, 0x00, 0xf7, 0x2c, 0xec, 
-0x4a, 0xe9, 0x06, 0xe7, 0x80, 0xe0, 0x2c, 0xe3, 0x14, 0xe3, 0x0f, 0xef, 0xbd, 0xfa, 0x15, 0x01, 
-0xb1, 0x08, 0x09, 0x0a, 0x5a, 0x0b, 0xf8, 0x0d, 0x16, 0x0e, 0xa3, 0x10, 0x18, 0x0f, 0xc7, 0x0b, 
-0xb2, 0x09, 0x31, 0x06, 0x47, 0x05, 0x98, 0x01, 0x43, 0x04, 0x1d, 0x05, 0x74, 0x01, 0xa1, 0x00, 
-0x1b, 0xfc, 0x81, 0xfb, 0x7e, 0xfb, 0x9a, 0xfd, 0x4c, 0x03, 0x61, 0x06, 0x37, 0x08, 0xa8, 0x0a, 
-0x54, 0x0b, 0x63, 0x08, 0xbd, 0x08, 0xee, 0x08, 0xdf, 0x06, 0x53, 0x03, 0x4b, 0xff, 0x39, 0xfa, 
-0x6a, 0xf3, 0x29, 0xf1, 0x82, 0xeb, 0x52, 0xe8, 0xea, 0xe5, 0xff, 0xe1, 0x76, 0xe3, 0x2c, 0xea, 
-0x8d, 0xf7, 0x35, 0x02, 0x01, 0x06, 0xfa, 0x09, 0x81, 0x0b, 0x08, 0x0c, 0xd0, 0x0c, 0xc4, 0x0b, 
-0xfc, 0x0d, 0x7c, 0x0c, 0xea, 0x0a, 0x8e, 0x07, 0x21, 0x06, 0x7c, 0x03, 0x08, 0x03, 0xd6, 0x03, 
-0xb3, 0x02, 0xb1, 0x00, 0x8e, 0xfa, 0x9c, 0xfa, 0x99, 0xfb, 0xe2, 0xfb, 0xf4, 0xff, 0x3c, 0x05, 
-0x9c, 0x08, 0x41, 0x08, 0x69, 0x0b, 0xeb, 0x0b, 0xf1, 0x08, 0x63, 0x08, 0x42, 0x08, 0x68, 0x08, 
-0xd8, 0xff, 0xaa, 0xfb, 0xdb, 0xf4, 0x12, 0xf2, 0xa3, 0xf3, 0x6e, 0xeb, 0x2c, 0xeb, 0xe9, 0xe4, 
-0xfe, 0xe1, 0x99, 0xe5, 0xf5, 0xec, 0xe7, 0xfd, 0xfa, 0x00, 0xbf, 0x07, 0x22, 0x0d, 0xfd, 0x09, 
-0x0f, 0x0d, 0x52, 0x0b, 0x08, 0x0f, 0xc3, 0x0e, 0x10, 0x0a, 0x88, 0x08, 0x12, 0x06, 0x3e, 0x05, 
-0x84, 0x02, 0xd9, 0x02, 0xd2, 0x04, 0x8f, 0x02, 0x15, 0xfc, 0xdf, 0xf7, 0x33, 0xf9, 0xd2, 0xfb, 
-0x94, 0xfd, 0x09, 0x00, 0x71, 0x06, 0x19, 0x0a, 0x74, 0x0a, 0xcc, 0x0b, 0xd7, 0x0b, 0xc5, 0x0b, 
-0x0d, 0x07, 0xbf, 0x06, 0x77, 0x07, 0xf3, 0xfe, 0x02, 0xfe, 0x9b, 0xf5, 0x10, 0xee, 0x22, 0xf1, 
-0x27, 0xeb, 0x7a, 0xeb, 0xbf, 0xe4, 0xb8, 0xe1, 0xe9, 0xe4, 0x7b, 0xec, 0x60, 0x02, 0x5d, 0x06, 
-0x01, 0x09, 0x87, 0x0c, 0x92, 0x0a, 0x47, 0x0d, 0xa6, 0x0a, 0x45, 0x0c, 0x0f, 0x0e, 0x1a, 0x0b, 
-0xb7, 0x06, 0x6d, 0x04, 0xfe, 0x02, 0x2a, 0x03, 0xc1, 0x01, 0x7f, 0x02, 0xe2, 0x03, 0x51, 0xfb, 
-0x6b, 0xf8, 0x66, 0xf8, 0x45, 0xfb, 0xf5, 0x00, 0x78, 0x03, 0x3e, 0x08, 0x5d, 0x0c, 0xe2, 0x0b, 
-0x5f, 0x09, 0xe8, 0x09, 0xd8, 0x08, 0xa7, 0x06, 0x7f, 0x07, 0x21, 0x05, 0xa4, 0x01, 0x43, 0xfc, 
-0xde, 0xf8, 0x12, 0xf2, 0x31, 0xf1, 0xdf, 0xf0, 0x09, 0xeb, 0xaa, 0xe8, 0xdd, 0xe4, 0xf4, 0xe3, 
-0xbc, 0xe7, 0x86, 0xf8, 0xf8, 0x07, 0x79, 0x0b, 0x3e, 0x0b, 0x35, 0x0b, 0x1b, 0x0b, 0x93, 0x0a, 
-0xec, 0x08, 0xf3, 0x09, 0x46, 0x0c, 0x67, 0x0a, 0x91, 0x03, 0x18, 0x00, 0x30, 0x02, 0x03, 0x03, 
-0xfc, 0x02, 0xbd, 0x02, 0xd0, 0xfe, 0x3d, 0xfb, 0x19, 0xfa, 0x7d, 0xf9, 0x7d, 0xfd, 0xeb, 0x02, 
-0x58, 0x08, 0x0e, 0x0c, 0xb7, 0x0b, 0x83, 0x0a, 0x36, 0x08, 0xae, 0x06, 0x3d, 0x08, 0xd7, 0x08, 
-0x89, 0x06, 0x2e, 0x03, 0x91, 0xff, 0x31, 0xfc, 0x32, 0xf6, 0x8c, 0xf1, 0xbc, 0xf4, 0x16, 0xf4, 
-0xf4, 0xec, 0x08, 0xe8, 0x7e, 0xe6, 0x30, 0xe7, 0x7e, 0xea, 0x84, 0xf6, 0xae, 0x05, 0x07, 0x0b, 
-0x5a, 0x0a, 0xdd, 0x06, 0xff, 0x06, 0x2a, 0x0a, 0x17, 0x07, 0x23, 0x09, 0xe5, 0x09, 0xcb, 0x06, 
-0x4c, 0x03, 0xf3, 0x00, 0xc1, 0x03, 0x9b, 0x04, 0x39, 0x04, 0x5e, 0x02, 0xd4, 0xff, 0x99, 0xfb, 
-0x5b, 0xfa, 0x56, 0xfc, 0x74, 0xfe, 0xf4, 0x04, 0x9a, 0x08, 0x8d, 0x0a, 0xa8, 0x0b, 0x80, 0x09, 
-0xaf, 0x07, 0xb3, 0x07, 0xb3, 0x09, 0xaf, 0x0a, 0xb4, 0x05, 0xf6, 0x01, 0x6c, 0x01, 0x86, 0xfc, 
-0x79, 0xf7, 0xd2, 0xf4, 0xb5, 0xf3, 0x72, 0xf4, 0xb3, 0xef, 0x0b, 0xec, 0x44, 0xe5, 0x1a, 0xe5, 
-0x77, 0xe7, 0xd9, 0xee, 0xbf, 0xfe, 0x6b, 0x07, 0x41, 0x0b, 0x1d, 0x05, 0xd7, 0x06, 0xf7, 0x09, 
-0xb5, 0x0a, 0x0f, 0x08, 0xd3, 0x07, 0x63, 0x0a, 0x03, 0x06, 0xa2, 0x02, 0x47, 0xff, 0x13, 0x03, 
-0x33, 0x06, 0x5d, 0x04, 0x3e, 0x03, 0x74, 0xff, 0xfe, 0xfc, 0xd0, 0xfa, 0x52, 0xfd, 0x14, 0x04, 
-0x05, 0x07, 0x78, 0x0a, 0x96, 0x0b, 0x27, 0x0a, 0xf8, 0x08, 0x38, 0x06, 0x92, 0x08, 0x1e, 0x0a, 
-0xc7, 0x09, 0xb8, 0x06, 0xe4, 0x01, 0x1f, 0x00, 0x1b, 0xfb, 0x77, 0xf8, 0xbf, 0xf5, 0x54, 0xf3, 
-0x50, 0xf5, 0xef, 0xee, 0x3b, 0xeb, 0xf1, 0xe4, 0xc0, 0xe5, 0xf1, 0xe7, 0x18, 0xed, 0x13, 0x00, 
-0x01, 0x06, 0xb5, 0x07, 0xc9, 0x02, 0xa6, 0x04, 0x08, 0x09, 0x1e, 0x09, 0x4e, 0x09, 0x76, 0x07, 
-0x9e, 0x09, 0x6a, 0x05, 0x92, 0x00, 0x39, 0x01, 0xf6, 0x03, 0x5c, 0x08, 0xeb, 0x07, 0xcf, 0x03, 
-0xcd, 0x00, 0x60, 0xfb, 0x22, 0xfa, 0x21, 0xfe, 0xe2, 0x04, 0xa2, 0x0b, 0xe4, 0x0b, 0x96, 0x09, 
-0x03, 0x08, 0x77, 0x08, 0x04, 0x08, 0xad, 0x09, 0xe4, 0x0a, 0x39, 0x0a, 0xcd, 0x06, 0x25, 0x00, 
-0xe5, 0xfd, 0xc3, 0xfb, 0x34, 0xfa, 0x0a, 0xf6, 0x4f, 0xf1, 0xa4, 0xf1, 0xce, 0xee, 0x11, 0xea, 
-0x3f, 0xe4, 0xed, 0xe6, 0x79, 0xea, 0xb2, 0xee, 0x6a, 0xfa, 0xd4, 0x02, 0x7a, 0x08, 0x1a, 0x05, 
-0x96, 0x03, 0x0c, 0x07, 0x65, 0x0c, 0xc3, 0x0a, 0xde, 0x07, 0x3f, 0x08, 0x68, 0x05, 0x47, 0x02, 
-0xb2, 0xfe, 0xb3, 0x04, 0x5c, 0x08, 0x0b, 0x08, 0xd7, 0x04, 0x86, 0xff, 0x67, 0xfe, 0xc0, 0xfb, 
-0x12, 0xff, 0x51, 0x03, 0x89, 0x08, 0x94, 0x0a, 0x2b, 0x09, 0x44, 0x0a, 0xb2, 0x08, 0x29, 0x0a, 
-0x20, 0x0a, 0x47, 0x0b, 0xc4, 0x0b, 0xaa, 0x05, 0x5b, 0x02, 0xb6, 0xfe, 0x6a, 0xfd, 0x4e, 0xfa, 
-0x35, 0xf4, 0xd3, 0xf2, 0xcb, 0xf3, 0x79, 0xef, 0x98, 0xe9, 0x79, 0xe6, 0x0c, 0xe6, 0x88, 0xe8, 
-0x82, 0xe9, 0x98, 0xf5, 0x86, 0x02, 0x6b, 0x06, 0x8f, 0x06, 0x19, 0x04, 0x62, 0x08, 0xce, 0x0b, 
-0x05, 0x0a, 0xca, 0x09, 0x81, 0x09, 0xd9, 0x06, 0x9a, 0x01, 0xb0, 0xff, 0x52, 0x03, 0x49, 0x06, 
-0x9e, 0x06, 0x45, 0x05, 0x4d, 0x03, 0x28, 0x00, 0x87, 0xfc, 0x40, 0xfd, 0xed, 0x01, 0xad, 0x06, 
-0xde, 0x09, 0xa6, 0x09, 0x0d, 0x09, 0x43, 0x09, 0xc9, 0x08, 0xc8, 0x09, 0x4a, 0x09, 0xee, 0x0a, 
-0x5b, 0x09, 0x79, 0x02, 0xfd, 0xfd, 0x44, 0xfc, 0x8a, 0xfb, 0xf7, 0xf7, 0x61, 0xf2, 0x2c, 0xf3, 
-0xa9, 0xf3, 0x1a, 0xed, 0x8f, 0xe8, 0xb9, 0xe4, 0x02, 0xe9, 0x7f, 0xeb, 0xac, 0xed, 0x21, 0xf9, 
-0xf5, 0x00, 0x21, 0x08, 0x89, 0x03, 0x5c, 0x03, 0xeb, 0x09, 0x0a, 0x0c, 0x1d, 0x0c, 0x47, 0x05, 
-0xfe, 0x06, 0x0c, 0x06, 0xad, 0x03, 0x9b, 0x02, 0x0b, 0x03, 0xda, 0x09, 0x84, 0x08, 0xc9, 0x04, 
-0x23, 0xff, 0x50, 0xfe, 0xda, 0xff, 0xd2, 0x00, 0xbb, 0x05, 0x35, 0x08, 0x25, 0x09, 0x91, 0x07, 
-0xbb, 0x08, 0x6f, 0x09, 0x15, 0x0a, 0x8a, 0x0a, 0x9f, 0x0a, 0xd6, 0x09, 0xb2, 0x04, 0x7d, 0x00, 
-0xe3, 0xfc, 0x98, 0xfb, 0x71, 0xf9, 0xd7, 0xf6, 0x51, 0xf4, 0xef, 0xf3, 0x53, 0xf1, 0xf5, 0xeb, 
-0x3c, 0xe9, 0x0f, 0xe9, 0x58, 0xeb, 0x3a, 0xe9, 0x81, 0xec, 0xc4, 0xf8, 0x37, 0x07, 0x47, 0x08, 
-0xc4, 0x01, 0x94, 0x03, 0xba, 0x09, 0x70, 0x0f, 0x4b, 0x09, 0x82, 0x05, 0xc0, 0x07, 0x27, 0x08, 
-0x94, 0x05, 0x2e, 0x01, 0x2c, 0x05, 0xf7, 0x08, 0xee, 0x07, 0xea, 0x03, 0x86, 0xff, 0x9a, 0xfe, 
-0xe0, 0xfe, 0x10, 0x01, 0x72, 0x03, 0x19, 0x07, 0xf8, 0x09, 0xeb, 0x07, 0xcb, 0x07, 0x6c, 0x08, 
-0x15, 0x0a, 0x66, 0x0a, 0xc9, 0x09, 0xf5, 0x09, 0x38, 0x06, 0x0b, 0x01, 0x28, 0xfd, 0xb2, 0xfd, 
-0x6a, 0xfc, 0x0d, 0xf9, 0xf3, 0xf2, 0xf4, 0xf1, 0x87, 0xf2, 0x82, 0xed, 0x5e, 0xea, 0x04, 0xe5, 
-0x3d, 0xe6, 0x22, 0xe9, 0xad, 0xed, 0x6e, 0xf7, 0x82, 0x01, 0xcd, 0x06, 0x63, 0x05, 0x8a, 0x04, 
-0xe9, 0x06, 0x50, 0x0c, 0x93, 0x0a, 0xae, 0x07, 0xa4, 0x07, 0x2d, 0x08, 0x61, 0x07, 0x5b, 0x03, 
-0x3a, 0x05, 0xfb, 0x08, 0x3d, 0x08, 0xe0, 0x03, 0x97, 0xff, 0x2b, 0xff, 0xb5, 0xff, 0x27, 0xff, 
-0x9a, 0x01, 0xd0, 0x05, 0xc5, 0x08, 0x4f, 0x09, 0x72, 0x08, 0xdd, 0x08, 0x6b, 0x0a, 0xc0, 0x0b, 
-0x30, 0x0a, 0x59, 0x08, 0x73, 0x06, 0xc5, 0x02, 0x8b, 0xff, 0x1d, 0xfc, 0x23, 0xfa, 0xff, 0xf6, 
-0x82, 0xf2, 0x6e, 0xf2, 0x29, 0xf1, 0xcb, 0xed, 0xe4, 0xe8, 0x74, 0xe5, 0x84, 0xe8, 0xe9, 0xeb, 
-0x74, 0xef, 0xc2, 0xf7, 0x98, 0x02, 0xe5, 0x07, 0xec, 0x04, 0x7a, 0x02, 0xe3, 0x06, 0xe1, 0x0c, 
-0x04, 0x0d, 0xfc, 0x08, 0xd4, 0x05, 0xe6, 0x05, 0x9d, 0x06, 0x38, 0x05, 0x0d, 0x06, 0xd1, 0x07, 
-0x2e, 0x09, 0xe2, 0x05, 0x75, 0xff, 0x45, 0xfe, 0x5f, 0xfd, 0xe5, 0xff, 0xc1, 0x01, 0xae, 0x04, 
-0xd9, 0x09, 0x58, 0x09, 0xcc, 0x09, 0x40, 0x08, 0xaf, 0x09, 0xa6, 0x0b, 0x91, 0x0a, 0x9c, 0x09, 
-0xa3, 0x04, 0xa1, 0x00, 0x22, 0xff, 0x8a, 0xfc, 0xcd, 0xf9, 0x98, 0xf6, 0x99, 0xf1, 0xc1, 0xf2, 
-0xe8, 0xf1, 0xeb, 0xed, 0x79, 0xea, 0x3a, 0xe5, 0xed, 0xe5, 0x7a, 0xe6, 0xe6, 0xec, 0xec, 0xf7, 
-0x02, 0x02, 0x3f, 0x08, 0xbf, 0x06, 0x97, 0x06, 0xd6, 0x08, 0x9c, 0x0c, 0xa2, 0x0b, 0xfc, 0x08, 
-0xcc, 0x07, 0x61, 0x08, 0xbf, 0x08, 0x0d, 0x05, 0x6a, 0x04, 0x01, 0x06, 0xbb, 0x08, 0x0d, 0x06, 
-0x55, 0x00, 0x31, 0xfd, 0x9a, 0xfc, 0x4b, 0xff, 0x4c, 0xff, 0x51, 0x01, 0x18, 0x06, 0xaf, 0x0a, 
-0xde, 0x0b, 0x42, 0x0a, 0xc4, 0x0a, 0x1e, 0x0b, 0x69, 0x0b, 0x53, 0x09, 0x0d, 0x07, 0x61, 0x05, 
-0x21, 0x02, 0x63, 0xff, 0x9c, 0xfa, 0x66, 0xf7, 0x06, 0xf4, 0x1e, 0xf2, 0xcc, 0xf2, 0x06, 0xef, 
-0x71, 0xed, 0x07, 0xea, 0xec, 0xe7, 0xaf, 0xe8, 0xb3, 0xe8, 0x26, 0xf0, 0xd6, 0xf8, 0xbd, 0x00, 
-0x5e, 0x04, 0xa0, 0x04, 0xf9, 0x06, 0xf8, 0x09, 0xff, 0x0a, 0x91, 0x09, 0xb2, 0x08, 0x9e, 0x07, 
-0x7e, 0x08, 0xa9, 0x08, 0xbb, 0x08, 0xe4, 0x07, 0xc0, 0x05, 0xdb, 0x05, 0x6d, 0x04, 0x62, 0x03, 
-0xf1, 0x00, 0x99, 0xfe, 0x22, 0xff, 0x04, 0x00, 0x46, 0x02, 0x92, 0x03, 0x46, 0x06, 0x31, 0x08, 
-0x04, 0x09, 0x31, 0x0a, 0x1b, 0x09, 0xe3, 0x09, 0x24, 0x09, 0x3b, 0x07, 0x05, 0x05, 0xee, 0x01, 
-0x78, 0x00, 0xf7, 0xfe, 0xd7, 0xfb, 0x22, 0xf8, 0x04, 0xf7, 0xf4, 0xf5, 0x21, 0xf5, 0x93, 0xf2, 
-0xa9, 0xef, 0xd8, 0xee, 0x3b, 0xed, 0xd4, 0xeb, 0xa0, 0xea, 0xe8, 0xeb, 0x7a, 0xf0, 0x27, 0xf5, 
-0x56, 0xf8, 0xe0, 0xfa, 0xaa, 0xfe, 0xb1, 0x03, 0xad, 0x07, 0x1a, 0x0a, 0xd4, 0x0b, 0x68, 0x0d, 
-0xfb, 0x0e, 0x15, 0x0f, 0xfa, 0x0e, 0x36, 0x0e, 0xdf, 0x0c, 0x92, 0x0c, 0x6e, 0x0a, 0x7a, 0x07, 
-0x52, 0x04, 0x01, 0x02, 0x23, 0x01, 0xb6, 0x00, 0xc4, 0x00, 0x8d, 0xff, 0x5a, 0x00, 0xea, 0x01, 
-0xf2, 0x02, 0xf0, 0x04, 0x97, 0x05, 0xa4, 0x05, 0x66, 0x05, 0x03, 0x05, 0xf2, 0x04, 0x9d, 0x04, 
-0x89, 0x02, 0x14, 0x00, 0x62, 0xfd, 0xb5, 0xfa, 0x1d, 0xf8, 0x57, 0xf4, 0xa1, 0xf1, 0x41, 0xee, 
-0x41, 0xeb, 0xeb, 0xe9, 0xfe, 0xe7, 0x19, 0xe7, 0xa2, 0xe9, 0x52, 0xef, 0xa7, 0xf4, 0x12, 0xf9, 
-0x02, 0xfc, 0xd2, 0xff, 0x37, 0x06, 0x67, 0x0b, 0x29, 0x0e, 0xed, 0x0e, 0x25, 0x10, 0xe5, 0x11, 
-0xcd, 0x13, 0x32, 0x13, 0xd9, 0x0f, 0x90, 0x0c, 0x10, 0x0a, 0x8e, 0x07, 0x7c, 0x04, 0x2d, 0x01, 
-0x11, 0xfe, 0xb9, 0xfd, 0x78, 0xfd, 0xc2, 0xfd, 0x51, 0xfe, 0x69, 0xff, 0x22, 0x01, 0x2b, 0x03, 
-0xa2, 0x05, 0x60, 0x06, 0xed, 0x08, 0x75, 0x09, 0x16, 0x09, 0x20, 0x08, 0x13, 0x05, 0x48, 0x03, 
-0x97, 0xff, 0x19, 0xfb, 0xec, 0xf6, 0x52, 0xf4, 0x79, 0xf1, 0xd6, 0xed, 0x35, 0xeb, 0x50, 0xe9, 
-0x86, 0xe7, 0x76, 0xe4, 0x1c, 0xe4, 0x85, 0xe8, 0x3e, 0xf1, 0x35, 0xf9, 0x02, 0xfe, 0xb2, 0x01, 
-0x6e, 0x05, 0xe0, 0x0b, 0xb3, 0x0f, 0xd1, 0x10, 0xc3, 0x10, 0xef, 0x10, 0xb6, 0x12, 0x95, 0x11, 
-0x78, 0x0f, 0xc6, 0x0b, 0x65, 0x08, 0x46, 0x06, 0x15, 0x03, 0x66, 0x00, 0xfb, 0xfd, 0xcb, 0xfc, 
-0xd1, 0xfc, 0x88, 0xfd, 0xa4, 0xff, 0x6f, 0x02, 0xa1, 0x04, 0xbb, 0x06, 0x2b, 0x08, 0x46, 0x0a, 
-0x06, 0x0c, 0xd1, 0x0b, 0xc5, 0x0a, 0x15, 0x08, 0x7f, 0x05, 0xe2, 0x02, 0xe0, 0xff, 0x97, 0xfc, 
-0x90, 0xf8, 0x4c, 0xf3, 0xd9, 0xef, 0xac, 0xef, 0x7d, 0xee, 0xc0, 0xed, 0x0e, 0xeb, 0x3c, 0xe8, 
-0x41, 0xe9, 0x32, 0xe9, 0xa5, 0xea, 0xac, 0xf0, 0x8c, 0xf9, 0xd4, 0x00, 0x9a, 0x04, 0x4f, 0x07, 
-0x82, 0x0a, 0x3f, 0x0e, 0xd6, 0x0f, 0x62, 0x0e, 0x2d, 0x0d, 0x2b, 0x0d, 0xd8, 0x0c, 0xae, 0x0b, 
-0x0f, 0x09, 0xc2, 0x06, 0x30, 0x05, 0xcd, 0x03, 0xb3, 0x01, 0x19, 0x00, 0xb8, 0xfe, 0x29, 0xfd, 
-0x05, 0xfe, 0xdc, 0xfe, 0xc8, 0x00, 0x5f, 0x04, 0x4f, 0x06, 0xdc, 0x08, 0x23, 0x0a, 0xad, 0x09, 
-0xf1, 0x09, 0xdc, 0x09, 0x93, 0x08, 0x04, 0x06, 0x03, 0x02, 0x9e, 0xfe, 0xcd, 0xfd, 0xdf, 0xfa, 
-0xea, 0xf6, 0xb2, 0xf2, 0x35, 0xef, 0xec, 0xef, 0xf1, 0xee, 0xcc, 0xed, 0xee, 0xec, 0x98, 0xec, 
-0x9e, 0xea, 0xc1, 0xe8, 0x8b, 0xeb, 0x3e, 0xf1, 0x7b, 0xfe, 0x3a, 0x06, 0xfc, 0x08, 0x3b, 0x09, 
-0x2f, 0x08, 0x16, 0x0e, 0xb9, 0x0f, 0x93, 0x0e, 0xb6, 0x0d, 0xc3, 0x0a, 0x80, 0x0b, 0xc9, 0x0b, 
-0xc2, 0x07, 0x7b, 0x05, 0x71, 0x04, 0x6b, 0x03, 0xe4, 0x04, 0xc3, 0x02, 0xd7, 0xfe, 0x1d, 0xfd, 
-0xc6, 0xfc, 0x07, 0x00, 0x97, 0x03, 0xa6, 0x05, 0xf9, 0x07, 0xa1, 0x09, 0x2c, 0x0b, 0xcc, 0x0a, 
-0x3b, 0x08, 0xd7, 0x06, 0xb9, 0x05, 0x87, 0x05, 0xec, 0x03, 0x22, 0xff, 0x75, 0xfa, 0xe9, 0xf7, 
-0xaa, 0xf6, 0x88, 0xf5, 0xeb, 0xf1, 0xe1, 0xee, 0xd2, 0xef, 0xa1, 0xef, 0xdb, 0xef, 0x14, 0xef, 
-0x65, 0xed, 0x23, 0xed, 0xc5, 0xeb, 0x0d, 0xf0, 0x9d, 0xf9, 0x89, 0x03, 0x4e, 0x0a, 0xf1, 0x08, 
-0x10, 0x06, 0xec, 0x07, 0x12, 0x0b, 0x71, 0x0e, 0x66, 0x0d, 0x3f, 0x0a, 0x5b, 0x09, 0xa1, 0x08, 
-0x20, 0x08, 0x44, 0x07, 0x78, 0x06, 0xbb, 0x06, 0xa0, 0x06, 0x4c, 0x04, 0x18, 0x01, 0x99, 0xfd, 
-0x1d, 0xfc, 0x68, 0xfd, 0xc8, 0x01, 0x80, 0x04, 0x32, 0x08, 0xfb, 0x09, 0x92, 0x09, 0xae, 0x0a, 
-0x16, 0x07, 0x3d, 0x05, 0x7a, 0x04, 0x85, 0x04, 0x6c, 0x04, 0xa0, 0x01, 0x32, 0xfd, 0x5c, 0xf9, 
-0x61, 0xf7, 0xe9, 0xf6, 0xc6, 0xf5, 0x82, 0xf2, 0xcd, 0xf0, 0xa8, 0xef, 0xad, 0xee, 0xce, 0xee, 
-0x77, 0xed, 0x5e, 0xee, 0x1e, 0xee, 0xa8, 0xee, 0xe1, 0xf2, 0x73, 0xfc, 0x77, 0x07, 0x46, 0x0a, 
-0xe5, 0x09, 0x95, 0x05, 0xc1, 0x06, 0x0b, 0x0c, 0x4c, 0x0e, 0x3e, 0x0e, 0xaa, 0x0a, 0xb2, 0x07, 
-0xf4, 0x06, 0xc6, 0x07, 0x47, 0x09, 0x18, 0x09, 0x73, 0x07, 0x14, 0x05, 0xef, 0x01, 0x26, 0xff, 
-0x1b, 0xfd, 0x75, 0xfb, 0x93, 0xfd, 0x95, 0x01, 0xdf, 0x05, 0xa4, 0x08, 0x3d, 0x0a, 0x0d, 0x09, 
-0xa4, 0x07, 0x5b, 0x05, 0xda, 0x03, 0x26, 0x04, 0x58, 0x04, 0x9b, 0x03, 0x13, 0xff, 0xe6, 0xfa, 
-0x6a, 0xf6, 0x03, 0xf6, 0x6b, 0xf6, 0xa9, 0xf6, 0x54, 0xf4, 0x5b, 0xf1, 0xa0, 0xf0, 0x43, 0xf0, 
-0x67, 0xf1, 0xaf, 0xf1, 0x84, 0xf1, 0x3b, 0xf1, 0x8a, 0xee, 0xd0, 0xf0, 0xfe, 0xf8, 0x5a, 0x05, 
-0x4d, 0x0d, 0xdc, 0x0a, 0xd5, 0x05, 0x97, 0x03, 0xd7, 0x07, 0x5f, 0x0d, 0xfd, 0x0e, 0x82, 0x0c, 
-0x59, 0x08, 0x84, 0x06, 0x94, 0x07, 0x42, 0x09, 0xe5, 0x09, 0xdf, 0x08, 0xb3, 0x06, 0xeb, 0x03, 
-0x70, 0x01, 0x89, 0xfd, 0x5a, 0xfb, 0x96, 0xfc, 0xbf, 0xff, 0x65, 0x04, 0x60, 0x06, 0x3d, 0x06, 
-0xa6, 0x05, 0x5e, 0x04, 0xe4, 0x03, 0xb1, 0x03, 0x02, 0x04, 0x9f, 0x03, 0xb4, 0x03, 0x10, 0x03, 
-0xb6, 0xff, 0x0e, 0xfb, 0xb3, 0xf6, 0xdc, 0xf6, 0x5f, 0xf8, 0xf9, 0xf8, 0x85, 0xf6, 0xdc, 0xf2, 
-0x8e, 0xf1, 0x74, 0xf1, 0x8c, 0xf3, 0xa6, 0xf4, 0x36, 0xf4, 0x2e, 0xf1, 0xfc, 0xed, 0x56, 0xf0, 
-0x21, 0xfa, 0xb8, 0x06, 0x8d, 0x0d, 0xef, 0x0b, 0x34, 0x06, 0x4f, 0x03, 0x35, 0x06, 0x3a, 0x0c, 
-0x46, 0x0f, 0xca, 0x0d, 0x9b, 0x08, 0xa0, 0x05, 0x10, 0x05, 0x8e, 0x06, 0x1d, 0x08, 0x06, 0x08, 
-0x51, 0x07, 0x70, 0x03, 0xd3, 0xff, 0xa9, 0xfb, 0xac, 0xfa, 0x0f, 0xfd, 0x77, 0x00, 0x71, 0x03, 
-0xcc, 0x04, 0x6e, 0x05, 0x62, 0x05, 0xc5, 0x04, 0xb9, 0x03, 0xb2, 0x03, 0xa3, 0x03, 0x7e, 0x03, 
-0x9e, 0x02, 0x0d, 0x01, 0x81, 0xfe, 0x86, 0xfb, 0x34, 0xf9, 0xa6, 0xf8, 0x29, 0xf9, 0x12, 0xf9, 
-0x9c, 0xf7, 0x1e, 0xf4, 0x56, 0xf1, 0xac, 0xf0, 0xa1, 0xf2, 0xe1, 0xf4, 0x98, 0xf4, 0x24, 0xf1, 
-0xfd, 0xee, 0xa8, 0xf2, 0xa4, 0xfc, 0x4b, 0x07, 0x8a, 0x0b, 0x7d, 0x09, 0x20, 0x05, 0x1e, 0x04, 
-0x57, 0x07, 0x82, 0x0c, 0x80, 0x0e, 0xd1, 0x0d, 0x2e, 0x0a, 0x83, 0x07, 0x6e, 0x06, 0x35, 0x07, 
-0xc2, 0x08, 0x75, 0x08, 0xeb, 0x06, 0x73, 0x02, 0x72, 0xfe, 0xf9, 0xfa, 0x88, 0xfa, 0x66, 0xfc, 
-0x41, 0x00, 0x27, 0x03, 0xf6, 0x04, 0xd2, 0x05, 0x85, 0x04, 0xe1, 0x02, 0xab, 0x01, 0xad, 0x02, 
-0xc9, 0x03, 0x12, 0x05, 0x80, 0x03, 0x76, 0x01, 0x88, 0xfe, 0xea, 0xfb, 0xa1, 0xfa, 0xc0, 0xfa, 
-0x81, 0xfb, 0x77, 0xfa, 0x04, 0xf8, 0x51, 0xf4, 0x4e, 0xf2, 0x25, 0xf2, 0x1e, 0xf4, 0x9c, 0xf5, 
-0x7c, 0xf5, 0x97, 0xf2, 0xbc, 0xef, 0xca, 0xf0, 0x70, 0xf8, 0x96, 0x02, 0xad, 0x09, 0x94, 0x0a, 
-0xdd, 0x06, 0x1d, 0x04, 0xb4, 0x04, 0xc8, 0x08, 0x87, 0x0c, 0x67, 0x0d, 0x91, 0x0a, 0x92, 0x06, 
-0xd1, 0x04, 0xa5, 0x05, 0xd4, 0x07, 0xa5, 0x08, 0x21, 0x07, 0x80, 0x03, 0x45, 0xff, 0xe4, 0xfb, 
-0x81, 0xfa, 0x4e, 0xfb, 0x4a, 0xfe, 0x8c, 0x01, 0x76, 0x04, 0x76, 0x05, 0x2b, 0x05, 0x63, 0x04, 
-0xb2, 0x03, 0x3e, 0x04, 0x71, 0x04, 0xe7, 0x04, 0xc1, 0x03, 0x52, 0x03, 0x4d, 0x01, 0x07, 0xff, 
-0x0e, 0xfc, 0xd2, 0xf9, 0x7c, 0xf8, 0xbf, 0xf7, 0xf4, 0xf6, 0x39, 0xf6, 0xa3, 0xf5, 0xfe, 0xf3, 
-0x02, 0xf3, 0x44, 0xf3, 0xef, 0xf3, 0x74, 0xf3, 0x30, 0xf2, 0x75, 0xf1, 0xaa, 0xf5, 0x4b, 0xfe, 
-0xe8, 0x06, 0xfe, 0x0b, 0x71, 0x0b, 0x4d, 0x08, 0x57, 0x06, 0xc6, 0x07, 0x8d, 0x0a, 0xcf, 0x0c, 
-0x99, 0x0c, 0xc8, 0x09, 0x27, 0x07, 0xd1, 0x04, 0x10, 0x04, 0x92, 0x04, 0x47, 0x06, 0x21, 0x06, 
-0x6c, 0x03, 0xd3, 0xfd, 0x87, 0xf8, 0x00, 0xf7, 0x04, 0xfa, 0x7d, 0xff, 0x30, 0x04, 0x83, 0x06, 
-0x29, 0x06, 0x38, 0x05, 0x7a, 0x04, 0x88, 0x04, 0x35, 0x05, 0xac, 0x05, 0x16, 0x05, 0xcc, 0x03, 
-0x45, 0x02, 0x14, 0x00, 0xc1, 0xfd, 0x9c, 0xfb, 0xab, 0xf9, 0x3e, 0xf8, 0xee, 0xf6, 0xe5, 0xf5, 
-0x8f, 0xf5, 0x8c, 0xf5, 0xff, 0xf4, 0x7a, 0xf4, 0x7a, 0xf4, 0xdf, 0xf3, 0x8c, 0xf2, 0x0b, 0xf1, 
-0x67, 0xf2, 0x54, 0xf8, 0xec, 0x00, 0x86, 0x07, 0xde, 0x09, 0x56, 0x08, 0x53, 0x06, 0x31, 0x06, 
-0xd8, 0x07, 0xaf, 0x09, 0x82, 0x0a, 0x62, 0x0a, 0xfd, 0x08, 0x45, 0x07, 0x6e, 0x05, 0xd6, 0x04, 
-0x3b, 0x05, 0x7f, 0x05, 0x76, 0x04, 0x2d, 0x01, 0x73, 0xfd, 0x7b, 0xfa, 0x6e, 0xfa, 0xbe, 0xfc, 
-0x7a, 0x00, 0xb4, 0x03, 0x74, 0x05, 0x35, 0x06, 0x5b, 0x06, 0x52, 0x06, 0x34, 0x05, 0xfa, 0x03, 
-0x4b, 0x03, 0xdf, 0x03, 0xd5, 0x03, 0xbb, 0x02, 0x50, 0x00, 0x90, 0xfd, 0xb5, 0xfa, 0x7a, 0xf8, 
-0x05, 0xf7, 0x37, 0xf6, 0x35, 0xf6, 0x3a, 0xf6, 0x25, 0xf6, 0x04, 0xf5, 0xd7, 0xf3, 0x1d, 0xf2, 
-0xd7, 0xf0, 0x29, 0xf0, 0x07, 0xf2, 0x78, 0xf7, 0xf2, 0xfe, 0xdd, 0x04, 0x42, 0x08, 0xc6, 0x08, 
-0xf0, 0x07, 0x3a, 0x07, 0x8f, 0x07, 0x96, 0x08, 0x1c, 0x0a, 0xdc, 0x0a, 0xf7, 0x09, 0x66, 0x08, 
-0x6e, 0x06, 0x72, 0x05, 0xce, 0x04, 0xa5, 0x04, 0x25, 0x03, 0x71, 0x01, 0xa8, 0xfe, 0x31, 0xfc, 
-0x1f, 0xfb, 0x66, 0xfc, 0x36, 0xff, 0xa1, 0x02, 0x81, 0x05, 0x7e, 0x06, 0xe2, 0x06, 0x05, 0x06, 
-0x38, 0x05, 0xf9, 0x03, 0x5c, 0x03, 0x42, 0x03, 0xe8, 0x03, 0xa5, 0x03, 0xa3, 0x01, 0x80, 0xfe, 
-0xb9, 0xfa, 0xce, 0xf7, 0xcd, 0xf5, 0x4c, 0xf5, 0xa3, 0xf5, 0x29, 0xf7, 0x8f, 0xf7, 0x09, 0xf6, 
-0x5a, 0xf3, 0xa1, 0xf0, 0x58, 0xef, 0x6b, 0xef, 0x58, 0xf1, 0xa2, 0xf6, 0x12, 0xff, 0x44, 0x06, 
-0xc9, 0x09, 0x3a, 0x09, 0xb6, 0x06, 0x89, 0x05, 0x67, 0x06, 0x95, 0x08, 0xbf, 0x0a, 0xaf, 0x0b, 
-0x7a, 0x0a, 0x49, 0x08, 0x09, 0x06, 0x91, 0x04, 0x38, 0x04, 0x23, 0x04, 0x84, 0x03, 0x2b, 0x02, 
-0x18, 0x00, 0x94, 0xfd, 0x0f, 0xfc, 0x5a, 0xfc, 0xc4, 0xfe, 0x7f, 0x02, 0xa8, 0x05, 0x7c, 0x07, 
-0x96, 0x07, 0x6b, 0x06, 0x3b, 0x05, 0x38, 0x04, 0x05, 0x03, 0x5b, 0x02, 0x7b, 0x02, 0xdd, 0x02, 
-0xaa, 0x02, 0x32, 0x00, 0xfc, 0xfb, 0xf8, 0xf7, 0x6b, 0xf5, 0x7d, 0xf4, 0x21, 0xf5, 0x4e, 0xf6, 
-0xa9, 0xf6, 0xf8, 0xf5, 0x1e, 0xf4, 0x67, 0xf1, 0xf3, 0xee, 0xe4, 0xed, 0x62, 0xef, 0x60, 0xf5, 
-0x19, 0xfe, 0xbb, 0x05, 0xe6, 0x09, 0xa9, 0x09, 0xc5, 0x06, 0xb3, 0x04, 0xd5, 0x04, 0xe6, 0x06, 
-0xdc, 0x09, 0xaa, 0x0b, 0x9a, 0x0b, 0x1a, 0x0a, 0xd9, 0x07, 0x81, 0x05, 0x15, 0x04, 0x7b, 0x03, 
-0x33, 0x03, 0xcc, 0x02, 0x8d, 0x01, 0x3d, 0xff, 0x40, 0xfd, 0xd9, 0xfc, 0x58, 0xfe, 0x6b, 0x01, 
-0x40, 0x04, 0x2c, 0x06, 0xe7, 0x06, 0xf9, 0x06, 0x77, 0x06, 0x54, 0x05, 0x55, 0x03, 0x9e, 0x01, 
-0x0e, 0x01, 0x69, 0x01, 0x50, 0x01, 0xdc, 0xff, 0x63, 0xfd, 0x76, 0xfa, 0xc9, 0xf7, 0x61, 0xf5, 
-0x0a, 0xf4, 0x21, 0xf4, 0xaa, 0xf4, 0x09, 0xf5, 0xba, 0xf4, 0x3b, 0xf3, 0x12, 0xf1, 0x8d, 0xef, 
-0x46, 0xf0, 0x6c, 0xf5, 0x6d, 0xfd, 0xbd, 0x04, 0x2d, 0x09, 0x42, 0x0a, 0xfc, 0x08, 0x6d, 0x07, 
-0x89, 0x06, 0xde, 0x06, 0xc5, 0x08, 0xb9, 0x0a, 0x60, 0x0b, 0x8b, 0x0a, 0x86, 0x08, 0x4c, 0x06, 
-0xb7, 0x04, 0x8d, 0x03, 0x91, 0x02, 0x9a, 0x01, 0x5f, 0x00, 0x05, 0xff, 0x0a, 0xfe, 0x0b, 0xfe, 
-0x36, 0xff, 0x1e, 0x01, 0x09, 0x03, 0x97, 0x04, 0x9a, 0x05, 0x07, 0x06, 0x05, 0x06, 0x3e, 0x05, 
-0x9b, 0x03, 0xcc, 0x01, 0x92, 0x00, 0xef, 0xff, 0x60, 0xff, 0xd7, 0xfd, 0x95, 0xfb, 0x27, 0xf9, 
-0x11, 0xf7, 0x3a, 0xf5, 0x2a, 0xf4, 0x2c, 0xf4, 0xe9, 0xf4, 0xaf, 0xf5, 0xaa, 0xf5, 0x1e, 0xf4, 
-0x2c, 0xf2, 0x89, 0xf1, 0x4b, 0xf3, 0x31, 0xf8, 0xce, 0xfe, 0xa6, 0x04, 0x61, 0x08, 0x6c, 0x09, 
-0xc5, 0x08, 0xea, 0x07, 0xa4, 0x07, 0x0d, 0x08, 0x06, 0x09, 0xbc, 0x09, 0x10, 0x0a, 0xc6, 0x09, 
-0xb3, 0x08, 0x25, 0x07, 0x8c, 0x05, 0x04, 0x04, 0xcc, 0x02, 0xc5, 0x01, 0x6d, 0x00, 0x34, 0xff, 
-0x8c, 0xfe, 0x97, 0xfe, 0xb6, 0xff, 0x3f, 0x01, 0x80, 0x02, 0x9b, 0x03, 0xc8, 0x04, 0xc3, 0x05, 
-0x33, 0x06, 0x74, 0x05, 0x9d, 0x03, 0x4c, 0x01, 0x72, 0xff, 0x6e, 0xfe, 0xac, 0xfd, 0x8f, 0xfc, 
-0xc9, 0xfa, 0x74, 0xf8, 0x7d, 0xf6, 0x88, 0xf5, 0xfa, 0xf4, 0x5d, 0xf4, 0xe3, 0xf3, 0x73, 0xf3, 
-0xe9, 0xf2, 0x57, 0xf2, 0xbc, 0xf1, 0xd8, 0xf2, 0x31, 0xf7, 0x64, 0xfd, 0x5b, 0x03, 0xa2, 0x07, 
-0x36, 0x09, 0x02, 0x09, 0x5b, 0x08, 0xac, 0x07, 0xc1, 0x07, 0xd7, 0x08, 0xe0, 0x09, 0x4b, 0x0a, 
-0xe5, 0x09, 0x74, 0x08, 0x95, 0x06, 0xcd, 0x04, 0x0c, 0x03, 0xe0, 0x01, 0x1a, 0x01, 0x1e, 0x00, 
-0x56, 0xff, 0xf5, 0xfe, 0x01, 0xff, 0x00, 0x00, 0x6c, 0x01, 0xe6, 0x02, 0x6b, 0x04, 0x81, 0x05, 
-0xfb, 0x05, 0xe7, 0x05, 0x10, 0x05, 0xd3, 0x03, 0x61, 0x02, 0xa4, 0x00, 0xfb, 0xfe, 0xd9, 0xfd, 
-0xf7, 0xfc, 0xd1, 0xfb, 0xda, 0xf9, 0x56, 0xf7, 0x8e, 0xf5, 0x17, 0xf5, 0x38, 0xf5, 0x7a, 0xf5, 
-0x71, 0xf5, 0x15, 0xf5, 0xb1, 0xf4, 0x2b, 0xf4, 0x01, 0xf4, 0x9f, 0xf5, 0x82, 0xf9, 0xb2, 0xfe, 
-0x9e, 0x03, 0x10, 0x07, 0x71, 0x08, 0x3d, 0x08, 0x81, 0x07, 0xcc, 0x06, 0xa5, 0x06, 0x63, 0x07, 
-0x61, 0x08, 0x0e, 0x09, 0x21, 0x09, 0x59, 0x08, 0xf2, 0x06, 0x67, 0x05, 0xf7, 0x03, 0xb5, 0x02, 
-0xa6, 0x01, 0xa6, 0x00, 0x9a, 0xff, 0xfa, 0xfe, 0x1c, 0xff, 0xb9, 0xff, 0xd4, 0x00, 0x13, 0x02, 
-0x03, 0x03, 0xb2, 0x03, 0x1c, 0x04, 0x07, 0x04, 0x8a, 0x03, 0xb3, 0x02, 0x70, 0x01, 0xf0, 0xff, 
-0x71, 0xfe, 0xfd, 0xfc, 0xb9, 0xfb, 0x6a, 0xfa, 0xef, 0xf8, 0xfa, 0xf7, 0x74, 0xf7, 0xed, 0xf6, 
-0x88, 0xf6, 0xe9, 0xf5, 0x40, 0xf5, 0x0a, 0xf5, 0xbe, 0xf4, 0xa6, 0xf4, 0xcc, 0xf5, 0x66, 0xf8, 
-0xb3, 0xfc, 0xae, 0x01, 0x67, 0x05, 0x69, 0x07, 0x32, 0x08, 0x04, 0x08, 0x89, 0x07, 0x1b, 0x07, 
-0xff, 0x06, 0xd7, 0x07, 0x40, 0x09, 0xef, 0x09, 0x81, 0x09, 0x06, 0x08, 0xe8, 0x05, 0x20, 0x04, 
-0xbc, 0x02, 0x7e, 0x01, 0x99, 0x00, 0xd0, 0xff, 0x28, 0xff, 0x19, 0xff, 0x98, 0xff, 0x46, 0x00, 
-0xf9, 0x00, 0xa3, 0x01, 0x3a, 0x02, 0xc5, 0x02, 0x40, 0x03, 0x2f, 0x03, 0x71, 0x02, 0x66, 0x01, 
-0x1b, 0x00, 0xb3, 0xfe, 0x83, 0xfd, 0x40, 0xfc, 0xb0, 0xfa, 0x49, 0xf9, 0x4c, 0xf8, 0x77, 0xf7, 
-0xd0, 0xf6, 0x79, 0xf6, 0x5b, 0xf6, 0x9d, 0xf6, 0x12, 0xf7, 0x1b, 0xf7, 0x09, 0xf7, 0x99, 0xf7, 
-0xe1, 0xf8, 0x52, 0xfb, 0x26, 0xff, 0x1e, 0x03, 0x02, 0x06, 0x8d, 0x07, 0xb3, 0x07, 0x43, 0x07, 
-0x29, 0x07, 0x38, 0x07, 0x71, 0x07, 0x20, 0x08, 0xa8, 0x08, 0x91, 0x08, 0xae, 0x07, 0x12, 0x06, 
-0x68, 0x04, 0x37, 0x03, 0x58, 0x02, 0x9b, 0x01, 0xbd, 0x00, 0xe2, 0xff, 0x70, 0xff, 0x90, 0xff, 
-0x22, 0x00, 0xee, 0x00, 0x94, 0x01, 0x13, 0x02, 0x61, 0x02, 0x5d, 0x02, 0x17, 0x02, 0xa4, 0x01, 
-0xf6, 0x00, 0x2f, 0x00, 0x23, 0xff, 0xa7, 0xfd, 0xe8, 0xfb, 0x64, 0xfa, 0xaf, 0xf9, 0x89, 0xf9, 
-0x26, 0xf9, 0x85, 0xf8, 0xe9, 0xf7, 0xa0, 0xf7, 0xd3, 0xf7, 0xfd, 0xf7, 0x19, 0xf8, 0x9e, 0xf8, 
-0x8f, 0xf9, 0x0c, 0xfb, 0xf2, 0xfc, 0xaf, 0xfe, 0x4c, 0x00, 0xf2, 0x01, 0x8e, 0x03, 0x06, 0x05, 
-0xff, 0x05, 0x49, 0x06, 0x68, 0x06, 0xa9, 0x06, 0xe8, 0x06, 0x0c, 0x07, 0xc4, 0x06, 0xf9, 0x05, 
-0x4f, 0x05, 0xcc, 0x04, 0x3c, 0x04, 0xb5, 0x03, 0xee, 0x02, 0xfc, 0x01, 0x4f, 0x01, 0xe9, 0x00, 
-0xe0, 0x00, 0x05, 0x01, 0x04, 0x01, 0xe1, 0x00, 0xd9, 0x00, 0x1f, 0x01, 0x86, 0x01, 0xa8, 0x01, 
-0x6b, 0x01, 0xab, 0x00, 0xbb, 0xff, 0xe5, 0xfe, 0xfc, 0xfd, 0xe8, 0xfc, 0xd4, 0xfb, 0x0c, 0xfb, 
-0xb4, 0xfa, 0x66, 0xfa, 0xe3, 0xf9, 0x22, 0xf9, 0x88, 0xf8, 0x7b, 0xf8, 0xcd, 0xf8, 0x4b, 0xf9, 
-0x0a, 0xfa, 0xec, 0xfa, 0x15, 0xfc, 0x91, 0xfd, 0x0e, 0xff, 0x5e, 0x00, 0xa2, 0x01, 0x88, 0x02, 
-0xe9, 0x02, 0x48, 0x03, 0xd0, 0x03, 0x86, 0x04, 0x7d, 0x05, 0xec, 0x05, 0xda, 0x05, 0xee, 0x05, 
-0xc9, 0x05, 0x4c, 0x05, 0xbe, 0x04, 0x04, 0x04, 0x89, 0x03, 0x5e, 0x03, 0xe6, 0x02, 0x26, 0x02, 
-0x8e, 0x01, 0x15, 0x01, 0xc5, 0x00, 0xac, 0x00, 0x89, 0x00, 0x4e, 0x00, 0x23, 0x00, 0xc5, 0xff, 
-0x22, 0xff, 0x93, 0xfe, 0x25, 0xfe, 0xef, 0xfd, 0xd1, 0xfd, 0x65, 0xfd, 0xe1, 0xfc, 0xc4, 0xfc, 
-0xe5, 0xfc, 0xfb, 0xfc, 0xda, 0xfc, 0x83, 0xfc, 0x48, 0xfc, 0x57, 0xfc, 0x4f, 0xfc, 0x35, 0xfc, 
-0x1f, 0xfc, 0x0d, 0xfc, 0x67, 0xfc, 0x2e, 0xfd, 0xbb, 0xfd, 0x57, 0xfe, 0x21, 0xff, 0x0b, 0x00, 
-0x4d, 0x01, 0x4f, 0x02, 0x88, 0x02, 0x9a, 0x02, 0xab, 0x02, 0xd7, 0x02, 0x71, 0x03, 0x0c, 0x04, 
-0x3e, 0x04, 0x55, 0x04, 0x37, 0x04, 0xbf, 0x03, 0x32, 0x03, 0xbc, 0x02, 0x58, 0x02, 0x3e, 0x02, 
-0x3e, 0x02, 0xfe, 0x01, 0x84, 0x01, 0x15, 0x01, 0xc7, 0x00, 0xb4, 0x00, 0xd0, 0x00, 0xc7, 0x00, 
-0x79, 0x00, 0x1e, 0x00, 0xbf, 0xff, 0x58, 0xff, 0x11, 0xff, 0xd6, 0xfe, 0x79, 0xfe, 0x09, 0xfe, 
-0x94, 0xfd, 0x12, 0xfd, 0xb2, 0xfc, 0x7e, 0xfc, 0x6e, 0xfc, 0x7c, 0xfc, 0x8d, 0xfc, 0x90, 0xfc, 
-0xa4, 0xfc, 0xb8, 0xfc, 0xcb, 0xfc, 0xf4, 0xfc, 0x56, 0xfd, 0xfb, 0xfd, 0xa6, 0xfe, 0x28, 0xff, 
-0xbf, 0xff, 0x7f, 0x00, 0x37, 0x01, 0x94, 0x01, 0x6d, 0x01, 0x0d, 0x01, 0x0c, 0x01, 0x5f, 0x01, 
-0xb3, 0x01, 0xff, 0x01, 0x27, 0x02, 0x18, 0x02, 0x10, 0x02, 0xe5, 0x01, 0x91, 0x01, 0x6c, 0x01, 
-0x4b, 0x01, 0x2a, 0x01, 0x4c, 0x01, 0x55, 0x01, 0x31, 0x01, 0x1d, 0x01, 0xfe, 0x00, 0xeb, 0x00, 
-0xe6, 0x00, 0xab, 0x00, 0x65, 0x00, 0x32, 0x00, 0xeb, 0xff, 0xb1, 0xff, 0x85, 0xff, 0x57, 0xff, 
-0x35, 0xff, 0xff, 0xfe, 0xad, 0xfe, 0x7d, 0xfe, 0x68, 0xfe, 0x58, 0xfe, 0x39, 0xfe, 0x1f, 0xfe, 
-0x16, 0xfe, 0x18, 0xfe, 0x05, 0xfe, 0xc8, 0xfd, 0x72, 0xfd, 0x62, 0xfd, 0xbc, 0xfd, 0x57, 0xfe, 
-0xfb, 0xfe, 0x81, 0xff, 0xf7, 0xff, 0x72, 0x00, 0xd2, 0x00, 0x06, 0x01, 0x37, 0x01, 0x96, 0x01, 
-0x1e, 0x02, 0x5d, 0x02, 0x16, 0x02, 0x91, 0x01, 0x1c, 0x01, 0xd4, 0x00, 0xca, 0x00, 0xb8, 0x00, 
-0x90, 0x00, 0x98, 0x00, 0xac, 0x00, 0x8d, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xe9, 0xff, 
-0x33, 0x00, 0x5a, 0x00, 0x7a, 0x00, 0x91, 0x00, 0xcc, 0x00, 0xf9, 0x00, 0xc9, 0x00, 0x57, 0x00, 
-0xf3, 0xff, 0xbd, 0xff, 0xaa, 0xff, 0x7c, 0xff, 0x26, 0xff, 0xb9, 0xfe, 0x58, 0xfe, 0x14, 0xfe, 
-0x07, 0xfe, 0x4a, 0xfe, 0xbc, 0xfe, 0x24, 0xff, 0x65, 0xff, 0x52, 0xff, 0xfd, 0xfe, 0x9f, 0xfe, 
-0x69, 0xfe, 0xa5, 0xfe, 0x62, 0xff, 0x51, 0x00, 0x0f, 0x01, 0x55, 0x01, 0x25, 0x01, 0xc3, 0x00, 
-0x72, 0x00, 0x6e, 0x00, 0xb5, 0x00, 0x1f, 0x01, 0x5e, 0x01, 0x51, 0x01, 0x09, 0x01, 0xa4, 0x00, 
-0x43, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x4e, 0x00, 0x6b, 0x00, 0x49, 0x00, 0xe0, 0xff, 0x75, 0xff, 
-0x4f, 0xff, 0x6b, 0xff, 0xac, 0xff, 0x0a, 0x00, 0x4b, 0x00, 0x63, 0x00, 0x44, 0x00, 0xee, 0xff, 
-0xa0, 0xff, 0x9b, 0xff, 0xce, 0xff, 0x0e, 0x00, 0x28, 0x00, 0x18, 0x00, 0xde, 0xff, 0x8b, 0xff, 
-0x3a, 0xff, 0xe1, 0xfe, 0x8e, 0xfe, 0x8a, 0xfe, 0xc4, 0xfe, 0x10, 0xff, 0x4a, 0xff, 0x57, 0xff, 
-0x66, 0xff, 0x99, 0xff, 0xec, 0xff, 0x4c, 0x00, 0x9c, 0x00, 0xdd, 0x00, 0x1d, 0x01, 0x34, 0x01, 
-0x0f, 0x01, 0xcd, 0x00, 0x9d, 0x00, 0x9a, 0x00, 0xc1, 0x00, 0xeb, 0x00, 0xfe, 0x00, 0xe4, 0x00, 
-0x8e, 0x00, 0x10, 0x00, 0xc0, 0xff, 0xcc, 0xff, 0x0e, 0x00, 0x3c, 0x00, 0x2e, 0x00, 0xf4, 0xff, 
-0xbe, 0xff, 0xaa, 0xff, 0xbe, 0xff, 0xe1, 0xff, 0x06, 0x00, 0x1d, 0x00, 0x11, 0x00, 0xe2, 0xff, 
-0x9b, 0xff, 0x6f, 0xff, 0x7e, 0xff, 0xa5, 0xff, 0xca, 0xff, 0xde, 0xff, 0xc5, 0xff, 0xb5, 0xff, 
-0xcb, 0xff, 0xef, 0xff, 0x13, 0x00, 0x1e, 0x00, 0x05, 0x00, 0xec, 0xff, 0xdd, 0xff, 0xe4, 0xff, 
-0x05, 0x00, 0x26, 0x00, 0x31, 0x00, 0x24, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x32, 0x00, 0x54, 0x00, 
-0x73, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x34, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x21, 0x00, 
-0x22, 0x00, 0x18, 0x00, 0x09, 0x00, 0xfe, 0xff, 0xf0, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xf5, 0xff, 
-0xfd, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf6, 0xff, 
-0xfd, 0xff, 0x01, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x02, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0xfe, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 
-0xfb, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 
-0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfb, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 
-};
-
@@ -1,710 +0,0 @@
-#include <stdio.h>
-const unsigned char me_red_color[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 
-0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfa, 0xff, 
-0xf7, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf0, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0xfd, 0xff, 0x01, 0x00, 0x13, 0x00, 0x36, 0x00, 0x55, 0x00, 0x63, 0x00, 0x67, 0x00, 
-0x59, 0x00, 0x43, 0x00, 0x35, 0x00, 0x2a, 0x00, 0x28, 0x00, 0x24, 0x00, 0x18, 0x00, 0x04, 0x00, 
-0xda, 0xff, 0xaa, 0xff, 0x82, 0xff, 0x62, 0xff, 0x59, 0xff, 0x5d, 0xff, 0x6b, 0xff, 0x78, 0xff, 
-0x7e, 0xff, 0x83, 0xff, 0x84, 0xff, 0x89, 0xff, 0x9b, 0xff, 0xb2, 0xff, 0xd0, 0xff, 0xeb, 0xff, 
-0xff, 0xff, 0x0c, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 
-0x19, 0x00, 0x1a, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x05, 0x00, 0xff, 0xff, 0xfc, 0xff, 
-0x02, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x0c, 0x00, 
-0x19, 0x00, 0x2d, 0x00, 0x3d, 0x00, 0x45, 0x00, 0x4b, 0x00, 0x4a, 0x00, 0x46, 0x00, 0x38, 0x00, 
-0x28, 0x00, 0x22, 0x00, 0x1d, 0x00, 0x19, 0x00, 0x11, 0x00, 0x08, 0x00, 0x00, 0x00, 0xfc, 0xff, 
-0xfa, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x07, 0x00, 0x0d, 0x00, 0x0f, 0x00, 
-0x0b, 0x00, 0x09, 0x00, 0x04, 0x00, 0xfa, 0xff, 0xef, 0xff, 0xe5, 0xff, 0xe0, 0xff, 0xd3, 0xff, 
-0xd1, 0xff, 0xdc, 0xff, 0xea, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x23, 0x00, 
-0x13, 0x00, 0x05, 0x00, 0x04, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x06, 0x00, 0xf2, 0xff, 0xe3, 0xff, 
-0xd1, 0xff, 0xba, 0xff, 0xb1, 0xff, 0xaa, 0xff, 0xa1, 0xff, 0xa2, 0xff, 0xa4, 0xff, 0xa0, 0xff, 
-0xa0, 0xff, 0x97, 0xff, 0x8d, 0xff, 0x8d, 0xff, 0x93, 0xff, 0xab, 0xff, 0xdd, 0xff, 0x25, 0x00, 
-0xd4, 0x00, 0xe6, 0x01, 0xc8, 0x02, 0x1d, 0x03, 0x06, 0x03, 0xb3, 0x02, 0x2e, 0x02, 0xa7, 0x01, 
-0x35, 0x01, 0xec, 0x00, 0x9a, 0x00, 0xf7, 0xff, 0x2e, 0xff, 0x54, 0xfe, 0x63, 0xfd, 0x7f, 0xfc, 
-0xf6, 0xfb, 0xef, 0xfb, 0x44, 0xfc, 0xcc, 0xfc, 0x6a, 0xfd, 0xf8, 0xfd, 0x3e, 0xfe, 0x3c, 0xfe, 
-0x4b, 0xfe, 0xa1, 0xfe, 0x25, 0xff, 0xb5, 0xff, 0x23, 0x00, 0x73, 0x00, 0x8c, 0x00, 0x6c, 0x00, 
-0x17, 0x00, 0x98, 0xff, 0xfd, 0xfe, 0x4b, 0xfe, 0xba, 0xfd, 0x4e, 0xfd, 0x0f, 0xfd, 0xfa, 0xfc, 
-0x2f, 0xfd, 0xb3, 0xfd, 0x58, 0xfe, 0x33, 0xff, 0x36, 0x00, 0x73, 0x01, 0xca, 0x02, 0x11, 0x04, 
-0x39, 0x05, 0x1a, 0x06, 0xb3, 0x06, 0xe7, 0x06, 0xc4, 0x06, 0x6e, 0x06, 0xc8, 0x05, 0xb8, 0x04, 
-0x69, 0x03, 0x57, 0x02, 0xa2, 0x01, 0xd6, 0x00, 0xbc, 0xff, 0x6e, 0xfe, 0x81, 0xfd, 0x37, 0xfd, 
-0xc8, 0xfc, 0x16, 0xfc, 0x73, 0xfb, 0x0f, 0xfb, 0xd0, 0xfa, 0x9a, 0xfa, 0x7e, 0xfa, 0x64, 0xfa, 
-0x5e, 0xfa, 0x59, 0xfa, 0x5a, 0xfa, 0x6e, 0xfa, 0xb0, 0xfa, 0xa3, 0xfb, 0xec, 0xfd, 0xef, 0x00, 
-0x6c, 0x03, 0xac, 0x04, 0xf6, 0x04, 0xf3, 0x04, 0x1e, 0x05, 0xa3, 0x05, 0x7f, 0x06, 0x81, 0x07, 
-0x06, 0x08, 0xe3, 0x07, 0x5c, 0x07, 0x29, 0x06, 0x3f, 0x04, 0x06, 0x02, 0x95, 0x00, 0xad, 0x00, 
-0x20, 0x01, 0xfe, 0x00, 0x5d, 0x00, 0xa4, 0xff, 0xe3, 0xfe, 0x46, 0xfe, 0x2a, 0xfe, 0x5a, 0xfe, 
-0x78, 0xfe, 0x56, 0xfe, 0xf3, 0xfd, 0x2e, 0xfd, 0x4f, 0xfc, 0x5b, 0xfb, 0x7d, 0xfa, 0xdf, 0xf9, 
-0x33, 0xf9, 0x76, 0xf8, 0xcc, 0xf7, 0x90, 0xf7, 0xab, 0xf7, 0x2c, 0xf8, 0x35, 0xf9, 0xa3, 0xfa, 
-0x60, 0xfc, 0x47, 0xfe, 0x37, 0x00, 0x0d, 0x02, 0xce, 0x03, 0x78, 0x05, 0xfd, 0x06, 0x52, 0x08, 
-0x38, 0x09, 0x94, 0x09, 0x70, 0x09, 0xd5, 0x08, 0x95, 0x07, 0xbd, 0x05, 0xe2, 0x03, 0x82, 0x02, 
-0x52, 0x02, 0x42, 0x02, 0xb2, 0x01, 0xea, 0x00, 0x16, 0x00, 0xfe, 0xff, 0xf9, 0xff, 0xd4, 0xff, 
-0x8f, 0xff, 0x7e, 0xff, 0x62, 0xff, 0xa8, 0xfe, 0xb8, 0xfd, 0xde, 0xfc, 0xee, 0xfb, 0xc6, 0xfa, 
-0xfe, 0xf9, 0x3e, 0xf9, 0x66, 0xf8, 0x9f, 0xf7, 0xf9, 0xf6, 0xa4, 0xf6, 0xe1, 0xf6, 0xc0, 0xf7, 
-0x10, 0xf9, 0xcd, 0xfa, 0xb7, 0xfc, 0xb6, 0xfe, 0xad, 0x00, 0x82, 0x02, 0x7b, 0x04, 0x87, 0x06, 
-0x46, 0x08, 0x8d, 0x09, 0x28, 0x0a, 0xe1, 0x09, 0x96, 0x08, 0x7c, 0x06, 0x2e, 0x04, 0xd4, 0x02, 
-0x06, 0x03, 0x2d, 0x03, 0xc4, 0x02, 0x4e, 0x02, 0x3c, 0x01, 0x3d, 0x00, 0x43, 0x00, 0xd6, 0x00, 
-0x47, 0x01, 0x50, 0x01, 0x0d, 0x01, 0x78, 0x00, 0x85, 0xff, 0xa4, 0xfe, 0xfe, 0xfd, 0x65, 0xfd, 
-0x90, 0xfc, 0x6d, 0xfb, 0x5f, 0xfa, 0xad, 0xf9, 0x12, 0xf9, 0x2e, 0xf8, 0xa1, 0xf7, 0x60, 0xf7, 
-0x96, 0xf7, 0x91, 0xf8, 0xea, 0xf9, 0x93, 0xfb, 0x6f, 0xfd, 0x65, 0xff, 0x45, 0x01, 0x32, 0x03, 
-0xe9, 0x04, 0xa3, 0x06, 0xff, 0x07, 0x8c, 0x08, 0x99, 0x08, 0x1b, 0x08, 0xbf, 0x06, 0x2d, 0x05, 
-0x42, 0x04, 0xf8, 0x03, 0xf0, 0x03, 0x7a, 0x03, 0xfb, 0x02, 0x5f, 0x02, 0x7a, 0x01, 0x43, 0x01, 
-0x51, 0x02, 0xf4, 0x02, 0x71, 0x02, 0xa2, 0x01, 0x99, 0x00, 0xce, 0xff, 0x37, 0xff, 0xeb, 0xfe, 
-0x90, 0xfe, 0xcc, 0xfd, 0x8b, 0xfc, 0xf4, 0xfa, 0x8d, 0xfa, 0xa3, 0xf9, 0x43, 0xf8, 0x5f, 0xf7, 
-0xbc, 0xf6, 0x84, 0xf6, 0x67, 0xf6, 0x1d, 0xf7, 0x58, 0xf8, 0xc8, 0xf9, 0x84, 0xfb, 0xb5, 0xfd, 
-0x2d, 0x00, 0x99, 0x02, 0x8e, 0x04, 0x05, 0x06, 0x22, 0x07, 0x13, 0x08, 0xac, 0x08, 0x25, 0x08, 
-0x11, 0x07, 0x13, 0x06, 0x3f, 0x05, 0x90, 0x04, 0xd3, 0x03, 0xbe, 0x03, 0x68, 0x03, 0x74, 0x02, 
-0x40, 0x02, 0xca, 0x02, 0x38, 0x03, 0x2f, 0x03, 0xfb, 0x02, 0xb5, 0x02, 0x14, 0x02, 0x64, 0x01, 
-0x19, 0x01, 0x4c, 0x00, 0x1d, 0xff, 0x15, 0xfe, 0x73, 0xfc, 0xf7, 0xfa, 0x6a, 0xfa, 0x5a, 0xf9, 
-0xb3, 0xf7, 0xf8, 0xf6, 0xb1, 0xf6, 0x3e, 0xf6, 0x71, 0xf5, 0xe5, 0xf4, 0xad, 0xf5, 0x3b, 0xf7, 
-0x99, 0xf9, 0x60, 0xfc, 0x28, 0xff, 0x9d, 0x01, 0xf8, 0x03, 0x17, 0x06, 0x56, 0x07, 0x28, 0x08, 
-0xd0, 0x08, 0x4f, 0x09, 0xf4, 0x08, 0x10, 0x08, 0xcd, 0x06, 0x07, 0x05, 0xcb, 0x03, 0x67, 0x03, 
-0xd5, 0x03, 0x76, 0x04, 0xde, 0x04, 0xeb, 0x04, 0x61, 0x04, 0xda, 0x03, 0xc4, 0x03, 0xd4, 0x03, 
-0xd5, 0x03, 0xf8, 0x02, 0xbc, 0x01, 0x76, 0x00, 0x29, 0xfe, 0x7d, 0xfd, 0xca, 0xfc, 0x01, 0xfb, 
-0xb5, 0xf9, 0x00, 0xf8, 0x7d, 0xf6, 0x6f, 0xf5, 0x00, 0xf5, 0x34, 0xf4, 0xd5, 0xf2, 0x93, 0xf1, 
-0x88, 0xf1, 0xd6, 0xf3, 0xc1, 0xf7, 0x5c, 0xfc, 0x39, 0x00, 0xf9, 0x02, 0x18, 0x05, 0x86, 0x06, 
-0xb2, 0x07, 0xfb, 0x08, 0x40, 0x0a, 0xef, 0x0a, 0x87, 0x0a, 0xb1, 0x08, 0x03, 0x06, 0x7b, 0x03, 
-0x37, 0x02, 0xae, 0x02, 0xf9, 0x03, 0x1d, 0x05, 0x33, 0x05, 0xdc, 0x04, 0xc0, 0x04, 0xdb, 0x04, 
-0xfc, 0x04, 0x2b, 0x05, 0xe4, 0x04, 0xdf, 0x03, 0xcc, 0x02, 0xc2, 0x01, 0x18, 0x00, 0x14, 0xfe, 
-0x1e, 0xfc, 0x86, 0xfa, 0x1a, 0xf9, 0xe6, 0xf7, 0x22, 0xf7, 0x21, 0xf5, 0x98, 0xf2, 0x36, 0xf0, 
-0x98, 0xef, 0x7c, 0xf2, 0xb5, 0xf6, 0x22, 0xfa, 0x28, 0xfd, 0x5d, 0xff, 0xfd, 0x01, 0xa7, 0x05, 
-0x96, 0x08, 0x78, 0x09, 0x49, 0x08, 0x00, 0x07, 0x15, 0x06, 0x65, 0x05, 0x77, 0x04, 0x10, 0x03, 
-0xa3, 0x01, 0x4e, 0x01, 0xda, 0x01, 0xf6, 0x02, 0x40, 0x04, 0x0c, 0x05, 0x4d, 0x05, 0x9b, 0x05, 
-0x44, 0x06, 0x04, 0x07, 0xcc, 0x06, 0xb5, 0x05, 0x91, 0x04, 0x99, 0x03, 0x54, 0x03, 0xa0, 0x02, 
-0x21, 0x01, 0x40, 0xff, 0x3f, 0xfd, 0x0a, 0xfb, 0x10, 0xf9, 0x3a, 0xf7, 0x07, 0xf5, 0x29, 0xf3, 
-0xbd, 0xf0, 0x9d, 0xed, 0x98, 0xeb, 0x7a, 0xed, 0x94, 0xf3, 0x81, 0xf9, 0xe4, 0xfd, 0x2f, 0x01, 
-0x27, 0x04, 0x46, 0x07, 0x37, 0x0a, 0xdb, 0x0b, 0x4e, 0x0b, 0xb9, 0x09, 0xed, 0x07, 0x14, 0x06, 
-0xe7, 0x03, 0xc9, 0x01, 0x5c, 0xff, 0x55, 0xfe, 0x2c, 0xff, 0xdf, 0x00, 0xf5, 0x02, 0x4d, 0x05, 
-0x24, 0x07, 0x13, 0x08, 0x86, 0x08, 0xf2, 0x08, 0x1a, 0x09, 0xc7, 0x07, 0x3f, 0x06, 0x8f, 0x04, 
-0x1b, 0x03, 0x54, 0x02, 0x0d, 0x02, 0xda, 0x00, 0x4b, 0xfe, 0x33, 0xfb, 0x48, 0xf8, 0xcf, 0xf5, 
-0xe2, 0xf3, 0xca, 0xf1, 0x96, 0xee, 0xa2, 0xea, 0xed, 0xe7, 0xc0, 0xe9, 0x4a, 0xf0, 0xc7, 0xf7, 
-0x77, 0xfe, 0xd8, 0x03, 0x42, 0x07, 0xea, 0x0a, 0x7c, 0x0e, 0x13, 0x0f, 0x6c, 0x0c, 0xd0, 0x09, 
-0x46, 0x07, 0xb8, 0x04, 0x2b, 0x02, 0xce, 0xfe, 0x13, 0xfc, 0x86, 0xfb, 0x39, 0xfd, 0x67, 0xff, 
-0x11, 0x02, 0xc7, 0x05, 0xfa, 0x08, 0x05, 0x0b, 0x9f, 0x0c, 0x21, 0x0d, 0x67, 0x0c, 0xdf, 0x0a, 
-0x67, 0x08, 0xf2, 0x04, 0x36, 0x02, 0xec, 0x00, 0x5a, 0xff, 0x32, 0xfd, 0xb6, 0xfb, 0x46, 0xfa, 
-0xd3, 0xf8, 0x72, 0xf7, 0x27, 0xf5, 0x8c, 0xf2, 0xb7, 0xee, 0x64, 0xe8, 0x7f, 0xe3, 0xdd, 0xe4, 
-0x58, 0xec, 0xcf, 0xf5, 0xbd, 0xfe, 0x30, 0x06, 0x80, 0x0b, 0x51, 0x10, 0xa6, 0x13, 0xd8, 0x13, 
-0xe3, 0x0f, 0x2b, 0x0a, 0x2d, 0x05, 0x75, 0x01, 0xa1, 0xfe, 0xec, 0xfa, 0x52, 0xf7, 0x5c, 0xf7, 
-0x33, 0xfb, 0xb8, 0xff, 0xfa, 0x03, 0x8f, 0x07, 0x53, 0x0b, 0x8f, 0x0f, 0xe6, 0x11, 0x3b, 0x10, 
-0x36, 0x0c, 0x36, 0x09, 0x1e, 0x07, 0x7f, 0x04, 0x98, 0x00, 0x2e, 0xfe, 0x22, 0xfe, 0x35, 0xfe, 
-0x71, 0xfd, 0x44, 0xfb, 0x91, 0xf8, 0xd2, 0xf6, 0x23, 0xf5, 0x60, 0xf1, 0x1a, 0xec, 0xc0, 0xe4, 
-0x76, 0xdf, 0x41, 0xe2, 0x5a, 0xed, 0x8c, 0xf8, 0xf8, 0x00, 0x10, 0x09, 0xcb, 0x0f, 0x58, 0x15, 
-0x1f, 0x18, 0xf2, 0x14, 0x31, 0x0e, 0x5f, 0x08, 0x4b, 0x03, 0xdb, 0xfd, 0x9e, 0xf8, 0xce, 0xf5, 
-0xdc, 0xf5, 0x78, 0xf9, 0x73, 0xfe, 0xa0, 0x02, 0xd6, 0x06, 0x6f, 0x0c, 0x3d, 0x10, 0x32, 0x10, 
-0x22, 0x0e, 0xe7, 0x0b, 0xf4, 0x09, 0xe4, 0x07, 0xd6, 0x04, 0x61, 0x01, 0x04, 0x01, 0xc0, 0x01, 
-0x31, 0x01, 0x31, 0xff, 0xef, 0xfd, 0xd0, 0xfc, 0xe9, 0xf9, 0xbf, 0xf6, 0x5c, 0xf3, 0x44, 0xef, 
-0x58, 0xeb, 0x40, 0xe4, 0xdb, 0xdb, 0xa1, 0xdd, 0x1e, 0xeb, 0x0c, 0xfa, 0x74, 0x04, 0x47, 0x0d, 
-0x79, 0x14, 0xb6, 0x19, 0x69, 0x1b, 0x5e, 0x15, 0xfc, 0x09, 0x18, 0x02, 0xb0, 0xfd, 0x77, 0xf7, 
-0xf4, 0xf2, 0xbc, 0xf3, 0x35, 0xf7, 0x44, 0xfd, 0x2e, 0x05, 0xe8, 0x09, 0xf7, 0x0c, 0x13, 0x11, 
-0x1a, 0x12, 0xcf, 0x0d, 0x41, 0x08, 0x87, 0x04, 0x98, 0x03, 0x00, 0x03, 0x45, 0x02, 0x96, 0x02, 
-0x70, 0x04, 0x4b, 0x06, 0x6c, 0x05, 0xc3, 0x03, 0xbd, 0x01, 0xab, 0xfe, 0x73, 0xfa, 0x1b, 0xf5, 
-0xd9, 0xf0, 0xeb, 0xed, 0xe1, 0xea, 0x86, 0xe3, 0xc3, 0xdb, 0x03, 0xde, 0xce, 0xea, 0xb5, 0xfb, 
-0xed, 0x08, 0xa7, 0x10, 0x34, 0x15, 0xc0, 0x19, 0x95, 0x19, 0x04, 0x10, 0x10, 0x04, 0x20, 0xfd, 
-0x2c, 0xf9, 0x49, 0xf5, 0x3e, 0xf3, 0xc6, 0xf3, 0x17, 0xf9, 0xcd, 0x01, 0x5a, 0x09, 0xe8, 0x0c, 
-0xe9, 0x0e, 0xc5, 0x11, 0xbc, 0x11, 0x28, 0x0b, 0xe8, 0x03, 0x80, 0x00, 0xa8, 0xff, 0x1f, 0x01, 
-0x0d, 0x02, 0xd9, 0x03, 0xf7, 0x07, 0x5c, 0x0a, 0x7c, 0x07, 0x67, 0x04, 0x66, 0x03, 0xff, 0xff, 
-0x74, 0xfa, 0x4e, 0xf4, 0x6c, 0xf0, 0x45, 0xef, 0x70, 0xec, 0x53, 0xe6, 0x97, 0xdd, 0x71, 0xdd, 
-0x70, 0xe8, 0x5e, 0xf9, 0x7e, 0x09, 0x99, 0x12, 0xf7, 0x16, 0x08, 0x1a, 0xa2, 0x17, 0xf8, 0x0b, 
-0x3a, 0x00, 0xa9, 0xf9, 0x93, 0xf6, 0x16, 0xf4, 0xeb, 0xf3, 0x66, 0xf7, 0xba, 0xfe, 0x65, 0x06, 
-0x59, 0x0b, 0xc5, 0x0e, 0x4e, 0x10, 0x7f, 0x0e, 0x6c, 0x0a, 0xe5, 0x04, 0x22, 0x00, 0xe2, 0xfe, 
-0x3d, 0xfe, 0x17, 0x00, 0x08, 0x07, 0x58, 0x0b, 0x0d, 0x0c, 0xaa, 0x0c, 0xc5, 0x09, 0xac, 0x04, 
-0xe1, 0x00, 0x44, 0xfb, 0x32, 0xf6, 0xee, 0xf4, 0x68, 0xf2, 0x1d, 0xf0, 0xa0, 0xee, 0xec, 0xed, 
-0xb6, 0xe8, 0x9c, 0xdf, 0x40, 0xe2, 0xb0, 0xf1, 0x2b, 0x03, 0x29, 0x0e, 0x67, 0x14, 0x72, 0x17, 
-0x90, 0x16, 0xb4, 0x0d, 0xc9, 0x00, 0x95, 0xf8, 0x71, 0xf6, 0x0a, 0xf6, 0x49, 0xf5, 0x01, 0xf9, 
-0x88, 0x01, 0x96, 0x08, 0xba, 0x0b, 0xcb, 0x0d, 0xc8, 0x0d, 0x3b, 0x0b, 0x01, 0x07, 0xe6, 0x02, 
-0xc5, 0x00, 0x05, 0x00, 0x45, 0x01, 0x4f, 0x04, 0xd1, 0x06, 0x73, 0x0a, 0x10, 0x0d, 0xe1, 0x0b, 
-0x97, 0x07, 0xa9, 0x03, 0x60, 0x00, 0xe4, 0xfc, 0x0a, 0xfa, 0x0e, 0xf9, 0x00, 0xf6, 0xbe, 0xf2, 
-0x37, 0xf2, 0xc7, 0xee, 0xfa, 0xe9, 0xd6, 0xe3, 0x94, 0xe0, 0x32, 0xe8, 0x68, 0xf9, 0xcc, 0x07, 
-0x8f, 0x11, 0x7e, 0x18, 0x58, 0x17, 0x57, 0x10, 0x0f, 0x06, 0x15, 0xfa, 0x5b, 0xf3, 0xf4, 0xf3, 
-0xa0, 0xf5, 0x62, 0xf9, 0xcf, 0x02, 0x14, 0x0b, 0xf1, 0x0d, 0x13, 0x0f, 0xe4, 0x0d, 0xe8, 0x09, 
-0x38, 0x04, 0x33, 0xff, 0x4b, 0xfd, 0x5b, 0xfe, 0xa7, 0x00, 0xeb, 0x03, 0x74, 0x07, 0x7f, 0x0c, 
-0x86, 0x0f, 0x41, 0x0c, 0x65, 0x07, 0xe2, 0x03, 0x69, 0xff, 0x4b, 0xfb, 0x14, 0xfb, 0xfd, 0xfb, 
-0x83, 0xfc, 0x6d, 0xf9, 0x94, 0xf5, 0xad, 0xf3, 0xe0, 0xee, 0xaa, 0xe7, 0x9f, 0xe2, 0x0f, 0xe4, 
-0x79, 0xec, 0xd7, 0xfa, 0x3e, 0x09, 0x5c, 0x14, 0x14, 0x19, 0x94, 0x14, 0xf6, 0x0c, 0x48, 0x02, 
-0x6a, 0xf6, 0xd9, 0xf0, 0x5f, 0xf1, 0xf3, 0xf5, 0x65, 0xfd, 0xf7, 0x04, 0x74, 0x0b, 0xd9, 0x10, 
-0x36, 0x10, 0x08, 0x0b, 0x5d, 0x06, 0x29, 0x02, 0x3d, 0xfe, 0xfa, 0xfb, 0x15, 0xfc, 0x51, 0x01, 
-0xe7, 0x06, 0xad, 0x0b, 0x85, 0x10, 0xdb, 0x0f, 0x04, 0x0e, 0x39, 0x08, 0xbd, 0xfe, 0x8e, 0xfb, 
-0xf0, 0xfc, 0x4b, 0xfb, 0x2c, 0xfb, 0x5e, 0xfc, 0xcd, 0xf8, 0xa9, 0xf5, 0x47, 0xf2, 0xdc, 0xeb, 
-0x11, 0xea, 0x99, 0xe6, 0x1c, 0xe4, 0xef, 0xed, 0xaa, 0xff, 0x54, 0x0e, 0xdf, 0x13, 0x37, 0x14, 
-0x80, 0x12, 0xef, 0x0b, 0xb1, 0xfc, 0xdf, 0xf1, 0xa9, 0xf1, 0x1e, 0xf3, 0x0f, 0xf7, 0xb6, 0xfe, 
-0x12, 0x08, 0xcb, 0x0f, 0x0e, 0x10, 0xd5, 0x0c, 0x37, 0x0b, 0x5d, 0x06, 0xed, 0xff, 0x22, 0xfb, 
-0x20, 0xfa, 0x69, 0xfe, 0xc5, 0x04, 0x0e, 0x09, 0x28, 0x0f, 0x8e, 0x13, 0x1a, 0x0f, 0xeb, 0x0b, 
-0x10, 0x06, 0xfc, 0xfc, 0xf4, 0xf9, 0x4f, 0xfb, 0x9f, 0xfc, 0x9b, 0xfd, 0x34, 0xfc, 0x40, 0xf8, 
-0x2c, 0xf6, 0xc7, 0xf0, 0xc6, 0xea, 0xaf, 0xea, 0x8e, 0xe5, 0x81, 0xe2, 0x85, 0xee, 0x1a, 0x01, 
-0xd9, 0x0f, 0xe5, 0x14, 0xfd, 0x13, 0x1f, 0x11, 0xb4, 0x09, 0x90, 0xfa, 0x84, 0xf1, 0xe7, 0xf3, 
-0xa7, 0xf4, 0x92, 0xf7, 0xf8, 0x00, 0xa4, 0x0b, 0xdf, 0x12, 0x74, 0x11, 0xcd, 0x0b, 0x7d, 0x08, 
-0xdb, 0x03, 0xf3, 0xfc, 0xd6, 0xf6, 0xe6, 0xf9, 0x12, 0x03, 0xda, 0x07, 0xef, 0x09, 0x16, 0x12, 
-0x13, 0x16, 0x4d, 0x0c, 0xc4, 0x04, 0x5e, 0x01, 0x15, 0xfc, 0x5c, 0xf9, 0x05, 0xfb, 0xf3, 0xfe, 
-0xd1, 0xff, 0x4e, 0xfc, 0x63, 0xf8, 0xb0, 0xf5, 0x41, 0xf0, 0xf1, 0xea, 0x42, 0xe6, 0x17, 0xe0, 
-0x93, 0xe5, 0x48, 0xf2, 0x90, 0x00, 0x3e, 0x11, 0xdc, 0x18, 0xb8, 0x16, 0x7e, 0x10, 0xad, 0x05, 
-0x71, 0xfa, 0x73, 0xf2, 0xb7, 0xee, 0xc2, 0xf3, 0x5f, 0xfd, 0xb3, 0x03, 0xd1, 0x0b, 0x0b, 0x13, 
-0x55, 0x11, 0x4c, 0x0c, 0x0e, 0x06, 0xc6, 0xff, 0x81, 0xfb, 0x0d, 0xf9, 0xc9, 0xfc, 0x6d, 0x03, 
-0xbf, 0x07, 0x76, 0x0e, 0x24, 0x13, 0x87, 0x0f, 0x99, 0x0a, 0xc8, 0x06, 0x2c, 0xff, 0xb3, 0xfa, 
-0x20, 0xfc, 0x8d, 0xfe, 0xa3, 0x00, 0x75, 0xff, 0x94, 0xfd, 0x8a, 0xf9, 0xe6, 0xf2, 0xe8, 0xed, 
-0x87, 0xea, 0x90, 0xe4, 0x8f, 0xe1, 0xa0, 0xe6, 0x31, 0xf1, 0xf8, 0x03, 0xdc, 0x11, 0x8f, 0x14, 
-0xc8, 0x15, 0x8a, 0x10, 0x91, 0x03, 0x33, 0xf7, 0x5b, 0xf1, 0xc3, 0xf1, 0x96, 0xf4, 0x79, 0xfb, 
-0x14, 0x05, 0xc5, 0x0c, 0x93, 0x0f, 0x84, 0x0e, 0x01, 0x0b, 0x7e, 0x03, 0x15, 0xff, 0x88, 0xfe, 
-0xb5, 0xfc, 0x53, 0xfe, 0x67, 0x03, 0x22, 0x09, 0xcb, 0x0f, 0xa7, 0x12, 0xd9, 0x0f, 0x10, 0x0b, 
-0x52, 0x07, 0x66, 0x01, 0x56, 0xfa, 0x6a, 0xfc, 0x5b, 0x01, 0x3b, 0x00, 0x8a, 0xff, 0xec, 0xff, 
-0x08, 0xfc, 0x69, 0xf5, 0x7c, 0xee, 0x94, 0xeb, 0x2d, 0xe6, 0x1e, 0xdf, 0xf6, 0xe5, 0x8c, 0xf4, 
-0x67, 0x02, 0x10, 0x0e, 0x42, 0x15, 0x78, 0x17, 0xe6, 0x10, 0x82, 0x02, 0x93, 0xf7, 0xec, 0xf3, 
-0xff, 0xf1, 0x31, 0xf3, 0xe8, 0xfa, 0xe3, 0x03, 0xba, 0x0a, 0xd4, 0x0d, 0x8d, 0x0d, 0x80, 0x0c, 
-0xb6, 0x07, 0x71, 0x00, 0xee, 0xfc, 0x3f, 0xfd, 0x00, 0xfe, 0x17, 0x00, 0x3c, 0x08, 0x65, 0x10, 
-0xd7, 0x10, 0x8d, 0x0e, 0xf0, 0x0c, 0x55, 0x07, 0x52, 0xfe, 0x39, 0xfb, 0x63, 0xfc, 0x06, 0xfe, 
-0xe3, 0xff, 0x92, 0x02, 0x93, 0x01, 0xf0, 0xf9, 0x8b, 0xf3, 0x3e, 0xec, 0x49, 0xe5, 0xcb, 0xde, 
-0x4d, 0xdc, 0x33, 0xe7, 0x53, 0xf8, 0x4e, 0x09, 0xa0, 0x13, 0xcf, 0x19, 0x6a, 0x19, 0xf6, 0x0c, 
-0x2f, 0xff, 0x7b, 0xf5, 0x3c, 0xf0, 0x9c, 0xee, 0x12, 0xf3, 0xf6, 0xfc, 0x0b, 0x06, 0x6f, 0x0c, 
-0xc7, 0x10, 0x46, 0x11, 0x24, 0x0d, 0xc4, 0x06, 0xef, 0x00, 0x0f, 0xfc, 0x1d, 0xfb, 0x2d, 0xfd, 
-0x6f, 0x02, 0xd9, 0x09, 0xcd, 0x0e, 0x58, 0x10, 0xd1, 0x0f, 0x81, 0x0e, 0xdb, 0x05, 0x94, 0xfe, 
-0x82, 0xfc, 0x60, 0xf9, 0xf5, 0xf9, 0x9d, 0xfc, 0xc3, 0xfe, 0x78, 0xfd, 0x32, 0xf9, 0xfd, 0xf4, 
-0x7f, 0xee, 0x31, 0xe7, 0x93, 0xdf, 0xec, 0xe2, 0xbc, 0xee, 0x9d, 0xfa, 0x7f, 0x0b, 0x8e, 0x14, 
-0x69, 0x18, 0x55, 0x17, 0x4e, 0x0b, 0x00, 0x02, 0x8c, 0xf8, 0xd2, 0xf0, 0x12, 0xf2, 0x28, 0xf4, 
-0x10, 0xfc, 0xda, 0x04, 0x40, 0x09, 0xa3, 0x0f, 0xe5, 0x0f, 0x3b, 0x0c, 0xfd, 0x07, 0x42, 0x01, 
-0x93, 0xfe, 0x0f, 0xfe, 0x73, 0xfe, 0xa1, 0x03, 0x5c, 0x08, 0xe6, 0x0b, 0xc3, 0x0d, 0x7e, 0x0d, 
-0x54, 0x0b, 0x05, 0x04, 0x85, 0xfe, 0x98, 0xfc, 0xae, 0xf9, 0xc5, 0xfa, 0xb5, 0xfc, 0x0e, 0xfd, 
-0x1b, 0xfb, 0xb5, 0xf5, 0xd1, 0xef, 0xcc, 0xe8, 0x11, 0xe2, 0xce, 0xe0, 0x7b, 0xe9, 0xb8, 0xf6, 
-0x94, 0x05, 0xec, 0x0f, 0xff, 0x16, 0x04, 0x19, 0x0e, 0x10, 0xcf, 0x05, 0xe5, 0xfb, 0xb0, 0xf4, 
-0x0c, 0xf2, 0x1b, 0xf3, 0x2e, 0xf9, 0x33, 0x01, 0x4a, 0x07, 0x66, 0x0c, 0x1e, 0x0f, 0x6e, 0x0d, 
-0x8d, 0x09, 0x9a, 0x05, 0x6c, 0x01, 0x17, 0xfd, 0xad, 0xfd, 0xf8, 0x00, 0xc1, 0x06, 0xe9, 0x09, 
-0x2f, 0x0a, 0xaf, 0x0f, 0x77, 0x0e, 0x7d, 0x06, 0xf5, 0x03, 0xd2, 0x00, 0x4b, 0xfa, 0x6a, 0xf7, 
-0x32, 0xf9, 0x85, 0xf9, 0xf2, 0xf5, 0x9e, 0xf2, 0x9b, 0xef, 0x40, 0xeb, 0x7d, 0xe4, 0x65, 0xe5, 
-0x0a, 0xed, 0xd1, 0xf8, 0xd9, 0x07, 0x11, 0x0f, 0x1b, 0x15, 0xb0, 0x16, 0x2f, 0x0f, 0x34, 0x07, 
-0xd0, 0xfd, 0x07, 0xf8, 0x27, 0xf5, 0x13, 0xf3, 0xc4, 0xf7, 0x9a, 0xfc, 0xd9, 0x01, 0xc5, 0x07, 
-0x4d, 0x0b, 0xbb, 0x0e, 0x93, 0x0d, 0xbc, 0x09, 0x1f, 0x07, 0x36, 0x03, 0x65, 0x00, 0xda, 0xfe, 
-0x2a, 0x01, 0x20, 0x05, 0x56, 0x06, 0xaa, 0x0a, 0x63, 0x0d, 0x3b, 0x0b, 0x4d, 0x08, 0x83, 0x03, 
-0x1e, 0xff, 0x52, 0xfa, 0xa6, 0xf6, 0xb5, 0xf4, 0xa3, 0xf1, 0x88, 0xed, 0xbe, 0xea, 0xd6, 0xe6, 
-0x87, 0xe3, 0x8a, 0xe9, 0xa3, 0xf1, 0xeb, 0xff, 0x84, 0x0b, 0x95, 0x0e, 0x00, 0x15, 0xd3, 0x12, 
-0x7d, 0x0b, 0x42, 0x07, 0x63, 0xff, 0x90, 0xfb, 0xd4, 0xf7, 0x69, 0xf5, 0xc4, 0xfa, 0x00, 0xfc, 
-0x8c, 0x00, 0xe8, 0x06, 0x5d, 0x09, 0x97, 0x0d, 0x79, 0x0d, 0x82, 0x0b, 0x7d, 0x0a, 0xb9, 0x05, 
-0xbe, 0x02, 0x97, 0x01, 0x08, 0x00, 0xe8, 0x01, 0xcd, 0x05, 0xf6, 0x08, 0x1d, 0x09, 0x38, 0x09, 
-0x6d, 0x08, 0x26, 0x03, 0xa2, 0xfe, 0xfc, 0xfa, 0xe8, 0xf4, 0x8c, 0xf0, 0xa4, 0xec, 0x2b, 0xe8, 
-0xda, 0xe5, 0xf6, 0xe2, 0x95, 0xe6, 0xc3, 0xf0, 0xa4, 0xfc, 0x61, 0x08, 0x31, 0x0e, 0x4b, 0x13, 
-0xbf, 0x15, 0x18, 0x10, 0xac, 0x09, 0x30, 0x04, 0x97, 0xfe, 0x3d, 0xf9, 0xf5, 0xf5, 0x58, 0xf8, 
-0xa2, 0xf9, 0x6b, 0xfa, 0x4c, 0x00, 0x6a, 0x05, 0x76, 0x08, 0x15, 0x0b, 0x29, 0x0c, 0xa5, 0x0c, 
-0xb5, 0x09, 0xfb, 0x05, 0xec, 0x04, 0x53, 0x01, 0x9d, 0xff, 0xf1, 0x00, 0x42, 0x02, 0xdf, 0x04, 
-0x7c, 0x05, 0xef, 0x06, 0x63, 0x07, 0x1c, 0x02, 0xd7, 0xfd, 0x61, 0xf8, 0x5b, 0xf2, 0x56, 0xec, 
-0x2e, 0xe6, 0xf5, 0xe1, 0xc6, 0xe1, 0xe0, 0xe7, 0xbe, 0xf1, 0xc6, 0xfe, 0xc0, 0x08, 0x3d, 0x11, 
-0x42, 0x17, 0x64, 0x17, 0xd1, 0x13, 0x8a, 0x0d, 0x33, 0x07, 0x98, 0x00, 0xd6, 0xf9, 0x38, 0xf7, 
-0xd7, 0xf6, 0x53, 0xf6, 0x25, 0xf9, 0xa0, 0xfe, 0x3b, 0x03, 0xb8, 0x06, 0x11, 0x0b, 0x46, 0x0e, 
-0x1c, 0x0f, 0x50, 0x0d, 0xba, 0x0a, 0xc6, 0x08, 0xe8, 0x04, 0x4c, 0x01, 0xaf, 0xff, 0x9c, 0xfe, 
-0x2a, 0xff, 0xe0, 0xff, 0x6f, 0x00, 0xbe, 0x00, 0x8e, 0xfe, 0xf5, 0xfb, 0x0c, 0xf8, 0x1a, 0xf2, 
-0x97, 0xec, 0x78, 0xe7, 0x3b, 0xe6, 0x07, 0xe8, 0x7d, 0xed, 0x87, 0xf6, 0xa8, 0xff, 0x09, 0x07, 
-0x95, 0x0d, 0x61, 0x12, 0x3c, 0x13, 0x23, 0x12, 0x36, 0x0f, 0x51, 0x0b, 0x70, 0x05, 0xb5, 0x00, 
-0x4d, 0xfd, 0x48, 0xfa, 0x29, 0xf9, 0xc1, 0xf9, 0x9c, 0xfb, 0x8a, 0xfe, 0x22, 0x01, 0x87, 0x04, 
-0x51, 0x07, 0x0a, 0x09, 0x41, 0x0a, 0x26, 0x09, 0xa5, 0x08, 0x3f, 0x06, 0x87, 0x02, 0x4c, 0x01, 
-0xf9, 0xfe, 0x90, 0xfd, 0x3d, 0xfd, 0x70, 0xfb, 0x15, 0xfc, 0x9c, 0xfb, 0xd1, 0xf9, 0x19, 0xf8, 
-0xaf, 0xf7, 0xce, 0xf5, 0x76, 0xf5, 0x72, 0xf5, 0x12, 0xf6, 0xf1, 0xf9, 0x79, 0xfb, 0x93, 0xfd, 
-0x20, 0x00, 0xfd, 0x01, 0xbb, 0x03, 0xd9, 0x03, 0xf3, 0x04, 0xe8, 0x05, 0x8f, 0x04, 0xfb, 0x03, 
-0x16, 0x03, 0x09, 0x03, 0xe0, 0x01, 0x51, 0x01, 0x87, 0x01, 0xf5, 0x01, 0x2e, 0x02, 0x15, 0x02, 
-0xe2, 0x02, 0x33, 0x03, 0x4a, 0x03, 0xce, 0x02, 0x27, 0x02, 0x1e, 0x02, 0xa2, 0x01, 0xa6, 0x00, 
-0xf7, 0x00, 0x0f, 0x01, 0xcf, 0x00, 0xf0, 0x00, 0xe8, 0x00, 0xa0, 0x00, 0xfe, 0xff, 0x08, 0xff, 
-0x55, 0xfe, 0xaf, 0xfd, 0x77, 0xfc, 0xb9, 0xfb, 0x6d, 0xfb, 0xd7, 0xfa, 0x58, 0xfb, 0x79, 0xfb, 
-0xd6, 0xfb, 0xf7, 0xfc, 0x66, 0xfd, 0x49, 0xfe, 0x85, 0xfe, 0xf0, 0xfe, 0x17, 0xff, 0x57, 0xff, 
-0x8f, 0xff, 0x49, 0xff, 0xa1, 0xff, 0xfa, 0xff, 0x6f, 0x00, 0xf9, 0x00, 0x0e, 0x02, 0xf7, 0x02, 
-0x27, 0x03, 0xcc, 0x03, 0x6e, 0x04, 0x72, 0x04, 0xab, 0x03, 0x5d, 0x03, 0x42, 0x03, 0x8a, 0x02, 
-0x30, 0x02, 0x90, 0x01, 0x59, 0x01, 0xf7, 0x00, 0x20, 0x00, 0x51, 0x00, 0x1d, 0x00, 0xdf, 0xff, 
-0xd3, 0xff, 0x42, 0xff, 0xda, 0xfe, 0x5d, 0xfe, 0xa1, 0xfd, 0x46, 0xfd, 0x16, 0xfd, 0xc5, 0xfc, 
-0xff, 0xfc, 0x66, 0xfd, 0x1f, 0xfe, 0xb6, 0xfe, 0xf6, 0xfe, 0x8c, 0xff, 0xee, 0xff, 0xbb, 0xff, 
-0xa4, 0xff, 0x8a, 0xff, 0x08, 0xff, 0xda, 0xfe, 0xdc, 0xfe, 0x29, 0xff, 0xd2, 0xff, 0x5c, 0x00, 
-0x58, 0x01, 0x0b, 0x02, 0x71, 0x02, 0x07, 0x03, 0x3b, 0x03, 0x09, 0x03, 0x9b, 0x02, 0x3e, 0x02, 
-0x99, 0x01, 0x14, 0x01, 0xac, 0x00, 0x5d, 0x00, 0x7d, 0x00, 0x59, 0x00, 0xa9, 0x00, 0xa5, 0x00, 
-0x92, 0x00, 0xab, 0x00, 0x1f, 0x00, 0xb5, 0xff, 0x4a, 0xff, 0xa7, 0xfe, 0x08, 0xfe, 0x0c, 0xfe, 
-0x11, 0xfe, 0x1a, 0xfe, 0x82, 0xfe, 0xff, 0xfe, 0xb9, 0xff, 0xec, 0xff, 0x5c, 0x00, 0xe8, 0x00, 
-0x70, 0x00, 0xd4, 0x00, 0x21, 0x00, 0x58, 0x00, 0x22, 0xff, 0x25, 0x01, 0x66, 0x01, 0xf7, 0xfd, 
-0xca, 0xff, 0x9c, 0xfe, 0x6b, 0xff, 0x10, 0xff, 0x38, 0xff, 0x8b, 0x00, 0x3e, 0xff, 0x74, 0xff, 
-0xfc, 0xfe, 0x05, 0xff, 0x8c, 0xff, 0x7b, 0xff, 0x87, 0xff, 0x97, 0xff, 0x10, 0x00, 0xd7, 0x00, 
-0x22, 0x01, 0x2f, 0x01, 0x8c, 0x01, 0xe7, 0x00, 0x49, 0x00, 0xe0, 0xff, 0x15, 0xff, 0x71, 0xfe, 
-0xe1, 0xfe, 0x96, 0xfe, 0xb5, 0xfe, 0xdc, 0xfe, 0x33, 0xff, 0xcf, 0xff, 0xa6, 0x00, 0xd2, 0x00, 
-0x2a, 0x01, 0xf3, 0x00, 0xeb, 0x00, 0xd1, 0x04, 0x7f, 0x00, 0x82, 0xff, 0xa4, 0x01, 0x23, 0x00, 
-0x37, 0xfe, 0x09, 0xfe, 0x9a, 0xff, 0xad, 0xff, 0xba, 0xfe, 0x45, 0xfe, 0x5e, 0xff, 0x12, 0x00, 
-0x8f, 0xff, 0xf9, 0xfe, 0x26, 0x00, 0x9e, 0x00, 0x98, 0xff, 0x50, 0xff, 0x84, 0xff, 0x13, 0xff, 
-0x03, 0xff, 0x92, 0xfe, 0x62, 0xfe, 0xc7, 0xfe, 0x73, 0xfe, 0x24, 0xff, 0xf2, 0xfe, 0x65, 0xfe, 
-0x83, 0xff, 0xfe, 0xfe, 0x66, 0xff, 0x1c, 0xff, 0xf7, 0xff, 0x0f, 0x00, 0x58, 0x00, 0xcd, 0x00, 
-0x4f, 0x01, 0x98, 0x01, 0xc9, 0x00, 0xcc, 0x01, 0x61, 0x01, 0xf6, 0x00, 0x55, 0x00, 0xd8, 0xff, 
-0xc0, 0x00, 0x43, 0xff, 0x82, 0xfe, 0x1e, 0x00, 0x9d, 0xff, 0x1e, 0xff, 0xf1, 0xfe, 0x2f, 0xff, 
-0xe1, 0xff, 0x7a, 0xff, 0xe7, 0xfe, 0x8b, 0xfe, 0x7a, 0xff, 0x04, 0x00, 0xcb, 0xfe, 0x3a, 0xfe, 
-0x4c, 0xff, 0x51, 0x00, 0x34, 0xff, 0x47, 0xff, 0xb2, 0x00, 0x14, 0x00, 0xe9, 0x00, 0x15, 0x01, 
-0x1c, 0x00, 0x9b, 0x00, 0xdb, 0x00, 0xde, 0x00, 0x88, 0xff, 0xce, 0x01, 0x19, 0x01, 0x8d, 0xff, 
-0x4d, 0x01, 0x16, 0x03, 0x8e, 0x01, 0x9d, 0xff, 0x04, 0x02, 0xce, 0x02, 0xf7, 0x00, 0x41, 0xff, 
-0x44, 0x00, 0x45, 0x01, 0x67, 0x00, 0xa5, 0xfd, 0xbe, 0xfe, 0xcf, 0x00, 0x3f, 0x00, 0x59, 0xfd, 
-0xa3, 0xfd, 0x1b, 0x01, 0x1f, 0x00, 0x39, 0xfd, 0x14, 0xfe, 0xac, 0x00, 0x98, 0xff, 0x9f, 0xfc, 
-0x87, 0xfd, 0x4f, 0x00, 0xd3, 0xff, 0xae, 0xfc, 0xee, 0xfd, 0xbe, 0x01, 0x77, 0x00, 0xa3, 0xfd, 
-0x75, 0x00, 0x16, 0x03, 0xb6, 0x00, 0x23, 0xfe, 0x06, 0x01, 0x32, 0x03, 0x7a, 0x00, 0x34, 0xff, 
-0xb1, 0x00, 0x53, 0x02, 0x85, 0x00, 0x70, 0xff, 0xa8, 0x00, 0xf8, 0x01, 0xa9, 0x00, 0xa1, 0xff, 
-0xfb, 0x00, 0xae, 0x01, 0x82, 0x00, 0xc5, 0xff, 0x7d, 0x00, 0xde, 0x00, 0x9c, 0x00, 0x0a, 0x00, 
-0xfd, 0xff, 0x75, 0x00, 0x76, 0x00, 0x49, 0x00, 0x41, 0x00, 0x5b, 0x00, 0x44, 0x00, 0x2f, 0x00, 
-0x16, 0x00, 0xc9, 0xff, 0xbc, 0xff, 0xdc, 0xff, 0x8a, 0xff, 0xbc, 0xff, 0x23, 0x00, 0x28, 0x00, 
-0x06, 0x00, 0x31, 0x00, 0xad, 0x00, 0x59, 0x00, 0x43, 0x00, 0x43, 0x00, 0x47, 0x00, 0x5c, 0x00, 
-0x2e, 0x00, 0xe0, 0xff, 0xe3, 0xff, 0x71, 0x00, 0xdf, 0x00, 0x88, 0x00, 0x85, 0x00, 0xca, 0x00, 
-0x29, 0x01, 0xeb, 0x00, 0x82, 0x00, 0x9d, 0x00, 0x85, 0x00, 0x6a, 0x00, 0x05, 0x00, 0xe3, 0xff, 
-0xc1, 0xff, 0x94, 0xff, 0x88, 0xff, 0x5f, 0xff, 0x63, 0xff, 0x84, 0xff, 0x6c, 0xff, 0x7a, 0xff, 
-0x8c, 0xff, 0x65, 0xff, 0x43, 0xff, 0x56, 0xff, 0x3b, 0xff, 0x2e, 0xff, 0x2a, 0xff, 0x31, 0xff, 
-0x5a, 0xff, 0x74, 0xff, 0x90, 0xff, 0xc1, 0xff, 0xd5, 0xff, 0xc5, 0xff, 0xaf, 0xff, 0xf9, 0xff, 
-0xeb, 0xff, 0xa3, 0xff, 0xcf, 0xff, 0xef, 0xff, 0x17, 0x00, 0x0b, 0x00, 0x2b, 0x00, 0x59, 0x00, 
-0x71, 0x00, 0x88, 0x00, 0x79, 0x00, 0x83, 0x00, 0x76, 0x00, 0x69, 0x00, 0x55, 0x00, 0x34, 0x00, 
-0x3d, 0x00, 0x0c, 0x00, 0xfd, 0xff, 0xf9, 0xff, 0x09, 0x00, 0xfc, 0xff, 0xf9, 0xff, 0xfa, 0xff, 
-0x0a, 0x00, 0xf4, 0xff, 0xd8, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xc1, 0xff, 0xa9, 0xff, 0xd2, 0xff, 
-0xd5, 0xff, 0xd5, 0xff, 0xce, 0xff, 0xfe, 0xff, 0x12, 0x00, 0x02, 0x00, 0x10, 0x00, 0x34, 0x00, 
-0x38, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x2f, 0x00, 0x16, 0x00, 0x23, 0x00, 0x3e, 0x00, 0x33, 0x00, 
-0x2d, 0x00, 0x51, 0x00, 0x54, 0x00, 0x6e, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x5b, 0x00, 
-0x3b, 0x00, 0x46, 0x00, 0x50, 0x00, 0x1b, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x13, 0x00, 0xfa, 0xff, 
-0xf0, 0xff, 0xf4, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe9, 0xff, 0xfa, 0xff, 0xde, 0xff, 0xbe, 0xff, 
-0xcd, 0xff, 0xd2, 0xff, 0xcf, 0xff, 0xcb, 0xff, 0xd4, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0x03, 0x00, 
-0xfa, 0xff, 0xf0, 0xff, 0x1b, 0x00, 0x26, 0x00, 0x06, 0x00, 0xf1, 0xff, 0x0e, 0x00, 0x1f, 0x00, 
-0x17, 0x00, 0x18, 0x00, 0x17, 0x00, 0x31, 0x00, 0x23, 0x00, 0x33, 0x00, 0x3d, 0x00, 0x31, 0x00, 
-0x1b, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x08, 0x00, 0xe2, 0xff, 0xd8, 0xff, 0xe3, 0xff, 0xed, 0xff, 
-0xcb, 0xff, 0xca, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xd6, 0xff, 0xd4, 0xff, 0xe6, 0xff, 0xde, 0xff, 
-0xca, 0xff, 0xd0, 0xff, 0xde, 0xff, 0xe7, 0xff, 0xd5, 0xff, 0xd4, 0xff, 0xe1, 0xff, 0xea, 0xff, 
-0xf8, 0xff, 0xfa, 0xff, 0x04, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x1c, 0x00, 0x13, 0x00, 0x13, 0x00, 
-0x1d, 0x00, 0x26, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x19, 0x00, 0x06, 0x00, 
-0x14, 0x00, 0x1d, 0x00, 0x0b, 0x00, 0xf5, 0xff, 0xf5, 0xff, 0x01, 0x00, 0xdf, 0xff, 0xc9, 0xff, 
-0xd5, 0xff, 0xdf, 0xff, 0xd5, 0xff, 0xc2, 0xff, 0xcf, 0xff, 0xdc, 0xff, 0xdb, 0xff, 0xe0, 0xff, 
-0xe3, 0xff, 0xe8, 0xff, 0xda, 0xff, 0xe9, 0xff, 0xf5, 0xff, 0xed, 0xff, 0xe6, 0xff, 0xe9, 0xff, 
-0x06, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x26, 0x00, 0x1e, 0x00, 0x16, 0x00, 
-0x20, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x22, 0x00, 0x14, 0x00, 0x16, 0x00, 0x1d, 0x00, 0x1b, 0x00, 
-0x08, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x07, 0x00, 0xfd, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xe5, 0xff, 
-0xd9, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xca, 0xff, 0xbd, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xca, 0xff, 
-0xc9, 0xff, 0xdd, 0xff, 0xe0, 0xff, 0xdd, 0xff, 0xdd, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xe6, 0xff, 
-0xec, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 0x1d, 0x00, 
-0x25, 0x00, 0x28, 0x00, 0x22, 0x00, 0x26, 0x00, 0x26, 0x00, 0x22, 0x00, 0x19, 0x00, 0x16, 0x00, 
-0x16, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x00, 0x08, 0x00, 0xff, 0xff, 0xf3, 0xff, 0xec, 0xff, 
-0xe9, 0xff, 0xde, 0xff, 0xd4, 0xff, 0xd1, 0xff, 0xce, 0xff, 0xc7, 0xff, 0xc4, 0xff, 0xcb, 0xff, 
-0xca, 0xff, 0xcf, 0xff, 0xd3, 0xff, 0xd7, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xdb, 0xff, 0xdf, 0xff, 
-0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xea, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf8, 0xff, 0xff, 0xff, 
-0x06, 0x00, 0x09, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x10, 0x00, 
-0x0c, 0x00, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0xfd, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 
-0xde, 0xff, 0xdc, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xe5, 0xff, 0xe7, 0xff, 0xea, 0xff, 
-0xee, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0x03, 0x00, 
-0x05, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x19, 0x00, 0x17, 0x00, 0x1a, 0x00, 0x1a, 0x00, 
-0x19, 0x00, 0x16, 0x00, 0x14, 0x00, 0x18, 0x00, 0x17, 0x00, 0x14, 0x00, 0x11, 0x00, 0x11, 0x00, 
-0x10, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0x00, 0xf8, 0xff, 0xf3, 0xff, 
-0xf0, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xe5, 0xff, 0xe4, 0xff, 
-0xe5, 0xff, 0xe6, 0xff, 0xe0, 0xff, 0xdf, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xe6, 0xff, 0xe6, 0xff, 
-0xe9, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x09, 0x00, 0x0b, 0x00, 
-0x07, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x1b, 0x00, 0x12, 0x00, 0x09, 0x00, 0x03, 0x00, 0x0a, 0x00, 
-0x0e, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x15, 0x00, 0x1a, 0x00, 0x19, 0x00, 0x17, 0x00, 0x12, 0x00, 
-0x0b, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf3, 0xff, 0xeb, 0xff, 
-0xf0, 0xff, 0xfe, 0xff, 0x09, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x01, 0x00, 0xf6, 0xff, 0xf5, 0xff, 
-0xfe, 0xff, 0x09, 0x00, 0x07, 0x00, 0xfb, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0x0c, 0x00, 0x12, 0x00, 
-0x10, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x12, 0x00, 
-0x0e, 0x00, 0x0b, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x12, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0e, 0x00, 
-0x0a, 0x00, 0x05, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x06, 0x00, 0xfd, 0xff, 
-0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x06, 0x00, 
-0xfe, 0xff, 0xfb, 0xff, 0x01, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf5, 0xff, 
-0xfe, 0xff, 0x22, 0x00, 0x29, 0x00, 0x1c, 0x00, 0x08, 0x00, 0xf1, 0xff, 0xf5, 0xff, 0xfb, 0xff, 
-0xf7, 0xff, 0x0a, 0x00, 0x20, 0x00, 0x19, 0x00, 0xfb, 0xff, 0xde, 0xff, 0xd0, 0xff, 0xec, 0xff, 
-0x07, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x26, 0x00, 0x0e, 0x00, 0xf2, 0xff, 0xe5, 0xff, 0xe4, 0xff, 
-0xf9, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0xed, 0xff, 0xf0, 0xff, 0x04, 0x00, 0xe4, 0xff, 0x04, 0x00, 
-0xf0, 0xff, 0x47, 0x00, 0xe0, 0x00, 0xca, 0x00, 0x68, 0x00, 0xb7, 0xff, 0x2a, 0xff, 0x2d, 0xff, 
-0xb7, 0xff, 0x31, 0x00, 0x62, 0x00, 0x55, 0x00, 0xe6, 0xff, 0x8e, 0xff, 0xa5, 0xff, 0xb4, 0xff, 
-0xeb, 0xff, 0x20, 0x00, 0x00, 0x00, 0xe1, 0xff, 0xd9, 0xff, 0xff, 0xff, 0x2c, 0x00, 0xfa, 0xff, 
-0x9d, 0x00, 0xdc, 0xff, 0x62, 0x03, 0x4d, 0x04, 0x10, 0xfd, 0x12, 0xfb, 0xfd, 0xff, 0xde, 0x03, 
-0x89, 0x02, 0xec, 0xff, 0x2b, 0xfd, 0xcc, 0xfc, 0x67, 0xff, 0xf2, 0x00, 0x31, 0x00, 0x59, 0xff, 
-0x6b, 0xff, 0x45, 0x00, 0x1f, 0x00, 0xe9, 0xff, 0x2d, 0x00, 0x57, 0x00, 0x76, 0x00, 0xd1, 0xff, 
-0x5d, 0xff, 0x67, 0xff, 0xec, 0xff, 0xd9, 0xff, 0x31, 0xff, 0x42, 0xff, 0x84, 0xff, 0xb8, 0xff, 
-0xec, 0xff, 0xd4, 0xff, 0xc8, 0xff, 0xb4, 0xff, 0xb7, 0xff, 0xb3, 0xff, 0xe3, 0xff, 0xe0, 0xff, 
-0xf8, 0xff, 0xad, 0xff, 0x89, 0xff, 0x0f, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0xf7, 0xff, 0xca, 0xff, 
-0xbb, 0xff, 0xfc, 0xff, 0x3a, 0x00, 0x15, 0x00, 0x33, 0x00, 0x0c, 0x00, 0xf4, 0xff, 0x60, 0x00, 
-0x3c, 0x00, 0x18, 0x00, 0xd3, 0xff, 0xa3, 0xff, 0x13, 0x00, 0xa1, 0xff, 0x20, 0xff, 0x60, 0x00, 
-0xd2, 0x00, 0xbf, 0xff, 0x68, 0xff, 0x1c, 0x00, 0xdf, 0x00, 0x50, 0x00, 0xac, 0xff, 0x03, 0x00, 
-0x88, 0x00, 0x09, 0x00, 0xa0, 0xff, 0xd9, 0xff, 0x10, 0x00, 0x69, 0x00, 0x24, 0x00, 0xb6, 0xff, 
-0x0e, 0x00, 0xf0, 0x00, 0x7a, 0x01, 0x9f, 0x00, 0xd0, 0xff, 0x56, 0x00, 0xfa, 0xff, 0x5f, 0x00, 
-0x4d, 0x01, 0x8d, 0x01, 0xf9, 0x01, 0x64, 0x01, 0x8a, 0x00, 0x41, 0x01, 0x83, 0x00, 0xf8, 0xfe, 
-0xab, 0xfe, 0x7e, 0xfe, 0xac, 0xfe, 0x8e, 0xfe, 0xf3, 0xff, 0x87, 0x02, 0x6e, 0x02, 0x94, 0xfe, 
-0xc5, 0xfc, 0x6d, 0xfe, 0xf7, 0xfe, 0xbe, 0xfd, 0x39, 0xfe, 0x2f, 0x00, 0xb3, 0x00, 0x0c, 0xff, 
-0xb3, 0xfd, 0x9b, 0xff, 0xce, 0x00, 0xc5, 0xfe, 0x50, 0xff, 0x4e, 0x01, 0x50, 0x01, 0x40, 0x00, 
-0x6e, 0xff, 0x03, 0x01, 0x45, 0x01, 0x85, 0x00, 0x5c, 0x00, 0x7e, 0xff, 0xd0, 0xfc, 0x21, 0xfc, 
-0x7a, 0xff, 0x64, 0x00, 0x53, 0xfd, 0x0f, 0xfc, 0x26, 0xfe, 0x66, 0x01, 0x58, 0x00, 0x4f, 0xfd, 
-0x25, 0x00, 0x15, 0x03, 0x70, 0x02, 0x52, 0xff, 0x1d, 0xff, 0x8a, 0x01, 0x8c, 0x00, 0x3a, 0xfe, 
-0x69, 0xfd, 0x81, 0xff, 0x75, 0xff, 0x77, 0xfd, 0x58, 0xff, 0x10, 0x01, 0xa7, 0x00, 0x3a, 0xff, 
-0x57, 0xff, 0xe5, 0x01, 0x43, 0x02, 0xb8, 0x00, 0x92, 0x00, 0x4f, 0x01, 0x1b, 0x01, 0x7f, 0xff, 
-0x4b, 0xff, 0x27, 0x01, 0x72, 0x01, 0x97, 0x00, 0x38, 0x00, 0xd1, 0x00, 0xfb, 0x01, 0x4d, 0x02, 
-0xee, 0x00, 0xac, 0x00, 0xb0, 0x00, 0x43, 0x00, 0xbe, 0x00, 0x74, 0xff, 0xa2, 0xff, 0x47, 0x01, 
-0xea, 0x00, 0xb9, 0xff, 0xa8, 0xff, 0x2c, 0x01, 0x42, 0x01, 0x77, 0x01, 0x2a, 0x02, 0xd6, 0x01, 
-0x2c, 0x00, 0x5b, 0xff, 0xe4, 0x00, 0x02, 0x01, 0x04, 0x00, 0x8f, 0xfe, 0x18, 0xff, 0xdd, 0x00, 
-0xa1, 0x00, 0x08, 0x00, 0x8e, 0xff, 0x7c, 0xff, 0xa6, 0x01, 0x74, 0x01, 0x04, 0xff, 0x55, 0xfe, 
-0x7f, 0xff, 0x18, 0x01, 0xf6, 0xfe, 0x67, 0xfd, 0xf2, 0xfe, 0x0c, 0x00, 0x9d, 0xff, 0x37, 0x00, 
-0x5a, 0x00, 0xb2, 0xff, 0x6a, 0x00, 0x4a, 0xff, 0x95, 0xff, 0xc4, 0x01, 0xad, 0x00, 0x0e, 0xff, 
-0x7d, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xe5, 0xfd, 0x46, 0xff, 0x6f, 0xff, 0x5c, 0x00, 0xba, 0xff, 
-0xf4, 0xfd, 0x7d, 0x00, 0x3d, 0x02, 0x28, 0x01, 0x49, 0x00, 0x2d, 0xff, 0xf5, 0xff, 0xe4, 0xff, 
-0x04, 0xff, 0x8c, 0xff, 0x08, 0xff, 0x35, 0xff, 0x8a, 0xff, 0x1b, 0xff, 0x15, 0x00, 0xb6, 0x00, 
-0x0e, 0x00, 0xef, 0x00, 0x06, 0x01, 0x0d, 0x00, 0xe4, 0xfe, 0xb3, 0xfe, 0xd9, 0xff, 0xe9, 0xfe, 
-0xd8, 0xfe, 0x6b, 0xff, 0xb8, 0xff, 0x3d, 0x01, 0x4e, 0x00, 0xed, 0xfe, 0x1c, 0x00, 0xcd, 0x01, 
-0xb9, 0x02, 0x22, 0x01, 0xcf, 0xff, 0x29, 0x00, 0x20, 0xff, 0x36, 0xff, 0xaf, 0xff, 0x5b, 0xff, 
-0x8a, 0x00, 0x06, 0x01, 0x2d, 0x01, 0x1c, 0x01, 0xc4, 0xff, 0x8d, 0x00, 0x98, 0x00, 0x53, 0xff, 
-0x97, 0xff, 0xd9, 0xff, 0x42, 0x01, 0x81, 0x01, 0x6b, 0x00, 0x1d, 0x00, 0x30, 0x00, 0x29, 0x01, 
-0xa4, 0xff, 0x76, 0xfe, 0x0e, 0xff, 0x24, 0xfe, 0x7a, 0xff, 0x7c, 0xff, 0x02, 0xff, 0xe7, 0x00, 
-0x90, 0x00, 0x7c, 0x00, 0xad, 0xff, 0xf2, 0xfe, 0xbd, 0xff, 0x48, 0xff, 0x01, 0x00, 0xf1, 0xff, 
-0x90, 0xff, 0xcf, 0x00, 0x6c, 0x00, 0x27, 0x00, 0x83, 0x00, 0x86, 0x00, 0xe2, 0x00, 0x42, 0x01, 
-0x7b, 0x01, 0x80, 0x01, 0x47, 0x01, 0xa5, 0x00, 0x72, 0x00, 0xac, 0xff, 0x56, 0xfe, 0x2f, 0xff, 
-0x07, 0x00, 0x76, 0xff, 0xd6, 0xff, 0x53, 0x00, 0xd1, 0x00, 0x3d, 0x00, 0xa7, 0xfe, 0x27, 0xff, 
-0xe7, 0xff, 0xd1, 0x00, 0xd5, 0x01, 0xed, 0x00, 0x8d, 0x00, 0xf9, 0xff, 0x7e, 0xff, 0x22, 0x00, 
-0xfe, 0xfd, 0x18, 0xfe, 0x90, 0xff, 0x81, 0xff, 0x05, 0x01, 0xf8, 0xfe, 0x55, 0xff, 0x90, 0x02, 
-0xa2, 0x01, 0xbf, 0x00, 0x7d, 0xfe, 0x29, 0xff, 0xa3, 0x03, 0xef, 0x01, 0x44, 0xfe, 0xf9, 0xfc, 
-0x90, 0xfe, 0xe4, 0x01, 0x1a, 0x01, 0x52, 0xff, 0x51, 0xff, 0xf9, 0xff, 0xa7, 0xff, 0xe7, 0xfd, 
-0x9a, 0xfe, 0xf2, 0x00, 0x2d, 0x01, 0xcf, 0xff, 0xbe, 0xfe, 0x3c, 0xfe, 0x6f, 0xff, 0x6a, 0x00, 
-0xab, 0xff, 0xfe, 0xff, 0xf8, 0x00, 0xa1, 0x01, 0x71, 0x00, 0xc3, 0xfe, 0x31, 0xff, 0x4c, 0xff, 
-0xaa, 0xfe, 0x20, 0xfe, 0xd6, 0xfe, 0x51, 0x02, 0xb0, 0x03, 0x13, 0x01, 0x18, 0xff, 0x93, 0xfe, 
-0x17, 0x00, 0xc3, 0x00, 0x72, 0xff, 0xeb, 0x00, 0x75, 0x02, 0x3a, 0x01, 0x04, 0xff, 0x55, 0xfc, 
-0xfc, 0xfd, 0x11, 0x02, 0x3b, 0x02, 0x4d, 0x02, 0x8d, 0x01, 0xbf, 0x00, 0xb1, 0xff, 0x27, 0xfd, 
-0x92, 0xff, 0xeb, 0x02, 0xa5, 0x03, 0x1d, 0x00, 0xfa, 0xfb, 0x65, 0xfe, 0x4c, 0x01, 0xf4, 0x00, 
-0x21, 0xfe, 0xfb, 0xfd, 0x54, 0x02, 0x46, 0x02, 0x33, 0xfd, 0x9f, 0xf9, 0xde, 0xfb, 0xee, 0x01, 
-0xbd, 0x03, 0xf7, 0x01, 0x1c, 0x00, 0x3d, 0xff, 0x9c, 0xff, 0xb0, 0xfc, 0x30, 0xfa, 0x5e, 0xfd, 
-0x6b, 0x02, 0xea, 0x05, 0xc1, 0x05, 0x31, 0x00, 0x01, 0xfd, 0xba, 0xfd, 0xc3, 0xfc, 0x10, 0xff, 
-0x37, 0x01, 0x7e, 0x03, 0x79, 0x06, 0x92, 0x03, 0x3c, 0x00, 0x3d, 0xfd, 0x8d, 0xfd, 0x7f, 0x00, 
-0x77, 0xff, 0xe1, 0xfe, 0xbd, 0xff, 0x61, 0x02, 0x41, 0x05, 0x29, 0x02, 0x36, 0xfd, 0xcf, 0xfa, 
-0xc2, 0xfb, 0xfc, 0xff, 0x5c, 0x00, 0x71, 0xfe, 0x55, 0xfd, 0x56, 0xfb, 0xb3, 0xfa, 0xc2, 0xf9, 
-0xa5, 0xf9, 0x01, 0xfd, 0x14, 0x00, 0xe5, 0x00, 0x7b, 0x00, 0xeb, 0xff, 0xf1, 0xff, 0x38, 0xfd, 
-0xda, 0xfc, 0x41, 0x01, 0x08, 0x06, 0x26, 0x0b, 0x9a, 0x07, 0x00, 0x00, 0xff, 0xfd, 0xe5, 0xff, 
-0x5f, 0x05, 0x90, 0x08, 0xb2, 0x08, 0x22, 0x07, 0xcd, 0x04, 0x19, 0x02, 0x7d, 0xfe, 0xc0, 0xfe, 
-0x9a, 0x02, 0x46, 0x06, 0xb1, 0x06, 0x3a, 0x02, 0xd4, 0xfc, 0xe9, 0xfa, 0x6f, 0xfc, 0xa1, 0xfd, 
-0x8b, 0xfc, 0x22, 0xfc, 0x99, 0xfc, 0xd3, 0xfc, 0xaf, 0xfa, 0xed, 0xf6, 0x6a, 0xf5, 0x0c, 0xf6, 
-0xd5, 0xf7, 0xe2, 0xf6, 0xf6, 0xf7, 0x13, 0xfc, 0x04, 0xff, 0x64, 0x01, 0x90, 0xfe, 0x77, 0xfd, 
-0x50, 0x01, 0xd5, 0x04, 0xbd, 0x08, 0x4e, 0x0a, 0x18, 0x0a, 0xc8, 0x08, 0xfb, 0x04, 0x9b, 0x03, 
-0x84, 0x05, 0x93, 0x07, 0xf6, 0x08, 0xaa, 0x05, 0x15, 0x03, 0x8b, 0x05, 0xce, 0x06, 0x9b, 0x05, 
-0x18, 0x02, 0x7a, 0xff, 0x06, 0x01, 0xbc, 0x02, 0xa6, 0xff, 0x98, 0xf9, 0xc4, 0xf6, 0x10, 0xfa, 
-0x6a, 0xff, 0xe7, 0xff, 0xc5, 0xfa, 0x7f, 0xf5, 0xd3, 0xf3, 0xf1, 0xf5, 0x20, 0xf8, 0xe6, 0xf4, 
-0xb3, 0xf0, 0x75, 0xef, 0x0a, 0xf1, 0x22, 0xf8, 0x6f, 0x00, 0xe3, 0x06, 0x3f, 0x0a, 0x23, 0x0b, 
-0xac, 0x0a, 0x72, 0x07, 0x2a, 0x03, 0xa2, 0x00, 0xf8, 0x02, 0x18, 0x08, 0xad, 0x0c, 0x12, 0x0b, 
-0xee, 0x05, 0xbe, 0x05, 0x3a, 0x06, 0xb4, 0x05, 0x71, 0x04, 0xce, 0x02, 0xca, 0x05, 0x3c, 0x08, 
-0x4e, 0x06, 0x9b, 0x02, 0x8d, 0xfe, 0xf2, 0xfd, 0x8b, 0xfc, 0x5e, 0xfa, 0x0f, 0xfb, 0x3a, 0xfc, 
-0xce, 0xfe, 0xb5, 0xfe, 0x7a, 0xfa, 0x71, 0xf6, 0xda, 0xf2, 0xde, 0xf0, 0xc3, 0xef, 0x0a, 0xed, 
-0xbb, 0xea, 0x0e, 0xf1, 0xa8, 0xfe, 0xc0, 0x08, 0xbe, 0x0a, 0x47, 0x05, 0x4a, 0x01, 0x93, 0x06, 
-0xbb, 0x0a, 0x70, 0x05, 0x2c, 0xff, 0xc8, 0xfd, 0x00, 0x04, 0x9f, 0x0a, 0x92, 0x08, 0x95, 0x03, 
-0xbd, 0x01, 0x7d, 0x06, 0x52, 0x0c, 0x93, 0x0a, 0xb9, 0x05, 0xa6, 0x02, 0x1a, 0x04, 0xc8, 0x08, 
-0x7e, 0x08, 0x69, 0x05, 0x5b, 0x03, 0xeb, 0x02, 0x0d, 0x03, 0xdb, 0xff, 0xcc, 0xfb, 0x5b, 0xfa, 
-0xe0, 0xfa, 0x06, 0xfb, 0x8c, 0xf8, 0xe9, 0xf5, 0x65, 0xf6, 0xf6, 0xf8, 0x99, 0xf8, 0xe8, 0xf1, 
-0x2f, 0xe9, 0x2c, 0xe7, 0x53, 0xee, 0x98, 0xf8, 0x43, 0x00, 0x4c, 0x05, 0x99, 0x0b, 0xb4, 0x0f, 
-0x72, 0x0d, 0x08, 0x05, 0x03, 0xfc, 0xb0, 0xfb, 0x6b, 0x00, 0xe8, 0x04, 0xeb, 0x07, 0xb4, 0x06, 
-0x9d, 0x06, 0xfb, 0x05, 0xfb, 0x02, 0xe9, 0x02, 0x11, 0x03, 0x73, 0x06, 0x69, 0x0a, 0x21, 0x0a, 
-0xf9, 0x08, 0xae, 0x06, 0xfc, 0x04, 0x2d, 0x04, 0x45, 0x02, 0xe6, 0x01, 0xa0, 0x02, 0xaf, 0x03, 
-0x23, 0x03, 0x39, 0xff, 0xc2, 0xfa, 0x80, 0xf7, 0xc2, 0xf6, 0x50, 0xf6, 0x76, 0xf6, 0x05, 0xf7, 
-0xac, 0xf3, 0x7e, 0xed, 0x40, 0xe7, 0x45, 0xe3, 0x61, 0xea, 0x4d, 0xfc, 0x23, 0x0d, 0xdf, 0x15, 
-0x2b, 0x12, 0x90, 0x06, 0x95, 0xff, 0x7d, 0xfd, 0xfd, 0xfe, 0x5a, 0x00, 0xf0, 0x00, 0x18, 0x04, 
-0x3f, 0x06, 0x11, 0x07, 0xbd, 0x05, 0x85, 0x03, 0x8c, 0x02, 0xfe, 0x03, 0x28, 0x06, 0xe3, 0x07, 
-0x2f, 0x09, 0xfe, 0x06, 0x46, 0x05, 0xaf, 0x05, 0x4c, 0x04, 0x58, 0x03, 0x9d, 0x02, 0x7d, 0x03, 
-0x40, 0x06, 0xd4, 0x04, 0x28, 0x01, 0x6f, 0xfd, 0xd0, 0xfb, 0x03, 0xfd, 0x8d, 0xfc, 0x5a, 0xf9, 
-0xfb, 0xf3, 0x3d, 0xf2, 0x77, 0xf0, 0x5d, 0xeb, 0x88, 0xe6, 0x86, 0xe2, 0x40, 0xeb, 0x39, 0xfd, 
-0x47, 0x0c, 0xef, 0x14, 0xcc, 0x11, 0xe0, 0x09, 0x34, 0x03, 0xf0, 0xfe, 0x11, 0xfe, 0xc7, 0xfe, 
-0x0f, 0x01, 0x32, 0x04, 0x7e, 0x06, 0x62, 0x07, 0x23, 0x05, 0x20, 0x02, 0x0a, 0x01, 0x19, 0x02, 
-0x45, 0x06, 0x66, 0x08, 0x47, 0x09, 0x89, 0x09, 0x2b, 0x07, 0x8b, 0x05, 0x2d, 0x05, 0xdc, 0x03, 
-0x46, 0x03, 0x3b, 0x03, 0x3c, 0x04, 0xc2, 0x05, 0xb9, 0x04, 0xe9, 0x01, 0x09, 0xfe, 0xdd, 0xfa, 
-0x3a, 0xf9, 0x95, 0xf6, 0xa5, 0xf4, 0xe4, 0xf1, 0x8f, 0xf0, 0xdf, 0xf0, 0x4c, 0xef, 0x52, 0xeb, 
-0x67, 0xe6, 0xcf, 0xeb, 0xaa, 0xf9, 0x0e, 0x0b, 0xb9, 0x17, 0x58, 0x15, 0x0d, 0x0b, 0x99, 0x00, 
-0x6b, 0xfb, 0x83, 0xfd, 0xed, 0xff, 0xaf, 0x01, 0xcf, 0x03, 0xc9, 0x06, 0xab, 0x08, 0xe6, 0x05, 
-0xe0, 0x01, 0x6a, 0xff, 0x07, 0x01, 0xde, 0x05, 0x77, 0x08, 0x9e, 0x09, 0xbf, 0x09, 0x27, 0x08, 
-0x8d, 0x05, 0xf9, 0x02, 0x26, 0x02, 0x0e, 0x03, 0x5c, 0x05, 0x10, 0x06, 0x11, 0x04, 0x37, 0x01, 
-0x0a, 0x00, 0x44, 0x00, 0x5a, 0xff, 0xe0, 0xfb, 0xa3, 0xf6, 0xfc, 0xf3, 0xdb, 0xf2, 0xa2, 0xf1, 
-0x8c, 0xf0, 0xf3, 0xec, 0x27, 0xe6, 0x40, 0xe3, 0x6d, 0xea, 0x6c, 0xfa, 0x10, 0x0e, 0x6e, 0x19, 
-0xcd, 0x16, 0x7c, 0x0b, 0xb0, 0x01, 0x6b, 0xfd, 0x22, 0xfe, 0x3a, 0xff, 0x2f, 0xfe, 0xc9, 0xfe, 
-0x0a, 0x03, 0x09, 0x09, 0x80, 0x0b, 0x53, 0x08, 0xf7, 0x02, 0xc7, 0xfe, 0xc5, 0xff, 0xf4, 0x03, 
-0x5c, 0x07, 0xc2, 0x08, 0x30, 0x08, 0x95, 0x06, 0x20, 0x04, 0x09, 0x03, 0x0e, 0x03, 0x23, 0x05, 
-0x18, 0x07, 0x88, 0x07, 0x2f, 0x04, 0xae, 0xfe, 0x48, 0xfa, 0x64, 0xf9, 0xef, 0xfb, 0xda, 0xfd, 
-0xe6, 0xfc, 0x00, 0xf9, 0xbc, 0xf2, 0x51, 0xef, 0x0a, 0xec, 0xdc, 0xe7, 0xd9, 0xe3, 0x45, 0xe2, 
-0x06, 0xee, 0x2c, 0x03, 0x4f, 0x18, 0x15, 0x22, 0xcb, 0x17, 0xc1, 0x05, 0x4d, 0xf9, 0x0d, 0xf6, 
-0x2d, 0xfc, 0xb6, 0xff, 0x79, 0x00, 0xab, 0x01, 0x9b, 0x04, 0xd0, 0x09, 0x0d, 0x0a, 0xb7, 0x06, 
-0xa2, 0x02, 0xc4, 0xff, 0x39, 0x02, 0xf6, 0x03, 0xc7, 0x05, 0x31, 0x07, 0xcf, 0x07, 0x20, 0x09, 
-0xf5, 0x06, 0x60, 0x05, 0x6d, 0x02, 0x7e, 0x01, 0x30, 0x05, 0x5e, 0x07, 0x2f, 0x08, 0x76, 0x04, 
-0xf7, 0xfd, 0xc1, 0xfa, 0x25, 0xfa, 0x4a, 0xfb, 0x6c, 0xfa, 0x16, 0xf6, 0x73, 0xf1, 0x62, 0xef, 
-0x3f, 0xed, 0xa9, 0xe8, 0xad, 0xe3, 0x62, 0xe5, 0x79, 0xf3, 0x2c, 0x08, 0xf5, 0x17, 0x62, 0x1a, 
-0x00, 0x0f, 0x05, 0x02, 0xc3, 0xfb, 0x41, 0xfc, 0x25, 0xff, 0x7c, 0xfe, 0x13, 0xfd, 0xdd, 0xfe, 
-0xf0, 0x03, 0x3f, 0x09, 0xa9, 0x09, 0x9c, 0x05, 0xab, 0x01, 0x10, 0x01, 0x42, 0x04, 0x21, 0x06, 
-0x36, 0x06, 0xb0, 0x04, 0x87, 0x04, 0xf1, 0x06, 0x4f, 0x07, 0xe2, 0x06, 0x96, 0x04, 0x86, 0x02, 
-0x03, 0x03, 0x7e, 0x04, 0x0c, 0x06, 0xc5, 0x05, 0x90, 0x02, 0x5d, 0xfe, 0x75, 0xfb, 0xdf, 0xfa, 
-0x7c, 0xfb, 0x53, 0xfa, 0x98, 0xf5, 0x90, 0xf0, 0x16, 0xed, 0x71, 0xec, 0x48, 0xeb, 0x3e, 0xe9, 
-0x62, 0xeb, 0xd7, 0xf5, 0x1c, 0x07, 0x66, 0x15, 0x6e, 0x18, 0x80, 0x0e, 0x10, 0x02, 0x1b, 0xfb, 
-0x79, 0xfb, 0xe8, 0xfe, 0xc7, 0xfe, 0xef, 0xfc, 0xee, 0xfc, 0xfc, 0x01, 0x1c, 0x0a, 0xb0, 0x0d, 
-0xef, 0x0a, 0x46, 0x04, 0x93, 0xfe, 0x43, 0xfe, 0xfb, 0x01, 0xe4, 0x05, 0x9b, 0x07, 0x6f, 0x07, 
-0xbd, 0x07, 0x94, 0x07, 0x7b, 0x06, 0x38, 0x04, 0x96, 0x01, 0x55, 0x01, 0xd3, 0x03, 0x81, 0x06, 
-0xb9, 0x07, 0x9d, 0x04, 0x9d, 0xff, 0xb6, 0xfb, 0x78, 0xfa, 0x19, 0xfa, 0xff, 0xf7, 0xbc, 0xf3, 
-0x67, 0xef, 0xb1, 0xee, 0xa9, 0xef, 0x62, 0xf0, 0x23, 0xed, 0x5a, 0xe8, 0x92, 0xec, 0xa0, 0xfa, 
-0x59, 0x0c, 0x10, 0x18, 0xa3, 0x14, 0x9d, 0x09, 0xdf, 0xfe, 0x18, 0xfb, 0x20, 0xfe, 0xd7, 0xff, 
-0x7d, 0x00, 0x5b, 0xff, 0xa7, 0xff, 0xd0, 0x03, 0xcb, 0x07, 0xfc, 0x09, 0x32, 0x09, 0x20, 0x06, 
-0xdd, 0x02, 0xd8, 0x01, 0xb2, 0x02, 0x12, 0x04, 0x96, 0x06, 0xc2, 0x08, 0xbc, 0x09, 0xfe, 0x08, 
-0x4a, 0x06, 0x94, 0x03, 0xd4, 0x01, 0xc8, 0x02, 0xc7, 0x04, 0xdd, 0x06, 0xe9, 0x06, 0x08, 0x04, 
-0x87, 0xff, 0x19, 0xfb, 0x80, 0xf8, 0xbf, 0xf6, 0xea, 0xf5, 0xb5, 0xf2, 0x5d, 0xf0, 0xc8, 0xed, 
-0x38, 0xec, 0x92, 0xea, 0xb0, 0xe7, 0x8b, 0xe8, 0xd5, 0xf0, 0xe3, 0x00, 0xb0, 0x11, 0x86, 0x19, 
-0xd7, 0x13, 0xd2, 0x07, 0xe0, 0xfd, 0xa3, 0xfb, 0x1b, 0xfe, 0x1d, 0x00, 0xd1, 0xfe, 0x87, 0xfd, 
-0xab, 0xfe, 0x2c, 0x04, 0xf8, 0x0a, 0x67, 0x0e, 0x50, 0x0d, 0x91, 0x07, 0xeb, 0x01, 0x3f, 0xff, 
-0xa5, 0x00, 0x75, 0x04, 0xa7, 0x07, 0x6b, 0x08, 0xc6, 0x07, 0xcb, 0x06, 0xd2, 0x06, 0xa4, 0x07, 
-0xb7, 0x05, 0x1c, 0x03, 0xdc, 0x00, 0x34, 0x01, 0x4f, 0x04, 0x83, 0x05, 0xc0, 0x02, 0x74, 0xfd, 
-0x71, 0xf8, 0xb4, 0xf5, 0x8a, 0xf4, 0xfa, 0xf1, 0x19, 0xf0, 0xef, 0xed, 0x35, 0xed, 0x46, 0xeb, 
-0xc9, 0xe7, 0xde, 0xe6, 0x8a, 0xed, 0x88, 0xfd, 0xe3, 0x0f, 0xd2, 0x1a, 0xad, 0x17, 0xf4, 0x0b, 
-0xfc, 0xff, 0x94, 0xfa, 0x69, 0xfb, 0xa3, 0xfd, 0xce, 0xfe, 0xb0, 0xfe, 0xf3, 0xff, 0xb1, 0x03, 
-0xfd, 0x09, 0x9f, 0x0e, 0xe7, 0x0e, 0x1f, 0x0b, 0xaf, 0x04, 0x13, 0x01, 0xda, 0x00, 0xd9, 0x02, 
-0xf3, 0x04, 0xc4, 0x05, 0xac, 0x05, 0x13, 0x06, 0x13, 0x07, 0xbd, 0x07, 0x89, 0x07, 0xa6, 0x05, 
-0x3b, 0x03, 0x4e, 0x02, 0xe9, 0x02, 0x49, 0x03, 0xc0, 0x01, 0xd9, 0xfd, 0xef, 0xf8, 0xf4, 0xf5, 
-0x31, 0xf4, 0xdf, 0xf2, 0x4c, 0xf2, 0x98, 0xf0, 0x9d, 0xef, 0x4f, 0xee, 0x59, 0xeb, 0x8e, 0xe9, 
-0xd2, 0xea, 0x37, 0xf3, 0x4b, 0x01, 0xf7, 0x0e, 0x77, 0x15, 0xdd, 0x12, 0x17, 0x0a, 0xa8, 0x01, 
-0x79, 0xfd, 0x1b, 0xfd, 0x30, 0xff, 0xbf, 0xff, 0xbd, 0xff, 0x18, 0x00, 0x4e, 0x03, 0x46, 0x08, 
-0x27, 0x0c, 0x07, 0x0d, 0x89, 0x0a, 0x04, 0x07, 0x5e, 0x04, 0x22, 0x03, 0x5d, 0x03, 0x14, 0x04, 
-0x8a, 0x04, 0x0b, 0x05, 0x11, 0x05, 0x6a, 0x06, 0x9b, 0x07, 0x67, 0x07, 0x05, 0x06, 0x6a, 0x03, 
-0xa4, 0x02, 0x33, 0x02, 0x34, 0x01, 0xd2, 0xfe, 0x46, 0xfb, 0x5a, 0xf9, 0xb0, 0xf7, 0x7f, 0xf6, 
-0x5a, 0xf3, 0xba, 0xef, 0xf7, 0xec, 0x5a, 0xec, 0x20, 0xed, 0xcc, 0xec, 0x5d, 0xec, 0x42, 0xed, 
-0xe3, 0xf3, 0xb5, 0xfe, 0x96, 0x0a, 0x35, 0x12, 0x08, 0x12, 0xfb, 0x0c, 0xc1, 0x06, 0xf7, 0x02, 
-0xfa, 0x01, 0xa4, 0x01, 0x70, 0x00, 0xb0, 0xfe, 0xe1, 0xfe, 0x9d, 0x01, 0x48, 0x06, 0xd0, 0x0a, 
-0xcd, 0x0c, 0x60, 0x0c, 0x52, 0x09, 0x97, 0x05, 0x1a, 0x03, 0x9e, 0x02, 0xc5, 0x03, 0x8f, 0x04, 
-0xcc, 0x04, 0xb9, 0x04, 0xcc, 0x05, 0x2a, 0x07, 0x9c, 0x07, 0x67, 0x06, 0x4a, 0x03, 0x8d, 0x00, 
-0xef, 0xfe, 0xd0, 0xfe, 0xea, 0xfe, 0xe0, 0xfd, 0x9a, 0xfb, 0x5a, 0xf8, 0xb8, 0xf5, 0xf5, 0xf3, 
-0x08, 0xf3, 0x2a, 0xf2, 0xfe, 0xef, 0x15, 0xee, 0x4a, 0xeb, 0x1f, 0xea, 0xb6, 0xeb, 0xa5, 0xf0, 
-0x2a, 0xfa, 0x8b, 0x04, 0x35, 0x0d, 0x1f, 0x11, 0xab, 0x0f, 0x91, 0x0b, 0xfd, 0x06, 0x16, 0x04, 
-0xf6, 0x02, 0xbe, 0x01, 0xe4, 0x00, 0x0e, 0x00, 0x2f, 0x00, 0x0e, 0x02, 0xde, 0x04, 0x08, 0x08, 
-0xdb, 0x09, 0xfe, 0x09, 0x1a, 0x08, 0xb9, 0x05, 0x19, 0x04, 0x25, 0x04, 0x76, 0x05, 0x44, 0x06, 
-0xed, 0x05, 0x1d, 0x05, 0x09, 0x05, 0xc1, 0x05, 0x77, 0x06, 0xa5, 0x05, 0x49, 0x03, 0xc0, 0x00, 
-0xe7, 0xfe, 0x5b, 0xfe, 0x2c, 0xfe, 0x0a, 0xfd, 0xd1, 0xfa, 0x7f, 0xf7, 0x23, 0xf4, 0x1e, 0xf1, 
-0x8a, 0xef, 0x23, 0xef, 0xcf, 0xef, 0x81, 0xef, 0x52, 0xee, 0x57, 0xed, 0xeb, 0xed, 0x30, 0xf3, 
-0xef, 0xfb, 0xa3, 0x05, 0x02, 0x0d, 0x98, 0x0f, 0x13, 0x0e, 0x0f, 0x0b, 0x68, 0x08, 0xf7, 0x06, 
-0x71, 0x05, 0x28, 0x03, 0x46, 0x00, 0x65, 0xfe, 0xcb, 0xfe, 0x41, 0x01, 0xca, 0x04, 0xe1, 0x07, 
-0xae, 0x09, 0xbd, 0x09, 0xa8, 0x08, 0x04, 0x07, 0xe0, 0x05, 0x1c, 0x05, 0x47, 0x05, 0x6f, 0x05, 
-0x62, 0x05, 0x74, 0x05, 0xb3, 0x05, 0x29, 0x06, 0xd2, 0x05, 0x29, 0x04, 0xa1, 0x01, 0xde, 0xff, 
-0xb7, 0xfe, 0x91, 0xfe, 0xa0, 0xfd, 0xab, 0xfb, 0x59, 0xf9, 0xfd, 0xf6, 0x2b, 0xf5, 0x4b, 0xf3, 
-0xf7, 0xf1, 0x20, 0xf1, 0xbd, 0xf0, 0x77, 0xf0, 0x08, 0xef, 0xe2, 0xed, 0xa7, 0xee, 0x52, 0xf2, 
-0xd5, 0xf9, 0x9f, 0x02, 0x4d, 0x0a, 0xce, 0x0e, 0x72, 0x0f, 0xdf, 0x0d, 0x61, 0x0b, 0x3a, 0x09, 
-0x59, 0x07, 0xf6, 0x04, 0xdc, 0x01, 0xcf, 0xfe, 0x22, 0xfd, 0xf2, 0xfd, 0xbb, 0x00, 0x66, 0x04, 
-0x49, 0x07, 0x5f, 0x08, 0x5a, 0x08, 0x91, 0x07, 0x02, 0x07, 0x8b, 0x06, 0xc3, 0x05, 0x8d, 0x04, 
-0x59, 0x03, 0x5f, 0x02, 0xee, 0x01, 0xf7, 0x01, 0xa8, 0x01, 0x13, 0x01, 0x3f, 0x00, 0xb1, 0xff, 
-0x42, 0xff, 0x10, 0xff, 0x4b, 0xfe, 0x52, 0xfd, 0x66, 0xfc, 0xb7, 0xfa, 0xb3, 0xf9, 0xe1, 0xf8, 
-0x01, 0xf8, 0xa0, 0xf7, 0x5c, 0xf6, 0x53, 0xf4, 0xf9, 0xf1, 0x11, 0xf0, 0x8e, 0xee, 0x02, 0xef, 
-0xa2, 0xf1, 0x6d, 0xf6, 0xfd, 0xfd, 0xa2, 0x05, 0x48, 0x0c, 0x24, 0x10, 0x0a, 0x11, 0x6e, 0x0f, 
-0xbf, 0x0c, 0x0f, 0x0a, 0xf9, 0x06, 0x9b, 0x03, 0x08, 0x00, 0xf0, 0xfc, 0x48, 0xfc, 0xff, 0xfd, 
-0x8d, 0x01, 0x8f, 0x05, 0x20, 0x08, 0xb8, 0x08, 0x0f, 0x08, 0x3c, 0x07, 0x58, 0x06, 0x42, 0x06, 
-0x78, 0x05, 0x3e, 0x04, 0xcd, 0x02, 0xb6, 0x00, 0xd1, 0xff, 0x71, 0xff, 0xb6, 0xff, 0xaa, 0x00, 
-0x03, 0x00, 0x63, 0xff, 0xa9, 0xfe, 0x41, 0xfe, 0xcd, 0xfe, 0x25, 0xfe, 0xdd, 0xfc, 0x7a, 0xfa, 
-0x83, 0xf8, 0xd4, 0xf7, 0x98, 0xf6, 0x23, 0xf6, 0xc5, 0xf4, 0xa5, 0xf2, 0xa6, 0xf1, 0xb2, 0xef, 
-0x52, 0xee, 0x44, 0xef, 0x5a, 0xf3, 0x7f, 0xfb, 0x4f, 0x05, 0x5d, 0x0c, 0x00, 0x0f, 0x1b, 0x0e, 
-0x0c, 0x0c, 0x1c, 0x0b, 0xad, 0x0a, 0x2b, 0x08, 0xe5, 0x03, 0x56, 0xff, 0xc7, 0xfc, 0x06, 0xfe, 
-0x32, 0x01, 0xed, 0x04, 0xe7, 0x07, 0xe8, 0x08, 0x0d, 0x09, 0xf9, 0x07, 0xf9, 0x06, 0xa1, 0x06, 
-0x60, 0x05, 0xdd, 0x04, 0x86, 0x03, 0x9f, 0x01, 0x35, 0x01, 0x3f, 0x00, 0x90, 0x00, 0x0c, 0x01, 
-0xd2, 0xff, 0xf4, 0xfe, 0x12, 0xfe, 0x3d, 0xfe, 0x2d, 0xff, 0xac, 0xfe, 0x11, 0xfd, 0x08, 0xfb, 
-0xb6, 0xf9, 0x11, 0xf9, 0xbd, 0xf8, 0x35, 0xf7, 0xa6, 0xf4, 0x68, 0xf2, 0x98, 0xf0, 0x37, 0xf1, 
-0xcc, 0xf1, 0xa9, 0xf0, 0xe7, 0xef, 0x66, 0xf0, 0x0d, 0xf7, 0x66, 0x02, 0x77, 0x0c, 0x87, 0x12, 
-0x2f, 0x11, 0xd7, 0x0c, 0x2c, 0x09, 0x30, 0x07, 0xe1, 0x06, 0xe5, 0x04, 0xe5, 0x01, 0x13, 0xff, 
-0x21, 0xfe, 0x44, 0x01, 0x63, 0x05, 0xc3, 0x09, 0xc9, 0x0b, 0x52, 0x0a, 0xeb, 0x07, 0xba, 0x04, 
-0xbe, 0x03, 0x88, 0x03, 0x06, 0x03, 0xc7, 0x02, 0xfd, 0x00, 0x0b, 0x01, 0xea, 0x01, 0x94, 0x01, 
-0x25, 0x01, 0xd5, 0xfe, 0x15, 0xfd, 0x40, 0xfd, 0x58, 0xfe, 0xed, 0xff, 0x9f, 0xff, 0x83, 0xfe, 
-0x99, 0xfc, 0x74, 0xfb, 0x5c, 0xfb, 0x2a, 0xfa, 0x0a, 0xf9, 0x8d, 0xf6, 0x9c, 0xf4, 0xda, 0xf3, 
-0x7a, 0xf2, 0x23, 0xf2, 0x2d, 0xf0, 0xef, 0xed, 0x1c, 0xef, 0x71, 0xf3, 0xb2, 0xfd, 0x49, 0x09, 
-0xd6, 0x10, 0xee, 0x12, 0xb1, 0x0e, 0xbf, 0x0a, 0x4d, 0x08, 0xdb, 0x06, 0xb6, 0x05, 0x85, 0x01, 
-0x23, 0xfe, 0x09, 0xfe, 0x88, 0x00, 0xd4, 0x05, 0xe0, 0x08, 0xe5, 0x09, 0x68, 0x09, 0x86, 0x07, 
-0xc4, 0x06, 0x54, 0x05, 0xcb, 0x03, 0xa2, 0x02, 0xd0, 0x01, 0xbe, 0x02, 0x7b, 0x03, 0x40, 0x03, 
-0x10, 0x02, 0x5c, 0xff, 0x5c, 0xfe, 0xe5, 0xfd, 0x69, 0xfe, 0x63, 0xff, 0xd1, 0xff, 0x32, 0x00, 
-0x1d, 0xff, 0xcc, 0xfd, 0xaa, 0xfc, 0x02, 0xfb, 0x5e, 0xfa, 0xbe, 0xf8, 0x82, 0xf7, 0xc8, 0xf6, 
-0x51, 0xf5, 0x91, 0xf5, 0x5a, 0xf3, 0x46, 0xf2, 0x4e, 0xf0, 0x36, 0xec, 0x43, 0xef, 0x6a, 0xf5, 
-0x39, 0x00, 0x4b, 0x0d, 0x15, 0x11, 0x6e, 0x11, 0xdf, 0x0d, 0x78, 0x09, 0x2f, 0x09, 0xd1, 0x05, 
-0x90, 0x03, 0xf7, 0xff, 0xd9, 0xfd, 0xf6, 0x00, 0x6d, 0x03, 0x36, 0x07, 0xd0, 0x08, 0x89, 0x07, 
-0xcf, 0x07, 0xeb, 0x05, 0x8f, 0x04, 0x1e, 0x03, 0xd8, 0x00, 0xf4, 0x00, 0x00, 0x01, 0x13, 0x02, 
-0x66, 0x02, 0xd9, 0x01, 0xea, 0x00, 0x43, 0xff, 0x66, 0xfe, 0x10, 0xff, 0x90, 0xff, 0x8f, 0x00, 
-0x2d, 0x01, 0x00, 0x01, 0xee, 0x00, 0xf5, 0xff, 0xe4, 0xfd, 0x8d, 0xfa, 0xd4, 0xf8, 0xa1, 0xf8, 
-0x7f, 0xf9, 0x59, 0xf9, 0xcc, 0xf7, 0x92, 0xf4, 0x4b, 0xf2, 0x04, 0xf1, 0x83, 0xf0, 0xfd, 0xee, 
-0x03, 0xf0, 0xdf, 0xf4, 0x7b, 0xfe, 0x3a, 0x0b, 0x63, 0x11, 0xc2, 0x11, 0x38, 0x0d, 0xdc, 0x08, 
-0x14, 0x08, 0xeb, 0x06, 0x05, 0x04, 0xbb, 0x00, 0xa6, 0xfd, 0x98, 0x00, 0x9b, 0x04, 0x1b, 0x08, 
-0x25, 0x09, 0xcb, 0x07, 0x8b, 0x06, 0xd7, 0x05, 0xf6, 0x05, 0xab, 0x03, 0x94, 0x01, 0x47, 0x01, 
-0x5e, 0x01, 0xb4, 0x03, 0xeb, 0x03, 0x96, 0x01, 0xe3, 0x00, 0xa5, 0xfe, 0x27, 0xff, 0xd5, 0x00, 
-0x19, 0x00, 0xff, 0x00, 0x49, 0x01, 0x61, 0x00, 0x5d, 0x01, 0x4a, 0xff, 0x35, 0xfd, 0xb5, 0xfa, 
-0xec, 0xf7, 0x97, 0xf7, 0x9c, 0xf7, 0x4f, 0xf7, 0x2f, 0xf6, 0xaf, 0xf3, 0x95, 0xf2, 0x24, 0xf2, 
-0x3a, 0xf1, 0x41, 0xef, 0x89, 0xee, 0x3a, 0xf5, 0x28, 0xff, 0x68, 0x0b, 0x0b, 0x11, 0xba, 0x0f, 
-0xa9, 0x0c, 0xb4, 0x08, 0x16, 0x06, 0xeb, 0x04, 0xb0, 0x01, 0xff, 0xff, 0xa2, 0x00, 0xde, 0x01, 
-0xae, 0x05, 0x15, 0x07, 0x30, 0x07, 0x75, 0x07, 0x7e, 0x07, 0x41, 0x06, 0x3c, 0x05, 0x5d, 0x01, 
-0x54, 0x00, 0xa5, 0x01, 0x46, 0x03, 0x0d, 0x05, 0xf3, 0x03, 0x04, 0x02, 0x61, 0x01, 0x65, 0x01, 
-0xcb, 0x01, 0x6c, 0x01, 0x51, 0xff, 0xcb, 0xff, 0xd5, 0x01, 0xc6, 0x02, 0xc0, 0x01, 0xf5, 0xfd, 
-0xb3, 0xfa, 0xb1, 0xf9, 0x5e, 0xf9, 0x03, 0xf9, 0x12, 0xf8, 0x1c, 0xf7, 0x97, 0xf5, 0x27, 0xf4, 
-0x13, 0xf3, 0xd0, 0xf1, 0x71, 0xf1, 0xe9, 0xee, 0x28, 0xed, 0xee, 0xf3, 0x24, 0xfd, 0x87, 0x09, 
-0xb9, 0x10, 0xa7, 0x0e, 0x26, 0x0c, 0xaa, 0x09, 0xd8, 0x07, 0xef, 0x06, 0x72, 0x01, 0x32, 0xfd, 
-0xb0, 0xfe, 0x51, 0x02, 0x5a, 0x07, 0x4e, 0x08, 0x7a, 0x06, 0x61, 0x06, 0x56, 0x07, 0x7b, 0x07, 
-0xe1, 0x05, 0xbd, 0x01, 0x7a, 0x00, 0xd3, 0x01, 0x6f, 0x03, 0x03, 0x05, 0x3c, 0x04, 0xfb, 0x02, 
-0x84, 0x02, 0xc5, 0x01, 0x65, 0x01, 0xbe, 0x01, 0x6e, 0x01, 0x2c, 0x01, 0xf7, 0x01, 0x48, 0x01, 
-0x09, 0x00, 0x60, 0xfe, 0x83, 0xfb, 0xc6, 0xf9, 0x52, 0xf9, 0xcf, 0xf9, 0x86, 0xfa, 0x97, 0xf9, 
-0x48, 0xf7, 0xc7, 0xf4, 0xea, 0xf2, 0xe2, 0xf0, 0x74, 0xf0, 0xaa, 0xef, 0x87, 0xed, 0xaa, 0xf0, 
-0x27, 0xf8, 0xe1, 0x02, 0x53, 0x0e, 0x9f, 0x11, 0x66, 0x0e, 0x66, 0x0a, 0x87, 0x07, 0x7a, 0x06, 
-0x11, 0x04, 0xa8, 0xff, 0x61, 0xfe, 0x26, 0x01, 0x4d, 0x05, 0x52, 0x08, 0x3f, 0x08, 0xac, 0x07, 
-0x44, 0x07, 0xb5, 0x05, 0x18, 0x05, 0xfa, 0x03, 0x00, 0x02, 0x97, 0x02, 0xb4, 0x02, 0x24, 0x03, 
-0x08, 0x05, 0x61, 0x03, 0x6d, 0x01, 0xa6, 0x00, 0xb0, 0xff, 0xb8, 0x01, 0x69, 0x03, 0x52, 0x02, 
-0x96, 0x02, 0x68, 0x01, 0xf2, 0xfe, 0x16, 0xfe, 0x3a, 0xfb, 0xe9, 0xf8, 0x08, 0xf9, 0xd6, 0xf9, 
-0xb0, 0xfa, 0x05, 0xfa, 0xb5, 0xf6, 0x4d, 0xf4, 0xc4, 0xf4, 0xce, 0xf2, 0xd1, 0xf0, 0x02, 0xf0, 
-0x0e, 0xec, 0x4c, 0xed, 0x3d, 0xf5, 0x61, 0xfd, 0x37, 0x0a, 0x82, 0x12, 0x22, 0x10, 0xe9, 0x0c, 
-0x95, 0x09, 0xae, 0x06, 0x04, 0x05, 0x3a, 0x01, 0x2b, 0xff, 0xb1, 0x01, 0xd0, 0x05, 0x5f, 0x08, 
-0xd3, 0x07, 0x7b, 0x07, 0xe1, 0x07, 0x00, 0x07, 0x8e, 0x05, 0xbe, 0x03, 0xf7, 0x01, 0xa5, 0x02, 
-0xac, 0x03, 0x41, 0x03, 0x95, 0x03, 0x22, 0x04, 0x8b, 0x03, 0xce, 0x02, 0x7d, 0x01, 0x64, 0x00, 
-0xdd, 0x00, 0xdf, 0x01, 0x23, 0x02, 0x58, 0x02, 0xc6, 0x00, 0xf3, 0xfd, 0x72, 0xfc, 0xa8, 0xfa, 
-0x00, 0xfa, 0xc6, 0xfa, 0x01, 0xfa, 0x99, 0xf9, 0xc6, 0xf8, 0x90, 0xf5, 0x94, 0xf4, 0x8d, 0xf2, 
-0x8f, 0xf0, 0xb7, 0xf1, 0xcf, 0xed, 0xde, 0xeb, 0xdd, 0xf4, 0x34, 0xfe, 0xf6, 0x08, 0x93, 0x10, 
-0xf3, 0x0c, 0xe8, 0x0a, 0x11, 0x0b, 0x84, 0x06, 0x6a, 0x02, 0xa8, 0xff, 0x4d, 0xff, 0x66, 0x03, 
-0x31, 0x06, 0xa7, 0x05, 0x7f, 0x06, 0xc5, 0x08, 0x31, 0x09, 0xc0, 0x07, 0xba, 0x03, 0x40, 0x01, 
-0xf4, 0x02, 0x14, 0x05, 0xb0, 0x04, 0x59, 0x03, 0xbc, 0x01, 0xa2, 0x02, 0xae, 0x03, 0xe1, 0x02, 
-0x08, 0x01, 0x70, 0x01, 0x09, 0x03, 0x90, 0x03, 0x3b, 0x03, 0x8d, 0x01, 0x11, 0x00, 0x92, 0xff, 
-0x14, 0xfe, 0x77, 0xfb, 0x71, 0xfa, 0xe8, 0xf9, 0xbb, 0xf9, 0x76, 0xf9, 0x54, 0xf7, 0x58, 0xf5, 
-0x36, 0xf4, 0x1d, 0xf2, 0x57, 0xf1, 0x56, 0xf0, 0x5a, 0xed, 0xab, 0xec, 0x5f, 0xf4, 0xae, 0xff, 
-0x79, 0x0a, 0xaa, 0x0f, 0xf6, 0x0c, 0xa0, 0x08, 0xf2, 0x07, 0xc6, 0x06, 0x6f, 0x03, 0x91, 0x00, 
-0x47, 0x00, 0x4e, 0x03, 0xc8, 0x06, 0xfd, 0x06, 0x07, 0x06, 0x78, 0x07, 0xcb, 0x08, 0xa9, 0x08, 
-0x95, 0x05, 0x6c, 0x01, 0xe5, 0x00, 0x3f, 0x03, 0x08, 0x03, 0x94, 0x02, 0xed, 0x01, 0xdd, 0x01, 
-0x12, 0x03, 0xc5, 0x02, 0x65, 0x00, 0x22, 0x01, 0x7f, 0x03, 0xe0, 0x02, 0xd4, 0x02, 0x94, 0x01, 
-0x78, 0xfe, 0xdb, 0xfd, 0x2b, 0xfd, 0x38, 0xfb, 0x6d, 0xfb, 0xed, 0xfa, 0xb7, 0xf8, 0xc4, 0xf8, 
-0x5d, 0xf8, 0x97, 0xf6, 0xc9, 0xf5, 0xfb, 0xf3, 0xd5, 0xf2, 0xfa, 0xf1, 0x68, 0xef, 0x4b, 0xed, 
-0xd1, 0xf2, 0xf9, 0xfc, 0x36, 0x07, 0x58, 0x0e, 0x11, 0x0f, 0x51, 0x0b, 0xf7, 0x08, 0x18, 0x07, 
-0xfc, 0x02, 0xa7, 0x00, 0xbc, 0x00, 0x58, 0x02, 0x53, 0x05, 0xfc, 0x06, 0x2e, 0x06, 0xc9, 0x06, 
-0xb3, 0x07, 0xd8, 0x06, 0x09, 0x05, 0x95, 0x03, 0xa2, 0x02, 0x30, 0x04, 0xa9, 0x04, 0xfa, 0x02, 
-0xaa, 0x01, 0x3f, 0x02, 0x28, 0x03, 0xef, 0x02, 0x61, 0x01, 0x4e, 0x00, 0xa4, 0x01, 0xb9, 0x02, 
-0x7c, 0x02, 0x65, 0x01, 0x44, 0x00, 0xb8, 0xff, 0x97, 0xfe, 0xda, 0xfb, 0xd3, 0xf9, 0xe8, 0xf9, 
-0x5b, 0xf9, 0xae, 0xf7, 0xec, 0xf5, 0x29, 0xf4, 0x90, 0xf4, 0x27, 0xf4, 0xe4, 0xf2, 0x01, 0xf2, 
-0xd4, 0xf0, 0x33, 0xf1, 0x2c, 0xf6, 0xd5, 0xfc, 0xd6, 0x04, 0x11, 0x0d, 0x9b, 0x0d, 0x6e, 0x0a, 
-0xd4, 0x07, 0x63, 0x05, 0x1f, 0x03, 0x20, 0x02, 0x68, 0x00, 0xb9, 0x01, 0x87, 0x06, 0x54, 0x08, 
-0x14, 0x07, 0x86, 0x06, 0x98, 0x06, 0x3f, 0x06, 0x0a, 0x06, 0x68, 0x04, 0xc2, 0x02, 0x7d, 0x03, 
-0x01, 0x05, 0x39, 0x03, 0x4b, 0x01, 0xbd, 0x01, 0x4a, 0x02, 0xc9, 0x01, 0xb9, 0x01, 0x0c, 0x01, 
-0xc1, 0x00, 0x19, 0x02, 0x46, 0x02, 0x9d, 0x00, 0x55, 0xff, 0xfe, 0xfe, 0x6c, 0xfd, 0x1e, 0xfc, 
-0xf7, 0xfa, 0x63, 0xfa, 0x7c, 0xfa, 0x02, 0xfa, 0x32, 0xf8, 0xc6, 0xf5, 0x9a, 0xf4, 0xfb, 0xf3, 
-0xdf, 0xf3, 0x00, 0xf3, 0xb1, 0xf1, 0xcb, 0xf0, 0x87, 0xf3, 0xf8, 0xfa, 0x8f, 0x03, 0xec, 0x09, 
-0x25, 0x0c, 0x49, 0x0b, 0x36, 0x09, 0xe6, 0x07, 0xb1, 0x05, 0x60, 0x02, 0x35, 0x00, 0xe8, 0x01, 
-0x84, 0x05, 0x3c, 0x07, 0x11, 0x07, 0x08, 0x07, 0xdb, 0x06, 0xa1, 0x07, 0x7b, 0x07, 0xa0, 0x04, 
-0xe8, 0x02, 0xc8, 0x03, 0x50, 0x03, 0xf0, 0x01, 0xd2, 0x01, 0xf3, 0x01, 0x21, 0x03, 0x00, 0x03, 
-0x0e, 0x01, 0xff, 0xff, 0x28, 0x01, 0x35, 0x01, 0x76, 0x00, 0xa8, 0xff, 0x52, 0xff, 0xe1, 0xfe, 
-0xa8, 0xfd, 0xb6, 0xfb, 0x62, 0xfa, 0x8a, 0xfa, 0xa1, 0xfa, 0x18, 0xf9, 0x5b, 0xf7, 0xce, 0xf6, 
-0x49, 0xf6, 0x05, 0xf5, 0xbc, 0xf3, 0x60, 0xf3, 0xc4, 0xf3, 0xfb, 0xf3, 0xfd, 0xf4, 0x48, 0xf9, 
-0x89, 0x00, 0x87, 0x07, 0x93, 0x0a, 0xa4, 0x09, 0x34, 0x08, 0x09, 0x08, 0x25, 0x07, 0xda, 0x03, 
-0x86, 0x00, 0xa6, 0x00, 0xd7, 0x03, 0xc7, 0x06, 0xd6, 0x06, 0x25, 0x06, 0xe4, 0x06, 0x8c, 0x08, 
-0xdf, 0x07, 0x50, 0x05, 0x11, 0x02, 0xfe, 0x01, 0x53, 0x04, 0x95, 0x04, 0x35, 0x02, 0xee, 0x00, 
-0xb5, 0x01, 0x21, 0x03, 0x1b, 0x03, 0x3c, 0x00, 0x1b, 0xff, 0xda, 0x00, 0x0a, 0x02, 0xd4, 0x00, 
-0x61, 0xff, 0x76, 0xfe, 0x62, 0xfe, 0x91, 0xfd, 0xeb, 0xfa, 0x9a, 0xf8, 0x99, 0xf8, 0x1f, 0xf9, 
-0x79, 0xf8, 0xc8, 0xf7, 0x5b, 0xf7, 0xce, 0xf6, 0x07, 0xf6, 0xa3, 0xf4, 0x43, 0xf3, 0x98, 0xf3, 
-0x5d, 0xf6, 0x43, 0xfa, 0x2a, 0xfe, 0x4b, 0x02, 0x4c, 0x07, 0xf5, 0x09, 0x32, 0x09, 0x6d, 0x07, 
-0x38, 0x06, 0x96, 0x04, 0xb5, 0x03, 0x9a, 0x03, 0x08, 0x04, 0x24, 0x05, 0xbb, 0x05, 0xb4, 0x05, 
-0xde, 0x06, 0xcc, 0x07, 0xe9, 0x05, 0xd8, 0x03, 0x87, 0x03, 0x12, 0x04, 0x9c, 0x03, 0x3d, 0x02, 
-0x6a, 0x01, 0x95, 0x02, 0x12, 0x03, 0x8b, 0x01, 0x63, 0x00, 0x08, 0x01, 0x66, 0x01, 0xd5, 0x00, 
-0xe8, 0xff, 0x4f, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0x98, 0xfd, 0xa3, 0xfb, 0x92, 0xfb, 0x50, 0xfb, 
-0xa8, 0xfa, 0x2a, 0xf9, 0x51, 0xf7, 0x97, 0xf7, 0x2b, 0xf9, 0x29, 0xf9, 0x5a, 0xf7, 0x32, 0xf6, 
-0x1f, 0xf6, 0x6d, 0xf5, 0x25, 0xf5, 0x96, 0xf8, 0x6b, 0xfd, 0x01, 0x01, 0x8d, 0x04, 0x79, 0x07, 
-0x7a, 0x08, 0xd0, 0x07, 0xf9, 0x05, 0xbb, 0x03, 0x1f, 0x03, 0xb4, 0x03, 0xeb, 0x03, 0xf5, 0x03, 
-0x54, 0x05, 0x36, 0x06, 0xc7, 0x05, 0xe0, 0x05, 0x9c, 0x05, 0x0d, 0x04, 0x74, 0x03, 0xf4, 0x03, 
-0x66, 0x03, 0x13, 0x03, 0x6b, 0x03, 0xe0, 0x02, 0xb1, 0x01, 0xf1, 0x01, 0x4a, 0x02, 0x81, 0x01, 
-0xb2, 0x00, 0x25, 0x00, 0x3b, 0x00, 0x06, 0x01, 0x28, 0x01, 0xd3, 0xff, 0x6d, 0xfe, 0xf8, 0xfc, 
-0xea, 0xfb, 0x3c, 0xfb, 0xe7, 0xfa, 0x7c, 0xfa, 0x8c, 0xf9, 0xb2, 0xf8, 0x9a, 0xf8, 0x8d, 0xf8, 
-0x2f, 0xf8, 0xf0, 0xf7, 0xb7, 0xf7, 0x36, 0xf7, 0xd2, 0xf6, 0x0f, 0xf8, 0x4b, 0xfb, 0x73, 0xfe, 
-0x9d, 0x01, 0x3e, 0x05, 0x35, 0x07, 0x4d, 0x06, 0xd6, 0x04, 0x2c, 0x05, 0x1e, 0x06, 0x27, 0x05, 
-0x86, 0x02, 0x5f, 0x02, 0x98, 0x04, 0x46, 0x06, 0xaa, 0x05, 0x50, 0x04, 0xdf, 0x03, 0xdf, 0x04, 
-0x07, 0x05, 0xa4, 0x03, 0xec, 0x01, 0x15, 0x01, 0x73, 0x02, 0xe4, 0x03, 0xa0, 0x02, 0xad, 0x00, 
-0x2e, 0x01, 0x6c, 0x02, 0x52, 0x02, 0x56, 0x00, 0x0a, 0xff, 0x41, 0x00, 0x1c, 0x01, 0x07, 0x00, 
-0x77, 0xfe, 0xe4, 0xfd, 0x06, 0xfe, 0x9f, 0xfd, 0xae, 0xfb, 0xfe, 0xfa, 0xc8, 0xfb, 0xb4, 0xfb, 
-0xa1, 0xfa, 0x60, 0xf9, 0x51, 0xf8, 0xc1, 0xf7, 0x9f, 0xf8, 0x61, 0xf9, 0x40, 0xf9, 0xf8, 0xf8, 
-0x46, 0xfa, 0x32, 0xfc, 0x82, 0xfe, 0x45, 0x00, 0x4d, 0x01, 0xa8, 0x02, 0x66, 0x04, 0xdd, 0x04, 
-0x63, 0x04, 0x25, 0x04, 0x9b, 0x03, 0xdc, 0x03, 0x17, 0x05, 0x0b, 0x06, 0xbb, 0x05, 0x7d, 0x05, 
-0x0f, 0x05, 0xdb, 0x04, 0xbb, 0x04, 0xf3, 0x03, 0xb3, 0x02, 0x0e, 0x02, 0xdc, 0x01, 0xc5, 0x01, 
-0x51, 0x01, 0x93, 0x00, 0xdf, 0x00, 0x07, 0x02, 0x84, 0x02, 0x0f, 0x02, 0xa1, 0x01, 0x3b, 0x01, 
-0xd7, 0x00, 0x23, 0x00, 0x4b, 0xff, 0x17, 0xfe, 0x6b, 0xfd, 0x1f, 0xfd, 0x74, 0xfc, 0x31, 0xfb, 
-0x1e, 0xfa, 0xb7, 0xf9, 0xe0, 0xf9, 0x7d, 0xf9, 0x9d, 0xf8, 0xcf, 0xf8, 0x53, 0xf9, 0x33, 0xf9, 
-0x4e, 0xf9, 0x73, 0xfa, 0x4e, 0xfb, 0x44, 0xfc, 0xb7, 0xfd, 0x9e, 0xff, 0x11, 0x01, 0x6b, 0x02, 
-0xfd, 0x03, 0xc2, 0x04, 0xa5, 0x03, 0xee, 0x02, 0x73, 0x04, 0x39, 0x05, 0x1d, 0x04, 0x9c, 0x04, 
-0x04, 0x06, 0x8f, 0x05, 0xd6, 0x04, 0x23, 0x05, 0x3c, 0x04, 0x4f, 0x03, 0x35, 0x04, 0x12, 0x04, 
-0x29, 0x02, 0x32, 0x01, 0x47, 0x01, 0x26, 0x01, 0x7a, 0x01, 0xb6, 0x01, 0xa5, 0x01, 0x33, 0x02, 
-0x76, 0x02, 0x0a, 0x01, 0x80, 0xff, 0xd4, 0xfe, 0x1d, 0xff, 0xd8, 0xfe, 0xa0, 0xfd, 0x3f, 0xfc, 
-0x53, 0xfc, 0xa0, 0xfc, 0x87, 0xfb, 0x5a, 0xfa, 0x97, 0xfa, 0xe6, 0xfa, 0x25, 0xfa, 0xc8, 0xf9, 
-0x5d, 0xfa, 0x79, 0xfa, 0x81, 0xfa, 0x44, 0xfb, 0x3d, 0xfc, 0x88, 0xfc, 0xc1, 0xfc, 0x91, 0xfd, 
-0x70, 0xff, 0xff, 0x01, 0xe5, 0x02, 0xca, 0x01, 0x92, 0x01, 0xcc, 0x03, 0x5a, 0x05, 0x1b, 0x04, 
-0xeb, 0x02, 0xdf, 0x04, 0x2a, 0x07, 0x60, 0x06, 0xfd, 0x03, 0x0e, 0x04, 0xde, 0x05, 0xb6, 0x05, 
-0x35, 0x03, 0xfe, 0x01, 0xd9, 0x02, 0xb3, 0x02, 0x26, 0x01, 0x94, 0x00, 0x40, 0x01, 0x46, 0x01, 
-0xd1, 0x00, 0xdf, 0x00, 0xa7, 0x00, 0x19, 0x00, 0x87, 0xff, 0xb4, 0xfe, 0xc9, 0xfd, 0x2d, 0xfd, 
-0xc8, 0xfc, 0xa1, 0xfc, 0x99, 0xfc, 0xca, 0xfb, 0x0f, 0xfb, 0x7e, 0xfb, 0xb5, 0xfb, 0x2c, 0xfb, 
-0x0c, 0xfb, 0x5a, 0xfb, 0x53, 0xfb, 0x2b, 0xfb, 0xd7, 0xfb, 0xe6, 0xfc, 0x48, 0xfd, 0x79, 0xfd, 
-0x44, 0xff, 0x20, 0x01, 0xde, 0x00, 0x5c, 0x00, 0x15, 0x01, 0x97, 0x02, 0x07, 0x03, 0x86, 0x02, 
-0x69, 0x02, 0x8b, 0x03, 0x72, 0x04, 0x2f, 0x04, 0xc2, 0x03, 0x2f, 0x04, 0x1f, 0x05, 0x5c, 0x05, 
-0x9d, 0x04, 0xc3, 0x03, 0xeb, 0x02, 0x3d, 0x02, 0x05, 0x02, 0xd4, 0x01, 0x85, 0x01, 0x71, 0x01, 
-0x87, 0x01, 0xe5, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0xc4, 0xff, 0xf4, 0xfe, 0x7b, 0xfe, 0xa9, 0xfe, 
-0x41, 0xfe, 0xf9, 0xfc, 0xa8, 0xfc, 0x74, 0xfd, 0x8b, 0xfd, 0xae, 0xfc, 0x2e, 0xfc, 0x79, 0xfc, 
-0xf0, 0xfc, 0xa8, 0xfc, 0x01, 0xfc, 0xf8, 0xfb, 0xd0, 0xfc, 0x9a, 0xfd, 0xe3, 0xfd, 0x3e, 0xfe, 
-0xdc, 0xfe, 0x24, 0xff, 0xb3, 0xff, 0x52, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x2b, 0x01, 0xbe, 0x01, 
-0x14, 0x01, 0x36, 0x01, 0x10, 0x02, 0x85, 0x02, 0x5c, 0x02, 0x50, 0x02, 0x8e, 0x02, 0xbb, 0x02, 
-0x53, 0x02, 0x26, 0x02, 0x96, 0x02, 0xba, 0x02, 0x2a, 0x02, 0x09, 0x02, 0x35, 0x02, 0xd6, 0x01, 
-0x6c, 0x01, 0x87, 0x01, 0xac, 0x01, 0x27, 0x01, 0xaa, 0x00, 0x3a, 0x00, 0x3c, 0x00, 0x3c, 0x00, 
-0x7b, 0xff, 0x7c, 0xfe, 0x5f, 0xfe, 0x8f, 0xfe, 0x19, 0xfe, 0x5e, 0xfd, 0x16, 0xfd, 0x56, 0xfd, 
-0x88, 0xfd, 0x46, 0xfd, 0x4c, 0xfd, 0x9f, 0xfd, 0xfe, 0xfd, 0x19, 0xfe, 0xc9, 0xfd, 0x62, 0xfd, 
-0xc5, 0xfd, 0xc2, 0xfe, 0x48, 0xff, 0x44, 0xff, 0x58, 0xff, 0xc7, 0xff, 0x4c, 0x00, 0x62, 0x00, 
-0x21, 0x00, 0x60, 0x00, 0x0c, 0x01, 0x4b, 0x01, 0x12, 0x01, 0x0b, 0x01, 0x4e, 0x01, 0x06, 0x02, 
-0xce, 0x02, 0xc4, 0x02, 0xc7, 0x01, 0x5f, 0x01, 0xe5, 0x01, 0x21, 0x02, 0x4e, 0x01, 0x6e, 0x00, 
-0xb7, 0x00, 0x45, 0x01, 0xb2, 0x00, 0xeb, 0xff, 0x39, 0x00, 0xbb, 0x00, 0xa3, 0x00, 0x20, 0x00, 
-0xac, 0xff, 0xb0, 0xff, 0xcc, 0xff, 0x8d, 0xff, 0x6b, 0xff, 0xea, 0xff, 0x1c, 0x00, 0x40, 0xff, 
-0x53, 0xfe, 0x7b, 0xfe, 0xef, 0xfe, 0xa3, 0xfe, 0x15, 0xfe, 0x17, 0xfe, 0x78, 0xfe, 0x9a, 0xfe, 
-0x3a, 0xfe, 0xe5, 0xfd, 0x4f, 0xfe, 0x24, 0xff, 0x5f, 0xff, 0x4a, 0xff, 0xcd, 0xff, 0x8d, 0x00, 
-0x88, 0x00, 0x1d, 0x00, 0x91, 0x00, 0x6d, 0x01, 0x5c, 0x01, 0xb2, 0x00, 0xac, 0x00, 0x2f, 0x01, 
-0x65, 0x01, 0xe9, 0x00, 0x7a, 0x00, 0xbb, 0x00, 0x34, 0x01, 0x14, 0x01, 0x5b, 0x00, 0x8e, 0xff, 
-0x7a, 0xff, 0xf2, 0xff, 0x56, 0x00, 0x30, 0x00, 0x14, 0x00, 0x84, 0x00, 0xf4, 0x00, 0xac, 0x00, 
-0x58, 0x00, 0x78, 0x00, 0x9f, 0x00, 0x88, 0x00, 0x18, 0x00, 0x97, 0xff, 0x42, 0xff, 0x1e, 0xff, 
-0x20, 0xff, 0x55, 0xff, 0x85, 0xff, 0x68, 0xff, 0x01, 0xff, 0xaa, 0xfe, 0xa7, 0xfe, 0xf7, 0xfe, 
-0x3f, 0xff, 0x6c, 0xff, 0x90, 0xff, 0xa4, 0xff, 0xa5, 0xff, 0xa9, 0xff, 0x9e, 0xff, 0xde, 0xff, 
-0x80, 0x00, 0xda, 0x00, 0x8b, 0x00, 0xe4, 0xff, 0xa6, 0xff, 0x3f, 0x00, 0xbc, 0x00, 0x81, 0x00, 
-0x3c, 0x00, 0xce, 0x00, 0x42, 0x01, 0x75, 0x00, 0x7e, 0xff, 0xe3, 0xff, 0xc9, 0x00, 0xbf, 0x00, 
-0x00, 0x00, 0x8b, 0xff, 0xe0, 0xff, 0x46, 0x00, 0x38, 0x00, 0xf6, 0xff, 0x0d, 0x00, 0x6e, 0x00, 
-0x9a, 0x00, 0x12, 0x00, 0x90, 0xff, 0xc4, 0xff, 0x57, 0x00, 0x68, 0x00, 0xfd, 0xff, 0xdf, 0xff, 
-0x20, 0x00, 0x29, 0x00, 0xca, 0xff, 0x8e, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xa9, 0xff, 
-0xbf, 0xff, 0x1c, 0x00, 0x20, 0x00, 0xd6, 0xff, 0xea, 0xff, 0x40, 0x00, 0x42, 0x00, 0x23, 0x00, 
-0x2e, 0x00, 0x33, 0x00, 0x2f, 0x00, 0x4e, 0x00, 0x5d, 0x00, 0x23, 0x00, 0x12, 0x00, 0x47, 0x00, 
-0x3a, 0x00, 0xf5, 0xff, 0xf0, 0xff, 0x17, 0x00, 0x2b, 0x00, 0x13, 0x00, 0xf4, 0xff, 0xf9, 0xff, 
-0x0b, 0x00, 0x08, 0x00, 0xff, 0xff, 0xf9, 0xff, 0x02, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xfc, 0xff, 
-0xef, 0xff, 0xe6, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0x05, 0x00, 0x09, 0x00, 
-0x08, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x04, 0x00, 0x09, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x19, 0x00, 
-0x0c, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x04, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x01, 0x00, 
-0xfd, 0xff, 0xf9, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf6, 0xff, 
-0x00, 0x00, 0x04, 0x00, 0xfc, 0xff, 0xfd, 0xff, 0x05, 0x00, 0xfe, 0xff, 0xf7, 0xff, 0xf1, 0xff, 
-0xef, 0xff, 0xff, 0xff, 0x12, 0x00, 0x0c, 0x00, 0xff, 0xff, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 
-0xf3, 0xff, 0xef, 0xff, 0x04, 0x00, 0x0e, 0x00, 0xfa, 0xff, 0xf1, 0xff, 0xfe, 0xff, 0x07, 0x00, 
-0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0xff, 0x01, 0x00, 
-0x0d, 0x00, 0x09, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 
-0xfa, 0xff, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x0b, 0x00, 0x05, 0x00, 
-0x04, 0x00, 0x05, 0x00, 0xfc, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x04, 0x00, 0xfc, 0xff, 
-};
-
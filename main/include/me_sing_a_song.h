@@ -1,919 +0,0 @@
-#include <stdio.h>
-const unsigned char me_sing_a_song[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x01, 0x00, 0x03, 0x00, 
-0x03, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x03, 0x00, 
-0x00, 0x00, 0xfb, 0xff, 0xfc, 0xff, 0x02, 0x00, 0x04, 0x00, 0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0xfd, 0xff, 0x00, 0x00, 0xfa, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xfb, 0xff, 0xfd, 0xff, 0xfe, 0xff, 
-0x03, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x05, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x07, 0x00, 0x14, 0x00, 0x0c, 0x00, 0xfa, 0xff, 0xef, 0xff, 0xe9, 0xff, 0xf3, 0xff, 0x01, 0x00, 
-0x0f, 0x00, 0x01, 0x00, 0xf9, 0xff, 0x0a, 0x00, 0x25, 0x00, 0x2a, 0x00, 0x16, 0x00, 0xf0, 0xff, 
-0xd1, 0xff, 0xee, 0xff, 0x09, 0x00, 0xfa, 0xff, 0xb0, 0xff, 0xd3, 0xff, 0x08, 0x00, 0xfa, 0xff, 
-0x16, 0x00, 0xf6, 0xff, 0xd8, 0xff, 0xef, 0xff, 0x12, 0x00, 0x0e, 0x00, 0xb6, 0xff, 0xdd, 0xff, 
-0xe2, 0xff, 0xfa, 0xff, 0x1f, 0x00, 0x15, 0x00, 0xfe, 0xff, 0xc9, 0xff, 0x14, 0x00, 0x04, 0x00, 
-0x13, 0x00, 0x0a, 0x00, 0xe3, 0xff, 0x30, 0x00, 0x02, 0x00, 0xf5, 0xff, 0x2a, 0x00, 0xf8, 0xff, 
-0x27, 0x00, 0x2c, 0x00, 0x1e, 0x00, 0xec, 0xff, 0x0f, 0x00, 0x18, 0x00, 0x08, 0x00, 0x32, 0x00, 
-0x0d, 0x00, 0x79, 0x00, 0xf6, 0xff, 0xee, 0xff, 0x38, 0x00, 0xf1, 0xff, 0xa7, 0xff, 0xbd, 0xff, 
-0x49, 0x00, 0x45, 0x00, 0x3f, 0x00, 0xe2, 0xff, 0x84, 0x00, 0x86, 0x00, 0xa6, 0xff, 0xbd, 0xff, 
-0x10, 0x00, 0x77, 0x00, 0x01, 0x00, 0xee, 0xff, 0x7a, 0x00, 0xb9, 0xff, 0x9c, 0xff, 0x25, 0x00, 
-0xd3, 0xff, 0xda, 0xff, 0x19, 0x00, 0xde, 0xff, 0xc6, 0xff, 0x7a, 0x00, 0xf3, 0xff, 0xc1, 0xff, 
-0x7c, 0x00, 0x1f, 0x00, 0x78, 0xff, 0xb7, 0xff, 0x77, 0x00, 0xd1, 0xff, 0x91, 0xff, 0x28, 0x00, 
-0xfe, 0xff, 0x17, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x1b, 0x00, 0xf5, 0xff, 0x49, 0x00, 0xb0, 0xff, 
-0xc1, 0xff, 0x30, 0x00, 0xa4, 0xff, 0x03, 0x00, 0x22, 0x00, 0xad, 0xff, 0x89, 0xff, 0xee, 0xff, 
-0x37, 0x00, 0x16, 0x00, 0x65, 0x00, 0x99, 0x00, 0x6d, 0x00, 0xc6, 0xff, 0xf1, 0xff, 0x3e, 0x00, 
-0x85, 0xff, 0x8d, 0xff, 0x2a, 0x00, 0x22, 0x00, 0xb7, 0xff, 0x7a, 0xff, 0x66, 0xff, 0xa5, 0x00, 
-0x5a, 0x00, 0x8b, 0xff, 0x61, 0x00, 0x41, 0x00, 0x3f, 0x00, 0x5d, 0x00, 0x99, 0xff, 0xb7, 0xff, 
-0x41, 0x00, 0xcc, 0xff, 0x09, 0x00, 0xc3, 0xff, 0xb4, 0x00, 0xdc, 0xff, 0x18, 0xff, 0xe6, 0x00, 
-0x20, 0x00, 0xcf, 0xff, 0x0c, 0x00, 0x3d, 0x00, 0xad, 0x00, 0x98, 0xff, 0x69, 0xff, 0xf1, 0x00, 
-0x3e, 0x00, 0x87, 0xff, 0x55, 0x00, 0x53, 0x00, 0x20, 0x00, 0x33, 0xff, 0x0a, 0x00, 0x1e, 0x01, 
-0xbe, 0xff, 0xb6, 0xff, 0x7a, 0x00, 0x68, 0x00, 0x12, 0x00, 0x93, 0xff, 0x16, 0x01, 0x68, 0x00, 
-0xac, 0xfe, 0xd2, 0x00, 0x04, 0x01, 0xa9, 0xff, 0xfc, 0xfe, 0xe4, 0x00, 0x32, 0x00, 0x6f, 0xfe, 
-0xc1, 0x00, 0xe6, 0xff, 0x8d, 0xff, 0x9a, 0xff, 0x77, 0x00, 0xb3, 0x00, 0x41, 0xff, 0x2c, 0x00, 
-0x7b, 0x00, 0xa6, 0xff, 0x27, 0x00, 0xba, 0x00, 0xd0, 0x00, 0x3e, 0x00, 0xbe, 0xff, 0x3c, 0x01, 
-0xb6, 0xff, 0x5f, 0xff, 0xa9, 0x00, 0x4b, 0xff, 0x43, 0xff, 0xd7, 0xff, 0x2f, 0x00, 0x28, 0x00, 
-0x64, 0x00, 0x87, 0x00, 0xbd, 0xff, 0xc0, 0xff, 0x18, 0x00, 0x1e, 0x00, 0xb5, 0xff, 0x6c, 0x00, 
-0xf1, 0xff, 0xf3, 0xff, 0xa6, 0x00, 0xb5, 0xff, 0x34, 0x00, 0xd5, 0xff, 0x35, 0x00, 0xfd, 0xff, 
-0x88, 0xff, 0x7c, 0x00, 0x9c, 0xff, 0x4d, 0x00, 0x2e, 0x00, 0x41, 0xff, 0x0b, 0x00, 0x14, 0x00, 
-0x53, 0x00, 0x7b, 0xff, 0x87, 0xff, 0xe6, 0xff, 0x1c, 0xff, 0x79, 0x00, 0xb6, 0x00, 0xd8, 0xff, 
-0xbe, 0x00, 0x70, 0x00, 0x08, 0x00, 0x4a, 0x00, 0xf3, 0xff, 0x2b, 0x00, 0x9b, 0xff, 0xf2, 0xff, 
-0xe5, 0xff, 0x80, 0xff, 0x2c, 0x00, 0x05, 0x00, 0x90, 0xff, 0x24, 0x00, 0x14, 0x00, 0xef, 0xff, 
-0xd4, 0xff, 0x7c, 0xff, 0x43, 0x00, 0x3a, 0x00, 0x11, 0x00, 0xff, 0xff, 0xf1, 0xff, 0x37, 0x00, 
-0x05, 0x00, 0xef, 0xff, 0xbe, 0xff, 0xc7, 0xff, 0xdb, 0xff, 0x2a, 0x00, 0x79, 0x00, 0x7b, 0xff, 
-0xd9, 0xff, 0xe3, 0xff, 0xf2, 0xff, 0x34, 0x00, 0xa2, 0xff, 0xfb, 0xff, 0x1b, 0x00, 0xfa, 0xff, 
-0xc0, 0xff, 0x17, 0x00, 0x5f, 0x00, 0x06, 0x00, 0xa9, 0xff, 0xbd, 0x00, 0x54, 0x00, 0xf2, 0xff, 
-0x7f, 0x00, 0xf8, 0xff, 0xef, 0xff, 0xa9, 0xff, 0x6b, 0xff, 0xf3, 0xff, 0x10, 0x00, 0xb3, 0xff, 
-0xcd, 0xff, 0x03, 0x00, 0xa1, 0xff, 0x89, 0xff, 0x86, 0x00, 0xbb, 0xff, 0x36, 0x00, 0xa0, 0x00, 
-0x1c, 0x00, 0x78, 0x00, 0x0f, 0x00, 0xa2, 0x00, 0x58, 0xff, 0x6d, 0x00, 0x82, 0x00, 0x05, 0xff, 
-0xe8, 0x00, 0x3a, 0xff, 0x1c, 0x00, 0xd3, 0xff, 0x26, 0xff, 0x7c, 0x00, 0xb7, 0xff, 0x24, 0x00, 
-0x8e, 0xff, 0x8d, 0x00, 0x3e, 0x00, 0xb5, 0xff, 0x52, 0x00, 0x32, 0x00, 0x54, 0x00, 0xad, 0xff, 
-0x4f, 0x00, 0x37, 0x00, 0x80, 0xff, 0x57, 0x00, 0x37, 0x00, 0xf4, 0xff, 0xbc, 0xff, 0xe6, 0xff, 
-0x6b, 0x00, 0x55, 0xff, 0x12, 0x00, 0x28, 0x00, 0xbd, 0xff, 0x50, 0x00, 0x9b, 0xff, 0xae, 0xff, 
-0x8c, 0xff, 0x47, 0x00, 0x69, 0x00, 0x84, 0xff, 0x06, 0x00, 0xd0, 0xff, 0xdc, 0xff, 0x0e, 0x00, 
-0x63, 0x00, 0x42, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x13, 0x00, 0x24, 0x00, 0xb7, 0xff, 0x17, 0x00, 
-0x4b, 0x00, 0xf0, 0xff, 0xa3, 0xff, 0xc9, 0xff, 0x99, 0x00, 0xb4, 0xff, 0x2b, 0xff, 0x1d, 0x00, 
-0x0b, 0x00, 0x76, 0xff, 0xee, 0xff, 0x9f, 0x00, 0x56, 0xff, 0x25, 0x00, 0x26, 0x00, 0x6e, 0xff, 
-0x3e, 0x00, 0x45, 0x00, 0xee, 0xff, 0xb0, 0xff, 0x4d, 0x00, 0xa1, 0xff, 0xa1, 0xff, 0x1c, 0x00, 
-0x3f, 0x00, 0x61, 0xff, 0xd8, 0xff, 0xf9, 0xff, 0x3e, 0xff, 0x7d, 0xff, 0xec, 0xff, 0x46, 0x00, 
-0xde, 0xff, 0xa5, 0x00, 0xba, 0xff, 0xe6, 0xff, 0x75, 0x00, 0x5b, 0x00, 0xaf, 0xff, 0xfa, 0xff, 
-0x49, 0x00, 0x79, 0xff, 0x26, 0x00, 0x27, 0x00, 0x5f, 0x00, 0xe6, 0xff, 0xe1, 0xff, 0xcb, 0xff, 
-0x23, 0x00, 0xd0, 0xff, 0xbc, 0xff, 0xde, 0xff, 0xf0, 0xff, 0x3c, 0x00, 0x65, 0xff, 0x2f, 0x00, 
-0xcb, 0xff, 0xf4, 0xff, 0xd9, 0xff, 0xb9, 0xff, 0xcc, 0xff, 0xe4, 0xff, 0x6b, 0x00, 0xf6, 0xff, 
-0x3b, 0x00, 0xb5, 0xff, 0x41, 0x00, 0x90, 0xff, 0xb3, 0xff, 0x5b, 0x00, 0xc6, 0xff, 0x3c, 0x00, 
-0xe2, 0xff, 0x04, 0x00, 0xb0, 0xff, 0xef, 0xff, 0x34, 0x00, 0xd5, 0xff, 0xc8, 0xff, 0x4f, 0x00, 
-0x36, 0x00, 0xe5, 0xff, 0xca, 0xff, 0xd3, 0xff, 0x6d, 0x00, 0x51, 0x00, 0x38, 0x00, 0xbf, 0xff, 
-0x0a, 0x00, 0x81, 0x00, 0xf3, 0xff, 0xc9, 0xff, 0x77, 0x00, 0x50, 0x00, 0xd8, 0xff, 0x1c, 0x00, 
-0x50, 0x00, 0x9f, 0xff, 0x3c, 0x00, 0xe1, 0xff, 0x11, 0x00, 0x74, 0x00, 0xb0, 0xff, 0x55, 0x00, 
-0xe6, 0xff, 0xdf, 0xff, 0xd7, 0xff, 0x49, 0x00, 0xd8, 0xff, 0xae, 0xff, 0x45, 0x00, 0xde, 0xff, 
-0x3b, 0x00, 0x4f, 0x00, 0x9b, 0xff, 0x12, 0x00, 0x40, 0x00, 0xee, 0xff, 0x0c, 0x00, 0xe7, 0xff, 
-0x48, 0x00, 0xaa, 0xff, 0xc9, 0xff, 0x33, 0x00, 0x10, 0x00, 0x2f, 0x00, 0x14, 0x00, 0xbc, 0xff, 
-0x8f, 0xff, 0x17, 0x00, 0xd4, 0xff, 0xf8, 0xff, 0x9f, 0x00, 0x10, 0x00, 0x2e, 0x00, 0xb1, 0xff, 
-0xd6, 0xff, 0x6f, 0x00, 0x1d, 0x00, 0x10, 0x00, 0x8f, 0xff, 0x83, 0xff, 0x26, 0x00, 0x61, 0x00, 
-0xc1, 0xff, 0x52, 0x00, 0x1b, 0x00, 0xb2, 0xff, 0x18, 0x00, 0xfe, 0xff, 0x18, 0x00, 0x52, 0x00, 
-0xdd, 0xff, 0xeb, 0xff, 0x59, 0x00, 0xda, 0xff, 0xb6, 0xff, 0xce, 0xff, 0x43, 0x00, 0x12, 0x00, 
-0xc2, 0xff, 0x16, 0x00, 0x13, 0x00, 0xcd, 0xff, 0xdd, 0xff, 0x51, 0x00, 0x77, 0x00, 0xf6, 0xff, 
-0xe8, 0xff, 0xeb, 0xff, 0xea, 0xff, 0x63, 0x00, 0x24, 0x00, 0x2b, 0x00, 0xa5, 0xff, 0xd9, 0xff, 
-0xe7, 0xff, 0x19, 0x00, 0x52, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xb3, 0xff, 0x39, 0x00, 0xdb, 0xff, 
-0xcd, 0xff, 0x15, 0x00, 0xeb, 0xff, 0xfb, 0xff, 0x02, 0x00, 0xec, 0xff, 0x6c, 0x00, 0xd3, 0xff, 
-0xe2, 0xff, 0xe3, 0xff, 0xe2, 0xff, 0x18, 0x00, 0x54, 0x00, 0x3d, 0x00, 0xed, 0xff, 0xdc, 0xff, 
-0xc7, 0xff, 0x45, 0x01, 0x9b, 0xff, 0x2d, 0x00, 0x12, 0x00, 0xa3, 0xff, 0x06, 0x00, 0x6a, 0xff, 
-0x6f, 0x00, 0x99, 0xff, 0xe2, 0xff, 0x8d, 0xff, 0x3e, 0x00, 0x35, 0x00, 0xe2, 0xff, 0x35, 0x00, 
-0xa5, 0xff, 0x00, 0x00, 0xa6, 0xff, 0xfc, 0xff, 0x07, 0x00, 0xb6, 0xff, 0x26, 0x00, 0xe2, 0xff, 
-0xf5, 0xff, 0x5e, 0x00, 0xd5, 0xff, 0xf6, 0x00, 0xdf, 0x01, 0x74, 0xff, 0xa5, 0xff, 0xd4, 0xff, 
-0x48, 0x00, 0x68, 0xff, 0x9c, 0xff, 0x99, 0x00, 0xd8, 0xfe, 0x22, 0x00, 0xae, 0xff, 0x42, 0x00, 
-0xb7, 0xff, 0x10, 0x00, 0xd2, 0x00, 0xc7, 0xff, 0x74, 0x00, 0x18, 0x00, 0x0a, 0x00, 0xc3, 0xff, 
-0xf6, 0xff, 0x6c, 0x00, 0xfe, 0xff, 0x70, 0xff, 0x42, 0x00, 0xaf, 0xff, 0x72, 0xff, 0xa1, 0xff, 
-0xca, 0xff, 0xfc, 0xff, 0xa0, 0xff, 0x0b, 0x00, 0xff, 0xff, 0x80, 0x00, 0x11, 0x00, 0xc9, 0xff, 
-0xcd, 0xff, 0x58, 0xff, 0xeb, 0xff, 0xc9, 0xff, 0x1f, 0x00, 0xa8, 0x00, 0x65, 0x00, 0xd0, 0xff, 
-0x9c, 0xff, 0xee, 0xff, 0x77, 0xff, 0x94, 0x00, 0xa0, 0x00, 0x21, 0x00, 0xd8, 0xff, 0x9b, 0xff, 
-0x77, 0x00, 0xe7, 0xff, 0x20, 0x00, 0x59, 0x00, 0xc7, 0xff, 0x22, 0x00, 0x7d, 0xff, 0xfa, 0xff, 
-0x00, 0x00, 0x91, 0xff, 0xd1, 0x00, 0x6e, 0x00, 0xf1, 0xff, 0x56, 0x00, 0x7d, 0xff, 0x13, 0x00, 
-0x5f, 0x00, 0x63, 0xff, 0xee, 0x00, 0xf2, 0xff, 0x47, 0xff, 0xcc, 0xff, 0x03, 0x00, 0x96, 0x00, 
-0xcc, 0xff, 0xba, 0x00, 0x46, 0x00, 0x92, 0xff, 0x2a, 0x00, 0xf9, 0xff, 0x5e, 0x00, 0x94, 0x00, 
-0xcc, 0xff, 0x76, 0xff, 0x6c, 0xff, 0xda, 0xff, 0x13, 0x00, 0x5b, 0x00, 0xb8, 0x00, 0xef, 0xff, 
-0xca, 0xff, 0xc7, 0xff, 0xd9, 0xff, 0x17, 0x00, 0x81, 0xff, 0x23, 0x00, 0x60, 0x00, 0xf9, 0xff, 
-0xba, 0xff, 0xa9, 0xff, 0xd8, 0xff, 0x31, 0x00, 0xb8, 0x00, 0xc3, 0xff, 0x16, 0x00, 0x2c, 0x00, 
-0x72, 0x00, 0xfc, 0xff, 0x80, 0xff, 0x2e, 0x00, 0x7e, 0xff, 0x0f, 0x00, 0x2e, 0x00, 0x9e, 0xff, 
-0x5a, 0x00, 0x37, 0x00, 0x0f, 0x00, 0xf7, 0xff, 0xb1, 0xff, 0x32, 0x00, 0x11, 0x00, 0xc0, 0xff, 
-0xff, 0xff, 0x3a, 0x00, 0xf8, 0xff, 0x5a, 0x00, 0x9c, 0x00, 0xa2, 0xff, 0x1f, 0x00, 0xf5, 0xff, 
-0xeb, 0xff, 0x88, 0x00, 0xc2, 0xff, 0xf5, 0xff, 0xe2, 0xff, 0x2a, 0xff, 0xcb, 0xff, 0x64, 0x00, 
-0x03, 0x00, 0xf2, 0xff, 0x2f, 0x00, 0xf6, 0xff, 0xa1, 0xff, 0x0d, 0x01, 0x99, 0x00, 0xdb, 0xff, 
-0x39, 0x00, 0x0e, 0x00, 0xa8, 0xff, 0x80, 0x00, 0xec, 0x00, 0xda, 0xff, 0xcb, 0xff, 0x11, 0x00, 
-0x1f, 0x00, 0x54, 0xff, 0xc9, 0xff, 0x82, 0x00, 0x15, 0x00, 0xa3, 0xff, 0x1c, 0x00, 0x45, 0x00, 
-0x67, 0xff, 0x0e, 0x00, 0xba, 0x00, 0x6c, 0xff, 0xa9, 0xff, 0x72, 0x00, 0x73, 0x00, 0x32, 0x00, 
-0x3f, 0x00, 0x20, 0x00, 0x0c, 0x00, 0x35, 0x00, 0x9c, 0xff, 0xe5, 0xff, 0xb8, 0xff, 0xd4, 0xff, 
-0x05, 0x00, 0xb1, 0xff, 0x08, 0x00, 0x25, 0x00, 0xe8, 0xff, 0x93, 0x00, 0xf5, 0xff, 0xa2, 0xff, 
-0x1c, 0x00, 0x1f, 0x00, 0x41, 0x00, 0x3f, 0x00, 0xfe, 0xff, 0x66, 0x00, 0x4e, 0x00, 0x20, 0x00, 
-0x73, 0x00, 0x13, 0x00, 0xbb, 0xff, 0x49, 0x00, 0x56, 0x00, 0xab, 0xff, 0xe9, 0xff, 0x39, 0x00, 
-0x75, 0xff, 0xef, 0xff, 0xbb, 0x00, 0x7d, 0xff, 0xf7, 0xff, 0x51, 0x00, 0xc7, 0xff, 0x4b, 0x00, 
-0x10, 0x00, 0x92, 0xff, 0xdf, 0xff, 0xaa, 0xff, 0x46, 0x00, 0x1d, 0x00, 0xd5, 0xff, 0x41, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xea, 0xff, 0x45, 0x00, 0x72, 0x00, 0x84, 0x00, 0xe5, 0xfe, 0xef, 0xff, 
-0x0a, 0x00, 0x35, 0x00, 0x2f, 0x00, 0x66, 0xff, 0x50, 0x00, 0xea, 0xff, 0xec, 0xff, 0x22, 0x00, 
-0x10, 0xff, 0xb5, 0xff, 0xd3, 0xff, 0x20, 0x00, 0xd1, 0xff, 0xa1, 0x00, 0xbe, 0x00, 0xbf, 0xff, 
-0x70, 0x00, 0x49, 0x00, 0x11, 0x00, 0x84, 0x00, 0xf6, 0xff, 0xa7, 0xff, 0x40, 0x00, 0x03, 0x00, 
-0xcd, 0xff, 0x3f, 0xff, 0xb7, 0x00, 0x88, 0x00, 0xbb, 0xff, 0x9c, 0xff, 0xe8, 0xff, 0x15, 0x00, 
-0x58, 0x00, 0x54, 0x00, 0x04, 0xff, 0xf8, 0xff, 0x39, 0x00, 0x2a, 0xff, 0x6d, 0x00, 0x85, 0x00, 
-0x0a, 0x00, 0x1f, 0x00, 0xc9, 0xff, 0xe6, 0xff, 0x33, 0x00, 0xdf, 0xff, 0x8c, 0xff, 0x95, 0x00, 
-0xd7, 0xff, 0xce, 0xff, 0x68, 0xff, 0x3a, 0x00, 0xbf, 0x00, 0xa3, 0xff, 0x8d, 0x00, 0x49, 0x00, 
-0x0f, 0x00, 0x8f, 0x00, 0xbf, 0xff, 0x81, 0xff, 0xf3, 0xff, 0x49, 0x00, 0xaa, 0xff, 0x70, 0x00, 
-0x60, 0x00, 0xf0, 0xfe, 0xcb, 0xff, 0xab, 0xff, 0x49, 0x00, 0x4e, 0x00, 0xee, 0xff, 0x37, 0x00, 
-0x8c, 0xff, 0x99, 0xff, 0x48, 0xff, 0x74, 0xff, 0xe4, 0x00, 0x16, 0x00, 0x5f, 0x00, 0x94, 0x00, 
-0x68, 0xff, 0x06, 0x00, 0xf1, 0xff, 0x02, 0x00, 0x88, 0xff, 0x82, 0xff, 0x05, 0x00, 0x8f, 0xff, 
-0x87, 0x00, 0x06, 0x00, 0xd1, 0xff, 0x6d, 0x00, 0x1a, 0xff, 0x9f, 0xff, 0x2e, 0x00, 0x56, 0xff, 
-0xbb, 0xff, 0xf4, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0x90, 0xff, 0xa0, 0x00, 0x01, 0x00, 0x08, 0x00, 
-0x60, 0x00, 0x53, 0xff, 0x33, 0x00, 0x7d, 0xff, 0xaa, 0xff, 0x78, 0x00, 0x4b, 0xff, 0x2c, 0x00, 
-0x13, 0x00, 0xf4, 0xff, 0x6f, 0x00, 0x24, 0x00, 0x10, 0x00, 0xd9, 0xff, 0xb9, 0xff, 0x51, 0x00, 
-0x19, 0x00, 0x82, 0x00, 0xcb, 0xff, 0xca, 0xff, 0x93, 0xff, 0x62, 0xff, 0xe5, 0x00, 0x29, 0x00, 
-0x50, 0x00, 0xe9, 0xff, 0x01, 0x00, 0xe1, 0xff, 0xdb, 0xff, 0xc8, 0xff, 0xab, 0xff, 0x92, 0xff, 
-0x3a, 0x00, 0x10, 0xff, 0xd7, 0xff, 0xa7, 0x00, 0x8d, 0xff, 0xda, 0xff, 0xda, 0xff, 0x01, 0x00, 
-0xd5, 0xff, 0xdc, 0xff, 0xdd, 0xff, 0x81, 0xff, 0xb5, 0xff, 0x76, 0xff, 0x10, 0x00, 0xb6, 0xff, 
-0x81, 0x00, 0x9e, 0xff, 0x88, 0xfe, 0xa0, 0x01, 0x4b, 0xff, 0x0e, 0xff, 0x71, 0x00, 0xeb, 0x00, 
-0x41, 0x00, 0x08, 0x00, 0xa0, 0x01, 0xc5, 0xff, 0xbd, 0xff, 0x93, 0x00, 0x32, 0x00, 0xbf, 0xff, 
-0xbd, 0xfe, 0xec, 0xff, 0x41, 0x00, 0x90, 0xff, 0x5a, 0x01, 0xc0, 0xff, 0xa4, 0xff, 0xb1, 0x00, 
-0xf5, 0xfe, 0xe2, 0x00, 0x16, 0x00, 0x13, 0x00, 0x23, 0x00, 0x1d, 0x00, 0x8c, 0xff, 0x91, 0xff, 
-0x0a, 0x01, 0x5b, 0xff, 0x6c, 0x00, 0x1c, 0x00, 0x32, 0xff, 0xcb, 0xff, 0xa6, 0xff, 0xce, 0x00, 
-0x8d, 0xff, 0x2f, 0x00, 0xab, 0xff, 0x07, 0xff, 0x2a, 0x00, 0xe5, 0xfe, 0x47, 0x00, 0xe8, 0x00, 
-0xb9, 0xff, 0x41, 0x00, 0x26, 0x01, 0xce, 0xff, 0x87, 0xff, 0xcf, 0x00, 0x14, 0x00, 0x5f, 0xfe, 
-0xfc, 0xff, 0x7e, 0x00, 0x86, 0x00, 0x0a, 0x00, 0x33, 0x00, 0x27, 0x01, 0x0b, 0xff, 0x7a, 0xff, 
-0x4a, 0x01, 0xdc, 0xff, 0xc9, 0xfe, 0x76, 0xff, 0xb1, 0x00, 0x12, 0xff, 0x01, 0xff, 0x74, 0x01, 
-0xc3, 0x00, 0xc8, 0xfe, 0xbf, 0xff, 0xac, 0x00, 0x0f, 0x00, 0xb2, 0xfe, 0x65, 0x01, 0xfa, 0x02, 
-0xbb, 0xff, 0xa6, 0x02, 0xa8, 0x03, 0xae, 0x01, 0xc6, 0xff, 0xb0, 0xff, 0x3e, 0xff, 0x7c, 0xfe, 
-0x6f, 0xff, 0x82, 0xfd, 0x16, 0xfe, 0x15, 0xfe, 0x03, 0xfd, 0xca, 0xfe, 0x3b, 0x00, 0xdf, 0xff, 
-0xf3, 0xff, 0x26, 0x01, 0x2d, 0x02, 0x04, 0x01, 0x0b, 0x00, 0xca, 0x00, 0xb5, 0xff, 0x17, 0x00, 
-0xf3, 0xfe, 0x9a, 0xff, 0xef, 0xff, 0x8d, 0xfe, 0x8b, 0x01, 0xf3, 0x02, 0x7f, 0x02, 0x54, 0x02, 
-0xc2, 0x02, 0x24, 0x02, 0x74, 0x00, 0x51, 0x01, 0x44, 0x00, 0x1d, 0xff, 0x85, 0xfe, 0xef, 0xfe, 
-0x29, 0xff, 0xa5, 0xfd, 0xc2, 0xfd, 0x78, 0xfd, 0x5d, 0xfb, 0x65, 0xfa, 0xca, 0xfb, 0x5d, 0xfb, 
-0x48, 0xfb, 0x0c, 0xfc, 0x40, 0xfe, 0xb6, 0xfd, 0xc6, 0xfe, 0x57, 0x01, 0xf2, 0x00, 0x1e, 0x01, 
-0xff, 0x01, 0x4e, 0x03, 0xd2, 0x02, 0xf7, 0x03, 0xa8, 0x04, 0x2c, 0x03, 0xe0, 0x01, 0x6a, 0x01, 
-0x88, 0x01, 0x7d, 0x00, 0x3c, 0x00, 0xcb, 0x00, 0x86, 0xff, 0x33, 0xff, 0x9c, 0xff, 0x93, 0xff, 
-0xb8, 0xff, 0xd7, 0xff, 0x0f, 0x00, 0x77, 0xff, 0x74, 0x00, 0xb7, 0xff, 0x19, 0xfe, 0xb0, 0xfe, 
-0x2e, 0xfd, 0xac, 0xfc, 0x2a, 0xfc, 0x52, 0xfc, 0x49, 0xfc, 0xdc, 0xfb, 0x1a, 0xfe, 0xaa, 0xfd, 
-0x1d, 0xff, 0x09, 0x01, 0xe0, 0x01, 0x51, 0x03, 0x6b, 0x04, 0x6f, 0x06, 0x2e, 0x06, 0xf6, 0x07, 
-0xef, 0x08, 0x25, 0x08, 0xa0, 0x09, 0x8c, 0x08, 0x6c, 0x08, 0xbd, 0x07, 0xb0, 0x06, 0xad, 0x05, 
-0xb0, 0x02, 0x16, 0x02, 0x93, 0x00, 0xb4, 0xfd, 0x8e, 0xfc, 0xaf, 0xfa, 0xdf, 0xf7, 0x3c, 0xf6, 
-0xb5, 0xf4, 0x48, 0xf2, 0x32, 0xf1, 0x15, 0xf0, 0x47, 0xee, 0x8d, 0xef, 0x03, 0xf1, 0x50, 0xf2, 
-0x27, 0xf7, 0x7f, 0xfb, 0x36, 0x00, 0x6b, 0x04, 0x3d, 0x09, 0x03, 0x0d, 0xe0, 0x0d, 0x83, 0x11, 
-0x11, 0x11, 0xcb, 0x0f, 0x6c, 0x0f, 0xea, 0x0d, 0xf8, 0x0b, 0xf3, 0x09, 0x99, 0x09, 0xa7, 0x06, 
-0xec, 0x04, 0x74, 0x04, 0x33, 0x01, 0xa2, 0x00, 0x46, 0xfe, 0x3b, 0xfd, 0xac, 0xfc, 0x8d, 0xfa, 
-0xfc, 0xfa, 0x8b, 0xf7, 0xbc, 0xf7, 0xd8, 0xf5, 0x6f, 0xf3, 0x1f, 0xf2, 0xc6, 0xed, 0x7d, 0xec, 
-0xb0, 0xea, 0xc6, 0xeb, 0xe4, 0xee, 0xe6, 0xf2, 0x3c, 0xf8, 0x62, 0xfd, 0x4f, 0x02, 0x37, 0x07, 
-0x6a, 0x0a, 0x9f, 0x0d, 0xb9, 0x0e, 0xeb, 0x0e, 0x9d, 0x0f, 0x68, 0x0e, 0x3e, 0x0d, 0x44, 0x0c, 
-0xd6, 0x0b, 0x01, 0x0a, 0x31, 0x09, 0xa2, 0x07, 0x2f, 0x06, 0xc3, 0x04, 0x3f, 0x03, 0xcc, 0x00, 
-0x99, 0x00, 0x17, 0xff, 0xf1, 0xfc, 0x96, 0xfe, 0x72, 0xfd, 0x1f, 0xfd, 0xb3, 0xfd, 0x35, 0xfc, 
-0xa5, 0xf9, 0x06, 0xf8, 0xc6, 0xf3, 0xc1, 0xef, 0xab, 0xeb, 0x30, 0xeb, 0x3b, 0xeb, 0x5e, 0xec, 
-0xf1, 0xf2, 0xa7, 0xf6, 0xe9, 0xfc, 0x6d, 0x02, 0xf6, 0x07, 0x6b, 0x0a, 0x81, 0x0c, 0x4a, 0x0f, 
-0x34, 0x0d, 0x15, 0x0e, 0xe1, 0x0e, 0xc2, 0x0d, 0x52, 0x0d, 0xe6, 0x0c, 0xda, 0x0b, 0x95, 0x0a, 
-0x1e, 0x08, 0x25, 0x07, 0xe9, 0x03, 0xeb, 0x01, 0xac, 0x01, 0xce, 0xfe, 0x9c, 0xfd, 0x2b, 0xfe, 
-0xde, 0xfd, 0xed, 0xfc, 0xe5, 0xff, 0x74, 0xff, 0xde, 0xff, 0x3f, 0xff, 0x57, 0xfd, 0x7c, 0xf9, 
-0x1c, 0xf4, 0xfc, 0xee, 0x2e, 0xe6, 0xba, 0xe7, 0xeb, 0xe4, 0x5e, 0xe8, 0x4f, 0xef, 0x4e, 0xf3, 
-0x7e, 0xfd, 0xfd, 0xff, 0x0f, 0x09, 0x48, 0x0b, 0x6c, 0x0c, 0xb3, 0x10, 0x34, 0x0e, 0xe2, 0x0f, 
-0x30, 0x0f, 0xf1, 0x10, 0x8b, 0x0f, 0xb8, 0x0e, 0xf3, 0x0f, 0x1c, 0x0a, 0x8b, 0x09, 0x54, 0x06, 
-0xc5, 0x01, 0xc9, 0x01, 0x71, 0xfe, 0xf3, 0xfd, 0x4a, 0xfc, 0x10, 0xfc, 0x04, 0xfe, 0xe7, 0xfc, 
-0xc5, 0xff, 0x4e, 0x01, 0xe8, 0xff, 0x89, 0x00, 0x9f, 0xff, 0xfd, 0xfb, 0x78, 0xf6, 0xf9, 0xf1, 
-0xa1, 0xe8, 0xf7, 0xe2, 0xac, 0xe5, 0xe3, 0xe3, 0x3e, 0xe9, 0xae, 0xf1, 0x8a, 0xf8, 0x90, 0xfe, 
-0x29, 0x05, 0x91, 0x0b, 0x9b, 0x0b, 0xc6, 0x0f, 0x42, 0x11, 0xf4, 0x0f, 0x18, 0x11, 0x4f, 0x11, 
-0x85, 0x11, 0x97, 0x0f, 0x38, 0x0f, 0x29, 0x0e, 0xb3, 0x08, 0xd5, 0x07, 0x02, 0x05, 0xc9, 0x00, 
-0xb5, 0xff, 0xe1, 0xfc, 0xf8, 0xfa, 0x88, 0xf9, 0x2e, 0xfc, 0x7b, 0xfb, 0x3f, 0xfd, 0xb4, 0x01, 
-0x92, 0x00, 0x7c, 0x02, 0x97, 0x02, 0x73, 0x00, 0x2d, 0xfc, 0x9a, 0xf6, 0x94, 0xf0, 0x3a, 0xe6, 
-0x09, 0xe4, 0x43, 0xe6, 0x50, 0xe4, 0x23, 0xec, 0x59, 0xf5, 0x68, 0xf9, 0x22, 0x00, 0x2b, 0x08, 
-0x62, 0x0a, 0x82, 0x0b, 0x73, 0x11, 0xb8, 0x0f, 0xa9, 0x0f, 0x8d, 0x12, 0xb2, 0x11, 0x55, 0x11, 
-0xb2, 0x0f, 0x3d, 0x0f, 0x14, 0x0b, 0x8e, 0x07, 0x71, 0x06, 0x60, 0x02, 0x77, 0xff, 0x10, 0xfd, 
-0x83, 0xfb, 0xbe, 0xf8, 0x80, 0xf9, 0x55, 0xfc, 0xc6, 0xfc, 0x82, 0x00, 0x86, 0x03, 0x0e, 0x04, 
-0xdc, 0x03, 0xdd, 0x04, 0xbb, 0x00, 0xf9, 0xfc, 0xa9, 0xf7, 0xf9, 0xee, 0xa2, 0xe7, 0x45, 0xe2, 
-0xbd, 0xe3, 0xb8, 0xe1, 0x75, 0xe9, 0x30, 0xf1, 0x9e, 0xf5, 0x62, 0xfe, 0xb1, 0x04, 0xd8, 0x09, 
-0xcc, 0x0a, 0x63, 0x12, 0xb2, 0x10, 0xeb, 0x10, 0x25, 0x16, 0xe8, 0x11, 0xa7, 0x13, 0x40, 0x13, 
-0x64, 0x0e, 0x6c, 0x0c, 0x56, 0x09, 0x55, 0x04, 0x31, 0x02, 0xad, 0xff, 0x8e, 0xfc, 0x05, 0xfa, 
-0x68, 0xfa, 0x0b, 0xf9, 0x56, 0xf9, 0x77, 0xfe, 0x09, 0xff, 0x4e, 0x01, 0x02, 0x06, 0x0d, 0x06, 
-0x84, 0x05, 0xee, 0x05, 0xda, 0x01, 0xa9, 0xfb, 0x36, 0xf5, 0xfb, 0xee, 0x5f, 0xe4, 0x6a, 0xe3, 
-0x6a, 0xe2, 0xbb, 0xe1, 0xc5, 0xec, 0xad, 0xef, 0x76, 0xf8, 0x3c, 0xff, 0x85, 0x04, 0xe0, 0x09, 
-0xb9, 0x0c, 0xf3, 0x11, 0xfa, 0x0f, 0x7e, 0x13, 0xe3, 0x13, 0x05, 0x12, 0x3d, 0x14, 0x05, 0x11, 
-0xc8, 0x0d, 0x09, 0x0c, 0x0c, 0x07, 0x8c, 0x03, 0x81, 0x02, 0xf5, 0xfd, 0xda, 0xfb, 0x31, 0xfb, 
-0x05, 0xf9, 0x68, 0xf9, 0x63, 0xfc, 0x64, 0xfe, 0xb1, 0x00, 0x8e, 0x04, 0x8f, 0x06, 0x32, 0x07, 
-0xc3, 0x07, 0x3d, 0x06, 0x74, 0x01, 0x10, 0xfc, 0x42, 0xf5, 0xbb, 0xed, 0x44, 0xe5, 0x94, 0xe3, 
-0x98, 0xe1, 0xda, 0xe1, 0x24, 0xeb, 0x30, 0xee, 0x9c, 0xf5, 0x16, 0xfe, 0x0a, 0x01, 0x13, 0x07, 
-0xea, 0x0b, 0x4c, 0x0e, 0x2d, 0x11, 0xd2, 0x13, 0xd3, 0x14, 0x42, 0x14, 0x9e, 0x15, 0x3a, 0x12, 
-0x7f, 0x0e, 0x27, 0x0d, 0x9f, 0x06, 0x4c, 0x04, 0x93, 0x02, 0x2b, 0xfe, 0x0d, 0xfd, 0xc2, 0xfb, 
-0x59, 0xf9, 0xd1, 0xfa, 0xe3, 0xfb, 0x62, 0xfd, 0x17, 0x01, 0xf8, 0x02, 0x17, 0x05, 0xf1, 0x06, 
-0x41, 0x06, 0x02, 0x05, 0xa1, 0x02, 0x00, 0xfd, 0x5e, 0xf7, 0xf1, 0xf1, 0x12, 0xe9, 0xbd, 0xe5, 
-0xb2, 0xe4, 0x0e, 0xe2, 0xd7, 0xe9, 0x9f, 0xed, 0x5a, 0xf2, 0x52, 0xfb, 0x51, 0xfe, 0x32, 0x04, 
-0x61, 0x09, 0x7e, 0x0c, 0x0b, 0x10, 0x3d, 0x12, 0x46, 0x14, 0x93, 0x14, 0x6f, 0x14, 0x01, 0x13, 
-0x5e, 0x0f, 0xbb, 0x0c, 0x21, 0x08, 0x5a, 0x05, 0x9b, 0x03, 0x9a, 0x00, 0x6e, 0xff, 0xa2, 0xfd, 
-0xc9, 0xfb, 0x90, 0xfc, 0x82, 0xfc, 0x0d, 0xfe, 0x2e, 0x00, 0x72, 0x01, 0x95, 0x03, 0xe5, 0x04, 
-0xcc, 0x05, 0xab, 0x04, 0x25, 0x03, 0xc3, 0xfe, 0x5f, 0xfa, 0xcd, 0xf4, 0x7c, 0xed, 0xc0, 0xe8, 
-0x21, 0xe5, 0x08, 0xe3, 0x6c, 0xe6, 0x0c, 0xeb, 0xe8, 0xee, 0x2c, 0xf7, 0x7a, 0xfb, 0x60, 0x00, 
-0x68, 0x07, 0x45, 0x09, 0x2b, 0x0e, 0x6a, 0x10, 0x7a, 0x11, 0xff, 0x13, 0xee, 0x12, 0xd2, 0x13, 
-0x2d, 0x11, 0xd1, 0x0e, 0xe1, 0x0b, 0x9c, 0x07, 0x00, 0x06, 0x7a, 0x03, 0x0c, 0x01, 0x23, 0xff, 
-0xda, 0xfd, 0x1a, 0xfc, 0x4c, 0xfc, 0x70, 0xfd, 0x09, 0xfe, 0xe3, 0xff, 0xde, 0x01, 0x9f, 0x02, 
-0x62, 0x04, 0xfa, 0x04, 0x8a, 0x03, 0x3a, 0x01, 0x12, 0xfe, 0x02, 0xf9, 0x3e, 0xf4, 0x97, 0xee, 
-0xcc, 0xe9, 0xbd, 0xe6, 0x48, 0xe5, 0x40, 0xe8, 0x79, 0xeb, 0x48, 0xf1, 0xcc, 0xf6, 0x2f, 0xfc, 
-0x99, 0x01, 0xf5, 0x05, 0x54, 0x0a, 0x37, 0x0d, 0x81, 0x0f, 0x4c, 0x12, 0x40, 0x13, 0xc6, 0x13, 
-0xd1, 0x13, 0x8c, 0x10, 0xda, 0x0e, 0x7b, 0x0b, 0xa6, 0x07, 0xa3, 0x06, 0x24, 0x03, 0x00, 0x01, 
-0xd5, 0xff, 0xc0, 0xfc, 0x65, 0xfc, 0x7e, 0xfb, 0xca, 0xfb, 0xea, 0xfc, 0x30, 0xfe, 0xf5, 0xff, 
-0x7a, 0x01, 0x60, 0x03, 0x2d, 0x03, 0x3f, 0x03, 0x1a, 0x01, 0x41, 0xfe, 0x49, 0xfb, 0x56, 0xf6, 
-0xd1, 0xf0, 0x22, 0xec, 0x69, 0xe7, 0xf7, 0xe5, 0xcd, 0xe7, 0xf2, 0xe9, 0xd2, 0xee, 0xc7, 0xf3, 
-0xe4, 0xf8, 0x43, 0xfe, 0x50, 0x03, 0xa5, 0x07, 0x7a, 0x0b, 0xbb, 0x0f, 0xce, 0x12, 0xb3, 0x15, 
-0x5f, 0x17, 0x65, 0x16, 0x57, 0x15, 0xd0, 0x12, 0x55, 0x0f, 0x95, 0x0c, 0x5f, 0x09, 0x89, 0x06, 
-0xd2, 0x03, 0x04, 0x01, 0x73, 0xfe, 0x25, 0xfc, 0xf6, 0xfa, 0x98, 0xfa, 0x93, 0xfa, 0xf8, 0xfb, 
-0x20, 0xfd, 0xa6, 0xfe, 0x00, 0x00, 0x41, 0x00, 0xdf, 0xff, 0x18, 0xfe, 0xc2, 0xfb, 0x28, 0xf8, 
-0xc5, 0xf3, 0xd8, 0xee, 0x21, 0xea, 0x69, 0xe7, 0xdd, 0xe6, 0xc7, 0xe8, 0x62, 0xec, 0xdd, 0xf0, 
-0x21, 0xf6, 0x31, 0xfb, 0xaf, 0x00, 0xf2, 0x05, 0x2a, 0x0a, 0x5d, 0x0e, 0xe1, 0x11, 0xda, 0x14, 
-0x0b, 0x17, 0x5e, 0x17, 0xaa, 0x16, 0x99, 0x14, 0x7d, 0x11, 0x3d, 0x0e, 0xfa, 0x0a, 0x23, 0x08, 
-0x17, 0x05, 0x2e, 0x02, 0x5a, 0xff, 0x17, 0xfd, 0x60, 0xfb, 0x5a, 0xfa, 0x9f, 0xfa, 0x4c, 0xfb, 
-0x8f, 0xfc, 0x1a, 0xfe, 0xc1, 0xff, 0x93, 0x00, 0xb4, 0x00, 0x2b, 0x00, 0xb2, 0xfd, 0x9e, 0xfa, 
-0x4e, 0xf6, 0x5e, 0xf1, 0xa7, 0xec, 0xa4, 0xe8, 0xc6, 0xe6, 0x2d, 0xe7, 0x2f, 0xea, 0xe7, 0xed, 
-0x71, 0xf2, 0x8e, 0xf7, 0x57, 0xfc, 0xe4, 0x01, 0xfb, 0x06, 0x4c, 0x0b, 0x72, 0x0f, 0xfa, 0x12, 
-0x95, 0x15, 0x1d, 0x17, 0xa2, 0x17, 0x39, 0x16, 0x98, 0x13, 0x8c, 0x10, 0x20, 0x0d, 0x6e, 0x0a, 
-0x58, 0x07, 0x20, 0x04, 0x19, 0x01, 0x11, 0xfe, 0xf2, 0xfb, 0xa8, 0xfa, 0xf5, 0xf9, 0x41, 0xfa, 
-0x3f, 0xfb, 0xa3, 0xfc, 0x40, 0xfe, 0xe0, 0xff, 0x8f, 0x00, 0x54, 0x00, 0x13, 0xff, 0x7b, 0xfc, 
-0xed, 0xf8, 0x4e, 0xf4, 0x63, 0xef, 0x89, 0xea, 0x60, 0xe7, 0xc6, 0xe6, 0x7b, 0xe8, 0x12, 0xec, 
-0x65, 0xf0, 0x04, 0xf5, 0x1d, 0xfa, 0xd3, 0xff, 0xfe, 0x04, 0xfa, 0x09, 0x25, 0x0e, 0x7f, 0x11, 
-0x2a, 0x15, 0xe8, 0x16, 0x4c, 0x17, 0x22, 0x17, 0xd8, 0x14, 0xd2, 0x11, 0xba, 0x0e, 0xcb, 0x0b, 
-0xd6, 0x08, 0xf3, 0x05, 0xe1, 0x02, 0xbf, 0xff, 0x38, 0xfd, 0x0f, 0xfb, 0x0f, 0xfa, 0xcf, 0xf9, 
-0x2d, 0xfa, 0x6e, 0xfb, 0x15, 0xfd, 0xb4, 0xfe, 0x43, 0x00, 0x59, 0x00, 0x84, 0xff, 0xc5, 0xfd, 
-0xcb, 0xfa, 0x5e, 0xf7, 0xa2, 0xf2, 0xe8, 0xed, 0xed, 0xe9, 0x95, 0xe7, 0x63, 0xe8, 0xc9, 0xea, 
-0x49, 0xee, 0xa8, 0xf2, 0x5e, 0xf7, 0xd2, 0xfc, 0x30, 0x02, 0x2e, 0x07, 0xab, 0x0b, 0x1b, 0x0f, 
-0xc6, 0x12, 0xd3, 0x15, 0x38, 0x17, 0xd0, 0x16, 0xb9, 0x14, 0xa8, 0x11, 0xe3, 0x0d, 0x55, 0x0a, 
-0xea, 0x06, 0xed, 0x03, 0x07, 0x01, 0xc3, 0xfe, 0xa2, 0xfd, 0xa1, 0xfc, 0x8e, 0xfc, 0xfc, 0xfc, 
-0xb8, 0xfd, 0x9c, 0xff, 0xcc, 0x01, 0x5d, 0x03, 0xa1, 0x03, 0x4d, 0x02, 0x9b, 0xff, 0xd3, 0xfb, 
-0xa2, 0xf7, 0xaf, 0xf2, 0x75, 0xec, 0x22, 0xe7, 0x90, 0xe4, 0x1a, 0xe5, 0xfc, 0xe7, 0xf5, 0xeb, 
-0x58, 0xf0, 0xa6, 0xf5, 0x1e, 0xfc, 0xec, 0x01, 0x5d, 0x07, 0x34, 0x0c, 0x8e, 0x0f, 0x1b, 0x13, 
-0x37, 0x16, 0x48, 0x18, 0xa5, 0x18, 0x6e, 0x16, 0xaa, 0x12, 0x37, 0x0e, 0x41, 0x0a, 0x74, 0x06, 
-0xfc, 0x02, 0x8b, 0x00, 0xc3, 0xfd, 0x32, 0xfc, 0x2e, 0xfc, 0x4e, 0xfc, 0x0e, 0xfd, 0x2b, 0xfe, 
-0x9e, 0xff, 0x9c, 0x01, 0xa6, 0x03, 0x7b, 0x04, 0xed, 0x03, 0xe2, 0x01, 0xbe, 0xfe, 0xfe, 0xfa, 
-0x68, 0xf6, 0xac, 0xf0, 0x0d, 0xeb, 0x97, 0xe6, 0xc3, 0xe4, 0x81, 0xe6, 0x58, 0xe9, 0x53, 0xed, 
-0xee, 0xf1, 0x69, 0xf7, 0x5c, 0xfe, 0x2b, 0x04, 0x2e, 0x09, 0x74, 0x0d, 0xce, 0x10, 0x52, 0x14, 
-0x61, 0x17, 0x28, 0x19, 0x49, 0x18, 0xdf, 0x14, 0x90, 0x10, 0x41, 0x0c, 0x9d, 0x08, 0xeb, 0x04, 
-0xed, 0x01, 0x41, 0xff, 0x8c, 0xfc, 0x14, 0xfc, 0xac, 0xfb, 0xfe, 0xfb, 0x1f, 0xfd, 0xf7, 0xfd, 
-0x0c, 0x00, 0x8f, 0x02, 0xba, 0x04, 0x35, 0x05, 0x39, 0x04, 0xe5, 0x01, 0x3b, 0xfe, 0x78, 0xfa, 
-0xc1, 0xf5, 0x7a, 0xef, 0x50, 0xe9, 0x2d, 0xe5, 0xe7, 0xe3, 0x85, 0xe5, 0x7d, 0xe8, 0x17, 0xed, 
-0x53, 0xf2, 0x75, 0xf8, 0xb9, 0xff, 0x80, 0x05, 0xba, 0x0a, 0xba, 0x0e, 0xe5, 0x11, 0x6b, 0x15, 
-0xf2, 0x17, 0x02, 0x19, 0xb8, 0x17, 0x24, 0x14, 0xb8, 0x0f, 0xb5, 0x0b, 0x2a, 0x08, 0xc4, 0x04, 
-0x4b, 0x02, 0x93, 0xff, 0x12, 0xfd, 0x17, 0xfc, 0xc8, 0xfb, 0x43, 0xfc, 0xdb, 0xfc, 0x1a, 0xfe, 
-0x65, 0x00, 0x66, 0x02, 0x15, 0x04, 0x55, 0x04, 0x34, 0x02, 0xa8, 0xfe, 0xf1, 0xfa, 0x80, 0xf6, 
-0x83, 0xf1, 0x4e, 0xec, 0x24, 0xe7, 0x72, 0xe4, 0x4d, 0xe5, 0x08, 0xe8, 0xc6, 0xeb, 0x76, 0xf0, 
-0xc6, 0xf5, 0x69, 0xfc, 0xac, 0x02, 0xc8, 0x07, 0x5c, 0x0c, 0xde, 0x0f, 0x01, 0x13, 0x53, 0x16, 
-0x7f, 0x18, 0x0e, 0x19, 0x4a, 0x17, 0x2a, 0x13, 0xcf, 0x0e, 0xb1, 0x0a, 0xe6, 0x06, 0xca, 0x03, 
-0x94, 0x01, 0xec, 0xfe, 0x2a, 0xfd, 0x5b, 0xfd, 0x0a, 0xfd, 0xcb, 0xfd, 0xee, 0xfe, 0xda, 0xff, 
-0x3b, 0x02, 0x9a, 0x04, 0x9a, 0x05, 0x67, 0x04, 0x10, 0x02, 0x4b, 0xfe, 0x75, 0xf9, 0x1c, 0xf4, 
-0x10, 0xee, 0xf5, 0xe7, 0xda, 0xe3, 0x30, 0xe3, 0x0e, 0xe5, 0x2f, 0xe9, 0x37, 0xee, 0x75, 0xf3, 
-0x83, 0xf8, 0x2d, 0x00, 0xca, 0x06, 0xe7, 0x09, 0x2d, 0x0e, 0x2c, 0x12, 0x93, 0x14, 0x56, 0x16, 
-0x0e, 0x18, 0xce, 0x16, 0xd7, 0x12, 0xec, 0x0e, 0xe9, 0x0a, 0x10, 0x07, 0x47, 0x03, 0x22, 0x01, 
-0x0e, 0xfe, 0x2a, 0xfe, 0xc6, 0xfe, 0x81, 0xfb, 0x5d, 0xfd, 0x07, 0x00, 0xde, 0xff, 0x20, 0x01, 
-0x51, 0x04, 0x40, 0x05, 0x16, 0x03, 0xf6, 0x01, 0x86, 0xfe, 0x65, 0xf8, 0xc2, 0xf2, 0xf3, 0xec, 
-0x1f, 0xe7, 0x27, 0xe3, 0x6e, 0xe4, 0x03, 0xe7, 0x5e, 0xeb, 0x91, 0xf2, 0xe4, 0xf7, 0x34, 0xfd, 
-0x6b, 0x03, 0x9e, 0x08, 0x7d, 0x0c, 0xb3, 0x0f, 0xde, 0x12, 0x41, 0x14, 0xd1, 0x15, 0x9b, 0x16, 
-0x0c, 0x14, 0x83, 0x10, 0xca, 0x0b, 0xf6, 0x06, 0xdd, 0x02, 0x3b, 0xff, 0x8d, 0xfd, 0x0b, 0xfc, 
-0x26, 0xfb, 0xa6, 0xfc, 0x23, 0xfe, 0x9e, 0x00, 0xe3, 0x02, 0xac, 0x05, 0xb8, 0x07, 0xeb, 0x08, 
-0x15, 0x0a, 0xdd, 0x07, 0x54, 0x04, 0x9b, 0xff, 0x62, 0xf9, 0x7a, 0xf2, 0x77, 0xeb, 0x8d, 0xe5, 
-0xd0, 0xe0, 0x0b, 0xe1, 0xc5, 0xe3, 0x0a, 0xe8, 0xd7, 0xef, 0x80, 0xf5, 0x43, 0xfb, 0x7b, 0x02, 
-0xe9, 0x07, 0x2b, 0x0c, 0xbf, 0x0f, 0x54, 0x12, 0xe9, 0x13, 0x23, 0x15, 0x0c, 0x16, 0x4d, 0x14, 
-0x15, 0x10, 0x4a, 0x0b, 0x8b, 0x05, 0x01, 0x01, 0x1a, 0xfd, 0x90, 0xfa, 0x5d, 0xfa, 0x43, 0xf9, 
-0x90, 0xfb, 0xfa, 0xfe, 0xfe, 0x00, 0x62, 0x04, 0x85, 0x06, 0xc0, 0x08, 0x93, 0x0a, 0xf8, 0x0a, 
-0xf3, 0x0a, 0x4c, 0x07, 0x6e, 0x02, 0xcf, 0xfc, 0x88, 0xf5, 0xc1, 0xed, 0x07, 0xe6, 0x8b, 0xe2, 
-0x8b, 0xe0, 0xb1, 0xe2, 0xe9, 0xe8, 0x97, 0xee, 0x7f, 0xf5, 0x1d, 0xfc, 0x37, 0x02, 0x1d, 0x08, 
-0x55, 0x0c, 0x4b, 0x10, 0xf0, 0x12, 0xdd, 0x13, 0x8a, 0x15, 0xa5, 0x15, 0xfe, 0x13, 0xbb, 0x10, 
-0xaf, 0x0b, 0xe0, 0x05, 0x1c, 0x01, 0xba, 0xfc, 0xbf, 0xf9, 0xeb, 0xf8, 0x06, 0xf7, 0x2b, 0xf9, 
-0x04, 0xfc, 0x9c, 0xfe, 0x49, 0x03, 0x3b, 0x06, 0x79, 0x09, 0x30, 0x0b, 0x08, 0x0c, 0xac, 0x0b, 
-0xc6, 0x07, 0x03, 0x03, 0x71, 0xfc, 0x9d, 0xf4, 0x8f, 0xec, 0xe9, 0xe5, 0xa0, 0xe1, 0x79, 0xe0, 
-0xd7, 0xe3, 0x79, 0xe8, 0xaf, 0xee, 0x4d, 0xf6, 0x99, 0xfc, 0xd3, 0x01, 0x01, 0x08, 0x0e, 0x0c, 
-0x93, 0x0e, 0x99, 0x11, 0x4b, 0x13, 0x37, 0x14, 0x69, 0x14, 0x1d, 0x13, 0x6c, 0x0f, 0xa4, 0x0b, 
-0x27, 0x06, 0x20, 0x01, 0x5a, 0xfd, 0x97, 0xfa, 0x4b, 0xf9, 0x6d, 0xf8, 0x99, 0xfb, 0x6c, 0xfe, 
-0x4e, 0x01, 0xfa, 0x05, 0xb5, 0x08, 0x0d, 0x0a, 0x65, 0x0b, 0x47, 0x0b, 0xa0, 0x09, 0x8c, 0x05, 
-0x7b, 0x00, 0xe7, 0xfa, 0x3c, 0xf2, 0x9a, 0xea, 0x51, 0xe4, 0xe9, 0xe0, 0x14, 0xe1, 0x1d, 0xe5, 
-0x43, 0xec, 0x06, 0xf2, 0x64, 0xf9, 0x0a, 0x00, 0x79, 0x04, 0xc5, 0x08, 0x0a, 0x0c, 0xc9, 0x0e, 
-0xae, 0x0f, 0x12, 0x11, 0x60, 0x12, 0x46, 0x12, 0x2f, 0x11, 0x1b, 0x0e, 0xf2, 0x09, 0x41, 0x05, 
-0xfc, 0x00, 0x0b, 0xfd, 0x27, 0xfc, 0x4a, 0xfa, 0x7f, 0xf9, 0x93, 0xfd, 0xb3, 0xff, 0xd0, 0x02, 
-0x3c, 0x07, 0x03, 0x0a, 0xb0, 0x0b, 0xb9, 0x0b, 0xd9, 0x0b, 0xcb, 0x09, 0x29, 0x04, 0x8e, 0xfe, 
-0x2f, 0xf7, 0xaf, 0xee, 0xdf, 0xe5, 0x47, 0xe0, 0x01, 0xe0, 0x65, 0xe1, 0x0f, 0xe8, 0xe6, 0xee, 
-0x79, 0xf6, 0x26, 0xfe, 0x4c, 0x02, 0xcd, 0x07, 0xee, 0x0a, 0x9e, 0x0c, 0xf2, 0x0e, 0xb7, 0x0f, 
-0x10, 0x10, 0x33, 0x10, 0xa7, 0x0f, 0xc6, 0x0d, 0x73, 0x0a, 0xeb, 0x06, 0x8a, 0x02, 0xf2, 0xfd, 
-0x96, 0xfc, 0xdf, 0xfb, 0x0d, 0xfa, 0x9c, 0xfc, 0xf5, 0xff, 0x0f, 0x02, 0xf4, 0x05, 0x3d, 0x09, 
-0x77, 0x0b, 0x30, 0x0b, 0x0e, 0x0b, 0x99, 0x09, 0x37, 0x04, 0x04, 0xff, 0x77, 0xf9, 0xd0, 0xf1, 
-0x16, 0xe9, 0xe1, 0xe2, 0x6b, 0xe1, 0x59, 0xe2, 0x7c, 0xe7, 0x35, 0xef, 0xe0, 0xf5, 0xde, 0xfd, 
-0xab, 0x02, 0x1b, 0x07, 0xcc, 0x0a, 0x93, 0x0b, 0xb1, 0x0d, 0x64, 0x0e, 0xe9, 0x0e, 0x9f, 0x0f, 
-0x70, 0x0f, 0xd3, 0x0e, 0x58, 0x0c, 0x4f, 0x09, 0xc3, 0x04, 0x6b, 0x00, 0x7b, 0xfe, 0x19, 0xfb, 
-0x4d, 0xfa, 0xc7, 0xfb, 0x7a, 0xfd, 0x25, 0x01, 0x64, 0x04, 0x64, 0x07, 0x97, 0x09, 0x3c, 0x0a, 
-0xf3, 0x09, 0xfd, 0x07, 0xed, 0x03, 0x0f, 0xfe, 0x3f, 0xf9, 0x9a, 0xf3, 0x0b, 0xea, 0xb8, 0xe4, 
-0xec, 0xe2, 0x49, 0xe2, 0xcb, 0xe6, 0x26, 0xee, 0xb5, 0xf5, 0x5d, 0xfc, 0x50, 0x02, 0x37, 0x07, 
-0x63, 0x0a, 0x6b, 0x0c, 0x07, 0x0d, 0xb9, 0x0e, 0x9e, 0x0f, 0x49, 0x0e, 0x4a, 0x0f, 0xe8, 0x0e, 
-0x77, 0x0c, 0x87, 0x09, 0x96, 0x05, 0x40, 0x02, 0xc7, 0xfe, 0x80, 0xfc, 0x63, 0xfa, 0x76, 0xfa, 
-0x10, 0xfd, 0xf0, 0xfe, 0x9b, 0x02, 0x0e, 0x06, 0x64, 0x08, 0xf3, 0x09, 0xb3, 0x09, 0xb5, 0x08, 
-0x7a, 0x05, 0xc4, 0xff, 0x45, 0xfb, 0x80, 0xf5, 0x8c, 0xed, 0x16, 0xe7, 0xa1, 0xe3, 0x14, 0xe4, 
-0x4c, 0xe6, 0x03, 0xec, 0x0e, 0xf4, 0x0a, 0xfb, 0x9d, 0x00, 0x51, 0x05, 0x09, 0x09, 0x20, 0x0b, 
-0xc7, 0x0b, 0xf3, 0x0d, 0x0a, 0x0f, 0xb2, 0x0e, 0x9e, 0x0f, 0xbe, 0x0e, 0xee, 0x0d, 0x69, 0x0b, 
-0x9c, 0x07, 0x00, 0x04, 0xc7, 0x00, 0x2d, 0xfe, 0x2a, 0xfb, 0x7a, 0xfb, 0x17, 0xfc, 0x4d, 0xfd, 
-0x74, 0x01, 0xf5, 0x03, 0x80, 0x06, 0x88, 0x07, 0x19, 0x07, 0x93, 0x05, 0xce, 0x02, 0x7a, 0xfe, 
-0x98, 0xf9, 0x7d, 0xf6, 0xa6, 0xef, 0xec, 0xe8, 0xb5, 0xe6, 0x35, 0xe7, 0x8e, 0xe7, 0x35, 0xec, 
-0x9b, 0xf3, 0x62, 0xf8, 0xfb, 0xfe, 0xd2, 0x04, 0x21, 0x08, 0x66, 0x0a, 0x31, 0x0c, 0x1d, 0x0e, 
-0xdd, 0x0e, 0xd5, 0x0e, 0x07, 0x10, 0x12, 0x10, 0x0e, 0x0f, 0xcf, 0x0d, 0xbf, 0x0a, 0x0d, 0x08, 
-0xa8, 0x04, 0xcf, 0x01, 0x5b, 0xff, 0xde, 0xfc, 0xad, 0xfc, 0x23, 0xfd, 0x95, 0xff, 0xdf, 0x01, 
-0x42, 0x03, 0xcc, 0x04, 0xd9, 0x04, 0x29, 0x02, 0xc1, 0xff, 0x6d, 0xfd, 0x86, 0xf9, 0x50, 0xf5, 
-0x18, 0xf0, 0x2d, 0xeb, 0xf5, 0xe8, 0x6b, 0xe9, 0x82, 0xe8, 0x22, 0xed, 0xd9, 0xf3, 0x02, 0xf7, 
-0xdd, 0xfc, 0xd9, 0x01, 0xef, 0x05, 0x1e, 0x08, 0xb6, 0x09, 0x29, 0x0d, 0x7f, 0x0d, 0x35, 0x0e, 
-0x11, 0x0f, 0xcf, 0x0f, 0xab, 0x0f, 0x7f, 0x0d, 0x2e, 0x0e, 0xa0, 0x0b, 0x27, 0x07, 0x4e, 0x05, 
-0xf9, 0x01, 0x37, 0xff, 0x58, 0xfe, 0x56, 0xfe, 0x16, 0xff, 0x8a, 0xff, 0x4d, 0x00, 0x8a, 0xfe, 
-0x5b, 0xff, 0xed, 0xff, 0x1d, 0xfc, 0x4b, 0xfc, 0x67, 0xf9, 0x6e, 0xf4, 0xe0, 0xf0, 0xe7, 0xec, 
-0xe5, 0xec, 0x4f, 0xec, 0xd5, 0xeb, 0x16, 0xee, 0xa4, 0xf2, 0x05, 0xfa, 0xfc, 0xfb, 0x7a, 0x00, 
-0x07, 0x08, 0xa2, 0x08, 0x7c, 0x0b, 0xc1, 0x0c, 0xf8, 0x0d, 0x24, 0x0f, 0x04, 0x0d, 0xdf, 0x0f, 
-0xf1, 0x0e, 0xf2, 0x0d, 0xc5, 0x0d, 0x6f, 0x0a, 0x00, 0x0a, 0xeb, 0x06, 0xa0, 0x03, 0xe1, 0x00, 
-0xdf, 0xfe, 0xc2, 0xfe, 0xa4, 0xfd, 0x51, 0xfe, 0xf0, 0xfe, 0x57, 0xfe, 0xb4, 0xff, 0x9b, 0xff, 
-0xe9, 0xfd, 0x64, 0xfd, 0x59, 0xfb, 0xbf, 0xf7, 0x22, 0xf4, 0xde, 0xf1, 0x0d, 0xef, 0xce, 0xee, 
-0xdd, 0xf1, 0xcb, 0xf0, 0x59, 0xf2, 0xfe, 0xf4, 0xd3, 0xf4, 0xc0, 0xfa, 0xd8, 0xff, 0x4e, 0x03, 
-0xc3, 0x06, 0x37, 0x09, 0x0d, 0x0e, 0x9b, 0x0e, 0x73, 0x0f, 0x25, 0x10, 0x47, 0x0e, 0x7e, 0x0e, 
-0x7f, 0x0b, 0x36, 0x09, 0x2a, 0x08, 0x30, 0x05, 0x43, 0x03, 0x3d, 0x01, 0x13, 0x00, 0xba, 0xfe, 
-0x9c, 0xfd, 0xb5, 0xfd, 0x55, 0xfc, 0x3c, 0xfc, 0x35, 0xfc, 0xce, 0xfb, 0xbb, 0xfc, 0x05, 0xfc, 
-0x03, 0xfc, 0x1d, 0xfb, 0xc6, 0xf9, 0xfe, 0xf8, 0x3e, 0xf7, 0x5b, 0xf7, 0x91, 0xf7, 0xa5, 0xf6, 
-0x65, 0xf7, 0x5f, 0xf9, 0x43, 0xf9, 0xc8, 0xf9, 0x05, 0xfb, 0x1d, 0xfd, 0x92, 0xff, 0x77, 0x00, 
-0x85, 0x04, 0x06, 0x07, 0xcd, 0x06, 0xae, 0x08, 0xdd, 0x09, 0xc7, 0x0a, 0xf9, 0x09, 0x30, 0x09, 
-0x51, 0x0a, 0xf6, 0x08, 0x4d, 0x07, 0x94, 0x05, 0x58, 0x04, 0x70, 0x03, 0x94, 0x01, 0x95, 0x01, 
-0x73, 0x01, 0x20, 0x01, 0xdc, 0xff, 0x4f, 0xff, 0x1e, 0xff, 0x96, 0xfd, 0x63, 0xfd, 0x58, 0xfd, 
-0x19, 0xfe, 0x8a, 0xfd, 0xca, 0xfb, 0x98, 0xfb, 0x06, 0xfb, 0x78, 0xf9, 0x5a, 0xf9, 0x1d, 0xf9, 
-0x9f, 0xf9, 0xdf, 0xf8, 0xa0, 0xf8, 0x56, 0xfa, 0xb4, 0xfa, 0x2e, 0xfd, 0x07, 0xfd, 0x67, 0xfe, 
-0x36, 0x01, 0x82, 0x01, 0x0c, 0x03, 0x63, 0x02, 0x11, 0x03, 0x02, 0x05, 0x29, 0x04, 0x38, 0x03, 
-0xf4, 0x02, 0xa0, 0x03, 0xdf, 0x03, 0x79, 0x02, 0x8a, 0x03, 0xcf, 0x03, 0x43, 0x03, 0x18, 0x03, 
-0x5a, 0x03, 0xf4, 0x03, 0x8f, 0x01, 0xa6, 0x02, 0x5d, 0x02, 0x6a, 0x02, 0x76, 0x02, 0x68, 0x01, 
-0x5b, 0x02, 0x16, 0x00, 0x75, 0xff, 0x9b, 0xfe, 0xa1, 0xfd, 0x3e, 0xfe, 0x93, 0xfc, 0xc7, 0xfb, 
-0xeb, 0xfb, 0x3b, 0xfa, 0x68, 0xfa, 0xc0, 0xfa, 0x39, 0xfb, 0x25, 0xfc, 0x9b, 0xfc, 0xe8, 0xfd, 
-0x0a, 0xfe, 0x31, 0xff, 0x70, 0xff, 0xcf, 0xff, 0x14, 0x00, 0xd8, 0xfe, 0x58, 0x00, 0xc4, 0x00, 
-0x5e, 0x01, 0xca, 0x01, 0xc1, 0x00, 0x30, 0x01, 0x4f, 0x01, 0xa8, 0x00, 0x74, 0x00, 0xb5, 0x00, 
-0x82, 0x00, 0xda, 0x00, 0xe0, 0x00, 0x08, 0x01, 0xc6, 0x00, 0xa2, 0x00, 0x0c, 0x02, 0x2a, 0x01, 
-0xe9, 0x00, 0x4a, 0x01, 0xf3, 0xff, 0x2f, 0x01, 0x6e, 0x01, 0x4f, 0x00, 0x96, 0x00, 0xec, 0x00, 
-0xfe, 0x00, 0x57, 0x00, 0x0c, 0x00, 0xba, 0xff, 0x44, 0xff, 0x8b, 0xff, 0xe9, 0xff, 0xcf, 0xfe, 
-0x4e, 0xff, 0x63, 0xff, 0x6f, 0xfe, 0xb1, 0xfe, 0xa3, 0xfe, 0xe6, 0xfe, 0x82, 0xfe, 0x2f, 0xff, 
-0x35, 0xff, 0x94, 0xff, 0x54, 0x00, 0xd3, 0xff, 0x0e, 0x00, 0x4a, 0x00, 0x43, 0x00, 0x28, 0x00, 
-0x89, 0x00, 0x2a, 0x01, 0x1c, 0x00, 0x71, 0x00, 0x6b, 0x01, 0xf8, 0x00, 0x3f, 0x00, 0xb1, 0xff, 
-0xe9, 0xff, 0x7b, 0x00, 0xb8, 0xff, 0x55, 0x00, 0x20, 0x01, 0x25, 0x00, 0x14, 0x01, 0x38, 0x00, 
-0x72, 0x00, 0x87, 0x00, 0xdf, 0xff, 0xc2, 0x00, 0x8c, 0x00, 0xde, 0x00, 0xd3, 0x00, 0x17, 0x00, 
-0xa6, 0x00, 0xb8, 0xff, 0x65, 0xff, 0x22, 0x00, 0xe0, 0xfe, 0xba, 0xff, 0xf5, 0xff, 0xc7, 0xfe, 
-0xb7, 0xff, 0x71, 0xff, 0xe4, 0xfe, 0x3f, 0xff, 0xbf, 0x00, 0x6c, 0x00, 0x98, 0xfe, 0xb6, 0xff, 
-0xe7, 0x00, 0x3f, 0x00, 0xfa, 0xfe, 0x8b, 0xff, 0xfd, 0x00, 0x03, 0x00, 0x61, 0xff, 0x33, 0x00, 
-0xbf, 0xff, 0x23, 0x00, 0xb8, 0xff, 0x84, 0x00, 0x5d, 0x00, 0xb8, 0x00, 0xce, 0x00, 0xaf, 0xff, 
-0x0e, 0x01, 0x67, 0x00, 0x9f, 0xff, 0xeb, 0xff, 0xa0, 0x00, 0x15, 0x01, 0xad, 0xfe, 0x26, 0xff, 
-0x14, 0x00, 0xa1, 0xff, 0x12, 0xff, 0x64, 0xff, 0xed, 0x00, 0xbf, 0xff, 0xc6, 0x00, 0x8b, 0xff, 
-0x4c, 0x00, 0x12, 0x00, 0x8f, 0xfe, 0xe5, 0xff, 0x5d, 0xff, 0x87, 0xff, 0xdb, 0xff, 0xaf, 0x00, 
-0x65, 0x00, 0x55, 0xff, 0x8d, 0x00, 0xc5, 0xff, 0x94, 0xff, 0xfd, 0x00, 0x26, 0x00, 0xbf, 0xff, 
-0x23, 0x00, 0x5e, 0x00, 0x3d, 0x00, 0xa2, 0xff, 0x2b, 0x01, 0x99, 0xff, 0x3f, 0xff, 0xae, 0x00, 
-0xe2, 0xff, 0x26, 0x00, 0xd2, 0xfe, 0x74, 0x00, 0x34, 0xff, 0x79, 0xff, 0xdf, 0xff, 0x4a, 0x00, 
-0xf5, 0xff, 0x3d, 0xff, 0x9d, 0xff, 0xe6, 0xfe, 0xcc, 0x00, 0x53, 0xff, 0x3b, 0x00, 0x9b, 0xff, 
-0x92, 0xff, 0xfd, 0xff, 0x29, 0x00, 0x71, 0x00, 0x57, 0x00, 0xf7, 0xff, 0xe1, 0xff, 0x7a, 0x01, 
-0x11, 0x00, 0x0b, 0x01, 0x42, 0x00, 0x54, 0xff, 0xc2, 0x00, 0x08, 0x01, 0xb3, 0x00, 0x6f, 0xff, 
-0x7c, 0x00, 0x7b, 0x00, 0xc0, 0xff, 0x2e, 0x01, 0xd2, 0xff, 0xaa, 0xfe, 0x79, 0xfe, 0xeb, 0xff, 
-0x7b, 0xfe, 0x96, 0xfe, 0xd2, 0xfe, 0x87, 0xff, 0x80, 0xff, 0xed, 0xfe, 0x2b, 0xff, 0x2e, 0xfe, 
-0x24, 0x00, 0xff, 0xff, 0xad, 0xff, 0x07, 0x01, 0x39, 0xff, 0x78, 0xff, 0x5b, 0x00, 0x16, 0xff, 
-0xb5, 0xff, 0x75, 0xff, 0x97, 0x00, 0xb7, 0xff, 0x14, 0x01, 0xdb, 0x00, 0x41, 0x00, 0xac, 0x00, 
-0xca, 0x00, 0x5c, 0x00, 0x38, 0x01, 0x56, 0x00, 0xea, 0x00, 0x27, 0x01, 0x27, 0xff, 0x6d, 0x01, 
-0x9f, 0xfe, 0xfe, 0xff, 0x2d, 0x00, 0x62, 0xff, 0x18, 0x01, 0xe9, 0xfe, 0x83, 0xff, 0xfc, 0xfe, 
-0x1c, 0x00, 0x98, 0xff, 0x78, 0xff, 0xe4, 0xff, 0x56, 0xff, 0x33, 0x00, 0xd6, 0xfe, 0x4d, 0xff, 
-0xf8, 0xff, 0x7d, 0xff, 0x63, 0xfe, 0x3a, 0x01, 0x60, 0xff, 0x03, 0xff, 0x8b, 0x00, 0x42, 0x00, 
-0xb1, 0x00, 0x24, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xd0, 0x00, 0x84, 0x00, 0xca, 0x00, 0xd2, 0x00, 
-0xd7, 0xff, 0x17, 0x01, 0xda, 0xff, 0x5c, 0x01, 0x67, 0x00, 0x7c, 0xff, 0xd0, 0xff, 0xd7, 0xff, 
-0xef, 0xff, 0x36, 0x00, 0xff, 0xff, 0xbb, 0xff, 0x3c, 0x00, 0x52, 0xff, 0x93, 0x00, 0xf6, 0xfe, 
-0x92, 0xff, 0xfc, 0xfe, 0xa5, 0xff, 0x0a, 0xff, 0xa6, 0xff, 0xdb, 0xff, 0x09, 0xff, 0x42, 0xff, 
-0xb7, 0xff, 0x53, 0x00, 0xf9, 0xff, 0xda, 0xff, 0xf0, 0xff, 0x93, 0xff, 0xd8, 0xff, 0xe1, 0xff, 
-0xd0, 0xff, 0x24, 0x00, 0xdb, 0x00, 0x31, 0x01, 0x66, 0x00, 0x50, 0x00, 0x57, 0x00, 0x0b, 0x01, 
-0xb5, 0x00, 0xbb, 0x00, 0x86, 0x00, 0xb6, 0x00, 0xeb, 0xff, 0x4e, 0x00, 0x20, 0xff, 0x25, 0x00, 
-0xca, 0x00, 0x04, 0xff, 0x32, 0x00, 0xe3, 0xff, 0x4c, 0x00, 0x65, 0xff, 0x2c, 0x00, 0xb9, 0xff, 
-0xb4, 0xfe, 0x3b, 0x00, 0x7a, 0xff, 0x34, 0x00, 0x46, 0xff, 0xb7, 0xfe, 0xc1, 0xff, 0x5a, 0x00, 
-0xe5, 0xfe, 0x9c, 0xff, 0x26, 0x00, 0x64, 0x00, 0x8b, 0xff, 0x64, 0xff, 0x57, 0x00, 0xb4, 0xff, 
-0xe0, 0x00, 0xef, 0xff, 0x6b, 0x00, 0xbf, 0x00, 0xdf, 0xff, 0x0a, 0x02, 0xc4, 0xff, 0xa2, 0x00, 
-0xaa, 0x00, 0x92, 0x00, 0x3d, 0x00, 0xb9, 0xff, 0xf9, 0x00, 0x9e, 0xff, 0x1e, 0x00, 0xec, 0x00, 
-0xc8, 0x00, 0x88, 0xfe, 0xb1, 0x00, 0x3f, 0x01, 0x98, 0xff, 0xd5, 0xfd, 0x84, 0x01, 0xbd, 0x00, 
-0x14, 0xff, 0x4f, 0xfe, 0xe3, 0xfd, 0x5b, 0x01, 0xbd, 0xff, 0x07, 0xff, 0xeb, 0xff, 0x62, 0xfe, 
-0xfa, 0xfe, 0x69, 0x00, 0x21, 0x00, 0x63, 0x00, 0x61, 0x00, 0xa3, 0x00, 0xcf, 0xff, 0x42, 0x00, 
-0xf6, 0x00, 0x43, 0x00, 0x5c, 0xff, 0xdb, 0x00, 0x9c, 0x00, 0x41, 0xff, 0x11, 0x00, 0x0b, 0x01, 
-0x7a, 0x00, 0x97, 0xff, 0xa3, 0x00, 0x6d, 0x00, 0xd6, 0xff, 0xdf, 0xff, 0xe7, 0x00, 0xea, 0xff, 
-0x0d, 0x00, 0x26, 0x00, 0x3b, 0x00, 0x06, 0x01, 0x29, 0xff, 0xb2, 0xff, 0xe9, 0xfe, 0x52, 0x00, 
-0x19, 0x00, 0x14, 0xff, 0x66, 0x00, 0x26, 0xfe, 0xa2, 0xff, 0x9b, 0xff, 0xd0, 0xff, 0xdb, 0x00, 
-0x23, 0x00, 0x87, 0xff, 0x26, 0x00, 0x36, 0x00, 0x50, 0x00, 0x46, 0x00, 0x30, 0xff, 0xc7, 0x00, 
-0x89, 0x00, 0xef, 0x00, 0x31, 0x00, 0x88, 0x00, 0x4b, 0xff, 0xe0, 0x00, 0x24, 0x01, 0x20, 0x00, 
-0x45, 0x01, 0xaf, 0xff, 0x7b, 0x01, 0xc4, 0xff, 0x90, 0xff, 0x43, 0xff, 0x5d, 0xff, 0x8d, 0xff, 
-0x83, 0x00, 0x00, 0x01, 0x9c, 0xff, 0x13, 0x00, 0x03, 0x00, 0x5b, 0xff, 0x26, 0xff, 0x41, 0x01, 
-0x01, 0xff, 0x1a, 0x01, 0xe3, 0xff, 0x0e, 0xff, 0x1c, 0x00, 0x72, 0xff, 0x0e, 0x00, 0x9a, 0xfe, 
-0x53, 0xff, 0xa4, 0xff, 0x1b, 0x01, 0xde, 0xff, 0xc1, 0xff, 0x7c, 0x00, 0xfa, 0x00, 0x7e, 0xff, 
-0x97, 0xff, 0x56, 0x00, 0xfb, 0xff, 0x24, 0xff, 0xd6, 0xfe, 0xa0, 0x00, 0xb9, 0x00, 0x55, 0x01, 
-0xf9, 0xff, 0xaa, 0x00, 0xae, 0xfe, 0x42, 0xff, 0xe7, 0x01, 0x83, 0xff, 0x3c, 0xff, 0x92, 0xff, 
-0x11, 0xff, 0x43, 0x00, 0xef, 0xff, 0xe8, 0xff, 0x9d, 0x00, 0x5f, 0xff, 0xe0, 0xff, 0xdd, 0xfe, 
-0x93, 0xfe, 0x39, 0x00, 0x87, 0xff, 0x53, 0x00, 0x60, 0x00, 0xfb, 0xff, 0x7c, 0x00, 0xe0, 0xff, 
-0x15, 0x01, 0x10, 0x00, 0xad, 0x00, 0x20, 0x01, 0xc6, 0x00, 0x82, 0xff, 0x8e, 0xff, 0xef, 0xfe, 
-0xb3, 0xfe, 0x09, 0x00, 0xb8, 0xff, 0x94, 0x00, 0x02, 0x01, 0x7a, 0xff, 0x44, 0x01, 0xc3, 0xff, 
-0x98, 0xfe, 0xf3, 0x00, 0x29, 0x00, 0xb0, 0x01, 0xd0, 0xfe, 0xdb, 0x00, 0x2c, 0x01, 0x8e, 0xfe, 
-0x87, 0xff, 0x85, 0xff, 0xd0, 0xff, 0x86, 0xff, 0xb9, 0xfe, 0xe9, 0x00, 0xb6, 0xff, 0xa7, 0x00, 
-0xaf, 0x00, 0xdf, 0xfe, 0x22, 0x00, 0xc9, 0xfe, 0xf7, 0xff, 0xa7, 0xff, 0x1d, 0x00, 0x38, 0x00, 
-0x43, 0xff, 0x38, 0x00, 0x04, 0x00, 0x12, 0x00, 0x52, 0x00, 0x55, 0x00, 0x24, 0x02, 0x7d, 0x00, 
-0xfe, 0xfe, 0x12, 0x01, 0x79, 0xff, 0xa7, 0xff, 0x3c, 0x01, 0xa3, 0xff, 0xe2, 0x00, 0x04, 0xff, 
-0x58, 0xff, 0xcd, 0xff, 0x3b, 0x00, 0x42, 0x01, 0xe7, 0xff, 0x91, 0x00, 0x6c, 0x00, 0x6f, 0x00, 
-0x5a, 0x00, 0x94, 0xff, 0xdf, 0xff, 0xad, 0xff, 0xe1, 0xfe, 0xb8, 0xff, 0xc2, 0xfe, 0x6b, 0x00, 
-0x79, 0x00, 0xa9, 0x00, 0x3a, 0x00, 0x9e, 0x00, 0xae, 0x00, 0x01, 0xff, 0x42, 0x00, 0x5f, 0xff, 
-0x04, 0xff, 0x62, 0xff, 0x41, 0xff, 0x9d, 0x00, 0x0d, 0x00, 0x9b, 0x00, 0xea, 0xff, 0xa8, 0x00, 
-0xe1, 0x00, 0x0e, 0xff, 0xd7, 0xfe, 0x11, 0x00, 0xcd, 0xff, 0xbd, 0x00, 0xcf, 0xff, 0x04, 0x00, 
-0x65, 0x00, 0x58, 0xff, 0x61, 0x00, 0x3e, 0x00, 0xd6, 0x01, 0x34, 0x00, 0xb4, 0x00, 0x0d, 0x01, 
-0xf7, 0xff, 0xe2, 0xff, 0x4f, 0xff, 0xc5, 0xff, 0xb7, 0xff, 0x44, 0xff, 0xc9, 0xff, 0x8c, 0xfe, 
-0xc4, 0xff, 0xe3, 0x00, 0x8a, 0xff, 0x57, 0x00, 0xa7, 0xff, 0x8e, 0x01, 0xc8, 0x00, 0xef, 0xff, 
-0x8a, 0xff, 0xc0, 0xfe, 0xa3, 0x00, 0xb4, 0xff, 0x65, 0x01, 0x8f, 0x00, 0x47, 0x00, 0xb4, 0xff, 
-0x52, 0xff, 0x7a, 0x00, 0xf4, 0xff, 0x5b, 0x00, 0xb5, 0x01, 0x09, 0x00, 0x98, 0xfe, 0x93, 0xff, 
-0x7e, 0xff, 0x47, 0xff, 0x85, 0x00, 0x93, 0x00, 0xb6, 0x00, 0xe6, 0xff, 0x56, 0x00, 0x17, 0x01, 
-0x0b, 0x00, 0x2e, 0x01, 0x71, 0x00, 0x92, 0xff, 0x3d, 0x00, 0xa8, 0xfe, 0x4e, 0x00, 0x40, 0x00, 
-0x9d, 0x01, 0xd7, 0xff, 0x22, 0x00, 0x93, 0x01, 0xbe, 0xff, 0x74, 0x00, 0x07, 0xfe, 0xba, 0xfd, 
-0xa0, 0xfd, 0x67, 0xff, 0x21, 0x01, 0x60, 0xff, 0xd2, 0xff, 0x2d, 0x01, 0x71, 0x00, 0xf4, 0x00, 
-0x24, 0xff, 0x69, 0xff, 0xde, 0xff, 0x93, 0x01, 0xa7, 0x00, 0x8c, 0xfe, 0x0e, 0x00, 0xc2, 0x00, 
-0x6c, 0x00, 0xf7, 0xff, 0xce, 0xfe, 0x02, 0x01, 0x4b, 0x01, 0xb6, 0x00, 0xaf, 0xff, 0x0a, 0xff, 
-0xc0, 0xff, 0x7f, 0xfe, 0x37, 0xff, 0x0b, 0x00, 0xec, 0xff, 0x90, 0x02, 0x16, 0x00, 0x4f, 0xff, 
-0x49, 0x00, 0xaf, 0xfe, 0x34, 0x02, 0x3e, 0x00, 0xd2, 0xff, 0x63, 0xfe, 0xae, 0xfe, 0x3a, 0x02, 
-0xee, 0xff, 0x48, 0x00, 0x32, 0xff, 0x6a, 0xfe, 0x67, 0x00, 0x42, 0xff, 0x10, 0x00, 0x52, 0x00, 
-0x30, 0x00, 0xc7, 0xff, 0xeb, 0xff, 0x92, 0xff, 0x6c, 0xff, 0x88, 0x00, 0x84, 0x00, 0xda, 0x00, 
-0xff, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x05, 0xff, 0x25, 0x00, 0xb4, 0x00, 0x81, 0x00, 0xaf, 0x00, 
-0xcb, 0xff, 0xa1, 0xff, 0x76, 0xff, 0x7f, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x98, 0xff, 0x82, 0x00, 
-0x2d, 0x01, 0xff, 0xff, 0xd4, 0x00, 0x14, 0xff, 0x4e, 0x00, 0x29, 0xff, 0x19, 0xff, 0x09, 0x01, 
-0x9d, 0xff, 0x7b, 0x00, 0x10, 0x00, 0x01, 0x00, 0x35, 0x00, 0xda, 0xff, 0xbe, 0xff, 0xae, 0xff, 
-0x97, 0x00, 0x8a, 0x00, 0x7a, 0xff, 0xaf, 0xff, 0xe3, 0xff, 0x83, 0x00, 0x42, 0x00, 0xe0, 0x00, 
-0xe0, 0xff, 0x37, 0xfe, 0x6c, 0xff, 0xc7, 0xff, 0x19, 0x02, 0xbe, 0x00, 0xda, 0xff, 0x65, 0x01, 
-0x51, 0x00, 0xc6, 0xff, 0x1a, 0xfe, 0xc7, 0xfe, 0xd7, 0xff, 0x86, 0x00, 0x5e, 0x00, 0xfc, 0xfe, 
-0x18, 0x00, 0x3c, 0x01, 0xa0, 0xff, 0xa8, 0xff, 0x26, 0x00, 0x83, 0x00, 0x1d, 0x01, 0x6e, 0x00, 
-0x98, 0x00, 0x91, 0xff, 0x43, 0xfe, 0x60, 0xfe, 0x13, 0xff, 0x15, 0x00, 0x7f, 0xff, 0xba, 0xff, 
-0x17, 0x01, 0xf7, 0xff, 0xd5, 0xff, 0xf4, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x4f, 0x01, 0x05, 0x02, 
-0xf0, 0x00, 0x0f, 0xff, 0xcc, 0xfd, 0xbb, 0xfd, 0x1a, 0x00, 0x34, 0x01, 0x47, 0x00, 0x0f, 0x00, 
-0x68, 0xfe, 0xe3, 0xfe, 0x20, 0x00, 0x7f, 0x01, 0xe5, 0x00, 0x2d, 0x00, 0x0c, 0x00, 0xad, 0xfe, 
-0xb2, 0xff, 0x45, 0xff, 0x9b, 0xff, 0x55, 0xff, 0x56, 0xff, 0x02, 0x00, 0x02, 0xff, 0x53, 0x00, 
-0x5a, 0x00, 0xbf, 0x00, 0xda, 0x00, 0x14, 0x00, 0x60, 0x01, 0xeb, 0xff, 0xf4, 0xff, 0xee, 0x00, 
-0xa4, 0x00, 0x4a, 0x01, 0x23, 0xfe, 0x5e, 0xff, 0xdb, 0xfe, 0xf5, 0xfd, 0x1b, 0x00, 0x81, 0xff, 
-0xe2, 0x00, 0xff, 0xfe, 0x34, 0x00, 0xd7, 0x00, 0x06, 0xff, 0x81, 0xff, 0xd9, 0xfe, 0x06, 0x00, 
-0x34, 0x01, 0x0f, 0x01, 0x20, 0x00, 0x5c, 0xff, 0xd9, 0xff, 0xc3, 0xff, 0xb5, 0x00, 0xcb, 0x00, 
-0xb7, 0xff, 0x71, 0x00, 0x20, 0x00, 0x9b, 0x00, 0x3a, 0xff, 0x09, 0x00, 0x11, 0x01, 0x57, 0x00, 
-0x44, 0x00, 0x00, 0xfe, 0x3f, 0x00, 0x93, 0xfe, 0x4e, 0xfe, 0x02, 0x00, 0xfe, 0xfe, 0xa1, 0x01, 
-0x96, 0xff, 0xe0, 0xff, 0x93, 0xff, 0xde, 0xfd, 0x3c, 0x01, 0xf2, 0xff, 0x25, 0x01, 0x42, 0x01, 
-0x97, 0x00, 0xbf, 0x00, 0x52, 0xfe, 0xb7, 0x00, 0xd4, 0xfe, 0x35, 0xfe, 0xc7, 0x00, 0x7b, 0x00, 
-0x29, 0x02, 0xe0, 0x00, 0x2c, 0x01, 0x04, 0x00, 0x8d, 0xfd, 0xcb, 0xfe, 0x5a, 0xfe, 0x88, 0xff, 
-0x06, 0xff, 0xeb, 0xff, 0x41, 0x01, 0xcd, 0xff, 0xa5, 0x01, 0x3f, 0x00, 0x53, 0xff, 0xb6, 0xff, 
-0xcc, 0x00, 0x10, 0x02, 0x0f, 0x00, 0xb7, 0x01, 0x22, 0x01, 0x1e, 0x00, 0x0e, 0x00, 0x87, 0xfe, 
-0x2b, 0xff, 0x06, 0xff, 0xe7, 0x00, 0x44, 0xff, 0x43, 0xfe, 0x4b, 0xff, 0xe1, 0xfd, 0x56, 0xff, 
-0x16, 0xfe, 0x56, 0xff, 0x9a, 0x00, 0xc1, 0xff, 0x59, 0x02, 0x39, 0x00, 0x0d, 0x00, 0x4a, 0x00, 
-0xb4, 0xfe, 0xa0, 0xff, 0x2d, 0xff, 0xb1, 0x00, 0xfd, 0x00, 0x56, 0x01, 0xe4, 0x00, 0x5a, 0x00, 
-0x78, 0x01, 0x9b, 0x01, 0x31, 0x02, 0x01, 0x02, 0x46, 0x00, 0xe4, 0xfd, 0x73, 0xfd, 0x11, 0xfe, 
-0xbc, 0xfe, 0x6e, 0x00, 0xd4, 0x01, 0x2f, 0x01, 0x74, 0x00, 0x4f, 0x00, 0xf8, 0xfe, 0x94, 0xff, 
-0x85, 0xff, 0x4e, 0xff, 0x80, 0xfe, 0xc9, 0xfe, 0x9f, 0xfe, 0xcc, 0xfe, 0x4a, 0x01, 0x05, 0x00, 
-0xfc, 0xff, 0x41, 0x00, 0xce, 0x00, 0xf8, 0x00, 0x85, 0x01, 0x19, 0x02, 0xc9, 0x02, 0x1f, 0x03, 
-0x0d, 0x03, 0x90, 0x03, 0x52, 0x02, 0xf1, 0x01, 0xef, 0x00, 0xae, 0xff, 0x65, 0xfe, 0x53, 0xfd, 
-0x4f, 0xf9, 0x81, 0xf9, 0x4e, 0xfb, 0xa2, 0xf7, 0x38, 0xf7, 0xc5, 0xf7, 0xc9, 0xf9, 0x8b, 0xfb, 
-0x33, 0xfc, 0x8c, 0xfc, 0xf0, 0xfd, 0x72, 0x01, 0x50, 0x04, 0x5e, 0x06, 0xc6, 0x07, 0x19, 0x09, 
-0x8e, 0x0a, 0xe7, 0x0a, 0x62, 0x0a, 0xf0, 0x09, 0x66, 0x09, 0x67, 0x09, 0x8d, 0x09, 0x65, 0x08, 
-0x92, 0x06, 0xad, 0x04, 0xc4, 0x00, 0x72, 0xfe, 0x4d, 0xfd, 0x9e, 0xfb, 0xcc, 0xf9, 0x35, 0xf7, 
-0xc5, 0xf4, 0xf4, 0xf0, 0x33, 0xed, 0xc0, 0xe9, 0x97, 0xe7, 0x4e, 0xe7, 0xc2, 0xe8, 0xe4, 0xee, 
-0x0b, 0xf8, 0xa6, 0x03, 0x2e, 0x0b, 0x35, 0x0d, 0x24, 0x0c, 0x75, 0x0a, 0x6e, 0x0a, 0x3a, 0x0b, 
-0xf4, 0x0d, 0x57, 0x0e, 0x94, 0x0d, 0xf4, 0x0d, 0x89, 0x0f, 0x7a, 0x10, 0x97, 0x0e, 0x3a, 0x0c, 
-0xfb, 0x07, 0xe7, 0x05, 0xf3, 0x03, 0x67, 0x01, 0x5f, 0xff, 0xf9, 0xfc, 0xeb, 0xfb, 0x3e, 0xf9, 
-0xca, 0xf7, 0xdf, 0xf6, 0xbc, 0xf6, 0xeb, 0xf5, 0x41, 0xf3, 0x70, 0xee, 0x2d, 0xe8, 0xa0, 0xe3, 
-0x53, 0xe1, 0x3f, 0xe5, 0x05, 0xf0, 0x29, 0xfe, 0xa9, 0x0a, 0x8e, 0x0f, 0x03, 0x0e, 0xac, 0x08, 
-0x0d, 0x05, 0xd6, 0x05, 0xb6, 0x08, 0x47, 0x0c, 0x81, 0x0d, 0x3d, 0x0e, 0x75, 0x0e, 0xc9, 0x0e, 
-0xe0, 0x0e, 0xf3, 0x0c, 0xfb, 0x09, 0x8e, 0x06, 0x95, 0x04, 0x84, 0x03, 0x34, 0x03, 0x2a, 0x02, 
-0xeb, 0xff, 0x7e, 0xfd, 0x50, 0xfc, 0xf5, 0xfa, 0xaa, 0xfa, 0x99, 0xfb, 0x9a, 0xfc, 0xf8, 0xfa, 
-0xe3, 0xf4, 0x1a, 0xeb, 0x55, 0xe0, 0x96, 0xd9, 0x28, 0xdc, 0x73, 0xeb, 0x60, 0xff, 0x18, 0x0f, 
-0x2c, 0x12, 0x43, 0x0c, 0x76, 0x02, 0x67, 0xfe, 0x03, 0x01, 0x13, 0x07, 0xed, 0x0c, 0x4d, 0x0d, 
-0xaa, 0x0c, 0x63, 0x0b, 0xe4, 0x0c, 0x07, 0x0d, 0x84, 0x0b, 0xdd, 0x08, 0xf0, 0x05, 0x63, 0x05, 
-0x3d, 0x05, 0x6c, 0x06, 0xde, 0x03, 0x9e, 0xff, 0x17, 0xfc, 0x6e, 0xfc, 0x00, 0x00, 0x39, 0x04, 
-0x0d, 0x06, 0x7e, 0x02, 0xfa, 0xfc, 0x22, 0xf7, 0x21, 0xf3, 0xe6, 0xee, 0x7e, 0xe8, 0x83, 0xe0, 
-0xa5, 0xdc, 0x16, 0xe3, 0xd0, 0xf3, 0xc8, 0x06, 0x91, 0x10, 0xcf, 0x0c, 0xe6, 0x01, 0xc8, 0xf8, 
-0x7c, 0xf8, 0x3a, 0x00, 0xa4, 0x0b, 0x4e, 0x13, 0x5d, 0x13, 0x68, 0x0e, 0x06, 0x09, 0x02, 0x07, 
-0xfd, 0x07, 0x32, 0x0b, 0x38, 0x0c, 0xa9, 0x0a, 0x27, 0x07, 0x8f, 0x03, 0x80, 0x00, 0xe0, 0xfd, 
-0x78, 0xfd, 0x3b, 0xff, 0x3f, 0x04, 0x75, 0x08, 0xab, 0x09, 0x4e, 0x06, 0xff, 0xff, 0x6d, 0xf9, 
-0xd0, 0xf5, 0x18, 0xf3, 0x66, 0xf1, 0xc2, 0xed, 0x5e, 0xe6, 0x4e, 0xde, 0xc1, 0xdd, 0x64, 0xeb, 
-0x8e, 0x00, 0x65, 0x10, 0xea, 0x0f, 0x88, 0x03, 0xe6, 0xf6, 0xc7, 0xf4, 0x1c, 0xfd, 0x31, 0x0a, 
-0x91, 0x13, 0xee, 0x14, 0xcd, 0x0f, 0xe2, 0x09, 0x10, 0x08, 0xa1, 0x09, 0xee, 0x0b, 0x4d, 0x0c, 
-0xdc, 0x09, 0x20, 0x06, 0xaf, 0x01, 0x1e, 0xff, 0x72, 0xfd, 0x80, 0xfd, 0xfa, 0xfe, 0x7c, 0x02, 
-0x22, 0x07, 0xf0, 0x09, 0xaa, 0x08, 0x4c, 0x03, 0xf1, 0xfb, 0x65, 0xf5, 0xe9, 0xf3, 0x1b, 0xf5, 
-0x73, 0xf7, 0x7a, 0xf3, 0x16, 0xe9, 0xf6, 0xdc, 0x60, 0xda, 0x37, 0xe7, 0x2e, 0xfe, 0x97, 0x12, 
-0x3f, 0x16, 0xa3, 0x09, 0xdd, 0xf8, 0x56, 0xf2, 0xf3, 0xf9, 0xd8, 0x09, 0xec, 0x15, 0x51, 0x17, 
-0x34, 0x10, 0x94, 0x08, 0x47, 0x05, 0x5f, 0x06, 0x44, 0x08, 0xfd, 0x08, 0xf7, 0x06, 0xfc, 0x04, 
-0x34, 0x03, 0x78, 0x02, 0x8d, 0x01, 0xe1, 0xfe, 0x87, 0xfd, 0xf6, 0xfd, 0xb5, 0x02, 0x91, 0x06, 
-0x8a, 0x08, 0x66, 0x07, 0xea, 0x03, 0xec, 0xff, 0x49, 0xfb, 0x09, 0xf8, 0x87, 0xf3, 0x2e, 0xf0, 
-0x2f, 0xeb, 0xf4, 0xe3, 0xb5, 0xde, 0x5c, 0xe2, 0xa5, 0xf1, 0xaf, 0x04, 0x45, 0x10, 0x0d, 0x0d, 
-0x3b, 0x02, 0x26, 0xf6, 0x79, 0xf4, 0x60, 0xff, 0xf3, 0x0d, 0x30, 0x17, 0x00, 0x16, 0x15, 0x0e, 
-0xb8, 0x05, 0xb0, 0x03, 0xcd, 0x06, 0xb7, 0x0a, 0xd3, 0x0a, 0x4f, 0x07, 0x30, 0x03, 0xb2, 0x00, 
-0xb0, 0xff, 0x56, 0xfe, 0x5f, 0xfd, 0xf3, 0xfe, 0x8a, 0x03, 0x49, 0x09, 0xce, 0x0c, 0xfa, 0x0a, 
-0x36, 0x05, 0xd1, 0xfe, 0x98, 0xfa, 0x11, 0xfa, 0xeb, 0xfa, 0x87, 0xf9, 0x55, 0xf4, 0x10, 0xec, 
-0x5f, 0xe3, 0x58, 0xde, 0xf8, 0xdf, 0x2f, 0xec, 0x2e, 0xfe, 0xe4, 0x0c, 0x0b, 0x0f, 0xd6, 0x04, 
-0xcf, 0xf8, 0x68, 0xf4, 0x54, 0xfc, 0xfa, 0x0a, 0x57, 0x17, 0x4e, 0x19, 0x45, 0x11, 0xcb, 0x06, 
-0x35, 0x01, 0x46, 0x03, 0x6f, 0x08, 0x67, 0x0c, 0x9d, 0x0a, 0xe9, 0x04, 0xd8, 0xfe, 0xff, 0xfa, 
-0xe6, 0xfa, 0x49, 0xfc, 0x2c, 0x00, 0x42, 0x04, 0xa3, 0x08, 0x42, 0x0a, 0x0a, 0x0a, 0x56, 0x06, 
-0x19, 0x02, 0x21, 0xfe, 0xea, 0xfb, 0xe4, 0xfc, 0xc2, 0xfd, 0x1c, 0xfa, 0x52, 0xf1, 0x3f, 0xe7, 
-0xd5, 0xdd, 0xf1, 0xdb, 0x6e, 0xe4, 0x2d, 0xf8, 0xb3, 0x0a, 0xb4, 0x12, 0xc2, 0x0a, 0xd2, 0xfb, 
-0x8e, 0xf2, 0x70, 0xf6, 0x86, 0x05, 0xd0, 0x14, 0x18, 0x1b, 0xf1, 0x14, 0x35, 0x0a, 0xb8, 0x01, 
-0x4f, 0x00, 0x99, 0x04, 0xf2, 0x09, 0xd9, 0x0b, 0x5f, 0x08, 0x30, 0x02, 0x77, 0xfd, 0x41, 0xfb, 
-0x52, 0xfb, 0x67, 0xfd, 0xa3, 0x01, 0x35, 0x06, 0xce, 0x09, 0x05, 0x0b, 0xa6, 0x08, 0x7d, 0x03, 
-0xe9, 0xfe, 0xef, 0xfc, 0x34, 0xfe, 0xab, 0xff, 0x11, 0xfe, 0xe6, 0xf6, 0x74, 0xee, 0x10, 0xe7, 
-0x55, 0xe2, 0x49, 0xe1, 0x2b, 0xe5, 0x0f, 0xf2, 0x31, 0x02, 0x0b, 0x0e, 0x67, 0x0c, 0xe5, 0x01, 
-0x4a, 0xf7, 0x20, 0xf7, 0x54, 0x02, 0x3d, 0x11, 0x72, 0x1a, 0x47, 0x17, 0x21, 0x0c, 0xbf, 0x00, 
-0x01, 0xfd, 0x11, 0x01, 0xca, 0x08, 0xc9, 0x0d, 0x92, 0x0c, 0x52, 0x05, 0xe8, 0xfc, 0x48, 0xf7, 
-0x1f, 0xf8, 0xe6, 0xfc, 0x31, 0x04, 0xbd, 0x0a, 0xb9, 0x0d, 0xa6, 0x0c, 0x88, 0x07, 0xe6, 0x01, 
-0x50, 0xfe, 0xb2, 0xff, 0x6b, 0x02, 0x9a, 0x03, 0xb6, 0xff, 0x6a, 0xf7, 0x89, 0xef, 0x4a, 0xeb, 
-0x18, 0xea, 0x1a, 0xe8, 0xa1, 0xe4, 0x5f, 0xe4, 0xab, 0xed, 0xf9, 0xfd, 0xa9, 0x0b, 0x00, 0x0e, 
-0x17, 0x05, 0xd1, 0xfa, 0xea, 0xf9, 0x09, 0x03, 0xfe, 0x10, 0xb8, 0x18, 0xa4, 0x14, 0x2f, 0x09, 
-0xdb, 0xfe, 0x29, 0xfd, 0x32, 0x02, 0xaf, 0x09, 0x86, 0x0c, 0x7a, 0x09, 0x37, 0x01, 0x08, 0xfa, 
-0x93, 0xf8, 0x29, 0xfc, 0x3c, 0x02, 0x7b, 0x07, 0x73, 0x0a, 0xea, 0x0a, 0x05, 0x09, 0x76, 0x06, 
-0xa0, 0x04, 0x62, 0x03, 0x6b, 0x03, 0x22, 0x02, 0x8f, 0xff, 0x43, 0xfb, 0x7e, 0xf6, 0x9d, 0xf2, 
-0xe3, 0xef, 0xf4, 0xec, 0xca, 0xe8, 0x38, 0xe4, 0xba, 0xe2, 0x0c, 0xec, 0xd5, 0xfc, 0xf6, 0x0b, 
-0xf9, 0x0e, 0xe0, 0x05, 0x18, 0xfb, 0xf9, 0xf8, 0x83, 0x02, 0x74, 0x10, 0x65, 0x19, 0x52, 0x15, 
-0xea, 0x08, 0xd7, 0xfc, 0xd3, 0xf9, 0xf4, 0xff, 0x66, 0x09, 0x3c, 0x0e, 0x3f, 0x0b, 0xff, 0x01, 
-0x93, 0xf9, 0x68, 0xf7, 0x13, 0xfb, 0x09, 0x02, 0x45, 0x07, 0x3e, 0x0a, 0x6b, 0x0a, 0x8c, 0x09, 
-0x6d, 0x07, 0x00, 0x05, 0x88, 0x03, 0x84, 0x03, 0x93, 0x04, 0x2f, 0x03, 0x9b, 0xfe, 0xc8, 0xf8, 
-0xba, 0xf3, 0xbe, 0xf0, 0xe0, 0xef, 0x26, 0xee, 0x7e, 0xe9, 0xb8, 0xe3, 0x48, 0xe1, 0x66, 0xea, 
-0x70, 0xfc, 0xf5, 0x0c, 0xc2, 0x11, 0x5e, 0x09, 0xd5, 0xfd, 0xa0, 0xf8, 0x90, 0xff, 0x24, 0x0c, 
-0xa7, 0x16, 0x23, 0x16, 0xc0, 0x0c, 0xec, 0x01, 0xdc, 0xfc, 0xd5, 0xff, 0x4e, 0x06, 0xde, 0x0b, 
-0xdd, 0x0b, 0x48, 0x06, 0x81, 0xfd, 0x11, 0xf8, 0x9a, 0xf8, 0x32, 0xff, 0x2a, 0x06, 0x25, 0x0b, 
-0x64, 0x0b, 0x66, 0x09, 0x29, 0x06, 0xee, 0x03, 0xbf, 0x03, 0xd4, 0x04, 0xe3, 0x05, 0xd0, 0x03, 
-0x89, 0xfe, 0x2b, 0xf7, 0x55, 0xf2, 0x6e, 0xef, 0x99, 0xee, 0x13, 0xee, 0xe3, 0xea, 0xc5, 0xe5, 
-0x34, 0xe1, 0x44, 0xe4, 0xf0, 0xf2, 0x30, 0x06, 0xa3, 0x13, 0xed, 0x11, 0xb0, 0x05, 0xbe, 0xf9, 
-0x9e, 0xf9, 0x4d, 0x06, 0x62, 0x15, 0xfb, 0x1b, 0x05, 0x14, 0xbf, 0x05, 0x29, 0xfb, 0x69, 0xfa, 
-0x23, 0x02, 0x75, 0x0a, 0x8e, 0x0d, 0xc6, 0x08, 0x9a, 0xff, 0xa6, 0xf8, 0x3c, 0xf8, 0xf8, 0xfd, 
-0x4c, 0x05, 0xda, 0x0a, 0xf5, 0x0b, 0xc9, 0x09, 0xd4, 0x06, 0x3a, 0x04, 0x1e, 0x04, 0x2c, 0x05, 
-0xbf, 0x05, 0x09, 0x05, 0xaf, 0x00, 0x09, 0xfa, 0xf6, 0xf3, 0x68, 0xf1, 0x46, 0xf1, 0xe6, 0xf0, 
-0xf1, 0xed, 0x03, 0xe8, 0xc5, 0xe2, 0xe4, 0xe0, 0xc9, 0xe9, 0xf2, 0xfa, 0xac, 0x0c, 0x55, 0x14, 
-0x6f, 0x0d, 0x70, 0x00, 0x0f, 0xf8, 0x21, 0xfd, 0x9c, 0x0b, 0x1b, 0x18, 0x00, 0x19, 0xb3, 0x0d, 
-0xc8, 0xff, 0x8e, 0xf8, 0xd7, 0xfb, 0xe1, 0x04, 0xde, 0x0b, 0xd7, 0x0c, 0xc9, 0x06, 0xf3, 0xfe, 
-0x55, 0xf9, 0xe9, 0xf8, 0xcd, 0xfd, 0x90, 0x04, 0x8c, 0x0a, 0x5d, 0x0d, 0x1a, 0x0d, 0xfc, 0x09, 
-0x1c, 0x06, 0xd3, 0x03, 0x9a, 0x03, 0x30, 0x04, 0x68, 0x03, 0x68, 0xff, 0x73, 0xf9, 0x8c, 0xf4, 
-0x23, 0xf2, 0x72, 0xf2, 0x01, 0xf2, 0xe8, 0xed, 0x07, 0xe7, 0x08, 0xe1, 0x3a, 0xe0, 0xc4, 0xea, 
-0x1f, 0xfe, 0x01, 0x10, 0x84, 0x15, 0x26, 0x0c, 0x90, 0xfd, 0x28, 0xf6, 0xab, 0xfc, 0x21, 0x0c, 
-0x03, 0x19, 0x72, 0x19, 0xf4, 0x0c, 0x6a, 0xfe, 0x73, 0xf7, 0x3c, 0xfb, 0xd7, 0x04, 0x69, 0x0c, 
-0x70, 0x0d, 0xb7, 0x06, 0x0c, 0xfd, 0x62, 0xf5, 0x59, 0xf5, 0xe2, 0xfc, 0x04, 0x08, 0x55, 0x10, 
-0x0b, 0x12, 0x0d, 0x0e, 0x70, 0x07, 0x1b, 0x03, 0x31, 0x02, 0x24, 0x04, 0x61, 0x05, 0x38, 0x04, 
-0x30, 0x00, 0x63, 0xfa, 0xe8, 0xf5, 0x90, 0xf3, 0xf4, 0xf3, 0xed, 0xf3, 0x26, 0xf1, 0xef, 0xe9, 
-0xd7, 0xe2, 0x36, 0xdf, 0x6c, 0xe4, 0x7c, 0xf5, 0x7f, 0x09, 0x39, 0x16, 0xdf, 0x12, 0x11, 0x05, 
-0x11, 0xf8, 0xad, 0xf7, 0x53, 0x03, 0x89, 0x12, 0x68, 0x19, 0x7b, 0x11, 0xb7, 0x02, 0xcb, 0xf7, 
-0x47, 0xf8, 0x2c, 0x01, 0x90, 0x0a, 0x58, 0x0d, 0xad, 0x08, 0xb7, 0x00, 0x79, 0xfa, 0x08, 0xfa, 
-0x79, 0xfe, 0x1d, 0x05, 0xf9, 0x0a, 0x9d, 0x0d, 0x1e, 0x0d, 0x8a, 0x0a, 0x50, 0x07, 0xd4, 0x04, 
-0xa8, 0x03, 0x57, 0x03, 0x22, 0x03, 0x3a, 0x01, 0xea, 0xfc, 0x00, 0xf8, 0x86, 0xf4, 0xe6, 0xf3, 
-0x1a, 0xf4, 0xc4, 0xf2, 0x78, 0xed, 0x84, 0xe6, 0x64, 0xe2, 0xcf, 0xe2, 0xff, 0xec, 0x5b, 0xfe, 
-0xca, 0x0f, 0x62, 0x16, 0xcf, 0x0e, 0xc1, 0x00, 0x4f, 0xf7, 0xd8, 0xfa, 0x33, 0x07, 0x04, 0x14, 
-0x5a, 0x16, 0xdb, 0x0c, 0x2e, 0xff, 0xed, 0xf6, 0xeb, 0xf9, 0x18, 0x03, 0x34, 0x0b, 0x0d, 0x0c, 
-0x6f, 0x06, 0xd7, 0xfe, 0x17, 0xfa, 0x68, 0xfa, 0x34, 0xff, 0x70, 0x06, 0xa1, 0x0c, 0xb6, 0x0f, 
-0x55, 0x0e, 0x03, 0x0a, 0xec, 0x04, 0xb1, 0x01, 0x32, 0x01, 0xfd, 0x02, 0x6c, 0x03, 0x98, 0x00, 
-0x2b, 0xfb, 0xd6, 0xf6, 0xd3, 0xf4, 0xaf, 0xf4, 0x86, 0xf4, 0xb9, 0xf2, 0xc5, 0xee, 0x43, 0xe9, 
-0x25, 0xe5, 0x87, 0xe3, 0x69, 0xeb, 0xc6, 0xfb, 0x9f, 0x0d, 0x43, 0x16, 0x44, 0x10, 0xab, 0x02, 
-0x0b, 0xf8, 0x72, 0xf9, 0xcb, 0x04, 0xc2, 0x11, 0x98, 0x15, 0x86, 0x0d, 0x65, 0x00, 0xfa, 0xf8, 
-0x27, 0xfc, 0x20, 0x05, 0x61, 0x0c, 0x68, 0x0c, 0x6f, 0x07, 0x8b, 0x00, 0x58, 0xfc, 0x5c, 0xfc, 
-0x79, 0x00, 0xdb, 0x06, 0x7c, 0x0b, 0xd1, 0x0d, 0xfb, 0x0b, 0x30, 0x08, 0x8d, 0x04, 0xb7, 0x02, 
-0xdf, 0x02, 0xad, 0x02, 0x14, 0x01, 0xc2, 0xfc, 0x0d, 0xf9, 0x15, 0xf7, 0x9e, 0xf5, 0x45, 0xf4, 
-0x3a, 0xf1, 0xa2, 0xed, 0x3c, 0xe9, 0x04, 0xe6, 0x14, 0xe4, 0x9b, 0xe6, 0x87, 0xf3, 0x87, 0x05, 
-0x61, 0x14, 0xc4, 0x14, 0xcf, 0x08, 0x91, 0xfb, 0x39, 0xf7, 0x17, 0x00, 0x1b, 0x0e, 0x58, 0x17, 
-0xd4, 0x12, 0x60, 0x05, 0x10, 0xfa, 0x36, 0xf9, 0x05, 0x02, 0xd4, 0x0b, 0x85, 0x0f, 0xb4, 0x0a, 
-0x60, 0x01, 0x49, 0xfa, 0x0b, 0xf9, 0xd6, 0xfd, 0x2d, 0x06, 0x1a, 0x0d, 0x1d, 0x10, 0x02, 0x0e, 
-0xa5, 0x08, 0xcc, 0x03, 0x28, 0x02, 0xa7, 0x03, 0x33, 0x05, 0x50, 0x04, 0x6c, 0x00, 0x96, 0xfa, 
-0xac, 0xf6, 0x84, 0xf4, 0x30, 0xf4, 0x02, 0xf3, 0xe1, 0xef, 0xf0, 0xeb, 0x4d, 0xe6, 0x56, 0xe3, 
-0x9a, 0xe3, 0x47, 0xec, 0x6f, 0xfc, 0x90, 0x0c, 0x15, 0x14, 0x09, 0x0e, 0x66, 0x01, 0xc0, 0xf8, 
-0xad, 0xfb, 0x83, 0x07, 0x30, 0x13, 0xac, 0x15, 0x0f, 0x0c, 0x06, 0xff, 0x1a, 0xf9, 0xd6, 0xfc, 
-0x2f, 0x06, 0x1f, 0x0d, 0x54, 0x0d, 0xde, 0x06, 0x2b, 0xff, 0x51, 0xfa, 0x04, 0xfc, 0x94, 0x02, 
-0x92, 0x09, 0xe6, 0x0d, 0x77, 0x0d, 0x6b, 0x0a, 0xd4, 0x06, 0x93, 0x05, 0xda, 0x04, 0x04, 0x04, 
-0xc9, 0x02, 0x0c, 0x00, 0xaa, 0xfd, 0xb4, 0xfa, 0x2e, 0xf8, 0x73, 0xf5, 0x69, 0xf2, 0x97, 0xee, 
-0xa9, 0xe9, 0x72, 0xe7, 0xe2, 0xe5, 0x84, 0xe5, 0x67, 0xe7, 0xb0, 0xf1, 0x20, 0x02, 0x2e, 0x10, 
-0xef, 0x13, 0x31, 0x0b, 0x6c, 0xff, 0xe5, 0xf8, 0x60, 0xfe, 0x21, 0x0b, 0x68, 0x16, 0xaa, 0x15, 
-0xc5, 0x09, 0x4e, 0xfc, 0x87, 0xf7, 0xc5, 0xfd, 0x40, 0x08, 0xaf, 0x0f, 0xc0, 0x0d, 0xcf, 0x04, 
-0xf4, 0xfa, 0x0d, 0xf8, 0x09, 0xfd, 0x01, 0x07, 0xcc, 0x0e, 0xad, 0x10, 0x24, 0x0d, 0xbd, 0x07, 
-0xe9, 0x04, 0xe1, 0x05, 0x4f, 0x08, 0xa2, 0x07, 0xd2, 0x03, 0xaa, 0xfd, 0x79, 0xf9, 0x85, 0xf6, 
-0x42, 0xf5, 0xca, 0xf3, 0x3f, 0xf2, 0x43, 0xef, 0x6f, 0xea, 0x7f, 0xe6, 0xf4, 0xe3, 0x36, 0xe4, 
-0xdb, 0xe5, 0xc5, 0xef, 0xc3, 0x00, 0x1d, 0x10, 0xa4, 0x14, 0x62, 0x0c, 0x48, 0xff, 0x44, 0xf8, 
-0xb7, 0xfc, 0x60, 0x09, 0xe6, 0x14, 0x63, 0x16, 0x99, 0x0c, 0x51, 0xff, 0x57, 0xf8, 0xad, 0xfb, 
-0x5e, 0x06, 0x4e, 0x0f, 0xfe, 0x0f, 0xc5, 0x07, 0x5c, 0xfd, 0x9b, 0xf8, 0xfe, 0xfb, 0xc3, 0x04, 
-0x5a, 0x0e, 0xa2, 0x12, 0x76, 0x12, 0xe4, 0x0d, 0xf9, 0x07, 0x01, 0x04, 0x56, 0x02, 0x4e, 0x03, 
-0x86, 0x03, 0x38, 0x02, 0x6d, 0xfe, 0x24, 0xf9, 0x21, 0xf5, 0xcf, 0xf1, 0xcb, 0xf0, 0xfe, 0xef, 
-0xe4, 0xee, 0xf6, 0xeb, 0x0a, 0xe7, 0x72, 0xe4, 0xcc, 0xe2, 0xfa, 0xea, 0x02, 0xfa, 0x23, 0x0c, 
-0x42, 0x15, 0x42, 0x10, 0x28, 0x03, 0x1a, 0xf8, 0x02, 0xfa, 0xbc, 0x03, 0xf2, 0x10, 0x6b, 0x15, 
-0x8d, 0x10, 0x50, 0x05, 0xea, 0xfb, 0x59, 0xfa, 0x72, 0x00, 0xf2, 0x09, 0xd7, 0x0e, 0x0a, 0x0c, 
-0x18, 0x03, 0xd3, 0xfa, 0x28, 0xf9, 0x2a, 0xff, 0xd2, 0x08, 0x8d, 0x10, 0xdb, 0x11, 0xe1, 0x0d, 
-0xbe, 0x07, 0x17, 0x04, 0x61, 0x03, 0xe8, 0x03, 0x83, 0x03, 0xd4, 0x01, 0xb1, 0xfe, 0xee, 0xfa, 
-0xae, 0xf7, 0x4b, 0xf5, 0xe3, 0xf3, 0xc2, 0xf2, 0x1c, 0xf2, 0x02, 0xf1, 0xb4, 0xed, 0x72, 0xe8, 
-0xa8, 0xe4, 0x10, 0xe4, 0xb9, 0xeb, 0x82, 0xfc, 0x45, 0x0e, 0xb7, 0x16, 0x6f, 0x10, 0x1f, 0x02, 
-0xf7, 0xf7, 0x74, 0xfa, 0x7d, 0x06, 0x7f, 0x12, 0x25, 0x16, 0xdf, 0x0d, 0x13, 0x01, 0x41, 0xf8, 
-0xc0, 0xf9, 0x46, 0x02, 0x38, 0x0b, 0x33, 0x0f, 0x42, 0x0a, 0x5c, 0x01, 0x0b, 0xf9, 0xd0, 0xf8, 
-0x23, 0x00, 0xdd, 0x0a, 0xa1, 0x11, 0xf4, 0x10, 0x2b, 0x0c, 0xc0, 0x06, 0x50, 0x04, 0xa4, 0x04, 
-0x5e, 0x06, 0xe8, 0x05, 0xd5, 0x02, 0xe8, 0xfd, 0xf6, 0xf8, 0x08, 0xf5, 0xb8, 0xf3, 0x0d, 0xf4, 
-0x43, 0xf5, 0x88, 0xf4, 0xda, 0xf0, 0x53, 0xeb, 0xb8, 0xe5, 0xc9, 0xe3, 0x11, 0xe4, 0x3b, 0xec, 
-0x6a, 0xfc, 0x09, 0x0f, 0xab, 0x17, 0x75, 0x11, 0x19, 0x02, 0x7a, 0xf5, 0xde, 0xf6, 0x3c, 0x04, 
-0xa3, 0x14, 0x3f, 0x1a, 0x7d, 0x11, 0xf9, 0x00, 0x2c, 0xf6, 0x38, 0xf8, 0x18, 0x03, 0x19, 0x0e, 
-0x28, 0x12, 0x09, 0x0c, 0x36, 0x01, 0xf2, 0xf8, 0x9d, 0xf8, 0x3d, 0x00, 0x45, 0x0b, 0x92, 0x12, 
-0x91, 0x12, 0x71, 0x0d, 0xfb, 0x06, 0x14, 0x03, 0xd0, 0x02, 0xf9, 0x04, 0xd1, 0x06, 0x04, 0x05, 
-0x6f, 0x00, 0x54, 0xfa, 0xe5, 0xf5, 0x95, 0xf3, 0xe7, 0xf2, 0x5b, 0xf2, 0xa6, 0xf0, 0x36, 0xed, 
-0xa0, 0xe8, 0xc9, 0xe4, 0xd6, 0xe3, 0x6b, 0xe4, 0x31, 0xea, 0xfc, 0xf7, 0x2e, 0x09, 0xb3, 0x14, 
-0x7a, 0x12, 0x1f, 0x07, 0x23, 0xfa, 0xb2, 0xf8, 0xa6, 0x01, 0xfc, 0x10, 0x3e, 0x19, 0x71, 0x14, 
-0x7f, 0x06, 0xb0, 0xf9, 0xfd, 0xf8, 0xc2, 0x01, 0x6a, 0x0d, 0xf1, 0x12, 0x8c, 0x0e, 0x33, 0x04, 
-0x3c, 0xfb, 0x92, 0xf9, 0xd7, 0xff, 0xc2, 0x09, 0xeb, 0x10, 0x2f, 0x11, 0xf3, 0x0c, 0x92, 0x06, 
-0x0d, 0x03, 0x8f, 0x02, 0xc9, 0x03, 0x46, 0x04, 0x09, 0x02, 0x15, 0xfe, 0xff, 0xf8, 0xfc, 0xf5, 
-0xba, 0xf4, 0x4a, 0xf4, 0xef, 0xf2, 0xd7, 0xf0, 0xa7, 0xed, 0x9f, 0xea, 0x1c, 0xe8, 0x09, 0xe7, 
-0x88, 0xe7, 0x49, 0xea, 0x7e, 0xf5, 0xe5, 0x04, 0x4c, 0x12, 0xfd, 0x12, 0xd2, 0x09, 0x6a, 0xfd, 
-0x19, 0xf9, 0x9f, 0xff, 0xd0, 0x0b, 0x07, 0x16, 0xb3, 0x14, 0xae, 0x0a, 0xc7, 0xfd, 0xc7, 0xf8, 
-0xad, 0xfd, 0x52, 0x08, 0x79, 0x10, 0xf0, 0x0f, 0x26, 0x08, 0x40, 0xfe, 0x3c, 0xf9, 0x0b, 0xfc, 
-0x4f, 0x05, 0xd7, 0x0e, 0xbb, 0x12, 0x57, 0x10, 0x02, 0x0a, 0x9a, 0x05, 0xac, 0x03, 0x96, 0x03, 
-0xfb, 0x02, 0x23, 0x01, 0x1b, 0xff, 0x6b, 0xfb, 0x88, 0xf7, 0x11, 0xf4, 0xb3, 0xf2, 0x45, 0xf2, 
-0xa4, 0xf2, 0xab, 0xf3, 0xcb, 0xf1, 0xaf, 0xed, 0xa3, 0xe7, 0xa0, 0xe4, 0x2c, 0xe6, 0xee, 0xec, 
-0x2c, 0xfb, 0x34, 0x0a, 0xf2, 0x13, 0x99, 0x10, 0xd3, 0x04, 0x62, 0xf9, 0x8f, 0xf8, 0x60, 0x02, 
-0x33, 0x0f, 0x70, 0x17, 0x4e, 0x13, 0xc3, 0x06, 0xf0, 0xfa, 0x10, 0xf9, 0xe3, 0x00, 0x8c, 0x0b, 
-0xea, 0x10, 0x37, 0x0e, 0x5a, 0x05, 0x0d, 0xfd, 0x8e, 0xfa, 0x6d, 0xff, 0x9d, 0x07, 0x58, 0x0e, 
-0x5d, 0x0f, 0xe7, 0x0b, 0x9d, 0x07, 0x84, 0x05, 0x3b, 0x05, 0x64, 0x05, 0x45, 0x04, 0xa4, 0x01, 
-0x4f, 0xfe, 0xa7, 0xfa, 0x05, 0xf8, 0x15, 0xf5, 0x3f, 0xf3, 0x69, 0xf2, 0x6e, 0xf2, 0x1b, 0xf3, 
-0xb8, 0xf0, 0xa3, 0xeb, 0x4f, 0xe5, 0x19, 0xe4, 0x5c, 0xe7, 0x5d, 0xef, 0xb9, 0xfd, 0xd2, 0x0b, 
-0x7f, 0x14, 0x30, 0x10, 0x5a, 0x04, 0x6b, 0xf9, 0xda, 0xf9, 0x91, 0x03, 0x90, 0x10, 0x94, 0x17, 
-0xaa, 0x11, 0xec, 0x04, 0x0f, 0xfb, 0xcf, 0xfb, 0x51, 0x04, 0x8b, 0x0d, 0x57, 0x0f, 0xb7, 0x09, 
-0x57, 0x00, 0xb1, 0xfa, 0x78, 0xfc, 0x4e, 0x03, 0x84, 0x0b, 0x3c, 0x0f, 0xc0, 0x0e, 0xef, 0x0a, 
-0x40, 0x06, 0x9e, 0x04, 0x77, 0x04, 0xf1, 0x04, 0xac, 0x03, 0x6b, 0x01, 0xa4, 0xfd, 0x3d, 0xfa, 
-0x70, 0xf7, 0xbc, 0xf5, 0xfa, 0xf4, 0x3d, 0xf4, 0x79, 0xf4, 0xb2, 0xf4, 0x0b, 0xf3, 0x79, 0xee, 
-0xd4, 0xe8, 0x6f, 0xe5, 0xe7, 0xe7, 0x5b, 0xec, 0xd3, 0xf7, 0x5b, 0x05, 0xe2, 0x0f, 0x3d, 0x10, 
-0x14, 0x08, 0x24, 0xfe, 0x9a, 0xf9, 0xe0, 0xff, 0x49, 0x09, 0xbb, 0x12, 0x55, 0x11, 0x7a, 0x08, 
-0x83, 0xfe, 0xbb, 0xfb, 0x26, 0x02, 0xab, 0x0a, 0xf8, 0x0f, 0x7d, 0x0d, 0x1c, 0x06, 0x41, 0xfe, 
-0xe1, 0xfa, 0xa5, 0xfd, 0x3e, 0x04, 0xde, 0x0a, 0x4f, 0x0e, 0x16, 0x0e, 0xab, 0x0a, 0x95, 0x05, 
-0xa3, 0x02, 0x1a, 0x02, 0x52, 0x03, 0xda, 0x03, 0x70, 0x02, 0x1f, 0xff, 0xd9, 0xf9, 0x3d, 0xf5, 
-0xec, 0xf2, 0x6c, 0xf3, 0x96, 0xf5, 0xd6, 0xf6, 0x46, 0xf5, 0xf1, 0xf1, 0x73, 0xec, 0x32, 0xe8, 
-0x1c, 0xe8, 0xfa, 0xe9, 0x6c, 0xee, 0x43, 0xf9, 0x71, 0x06, 0xa7, 0x10, 0x2c, 0x10, 0x89, 0x07, 
-0xee, 0xfd, 0x62, 0xfb, 0xd8, 0x01, 0xf3, 0x0b, 0x32, 0x14, 0xe1, 0x10, 0xbd, 0x07, 0x82, 0xfe, 
-0x4c, 0xfd, 0xf8, 0x03, 0x4b, 0x0c, 0x35, 0x10, 0x17, 0x0c, 0x51, 0x04, 0x68, 0xfd, 0x66, 0xfb, 
-0x1b, 0xff, 0x4d, 0x05, 0xec, 0x0b, 0x41, 0x0e, 0xea, 0x0c, 0x18, 0x09, 0xa3, 0x04, 0xaf, 0x02, 
-0x3e, 0x01, 0x6b, 0x02, 0x1d, 0x02, 0x1b, 0x01, 0xdc, 0xfd, 0x58, 0xf9, 0xfd, 0xf4, 0xa5, 0xf2, 
-0x39, 0xf3, 0xde, 0xf4, 0xef, 0xf5, 0x71, 0xf4, 0x76, 0xf1, 0xa8, 0xec, 0xbf, 0xe7, 0x18, 0xe6, 
-0x7d, 0xe7, 0xc4, 0xec, 0xb1, 0xf9, 0x08, 0x09, 0xf9, 0x13, 0x7e, 0x11, 0xfa, 0x05, 0x5a, 0xfa, 
-0xd6, 0xf8, 0xfa, 0x01, 0xd3, 0x0e, 0xc0, 0x16, 0x16, 0x12, 0x6d, 0x06, 0x54, 0xfc, 0xdb, 0xfc, 
-0x37, 0x04, 0x2d, 0x0d, 0x42, 0x10, 0x37, 0x0c, 0x8b, 0x04, 0xc9, 0xfd, 0x0a, 0xfd, 0x90, 0x00, 
-0xd0, 0x07, 0xb3, 0x0c, 0x72, 0x0e, 0xb6, 0x0b, 0x76, 0x07, 0xe7, 0x03, 0xba, 0x02, 0xad, 0x03, 
-0x55, 0x04, 0x3b, 0x04, 0x7f, 0x01, 0x42, 0xfd, 0x62, 0xf7, 0xe0, 0xf2, 0x99, 0xf1, 0xa2, 0xf3, 
-0xea, 0xf5, 0x51, 0xf6, 0xd7, 0xf3, 0x81, 0xef, 0x66, 0xeb, 0x4e, 0xe8, 0xe6, 0xe8, 0x42, 0xeb, 
-0x18, 0xef, 0xe9, 0xf8, 0x12, 0x06, 0x2b, 0x11, 0xe0, 0x10, 0x9e, 0x07, 0x82, 0xfc, 0x15, 0xfb, 
-0x09, 0x04, 0x13, 0x10, 0x07, 0x16, 0xb4, 0x10, 0x76, 0x05, 0x4d, 0xfd, 0x0a, 0xfe, 0xbb, 0x04, 
-0xf9, 0x0b, 0x28, 0x0e, 0x8c, 0x0a, 0x67, 0x04, 0x83, 0xff, 0xea, 0xfd, 0xbd, 0xff, 0xa4, 0x04, 
-0x2b, 0x0a, 0xc7, 0x0c, 0x81, 0x0c, 0x1e, 0x09, 0x80, 0x05, 0xb7, 0x02, 0x9f, 0x01, 0x54, 0x01, 
-0x81, 0x01, 0xdc, 0x00, 0x92, 0xfe, 0x2e, 0xfb, 0x91, 0xf6, 0x50, 0xf4, 0x8e, 0xf4, 0xa9, 0xf5, 
-0xee, 0xf6, 0xda, 0xf5, 0x4e, 0xf2, 0x99, 0xec, 0xe0, 0xe7, 0xaf, 0xe6, 0x9c, 0xea, 0x8f, 0xef, 
-0x14, 0xf8, 0x7b, 0x03, 0x6f, 0x0c, 0x41, 0x0e, 0xff, 0x06, 0x8a, 0xfe, 0xd6, 0xfa, 0xa1, 0x00, 
-0x56, 0x0a, 0x51, 0x12, 0x97, 0x11, 0x76, 0x09, 0xbf, 0x01, 0xef, 0xff, 0x56, 0x04, 0x7e, 0x09, 
-0x90, 0x0c, 0x12, 0x0b, 0xf7, 0x06, 0x1f, 0x01, 0x6d, 0xfd, 0x82, 0xfd, 0x30, 0x01, 0xee, 0x07, 
-0x62, 0x0d, 0xb2, 0x0f, 0xe4, 0x0c, 0xbf, 0x07, 0xbf, 0x02, 0x13, 0x01, 0xc1, 0x01, 0xc4, 0x02, 
-0x35, 0x03, 0xd9, 0x00, 0x15, 0xfd, 0x6b, 0xf9, 0xc9, 0xf6, 0xaa, 0xf5, 0xf2, 0xf4, 0x6e, 0xf4, 
-0x11, 0xf4, 0x02, 0xf3, 0x14, 0xf0, 0x9e, 0xeb, 0x0b, 0xe8, 0xc6, 0xe7, 0x34, 0xeb, 0x74, 0xf0, 
-0xe6, 0xf9, 0xd8, 0x03, 0xce, 0x0b, 0x2c, 0x0b, 0xf1, 0x04, 0x3b, 0xfe, 0x0f, 0xfe, 0x05, 0x05, 
-0x84, 0x0d, 0x27, 0x13, 0xd6, 0x10, 0x33, 0x09, 0xd6, 0x01, 0xa1, 0x00, 0x3c, 0x04, 0xd4, 0x09, 
-0xc6, 0x0b, 0xbf, 0x09, 0x9c, 0x04, 0x3e, 0x00, 0xd1, 0xfe, 0x95, 0x00, 0x02, 0x04, 0x94, 0x07, 
-0x3e, 0x0b, 0x5c, 0x0c, 0x3b, 0x0a, 0x6b, 0x06, 0x58, 0x03, 0xfc, 0x02, 0x35, 0x03, 0xe7, 0x03, 
-0xbe, 0x03, 0xe0, 0x00, 0x20, 0xfd, 0x54, 0xf8, 0x79, 0xf5, 0x31, 0xf4, 0x81, 0xf4, 0x09, 0xf5, 
-0x6b, 0xf5, 0xf3, 0xf4, 0xdd, 0xf3, 0x05, 0xf1, 0x88, 0xed, 0x2a, 0xea, 0x6e, 0xea, 0x74, 0xed, 
-0xcc, 0xf3, 0x23, 0xfe, 0xa8, 0x07, 0xfa, 0x0c, 0x74, 0x09, 0x12, 0x03, 0x79, 0xfe, 0x52, 0x01, 
-0x13, 0x08, 0x40, 0x0f, 0xb7, 0x10, 0x08, 0x0c, 0x79, 0x05, 0x64, 0x02, 0x5c, 0x04, 0x4f, 0x08, 
-0x5f, 0x0b, 0x82, 0x0a, 0xc2, 0x07, 0x89, 0x02, 0x65, 0xff, 0x8c, 0xfe, 0x05, 0x01, 0x69, 0x05, 
-0xf0, 0x08, 0x85, 0x0b, 0xe0, 0x09, 0x54, 0x06, 0x52, 0x02, 0xb4, 0x01, 0xea, 0x02, 0xc0, 0x03, 
-0xcd, 0x02, 0x4f, 0x00, 0xb8, 0xfd, 0x75, 0xfa, 0xce, 0xf7, 0x91, 0xf5, 0x14, 0xf5, 0x7f, 0xf5, 
-0x78, 0xf6, 0xa6, 0xf6, 0x69, 0xf5, 0xab, 0xf2, 0xf4, 0xef, 0x7a, 0xee, 0x6b, 0xee, 0x1e, 0xf0, 
-0xfa, 0xf1, 0x7c, 0xf4, 0x6b, 0xfa, 0xd0, 0x02, 0xe3, 0x09, 0xd0, 0x0a, 0xc8, 0x06, 0xde, 0x01, 
-0x7c, 0x01, 0xc5, 0x05, 0xb9, 0x0b, 0xeb, 0x0e, 0x0c, 0x0d, 0x3e, 0x08, 0xe0, 0x04, 0x4f, 0x05, 
-0xb9, 0x07, 0xee, 0x09, 0x65, 0x09, 0xc4, 0x06, 0x99, 0x03, 0x13, 0x01, 0x5f, 0x00, 0x5f, 0x01, 
-0xa0, 0x03, 0x6c, 0x05, 0xc0, 0x06, 0xd2, 0x07, 0x0d, 0x07, 0xdf, 0x05, 0x66, 0x03, 0x27, 0x02, 
-0xaa, 0x01, 0xd2, 0x01, 0x22, 0x01, 0xd9, 0xfe, 0x49, 0xfb, 0xb8, 0xf7, 0x8b, 0xf5, 0x2b, 0xf5, 
-0xe2, 0xf6, 0x44, 0xf8, 0x15, 0xf8, 0xdf, 0xf4, 0xed, 0xf1, 0xe7, 0xef, 0x3f, 0xf0, 0x16, 0xf1, 
-0x98, 0xf1, 0x8b, 0xf2, 0xe4, 0xf2, 0xcb, 0xf7, 0xdc, 0xfe, 0x63, 0x07, 0x07, 0x0b, 0x92, 0x09, 
-0xee, 0x05, 0xdc, 0x03, 0x7b, 0x05, 0xd5, 0x08, 0xa3, 0x0c, 0x66, 0x0c, 0x76, 0x0a, 0xe3, 0x06, 
-0x41, 0x06, 0x57, 0x06, 0xc2, 0x07, 0x50, 0x07, 0x0f, 0x06, 0xd5, 0x03, 0x82, 0x01, 0xf7, 0x00, 
-0x1e, 0x00, 0x2a, 0x01, 0xf2, 0x01, 0x75, 0x04, 0xf6, 0x06, 0x58, 0x08, 0x73, 0x07, 0x1f, 0x05, 
-0x36, 0x03, 0x24, 0x02, 0xbf, 0x01, 0xf3, 0x00, 0xb8, 0xff, 0x62, 0xfd, 0xff, 0xfa, 0xb1, 0xf8, 
-0x9b, 0xf6, 0x11, 0xf5, 0xaa, 0xf4, 0x76, 0xf5, 0xd0, 0xf5, 0xf4, 0xf5, 0x22, 0xf5, 0x3a, 0xf4, 
-0xfd, 0xf1, 0xb5, 0xef, 0x58, 0xef, 0x00, 0xf1, 0x02, 0xf5, 0xed, 0xfb, 0xb4, 0x03, 0x1f, 0x09, 
-0x48, 0x09, 0xfb, 0x05, 0xa1, 0x03, 0x8f, 0x04, 0x8c, 0x08, 0x16, 0x0c, 0xe5, 0x0d, 0xb9, 0x0b, 
-0x32, 0x08, 0x74, 0x05, 0xda, 0x05, 0xd8, 0x07, 0x32, 0x09, 0x38, 0x08, 0x6a, 0x05, 0x19, 0x02, 
-0xa3, 0xff, 0x05, 0xff, 0x52, 0xff, 0x47, 0x01, 0x69, 0x03, 0x41, 0x06, 0xd8, 0x06, 0x92, 0x05, 
-0x09, 0x03, 0xae, 0x01, 0x92, 0x02, 0x92, 0x03, 0x36, 0x03, 0xd0, 0x00, 0x48, 0xfe, 0xfd, 0xfb, 
-0x63, 0xfa, 0xf5, 0xf8, 0xbb, 0xf7, 0x83, 0xf7, 0x75, 0xf8, 0x2a, 0xf9, 0xfc, 0xf7, 0x96, 0xf5, 
-0x6f, 0xf3, 0xad, 0xf3, 0xba, 0xf4, 0x30, 0xf5, 0x21, 0xf5, 0xa3, 0xf4, 0x6f, 0xf4, 0x8e, 0xf6, 
-0x3a, 0xfd, 0xdf, 0x04, 0x2c, 0x0a, 0xb9, 0x09, 0x18, 0x06, 0x4c, 0x03, 0x53, 0x04, 0xa3, 0x07, 
-0x27, 0x0b, 0x03, 0x0c, 0xc0, 0x09, 0x34, 0x07, 0xea, 0x05, 0xd0, 0x06, 0xce, 0x07, 0xee, 0x07, 
-0xf5, 0x05, 0x5f, 0x03, 0xbe, 0x00, 0x79, 0xff, 0x1e, 0xff, 0x58, 0xff, 0x19, 0x00, 0x05, 0x02, 
-0x15, 0x04, 0x3c, 0x05, 0x2d, 0x05, 0xb3, 0x03, 0xc8, 0x02, 0x73, 0x02, 0xe2, 0x02, 0x3f, 0x02, 
-0xea, 0x00, 0x71, 0xfe, 0x0d, 0xfc, 0x2d, 0xfa, 0xb0, 0xf8, 0x06, 0xf8, 0x2a, 0xf8, 0xdf, 0xf8, 
-0x32, 0xf9, 0x97, 0xf8, 0x6c, 0xf6, 0xbe, 0xf4, 0x7b, 0xf3, 0x19, 0xf3, 0x85, 0xf3, 0xb7, 0xf4, 
-0xa4, 0xf5, 0xdc, 0xf6, 0xbe, 0xfa, 0xed, 0x00, 0x42, 0x07, 0x8b, 0x09, 0xe9, 0x07, 0xff, 0x04, 
-0x36, 0x04, 0x55, 0x06, 0xbd, 0x09, 0xd2, 0x0b, 0xb1, 0x0a, 0xb6, 0x07, 0xa9, 0x05, 0x73, 0x06, 
-0x49, 0x08, 0xdd, 0x08, 0x98, 0x06, 0x10, 0x03, 0x2d, 0x00, 0x43, 0xff, 0xb8, 0xff, 0x2b, 0x00, 
-0xc0, 0x00, 0xbd, 0x01, 0x72, 0x03, 0x8a, 0x04, 0x1e, 0x05, 0xdc, 0x04, 0x91, 0x04, 0x32, 0x04, 
-0x97, 0x03, 0x6d, 0x02, 0xc2, 0x00, 0x39, 0xff, 0xc0, 0xfd, 0x5c, 0xfc, 0x5f, 0xfa, 0xa2, 0xf8, 
-0x24, 0xf7, 0x64, 0xf6, 0xda, 0xf5, 0x62, 0xf5, 0x0c, 0xf5, 0x32, 0xf5, 0xed, 0xf5, 0xa3, 0xf5, 
-0x9a, 0xf4, 0x45, 0xf3, 0x29, 0xf3, 0x43, 0xf4, 0x88, 0xf8, 0x33, 0xff, 0xb1, 0x05, 0xe6, 0x08, 
-0x11, 0x08, 0xd4, 0x05, 0x09, 0x05, 0xf1, 0x06, 0x5d, 0x09, 0x85, 0x0b, 0xe9, 0x0a, 0x89, 0x08, 
-0x07, 0x06, 0x78, 0x05, 0xae, 0x05, 0xcd, 0x05, 0x2b, 0x05, 0xb0, 0x03, 0x7f, 0x02, 0x7d, 0x01, 
-0x67, 0x01, 0xf3, 0x00, 0x4b, 0x00, 0xe1, 0xff, 0x86, 0x01, 0x3c, 0x04, 0x2b, 0x06, 0x24, 0x06, 
-0xb6, 0x04, 0x77, 0x03, 0xd4, 0x02, 0x0e, 0x03, 0xa3, 0x02, 0x67, 0x01, 0x2d, 0xff, 0xd7, 0xfc, 
-0xc0, 0xfa, 0xf9, 0xf8, 0x95, 0xf7, 0xfe, 0xf6, 0xb8, 0xf7, 0x40, 0xf8, 0xc4, 0xf7, 0x8e, 0xf6, 
-0xb0, 0xf5, 0x91, 0xf5, 0x46, 0xf5, 0xc3, 0xf4, 0x6d, 0xf4, 0xf9, 0xf4, 0x79, 0xf6, 0x6a, 0xfa, 
-0xaa, 0xff, 0x50, 0x04, 0x7a, 0x06, 0x51, 0x06, 0xab, 0x05, 0x19, 0x06, 0xaa, 0x07, 0xed, 0x08, 
-0x69, 0x09, 0x6b, 0x08, 0x6e, 0x07, 0x51, 0x07, 0xd5, 0x07, 0x7e, 0x07, 0x4a, 0x06, 0xad, 0x04, 
-0x68, 0x03, 0x70, 0x02, 0x85, 0x01, 0xa7, 0x00, 0xca, 0xff, 0xc1, 0xff, 0xdb, 0x00, 0xba, 0x02, 
-0x2a, 0x04, 0xc7, 0x04, 0xaa, 0x04, 0x43, 0x04, 0xb7, 0x03, 0x2d, 0x03, 0x8a, 0x02, 0xa8, 0x01, 
-0x8a, 0x00, 0x5e, 0xff, 0x28, 0xfe, 0x5a, 0xfc, 0x38, 0xfa, 0x45, 0xf8, 0x80, 0xf7, 0xd7, 0xf7, 
-0x4d, 0xf8, 0x05, 0xf8, 0x48, 0xf7, 0x80, 0xf6, 0xc0, 0xf5, 0x05, 0xf5, 0x96, 0xf4, 0xe2, 0xf4, 
-0xfc, 0xf5, 0xc1, 0xf7, 0x88, 0xfa, 0x4c, 0xfe, 0xfc, 0x01, 0x74, 0x04, 0x86, 0x05, 0xb0, 0x05, 
-0x2d, 0x06, 0x3c, 0x07, 0x6d, 0x08, 0x17, 0x09, 0xe1, 0x08, 0x3d, 0x08, 0xcb, 0x07, 0xae, 0x07, 
-0x3b, 0x07, 0x50, 0x06, 0xee, 0x04, 0x9b, 0x03, 0xa5, 0x02, 0x37, 0x02, 0xc6, 0x01, 0xfd, 0x00, 
-0x5f, 0x00, 0xbe, 0x00, 0xda, 0x01, 0xe4, 0x02, 0xa3, 0x03, 0xfc, 0x03, 0x34, 0x04, 0x2a, 0x04, 
-0x96, 0x03, 0xad, 0x02, 0x7f, 0x01, 0x0a, 0x00, 0x78, 0xfe, 0xd5, 0xfc, 0xf7, 0xfa, 0x4b, 0xf9, 
-0x40, 0xf8, 0xf6, 0xf7, 0xd1, 0xf7, 0x53, 0xf7, 0xc6, 0xf6, 0x93, 0xf6, 0xaa, 0xf6, 0x75, 0xf6, 
-0x05, 0xf6, 0x93, 0xf5, 0xeb, 0xf5, 0x01, 0xf7, 0xac, 0xf8, 0x04, 0xfb, 0xe3, 0xfd, 0x04, 0x01, 
-0xe8, 0x03, 0xe3, 0x05, 0xa7, 0x06, 0x08, 0x07, 0x68, 0x07, 0x35, 0x08, 0x10, 0x09, 0x53, 0x09, 
-0xd1, 0x08, 0x23, 0x08, 0xa2, 0x07, 0x17, 0x07, 0x5b, 0x06, 0x1c, 0x05, 0xf2, 0x03, 0xee, 0x02, 
-0x2d, 0x02, 0xab, 0x01, 0x3b, 0x01, 0xdf, 0x00, 0xdc, 0x00, 0x50, 0x01, 0xff, 0x01, 0x9c, 0x02, 
-0xe7, 0x02, 0xee, 0x02, 0xc8, 0x02, 0x70, 0x02, 0x21, 0x02, 0xc5, 0x01, 0x01, 0x01, 0x91, 0xff, 
-0x9c, 0xfd, 0x87, 0xfb, 0x13, 0xfa, 0x5e, 0xf9, 0x2e, 0xf9, 0xf4, 0xf8, 0x4a, 0xf8, 0x55, 0xf7, 
-0x83, 0xf6, 0x45, 0xf6, 0x81, 0xf6, 0xbf, 0xf6, 0xae, 0xf6, 0x63, 0xf6, 0xb3, 0xf6, 0x66, 0xf7, 
-0xe4, 0xf8, 0x5d, 0xfb, 0x56, 0xfe, 0x26, 0x01, 0x4a, 0x03, 0xef, 0x04, 0x7a, 0x06, 0xf6, 0x07, 
-0xf3, 0x08, 0x70, 0x09, 0x70, 0x09, 0x74, 0x09, 0x69, 0x09, 0x59, 0x09, 0xcc, 0x08, 0xa4, 0x07, 
-0x4d, 0x06, 0x00, 0x05, 0xcd, 0x03, 0x91, 0x02, 0x98, 0x01, 0xb7, 0x00, 0x4b, 0x00, 0x41, 0x00, 
-0x73, 0x00, 0xcd, 0x00, 0x23, 0x01, 0x92, 0x01, 0x1a, 0x02, 0xb5, 0x02, 0xf4, 0x02, 0xe5, 0x02, 
-0x4e, 0x02, 0x56, 0x01, 0x2c, 0x00, 0xd4, 0xfe, 0x15, 0xfd, 0x62, 0xfb, 0x36, 0xfa, 0xba, 0xf9, 
-0x7c, 0xf9, 0xbb, 0xf8, 0xc2, 0xf7, 0x0e, 0xf7, 0xd7, 0xf6, 0xe1, 0xf6, 0xac, 0xf6, 0x40, 0xf6, 
-0x07, 0xf6, 0x9c, 0xf6, 0x83, 0xf7, 0xe8, 0xf8, 0x23, 0xfb, 0xb0, 0xfd, 0x28, 0x00, 0x38, 0x02, 
-0x02, 0x04, 0xbf, 0x05, 0x14, 0x07, 0x17, 0x08, 0x16, 0x09, 0xc7, 0x09, 0x1a, 0x0a, 0xf6, 0x09, 
-0xb0, 0x09, 0x42, 0x09, 0x9e, 0x08, 0xa3, 0x07, 0x22, 0x06, 0x71, 0x04, 0xeb, 0x02, 0xf3, 0x01, 
-0x6d, 0x01, 0x13, 0x01, 0xb8, 0x00, 0x75, 0x00, 0x57, 0x00, 0x6c, 0x00, 0xcb, 0x00, 0x2d, 0x01, 
-0x5d, 0x01, 0x62, 0x01, 0x2a, 0x01, 0xba, 0x00, 0x1c, 0x00, 0x2d, 0xff, 0xf2, 0xfd, 0x99, 0xfc, 
-0x5a, 0xfb, 0x7c, 0xfa, 0xf9, 0xf9, 0x7d, 0xf9, 0xe2, 0xf8, 0x44, 0xf8, 0xc2, 0xf7, 0x58, 0xf7, 
-0x46, 0xf7, 0x25, 0xf7, 0xe4, 0xf6, 0xc9, 0xf6, 0x21, 0xf7, 0xe8, 0xf7, 0x06, 0xf9, 0xef, 0xfa, 
-0x23, 0xfd, 0x72, 0xff, 0x9f, 0x01, 0xb1, 0x03, 0x9a, 0x05, 0xe7, 0x06, 0x09, 0x08, 0x00, 0x09, 
-0xa3, 0x09, 0xfd, 0x09, 0x13, 0x0a, 0xfa, 0x09, 0x88, 0x09, 0x95, 0x08, 0x82, 0x07, 0x38, 0x06, 
-0xc3, 0x04, 0x7f, 0x03, 0x8c, 0x02, 0xe8, 0x01, 0x35, 0x01, 0xab, 0x00, 0x5c, 0x00, 0x3e, 0x00, 
-0x48, 0x00, 0x7a, 0x00, 0xb4, 0x00, 0xda, 0x00, 0xe9, 0x00, 0xa1, 0x00, 0x2e, 0x00, 0x6c, 0xff, 
-0xbc, 0xfe, 0xeb, 0xfd, 0x04, 0xfd, 0x31, 0xfc, 0x7d, 0xfb, 0xee, 0xfa, 0x59, 0xfa, 0xd2, 0xf9, 
-0x41, 0xf9, 0xe2, 0xf8, 0x59, 0xf8, 0xf7, 0xf7, 0xa6, 0xf7, 0x53, 0xf7, 0x48, 0xf7, 0x7b, 0xf7, 
-0xdc, 0xf7, 0x6e, 0xf8, 0xd7, 0xf9, 0xeb, 0xfb, 0x46, 0xfe, 0x7c, 0x00, 0x6c, 0x02, 0x5a, 0x04, 
-0x0a, 0x06, 0x97, 0x07, 0xd8, 0x08, 0xcb, 0x09, 0x58, 0x0a, 0x7d, 0x0a, 0x78, 0x0a, 0x3c, 0x0a, 
-0x7b, 0x09, 0x54, 0x08, 0xe4, 0x06, 0x6a, 0x05, 0x4c, 0x04, 0x46, 0x03, 0x6e, 0x02, 0x7b, 0x01, 
-0x95, 0x00, 0xf7, 0xff, 0xac, 0xff, 0xb6, 0xff, 0xe6, 0xff, 0x02, 0x00, 0x0e, 0x00, 0x28, 0x00, 
-0x26, 0x00, 0xfe, 0xff, 0x8e, 0xff, 0xfc, 0xfe, 0x16, 0xfe, 0x29, 0xfd, 0x74, 0xfc, 0xcf, 0xfb, 
-0x6c, 0xfb, 0x06, 0xfb, 0x60, 0xfa, 0x9a, 0xf9, 0xc0, 0xf8, 0xe3, 0xf7, 0x95, 0xf7, 0x7b, 0xf7, 
-0x53, 0xf7, 0x54, 0xf7, 0x71, 0xf7, 0xf3, 0xf7, 0xbd, 0xf8, 0x15, 0xfa, 0xfb, 0xfb, 0x16, 0xfe, 
-0x0d, 0x00, 0xb2, 0x01, 0xa9, 0x03, 0xb8, 0x05, 0x91, 0x07, 0xe5, 0x08, 0xac, 0x09, 0x0d, 0x0a, 
-0x3e, 0x0a, 0x48, 0x0a, 0x1b, 0x0a, 0x8e, 0x09, 0x7e, 0x08, 0x32, 0x07, 0xb7, 0x05, 0x4a, 0x04, 
-0x1a, 0x03, 0x44, 0x02, 0x6f, 0x01, 0xce, 0x00, 0x12, 0x00, 0xaa, 0xff, 0xa1, 0xff, 0xa1, 0xff, 
-0x8e, 0xff, 0x87, 0xff, 0xa0, 0xff, 0xaf, 0xff, 0xa0, 0xff, 0x2c, 0xff, 0x88, 0xfe, 0xa1, 0xfd, 
-0xdf, 0xfc, 0x4c, 0xfc, 0x1c, 0xfc, 0xf3, 0xfb, 0x72, 0xfb, 0xc7, 0xfa, 0x3d, 0xfa, 0x04, 0xfa, 
-0x9e, 0xf9, 0x14, 0xf9, 0x84, 0xf8, 0x27, 0xf8, 0x54, 0xf8, 0xcd, 0xf8, 0x4f, 0xf9, 0xd0, 0xf9, 
-0x25, 0xfa, 0xfa, 0xfa, 0x78, 0xfc, 0x4b, 0xfe, 0x41, 0x00, 0xff, 0x01, 0xcd, 0x03, 0x58, 0x05, 
-0xc5, 0x06, 0x1b, 0x08, 0x11, 0x09, 0x97, 0x09, 0x9d, 0x09, 0x7c, 0x09, 0x49, 0x09, 0xe1, 0x08, 
-0x34, 0x08, 0x0d, 0x07, 0xc7, 0x05, 0x9f, 0x04, 0x8c, 0x03, 0xc4, 0x02, 0xdf, 0x01, 0xd6, 0x00, 
-0x09, 0x00, 0x93, 0xff, 0x71, 0xff, 0x78, 0xff, 0x68, 0xff, 0x5a, 0xff, 0x2b, 0xff, 0xe8, 0xfe, 
-0xbe, 0xfe, 0x65, 0xfe, 0xf8, 0xfd, 0x5a, 0xfd, 0xe1, 0xfc, 0xbc, 0xfc, 0x9a, 0xfc, 0x30, 0xfc, 
-0x75, 0xfb, 0xbb, 0xfa, 0x14, 0xfa, 0xc7, 0xf9, 0xb9, 0xf9, 0x8c, 0xf9, 0x36, 0xf9, 0xe4, 0xf8, 
-0xce, 0xf8, 0x11, 0xf9, 0x75, 0xf9, 0xeb, 0xf9, 0xae, 0xfa, 0x1a, 0xfc, 0xeb, 0xfd, 0xf3, 0xff, 
-0xe2, 0x01, 0x7f, 0x03, 0x08, 0x05, 0x46, 0x06, 0x74, 0x07, 0x63, 0x08, 0x09, 0x09, 0x77, 0x09, 
-0x96, 0x09, 0x68, 0x09, 0xf3, 0x08, 0x21, 0x08, 0x0d, 0x07, 0xbb, 0x05, 0x96, 0x04, 0xa0, 0x03, 
-0xd8, 0x02, 0x0c, 0x02, 0x10, 0x01, 0x3e, 0x00, 0xb8, 0xff, 0x86, 0xff, 0x5f, 0xff, 0x60, 0xff, 
-0x4a, 0xff, 0x3f, 0xff, 0x34, 0xff, 0xfa, 0xfe, 0x92, 0xfe, 0xf7, 0xfd, 0x26, 0xfd, 0x3e, 0xfc, 
-0xa7, 0xfb, 0x21, 0xfb, 0xda, 0xfa, 0x91, 0xfa, 0x1a, 0xfa, 0xac, 0xf9, 0x33, 0xf9, 0xc3, 0xf8, 
-0x8e, 0xf8, 0x95, 0xf8, 0xb4, 0xf8, 0x14, 0xf9, 0x8a, 0xf9, 0x51, 0xfa, 0x48, 0xfb, 0x27, 0xfc, 
-0x3f, 0xfd, 0xa6, 0xfe, 0x2f, 0x00, 0xdd, 0x01, 0x7c, 0x03, 0x0e, 0x05, 0x7d, 0x06, 0x79, 0x07, 
-0x3d, 0x08, 0xca, 0x08, 0x15, 0x09, 0x0f, 0x09, 0xc4, 0x08, 0x5a, 0x08, 0xbc, 0x07, 0xdf, 0x06, 
-0xde, 0x05, 0xdd, 0x04, 0xd8, 0x03, 0xdf, 0x02, 0x02, 0x02, 0x45, 0x01, 0xa2, 0x00, 0x0f, 0x00, 
-0x92, 0xff, 0x2f, 0xff, 0xfa, 0xfe, 0xe5, 0xfe, 0xdb, 0xfe, 0xd3, 0xfe, 0xbc, 0xfe, 0x5d, 0xfe, 
-0xb4, 0xfd, 0xdd, 0xfc, 0x3a, 0xfc, 0xe6, 0xfb, 0xce, 0xfb, 0xc4, 0xfb, 0x67, 0xfb, 0xe4, 0xfa, 
-0x5b, 0xfa, 0xdb, 0xf9, 0x7b, 0xf9, 0x45, 0xf9, 0x64, 0xf9, 0x9f, 0xf9, 0xf9, 0xf9, 0x69, 0xfa, 
-0xe9, 0xfa, 0x81, 0xfb, 0xf5, 0xfb, 0x67, 0xfc, 0x49, 0xfd, 0xcd, 0xfe, 0xab, 0x00, 0x82, 0x02, 
-0xff, 0x03, 0x60, 0x05, 0x7d, 0x06, 0x98, 0x07, 0x7f, 0x08, 0x03, 0x09, 0x27, 0x09, 0x23, 0x09, 
-0x05, 0x09, 0x83, 0x08, 0xe4, 0x07, 0xf4, 0x06, 0xf9, 0x05, 0xc9, 0x04, 0xa2, 0x03, 0xb3, 0x02, 
-0xdc, 0x01, 0x1a, 0x01, 0x3a, 0x00, 0x95, 0xff, 0x16, 0xff, 0xc0, 0xfe, 0x88, 0xfe, 0x51, 0xfe, 
-0x26, 0xfe, 0xcd, 0xfd, 0x78, 0xfd, 0x2d, 0xfd, 0xd6, 0xfc, 0xae, 0xfc, 0xae, 0xfc, 0xce, 0xfc, 
-0xbd, 0xfc, 0x7f, 0xfc, 0x3a, 0xfc, 0xed, 0xfb, 0x8d, 0xfb, 0x22, 0xfb, 0xc5, 0xfa, 0x89, 0xfa, 
-0x66, 0xfa, 0x44, 0xfa, 0x48, 0xfa, 0x90, 0xfa, 0x13, 0xfb, 0xa5, 0xfb, 0x55, 0xfc, 0x1d, 0xfd, 
-0x19, 0xfe, 0x39, 0xff, 0x8c, 0x00, 0x0b, 0x02, 0x86, 0x03, 0xf9, 0x04, 0x39, 0x06, 0x51, 0x07, 
-0x3c, 0x08, 0xc6, 0x08, 0xff, 0x08, 0xfc, 0x08, 0xbe, 0x08, 0x65, 0x08, 0xb3, 0x07, 0xd6, 0x06, 
-0xbf, 0x05, 0x74, 0x04, 0x37, 0x03, 0xfa, 0x01, 0xd3, 0x00, 0xb4, 0xff, 0xb5, 0xfe, 0xd0, 0xfd, 
-0x30, 0xfd, 0xb2, 0xfc, 0x39, 0xfc, 0xee, 0xfb, 0xb3, 0xfb, 0xb9, 0xfb, 0xdb, 0xfb, 0x07, 0xfc, 
-0x2d, 0xfc, 0x45, 0xfc, 0x51, 0xfc, 0x5b, 0xfc, 0x83, 0xfc, 0xa5, 0xfc, 0xc4, 0xfc, 0xc8, 0xfc, 
-0xb9, 0xfc, 0x87, 0xfc, 0x3c, 0xfc, 0x02, 0xfc, 0xed, 0xfb, 0xfa, 0xfb, 0x2b, 0xfc, 0xb5, 0xfc, 
-0x72, 0xfd, 0x0e, 0xfe, 0x9e, 0xfe, 0x59, 0xff, 0x3d, 0x00, 0x51, 0x01, 0x7a, 0x02, 0xaf, 0x03, 
-0xde, 0x04, 0x09, 0x06, 0x04, 0x07, 0xad, 0x07, 0xfc, 0x07, 0xec, 0x07, 0xd0, 0x07, 0x69, 0x07, 
-0xf3, 0x06, 0x56, 0x06, 0x74, 0x05, 0x8a, 0x04, 0x73, 0x03, 0x62, 0x02, 0x4d, 0x01, 0x57, 0x00, 
-0x63, 0xff, 0x8c, 0xfe, 0xc8, 0xfd, 0x1c, 0xfd, 0x86, 0xfc, 0xf7, 0xfb, 0x7c, 0xfb, 0x15, 0xfb, 
-0x07, 0xfb, 0x2e, 0xfb, 0x89, 0xfb, 0xe8, 0xfb, 0x32, 0xfc, 0x66, 0xfc, 0xab, 0xfc, 0xd6, 0xfc, 
-0xd5, 0xfc, 0xb7, 0xfc, 0x89, 0xfc, 0x8e, 0xfc, 0xb9, 0xfc, 0x01, 0xfd, 0x56, 0xfd, 0x84, 0xfd, 
-0xac, 0xfd, 0xe9, 0xfd, 0x28, 0xfe, 0x83, 0xfe, 0xee, 0xfe, 0x8d, 0xff, 0x2f, 0x00, 0xfe, 0x00, 
-0xd3, 0x01, 0xb8, 0x02, 0xb4, 0x03, 0x77, 0x04, 0x22, 0x05, 0x9f, 0x05, 0x12, 0x06, 0x6e, 0x06, 
-0x9e, 0x06, 0x99, 0x06, 0x78, 0x06, 0x08, 0x06, 0x6e, 0x05, 0xb5, 0x04, 0xe7, 0x03, 0xfd, 0x02, 
-0xf3, 0x01, 0xf8, 0x00, 0xf2, 0xff, 0x22, 0xff, 0x4e, 0xfe, 0xac, 0xfd, 0x29, 0xfd, 0xdb, 0xfc, 
-0xb9, 0xfc, 0x93, 0xfc, 0x80, 0xfc, 0x43, 0xfc, 0x3c, 0xfc, 0x2c, 0xfc, 0x42, 0xfc, 0x6c, 0xfc, 
-0x89, 0xfc, 0xc3, 0xfc, 0xec, 0xfc, 0x28, 0xfd, 0x62, 0xfd, 0x90, 0xfd, 0x84, 0xfd, 0x6c, 0xfd, 
-0x66, 0xfd, 0x74, 0xfd, 0xa9, 0xfd, 0xf7, 0xfd, 0x6d, 0xfe, 0xdb, 0xfe, 0x54, 0xff, 0xe4, 0xff, 
-0x7c, 0x00, 0xee, 0x00, 0x3a, 0x01, 0x9d, 0x01, 0x21, 0x02, 0xa7, 0x02, 0x1a, 0x03, 0x96, 0x03, 
-0xf3, 0x03, 0x40, 0x04, 0x78, 0x04, 0x9e, 0x04, 0xba, 0x04, 0xa5, 0x04, 0x94, 0x04, 0x61, 0x04, 
-0x16, 0x04, 0xc7, 0x03, 0x6e, 0x03, 0xee, 0x02, 0x54, 0x02, 0x9b, 0x01, 0xf5, 0x00, 0x56, 0x00, 
-0x9e, 0xff, 0xf7, 0xfe, 0x36, 0xfe, 0xa1, 0xfd, 0x1b, 0xfd, 0xc8, 0xfc, 0xa0, 0xfc, 0x96, 0xfc, 
-0xb0, 0xfc, 0xc3, 0xfc, 0xd7, 0xfc, 0xe3, 0xfc, 0xf6, 0xfc, 0x00, 0xfd, 0x21, 0xfd, 0x39, 0xfd, 
-0x6d, 0xfd, 0xa6, 0xfd, 0xd2, 0xfd, 0x12, 0xfe, 0x4e, 0xfe, 0xbd, 0xfe, 0xf6, 0xfe, 0x77, 0xff, 
-0xf9, 0xff, 0x1e, 0x00, 0x6a, 0x00, 0xae, 0x00, 0xf7, 0x00, 0x27, 0x01, 0x4e, 0x01, 0x71, 0x01, 
-0xc6, 0x01, 0x0b, 0x02, 0x47, 0x02, 0x67, 0x02, 0x59, 0x02, 0x52, 0x02, 0x2a, 0x02, 0x1b, 0x02, 
-0x0f, 0x02, 0x02, 0x02, 0x05, 0x02, 0x0a, 0x02, 0xf5, 0x01, 0xe7, 0x01, 0xc5, 0x01, 0x8d, 0x01, 
-0x54, 0x01, 0x0d, 0x01, 0xd3, 0x00, 0x98, 0x00, 0x4d, 0x00, 0xeb, 0xff, 0x7f, 0xff, 0x0b, 0xff, 
-0xb3, 0xfe, 0x61, 0xfe, 0x0e, 0xfe, 0xcc, 0xfd, 0x8c, 0xfd, 0x69, 0xfd, 0x59, 0xfd, 0x4f, 0xfd, 
-0x5a, 0xfd, 0x6b, 0xfd, 0x80, 0xfd, 0xb7, 0xfd, 0x09, 0xfe, 0x61, 0xfe, 0xa6, 0xfe, 0xea, 0xfe, 
-0x26, 0xff, 0x6e, 0xff, 0xbe, 0xff, 0x15, 0x00, 0x7c, 0x00, 0xd5, 0x00, 0x11, 0x01, 0x35, 0x01, 
-0x53, 0x01, 0x5c, 0x01, 0x64, 0x01, 0x4c, 0x01, 0x4e, 0x01, 0x54, 0x01, 0x48, 0x01, 0x39, 0x01, 
-0x20, 0x01, 0x0f, 0x01, 0xf6, 0x00, 0xe9, 0x00, 0xcf, 0x00, 0xb9, 0x00, 0xbd, 0x00, 0xc2, 0x00, 
-0xbf, 0x00, 0xa2, 0x00, 0x74, 0x00, 0x77, 0x00, 0x73, 0x00, 0x53, 0x00, 0x49, 0x00, 0x32, 0x00, 
-0x1f, 0x00, 0xfc, 0xff, 0xc8, 0xff, 0xa4, 0xff, 0x62, 0xff, 0x1f, 0xff, 0xf3, 0xfe, 0xc9, 0xfe, 
-0xab, 0xfe, 0x89, 0xfe, 0x75, 0xfe, 0x79, 0xfe, 0x90, 0xfe, 0xae, 0xfe, 0xbc, 0xfe, 0xe1, 0xfe, 
-0x0c, 0xff, 0x42, 0xff, 0x7f, 0xff, 0xb1, 0xff, 0xef, 0xff, 0x2a, 0x00, 0x60, 0x00, 0x86, 0x00, 
-0xa5, 0x00, 0xd3, 0x00, 0x05, 0x01, 0x09, 0x01, 0xf9, 0x00, 0xf6, 0x00, 0xe5, 0x00, 0xd6, 0x00, 
-0xb5, 0x00, 0xaa, 0x00, 0x7a, 0x00, 0x73, 0x00, 0x6c, 0x00, 0x67, 0x00, 0xb7, 0x00, 0x65, 0x00, 
-0xd6, 0xff, 0xd9, 0xff, 0x2c, 0x00, 0xed, 0xff, 0xed, 0xff, 0xf4, 0xff, 0xb9, 0xff, 0xb9, 0xff, 
-0xc0, 0xff, 0xc2, 0xff, 0xb3, 0xff, 0xc7, 0xff, 0xa4, 0xff, 0x9e, 0xff, 0x9d, 0xff, 0x9c, 0xff, 
-0x97, 0xff, 0x7a, 0xff, 0x75, 0xff, 0x6d, 0xff, 0x82, 0xff, 0x93, 0xff, 0xa7, 0xff, 0xb9, 0xff, 
-0xd1, 0xff, 0x04, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x23, 0x00, 0x32, 0x00, 0x42, 0x00, 
-0x48, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x6c, 0x00, 0x6b, 0x00, 0x54, 0x00, 0x42, 0x00, 0x2c, 0x00, 
-0x05, 0x00, 0xf7, 0xff, 0xfd, 0xff, 0x11, 0x00, 0x22, 0x00, 0x5f, 0x00, 0x71, 0x00, 0x16, 0x00, 
-0x0f, 0x00, 0x50, 0x00, 0x40, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x06, 0x00, 0xe6, 0xff, 0xde, 0xff, 
-0xd7, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xbf, 0xff, 0xb0, 0xff, 0xb7, 0xff, 0xa9, 0xff, 0xa3, 0xff, 
-0xa1, 0xff, 0xa1, 0xff, 0xac, 0xff, 0xc7, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0x21, 0x00, 0x34, 0x00, 
-0x49, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x5b, 0x00, 0x46, 0x00, 0x40, 0x00, 0x37, 0x00, 
-0x26, 0x00, 0x2b, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x09, 0x00, 0xff, 0xff, 0xec, 0xff, 0xd3, 0xff, 
-0x2c, 0x00, 0x2f, 0x00, 0xc6, 0xff, 0xc6, 0xff, 0xff, 0xff, 0x07, 0x00, 0xf4, 0xff, 0x04, 0x00, 
-0x05, 0x00, 0xf0, 0xff, 0xe2, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xf2, 0xff, 0xf5, 0xff, 
-0xfd, 0xff, 0x0f, 0x00, 0x23, 0x00, 0x34, 0x00, 0x3b, 0x00, 0x40, 0x00, 0x3b, 0x00, 0x34, 0x00, 
-0x23, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x1d, 0x00, 0x1c, 0x00, 0x10, 0x00, 
-0xfd, 0xff, 0xe2, 0xff, 0xe5, 0xff, 0xe7, 0xff, 0xef, 0xff, 0x00, 0x00, 0x16, 0x00, 0x2c, 0x00, 
-0x39, 0x00, 0x4e, 0x00, 0x4a, 0x00, 0x4e, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x45, 0x00, 0x29, 0x00, 
-0x1a, 0x00, 0x06, 0x00, 0x02, 0x00, 0xee, 0xff, 0xe2, 0xff, 0xe1, 0xff, 0xd1, 0xff, 0xd5, 0xff, 
-0xda, 0xff, 0xcd, 0xff, 0xba, 0xff, 0xad, 0xff, 0xb9, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xf8, 0xff, 
-0x2e, 0x00, 0x3b, 0x00, 0x35, 0x00, 0x44, 0x00, 0x4a, 0x00, 0x31, 0x00, 0x13, 0x00, 0x12, 0x00, 
-0x19, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x40, 0x00, 0x37, 0x00, 0x24, 0x00, 
-0x10, 0x00, 0x05, 0x00, 0x03, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 
-0x06, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xee, 0xff, 0xe8, 0xff, 0xea, 0xff, 0xee, 0xff, 0xed, 0xff, 
-0xf6, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0xff, 0xff, 0xf9, 0xff, 
-0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xf7, 0xff, 
-0xf8, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 
-0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0xff, 0xff, 
-0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 
-0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xff, 
-0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 
-};
-
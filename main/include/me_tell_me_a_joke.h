@@ -1,945 +0,0 @@
-#include <stdio.h>
-const unsigned char me_tell_me_a_joke[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x02, 0x00, 0xfe, 0xff, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 
-0x01, 0x00, 0x02, 0x00, 0xfc, 0xff, 0x04, 0x00, 0xff, 0xff, 0xfd, 0xff, 0x03, 0x00, 0x02, 0x00, 
-0xfa, 0xff, 0x06, 0x00, 0x00, 0x00, 0xfa, 0xff, 0x05, 0x00, 0x01, 0x00, 0xfa, 0xff, 0x05, 0x00, 
-0x02, 0x00, 0xf7, 0xff, 0x06, 0x00, 0x01, 0x00, 0xf8, 0xff, 0x05, 0x00, 0x05, 0x00, 0xf7, 0xff, 
-0x07, 0x00, 0x01, 0x00, 0xfb, 0xff, 0x02, 0x00, 0x04, 0x00, 0xfa, 0xff, 0x02, 0x00, 0x04, 0x00, 
-0xf9, 0xff, 0x06, 0x00, 0xfe, 0xff, 0x04, 0x00, 0xfc, 0xff, 0x06, 0x00, 0xfe, 0xff, 0xfa, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0x06, 0x00, 0xfb, 0xff, 0x04, 0x00, 0x02, 0x00, 0x06, 0x00, 0x02, 0x00, 
-0xff, 0xff, 0xfa, 0xff, 0x0b, 0x00, 0x02, 0x00, 0xfe, 0xff, 0x0d, 0x00, 0xf5, 0xff, 0x04, 0x00, 
-0x03, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd4, 0xff, 
-0xdf, 0xff, 0x10, 0x00, 0xf7, 0xff, 0x17, 0x00, 0x07, 0x00, 0x04, 0x00, 0x04, 0x00, 0xe8, 0xff, 
-0xfd, 0xff, 0xf2, 0xff, 0x11, 0x00, 0x14, 0x00, 0xf9, 0xff, 0xf0, 0xff, 0xdd, 0xff, 0x07, 0x00, 
-0x20, 0x00, 0xff, 0xff, 0xf6, 0xff, 0x1b, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x18, 0x00, 0x1d, 0x00, 
-0xe3, 0xff, 0x05, 0x00, 0x23, 0x00, 0xe2, 0xff, 0xf2, 0xff, 0x49, 0x00, 0x03, 0x00, 0xfa, 0xff, 
-0x09, 0x00, 0xc6, 0xff, 0x16, 0x00, 0x31, 0x00, 0xea, 0xff, 0xf7, 0xff, 0x0f, 0x00, 0xf8, 0xff, 
-0xa9, 0xff, 0x1e, 0x00, 0x1e, 0x00, 0xe3, 0xff, 0x42, 0x00, 0x05, 0x00, 0x24, 0x00, 0x08, 0x00, 
-0xfd, 0xff, 0x0d, 0x00, 0x9b, 0xff, 0x26, 0x00, 0xd7, 0xff, 0xf7, 0xff, 0x95, 0x00, 0x66, 0xff, 
-0x22, 0x00, 0x37, 0x00, 0x94, 0xff, 0x51, 0x00, 0x3d, 0x00, 0xe7, 0xff, 0xe6, 0xff, 0x12, 0x00, 
-0x10, 0x00, 0x24, 0x00, 0x76, 0x00, 0x03, 0xff, 0x86, 0x05, 0x0b, 0x01, 0x6e, 0xfd, 0x7b, 0x00, 
-0x1c, 0xfe, 0x6c, 0x00, 0x56, 0xff, 0x60, 0x00, 0x9b, 0xff, 0x8b, 0xff, 0x64, 0xff, 0x5f, 0xff, 
-0x50, 0x00, 0x9f, 0xff, 0x08, 0x00, 0x3c, 0x00, 0xc5, 0xff, 0xd7, 0xff, 0x3c, 0x00, 0x2c, 0x00, 
-0x25, 0x00, 0x2f, 0x00, 0x29, 0x00, 0xe4, 0xff, 0x19, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xdc, 0xff, 
-0x40, 0xff, 0x82, 0x00, 0xb4, 0xff, 0x6a, 0x00, 0xdd, 0xfe, 0x0d, 0x03, 0x4c, 0x04, 0x71, 0xfe, 
-0x26, 0xff, 0xf4, 0xfd, 0x1d, 0xff, 0x18, 0xff, 0x46, 0x00, 0x2e, 0x00, 0xb9, 0xfd, 0xaf, 0xff, 
-0x0b, 0xff, 0x8e, 0xff, 0x16, 0x00, 0xdb, 0xff, 0x44, 0x01, 0x8f, 0x00, 0xff, 0xff, 0x0a, 0x00, 
-0x90, 0x00, 0x63, 0x00, 0x1c, 0x00, 0x2b, 0x00, 0xec, 0xff, 0xba, 0xff, 0xcc, 0xff, 0x8b, 0xff, 
-0x0e, 0x00, 0x74, 0xff, 0xe3, 0xfe, 0x8a, 0x00, 0x84, 0xff, 0x1d, 0x00, 0xe6, 0xff, 0x9f, 0xff, 
-0x6f, 0x00, 0xab, 0xff, 0xf2, 0xff, 0x85, 0x00, 0x6e, 0x00, 0x0d, 0x00, 0x33, 0x00, 0x4f, 0x00, 
-0x6e, 0x00, 0x45, 0x00, 0xb5, 0x00, 0xfb, 0x00, 0x0f, 0x00, 0x8c, 0x00, 0x53, 0x00, 0xc4, 0xff, 
-0xfc, 0xff, 0xcd, 0xff, 0xdd, 0xff, 0x33, 0x00, 0x09, 0x00, 0x54, 0xff, 0xc1, 0xff, 0x50, 0xff, 
-0x75, 0xff, 0x77, 0xff, 0xd3, 0x00, 0xb1, 0xff, 0x8f, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0xa6, 0xff, 
-0x2f, 0x00, 0x34, 0x00, 0xa6, 0xff, 0x2e, 0x00, 0x39, 0x00, 0xd3, 0xff, 0x8f, 0xff, 0xd1, 0xff, 
-0xc8, 0xff, 0xcb, 0xff, 0xb5, 0xff, 0xfe, 0xff, 0x55, 0x00, 0xe1, 0xff, 0xb1, 0xff, 0x45, 0x00, 
-0xd4, 0xff, 0x57, 0xff, 0xb6, 0xff, 0xc4, 0xff, 0x64, 0xff, 0x16, 0x00, 0x36, 0x00, 0x86, 0xff, 
-0xa1, 0xff, 0x11, 0x00, 0xc9, 0xff, 0xbb, 0xff, 0xa1, 0x00, 0x79, 0x00, 0xe6, 0xff, 0x33, 0x00, 
-0x67, 0x00, 0xcf, 0xff, 0x38, 0x00, 0xc2, 0x00, 0x35, 0x00, 0xe5, 0xff, 0x45, 0x00, 0x2b, 0x00, 
-0xc9, 0xff, 0xed, 0xff, 0xfe, 0xff, 0x9d, 0xff, 0x6a, 0xff, 0xc1, 0xff, 0x32, 0x00, 0x40, 0x00, 
-0x27, 0x00, 0x3a, 0x00, 0xdd, 0xff, 0x71, 0xff, 0xbb, 0xff, 0xe9, 0xff, 0xa5, 0xff, 0xf4, 0xff, 
-0x11, 0x00, 0x74, 0xff, 0xb4, 0xff, 0x54, 0x00, 0xed, 0xff, 0xdf, 0xff, 0x6b, 0x00, 0xf0, 0xff, 
-0x9a, 0xff, 0x2c, 0x00, 0x00, 0x00, 0xb5, 0xff, 0x43, 0x00, 0x38, 0x00, 0xc5, 0xff, 0xf8, 0xff, 
-0xf3, 0xff, 0xc7, 0xff, 0x32, 0x00, 0x1d, 0x00, 0xbf, 0xff, 0x2c, 0x00, 0x3c, 0x00, 0xc7, 0xff, 
-0x0d, 0x00, 0x83, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x9a, 0x00, 0x75, 0x00, 0xb2, 0xff, 0x39, 0xff, 
-0xbb, 0xff, 0xda, 0xff, 0x87, 0xff, 0x1c, 0x00, 0x76, 0x00, 0xd6, 0xff, 0xfb, 0xff, 0x60, 0x00, 
-0x5b, 0xff, 0x2f, 0xff, 0x18, 0x00, 0x69, 0xff, 0x78, 0xff, 0x65, 0x00, 0xb0, 0xff, 0x96, 0xff, 
-0x1f, 0x00, 0x9c, 0xff, 0xb9, 0xff, 0x8b, 0x00, 0x1c, 0x00, 0xb7, 0xff, 0x8c, 0x00, 0xe5, 0xff, 
-0xbb, 0xff, 0xf7, 0x00, 0x8a, 0xff, 0x6f, 0xff, 0x85, 0x02, 0x6c, 0x02, 0x33, 0x00, 0xcd, 0x00, 
-0xb2, 0x00, 0x42, 0xfe, 0xca, 0xfe, 0xb7, 0x00, 0xac, 0xff, 0x27, 0xff, 0xdf, 0xff, 0x2c, 0x00, 
-0x7a, 0xff, 0x0a, 0xff, 0x39, 0x00, 0x9a, 0x00, 0x91, 0xff, 0x99, 0x00, 0x76, 0x03, 0x8d, 0x02, 
-0x91, 0x00, 0x7d, 0x00, 0xfb, 0xfe, 0x67, 0xfc, 0x6f, 0xfd, 0x6c, 0xff, 0xc4, 0xfd, 0x44, 0xfe, 
-0xe0, 0xff, 0x65, 0xfe, 0xca, 0xfe, 0x33, 0xff, 0x60, 0x00, 0x31, 0x01, 0xef, 0x00, 0x99, 0x00, 
-0xf7, 0xff, 0x8c, 0x00, 0xe3, 0xff, 0xa1, 0x00, 0xd7, 0x00, 0xb5, 0xff, 0x88, 0xff, 0xa5, 0x00, 
-0x75, 0xff, 0xe1, 0xff, 0x4e, 0x01, 0xdb, 0x00, 0xd8, 0xff, 0xf8, 0xfe, 0x4a, 0xff, 0x16, 0xfe, 
-0x2d, 0xfe, 0xf5, 0xfe, 0xd7, 0xfe, 0xdc, 0xfe, 0x94, 0xfe, 0xaa, 0xff, 0x8a, 0xff, 0xe6, 0xfe, 
-0xb3, 0x00, 0xc8, 0x00, 0x05, 0x01, 0x11, 0x00, 0xea, 0x00, 0x86, 0x00, 0x4f, 0x00, 0xcb, 0xff, 
-0x76, 0xff, 0x02, 0x00, 0xcb, 0xfe, 0xf9, 0xfe, 0x29, 0xff, 0x64, 0x00, 0x21, 0xfe, 0xcb, 0xff, 
-0x7d, 0x00, 0xa0, 0xff, 0xc9, 0xff, 0xa1, 0x00, 0x0c, 0x01, 0xc4, 0xff, 0x2c, 0x01, 0x98, 0x00, 
-0x71, 0x00, 0x52, 0x00, 0x1c, 0x00, 0xae, 0x00, 0x7c, 0x00, 0x2b, 0x01, 0x93, 0x00, 0x33, 0x01, 
-0xdb, 0x00, 0xa1, 0x00, 0xdb, 0x00, 0xa5, 0xff, 0xc8, 0x00, 0x2a, 0xff, 0x55, 0x00, 0xd5, 0xff, 
-0x80, 0x00, 0x0b, 0x00, 0x63, 0x00, 0xea, 0x00, 0xe6, 0xfe, 0x7c, 0x00, 0x44, 0x00, 0xfe, 0xff, 
-0xe4, 0xfe, 0xff, 0x00, 0xd0, 0xff, 0x9c, 0xff, 0xfb, 0xff, 0xea, 0xff, 0xd6, 0x00, 0x83, 0x00, 
-0x57, 0x01, 0x67, 0x00, 0xc1, 0x00, 0xc1, 0x00, 0xaa, 0xff, 0x79, 0x00, 0xc8, 0xff, 0x1f, 0x00, 
-0x37, 0x00, 0xf9, 0xff, 0x75, 0x00, 0x4c, 0xff, 0x95, 0x00, 0xb9, 0xff, 0xa3, 0xff, 0x05, 0x00, 
-0x46, 0x00, 0x31, 0xff, 0xe0, 0xfe, 0x1e, 0xff, 0x45, 0xff, 0xea, 0xfe, 0xa8, 0x00, 0xbe, 0x00, 
-0x87, 0xfe, 0x13, 0x02, 0xb2, 0xff, 0x2d, 0xff, 0xf3, 0xff, 0x36, 0x00, 0xad, 0x00, 0x7b, 0xfe, 
-0x57, 0x00, 0xf8, 0xff, 0xae, 0xff, 0x96, 0x00, 0x75, 0xff, 0x31, 0x01, 0xdf, 0x00, 0x40, 0xff, 
-0x99, 0x00, 0xb5, 0x01, 0xd0, 0xff, 0xc2, 0xff, 0xf1, 0x00, 0x5e, 0x00, 0x3d, 0x00, 0xc0, 0xff, 
-0xb0, 0x01, 0xfb, 0xff, 0x39, 0xff, 0x37, 0x01, 0x2e, 0x00, 0x87, 0xff, 0x3e, 0xff, 0x24, 0x01, 
-0xc1, 0x00, 0x4b, 0xfe, 0xb9, 0x00, 0xcd, 0xff, 0x4d, 0xfe, 0x5d, 0xff, 0x72, 0xff, 0xa9, 0x00, 
-0x19, 0xfe, 0x48, 0xff, 0x6a, 0x00, 0x3d, 0xff, 0x1a, 0x01, 0x70, 0xfe, 0x9e, 0x00, 0xa0, 0x00, 
-0x81, 0xfe, 0xa8, 0x01, 0xe8, 0xfe, 0xe9, 0x00, 0x73, 0xff, 0xb4, 0xfe, 0xd4, 0x02, 0xb7, 0xfd, 
-0x6d, 0xff, 0x26, 0x01, 0xbc, 0xff, 0x68, 0x00, 0xee, 0xff, 0x56, 0x02, 0x72, 0xff, 0xd3, 0xff, 
-0x2e, 0x03, 0x15, 0xff, 0x44, 0xff, 0xe2, 0x01, 0x3e, 0x00, 0x0a, 0x00, 0x3e, 0x01, 0xa2, 0x00, 
-0x4d, 0xff, 0xb7, 0x00, 0xbb, 0xff, 0xc0, 0xfd, 0x86, 0xff, 0x49, 0x00, 0x1e, 0x00, 0xc1, 0xfe, 
-0xe3, 0xfe, 0x96, 0xff, 0x0e, 0x00, 0x83, 0xfe, 0xc7, 0xff, 0x21, 0x00, 0xbd, 0xff, 0xa1, 0xff, 
-0x6f, 0xff, 0x1f, 0x02, 0x36, 0xfe, 0x88, 0x00, 0x38, 0x01, 0xec, 0xfe, 0xb3, 0x00, 0x2a, 0xfe, 
-0x88, 0xff, 0x51, 0x00, 0x21, 0xff, 0x33, 0x01, 0xb9, 0xfe, 0xd6, 0xff, 0x1b, 0x01, 0xf9, 0xfe, 
-0x82, 0x01, 0xcf, 0xfe, 0x9a, 0x00, 0xb7, 0x00, 0xdd, 0xff, 0xc0, 0x01, 0x14, 0xff, 0xeb, 0x01, 
-0x9e, 0xfe, 0x15, 0x00, 0x0b, 0x03, 0x87, 0xfe, 0x33, 0x00, 0x24, 0x00, 0xb6, 0x00, 0x11, 0xfe, 
-0x57, 0xff, 0x90, 0x02, 0x5a, 0xfc, 0x37, 0x01, 0xa3, 0x03, 0xb2, 0xfc, 0x68, 0x00, 0x16, 0x01, 
-0x92, 0xff, 0x76, 0xff, 0x2a, 0x00, 0xbb, 0x00, 0x78, 0xfc, 0xdc, 0x00, 0x52, 0xff, 0x88, 0xfc, 
-0xfc, 0x01, 0xb0, 0xff, 0x13, 0xfd, 0xae, 0x00, 0xad, 0x01, 0x26, 0xff, 0x82, 0x00, 0x98, 0x02, 
-0x86, 0x00, 0x06, 0x00, 0x89, 0x02, 0x87, 0xff, 0x8b, 0xfe, 0x9d, 0x00, 0x4b, 0xff, 0x04, 0xfe, 
-0x28, 0x00, 0xa2, 0x01, 0x5f, 0xff, 0x74, 0x00, 0xb4, 0x01, 0x20, 0xff, 0xed, 0xff, 0xbd, 0x02, 
-0x34, 0xff, 0x2b, 0x00, 0x74, 0x00, 0xfa, 0xfd, 0x27, 0xff, 0x1b, 0xfe, 0xd5, 0x00, 0x64, 0xfe, 
-0x1a, 0xff, 0xe2, 0x01, 0x26, 0xfe, 0xe2, 0xff, 0x3a, 0x00, 0x58, 0x00, 0x67, 0x01, 0x9b, 0xfe, 
-0x9b, 0xff, 0x8a, 0x00, 0x14, 0xfe, 0xfd, 0x00, 0xd1, 0xff, 0x85, 0xfe, 0xfb, 0xfe, 0x5e, 0xff, 
-0xd1, 0x01, 0xb1, 0xff, 0x37, 0xff, 0xa5, 0x00, 0xc9, 0x00, 0x99, 0x00, 0xf3, 0xff, 0xaf, 0x00, 
-0xa2, 0x02, 0xa0, 0xff, 0xb9, 0x00, 0x3e, 0x01, 0x38, 0xfd, 0xdd, 0xfe, 0x53, 0x00, 0xc7, 0xff, 
-0x59, 0xff, 0x17, 0x03, 0x4d, 0x02, 0x9b, 0xfd, 0x8c, 0x01, 0x86, 0x03, 0x90, 0xff, 0x51, 0xff, 
-0xe6, 0x00, 0x0f, 0x00, 0xa9, 0xfe, 0xbc, 0xfd, 0xbb, 0xff, 0x00, 0xfe, 0x06, 0xfe, 0x87, 0xff, 
-0x5e, 0xfe, 0xba, 0x01, 0x7d, 0xff, 0xc0, 0x01, 0xc6, 0x00, 0x1a, 0xfd, 0xa3, 0x01, 0x72, 0xff, 
-0x18, 0xfe, 0x3d, 0xff, 0x0b, 0xff, 0x12, 0x00, 0x27, 0x00, 0x14, 0x00, 0xed, 0x00, 0xdc, 0xff, 
-0x13, 0x00, 0x02, 0x01, 0x4a, 0x01, 0xe2, 0x00, 0x93, 0x00, 0x81, 0x01, 0xb4, 0xfe, 0x94, 0xff, 
-0x6f, 0xff, 0x0b, 0x00, 0x1e, 0x01, 0x75, 0xfe, 0x5e, 0x02, 0x1d, 0x02, 0x9f, 0x00, 0xe6, 0x00, 
-0x4e, 0xff, 0xa3, 0x00, 0x01, 0xff, 0x79, 0xfd, 0x25, 0xfe, 0x38, 0xfc, 0xf1, 0xfd, 0x17, 0x01, 
-0xa5, 0xff, 0xad, 0x01, 0xe9, 0x03, 0xac, 0xff, 0xcd, 0xfe, 0x68, 0x00, 0xea, 0xfe, 0x2a, 0xff, 
-0xfe, 0xfe, 0x1c, 0xff, 0xc4, 0x00, 0x5b, 0xfd, 0xf3, 0x00, 0x80, 0x01, 0xcb, 0xff, 0x74, 0x02, 
-0xa9, 0xfd, 0xb9, 0x01, 0x7d, 0xff, 0x14, 0xff, 0x37, 0x01, 0x24, 0xfe, 0xfb, 0x01, 0x2b, 0x00, 
-0x7d, 0x00, 0xb2, 0x01, 0xe7, 0xfe, 0xa2, 0x00, 0x2f, 0xff, 0xc5, 0xfc, 0x7b, 0xff, 0xb3, 0xfe, 
-0x91, 0xff, 0xca, 0xff, 0x63, 0x01, 0xcd, 0x03, 0xef, 0xff, 0x3c, 0x01, 0x27, 0x01, 0x95, 0xff, 
-0x7d, 0xfd, 0xa6, 0xfe, 0xe1, 0x02, 0x22, 0xfc, 0x0b, 0x01, 0xac, 0x02, 0xb2, 0xff, 0xdd, 0xff, 
-0x6a, 0x00, 0xf0, 0x01, 0x5b, 0xfd, 0x29, 0x00, 0x65, 0xfe, 0x36, 0xfe, 0x9e, 0xff, 0xbb, 0xff, 
-0x91, 0x00, 0xa7, 0xfd, 0xbb, 0x02, 0x81, 0x02, 0x6e, 0xff, 0x59, 0x01, 0x05, 0xff, 0x77, 0x00, 
-0xe9, 0xfc, 0x46, 0xfd, 0x05, 0x02, 0x8b, 0xff, 0x9e, 0xff, 0x03, 0x03, 0x1a, 0x02, 0x5f, 0x02, 
-0x47, 0x02, 0x4c, 0xfe, 0x91, 0x01, 0x5a, 0xfc, 0x19, 0xfc, 0xb1, 0x02, 0x11, 0xfd, 0x6a, 0x00, 
-0x41, 0x01, 0xa5, 0xff, 0xb4, 0x01, 0xf9, 0xfd, 0x2d, 0x03, 0xce, 0x00, 0xc1, 0xfe, 0xdd, 0xfe, 
-0x21, 0xfe, 0xf9, 0xff, 0xa7, 0xfd, 0x46, 0x02, 0x1f, 0x01, 0x68, 0x00, 0x89, 0xff, 0x12, 0xff, 
-0x22, 0x01, 0x15, 0x00, 0x17, 0x01, 0x27, 0x00, 0xd2, 0xfe, 0x90, 0xff, 0x19, 0xfe, 0x4e, 0xfe, 
-0x29, 0x02, 0xa0, 0xff, 0x45, 0xfe, 0xe6, 0x01, 0x69, 0x02, 0xab, 0x00, 0x2a, 0xfe, 0xaf, 0x00, 
-0xe4, 0xfe, 0x96, 0xfc, 0xdf, 0x00, 0x59, 0x03, 0xab, 0x01, 0x69, 0xfe, 0xa3, 0x01, 0x8b, 0x00, 
-0x63, 0xfd, 0x0f, 0xff, 0xd5, 0x00, 0xf6, 0x01, 0xf1, 0x00, 0xf0, 0x00, 0x1e, 0x04, 0x14, 0xfe, 
-0x94, 0xfb, 0xc2, 0x00, 0x95, 0x00, 0x0a, 0x02, 0xc4, 0xff, 0xe2, 0x01, 0x8d, 0x02, 0x11, 0xfe, 
-0x74, 0xff, 0x13, 0xfd, 0xeb, 0xfc, 0x04, 0xfd, 0x36, 0xfb, 0x80, 0x01, 0xcc, 0x03, 0xc3, 0xff, 
-0xbd, 0x00, 0xfa, 0xfe, 0xeb, 0xfc, 0xa8, 0xfa, 0x96, 0xfd, 0x7f, 0x04, 0x8b, 0xfd, 0xdf, 0xfc, 
-0xff, 0x01, 0x09, 0x05, 0x4e, 0x01, 0x87, 0xfe, 0xb8, 0x05, 0xc3, 0xfb, 0x38, 0xfc, 0xcf, 0x02, 
-0x66, 0x04, 0x28, 0x04, 0xdc, 0xfb, 0x03, 0x05, 0xe4, 0x06, 0xce, 0x00, 0x1e, 0x01, 0xf8, 0x03, 
-0x5e, 0x04, 0xf5, 0xfd, 0xf5, 0xff, 0xca, 0x07, 0x4a, 0x05, 0xd9, 0xfd, 0x5f, 0xfc, 0x12, 0x00, 
-0xfe, 0x00, 0xf0, 0xfb, 0x46, 0xfe, 0x2d, 0x02, 0xf2, 0xfe, 0xc6, 0xfd, 0xd2, 0xfe, 0xb1, 0xfb, 
-0xf5, 0xf6, 0x1b, 0xf7, 0xad, 0xfb, 0xef, 0xfb, 0x30, 0xf9, 0x17, 0xfe, 0xe0, 0xfd, 0xed, 0xfd, 
-0x90, 0xfc, 0x58, 0xfa, 0x54, 0x01, 0xec, 0xff, 0x14, 0xfb, 0x5d, 0x01, 0x93, 0x04, 0x6d, 0x01, 
-0xa3, 0x01, 0x24, 0x03, 0x61, 0x03, 0x39, 0x04, 0xdb, 0x06, 0xf0, 0x07, 0x74, 0x05, 0x91, 0x05, 
-0xdd, 0x08, 0x25, 0x06, 0xd3, 0x03, 0x76, 0x04, 0x12, 0x05, 0x62, 0x04, 0x71, 0x03, 0x06, 0x02, 
-0xc7, 0xff, 0x82, 0x01, 0xae, 0xff, 0x37, 0xff, 0x67, 0xff, 0xf6, 0xfe, 0x65, 0xfe, 0x8f, 0xf8, 
-0xa2, 0xf8, 0xc3, 0xfa, 0x38, 0xf7, 0x1d, 0xf6, 0xf2, 0xfa, 0x21, 0xfd, 0xea, 0xfd, 0x48, 0xf9, 
-0xb7, 0xf9, 0x1c, 0xf8, 0x87, 0xf7, 0x69, 0xfa, 0x26, 0xf5, 0x86, 0xfa, 0x65, 0x00, 0x11, 0x07, 
-0x69, 0x02, 0x02, 0x00, 0x54, 0x0a, 0x99, 0x02, 0x32, 0x01, 0xb5, 0x05, 0x06, 0x07, 0x71, 0x08, 
-0x2c, 0x08, 0x0e, 0x07, 0xaf, 0x08, 0x8c, 0x0b, 0xdc, 0x03, 0x1c, 0x02, 0x69, 0x06, 0x23, 0x09, 
-0x64, 0x07, 0x46, 0x03, 0x32, 0x04, 0x21, 0x00, 0x50, 0xfd, 0xf4, 0xfd, 0x1f, 0xfd, 0xb8, 0xfb, 
-0x6d, 0xfb, 0x23, 0xfb, 0xef, 0xfc, 0x2d, 0xfc, 0xa7, 0xf6, 0xa5, 0xf9, 0x65, 0xfc, 0x01, 0xf8, 
-0x65, 0xf5, 0x5d, 0xf6, 0x46, 0xf3, 0xe8, 0xf5, 0xed, 0xf2, 0xd6, 0xf3, 0x1c, 0xfa, 0x61, 0x03, 
-0xa7, 0x08, 0x54, 0xff, 0xa8, 0xfe, 0xb8, 0xff, 0xf0, 0x02, 0x8a, 0xfe, 0xbf, 0x06, 0xdf, 0x0f, 
-0x4c, 0x10, 0xc7, 0x10, 0x61, 0x09, 0x8c, 0x06, 0x96, 0x02, 0xdc, 0x04, 0x2b, 0x01, 0xbd, 0x06, 
-0xad, 0x0d, 0x72, 0x0a, 0x05, 0x09, 0x3b, 0x04, 0x3f, 0x03, 0x74, 0xfe, 0xee, 0xfb, 0xa2, 0xf9, 
-0x56, 0xfb, 0xbe, 0xfc, 0x60, 0xfe, 0x52, 0xfa, 0x73, 0xf8, 0x72, 0xff, 0x20, 0x00, 0x22, 0xff, 
-0x0d, 0xf7, 0x94, 0xf2, 0xc9, 0xf2, 0x76, 0xf2, 0xdc, 0xed, 0xb1, 0xec, 0x0d, 0xef, 0x2d, 0xfa, 
-0xee, 0x05, 0x6a, 0x04, 0xfe, 0x04, 0x9a, 0xfd, 0xf2, 0xff, 0x16, 0x05, 0x13, 0x04, 0xd9, 0x06, 
-0xd9, 0x08, 0xd1, 0x0c, 0x5e, 0x0e, 0xc0, 0x0b, 0xdd, 0x07, 0xe5, 0x02, 0xba, 0x01, 0x1c, 0x06, 
-0xe9, 0x06, 0x7f, 0x0b, 0x5c, 0x0a, 0xd0, 0x05, 0xe4, 0x03, 0x93, 0xff, 0x40, 0x01, 0x4d, 0x00, 
-0x38, 0x01, 0xd5, 0x00, 0x30, 0xfe, 0xde, 0xfd, 0x15, 0xf9, 0xea, 0xf7, 0xcc, 0xf9, 0x0c, 0xfc, 
-0x3c, 0xfd, 0x8c, 0xfa, 0xf1, 0xf5, 0x5b, 0xf2, 0x51, 0xee, 0x4f, 0xf2, 0x88, 0xef, 0x3b, 0xf3, 
-0x80, 0xf8, 0xd2, 0xf5, 0xf2, 0xfd, 0x45, 0xff, 0x8a, 0x04, 0xf1, 0x0c, 0x30, 0x0d, 0xb6, 0x08, 
-0xe4, 0x02, 0x7d, 0x02, 0x41, 0x07, 0x43, 0x0b, 0x88, 0x08, 0x0d, 0x07, 0xbf, 0x0b, 0xb5, 0x0b, 
-0xb6, 0x08, 0x3a, 0x03, 0x9f, 0x04, 0x0f, 0x0b, 0xb1, 0x09, 0x49, 0x06, 0x15, 0x01, 0xa9, 0xff, 
-0xcf, 0x03, 0x9c, 0xfe, 0x67, 0xfa, 0xdb, 0xfa, 0x99, 0xfd, 0x69, 0x00, 0x80, 0xfb, 0xd0, 0xfa, 
-0x01, 0xf8, 0x47, 0xf6, 0x0b, 0xf4, 0xda, 0xee, 0x5b, 0xee, 0x09, 0xf1, 0x54, 0xf4, 0x9f, 0xf3, 
-0xce, 0xf9, 0x26, 0xfc, 0x80, 0xfa, 0xc6, 0xfd, 0x60, 0xff, 0xfb, 0x07, 0x85, 0x0c, 0x13, 0x0a, 
-0x28, 0x05, 0x5f, 0xfd, 0x53, 0x02, 0xca, 0x06, 0xa8, 0x08, 0x21, 0x0b, 0xf3, 0x06, 0x79, 0x09, 
-0xde, 0x0a, 0x3b, 0x08, 0x8b, 0x08, 0xde, 0x08, 0x16, 0x09, 0xb5, 0x08, 0xbe, 0x06, 0x21, 0x06, 
-0x18, 0x04, 0x73, 0x01, 0x98, 0xfe, 0x7e, 0xf7, 0x3b, 0xf8, 0x94, 0xfb, 0xfb, 0xfd, 0x41, 0xfd, 
-0xac, 0xf9, 0x66, 0xf6, 0x2c, 0xf2, 0xed, 0xee, 0x24, 0xed, 0xaf, 0xee, 0xa0, 0xef, 0xae, 0xf4, 
-0xe1, 0xef, 0x0a, 0xf5, 0x91, 0xfd, 0x32, 0x04, 0xdf, 0x0d, 0x61, 0x0b, 0xd2, 0x0a, 0x0d, 0x07, 
-0x5b, 0x04, 0x51, 0x05, 0x34, 0x03, 0x2c, 0x03, 0xf4, 0x05, 0x2c, 0x04, 0x66, 0x05, 0x09, 0x06, 
-0x66, 0x06, 0x90, 0x09, 0x3e, 0x09, 0x64, 0x0b, 0x26, 0x0c, 0xa1, 0x0a, 0x1a, 0x0a, 0xbd, 0x06, 
-0xda, 0x04, 0xf5, 0x02, 0x89, 0xff, 0xab, 0xff, 0x0e, 0x00, 0x60, 0xff, 0x7c, 0xfb, 0x33, 0xf6, 
-0x68, 0xf6, 0xa6, 0xf8, 0x3c, 0xf8, 0x23, 0xf5, 0xa6, 0xef, 0x02, 0xec, 0x94, 0xea, 0xf8, 0xe5, 
-0xaa, 0xe7, 0x43, 0xec, 0x8c, 0xfc, 0xe4, 0x0d, 0x72, 0x10, 0xa5, 0x0d, 0xce, 0x06, 0xc5, 0x02, 
-0x8a, 0x03, 0x62, 0x04, 0xb6, 0x01, 0x0c, 0x04, 0xda, 0x05, 0xf5, 0x0a, 0x4e, 0x0a, 0x4d, 0x05, 
-0x3a, 0x04, 0x34, 0x02, 0x4b, 0x07, 0xf8, 0x08, 0x4a, 0x0c, 0x04, 0x0c, 0x56, 0x0a, 0x8d, 0x08, 
-0xba, 0x01, 0x12, 0x01, 0x8d, 0x01, 0x4e, 0x03, 0xd3, 0x04, 0x5f, 0x02, 0x54, 0xfe, 0xc3, 0xf9, 
-0x81, 0xf6, 0xca, 0xf7, 0x95, 0xf7, 0x6a, 0xf7, 0xdb, 0xf3, 0xba, 0xed, 0x31, 0xe9, 0x6a, 0xe5, 
-0x02, 0xe9, 0x8c, 0xea, 0xee, 0xf0, 0xf8, 0x01, 0x93, 0x10, 0xc8, 0x18, 0x1c, 0x13, 0x28, 0x04, 
-0x47, 0xfd, 0xd9, 0xfc, 0xd0, 0x03, 0xe9, 0x06, 0x7d, 0x06, 0x3c, 0x08, 0x55, 0x0a, 0x45, 0x0c, 
-0x18, 0x08, 0x43, 0x03, 0x88, 0x00, 0xdb, 0x01, 0x7d, 0x07, 0x2a, 0x0b, 0x2a, 0x0c, 0xa2, 0x0a, 
-0x91, 0x05, 0x33, 0x02, 0xa0, 0xff, 0xfa, 0xff, 0xc5, 0x01, 0x59, 0x03, 0xc7, 0x02, 0x94, 0xff, 
-0x09, 0xfb, 0x0f, 0xf6, 0xb6, 0xf4, 0x18, 0xf4, 0x65, 0xf3, 0x7e, 0xf1, 0x1d, 0xea, 0xc1, 0xe3, 
-0x9f, 0xe2, 0xcf, 0xe9, 0xa0, 0xf4, 0x85, 0x03, 0xfa, 0x0d, 0xf9, 0x11, 0x8c, 0x0c, 0xdf, 0x03, 
-0x9f, 0xff, 0xb1, 0x00, 0xb4, 0x07, 0xc8, 0x0b, 0x99, 0x0b, 0xd0, 0x07, 0x8b, 0x05, 0x99, 0x04, 
-0xb7, 0x06, 0x00, 0x07, 0xf1, 0x07, 0x13, 0x08, 0x37, 0x07, 0xd1, 0x04, 0xcf, 0x01, 0x1c, 0x01, 
-0xd8, 0x00, 0x4f, 0x03, 0xaf, 0x05, 0xb0, 0x09, 0xf5, 0x09, 0xfd, 0x05, 0x35, 0x01, 0x5c, 0xfc, 
-0xb5, 0xfc, 0x88, 0xfe, 0x0c, 0xfd, 0x34, 0xf9, 0x12, 0xf3, 0x9c, 0xec, 0xb5, 0xe6, 0x08, 0xe2, 
-0xb9, 0xe0, 0xca, 0xe4, 0xcf, 0xef, 0xf4, 0xfd, 0x0e, 0x0a, 0x5f, 0x0c, 0x9a, 0x08, 0x8f, 0x02, 
-0x69, 0x02, 0x86, 0x08, 0xfe, 0x0e, 0x20, 0x11, 0x91, 0x0e, 0x33, 0x0b, 0x46, 0x07, 0x39, 0x08, 
-0xb1, 0x09, 0x39, 0x09, 0xf5, 0x07, 0x96, 0x04, 0x17, 0x01, 0x6a, 0xfe, 0x48, 0xfb, 0xbe, 0xfa, 
-0xb1, 0xfd, 0x73, 0x02, 0x18, 0x08, 0xf1, 0x09, 0xaa, 0x07, 0xaa, 0x02, 0xbb, 0xff, 0xa6, 0xff, 
-0x31, 0x02, 0xdf, 0x02, 0x55, 0xff, 0xe1, 0xf9, 0x38, 0xf1, 0x7c, 0xeb, 0x48, 0xe7, 0x07, 0xe1, 
-0x8f, 0xe1, 0x32, 0xe7, 0xef, 0xf2, 0x98, 0x01, 0x94, 0x08, 0x71, 0x08, 0xa5, 0x02, 0xec, 0x00, 
-0x1b, 0x05, 0x74, 0x0d, 0xc2, 0x13, 0xd9, 0x12, 0x46, 0x0c, 0xd1, 0x07, 0xb2, 0x07, 0x1e, 0x0a, 
-0x0a, 0x0c, 0xd7, 0x09, 0xd3, 0x05, 0xa6, 0x01, 0xf9, 0xfd, 0x46, 0xfb, 0x8d, 0xfa, 0x3d, 0xfc, 
-0x0f, 0x00, 0x74, 0x04, 0xad, 0x08, 0x46, 0x09, 0x4d, 0x06, 0x2c, 0x02, 0x54, 0x00, 0x7e, 0x00, 
-0x17, 0x03, 0x7f, 0x03, 0x0a, 0x00, 0x07, 0xf9, 0x09, 0xef, 0x01, 0xe6, 0x67, 0xdf, 0x5d, 0xde, 
-0x19, 0xe3, 0x1e, 0xef, 0xbd, 0xfd, 0xcb, 0x06, 0x59, 0x07, 0xdf, 0x01, 0xb9, 0xfd, 0x3f, 0x01, 
-0x8d, 0x0a, 0xfb, 0x12, 0xeb, 0x15, 0x17, 0x11, 0x21, 0x0a, 0xe8, 0x07, 0xf1, 0x07, 0x7f, 0x0b, 
-0xa4, 0x0c, 0x7c, 0x08, 0x40, 0x03, 0xd3, 0xfc, 0x7e, 0xfa, 0x51, 0xf9, 0x39, 0xfb, 0xf0, 0xfd, 
-0x1f, 0x02, 0x66, 0x06, 0x0d, 0x08, 0x98, 0x07, 0x66, 0x03, 0xd3, 0x00, 0xa3, 0x00, 0x10, 0x03, 
-0x46, 0x05, 0x9a, 0x03, 0x0a, 0xfc, 0x90, 0xf0, 0x92, 0xe5, 0xb5, 0xe0, 0x39, 0xe1, 0x20, 0xe6, 
-0xa4, 0xed, 0x9b, 0xf8, 0x19, 0x01, 0xa5, 0x04, 0xff, 0x02, 0xd1, 0x00, 0xfb, 0x02, 0x79, 0x09, 
-0xc4, 0x11, 0x12, 0x15, 0xc1, 0x12, 0xec, 0x0b, 0x6e, 0x07, 0xfb, 0x07, 0x23, 0x0a, 0x92, 0x0b, 
-0xb2, 0x08, 0xbe, 0x02, 0x29, 0xfd, 0xeb, 0xf8, 0xd4, 0xf8, 0x14, 0xf9, 0x72, 0xfc, 0xc8, 0x00, 
-0x53, 0x05, 0x52, 0x09, 0x25, 0x09, 0x1d, 0x07, 0xb0, 0x03, 0xe3, 0x01, 0x2e, 0x02, 0x35, 0x04, 
-0x89, 0x04, 0xcc, 0xff, 0x2b, 0xf6, 0xbe, 0xea, 0xae, 0xe2, 0x30, 0xdf, 0x2b, 0xe1, 0x65, 0xe7, 
-0xfd, 0xf1, 0xb1, 0xfc, 0xc3, 0x03, 0x33, 0x05, 0xc4, 0x02, 0xe5, 0x02, 0xa5, 0x06, 0xec, 0x0d, 
-0x78, 0x13, 0xc8, 0x14, 0x81, 0x10, 0xf1, 0x0a, 0xd1, 0x07, 0x3c, 0x08, 0x6c, 0x0a, 0x5b, 0x0a, 
-0xda, 0x06, 0x6c, 0x01, 0x65, 0xfb, 0x85, 0xf7, 0x0f, 0xf7, 0x17, 0xfa, 0x1b, 0x00, 0x1f, 0x05, 
-0x6b, 0x08, 0x10, 0x08, 0xc7, 0x05, 0x40, 0x03, 0x0b, 0x03, 0xc9, 0x03, 0xca, 0x04, 0xd6, 0x04, 
-0x7d, 0x01, 0xe5, 0xf9, 0xa3, 0xee, 0xf0, 0xe3, 0xbc, 0xde, 0x67, 0xde, 0x9c, 0xe5, 0x4d, 0xf0, 
-0x3c, 0xfc, 0x9a, 0x02, 0x81, 0x02, 0x75, 0x00, 0xd8, 0xff, 0x73, 0x05, 0xa0, 0x0b, 0xfd, 0x11, 
-0x21, 0x13, 0x86, 0x10, 0x9c, 0x0b, 0x4b, 0x08, 0x02, 0x08, 0xd3, 0x08, 0x39, 0x09, 0x66, 0x07, 
-0x9f, 0x03, 0x40, 0x00, 0x10, 0xfd, 0x95, 0xfb, 0xb8, 0xfb, 0x5f, 0xfd, 0x3b, 0x00, 0x78, 0x02, 
-0x71, 0x04, 0x5d, 0x04, 0xbd, 0x04, 0x8a, 0x05, 0x55, 0x06, 0x78, 0x06, 0x6c, 0x03, 0x15, 0xff, 
-0x97, 0xf8, 0x7c, 0xf1, 0x66, 0xeb, 0x32, 0xe6, 0x20, 0xe3, 0x4f, 0xe2, 0x55, 0xe8, 0x52, 0xf2, 
-0x81, 0xfe, 0x0e, 0x08, 0x2d, 0x0c, 0x79, 0x0b, 0x5e, 0x08, 0xf8, 0x06, 0x7f, 0x07, 0x5a, 0x0a, 
-0xea, 0x0c, 0x08, 0x0d, 0x62, 0x0b, 0x0b, 0x08, 0x57, 0x05, 0xb2, 0x04, 0xca, 0x05, 0x30, 0x07, 
-0x96, 0x06, 0x74, 0x04, 0xd5, 0xff, 0xcb, 0xfc, 0x37, 0xfc, 0xe0, 0xfd, 0xbe, 0x00, 0x76, 0x02, 
-0x1a, 0x03, 0x37, 0x03, 0x3d, 0x04, 0xdb, 0x05, 0x9a, 0x06, 0xdf, 0x04, 0x56, 0x00, 0x24, 0xfa, 
-0x7d, 0xf2, 0xac, 0xeb, 0xab, 0xe6, 0x32, 0xe3, 0xa0, 0xe2, 0x4f, 0xe7, 0xe5, 0xf0, 0x17, 0xfc, 
-0x53, 0x05, 0x1f, 0x0a, 0xb1, 0x0a, 0x48, 0x09, 0xaa, 0x08, 0x31, 0x09, 0x00, 0x0b, 0x75, 0x0c, 
-0x12, 0x0c, 0x7b, 0x0a, 0x8d, 0x08, 0x79, 0x06, 0x9f, 0x05, 0xd4, 0x05, 0x75, 0x06, 0xe3, 0x05, 
-0xbd, 0x03, 0xff, 0xff, 0xd4, 0xfc, 0x6b, 0xfc, 0x2f, 0xfe, 0x2e, 0x01, 0x51, 0x03, 0xbc, 0x03, 
-0x9b, 0x03, 0x2a, 0x04, 0x85, 0x05, 0x2b, 0x06, 0x2f, 0x05, 0x53, 0x01, 0xf4, 0xfb, 0x30, 0xf5, 
-0x1b, 0xee, 0xbe, 0xe8, 0x40, 0xe4, 0xa3, 0xe2, 0x05, 0xe5, 0x3a, 0xed, 0x0a, 0xf8, 0x8b, 0x02, 
-0x41, 0x09, 0x1e, 0x0b, 0x5c, 0x0a, 0x8e, 0x09, 0xdf, 0x09, 0x9c, 0x0b, 0xb5, 0x0d, 0x1c, 0x0e, 
-0x7e, 0x0c, 0x87, 0x09, 0x7b, 0x06, 0x98, 0x04, 0x85, 0x04, 0xcb, 0x04, 0x9a, 0x04, 0xd3, 0x02, 
-0xd0, 0xff, 0x06, 0xfd, 0x47, 0xfc, 0x82, 0xfd, 0xf1, 0xff, 0x9f, 0x02, 0x16, 0x04, 0x24, 0x04, 
-0xa8, 0x04, 0x08, 0x06, 0x38, 0x07, 0xa6, 0x06, 0x61, 0x03, 0x10, 0xfe, 0x9e, 0xf7, 0xba, 0xf0, 
-0x86, 0xea, 0x8d, 0xe5, 0xf7, 0xe1, 0xe0, 0xe1, 0x9f, 0xe7, 0xa2, 0xf1, 0xc9, 0xfc, 0x40, 0x05, 
-0x62, 0x09, 0x10, 0x0a, 0x49, 0x0a, 0x5d, 0x0b, 0x1d, 0x0d, 0x13, 0x0f, 0x7f, 0x0f, 0x30, 0x0e, 
-0xc8, 0x0b, 0xa5, 0x08, 0x6f, 0x06, 0xda, 0x05, 0xbd, 0x05, 0x36, 0x05, 0x6f, 0x03, 0x86, 0x00, 
-0x8c, 0xfd, 0x20, 0xfc, 0xd7, 0xfc, 0x64, 0xff, 0xde, 0x01, 0xc7, 0x02, 0x4d, 0x02, 0xb3, 0x02, 
-0xaa, 0x04, 0xf6, 0x06, 0xac, 0x07, 0x53, 0x05, 0x10, 0x00, 0x22, 0xf9, 0x98, 0xf1, 0xa5, 0xeb, 
-0xad, 0xe6, 0x59, 0xe3, 0xcd, 0xe2, 0x65, 0xe7, 0xe5, 0xef, 0x5f, 0xf9, 0x81, 0x01, 0x2a, 0x06, 
-0xd5, 0x08, 0x63, 0x0a, 0x9d, 0x0c, 0x86, 0x0e, 0xb4, 0x0f, 0xc8, 0x0f, 0xea, 0x0d, 0x1f, 0x0b, 
-0x5e, 0x08, 0x4c, 0x06, 0xdd, 0x05, 0xed, 0x05, 0xc4, 0x05, 0x0f, 0x04, 0x43, 0x01, 0x70, 0xfe, 
-0x28, 0xfd, 0xde, 0xfd, 0xbc, 0xff, 0x87, 0x01, 0x63, 0x02, 0x9c, 0x02, 0x21, 0x03, 0xde, 0x04, 
-0x8f, 0x06, 0xc8, 0x06, 0x6a, 0x04, 0xe7, 0xff, 0x5c, 0xfa, 0xf0, 0xf3, 0x70, 0xed, 0x20, 0xe8, 
-0x1c, 0xe4, 0xf4, 0xe2, 0x62, 0xe6, 0xdf, 0xed, 0x5b, 0xf6, 0xf9, 0xfd, 0x0b, 0x03, 0x04, 0x06, 
-0xb7, 0x08, 0xeb, 0x0b, 0x81, 0x0f, 0xb0, 0x11, 0x12, 0x12, 0xfe, 0x0f, 0x7b, 0x0c, 0x40, 0x09, 
-0x01, 0x07, 0x49, 0x06, 0x14, 0x06, 0xe4, 0x04, 0x23, 0x03, 0xe7, 0x00, 0x1b, 0xff, 0x82, 0xfe, 
-0xe2, 0xfe, 0x02, 0x00, 0xc5, 0x00, 0x52, 0x01, 0xa4, 0x01, 0x91, 0x02, 0x09, 0x04, 0x43, 0x05, 
-0x1a, 0x05, 0xe7, 0x02, 0x10, 0xff, 0x3b, 0xfa, 0xfd, 0xf4, 0x6f, 0xf0, 0x07, 0xec, 0x26, 0xe8, 
-0x26, 0xe6, 0xb4, 0xe7, 0x18, 0xed, 0x07, 0xf4, 0xa4, 0xfa, 0x75, 0xff, 0x61, 0x03, 0xd1, 0x06, 
-0xa0, 0x0a, 0x89, 0x0e, 0x06, 0x11, 0xd9, 0x11, 0xae, 0x10, 0x7f, 0x0e, 0x00, 0x0c, 0xcb, 0x09, 
-0x46, 0x08, 0xac, 0x06, 0xc8, 0x04, 0xe0, 0x02, 0xac, 0x00, 0x29, 0xff, 0xd3, 0xfe, 0x60, 0xff, 
-0x57, 0x00, 0xb2, 0x00, 0xc0, 0x00, 0xed, 0x00, 0x8e, 0x01, 0xc7, 0x02, 0xe5, 0x03, 0xc9, 0x03, 
-0x46, 0x02, 0x4a, 0xff, 0x1c, 0xfc, 0xd7, 0xf7, 0x3c, 0xf3, 0x68, 0xef, 0x10, 0xec, 0x95, 0xe9, 
-0xdf, 0xe9, 0xaa, 0xed, 0x3f, 0xf2, 0x51, 0xf6, 0xc3, 0xf9, 0x52, 0xfd, 0xa3, 0x01, 0x3e, 0x06, 
-0xba, 0x0a, 0x54, 0x0e, 0xf6, 0x0f, 0x47, 0x10, 0x96, 0x0f, 0x5c, 0x0e, 0x5f, 0x0d, 0x29, 0x0c, 
-0x52, 0x0a, 0x4f, 0x08, 0x3b, 0x06, 0x0b, 0x04, 0x41, 0x02, 0xca, 0x00, 0x32, 0x00, 0x4d, 0x00, 
-0x39, 0x00, 0xff, 0xff, 0xba, 0xff, 0x13, 0x00, 0xb6, 0x00, 0x44, 0x01, 0x15, 0x01, 0x0b, 0x00, 
-0x14, 0xfe, 0xcb, 0xfb, 0x90, 0xf8, 0xc7, 0xf4, 0x05, 0xf1, 0x68, 0xed, 0xe9, 0xea, 0x64, 0xeb, 
-0x17, 0xee, 0xa8, 0xf0, 0xc8, 0xf2, 0x49, 0xf5, 0x33, 0xf9, 0xee, 0xfd, 0xe1, 0x02, 0x9d, 0x07, 
-0xdf, 0x0b, 0x19, 0x0f, 0x57, 0x11, 0x53, 0x12, 0x8b, 0x12, 0x31, 0x12, 0xd9, 0x10, 0x88, 0x0e, 
-0x0f, 0x0c, 0xe2, 0x09, 0x93, 0x07, 0xb3, 0x05, 0x0a, 0x04, 0x64, 0x02, 0x16, 0x01, 0xed, 0xff, 
-0xd1, 0xfe, 0x0e, 0xfe, 0x9b, 0xfd, 0x93, 0xfd, 0x8e, 0xfd, 0xd7, 0xfc, 0x05, 0xfc, 0xd2, 0xfa, 
-0x24, 0xf9, 0x55, 0xf6, 0xcf, 0xf2, 0x64, 0xef, 0xbf, 0xec, 0x73, 0xeb, 0xaf, 0xec, 0xf6, 0xee, 
-0x3c, 0xf1, 0x72, 0xf3, 0x7b, 0xf6, 0xea, 0xfa, 0xf1, 0xff, 0x3e, 0x05, 0xdf, 0x09, 0xa8, 0x0d, 
-0xbc, 0x10, 0xfc, 0x12, 0x18, 0x14, 0x09, 0x14, 0xdf, 0x12, 0xd4, 0x10, 0xa6, 0x0d, 0xbd, 0x0a, 
-0x09, 0x08, 0x7b, 0x05, 0xb8, 0x03, 0x40, 0x02, 0xe5, 0x00, 0x94, 0xff, 0x69, 0xfe, 0xd5, 0xfd, 
-0x90, 0xfd, 0x5b, 0xfd, 0x75, 0xfd, 0x3f, 0xfd, 0xfb, 0xfc, 0x81, 0xfc, 0x66, 0xfb, 0x70, 0xf9, 
-0x4a, 0xf6, 0xf9, 0xf2, 0xc5, 0xef, 0x30, 0xed, 0x64, 0xec, 0x86, 0xed, 0x65, 0xef, 0x7f, 0xf1, 
-0xe0, 0xf3, 0xd9, 0xf7, 0xd0, 0xfc, 0xe0, 0x01, 0xb6, 0x06, 0xa6, 0x0a, 0xf8, 0x0d, 0xf6, 0x10, 
-0x1a, 0x13, 0x1f, 0x14, 0xc9, 0x13, 0x33, 0x12, 0xf3, 0x0f, 0xdc, 0x0c, 0x1f, 0x0a, 0x79, 0x07, 
-0xe2, 0x04, 0xed, 0x02, 0x3e, 0x01, 0xe3, 0xff, 0xd9, 0xfe, 0xee, 0xfd, 0x6d, 0xfd, 0x44, 0xfd, 
-0x60, 0xfd, 0x93, 0xfd, 0x94, 0xfd, 0x7a, 0xfd, 0xa2, 0xfc, 0x37, 0xfb, 0xa5, 0xf8, 0x20, 0xf5, 
-0xc5, 0xf1, 0x4e, 0xee, 0x78, 0xec, 0xce, 0xec, 0xca, 0xed, 0x50, 0xef, 0x7e, 0xf1, 0x99, 0xf4, 
-0x79, 0xf9, 0x46, 0xfe, 0xe6, 0x02, 0x4b, 0x07, 0x38, 0x0b, 0x06, 0x0f, 0x13, 0x12, 0xe4, 0x13, 
-0x70, 0x14, 0xc5, 0x13, 0x31, 0x12, 0x7e, 0x0f, 0x7a, 0x0c, 0xe8, 0x09, 0x21, 0x07, 0xf8, 0x04, 
-0x09, 0x03, 0xfd, 0x00, 0x68, 0xff, 0x51, 0xfe, 0xa3, 0xfd, 0x62, 0xfd, 0x39, 0xfd, 0x32, 0xfd, 
-0x70, 0xfd, 0xc1, 0xfd, 0xc5, 0xfd, 0xd5, 0xfc, 0xc2, 0xfa, 0x6b, 0xf7, 0x08, 0xf4, 0xb4, 0xf0, 
-0xc5, 0xed, 0x62, 0xec, 0x69, 0xec, 0x82, 0xed, 0x6a, 0xef, 0xdc, 0xf1, 0x8c, 0xf5, 0x9c, 0xfa, 
-0x7f, 0xff, 0x50, 0x04, 0x7a, 0x08, 0x52, 0x0c, 0x1a, 0x10, 0xfe, 0x12, 0x84, 0x14, 0x84, 0x14, 
-0xff, 0x12, 0x0f, 0x11, 0x7d, 0x0e, 0xa8, 0x0b, 0xdb, 0x08, 0x0c, 0x06, 0xd4, 0x03, 0x00, 0x02, 
-0x00, 0x00, 0x95, 0xfe, 0x87, 0xfd, 0x00, 0xfd, 0x03, 0xfd, 0x21, 0xfd, 0x82, 0xfd, 0x01, 0xfe, 
-0x62, 0xfe, 0xc5, 0xfd, 0x7d, 0xfc, 0x33, 0xfa, 0xb9, 0xf6, 0x8b, 0xf3, 0xf1, 0xef, 0x05, 0xed, 
-0xa2, 0xec, 0xf3, 0xec, 0x42, 0xee, 0xad, 0xf0, 0x53, 0xf3, 0xef, 0xf7, 0x4c, 0xfd, 0xfd, 0x01, 
-0xb2, 0x06, 0x6b, 0x0a, 0x73, 0x0e, 0x32, 0x12, 0x8e, 0x14, 0xcc, 0x15, 0x74, 0x15, 0x0f, 0x14, 
-0x5b, 0x12, 0xf0, 0x0f, 0x20, 0x0d, 0xe5, 0x09, 0x8f, 0x06, 0x8c, 0x03, 0xf0, 0x00, 0x99, 0xfe, 
-0x2b, 0xfc, 0x3b, 0xfa, 0xe6, 0xf8, 0x00, 0xf8, 0xe0, 0xf7, 0x25, 0xf8, 0x3f, 0xf8, 0x85, 0xf8, 
-0xd2, 0xf8, 0x04, 0xf9, 0x8a, 0xf8, 0x3b, 0xf7, 0x6c, 0xf5, 0x9e, 0xf2, 0x3b, 0xf0, 0x4a, 0xef, 
-0x11, 0xef, 0x44, 0xef, 0x97, 0xf0, 0x61, 0xf3, 0x44, 0xf7, 0x3e, 0xfc, 0x19, 0x01, 0x7d, 0x05, 
-0xf0, 0x09, 0x8a, 0x0e, 0x83, 0x12, 0xf7, 0x15, 0xfa, 0x17, 0xc9, 0x17, 0xc4, 0x16, 0x33, 0x15, 
-0xc7, 0x12, 0x27, 0x0f, 0x10, 0x0b, 0x06, 0x07, 0x57, 0x03, 0x8d, 0x00, 0xd4, 0xfd, 0x07, 0xfb, 
-0xc9, 0xf8, 0x79, 0xf7, 0xfa, 0xf6, 0x05, 0xf7, 0x75, 0xf7, 0x0e, 0xf8, 0x82, 0xf8, 0xf7, 0xf8, 
-0x59, 0xf9, 0xe9, 0xf8, 0xb6, 0xf7, 0x2b, 0xf5, 0xf3, 0xf1, 0xfc, 0xef, 0x6f, 0xef, 0x7e, 0xef, 
-0x08, 0xf0, 0xc7, 0xf1, 0xa2, 0xf4, 0xf4, 0xf8, 0x33, 0xfe, 0xe0, 0x02, 0x1c, 0x07, 0x5e, 0x0b, 
-0x7e, 0x0f, 0x56, 0x13, 0xa3, 0x16, 0xe2, 0x17, 0x65, 0x17, 0x07, 0x16, 0x1a, 0x14, 0x59, 0x11, 
-0xd3, 0x0d, 0xcf, 0x09, 0x9e, 0x05, 0x74, 0x02, 0xd1, 0xff, 0xf1, 0xfc, 0x5c, 0xfa, 0x77, 0xf8, 
-0x30, 0xf7, 0xe4, 0xf6, 0x56, 0xf7, 0x18, 0xf8, 0xcd, 0xf8, 0x50, 0xf9, 0xc5, 0xf9, 0xcc, 0xf9, 
-0x11, 0xf9, 0x88, 0xf7, 0x02, 0xf5, 0xce, 0xf1, 0x89, 0xef, 0x13, 0xef, 0x53, 0xef, 0xcc, 0xef, 
-0x91, 0xf1, 0x5b, 0xf4, 0x58, 0xf8, 0x49, 0xfd, 0xfd, 0x01, 0xe6, 0x05, 0xf6, 0x09, 0x5e, 0x0e, 
-0x0b, 0x12, 0x50, 0x15, 0xc2, 0x16, 0x39, 0x16, 0x1c, 0x15, 0x7f, 0x13, 0x13, 0x11, 0x11, 0x0e, 
-0xa9, 0x0a, 0xde, 0x06, 0x49, 0x03, 0x8d, 0x00, 0x39, 0xfe, 0xfc, 0xfb, 0xd7, 0xf9, 0x88, 0xf8, 
-0x37, 0xf8, 0x76, 0xf8, 0x25, 0xf9, 0xce, 0xf9, 0x20, 0xfa, 0x55, 0xfa, 0x90, 0xfa, 0xd8, 0xf9, 
-0x5f, 0xf8, 0x9d, 0xf5, 0xee, 0xf1, 0x91, 0xef, 0x41, 0xef, 0x92, 0xef, 0xd0, 0xef, 0x58, 0xf1, 
-0x54, 0xf3, 0xcd, 0xf6, 0x48, 0xfc, 0x5d, 0x01, 0x6d, 0x05, 0x73, 0x09, 0x7c, 0x0d, 0x48, 0x11, 
-0x28, 0x15, 0x17, 0x17, 0xc9, 0x16, 0xcb, 0x15, 0x09, 0x14, 0xb0, 0x11, 0xe0, 0x0e, 0xf4, 0x0a, 
-0xf2, 0x06, 0xdc, 0x03, 0x5c, 0x01, 0x60, 0xff, 0x75, 0xfd, 0x5a, 0xfb, 0xee, 0xf9, 0x4a, 0xf9, 
-0xef, 0xf8, 0x56, 0xf9, 0xcc, 0xf9, 0xe4, 0xf9, 0xfd, 0xf9, 0xcc, 0xf9, 0x20, 0xf9, 0xb5, 0xf7, 
-0x4c, 0xf5, 0xd9, 0xf1, 0x92, 0xef, 0x53, 0xef, 0xa3, 0xef, 0x50, 0xf0, 0x1e, 0xf2, 0x36, 0xf4, 
-0x9e, 0xf7, 0x6d, 0xfc, 0x2b, 0x01, 0x50, 0x05, 0xe7, 0x08, 0x4c, 0x0c, 0xf0, 0x0f, 0x6a, 0x13, 
-0x0c, 0x15, 0x48, 0x15, 0x4e, 0x14, 0x7e, 0x12, 0x19, 0x10, 0xcb, 0x0d, 0xbc, 0x0a, 0x88, 0x07, 
-0x84, 0x04, 0xb1, 0x01, 0xbe, 0xff, 0xd5, 0xfd, 0xc2, 0xfb, 0xce, 0xfa, 0x27, 0xfa, 0x8d, 0xf9, 
-0x3d, 0xfa, 0x0e, 0xfb, 0xe3, 0xfb, 0x9f, 0xfb, 0xd5, 0xfa, 0xf5, 0xf8, 0x20, 0xf6, 0x82, 0xf2, 
-0x2b, 0xef, 0x94, 0xee, 0xf6, 0xed, 0x03, 0xee, 0x52, 0xf0, 0xe0, 0xf3, 0xb0, 0xf6, 0x67, 0xfa, 
-0x2a, 0xff, 0x8b, 0x04, 0xad, 0x09, 0xa5, 0x0d, 0x46, 0x10, 0x44, 0x13, 0x3f, 0x16, 0x86, 0x16, 
-0x4a, 0x15, 0x53, 0x13, 0xef, 0x10, 0x0c, 0x0d, 0xa3, 0x08, 0x95, 0x04, 0xe4, 0x00, 0xb7, 0xfd, 
-0x79, 0xfa, 0xeb, 0xf7, 0x71, 0xf7, 0x60, 0xf7, 0xa9, 0xf7, 0x0d, 0xf9, 0x3f, 0xfb, 0x99, 0xfd, 
-0x65, 0xff, 0x07, 0x01, 0x10, 0x01, 0xd0, 0xff, 0xbc, 0xfc, 0x6d, 0xf8, 0xfd, 0xf3, 0x42, 0xed, 
-0xd0, 0xeb, 0xfc, 0xeb, 0x23, 0xeb, 0x3a, 0xee, 0x1b, 0xf3, 0xb5, 0xf6, 0x0a, 0xfc, 0x2c, 0x02, 
-0x23, 0x07, 0x5a, 0x0c, 0x8c, 0x0f, 0x85, 0x12, 0x53, 0x15, 0x73, 0x15, 0x5d, 0x15, 0x27, 0x15, 
-0xf7, 0x11, 0xef, 0x0e, 0x27, 0x0b, 0x73, 0x06, 0x1c, 0x03, 0xf6, 0xff, 0xb9, 0xfc, 0x41, 0xfb, 
-0x1b, 0xf9, 0xab, 0xf8, 0xf5, 0xf9, 0xa6, 0xf9, 0xba, 0xfc, 0xf4, 0xfe, 0x60, 0xff, 0xba, 0x02, 
-0x08, 0x04, 0xa8, 0x02, 0x61, 0x02, 0xae, 0xfe, 0x89, 0xf8, 0x95, 0xf4, 0x96, 0xec, 0x1a, 0xea, 
-0xa2, 0xe9, 0xb7, 0xe6, 0x2c, 0xeb, 0x92, 0xef, 0x0f, 0xf2, 0xe5, 0xf9, 0x9d, 0xff, 0x11, 0x04, 
-0x24, 0x0b, 0xa7, 0x0e, 0x3f, 0x11, 0xb2, 0x13, 0x35, 0x15, 0xdf, 0x15, 0x46, 0x14, 0x00, 0x13, 
-0xb6, 0x10, 0x61, 0x0b, 0x94, 0x08, 0x9e, 0x05, 0xf8, 0x00, 0x88, 0xfe, 0x72, 0xfc, 0x51, 0xf9, 
-0x76, 0xf9, 0x59, 0xf9, 0x40, 0xf9, 0x34, 0xfc, 0xf7, 0xfc, 0xf6, 0xfe, 0xe8, 0x00, 0xed, 0x01, 
-0xfc, 0x02, 0x37, 0x01, 0x97, 0xfe, 0xad, 0xfa, 0xf1, 0xf5, 0xa1, 0xee, 0x45, 0xed, 0xb1, 0xeb, 
-0x95, 0xe8, 0x67, 0xed, 0x53, 0xf0, 0xa4, 0xf2, 0x7b, 0xfa, 0x23, 0xff, 0xd6, 0x02, 0xe2, 0x09, 
-0x0a, 0x0e, 0xb4, 0x0f, 0xf2, 0x12, 0x54, 0x15, 0xb4, 0x13, 0xcc, 0x13, 0xfc, 0x12, 0xa5, 0x0e, 
-0x69, 0x0b, 0x46, 0x08, 0xb7, 0x03, 0xe7, 0x00, 0x9f, 0xfe, 0x48, 0xfb, 0x3d, 0xfa, 0xe1, 0xf9, 
-0xed, 0xf8, 0x56, 0xfa, 0xcb, 0xfb, 0xc1, 0xfc, 0x76, 0xff, 0xcf, 0x00, 0x39, 0x02, 0xdc, 0x02, 
-0xf4, 0x00, 0x11, 0xfe, 0x7e, 0xfa, 0xf5, 0xf4, 0x2d, 0xee, 0x93, 0xed, 0xc3, 0xea, 0x6b, 0xe9, 
-0x99, 0xee, 0x4a, 0xf0, 0x64, 0xf3, 0x9e, 0xfb, 0xf8, 0xfe, 0x9f, 0x03, 0xe1, 0x0a, 0xd6, 0x0c, 
-0x1a, 0x10, 0x0b, 0x13, 0xb8, 0x13, 0xc1, 0x13, 0x2e, 0x13, 0x6f, 0x11, 0x15, 0x0e, 0xff, 0x0a, 
-0x25, 0x07, 0xb4, 0x03, 0xfa, 0x00, 0x07, 0xfe, 0x11, 0xfc, 0xf9, 0xfa, 0x2a, 0xfa, 0x56, 0xfa, 
-0xed, 0xfb, 0xe6, 0xfc, 0xa0, 0xfd, 0x4c, 0x00, 0xd1, 0x00, 0x02, 0x01, 0x62, 0x02, 0x52, 0xff, 
-0x7b, 0xfc, 0x39, 0xf9, 0xff, 0xf2, 0xb0, 0xed, 0x53, 0xed, 0xb9, 0xe9, 0x69, 0xea, 0x30, 0xf0, 
-0xa3, 0xef, 0xb2, 0xf6, 0x4a, 0xfd, 0x2d, 0xff, 0x53, 0x07, 0x93, 0x0b, 0xf3, 0x0d, 0x81, 0x12, 
-0x82, 0x13, 0x9d, 0x14, 0xa0, 0x14, 0x14, 0x13, 0x2f, 0x11, 0x27, 0x0d, 0x1b, 0x0a, 0x04, 0x06, 
-0xd6, 0x01, 0x6b, 0x00, 0x90, 0xfc, 0xbc, 0xfa, 0xbe, 0xfa, 0xb2, 0xf8, 0x92, 0xf9, 0x49, 0xfa, 
-0x7d, 0xfb, 0x0b, 0xfd, 0x42, 0xfe, 0xdc, 0x00, 0x12, 0x01, 0xe2, 0x00, 0xf4, 0xff, 0x06, 0xfb, 
-0xf9, 0xf7, 0x61, 0xf1, 0xda, 0xed, 0x6d, 0xed, 0x79, 0xe9, 0xeb, 0xee, 0x90, 0xf0, 0xcb, 0xf2, 
-0x8b, 0xfb, 0x7a, 0xfd, 0x1e, 0x03, 0xb2, 0x09, 0xc8, 0x0b, 0x4e, 0x10, 0x67, 0x12, 0xc4, 0x13, 
-0xd5, 0x14, 0x59, 0x14, 0xb3, 0x12, 0x67, 0x0f, 0xa0, 0x0c, 0xf8, 0x07, 0xd0, 0x03, 0xc3, 0x01, 
-0xd1, 0xfd, 0x48, 0xfb, 0x50, 0xfb, 0xa0, 0xf9, 0xd9, 0xf8, 0x1a, 0xfb, 0xdb, 0xfa, 0x1c, 0xfc, 
-0x47, 0xff, 0xcf, 0xfe, 0xc6, 0x01, 0x2f, 0x01, 0x1e, 0x00, 0x7d, 0xfd, 0x60, 0xf8, 0x07, 0xf4, 
-0x66, 0xed, 0x45, 0xee, 0x7e, 0xea, 0xf9, 0xea, 0x0b, 0xf2, 0xdf, 0xef, 0xd4, 0xf7, 0xe3, 0xfe, 
-0xfc, 0xfe, 0x13, 0x09, 0x7e, 0x0c, 0xc7, 0x0d, 0xa3, 0x13, 0xc6, 0x13, 0xe5, 0x13, 0xc0, 0x15, 
-0xa3, 0x13, 0xf0, 0x0f, 0xc0, 0x0e, 0x0a, 0x0a, 0x2c, 0x04, 0x8a, 0x03, 0xa4, 0xfe, 0x2a, 0xfb, 
-0x00, 0xfc, 0xc6, 0xf8, 0xa1, 0xf8, 0x28, 0xfa, 0xe9, 0xf9, 0xea, 0xfa, 0xd2, 0xfd, 0xe3, 0xfd, 
-0x8d, 0xff, 0x03, 0x01, 0x4b, 0xff, 0xb0, 0xfd, 0xee, 0xf9, 0xf3, 0xf4, 0x7c, 0xef, 0xa0, 0xee, 
-0xd3, 0xeb, 0x74, 0xeb, 0xb8, 0xf0, 0xa9, 0xf0, 0xf4, 0xf5, 0x5d, 0xfd, 0x62, 0xfe, 0x20, 0x06, 
-0x85, 0x0b, 0x20, 0x0c, 0xa7, 0x11, 0x4b, 0x13, 0xb0, 0x12, 0xa3, 0x14, 0x89, 0x13, 0x6e, 0x0f, 
-0x14, 0x0e, 0x4b, 0x0a, 0x1f, 0x04, 0x35, 0x03, 0xbd, 0xfe, 0x32, 0xfc, 0xb6, 0xfc, 0xc4, 0xf9, 
-0xe7, 0xfa, 0xe0, 0xfa, 0x50, 0xfb, 0x0c, 0xfc, 0x01, 0xfe, 0x9e, 0xfe, 0x32, 0xff, 0xaa, 0x01, 
-0x13, 0xff, 0xac, 0xfe, 0xc7, 0xfb, 0x6f, 0xf5, 0x86, 0xf2, 0xc2, 0xef, 0x33, 0xec, 0x10, 0xee, 
-0x62, 0xf0, 0x3b, 0xf1, 0xd0, 0xf7, 0xf9, 0xfc, 0x87, 0xff, 0x3b, 0x07, 0x36, 0x0b, 0x06, 0x0d, 
-0x19, 0x12, 0xb0, 0x12, 0xfc, 0x12, 0x51, 0x14, 0x05, 0x12, 0xa9, 0x0f, 0x6e, 0x0d, 0xfd, 0x08, 
-0x5e, 0x04, 0x76, 0x01, 0x9a, 0xfd, 0x9f, 0xfa, 0x19, 0xfa, 0x4d, 0xf8, 0x7c, 0xf8, 0xb4, 0xf9, 
-0x44, 0xfa, 0xbc, 0xfb, 0x28, 0xfe, 0x29, 0xff, 0x83, 0x00, 0x58, 0x01, 0xa1, 0x00, 0x7f, 0xfe, 
-0x0c, 0xfb, 0x82, 0xf6, 0x97, 0xf1, 0x54, 0xf0, 0x75, 0xec, 0xe6, 0xed, 0xcd, 0xf0, 0x84, 0xf0, 
-0x52, 0xf8, 0xb9, 0xfb, 0x67, 0xff, 0x98, 0x07, 0x86, 0x09, 0xfc, 0x0d, 0x54, 0x12, 0x2a, 0x12, 
-0x0d, 0x14, 0x56, 0x14, 0x6f, 0x12, 0x34, 0x10, 0x69, 0x0d, 0x69, 0x09, 0x66, 0x04, 0x81, 0x01, 
-0xce, 0xfd, 0x91, 0xfa, 0xfe, 0xf9, 0x5a, 0xf8, 0x81, 0xf8, 0x54, 0xf9, 0x48, 0xfa, 0x50, 0xfc, 
-0x8a, 0xfd, 0xb3, 0xff, 0x5b, 0x00, 0x70, 0x00, 0xe8, 0x00, 0xe6, 0xfc, 0x6d, 0xfa, 0x0b, 0xf6, 
-0xf0, 0xf0, 0xcb, 0xf0, 0xb3, 0xed, 0x46, 0xef, 0x2f, 0xf2, 0xd6, 0xf3, 0x4a, 0xfa, 0xde, 0xfd, 
-0xa0, 0x02, 0xda, 0x08, 0x39, 0x0b, 0xee, 0x0f, 0x28, 0x12, 0x92, 0x12, 0x95, 0x14, 0x5e, 0x12, 
-0x9d, 0x11, 0xec, 0x0e, 0x2d, 0x0a, 0x88, 0x07, 0x31, 0x02, 0xb4, 0xfe, 0x98, 0xfd, 0xd5, 0xf9, 
-0x5a, 0xfa, 0x08, 0xfb, 0x48, 0xfa, 0xf8, 0xfd, 0x99, 0xfe, 0xf4, 0xff, 0xb4, 0x01, 0xae, 0xff, 
-0x4b, 0xff, 0xc6, 0xfa, 0xc2, 0xf7, 0x52, 0xf2, 0x4d, 0xeb, 0xd4, 0xec, 0x1d, 0xe6, 0x78, 0xe8, 
-0x73, 0xec, 0x5d, 0xea, 0xff, 0xf4, 0xd2, 0xf8, 0xeb, 0xfd, 0x4d, 0x09, 0x89, 0x0b, 0x11, 0x12, 
-0x4a, 0x17, 0xfe, 0x15, 0xb1, 0x18, 0xb7, 0x16, 0x55, 0x13, 0x4d, 0x11, 0x95, 0x0c, 0x8b, 0x08, 
-0x32, 0x05, 0x55, 0x02, 0xc1, 0xff, 0xb2, 0xfe, 0xe2, 0xfe, 0xf5, 0xfc, 0x8d, 0xfe, 0x24, 0xff, 
-0x65, 0xfd, 0x4d, 0x00, 0x86, 0xfe, 0x23, 0xfe, 0x00, 0x00, 0x9d, 0xfc, 0xc6, 0xfc, 0x4d, 0xf9, 
-0x75, 0xf5, 0xfa, 0xf0, 0x3f, 0xed, 0x4c, 0xec, 0x67, 0xe8, 0x8a, 0xeb, 0xbc, 0xeb, 0xdf, 0xee, 
-0xe9, 0xf5, 0xfb, 0xf9, 0xb7, 0x01, 0x34, 0x08, 0xd1, 0x0c, 0xba, 0x11, 0xe0, 0x13, 0xef, 0x15, 
-0x2d, 0x15, 0x95, 0x13, 0x68, 0x12, 0x1b, 0x0e, 0x21, 0x0c, 0x13, 0x09, 0x03, 0x06, 0x53, 0x04, 
-0x40, 0x02, 0x9c, 0x00, 0x01, 0x00, 0xcd, 0xfe, 0x5a, 0xff, 0xb2, 0xfe, 0xbe, 0xfe, 0x35, 0xff, 
-0xef, 0xfc, 0xe0, 0xfe, 0xbb, 0xfc, 0xf2, 0xfb, 0x3d, 0xfc, 0x2f, 0xf6, 0xcc, 0xf5, 0xe3, 0xef, 
-0x96, 0xec, 0x81, 0xed, 0xc2, 0xe8, 0x4e, 0xec, 0x51, 0xee, 0x18, 0xf0, 0x0d, 0xf8, 0x8e, 0xfc, 
-0xf8, 0x01, 0x79, 0x0a, 0x9c, 0x0d, 0x86, 0x11, 0xf0, 0x15, 0x38, 0x15, 0x09, 0x15, 0xcd, 0x14, 
-0xe5, 0x10, 0xf5, 0x0e, 0x15, 0x0c, 0xdd, 0x07, 0xdf, 0x05, 0x09, 0x03, 0x80, 0x00, 0x38, 0xff, 
-0x4e, 0xfe, 0xba, 0xfc, 0x66, 0xfd, 0x12, 0xfd, 0xc4, 0xfc, 0x7b, 0xfd, 0x6a, 0xfd, 0x75, 0xfd, 
-0x1a, 0xfd, 0x5f, 0xfc, 0x70, 0xf9, 0xeb, 0xf6, 0x01, 0xf2, 0xca, 0xec, 0x03, 0xec, 0xfa, 0xe7, 
-0x47, 0xe9, 0x74, 0xeb, 0x94, 0xed, 0x2a, 0xf5, 0x45, 0xf9, 0x53, 0x01, 0x70, 0x07, 0xcc, 0x0c, 
-0x1b, 0x13, 0xe8, 0x13, 0x9b, 0x17, 0x00, 0x17, 0x41, 0x14, 0xc0, 0x14, 0x7b, 0x10, 0xdc, 0x0d, 
-0xd2, 0x0b, 0x2d, 0x08, 0xe5, 0x05, 0xbb, 0x02, 0x35, 0x01, 0x50, 0xff, 0x2c, 0xfd, 0xc7, 0xfd, 
-0xbc, 0xfb, 0xf6, 0xfb, 0xf5, 0xfc, 0x82, 0xfb, 0x6a, 0xfd, 0x31, 0xfc, 0x89, 0xfb, 0x3f, 0xfb, 
-0xca, 0xf5, 0xf5, 0xf4, 0xc2, 0xed, 0xe9, 0xe9, 0x8b, 0xeb, 0x9b, 0xe4, 0x79, 0xeb, 0xe5, 0xec, 
-0x63, 0xef, 0x12, 0xfb, 0x73, 0xfc, 0xa2, 0x05, 0xcd, 0x0c, 0x63, 0x0e, 0x56, 0x15, 0x71, 0x15, 
-0x4d, 0x15, 0x40, 0x16, 0x7b, 0x12, 0x6b, 0x11, 0x02, 0x0f, 0x1f, 0x0b, 0xeb, 0x09, 0x30, 0x06, 
-0x18, 0x03, 0x8d, 0x02, 0xd9, 0xff, 0xb0, 0xfe, 0x36, 0xfe, 0xf6, 0xfc, 0xe5, 0xfc, 0x2a, 0xfc, 
-0xa1, 0xfc, 0x5a, 0xfd, 0xb9, 0xfc, 0x8e, 0xfd, 0x92, 0xfc, 0xae, 0xfa, 0xb6, 0xf7, 0x4a, 0xf3, 
-0x6f, 0xeb, 0x0f, 0xeb, 0x07, 0xe8, 0x80, 0xe4, 0xf9, 0xec, 0x56, 0xec, 0x4f, 0xf3, 0x0f, 0xfd, 
-0x61, 0xff, 0xe9, 0x09, 0x20, 0x0e, 0x4e, 0x11, 0x26, 0x16, 0xe6, 0x13, 0xd0, 0x15, 0x85, 0x13, 
-0x83, 0x11, 0xb0, 0x11, 0x07, 0x0d, 0x54, 0x0c, 0x53, 0x09, 0x6c, 0x05, 0x90, 0x04, 0xf2, 0x01, 
-0xf3, 0xff, 0xdc, 0xfe, 0x6d, 0xfd, 0x64, 0xfc, 0x96, 0xfb, 0xa7, 0xfb, 0x7d, 0xfc, 0xd8, 0xfb, 
-0x81, 0xfd, 0x9f, 0xfc, 0x2c, 0xfb, 0x08, 0xfb, 0x62, 0xf3, 0x67, 0xee, 0xf6, 0xea, 0xd7, 0xe6, 
-0x41, 0xe6, 0x27, 0xe9, 0x42, 0xed, 0x32, 0xf2, 0x40, 0xfa, 0xd8, 0x00, 0x43, 0x06, 0x8b, 0x0d, 
-0x1d, 0x11, 0xc2, 0x12, 0xd2, 0x14, 0xf4, 0x13, 0x63, 0x12, 0x66, 0x12, 0x82, 0x10, 0x91, 0x0d, 
-0x29, 0x0d, 0x9b, 0x09, 0x10, 0x06, 0x08, 0x05, 0x08, 0x02, 0x25, 0x00, 0xbf, 0xff, 0x97, 0xfc, 
-0x10, 0xfd, 0x10, 0xfc, 0x36, 0xfb, 0x3d, 0xfd, 0x08, 0xfd, 0x7c, 0xfd, 0x33, 0xfe, 0xdc, 0xfd, 
-0xb0, 0xfa, 0x84, 0xf8, 0xa8, 0xf1, 0x16, 0xea, 0x41, 0xea, 0x1c, 0xe5, 0xe6, 0xe5, 0x8e, 0xec, 
-0x4c, 0xee, 0x4c, 0xf6, 0xb8, 0xfd, 0x23, 0x03, 0xed, 0x09, 0xb7, 0x0e, 0xa4, 0x11, 0xb6, 0x13, 
-0x90, 0x13, 0x2f, 0x14, 0x62, 0x12, 0x6e, 0x11, 0x22, 0x10, 0x38, 0x0d, 0xb9, 0x0a, 0x25, 0x08, 
-0x27, 0x05, 0x5e, 0x03, 0x26, 0x02, 0x3a, 0xff, 0x7f, 0xff, 0x05, 0xfd, 0x85, 0xfc, 0x11, 0xfc, 
-0xed, 0xfb, 0xb4, 0xfd, 0xc6, 0xfd, 0x61, 0xfe, 0xd2, 0xfe, 0xa8, 0xfc, 0x3e, 0xf9, 0x68, 0xf5, 
-0x28, 0xeb, 0xc6, 0xe8, 0xf2, 0xe7, 0xf8, 0xe1, 0xc1, 0xea, 0xe7, 0xed, 0xad, 0xf2, 0x52, 0xfd, 
-0x61, 0x01, 0xeb, 0x08, 0x39, 0x0d, 0xea, 0x10, 0x15, 0x13, 0x24, 0x11, 0xcb, 0x13, 0x5d, 0x11, 
-0x67, 0x0f, 0x8a, 0x10, 0xb1, 0x0c, 0x43, 0x0b, 0xf6, 0x07, 0xd8, 0x06, 0x4a, 0x03, 0x97, 0x01, 
-0xef, 0x02, 0x3d, 0xfe, 0x5a, 0xff, 0xe2, 0xfe, 0xb6, 0xfb, 0xfc, 0xfd, 0x57, 0xfe, 0x47, 0xfd, 
-0x3a, 0xff, 0xf5, 0xfe, 0x00, 0xfc, 0x69, 0xfb, 0xf5, 0xf5, 0x79, 0xee, 0x46, 0xe8, 0xee, 0xe7, 
-0x17, 0xe4, 0x16, 0xe7, 0x95, 0xf0, 0x19, 0xf1, 0xf6, 0xfb, 0x32, 0x03, 0x5a, 0x05, 0x0d, 0x0d, 
-0xa0, 0x0f, 0x2c, 0x10, 0x09, 0x11, 0x48, 0x10, 0xd2, 0x0f, 0xda, 0x0d, 0x91, 0x0e, 0x09, 0x0e, 
-0x2e, 0x0a, 0x14, 0x0b, 0x7e, 0x08, 0x3b, 0x03, 0xe0, 0x04, 0x1e, 0x01, 0xc3, 0xfe, 0x21, 0xff, 
-0x63, 0xfc, 0x14, 0xfc, 0xa7, 0xfc, 0xd2, 0xfc, 0x9e, 0xfe, 0xc2, 0xff, 0x4c, 0xff, 0x3a, 0x00, 
-0x25, 0xfe, 0xe0, 0xf9, 0x0f, 0xf4, 0xed, 0xeb, 0x9a, 0xe6, 0x49, 0xe4, 0x0e, 0xe6, 0xbb, 0xea, 
-0x13, 0xef, 0x6b, 0xf9, 0xd8, 0xfd, 0xa7, 0x04, 0x75, 0x0b, 0x3b, 0x0d, 0xba, 0x11, 0xeb, 0x11, 
-0x5e, 0x11, 0x4a, 0x10, 0xfd, 0x0e, 0xce, 0x0e, 0x0c, 0x0c, 0x64, 0x0b, 0x20, 0x0c, 0xcf, 0x06, 
-0xd7, 0x06, 0x24, 0x05, 0xdb, 0x01, 0xb6, 0x00, 0x1e, 0xfe, 0x1c, 0xfe, 0x5b, 0xfa, 0x3f, 0xfc, 
-0x87, 0xfd, 0xdf, 0xfc, 0xb1, 0x00, 0x69, 0x01, 0xea, 0x00, 0x3f, 0x00, 0xeb, 0xfe, 0xc3, 0xf6, 
-0xf5, 0xf0, 0x3f, 0xe7, 0xde, 0xe2, 0xbd, 0xe5, 0x4a, 0xe3, 0xd5, 0xed, 0x38, 0xf3, 0xaa, 0xf9, 
-0x12, 0x04, 0x5b, 0x06, 0x9a, 0x0c, 0xc1, 0x10, 0xfd, 0x10, 0x37, 0x12, 0x0c, 0x11, 0x40, 0x10, 
-0xf5, 0x0e, 0x6e, 0x0c, 0x10, 0x0d, 0x2e, 0x0a, 0x40, 0x09, 0x8b, 0x07, 0xe1, 0x04, 0x67, 0x04, 
-0xbe, 0x00, 0x2b, 0x00, 0xbc, 0xfd, 0x65, 0xfb, 0xd3, 0xfc, 0x04, 0xfc, 0x42, 0xfd, 0x51, 0xff, 
-0x7a, 0x01, 0x2b, 0x00, 0xc5, 0xff, 0x38, 0x00, 0xe9, 0xf7, 0x71, 0xf3, 0xa9, 0xea, 0x05, 0xe2, 
-0x7d, 0xe5, 0x9e, 0xe4, 0x06, 0xea, 0xf8, 0xf3, 0xf1, 0xf8, 0xe5, 0x01, 0xd8, 0x06, 0xcb, 0x0b, 
-0x52, 0x0f, 0x65, 0x0f, 0x8e, 0x12, 0x16, 0x10, 0x3b, 0x0f, 0x88, 0x0f, 0x6e, 0x0c, 0xa4, 0x0c, 
-0x9f, 0x0a, 0xec, 0x09, 0x03, 0x08, 0xbe, 0x04, 0x83, 0x04, 0x12, 0x02, 0x7f, 0xff, 0x94, 0xfd, 
-0xdd, 0xfc, 0xa4, 0xfb, 0x03, 0xfc, 0x67, 0xfd, 0x79, 0xff, 0x22, 0x01, 0xbd, 0x01, 0xe9, 0x01, 
-0xda, 0xff, 0x22, 0xfd, 0x2a, 0xf6, 0xe4, 0xee, 0x8d, 0xe5, 0x5b, 0xe2, 0xd0, 0xe4, 0xca, 0xe5, 
-0x4a, 0xef, 0xa2, 0xf6, 0x63, 0xfd, 0x93, 0x04, 0x97, 0x08, 0x3c, 0x0d, 0x62, 0x0d, 0xad, 0x0e, 
-0xa4, 0x0f, 0x56, 0x0d, 0xd5, 0x0c, 0x9b, 0x0c, 0xa4, 0x0b, 0x33, 0x0a, 0x5d, 0x09, 0xf7, 0x07, 
-0x4a, 0x05, 0x09, 0x04, 0xa9, 0x02, 0x0b, 0x01, 0x71, 0x01, 0x19, 0x01, 0xb7, 0x01, 0x88, 0x03, 
-0x4f, 0x04, 0x93, 0x04, 0x84, 0x04, 0xbf, 0x02, 0x2e, 0xfe, 0x79, 0xfa, 0x10, 0xf5, 0x1b, 0xed, 
-0xe3, 0xe6, 0x16, 0xe4, 0x0a, 0xe7, 0x1e, 0xed, 0x12, 0xf3, 0x41, 0xfa, 0xcd, 0x01, 0x1d, 0x06, 
-0x68, 0x08, 0xda, 0x09, 0xf5, 0x09, 0xb9, 0x08, 0x27, 0x07, 0xeb, 0x06, 0xd2, 0x06, 0xc7, 0x06, 
-0xef, 0x06, 0x1b, 0x08, 0x56, 0x08, 0xc0, 0x06, 0xf2, 0x06, 0xa7, 0x04, 0x49, 0x02, 0x63, 0x02, 
-0x31, 0x01, 0xae, 0x00, 0x4e, 0x01, 0x76, 0x02, 0xc6, 0x02, 0x08, 0x04, 0x6e, 0x05, 0x23, 0x05, 
-0xe6, 0x03, 0x24, 0x02, 0x5a, 0xfe, 0x10, 0xf9, 0xa7, 0xf3, 0x77, 0xec, 0xfb, 0xe7, 0x1f, 0xe6, 
-0xf9, 0xe8, 0x5b, 0xf0, 0xe3, 0xf3, 0xfb, 0xf9, 0xe6, 0x01, 0xf6, 0x05, 0xd5, 0x07, 0x8a, 0x09, 
-0xa4, 0x0b, 0x9d, 0x09, 0xdc, 0x07, 0x1d, 0x08, 0x33, 0x07, 0x21, 0x06, 0x77, 0x06, 0xc6, 0x07, 
-0x83, 0x07, 0xf6, 0x06, 0x09, 0x06, 0xff, 0x04, 0x39, 0x04, 0xdd, 0x01, 0x64, 0x01, 0xe1, 0x01, 
-0xf8, 0x00, 0x02, 0x01, 0x84, 0x02, 0x23, 0x04, 0x37, 0x03, 0x13, 0x03, 0x4c, 0x03, 0x0c, 0xff, 
-0x58, 0xfb, 0x45, 0xf7, 0xf6, 0xf0, 0xbf, 0xeb, 0x42, 0xe8, 0x09, 0xe9, 0x9f, 0xec, 0xa0, 0xf0, 
-0x48, 0xf5, 0xaa, 0xfb, 0xb6, 0x01, 0xdd, 0x04, 0x88, 0x08, 0x89, 0x0b, 0x63, 0x0c, 0xd4, 0x0b, 
-0x0c, 0x0b, 0xea, 0x0a, 0xfc, 0x07, 0xe6, 0x06, 0xfe, 0x06, 0x0b, 0x06, 0x5e, 0x05, 0x7b, 0x04, 
-0xfb, 0x04, 0x68, 0x03, 0x14, 0x03, 0xe3, 0x02, 0x00, 0x02, 0xa2, 0x02, 0xb2, 0x01, 0x41, 0x02, 
-0x96, 0x02, 0x58, 0x02, 0xf0, 0x01, 0xee, 0x00, 0x6c, 0xff, 0x40, 0xfc, 0x7a, 0xf9, 0xde, 0xf4, 
-0x42, 0xf0, 0xae, 0xec, 0xce, 0xea, 0x55, 0xec, 0x31, 0xee, 0x3f, 0xf1, 0xe6, 0xf5, 0x65, 0xfb, 
-0x47, 0x00, 0x38, 0x04, 0x88, 0x08, 0x88, 0x0b, 0xd5, 0x0c, 0x99, 0x0d, 0x8a, 0x0d, 0xc6, 0x0c, 
-0x11, 0x0b, 0x90, 0x09, 0xb9, 0x08, 0x68, 0x07, 0x17, 0x06, 0xf6, 0x04, 0xb6, 0x03, 0x7d, 0x02, 
-0xb3, 0x01, 0xe5, 0x00, 0x0f, 0x01, 0x26, 0x01, 0xb7, 0x00, 0x6e, 0x01, 0x9b, 0x01, 0xf6, 0x00, 
-0x70, 0x00, 0xba, 0xff, 0x75, 0xfd, 0x2f, 0xfb, 0x39, 0xf9, 0x70, 0xf5, 0x9a, 0xf2, 0x2e, 0xf0, 
-0xf5, 0xee, 0xde, 0xef, 0xfc, 0xef, 0x38, 0xf1, 0xe1, 0xf4, 0xcf, 0xf8, 0x3a, 0xfc, 0x9b, 0x00, 
-0x57, 0x05, 0x8a, 0x08, 0x05, 0x0b, 0x28, 0x0d, 0x5b, 0x0e, 0x37, 0x0e, 0x70, 0x0d, 0x0a, 0x0d, 
-0x9e, 0x0b, 0xcc, 0x09, 0xf9, 0x07, 0x39, 0x06, 0x3d, 0x04, 0xec, 0x01, 0xbf, 0x00, 0xc5, 0xff, 
-0xdb, 0xfe, 0x34, 0xfe, 0xb5, 0xfe, 0x3c, 0xff, 0x0b, 0xff, 0xea, 0xff, 0x1a, 0x00, 0xb4, 0xff, 
-0xae, 0xfe, 0x8d, 0xfd, 0x47, 0xfc, 0xfe, 0xf9, 0x3a, 0xf8, 0x63, 0xf6, 0xfd, 0xf4, 0xba, 0xf3, 
-0x95, 0xf2, 0xb9, 0xf2, 0xdc, 0xf3, 0x80, 0xf5, 0x61, 0xf7, 0xf4, 0xf9, 0x34, 0xfd, 0x84, 0x00, 
-0x9a, 0x03, 0xe2, 0x06, 0x19, 0x0a, 0x31, 0x0c, 0xa8, 0x0d, 0x65, 0x0e, 0x64, 0x0e, 0xba, 0x0d, 
-0x34, 0x0c, 0xbc, 0x0a, 0xc3, 0x08, 0x87, 0x06, 0xd5, 0x04, 0x51, 0x03, 0xbf, 0x01, 0x91, 0x00, 
-0x07, 0x00, 0xf1, 0xfe, 0x26, 0xfe, 0xc6, 0xfd, 0xc0, 0xfc, 0xde, 0xfb, 0x24, 0xfb, 0x93, 0xfa, 
-0xf6, 0xf9, 0x5d, 0xf9, 0xf0, 0xf8, 0x4f, 0xf8, 0x74, 0xf7, 0xc1, 0xf6, 0x00, 0xf6, 0x77, 0xf5, 
-0xdd, 0xf5, 0x50, 0xf6, 0xff, 0xf6, 0xf3, 0xf8, 0x4c, 0xfb, 0xa2, 0xfd, 0x92, 0x00, 0x8a, 0x03, 
-0x17, 0x06, 0x3f, 0x08, 0xcd, 0x09, 0xf0, 0x0a, 0xdc, 0x0b, 0xfc, 0x0b, 0xc2, 0x0b, 0x7d, 0x0b, 
-0x68, 0x0a, 0x36, 0x09, 0x17, 0x08, 0x7c, 0x06, 0xbb, 0x04, 0xd3, 0x02, 0x3a, 0x01, 0xc9, 0xff, 
-0x93, 0xfe, 0xaf, 0xfd, 0x07, 0xfd, 0xa9, 0xfc, 0x54, 0xfc, 0x65, 0xfc, 0xff, 0xfb, 0x69, 0xfb, 
-0x2a, 0xfb, 0xab, 0xfa, 0xfd, 0xf9, 0x46, 0xf9, 0xde, 0xf8, 0x26, 0xf8, 0x66, 0xf7, 0x67, 0xf7, 
-0x99, 0xf7, 0x15, 0xf8, 0x07, 0xf9, 0x8c, 0xfa, 0x42, 0xfc, 0x31, 0xfe, 0x47, 0x00, 0x1e, 0x02, 
-0xd1, 0x03, 0x24, 0x05, 0x5d, 0x06, 0x5c, 0x07, 0xfa, 0x07, 0x66, 0x08, 0x7b, 0x08, 0x57, 0x08, 
-0x2c, 0x08, 0xdc, 0x07, 0x2c, 0x07, 0x5a, 0x06, 0x7b, 0x05, 0x98, 0x04, 0xc9, 0x03, 0xde, 0x02, 
-0xfb, 0x01, 0x52, 0x01, 0x98, 0x00, 0xb3, 0xff, 0x0b, 0xff, 0x4c, 0xfe, 0x7f, 0xfd, 0x9a, 0xfc, 
-0x68, 0xfb, 0x57, 0xfa, 0x86, 0xf9, 0xa6, 0xf8, 0x0e, 0xf8, 0xd7, 0xf7, 0x95, 0xf7, 0x8a, 0xf7, 
-0xc1, 0xf7, 0x51, 0xf8, 0x20, 0xf9, 0x1d, 0xfa, 0x67, 0xfb, 0xca, 0xfc, 0x33, 0xfe, 0x9d, 0xff, 
-0x19, 0x01, 0x95, 0x02, 0xd0, 0x03, 0x14, 0x05, 0x03, 0x06, 0xbd, 0x06, 0x6b, 0x07, 0xaa, 0x07, 
-0xbb, 0x07, 0x9f, 0x07, 0x7d, 0x07, 0x4f, 0x07, 0x1c, 0x07, 0xbd, 0x06, 0x2e, 0x06, 0x89, 0x05, 
-0xbe, 0x04, 0xc1, 0x03, 0xa7, 0x02, 0x85, 0x01, 0x2c, 0x00, 0xc5, 0xfe, 0x5e, 0xfd, 0x0b, 0xfc, 
-0xf6, 0xfa, 0x19, 0xfa, 0x61, 0xf9, 0xe1, 0xf8, 0x85, 0xf8, 0x53, 0xf8, 0x4b, 0xf8, 0x3e, 0xf8, 
-0x4d, 0xf8, 0xa6, 0xf8, 0x2d, 0xf9, 0xc8, 0xf9, 0xa3, 0xfa, 0xc7, 0xfb, 0xfc, 0xfc, 0x40, 0xfe, 
-0x9b, 0xff, 0xc4, 0x00, 0xec, 0x01, 0x07, 0x03, 0xf3, 0x03, 0xc8, 0x04, 0x7c, 0x05, 0x26, 0x06, 
-0xa6, 0x06, 0x0e, 0x07, 0x7a, 0x07, 0xbf, 0x07, 0xc9, 0x07, 0xce, 0x07, 0x9c, 0x07, 0x19, 0x07, 
-0x5d, 0x06, 0x68, 0x05, 0x50, 0x04, 0xf2, 0x02, 0x81, 0x01, 0x0f, 0x00, 0x9c, 0xfe, 0x45, 0xfd, 
-0x0e, 0xfc, 0x0b, 0xfb, 0x29, 0xfa, 0x80, 0xf9, 0x1c, 0xf9, 0xd1, 0xf8, 0xa8, 0xf8, 0xbc, 0xf8, 
-0xd7, 0xf8, 0xfb, 0xf8, 0x47, 0xf9, 0xb8, 0xf9, 0x41, 0xfa, 0xe9, 0xfa, 0xbf, 0xfb, 0xa4, 0xfc, 
-0x9d, 0xfd, 0xbf, 0xfe, 0xe1, 0xff, 0x09, 0x01, 0x3b, 0x02, 0x5a, 0x03, 0x6d, 0x04, 0x68, 0x05, 
-0x3f, 0x06, 0xd6, 0x06, 0x4d, 0x07, 0xa9, 0x07, 0xd9, 0x07, 0xce, 0x07, 0xa5, 0x07, 0x6a, 0x07, 
-0xf6, 0x06, 0x4e, 0x06, 0x82, 0x05, 0x7d, 0x04, 0x4f, 0x03, 0x15, 0x02, 0xb5, 0x00, 0x4c, 0xff, 
-0xf4, 0xfd, 0xaf, 0xfc, 0x8e, 0xfb, 0x99, 0xfa, 0xcb, 0xf9, 0x48, 0xf9, 0xe4, 0xf8, 0xa0, 0xf8, 
-0x8c, 0xf8, 0x9e, 0xf8, 0xbe, 0xf8, 0xe2, 0xf8, 0x36, 0xf9, 0x96, 0xf9, 0x1b, 0xfa, 0xc9, 0xfa, 
-0x9f, 0xfb, 0xa8, 0xfc, 0xc4, 0xfd, 0x0e, 0xff, 0x69, 0x00, 0xa9, 0x01, 0xe6, 0x02, 0x0c, 0x04, 
-0x0b, 0x05, 0xe0, 0x05, 0x88, 0x06, 0x0a, 0x07, 0x51, 0x07, 0x92, 0x07, 0xb4, 0x07, 0x9b, 0x07, 
-0x79, 0x07, 0x1d, 0x07, 0xa0, 0x06, 0x01, 0x06, 0x27, 0x05, 0x25, 0x04, 0xe2, 0x02, 0x9b, 0x01, 
-0x3e, 0x00, 0xd4, 0xfe, 0x95, 0xfd, 0x63, 0xfc, 0x5b, 0xfb, 0x78, 0xfa, 0xcb, 0xf9, 0x60, 0xf9, 
-0x0e, 0xf9, 0xdd, 0xf8, 0xcb, 0xf8, 0xd7, 0xf8, 0xea, 0xf8, 0x13, 0xf9, 0x67, 0xf9, 0xde, 0xf9, 
-0x81, 0xfa, 0x55, 0xfb, 0x4f, 0xfc, 0x71, 0xfd, 0xaf, 0xfe, 0xf6, 0xff, 0x34, 0x01, 0x69, 0x02, 
-0x88, 0x03, 0x7f, 0x04, 0x52, 0x05, 0x09, 0x06, 0xa4, 0x06, 0x11, 0x07, 0x64, 0x07, 0xad, 0x07, 
-0xca, 0x07, 0xbd, 0x07, 0x9c, 0x07, 0x3d, 0x07, 0xb3, 0x06, 0xf1, 0x05, 0x0f, 0x05, 0xfc, 0x03, 
-0xb8, 0x02, 0x79, 0x01, 0x13, 0x00, 0xbd, 0xfe, 0x76, 0xfd, 0x44, 0xfc, 0x41, 0xfb, 0x5b, 0xfa, 
-0xb0, 0xf9, 0x33, 0xf9, 0xe1, 0xf8, 0xc3, 0xf8, 0xc1, 0xf8, 0xed, 0xf8, 0x2d, 0xf9, 0x7f, 0xf9, 
-0xea, 0xf9, 0x65, 0xfa, 0x0b, 0xfb, 0xb8, 0xfb, 0x83, 0xfc, 0x74, 0xfd, 0x6d, 0xfe, 0x7d, 0xff, 
-0x8d, 0x00, 0x9e, 0x01, 0xa1, 0x02, 0x8d, 0x03, 0x67, 0x04, 0x1b, 0x05, 0xb8, 0x05, 0x32, 0x06, 
-0x87, 0x06, 0xd2, 0x06, 0xee, 0x06, 0xed, 0x06, 0xcd, 0x06, 0x78, 0x06, 0x08, 0x06, 0x5d, 0x05, 
-0x9c, 0x04, 0xa7, 0x03, 0x98, 0x02, 0x81, 0x01, 0x46, 0x00, 0x1c, 0xff, 0xf8, 0xfd, 0xe9, 0xfc, 
-0xfb, 0xfb, 0x31, 0xfb, 0xa0, 0xfa, 0x2f, 0xfa, 0xe9, 0xf9, 0xd2, 0xf9, 0xd6, 0xf9, 0xfb, 0xf9, 
-0x39, 0xfa, 0x8d, 0xfa, 0xeb, 0xfa, 0x4d, 0xfb, 0xcf, 0xfb, 0x61, 0xfc, 0x01, 0xfd, 0xbe, 0xfd, 
-0x7f, 0xfe, 0x58, 0xff, 0x2e, 0x00, 0x0f, 0x01, 0xe9, 0x01, 0xa7, 0x02, 0x5d, 0x03, 0xf4, 0x03, 
-0x7c, 0x04, 0xdc, 0x04, 0x24, 0x05, 0x5a, 0x05, 0x79, 0x05, 0x88, 0x05, 0x76, 0x05, 0x49, 0x05, 
-0x01, 0x05, 0x9c, 0x04, 0x15, 0x04, 0x6c, 0x03, 0xad, 0x02, 0xd3, 0x01, 0xec, 0x00, 0xf2, 0xff, 
-0xf8, 0xfe, 0x04, 0xfe, 0x28, 0xfd, 0x67, 0xfc, 0xbf, 0xfb, 0x46, 0xfb, 0xf4, 0xfa, 0xc6, 0xfa, 
-0xc3, 0xfa, 0xe2, 0xfa, 0x1c, 0xfb, 0x65, 0xfb, 0xc3, 0xfb, 0x25, 0xfc, 0x9b, 0xfc, 0x18, 0xfd, 
-0x95, 0xfd, 0x22, 0xfe, 0xa7, 0xfe, 0x42, 0xff, 0xd2, 0xff, 0x68, 0x00, 0xf6, 0x00, 0x77, 0x01, 
-0xf6, 0x01, 0x5a, 0x02, 0xce, 0x02, 0x2b, 0x03, 0x74, 0x03, 0xbb, 0x03, 0xeb, 0x03, 0x04, 0x04, 
-0x16, 0x04, 0x00, 0x04, 0xc2, 0x03, 0x89, 0x03, 0x26, 0x03, 0xc4, 0x02, 0x35, 0x02, 0x92, 0x01, 
-0x16, 0x01, 0x2e, 0x00, 0x97, 0xff, 0x0f, 0xff, 0x6b, 0xfe, 0xe9, 0xfd, 0x6c, 0xfd, 0x18, 0xfd, 
-0xf4, 0xfc, 0xc4, 0xfc, 0xc0, 0xfc, 0xf7, 0xfc, 0x11, 0xfd, 0x56, 0xfd, 0x91, 0xfd, 0xe6, 0xfd, 
-0x74, 0xfe, 0xe6, 0xfe, 0xd4, 0xfe, 0xa0, 0xff, 0xc2, 0xff, 0x22, 0x00, 0x96, 0x00, 0xe0, 0x00, 
-0x1a, 0x01, 0x32, 0x01, 0x40, 0x01, 0x8b, 0x01, 0x7f, 0x01, 0x43, 0x01, 0xc8, 0x01, 0x14, 0x01, 
-0x76, 0x01, 0x35, 0x01, 0x2e, 0x01, 0xd2, 0x00, 0xe3, 0x00, 0x07, 0x01, 0x8e, 0x00, 0xae, 0x00, 
-0x2f, 0x01, 0xf2, 0xff, 0x5e, 0x01, 0xf6, 0xff, 0x68, 0x00, 0x88, 0x00, 0x5f, 0xff, 0xde, 0x00, 
-0xe6, 0xfe, 0x66, 0x00, 0xd1, 0xfe, 0x7f, 0x00, 0x20, 0xfe, 0x91, 0x00, 0x6f, 0xfe, 0xb2, 0xfe, 
-0x43, 0x00, 0xbd, 0xfc, 0x53, 0x02, 0x42, 0xfb, 0x8f, 0x01, 0x75, 0xfe, 0x81, 0xfe, 0x0a, 0x01, 
-0xea, 0xfd, 0x77, 0x01, 0x5e, 0xfe, 0x91, 0x01, 0x01, 0xff, 0xf5, 0x01, 0x12, 0xff, 0x87, 0x02, 
-0x51, 0xff, 0xb9, 0x02, 0xf1, 0xff, 0xec, 0x01, 0x8d, 0x01, 0x06, 0x01, 0xc8, 0x01, 0xdc, 0x00, 
-0xdd, 0x00, 0x5f, 0x01, 0x07, 0x01, 0x23, 0xff, 0xe5, 0x03, 0x51, 0xfc, 0x61, 0x04, 0x4b, 0xfc, 
-0xd4, 0x01, 0x05, 0xff, 0x57, 0xfe, 0xba, 0x00, 0x3f, 0xfd, 0xf7, 0xff, 0xd1, 0xfe, 0xd2, 0xfe, 
-0xd4, 0xfe, 0x7d, 0xfe, 0xce, 0xff, 0x01, 0xfd, 0xe2, 0xff, 0x1c, 0x00, 0x5c, 0xfd, 0xf7, 0x00, 
-0xd3, 0xfd, 0xa7, 0x01, 0x0c, 0xfe, 0x77, 0x00, 0xdc, 0x00, 0xe8, 0xff, 0xd8, 0x00, 0x12, 0x00, 
-0xab, 0x01, 0x37, 0xff, 0x56, 0x02, 0x6c, 0x00, 0xb7, 0x00, 0x02, 0x04, 0x6f, 0xfc, 0x99, 0x05, 
-0xd6, 0xfd, 0x0b, 0x02, 0x77, 0xff, 0xbd, 0x00, 0xe4, 0x00, 0x1d, 0xff, 0x3e, 0x01, 0x04, 0xfd, 
-0x3f, 0x02, 0x27, 0xfd, 0xe6, 0x00, 0xf3, 0xfe, 0x9e, 0xfd, 0x60, 0xff, 0xcc, 0x01, 0x8d, 0xf9, 
-0x67, 0x05, 0xbc, 0xfa, 0x8e, 0x01, 0x99, 0x00, 0x2f, 0xff, 0x49, 0x05, 0x45, 0x03, 0xb9, 0x00, 
-0x52, 0x05, 0x91, 0xfa, 0x4f, 0xfd, 0x7f, 0x00, 0x9f, 0xf6, 0xbb, 0x07, 0x5a, 0xf7, 0x69, 0x02, 
-0x63, 0x00, 0xfe, 0xfa, 0x82, 0x04, 0x95, 0xfd, 0x37, 0x00, 0x24, 0x05, 0x05, 0xfa, 0x2d, 0x08, 
-0x04, 0xfe, 0x48, 0x00, 0x75, 0x04, 0x90, 0xfc, 0xcf, 0x04, 0x86, 0xfc, 0xab, 0x00, 0xbf, 0x00, 
-0xd7, 0xfc, 0x51, 0x01, 0x69, 0xfe, 0xed, 0xfe, 0x45, 0x01, 0xf6, 0xff, 0xbb, 0x07, 0x2f, 0x00, 
-0xaa, 0x02, 0x52, 0xfc, 0xa6, 0xfd, 0x16, 0xfe, 0x63, 0xfb, 0x97, 0x02, 0x02, 0xf9, 0x77, 0xff, 
-0x5c, 0x00, 0x1e, 0xfa, 0x44, 0x03, 0x30, 0xfd, 0x8f, 0xfe, 0xe3, 0x03, 0x54, 0xfa, 0x63, 0x07, 
-0x11, 0xfc, 0x71, 0xff, 0x2a, 0x06, 0xbf, 0xf9, 0x5a, 0x05, 0x2c, 0xfe, 0x8d, 0xff, 0xf7, 0x03, 
-0x0a, 0xfa, 0x22, 0x05, 0xec, 0xfe, 0x0e, 0xfb, 0xe8, 0x07, 0x1b, 0xfa, 0x2c, 0x02, 0xd9, 0x02, 
-0x4b, 0xfe, 0x12, 0x03, 0xe4, 0xfd, 0x54, 0x02, 0x7b, 0x00, 0x8a, 0xfd, 0xaa, 0x03, 0xd4, 0xfd, 
-0x4c, 0x00, 0x14, 0x02, 0xd7, 0xfd, 0xb8, 0x00, 0x95, 0xff, 0x66, 0x00, 0x19, 0xff, 0xa5, 0xff, 
-0x0b, 0x01, 0x7a, 0xfe, 0xe1, 0xfe, 0xa3, 0xff, 0x35, 0xff, 0x7e, 0xff, 0xf7, 0xfd, 0x62, 0x01, 
-0xa2, 0xff, 0x97, 0xfe, 0x1a, 0x02, 0xff, 0xff, 0x5d, 0x01, 0xc6, 0x00, 0xd5, 0xff, 0x8d, 0x04, 
-0xc9, 0xff, 0x65, 0x01, 0x07, 0x04, 0x65, 0xfe, 0xa2, 0x02, 0x12, 0x01, 0x58, 0x00, 0x87, 0x00, 
-0x9e, 0x01, 0xb3, 0xff, 0x5f, 0xff, 0x6e, 0x02, 0x28, 0x00, 0x65, 0xfe, 0x7e, 0x01, 0x34, 0xfe, 
-0xcc, 0xfe, 0xe1, 0xfe, 0xda, 0xfb, 0x45, 0xff, 0x81, 0xfa, 0x41, 0xfc, 0x3d, 0xfd, 0xdf, 0xf9, 
-0xc5, 0xfd, 0xe7, 0xfc, 0x7a, 0xfc, 0x46, 0x01, 0x25, 0xfd, 0x86, 0x02, 0x5c, 0x01, 0xcc, 0x00, 
-0x2e, 0x07, 0xcb, 0x00, 0xae, 0x04, 0x14, 0x09, 0xa3, 0x00, 0x79, 0x09, 0x52, 0x02, 0xa9, 0x05, 
-0x19, 0x07, 0xd0, 0xfe, 0xfb, 0x07, 0x06, 0x01, 0xcd, 0x01, 0xe2, 0x02, 0x5b, 0xfe, 0x04, 0x01, 
-0xa6, 0xfc, 0x4f, 0xfc, 0x63, 0xfc, 0x24, 0xf5, 0xaf, 0xfc, 0xa0, 0xf3, 0xe2, 0xf3, 0xaa, 0xf4, 
-0xaf, 0xf2, 0x25, 0xf6, 0xdb, 0xf4, 0xa1, 0xf8, 0x45, 0xff, 0x69, 0xfc, 0xa6, 0x01, 0x76, 0x08, 
-0x67, 0x06, 0x9f, 0x08, 0x94, 0x0d, 0xc6, 0x0c, 0x93, 0x0a, 0x20, 0x0e, 0xcc, 0x0b, 0x6d, 0x0a, 
-0xc2, 0x08, 0x67, 0x06, 0x31, 0x07, 0xbe, 0x02, 0x83, 0x02, 0x69, 0x04, 0xc4, 0xfe, 0xa7, 0x02, 
-0x8b, 0xfe, 0x48, 0xfe, 0x23, 0xfd, 0x83, 0xfd, 0xde, 0xf6, 0xc8, 0xf8, 0xa4, 0xf7, 0x5d, 0xee, 
-0xe7, 0xf0, 0xe3, 0xec, 0x09, 0xec, 0x7e, 0xf2, 0x43, 0xec, 0xc3, 0xf8, 0xf9, 0xf9, 0xec, 0xfa, 
-0x21, 0x08, 0x87, 0x03, 0xb4, 0x0c, 0xfc, 0x0e, 0x25, 0x0d, 0xd0, 0x13, 0x32, 0x0e, 0x46, 0x0d, 
-0x88, 0x0e, 0x00, 0x06, 0xec, 0x08, 0x78, 0x03, 0xb6, 0x00, 0x93, 0x01, 0xac, 0xff, 0xd3, 0xff, 
-0x2f, 0x02, 0xfe, 0xff, 0x2e, 0x03, 0xcd, 0x04, 0x50, 0x02, 0x68, 0x01, 0xd2, 0xff, 0x23, 0xfd, 
-0xf4, 0xf7, 0x88, 0xf0, 0x21, 0xf1, 0xcb, 0xe8, 0x98, 0xe6, 0x85, 0xeb, 0xc0, 0xea, 0xb9, 0xf1, 
-0x85, 0xf5, 0x49, 0xfd, 0xd6, 0x03, 0xb1, 0x07, 0x3f, 0x0e, 0x00, 0x12, 0x5e, 0x13, 0x07, 0x15, 
-0x07, 0x13, 0xd0, 0x10, 0x67, 0x0d, 0xa5, 0x08, 0x0b, 0x05, 0x6c, 0x02, 0x2d, 0xfd, 0xf9, 0xfc, 
-0xe7, 0xfc, 0x11, 0xfc, 0x33, 0xfe, 0x4a, 0x00, 0xd1, 0x03, 0xc3, 0x05, 0x21, 0x05, 0x16, 0x08, 
-0xd9, 0x06, 0x88, 0x00, 0xbd, 0xfe, 0xb0, 0xf9, 0x4d, 0xee, 0x59, 0xec, 0x47, 0xe4, 0xb6, 0xe0, 
-0xbe, 0xe7, 0xa8, 0xe5, 0x37, 0xee, 0x6d, 0xf8, 0x8a, 0xfb, 0x86, 0x07, 0xd6, 0x0e, 0xe4, 0x11, 
-0xfb, 0x1a, 0xf0, 0x19, 0x89, 0x19, 0x48, 0x18, 0x8d, 0x10, 0xb7, 0x0c, 0xc9, 0x05, 0x30, 0xff, 
-0x67, 0xfd, 0x77, 0xf8, 0x31, 0xf7, 0x8b, 0xf9, 0xea, 0xfa, 0x10, 0xfd, 0x84, 0x02, 0xb4, 0x05, 
-0xfa, 0x08, 0x3e, 0x0a, 0x78, 0x09, 0xf3, 0x07, 0x2d, 0x01, 0x13, 0xfc, 0xae, 0xf2, 0x70, 0xea, 
-0x9f, 0xe4, 0x1e, 0xdc, 0x7a, 0xdd, 0x92, 0xe2, 0xd0, 0xe6, 0x6d, 0xf1, 0x35, 0xfb, 0xec, 0x05, 
-0x27, 0x11, 0x34, 0x16, 0x31, 0x1e, 0x6a, 0x20, 0x8f, 0x1d, 0xfe, 0x1c, 0xfa, 0x14, 0xc3, 0x0c, 
-0xb9, 0x06, 0x09, 0x00, 0x4c, 0xf9, 0x2e, 0xf7, 0x93, 0xf6, 0xc2, 0xf7, 0x6d, 0xf9, 0x79, 0x00, 
-0x4e, 0x05, 0x2d, 0x09, 0xe1, 0x0d, 0xb1, 0x0e, 0x75, 0x0e, 0x50, 0x0a, 0xfd, 0x04, 0x7c, 0xfd, 
-0xb2, 0xf5, 0x21, 0xeb, 0xf7, 0xe0, 0x26, 0xdb, 0xa1, 0xd5, 0x41, 0xd7, 0xd8, 0xe1, 0x67, 0xe7, 
-0x19, 0xf5, 0xf2, 0x04, 0xba, 0x0d, 0x9b, 0x18, 0x01, 0x21, 0xe1, 0x22, 0x11, 0x21, 0xd3, 0x1b, 
-0x16, 0x17, 0xa8, 0x0b, 0x79, 0x01, 0x81, 0xfc, 0x4e, 0xf5, 0x74, 0xf1, 0xf0, 0xf2, 0xd6, 0xf5, 
-0x30, 0xfa, 0x58, 0x01, 0xde, 0x06, 0xb5, 0x0d, 0x0a, 0x12, 0x4e, 0x13, 0x65, 0x13, 0x68, 0x0f, 
-0xa5, 0x08, 0x76, 0x03, 0xba, 0xfa, 0xf9, 0xf1, 0xec, 0xe8, 0xb6, 0xdf, 0x98, 0xd8, 0xf7, 0xd3, 
-0xa4, 0xd8, 0x9a, 0xe1, 0xee, 0xea, 0xdf, 0xfb, 0x03, 0x09, 0x5f, 0x14, 0xba, 0x1e, 0x93, 0x21, 
-0x70, 0x22, 0x35, 0x1f, 0xe3, 0x16, 0x2e, 0x0f, 0xb9, 0x04, 0x98, 0xfb, 0x2b, 0xf7, 0xb4, 0xf0, 
-0xe9, 0xef, 0x10, 0xf4, 0xeb, 0xf7, 0xd7, 0xfe, 0x02, 0x07, 0xb6, 0x0d, 0x20, 0x13, 0x1b, 0x16, 
-0xbe, 0x15, 0xb0, 0x12, 0xb0, 0x0c, 0xd7, 0x04, 0x5b, 0xfd, 0xed, 0xf5, 0x52, 0xef, 0x5e, 0xe8, 
-0x0b, 0xe3, 0x1b, 0xde, 0x54, 0xd7, 0xf1, 0xd9, 0xe6, 0xe4, 0xc7, 0xea, 0x48, 0xfa, 0x10, 0x0b, 
-0xaf, 0x11, 0x14, 0x1b, 0x97, 0x20, 0xf4, 0x1d, 0xc1, 0x19, 0xd6, 0x11, 0x69, 0x09, 0x54, 0x00, 
-0xe0, 0xf7, 0x5f, 0xf4, 0x29, 0xf3, 0x26, 0xf3, 0x75, 0xf7, 0xfe, 0xfd, 0x45, 0x05, 0x57, 0x0b, 
-0x0d, 0x11, 0xf9, 0x14, 0xe0, 0x14, 0x2d, 0x13, 0x4e, 0x0f, 0xad, 0x09, 0xa9, 0x01, 0x4e, 0xfc, 
-0x81, 0xf8, 0x7f, 0xf2, 0x9c, 0xed, 0x7e, 0xec, 0x27, 0xe7, 0x36, 0xe0, 0x04, 0xdf, 0xf8, 0xe0, 
-0x3d, 0xeb, 0x06, 0xf7, 0x5e, 0xfe, 0x3e, 0x0c, 0x4f, 0x15, 0x1f, 0x16, 0xc8, 0x17, 0x1f, 0x17, 
-0x60, 0x10, 0x50, 0x09, 0x92, 0x02, 0x05, 0xfc, 0x74, 0xf8, 0xdf, 0xf5, 0xeb, 0xf7, 0x90, 0xfb, 
-0x0b, 0xff, 0xa8, 0x05, 0x80, 0x0c, 0xe7, 0x0f, 0xd4, 0x10, 0x44, 0x12, 0x09, 0x12, 0x3e, 0x0d, 
-0x47, 0x08, 0xb3, 0x03, 0x41, 0xfe, 0xe5, 0xfa, 0xa2, 0xf7, 0xbb, 0xf4, 0x73, 0xf2, 0xc8, 0xf1, 
-0xcc, 0xee, 0xa9, 0xe8, 0xf9, 0xe2, 0x68, 0xe0, 0x19, 0xe7, 0xa2, 0xef, 0xf0, 0xf7, 0xd1, 0x03, 
-0x62, 0x0d, 0xd6, 0x12, 0xc8, 0x16, 0xa8, 0x15, 0x0d, 0x13, 0x11, 0x0d, 0x82, 0x05, 0xb9, 0x01, 
-0x36, 0xfb, 0x56, 0xf8, 0x2c, 0xf8, 0xe1, 0xf9, 0xf4, 0xff, 0xf3, 0x04, 0xc8, 0x09, 0xfe, 0x0d, 
-0xaf, 0x0f, 0x04, 0x0f, 0xbc, 0x0d, 0x5b, 0x0c, 0xb7, 0x08, 0xdb, 0x03, 0x36, 0x01, 0xff, 0xfe, 
-0x9e, 0xfb, 0x17, 0xfb, 0xe9, 0xfa, 0x56, 0xf7, 0x6b, 0xf5, 0xa6, 0xf0, 0x35, 0xe9, 0x8c, 0xe1, 
-0x5d, 0xe0, 0x43, 0xe5, 0x17, 0xee, 0xdf, 0xfa, 0x0a, 0x01, 0x3e, 0x0c, 0xf5, 0x16, 0x5c, 0x14, 
-0x11, 0x14, 0x8e, 0x14, 0x84, 0x0a, 0x3c, 0x00, 0x71, 0xfc, 0x4c, 0xfa, 0xa4, 0xf8, 0x36, 0xf9, 
-0x0b, 0xfd, 0x42, 0x01, 0xa5, 0x04, 0xf5, 0x09, 0x0d, 0x0d, 0xdd, 0x0d, 0xf9, 0x0d, 0x16, 0x0c, 
-0xf1, 0x09, 0x7c, 0x07, 0xba, 0x03, 0xf1, 0xff, 0xe1, 0xff, 0x7b, 0x00, 0x45, 0xfe, 0xf0, 0xfc, 
-0x81, 0xfb, 0x78, 0xf7, 0x52, 0xf2, 0x53, 0xeb, 0xf1, 0xde, 0x68, 0xdb, 0x77, 0xdf, 0x83, 0xe8, 
-0x4c, 0xf9, 0x06, 0x04, 0x1a, 0x0f, 0x2d, 0x1b, 0x30, 0x1c, 0x0c, 0x16, 0xfd, 0x13, 0x9c, 0x0c, 
-0x38, 0x01, 0xba, 0xfa, 0xe4, 0xf6, 0x05, 0xf6, 0xf1, 0xf6, 0x84, 0xf9, 0xcc, 0x01, 0xb3, 0x0a, 
-0x10, 0x0c, 0x64, 0x0e, 0x64, 0x11, 0xd4, 0x0e, 0x28, 0x0b, 0x6c, 0x07, 0xcb, 0x02, 0x50, 0x00, 
-0xbd, 0xfc, 0x67, 0xfb, 0xde, 0xff, 0x5e, 0x01, 0x45, 0x00, 0x07, 0xfd, 0x91, 0xf6, 0x2d, 0xf2, 
-0x01, 0xec, 0x4f, 0xe4, 0x47, 0xdd, 0xe3, 0xdd, 0x8c, 0xe7, 0x98, 0xf4, 0xa3, 0x03, 0x51, 0x0f, 
-0xc2, 0x18, 0xc3, 0x1d, 0x98, 0x19, 0x6c, 0x12, 0xaf, 0x0a, 0xaa, 0xff, 0x1f, 0xf7, 0x3a, 0xf3, 
-0x2f, 0xf4, 0x87, 0xf7, 0x55, 0xfc, 0xd6, 0x03, 0xe1, 0x09, 0x94, 0x10, 0x1e, 0x11, 0xee, 0x0d, 
-0x1d, 0x10, 0x75, 0x0b, 0xc4, 0x05, 0x36, 0x03, 0x04, 0xff, 0x58, 0xfd, 0x5d, 0xfc, 0x7e, 0xff, 
-0xba, 0x03, 0x87, 0x05, 0x76, 0x03, 0xf6, 0xff, 0x4e, 0xf9, 0xe2, 0xf0, 0xc6, 0xea, 0x04, 0xe4, 
-0x40, 0xda, 0x7c, 0xd8, 0x8a, 0xe7, 0xd6, 0xf4, 0x83, 0x03, 0xd6, 0x10, 0xad, 0x15, 0xdf, 0x1a, 
-0xf8, 0x19, 0x96, 0x0e, 0xfd, 0x07, 0x6c, 0x02, 0x3d, 0xf7, 0xf8, 0xf3, 0x71, 0xf5, 0xd2, 0xf6, 
-0x23, 0xfe, 0xda, 0x04, 0xc0, 0x0a, 0x15, 0x11, 0xd0, 0x12, 0x46, 0x0f, 0x77, 0x0b, 0x1e, 0x08, 
-0x37, 0x02, 0x35, 0xff, 0xc1, 0xfd, 0xfe, 0xfd, 0x93, 0xff, 0xcf, 0x03, 0x9b, 0x07, 0xe3, 0x06, 
-0x4c, 0x06, 0x4d, 0x02, 0xb5, 0xfb, 0xa9, 0xf4, 0x47, 0xf1, 0x40, 0xec, 0x1b, 0xe7, 0x41, 0xdf, 
-0xf2, 0xd4, 0xb8, 0xe2, 0x6d, 0xf7, 0x7c, 0x03, 0xe3, 0x10, 0x2f, 0x1a, 0x97, 0x1f, 0x4e, 0x1b, 
-0xae, 0x0b, 0xde, 0x03, 0x31, 0xfe, 0xf7, 0xf2, 0xda, 0xee, 0x8b, 0xf4, 0x0d, 0xff, 0xb0, 0x05, 
-0x3e, 0x09, 0x38, 0x0f, 0x39, 0x11, 0x52, 0x10, 0x6f, 0x0b, 0x3e, 0x06, 0xe9, 0x02, 0x2d, 0xfc, 
-0xcd, 0xfb, 0x9a, 0xfe, 0x58, 0x02, 0x28, 0x05, 0xaa, 0x04, 0xb2, 0x08, 0x7d, 0x0a, 0x03, 0x04, 
-0x58, 0xff, 0x4b, 0xfd, 0x8a, 0xf6, 0x67, 0xef, 0xec, 0xed, 0x62, 0xee, 0x3e, 0xe9, 0x14, 0xde, 
-0xe2, 0xdb, 0x94, 0xea, 0x28, 0x00, 0x7c, 0x0c, 0xd1, 0x10, 0xfb, 0x1b, 0x1a, 0x1e, 0x6d, 0x12, 
-0x6f, 0x05, 0x74, 0xfd, 0x84, 0xf8, 0xfa, 0xf2, 0x8c, 0xf1, 0xb5, 0xf9, 0xba, 0x05, 0x9e, 0x09, 
-0x09, 0x0b, 0xe1, 0x0f, 0x58, 0x11, 0x6e, 0x0c, 0x9a, 0x05, 0x58, 0x00, 0x6a, 0xfd, 0x4d, 0xfc, 
-0x0a, 0xfe, 0x27, 0x01, 0x1f, 0x07, 0x7f, 0x09, 0xfe, 0x08, 0xd8, 0x07, 0x2b, 0x03, 0x54, 0x00, 
-0x30, 0xfd, 0xaf, 0xfa, 0xfd, 0xf8, 0x28, 0xf7, 0xaa, 0xf3, 0xed, 0xf1, 0x89, 0xed, 0x9b, 0xe6, 
-0xcf, 0xdf, 0x56, 0xe2, 0x68, 0xf0, 0xd7, 0xfe, 0x7c, 0x0b, 0x58, 0x12, 0xbe, 0x1a, 0x2e, 0x1b, 
-0xb9, 0x10, 0x36, 0x08, 0x72, 0x00, 0xcb, 0xf6, 0x86, 0xf1, 0x36, 0xf2, 0xc5, 0xf9, 0xed, 0x02, 
-0x26, 0x0a, 0x77, 0x0d, 0x88, 0x0f, 0x02, 0x0f, 0x25, 0x09, 0x13, 0x04, 0xe6, 0x00, 0x8b, 0x00, 
-0xca, 0xff, 0x7b, 0xfe, 0x1a, 0x01, 0xcd, 0x07, 0xaa, 0x09, 0xfa, 0x08, 0x7e, 0x0a, 0x60, 0x06, 
-0xd4, 0xfe, 0xc9, 0xf9, 0x18, 0xf7, 0x9b, 0xf6, 0xca, 0xf6, 0x3d, 0xf6, 0x33, 0xf4, 0x20, 0xf2, 
-0x7c, 0xef, 0xc9, 0xe8, 0x0d, 0xe4, 0x99, 0xe9, 0xa9, 0xf8, 0x09, 0x09, 0x3f, 0x0e, 0xeb, 0x11, 
-0x46, 0x19, 0x44, 0x14, 0xcd, 0x06, 0x34, 0xfe, 0xce, 0xf8, 0x91, 0xf5, 0xfb, 0xf2, 0xe2, 0xf2, 
-0x3b, 0xfc, 0xa0, 0x06, 0xcb, 0x0a, 0x30, 0x0c, 0x26, 0x0f, 0x46, 0x0f, 0x74, 0x0a, 0x39, 0x03, 
-0x69, 0xff, 0xd8, 0x00, 0x66, 0x02, 0x52, 0x02, 0x50, 0x02, 0x1f, 0x06, 0xc5, 0x07, 0xef, 0x06, 
-0x52, 0x06, 0x65, 0x05, 0x27, 0x02, 0xe5, 0xfb, 0x5f, 0xf6, 0x70, 0xf4, 0xdf, 0xf5, 0x52, 0xf6, 
-0x58, 0xf5, 0xa8, 0xf9, 0x95, 0xf5, 0x98, 0xe7, 0xd1, 0xe2, 0x5c, 0xe8, 0xdd, 0xf5, 0xa6, 0x05, 
-0xe7, 0x0e, 0x95, 0x14, 0xd2, 0x17, 0xc4, 0x10, 0xee, 0x05, 0xaf, 0xfc, 0xd1, 0xf5, 0x99, 0xf4, 
-0x7e, 0xf6, 0x2e, 0xf8, 0xda, 0xfe, 0x27, 0x08, 0x7e, 0x0c, 0x49, 0x0f, 0x92, 0x0e, 0xa0, 0x0a, 
-0x78, 0x06, 0xa2, 0x03, 0x54, 0x02, 0x62, 0x01, 0x6a, 0x00, 0xde, 0x01, 0xcd, 0x03, 0x3c, 0x05, 
-0xc1, 0x07, 0xac, 0x07, 0x3b, 0x07, 0x3e, 0x06, 0x61, 0x01, 0x2e, 0xfc, 0x36, 0xfb, 0x6a, 0xfa, 
-0x1e, 0xf9, 0x68, 0xf8, 0x4e, 0xf8, 0x55, 0xf7, 0xa0, 0xf2, 0xfb, 0xea, 0x4a, 0xe8, 0x99, 0xe6, 
-0x8d, 0xe5, 0x8e, 0xf1, 0xfa, 0x04, 0x2f, 0x10, 0x1d, 0x13, 0x17, 0x14, 0x18, 0x11, 0xcd, 0x0a, 
-0x04, 0x00, 0x35, 0xf6, 0x0b, 0xf4, 0xe0, 0xf4, 0x47, 0xf6, 0xf5, 0xfc, 0xaa, 0x08, 0x80, 0x11, 
-0xd0, 0x12, 0xe5, 0x0d, 0x30, 0x0b, 0xe7, 0x0a, 0x74, 0x04, 0x46, 0xfc, 0xab, 0xfa, 0x4c, 0xfe, 
-0x2c, 0x02, 0x83, 0x05, 0x70, 0x08, 0xf5, 0x0c, 0xb0, 0x0d, 0xb5, 0x06, 0x30, 0x02, 0x90, 0xff, 
-0xa0, 0xfb, 0x0f, 0xfb, 0x24, 0xfa, 0x83, 0xf8, 0xc7, 0xfa, 0x0b, 0xfc, 0xdb, 0xf8, 0xda, 0xf7, 
-0x9d, 0xf6, 0x3e, 0xf1, 0x7d, 0xec, 0xab, 0xe7, 0x53, 0xe5, 0xd6, 0xef, 0x54, 0x02, 0x16, 0x10, 
-0x47, 0x13, 0x26, 0x10, 0x42, 0x0e, 0x3f, 0x09, 0xcd, 0xfe, 0x97, 0xf4, 0x87, 0xf2, 0xe8, 0xf5, 
-0x38, 0xfa, 0xaf, 0xff, 0xbe, 0x08, 0x0e, 0x12, 0x42, 0x12, 0x16, 0x0c, 0x69, 0x09, 0xe9, 0x07, 
-0x0e, 0x02, 0x57, 0xfd, 0xa6, 0xfc, 0xad, 0xfd, 0x05, 0x00, 0x40, 0x05, 0x8d, 0x0a, 0xb0, 0x0e, 
-0xf5, 0x0e, 0x4e, 0x09, 0xd7, 0x01, 0x8d, 0xfd, 0x97, 0xfc, 0x7f, 0xfa, 0xc2, 0xf8, 0x1d, 0xf9, 
-0x4a, 0xf9, 0x9a, 0xf9, 0x09, 0xfa, 0x62, 0xfb, 0x95, 0xfc, 0x00, 0xf7, 0xeb, 0xf0, 0xd3, 0xed, 
-0xac, 0xe8, 0x14, 0xe5, 0xf7, 0xed, 0x44, 0x02, 0x28, 0x0f, 0xbb, 0x12, 0x88, 0x12, 0x1f, 0x0f, 
-0xb5, 0x09, 0x89, 0xff, 0x71, 0xf4, 0x90, 0xf3, 0x14, 0xfa, 0xe1, 0xfc, 0x57, 0x00, 0x5a, 0x07, 
-0x38, 0x0d, 0x63, 0x0f, 0x2a, 0x0d, 0x8e, 0x09, 0xe9, 0x05, 0xf9, 0x00, 0xf8, 0xfa, 0x1f, 0xf9, 
-0x53, 0xfe, 0xd7, 0x06, 0x90, 0x0a, 0x79, 0x0a, 0x65, 0x0a, 0x52, 0x09, 0xf4, 0x04, 0xfa, 0x00, 
-0xd2, 0xfc, 0x3a, 0xf8, 0x01, 0xfa, 0xcb, 0xfd, 0x17, 0xff, 0x67, 0x01, 0x8d, 0x00, 0xa9, 0xfc, 
-0xa2, 0xf9, 0x01, 0xf6, 0x39, 0xf5, 0x06, 0xf4, 0xbf, 0xf0, 0x8c, 0xf0, 0x27, 0xec, 0xfb, 0xe3, 
-0xfd, 0xec, 0x55, 0x05, 0x41, 0x15, 0x80, 0x13, 0x1a, 0x0c, 0x57, 0x09, 0x13, 0x0a, 0xff, 0x01, 
-0x37, 0xf5, 0x7d, 0xf4, 0x57, 0xfb, 0x83, 0xff, 0x59, 0x02, 0x31, 0x06, 0x80, 0x0a, 0xf0, 0x0d, 
-0x7c, 0x0e, 0x21, 0x0c, 0x4c, 0x08, 0x2c, 0x03, 0x14, 0xfe, 0x48, 0xfb, 0x1c, 0xfc, 0x2f, 0x02, 
-0x60, 0x08, 0x35, 0x09, 0x22, 0x07, 0xd3, 0x07, 0x31, 0x08, 0x02, 0x03, 0xcf, 0xfc, 0xe3, 0xfa, 
-0x04, 0xff, 0x6f, 0x02, 0xcd, 0xff, 0xfe, 0xfd, 0x31, 0xfe, 0x96, 0xfc, 0x3f, 0xf9, 0x80, 0xf6, 
-0x8d, 0xf6, 0x8b, 0xf7, 0x51, 0xf5, 0x11, 0xf3, 0xcd, 0xf2, 0x63, 0xed, 0x68, 0xe4, 0xea, 0xec, 
-0x7f, 0x03, 0xce, 0x0e, 0xa0, 0x10, 0xf7, 0x0e, 0x51, 0x0a, 0xfa, 0x07, 0x65, 0x02, 0xe3, 0xf6, 
-0xd1, 0xf4, 0x23, 0xfa, 0x70, 0xfd, 0x9b, 0x02, 0x18, 0x06, 0xc7, 0x08, 0xaf, 0x0e, 0x7c, 0x0e, 
-0xe4, 0x07, 0xd6, 0x04, 0x12, 0x03, 0x74, 0xff, 0x5a, 0xfc, 0x26, 0xfc, 0xad, 0x03, 0x83, 0x0b, 
-0x4d, 0x0a, 0x33, 0x08, 0xe9, 0x08, 0x12, 0x08, 0x36, 0x05, 0x9c, 0xff, 0x7c, 0xfb, 0x34, 0xfe, 
-0xb0, 0x01, 0xa4, 0x00, 0x43, 0xfd, 0x2c, 0xfc, 0x40, 0xfd, 0x75, 0xfb, 0x5d, 0xf7, 0x7e, 0xf4, 
-0x32, 0xf6, 0xcf, 0xf9, 0x11, 0xf8, 0xe6, 0xef, 0xca, 0xe5, 0x3b, 0xe1, 0x0c, 0xec, 0x96, 0xff, 
-0xfb, 0x0b, 0x8c, 0x0f, 0xeb, 0x10, 0x33, 0x11, 0x3c, 0x0c, 0xc6, 0x02, 0x93, 0xf7, 0x88, 0xf2, 
-0x40, 0xf8, 0xea, 0xfe, 0xca, 0x01, 0x19, 0x06, 0x28, 0x0b, 0x7a, 0x0e, 0xe0, 0x0e, 0x9e, 0x0a, 
-0x49, 0x05, 0x5e, 0x01, 0x72, 0xfe, 0x23, 0xfd, 0x3a, 0xfe, 0xae, 0x00, 0xf6, 0x05, 0xe8, 0x0b, 
-0xef, 0x0d, 0xb4, 0x0c, 0x9b, 0x08, 0xe8, 0x03, 0x37, 0xfe, 0x36, 0xf8, 0xb3, 0xf7, 0xd2, 0xfd, 
-0xe6, 0x01, 0xa8, 0x01, 0xcf, 0x00, 0xfa, 0xfe, 0x1e, 0xfc, 0xb8, 0xf8, 0xee, 0xf7, 0x3c, 0xf7, 
-0x59, 0xf4, 0xb0, 0xf2, 0x84, 0xf3, 0x69, 0xf2, 0x7d, 0xec, 0x24, 0xe4, 0xce, 0xe8, 0x58, 0xfd, 
-0x28, 0x0e, 0xf7, 0x12, 0xce, 0x0e, 0x86, 0x09, 0xec, 0x08, 0x05, 0x06, 0x87, 0xfc, 0xa2, 0xf6, 
-0x8f, 0xf8, 0x0a, 0xfd, 0x0c, 0x02, 0xe7, 0x05, 0xba, 0x08, 0x3a, 0x0e, 0x03, 0x12, 0x22, 0x0d, 
-0x4d, 0x05, 0xa9, 0xff, 0xa7, 0xfd, 0x37, 0x00, 0xc5, 0x01, 0xfb, 0x01, 0x74, 0x06, 0x96, 0x0c, 
-0x99, 0x0d, 0xff, 0x0a, 0xb4, 0x05, 0xe8, 0x00, 0xeb, 0xff, 0x8c, 0xfd, 0x8b, 0xf9, 0x39, 0xfa, 
-0x57, 0xfe, 0x2d, 0x01, 0x0c, 0x01, 0xff, 0xfc, 0x44, 0xf9, 0xd9, 0xf7, 0xef, 0xf7, 0x99, 0xf7, 
-0xc4, 0xf5, 0x72, 0xf5, 0x9b, 0xf5, 0x17, 0xf1, 0x8b, 0xea, 0x2c, 0xe6, 0x28, 0xe9, 0x99, 0xf9, 
-0xb0, 0x0a, 0x46, 0x11, 0x2e, 0x11, 0x8d, 0x0d, 0x9e, 0x0b, 0x8a, 0x0a, 0xe0, 0x01, 0x7f, 0xf7, 
-0x85, 0xf5, 0xf8, 0xf9, 0xa6, 0x00, 0x41, 0x06, 0xbf, 0x08, 0xaa, 0x0b, 0xef, 0x0f, 0xe9, 0x0f, 
-0xbb, 0x09, 0xba, 0x01, 0xbe, 0xfc, 0x1f, 0xfe, 0xc0, 0x00, 0xe6, 0x00, 0xe5, 0x01, 0xd0, 0x06, 
-0xe3, 0x0b, 0xd4, 0x0b, 0xe1, 0x06, 0xf4, 0x01, 0xf2, 0xff, 0xaa, 0xfe, 0x1f, 0xfd, 0x06, 0xfc, 
-0x6c, 0xfc, 0xd3, 0xfd, 0x0a, 0xff, 0xa5, 0xfd, 0x0f, 0xfc, 0xfd, 0xf9, 0x01, 0xf7, 0x75, 0xf5, 
-0x64, 0xf4, 0x92, 0xf4, 0xa8, 0xf7, 0xb6, 0xf8, 0xde, 0xf3, 0x41, 0xec, 0xa6, 0xe5, 0xd8, 0xea, 
-0x94, 0xfd, 0xf4, 0x0c, 0x28, 0x11, 0xcb, 0x0e, 0xc8, 0x0a, 0x98, 0x0b, 0x0b, 0x0c, 0x61, 0x03, 
-0x1d, 0xf9, 0xdd, 0xf5, 0x47, 0xfa, 0xaf, 0x02, 0xb5, 0x07, 0xc5, 0x07, 0xf0, 0x08, 0x9c, 0x0c, 
-0xa8, 0x0d, 0xd0, 0x0a, 0x62, 0x04, 0x94, 0xff, 0x71, 0xff, 0x1d, 0x00, 0x99, 0xff, 0x47, 0x00, 
-0x0c, 0x04, 0xc2, 0x09, 0x12, 0x0d, 0x57, 0x0a, 0x9d, 0x03, 0x26, 0xfe, 0x07, 0xfd, 0x94, 0xfd, 
-0x46, 0xfd, 0xa1, 0xfb, 0xca, 0xfb, 0xe5, 0xfd, 0x3d, 0xff, 0x9e, 0xfd, 0xa1, 0xf9, 0x02, 0xf8, 
-0x93, 0xf8, 0x67, 0xf7, 0x3e, 0xf5, 0x35, 0xf4, 0x22, 0xf3, 0xdd, 0xf0, 0xc5, 0xeb, 0x3d, 0xe7, 
-0xd7, 0xee, 0x25, 0x01, 0x31, 0x0f, 0x6d, 0x13, 0x32, 0x10, 0xd4, 0x0a, 0x57, 0x0a, 0x78, 0x08, 
-0x35, 0x00, 0xea, 0xf8, 0xca, 0xf6, 0xbf, 0xfa, 0x04, 0x03, 0x83, 0x08, 0x2c, 0x09, 0x34, 0x0a, 
-0x84, 0x0b, 0xfc, 0x0b, 0xe1, 0x09, 0xdf, 0x03, 0x93, 0xff, 0x76, 0xfe, 0x4c, 0xff, 0xf8, 0x01, 
-0x02, 0x04, 0xf6, 0x04, 0xea, 0x07, 0x23, 0x0a, 0xa7, 0x08, 0x2f, 0x04, 0xcc, 0xfe, 0xa9, 0xfb, 
-0xac, 0xfc, 0x0f, 0xfe, 0x50, 0xfd, 0x99, 0xfc, 0x25, 0xfc, 0x82, 0xfd, 0x5c, 0xff, 0xf4, 0xfc, 
-0x94, 0xf8, 0x2e, 0xf6, 0x54, 0xf5, 0xf0, 0xf6, 0x1f, 0xf8, 0x50, 0xf4, 0xe6, 0xee, 0x33, 0xea, 
-0x67, 0xe7, 0x8c, 0xf0, 0xf2, 0x00, 0x72, 0x0b, 0xc9, 0x10, 0x1b, 0x10, 0x11, 0x0b, 0xdb, 0x0a, 
-0x91, 0x09, 0x4c, 0x02, 0x64, 0xfc, 0x95, 0xf8, 0xbf, 0xf8, 0xed, 0x00, 0x45, 0x07, 0xcf, 0x07, 
-0x0c, 0x09, 0x62, 0x09, 0xbb, 0x0a, 0x23, 0x0c, 0x28, 0x07, 0x8e, 0x00, 0xe2, 0xfd, 0x7c, 0xfe, 
-0xf1, 0x01, 0x40, 0x04, 0x83, 0x02, 0xfa, 0x02, 0xaf, 0x05, 0x32, 0x06, 0x84, 0x05, 0x4d, 0x02, 
-0x5f, 0xfd, 0xb2, 0xfc, 0x3e, 0xfe, 0x90, 0xfe, 0xe7, 0xfe, 0x63, 0xfd, 0x19, 0xfc, 0xa8, 0xfc, 
-0x1f, 0xfb, 0x6a, 0xf9, 0xe3, 0xf8, 0x13, 0xf7, 0x51, 0xf6, 0x37, 0xf7, 0xff, 0xf4, 0xa1, 0xf0, 
-0x98, 0xea, 0x93, 0xe6, 0x49, 0xf1, 0xd9, 0x02, 0x62, 0x0e, 0x31, 0x13, 0x59, 0x10, 0x50, 0x0b, 
-0x8b, 0x0b, 0xac, 0x09, 0x5b, 0x02, 0xfb, 0xfb, 0x5e, 0xf7, 0x03, 0xf8, 0x81, 0xff, 0x19, 0x05, 
-0x9d, 0x07, 0xc6, 0x09, 0x68, 0x09, 0x55, 0x0a, 0xee, 0x0a, 0xc9, 0x06, 0x35, 0x01, 0xe3, 0xfc, 
-0xb1, 0xfb, 0x30, 0x00, 0xda, 0x04, 0xce, 0x04, 0xf3, 0x03, 0xa2, 0x03, 0x18, 0x04, 0x06, 0x06, 
-0x10, 0x05, 0x99, 0x00, 0xb8, 0xfd, 0xf3, 0xfc, 0xa7, 0xfd, 0xa1, 0xfe, 0xfc, 0xfc, 0x24, 0xfb, 
-0xec, 0xf9, 0xf6, 0xf8, 0x09, 0xfa, 0x93, 0xfa, 0x72, 0xf8, 0x40, 0xf6, 0xa9, 0xf4, 0x7e, 0xf1, 
-0xfd, 0xee, 0xc2, 0xea, 0x5e, 0xe9, 0x4a, 0xf4, 0xce, 0x03, 0x4c, 0x0f, 0x45, 0x13, 0x2c, 0x0f, 
-0x2d, 0x0a, 0xf2, 0x09, 0x7e, 0x09, 0x6f, 0x05, 0x57, 0xff, 0x66, 0xf9, 0xf6, 0xf8, 0x7b, 0xfe, 
-0x07, 0x04, 0x9c, 0x07, 0x9d, 0x08, 0x30, 0x07, 0xaf, 0x07, 0x85, 0x09, 0xae, 0x08, 0x10, 0x05, 
-0x04, 0x00, 0x94, 0xfd, 0x55, 0x00, 0xc3, 0x03, 0x02, 0x04, 0x58, 0x02, 0xb0, 0x00, 0x45, 0x01, 
-0xbf, 0x04, 0x02, 0x06, 0xd7, 0x02, 0x7f, 0xfe, 0x4c, 0xfb, 0x71, 0xfb, 0x47, 0xfd, 0x36, 0xfd, 
-0xc4, 0xfb, 0xa4, 0xf9, 0x18, 0xf8, 0xe7, 0xf8, 0xec, 0xf9, 0x1e, 0xf9, 0xa0, 0xf7, 0x04, 0xf5, 
-0x16, 0xf2, 0x38, 0xf0, 0xd2, 0xec, 0xfc, 0xee, 0xdd, 0xf9, 0x1b, 0x05, 0x82, 0x0d, 0x3c, 0x10, 
-0x07, 0x0d, 0x4a, 0x0a, 0xc5, 0x09, 0xe2, 0x07, 0x90, 0x04, 0x6d, 0xff, 0x7b, 0xfa, 0xaa, 0xfa, 
-0xe4, 0xfe, 0xf1, 0x03, 0xec, 0x07, 0x28, 0x08, 0x16, 0x06, 0x98, 0x06, 0xdf, 0x07, 0x85, 0x07, 
-0x81, 0x05, 0x77, 0x01, 0xc0, 0xff, 0x0b, 0x01, 0xfb, 0x01, 0x19, 0x02, 0x73, 0x01, 0x15, 0x00, 
-0x88, 0x00, 0x5d, 0x02, 0x86, 0x02, 0xa7, 0x01, 0xb3, 0xff, 0x5a, 0xfd, 0xce, 0xfd, 0x32, 0xff, 
-0x37, 0xff, 0x00, 0xfe, 0x38, 0xfa, 0x50, 0xf6, 0x0c, 0xf6, 0x48, 0xf7, 0x66, 0xf8, 0xc6, 0xf8, 
-0x1b, 0xf6, 0x5a, 0xf2, 0x7b, 0xee, 0xbd, 0xec, 0x1d, 0xf4, 0x0d, 0x00, 0x8e, 0x08, 0x6a, 0x0d, 
-0x9d, 0x0c, 0x48, 0x09, 0x86, 0x09, 0x0d, 0x0a, 0xcd, 0x07, 0xfe, 0x03, 0xa5, 0xfe, 0x9a, 0xfb, 
-0xa8, 0xfd, 0xa1, 0x01, 0xf8, 0x04, 0x33, 0x06, 0x13, 0x05, 0x5b, 0x04, 0x7d, 0x05, 0x82, 0x06, 
-0xf5, 0x06, 0x17, 0x05, 0x54, 0x01, 0xce, 0xff, 0x6e, 0x00, 0xba, 0x01, 0xed, 0x02, 0x10, 0x02, 
-0x08, 0x00, 0x8d, 0xff, 0x89, 0x00, 0x9d, 0x01, 0xdf, 0x01, 0x12, 0x01, 0x65, 0xff, 0xae, 0xfd, 
-0x68, 0xfc, 0xaf, 0xfb, 0x51, 0xfb, 0x42, 0xfa, 0x56, 0xf8, 0xf5, 0xf6, 0x84, 0xf6, 0xdf, 0xf6, 
-0xfb, 0xf6, 0x2a, 0xf5, 0x4d, 0xf2, 0x2f, 0xf1, 0x56, 0xf5, 0x72, 0xfe, 0xc9, 0x06, 0x06, 0x0b, 
-0xd4, 0x0a, 0xb3, 0x07, 0x8d, 0x06, 0xb6, 0x07, 0x3d, 0x08, 0x4d, 0x06, 0x51, 0x01, 0xb6, 0xfc, 
-0x60, 0xfc, 0xbb, 0xff, 0x4f, 0x04, 0xbe, 0x06, 0xae, 0x05, 0x4f, 0x04, 0x3e, 0x04, 0xe7, 0x04, 
-0x5e, 0x06, 0x2a, 0x06, 0x2c, 0x03, 0x91, 0x00, 0x6a, 0xff, 0xb3, 0xff, 0xf2, 0x01, 0xf8, 0x02, 
-0x2d, 0x01, 0x86, 0xff, 0x63, 0xfe, 0x97, 0xfe, 0xce, 0x00, 0x16, 0x02, 0xc3, 0x01, 0x6d, 0x00, 
-0xa3, 0xfd, 0x11, 0xfb, 0xe9, 0xf9, 0x07, 0xf9, 0x68, 0xf8, 0x28, 0xf8, 0x3b, 0xf7, 0x41, 0xf5, 
-0x27, 0xf3, 0xd6, 0xf0, 0x63, 0xf0, 0x26, 0xf5, 0x26, 0xfd, 0xa8, 0x05, 0xa4, 0x0b, 0xdf, 0x0b, 
-0x35, 0x09, 0x1f, 0x07, 0x40, 0x06, 0xdb, 0x06, 0x46, 0x06, 0x4a, 0x02, 0x91, 0xfd, 0x7e, 0xfb, 
-0xe7, 0xfc, 0x08, 0x01, 0xcd, 0x04, 0xb9, 0x05, 0x21, 0x05, 0xa2, 0x04, 0xd0, 0x04, 0x15, 0x06, 
-0x92, 0x06, 0xea, 0x04, 0x26, 0x02, 0x4d, 0xff, 0x4a, 0xfe, 0xf4, 0xff, 0x0b, 0x02, 0xb7, 0x02, 
-0xba, 0x01, 0xb9, 0xff, 0x6c, 0xfe, 0x5e, 0xff, 0x7e, 0x01, 0x73, 0x02, 0x11, 0x01, 0x8b, 0xfe, 
-0xd5, 0xfc, 0x23, 0xfc, 0x3d, 0xfc, 0x0a, 0xfc, 0x68, 0xfa, 0x21, 0xf8, 0xac, 0xf6, 0x30, 0xf6, 
-0x1d, 0xf6, 0xee, 0xf5, 0xf2, 0xf4, 0xd9, 0xf5, 0xca, 0xfa, 0x48, 0x01, 0x03, 0x07, 0xa0, 0x09, 
-0x17, 0x08, 0x56, 0x05, 0x81, 0x03, 0x54, 0x03, 0xc0, 0x04, 0x88, 0x05, 0xef, 0x03, 0x3a, 0x01, 
-0x46, 0xff, 0x2a, 0xff, 0x8c, 0x01, 0x33, 0x04, 0xd7, 0x04, 0xdc, 0x03, 0x42, 0x02, 0xe7, 0x01, 
-0x1f, 0x03, 0x2a, 0x04, 0x57, 0x04, 0x79, 0x03, 0xe9, 0x01, 0x32, 0x01, 0x38, 0x01, 0xf6, 0x00, 
-0xa8, 0x00, 0xe5, 0xff, 0x81, 0xfe, 0xe0, 0xfd, 0x1d, 0xfe, 0x8b, 0xfe, 0xfd, 0xfe, 0xcf, 0xfe, 
-0xc8, 0xfd, 0xf4, 0xfb, 0xe5, 0xf9, 0x6e, 0xf8, 0xb7, 0xf7, 0x10, 0xf7, 0xfb, 0xf5, 0xbb, 0xf3, 
-0x9c, 0xf1, 0xe8, 0xf3, 0x1f, 0xfa, 0x6c, 0x01, 0xd2, 0x07, 0x09, 0x0a, 0x79, 0x08, 0x8a, 0x06, 
-0xf2, 0x05, 0xc2, 0x06, 0xbb, 0x07, 0x79, 0x06, 0x49, 0x03, 0x7c, 0x00, 0x0a, 0xff, 0x67, 0xff, 
-0xc9, 0x00, 0x82, 0x01, 0xaf, 0x01, 0xa8, 0x01, 0x8b, 0x01, 0x5e, 0x02, 0xb9, 0x03, 0xc6, 0x04, 
-0x37, 0x05, 0x5b, 0x04, 0x99, 0x02, 0x62, 0x01, 0x33, 0x01, 0x83, 0x01, 0x94, 0x01, 0x85, 0x00, 
-0x15, 0xff, 0x59, 0xfe, 0x62, 0xfe, 0x26, 0xff, 0x64, 0x00, 0x3c, 0x01, 0x14, 0x01, 0xf2, 0xff, 
-0xf3, 0xfd, 0x05, 0xfc, 0xca, 0xfa, 0xcf, 0xf9, 0x28, 0xf9, 0xcf, 0xf8, 0x11, 0xf8, 0x75, 0xf7, 
-0x86, 0xf7, 0x65, 0xf8, 0x71, 0xfa, 0x07, 0xfd, 0x6e, 0xff, 0x7a, 0x01, 0x12, 0x03, 0x42, 0x04, 
-0x07, 0x05, 0x4c, 0x05, 0x25, 0x05, 0x05, 0x05, 0xe2, 0x04, 0x40, 0x04, 0x36, 0x03, 0x2c, 0x02, 
-0xc1, 0x01, 0x09, 0x02, 0x9c, 0x02, 0x35, 0x03, 0x17, 0x03, 0xeb, 0x02, 0x01, 0x03, 0x69, 0x03, 
-0x20, 0x04, 0xc2, 0x03, 0x58, 0x02, 0x59, 0x00, 0x6d, 0xfe, 0x4a, 0xfd, 0xd2, 0xfc, 0x38, 0xfc, 
-0x50, 0xfb, 0x8e, 0xfa, 0xbe, 0xf9, 0xda, 0xf8, 0xd2, 0xf7, 0xe0, 0xf6, 0xe9, 0xf5, 0x20, 0xf6, 
-0x97, 0xf8, 0x65, 0xfc, 0x6a, 0x00, 0x25, 0x03, 0x12, 0x04, 0xdb, 0x03, 0xe6, 0x03, 0xfd, 0x04, 
-0xb2, 0x06, 0xaf, 0x07, 0xaa, 0x06, 0x33, 0x04, 0x47, 0x01, 0x3f, 0xff, 0x07, 0xff, 0xab, 0xff, 
-0x6c, 0x00, 0xbe, 0x00, 0x3c, 0x00, 0xc0, 0xff, 0x06, 0x00, 0x02, 0x01, 0x34, 0x02, 0xe8, 0x02, 
-0xcf, 0x02, 0x10, 0x02, 0x5f, 0x01, 0x3e, 0x01, 0x8e, 0x01, 0xd7, 0x01, 0x8e, 0x01, 0xab, 0x00, 
-0x8b, 0xff, 0xc9, 0xfe, 0xfb, 0xfe, 0x9a, 0xff, 0x4c, 0x00, 0xbb, 0x00, 0x65, 0x00, 0xaf, 0xff, 
-0xf5, 0xfe, 0x81, 0xfe, 0x8d, 0xfe, 0xe5, 0xfe, 0x07, 0xff, 0xcc, 0xfe, 0x71, 0xfe, 0x14, 0xfe, 
-0xfe, 0xfd, 0x1d, 0xfe, 0x46, 0xfe, 0x91, 0xfe, 0xe3, 0xfe, 0x18, 0xff, 0x68, 0xff, 0xa5, 0xff, 
-0xc4, 0xff, 0xfc, 0xff, 0x23, 0x00, 0x45, 0x00, 0x5e, 0x00, 0x7e, 0x00, 0xa5, 0x00, 0xbe, 0x00, 
-0xb9, 0x00, 0x86, 0x00, 0x51, 0x00, 0x37, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x1f, 0x00, 
-0xe3, 0xff, 0xa6, 0xff, 0x68, 0xff, 0x44, 0xff, 0x36, 0xff, 0x17, 0xff, 0x1d, 0xff, 0x40, 0xff, 
-0x5c, 0xff, 0x76, 0xff, 0x94, 0xff, 0xc4, 0xff, 0x0d, 0x00, 0x50, 0x00, 0x6e, 0x00, 0x6d, 0x00, 
-0x50, 0x00, 0x3d, 0x00, 0x35, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x54, 0x00, 0x46, 0x00, 
-0x05, 0x00, 0xb3, 0xff, 0x7f, 0xff, 0x79, 0xff, 0x93, 0xff, 0xad, 0xff, 0xc9, 0xff, 0x00, 0x00, 
-0x33, 0x00, 0x65, 0x00, 0x7c, 0x00, 0x6b, 0x00, 0x49, 0x00, 0x29, 0x00, 0x33, 0x00, 0x51, 0x00, 
-0x5e, 0x00, 0x4d, 0x00, 0x31, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x6a, 0x00, 0xae, 0x00, 0xe3, 0x00, 
-0xfe, 0x00, 0x07, 0x01, 0x0f, 0x01, 0x13, 0x01, 0x16, 0x01, 0xfe, 0x00, 0xc1, 0x00, 0x74, 0x00, 
-0x15, 0x00, 0xd2, 0xff, 0xc6, 0xff, 0xd3, 0xff, 0xdc, 0xff, 0xca, 0xff, 0xa5, 0xff, 0x79, 0xff, 
-0x5a, 0xff, 0x52, 0xff, 0x54, 0xff, 0x5e, 0xff, 0x72, 0xff, 0x7d, 0xff, 0x72, 0xff, 0x6f, 0xff, 
-0x77, 0xff, 0x8c, 0xff, 0xaa, 0xff, 0xbd, 0xff, 0xcf, 0xff, 0xe2, 0xff, 0x00, 0x00, 0x12, 0x00, 
-0x18, 0x00, 0x14, 0x00, 0x15, 0x00, 0x31, 0x00, 0x5b, 0x00, 0x83, 0x00, 0x9d, 0x00, 0x90, 0x00, 
-0x5e, 0x00, 0x2e, 0x00, 0x04, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x17, 0x00, 0x3a, 0x00, 0x56, 0x00, 
-0x62, 0x00, 0x5b, 0x00, 0x41, 0x00, 0x23, 0x00, 0x02, 0x00, 0xec, 0xff, 0xcf, 0xff, 0xb0, 0xff, 
-0x99, 0xff, 0x8c, 0xff, 0x80, 0xff, 0x73, 0xff, 0x71, 0xff, 0x68, 0xff, 0x5d, 0xff, 0x5e, 0xff, 
-0x6b, 0xff, 0x85, 0xff, 0xa3, 0xff, 0xc0, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xc0, 0xff, 0xb5, 0xff, 
-0xb1, 0xff, 0xaf, 0xff, 0xb5, 0xff, 0xcc, 0xff, 0xe3, 0xff, 0xfa, 0xff, 0x11, 0x00, 0x29, 0x00, 
-0x44, 0x00, 0x69, 0x00, 0x8f, 0x00, 0xb2, 0x00, 0xd1, 0x00, 0xd5, 0x00, 0xc4, 0x00, 0xa7, 0x00, 
-0x82, 0x00, 0x60, 0x00, 0x43, 0x00, 0x39, 0x00, 0x3f, 0x00, 0x46, 0x00, 0x41, 0x00, 0x35, 0x00, 
-0x22, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x06, 0x00, 0xf0, 0xff, 0xc7, 0xff, 
-0xac, 0xff, 0x7f, 0xff, 0x4b, 0xff, 0x30, 0xff, 0x27, 0xff, 0x33, 0xff, 0x59, 0xff, 0x77, 0xff, 
-0x8b, 0xff, 0xa4, 0xff, 0xc3, 0xff, 0xf4, 0xff, 0x23, 0x00, 0x32, 0x00, 0x27, 0x00, 0x1a, 0x00, 
-0x11, 0x00, 0x13, 0x00, 0x17, 0x00, 0x07, 0x00, 0xec, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xf0, 0xff, 
-0x0b, 0x00, 0x23, 0x00, 0x3a, 0x00, 0x54, 0x00, 0x74, 0x00, 0x8d, 0x00, 0x9d, 0x00, 0x9f, 0x00, 
-0x94, 0x00, 0x86, 0x00, 0x7d, 0x00, 0x71, 0x00, 0x5e, 0x00, 0x43, 0x00, 0x24, 0x00, 0x08, 0x00, 
-0xfb, 0xff, 0xee, 0xff, 0xe7, 0xff, 0xe2, 0xff, 0xdd, 0xff, 0xd9, 0xff, 0xd5, 0xff, 0xd1, 0xff, 
-0xce, 0xff, 0xc9, 0xff, 0xbc, 0xff, 0xac, 0xff, 0xa0, 0xff, 0x9b, 0xff, 0x97, 0xff, 0x94, 0xff, 
-0x8c, 0xff, 0x8a, 0xff, 0x8c, 0xff, 0x93, 0xff, 0xa3, 0xff, 0xb6, 0xff, 0xc8, 0xff, 0xd7, 0xff, 
-0xe9, 0xff, 0xfd, 0xff, 0x0d, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x3b, 0x00, 
-0x37, 0x00, 0x34, 0x00, 0x31, 0x00, 0x2b, 0x00, 0x21, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0c, 0x00, 
-0x0c, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x05, 0x00, 0xf8, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xe7, 0xff, 
-0xe1, 0xff, 0xda, 0xff, 0xda, 0xff, 0xd9, 0xff, 0xd6, 0xff, 0xd5, 0xff, 0xd4, 0xff, 0xd5, 0xff, 
-0xd3, 0xff, 0xd1, 0xff, 0xc7, 0xff, 0xbe, 0xff, 0xb7, 0xff, 0xab, 0xff, 0xa4, 0xff, 0xa6, 0xff, 
-0xa9, 0xff, 0xb3, 0xff, 0xbe, 0xff, 0xc8, 0xff, 0xd5, 0xff, 0xe4, 0xff, 0xf2, 0xff, 0xff, 0xff, 
-0x0c, 0x00, 0x17, 0x00, 0x23, 0x00, 0x30, 0x00, 0x35, 0x00, 0x36, 0x00, 0x3b, 0x00, 0x43, 0x00, 
-0x4d, 0x00, 0x53, 0x00, 0x58, 0x00, 0x57, 0x00, 0x5a, 0x00, 0x5a, 0x00, 0x59, 0x00, 0x49, 0x00, 
-0x36, 0x00, 0x22, 0x00, 0x10, 0x00, 0x07, 0x00, 0xf3, 0xff, 0xda, 0xff, 0xc6, 0xff, 0xb8, 0xff, 
-0xb0, 0xff, 0xae, 0xff, 0xb0, 0xff, 0xb3, 0xff, 0xbd, 0xff, 0xc5, 0xff, 0xce, 0xff, 0xd9, 0xff, 
-0xd3, 0xff, 0xcf, 0xff, 0xd4, 0xff, 0xde, 0xff, 0xdd, 0xff, 0xd4, 0xff, 0xd0, 0xff, 0xcd, 0xff, 
-0xd7, 0xff, 0xe8, 0xff, 0xf8, 0xff, 0x03, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x2f, 0x00, 
-0x2e, 0x00, 0x29, 0x00, 0x26, 0x00, 0x23, 0x00, 0x1d, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf7, 0xff, 
-0xf6, 0xff, 0xfc, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x00, 0x19, 0x00, 
-0x1f, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x1f, 0x00, 0x15, 0x00, 0x08, 0x00, 0xf9, 0xff, 0xef, 0xff, 
-0xea, 0xff, 0xdd, 0xff, 0xd2, 0xff, 0xcc, 0xff, 0xc2, 0xff, 0xbc, 0xff, 0xc2, 0xff, 0xc4, 0xff, 
-0xc8, 0xff, 0xd2, 0xff, 0xda, 0xff, 0xe1, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe6, 0xff, 0xe7, 0xff, 
-0xe7, 0xff, 0xe5, 0xff, 0xdf, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xed, 0xff, 0xf3, 0xff, 0xfa, 0xff, 
-0xff, 0xff, 0x06, 0x00, 0x0e, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x03, 0x00, 
-0xfe, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfd, 0xff, 
-0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00, 0x05, 0x00, 
-0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xec, 0xff, 0xec, 0xff, 0xea, 0xff, 0xe9, 0xff, 
-0xeb, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xec, 0xff, 0xe9, 0xff, 0xea, 0xff, 
-0xec, 0xff, 0xec, 0xff, 0xef, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0xfb, 0xff, 
-0xfe, 0xff, 0x03, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 
-0x16, 0x00, 0x14, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x05, 0x00, 
-0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xfc, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xf2, 0xff, 
-0xf2, 0xff, 0xed, 0xff, 0xe8, 0xff, 0xe2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xd9, 0xff, 0xd9, 0xff, 
-0xdb, 0xff, 0xdd, 0xff, 0xe0, 0xff, 0xe1, 0xff, 0xe4, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xf4, 0xff, 
-0xfa, 0xff, 0xfd, 0xff, 0x01, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x10, 0x00, 
-0x13, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x23, 0x00, 0x25, 0x00, 0x23, 0x00, 0x22, 0x00, 
-0x1f, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x13, 0x00, 0x10, 0x00, 0x07, 0x00, 0x05, 0x00, 0x01, 0x00, 
-0xfc, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf1, 0xff, 
-0xee, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xdf, 0xff, 
-0xe2, 0xff, 0xe9, 0xff, 0xf1, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0x06, 0x00, 0x11, 0x00, 0x12, 0x00, 
-0x16, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1d, 0x00, 0x1f, 0x00, 0x19, 0x00, 0x18, 0x00, 
-0x20, 0x00, 0x23, 0x00, 0x26, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x21, 0x00, 
-0x1c, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0a, 0x00, 
-0xfd, 0xff, 0xf8, 0xff, 0x09, 0x00, 0x05, 0x00, 0xf5, 0xff, 0xf2, 0xff, 0xfd, 0xff, 0x03, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x0d, 0x00, 0x04, 0x00, 0xfb, 0xff, 0xf7, 0xff, 0xf5, 0xff, 0x01, 0x00, 
-0x02, 0x00, 0xfe, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0x04, 0x00, 0x04, 0x00, 0x08, 0x00, 0x13, 0x00, 
-0x1e, 0x00, 0x10, 0x00, 0xf5, 0xff, 0x07, 0x00, 0x26, 0x00, 0x23, 0x00, 0x12, 0x00, 0x1e, 0x00, 
-0x1c, 0x00, 0x09, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x01, 0x00, 0xfc, 0xff, 0xf6, 0xff, 
-0xfc, 0xff, 0x18, 0x00, 0x0c, 0x00, 0xe5, 0xff, 0xf4, 0xff, 0xfb, 0xff, 0x14, 0x00, 0x01, 0x00, 
-0xeb, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xc1, 0xff, 0xe1, 0xff, 0x02, 0x00, 0x09, 0x00, 
-0x04, 0x00, 0xe2, 0xff, 0xe3, 0xff, 0xee, 0xff, 0x10, 0x00, 0x26, 0x00, 0xff, 0xff, 0xec, 0xff, 
-0xdb, 0xff, 0x1c, 0x00, 0x25, 0x00, 0xda, 0xff, 0x07, 0x00, 0x0c, 0x00, 0x07, 0x00, 0xe2, 0xff, 
-0xff, 0xff, 0x88, 0x00, 0x14, 0x00, 0xd1, 0xff, 0x19, 0x00, 0x18, 0x00, 0x09, 0x00, 0x2a, 0x00, 
-0x28, 0x00, 0xfb, 0xff, 0xf4, 0xff, 0x0d, 0x00, 0x5d, 0x00, 0x26, 0x00, 0xa0, 0xff, 0xd3, 0xff, 
-0x4f, 0x00, 0xab, 0xff, 0xcc, 0xff, 0x7b, 0x00, 0xf6, 0xff, 0xf3, 0xff, 0x3a, 0x00, 0x5e, 0xff, 
-0x7b, 0xff, 0x57, 0x00, 0x52, 0x00, 0x10, 0x00, 0xcc, 0xff, 0xbb, 0xff, 0xa8, 0xff, 0x4b, 0x00, 
-0x45, 0x00, 0xc9, 0xff, 0xac, 0xff, 0x74, 0xff, 0xd8, 0xff, 0xe8, 0x00, 0x41, 0xff, 0xe9, 0x02, 
-0xeb, 0x05, 0xdf, 0xfb, 0xab, 0xf8, 0x80, 0x01, 0x73, 0x05, 0xbe, 0x01, 0xc0, 0xff, 0xd2, 0xfd, 
-0x74, 0xff, 0x81, 0x04, 0x10, 0x02, 0xb8, 0xfb, 0x05, 0xfc, 0x23, 0x03, 0x9d, 0x02, 0xe7, 0xfc, 
-0xd0, 0xfd, 0x71, 0x01, 0xac, 0x01, 0x47, 0xfe, 0xea, 0xfd, 0xbf, 0x00, 0xed, 0x01, 0xf7, 0xff, 
-0x9c, 0xfd, 0xd7, 0xff, 0x6d, 0x01, 0x21, 0x00, 0x46, 0xfe, 0x11, 0xff, 0x71, 0x00, 0x67, 0xff, 
-0x88, 0xff, 0xb4, 0xff, 0x7a, 0xff, 0x60, 0xff, 0xe7, 0xff, 0xef, 0xff, 0x48, 0xff, 0xc5, 0xff, 
-0x07, 0x00, 0x2e, 0x00, 0x40, 0x00, 0xa2, 0xff, 0xce, 0xff, 0x3f, 0x00, 0xc5, 0xff, 0xe5, 0xff, 
-0x45, 0x00, 0x0f, 0x00, 0xc7, 0xff, 0x9a, 0xff, 0xd8, 0xff, 0xc5, 0xff, 0x01, 0x00, 0xd7, 0xff, 
-0x30, 0x00, 0x39, 0x00, 0x1b, 0x00, 0x9d, 0xff, 0xbc, 0xff, 0xcb, 0xff, 0x5e, 0x00, 0x7d, 0x02, 
-0xea, 0x00, 0x30, 0xff, 0x34, 0xff, 0x35, 0x00, 0xf8, 0xff, 0xda, 0xfe, 0x84, 0xff, 0x60, 0x00, 
-0x71, 0xff, 0x27, 0xff, 0xfd, 0xff, 0x3b, 0x00, 0x0d, 0x00, 0xd7, 0xff, 0x36, 0x00, 0xb4, 0x00, 
-0xa1, 0xff, 0x4a, 0xff, 0x69, 0x00, 0x4d, 0x00, 0xbb, 0xff, 0x62, 0xff, 0x34, 0x00, 0x76, 0x00, 
-0x7e, 0xff, 0x8a, 0xff, 0xa5, 0x00, 0xfa, 0xff, 0xa3, 0xff, 0x2f, 0x00, 0xea, 0xff, 0x8f, 0xff, 
-0xb4, 0xff, 0x98, 0x00, 0x2f, 0x00, 0xb2, 0xff, 0x16, 0x00, 0x54, 0x00, 0x4a, 0xff, 0xd9, 0xff, 
-0x06, 0x00, 0x73, 0x01, 0xa2, 0x02, 0x20, 0xff, 0xfe, 0xfe, 0x1c, 0x00, 0xcf, 0x00, 0x0d, 0x00, 
-0x12, 0xff, 0x4e, 0x00, 0x65, 0x00, 0xbc, 0xfe, 0x2e, 0xff, 0xd3, 0x00, 0xe4, 0xff, 0x88, 0xff, 
-0xbe, 0xff, 0xdf, 0x00, 0xdd, 0x00, 0x83, 0xff, 0x11, 0x00, 0x02, 0x00, 0x33, 0xff, 0x6d, 0xff, 
-0xd8, 0xff, 0xbc, 0xff, 0x58, 0xff, 0xe6, 0xff, 0x44, 0x00, 0xd6, 0xff, 0x99, 0xff, 0xee, 0xff, 
-0x27, 0x00, 0xb5, 0xff, 0x0e, 0x00, 0x37, 0x00, 0xbc, 0xff, 0xc0, 0xff, 0xde, 0x00, 0x17, 0x00, 
-0x79, 0xff, 0x49, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x49, 0x00, 0x9e, 0xff, 
-0xcb, 0xff, 0x1e, 0x00, 0x5b, 0x00, 0xd0, 0xff, 0xd3, 0xff, 0xff, 0xff, 0x61, 0x00, 0xfc, 0xff, 
-0x40, 0xff, 0x85, 0x00, 0xf3, 0xff, 0xc3, 0xff, 0x25, 0x00, 0x4b, 0x00, 0x34, 0x00, 0xe8, 0xff, 
-0x71, 0x00, 0xde, 0x00, 0xcb, 0xff, 0xd3, 0xff, 0xb9, 0x00, 0xb1, 0xff, 0xa8, 0xff, 0xc3, 0x00, 
-0x07, 0x00, 0xac, 0xff, 0x77, 0x00, 0x67, 0x00, 0x38, 0x00, 0xb4, 0xff, 0x7f, 0xff, 0xee, 0xff, 
-0xae, 0x00, 0x2b, 0x00, 0xe4, 0xff, 0x5f, 0x00, 0xdf, 0xff, 0x33, 0xff, 0x1c, 0x00, 0x00, 0x01, 
-0x6d, 0xff, 0xcb, 0xff, 0x5b, 0x00, 0x18, 0x00, 0x51, 0xff, 0x82, 0xff, 0x8c, 0x00, 0x4d, 0xff, 
-0x51, 0xff, 0x09, 0x00, 0x6f, 0x00, 0xd1, 0xff, 0xcc, 0xff, 0x36, 0x00, 0x23, 0x00, 0x59, 0x00, 
-0xd4, 0xff, 0xb4, 0xff, 0x86, 0x00, 0x9d, 0xff, 0xca, 0xff, 0xe2, 0xff, 0xdd, 0xff, 0x13, 0x00, 
-0x85, 0xff, 0xbf, 0xff, 0xf8, 0xff, 0xc7, 0xff, 0x71, 0xff, 0xe0, 0xff, 0x87, 0xff, 0x27, 0x01, 
-0x44, 0x00, 0x3e, 0xff, 0xa0, 0x00, 0x4f, 0x00, 0xd0, 0xff, 0x4f, 0xff, 0x93, 0x00, 0x90, 0x00, 
-0x29, 0xff, 0x97, 0xff, 0xd0, 0x00, 0x3b, 0xff, 0xad, 0xff, 0xdd, 0x00, 0xcd, 0xff, 0xcd, 0xff, 
-0xd6, 0xff, 0x95, 0x00, 0x8c, 0xff, 0x9b, 0xff, 0x15, 0x01, 0xcb, 0xff, 0x2d, 0xff, 0x86, 0x00, 
-0xc4, 0x00, 0xca, 0xff, 0x41, 0xff, 0x4a, 0x00, 0x99, 0xff, 0x49, 0xff, 0x2e, 0x00, 0x54, 0x00, 
-0xfb, 0xff, 0x5f, 0xff, 0xde, 0x00, 0x60, 0x01, 0x65, 0xff, 0x8d, 0xff, 0x1c, 0x01, 0x1e, 0x00, 
-0x04, 0xff, 0x45, 0x00, 0x2c, 0x01, 0xd1, 0xff, 0xf5, 0xfe, 0x3a, 0x01, 0x4c, 0x01, 0x2c, 0xff, 
-0xd5, 0xff, 0xcd, 0x00, 0x21, 0x00, 0x3c, 0xff, 0xca, 0xff, 0x6c, 0x00, 0xb2, 0xff, 0xb2, 0xff, 
-0x8f, 0x00, 0x8d, 0x00, 0xc0, 0xff, 0xb9, 0xff, 0xf2, 0x00, 0x17, 0x01, 0x57, 0xff, 0x17, 0x00, 
-0x14, 0x01, 0xb8, 0xff, 0xc3, 0xff, 0x2a, 0x00, 0x31, 0x00, 0x91, 0xff, 0xdf, 0xff, 0xc0, 0x00, 
-0x09, 0x00, 0x95, 0xff, 0x09, 0x00, 0x79, 0x00, 0xbe, 0xff, 0xc3, 0xff, 0xb4, 0x00, 0x6f, 0x00, 
-0xbb, 0xff, 0xd3, 0xff, 0x8e, 0x00, 0xde, 0xff, 0x7d, 0xff, 0x00, 0x00, 0xbe, 0xff, 0x70, 0xff, 
-0xb2, 0xff, 0x8c, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x65, 0xff, 0xbb, 0xff, 0x0a, 0x00, 0xfb, 0xff, 
-0x8b, 0xff, 0x24, 0x00, 0x61, 0x00, 0x02, 0x00, 0x09, 0x00, 0x5d, 0x00, 0x45, 0x00, 0xcc, 0xff, 
-0x40, 0x00, 0x4c, 0x00, 0xd3, 0xff, 0x34, 0x00, 0x15, 0x00, 0xc7, 0xff, 0x0f, 0x00, 0xfa, 0xff, 
-0xd6, 0xff, 0x37, 0x00, 0xdc, 0xff, 0xd2, 0xff, 0x5c, 0x00, 0x03, 0x00, 0xfa, 0xff, 0x3d, 0x00, 
-0xfd, 0xff, 0x12, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x17, 0x00, 0xfe, 0xff, 0x0b, 0x00, 0xdd, 0xff, 
-0xec, 0xff, 0x1b, 0x00, 0xde, 0xff, 0xee, 0xff, 0xf6, 0xff, 0x18, 0x00, 0x0e, 0x00, 0xe6, 0xff, 
-0xf6, 0xff, 0x16, 0x00, 0x12, 0x00, 0xe5, 0xff, 0xe0, 0xff, 0x2d, 0x00, 0x1d, 0x00, 0xf1, 0xff, 
-0xfd, 0xff, 0x06, 0x00, 0x11, 0x00, 0xe8, 0xff, 0x08, 0x00, 0x07, 0x00, 0xf4, 0xff, 0xfb, 0xff, 
-0x06, 0x00, 0x03, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x22, 0x00, 0x09, 0x00, 0xf8, 0xff, 
-0xfd, 0xff, 0xf9, 0xff, 0x08, 0x00, 0xed, 0xff, 0xf1, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xff, 
-0x0b, 0x00, 0xfb, 0xff, 0xf8, 0xff, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 
-0xfe, 0xff, 0x00, 0x00, 0x07, 0x00, 0x05, 0x00, 0x0b, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x02, 0x00, 
-0x03, 0x00, 0x10, 0x00, 0xf7, 0xff, 0xfb, 0xff, 0x07, 0x00, 0xf9, 0xff, 0xf8, 0xff, 0xfe, 0xff, 
-0x0b, 0x00, 0x03, 0x00, 0xf7, 0xff, 0x05, 0x00, 0x04, 0x00, 0xfa, 0xff, 0xfb, 0xff, 0x05, 0x00, 
-0x11, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00, 0xfa, 0xff, 0x05, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xf8, 0xff, 0x07, 0x00, 0x05, 0x00, 
-0x05, 0x00, 0x04, 0x00, 0xfc, 0xff, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfa, 0xff, 
-0xf9, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0x05, 0x00, 0xf7, 0xff, 0xf9, 0xff, 
-0x0a, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xf8, 0xff, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 
-0xf9, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfa, 0xff, 0xfc, 0xff, 
-0x00, 0x00, 0xf7, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xf6, 0xff, 0xfa, 0xff, 0x06, 0x00, 
-0xfa, 0xff, 0xf7, 0xff, 0x02, 0x00, 0xf9, 0xff, 0xfe, 0xff, 0x07, 0x00, 0x0a, 0x00, 0x03, 0x00, 
-0x00, 0x00, 0x06, 0x00, 0xfa, 0xff, 0xfb, 0xff, 0x07, 0x00, 0xf9, 0xff, 0x02, 0x00, 0xfe, 0xff, 
-0xfa, 0xff, 0x09, 0x00, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xf9, 0xff, 0xfa, 0xff, 0x0a, 0x00, 
-0xf8, 0xff, 0xf4, 0xff, 0x02, 0x00, 0xfc, 0xff, 0x00, 0x00, 0x03, 0x00, 0xfb, 0xff, 0xfe, 0xff, 
-0x07, 0x00, 0xff, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 
-0x00, 0x00, 0x02, 0x00, 0xfb, 0xff, 0xfa, 0xff, 0x00, 0x00, 0x03, 0x00, 0xf7, 0xff, 0xfe, 0xff, 
-0x08, 0x00, 0xf9, 0xff, 0xfb, 0xff, 0x08, 0x00, 0xfd, 0xff, 0xf7, 0xff, 0x05, 0x00, 0xff, 0xff, 
-0xfb, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 
-};
-
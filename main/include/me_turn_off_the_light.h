@@ -1,1049 +0,0 @@
-#include <stdio.h>
-const unsigned char me_turn_off_the_light[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 
-0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 
-0xfc, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 
-0xfd, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x00, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 
-0x03, 0x00, 0x06, 0x00, 0x04, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 
-0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 
-0x05, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x12, 0x00, 0x10, 0x00, 
-0x14, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x14, 0x00, 0x19, 0x00, 0x11, 0x00, 0x0e, 0x00, 
-0x03, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfa, 0xff, 
-0x03, 0x00, 0xfd, 0xff, 0x04, 0x00, 0x0b, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0xf1, 0xff, 0xe6, 0xff, 
-0xf7, 0xff, 0xfa, 0xff, 0xed, 0xff, 0x02, 0x00, 0xfc, 0xff, 0xfe, 0xff, 0x09, 0x00, 0xf0, 0xff, 
-0xff, 0xff, 0x0c, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x06, 0x00, 0xf9, 0xff, 0x21, 0x00, 0x04, 0x00, 
-0x02, 0x00, 0x2c, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x14, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x03, 0x00, 
-0x01, 0x00, 0x1a, 0x00, 0xfa, 0xff, 0x0b, 0x00, 0xf5, 0xff, 0x19, 0x00, 0xf9, 0xff, 0x0c, 0x00, 
-0x09, 0x00, 0xf0, 0xff, 0x1b, 0x00, 0x09, 0x00, 0x11, 0x00, 0x09, 0x00, 0x04, 0x00, 0x14, 0x00, 
-0xfe, 0xff, 0xeb, 0xff, 0x01, 0x00, 0xf8, 0xff, 0xeb, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xf6, 0xff, 
-0xf4, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xef, 0xff, 0xe7, 0xff, 0xe6, 0xff, 0xfd, 0xff, 0x12, 0x00, 
-0xea, 0xff, 0x10, 0x00, 0xdd, 0xff, 0xea, 0xff, 0xfb, 0xff, 0xe3, 0xff, 0xf7, 0xff, 0xd3, 0xff, 
-0xe3, 0xff, 0xde, 0xff, 0xd6, 0xff, 0xf7, 0xff, 0xe8, 0xff, 0xc9, 0xff, 0x1b, 0x00, 0xe7, 0xff, 
-0xf6, 0xff, 0xf4, 0xff, 0xbe, 0xff, 0xfd, 0xff, 0xf2, 0xff, 0x00, 0x00, 0xdf, 0xff, 0xf8, 0xff, 
-0xec, 0xff, 0xdf, 0xff, 0x13, 0x00, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0x07, 0x00, 0xfb, 0xff, 
-0xe8, 0xff, 0x11, 0x00, 0x98, 0xff, 0x1a, 0x00, 0x0e, 0x00, 0xf5, 0xff, 0xf7, 0xff, 0xeb, 0xff, 
-0x0e, 0x00, 0x21, 0x00, 0xa5, 0xff, 0x4d, 0x00, 0xe2, 0xff, 0x65, 0x00, 0x07, 0x00, 0xf5, 0xff, 
-0xe0, 0x05, 0x8f, 0x00, 0xa7, 0xff, 0x4d, 0x00, 0xf3, 0xfe, 0x31, 0x00, 0xa2, 0xff, 0xd1, 0xff, 
-0xcf, 0xfd, 0x4d, 0xfe, 0xba, 0xff, 0x33, 0xfe, 0x77, 0xff, 0xa7, 0xff, 0x34, 0xff, 0x35, 0x00, 
-0x82, 0xff, 0xdc, 0x00, 0x55, 0x00, 0x54, 0x00, 0xc7, 0xff, 0x9f, 0x00, 0x64, 0x00, 0x94, 0xff, 
-0xad, 0xff, 0xee, 0xff, 0xb6, 0xff, 0x79, 0xff, 0x0a, 0xff, 0x6b, 0xff, 0x6c, 0xff, 0xe2, 0xfe, 
-0x60, 0xff, 0x5e, 0xff, 0x7c, 0xff, 0x1f, 0xff, 0x06, 0x00, 0x81, 0xff, 0xe1, 0xff, 0xf3, 0xff, 
-0x53, 0x00, 0xd5, 0xff, 0x8e, 0x00, 0xc1, 0xff, 0x93, 0x00, 0xdd, 0xff, 0x2e, 0x00, 0x8e, 0x00, 
-0x8f, 0xff, 0xfb, 0x00, 0x70, 0xff, 0xe3, 0x00, 0x7f, 0xff, 0x05, 0x00, 0x20, 0x00, 0x06, 0x00, 
-0xaf, 0xff, 0xf7, 0xff, 0x59, 0x00, 0x34, 0xff, 0xba, 0x00, 0xf9, 0xff, 0xdd, 0xff, 0x40, 0x00, 
-0xeb, 0xff, 0xf6, 0xff, 0x87, 0x00, 0xeb, 0xff, 0x29, 0x00, 0x25, 0x00, 0x77, 0x00, 0xfc, 0xff, 
-0x05, 0x00, 0x6b, 0x00, 0x14, 0x00, 0x4a, 0x00, 0xad, 0xff, 0x73, 0x00, 0x7c, 0xff, 0x77, 0x00, 
-0xb9, 0xff, 0x99, 0x00, 0x9c, 0xff, 0x0f, 0x00, 0x1c, 0x00, 0xe0, 0xff, 0xd9, 0xff, 0xb3, 0xff, 
-0xb7, 0xff, 0x2b, 0x00, 0xc4, 0xff, 0x29, 0x00, 0xee, 0xff, 0xc5, 0xff, 0x2c, 0x00, 0xe9, 0xff, 
-0xd0, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0x33, 0x00, 0x04, 0x00, 0xf0, 0xff, 0x2f, 0x00, 0x5c, 0xff, 
-0x50, 0x00, 0x75, 0xff, 0xdf, 0xff, 0xe1, 0xff, 0xa7, 0xff, 0x92, 0xff, 0x90, 0xff, 0x97, 0xff, 
-0xfe, 0xff, 0x8b, 0xff, 0xd6, 0xff, 0xce, 0xff, 0x97, 0xff, 0xdf, 0xff, 0x0d, 0x00, 0x9f, 0xff, 
-0x12, 0x00, 0x17, 0x00, 0xe8, 0xff, 0x33, 0x00, 0xf3, 0xff, 0xea, 0xff, 0x10, 0x00, 0xdd, 0xff, 
-0xe6, 0x00, 0x70, 0xff, 0x73, 0x00, 0xec, 0xff, 0xb6, 0xff, 0xad, 0x00, 0xc7, 0xff, 0x05, 0x00, 
-0x15, 0x00, 0x5c, 0xff, 0x15, 0x02, 0x0e, 0x01, 0x1a, 0x01, 0x86, 0x01, 0x28, 0xff, 0xf8, 0xff, 
-0xe9, 0xfe, 0x92, 0xff, 0xf6, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0x4d, 0x00, 0xcb, 0xff, 0x00, 0x00, 
-0xd4, 0x00, 0x73, 0x01, 0xed, 0x01, 0xc0, 0x05, 0x3d, 0x02, 0xb9, 0x00, 0x45, 0x01, 0xe5, 0xfc, 
-0x59, 0xfe, 0xac, 0xfe, 0x85, 0xfd, 0xb5, 0xfd, 0x8a, 0xfd, 0xfb, 0xfd, 0x69, 0xfe, 0xe5, 0xfe, 
-0xe8, 0xff, 0x69, 0xff, 0x64, 0x01, 0x0e, 0x00, 0x9f, 0x01, 0x89, 0x01, 0xcd, 0xfe, 0xf7, 0x00, 
-0x04, 0x00, 0x21, 0xff, 0xd3, 0xff, 0x80, 0xff, 0x97, 0xff, 0x99, 0xfe, 0x8a, 0xff, 0x90, 0x00, 
-0xd1, 0xfe, 0x19, 0x00, 0x81, 0xff, 0xde, 0xff, 0x42, 0x00, 0x30, 0x00, 0x37, 0x00, 0x96, 0x00, 
-0xd9, 0x00, 0x05, 0x00, 0xb3, 0x00, 0x04, 0x01, 0x17, 0x01, 0xac, 0x01, 0xf5, 0x00, 0x70, 0x01, 
-0x58, 0x01, 0x17, 0x00, 0xf7, 0x00, 0x68, 0xff, 0x02, 0x00, 0xc4, 0xff, 0x22, 0xfe, 0x8f, 0x00, 
-0xb1, 0xfe, 0x27, 0xfe, 0x87, 0xff, 0x6c, 0xfe, 0x5d, 0xff, 0x74, 0x00, 0x6e, 0x00, 0xaa, 0x00, 
-0x20, 0x00, 0xa7, 0x00, 0x47, 0x00, 0xd9, 0xff, 0x1f, 0xff, 0x2c, 0xff, 0x88, 0xfe, 0x0c, 0xff, 
-0x41, 0xff, 0x4d, 0xff, 0x33, 0x00, 0x51, 0x00, 0x23, 0x00, 0x36, 0xff, 0xd4, 0xff, 0x76, 0xff, 
-0xa4, 0xff, 0xd3, 0xff, 0x81, 0x00, 0x0f, 0x00, 0xd1, 0x00, 0xb9, 0x00, 0xbc, 0xff, 0x46, 0x00, 
-0x36, 0x00, 0x80, 0x00, 0x56, 0x00, 0xb4, 0x00, 0x32, 0x00, 0xf5, 0x00, 0x0d, 0x00, 0x82, 0x00, 
-0xa8, 0x00, 0x10, 0x00, 0xd9, 0x00, 0x86, 0x00, 0xb3, 0xff, 0x0b, 0x00, 0xa2, 0x00, 0x56, 0x00, 
-0xae, 0x00, 0x93, 0x00, 0x51, 0x01, 0x2c, 0xff, 0x52, 0x00, 0xeb, 0x00, 0x0a, 0x00, 0x93, 0xff, 
-0xb2, 0x00, 0x23, 0x00, 0x44, 0xff, 0xe3, 0xff, 0x24, 0x00, 0x70, 0xff, 0x8e, 0x00, 0x0e, 0x00, 
-0xcb, 0x00, 0xce, 0x00, 0x52, 0x00, 0xa6, 0x00, 0x72, 0xff, 0xe9, 0xff, 0x34, 0x00, 0x87, 0xff, 
-0x53, 0x00, 0x29, 0x00, 0x57, 0xff, 0x37, 0x01, 0x93, 0xfe, 0xbc, 0x00, 0xb3, 0xff, 0x95, 0xff, 
-0xf1, 0x00, 0x8b, 0xfe, 0x16, 0x01, 0x14, 0x01, 0xa1, 0xfe, 0xe4, 0x00, 0x58, 0x00, 0xb6, 0xfe, 
-0x61, 0x01, 0x50, 0x00, 0xfc, 0xff, 0xd9, 0x00, 0x3c, 0xff, 0x48, 0x00, 0xd6, 0xff, 0x13, 0x00, 
-0xcc, 0x00, 0x3d, 0xff, 0x0b, 0x01, 0x00, 0x01, 0x20, 0xff, 0x9b, 0xff, 0x2d, 0x02, 0xd4, 0xfe, 
-0xaf, 0x00, 0xe2, 0x00, 0xc7, 0x00, 0x82, 0x00, 0xaf, 0x00, 0xb9, 0x00, 0xc7, 0xfd, 0x66, 0x00, 
-0x92, 0x00, 0x04, 0xfd, 0xdc, 0x01, 0x6c, 0x00, 0x70, 0xff, 0xac, 0x01, 0xa4, 0xfe, 0xd8, 0x00, 
-0x3c, 0xff, 0xa1, 0xff, 0x43, 0x01, 0x3d, 0xfe, 0x7d, 0x01, 0xec, 0x01, 0x1a, 0xfa, 0xdc, 0x05, 
-0x56, 0xfc, 0xd5, 0xfe, 0x78, 0x02, 0x47, 0xfc, 0x88, 0x02, 0x7f, 0x00, 0x8f, 0xfc, 0x30, 0x02, 
-0xde, 0xfe, 0xc3, 0xff, 0x90, 0x01, 0x04, 0xfe, 0x31, 0x03, 0x7a, 0xfd, 0x08, 0x00, 0xc1, 0x00, 
-0xae, 0xfe, 0x42, 0x02, 0xe1, 0xfb, 0x75, 0xff, 0x46, 0x04, 0x21, 0xfb, 0xe6, 0x01, 0x61, 0x01, 
-0x83, 0xfe, 0x30, 0x01, 0xa0, 0xfe, 0xf2, 0xfe, 0x08, 0x03, 0x31, 0xfe, 0x87, 0x00, 0xff, 0x01, 
-0x36, 0xfe, 0x44, 0x00, 0x8d, 0x00, 0x1e, 0xfd, 0x0f, 0x02, 0xf8, 0x00, 0x08, 0xfd, 0x0d, 0x03, 
-0x13, 0x01, 0x82, 0xfa, 0xbd, 0x04, 0x31, 0x00, 0xdb, 0xfc, 0x14, 0x03, 0x7a, 0xfc, 0xfb, 0x00, 
-0xd4, 0x04, 0x73, 0xfd, 0x9e, 0xfd, 0xf4, 0x03, 0x6a, 0xfa, 0x94, 0x00, 0xcc, 0x01, 0x34, 0xff, 
-0xa5, 0x01, 0x2e, 0x01, 0x2e, 0xff, 0x97, 0x01, 0x4c, 0x00, 0xbf, 0xfc, 0x09, 0x00, 0x5e, 0xff, 
-0xf8, 0xfe, 0x74, 0x01, 0xdc, 0x02, 0xa6, 0xfd, 0xc0, 0x01, 0xed, 0x01, 0xb1, 0xfc, 0x7c, 0x00, 
-0xa5, 0xff, 0x1e, 0xfc, 0x81, 0x02, 0x8c, 0x01, 0x10, 0x00, 0x85, 0x01, 0xa5, 0x00, 0x73, 0xff, 
-0xe2, 0xfd, 0xd7, 0x00, 0x81, 0x00, 0x72, 0xfd, 0xb9, 0x02, 0x17, 0x01, 0xb9, 0xfa, 0xff, 0x01, 
-0xb4, 0x01, 0xfd, 0xfb, 0x29, 0x02, 0xc2, 0x00, 0x57, 0x00, 0x9b, 0x01, 0x66, 0xfc, 0xda, 0xfd, 
-0xdc, 0x03, 0xde, 0xff, 0xe4, 0xff, 0x14, 0x02, 0x4d, 0x00, 0xf0, 0x00, 0x52, 0xfc, 0xe4, 0xfe, 
-0x35, 0x02, 0x27, 0x00, 0x00, 0xfc, 0xc1, 0x02, 0xb5, 0x03, 0x0d, 0xfd, 0x92, 0xff, 0x51, 0x02, 
-0x99, 0xfd, 0xe8, 0x01, 0x01, 0x01, 0xbf, 0xfb, 0x87, 0x03, 0x3e, 0x01, 0x50, 0xfc, 0x1f, 0xff, 
-0xa7, 0x01, 0x24, 0xfe, 0xff, 0xfb, 0x45, 0x01, 0xc9, 0x00, 0x7e, 0xff, 0x7e, 0x04, 0x62, 0x00, 
-0x13, 0x00, 0x14, 0x02, 0x23, 0xfd, 0xbd, 0xfe, 0x07, 0xff, 0x53, 0x00, 0x2d, 0x02, 0xa7, 0xfd, 
-0x98, 0x01, 0xa2, 0x00, 0x2e, 0xfd, 0x65, 0x01, 0x4b, 0xff, 0x64, 0x00, 0xbb, 0x00, 0x52, 0x00, 
-0xd9, 0x03, 0xdd, 0xfc, 0xe7, 0xfe, 0x89, 0x03, 0x7d, 0xfa, 0xc8, 0xff, 0xda, 0x03, 0x4f, 0xff, 
-0x7e, 0x02, 0x93, 0xff, 0xa4, 0xfd, 0x4f, 0x01, 0x36, 0xfe, 0xbe, 0xfd, 0xb5, 0xff, 0xc9, 0x02, 
-0x7b, 0x01, 0xba, 0xfc, 0xd8, 0xfe, 0xce, 0x02, 0xe3, 0xfd, 0x69, 0xfa, 0xbb, 0x02, 0x70, 0x02, 
-0xc5, 0xfc, 0x3e, 0x01, 0x6e, 0x01, 0xbc, 0xfe, 0x4e, 0x02, 0xc2, 0xfe, 0x39, 0xff, 0x8a, 0x01, 
-0xa4, 0xfe, 0x85, 0x00, 0xf5, 0xff, 0x9e, 0xff, 0x9f, 0x01, 0x39, 0x00, 0xb0, 0x01, 0x6d, 0x00, 
-0xed, 0xff, 0x9a, 0x01, 0x10, 0x00, 0x85, 0xfe, 0xd7, 0xfd, 0xd4, 0x00, 0x15, 0x00, 0x27, 0xfe, 
-0xe5, 0x01, 0xb4, 0x02, 0xb4, 0xfe, 0xaa, 0x00, 0x57, 0xfe, 0x88, 0xfe, 0xad, 0xff, 0x01, 0x00, 
-0x62, 0x00, 0x8a, 0x01, 0x83, 0x01, 0xbb, 0xfd, 0xf8, 0xff, 0x00, 0xff, 0x79, 0xfc, 0x21, 0x01, 
-0x8e, 0x02, 0xc0, 0xfe, 0x45, 0x03, 0x98, 0x00, 0xd6, 0xfd, 0x77, 0x00, 0x64, 0x01, 0x37, 0xfe, 
-0xcb, 0xfe, 0x2c, 0x04, 0x5f, 0x04, 0xa3, 0xff, 0x51, 0xfe, 0xd1, 0xff, 0x66, 0xfe, 0x6b, 0xff, 
-0x80, 0xfe, 0xea, 0xff, 0x90, 0x03, 0x0b, 0x02, 0x18, 0xfe, 0x80, 0x01, 0x77, 0x02, 0x94, 0xfb, 
-0x05, 0xfc, 0xcb, 0xff, 0x35, 0xff, 0x23, 0xfd, 0x6f, 0xff, 0xa7, 0x00, 0xf9, 0x00, 0x32, 0x01, 
-0x23, 0x01, 0x9e, 0x02, 0x85, 0x01, 0xd7, 0xfc, 0xaf, 0xfb, 0x2b, 0x01, 0x01, 0xfe, 0x71, 0xfd, 
-0xf1, 0x00, 0x24, 0x00, 0xa2, 0x02, 0x81, 0x05, 0x98, 0xfc, 0xd1, 0xfa, 0x6a, 0x02, 0x20, 0xfe, 
-0xcb, 0xfb, 0x88, 0x00, 0x4c, 0x00, 0xf6, 0x00, 0x0a, 0x05, 0xe4, 0xfd, 0xb2, 0xfe, 0x73, 0x03, 
-0x2b, 0x01, 0x9c, 0xfd, 0x6e, 0x01, 0x14, 0x03, 0x4c, 0xfe, 0x90, 0xff, 0xc7, 0x00, 0x33, 0xfe, 
-0x1d, 0x01, 0xa0, 0x02, 0x27, 0xfd, 0x8a, 0x01, 0x8a, 0xff, 0x5a, 0xff, 0xc0, 0x00, 0x4b, 0xfd, 
-0xb9, 0xfc, 0xf5, 0x01, 0x71, 0x00, 0x97, 0xfd, 0x85, 0x02, 0xf4, 0x02, 0x6f, 0x01, 0xb9, 0x01, 
-0x7b, 0x00, 0x8a, 0xfd, 0xf1, 0xff, 0xf9, 0xfd, 0x90, 0xfe, 0x73, 0x01, 0xec, 0xff, 0x91, 0xfd, 
-0x53, 0xfe, 0x72, 0x00, 0x89, 0xfe, 0x2c, 0xfe, 0x9d, 0x01, 0x4e, 0x02, 0x25, 0x01, 0x92, 0x02, 
-0x2d, 0x00, 0xd6, 0xfc, 0xf3, 0x00, 0x69, 0x02, 0xed, 0xff, 0xa5, 0x03, 0xd1, 0x03, 0xc6, 0xff, 
-0x19, 0x01, 0x55, 0x02, 0xd1, 0xfe, 0xc2, 0xfd, 0x3a, 0x00, 0xf4, 0x00, 0x04, 0x02, 0x96, 0x00, 
-0x34, 0xfc, 0x82, 0xfd, 0x5b, 0xfc, 0x77, 0xf6, 0x72, 0xf6, 0xde, 0xf7, 0x88, 0xfa, 0x29, 0xfb, 
-0xff, 0xf6, 0x21, 0xf9, 0xdf, 0x00, 0xdd, 0x00, 0xfc, 0xfe, 0xc3, 0x04, 0x11, 0x0a, 0xb8, 0x0a, 
-0x1a, 0x0c, 0x73, 0x0a, 0x4b, 0x08, 0x54, 0x0b, 0xe3, 0x0d, 0x2b, 0x09, 0x0b, 0x08, 0x0a, 0x0c, 
-0xf1, 0x06, 0x7f, 0x04, 0x88, 0x05, 0x37, 0x02, 0xd5, 0xfe, 0x14, 0xfd, 0x9e, 0xf9, 0xb3, 0xf6, 
-0x8a, 0xf4, 0x4b, 0xf0, 0x14, 0xec, 0xb9, 0xec, 0x6e, 0xeb, 0x4a, 0xe8, 0xed, 0xea, 0xcc, 0xec, 
-0xdf, 0xf3, 0x48, 0xfc, 0x48, 0x02, 0xeb, 0x06, 0x55, 0x08, 0xe9, 0x0a, 0x6b, 0x0c, 0xb0, 0x0c, 
-0x0d, 0x0b, 0x91, 0x0b, 0xb5, 0x0f, 0x3f, 0x12, 0x51, 0x0f, 0xb2, 0x0c, 0x9b, 0x0d, 0xc8, 0x0d, 
-0x3c, 0x0c, 0x09, 0x0c, 0x63, 0x09, 0xc0, 0x05, 0x51, 0x03, 0x81, 0xfe, 0xb9, 0xf8, 0x9f, 0xf5, 
-0xac, 0xf4, 0x72, 0xf6, 0x56, 0xf8, 0x01, 0xf5, 0x66, 0xf0, 0x2c, 0xee, 0xdd, 0xea, 0xe5, 0xe4, 
-0xbb, 0xe1, 0xcd, 0xe4, 0xe9, 0xf0, 0x5f, 0xfd, 0x85, 0x04, 0x39, 0x07, 0x28, 0x0a, 0x88, 0x0b, 
-0x54, 0x09, 0x27, 0x07, 0x27, 0x09, 0x2c, 0x0c, 0xad, 0x0e, 0x79, 0x0e, 0x6e, 0x0c, 0x30, 0x0c, 
-0xac, 0x09, 0x6f, 0x0a, 0xd9, 0x0b, 0x03, 0x0c, 0x52, 0x0c, 0x96, 0x09, 0x3d, 0x05, 0xd0, 0x01, 
-0xa2, 0xfe, 0x6a, 0xfb, 0xee, 0xf9, 0x13, 0xfd, 0xb7, 0xfc, 0x65, 0xfc, 0xd5, 0xff, 0x8a, 0xfb, 
-0xaf, 0xf3, 0xba, 0xee, 0x2f, 0xec, 0x03, 0xe8, 0x20, 0xe6, 0xfc, 0xe3, 0xa0, 0xea, 0xb8, 0xfc, 
-0x39, 0x03, 0x11, 0x02, 0x27, 0x02, 0x16, 0x05, 0xcb, 0x06, 0xfa, 0x06, 0x9b, 0x07, 0x6b, 0x0a, 
-0x86, 0x0d, 0xea, 0x0c, 0x72, 0x09, 0x37, 0x08, 0x99, 0x08, 0xf1, 0x08, 0x0a, 0x0a, 0x83, 0x09, 
-0xa8, 0x0b, 0xa2, 0x0b, 0x1a, 0x09, 0xb0, 0x04, 0x07, 0x02, 0x66, 0x01, 0x4e, 0x00, 0xef, 0xff, 
-0x3c, 0x01, 0xa7, 0x01, 0xf4, 0xfd, 0x73, 0xfd, 0xd1, 0xfa, 0xc9, 0xf2, 0x18, 0xec, 0x23, 0xe8, 
-0x68, 0xe4, 0x6f, 0xe1, 0x0a, 0xe6, 0x73, 0xf2, 0x0c, 0xff, 0x49, 0x02, 0xeb, 0x00, 0xda, 0x02, 
-0xd6, 0x05, 0xf7, 0x05, 0xd2, 0x06, 0x83, 0x09, 0xbd, 0x0c, 0x07, 0x0e, 0x4c, 0x0b, 0x10, 0x09, 
-0xd6, 0x08, 0x75, 0x09, 0x9c, 0x09, 0xe9, 0x09, 0xf4, 0x09, 0x7f, 0x09, 0x59, 0x09, 0xd9, 0x07, 
-0xd3, 0x01, 0x5e, 0xff, 0xe7, 0x00, 0x95, 0x00, 0x6b, 0x00, 0xf0, 0x01, 0x20, 0x02, 0x40, 0xfc, 
-0xbb, 0xf9, 0xfc, 0xfa, 0x4f, 0xf5, 0x6a, 0xec, 0x15, 0xe7, 0xf4, 0xe3, 0x20, 0xe2, 0xc5, 0xe8, 
-0x84, 0xf5, 0x17, 0xff, 0xa1, 0x01, 0x8c, 0x01, 0x77, 0x03, 0x1e, 0x06, 0xb2, 0x05, 0x8d, 0x06, 
-0xb3, 0x0a, 0x8e, 0x0e, 0x38, 0x0f, 0xfe, 0x0b, 0xe0, 0x08, 0xb3, 0x07, 0x08, 0x08, 0xea, 0x07, 
-0x12, 0x09, 0x08, 0x0b, 0xdb, 0x09, 0x59, 0x07, 0x01, 0x06, 0xee, 0x01, 0x6f, 0xff, 0x6d, 0x00, 
-0x68, 0x01, 0x27, 0x01, 0x1a, 0x02, 0x17, 0x03, 0x93, 0x00, 0x5a, 0xfa, 0x37, 0xf8, 0xee, 0xf5, 
-0x43, 0xee, 0x2c, 0xe8, 0x35, 0xe3, 0xa8, 0xe2, 0x1b, 0xe9, 0xbf, 0xf3, 0xe2, 0xfb, 0x3f, 0x00, 
-0x28, 0x02, 0x06, 0x04, 0x53, 0x06, 0xaa, 0x06, 0x0b, 0x07, 0xed, 0x0a, 0xb5, 0x0e, 0x06, 0x0d, 
-0xcb, 0x0a, 0xcc, 0x09, 0x0d, 0x08, 0x6e, 0x06, 0x9c, 0x06, 0x14, 0x08, 0x70, 0x09, 0xf0, 0x08, 
-0x58, 0x05, 0x14, 0x03, 0xf4, 0x02, 0x08, 0x03, 0xda, 0x00, 0x7d, 0x00, 0x48, 0x02, 0x44, 0x03, 
-0x16, 0x04, 0x58, 0x03, 0x8f, 0xff, 0x47, 0xfa, 0x2c, 0xf8, 0x25, 0xf3, 0x18, 0xec, 0xeb, 0xe5, 
-0xc2, 0xe2, 0x23, 0xe6, 0x31, 0xed, 0x7b, 0xf6, 0x2d, 0xfe, 0xb7, 0x00, 0x8e, 0x02, 0xcc, 0x05, 
-0xb9, 0x05, 0x58, 0x06, 0x09, 0x09, 0xcd, 0x0b, 0x9a, 0x0b, 0xee, 0x0a, 0xcb, 0x0a, 0x8a, 0x07, 
-0x70, 0x06, 0x8f, 0x06, 0x7d, 0x06, 0x0b, 0x08, 0x57, 0x09, 0xca, 0x07, 0xe5, 0x05, 0x91, 0x05, 
-0x6e, 0x04, 0x8c, 0x00, 0xb9, 0xfe, 0x75, 0x01, 0x38, 0x03, 0x5e, 0x03, 0x0d, 0x03, 0x2e, 0x02, 
-0x1f, 0xff, 0xee, 0xfa, 0xf0, 0xf4, 0xdc, 0xed, 0x5d, 0xea, 0xe9, 0xe4, 0x7c, 0xe1, 0x61, 0xe8, 
-0x4c, 0xf3, 0xf5, 0xfa, 0xa2, 0xfd, 0x9b, 0x00, 0xa3, 0x03, 0xfb, 0x05, 0x07, 0x07, 0xd2, 0x06, 
-0x17, 0x0a, 0xde, 0x0d, 0xf7, 0x0c, 0xa8, 0x0a, 0xfb, 0x09, 0xb8, 0x08, 0x96, 0x07, 0x1a, 0x06, 
-0x28, 0x06, 0x46, 0x08, 0x77, 0x08, 0xb3, 0x04, 0x20, 0x03, 0xfb, 0x04, 0xa4, 0x02, 0x05, 0xff, 
-0xdf, 0x00, 0x0e, 0x03, 0xc2, 0x02, 0x90, 0x03, 0x04, 0x04, 0xfd, 0x01, 0xb9, 0xfe, 0x8a, 0xf9, 
-0xdf, 0xf2, 0x16, 0xee, 0x04, 0xe9, 0xd9, 0xe2, 0x56, 0xe4, 0xc4, 0xeb, 0x9b, 0xf3, 0xe6, 0xfa, 
-0x70, 0xfe, 0x77, 0x00, 0xdf, 0x02, 0xb3, 0x06, 0x01, 0x07, 0x6a, 0x08, 0xb5, 0x0c, 0xfe, 0x0e, 
-0x97, 0x0d, 0x68, 0x0b, 0xf5, 0x09, 0xe5, 0x07, 0x9a, 0x06, 0xdd, 0x05, 0x25, 0x06, 0x3a, 0x06, 
-0x74, 0x05, 0xf9, 0x03, 0x6c, 0x04, 0x1b, 0x04, 0x26, 0x02, 0x27, 0x00, 0xf2, 0x01, 0xaa, 0x03, 
-0x5f, 0x03, 0x25, 0x04, 0xe0, 0x03, 0xb3, 0x01, 0x3d, 0xfd, 0xdf, 0xf7, 0xe6, 0xf1, 0xe4, 0xec, 
-0x37, 0xe8, 0x24, 0xe2, 0x5f, 0xe1, 0x80, 0xeb, 0xa3, 0xf6, 0x0c, 0xfa, 0x57, 0xfb, 0x3e, 0x02, 
-0xf0, 0x06, 0x74, 0x05, 0x11, 0x06, 0xcc, 0x0a, 0xf1, 0x0e, 0x96, 0x0e, 0x69, 0x0c, 0xe1, 0x0b, 
-0xd9, 0x0b, 0x67, 0x09, 0x5d, 0x06, 0x21, 0x06, 0x80, 0x07, 0x88, 0x06, 0x09, 0x05, 0x72, 0x04, 
-0x62, 0x04, 0x9f, 0x03, 0x8f, 0x00, 0xae, 0xff, 0x43, 0x02, 0xda, 0x02, 0xdd, 0x02, 0x43, 0x04, 
-0x39, 0x04, 0x9e, 0x00, 0x8b, 0xfb, 0x81, 0xf8, 0x8f, 0xf2, 0x3b, 0xee, 0x3c, 0xe7, 0x4c, 0xe1, 
-0xac, 0xe5, 0x8e, 0xed, 0xa7, 0xf3, 0x07, 0xf7, 0xf9, 0xff, 0xd3, 0x03, 0x7d, 0x03, 0x33, 0x06, 
-0x94, 0x09, 0x97, 0x0b, 0x28, 0x0c, 0x71, 0x0e, 0xa8, 0x0c, 0x37, 0x0c, 0xb9, 0x0a, 0x96, 0x08, 
-0xc0, 0x07, 0x01, 0x07, 0x04, 0x07, 0x2c, 0x05, 0xed, 0x05, 0x9b, 0x03, 0x84, 0x02, 0xfe, 0x02, 
-0x1e, 0x01, 0x79, 0xff, 0xf9, 0xff, 0x8c, 0x03, 0x50, 0x03, 0xb7, 0x02, 0x14, 0x03, 0x85, 0x01, 
-0xa4, 0xfc, 0x4d, 0xf8, 0x22, 0xf4, 0x6c, 0xee, 0x5d, 0xe8, 0xc1, 0xe3, 0x8e, 0xe5, 0x4b, 0xeb, 
-0x7e, 0xf2, 0xe4, 0xf6, 0xde, 0xfc, 0x15, 0x03, 0xa4, 0x04, 0x0d, 0x07, 0xe1, 0x09, 0x35, 0x0c, 
-0xfd, 0x0c, 0xa1, 0x0d, 0xfa, 0x0c, 0x1e, 0x0c, 0x79, 0x0b, 0x20, 0x09, 0x3a, 0x08, 0x7d, 0x07, 
-0x46, 0x05, 0x33, 0x04, 0xe3, 0x05, 0xe0, 0x03, 0x7a, 0x01, 0x14, 0x04, 0x99, 0x02, 0x2d, 0xff, 
-0x72, 0x01, 0x25, 0x03, 0xdd, 0x01, 0xf0, 0x02, 0x93, 0x03, 0x2c, 0x00, 0x1c, 0xfd, 0x23, 0xfa, 
-0xcb, 0xf2, 0x35, 0xef, 0x1b, 0xeb, 0xa6, 0xe3, 0xa9, 0xe6, 0x60, 0xec, 0xd2, 0xef, 0x1c, 0xf4, 
-0x8a, 0xfc, 0x30, 0x02, 0x87, 0x02, 0x16, 0x07, 0xb6, 0x09, 0x93, 0x0c, 0x96, 0x0d, 0x14, 0x0d, 
-0x8c, 0x0e, 0x32, 0x0d, 0x81, 0x0b, 0xe1, 0x09, 0x56, 0x09, 0x6f, 0x07, 0xb1, 0x04, 0x29, 0x04, 
-0xca, 0x03, 0x3f, 0x03, 0xe0, 0x01, 0xd0, 0x02, 0x1c, 0x02, 0x5d, 0x00, 0xdf, 0x00, 0x53, 0x01, 
-0x64, 0x02, 0x62, 0x02, 0x58, 0x02, 0x4b, 0x00, 0x78, 0xfd, 0xf6, 0xf9, 0x25, 0xf5, 0x17, 0xf2, 
-0x5b, 0xec, 0x2c, 0xe7, 0xc0, 0xe8, 0x61, 0xec, 0xe5, 0xef, 0x03, 0xf4, 0x93, 0xfa, 0xf9, 0xff, 
-0x20, 0x02, 0xc6, 0x04, 0xa4, 0x08, 0xab, 0x0b, 0x56, 0x0c, 0x22, 0x0d, 0xe1, 0x0c, 0x3d, 0x0d, 
-0x14, 0x0d, 0x6b, 0x0b, 0x23, 0x0a, 0x7c, 0x08, 0x6b, 0x05, 0xc3, 0x02, 0x09, 0x04, 0x7b, 0x02, 
-0x6a, 0x00, 0x5c, 0x02, 0xb5, 0x01, 0x62, 0x00, 0xc6, 0x00, 0xd7, 0x01, 0x2c, 0x02, 0x00, 0x02, 
-0x6f, 0x02, 0xa7, 0x00, 0xa5, 0xfd, 0x11, 0xfb, 0x0c, 0xf8, 0xf1, 0xf4, 0x17, 0xf0, 0xb7, 0xeb, 
-0x8d, 0xeb, 0xcf, 0xeb, 0x46, 0xee, 0x01, 0xf2, 0x0d, 0xf7, 0x61, 0xfc, 0x02, 0xfe, 0x8c, 0x01, 
-0x1b, 0x05, 0xc6, 0x08, 0xd6, 0x0a, 0xac, 0x0a, 0xda, 0x0c, 0x47, 0x0d, 0x8b, 0x0c, 0x82, 0x0c, 
-0x53, 0x0c, 0xe0, 0x0b, 0x08, 0x09, 0xbe, 0x07, 0xee, 0x05, 0x79, 0x03, 0x92, 0x03, 0xcc, 0x01, 
-0x58, 0x01, 0xdd, 0x00, 0x89, 0x00, 0x95, 0x01, 0xb3, 0x01, 0x87, 0x02, 0x5b, 0x01, 0xa3, 0xff, 
-0x18, 0xfe, 0x3a, 0xfb, 0x62, 0xf9, 0x69, 0xf6, 0xf2, 0xf2, 0x32, 0xee, 0x74, 0xeb, 0x7a, 0xed, 
-0x10, 0xed, 0xc6, 0xee, 0xf6, 0xf3, 0x63, 0xf7, 0x68, 0xf9, 0x35, 0xfd, 0xaf, 0x02, 0x45, 0x06, 
-0x5e, 0x09, 0x3f, 0x0b, 0xd9, 0x0c, 0xac, 0x0e, 0x75, 0x0e, 0x24, 0x0e, 0x2a, 0x0e, 0xce, 0x0c, 
-0x9c, 0x0a, 0xf4, 0x08, 0x74, 0x06, 0x47, 0x04, 0x28, 0x03, 0xac, 0x01, 0x13, 0x00, 0x5e, 0xfe, 
-0x9a, 0xfd, 0x16, 0xfe, 0x42, 0xfe, 0x24, 0xfe, 0x44, 0xfe, 0xac, 0xfe, 0xdd, 0xfe, 0x35, 0xfd, 
-0x8c, 0xfb, 0xdb, 0xfa, 0x82, 0xf8, 0x34, 0xf4, 0x26, 0xf2, 0xd8, 0xf3, 0x14, 0xf4, 0xd8, 0xf3, 
-0xd0, 0xf5, 0xa4, 0xf8, 0x08, 0xfc, 0x30, 0xfd, 0x16, 0xff, 0xa5, 0x02, 0xeb, 0x05, 0x39, 0x09, 
-0xe1, 0x0a, 0xaf, 0x0c, 0x30, 0x0e, 0x22, 0x0e, 0x18, 0x0d, 0xd7, 0x0a, 0x71, 0x09, 0xe3, 0x08, 
-0x13, 0x07, 0x75, 0x04, 0x03, 0x02, 0xed, 0x00, 0x65, 0x00, 0xc2, 0xfe, 0x1a, 0xfd, 0x60, 0xfc, 
-0x00, 0xfd, 0x08, 0xfd, 0x47, 0xfd, 0x74, 0xfe, 0xa8, 0xfe, 0xab, 0xfe, 0xda, 0xfd, 0x3e, 0xfc, 
-0x57, 0xfa, 0x02, 0xf8, 0x02, 0xf6, 0xd9, 0xf3, 0x64, 0xf4, 0x30, 0xf6, 0x28, 0xf6, 0x4b, 0xf7, 
-0x72, 0xf9, 0xa0, 0xfc, 0x9d, 0xfe, 0x3c, 0xff, 0xd0, 0x01, 0x1b, 0x05, 0xb5, 0x07, 0x82, 0x09, 
-0x72, 0x0a, 0x7a, 0x0b, 0x5a, 0x0c, 0x16, 0x0c, 0xe9, 0x09, 0x21, 0x07, 0x26, 0x06, 0xa7, 0x04, 
-0x4b, 0x02, 0x9b, 0xff, 0x6d, 0xff, 0xe3, 0xff, 0x20, 0xfe, 0x20, 0xfd, 0x27, 0xfd, 0x9f, 0xfe, 
-0x04, 0xff, 0x56, 0xfe, 0xd3, 0xfe, 0x01, 0x00, 0xdc, 0xff, 0x43, 0xfd, 0xa9, 0xfb, 0xb7, 0xf9, 
-0xa6, 0xf6, 0x89, 0xf4, 0x6b, 0xf4, 0x0c, 0xf8, 0x3e, 0xf9, 0xff, 0xf8, 0xf9, 0xfa, 0x4a, 0xfe, 
-0x2a, 0x01, 0xad, 0x01, 0xea, 0x02, 0xf6, 0x04, 0x1a, 0x07, 0xb4, 0x07, 0xf8, 0x07, 0x48, 0x09, 
-0xc7, 0x09, 0xd0, 0x09, 0x45, 0x08, 0xcd, 0x05, 0x5a, 0x04, 0xe0, 0x02, 0x90, 0x00, 0x26, 0xfe, 
-0xca, 0xfc, 0x8a, 0xfc, 0x65, 0xfe, 0x3d, 0xff, 0xb9, 0xfe, 0x64, 0x00, 0x6d, 0x02, 0x13, 0x03, 
-0xcb, 0x02, 0x27, 0x04, 0x7f, 0x04, 0xe1, 0x01, 0xac, 0xfd, 0xf2, 0xf9, 0x2f, 0xf4, 0xbf, 0xed, 
-0xce, 0xf1, 0xad, 0xf7, 0xff, 0xf7, 0x0d, 0xf7, 0x8e, 0xfa, 0x8e, 0x01, 0xcd, 0x00, 0x52, 0xff, 
-0x61, 0x01, 0xf8, 0x05, 0x5e, 0x08, 0x89, 0x05, 0x44, 0x06, 0x78, 0x08, 0x74, 0x0b, 0x66, 0x09, 
-0x67, 0x05, 0xe6, 0x06, 0x35, 0x06, 0x61, 0x02, 0x91, 0xfc, 0x41, 0xfa, 0xbf, 0xf9, 0xef, 0xf7, 
-0xe3, 0xf7, 0x73, 0xf9, 0x7b, 0xfc, 0xc4, 0xfe, 0x98, 0xff, 0xbb, 0x01, 0x24, 0x06, 0xde, 0x09, 
-0x49, 0x09, 0xdc, 0x06, 0xf2, 0x06, 0xff, 0x05, 0xa0, 0x01, 0x91, 0xfd, 0x10, 0xfc, 0x12, 0xfc, 
-0x6a, 0xfb, 0x45, 0xf7, 0x2c, 0xf5, 0xbb, 0xf4, 0xf3, 0xf3, 0xaa, 0xf4, 0x66, 0xf8, 0x5c, 0xfd, 
-0x15, 0xff, 0x4a, 0xff, 0x21, 0x00, 0x78, 0x04, 0xc5, 0x05, 0xe0, 0x05, 0x30, 0x07, 0x1e, 0x09, 
-0x61, 0x0a, 0xfb, 0x07, 0xe5, 0x06, 0xca, 0x05, 0xa6, 0x05, 0x7c, 0x04, 0x34, 0x01, 0x72, 0xfd, 
-0x68, 0xfb, 0x46, 0xfb, 0x1c, 0xf9, 0x4b, 0xf8, 0xd3, 0xf8, 0x82, 0xf8, 0x15, 0xf9, 0xb6, 0xf6, 
-0x0c, 0xf7, 0xba, 0xf8, 0x76, 0xfc, 0xda, 0x04, 0x97, 0x06, 0xe0, 0x04, 0x77, 0x03, 0x84, 0x05, 
-0xe2, 0x04, 0xa5, 0x00, 0xf7, 0xfe, 0x64, 0x00, 0xf1, 0x03, 0x3a, 0x03, 0x6d, 0x00, 0x53, 0x00, 
-0x47, 0x02, 0x1d, 0x03, 0x65, 0x02, 0x44, 0x01, 0xfe, 0xff, 0x48, 0xfe, 0x86, 0xfb, 0x9b, 0xfa, 
-0xca, 0xfc, 0x33, 0xff, 0xbb, 0x00, 0x65, 0x01, 0x46, 0x01, 0xe1, 0x02, 0x10, 0x04, 0xb0, 0x02, 
-0x9e, 0x01, 0x78, 0x01, 0x9b, 0x01, 0x24, 0x02, 0x10, 0x01, 0xe4, 0xff, 0xa0, 0x03, 0x06, 0x07, 
-0x5e, 0x05, 0x6b, 0x02, 0xc8, 0x03, 0x77, 0x05, 0x19, 0x02, 0xfb, 0xfd, 0x21, 0xfb, 0x28, 0xfb, 
-0x71, 0xfa, 0xaf, 0xf7, 0xa3, 0xf2, 0x9f, 0xf2, 0x84, 0xeb, 0xf5, 0xf2, 0x6d, 0x08, 0xb2, 0x07, 
-0x5d, 0xff, 0x53, 0xf8, 0x19, 0xfc, 0xd2, 0x04, 0x02, 0x04, 0x4a, 0xff, 0xfd, 0x02, 0x85, 0x07, 
-0x95, 0x09, 0xde, 0x03, 0x42, 0xff, 0xe8, 0x03, 0x1e, 0x08, 0x30, 0x09, 0x35, 0x04, 0x7f, 0xfd, 
-0x18, 0xfc, 0xfe, 0xfb, 0xb7, 0xf9, 0x8e, 0xfa, 0x39, 0xfe, 0xf8, 0x03, 0x80, 0x05, 0x12, 0x02, 
-0x6f, 0x00, 0xaf, 0x00, 0x4e, 0x01, 0xc5, 0x01, 0x27, 0x02, 0x89, 0x03, 0x4b, 0x04, 0x0f, 0x03, 
-0xad, 0xff, 0x42, 0xfd, 0x55, 0xfd, 0x84, 0xfe, 0x67, 0xfe, 0x7b, 0xfe, 0xa1, 0xfd, 0x83, 0xfc, 
-0x57, 0xfc, 0x58, 0xfc, 0x2f, 0xfd, 0x66, 0xfd, 0xe1, 0xff, 0xaa, 0x02, 0x7b, 0x02, 0x49, 0x00, 
-0x64, 0xfe, 0x16, 0xff, 0x70, 0xff, 0x3b, 0xff, 0xe7, 0x00, 0xd7, 0x01, 0xc7, 0x00, 0xec, 0xff, 
-0xa6, 0xfe, 0xbe, 0xfd, 0x3e, 0xff, 0xbc, 0xff, 0xe5, 0x00, 0xfc, 0x00, 0x57, 0x00, 0xcd, 0x00, 
-0xf1, 0x00, 0x53, 0x01, 0x51, 0x01, 0x54, 0x02, 0x27, 0x03, 0xee, 0x02, 0x0c, 0x02, 0x3e, 0x00, 
-0xe1, 0xfe, 0x9d, 0xfe, 0x9b, 0xfe, 0x9d, 0xff, 0xd5, 0xff, 0x61, 0xfe, 0x11, 0xfe, 0xe6, 0xfc, 
-0xd6, 0xfc, 0x09, 0xfe, 0xcf, 0xfd, 0x6e, 0xfe, 0xf3, 0xfe, 0x6d, 0xff, 0x73, 0xff, 0x16, 0xff, 
-0xb8, 0xff, 0x92, 0x00, 0x51, 0x01, 0xd4, 0x01, 0x6d, 0x01, 0x9c, 0x00, 0x8d, 0x00, 0x13, 0x01, 
-0xc1, 0x00, 0x78, 0x00, 0x46, 0x00, 0xfb, 0xff, 0x3c, 0x00, 0xf4, 0xff, 0xcb, 0xff, 0x23, 0x00, 
-0x2f, 0x00, 0x06, 0x00, 0x7f, 0x00, 0x0b, 0x01, 0xa4, 0x00, 0x34, 0x00, 0xa1, 0x00, 0x61, 0x01, 
-0xc3, 0x00, 0x30, 0x00, 0x07, 0x00, 0xc5, 0xff, 0xbb, 0xff, 0x5c, 0xff, 0xda, 0xfe, 0x34, 0xfe, 
-0x21, 0xfe, 0xaa, 0xfe, 0xbd, 0xfe, 0x48, 0xff, 0x49, 0x00, 0x22, 0x00, 0x79, 0xff, 0xc5, 0xff, 
-0xe3, 0x00, 0x35, 0x01, 0x6c, 0x01, 0xd5, 0x00, 0xbd, 0x00, 0x9f, 0x01, 0x64, 0x01, 0x18, 0x01, 
-0x0d, 0x01, 0x07, 0x01, 0xa8, 0x00, 0x01, 0x00, 0xee, 0xff, 0xd2, 0xff, 0x00, 0x00, 0x20, 0x00, 
-0x51, 0xff, 0x53, 0xff, 0x6d, 0xff, 0x5b, 0x00, 0x85, 0x00, 0x82, 0x00, 0x25, 0x01, 0x7e, 0x00, 
-0x34, 0x00, 0x96, 0xff, 0xe5, 0xff, 0x9d, 0xff, 0x0e, 0xff, 0x73, 0xff, 0x45, 0xff, 0x58, 0xff, 
-0x25, 0xff, 0x1b, 0xff, 0x49, 0xff, 0x75, 0xff, 0x5e, 0xff, 0x07, 0xff, 0x4e, 0xff, 0xa4, 0xff, 
-0x78, 0xff, 0x67, 0x00, 0xac, 0xff, 0xab, 0x02, 0x14, 0x05, 0x44, 0x03, 0xd6, 0xff, 0x8b, 0xfb, 
-0x2c, 0xfe, 0xfb, 0x00, 0x32, 0x02, 0x3b, 0x01, 0x5a, 0xfe, 0xff, 0xfe, 0x0b, 0xff, 0x40, 0xff, 
-0xe1, 0xfe, 0x8b, 0xfe, 0xad, 0x00, 0x63, 0x00, 0x9e, 0xff, 0xb5, 0xfd, 0xe3, 0xfc, 0xbf, 0xff, 
-0xb8, 0x02, 0x2a, 0x05, 0xcf, 0x03, 0xd8, 0x00, 0x3a, 0xff, 0x91, 0xfe, 0x0e, 0x00, 0x7a, 0x00, 
-0x53, 0x00, 0x92, 0x00, 0xdd, 0x00, 0x84, 0x01, 0x8e, 0x00, 0x07, 0x00, 0x99, 0xff, 0x59, 0x00, 
-0x05, 0x02, 0x6c, 0x01, 0x6f, 0x00, 0x54, 0xfe, 0xb3, 0xfd, 0xb2, 0xfe, 0x27, 0xff, 0xcc, 0xff, 
-0xab, 0xfe, 0xd6, 0xfd, 0x8b, 0xfe, 0x0b, 0x00, 0x9b, 0x01, 0x65, 0x00, 0xfe, 0xfe, 0x7a, 0xfe, 
-0x84, 0xff, 0xa7, 0x01, 0xdd, 0x01, 0xb5, 0x01, 0xd4, 0x00, 0xa1, 0x00, 0xce, 0x00, 0xcd, 0x00, 
-0x4e, 0x01, 0xac, 0x00, 0x29, 0x01, 0xdd, 0x00, 0x16, 0x00, 0x40, 0xff, 0x04, 0xfe, 0xf3, 0xfe, 
-0xd0, 0xff, 0x54, 0x00, 0x28, 0x00, 0xed, 0xfe, 0x68, 0xfe, 0x98, 0xfe, 0x94, 0xff, 0x7a, 0x00, 
-0x71, 0x00, 0xe8, 0x00, 0xce, 0x00, 0x38, 0x01, 0x38, 0x01, 0xcd, 0x00, 0x59, 0x01, 0x0e, 0x01, 
-0x19, 0x01, 0xf9, 0x00, 0xbb, 0x00, 0x16, 0x00, 0x85, 0xff, 0x6c, 0xff, 0xe7, 0xff, 0x90, 0x00, 
-0x8c, 0x00, 0x53, 0x00, 0xec, 0xff, 0xd0, 0xff, 0x9f, 0xff, 0x84, 0xff, 0xa3, 0xff, 0x03, 0x00, 
-0x91, 0x00, 0xb7, 0x00, 0xed, 0xff, 0x43, 0xff, 0xeb, 0xfe, 0x45, 0xff, 0x82, 0xff, 0x85, 0xff, 
-0xcc, 0xff, 0xab, 0xff, 0x66, 0xff, 0xb1, 0xfe, 0x9b, 0xfe, 0x0d, 0xff, 0x7b, 0xff, 0x7e, 0x00, 
-0x3d, 0x00, 0x58, 0x02, 0x13, 0x05, 0x46, 0x04, 0xaa, 0x01, 0x50, 0xfd, 0x8b, 0xfd, 0x9e, 0xff, 
-0x62, 0x02, 0x0e, 0x03, 0xbd, 0xff, 0x8f, 0xfd, 0xdd, 0xfb, 0xe9, 0xfc, 0x0f, 0xfe, 0xa2, 0xfd, 
-0x85, 0xfd, 0xf1, 0xfc, 0xde, 0xfd, 0x1d, 0xfe, 0xe7, 0xfc, 0x6b, 0xfd, 0x58, 0xff, 0x68, 0x03, 
-0xb2, 0x05, 0x01, 0x04, 0xf9, 0x00, 0x97, 0xfd, 0x2f, 0xfe, 0x56, 0x00, 0x5e, 0x02, 0xee, 0x02, 
-0x3d, 0x01, 0x72, 0x00, 0x9a, 0xff, 0x66, 0xff, 0xfc, 0xfe, 0x6f, 0xfe, 0x1a, 0xff, 0x9e, 0xff, 
-0x76, 0x00, 0x19, 0x00, 0xb3, 0xfe, 0x54, 0xfe, 0xbb, 0xfe, 0xf8, 0x00, 0xd4, 0x02, 0x6c, 0x03, 
-0x84, 0x02, 0x89, 0x00, 0x62, 0xff, 0x25, 0xff, 0xf5, 0xff, 0xb3, 0x00, 0x20, 0x01, 0x09, 0x01, 
-0x3d, 0x00, 0x84, 0xff, 0xa3, 0xfe, 0x7f, 0xfe, 0xa5, 0xfe, 0x5d, 0xff, 0x7b, 0x00, 0xb3, 0x00, 
-0x2b, 0x00, 0x40, 0xff, 0x1c, 0xff, 0x8b, 0xff, 0x59, 0x00, 0xfa, 0x00, 0xcc, 0x00, 0x47, 0x00, 
-0x07, 0xff, 0xa8, 0xfe, 0xdc, 0xfe, 0x1a, 0xff, 0x4c, 0xff, 0x05, 0xff, 0x92, 0xfe, 0xd1, 0xfe, 
-0x0d, 0xff, 0x08, 0x00, 0x0a, 0x00, 0xd0, 0x01, 0x43, 0x04, 0x35, 0x04, 0x93, 0x02, 0x45, 0xfe, 
-0x21, 0xfe, 0xd7, 0xff, 0x0b, 0x03, 0x79, 0x04, 0x99, 0x01, 0xb5, 0xfe, 0x29, 0xfb, 0x91, 0xfb, 
-0x9f, 0xfc, 0x26, 0xfd, 0x5f, 0xfd, 0x20, 0xfb, 0x96, 0xf9, 0x8a, 0xf8, 0x19, 0xfb, 0xee, 0xfe, 
-0x56, 0x02, 0x80, 0x03, 0xe7, 0x01, 0x2b, 0x00, 0x8d, 0xff, 0xc6, 0x01, 0xfd, 0x03, 0xe3, 0x04, 
-0x44, 0x03, 0xce, 0x00, 0x3e, 0x00, 0xfa, 0x00, 0xc9, 0x02, 0xd4, 0x02, 0x65, 0x01, 0x51, 0xff, 
-0xb3, 0xfd, 0xc3, 0xfd, 0x32, 0xfe, 0x73, 0xff, 0x7a, 0xff, 0x20, 0xff, 0x83, 0xff, 0x51, 0x00, 
-0x38, 0x01, 0x48, 0x01, 0x2b, 0x01, 0xbf, 0x00, 0x58, 0x00, 0x91, 0x00, 0xc8, 0x00, 0x8e, 0x01, 
-0x54, 0x01, 0xa4, 0x00, 0xda, 0xff, 0x46, 0xff, 0xad, 0xff, 0xff, 0xff, 0xfb, 0x01, 0x8d, 0x02, 
-0xa2, 0x02, 0x20, 0x01, 0x1b, 0xff, 0xc0, 0xfe, 0xa7, 0xff, 0x2c, 0x02, 0x2d, 0x03, 0x88, 0x02, 
-0xbf, 0xff, 0xdb, 0xfc, 0x76, 0xfb, 0x6d, 0xfb, 0x3a, 0xfc, 0x6d, 0xfc, 0xdf, 0xfb, 0x83, 0xfa, 
-0x18, 0xf9, 0x0a, 0xf8, 0x38, 0xf9, 0xe7, 0xfd, 0x0a, 0x03, 0xc4, 0x05, 0xa9, 0x03, 0xad, 0xff, 
-0x37, 0xfd, 0xc2, 0xfe, 0x6e, 0x03, 0x11, 0x07, 0x7c, 0x07, 0xc8, 0x04, 0x28, 0x01, 0x9c, 0xff, 
-0x7a, 0x00, 0xb8, 0x02, 0xc0, 0x03, 0x39, 0x02, 0x9d, 0xff, 0x3f, 0xfd, 0x9e, 0xfc, 0x2a, 0xfd, 
-0xaa, 0xfe, 0x08, 0x00, 0x07, 0x01, 0x51, 0x01, 0xb0, 0x01, 0xe9, 0x01, 0x9b, 0x02, 0xf5, 0x04, 
-0xa0, 0x05, 0xd6, 0x04, 0x5b, 0x02, 0x85, 0x00, 0x5e, 0x00, 0x92, 0x01, 0x63, 0x02, 0xe6, 0x00, 
-0x28, 0xfe, 0x0e, 0xfb, 0xe7, 0xf9, 0xa2, 0xf9, 0x13, 0xfa, 0x3b, 0xfb, 0xa5, 0xfb, 0x82, 0xfa, 
-0x11, 0xf8, 0xc2, 0xf6, 0x99, 0xf8, 0x65, 0xfe, 0xbc, 0x04, 0xe0, 0x07, 0x01, 0x06, 0x6e, 0x00, 
-0x72, 0xfc, 0x3f, 0xfd, 0x87, 0x02, 0x5f, 0x07, 0x9c, 0x08, 0x9a, 0x05, 0xed, 0x00, 0x1a, 0xfe, 
-0x26, 0xfe, 0x02, 0x01, 0x42, 0x04, 0xb1, 0x04, 0xb4, 0x02, 0x20, 0xff, 0x8b, 0xfd, 0x83, 0xfd, 
-0x4c, 0x00, 0x86, 0x05, 0xa2, 0x07, 0xd8, 0x07, 0x51, 0x03, 0xb5, 0xff, 0x47, 0xfe, 0xfe, 0xfe, 
-0xf1, 0x01, 0x03, 0x02, 0x3a, 0x01, 0x41, 0xfd, 0xc1, 0xf9, 0x42, 0xf8, 0x26, 0xf8, 0xd5, 0xf9, 
-0x6a, 0xfa, 0x17, 0xfa, 0xf9, 0xf7, 0xc8, 0xf5, 0x94, 0xf7, 0xe6, 0xfd, 0x9a, 0x05, 0x45, 0x09, 
-0x44, 0x06, 0x16, 0x01, 0xe1, 0xfc, 0x3d, 0xfe, 0xc2, 0x03, 0xa2, 0x07, 0xf3, 0x07, 0x01, 0x04, 
-0xec, 0xff, 0xca, 0xfe, 0xfd, 0x00, 0x08, 0x03, 0xb1, 0x03, 0xe3, 0x00, 0xcf, 0xfd, 0x14, 0xfc, 
-0x94, 0xfd, 0xd6, 0x03, 0xf6, 0x05, 0x3f, 0x07, 0x83, 0x03, 0xbb, 0x00, 0x4d, 0x00, 0x70, 0x01, 
-0xab, 0x05, 0x68, 0x05, 0x04, 0x04, 0xa2, 0xfe, 0x7c, 0xfa, 0x06, 0xf9, 0x7e, 0xf9, 0x96, 0xfb, 
-0x2b, 0xfa, 0x21, 0xf8, 0x51, 0xf5, 0xf5, 0xf4, 0x09, 0xf7, 0x58, 0xfa, 0xcf, 0xfe, 0xd5, 0x01, 
-0x62, 0x03, 0xea, 0x01, 0x69, 0x00, 0xbf, 0xff, 0xc9, 0x01, 0x20, 0x05, 0xf0, 0x07, 0xff, 0x08, 
-0x2c, 0x07, 0xda, 0x04, 0xbf, 0x02, 0xd0, 0x01, 0x4f, 0x02, 0x54, 0x02, 0x0c, 0x03, 0x20, 0x03, 
-0xe5, 0x03, 0x00, 0x04, 0x1a, 0x02, 0xdc, 0x00, 0x46, 0x00, 0xfd, 0x01, 0x98, 0x02, 0x84, 0x03, 
-0xff, 0x02, 0xd9, 0xff, 0xb5, 0xfc, 0x1e, 0xfa, 0x30, 0xfa, 0x46, 0xfa, 0xa3, 0xf9, 0x2b, 0xf4, 
-0xce, 0xef, 0x3a, 0xe9, 0x98, 0xef, 0xe8, 0x02, 0x1a, 0x12, 0xa1, 0x17, 0xf6, 0x04, 0xbb, 0xf2, 
-0x82, 0xe8, 0x39, 0xf3, 0x9c, 0x0a, 0x7d, 0x19, 0xbd, 0x1c, 0x2b, 0x0c, 0x24, 0xfc, 0x83, 0xf4, 
-0xaa, 0xf9, 0x53, 0x08, 0xa3, 0x0f, 0x01, 0x0e, 0xa0, 0x00, 0x85, 0xf4, 0x7e, 0xef, 0xab, 0xf2, 
-0x09, 0xfb, 0xc8, 0x00, 0xd0, 0x03, 0x49, 0x04, 0xbd, 0x07, 0x38, 0x08, 0x48, 0x06, 0xf5, 0xff, 
-0xc6, 0xfb, 0x44, 0xfe, 0xe6, 0x04, 0x9a, 0x0c, 0xc8, 0x0a, 0x88, 0x01, 0x55, 0xf6, 0xca, 0xef, 
-0x76, 0xf2, 0x7a, 0xf9, 0x39, 0xff, 0x66, 0xfe, 0x92, 0xf8, 0x09, 0xf3, 0xa9, 0xf1, 0x0c, 0xf7, 
-0x77, 0xfe, 0x20, 0x06, 0x82, 0x09, 0x81, 0x07, 0xeb, 0x03, 0x9f, 0x00, 0x29, 0x02, 0xb2, 0x04, 
-0x1f, 0x07, 0xa9, 0x07, 0x54, 0x06, 0x2a, 0x05, 0x34, 0x03, 0xe2, 0x00, 0xa1, 0xfe, 0xd6, 0xfe, 
-0xa3, 0xff, 0xba, 0x00, 0x70, 0x00, 0x02, 0xfe, 0xf8, 0xfa, 0x32, 0xf9, 0x05, 0xfa, 0xc5, 0xfc, 
-0xd0, 0xfe, 0x61, 0xfe, 0x49, 0xfb, 0xc8, 0xf6, 0xab, 0xf3, 0xa7, 0xf3, 0xb8, 0xf6, 0xe7, 0xfa, 
-0x0f, 0x04, 0xba, 0x0c, 0xb4, 0x0f, 0x8a, 0x08, 0xb0, 0xfb, 0x3c, 0xf4, 0x03, 0xf6, 0x11, 0x03, 
-0xbf, 0x0f, 0x62, 0x14, 0x2b, 0x0e, 0x76, 0x02, 0xd7, 0xfb, 0xc5, 0xfc, 0x40, 0x05, 0x7b, 0x0c, 
-0xe5, 0x0c, 0x7f, 0x06, 0x7b, 0xfd, 0x98, 0xf8, 0x4c, 0xf8, 0xe8, 0xfd, 0xc9, 0x06, 0x2c, 0x0d, 
-0x66, 0x0c, 0x98, 0x03, 0x0f, 0xfa, 0x05, 0xf7, 0xb6, 0xfc, 0xf4, 0x04, 0x2d, 0x09, 0x78, 0x07, 
-0xe9, 0xff, 0x3e, 0xf8, 0x3f, 0xf3, 0xe2, 0xf1, 0x64, 0xf3, 0xf9, 0xf2, 0x6a, 0xef, 0x58, 0xeb, 
-0x91, 0xed, 0x3a, 0xf9, 0x34, 0x08, 0x44, 0x11, 0x0b, 0x0d, 0x19, 0x00, 0xaa, 0xf4, 0x72, 0xf3, 
-0x3d, 0xff, 0x8b, 0x0d, 0xd1, 0x14, 0x7d, 0x0f, 0x4c, 0x02, 0x81, 0xf8, 0x99, 0xf8, 0xbc, 0x01, 
-0xa5, 0x0b, 0x00, 0x0f, 0x3b, 0x0a, 0x6a, 0x00, 0xbc, 0xf7, 0x9c, 0xf5, 0xb0, 0xf9, 0x9a, 0x01, 
-0x4f, 0x07, 0x28, 0x0a, 0x6e, 0x09, 0x3d, 0x06, 0x36, 0x03, 0xb5, 0xff, 0xae, 0xfe, 0x51, 0xff, 
-0x6c, 0x01, 0x27, 0x03, 0x26, 0x01, 0x8e, 0xfc, 0xb1, 0xf5, 0xc8, 0xf0, 0xfe, 0xee, 0x01, 0xef, 
-0xf1, 0xf0, 0x25, 0xf2, 0xe4, 0xf5, 0x48, 0xfe, 0x5f, 0x07, 0x3a, 0x0d, 0x25, 0x09, 0x98, 0xfe, 
-0x8a, 0xf6, 0xd1, 0xf8, 0x7f, 0x05, 0xe9, 0x11, 0x19, 0x16, 0x12, 0x0f, 0x18, 0x03, 0x1c, 0xfb, 
-0x4f, 0xfb, 0x4f, 0x02, 0x49, 0x0a, 0xb4, 0x0d, 0x1a, 0x0b, 0x79, 0x03, 0xd4, 0xfb, 0x45, 0xf8, 
-0x6b, 0xfa, 0x84, 0x00, 0xdf, 0x06, 0xc7, 0x0a, 0x57, 0x09, 0x69, 0x03, 0x36, 0xfa, 0x35, 0xf3, 
-0xc4, 0xf1, 0x65, 0xf4, 0x54, 0xf7, 0xee, 0xf1, 0xdf, 0xe7, 0x5c, 0xe1, 0x79, 0xe9, 0xfb, 0x00, 
-0x22, 0x17, 0x8e, 0x1d, 0x88, 0x0c, 0x8a, 0xf2, 0xb0, 0xe3, 0xff, 0xea, 0x01, 0x04, 0xce, 0x19, 
-0xe3, 0x1e, 0x81, 0x11, 0x34, 0xfe, 0xe3, 0xf4, 0x20, 0xfa, 0x0c, 0x08, 0x0f, 0x12, 0x6f, 0x10, 
-0x38, 0x06, 0x8a, 0xfa, 0x59, 0xf5, 0xd7, 0xf6, 0x30, 0xfc, 0x9a, 0x02, 0xf0, 0x06, 0x07, 0x0a, 
-0x5d, 0x09, 0x75, 0x06, 0xca, 0x00, 0xdf, 0xfb, 0x9e, 0xfb, 0xe6, 0xff, 0x07, 0x08, 0xe7, 0x0c, 
-0xc6, 0x0b, 0x0c, 0x05, 0xfb, 0xfa, 0x11, 0xf4, 0xb4, 0xf2, 0x08, 0xf4, 0x5b, 0xf5, 0x43, 0xf2, 
-0x35, 0xee, 0x67, 0xe9, 0xa8, 0xeb, 0xa1, 0xfa, 0x7c, 0x0b, 0x2f, 0x17, 0x10, 0x11, 0xc5, 0x00, 
-0xe7, 0xf1, 0xbd, 0xef, 0x88, 0xfe, 0x0c, 0x0f, 0xc5, 0x18, 0x91, 0x13, 0xec, 0x05, 0xc2, 0xfc, 
-0xc2, 0xfb, 0x5a, 0x03, 0x1e, 0x0a, 0xc9, 0x0b, 0xa9, 0x08, 0x5b, 0x02, 0x91, 0xfe, 0x5f, 0xfc, 
-0xef, 0xfd, 0x3e, 0x01, 0xc3, 0x03, 0x75, 0x05, 0x11, 0x05, 0x95, 0x04, 0xdb, 0x02, 0x56, 0x00, 
-0x3e, 0xfd, 0xa0, 0xfb, 0xaa, 0xfc, 0x5c, 0xfe, 0xa5, 0xfc, 0xe0, 0xf4, 0x1e, 0xe9, 0x64, 0xdf, 
-0xeb, 0xe0, 0x4e, 0xec, 0xc9, 0xfe, 0x71, 0x0e, 0xdd, 0x13, 0xad, 0x0c, 0x71, 0xfc, 0xcf, 0xf0, 
-0xb0, 0xf0, 0xed, 0xfe, 0x6c, 0x11, 0xa0, 0x1a, 0x6b, 0x17, 0xd3, 0x08, 0x29, 0xfa, 0x09, 0xf4, 
-0x5a, 0xf9, 0x46, 0x06, 0x85, 0x0f, 0x86, 0x10, 0x16, 0x08, 0xb3, 0xfd, 0xd8, 0xf7, 0x8f, 0xf7, 
-0x7e, 0xfd, 0x89, 0x04, 0x40, 0x09, 0x64, 0x0a, 0x14, 0x08, 0x11, 0x05, 0xdf, 0x01, 0xe6, 0x01, 
-0xe7, 0x02, 0x6b, 0x04, 0x4a, 0x06, 0xcd, 0x04, 0x32, 0x01, 0x94, 0xf9, 0xad, 0xf2, 0x33, 0xed, 
-0xf5, 0xe9, 0x80, 0xe8, 0x22, 0xe6, 0x14, 0xe8, 0x01, 0xef, 0x54, 0xfe, 0x17, 0x0e, 0x47, 0x14, 
-0x11, 0x0d, 0x92, 0xfc, 0xef, 0xf0, 0x7e, 0xf1, 0x5d, 0xff, 0x85, 0x0f, 0x06, 0x17, 0xac, 0x12, 
-0x42, 0x06, 0x89, 0xfc, 0xa1, 0xf9, 0x0d, 0xfe, 0xf0, 0x05, 0xb5, 0x0a, 0x91, 0x0a, 0xe8, 0x03, 
-0x3c, 0xfd, 0xe6, 0xf9, 0x38, 0xfc, 0x87, 0x03, 0x4f, 0x08, 0x29, 0x0c, 0x81, 0x0b, 0x96, 0x09, 
-0x86, 0x06, 0xf5, 0x01, 0x5f, 0x00, 0x7b, 0xff, 0x08, 0x02, 0x93, 0x03, 0x4a, 0x02, 0x4e, 0xfd, 
-0xc1, 0xf3, 0x23, 0xed, 0x15, 0xea, 0x1a, 0xeb, 0x0c, 0xed, 0x0b, 0xed, 0xdc, 0xec, 0x23, 0xef, 
-0x1e, 0xf9, 0x39, 0x07, 0x7f, 0x12, 0xa7, 0x12, 0xce, 0x06, 0x1c, 0xf9, 0x3c, 0xf3, 0x97, 0xfb, 
-0xdf, 0x0a, 0x0c, 0x16, 0x9f, 0x15, 0x58, 0x0a, 0xdc, 0xff, 0x5d, 0xfb, 0x42, 0x00, 0x64, 0x08, 
-0x52, 0x0b, 0xaf, 0x09, 0xb9, 0x02, 0x43, 0xfd, 0x9c, 0xfa, 0x53, 0xfc, 0xa6, 0x02, 0x4e, 0x07, 
-0xcf, 0x0b, 0x07, 0x0d, 0x75, 0x0b, 0x90, 0x07, 0x3c, 0x01, 0x56, 0xfe, 0x6e, 0xfe, 0x78, 0x02, 
-0x6a, 0x06, 0x72, 0x04, 0x45, 0xfe, 0xf7, 0xf3, 0xd3, 0xec, 0x4d, 0xeb, 0x1b, 0xed, 0xc5, 0xf0, 
-0x18, 0xef, 0xa0, 0xec, 0xb1, 0xea, 0x48, 0xef, 0x4d, 0xfd, 0x72, 0x0b, 0x88, 0x15, 0xb1, 0x10, 
-0x55, 0x02, 0xdc, 0xf4, 0x04, 0xf1, 0xe0, 0xfc, 0x8e, 0x0c, 0x6b, 0x17, 0xa0, 0x15, 0x8e, 0x09, 
-0xb3, 0xfe, 0x67, 0xf9, 0x96, 0xfd, 0x28, 0x04, 0xb6, 0x07, 0x17, 0x08, 0x6d, 0x04, 0xf3, 0x01, 
-0x45, 0x00, 0x1e, 0x01, 0x43, 0x03, 0xa5, 0x04, 0x3b, 0x07, 0xaf, 0x08, 0x9b, 0x0a, 0xf6, 0x08, 
-0x9b, 0x04, 0x15, 0x00, 0x45, 0xfc, 0xa0, 0xfd, 0xe2, 0xff, 0x68, 0x00, 0x30, 0xfd, 0xee, 0xf6, 
-0x1e, 0xf2, 0x9f, 0xef, 0x59, 0xf0, 0xe3, 0xf0, 0x80, 0xed, 0x52, 0xe9, 0x7a, 0xe6, 0xe9, 0xea, 
-0x53, 0xfa, 0x2b, 0x0c, 0x44, 0x18, 0xf3, 0x14, 0xdd, 0x04, 0x3d, 0xf4, 0x7e, 0xee, 0xcf, 0xf9, 
-0x6c, 0x0b, 0x21, 0x18, 0x34, 0x17, 0x39, 0x0b, 0x07, 0xff, 0x02, 0xf9, 0xb8, 0xfc, 0xd6, 0x03, 
-0xa3, 0x08, 0xef, 0x07, 0xab, 0x03, 0x51, 0x00, 0x5c, 0xff, 0x2c, 0x03, 0xbe, 0x06, 0xa9, 0x08, 
-0xcb, 0x09, 0xbc, 0x08, 0x13, 0x09, 0xbd, 0x07, 0x58, 0x05, 0xb8, 0x02, 0x77, 0xff, 0x33, 0xff, 
-0x82, 0xff, 0x54, 0x00, 0x07, 0xfe, 0x7a, 0xf9, 0x76, 0xf5, 0xd3, 0xf1, 0x3e, 0xf1, 0x53, 0xf1, 
-0x0a, 0xf0, 0xff, 0xea, 0x86, 0xe6, 0x42, 0xe5, 0xa8, 0xec, 0xf7, 0xfd, 0x31, 0x0e, 0xec, 0x17, 
-0x2e, 0x12, 0x72, 0x03, 0x0f, 0xf6, 0xf6, 0xf0, 0xd8, 0xf9, 0xdf, 0x06, 0xe6, 0x12, 0xde, 0x15, 
-0x16, 0x0f, 0x31, 0x06, 0x0d, 0xfd, 0x62, 0xfb, 0x0c, 0x00, 0x98, 0x06, 0xe1, 0x0b, 0x0c, 0x0b, 
-0x38, 0x07, 0xa5, 0x02, 0xc5, 0x00, 0x29, 0x02, 0x8f, 0x05, 0x45, 0x09, 0x1c, 0x09, 0xf3, 0x08, 
-0x3c, 0x07, 0xde, 0x04, 0x3f, 0x02, 0x9f, 0xfe, 0x2e, 0xfe, 0xc2, 0xfe, 0xfc, 0x00, 0x31, 0x00, 
-0x65, 0xfb, 0xc3, 0xf5, 0xef, 0xef, 0x38, 0xee, 0x4a, 0xef, 0x8e, 0xef, 0x0c, 0xed, 0x90, 0xe8, 
-0x54, 0xe5, 0x77, 0xea, 0x24, 0xf7, 0xbc, 0x05, 0x30, 0x12, 0x9c, 0x13, 0x17, 0x0b, 0xce, 0xfd, 
-0xe6, 0xf3, 0xb0, 0xf5, 0x76, 0xff, 0x76, 0x0c, 0x46, 0x14, 0x05, 0x12, 0xbb, 0x0a, 0x5d, 0x02, 
-0x91, 0xfe, 0xb6, 0x00, 0x0e, 0x04, 0x88, 0x07, 0x3d, 0x09, 0x7e, 0x08, 0x04, 0x09, 0xfe, 0x07, 
-0xc7, 0x05, 0x22, 0x05, 0x8f, 0x03, 0xc2, 0x05, 0xb5, 0x08, 0x20, 0x0a, 0xc9, 0x09, 0x23, 0x04, 
-0x86, 0xff, 0xcb, 0xfc, 0xe6, 0xfc, 0xfc, 0xfe, 0x32, 0xfe, 0x5c, 0xfc, 0x5b, 0xf8, 0x42, 0xf4, 
-0x61, 0xf2, 0x26, 0xf0, 0x84, 0xee, 0xd1, 0xeb, 0x55, 0xe8, 0xdb, 0xe6, 0x5d, 0xe8, 0x58, 0xf0, 
-0xa7, 0xfb, 0x26, 0x09, 0xf9, 0x11, 0x5f, 0x11, 0x4d, 0x09, 0x81, 0xfa, 0xd5, 0xf2, 0x16, 0xf5, 
-0x19, 0x00, 0xf3, 0x0d, 0x23, 0x14, 0x2b, 0x13, 0x49, 0x0a, 0x33, 0x02, 0x49, 0xff, 0xab, 0x00, 
-0xae, 0x06, 0x65, 0x0a, 0xd0, 0x0b, 0xbd, 0x0b, 0xa9, 0x09, 0x6c, 0x08, 0xc3, 0x05, 0x10, 0x03, 
-0x10, 0x02, 0x11, 0x03, 0xfb, 0x07, 0x4b, 0x0b, 0x7a, 0x0b, 0x01, 0x06, 0x77, 0xfd, 0xfe, 0xf6, 
-0xba, 0xf4, 0xa2, 0xf9, 0xb0, 0xfd, 0x62, 0xfe, 0x46, 0xfa, 0x78, 0xf2, 0x16, 0xed, 0x61, 0xea, 
-0xc7, 0xeb, 0xf0, 0xeb, 0x60, 0xeb, 0xd6, 0xeb, 0xea, 0xec, 0x8e, 0xf6, 0x31, 0x05, 0x34, 0x12, 
-0xc1, 0x16, 0xf9, 0x0d, 0x8b, 0x00, 0x43, 0xf5, 0x01, 0xf4, 0x35, 0xfd, 0x88, 0x08, 0x06, 0x11, 
-0xee, 0x10, 0xdb, 0x0b, 0xf3, 0x06, 0x5c, 0x03, 0xac, 0x03, 0xf0, 0x04, 0x61, 0x06, 0xfb, 0x09, 
-0xf8, 0x0c, 0x2e, 0x0e, 0x7e, 0x0b, 0xbb, 0x05, 0xdf, 0x00, 0x28, 0xff, 0x96, 0x02, 0x71, 0x07, 
-0xec, 0x0a, 0x3a, 0x0a, 0x6b, 0x04, 0x13, 0xfd, 0xed, 0xf6, 0x13, 0xf5, 0x6c, 0xf7, 0x27, 0xfa, 
-0x7e, 0xfb, 0x66, 0xf9, 0x00, 0xf4, 0xc5, 0xee, 0x05, 0xe9, 0x91, 0xe7, 0xdc, 0xe8, 0x57, 0xeb, 
-0x08, 0xf1, 0x85, 0xf4, 0x47, 0xfd, 0x55, 0x05, 0xa7, 0x0a, 0xba, 0x0e, 0x21, 0x08, 0xd5, 0x00, 
-0x5c, 0xfa, 0x37, 0xf9, 0xb7, 0x01, 0x4a, 0x08, 0xea, 0x0e, 0xaa, 0x0f, 0x40, 0x0b, 0x70, 0x09, 
-0x0d, 0x05, 0x44, 0x05, 0xb5, 0x06, 0x29, 0x06, 0xb0, 0x09, 0x6f, 0x0a, 0x4f, 0x0c, 0x54, 0x0c, 
-0xef, 0x07, 0x64, 0x05, 0xd9, 0x01, 0x4e, 0x02, 0x69, 0x05, 0xf4, 0x06, 0x94, 0x08, 0x4c, 0x05, 
-0x2a, 0xff, 0x74, 0xf9, 0xe2, 0xf4, 0x69, 0xf6, 0x42, 0xf9, 0xcc, 0xfa, 0x8e, 0xfa, 0x2b, 0xf5, 
-0x72, 0xef, 0x52, 0xeb, 0xad, 0xe9, 0xdf, 0xea, 0x9a, 0xeb, 0x03, 0xee, 0xaa, 0xf1, 0xd3, 0xf6, 
-0x62, 0xff, 0xff, 0x07, 0x0a, 0x0d, 0xc3, 0x0c, 0xcc, 0x05, 0x7f, 0xfd, 0x76, 0xf9, 0x18, 0xfb, 
-0xb1, 0x02, 0x35, 0x0a, 0xb9, 0x0e, 0x38, 0x10, 0x75, 0x0d, 0xd0, 0x0a, 0x7e, 0x06, 0x96, 0x03, 
-0xf4, 0x04, 0x34, 0x07, 0xaa, 0x0c, 0xdb, 0x0f, 0x97, 0x0e, 0xff, 0x0b, 0x1d, 0x07, 0xbc, 0x03, 
-0x0a, 0x02, 0x48, 0x01, 0xc9, 0x02, 0x37, 0x03, 0x3e, 0x03, 0x5a, 0x02, 0xe0, 0xfd, 0x0f, 0xfa, 
-0x8e, 0xf6, 0x77, 0xf3, 0x96, 0xf3, 0xa0, 0xf2, 0x33, 0xf2, 0xf1, 0xf1, 0xa0, 0xf0, 0x61, 0xf0, 
-0xe3, 0xed, 0x62, 0xeb, 0xd3, 0xea, 0x80, 0xeb, 0x2b, 0xf1, 0x94, 0xfb, 0xd3, 0x07, 0xe4, 0x0f, 
-0x8c, 0x10, 0x12, 0x0b, 0x10, 0x03, 0x7f, 0xfd, 0x14, 0xfc, 0x5e, 0xfe, 0x77, 0x02, 0x72, 0x07, 
-0x71, 0x0d, 0x55, 0x11, 0x1e, 0x12, 0xdc, 0x0f, 0xe8, 0x0a, 0xce, 0x06, 0x51, 0x04, 0xeb, 0x04, 
-0xd4, 0x08, 0x46, 0x0b, 0x64, 0x0d, 0xdf, 0x0c, 0xc3, 0x08, 0xad, 0x05, 0xa7, 0x01, 0x8a, 0xff, 
-0xbb, 0xff, 0x45, 0xff, 0x2d, 0xff, 0x5c, 0xfd, 0xd1, 0xfb, 0x23, 0xfa, 0x17, 0xf8, 0x0c, 0xf7, 
-0x0e, 0xf4, 0x8d, 0xf2, 0xcb, 0xf1, 0x44, 0xf1, 0x30, 0xf1, 0x9e, 0xef, 0x95, 0xee, 0xe5, 0xed, 
-0xc3, 0xef, 0x82, 0xf1, 0x4c, 0xf3, 0xb3, 0xf9, 0xee, 0x00, 0xf6, 0x08, 0x64, 0x0d, 0xc0, 0x0b, 
-0xbf, 0x07, 0xfc, 0x01, 0xca, 0xfe, 0x10, 0xff, 0x3c, 0x02, 0x9c, 0x07, 0x3a, 0x0b, 0x28, 0x0e, 
-0x27, 0x0f, 0x54, 0x0d, 0xd3, 0x0b, 0xf8, 0x09, 0xd2, 0x07, 0xce, 0x07, 0x65, 0x08, 0xd3, 0x09, 
-0xa6, 0x0b, 0x68, 0x0a, 0x7d, 0x08, 0xe8, 0x04, 0x5a, 0x01, 0x20, 0x01, 0xef, 0xff, 0x06, 0x00, 
-0xbe, 0xfe, 0x82, 0xfb, 0x41, 0xfb, 0xaa, 0xf9, 0x15, 0xf9, 0xf0, 0xf8, 0x51, 0xf6, 0xba, 0xf5, 
-0x4c, 0xf4, 0x2f, 0xf3, 0x1a, 0xf4, 0x51, 0xf2, 0x47, 0xf1, 0x6f, 0xf1, 0x27, 0xf1, 0x88, 0xf3, 
-0xd8, 0xf6, 0xec, 0xfa, 0xb5, 0xff, 0x33, 0x02, 0xa5, 0x03, 0x28, 0x03, 0xeb, 0x00, 0x3d, 0x01, 
-0x87, 0x02, 0x22, 0x04, 0xae, 0x06, 0x3a, 0x07, 0xbd, 0x07, 0xc7, 0x08, 0x24, 0x09, 0xeb, 0x09, 
-0x1d, 0x09, 0xf2, 0x07, 0x7d, 0x08, 0x47, 0x08, 0x27, 0x08, 0x50, 0x08, 0x82, 0x07, 0x37, 0x07, 
-0x8e, 0x06, 0xc8, 0x05, 0xfa, 0x04, 0x93, 0x03, 0x79, 0x02, 0x65, 0x00, 0x1c, 0xfe, 0xa3, 0xfc, 
-0xf8, 0xfb, 0x28, 0xfc, 0x33, 0xfc, 0x15, 0xfc, 0x82, 0xfb, 0x55, 0xfa, 0x32, 0xf9, 0xc7, 0xf7, 
-0x80, 0xf7, 0xa1, 0xf7, 0x03, 0xf7, 0x86, 0xf7, 0x36, 0xf7, 0x57, 0xf7, 0xe0, 0xf7, 0xf5, 0xf7, 
-0xf9, 0xf9, 0x46, 0xfb, 0xb3, 0xfc, 0x7e, 0xfd, 0xa8, 0xfc, 0xad, 0xfd, 0x48, 0xff, 0xbc, 0x00, 
-0x67, 0x02, 0xcf, 0x02, 0x6d, 0x03, 0x8d, 0x05, 0xeb, 0x06, 0x2d, 0x08, 0x21, 0x08, 0xf1, 0x06, 
-0xf0, 0x06, 0x06, 0x06, 0x2e, 0x06, 0xc3, 0x06, 0xd2, 0x06, 0x74, 0x07, 0x96, 0x06, 0xbc, 0x05, 
-0x85, 0x05, 0x9c, 0x04, 0xde, 0x03, 0x30, 0x03, 0x25, 0x02, 0x11, 0x02, 0x37, 0x01, 0xf5, 0xff, 
-0x2d, 0xff, 0xc1, 0xfc, 0x56, 0xfc, 0x9a, 0xfc, 0x25, 0xfb, 0x25, 0xfb, 0x44, 0xfb, 0x24, 0xfb, 
-0x0f, 0xfb, 0xe4, 0xf9, 0xf1, 0xf9, 0x62, 0xf9, 0x41, 0xf8, 0x94, 0xf9, 0xb4, 0xfa, 0x67, 0xfb, 
-0xf7, 0xfa, 0x35, 0xfa, 0x79, 0xfb, 0x2a, 0xfc, 0x8f, 0xfc, 0xd1, 0xfe, 0xfd, 0xff, 0xb7, 0xff, 
-0x71, 0x00, 0xda, 0x00, 0x1c, 0x02, 0x9c, 0x02, 0xcd, 0x02, 0x3d, 0x04, 0x13, 0x04, 0x15, 0x04, 
-0x10, 0x04, 0xde, 0x03, 0x4d, 0x04, 0x0c, 0x05, 0x8e, 0x04, 0xdd, 0x04, 0xf3, 0x05, 0xf9, 0x04, 
-0xdd, 0x04, 0xed, 0x03, 0x6d, 0x03, 0x55, 0x03, 0x0f, 0x02, 0xfe, 0x01, 0x86, 0x01, 0x21, 0x01, 
-0x44, 0x00, 0x53, 0xff, 0x3c, 0xff, 0x9a, 0xfe, 0xc0, 0xfd, 0x6e, 0xfd, 0x28, 0xfd, 0xc0, 0xfc, 
-0x9d, 0xfc, 0xcb, 0xfb, 0xfd, 0xfa, 0xfc, 0xfb, 0xaf, 0xfb, 0xf9, 0xfa, 0x88, 0xfc, 0xb3, 0xfb, 
-0x20, 0xfc, 0x8a, 0xfd, 0xe4, 0xfc, 0x3d, 0xfd, 0x1f, 0xfd, 0x39, 0xfe, 0xd8, 0xfe, 0x91, 0xff, 
-0xc6, 0x00, 0xfc, 0x00, 0x94, 0x01, 0xb1, 0x01, 0xa7, 0x01, 0xc4, 0x01, 0x6f, 0x02, 0xf9, 0x01, 
-0xd1, 0x03, 0x9a, 0x05, 0xb7, 0x03, 0x9e, 0x02, 0x39, 0x02, 0xee, 0x02, 0x87, 0x02, 0x2b, 0x02, 
-0x91, 0x02, 0x91, 0x01, 0x14, 0x01, 0x71, 0x01, 0x91, 0x01, 0xfb, 0xff, 0x99, 0xff, 0xd3, 0xff, 
-0x92, 0xff, 0x6c, 0xff, 0x94, 0xfe, 0x68, 0xff, 0x09, 0x00, 0x1e, 0xff, 0x78, 0xfe, 0x57, 0xff, 
-0x78, 0xfe, 0x63, 0xfd, 0x95, 0xfe, 0x43, 0xfd, 0x4a, 0xfd, 0x8d, 0xfe, 0xa2, 0xfe, 0x37, 0xfe, 
-0x31, 0xfe, 0xa3, 0xff, 0x55, 0xfe, 0x31, 0xfd, 0x9f, 0xfe, 0x9a, 0xff, 0x24, 0x00, 0x20, 0x00, 
-0x85, 0x00, 0x09, 0x01, 0xca, 0xff, 0xa2, 0x00, 0x87, 0x01, 0x05, 0x01, 0x72, 0x01, 0x8d, 0x01, 
-0x94, 0x01, 0x0b, 0x01, 0xae, 0x01, 0x8b, 0x01, 0xb1, 0x01, 0x3d, 0x03, 0x47, 0x02, 0x82, 0x01, 
-0x2f, 0x01, 0x07, 0x01, 0x4b, 0x00, 0xcc, 0xfe, 0x18, 0x00, 0x78, 0x00, 0x38, 0x00, 0x9d, 0x00, 
-0x4e, 0xfe, 0xcd, 0xfd, 0x45, 0xff, 0xec, 0xff, 0x00, 0xff, 0x88, 0xfd, 0xd7, 0xfe, 0xa3, 0xfe, 
-0xf8, 0xfd, 0xc7, 0xff, 0xa7, 0xfe, 0x9f, 0xfd, 0x72, 0xff, 0x34, 0xff, 0x60, 0xff, 0x51, 0xfe, 
-0x8d, 0xff, 0xad, 0x00, 0xfc, 0xff, 0x25, 0x01, 0xad, 0xff, 0x69, 0x00, 0x30, 0x00, 0x09, 0x01, 
-0xae, 0x01, 0x18, 0x00, 0x5d, 0x01, 0x81, 0x00, 0x58, 0x01, 0x29, 0x01, 0xd3, 0x00, 0x82, 0x01, 
-0x06, 0x01, 0xc4, 0x01, 0xd2, 0x00, 0x4d, 0x00, 0x1f, 0x00, 0x78, 0x00, 0x40, 0x01, 0xef, 0x00, 
-0x0f, 0x00, 0x04, 0x00, 0x6b, 0x00, 0xdc, 0xff, 0x3d, 0xff, 0xc9, 0xfe, 0xdf, 0xff, 0x75, 0xff, 
-0x67, 0xff, 0x85, 0x00, 0xba, 0xfe, 0x49, 0xff, 0x0c, 0xfe, 0x79, 0xfd, 0xd9, 0xff, 0xd1, 0xfe, 
-0xa6, 0xfe, 0x1e, 0x00, 0x1e, 0xff, 0x67, 0xfe, 0x71, 0xff, 0x10, 0xff, 0xde, 0xfe, 0x9e, 0x00, 
-0x99, 0x00, 0x81, 0xff, 0x71, 0x00, 0x4e, 0x00, 0x67, 0x00, 0xb0, 0x00, 0x2f, 0x00, 0x56, 0x01, 
-0x8c, 0x00, 0xf3, 0x00, 0x9c, 0x01, 0xf5, 0x00, 0x62, 0x01, 0x2e, 0x01, 0xad, 0x01, 0xae, 0x01, 
-0x10, 0x00, 0x51, 0x00, 0x26, 0x01, 0x5d, 0x00, 0x5d, 0x01, 0xd2, 0x00, 0xe1, 0xfd, 0x52, 0xfe, 
-0x59, 0x00, 0xa1, 0x00, 0xeb, 0xff, 0xb0, 0xfe, 0xfd, 0x00, 0x63, 0x00, 0x8f, 0xfe, 0x40, 0xff, 
-0xf2, 0xfe, 0x8e, 0xff, 0x02, 0xff, 0xcd, 0xff, 0x96, 0xff, 0xd1, 0xfe, 0x61, 0xff, 0x80, 0xff, 
-0x8e, 0xff, 0xf0, 0xfe, 0xe1, 0xff, 0xa7, 0xff, 0xa4, 0xff, 0x33, 0x00, 0x29, 0x00, 0xab, 0x00, 
-0x2e, 0x00, 0x03, 0x00, 0xbd, 0x00, 0x3a, 0x00, 0x91, 0xff, 0x20, 0x00, 0xea, 0xff, 0x2a, 0x00, 
-0xf1, 0xff, 0x47, 0x00, 0x2a, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x3e, 0x00, 0xa7, 0xff, 
-0x6d, 0x00, 0x3c, 0x00, 0x32, 0x00, 0x43, 0x00, 0x45, 0x00, 0x17, 0x00, 0x20, 0x00, 0x10, 0x00, 
-0xe7, 0xff, 0xde, 0xff, 0xcc, 0xff, 0x0e, 0x00, 0x6b, 0xff, 0x72, 0xff, 0xfd, 0xff, 0xac, 0xff, 
-0x67, 0xff, 0xc7, 0xff, 0x77, 0xff, 0x71, 0xff, 0x7f, 0xff, 0x3e, 0xff, 0xa4, 0xff, 0x89, 0xff, 
-0x95, 0xff, 0x6c, 0xff, 0x7f, 0xff, 0xb8, 0xff, 0x76, 0xff, 0x73, 0xff, 0xb2, 0xff, 0xcd, 0xff, 
-0xd3, 0xff, 0x96, 0xff, 0xf6, 0xff, 0x1a, 0x00, 0x9d, 0xff, 0xe0, 0xff, 0x32, 0x00, 0x70, 0x00, 
-0xf9, 0xff, 0x01, 0x00, 0x31, 0x00, 0x6a, 0x00, 0x53, 0x00, 0x07, 0x00, 0x28, 0x00, 0x47, 0x00, 
-0x80, 0x00, 0x75, 0x00, 0x3f, 0x00, 0x1c, 0x00, 0x31, 0x00, 0x1d, 0x00, 0x72, 0x00, 0x54, 0x00, 
-0x25, 0x00, 0x29, 0x00, 0x16, 0x00, 0x4f, 0x00, 0x09, 0x00, 0xbf, 0xff, 0xe9, 0xff, 0xf5, 0xff, 
-0xcb, 0xff, 0xdc, 0xff, 0x16, 0x00, 0x6d, 0xff, 0x4b, 0xff, 0xef, 0xff, 0x7f, 0xff, 0xda, 0xff, 
-0xf0, 0xff, 0x8a, 0xff, 0xab, 0xff, 0x7c, 0xff, 0xd5, 0xff, 0x16, 0x00, 0xfd, 0xff, 0xb8, 0xff, 
-0xf1, 0xff, 0x27, 0x00, 0xed, 0xff, 0xe5, 0xff, 0x4e, 0x00, 0x60, 0x00, 0x15, 0x00, 0x22, 0x00, 
-0x21, 0x00, 0x4f, 0x00, 0x0a, 0x00, 0x62, 0x00, 0x28, 0x00, 0x32, 0x00, 0x7e, 0x00, 0x16, 0x00, 
-0x3e, 0x00, 0x18, 0x00, 0x40, 0x00, 0x22, 0x00, 0x35, 0x00, 0x74, 0x00, 0x5f, 0x00, 0xd4, 0xff, 
-0xef, 0xff, 0x0d, 0x00, 0x1a, 0x00, 0xea, 0xff, 0xd8, 0xff, 0xec, 0xff, 0xc4, 0xff, 0xf5, 0xff, 
-0x57, 0xff, 0xa4, 0xff, 0xb6, 0xff, 0x54, 0xff, 0x2f, 0xff, 0x6a, 0xff, 0xb0, 0xff, 0x3d, 0xff, 
-0x23, 0xff, 0x7f, 0xff, 0x94, 0xff, 0xb8, 0xff, 0x91, 0xff, 0x9b, 0xff, 0xf2, 0xff, 0x8e, 0xff, 
-0xeb, 0xff, 0xba, 0xff, 0xbb, 0xff, 0x0a, 0x00, 0xc7, 0xff, 0x1e, 0x00, 0xfa, 0xff, 0x56, 0x00, 
-0x87, 0x00, 0x06, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x8b, 0x00, 0xa6, 0x00, 0x9d, 0x00, 0x87, 0x00, 
-0x20, 0x00, 0x70, 0x00, 0x6d, 0x00, 0x6a, 0x00, 0x96, 0x00, 0x0c, 0x00, 0x39, 0x00, 0x50, 0x00, 
-0xf9, 0xff, 0x3c, 0x00, 0x4b, 0x00, 0x28, 0x00, 0x03, 0x00, 0xd3, 0xff, 0xda, 0xff, 0x0f, 0x00, 
-0xdc, 0xff, 0xde, 0xff, 0xcf, 0xff, 0xa6, 0xff, 0x9a, 0xff, 0xb9, 0xff, 0xf1, 0xff, 0xb0, 0xff, 
-0x88, 0xff, 0xa5, 0xff, 0xbe, 0xff, 0xb5, 0xff, 0xd9, 0xff, 0xea, 0xff, 0xe6, 0xff, 0xcf, 0xff, 
-0xc0, 0xff, 0x0a, 0x00, 0x2b, 0x00, 0x11, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x31, 0x00, 0x54, 0x00, 
-0x5f, 0x00, 0x4f, 0x00, 0x40, 0x00, 0x45, 0x00, 0x51, 0x00, 0x6e, 0x00, 0x40, 0x00, 0x2b, 0x00, 
-0x54, 0x00, 0x40, 0x00, 0x35, 0x00, 0x2b, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x03, 0x00, 0xec, 0xff, 
-0x06, 0x00, 0xeb, 0xff, 0xe5, 0xff, 0xd6, 0xff, 0xc4, 0xff, 0xde, 0xff, 0xcc, 0xff, 0xbe, 0xff, 
-0xcc, 0xff, 0xba, 0xff, 0xdb, 0xff, 0xd7, 0xff, 0xd3, 0xff, 0xe3, 0xff, 0xdd, 0xff, 0xda, 0xff, 
-0xdd, 0xff, 0xe4, 0xff, 0xdb, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0x0f, 0x00, 0x09, 0x00, 
-0x10, 0x00, 0x23, 0x00, 0x28, 0x00, 0x36, 0x00, 0x35, 0x00, 0x3d, 0x00, 0x4b, 0x00, 0x41, 0x00, 
-0x35, 0x00, 0x46, 0x00, 0x35, 0x00, 0x38, 0x00, 0x3b, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x21, 0x00, 
-0x14, 0x00, 0x14, 0x00, 0x13, 0x00, 0xfa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xde, 0xff, 0xd4, 0xff, 
-0xce, 0xff, 0xbf, 0xff, 0xbe, 0xff, 0xb0, 0xff, 0xba, 0xff, 0xc6, 0xff, 0xb0, 0xff, 0xbb, 0xff, 
-0xbf, 0xff, 0xbe, 0xff, 0xcd, 0xff, 0xce, 0xff, 0xd5, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xeb, 0xff, 
-0x05, 0x00, 0x01, 0x00, 0x06, 0x00, 0x15, 0x00, 0x20, 0x00, 0x25, 0x00, 0x20, 0x00, 0x32, 0x00, 
-0x38, 0x00, 0x38, 0x00, 0x43, 0x00, 0x42, 0x00, 0x42, 0x00, 0x37, 0x00, 0x43, 0x00, 0x45, 0x00, 
-0x38, 0x00, 0x3f, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x25, 0x00, 0x16, 0x00, 
-0x16, 0x00, 0x11, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x04, 0x00, 0xfb, 0xff, 0xf3, 0xff, 0xf3, 0xff, 
-0xef, 0xff, 0xe8, 0xff, 0xe5, 0xff, 0xea, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xe0, 0xff, 
-0xeb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x03, 0x00, 0x07, 0x00, 0xff, 0xff, 0x0a, 0x00, 0x15, 0x00, 
-0x1d, 0x00, 0x28, 0x00, 0x27, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x37, 0x00, 0x38, 0x00, 0x34, 0x00, 
-0x3a, 0x00, 0x3f, 0x00, 0x33, 0x00, 0x31, 0x00, 0x35, 0x00, 0x35, 0x00, 0x32, 0x00, 0x26, 0x00, 
-0x24, 0x00, 0x1c, 0x00, 0x12, 0x00, 0x08, 0x00, 0x07, 0x00, 0x07, 0x00, 0xf8, 0xff, 0xf5, 0xff, 
-0xf1, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0xec, 0xff, 0xdf, 0xff, 0xe5, 0xff, 
-0xe7, 0xff, 0xe2, 0xff, 0xf1, 0xff, 0xe6, 0xff, 0xf3, 0xff, 0xe8, 0xff, 0xe6, 0xff, 0xed, 0xff, 
-0xf0, 0xff, 0xfe, 0xff, 0xf0, 0xff, 0x02, 0x00, 0x07, 0x00, 0x15, 0x00, 0x11, 0x00, 0x0f, 0x00, 
-0x15, 0x00, 0x11, 0x00, 0x23, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x1f, 0x00, 0x21, 0x00, 
-0x1f, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x1e, 0x00, 
-0x1b, 0x00, 0x1a, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x01, 0x00, 0xf8, 0xff, 0xf7, 0xff, 0xfa, 0xff, 
-0xe7, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xd7, 0xff, 0xd0, 0xff, 0xd4, 0xff, 0xdb, 0xff, 0xd0, 0xff, 
-0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xdf, 0xff, 0xd5, 0xff, 0xea, 0xff, 0xe2, 0xff, 0xe2, 0xff, 
-0xf4, 0xff, 0xfd, 0xff, 0x09, 0x00, 0x07, 0x00, 0x08, 0x00, 0x15, 0x00, 0x23, 0x00, 0x1f, 0x00, 
-0x1f, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x1c, 0x00, 0x22, 0x00, 0x20, 0x00, 0x1e, 0x00, 
-0x20, 0x00, 0x15, 0x00, 0x1a, 0x00, 0x17, 0x00, 0x14, 0x00, 0x03, 0x00, 0xf9, 0xff, 0x0a, 0x00, 
-0x01, 0x00, 0xf8, 0xff, 0xf9, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf4, 0xff, 0xf0, 0xff, 
-0xf7, 0xff, 0xe1, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xe1, 0xff, 0xe2, 0xff, 
-0xe8, 0xff, 0xe3, 0xff, 0xdd, 0xff, 0xd2, 0xff, 0xe2, 0xff, 0xd1, 0xff, 0xd9, 0xff, 0xf3, 0xff, 
-0xea, 0xff, 0xf7, 0xff, 0xed, 0xff, 0xf3, 0xff, 0x03, 0x00, 0xf1, 0xff, 0x13, 0x00, 0x0c, 0x00, 
-0xf1, 0xff, 0x06, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x1c, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 
-0xf8, 0xff, 0x14, 0x00, 0x0d, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x01, 0x00, 0xfa, 0xff, 0xf6, 0xff, 
-0xfd, 0xff, 0x04, 0x00, 0x07, 0x00, 0xf6, 0xff, 0xf9, 0xff, 0x0f, 0x00, 0x07, 0x00, 0xd2, 0xff, 
-0xfb, 0xff, 0x08, 0x00, 0xf4, 0xff, 0x27, 0x00, 0xfe, 0xff, 0x34, 0x00, 0xed, 0xff, 0xeb, 0xff, 
-0x01, 0x00, 0xc5, 0xff, 0xc3, 0xff, 0x01, 0x00, 0x04, 0x00, 0xcb, 0xff, 0xea, 0xff, 0xcf, 0xff, 
-0x14, 0x00, 0xd9, 0xff, 0xcb, 0xff, 0x5c, 0x00, 0x23, 0x00, 0xb1, 0xff, 0x1e, 0x00, 0x48, 0x00, 
-0xdf, 0xff, 0xd2, 0xff, 0x34, 0x00, 0x04, 0x00, 0x00, 0x00, 0x34, 0x00, 0xec, 0xff, 0x1f, 0x00, 
-0x6f, 0x00, 0xf1, 0xff, 0xfb, 0xff, 0x2a, 0x00, 0x1d, 0x00, 0x43, 0x00, 0x0d, 0x00, 0x3a, 0x00, 
-0xf4, 0xff, 0x14, 0x00, 0x0c, 0x00, 0x21, 0x00, 0x51, 0x00, 0xf8, 0xff, 0x54, 0x00, 0x1a, 0x00, 
-0x18, 0x00, 0x38, 0x00, 0xe7, 0xff, 0x37, 0x00, 0x50, 0x00, 0x3d, 0x00, 0xf7, 0xff, 0x04, 0x00, 
-0x2a, 0x00, 0xd7, 0xff, 0x16, 0x00, 0xf2, 0xff, 0xa0, 0xff, 0xd8, 0xff, 0x17, 0x00, 0x03, 0x00, 
-0xf9, 0xff, 0xfa, 0xff, 0xd5, 0xff, 0xcc, 0xff, 0xb7, 0xff, 0x11, 0x00, 0xff, 0xff, 0x7a, 0xff, 
-0xe8, 0xff, 0x03, 0x00, 0xd7, 0xff, 0x13, 0x00, 0x0f, 0x00, 0x64, 0x00, 0xe8, 0xff, 0x03, 0x00, 
-0x70, 0x00, 0xd3, 0xff, 0x28, 0x00, 0xf3, 0xff, 0xea, 0xff, 0x8d, 0xff, 0x85, 0xff, 0x39, 0x00, 
-0xac, 0xff, 0xb4, 0xff, 0x8a, 0xff, 0x64, 0xff, 0xe6, 0xff, 0xd8, 0xff, 0x98, 0x00, 0x75, 0x00, 
-0xfc, 0xff, 0x1c, 0x00, 0x0a, 0x00, 0xe4, 0xff, 0xd5, 0xff, 0x36, 0x00, 0xf6, 0xff, 0xfb, 0xff, 
-0x5d, 0x00, 0x01, 0x00, 0x8a, 0xff, 0x7a, 0xff, 0x84, 0xff, 0xa0, 0x02, 0x64, 0x03, 0x65, 0x01, 
-0xa9, 0x00, 0xf3, 0xff, 0xa6, 0xff, 0x17, 0xff, 0x6a, 0xff, 0xb3, 0xff, 0xc9, 0xff, 0xbb, 0xff, 
-0x00, 0xff, 0xb7, 0xff, 0xb7, 0x00, 0x3a, 0x00, 0xf0, 0xff, 0x33, 0x00, 0xa0, 0x00, 0x13, 0x00, 
-0xb1, 0xff, 0xbf, 0xff, 0xd7, 0xff, 0xd8, 0xff, 0xd2, 0xff, 0xb1, 0xff, 0x2c, 0xff, 0x65, 0xff, 
-0x49, 0xff, 0x84, 0xff, 0x99, 0xff, 0xcc, 0xff, 0xb7, 0x00, 0x8e, 0x00, 0x14, 0x00, 0x93, 0x00, 
-0xed, 0x00, 0x3e, 0x01, 0x31, 0x01, 0x95, 0x01, 0x23, 0x05, 0x09, 0x04, 0xa7, 0x01, 0x2b, 0x00, 
-0x97, 0xfe, 0xed, 0xfd, 0xa1, 0xfc, 0x61, 0xfd, 0xab, 0xfd, 0x0c, 0xfe, 0x3e, 0xfe, 0x0c, 0xfe, 
-0x0c, 0xff, 0x55, 0xff, 0x08, 0xff, 0xbb, 0xff, 0xb9, 0xff, 0xa5, 0xff, 0x42, 0xff, 0x37, 0xff, 
-0x86, 0xff, 0x78, 0xff, 0x3b, 0x00, 0x8f, 0x00, 0x10, 0x01, 0xcf, 0x01, 0x5a, 0x02, 0x6d, 0x02, 
-0x74, 0x02, 0x57, 0x02, 0x8d, 0x01, 0xa7, 0x01, 0xc8, 0x01, 0xae, 0x01, 0x55, 0x01, 0x9d, 0x00, 
-0x1c, 0x00, 0xd1, 0xff, 0x34, 0xff, 0xe1, 0xfd, 0xda, 0xfa, 0xee, 0xf7, 0x21, 0xf6, 0xf2, 0xf3, 
-0x01, 0xf2, 0x19, 0xf0, 0xab, 0xf0, 0xac, 0xf6, 0x99, 0xfb, 0x3b, 0x01, 0x4b, 0x06, 0xe6, 0x09, 
-0x71, 0x0e, 0x26, 0x0e, 0x4e, 0x0e, 0xcb, 0x0c, 0x4c, 0x0a, 0x5b, 0x09, 0xd9, 0x05, 0xe3, 0x05, 
-0xe6, 0x05, 0xbe, 0x04, 0x12, 0x06, 0xe7, 0x04, 0x14, 0x06, 0xd5, 0x06, 0xde, 0x05, 0x05, 0x06, 
-0x34, 0x04, 0x10, 0x04, 0x66, 0x02, 0x3a, 0x00, 0x17, 0xff, 0x76, 0xfa, 0x5b, 0xf6, 0x22, 0xf1, 
-0x47, 0xeb, 0x00, 0xe7, 0x8f, 0xe0, 0x98, 0xe1, 0xdb, 0xe8, 0xd3, 0xf2, 0xb6, 0xff, 0xdd, 0x06, 
-0x6d, 0x0e, 0x12, 0x13, 0x31, 0x13, 0x79, 0x12, 0x39, 0x0a, 0xf3, 0x04, 0x31, 0x00, 0xb8, 0xfb, 
-0xb8, 0xfd, 0x67, 0xfc, 0x79, 0xff, 0x2b, 0x02, 0x9f, 0x03, 0xdd, 0x08, 0xa3, 0x08, 0x03, 0x0c, 
-0xe1, 0x0b, 0x0c, 0x08, 0x86, 0x07, 0xab, 0x03, 0x06, 0x03, 0xe5, 0x00, 0x4b, 0xff, 0x39, 0x00, 
-0x5e, 0xfe, 0x0d, 0xff, 0x3e, 0xfc, 0x3c, 0xf8, 0xf4, 0xf3, 0x2c, 0xeb, 0x1b, 0xe3, 0x7b, 0xdf, 
-0x84, 0xe5, 0x2c, 0xf1, 0xa3, 0xfb, 0x81, 0x03, 0xfa, 0x09, 0x55, 0x10, 0xe6, 0x14, 0xda, 0x12, 
-0x75, 0x0c, 0x7b, 0x06, 0xef, 0x01, 0xe8, 0xfe, 0x26, 0xfc, 0x22, 0xfc, 0xd8, 0xfd, 0xf8, 0x00, 
-0xcd, 0x04, 0x1f, 0x06, 0xeb, 0x08, 0xaf, 0x0a, 0x74, 0x0b, 0xf0, 0x0a, 0x08, 0x07, 0xd1, 0x05, 
-0x59, 0x04, 0x81, 0x03, 0xeb, 0x02, 0x37, 0x01, 0xae, 0x01, 0x4e, 0x00, 0xd0, 0xfd, 0x75, 0xfa, 
-0xec, 0xf5, 0xa0, 0xf1, 0x8d, 0xea, 0x82, 0xe3, 0xb4, 0xe1, 0x9f, 0xe7, 0x25, 0xf2, 0xba, 0xfc, 
-0x4b, 0x04, 0x91, 0x09, 0xc7, 0x0f, 0x81, 0x13, 0x24, 0x12, 0xfb, 0x0c, 0xda, 0x06, 0x57, 0x03, 
-0xfc, 0x00, 0x9d, 0xfe, 0xcc, 0xfd, 0x83, 0xfd, 0x58, 0xff, 0xb2, 0x02, 0x4e, 0x04, 0x22, 0x07, 
-0x16, 0x09, 0x98, 0x09, 0x92, 0x0a, 0x75, 0x08, 0xc4, 0x06, 0x13, 0x05, 0xd7, 0x02, 0x18, 0x02, 
-0xfe, 0xff, 0x61, 0xff, 0x18, 0xff, 0xdf, 0xfd, 0x26, 0xfc, 0x80, 0xf8, 0x87, 0xf4, 0x72, 0xee, 
-0xad, 0xe7, 0x21, 0xe4, 0x1f, 0xe7, 0x26, 0xee, 0xfc, 0xf5, 0x1e, 0xfe, 0x40, 0x04, 0xff, 0x09, 
-0xce, 0x0e, 0xfe, 0x10, 0x57, 0x10, 0x4f, 0x0d, 0x3a, 0x0a, 0xcf, 0x06, 0x94, 0x03, 0x40, 0x01, 
-0x87, 0xff, 0x91, 0xfe, 0xef, 0xfe, 0x38, 0x00, 0x58, 0x01, 0x20, 0x03, 0x69, 0x05, 0x14, 0x08, 
-0x15, 0x0a, 0x32, 0x0a, 0xd7, 0x08, 0x31, 0x07, 0xb1, 0x05, 0x30, 0x04, 0xab, 0x02, 0x8d, 0x00, 
-0xba, 0xfd, 0x34, 0xfa, 0xc8, 0xf6, 0x38, 0xf4, 0x5e, 0xf1, 0x4c, 0xee, 0xb9, 0xea, 0xb2, 0xe6, 
-0x61, 0xe5, 0x08, 0xe8, 0x0a, 0xf0, 0x91, 0xfa, 0xd9, 0x03, 0x79, 0x0a, 0x47, 0x0d, 0x4a, 0x0e, 
-0x86, 0x0f, 0xab, 0x10, 0xb2, 0x10, 0xd7, 0x0d, 0x2b, 0x08, 0xeb, 0x01, 0x8b, 0xfd, 0x6f, 0xfc, 
-0x40, 0xfd, 0x98, 0xfe, 0x38, 0xff, 0xf5, 0xff, 0x31, 0x02, 0xe4, 0x05, 0x82, 0x0a, 0x59, 0x0d, 
-0x2e, 0x0d, 0xe4, 0x0a, 0xec, 0x07, 0xcc, 0x05, 0x6c, 0x04, 0xbf, 0x02, 0x50, 0x00, 0x12, 0xfd, 
-0xfe, 0xf8, 0xc0, 0xf5, 0x45, 0xf3, 0xc2, 0xf0, 0xac, 0xed, 0xee, 0xe8, 0xf7, 0xe4, 0xb0, 0xe4, 
-0x76, 0xe9, 0xb8, 0xf3, 0x15, 0xff, 0x92, 0x07, 0x38, 0x0c, 0x35, 0x0d, 0x1f, 0x0e, 0x37, 0x10, 
-0x90, 0x11, 0x4d, 0x11, 0xee, 0x0c, 0xf5, 0x05, 0x70, 0xff, 0xf1, 0xfa, 0xba, 0xfa, 0x8c, 0xfc, 
-0x10, 0xfe, 0x42, 0xff, 0xf8, 0xff, 0xdb, 0x02, 0xab, 0x07, 0xde, 0x0b, 0x6c, 0x0e, 0xb4, 0x0d, 
-0x3d, 0x0b, 0x4f, 0x08, 0x6b, 0x05, 0xb9, 0x03, 0xb4, 0x01, 0x22, 0xff, 0x19, 0xfc, 0xf2, 0xf7, 
-0x86, 0xf4, 0x89, 0xf1, 0x90, 0xee, 0x6d, 0xeb, 0x6e, 0xe6, 0x89, 0xe3, 0x15, 0xe5, 0x4b, 0xec, 
-0x14, 0xf8, 0xec, 0x02, 0x0a, 0x0b, 0xa8, 0x0e, 0x16, 0x0f, 0xcd, 0x0f, 0xf8, 0x10, 0xcd, 0x11, 
-0xee, 0x0f, 0x7a, 0x0a, 0xb6, 0x03, 0xb7, 0xfd, 0x25, 0xfb, 0x54, 0xfb, 0x95, 0xfc, 0xda, 0xfd, 
-0xf0, 0xfe, 0x0d, 0x01, 0x4a, 0x04, 0xca, 0x08, 0x5f, 0x0c, 0xdf, 0x0d, 0xfa, 0x0c, 0x05, 0x0a, 
-0x72, 0x06, 0x98, 0x03, 0x50, 0x02, 0x0b, 0x01, 0x9f, 0xfe, 0xcf, 0xfa, 0x50, 0xf6, 0x65, 0xf3, 
-0x45, 0xf1, 0xbe, 0xee, 0x3a, 0xeb, 0x32, 0xe6, 0x38, 0xe4, 0x14, 0xe7, 0x09, 0xf0, 0xb7, 0xfc, 
-0x2e, 0x07, 0xe5, 0x0d, 0x45, 0x0f, 0x35, 0x0e, 0x79, 0x0e, 0x56, 0x0f, 0x48, 0x10, 0x00, 0x0e, 
-0x5d, 0x08, 0xca, 0x01, 0x1d, 0xfc, 0x25, 0xfa, 0x75, 0xfa, 0x92, 0xfc, 0x9d, 0xfe, 0x98, 0xff, 
-0x48, 0x01, 0x02, 0x04, 0xa8, 0x08, 0x22, 0x0d, 0x4b, 0x0f, 0x7a, 0x0e, 0x9c, 0x0a, 0x2b, 0x06, 
-0xf8, 0x02, 0x79, 0x01, 0xc5, 0x00, 0x5b, 0xff, 0xd1, 0xfb, 0xdc, 0xf6, 0x59, 0xf2, 0xaf, 0xee, 
-0x89, 0xec, 0x80, 0xe9, 0x9c, 0xe6, 0xf1, 0xe5, 0x6e, 0xe9, 0x97, 0xf2, 0xcf, 0xfd, 0x05, 0x08, 
-0x3d, 0x0e, 0x02, 0x10, 0x5b, 0x0f, 0x93, 0x0e, 0xc6, 0x0e, 0xd1, 0x0e, 0xd0, 0x0c, 0x0c, 0x08, 
-0xd5, 0x01, 0xb3, 0xfc, 0x03, 0xfa, 0x3c, 0xfa, 0x44, 0xfc, 0xb1, 0xfe, 0x01, 0x01, 0xd1, 0x02, 
-0x68, 0x05, 0xa8, 0x08, 0x35, 0x0c, 0x61, 0x0e, 0xcb, 0x0d, 0xa3, 0x0a, 0xb9, 0x05, 0xd4, 0x01, 
-0x7c, 0xff, 0x68, 0xfe, 0x4b, 0xfd, 0x45, 0xfa, 0x65, 0xf6, 0xe3, 0xf1, 0xb6, 0xed, 0xbc, 0xea, 
-0x85, 0xe7, 0x48, 0xe6, 0x85, 0xe7, 0xde, 0xec, 0x67, 0xf6, 0xeb, 0x00, 0x1c, 0x0a, 0x21, 0x0f, 
-0x41, 0x10, 0xe5, 0x0f, 0xa6, 0x0f, 0x15, 0x10, 0x3e, 0x0f, 0xcf, 0x0b, 0x1b, 0x06, 0xfe, 0xff, 
-0x7b, 0xfb, 0xf2, 0xf9, 0xcf, 0xfa, 0x2b, 0xfd, 0x56, 0xff, 0xae, 0x00, 0x2e, 0x02, 0x95, 0x04, 
-0x93, 0x08, 0x1b, 0x0c, 0x0e, 0x0e, 0x01, 0x0d, 0xb8, 0x09, 0x65, 0x05, 0x0c, 0x02, 0x03, 0x00, 
-0xed, 0xfe, 0x90, 0xfd, 0x61, 0xfa, 0x42, 0xf6, 0x7d, 0xf1, 0xad, 0xed, 0x98, 0xea, 0xb3, 0xe7, 
-0x8e, 0xe6, 0xc1, 0xe7, 0x6c, 0xed, 0x87, 0xf6, 0xe4, 0x00, 0x9f, 0x09, 0x30, 0x0e, 0x87, 0x0f, 
-0x16, 0x0f, 0xf7, 0x0e, 0x4b, 0x0f, 0xcd, 0x0e, 0x16, 0x0c, 0x2f, 0x07, 0xb4, 0x01, 0x82, 0xfd, 
-0xad, 0xfb, 0xe9, 0xfb, 0x7e, 0xfd, 0xe2, 0xfe, 0xf9, 0xff, 0x2d, 0x01, 0x19, 0x03, 0x61, 0x06, 
-0x8f, 0x09, 0x2a, 0x0c, 0x5e, 0x0c, 0x62, 0x0a, 0x15, 0x07, 0x5f, 0x03, 0x43, 0x01, 0x9f, 0xff, 
-0x4f, 0xfe, 0xab, 0xfb, 0x89, 0xf7, 0x4f, 0xf3, 0x8e, 0xee, 0xff, 0xea, 0x92, 0xe7, 0x3b, 0xe6, 
-0xf7, 0xe7, 0x29, 0xed, 0xf3, 0xf5, 0x45, 0xff, 0xb7, 0x07, 0xd1, 0x0c, 0xdf, 0x0e, 0x50, 0x0f, 
-0x1c, 0x0f, 0x39, 0x0f, 0x5c, 0x0e, 0x11, 0x0c, 0x14, 0x08, 0x05, 0x03, 0x94, 0xfe, 0x5b, 0xfb, 
-0x7e, 0xfa, 0x48, 0xfb, 0x3b, 0xfd, 0x76, 0xff, 0x84, 0x01, 0x04, 0x04, 0xd0, 0x06, 0xdb, 0x09, 
-0x5a, 0x0c, 0x15, 0x0d, 0x23, 0x0c, 0x03, 0x09, 0x7f, 0x05, 0x78, 0x02, 0x0c, 0x00, 0x18, 0xfe, 
-0x04, 0xfb, 0x50, 0xf7, 0x08, 0xf3, 0xb7, 0xee, 0x53, 0xeb, 0xfc, 0xe7, 0x54, 0xe6, 0x6b, 0xe7, 
-0xf2, 0xeb, 0x5d, 0xf4, 0x5e, 0xfd, 0x63, 0x06, 0xe5, 0x0b, 0x6a, 0x0e, 0xf4, 0x0e, 0x55, 0x0e, 
-0x93, 0x0e, 0xcd, 0x0d, 0x94, 0x0c, 0x3b, 0x09, 0x63, 0x04, 0xaa, 0xff, 0xcc, 0xfb, 0x9d, 0xfa, 
-0x33, 0xfb, 0x12, 0xfd, 0x36, 0xff, 0xe6, 0x00, 0x11, 0x03, 0xb9, 0x05, 0x02, 0x09, 0x38, 0x0c, 
-0x82, 0x0d, 0x09, 0x0d, 0xfd, 0x09, 0x50, 0x06, 0x05, 0x03, 0x6e, 0x00, 0xae, 0xfe, 0xea, 0xfb, 
-0xa8, 0xf8, 0x79, 0xf4, 0x36, 0xf0, 0x75, 0xec, 0xe6, 0xe8, 0x80, 0xe6, 0x8f, 0xe6, 0x42, 0xea, 
-0xec, 0xf1, 0x3d, 0xfb, 0x79, 0x04, 0xef, 0x0a, 0x17, 0x0e, 0xe7, 0x0e, 0x88, 0x0e, 0x92, 0x0e, 
-0x40, 0x0e, 0x3a, 0x0d, 0x40, 0x0a, 0x88, 0x05, 0x71, 0x00, 0x4b, 0xfc, 0xae, 0xfa, 0x07, 0xfb, 
-0xdd, 0xfc, 0xaf, 0xfe, 0x64, 0x00, 0x0e, 0x02, 0x96, 0x04, 0x06, 0x08, 0x92, 0x0b, 0xca, 0x0d, 
-0x8b, 0x0d, 0xf1, 0x0a, 0x79, 0x06, 0x6a, 0x02, 0x30, 0xff, 0x67, 0xfd, 0xa7, 0xfb, 0xf9, 0xf8, 
-0x7a, 0xf5, 0xd8, 0xf0, 0xba, 0xec, 0xda, 0xe8, 0x51, 0xe6, 0x6d, 0xe6, 0xed, 0xe9, 0x9e, 0xf1, 
-0xd9, 0xfa, 0x4e, 0x04, 0xee, 0x0a, 0x4f, 0x0e, 0x19, 0x0f, 0xac, 0x0e, 0xe3, 0x0e, 0x08, 0x0f, 
-0x98, 0x0e, 0xe1, 0x0b, 0x05, 0x07, 0x3a, 0x01, 0x61, 0xfc, 0x1e, 0xfa, 0x67, 0xfa, 0x6f, 0xfc, 
-0x92, 0xfe, 0x50, 0x00, 0xe9, 0x01, 0x0b, 0x04, 0x2f, 0x07, 0x96, 0x0a, 0x25, 0x0d, 0x73, 0x0d, 
-0x2f, 0x0b, 0xff, 0x06, 0x83, 0x02, 0x34, 0xff, 0x66, 0xfd, 0x40, 0xfc, 0x76, 0xfa, 0x4d, 0xf7, 
-0x2c, 0xf3, 0x79, 0xee, 0x65, 0xea, 0x11, 0xe7, 0x2b, 0xe6, 0x9a, 0xe8, 0xbb, 0xee, 0x8d, 0xf7, 
-0x83, 0x00, 0xf9, 0x07, 0xf7, 0x0b, 0x7f, 0x0d, 0xa2, 0x0d, 0x29, 0x0e, 0x1d, 0x0f, 0x47, 0x0f, 
-0x92, 0x0d, 0x23, 0x09, 0x87, 0x03, 0x24, 0xfe, 0x01, 0xfb, 0x7f, 0xfa, 0xd3, 0xfb, 0xf6, 0xfd, 
-0x8b, 0xff, 0x65, 0x01, 0x13, 0x03, 0x33, 0x06, 0x6d, 0x09, 0x62, 0x0c, 0xcf, 0x0d, 0x88, 0x0c, 
-0xa5, 0x09, 0x2d, 0x05, 0xab, 0x01, 0x0c, 0xff, 0x9b, 0xfd, 0x04, 0xfc, 0x51, 0xf9, 0xb9, 0xf5, 
-0x04, 0xf1, 0x75, 0xec, 0x33, 0xe8, 0xbf, 0xe5, 0xc0, 0xe6, 0x86, 0xeb, 0xdb, 0xf3, 0x01, 0xfd, 
-0x16, 0x05, 0x2a, 0x0a, 0x60, 0x0c, 0x2b, 0x0d, 0xa1, 0x0d, 0xc1, 0x0e, 0x1c, 0x0f, 0xe6, 0x0d, 
-0x21, 0x0a, 0xa4, 0x04, 0x34, 0xff, 0x46, 0xfb, 0xf9, 0xf9, 0x95, 0xfa, 0x8c, 0xfc, 0x79, 0xfe, 
-0x8d, 0x00, 0x78, 0x02, 0x08, 0x05, 0x51, 0x08, 0x5e, 0x0b, 0x8d, 0x0d, 0x4d, 0x0d, 0x2e, 0x0b, 
-0x44, 0x07, 0x59, 0x03, 0x19, 0x00, 0xfc, 0xfd, 0x65, 0xfc, 0x4b, 0xfa, 0xa9, 0xf7, 0x97, 0xf3, 
-0x31, 0xef, 0x93, 0xea, 0xde, 0xe6, 0xed, 0xe5, 0x84, 0xe8, 0x48, 0xef, 0x12, 0xf8, 0x2c, 0x01, 
-0xe7, 0x07, 0xb8, 0x0b, 0x3c, 0x0d, 0x84, 0x0d, 0x41, 0x0e, 0xb7, 0x0e, 0xba, 0x0e, 0xaf, 0x0c, 
-0xb0, 0x08, 0x2d, 0x03, 0x00, 0xfe, 0xcb, 0xfa, 0xf9, 0xf9, 0x73, 0xfb, 0xb3, 0xfd, 0x0e, 0x00, 
-0xf4, 0x01, 0x79, 0x03, 0xb4, 0x05, 0xd3, 0x08, 0xfd, 0x0b, 0xde, 0x0d, 0x3a, 0x0d, 0x67, 0x0a, 
-0x20, 0x06, 0x35, 0x02, 0x13, 0xff, 0x2b, 0xfd, 0x98, 0xfb, 0x6b, 0xf9, 0x94, 0xf6, 0x70, 0xf2, 
-0x2a, 0xee, 0x98, 0xe9, 0x43, 0xe6, 0xae, 0xe5, 0xe7, 0xe8, 0x4f, 0xf0, 0x79, 0xf9, 0x83, 0x02, 
-0x8c, 0x08, 0x67, 0x0b, 0xf3, 0x0b, 0x04, 0x0c, 0x08, 0x0d, 0x47, 0x0e, 0x0b, 0x0f, 0x48, 0x0d, 
-0x30, 0x09, 0xa0, 0x03, 0x95, 0xfe, 0xf6, 0xfb, 0xc2, 0xfb, 0x56, 0xfd, 0x36, 0xff, 0xb7, 0x00, 
-0x87, 0x01, 0x77, 0x02, 0x65, 0x04, 0xc5, 0x07, 0x43, 0x0b, 0x26, 0x0d, 0x64, 0x0c, 0x35, 0x09, 
-0x55, 0x05, 0xe2, 0x01, 0xbf, 0xff, 0x16, 0xfe, 0x33, 0xfc, 0xa2, 0xf9, 0x33, 0xf6, 0x48, 0xf2, 
-0x14, 0xee, 0xbc, 0xe9, 0x3a, 0xe6, 0x70, 0xe5, 0xd4, 0xe8, 0x5d, 0xf0, 0xeb, 0xf9, 0x8c, 0x02, 
-0x2e, 0x08, 0x78, 0x0a, 0xf8, 0x0a, 0xa6, 0x0b, 0x43, 0x0d, 0x41, 0x0f, 0xed, 0x0f, 0xd9, 0x0d, 
-0x48, 0x09, 0x52, 0x03, 0x95, 0xfe, 0x56, 0xfc, 0xb2, 0xfc, 0x7d, 0xfe, 0xf9, 0xff, 0xbf, 0x00, 
-0xde, 0x00, 0x98, 0x01, 0xfc, 0x03, 0x1a, 0x08, 0x2a, 0x0c, 0xfb, 0x0d, 0xe3, 0x0c, 0x2a, 0x09, 
-0xe9, 0x04, 0x71, 0x01, 0x39, 0xff, 0xf2, 0xfd, 0x5b, 0xfc, 0x2a, 0xfa, 0xda, 0xf6, 0xc5, 0xf2, 
-0x63, 0xee, 0xe2, 0xe9, 0x25, 0xe6, 0xcd, 0xe4, 0x9d, 0xe7, 0xc9, 0xee, 0x76, 0xf8, 0x04, 0x02, 
-0x69, 0x08, 0x5a, 0x0b, 0xb6, 0x0b, 0xd9, 0x0b, 0x0d, 0x0d, 0x8a, 0x0e, 0x2b, 0x0f, 0x21, 0x0d, 
-0x17, 0x09, 0xab, 0x03, 0xc9, 0xfe, 0xf5, 0xfb, 0x3e, 0xfb, 0x83, 0xfc, 0x7e, 0xfe, 0xe6, 0x00, 
-0x2c, 0x03, 0x7a, 0x05, 0x7b, 0x08, 0x07, 0x0b, 0xfb, 0x0c, 0x9f, 0x0d, 0xdc, 0x0b, 0x61, 0x08, 
-0x1e, 0x04, 0xed, 0xff, 0x8f, 0xfc, 0x2f, 0xfa, 0x9d, 0xf8, 0x50, 0xf7, 0x02, 0xf6, 0x2f, 0xf4, 
-0x6e, 0xf1, 0xbe, 0xed, 0x25, 0xe8, 0x7e, 0xe3, 0x50, 0xe4, 0xe5, 0xe9, 0x17, 0xf4, 0x67, 0x01, 
-0x25, 0x0c, 0x9f, 0x12, 0x92, 0x13, 0x84, 0x0f, 0x4c, 0x0b, 0x5c, 0x09, 0xaa, 0x09, 0x99, 0x0a, 
-0xa0, 0x0a, 0x78, 0x07, 0xea, 0x00, 0x03, 0xfa, 0x3f, 0xf5, 0xdf, 0xf5, 0x7a, 0xfb, 0xc0, 0x02, 
-0x78, 0x08, 0xf5, 0x0a, 0xce, 0x0b, 0xc0, 0x0b, 0xcd, 0x0b, 0xdd, 0x0c, 0xa4, 0x0c, 0xb4, 0x09, 
-0x72, 0x05, 0xb5, 0x01, 0x21, 0xff, 0xf1, 0xfc, 0x93, 0xfa, 0x40, 0xf8, 0xe9, 0xf5, 0xd9, 0xf3, 
-0xdf, 0xf2, 0x50, 0xf1, 0x7d, 0xee, 0x11, 0xea, 0xb4, 0xe4, 0xd2, 0xe5, 0x91, 0xed, 0xec, 0xf6, 
-0xf9, 0x02, 0xd4, 0x0d, 0xbf, 0x13, 0x75, 0x14, 0xbe, 0x0f, 0x9a, 0x08, 0xf6, 0x03, 0x6d, 0x04, 
-0x98, 0x06, 0xb4, 0x07, 0xfb, 0x04, 0x33, 0xfe, 0x0c, 0xf8, 0xca, 0xf5, 0xc8, 0xfa, 0x0c, 0x04, 
-0xd8, 0x0b, 0x5b, 0x0f, 0xfa, 0x0c, 0x6a, 0x08, 0x81, 0x05, 0xd4, 0x05, 0x5c, 0x08, 0xc1, 0x09, 
-0x5b, 0x08, 0x77, 0x04, 0xaf, 0x00, 0x91, 0xfe, 0x5d, 0xfd, 0x1f, 0xfc, 0xde, 0xf9, 0x30, 0xf7, 
-0xfa, 0xf5, 0xfa, 0xf5, 0xde, 0xf5, 0xab, 0xf4, 0xd0, 0xef, 0x6e, 0xe7, 0xc0, 0xe0, 0x71, 0xe2, 
-0x7b, 0xef, 0x31, 0x04, 0xea, 0x16, 0x8a, 0x1f, 0x5a, 0x1c, 0xad, 0x0f, 0x60, 0x01, 0xc1, 0xf8, 
-0xc5, 0xf7, 0x00, 0xfc, 0x40, 0x00, 0x4e, 0x01, 0xce, 0xff, 0x3d, 0xfe, 0xbd, 0xff, 0xff, 0x04, 
-0x9e, 0x0a, 0x67, 0x0e, 0xb8, 0x0d, 0x6e, 0x08, 0x01, 0x03, 0xcd, 0x00, 0x82, 0x03, 0x63, 0x08, 
-0xa4, 0x0b, 0xd9, 0x0a, 0xf5, 0x05, 0x3d, 0x00, 0x7a, 0xfc, 0x79, 0xfc, 0x47, 0xff, 0x0f, 0x01, 
-0x4c, 0xfe, 0xb6, 0xf8, 0xfe, 0xf3, 0x6d, 0xf2, 0xee, 0xf2, 0x79, 0xf1, 0xd8, 0xec, 0x33, 0xe4, 
-0x0d, 0xdf, 0x7d, 0xe6, 0x05, 0xfa, 0x9b, 0x13, 0xa3, 0x24, 0x1a, 0x24, 0x44, 0x14, 0xd8, 0xfe, 
-0x4d, 0xf0, 0xd8, 0xed, 0x3a, 0xf6, 0xb9, 0x01, 0x5c, 0x08, 0x34, 0x08, 0x4d, 0x04, 0x02, 0x03, 
-0x4c, 0x05, 0x13, 0x08, 0xa2, 0x08, 0xfc, 0x03, 0x4b, 0xff, 0x65, 0xfe, 0x6a, 0x01, 0x44, 0x09, 
-0xd0, 0x0e, 0x05, 0x0f, 0xfd, 0x0a, 0xc7, 0x03, 0x76, 0xff, 0x05, 0xff, 0x0c, 0x01, 0xa3, 0x02, 
-0xe6, 0x01, 0xda, 0xff, 0x7e, 0xfd, 0x50, 0xfc, 0x0c, 0xfa, 0x10, 0xf6, 0x22, 0xf1, 0xbf, 0xec, 
-0x55, 0xeb, 0x2c, 0xec, 0x4e, 0xea, 0xb9, 0xe6, 0xd5, 0xeb, 0x4d, 0xfc, 0xd7, 0x13, 0xa4, 0x24, 
-0xdf, 0x21, 0x18, 0x0e, 0x47, 0xf5, 0x95, 0xe8, 0xeb, 0xec, 0xb8, 0xfb, 0xa7, 0x09, 0x50, 0x0d, 
-0xa7, 0x08, 0xd3, 0x02, 0x96, 0x01, 0x56, 0x05, 0xb2, 0x08, 0xb3, 0x06, 0xe2, 0xff, 0x75, 0xfa, 
-0xcf, 0xfc, 0x5c, 0x06, 0x06, 0x11, 0x15, 0x14, 0xf7, 0x0c, 0x04, 0x03, 0x80, 0xfc, 0x89, 0xfd, 
-0x4a, 0x03, 0xf6, 0x07, 0x96, 0x08, 0x39, 0x04, 0x46, 0xfe, 0xad, 0xf8, 0xc6, 0xf5, 0xe9, 0xf4, 
-0x10, 0xf5, 0x69, 0xf5, 0xdd, 0xf6, 0x33, 0xf9, 0x81, 0xf7, 0xe5, 0xf0, 0xbf, 0xe4, 0xf0, 0xde, 
-0x19, 0xeb, 0x9f, 0x04, 0x48, 0x20, 0x25, 0x2a, 0xdb, 0x1b, 0x37, 0x00, 0x68, 0xea, 0xa7, 0xe8, 
-0x74, 0xf5, 0x96, 0x04, 0x39, 0x0a, 0x17, 0x06, 0xb6, 0x01, 0x61, 0x02, 0x8d, 0x08, 0x11, 0x0c, 
-0x85, 0x08, 0xa2, 0x00, 0x93, 0xfa, 0xf4, 0xfe, 0x91, 0x08, 0x07, 0x10, 0xc9, 0x0f, 0x1b, 0x07, 
-0xb3, 0xfe, 0xc4, 0xfc, 0xec, 0x01, 0x4c, 0x08, 0xf3, 0x09, 0x59, 0x07, 0x03, 0x02, 0x55, 0xfe, 
-0xe3, 0xfb, 0x4f, 0xf8, 0xb2, 0xf5, 0xa0, 0xf4, 0x46, 0xf6, 0xf0, 0xf8, 0x04, 0xfc, 0x39, 0xfb, 
-0x4f, 0xf4, 0x84, 0xea, 0x3f, 0xdf, 0x45, 0xdf, 0xa5, 0xf0, 0x85, 0x0b, 0xb1, 0x23, 0xbb, 0x25, 
-0xbe, 0x11, 0xd0, 0xf6, 0x87, 0xe6, 0xd9, 0xeb, 0xdc, 0xfb, 0xf0, 0x08, 0x88, 0x0b, 0xc8, 0x05, 
-0x6f, 0x04, 0x22, 0x08, 0xac, 0x0b, 0xa4, 0x09, 0xd8, 0xff, 0x22, 0xf8, 0xdb, 0xf8, 0xf2, 0x00, 
-0x54, 0x0c, 0xee, 0x11, 0x40, 0x10, 0x67, 0x0a, 0x18, 0x03, 0x2b, 0x00, 0x82, 0x00, 0xaf, 0x02, 
-0x74, 0x04, 0xf1, 0x05, 0x01, 0x06, 0x22, 0x03, 0x77, 0xfd, 0x07, 0xf6, 0x65, 0xf2, 0xcb, 0xf5, 
-0x72, 0xfb, 0xf0, 0xfe, 0x9d, 0xfd, 0x9c, 0xf9, 0xd2, 0xf5, 0x26, 0xf0, 0xe9, 0xe7, 0x32, 0xdf, 
-0x3b, 0xe4, 0x28, 0xfa, 0x25, 0x17, 0x42, 0x29, 0xa3, 0x1f, 0x52, 0x04, 0x32, 0xeb, 0xfc, 0xe4, 
-0xd6, 0xf3, 0x14, 0x06, 0x84, 0x0f, 0x9d, 0x0b, 0xec, 0x03, 0x45, 0x02, 0x7a, 0x05, 0x02, 0x09, 
-0x4e, 0x04, 0x75, 0xfb, 0x9d, 0xf7, 0x9d, 0xfd, 0x03, 0x09, 0x57, 0x11, 0x2e, 0x0f, 0x7b, 0x07, 
-0x9f, 0x02, 0xb3, 0x01, 0xc9, 0x05, 0x3a, 0x07, 0x68, 0x05, 0x80, 0x02, 0x23, 0x00, 0xd0, 0xff, 
-0xbc, 0xfe, 0xb6, 0xfc, 0x63, 0xfa, 0xad, 0xfa, 0xa2, 0xfd, 0x5e, 0xff, 0xf3, 0xfc, 0xd8, 0xf7, 
-0x9c, 0xf4, 0x33, 0xf3, 0x9c, 0xef, 0x9b, 0xe6, 0x6e, 0xdf, 0xf1, 0xe8, 0x1e, 0x03, 0x92, 0x20, 
-0xba, 0x29, 0x4b, 0x14, 0xa2, 0xf3, 0x05, 0xe0, 0x8d, 0xe7, 0xd3, 0xfe, 0x56, 0x0f, 0x53, 0x10, 
-0x7b, 0x06, 0x93, 0x00, 0x74, 0x02, 0xf7, 0x06, 0x0c, 0x07, 0xae, 0xff, 0x9e, 0xfa, 0xfc, 0xfb, 
-0x4e, 0x05, 0xd6, 0x0e, 0xd8, 0x0f, 0xa6, 0x09, 0xb3, 0x02, 0x8c, 0x01, 0xbb, 0x02, 0x9c, 0x04, 
-0x7c, 0x04, 0xbf, 0x03, 0x66, 0x06, 0x29, 0x07, 0x9f, 0x03, 0x83, 0xfc, 0xc6, 0xf7, 0x86, 0xf9, 
-0x33, 0xfe, 0xb3, 0x02, 0xa4, 0xff, 0x22, 0xf9, 0xaa, 0xf5, 0x0e, 0xf4, 0xa6, 0xf8, 0xa0, 0xf9, 
-0x48, 0xf2, 0x9a, 0xe6, 0xc1, 0xe0, 0x8e, 0xef, 0x3f, 0x09, 0x0f, 0x1e, 0x8f, 0x1d, 0xa8, 0x07, 
-0x5d, 0xf1, 0x11, 0xeb, 0x30, 0xf6, 0x41, 0x04, 0xcf, 0x07, 0xaf, 0x03, 0x9e, 0x01, 0x4b, 0x06, 
-0x5d, 0x0c, 0x93, 0x08, 0x02, 0xfe, 0x51, 0xf6, 0xe4, 0xfa, 0x61, 0x08, 0xcd, 0x11, 0x43, 0x11, 
-0x59, 0x06, 0x9c, 0xfe, 0x34, 0x01, 0x16, 0x07, 0x90, 0x0a, 0x86, 0x06, 0xb5, 0x01, 0x43, 0x02, 
-0xe4, 0x05, 0x25, 0x08, 0x4e, 0x02, 0x1f, 0xfc, 0xeb, 0xfa, 0xe7, 0xfc, 0x04, 0xff, 0x03, 0xfc, 
-0xfd, 0xf5, 0x37, 0xf4, 0x50, 0xf8, 0xe2, 0xfb, 0xe4, 0xfb, 0xf7, 0xf4, 0x1d, 0xe8, 0xd4, 0xdc, 
-0xc5, 0xe1, 0x32, 0xfb, 0x08, 0x18, 0xb4, 0x23, 0xde, 0x14, 0x4e, 0xf9, 0x77, 0xe8, 0x0f, 0xed, 
-0x2e, 0xfe, 0x59, 0x0b, 0xe8, 0x0b, 0xd1, 0x06, 0x30, 0x04, 0x66, 0x06, 0x55, 0x06, 0x64, 0x00, 
-0xa9, 0xfb, 0x4b, 0xfc, 0x60, 0x05, 0xd5, 0x0d, 0xa6, 0x0e, 0x4f, 0x08, 0xa8, 0x00, 0xb9, 0x00, 
-0x91, 0x05, 0xa4, 0x08, 0xdb, 0x07, 0x64, 0x06, 0x9f, 0x06, 0x67, 0x07, 0x41, 0x06, 0x2a, 0x01, 
-0xd4, 0xfb, 0x89, 0xfb, 0xc3, 0xfe, 0xfb, 0x00, 0xce, 0xfc, 0x60, 0xf5, 0xfc, 0xf0, 0xde, 0xf3, 
-0x47, 0xfe, 0x83, 0x02, 0xb2, 0xfe, 0x02, 0xf5, 0xff, 0xe6, 0x7f, 0xdd, 0x5a, 0xdf, 0xd1, 0xf3, 
-0xc2, 0x10, 0x49, 0x22, 0x25, 0x1b, 0xb5, 0x01, 0x74, 0xec, 0x42, 0xe9, 0x68, 0xf6, 0xfb, 0x05, 
-0x0e, 0x0d, 0x3b, 0x0b, 0xdd, 0x07, 0xdb, 0x06, 0x4a, 0x05, 0xe4, 0xff, 0x70, 0xfb, 0x82, 0xfd, 
-0xc0, 0x05, 0x21, 0x0e, 0x72, 0x0f, 0x1a, 0x0a, 0x4a, 0x02, 0x5f, 0x00, 0x75, 0x03, 0xa7, 0x06, 
-0xd4, 0x08, 0xcb, 0x09, 0x6c, 0x0a, 0xc3, 0x08, 0x78, 0x03, 0x59, 0xfd, 0x88, 0xfa, 0xca, 0xfb, 
-0xb3, 0xff, 0x14, 0x01, 0x47, 0xff, 0x32, 0xf9, 0x1d, 0xf3, 0x13, 0xf3, 0xed, 0xf7, 0x5a, 0xfd, 
-0x1c, 0xfc, 0x81, 0xf7, 0xfa, 0xf0, 0x85, 0xe7, 0xcd, 0xdf, 0x2a, 0xe3, 0x1d, 0xfa, 0x1b, 0x18, 
-0x9d, 0x24, 0xb8, 0x16, 0x07, 0xfa, 0xaf, 0xe7, 0x3c, 0xeb, 0x35, 0xfb, 0x86, 0x09, 0x97, 0x0d, 
-0xa8, 0x0d, 0x07, 0x0d, 0x9a, 0x09, 0x00, 0x01, 0x9f, 0xf8, 0xf8, 0xf8, 0xfa, 0x01, 0x0b, 0x0d, 
-0x0b, 0x10, 0x9c, 0x0b, 0x91, 0x04, 0xcc, 0x01, 0x13, 0x04, 0x36, 0x05, 0xb5, 0x05, 0x4c, 0x07, 
-0xed, 0x0a, 0x92, 0x0b, 0x61, 0x04, 0xf3, 0xfb, 0x8a, 0xf8, 0x4e, 0xfc, 0xfa, 0x01, 0x34, 0x02, 
-0x2c, 0xff, 0xa5, 0xfb, 0xa4, 0xf8, 0x2c, 0xf5, 0x35, 0xf4, 0x3b, 0xf8, 0xfc, 0xfc, 0xd5, 0xfd, 
-0x74, 0xfa, 0xee, 0xf2, 0x05, 0xe7, 0x93, 0xdb, 0x3d, 0xdf, 0x17, 0xfc, 0xce, 0x1c, 0xa3, 0x28, 
-0x63, 0x17, 0xba, 0xf9, 0x77, 0xea, 0x74, 0xeb, 0x4f, 0xf5, 0x12, 0x00, 0xdb, 0x09, 0xea, 0x13, 
-0x0f, 0x18, 0xb0, 0x0e, 0x4d, 0xfc, 0x50, 0xf1, 0x97, 0xf5, 0x11, 0x03, 0x7a, 0x0d, 0x7e, 0x10, 
-0x0a, 0x0e, 0x50, 0x0a, 0x73, 0x06, 0xcc, 0x00, 0xf6, 0xfe, 0xf8, 0x01, 0x8d, 0x08, 0x18, 0x0c, 
-0x40, 0x07, 0x23, 0x02, 0x1c, 0xff, 0x9d, 0xfd, 0x7b, 0xfc, 0x81, 0xfc, 0xe5, 0x00, 0x0a, 0x03, 
-0x69, 0xfd, 0x09, 0xf4, 0xa9, 0xf0, 0x7b, 0xf7, 0xb9, 0xfe, 0x2c, 0xff, 0xfe, 0xfb, 0x60, 0xf9, 
-0x20, 0xf6, 0x75, 0xed, 0xdf, 0xe1, 0x94, 0xdd, 0x2e, 0xee, 0x35, 0x0c, 0x40, 0x20, 0xbc, 0x1e, 
-0x40, 0x09, 0x90, 0xf4, 0x44, 0xed, 0x6e, 0xf1, 0x5b, 0xfc, 0xec, 0x05, 0x18, 0x10, 0xf7, 0x15, 
-0xa9, 0x10, 0x24, 0x04, 0x71, 0xf7, 0xfa, 0xf5, 0xc5, 0xfd, 0x4a, 0x06, 0x22, 0x0d, 0x9d, 0x0f, 
-0x3f, 0x0d, 0x5f, 0x06, 0x6b, 0xff, 0x80, 0xfc, 0x4f, 0x01, 0x07, 0x0a, 0x78, 0x0d, 0x6b, 0x0b, 
-0xe5, 0x06, 0x74, 0x02, 0x2e, 0xfe, 0x74, 0xfa, 0x21, 0xfa, 0x07, 0xff, 0xf9, 0x03, 0xdc, 0x01, 
-0x06, 0xf9, 0x8d, 0xf3, 0x5d, 0xf4, 0x28, 0xf7, 0x8b, 0xf9, 0x96, 0xf9, 0x99, 0xfb, 0xc3, 0xf9, 
-0xd2, 0xf1, 0x23, 0xe8, 0x32, 0xe0, 0x2f, 0xe7, 0xf6, 0xfd, 0x43, 0x15, 0x0d, 0x1d, 0x48, 0x10, 
-0x68, 0xfd, 0x05, 0xf3, 0xf4, 0xf0, 0xd9, 0xf5, 0x93, 0x00, 0xd3, 0x0c, 0xb1, 0x15, 0xc9, 0x14, 
-0x41, 0x09, 0xb2, 0xfd, 0x9d, 0xf8, 0x68, 0xf9, 0x8c, 0xff, 0x68, 0x07, 0xf1, 0x0e, 0xc8, 0x10, 
-0x17, 0x0b, 0xa0, 0x03, 0xb7, 0xfd, 0x9f, 0xfd, 0x2c, 0x02, 0x7d, 0x05, 0x12, 0x09, 0x2a, 0x0b, 
-0xc7, 0x08, 0x28, 0x04, 0x62, 0xfe, 0x4b, 0xfb, 0xa1, 0xfc, 0x3a, 0xff, 0xa3, 0xff, 0x23, 0xfe, 
-0x1a, 0xfb, 0x45, 0xf8, 0xd2, 0xf5, 0x19, 0xf4, 0x64, 0xf7, 0x78, 0xfc, 0xbf, 0xff, 0xfb, 0xfd, 
-0xe6, 0xf8, 0x3f, 0xf0, 0x92, 0xe4, 0x75, 0xe2, 0x67, 0xf0, 0x9f, 0x06, 0xfb, 0x13, 0x8d, 0x15, 
-0x3a, 0x0d, 0xb5, 0xff, 0x58, 0xf5, 0x80, 0xef, 0x15, 0xf6, 0x7f, 0x04, 0x5b, 0x0f, 0x84, 0x13, 
-0x3d, 0x0f, 0x86, 0x06, 0x84, 0xfe, 0xbb, 0xf9, 0xbb, 0xfa, 0x6e, 0x01, 0x48, 0x0a, 0xb4, 0x0e, 
-0x0b, 0x0c, 0xd8, 0x07, 0x35, 0x04, 0x0d, 0x01, 0x06, 0xff, 0xc5, 0xfe, 0xfe, 0x02, 0x4e, 0x0a, 
-0x6b, 0x0c, 0x26, 0x08, 0x7d, 0x01, 0x55, 0xfb, 0xd1, 0xf8, 0xc0, 0xfa, 0xe2, 0xfe, 0x6e, 0xff, 
-0x01, 0xfd, 0xfb, 0xf8, 0x62, 0xf7, 0xe9, 0xf8, 0x7d, 0xfa, 0x0b, 0xfc, 0x25, 0xfc, 0x34, 0xfc, 
-0x71, 0xf9, 0x2b, 0xf4, 0x9c, 0xf0, 0xed, 0xed, 0x89, 0xeb, 0x95, 0xf1, 0x7c, 0xff, 0x64, 0x0e, 
-0x49, 0x14, 0xf6, 0x0a, 0xbb, 0x00, 0x00, 0xfb, 0xce, 0xf8, 0x6b, 0xf9, 0xc1, 0xfe, 0xe4, 0x08, 
-0xd8, 0x0e, 0x1f, 0x0e, 0x97, 0x09, 0x73, 0x03, 0xa1, 0xfe, 0x52, 0xfc, 0x05, 0xfe, 0x58, 0x04, 
-0x6f, 0x09, 0x81, 0x0c, 0xc8, 0x0b, 0xd5, 0x09, 0xd4, 0x04, 0xfc, 0xfc, 0xd7, 0xfc, 0x72, 0x00, 
-0x6a, 0x05, 0xcb, 0x08, 0xa7, 0x07, 0x37, 0x05, 0x64, 0x01, 0xb1, 0xfd, 0x9b, 0xfc, 0x25, 0xfc, 
-0xe3, 0xfb, 0x39, 0xfa, 0x3d, 0xf6, 0xe2, 0xf5, 0x89, 0xf9, 0x4d, 0xfa, 0x87, 0xf8, 0x09, 0xfb, 
-0xdf, 0xfe, 0xdc, 0xfd, 0x34, 0xf6, 0x01, 0xf2, 0xec, 0xef, 0x43, 0xea, 0x59, 0xed, 0x72, 0xfa, 
-0xd6, 0x09, 0x2c, 0x13, 0x45, 0x11, 0x90, 0x07, 0x5b, 0x00, 0xd9, 0xf9, 0x13, 0xf6, 0x2a, 0xfb, 
-0x8c, 0x02, 0x70, 0x0c, 0xcc, 0x11, 0xe8, 0x0e, 0xde, 0x09, 0xac, 0x02, 0x43, 0xfc, 0x27, 0xfb, 
-0x3c, 0xfe, 0xe7, 0x04, 0x96, 0x0b, 0x4f, 0x0d, 0xa3, 0x09, 0xf4, 0x05, 0x8a, 0x03, 0x4e, 0xfe, 
-0x96, 0xfc, 0xe9, 0xff, 0x1b, 0x05, 0x5f, 0x07, 0xbc, 0x05, 0x4a, 0x04, 0x89, 0x01, 0xc4, 0xfc, 
-0xf7, 0xf7, 0x22, 0xf7, 0x96, 0xf8, 0x3f, 0xf9, 0x11, 0xfa, 0x1a, 0xfb, 0x05, 0xfb, 0x21, 0xf9, 
-0x2d, 0xfb, 0x06, 0xfe, 0xa5, 0xf7, 0x67, 0xf6, 0xc1, 0xfb, 0x55, 0xf8, 0x69, 0xf2, 0x65, 0xf0, 
-0xb5, 0xf2, 0x66, 0xfa, 0x10, 0x03, 0x80, 0x09, 0xc5, 0x10, 0xea, 0x0d, 0x8b, 0x03, 0x04, 0xff, 
-0x0d, 0xfc, 0xd0, 0xfa, 0x0a, 0xfd, 0x9c, 0x06, 0x99, 0x0e, 0x83, 0x0d, 0xd2, 0x0c, 0x61, 0x09, 
-0x80, 0x01, 0x4c, 0xfc, 0x44, 0xfc, 0x1f, 0x01, 0x40, 0x04, 0x99, 0x06, 0xaf, 0x0a, 0x4c, 0x0a, 
-0x29, 0x07, 0x1b, 0x03, 0xf9, 0xfd, 0x82, 0xfc, 0x4a, 0xfd, 0x2e, 0xff, 0xc8, 0x04, 0x03, 0x08, 
-0xc3, 0x05, 0x68, 0x01, 0x02, 0xfd, 0xb8, 0xf7, 0x24, 0xf3, 0x2c, 0xf4, 0x7f, 0xf8, 0xf7, 0xfb, 
-0x03, 0xfe, 0xf9, 0xfd, 0x24, 0xfe, 0xb4, 0xfd, 0xe7, 0xf6, 0x09, 0xf5, 0x83, 0xf8, 0x1e, 0xf8, 
-0xd6, 0xf9, 0x75, 0xf5, 0x57, 0xf3, 0x18, 0xf9, 0x83, 0xfa, 0xcd, 0x00, 0x09, 0x0b, 0x3e, 0x0e, 
-0x10, 0x0b, 0x8b, 0x07, 0x1e, 0x03, 0x9b, 0xfc, 0x31, 0xfb, 0xc6, 0xff, 0x8f, 0x05, 0xf7, 0x08, 
-0x68, 0x0a, 0x4c, 0x0b, 0xd4, 0x08, 0xa6, 0x03, 0x3e, 0xff, 0x2f, 0xfe, 0x23, 0xff, 0xd8, 0x01, 
-0x43, 0x05, 0xf1, 0x07, 0x7e, 0x08, 0x21, 0x05, 0xcb, 0x03, 0xdf, 0x00, 0x03, 0xfd, 0x62, 0xfd, 
-0xe6, 0xfe, 0x5d, 0x02, 0x14, 0x04, 0xa5, 0x04, 0xe6, 0x03, 0xbd, 0xfe, 0x3d, 0xfa, 0x9b, 0xf7, 
-0xf0, 0xf5, 0x3f, 0xf5, 0x7f, 0xf7, 0x86, 0xfc, 0x82, 0xfd, 0x48, 0xfe, 0xd5, 0x00, 0x5c, 0xfb, 
-0xd7, 0xf7, 0xa4, 0xf7, 0xe4, 0xf5, 0xce, 0xf6, 0xb8, 0xf5, 0x01, 0xf9, 0x3e, 0xfc, 0xe8, 0xfc, 
-0xee, 0x03, 0x7d, 0x0a, 0xbb, 0x0a, 0x91, 0x06, 0x59, 0x05, 0xaf, 0x04, 0xbb, 0xfe, 0x28, 0xfe, 
-0x6b, 0x00, 0x22, 0x00, 0xa4, 0x03, 0x65, 0x07, 0x4b, 0x08, 0x6e, 0x07, 0xad, 0x05, 0x64, 0x02, 
-0x58, 0x00, 0xc9, 0x00, 0xdc, 0x00, 0x53, 0x02, 0x85, 0x03, 0x1c, 0x04, 0xd5, 0x04, 0xf1, 0x04, 
-0xca, 0x02, 0x77, 0x00, 0x8f, 0x00, 0xd8, 0x00, 0x84, 0x02, 0xc6, 0x02, 0xf5, 0x02, 0x23, 0x02, 
-0x23, 0xff, 0x9f, 0xfd, 0xc3, 0xfa, 0x06, 0xf7, 0x17, 0xf7, 0x00, 0xf8, 0xbe, 0xf8, 0x85, 0xfb, 
-0x02, 0xff, 0xbe, 0xfe, 0x30, 0xfc, 0xd8, 0xfe, 0x7b, 0xfc, 0xe6, 0xf7, 0x08, 0xf9, 0x24, 0xf8, 
-0x3e, 0xf4, 0x98, 0xf5, 0x87, 0xfb, 0xc5, 0xfd, 0xa6, 0x01, 0x0d, 0x09, 0x76, 0x0a, 0x75, 0x08, 
-0x03, 0x08, 0xc9, 0x04, 0x01, 0x00, 0xdc, 0xfe, 0x5b, 0xff, 0xe2, 0xfe, 0x58, 0x01, 0x22, 0x05, 
-0x69, 0x06, 0xfc, 0x06, 0xf5, 0x06, 0xcb, 0x04, 0xd3, 0x02, 0xf0, 0x01, 0x85, 0x01, 0x4c, 0x00, 
-0x0f, 0x01, 0x01, 0x04, 0x42, 0x04, 0xf8, 0x03, 0xf7, 0x04, 0xeb, 0x03, 0x10, 0x02, 0x6a, 0x01, 
-0x85, 0x00, 0x55, 0xff, 0x18, 0xff, 0x14, 0x00, 0x4d, 0xff, 0xdf, 0xfd, 0x27, 0xfc, 0x5a, 0xf8, 
-0xf2, 0xf6, 0x4c, 0xf7, 0x2d, 0xf8, 0x3c, 0xfa, 0x88, 0xfd, 0x31, 0xff, 0x7f, 0xfe, 0x95, 0xff, 
-0x0d, 0xff, 0x0a, 0xf9, 0x70, 0xf5, 0xd5, 0xf5, 0xe4, 0xf2, 0x00, 0xf5, 0x87, 0xfc, 0x3b, 0x00, 
-0xbb, 0x04, 0x66, 0x0b, 0xe5, 0x0b, 0xdc, 0x09, 0xcd, 0x08, 0xc2, 0x04, 0x90, 0xff, 0xf8, 0xfd, 
-0xfe, 0xfd, 0xcf, 0xfd, 0xa3, 0x00, 0x45, 0x04, 0x65, 0x05, 0xc9, 0x06, 0x08, 0x08, 0xd8, 0x06, 
-0x87, 0x04, 0x0b, 0x02, 0xf3, 0x01, 0xa7, 0x00, 0x1d, 0xff, 0x52, 0x02, 0x56, 0x02, 0x3a, 0x02, 
-0xd4, 0x04, 0xfc, 0x03, 0x98, 0x03, 0xf2, 0x02, 0xe1, 0x01, 0xb6, 0x00, 0xc5, 0xff, 0x9b, 0xfe, 
-0xd3, 0xfb, 0x6f, 0xfb, 0x11, 0xfa, 0x06, 0xf8, 0x2e, 0xfa, 0xa4, 0xfa, 0x98, 0xf9, 0xc7, 0xfc, 
-0xde, 0xfe, 0x79, 0xfb, 0xfc, 0xfb, 0x5d, 0xfe, 0xe6, 0xfa, 0x62, 0xf8, 0xf5, 0xf8, 0xd7, 0xf7, 
-0x8e, 0xf6, 0xd4, 0xf9, 0xae, 0xfd, 0x9c, 0xfe, 0xa0, 0x03, 0x5e, 0x07, 0x9c, 0x06, 0x34, 0x09, 
-0x72, 0x07, 0x1c, 0x05, 0x3f, 0x04, 0xa2, 0x01, 0x6f, 0x00, 0xd1, 0xfe, 0x05, 0x00, 0xb1, 0x00, 
-0xb8, 0x00, 0x82, 0x04, 0x30, 0x05, 0x53, 0x05, 0xad, 0x06, 0x82, 0x05, 0x83, 0x05, 0x1e, 0x03, 
-0xec, 0x01, 0xf9, 0x01, 0xd0, 0xff, 0x0a, 0x01, 0xdf, 0x01, 0xb0, 0x01, 0x6a, 0x03, 0x6e, 0x03, 
-0xf2, 0x02, 0x34, 0x02, 0xca, 0x00, 0x0c, 0xff, 0xc1, 0xfc, 0x8e, 0xfb, 0x0d, 0xfa, 0xbd, 0xf8, 
-0xb7, 0xf9, 0x9e, 0xfa, 0x92, 0xfa, 0x31, 0xfb, 0x25, 0xfd, 0xdb, 0xfd, 0x33, 0xfc, 0x3a, 0xfc, 
-0x28, 0xfc, 0xd0, 0xf8, 0x1a, 0xf7, 0x71, 0xf8, 0xea, 0xf6, 0xf4, 0xf9, 0x88, 0xfd, 0x87, 0xff, 
-0x33, 0x05, 0x22, 0x06, 0xbd, 0x07, 0xfd, 0x08, 0xdb, 0x06, 0x29, 0x06, 0x2a, 0x04, 0x38, 0x02, 
-0xc5, 0xff, 0x36, 0xff, 0x26, 0x00, 0x4d, 0xff, 0x94, 0x01, 0xdc, 0x03, 0xb2, 0x04, 0x60, 0x06, 
-0xe6, 0x06, 0x53, 0x07, 0x7f, 0x06, 0xf8, 0x03, 0x83, 0x03, 0x19, 0x02, 0x1d, 0x00, 0x7a, 0x00, 
-0x99, 0x00, 0xdb, 0x00, 0x6a, 0x02, 0xfc, 0x02, 0x81, 0x02, 0x66, 0x02, 0x15, 0x01, 0xe2, 0xfe, 
-0xa7, 0xfd, 0xa5, 0xfa, 0xf2, 0xf7, 0x04, 0xf8, 0x50, 0xf7, 0xed, 0xf6, 0x40, 0xf9, 0xb2, 0xf9, 
-0x9d, 0xf8, 0x98, 0xfc, 0x77, 0xfd, 0x0c, 0xfa, 0x3f, 0xfb, 0x37, 0xf8, 0xb1, 0xf5, 0x7c, 0xf9, 
-0x17, 0xfa, 0x68, 0xfb, 0x98, 0x00, 0x41, 0x04, 0x30, 0x05, 0x6c, 0x08, 0xcc, 0x09, 0xae, 0x07, 
-0xaf, 0x07, 0x88, 0x05, 0x5b, 0x02, 0xe3, 0x01, 0x96, 0x00, 0x44, 0xff, 0x3f, 0x00, 0x22, 0x02, 
-0x02, 0x02, 0xe0, 0x03, 0x6a, 0x05, 0xce, 0x04, 0xf1, 0x05, 0x11, 0x06, 0xd0, 0x05, 0x2c, 0x04, 
-0x36, 0x04, 0xdc, 0x02, 0x92, 0x00, 0x2d, 0x02, 0x77, 0x00, 0x59, 0x00, 0x9b, 0x01, 0x4e, 0x00, 
-0xe4, 0x00, 0xbf, 0x00, 0x9c, 0xff, 0x78, 0xfe, 0xe3, 0xfc, 0x3c, 0xfb, 0xed, 0xf8, 0xfe, 0xf8, 
-0xbe, 0xf8, 0x12, 0xf9, 0x02, 0xfb, 0x71, 0xfa, 0xce, 0xfb, 0x2e, 0xfb, 0x12, 0xfa, 0x84, 0xf9, 
-0xb9, 0xf6, 0x28, 0xf9, 0xcd, 0xf8, 0x19, 0xfa, 0xf0, 0xfd, 0xfd, 0xfe, 0xdd, 0x02, 0xd8, 0x04, 
-0xaa, 0x07, 0xfb, 0x07, 0x2f, 0x08, 0xaf, 0x08, 0xd5, 0x04, 0xd4, 0x04, 0x4c, 0x03, 0xd2, 0xff, 
-0xfc, 0x00, 0xb2, 0xff, 0x53, 0xff, 0xd0, 0x01, 0x6a, 0x02, 0x74, 0x03, 0x86, 0x04, 0xa3, 0x05, 
-0xd7, 0x05, 0x90, 0x04, 0x19, 0x06, 0x87, 0x04, 0xa0, 0x02, 0x21, 0x04, 0x2c, 0x01, 0x9f, 0x00, 
-0x44, 0x01, 0x5a, 0xff, 0xd1, 0xff, 0xe8, 0xff, 0x15, 0xff, 0x18, 0xfe, 0x1d, 0xfd, 0x0f, 0xfc, 
-0x63, 0xfa, 0x0a, 0xfb, 0x90, 0xfa, 0xce, 0xf9, 0x33, 0xfb, 0x25, 0xfb, 0xfe, 0xf9, 0x03, 0xfa, 
-0x2f, 0xfa, 0x98, 0xf7, 0xf6, 0xf5, 0x1b, 0xf8, 0x2d, 0xf8, 0xe1, 0xf9, 0x53, 0xfe, 0xb3, 0x00, 
-0xeb, 0x02, 0xfb, 0x05, 0x5c, 0x07, 0x56, 0x07, 0xde, 0x08, 0x1a, 0x07, 0x87, 0x05, 0x23, 0x05, 
-0x30, 0x02, 0x81, 0x01, 0x1d, 0x00, 0x19, 0xff, 0xd3, 0xff, 0x87, 0xff, 0x6d, 0x01, 0xcc, 0x02, 
-0x37, 0x03, 0x03, 0x05, 0x7a, 0x05, 0x28, 0x05, 0xe0, 0x04, 0x02, 0x05, 0xe4, 0x03, 0x78, 0x02, 
-0xc9, 0x02, 0x3e, 0x01, 0x23, 0x00, 0x3d, 0x00, 0xb1, 0xff, 0x13, 0xff, 0x4b, 0xff, 0x47, 0xff, 
-0x7f, 0xfd, 0xb0, 0xfd, 0x9b, 0xfc, 0xc0, 0xfa, 0x89, 0xfb, 0x98, 0xfa, 0x1b, 0xfa, 0x4b, 0xfa, 
-0xb1, 0xfa, 0x1a, 0xfa, 0x3e, 0xf9, 0xc3, 0xf9, 0x98, 0xf7, 0x8b, 0xf7, 0x78, 0xfa, 0x6d, 0xfa, 
-0xa1, 0xfc, 0xc1, 0x00, 0x7d, 0x01, 0xd7, 0x03, 0x90, 0x06, 0xae, 0x06, 0x32, 0x07, 0xd0, 0x07, 
-0x01, 0x07, 0x08, 0x05, 0xe7, 0x04, 0xdb, 0x02, 0x86, 0x00, 0x4d, 0x01, 0x3f, 0xff, 0x7c, 0xff, 
-0xbb, 0x00, 0x58, 0x00, 0xe6, 0x01, 0xf2, 0x02, 0x08, 0x04, 0x37, 0x04, 0xe5, 0x04, 0xb2, 0x05, 
-0x00, 0x04, 0xdb, 0x03, 0x7b, 0x03, 0x44, 0x01, 0x1f, 0x01, 0x2c, 0x00, 0x35, 0xff, 0x2b, 0xff, 
-0x45, 0xfe, 0xf4, 0xfd, 0x0d, 0xfd, 0x19, 0xfc, 0x90, 0xfb, 0x06, 0xfb, 0x5b, 0xfb, 0x17, 0xfb, 
-0x8b, 0xfa, 0x56, 0xfb, 0x23, 0xfa, 0x95, 0xfa, 0xe6, 0xfa, 0xfd, 0xf8, 0xa7, 0xf9, 0x1c, 0xfa, 
-0xca, 0xfa, 0x04, 0xfc, 0xf5, 0xfe, 0x02, 0x00, 0x7e, 0x01, 0x6d, 0x05, 0x92, 0x04, 0x49, 0x06, 
-0xc9, 0x07, 0xb4, 0x05, 0x3e, 0x06, 0x50, 0x05, 0x65, 0x03, 0xb5, 0x02, 0xfc, 0x01, 0x8b, 0x00, 
-0x40, 0x00, 0xb4, 0x00, 0x2e, 0x00, 0xd4, 0x00, 0x73, 0x01, 0xae, 0x01, 0x9b, 0x02, 0xe4, 0x03, 
-0x72, 0x03, 0x46, 0x04, 0x30, 0x05, 0x17, 0x03, 0xc5, 0x03, 0x32, 0x03, 0x85, 0x00, 0x3e, 0x01, 
-0xe7, 0xff, 0xaa, 0xfd, 0x2f, 0xfe, 0xec, 0xfc, 0x76, 0xfb, 0x20, 0xfc, 0xd8, 0xfb, 0xb3, 0xfa, 
-0x5a, 0xfb, 0x67, 0xfb, 0x37, 0xfa, 0xfd, 0xfa, 0x55, 0xfa, 0x58, 0xf9, 0x2b, 0xfa, 0xfe, 0xf8, 
-0x33, 0xfa, 0x2a, 0xfc, 0xc4, 0xfc, 0x10, 0xff, 0xa2, 0x00, 0x51, 0x02, 0xc8, 0x03, 0x05, 0x05, 
-0x22, 0x06, 0xd4, 0x05, 0xc2, 0x06, 0xd6, 0x05, 0x0a, 0x04, 0x3f, 0x04, 0xf4, 0x01, 0x4e, 0x01, 
-0x0b, 0x01, 0x9f, 0xff, 0x3e, 0x00, 0x08, 0x00, 0x55, 0x00, 0x27, 0x01, 0x9b, 0x01, 0x76, 0x02, 
-0x9f, 0x03, 0xc2, 0x03, 0x60, 0x04, 0x0a, 0x05, 0xd6, 0x03, 0x16, 0x04, 0xae, 0x03, 0x94, 0x01, 
-0x48, 0x01, 0x5c, 0x00, 0x1f, 0xfe, 0xad, 0xfd, 0x88, 0xfc, 0x96, 0xfa, 0x7b, 0xfa, 0xdb, 0xf9, 
-0x34, 0xf9, 0x21, 0xfa, 0xe4, 0xf9, 0x45, 0xf9, 0x40, 0xf9, 0x08, 0xf9, 0xc6, 0xf9, 0x80, 0xfa, 
-0xd1, 0xfb, 0x03, 0xfe, 0xf5, 0xfe, 0x3a, 0x01, 0x22, 0x03, 0x7b, 0x03, 0x9b, 0x05, 0x1a, 0x06, 
-0x81, 0x05, 0x31, 0x06, 0x83, 0x05, 0xe3, 0x03, 0x8f, 0x03, 0xec, 0x02, 0xea, 0x00, 0x7a, 0x00, 
-0x62, 0x00, 0x09, 0xff, 0x73, 0xff, 0x56, 0x00, 0xab, 0xff, 0xc0, 0x00, 0xd4, 0x01, 0x5b, 0x01, 
-0x3f, 0x02, 0xa9, 0x02, 0x9d, 0x02, 0x4b, 0x02, 0x3d, 0x02, 0x26, 0x02, 0xd1, 0x00, 0xe9, 0x00, 
-0x11, 0x00, 0x1d, 0xff, 0x2a, 0xff, 0x43, 0xfe, 0x24, 0xfe, 0xb8, 0xfd, 0xb8, 0xfd, 0x8c, 0xfd, 
-0xa3, 0xfc, 0xeb, 0xfc, 0x17, 0xfc, 0x23, 0xfb, 0x63, 0xfb, 0x98, 0xfa, 0x63, 0xfa, 0x33, 0xfb, 
-0x60, 0xfb, 0xff, 0xfb, 0xfe, 0xfc, 0x0e, 0xfe, 0x63, 0xff, 0x78, 0x00, 0xf8, 0x01, 0x23, 0x03, 
-0xc1, 0x03, 0xb9, 0x04, 0x4c, 0x05, 0x47, 0x05, 0xfc, 0x04, 0x2d, 0x05, 0x63, 0x04, 0x71, 0x03, 
-0x94, 0x03, 0x2e, 0x02, 0x77, 0x01, 0x62, 0x01, 0x2f, 0x00, 0xf0, 0xff, 0x6f, 0xff, 0xe4, 0xfe, 
-0x9b, 0xfe, 0xb4, 0xfd, 0x80, 0xfd, 0x20, 0xfd, 0x70, 0xfc, 0xc2, 0xfc, 0xab, 0xfc, 0x64, 0xfc, 
-0x11, 0xfd, 0x03, 0xfd, 0xe2, 0xfc, 0x3b, 0xfd, 0xc9, 0xfc, 0xef, 0xfc, 0xab, 0xfd, 0x09, 0xfe, 
-0xae, 0xfe, 0xb6, 0xff, 0x56, 0x00, 0xd8, 0x00, 0xdd, 0x01, 0x5e, 0x02, 0xc4, 0x02, 0x4e, 0x03, 
-0x96, 0x03, 0xb3, 0x03, 0x67, 0x03, 0x3b, 0x03, 0xa6, 0x02, 0xde, 0x01, 0xc0, 0x01, 0x3b, 0x01, 
-0xa9, 0x00, 0xae, 0x00, 0x6c, 0x00, 0x56, 0x00, 0xa1, 0x00, 0xa4, 0x00, 0xd6, 0x00, 0x1a, 0x01, 
-0x1d, 0x01, 0x73, 0x01, 0x75, 0x01, 0x68, 0x01, 0xa9, 0x01, 0x65, 0x01, 0x3f, 0x01, 0x04, 0x01, 
-0x8d, 0x00, 0x6d, 0x00, 0x11, 0x00, 0xbd, 0xff, 0xbb, 0xff, 0x4f, 0xff, 0x33, 0xff, 0x4d, 0xff, 
-0xe0, 0xfe, 0xc7, 0xfe, 0xc1, 0xfe, 0x73, 0xfe, 0x5f, 0xfe, 0x5a, 0xfe, 0x4c, 0xfe, 0x60, 0xfe, 
-0x77, 0xfe, 0x92, 0xfe, 0xd3, 0xfe, 0x0f, 0xff, 0x34, 0xff, 0x9c, 0xff, 0xdc, 0xff, 0xf8, 0xff, 
-0x6d, 0x00, 0x6e, 0x00, 0x60, 0x00, 0xb1, 0x00, 0xa6, 0x00, 0x8c, 0x00, 0x9c, 0x00, 0x9f, 0x00, 
-0x6f, 0x00, 0x7f, 0x00, 0x93, 0x00, 0x5c, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x5c, 0x00, 0x4a, 0x00, 
-0x33, 0x00, 0x1c, 0x00, 0xe2, 0xff, 0xb6, 0xff, 0x9f, 0xff, 0x71, 0xff, 0x50, 0xff, 0x57, 0xff, 
-0x48, 0xff, 0x52, 0xff, 0x68, 0xff, 0x51, 0xff, 0x7f, 0xff, 0x93, 0xff, 0xa6, 0xff, 0xdf, 0xff, 
-0xe6, 0xff, 0xf7, 0xff, 0xee, 0xff, 0xe7, 0xff, 0xdc, 0xff, 0xcd, 0xff, 0xba, 0xff, 0xaa, 0xff, 
-0xb1, 0xff, 0xa4, 0xff, 0xa6, 0xff, 0xb1, 0xff, 0xe2, 0xff, 0xf8, 0xff, 0x0a, 0x00, 0x39, 0x00, 
-0x3f, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x50, 0x00, 0x58, 0x00, 0x63, 0x00, 0x5b, 0x00, 0x4f, 0x00, 
-0x63, 0x00, 0x51, 0x00, 0x40, 0x00, 0x56, 0x00, 0x44, 0x00, 0x53, 0x00, 0x4f, 0x00, 0x55, 0x00, 
-0x7a, 0x00, 0x5c, 0x00, 0x70, 0x00, 0x6a, 0x00, 0x37, 0x00, 0x2c, 0x00, 0x08, 0x00, 0xce, 0xff, 
-0xb7, 0xff, 0x8d, 0xff, 0x62, 0xff, 0x63, 0xff, 0x49, 0xff, 0x42, 0xff, 0x4d, 0xff, 0x5d, 0xff, 
-0x6b, 0xff, 0x88, 0xff, 0xa9, 0xff, 0xab, 0xff, 0xd4, 0xff, 0xeb, 0xff, 0xef, 0xff, 0x1b, 0x00, 
-0x21, 0x00, 0x25, 0x00, 0x36, 0x00, 0x3c, 0x00, 0x4e, 0x00, 0x50, 0x00, 0x59, 0x00, 0x58, 0x00, 
-0x51, 0x00, 0x45, 0x00, 0x48, 0x00, 0x45, 0x00, 0x18, 0x00, 0x25, 0x00, 0x23, 0x00, 0xfe, 0xff, 
-0x20, 0x00, 0x2f, 0x00, 0x0d, 0x00, 0x31, 0x00, 0x3f, 0x00, 0x29, 0x00, 0x47, 0x00, 0x48, 0x00, 
-0x3a, 0x00, 0x51, 0x00, 0x4f, 0x00, 0x3e, 0x00, 0x42, 0x00, 0x19, 0x00, 0x0c, 0x00, 0x07, 0x00, 
-0xe7, 0xff, 0xe5, 0xff, 0xd3, 0xff, 0xc7, 0xff, 0xbe, 0xff, 0xb0, 0xff, 0xa8, 0xff, 0xb1, 0xff, 
-0xb5, 0xff, 0xb0, 0xff, 0xcc, 0xff, 0xce, 0xff, 0xca, 0xff, 0xe4, 0xff, 0xd9, 0xff, 0xd8, 0xff, 
-0xea, 0xff, 0xde, 0xff, 0xe6, 0xff, 0xfa, 0xff, 0x05, 0x00, 0x15, 0x00, 0x35, 0x00, 0x42, 0x00, 
-0x4e, 0x00, 0x63, 0x00, 0x6a, 0x00, 0x72, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x6b, 0x00, 0x5b, 0x00, 
-0x4b, 0x00, 0x46, 0x00, 0x36, 0x00, 0x22, 0x00, 0x1a, 0x00, 0x0e, 0x00, 0x03, 0x00, 0xfa, 0xff, 
-0xef, 0xff, 0xf0, 0xff, 0xe3, 0xff, 0xd8, 0xff, 0xdd, 0xff, 0xd3, 0xff, 0xcb, 0xff, 0xd1, 0xff, 
-0x9e, 0xff, 0xaa, 0xff, 0xe7, 0xff, 0xc7, 0xff, 0xb2, 0xff, 0xb9, 0xff, 0xbb, 0xff, 0xc4, 0xff, 
-0xd4, 0xff, 0xe6, 0xff, 0xef, 0xff, 0xfb, 0xff, 0x0f, 0x00, 0x19, 0x00, 0x1e, 0x00, 0x28, 0x00, 
-0x2a, 0x00, 0x24, 0x00, 0x29, 0x00, 0x23, 0x00, 0x1e, 0x00, 0x20, 0x00, 0x19, 0x00, 0x18, 0x00, 
-0x1b, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3f, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x56, 0x00, 
-0x56, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x41, 0x00, 0x34, 0x00, 0x27, 0x00, 0x1d, 0x00, 0x10, 0x00, 
-0xff, 0xff, 0xf6, 0xff, 0xe8, 0xff, 0xde, 0xff, 0xd8, 0xff, 0xd1, 0xff, 0xca, 0xff, 0xd2, 0xff, 
-0xd8, 0xff, 0xbd, 0xff, 0xce, 0xff, 0xc5, 0xff, 0xa4, 0xff, 0xce, 0xff, 0xd5, 0xff, 0xd1, 0xff, 
-0xda, 0xff, 0xdb, 0xff, 0xe7, 0xff, 0xef, 0xff, 0xfc, 0xff, 0x0b, 0x00, 0x1a, 0x00, 0x21, 0x00, 
-0x2c, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0x39, 0x00, 0x35, 0x00, 0x30, 0x00, 0x29, 0x00, 
-0x24, 0x00, 0x15, 0x00, 0x0d, 0x00, 0x02, 0x00, 0xf4, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xec, 0xff, 
-0xcf, 0xff, 0xea, 0xff, 0xed, 0xff, 0xda, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xdf, 0xff, 0xe6, 0xff, 
-0xe8, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xef, 0xff, 0xee, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xeb, 0xff, 
-0xe9, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xe2, 0xff, 0xe7, 0xff, 0xe7, 0xff, 
-0xe9, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x07, 0x00, 0x0f, 0x00, 0x15, 0x00, 
-0x23, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x37, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x33, 0x00, 0x32, 0x00, 
-0x2e, 0x00, 0x24, 0x00, 0x20, 0x00, 0x19, 0x00, 0x11, 0x00, 0x0b, 0x00, 0xfb, 0xff, 0xf9, 0xff, 
-0xee, 0xff, 0xdc, 0xff, 0xcb, 0xff, 0xd0, 0xff, 0xcb, 0xff, 0xad, 0xff, 0xc1, 0xff, 0xad, 0xff, 
-0xc0, 0xff, 0xd5, 0xff, 0xbf, 0xff, 0xbb, 0xff, 0xd4, 0xff, 0x04, 0x00, 0xca, 0xff, 0xf4, 0xff, 
-0x21, 0x00, 0xfe, 0xff, 0x0c, 0x00, 0x19, 0x00, 0x27, 0x00, 0x16, 0x00, 0x18, 0x00, 0x1e, 0x00, 
-0x15, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x10, 0x00, 0x08, 0x00, 0x18, 0x00, 0xf0, 0xff, 0x0d, 0x00, 
-0x12, 0x00, 0xf4, 0xff, 0xc5, 0xff, 0xfb, 0xff, 0x2f, 0x00, 0xce, 0xff, 0xe6, 0xff, 0x0f, 0x00, 
-0xfa, 0xff, 0xad, 0xff, 0x09, 0x00, 0x0d, 0x00, 0xcf, 0xff, 0x1f, 0x00, 0xcd, 0xff, 0xea, 0xff, 
-0x05, 0x00, 0x10, 0x00, 0xec, 0xff, 0xc7, 0xff, 0x0c, 0x00, 0xb9, 0xff, 0xbd, 0xff, 0xef, 0xff, 
-0xf3, 0xff, 0xef, 0xff, 0xd3, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0xf7, 0xff, 0xda, 0xff, 
-0xd8, 0xff, 0x0c, 0x00, 0xec, 0xff, 0xc6, 0xff, 0x10, 0x00, 0xb3, 0xff, 0x78, 0x00, 0xe0, 0xfe, 
-0xea, 0x01, 0x20, 0x04, 0x76, 0xff, 0x46, 0x00, 0x2f, 0x00, 0xd9, 0xfe, 0x17, 0xff, 0xf0, 0xff, 
-0xcb, 0xff, 0xdf, 0xfe, 0xaa, 0xff, 0x31, 0x00, 0x64, 0xff, 0xa0, 0xff, 0x3e, 0x00, 0x7e, 0x00, 
-0x65, 0x00, 0x0b, 0x00, 0xb9, 0x00, 0xc1, 0x00, 0x37, 0x00, 0xee, 0xff, 0x2f, 0x00, 0x5c, 0x00, 
-0xa6, 0xff, 0x5d, 0xff, 0x98, 0xff, 0x61, 0xff, 0xfe, 0xfe, 0x2b, 0xff, 0x70, 0xff, 0x64, 0xff, 
-0x4a, 0xff, 0x63, 0xff, 0xde, 0xff, 0xb4, 0xff, 0xa0, 0xff, 0xf9, 0xff, 0xdd, 0xff, 0xe4, 0xff, 
-0xec, 0xff, 0x21, 0x00, 0xde, 0xff, 0xc4, 0xff, 0xea, 0xff, 0xf5, 0xff, 0xd6, 0xff, 0xbb, 0xff, 
-0xe7, 0xff, 0xcc, 0xff, 0xd8, 0xff, 0xda, 0xff, 0xd3, 0xff, 0xaa, 0xff, 0xde, 0xff, 0xdc, 0xff, 
-0xb5, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0x09, 0x00, 0x21, 0x00, 0x53, 0x00, 0x30, 0x00, 0x11, 0x00, 
-0x89, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x09, 0x00, 0x49, 0x00, 0xef, 0xff, 0x06, 0x00, 
-0xf7, 0xff, 0xaf, 0xff, 0x0f, 0x00, 0x44, 0x00, 0xcb, 0xff, 0xd6, 0xff, 0x10, 0x00, 0x23, 0x00, 
-0x18, 0x00, 0xe4, 0xff, 0xe6, 0xff, 0xca, 0xff, 0xbb, 0xff, 0xe3, 0xff, 0xfa, 0xff, 0xc0, 0xff, 
-0xe5, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xe7, 0xff, 0x0a, 0x00, 0xee, 0xff, 0xf4, 0xff, 0x36, 0x00, 
-0x03, 0x00, 0xf2, 0xff, 0x41, 0x00, 0x5d, 0x00, 0x35, 0x00, 0x50, 0x00, 0xb6, 0xff, 0x5f, 0x00, 
-0xa3, 0xff, 0xf1, 0x00, 0xee, 0x01, 0xc4, 0xff, 0x05, 0x00, 0x5e, 0x00, 0x48, 0xff, 0x73, 0xff, 
-0x17, 0x00, 0x17, 0x00, 0xb7, 0xff, 0x75, 0xff, 0x8f, 0x00, 0xd5, 0xff, 0x6b, 0xff, 0x99, 0x00, 
-0x38, 0x00, 0x03, 0x00, 0x13, 0x00, 0x83, 0x00, 0x47, 0x00, 0x3f, 0xff, 0xcf, 0xff, 0xdc, 0xff, 
-0xbb, 0xff, 0x6a, 0xff, 0x25, 0x00, 0x1f, 0x00, 0xbf, 0xff, 0x93, 0x00, 0x14, 0x01, 0x65, 0x00, 
-0x73, 0xff, 0xcd, 0xff, 0xda, 0xff, 0x6c, 0xff, 0x01, 0x00, 0x32, 0x00, 0xee, 0xff, 0xbb, 0xff, 
-0xc4, 0xff, 0xf3, 0xff, 0x1c, 0x00, 0x3b, 0x00, 0x14, 0x00, 0x76, 0x00, 0x68, 0x00, 0xfb, 0xff, 
-0x9e, 0x00, 0x91, 0x00, 0xbb, 0xff, 0x16, 0x00, 0x37, 0x00, 0x13, 0x00, 0x04, 0x00, 0x19, 0x00, 
-0x07, 0x00, 0xb9, 0xff, 0x7b, 0xff, 0xba, 0xff, 0xfd, 0xff, 0x9a, 0xff, 0x98, 0xff, 0x46, 0x00, 
-0x16, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x29, 0x00, 0x48, 0x00, 0xdc, 0xff, 0x3d, 0x00, 0x43, 0x00, 
-0x8d, 0xff, 0xd6, 0xff, 0x0f, 0x00, 0xe2, 0xff, 0x95, 0xff, 0x01, 0x00, 0x52, 0x00, 0xc1, 0xff, 
-0x56, 0x00, 0xfa, 0xff, 0x6b, 0x00, 0xf8, 0xff, 0xbb, 0xff, 0xd5, 0x00, 0x11, 0x00, 0xf0, 0xff, 
-0x61, 0x00, 0x43, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x71, 0x00, 0x0c, 0x00, 0xb0, 0xff, 0x39, 0x00, 
-0x17, 0x00, 0x23, 0x00, 0x59, 0x00, 0x2c, 0x00, 0x08, 0x00, 0x28, 0x00, 0x43, 0x00, 0xe4, 0xff, 
-0x1f, 0x00, 0x67, 0x00, 0xe5, 0xff, 0xb6, 0xff, 0x3a, 0x00, 0x0e, 0x00, 0xe6, 0xff, 0x5c, 0x00, 
-0x63, 0x00, 0x01, 0x00, 0x5a, 0xff, 0x19, 0x00, 0xef, 0xff, 0xa8, 0xff, 0xc9, 0xff, 0xab, 0xff, 
-0xe3, 0xff, 0xc6, 0xff, 0x2c, 0x00, 0x35, 0x00, 0x59, 0x00, 0xb8, 0xff, 0xba, 0xff, 0x21, 0x01, 
-0xbd, 0xff, 0xab, 0xff, 0xce, 0x00, 0x03, 0x00, 0x04, 0x00, 0x31, 0x00, 0x4a, 0x00, 0x60, 0xff, 
-0x19, 0x00, 0x1c, 0x00, 0xfa, 0xfe, 0xc3, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0x5e, 0x01, 0xc9, 0x00, 
-0x43, 0x01, 0x18, 0x00, 0xa1, 0x00, 0xe8, 0x00, 0x8f, 0xfe, 0xde, 0xff, 0x61, 0x00, 0xd8, 0xfe, 
-0x95, 0xff, 0xb4, 0xff, 0x24, 0xff, 0xfa, 0xfe, 0x5c, 0xff, 0xd3, 0xff, 0xfe, 0xff, 0x44, 0x00, 
-0xf2, 0xff, 0x45, 0x00, 0x13, 0x00, 0xbd, 0xff, 0x32, 0x00, 0x6a, 0xff, 0x03, 0xff, 0x3b, 0xff, 
-0xf2, 0xfe, 0xd7, 0xff, 0x61, 0xff, 0xfc, 0xfe, 0xb9, 0xff, 0x6c, 0xff, 0xed, 0xff, 0x19, 0x00, 
-0x11, 0x00, 0xec, 0xff, 0x94, 0xff, 0xd0, 0xff, 0x47, 0x00, 0xed, 0xff, 0x88, 0xff, 0x8b, 0x00, 
-0xdb, 0xff, 0x9d, 0xff, 0xb0, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x31, 0x00, 0x6c, 0x00, 0xde, 0xff, 
-0xa3, 0xff, 0x90, 0x01, 0x5e, 0x00, 0x89, 0xff, 0xcd, 0x00, 0x6b, 0x00, 0xd6, 0xff, 0xf9, 0xff, 
-0x31, 0x01, 0xec, 0xff, 0xaa, 0xff, 0x18, 0x01, 0xf0, 0xff, 0xfb, 0xff, 0x61, 0x00, 0x0b, 0x00, 
-0x72, 0x00, 0x9f, 0x00, 0x86, 0x00, 0x68, 0x00, 0x76, 0x00, 0xd4, 0xff, 0xd6, 0xff, 0x00, 0x01, 
-0xbc, 0xff, 0x52, 0xff, 0x2e, 0x00, 0x92, 0xff, 0xcc, 0xff, 0x14, 0x00, 0xa0, 0xff, 0xd3, 0xff, 
-0x4f, 0x00, 0x71, 0x00, 0xf9, 0xff, 0x4b, 0xff, 0x5c, 0x00, 0x4a, 0x00, 0x94, 0xff, 0x8a, 0x00, 
-0x36, 0x00, 0xf5, 0xfe, 0x6d, 0xff, 0x36, 0x00, 0x37, 0xff, 0xef, 0xff, 0x87, 0x00, 0xd2, 0xff, 
-0x8d, 0x00, 0x98, 0xff, 0xa3, 0xff, 0x5b, 0x00, 0x23, 0xff, 0xf7, 0xff, 0xcd, 0xff, 0x1a, 0x00, 
-0xf2, 0xff, 0xc0, 0xfe, 0x27, 0x01, 0xd8, 0xff, 0xa2, 0xfe, 0x70, 0x00, 0x3e, 0x00, 0x9d, 0xff, 
-0x6e, 0xff, 0x5c, 0x00, 0x8a, 0xff, 0x4d, 0xff, 0xf2, 0x00, 0x47, 0x00, 0xd0, 0xff, 0x03, 0x00, 
-0xf2, 0xff, 0x0d, 0x00, 0x76, 0xff, 0xfa, 0xff, 0xd0, 0xff, 0x6a, 0xff, 0xc5, 0xff, 0xdd, 0xff, 
-0x28, 0x00, 0xf8, 0xff, 0x6f, 0xff, 0x73, 0xff, 0x20, 0x00, 0xa7, 0xff, 0x54, 0x00, 0x30, 0x00, 
-0x3b, 0xff, 0x18, 0x00, 0xa8, 0xff, 0xe8, 0xff, 0xc4, 0xff, 0x37, 0xff, 0x5e, 0x00, 0xeb, 0xff, 
-0x64, 0xff, 0x14, 0x00, 0x2f, 0x00, 0xdb, 0xff, 0x40, 0xff, 0xfc, 0x00, 0x91, 0x00, 0xe5, 0xfe, 
-0xb4, 0x00, 0x49, 0x00, 0x2e, 0xff, 0x3d, 0x00, 0x9d, 0x00, 0x57, 0xff, 0x75, 0xff, 0x35, 0x00, 
-0x27, 0x00, 0x1b, 0x00, 0x7a, 0xff, 0x4c, 0x00, 0xde, 0x00, 0x5c, 0xff, 0x8e, 0xff, 0xa8, 0x00, 
-0xcf, 0xff, 0xaf, 0xff, 0xb0, 0x00, 0x25, 0x00, 0xd5, 0xfe, 0xd5, 0xff, 0x84, 0x00, 0xd7, 0xff, 
-0x2f, 0x00, 0x68, 0x00, 0xed, 0xff, 0x91, 0xff, 0x2d, 0x00, 0xbb, 0xff, 0x29, 0x00, 0x81, 0x00, 
-0xf1, 0xfe, 0x4f, 0xff, 0x78, 0x00, 0x9b, 0xff, 0xed, 0xfe, 0xae, 0x00, 0x87, 0x00, 0xed, 0xfe, 
-0xaa, 0x00, 0xa5, 0x00, 0x11, 0xff, 0x30, 0x00, 0x32, 0x00, 0x83, 0xff, 0x08, 0x00, 0x21, 0x00, 
-0x23, 0xff, 0x14, 0x00, 0xa3, 0x00, 0xd9, 0xfe, 0x6e, 0x00, 0x4a, 0x01, 0x0e, 0xff, 0x93, 0xff, 
-0xc1, 0x01, 0x92, 0xff, 0x93, 0xfe, 0xd5, 0x00, 0x2b, 0x00, 0xa2, 0xff, 0x6f, 0x00, 0x59, 0x00, 
-0xc5, 0xfe, 0x24, 0xff, 0x9b, 0x00, 0xd9, 0xff, 0x64, 0x00, 0x82, 0x00, 0x61, 0xff, 0xd4, 0xff, 
-0x5c, 0x00, 0x58, 0x00, 0x56, 0x00, 0xbf, 0x00, 0x9e, 0xff, 0x0f, 0xff, 0xbb, 0x00, 0x51, 0xff, 
-0x4a, 0xff, 0xa5, 0x00, 0x26, 0xff, 0xde, 0xff, 0x26, 0x01, 0x40, 0x00, 0x83, 0xff, 0xe9, 0x00, 
-0xc6, 0x00, 0x07, 0xff, 0xba, 0x00, 0xbf, 0x00, 0xb9, 0xfe, 0x5a, 0x00, 0xa6, 0x00, 0x87, 0xff, 
-0x7f, 0x00, 0x46, 0x00, 0x94, 0xff, 0xa4, 0xff, 0xba, 0xff, 0x61, 0x00, 0x97, 0x00, 0xc0, 0x00, 
-0xbe, 0xff, 0xa8, 0xff, 0xa9, 0x00, 0x61, 0xff, 0x00, 0x00, 0x31, 0x01, 0xff, 0xff, 0x49, 0xff, 
-0x81, 0x00, 0xb7, 0x00, 0x25, 0xff, 0x2b, 0x00, 0x67, 0x00, 0x49, 0xff, 0xf9, 0xff, 0x67, 0x00, 
-0x28, 0x00, 0xed, 0xff, 0xaa, 0xff, 0xad, 0xff, 0x77, 0x00, 0x2a, 0x00, 0x2d, 0xff, 0x4f, 0x00, 
-0x9b, 0x00, 0x24, 0xff, 0x4c, 0x00, 0x0e, 0x01, 0x86, 0xff, 0x25, 0x00, 0xad, 0x00, 0xf8, 0xff, 
-0xeb, 0xff, 0xea, 0xff, 0xd6, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xf3, 0xff, 0x32, 0x00, 0x52, 0x00, 
-0x88, 0xff, 0xb5, 0xff, 0x67, 0x00, 0xb4, 0xff, 0xdd, 0xff, 0xde, 0x00, 0x01, 0x00, 0x82, 0xff, 
-0x53, 0x00, 0x20, 0x00, 0x34, 0xff, 0x10, 0x00, 0x94, 0x00, 0x69, 0xff, 0xd0, 0xff, 0xbd, 0x00, 
-0x01, 0x00, 0x72, 0xff, 0xc0, 0x00, 0x4d, 0x00, 0xc5, 0xff, 0x5b, 0x00, 0xa9, 0xff, 0xbd, 0xff, 
-0x03, 0x00, 0xe2, 0xff, 0x1b, 0x00, 0x2c, 0x00, 0x8e, 0xff, 0x3e, 0xff, 0xde, 0xff, 0x04, 0x00, 
-0x06, 0x00, 0xad, 0x00, 0x87, 0x00, 0xfb, 0xff, 0x2b, 0x00, 0xfa, 0xff, 0xdb, 0xff, 0xd5, 0xff, 
-0x12, 0x00, 0x2c, 0x00, 0x29, 0x00, 0x7e, 0x00, 0xee, 0xff, 0x01, 0x00, 0x22, 0x00, 0xf7, 0xff, 
-0x43, 0x00, 0x0c, 0x00, 0x31, 0x00, 0x24, 0x00, 0x18, 0x00, 0x1a, 0x00, 0xb1, 0xff, 0x20, 0x00, 
-0x1e, 0x00, 0xe0, 0xff, 0x0a, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0xef, 0xff, 0xe4, 0xff, 0x45, 0x00, 
-0xff, 0xff, 0xf3, 0xff, 0x42, 0x00, 0x06, 0x00, 0x1c, 0x00, 0x12, 0x00, 0x07, 0x00, 0x19, 0x00, 
-0xf7, 0xff, 0x04, 0x00, 0xff, 0xff, 0x09, 0x00, 0x0e, 0x00, 0xf3, 0xff, 0x14, 0x00, 0x2b, 0x00, 
-0xfb, 0xff, 0x17, 0x00, 0x0a, 0x00, 0xff, 0xff, 0x22, 0x00, 0xf7, 0xff, 0xf8, 0xff, 0x00, 0x00, 
-0xfd, 0xff, 0xeb, 0xff, 0xfd, 0xff, 0x14, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xf7, 0xff, 
-0xf8, 0xff, 0x01, 0x00, 0x01, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 
-0x00, 0x00, 0x01, 0x00, 0xfe, 0xff, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 
-0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x02, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-};
-
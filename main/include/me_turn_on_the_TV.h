@@ -1,1180 +0,0 @@
-#include <stdio.h>
-const unsigned char me_turn_on_the_TV[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 
-0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0x00, 0x00, 0xfb, 0xff, 
-0xfc, 0xff, 0xff, 0xff, 0x05, 0x00, 0x03, 0x00, 0x06, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 
-0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 
-0x01, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0f, 0x00, 0xf6, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0xfc, 0xff, 0xf8, 0xff, 0xfb, 0xff, 
-0xfd, 0xff, 0xf6, 0xff, 0x0d, 0x00, 0xfc, 0xff, 0x06, 0x00, 0xfa, 0xff, 0xfc, 0xff, 0xfd, 0xff, 
-0xfa, 0xff, 0x0a, 0x00, 0x02, 0x00, 0xf5, 0xff, 0xf9, 0xff, 0x02, 0x00, 0x0a, 0x00, 0x06, 0x00, 
-0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xeb, 0xff, 0x02, 0x00, 0xf2, 0xff, 0xfc, 0xff, 
-0xfa, 0xff, 0x0d, 0x00, 0xfd, 0xff, 0xed, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf9, 0xff, 0xe6, 0xff, 
-0x0a, 0x00, 0xeb, 0xff, 0xd4, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0x05, 0x00, 0xea, 0xff, 0x02, 0x00, 
-0x02, 0x00, 0x24, 0x00, 0x06, 0x00, 0x19, 0x00, 0xf4, 0xff, 0xdb, 0xff, 0xd4, 0xff, 0x9f, 0xff, 
-0xe2, 0xff, 0xbb, 0xff, 0x73, 0xff, 0xa3, 0xff, 0x99, 0xff, 0xbc, 0xff, 0x60, 0xff, 0xbd, 0xff, 
-0xad, 0xff, 0x17, 0x00, 0x76, 0xff, 0x51, 0x00, 0x08, 0x00, 0xb8, 0xff, 0x5c, 0x00, 0xfe, 0xff, 
-0x46, 0x00, 0xe8, 0xff, 0xa0, 0x00, 0x07, 0x00, 0x33, 0x00, 0xf7, 0xff, 0x34, 0x00, 0xec, 0xff, 
-0x1a, 0x00, 0xb7, 0xff, 0x39, 0x00, 0x80, 0xff, 0xf1, 0xff, 0xbc, 0xff, 0x8e, 0xff, 0xe3, 0xff, 
-0x82, 0xff, 0x32, 0x00, 0x05, 0x00, 0x25, 0x00, 0x42, 0x00, 0xea, 0xff, 0xab, 0xff, 0x4d, 0x00, 
-0xfa, 0xff, 0x0f, 0x00, 0x44, 0x00, 0xf6, 0xff, 0x4b, 0x00, 0xc6, 0xff, 0xf7, 0xff, 0x21, 0x00, 
-0x25, 0x00, 0xf2, 0xff, 0xd8, 0xff, 0x42, 0x00, 0x8d, 0xff, 0x6f, 0x00, 0xf2, 0xff, 0x62, 0x00, 
-0x2a, 0x00, 0xcf, 0x00, 0x53, 0x00, 0x1f, 0x01, 0x5c, 0x00, 0x94, 0xff, 0x28, 0xff, 0x5c, 0xfe, 
-0x29, 0xff, 0x2e, 0xff, 0xd9, 0xff, 0x22, 0xff, 0xcf, 0xff, 0x77, 0xff, 0xff, 0xff, 0xf5, 0xff, 
-0x1e, 0x00, 0xd3, 0xff, 0x0c, 0x00, 0x18, 0x00, 0xc8, 0xff, 0xfd, 0xff, 0xe4, 0xff, 0xe4, 0xff, 
-0x9b, 0xff, 0xef, 0xff, 0x91, 0xff, 0xeb, 0xff, 0xf7, 0xff, 0x61, 0xff, 0x0f, 0x00, 0xf3, 0xff, 
-0xe1, 0xff, 0xca, 0xff, 0x52, 0x00, 0xdd, 0xff, 0x2f, 0x00, 0x2c, 0x00, 0x50, 0x00, 0x25, 0x00, 
-0xbd, 0xff, 0x9c, 0x00, 0x51, 0xff, 0xae, 0x00, 0x2b, 0x00, 0x6a, 0x00, 0x40, 0x00, 0xe5, 0xff, 
-0xec, 0xff, 0x2d, 0x00, 0xff, 0xff, 0x51, 0x00, 0xaa, 0xff, 0x0b, 0x00, 0x8d, 0xff, 0xef, 0xff, 
-0x03, 0x00, 0x56, 0xff, 0x29, 0x00, 0x10, 0xff, 0x32, 0x00, 0xe2, 0xff, 0xc7, 0xff, 0xf9, 0xff, 
-0xd0, 0xff, 0x65, 0xff, 0xd2, 0xff, 0xd0, 0xff, 0xa4, 0xff, 0x01, 0x00, 0x89, 0x00, 0x28, 0xff, 
-0x9e, 0x00, 0x69, 0xff, 0x11, 0x00, 0x0b, 0x00, 0xdc, 0xff, 0x35, 0x00, 0x7a, 0xff, 0x35, 0x00, 
-0xee, 0xff, 0x62, 0xff, 0x5c, 0x00, 0xb1, 0xff, 0x99, 0xff, 0x7b, 0x00, 0x58, 0x00, 0xb1, 0x00, 
-0x12, 0x00, 0x66, 0x00, 0xc2, 0xff, 0xcd, 0x00, 0x06, 0xff, 0x97, 0x01, 0xd4, 0x03, 0x04, 0x04, 
-0x84, 0x02, 0x43, 0x01, 0xd7, 0xff, 0xd7, 0xfe, 0xde, 0xfe, 0xd3, 0xff, 0xd5, 0xfe, 0x2e, 0x00, 
-0x73, 0xfe, 0xc0, 0xfe, 0xc2, 0xff, 0xc2, 0xfe, 0xfc, 0x00, 0xc6, 0xff, 0xfd, 0x00, 0xf8, 0xff, 
-0xea, 0xff, 0x0b, 0x01, 0xdb, 0xff, 0xe3, 0xff, 0x00, 0x00, 0x7b, 0xfd, 0x96, 0xff, 0xf4, 0xfd, 
-0xe6, 0xfe, 0x47, 0x00, 0x8d, 0xfe, 0x8c, 0xff, 0x83, 0xff, 0xda, 0xfe, 0xbe, 0xff, 0x25, 0xff, 
-0x4d, 0xff, 0xe0, 0xff, 0x39, 0xff, 0xed, 0xff, 0xdb, 0xfe, 0xb3, 0xff, 0x61, 0xff, 0x03, 0xfe, 
-0x4f, 0x00, 0x1c, 0xff, 0x99, 0xff, 0x91, 0x00, 0x69, 0x00, 0x9d, 0x00, 0x4b, 0x00, 0x13, 0x01, 
-0x97, 0x00, 0xc2, 0x00, 0x38, 0x02, 0xf2, 0x00, 0x8a, 0x00, 0x20, 0xff, 0xdb, 0xfe, 0x8e, 0x00, 
-0xe0, 0xfd, 0x0e, 0x01, 0xc9, 0xff, 0xfd, 0xff, 0xb8, 0x00, 0x9d, 0xff, 0xa2, 0xff, 0x8a, 0x00, 
-0x84, 0x00, 0x17, 0x01, 0x49, 0xff, 0xc4, 0x00, 0x10, 0x00, 0xf6, 0xfe, 0x37, 0x01, 0x37, 0xff, 
-0x57, 0x00, 0x83, 0xff, 0xfb, 0xfe, 0xc4, 0x00, 0xba, 0xff, 0xda, 0xfe, 0x5c, 0x01, 0x8f, 0xfe, 
-0xee, 0x00, 0xd1, 0xff, 0xae, 0xff, 0xae, 0x00, 0x97, 0xff, 0xa8, 0x01, 0x66, 0xff, 0x32, 0x00, 
-0xdc, 0x01, 0xf0, 0xfd, 0xba, 0x01, 0x1a, 0x01, 0x21, 0xff, 0x20, 0x02, 0x9d, 0xff, 0x41, 0x01, 
-0x13, 0x01, 0xe7, 0x00, 0xa6, 0x01, 0xe2, 0xff, 0x00, 0x01, 0xb2, 0x00, 0x18, 0x00, 0xf3, 0xff, 
-0x6d, 0x00, 0x6d, 0x01, 0xf5, 0xfd, 0xd6, 0x00, 0x4d, 0x00, 0x5e, 0x00, 0xf8, 0x00, 0x77, 0x00, 
-0xdb, 0xff, 0x1b, 0x00, 0xbb, 0xff, 0x88, 0x00, 0xa7, 0x00, 0x90, 0x00, 0x07, 0x00, 0xc5, 0x01, 
-0xca, 0xfe, 0x9f, 0xff, 0x09, 0x01, 0xb8, 0xfc, 0xdf, 0x02, 0x68, 0xff, 0xd6, 0xfc, 0x15, 0x03, 
-0x59, 0xfe, 0x74, 0xfe, 0xc4, 0x03, 0x47, 0xfb, 0x34, 0x02, 0x47, 0xff, 0xbc, 0xfc, 0x8e, 0x03, 
-0xff, 0xfd, 0xdc, 0xfe, 0xd9, 0x02, 0x2f, 0xfd, 0x76, 0x01, 0xbe, 0xfe, 0xe5, 0xfe, 0x34, 0x02, 
-0x35, 0xfd, 0x43, 0x02, 0xf0, 0xff, 0x3f, 0xfe, 0x78, 0x01, 0x0d, 0xfd, 0x37, 0x00, 0xb2, 0x00, 
-0x51, 0xff, 0xd5, 0x02, 0xca, 0xfe, 0x3b, 0x01, 0xfd, 0xff, 0xc8, 0xfe, 0xf6, 0x00, 0x72, 0xff, 
-0x07, 0xff, 0xa3, 0xff, 0xd5, 0xfe, 0x73, 0xff, 0xd4, 0xff, 0x27, 0x01, 0x2d, 0x00, 0x16, 0x02, 
-0x24, 0x00, 0x90, 0xfe, 0x71, 0x02, 0xb8, 0xfe, 0x19, 0xff, 0xd0, 0x00, 0xe9, 0xfd, 0xcb, 0x01, 
-0xf7, 0xff, 0xa7, 0xfe, 0x16, 0x01, 0x2d, 0x00, 0x54, 0x00, 0xd4, 0xfe, 0xa5, 0x02, 0x13, 0xff, 
-0xce, 0xff, 0xca, 0x00, 0x4f, 0xfd, 0x70, 0x02, 0x58, 0xfe, 0x7d, 0xff, 0x95, 0x00, 0x09, 0xfd, 
-0x06, 0x05, 0xb9, 0xfd, 0x17, 0xff, 0x00, 0x05, 0x9e, 0xfb, 0xde, 0x02, 0x1b, 0xff, 0x08, 0xff, 
-0x07, 0x02, 0x3d, 0xfb, 0xe5, 0x02, 0xb1, 0xff, 0xe9, 0xfe, 0xeb, 0x02, 0x00, 0xfd, 0x08, 0x03, 
-0x15, 0xfc, 0x74, 0x00, 0xca, 0x02, 0x92, 0xfd, 0x62, 0x02, 0xab, 0xfd, 0x1d, 0x00, 0x5b, 0xff, 
-0xc0, 0xfe, 0xaa, 0x03, 0x48, 0xf9, 0x0c, 0x02, 0x01, 0x02, 0xbc, 0xfb, 0x90, 0x04, 0x7f, 0xfd, 
-0xab, 0xff, 0xb9, 0x02, 0x49, 0xfd, 0x72, 0x02, 0x2a, 0x00, 0xe0, 0xfe, 0x89, 0x01, 0xea, 0xfd, 
-0x0e, 0x02, 0x27, 0xfd, 0x77, 0xfe, 0x99, 0x00, 0xd6, 0xff, 0x9c, 0x00, 0x07, 0xff, 0xe2, 0x01, 
-0xf6, 0x02, 0xdd, 0xfc, 0x9c, 0x02, 0xf3, 0xfe, 0x6a, 0xfe, 0x31, 0x03, 0x00, 0xfb, 0x3c, 0x03, 
-0x58, 0x03, 0xaf, 0xf7, 0x74, 0x09, 0x10, 0x00, 0xfc, 0xfc, 0x23, 0x09, 0x9f, 0xf7, 0xcf, 0x04, 
-0x94, 0x02, 0x4f, 0xf9, 0x9b, 0x08, 0xf3, 0xf7, 0x8c, 0xfe, 0x18, 0x07, 0xd3, 0xf5, 0xdf, 0x05, 
-0x79, 0x01, 0x03, 0xfb, 0xb4, 0x04, 0x93, 0xfe, 0x95, 0x01, 0x9e, 0x00, 0x0d, 0xfe, 0x22, 0x02, 
-0xe8, 0xff, 0x21, 0x00, 0x8a, 0xfc, 0xc5, 0x01, 0xc2, 0xfe, 0xe6, 0xfb, 0x7e, 0x04, 0xfa, 0xfd, 
-0xdf, 0x00, 0xb0, 0xff, 0xf4, 0xfd, 0x79, 0x02, 0x3d, 0xfb, 0xda, 0x01, 0xc3, 0xff, 0x4b, 0xf9, 
-0xe9, 0x06, 0x97, 0xfb, 0x87, 0xfe, 0x21, 0x08, 0xf6, 0xf6, 0x48, 0x01, 0xb4, 0x02, 0x8e, 0xf9, 
-0x86, 0x06, 0xa9, 0xfb, 0x64, 0x00, 0x7b, 0x04, 0xd0, 0xf7, 0x1e, 0x03, 0x81, 0xff, 0x65, 0xfd, 
-0x89, 0x03, 0x12, 0xfc, 0x19, 0x02, 0x0b, 0x02, 0xe3, 0xfd, 0x4f, 0x02, 0x64, 0xfe, 0x57, 0x01, 
-0x55, 0x01, 0x40, 0xff, 0xd7, 0x00, 0x43, 0xfd, 0xe3, 0x00, 0xb4, 0x00, 0x6e, 0xfe, 0x8c, 0x01, 
-0x33, 0xfe, 0xab, 0x01, 0x2d, 0x02, 0x0f, 0x02, 0x94, 0xff, 0x25, 0xff, 0xd0, 0x02, 0x4e, 0xff, 
-0x3a, 0xfe, 0x67, 0xfe, 0xf1, 0x01, 0xe0, 0x00, 0x0d, 0xfc, 0x0e, 0x01, 0xc6, 0x00, 0x3c, 0x02, 
-0x5b, 0xfe, 0x68, 0xfc, 0x9a, 0x03, 0x0b, 0x02, 0xe5, 0xfd, 0xd8, 0xfd, 0x03, 0x01, 0xe8, 0xff, 
-0x22, 0xfd, 0x1e, 0x00, 0xce, 0xff, 0x3d, 0xff, 0x11, 0x02, 0xa9, 0xff, 0xff, 0x00, 0x9a, 0x01, 
-0xcd, 0xfd, 0x7e, 0x00, 0x3e, 0x00, 0x1d, 0xfe, 0x8c, 0xff, 0x5f, 0x00, 0xf6, 0x01, 0xd0, 0xff, 
-0x56, 0xff, 0xe8, 0xfe, 0xd3, 0x00, 0xe6, 0xfe, 0x14, 0xfd, 0x60, 0xff, 0x19, 0x02, 0x48, 0x02, 
-0xb0, 0xfe, 0xd9, 0x01, 0x16, 0x03, 0x41, 0x00, 0x81, 0xff, 0x3f, 0xff, 0x65, 0x00, 0x14, 0xfe, 
-0x1a, 0x00, 0x2e, 0x00, 0x69, 0xff, 0x23, 0x02, 0x66, 0x00, 0xd4, 0xfe, 0x32, 0x00, 0xcf, 0x00, 
-0x54, 0xfd, 0x18, 0x00, 0x7e, 0x00, 0x0c, 0xff, 0x65, 0xfe, 0xc2, 0x00, 0xa8, 0x03, 0x33, 0xff, 
-0xb8, 0xfe, 0x4f, 0x02, 0x52, 0x01, 0xf0, 0xfe, 0x5a, 0xfd, 0x45, 0x00, 0x8d, 0x01, 0xe1, 0xff, 
-0xeb, 0xff, 0xe2, 0x02, 0x3a, 0x01, 0x70, 0x00, 0x2f, 0xfe, 0x67, 0xfe, 0xc5, 0xff, 0x6c, 0xfd, 
-0x9a, 0x02, 0x47, 0x02, 0xb2, 0xff, 0x53, 0x00, 0xdc, 0x01, 0x4f, 0xfe, 0xba, 0xfe, 0x1d, 0x03, 
-0x3a, 0xff, 0xbc, 0x01, 0x95, 0x00, 0x20, 0xfe, 0xb3, 0x00, 0xbf, 0xfe, 0x7f, 0x00, 0xf1, 0xfd, 
-0xb8, 0xfe, 0x99, 0x00, 0x8e, 0xff, 0xf2, 0xfd, 0xaf, 0x00, 0x23, 0x05, 0x1c, 0x01, 0x56, 0x00, 
-0x4d, 0x00, 0xf9, 0xff, 0xe7, 0x00, 0xfd, 0xfc, 0x15, 0xfd, 0x4c, 0x01, 0xa5, 0xfe, 0xd4, 0xfd, 
-0x6d, 0x02, 0x93, 0xff, 0x4a, 0x00, 0xa5, 0x04, 0x94, 0x01, 0x66, 0xfe, 0xd9, 0xff, 0xc7, 0xff, 
-0x6a, 0xfd, 0x48, 0x00, 0xe8, 0xfd, 0x8c, 0x00, 0xe8, 0x00, 0x70, 0xfd, 0xd0, 0x00, 0x17, 0x00, 
-0x67, 0x01, 0x9a, 0x00, 0xfa, 0xfe, 0x61, 0x00, 0x07, 0x00, 0x8d, 0xfe, 0x07, 0xfd, 0x72, 0x00, 
-0x3d, 0x00, 0xb7, 0xff, 0x72, 0x01, 0xc9, 0x00, 0x9e, 0x01, 0xc4, 0xfd, 0xd2, 0xfe, 0xaf, 0x02, 
-0x0a, 0x01, 0xa5, 0xff, 0x47, 0x02, 0x7a, 0x02, 0x08, 0x01, 0xb9, 0x00, 0x6f, 0x00, 0x95, 0x00, 
-0xec, 0xfd, 0xe7, 0xfd, 0x33, 0x00, 0x75, 0x00, 0xd1, 0xff, 0x3d, 0x00, 0xcb, 0x01, 0xb2, 0x01, 
-0x6c, 0x00, 0x7f, 0x00, 0x86, 0x01, 0x30, 0x00, 0x8e, 0xff, 0x01, 0x01, 0xe0, 0xff, 0x34, 0xff, 
-0x5a, 0x01, 0xb7, 0x02, 0xc6, 0x01, 0xea, 0xff, 0x98, 0xff, 0xf3, 0xff, 0xd0, 0xff, 0xda, 0xff, 
-0xa5, 0x00, 0x5f, 0x00, 0x90, 0xff, 0xc1, 0xfe, 0x05, 0xfc, 0x9d, 0xfb, 0x3c, 0xfc, 0x01, 0xfa, 
-0x42, 0xf9, 0x5b, 0xfc, 0x27, 0xfc, 0x3c, 0xfb, 0xd6, 0xfb, 0xcb, 0xfa, 0xe7, 0xf7, 0xc6, 0xf8, 
-0xbc, 0xfd, 0x79, 0xff, 0x6b, 0x01, 0xe6, 0x06, 0x30, 0x0a, 0x84, 0x09, 0x6d, 0x0a, 0xbb, 0x0a, 
-0x12, 0x0b, 0x79, 0x0a, 0x62, 0x09, 0x0f, 0x09, 0xf6, 0x07, 0x54, 0x08, 0x7f, 0x07, 0xd8, 0x03, 
-0xca, 0x03, 0xab, 0x03, 0xfa, 0xff, 0x9e, 0xfd, 0x59, 0xfc, 0xa1, 0xfa, 0x90, 0xf8, 0x72, 0xf6, 
-0xec, 0xf2, 0x83, 0xf1, 0xf3, 0xf0, 0x93, 0xef, 0xaf, 0xed, 0x75, 0xed, 0x11, 0xed, 0xa0, 0xeb, 
-0x1f, 0xef, 0x1d, 0xfb, 0xa3, 0x05, 0x5b, 0x08, 0x20, 0x0d, 0x53, 0x14, 0xce, 0x15, 0x24, 0x12, 
-0x68, 0x0e, 0x56, 0x0d, 0x3f, 0x0f, 0x03, 0x0d, 0x2e, 0x0a, 0xa0, 0x0c, 0x73, 0x10, 0xe6, 0x0d, 
-0x39, 0x0a, 0xd8, 0x07, 0x3a, 0x07, 0x97, 0x03, 0x14, 0xfb, 0xff, 0xf7, 0xb5, 0xf7, 0x00, 0xf7, 
-0x7d, 0xf3, 0x39, 0xf0, 0xd4, 0xef, 0xc3, 0xec, 0x10, 0xe8, 0x49, 0xe5, 0x10, 0xe4, 0x18, 0xe5, 
-0x26, 0xe5, 0x73, 0xeb, 0x3d, 0xf9, 0x4a, 0x07, 0x50, 0x0f, 0x08, 0x11, 0xb0, 0x12, 0xa6, 0x12, 
-0x8b, 0x10, 0x35, 0x09, 0xfb, 0x04, 0xde, 0x07, 0x8f, 0x0b, 0xdf, 0x0c, 0xa0, 0x0d, 0x65, 0x11, 
-0x79, 0x14, 0xee, 0x12, 0x1b, 0x0f, 0x1c, 0x0c, 0x52, 0x08, 0x34, 0x06, 0x15, 0x00, 0xb1, 0xfd, 
-0xc8, 0xfe, 0xf6, 0xfa, 0xd5, 0xf5, 0x4c, 0xf5, 0x9c, 0xf4, 0xe2, 0xf0, 0x7f, 0xef, 0x71, 0xef, 
-0x50, 0xe9, 0x89, 0xe1, 0x8f, 0xdb, 0xd6, 0xdb, 0x94, 0xec, 0x88, 0xfe, 0x76, 0x06, 0x55, 0x07, 
-0x5f, 0x0d, 0x6a, 0x10, 0x82, 0x0c, 0x06, 0x08, 0x34, 0x05, 0x26, 0x07, 0x50, 0x0a, 0xea, 0x0a, 
-0x53, 0x09, 0x9d, 0x0c, 0xf3, 0x12, 0xf2, 0x12, 0xbd, 0x11, 0x39, 0x12, 0x6d, 0x0f, 0xa2, 0x0a, 
-0xf0, 0x05, 0xc1, 0x01, 0xd0, 0xff, 0x75, 0xff, 0x4f, 0xff, 0x4b, 0xfd, 0x08, 0xfb, 0xc8, 0xfa, 
-0x4b, 0xfa, 0x62, 0xf5, 0x32, 0xee, 0xce, 0xe7, 0x55, 0xe2, 0x21, 0xd8, 0xc4, 0xd4, 0x3d, 0xe3, 
-0x78, 0xf5, 0x29, 0x00, 0x71, 0x03, 0x7a, 0x07, 0x2e, 0x0b, 0xc6, 0x0a, 0x93, 0x07, 0x5e, 0x08, 
-0x3c, 0x0a, 0xd2, 0x0b, 0x66, 0x0e, 0xec, 0x0e, 0x1a, 0x0f, 0x19, 0x10, 0xaf, 0x0f, 0x2a, 0x0e, 
-0x82, 0x0d, 0x6e, 0x0f, 0x73, 0x0d, 0x35, 0x06, 0x6f, 0xfe, 0xff, 0xfa, 0xab, 0xfc, 0x05, 0xff, 
-0xba, 0x01, 0x6d, 0x05, 0x84, 0x06, 0xe6, 0x02, 0x4b, 0xfb, 0x95, 0xf4, 0x5d, 0xee, 0x23, 0xeb, 
-0xba, 0xe9, 0x98, 0xe0, 0xa7, 0xd4, 0xf7, 0xd9, 0x56, 0xef, 0x58, 0xfe, 0x9c, 0x00, 0x98, 0x00, 
-0xb6, 0x05, 0x08, 0x0a, 0x4b, 0x09, 0x89, 0x06, 0xb0, 0x09, 0x91, 0x0f, 0x88, 0x12, 0xab, 0x10, 
-0xab, 0x0d, 0x3c, 0x0e, 0x57, 0x11, 0xc2, 0x10, 0xb0, 0x0c, 0xc5, 0x09, 0xa9, 0x0b, 0x52, 0x09, 
-0xbd, 0xff, 0x11, 0xfa, 0x31, 0xfe, 0xa2, 0x02, 0x9c, 0x00, 0x7b, 0x00, 0x9f, 0x04, 0x66, 0x05, 
-0xc1, 0xfe, 0xdf, 0xf6, 0x35, 0xf2, 0x0d, 0xed, 0x70, 0xe9, 0xc6, 0xe7, 0x38, 0xde, 0xe2, 0xd7, 
-0x47, 0xe6, 0xbc, 0xfc, 0x3b, 0x04, 0x31, 0xff, 0xd9, 0xff, 0x38, 0x07, 0xe8, 0x08, 0x8b, 0x04, 
-0x82, 0x04, 0xbe, 0x0c, 0x1a, 0x12, 0x6a, 0x0e, 0x80, 0x0a, 0xc0, 0x0c, 0xfd, 0x11, 0xac, 0x13, 
-0xa3, 0x10, 0x74, 0x0c, 0xbd, 0x07, 0xa6, 0x07, 0xf1, 0x05, 0xd8, 0xfc, 0xb7, 0xf8, 0x49, 0xff, 
-0x69, 0x05, 0xd6, 0x03, 0x03, 0x02, 0x6d, 0x03, 0x88, 0x01, 0x0a, 0xf9, 0xf8, 0xf0, 0x78, 0xed, 
-0x6b, 0xed, 0x87, 0xea, 0xaa, 0xe1, 0xa4, 0xd9, 0x11, 0xe1, 0xad, 0xf6, 0xc0, 0x03, 0x58, 0x01, 
-0x3f, 0xfd, 0xae, 0x02, 0x5e, 0x0b, 0xf2, 0x0a, 0x6d, 0x04, 0x4f, 0x06, 0xef, 0x0e, 0xa4, 0x12, 
-0x2b, 0x0f, 0xbd, 0x0b, 0x4a, 0x0e, 0x45, 0x12, 0xd3, 0x10, 0x23, 0x0b, 0x91, 0x05, 0x76, 0x03, 
-0xe6, 0x03, 0xf1, 0xff, 0xd7, 0xfa, 0x2f, 0xfd, 0x8e, 0x04, 0x5d, 0x07, 0x0e, 0x05, 0xf4, 0x03, 
-0x6c, 0x04, 0xe2, 0x00, 0x6c, 0xf7, 0x81, 0xef, 0x4b, 0xed, 0xca, 0xee, 0x25, 0xea, 0x0d, 0xdd, 
-0x61, 0xd7, 0xcd, 0xe7, 0xa9, 0xff, 0x57, 0x04, 0x4b, 0xfb, 0x82, 0xfa, 0xdf, 0x05, 0x3f, 0x0d, 
-0x25, 0x08, 0x9d, 0x04, 0xd1, 0x0b, 0xb6, 0x11, 0x96, 0x0f, 0xd5, 0x0b, 0xbf, 0x0c, 0x7d, 0x10, 
-0x48, 0x10, 0x93, 0x0b, 0xe1, 0x07, 0x66, 0x06, 0x76, 0x05, 0xcd, 0x01, 0xf7, 0xfc, 0x42, 0xfc, 
-0x9e, 0x00, 0xc9, 0x04, 0x63, 0x04, 0x77, 0x03, 0x7f, 0x04, 0xb8, 0x03, 0xc9, 0xfe, 0x0f, 0xf7, 
-0x1b, 0xf3, 0x7e, 0xf0, 0x46, 0xec, 0x6a, 0xe5, 0x7d, 0xdb, 0x59, 0xdb, 0x8a, 0xed, 0xb0, 0x00, 
-0x88, 0x02, 0xae, 0xfb, 0x4c, 0xfd, 0x35, 0x07, 0x78, 0x0b, 0x6a, 0x08, 0x13, 0x08, 0x84, 0x0d, 
-0x24, 0x12, 0xbc, 0x10, 0xa7, 0x0d, 0x28, 0x0d, 0x4f, 0x0f, 0xb4, 0x0f, 0x4d, 0x0c, 0xed, 0x08, 
-0x7b, 0x05, 0xc4, 0x03, 0xe8, 0xff, 0xb8, 0xfa, 0x1f, 0xfa, 0xb9, 0xff, 0x05, 0x04, 0xc6, 0x03, 
-0x00, 0x03, 0x2b, 0x03, 0x62, 0x01, 0x2e, 0xfc, 0x6b, 0xf6, 0x75, 0xf2, 0xb2, 0xed, 0xb2, 0xe9, 
-0x0b, 0xe5, 0x39, 0xdc, 0x3d, 0xdd, 0xca, 0xf0, 0x07, 0x04, 0xfb, 0x03, 0xef, 0xfa, 0x44, 0xfe, 
-0xd6, 0x09, 0x73, 0x0c, 0xba, 0x07, 0x3f, 0x08, 0x52, 0x0f, 0xb4, 0x12, 0x62, 0x10, 0x6c, 0x0d, 
-0xe1, 0x0c, 0x52, 0x0e, 0x29, 0x0e, 0x73, 0x0c, 0x80, 0x08, 0x78, 0x04, 0xa0, 0x02, 0xcf, 0xfe, 
-0xcd, 0xfa, 0xe4, 0xfb, 0x47, 0x03, 0x32, 0x07, 0x4e, 0x04, 0xb7, 0x01, 0xe3, 0x02, 0xe7, 0x01, 
-0x9b, 0xfc, 0xe3, 0xf5, 0xea, 0xf1, 0x95, 0xee, 0x6e, 0xeb, 0xbc, 0xe4, 0x65, 0xd9, 0x1f, 0xdc, 
-0x86, 0xf2, 0x9f, 0x05, 0xe2, 0x01, 0x62, 0xf8, 0x69, 0xfe, 0xa5, 0x0b, 0x30, 0x0d, 0x13, 0x06, 
-0xe4, 0x06, 0x4c, 0x10, 0x3c, 0x15, 0x52, 0x10, 0x19, 0x0b, 0xaa, 0x0c, 0x2d, 0x11, 0xb2, 0x10, 
-0xb1, 0x0a, 0x48, 0x05, 0xf0, 0x02, 0x01, 0x02, 0x39, 0xfe, 0x92, 0xf9, 0x08, 0xfb, 0x4f, 0x02, 
-0xf8, 0x06, 0xcc, 0x04, 0xef, 0x01, 0x4e, 0x02, 0xfb, 0x01, 0x0e, 0xfd, 0xfa, 0xf6, 0x4b, 0xf2, 
-0x28, 0xef, 0x48, 0xeb, 0xb7, 0xe2, 0xfa, 0xd7, 0xc7, 0xdc, 0x4a, 0xf4, 0x58, 0x04, 0x65, 0x01, 
-0xad, 0xf9, 0x57, 0xff, 0xae, 0x0a, 0x6f, 0x0c, 0x4c, 0x07, 0x78, 0x08, 0x3b, 0x10, 0x93, 0x14, 
-0xd1, 0x10, 0xdd, 0x0c, 0x75, 0x0e, 0x1c, 0x11, 0xd2, 0x0f, 0x3b, 0x0b, 0x4c, 0x08, 0x97, 0x03, 
-0x79, 0xff, 0xb6, 0xfc, 0xf8, 0xfb, 0x50, 0xfe, 0x1d, 0x02, 0x31, 0x06, 0x50, 0x05, 0xff, 0x02, 
-0x1c, 0x01, 0x2d, 0xff, 0xf2, 0xfa, 0x5b, 0xf5, 0xa7, 0xf1, 0x15, 0xee, 0x10, 0xe9, 0xa7, 0xdf, 
-0x80, 0xd8, 0xbc, 0xe2, 0x4f, 0xf9, 0x2d, 0x04, 0xc5, 0xfe, 0x91, 0xfa, 0x0b, 0x03, 0x4b, 0x0b, 
-0x88, 0x09, 0x84, 0x06, 0x5b, 0x0a, 0x4a, 0x11, 0xa2, 0x12, 0x5c, 0x0e, 0xeb, 0x0b, 0x39, 0x0e, 
-0xad, 0x10, 0x09, 0x0f, 0x72, 0x0b, 0x9c, 0x06, 0xf1, 0x02, 0x18, 0x00, 0x53, 0xfc, 0xa1, 0xfb, 
-0x13, 0x00, 0x67, 0x05, 0x25, 0x05, 0xdd, 0x02, 0x5c, 0x03, 0x59, 0x02, 0x71, 0xfd, 0x7f, 0xf6, 
-0xaa, 0xf2, 0x93, 0xf0, 0xcc, 0xec, 0x86, 0xe6, 0x76, 0xdb, 0x9b, 0xda, 0x33, 0xee, 0x32, 0x03, 
-0x07, 0x03, 0x8e, 0xf9, 0xce, 0xfd, 0xb6, 0x0a, 0xa5, 0x0d, 0xe7, 0x07, 0x75, 0x07, 0xe1, 0x0d, 
-0xa6, 0x12, 0xdc, 0x10, 0x74, 0x0c, 0xe9, 0x0a, 0x18, 0x0f, 0x32, 0x12, 0x9c, 0x0e, 0x73, 0x06, 
-0xb0, 0x02, 0xf1, 0x03, 0xfc, 0xff, 0x34, 0xf9, 0xc1, 0xfa, 0x66, 0x02, 0xdf, 0x04, 0x58, 0x03, 
-0xb4, 0x02, 0x53, 0x03, 0x5c, 0x00, 0x9c, 0xf9, 0xbb, 0xf3, 0x88, 0xf0, 0x69, 0xee, 0xdc, 0xe9, 
-0x34, 0xde, 0x09, 0xd8, 0x89, 0xe7, 0x8e, 0xfe, 0xf5, 0x03, 0x7d, 0xfb, 0xed, 0xfb, 0xa2, 0x07, 
-0xa8, 0x0d, 0x48, 0x09, 0xcf, 0x05, 0x67, 0x0b, 0x14, 0x12, 0xce, 0x10, 0x1a, 0x0b, 0x71, 0x0a, 
-0xe7, 0x0f, 0xdd, 0x11, 0x00, 0x0e, 0x44, 0x08, 0x6f, 0x06, 0xfe, 0x04, 0x7c, 0x00, 0x53, 0xfa, 
-0x2d, 0xfb, 0x3d, 0x02, 0xe7, 0x04, 0x1a, 0x03, 0xb4, 0x01, 0x29, 0x02, 0xb1, 0x00, 0x58, 0xfb, 
-0x11, 0xf6, 0xec, 0xf2, 0xdb, 0xef, 0x27, 0xec, 0x12, 0xe2, 0x1d, 0xda, 0x38, 0xe4, 0xa9, 0xf9, 
-0x0f, 0x04, 0xcc, 0xfe, 0x10, 0xfc, 0xb1, 0x03, 0xe0, 0x0a, 0x50, 0x09, 0xdc, 0x05, 0xaf, 0x09, 
-0xad, 0x0f, 0x12, 0x10, 0x9c, 0x0b, 0x7e, 0x09, 0x02, 0x0d, 0x2e, 0x10, 0xfa, 0x0e, 0x6f, 0x0a, 
-0x0b, 0x07, 0x65, 0x04, 0x47, 0x01, 0x0b, 0xfd, 0x36, 0xfb, 0x56, 0xff, 0xc0, 0x04, 0x5d, 0x05, 
-0x9e, 0x01, 0xce, 0xff, 0x3f, 0x00, 0xde, 0xfd, 0x39, 0xf7, 0xd1, 0xf1, 0xed, 0xee, 0x40, 0xed, 
-0xde, 0xe4, 0xe8, 0xda, 0x90, 0xe1, 0x1a, 0xf7, 0x50, 0x03, 0x63, 0xfd, 0xb4, 0xfa, 0x01, 0x04, 
-0x63, 0x0b, 0x2f, 0x08, 0x8d, 0x05, 0xd3, 0x0a, 0x6d, 0x11, 0x49, 0x11, 0x74, 0x0c, 0x43, 0x0a, 
-0x82, 0x0e, 0x69, 0x12, 0xa5, 0x0f, 0x34, 0x0a, 0x5f, 0x07, 0x1c, 0x05, 0xa0, 0x00, 0x5f, 0xfc, 
-0xda, 0xfb, 0xef, 0xff, 0x0e, 0x04, 0x41, 0x04, 0x93, 0x02, 0x09, 0x01, 0xa6, 0xff, 0x24, 0xfb, 
-0xf3, 0xf4, 0x80, 0xf1, 0x4d, 0xee, 0x99, 0xeb, 0x59, 0xe3, 0xad, 0xdb, 0xbb, 0xe3, 0x7e, 0xf7, 
-0x5d, 0x01, 0xaa, 0xfc, 0x0d, 0xfd, 0xda, 0x06, 0xb7, 0x0a, 0x30, 0x07, 0xb0, 0x06, 0x59, 0x0c, 
-0x50, 0x10, 0xc9, 0x0e, 0x65, 0x0c, 0xce, 0x0b, 0x85, 0x0f, 0xd3, 0x11, 0x67, 0x0f, 0xd2, 0x0a, 
-0x7c, 0x07, 0x8e, 0x03, 0x07, 0xff, 0x1f, 0xfd, 0xb1, 0xfd, 0x82, 0xff, 0x8d, 0x02, 0x46, 0x04, 
-0x92, 0x03, 0x1b, 0x02, 0xd4, 0xff, 0xd1, 0xfa, 0xb7, 0xf4, 0xda, 0xf0, 0xc8, 0xed, 0xd3, 0xea, 
-0x84, 0xe1, 0x82, 0xda, 0x4c, 0xe4, 0x81, 0xf9, 0x6e, 0x02, 0x4a, 0xfc, 0x29, 0xfe, 0x58, 0x09, 
-0xb3, 0x0d, 0xef, 0x07, 0x7e, 0x05, 0x6e, 0x0c, 0xa6, 0x11, 0x77, 0x0f, 0xe8, 0x0a, 0x1a, 0x0b, 
-0x34, 0x10, 0xf5, 0x11, 0x0f, 0x0e, 0x6e, 0x08, 0x5e, 0x06, 0x17, 0x04, 0x14, 0x00, 0x80, 0xfb, 
-0x30, 0xfb, 0x47, 0x01, 0x3a, 0x06, 0x25, 0x03, 0x95, 0x00, 0xf7, 0x01, 0x77, 0x00, 0x05, 0xf9, 
-0x38, 0xf2, 0x08, 0xf0, 0xd6, 0xec, 0x0f, 0xe8, 0x3d, 0xde, 0x1d, 0xdc, 0xa6, 0xea, 0x12, 0xfe, 
-0x8b, 0x00, 0x80, 0xfb, 0x8f, 0x00, 0x34, 0x0b, 0x3c, 0x0c, 0x42, 0x06, 0x3e, 0x08, 0x94, 0x0d, 
-0xc5, 0x10, 0xc3, 0x0e, 0x59, 0x0c, 0xa5, 0x0e, 0x4a, 0x12, 0x8e, 0x10, 0x41, 0x0c, 0x7b, 0x09, 
-0xd1, 0x07, 0x21, 0x03, 0x48, 0xfe, 0xb9, 0xfb, 0x41, 0xfd, 0xfd, 0x01, 0x12, 0x04, 0x19, 0x02, 
-0x2d, 0x01, 0x15, 0x02, 0x84, 0xfd, 0x08, 0xf6, 0xb9, 0xf1, 0x16, 0xee, 0x1c, 0xea, 0xd3, 0xe3, 
-0xde, 0xdb, 0x35, 0xe0, 0x54, 0xf2, 0x97, 0xff, 0x00, 0xfd, 0xa5, 0xfc, 0x18, 0x06, 0x57, 0x0c, 
-0x23, 0x08, 0x4a, 0x06, 0x54, 0x0c, 0xb8, 0x0f, 0x4f, 0x0f, 0x0d, 0x0c, 0x16, 0x0d, 0x98, 0x11, 
-0xa4, 0x12, 0x83, 0x0e, 0xf9, 0x0a, 0x29, 0x0a, 0x73, 0x06, 0x13, 0x01, 0x1e, 0xfc, 0xb4, 0xfa, 
-0x51, 0xfe, 0x69, 0x02, 0xa3, 0x02, 0x4c, 0x01, 0x91, 0x02, 0x84, 0x01, 0x18, 0xfb, 0x1e, 0xf5, 
-0x4f, 0xf0, 0x3c, 0xeb, 0x54, 0xe8, 0xd6, 0xdf, 0xbc, 0xdc, 0xc3, 0xe8, 0x7b, 0xfa, 0xd6, 0xfe, 
-0xc6, 0xfb, 0x61, 0x02, 0x06, 0x0a, 0x7f, 0x0a, 0x90, 0x06, 0xf5, 0x09, 0xe4, 0x0e, 0xc1, 0x10, 
-0x50, 0x0c, 0x05, 0x0a, 0xcd, 0x0e, 0x9d, 0x12, 0x57, 0x10, 0x39, 0x0c, 0x6a, 0x0b, 0xa4, 0x08, 
-0x8c, 0x01, 0x60, 0xfb, 0x12, 0xfb, 0xe8, 0xfd, 0x90, 0x00, 0x39, 0x00, 0x31, 0x01, 0xcb, 0x03, 
-0xdd, 0x03, 0x4e, 0xfd, 0x8e, 0xf6, 0xb4, 0xf3, 0x77, 0xef, 0xc5, 0xeb, 0xba, 0xe2, 0x87, 0xdc, 
-0x95, 0xe5, 0xde, 0xf5, 0xa9, 0xfc, 0xe2, 0xfa, 0xbb, 0xff, 0xd4, 0x07, 0x4b, 0x0a, 0xa3, 0x07, 
-0xc4, 0x07, 0x01, 0x0d, 0x40, 0x10, 0xe5, 0x0d, 0xdd, 0x0a, 0x9c, 0x0c, 0xff, 0x10, 0x45, 0x10, 
-0xef, 0x0c, 0x51, 0x0b, 0xcb, 0x08, 0x06, 0x04, 0x8d, 0xfe, 0xdd, 0xfb, 0x8a, 0xfc, 0x58, 0xff, 
-0x82, 0x01, 0x19, 0x02, 0x1d, 0x03, 0x7e, 0x02, 0x18, 0xff, 0xef, 0xf8, 0x1b, 0xf4, 0x0a, 0xf0, 
-0xf6, 0xea, 0x97, 0xe4, 0x98, 0xde, 0x21, 0xe4, 0x4f, 0xf1, 0x3e, 0xf9, 0x94, 0xfa, 0x3c, 0xff, 
-0xf5, 0x04, 0x9f, 0x07, 0x19, 0x08, 0x37, 0x09, 0x00, 0x0c, 0x31, 0x0e, 0x28, 0x0e, 0x91, 0x0d, 
-0xf9, 0x0f, 0xb2, 0x12, 0xa4, 0x11, 0x61, 0x0e, 0x35, 0x0d, 0x53, 0x09, 0xb2, 0x03, 0xd6, 0xff, 
-0x84, 0xfd, 0x5e, 0xfc, 0x07, 0xfd, 0xc5, 0xff, 0xd0, 0x01, 0x36, 0x02, 0xdc, 0x00, 0x29, 0xfe, 
-0x2c, 0xf9, 0x96, 0xf4, 0x19, 0xf0, 0xa3, 0xea, 0x7a, 0xe6, 0xe1, 0xdf, 0x74, 0xe4, 0xeb, 0xf1, 
-0xf9, 0xf9, 0x75, 0xfb, 0xb2, 0xfe, 0x96, 0x05, 0x46, 0x08, 0x2e, 0x08, 0xf2, 0x07, 0x4b, 0x0a, 
-0x38, 0x0d, 0x18, 0x0e, 0x3c, 0x0d, 0xfc, 0x0e, 0xae, 0x10, 0x1e, 0x11, 0x6d, 0x0f, 0x71, 0x0c, 
-0x48, 0x09, 0x24, 0x05, 0x04, 0x00, 0xf8, 0xfc, 0x3d, 0xfc, 0x6c, 0xfc, 0xbc, 0xfe, 0xf9, 0xff, 
-0x5d, 0x01, 0x84, 0x01, 0x66, 0xfd, 0xee, 0xf7, 0xe1, 0xf4, 0x79, 0xf0, 0x73, 0xeb, 0xdf, 0xe5, 
-0xc2, 0xe1, 0x47, 0xe8, 0x4f, 0xf3, 0x83, 0xf8, 0x80, 0xfd, 0x96, 0x02, 0xd0, 0x05, 0xf4, 0x07, 
-0x97, 0x07, 0xf6, 0x08, 0x19, 0x0b, 0x18, 0x0d, 0x85, 0x0d, 0x8b, 0x0d, 0xfc, 0x0f, 0x06, 0x11, 
-0xc4, 0x11, 0x2b, 0x0f, 0x45, 0x0b, 0x91, 0x09, 0xc9, 0x04, 0x64, 0xff, 0x79, 0xfc, 0x77, 0xfc, 
-0xff, 0xfc, 0x44, 0xfe, 0xef, 0xff, 0x22, 0x00, 0xcc, 0xfe, 0xe8, 0xfa, 0x83, 0xf6, 0x1d, 0xf2, 
-0xbe, 0xeb, 0xcb, 0xe8, 0xf2, 0xe2, 0x5d, 0xe3, 0xe9, 0xed, 0x05, 0xf6, 0x4b, 0xfc, 0xc9, 0xfe, 
-0x85, 0x03, 0x04, 0x07, 0x54, 0x08, 0xd8, 0x08, 0xbe, 0x0a, 0x1f, 0x0d, 0x4c, 0x0e, 0x0b, 0x0e, 
-0x05, 0x0f, 0xe6, 0x10, 0xb6, 0x10, 0x15, 0x10, 0x78, 0x0d, 0x3d, 0x0a, 0x42, 0x06, 0x24, 0x02, 
-0xdd, 0xfc, 0xa9, 0xfb, 0xf8, 0xfa, 0xfd, 0xfd, 0xbf, 0xff, 0x7d, 0xff, 0x66, 0xff, 0x3f, 0xfd, 
-0x22, 0xfa, 0x3a, 0xf5, 0xd4, 0xee, 0x7f, 0xeb, 0x0f, 0xe6, 0x5d, 0xe2, 0xe5, 0xe9, 0xd7, 0xf1, 
-0x35, 0xfa, 0xb7, 0xfc, 0x98, 0x00, 0xc6, 0x04, 0x20, 0x07, 0xf8, 0x07, 0x21, 0x09, 0x44, 0x0b, 
-0xf4, 0x0c, 0x30, 0x0c, 0xcc, 0x0c, 0x7c, 0x10, 0x5e, 0x11, 0x6e, 0x11, 0xbc, 0x0e, 0xd1, 0x0c, 
-0xa4, 0x0a, 0x06, 0x06, 0x37, 0x00, 0xa1, 0xfd, 0xdb, 0xfb, 0x23, 0xfc, 0x6c, 0xfd, 0xc6, 0xfe, 
-0x3e, 0x00, 0xf8, 0xfd, 0x7e, 0xf9, 0x4c, 0xf6, 0xac, 0xf2, 0x05, 0xed, 0x5f, 0xe7, 0xe1, 0xe2, 
-0x9d, 0xe7, 0x9c, 0xee, 0x2b, 0xf5, 0x5c, 0xfb, 0x93, 0xff, 0x13, 0x04, 0x05, 0x06, 0xf5, 0x08, 
-0x8f, 0x09, 0x81, 0x0a, 0x8d, 0x0d, 0xb1, 0x0d, 0x01, 0x0d, 0x81, 0x0e, 0x36, 0x11, 0x5e, 0x11, 
-0xa3, 0x0f, 0x40, 0x0d, 0x8e, 0x0b, 0xc9, 0x08, 0x72, 0x03, 0xfb, 0xff, 0xd9, 0xfc, 0xec, 0xfb, 
-0x68, 0xfb, 0x9c, 0xfb, 0xd5, 0xfc, 0xfe, 0xfb, 0x78, 0xf9, 0xce, 0xf5, 0x84, 0xf1, 0x19, 0xed, 
-0x8a, 0xe8, 0x04, 0xe5, 0x0f, 0xe8, 0x6f, 0xed, 0x3c, 0xf5, 0xac, 0xfa, 0xc3, 0xff, 0xbd, 0x04, 
-0x13, 0x07, 0xfb, 0x09, 0x69, 0x0a, 0x6d, 0x0c, 0xea, 0x0d, 0xc6, 0x0e, 0x4c, 0x0e, 0xd7, 0x0d, 
-0xd5, 0x0f, 0xbd, 0x0f, 0x0d, 0x0e, 0x75, 0x0c, 0x40, 0x0a, 0xc2, 0x06, 0x4b, 0x03, 0x30, 0x00, 
-0x5f, 0xfd, 0x1b, 0xfc, 0xed, 0xfb, 0x65, 0xfc, 0xcd, 0xfc, 0x7c, 0xfc, 0x24, 0xfa, 0x6a, 0xf7, 
-0x51, 0xf2, 0x6f, 0xed, 0x14, 0xe9, 0x63, 0xe5, 0x7b, 0xe7, 0x21, 0xed, 0xaa, 0xf4, 0xc7, 0xf9, 
-0x6d, 0xfe, 0xfd, 0x02, 0x5f, 0x06, 0x70, 0x08, 0xa1, 0x09, 0xb5, 0x0b, 0xbd, 0x0d, 0xa3, 0x0e, 
-0xad, 0x0e, 0xea, 0x0f, 0x83, 0x11, 0xe6, 0x11, 0x6b, 0x10, 0xa8, 0x0e, 0x02, 0x0c, 0x6e, 0x08, 
-0x75, 0x04, 0xe4, 0x00, 0x26, 0xfe, 0x42, 0xfb, 0x9e, 0xfa, 0xda, 0xf9, 0x62, 0xfa, 0xe3, 0xf8, 
-0xd9, 0xf5, 0xb8, 0xf3, 0xa3, 0xef, 0x3e, 0xed, 0xcc, 0xe7, 0x84, 0xe5, 0x0b, 0xe9, 0x40, 0xee, 
-0xd4, 0xf4, 0x22, 0xfa, 0x40, 0x00, 0x91, 0x05, 0x8c, 0x07, 0x62, 0x09, 0xc7, 0x0b, 0xec, 0x0d, 
-0xe2, 0x0e, 0x94, 0x0e, 0x70, 0x0f, 0x18, 0x10, 0x94, 0x11, 0xa4, 0x10, 0xde, 0x0e, 0x7d, 0x0d, 
-0x29, 0x0a, 0xfb, 0x06, 0x86, 0x03, 0x79, 0x01, 0xa1, 0xfe, 0xf1, 0xfb, 0xd5, 0xfa, 0x11, 0xfa, 
-0xd0, 0xf9, 0x7b, 0xf7, 0xf6, 0xf5, 0x3f, 0xf3, 0x1c, 0xf0, 0xc9, 0xed, 0xa9, 0xe9, 0xce, 0xe8, 
-0xad, 0xea, 0x6f, 0xef, 0x41, 0xf4, 0x83, 0xf9, 0x1d, 0xff, 0x2d, 0x03, 0x3e, 0x06, 0x50, 0x08, 
-0x55, 0x0b, 0x12, 0x0d, 0xac, 0x0e, 0xbf, 0x0f, 0xc8, 0x10, 0x49, 0x12, 0x60, 0x12, 0x1a, 0x11, 
-0x3a, 0x0f, 0x93, 0x0c, 0xaa, 0x09, 0xe7, 0x06, 0x97, 0x03, 0xbc, 0x01, 0x93, 0xff, 0x0e, 0xfd, 
-0x97, 0xfb, 0x55, 0xfa, 0xed, 0xf8, 0x9f, 0xf6, 0x26, 0xf5, 0xdd, 0xf2, 0x37, 0xf0, 0x6b, 0xed, 
-0xc6, 0xe9, 0x91, 0xe8, 0x60, 0xea, 0x18, 0xee, 0x29, 0xf2, 0x19, 0xf7, 0x98, 0xfc, 0x2b, 0x01, 
-0x52, 0x04, 0x57, 0x07, 0xda, 0x0a, 0x49, 0x0d, 0x5e, 0x0f, 0xeb, 0x10, 0xb1, 0x12, 0xe5, 0x14, 
-0x1d, 0x15, 0xbc, 0x13, 0xe6, 0x10, 0x16, 0x0e, 0x30, 0x0b, 0x0f, 0x08, 0x29, 0x05, 0x4a, 0x02, 
-0xdb, 0xff, 0x1d, 0xfd, 0xce, 0xfa, 0x41, 0xf9, 0xaa, 0xf7, 0x93, 0xf5, 0xbd, 0xf3, 0x70, 0xf1, 
-0x49, 0xef, 0xaa, 0xec, 0x6a, 0xe9, 0x2f, 0xe8, 0x76, 0xe9, 0x2d, 0xec, 0x71, 0xf0, 0xba, 0xf5, 
-0x42, 0xfb, 0xed, 0xff, 0xb2, 0x03, 0xc1, 0x07, 0x80, 0x0b, 0xb3, 0x0e, 0xca, 0x10, 0xb5, 0x12, 
-0xa1, 0x14, 0x50, 0x16, 0x14, 0x16, 0x81, 0x14, 0xfb, 0x11, 0xe9, 0x0e, 0xda, 0x0b, 0x78, 0x08, 
-0x32, 0x06, 0x4c, 0x03, 0x79, 0x00, 0x04, 0xfd, 0xf5, 0xf9, 0x98, 0xf8, 0x2a, 0xf6, 0xf5, 0xf3, 
-0xaa, 0xf1, 0x57, 0xef, 0x79, 0xed, 0x57, 0xea, 0x78, 0xe7, 0x1a, 0xe7, 0xfa, 0xe8, 0xcd, 0xeb, 
-0x32, 0xf0, 0x3e, 0xf6, 0xf6, 0xfc, 0x1c, 0x02, 0x2c, 0x06, 0x06, 0x0b, 0xe1, 0x0e, 0x9b, 0x11, 
-0x4d, 0x13, 0xfc, 0x14, 0xf6, 0x16, 0xf5, 0x17, 0x37, 0x17, 0xaf, 0x14, 0xaa, 0x11, 0x9f, 0x0d, 
-0x4f, 0x09, 0xf1, 0x05, 0xfd, 0x02, 0x00, 0x00, 0x21, 0xfd, 0x0f, 0xfa, 0xe4, 0xf7, 0x64, 0xf6, 
-0x68, 0xf4, 0x8b, 0xf2, 0x92, 0xf0, 0xdb, 0xee, 0xdb, 0xec, 0x1e, 0xea, 0x42, 0xe8, 0xac, 0xe8, 
-0x85, 0xea, 0xb2, 0xed, 0x9a, 0xf2, 0xb4, 0xf8, 0x1c, 0xff, 0x3e, 0x04, 0x58, 0x08, 0x01, 0x0d, 
-0x29, 0x11, 0x8c, 0x13, 0x6a, 0x15, 0xb2, 0x17, 0x4d, 0x19, 0x52, 0x19, 0xa8, 0x17, 0x9a, 0x14, 
-0xbe, 0x10, 0x89, 0x0c, 0xb5, 0x08, 0x1e, 0x05, 0xdf, 0x01, 0xa8, 0xfe, 0x5c, 0xfb, 0xb0, 0xf8, 
-0x1f, 0xf6, 0xc3, 0xf3, 0x12, 0xf2, 0x73, 0xef, 0xb2, 0xec, 0x82, 0xea, 0x95, 0xe7, 0x9c, 0xe5, 
-0xc2, 0xe5, 0x6b, 0xe7, 0xd7, 0xea, 0xa3, 0xef, 0x6a, 0xf5, 0x53, 0xfb, 0xf0, 0x00, 0x9a, 0x06, 
-0x98, 0x0b, 0x34, 0x10, 0x5f, 0x14, 0x30, 0x17, 0x72, 0x19, 0xf9, 0x1a, 0x37, 0x1a, 0x13, 0x18, 
-0x06, 0x15, 0x8c, 0x11, 0xab, 0x0d, 0xae, 0x09, 0x0f, 0x07, 0x99, 0x03, 0x24, 0x00, 0xd7, 0xfd, 
-0xb6, 0xfa, 0x23, 0xf8, 0x99, 0xf5, 0x95, 0xf2, 0xe3, 0xf0, 0x17, 0xee, 0x4c, 0xeb, 0x1f, 0xe9, 
-0x21, 0xe6, 0x1f, 0xe5, 0x4c, 0xe5, 0xf3, 0xe7, 0xa1, 0xec, 0xf6, 0xf0, 0x72, 0xf7, 0xad, 0xfd, 
-0x1c, 0x03, 0x21, 0x09, 0xb4, 0x0d, 0x08, 0x12, 0xb3, 0x15, 0x60, 0x18, 0xe6, 0x1a, 0x7c, 0x1b, 
-0x64, 0x1a, 0x7a, 0x18, 0xa9, 0x14, 0xd3, 0x10, 0x51, 0x0d, 0xb1, 0x09, 0xba, 0x06, 0xa1, 0x03, 
-0xaa, 0x00, 0x98, 0xfd, 0x9d, 0xfa, 0x20, 0xf8, 0x8b, 0xf5, 0x32, 0xf3, 0x07, 0xf1, 0xa5, 0xee, 
-0x37, 0xec, 0xc1, 0xe9, 0x3e, 0xe7, 0x0a, 0xe6, 0x05, 0xe7, 0xe5, 0xe8, 0xe5, 0xec, 0x85, 0xf2, 
-0xee, 0xf7, 0x5a, 0xfd, 0xff, 0x02, 0x21, 0x08, 0x7d, 0x0c, 0x63, 0x10, 0x23, 0x14, 0x7b, 0x16, 
-0x20, 0x18, 0x74, 0x19, 0x11, 0x18, 0xad, 0x15, 0x59, 0x13, 0x3c, 0x0f, 0xbc, 0x0b, 0x87, 0x09, 
-0x24, 0x06, 0x66, 0x03, 0x86, 0x00, 0x5b, 0xfd, 0x07, 0xfb, 0xb8, 0xf8, 0x4b, 0xf6, 0x4a, 0xf4, 
-0x55, 0xf2, 0x05, 0xf0, 0x92, 0xed, 0x7e, 0xeb, 0xf7, 0xe8, 0x63, 0xe7, 0x36, 0xe8, 0x5a, 0xea, 
-0x44, 0xee, 0x4d, 0xf3, 0xc7, 0xf8, 0x25, 0xfe, 0x42, 0x03, 0x53, 0x08, 0x2e, 0x0d, 0x42, 0x11, 
-0x9c, 0x14, 0x13, 0x17, 0xe8, 0x18, 0xd7, 0x19, 0x6e, 0x18, 0xd2, 0x15, 0x4e, 0x12, 0x51, 0x0e, 
-0xea, 0x0a, 0x7e, 0x07, 0xd2, 0x04, 0xf0, 0x01, 0x17, 0xff, 0x5c, 0xfc, 0x04, 0xfa, 0x0c, 0xf8, 
-0x8b, 0xf5, 0x7d, 0xf3, 0xc5, 0xf1, 0x56, 0xf0, 0x0a, 0xee, 0xf0, 0xeb, 0xfd, 0xe9, 0xd1, 0xe7, 
-0x2c, 0xe8, 0x3f, 0xea, 0x8f, 0xed, 0xf7, 0xf2, 0xb2, 0xf7, 0x25, 0xfd, 0x9f, 0x02, 0x75, 0x07, 
-0x6c, 0x0c, 0xf8, 0x0f, 0x0c, 0x14, 0x0d, 0x17, 0xeb, 0x18, 0x88, 0x1a, 0xdc, 0x19, 0x90, 0x17, 
-0x66, 0x14, 0x78, 0x10, 0x13, 0x0d, 0xc5, 0x09, 0x7f, 0x06, 0x66, 0x03, 0x29, 0x00, 0xa0, 0xfd, 
-0x63, 0xfa, 0x5a, 0xf7, 0xa3, 0xf5, 0x8c, 0xf3, 0xb2, 0xf1, 0x32, 0xf0, 0x06, 0xee, 0x0f, 0xec, 
-0xed, 0xe9, 0x1f, 0xe7, 0xcd, 0xe6, 0xdf, 0xe8, 0x59, 0xea, 0x10, 0xf0, 0x19, 0xf5, 0x02, 0xf9, 
-0x90, 0x00, 0x17, 0x05, 0x15, 0x09, 0xcd, 0x0e, 0xbf, 0x11, 0xe1, 0x14, 0x92, 0x17, 0x80, 0x19, 
-0x2b, 0x1a, 0xa2, 0x18, 0x2d, 0x16, 0x63, 0x12, 0x0a, 0x10, 0xb7, 0x0c, 0x45, 0x09, 0xf3, 0x06, 
-0x3c, 0x03, 0xd3, 0xff, 0xf7, 0xfc, 0x39, 0xf9, 0xdd, 0xf7, 0x04, 0xf5, 0x64, 0xf2, 0x7c, 0xf1, 
-0x4c, 0xef, 0x73, 0xed, 0x64, 0xeb, 0x03, 0xe9, 0x62, 0xe7, 0xd2, 0xe7, 0x40, 0xea, 0xa8, 0xed, 
-0xbd, 0xf2, 0x35, 0xf7, 0x93, 0xfc, 0x94, 0x02, 0x3e, 0x06, 0xed, 0x0a, 0xc6, 0x0f, 0x83, 0x12, 
-0xd4, 0x15, 0xe9, 0x18, 0xb8, 0x19, 0x1b, 0x1a, 0x9c, 0x18, 0x44, 0x15, 0x32, 0x12, 0x94, 0x0e, 
-0xd0, 0x0a, 0x57, 0x07, 0x83, 0x04, 0x0b, 0x01, 0x92, 0xfd, 0x35, 0xfb, 0x9f, 0xf7, 0x9b, 0xf5, 
-0x61, 0xf4, 0xfa, 0xf1, 0xc3, 0xf0, 0xe4, 0xee, 0x4b, 0xec, 0xe1, 0xea, 0xaa, 0xe9, 0x03, 0xe6, 
-0x1e, 0xe7, 0xf3, 0xeb, 0x8f, 0xec, 0x04, 0xf0, 0xc4, 0xf8, 0x9f, 0xfd, 0x34, 0xff, 0x8c, 0x06, 
-0xd6, 0x0b, 0x64, 0x0e, 0x6f, 0x12, 0x10, 0x16, 0xb0, 0x18, 0x9e, 0x19, 0xd5, 0x19, 0x80, 0x18, 
-0x5a, 0x15, 0x29, 0x12, 0xd4, 0x0d, 0xf2, 0x0a, 0xf1, 0x07, 0x2a, 0x03, 0x66, 0x00, 0x61, 0xfd, 
-0x70, 0xfa, 0x6f, 0xf8, 0xf4, 0xf6, 0x50, 0xf5, 0x41, 0xf4, 0xec, 0xf2, 0xa7, 0xf0, 0x34, 0xef, 
-0x87, 0xed, 0xb3, 0xea, 0xd7, 0xe7, 0x1f, 0xea, 0x70, 0xeb, 0x7e, 0xe9, 0xe0, 0xf1, 0xe6, 0xf8, 
-0xc5, 0xfd, 0x2a, 0x03, 0x07, 0x09, 0xe2, 0x0d, 0xce, 0x10, 0x00, 0x17, 0x64, 0x19, 0xc5, 0x1a, 
-0x05, 0x1d, 0xd6, 0x19, 0x97, 0x15, 0xe1, 0x13, 0x86, 0x0e, 0xd1, 0x09, 0x02, 0x04, 0xb1, 0x00, 
-0x81, 0xfc, 0xee, 0xf7, 0xee, 0xf5, 0x01, 0xf5, 0x16, 0xf6, 0xed, 0xf4, 0x93, 0xf4, 0xf7, 0xf4, 
-0x53, 0xf2, 0x0f, 0xee, 0x6f, 0xeb, 0x72, 0xea, 0x1a, 0xea, 0xd7, 0xec, 0xac, 0xf0, 0xdd, 0xf5, 
-0xb1, 0xfb, 0x9b, 0x00, 0x81, 0x03, 0x6b, 0x08, 0x7f, 0x0d, 0x34, 0x0d, 0x57, 0x0d, 0x73, 0x0f, 
-0xad, 0x11, 0x5e, 0x10, 0xd5, 0x10, 0x05, 0x10, 0x56, 0x10, 0x87, 0x0f, 0xc6, 0x0c, 0x9a, 0x09, 
-0x46, 0x06, 0x90, 0x03, 0x49, 0xff, 0xfb, 0xfc, 0x7e, 0xfb, 0xd5, 0xfb, 0x25, 0xfd, 0x49, 0xfd, 
-0x3d, 0xfe, 0xde, 0xfc, 0x0e, 0xfa, 0xe9, 0xf6, 0x18, 0xf0, 0x17, 0xe9, 0xf5, 0xe1, 0x5a, 0xe3, 
-0x21, 0xe4, 0xd2, 0xe8, 0xaa, 0xf0, 0x5d, 0xf7, 0x2c, 0x01, 0x91, 0x03, 0xa8, 0x06, 0xbf, 0x0a, 
-0x33, 0x0f, 0x9d, 0x10, 0x9f, 0x0e, 0x7d, 0x10, 0x4e, 0x10, 0x64, 0x11, 0x75, 0x0f, 0xb3, 0x0d, 
-0xb5, 0x0f, 0xd8, 0x0c, 0xcd, 0x09, 0x51, 0x04, 0x35, 0x00, 0xe7, 0xfc, 0x4b, 0xfc, 0x71, 0xfc, 
-0x2f, 0xfc, 0x55, 0xff, 0x25, 0x02, 0x8a, 0x03, 0x27, 0x02, 0x9e, 0xff, 0x5a, 0xfc, 0xea, 0xf6, 
-0x06, 0xf0, 0xb9, 0xe6, 0xcb, 0xe4, 0x34, 0xe4, 0x1f, 0xe5, 0x6d, 0xee, 0xe1, 0xf5, 0x26, 0xfe, 
-0xa4, 0x02, 0xa5, 0x04, 0xfa, 0x07, 0x73, 0x0c, 0x14, 0x0d, 0x8f, 0x0b, 0x95, 0x0d, 0x6f, 0x0f, 
-0x48, 0x10, 0x1c, 0x10, 0x0a, 0x0f, 0x4b, 0x10, 0xf6, 0x0f, 0xf0, 0x0c, 0x99, 0x07, 0xf2, 0x02, 
-0xce, 0xff, 0x73, 0xfd, 0x76, 0xfc, 0xa0, 0xfb, 0xa7, 0xfe, 0x63, 0x02, 0x2e, 0x05, 0x5d, 0x03, 
-0xc1, 0xff, 0x95, 0xfc, 0x97, 0xf8, 0x8f, 0xf2, 0x96, 0xea, 0xba, 0xe3, 0xda, 0xe1, 0x9d, 0xe1, 
-0x61, 0xe6, 0x13, 0xf1, 0x9f, 0xf9, 0x18, 0x01, 0x3d, 0x05, 0x4a, 0x03, 0x02, 0x07, 0xbd, 0x0a, 
-0x41, 0x0b, 0x2a, 0x0d, 0x54, 0x0c, 0x6b, 0x0f, 0x3e, 0x10, 0xe5, 0x0e, 0x79, 0x0e, 0xdd, 0x0e, 
-0x41, 0x0f, 0xa9, 0x0b, 0x10, 0x05, 0xde, 0xff, 0xca, 0xfc, 0x4f, 0xfa, 0x35, 0xfa, 0x83, 0xfb, 
-0x41, 0xff, 0xc8, 0x04, 0xf8, 0x05, 0xc5, 0x03, 0x5a, 0x00, 0xc6, 0xfc, 0xfa, 0xf8, 0xc4, 0xf2, 
-0x38, 0xec, 0xd5, 0xe4, 0xe9, 0xe1, 0xe8, 0xe2, 0x75, 0xe9, 0x8a, 0xf2, 0x69, 0xfc, 0xbd, 0x04, 
-0xe8, 0x04, 0x5f, 0x03, 0x2c, 0x06, 0xba, 0x0a, 0x26, 0x0d, 0xbb, 0x0c, 0x33, 0x0c, 0x9f, 0x0e, 
-0xb2, 0x10, 0xac, 0x0e, 0x64, 0x0d, 0xf0, 0x0d, 0xdc, 0x0e, 0x14, 0x0d, 0xd1, 0x03, 0x06, 0xfd, 
-0xd9, 0xfa, 0x1a, 0xfb, 0x39, 0xfc, 0x8d, 0xff, 0x07, 0x02, 0x51, 0x05, 0xf8, 0x05, 0x16, 0x03, 
-0xf9, 0x00, 0xbb, 0xfd, 0xc8, 0xfc, 0x3e, 0xf8, 0x75, 0xef, 0x72, 0xe7, 0x75, 0xe0, 0x5b, 0xe1, 
-0x23, 0xe5, 0x10, 0xed, 0x18, 0xfb, 0x4e, 0x02, 0x1a, 0x03, 0xf8, 0x01, 0x32, 0x02, 0xc7, 0x08, 
-0xd9, 0x0d, 0x93, 0x0d, 0x26, 0x0c, 0x35, 0x0c, 0x7f, 0x0f, 0xb3, 0x0f, 0x24, 0x0c, 0xe3, 0x0b, 
-0x0d, 0x0d, 0x29, 0x0e, 0xed, 0x07, 0xd2, 0xfd, 0x50, 0xf9, 0x28, 0xf8, 0x2b, 0xfc, 0xe9, 0x00, 
-0xf5, 0x01, 0xd3, 0x04, 0x16, 0x07, 0x6c, 0x04, 0x7e, 0x03, 0x7a, 0x00, 0x78, 0xff, 0xde, 0xfe, 
-0xe4, 0xf8, 0xa3, 0xf0, 0x6c, 0xe4, 0x85, 0xdf, 0x5d, 0xe2, 0x88, 0xe6, 0xf8, 0xf3, 0xd6, 0xfc, 
-0x98, 0x02, 0x4f, 0x02, 0xb7, 0xfd, 0x2a, 0x03, 0x5d, 0x09, 0xe2, 0x0d, 0x2b, 0x0f, 0x58, 0x0c, 
-0xea, 0x0d, 0xe2, 0x0d, 0xbd, 0x0d, 0x89, 0x0e, 0xdc, 0x0b, 0xe5, 0x0d, 0x1f, 0x0b, 0x1c, 0x04, 
-0x11, 0xff, 0xc2, 0xf7, 0xf1, 0xf8, 0xce, 0xfb, 0x1c, 0xff, 0xbd, 0x05, 0xeb, 0x04, 0xb6, 0x04, 
-0x69, 0x01, 0x86, 0x01, 0x9e, 0x02, 0x07, 0x00, 0x86, 0xff, 0x70, 0xf9, 0xba, 0xf1, 0x50, 0xe7, 
-0x0d, 0xdf, 0xc3, 0xe0, 0xda, 0xe6, 0x54, 0xf2, 0xc9, 0xfb, 0xe2, 0x01, 0xe8, 0x03, 0x56, 0xfe, 
-0x9e, 0xff, 0x7a, 0x05, 0xe5, 0x0b, 0xf4, 0x11, 0xad, 0x0e, 0x6a, 0x0c, 0x64, 0x0a, 0xd1, 0x09, 
-0x8a, 0x0c, 0xac, 0x0c, 0x20, 0x0f, 0xe1, 0x0c, 0x99, 0x06, 0x45, 0xfe, 0xed, 0xf6, 0xc1, 0xf7, 
-0x89, 0xfb, 0x34, 0x00, 0x47, 0x04, 0x80, 0x04, 0xaa, 0x05, 0x34, 0x05, 0x2e, 0x03, 0x12, 0x03, 
-0x44, 0x02, 0x45, 0x03, 0x50, 0x00, 0xd4, 0xf7, 0x23, 0xec, 0xf2, 0xdf, 0x16, 0xde, 0xa7, 0xe2, 
-0xc1, 0xec, 0xfd, 0xf8, 0x90, 0x00, 0x7a, 0x02, 0x38, 0xfe, 0x7e, 0xfd, 0xef, 0x01, 0x62, 0x0b, 
-0x22, 0x11, 0x5a, 0x0f, 0x7d, 0x0b, 0xd7, 0x08, 0x70, 0x0b, 0xf9, 0x0d, 0x98, 0x0d, 0xa0, 0x0d, 
-0x9f, 0x0b, 0xb4, 0x08, 0xad, 0x01, 0xbd, 0xf9, 0xf0, 0xf6, 0xce, 0xf7, 0x7c, 0xfe, 0xd8, 0x02, 
-0x24, 0x06, 0xb2, 0x05, 0xa8, 0x02, 0x2f, 0x02, 0xcd, 0x03, 0x88, 0x05, 0x02, 0x06, 0x25, 0x03, 
-0x4d, 0xfd, 0x19, 0xf5, 0xcd, 0xe9, 0x88, 0xe0, 0xc8, 0xdd, 0x3c, 0xe4, 0xc2, 0xf0, 0xec, 0xfa, 
-0x8e, 0x00, 0x65, 0xfe, 0x4e, 0xfc, 0x08, 0xfe, 0x79, 0x04, 0xb3, 0x0d, 0xb1, 0x0f, 0xd9, 0x0e, 
-0x41, 0x0a, 0x08, 0x09, 0x2d, 0x0a, 0x2b, 0x0d, 0xbd, 0x0e, 0x29, 0x10, 0xcc, 0x0d, 0x6b, 0x06, 
-0x63, 0xfd, 0x93, 0xf6, 0x74, 0xf7, 0xc8, 0xf9, 0x2e, 0xff, 0x8c, 0x01, 0xf0, 0x03, 0x2d, 0x06, 
-0x01, 0x04, 0xaf, 0x03, 0xe2, 0x02, 0x76, 0x06, 0x6c, 0x07, 0xfb, 0x02, 0xe0, 0xfc, 0x82, 0xf2, 
-0xe2, 0xea, 0x67, 0xe2, 0xf8, 0xdf, 0x52, 0xe5, 0x92, 0xef, 0x83, 0xfb, 0x0a, 0x00, 0x29, 0xfe, 
-0x68, 0xfc, 0x58, 0xfd, 0x7a, 0x05, 0xa0, 0x0d, 0xbc, 0x0f, 0x61, 0x0d, 0xee, 0x08, 0x7f, 0x09, 
-0x31, 0x0a, 0xee, 0x0c, 0x48, 0x0e, 0x27, 0x0e, 0xf6, 0x0d, 0x2a, 0x08, 0x8a, 0x00, 0x42, 0xf8, 
-0x61, 0xf5, 0xb7, 0xf9, 0xb2, 0xff, 0x46, 0x04, 0xa9, 0x03, 0x6b, 0x03, 0xc0, 0x01, 0xf6, 0x02, 
-0x7f, 0x05, 0xc6, 0x06, 0x62, 0x08, 0xfb, 0x03, 0x5a, 0xfd, 0x2d, 0xf5, 0x6b, 0xed, 0x44, 0xe7, 
-0x00, 0xe3, 0xe8, 0xe4, 0x95, 0xe9, 0x4e, 0xf4, 0x64, 0xfe, 0x9e, 0x00, 0x6f, 0xff, 0x95, 0xfc, 
-0x28, 0x01, 0x1a, 0x0a, 0xd2, 0x0f, 0x4f, 0x0f, 0x0c, 0x0a, 0xdd, 0x07, 0x25, 0x08, 0xf1, 0x0b, 
-0xcc, 0x0e, 0xef, 0x0e, 0x88, 0x0d, 0xd2, 0x07, 0x37, 0x02, 0xf9, 0xf9, 0xb5, 0xf6, 0x94, 0xf6, 
-0x50, 0xfc, 0x38, 0x02, 0x32, 0x04, 0x4c, 0x05, 0x57, 0x01, 0xf5, 0x01, 0xfc, 0x02, 0xab, 0x07, 
-0xc0, 0x08, 0xd7, 0x06, 0x36, 0x03, 0xa1, 0xfb, 0xe5, 0xf4, 0xe5, 0xeb, 0xde, 0xe3, 0xb2, 0xe2, 
-0x0b, 0xe5, 0xb1, 0xed, 0xb2, 0xf8, 0xa4, 0xff, 0x49, 0x01, 0xd4, 0xfc, 0x6c, 0xfe, 0x16, 0x04, 
-0x41, 0x0d, 0x75, 0x10, 0xcd, 0x0c, 0x07, 0x0a, 0xe6, 0x07, 0xed, 0x0a, 0x58, 0x0c, 0x33, 0x0e, 
-0x0b, 0x0f, 0x20, 0x0b, 0xd7, 0x05, 0x42, 0xfc, 0x0e, 0xf7, 0xaf, 0xf5, 0x04, 0xfb, 0x62, 0x01, 
-0x78, 0x04, 0x49, 0x03, 0x5d, 0x01, 0x6f, 0x02, 0xa2, 0x04, 0x08, 0x08, 0xa2, 0x08, 0x82, 0x07, 
-0x20, 0x04, 0xb7, 0xfe, 0xfe, 0xf8, 0xa9, 0xf1, 0x67, 0xeb, 0x33, 0xe4, 0x90, 0xe2, 0xd3, 0xe5, 
-0xa2, 0xed, 0xa2, 0xf8, 0x01, 0x00, 0x40, 0x01, 0xc2, 0xfe, 0xc0, 0xff, 0xf4, 0x04, 0x7a, 0x0c, 
-0x2c, 0x0f, 0x20, 0x0e, 0x4d, 0x0a, 0xf5, 0x0a, 0x98, 0x0b, 0xa7, 0x0e, 0x30, 0x0e, 0xc1, 0x0b, 
-0x46, 0x07, 0xf2, 0x00, 0x62, 0xfc, 0xfb, 0xf7, 0x8d, 0xf8, 0x06, 0xfb, 0x20, 0xff, 0x7a, 0x02, 
-0x78, 0x02, 0xa9, 0x04, 0x69, 0x06, 0x13, 0x09, 0xa2, 0x09, 0x2f, 0x07, 0xaa, 0x05, 0x1a, 0x02, 
-0x62, 0xff, 0x35, 0xfa, 0x57, 0xf3, 0x3a, 0xed, 0xbf, 0xe4, 0x04, 0xe2, 0x77, 0xe4, 0xcb, 0xeb, 
-0x8a, 0xf8, 0x8a, 0xff, 0x5f, 0x01, 0xdd, 0xfc, 0x38, 0xfd, 0x48, 0x02, 0xee, 0x0b, 0xea, 0x12, 
-0xc0, 0x10, 0x2d, 0x0c, 0x49, 0x06, 0x12, 0x08, 0xde, 0x0c, 0xd3, 0x0f, 0x05, 0x0e, 0xfe, 0x06, 
-0x7e, 0x00, 0x92, 0xfa, 0x4d, 0xf8, 0x05, 0xf9, 0xd4, 0xfb, 0x6d, 0xff, 0x77, 0x02, 0x32, 0x04, 
-0x6f, 0x05, 0x89, 0x05, 0x7b, 0x06, 0x39, 0x08, 0x49, 0x09, 0x00, 0x09, 0x3b, 0x04, 0x75, 0xfd, 
-0x56, 0xf8, 0xd5, 0xf4, 0x87, 0xf2, 0xb8, 0xe9, 0x8b, 0xe0, 0xfc, 0xdf, 0x61, 0xe9, 0x23, 0xfb, 
-0x95, 0x03, 0xb8, 0x01, 0xe3, 0xf9, 0x5e, 0xf9, 0xa7, 0x01, 0x7f, 0x0c, 0x51, 0x12, 0x3c, 0x0f, 
-0x09, 0x09, 0x05, 0x06, 0xaa, 0x07, 0xc7, 0x0c, 0x41, 0x0f, 0xa6, 0x0d, 0xdd, 0x08, 0xdb, 0x02, 
-0x9b, 0xfc, 0x09, 0xf7, 0x61, 0xf7, 0x79, 0xfb, 0x6a, 0x02, 0x0c, 0x06, 0x4a, 0x05, 0xe2, 0x02, 
-0x76, 0x03, 0x9c, 0x06, 0xcc, 0x09, 0x77, 0x09, 0x64, 0x07, 0x16, 0x04, 0xdc, 0xff, 0x39, 0xfa, 
-0x03, 0xf4, 0x19, 0xee, 0x9a, 0xe7, 0x55, 0xe1, 0xf3, 0xe3, 0xa5, 0xed, 0x86, 0xfc, 0x74, 0x04, 
-0x38, 0x00, 0xe0, 0xf8, 0xd9, 0xf7, 0xb1, 0x02, 0x33, 0x0e, 0x28, 0x14, 0x4b, 0x0e, 0xb9, 0x06, 
-0x1c, 0x04, 0xfb, 0x06, 0x43, 0x0d, 0x9d, 0x0f, 0x29, 0x0d, 0xeb, 0x06, 0x3d, 0x01, 0xe3, 0xfb, 
-0xfe, 0xf7, 0x5e, 0xf7, 0x7f, 0xfb, 0xf3, 0x01, 0x05, 0x06, 0x9a, 0x04, 0xba, 0x01, 0x91, 0x03, 
-0x0e, 0x07, 0x16, 0x0b, 0x23, 0x0a, 0xb3, 0x05, 0x41, 0x02, 0x17, 0xfe, 0x5e, 0xfb, 0xcc, 0xf6, 
-0x1a, 0xf0, 0xd1, 0xe7, 0xde, 0xde, 0x96, 0xe2, 0x49, 0xef, 0x56, 0x01, 0x85, 0x08, 0x85, 0x00, 
-0xd5, 0xf5, 0x30, 0xf4, 0x3d, 0x02, 0x41, 0x10, 0xde, 0x14, 0x46, 0x0e, 0x37, 0x06, 0x97, 0x03, 
-0x27, 0x07, 0xee, 0x0c, 0x6a, 0x0e, 0xa9, 0x0a, 0x84, 0x05, 0x44, 0x01, 0x15, 0xff, 0xf6, 0xfc, 
-0x5e, 0xfb, 0x01, 0xfc, 0x87, 0xff, 0xba, 0x05, 0xe7, 0x09, 0x04, 0x0b, 0x31, 0x09, 0xe4, 0x06, 
-0x8f, 0x05, 0x3e, 0x04, 0x33, 0x02, 0x50, 0xfe, 0x6d, 0xf9, 0x39, 0xf5, 0xf8, 0xf0, 0x2f, 0xeb, 
-0xd1, 0xe3, 0x02, 0xde, 0x57, 0xde, 0x08, 0xe7, 0x22, 0xf6, 0x62, 0x04, 0xcf, 0x0a, 0x08, 0x09, 
-0x93, 0x03, 0xc4, 0x01, 0xc8, 0x04, 0xb4, 0x0a, 0x8e, 0x0f, 0x87, 0x0e, 0xb3, 0x0b, 0xd6, 0x08, 
-0x0d, 0x08, 0xae, 0x06, 0x7f, 0x04, 0xaa, 0x03, 0x38, 0x02, 0x49, 0x02, 0x7d, 0x01, 0x95, 0x01, 
-0xa9, 0x01, 0xef, 0x01, 0x49, 0x04, 0x1f, 0x07, 0xda, 0x0a, 0x1c, 0x0c, 0xcd, 0x0b, 0x76, 0x09, 
-0x4a, 0x05, 0x28, 0x01, 0xb7, 0xfb, 0xcd, 0xf8, 0xec, 0xf5, 0x4c, 0xf3, 0x7d, 0xee, 0x5f, 0xe5, 
-0xf1, 0xdd, 0xf9, 0xda, 0x9b, 0xe3, 0x73, 0xf0, 0xcc, 0xfe, 0x20, 0x07, 0xed, 0x07, 0xc1, 0x07, 
-0x9d, 0x07, 0x98, 0x0b, 0x57, 0x0d, 0x1b, 0x0e, 0x4a, 0x0c, 0x29, 0x0a, 0x1b, 0x0a, 0x7d, 0x08, 
-0x1a, 0x07, 0x73, 0x03, 0xb0, 0x01, 0x1e, 0x01, 0x3a, 0x00, 0xec, 0xfe, 0xac, 0xfc, 0x59, 0xff, 
-0x76, 0x03, 0xa1, 0x07, 0x88, 0x08, 0xf3, 0x08, 0x7d, 0x0a, 0x0b, 0x0c, 0x3c, 0x0c, 0xf1, 0x07, 
-0x09, 0x04, 0x5b, 0xfe, 0xb5, 0xfa, 0xd6, 0xf8, 0xd6, 0xf5, 0xd1, 0xf1, 0xfe, 0xe9, 0x03, 0xe3, 
-0x85, 0xdd, 0xa0, 0xdd, 0x6b, 0xe4, 0x3a, 0xf0, 0x24, 0xff, 0xa0, 0x08, 0xc6, 0x0b, 0x8c, 0x0a, 
-0xf8, 0x09, 0xb9, 0x0c, 0xeb, 0x0e, 0x3e, 0x0f, 0x14, 0x0c, 0xaa, 0x09, 0x42, 0x09, 0xbe, 0x07, 
-0x80, 0x05, 0xa4, 0x01, 0x9a, 0xff, 0x21, 0xff, 0x9e, 0xff, 0x83, 0xff, 0x95, 0xff, 0x6f, 0x01, 
-0xf5, 0x04, 0x3c, 0x09, 0x6c, 0x0b, 0x07, 0x0b, 0x3f, 0x0b, 0xb7, 0x0b, 0x3f, 0x0c, 0x74, 0x0a, 
-0x4e, 0x06, 0x82, 0x00, 0xb0, 0xfa, 0x0d, 0xf8, 0xf9, 0xf3, 0x68, 0xef, 0x90, 0xe8, 0x0f, 0xe2, 
-0x88, 0xdd, 0xf6, 0xdb, 0x65, 0xdf, 0x23, 0xe6, 0x19, 0xf5, 0x1e, 0x05, 0x1b, 0x0f, 0x0e, 0x11, 
-0xa4, 0x0c, 0x95, 0x0b, 0xf2, 0x0c, 0x2f, 0x10, 0xba, 0x0f, 0xe9, 0x0c, 0x57, 0x0a, 0x51, 0x07, 
-0x61, 0x05, 0x64, 0x01, 0x9f, 0xfe, 0xf1, 0xfd, 0xd1, 0xff, 0x25, 0x01, 0x79, 0x01, 0xee, 0x03, 
-0x92, 0x06, 0x97, 0x08, 0x18, 0x08, 0x9a, 0x08, 0x89, 0x0b, 0x00, 0x0f, 0x6f, 0x0f, 0xa7, 0x0a, 
-0x1f, 0x05, 0x3c, 0xff, 0x29, 0xfc, 0x05, 0xfa, 0x3f, 0xf5, 0xf2, 0xef, 0x4f, 0xe9, 0x9a, 0xe3, 
-0x31, 0xdf, 0x83, 0xde, 0xab, 0xe2, 0x20, 0xe7, 0x49, 0xee, 0xb4, 0xf8, 0x3f, 0x04, 0x54, 0x0c, 
-0x49, 0x0f, 0x2e, 0x0f, 0xac, 0x0f, 0x38, 0x11, 0xd2, 0x11, 0x03, 0x0f, 0x25, 0x0a, 0x81, 0x07, 
-0x31, 0x06, 0x9d, 0x05, 0x25, 0x03, 0x8e, 0x00, 0xc2, 0xfe, 0x39, 0xfe, 0xca, 0xff, 0x6a, 0x02, 
-0x27, 0x05, 0x41, 0x07, 0x4f, 0x08, 0x92, 0x09, 0xb9, 0x0a, 0x35, 0x0b, 0x83, 0x0b, 0xf7, 0x0a, 
-0x87, 0x09, 0xdb, 0x06, 0x60, 0x01, 0x96, 0xfb, 0xf7, 0xf6, 0xfc, 0xf2, 0xf1, 0xee, 0x91, 0xe8, 
-0x62, 0xe3, 0x31, 0xe1, 0xbf, 0xe0, 0xfc, 0xe1, 0x28, 0xe3, 0xf5, 0xe9, 0xca, 0xf5, 0xc4, 0x03, 
-0x35, 0x0e, 0x26, 0x11, 0xb0, 0x11, 0x1e, 0x11, 0x96, 0x12, 0x89, 0x11, 0x11, 0x0f, 0xf7, 0x0b, 
-0xec, 0x08, 0x87, 0x06, 0xbc, 0x02, 0x28, 0x00, 0x97, 0xfe, 0x87, 0xfe, 0x5c, 0xff, 0x33, 0x01, 
-0x99, 0x04, 0x27, 0x07, 0x81, 0x08, 0x9d, 0x08, 0x05, 0x09, 0xa7, 0x0a, 0xbf, 0x0b, 0x27, 0x0c, 
-0x5f, 0x0b, 0x82, 0x09, 0xb9, 0x06, 0xc7, 0x01, 0xfe, 0xfc, 0x08, 0xf9, 0xe2, 0xf4, 0xbc, 0xef, 
-0xcd, 0xe9, 0xf6, 0xe3, 0xf0, 0xe0, 0x0d, 0xe1, 0x81, 0xe3, 0x55, 0xe5, 0xce, 0xe6, 0x5a, 0xee, 
-0x50, 0xfb, 0xff, 0x08, 0xf3, 0x0f, 0xdf, 0x10, 0x12, 0x11, 0x6f, 0x12, 0x5a, 0x13, 0xa5, 0x10, 
-0x75, 0x0c, 0xc6, 0x09, 0x23, 0x09, 0x6a, 0x07, 0x89, 0x03, 0x88, 0xff, 0xdb, 0xfd, 0x6a, 0xff, 
-0x71, 0x01, 0x0a, 0x04, 0xeb, 0x05, 0x1c, 0x08, 0xea, 0x08, 0xfb, 0x08, 0x45, 0x09, 0x27, 0x0a, 
-0xb1, 0x0b, 0x6e, 0x0b, 0xab, 0x09, 0x27, 0x07, 0xfd, 0x03, 0xab, 0xff, 0x75, 0xfb, 0x75, 0xf6, 
-0xbd, 0xf0, 0x9d, 0xeb, 0x07, 0xe7, 0x4c, 0xe4, 0x35, 0xe2, 0x80, 0xe2, 0x7c, 0xe3, 0xe8, 0xe4, 
-0x7f, 0xe9, 0x71, 0xf1, 0x8b, 0xfd, 0x67, 0x07, 0xc0, 0x0d, 0x5b, 0x10, 0xd5, 0x11, 0x7e, 0x13, 
-0xff, 0x12, 0x4d, 0x11, 0x88, 0x0d, 0x92, 0x0a, 0x57, 0x08, 0xe1, 0x05, 0x4d, 0x03, 0xdf, 0xff, 
-0xcd, 0xfe, 0x03, 0x00, 0x59, 0x02, 0x7c, 0x04, 0x57, 0x06, 0x26, 0x08, 0x41, 0x09, 0x2e, 0x0a, 
-0xdc, 0x0a, 0x79, 0x0b, 0x34, 0x0b, 0xd0, 0x09, 0xc0, 0x08, 0x08, 0x07, 0x47, 0x04, 0x60, 0x00, 
-0x70, 0xfc, 0x80, 0xf8, 0xae, 0xf2, 0x0b, 0xee, 0x42, 0xe9, 0xeb, 0xe6, 0x29, 0xe5, 0x97, 0xe3, 
-0x54, 0xe3, 0xbb, 0xe3, 0xbf, 0xe8, 0xe4, 0xef, 0x89, 0xf9, 0x6f, 0x01, 0xf0, 0x06, 0xa2, 0x0b, 
-0x35, 0x0f, 0x3b, 0x12, 0xc2, 0x12, 0x67, 0x11, 0xeb, 0x0e, 0xe8, 0x0c, 0x65, 0x0b, 0x68, 0x09, 
-0x4c, 0x06, 0x0f, 0x03, 0xf8, 0x01, 0xe2, 0x02, 0x1b, 0x04, 0x64, 0x04, 0x6d, 0x04, 0x0a, 0x05, 
-0x63, 0x06, 0xe4, 0x06, 0x1e, 0x07, 0x0e, 0x07, 0xec, 0x07, 0x17, 0x08, 0x42, 0x07, 0xb6, 0x05, 
-0xa7, 0x03, 0x34, 0x02, 0x2c, 0xff, 0xa9, 0xfb, 0xb4, 0xf7, 0x9e, 0xf4, 0xd9, 0xf0, 0xdd, 0xec, 
-0x99, 0xe9, 0x7f, 0xe7, 0x9c, 0xe6, 0xd2, 0xe5, 0x73, 0xe7, 0xf7, 0xeb, 0x43, 0xf3, 0x89, 0xf9, 
-0xd7, 0xfd, 0x52, 0x01, 0x8b, 0x04, 0xa2, 0x08, 0x06, 0x0c, 0xa8, 0x0e, 0x9c, 0x0f, 0xf1, 0x0f, 
-0xcd, 0x0f, 0x03, 0x0f, 0xf3, 0x0d, 0xba, 0x0c, 0xa5, 0x0b, 0x91, 0x0a, 0x96, 0x09, 0x26, 0x08, 
-0x03, 0x07, 0xde, 0x06, 0x57, 0x07, 0xc8, 0x06, 0xc7, 0x05, 0xec, 0x04, 0xaf, 0x04, 0xb8, 0x04, 
-0x20, 0x04, 0xbb, 0x02, 0x01, 0x01, 0x95, 0xff, 0x8b, 0xfd, 0xd0, 0xfa, 0x33, 0xf7, 0xe4, 0xf3, 
-0x02, 0xf1, 0x2f, 0xee, 0x0d, 0xeb, 0xeb, 0xe7, 0x4b, 0xe6, 0x17, 0xe7, 0xe8, 0xe9, 0xcf, 0xec, 
-0x43, 0xf0, 0xb7, 0xf3, 0x6d, 0xf7, 0x97, 0xfb, 0x46, 0x00, 0x97, 0x05, 0x13, 0x0a, 0xdc, 0x0d, 
-0x69, 0x10, 0xbe, 0x12, 0x96, 0x14, 0xec, 0x14, 0x4c, 0x14, 0xd1, 0x12, 0x64, 0x11, 0x9d, 0x0f, 
-0x93, 0x0d, 0x50, 0x0b, 0xdf, 0x08, 0xe7, 0x06, 0x37, 0x05, 0xbd, 0x03, 0x70, 0x02, 0x0d, 0x01, 
-0x85, 0xff, 0x56, 0xfe, 0x95, 0xfd, 0x27, 0xfd, 0x2c, 0xfc, 0xd2, 0xfa, 0x3b, 0xfa, 0xe7, 0xf9, 
-0xd5, 0xf8, 0xcc, 0xf6, 0xa4, 0xf4, 0x7e, 0xf2, 0xa5, 0xef, 0xa8, 0xec, 0x06, 0xea, 0xde, 0xe9, 
-0x6a, 0xeb, 0x95, 0xec, 0x64, 0xee, 0xc3, 0xf0, 0x26, 0xf5, 0xc4, 0xfa, 0x1d, 0x00, 0xfb, 0x04, 
-0xc5, 0x08, 0xc4, 0x0c, 0x6f, 0x10, 0xc1, 0x13, 0x3e, 0x16, 0xd7, 0x16, 0xa8, 0x16, 0x56, 0x15, 
-0xd0, 0x13, 0x28, 0x12, 0x9e, 0x0f, 0xc7, 0x0c, 0xb5, 0x09, 0x3f, 0x07, 0x68, 0x05, 0xc9, 0x03, 
-0x2c, 0x02, 0xa6, 0x00, 0xab, 0xff, 0xa4, 0xfe, 0xc6, 0xfd, 0x5e, 0xfd, 0x9d, 0xfc, 0x67, 0xfb, 
-0x41, 0xfa, 0x99, 0xf9, 0x75, 0xf8, 0x97, 0xf6, 0xc1, 0xf4, 0x5c, 0xf2, 0xcc, 0xef, 0x01, 0xed, 
-0x23, 0xea, 0x7f, 0xe9, 0x52, 0xea, 0xbe, 0xeb, 0x46, 0xed, 0x2a, 0xef, 0x43, 0xf3, 0x6a, 0xf8, 
-0xf7, 0xfd, 0x83, 0x02, 0x9a, 0x06, 0xe6, 0x0a, 0x5d, 0x0e, 0x11, 0x12, 0x68, 0x14, 0x9c, 0x15, 
-0xe8, 0x15, 0xe9, 0x14, 0xf8, 0x13, 0x58, 0x12, 0x2d, 0x10, 0x81, 0x0d, 0x7e, 0x0a, 0x07, 0x08, 
-0xd5, 0x05, 0x0a, 0x04, 0x18, 0x02, 0x20, 0x00, 0x02, 0xff, 0x4e, 0xfe, 0xfb, 0xfd, 0x9b, 0xfd, 
-0x52, 0xfd, 0xdd, 0xfc, 0xd4, 0xfb, 0x40, 0xfb, 0x65, 0xfa, 0x8c, 0xf8, 0x4d, 0xf6, 0xc8, 0xf3, 
-0x0c, 0xf1, 0x60, 0xee, 0x67, 0xeb, 0xa8, 0xe9, 0x0c, 0xea, 0xe0, 0xea, 0xd5, 0xec, 0x4f, 0xef, 
-0x1e, 0xf3, 0x9f, 0xf8, 0x80, 0xfd, 0x5f, 0x02, 0x83, 0x06, 0xb9, 0x0a, 0x27, 0x0f, 0x14, 0x12, 
-0xa4, 0x14, 0xde, 0x15, 0x65, 0x16, 0xfc, 0x15, 0xb9, 0x13, 0x0a, 0x12, 0x8b, 0x0f, 0x14, 0x0d, 
-0xb1, 0x0a, 0xda, 0x07, 0x2e, 0x06, 0x50, 0x04, 0x0a, 0x03, 0xa1, 0x01, 0x1f, 0x00, 0x4c, 0xff, 
-0xcf, 0xfe, 0xfb, 0xfe, 0x7f, 0xfe, 0x09, 0xfe, 0xb1, 0xfc, 0x77, 0xfb, 0xe9, 0xfa, 0xa1, 0xf8, 
-0x67, 0xf6, 0x2a, 0xf3, 0xcc, 0xef, 0x4f, 0xed, 0x28, 0xea, 0x6e, 0xe8, 0x0a, 0xe8, 0x01, 0xe9, 
-0xdb, 0xea, 0x70, 0xed, 0xbc, 0xf1, 0x17, 0xf7, 0xdd, 0xfc, 0xa7, 0x01, 0x5e, 0x06, 0x2f, 0x0b, 
-0x39, 0x0f, 0xd3, 0x12, 0x22, 0x15, 0x86, 0x16, 0xd9, 0x16, 0x28, 0x16, 0x8f, 0x14, 0x37, 0x12, 
-0x82, 0x0f, 0x67, 0x0c, 0x21, 0x0a, 0xbe, 0x07, 0x8c, 0x05, 0xe2, 0x03, 0x05, 0x02, 0xd1, 0x00, 
-0x57, 0xff, 0x5b, 0xfe, 0x35, 0xfe, 0x19, 0xfe, 0x62, 0xfe, 0x16, 0xfe, 0x4c, 0xfd, 0x2a, 0xfc, 
-0x6e, 0xfb, 0xd9, 0xf9, 0x9e, 0xf6, 0x41, 0xf3, 0x0c, 0xef, 0xf7, 0xeb, 0x8d, 0xe9, 0x72, 0xe7, 
-0xda, 0xe7, 0x9d, 0xe8, 0x30, 0xea, 0x59, 0xed, 0xba, 0xf1, 0x94, 0xf7, 0xf0, 0xfc, 0xa9, 0x01, 
-0x4a, 0x06, 0x40, 0x0b, 0xb4, 0x0f, 0xd6, 0x12, 0x1e, 0x15, 0xfe, 0x15, 0x3a, 0x16, 0xb1, 0x15, 
-0xcf, 0x13, 0x5d, 0x11, 0x69, 0x0e, 0x68, 0x0b, 0x13, 0x09, 0x29, 0x07, 0x2b, 0x05, 0x4c, 0x03, 
-0x78, 0x01, 0x4f, 0x00, 0x0d, 0x00, 0x63, 0xff, 0xfe, 0xfe, 0x04, 0xff, 0x39, 0xff, 0xa2, 0xff, 
-0xe1, 0xfe, 0x97, 0xfd, 0xaf, 0xfc, 0x11, 0xfb, 0x33, 0xf8, 0xd8, 0xf4, 0xb3, 0xf0, 0x01, 0xed, 
-0x7d, 0xea, 0x64, 0xe8, 0x90, 0xe8, 0x73, 0xe9, 0x7b, 0xea, 0xb8, 0xed, 0x43, 0xf2, 0x17, 0xf8, 
-0x7d, 0xfd, 0x0d, 0x02, 0x26, 0x07, 0xd3, 0x0b, 0x3e, 0x10, 0x68, 0x13, 0x67, 0x15, 0x9e, 0x16, 
-0x65, 0x16, 0xb6, 0x15, 0xfa, 0x13, 0x2f, 0x11, 0xe0, 0x0d, 0x5a, 0x0a, 0xb8, 0x07, 0x9b, 0x05, 
-0xdd, 0x03, 0x26, 0x02, 0x69, 0x00, 0xa1, 0xff, 0x5d, 0xff, 0x62, 0xff, 0x5a, 0xff, 0x6d, 0xff, 
-0xbf, 0xff, 0xc4, 0xff, 0x82, 0xff, 0xf8, 0xfd, 0x29, 0xfc, 0xc6, 0xfa, 0x87, 0xf7, 0xc0, 0xf3, 
-0x8e, 0xef, 0x14, 0xeb, 0xd8, 0xe8, 0x5a, 0xe7, 0x47, 0xe7, 0x3a, 0xe8, 0x23, 0xe9, 0xd6, 0xec, 
-0xaf, 0xf1, 0x9a, 0xf7, 0x84, 0xfd, 0xcf, 0x01, 0x2d, 0x07, 0xa0, 0x0b, 0xc4, 0x0f, 0x66, 0x13, 
-0xf8, 0x14, 0x56, 0x16, 0x21, 0x16, 0x6c, 0x15, 0x3e, 0x14, 0x62, 0x11, 0x5c, 0x0e, 0x47, 0x0b, 
-0xcc, 0x08, 0xbd, 0x06, 0xd2, 0x04, 0x03, 0x03, 0x4c, 0x01, 0x32, 0x00, 0x93, 0xff, 0x84, 0xff, 
-0x53, 0xff, 0x98, 0xff, 0x25, 0x00, 0x2d, 0x00, 0x2b, 0x00, 0xee, 0xfe, 0x46, 0xfd, 0xf1, 0xfa, 
-0x3d, 0xf7, 0x45, 0xf3, 0xf2, 0xee, 0x3c, 0xeb, 0x73, 0xe8, 0x65, 0xe7, 0xf3, 0xe7, 0xf5, 0xe8, 
-0xe2, 0xea, 0x0b, 0xee, 0x13, 0xf3, 0xf4, 0xf8, 0x7e, 0xfe, 0x7f, 0x03, 0x85, 0x08, 0xb8, 0x0d, 
-0xc6, 0x11, 0xd4, 0x14, 0x58, 0x16, 0x7f, 0x16, 0xd4, 0x15, 0x45, 0x14, 0x6b, 0x12, 0x5c, 0x0f, 
-0x07, 0x0c, 0x43, 0x09, 0x6f, 0x06, 0xa1, 0x04, 0xbf, 0x02, 0x2c, 0x01, 0x4b, 0x00, 0x5a, 0xff, 
-0x6d, 0xff, 0x5a, 0xff, 0x7a, 0xff, 0xed, 0xff, 0xf6, 0xff, 0x3b, 0x00, 0xac, 0xff, 0x52, 0xfe, 
-0x91, 0xfc, 0x06, 0xfa, 0xb8, 0xf6, 0xc5, 0xf2, 0x6d, 0xee, 0xda, 0xea, 0x85, 0xe9, 0xfe, 0xe8, 
-0x64, 0xe9, 0x3a, 0xeb, 0x8f, 0xed, 0x5c, 0xf2, 0x06, 0xf8, 0xc5, 0xfc, 0xd8, 0x01, 0x45, 0x06, 
-0x2d, 0x0b, 0xaf, 0x0f, 0x91, 0x12, 0xcd, 0x14, 0x6f, 0x15, 0x1f, 0x15, 0xee, 0x13, 0x9a, 0x11, 
-0x92, 0x0e, 0x33, 0x0b, 0x25, 0x08, 0x11, 0x05, 0x8f, 0x02, 0x91, 0x00, 0x7f, 0xfe, 0x59, 0xfd, 
-0x72, 0xfc, 0xc3, 0xfb, 0xf0, 0xfb, 0x61, 0xfc, 0x22, 0xfd, 0x2e, 0xfe, 0x0c, 0xff, 0xb7, 0xff, 
-0x1c, 0x00, 0x30, 0x00, 0xa0, 0xff, 0xfd, 0xfd, 0x45, 0xfb, 0x63, 0xf8, 0xa6, 0xf5, 0xd3, 0xf2, 
-0x7d, 0xf0, 0x36, 0xef, 0x1e, 0xef, 0x30, 0xf0, 0x48, 0xf2, 0x25, 0xf5, 0xfc, 0xf8, 0x45, 0xfd, 
-0x79, 0x01, 0xba, 0x05, 0xe6, 0x09, 0x5d, 0x0d, 0x00, 0x10, 0x8d, 0x11, 0xdd, 0x11, 0x06, 0x11, 
-0x9b, 0x0f, 0x8e, 0x0d, 0xd7, 0x0a, 0x19, 0x08, 0x1a, 0x05, 0x9c, 0x02, 0x98, 0x00, 0xce, 0xfe, 
-0xbf, 0xfd, 0xb1, 0xfc, 0x0a, 0xfc, 0xf7, 0xfb, 0x3a, 0xfc, 0x06, 0xfd, 0xe3, 0xfd, 0xc7, 0xfe, 
-0xe3, 0xff, 0x72, 0x00, 0xa5, 0x00, 0x78, 0x00, 0xdf, 0xfe, 0xa9, 0xfc, 0x31, 0xfa, 0x8d, 0xf7, 
-0xc8, 0xf4, 0x18, 0xf2, 0xaa, 0xf0, 0xab, 0xf0, 0x64, 0xf1, 0xf8, 0xf2, 0xea, 0xf5, 0xbc, 0xf9, 
-0x01, 0xfe, 0x39, 0x02, 0xe7, 0x05, 0x72, 0x09, 0x00, 0x0d, 0x80, 0x0f, 0x39, 0x11, 0xa6, 0x11, 
-0xe6, 0x10, 0xa8, 0x0f, 0x0f, 0x0d, 0xa1, 0x0a, 0x09, 0x07, 0xfa, 0x02, 0x5a, 0x00, 0xf3, 0xfd, 
-0x8e, 0xfb, 0x17, 0xfa, 0xd4, 0xf9, 0xce, 0xf9, 0x50, 0xfa, 0x02, 0xfb, 0x13, 0xfc, 0xff, 0xfd, 
-0x2d, 0xff, 0x5a, 0x00, 0x3b, 0x01, 0x36, 0x01, 0xee, 0x00, 0xe0, 0xfe, 0xae, 0xfb, 0xa9, 0xf9, 
-0x33, 0xf7, 0x65, 0xf4, 0xb3, 0xf2, 0x2f, 0xf2, 0x97, 0xf2, 0xec, 0xf3, 0x2a, 0xf7, 0x93, 0xfa, 
-0xa1, 0xfe, 0x50, 0x02, 0x70, 0x05, 0x3f, 0x09, 0x8a, 0x0b, 0x7e, 0x0d, 0xc9, 0x0e, 0xda, 0x0e, 
-0x2c, 0x0f, 0x11, 0x0e, 0x3a, 0x0c, 0xe9, 0x09, 0xc3, 0x06, 0x62, 0x04, 0x91, 0x01, 0xf1, 0xfe, 
-0x64, 0xfd, 0xf0, 0xfb, 0x21, 0xfb, 0x3c, 0xfb, 0xe0, 0xfb, 0x40, 0xfd, 0xff, 0xfe, 0x6e, 0x00, 
-0xba, 0x01, 0xfc, 0x02, 0x7a, 0x03, 0x82, 0x02, 0xc6, 0x00, 0x41, 0xfe, 0x51, 0xf9, 0x4b, 0xf4, 
-0x7c, 0xef, 0x44, 0xee, 0xad, 0xef, 0x60, 0xef, 0x83, 0xf3, 0x20, 0xf8, 0x5c, 0xfc, 0xcb, 0x00, 
-0xe6, 0x02, 0x5b, 0x06, 0x93, 0x08, 0x3f, 0x09, 0x6f, 0x0a, 0x86, 0x0a, 0x08, 0x0b, 0x0c, 0x0b, 
-0x57, 0x09, 0x6f, 0x09, 0xf3, 0x09, 0x80, 0x08, 0xfb, 0x06, 0x6f, 0x04, 0xa4, 0x02, 0x77, 0x00, 
-0x93, 0xfd, 0x4f, 0xfc, 0x0c, 0xfb, 0x9c, 0xfb, 0xfb, 0xfb, 0xc2, 0xfc, 0xaf, 0xff, 0xb5, 0x01, 
-0xa4, 0x02, 0x7d, 0x03, 0x6d, 0x03, 0x0c, 0x02, 0x07, 0xff, 0x23, 0xfa, 0x61, 0xf3, 0x6b, 0xeb, 
-0xed, 0xe5, 0x85, 0xe4, 0x10, 0xe7, 0xe3, 0xec, 0x54, 0xf6, 0xf5, 0xfe, 0xae, 0x05, 0x4a, 0x0c, 
-0x94, 0x0f, 0x1a, 0x10, 0x22, 0x0f, 0xf6, 0x0b, 0x30, 0x09, 0x0c, 0x07, 0x75, 0x05, 0x0e, 0x05, 
-0x8a, 0x05, 0x18, 0x07, 0x25, 0x08, 0xad, 0x09, 0xbd, 0x09, 0x38, 0x08, 0xbc, 0x06, 0xe5, 0x03, 
-0x2d, 0x00, 0xde, 0xfd, 0xc6, 0xfb, 0x5a, 0xfa, 0x64, 0xfc, 0xb8, 0xfe, 0xfc, 0x00, 0x2a, 0x03, 
-0x03, 0x04, 0xdf, 0x04, 0x2d, 0x03, 0x9e, 0x01, 0x0b, 0xfe, 0xa4, 0xf7, 0xba, 0xf0, 0x96, 0xe7, 
-0xc6, 0xe1, 0x6a, 0xe3, 0xdd, 0xe6, 0x56, 0xee, 0xe0, 0xf8, 0xa8, 0x00, 0x3b, 0x09, 0xfb, 0x0e, 
-0xf2, 0x10, 0xf9, 0x10, 0xb2, 0x0e, 0x2a, 0x0b, 0xbb, 0x07, 0xa8, 0x04, 0x99, 0x03, 0x28, 0x03, 
-0x85, 0x03, 0xec, 0x05, 0x20, 0x07, 0x1d, 0x08, 0xa1, 0x08, 0xad, 0x07, 0xc5, 0x06, 0xf0, 0x03, 
-0x9a, 0x00, 0x21, 0xff, 0x9e, 0xfc, 0x32, 0xfc, 0x7a, 0xfc, 0x20, 0xfd, 0x8d, 0xff, 0xf7, 0x00, 
-0x5c, 0x02, 0xd7, 0x02, 0xe1, 0x01, 0xf6, 0xfe, 0xd1, 0xf9, 0xe0, 0xf2, 0x61, 0xea, 0x20, 0xe4, 
-0xd9, 0xe4, 0xf5, 0xe6, 0x2d, 0xed, 0xf0, 0xf7, 0x18, 0x00, 0x43, 0x09, 0x69, 0x0f, 0xd3, 0x11, 
-0x6b, 0x13, 0x86, 0x10, 0xe3, 0x0b, 0x42, 0x08, 0x6f, 0x04, 0x00, 0x01, 0x8e, 0xff, 0xd1, 0xff, 
-0xba, 0x01, 0x2c, 0x04, 0xac, 0x05, 0x22, 0x06, 0x69, 0x07, 0x9f, 0x08, 0x94, 0x06, 0xb5, 0x03, 
-0x1d, 0x02, 0x76, 0x00, 0xa1, 0xfe, 0xd6, 0xfd, 0xbb, 0xfd, 0xc6, 0xfe, 0xd7, 0xff, 0x65, 0x00, 
-0x27, 0x00, 0x8d, 0xff, 0x25, 0xfe, 0x43, 0xfa, 0x43, 0xf3, 0xa8, 0xec, 0x15, 0xe6, 0x8b, 0xe6, 
-0xa4, 0xe9, 0x92, 0xec, 0x98, 0xf7, 0x14, 0x00, 0x10, 0x08, 0xba, 0x0e, 0x76, 0x10, 0x4b, 0x14, 
-0xc7, 0x12, 0x68, 0x0d, 0x83, 0x0b, 0x15, 0x06, 0x55, 0x02, 0x1c, 0xff, 0x65, 0xfc, 0xb1, 0xfe, 
-0xe0, 0xfe, 0x3a, 0x00, 0x63, 0x03, 0xcb, 0x05, 0x42, 0x09, 0x50, 0x09, 0xa4, 0x08, 0xd7, 0x08, 
-0x3d, 0x06, 0x3b, 0x04, 0xaa, 0x02, 0xd9, 0x00, 0x93, 0xff, 0x49, 0xfd, 0x59, 0xfc, 0x04, 0xfc, 
-0x02, 0xfa, 0x52, 0xf8, 0x5f, 0xf5, 0xdd, 0xef, 0x7b, 0xe9, 0xed, 0xe7, 0x1c, 0xec, 0x75, 0xec, 
-0x07, 0xf1, 0x1a, 0xfa, 0xaf, 0x00, 0x1f, 0x08, 0x21, 0x0c, 0x80, 0x10, 0x48, 0x13, 0x0b, 0x11, 
-0x19, 0x0e, 0x79, 0x0a, 0xce, 0x06, 0xf9, 0x01, 0x9e, 0xfd, 0xc1, 0xfc, 0x2b, 0xfc, 0x2d, 0xfc, 
-0x71, 0xfe, 0x6b, 0x01, 0x86, 0x04, 0x72, 0x07, 0x84, 0x09, 0x5f, 0x0a, 0x6c, 0x0a, 0xd1, 0x09, 
-0x4d, 0x08, 0x59, 0x06, 0x1b, 0x03, 0x3c, 0x00, 0x43, 0xfe, 0x04, 0xfc, 0x12, 0xfa, 0x84, 0xf8, 
-0xcf, 0xf6, 0xf5, 0xf3, 0x84, 0xef, 0x69, 0xea, 0xbb, 0xe8, 0xc8, 0xeb, 0x11, 0xed, 0x20, 0xf2, 
-0xcc, 0xf9, 0xb5, 0xff, 0x40, 0x05, 0x6b, 0x09, 0x5a, 0x0e, 0x42, 0x10, 0xd7, 0x0f, 0x39, 0x0f, 
-0x0f, 0x0d, 0x06, 0x0a, 0x1f, 0x06, 0xa8, 0x01, 0x24, 0x00, 0xd0, 0xfd, 0xab, 0xfc, 0x82, 0xfd, 
-0xeb, 0xff, 0xbe, 0x01, 0xe3, 0x02, 0x87, 0x06, 0xd8, 0x07, 0xe4, 0x08, 0x01, 0x0a, 0xc7, 0x08, 
-0x50, 0x07, 0x22, 0x05, 0xe9, 0x01, 0x3d, 0x00, 0x34, 0xfd, 0xaf, 0xf9, 0x6c, 0xf7, 0x7d, 0xf5, 
-0xdc, 0xf2, 0xbf, 0xee, 0x6b, 0xec, 0x4f, 0xef, 0x6e, 0xef, 0xca, 0xf0, 0xaa, 0xf6, 0xa8, 0xfa, 
-0xb1, 0xff, 0x2a, 0x03, 0x11, 0x07, 0xde, 0x0a, 0x9f, 0x0a, 0x99, 0x0b, 0xb1, 0x0b, 0x3a, 0x0a, 
-0xc9, 0x08, 0xdf, 0x05, 0xf0, 0x04, 0x8b, 0x02, 0xa4, 0xff, 0x9e, 0xff, 0x59, 0xff, 0x30, 0xff, 
-0x89, 0xff, 0x7d, 0x00, 0x52, 0x02, 0xba, 0x02, 0xd1, 0x03, 0x32, 0x05, 0x5e, 0x04, 0xc8, 0x03, 
-0xa6, 0x02, 0x72, 0x02, 0xd4, 0x01, 0x9d, 0xff, 0x31, 0xff, 0xfd, 0xfd, 0x29, 0xfc, 0xdc, 0xfb, 
-0xf5, 0xf9, 0xb1, 0xf9, 0x93, 0xf9, 0xcd, 0xf8, 0x4e, 0xfa, 0x5f, 0xf9, 0xdd, 0xfa, 0x17, 0xfb, 
-0xab, 0xfa, 0xb9, 0xfb, 0x17, 0xfc, 0x06, 0xfd, 0x33, 0xfe, 0x0e, 0xff, 0xb8, 0x00, 0x10, 0x02, 
-0xb8, 0x02, 0x20, 0x04, 0xee, 0x03, 0xce, 0x04, 0x46, 0x05, 0xb2, 0x04, 0x84, 0x04, 0xe5, 0x03, 
-0xb7, 0x03, 0x95, 0x03, 0xb0, 0x03, 0xad, 0x03, 0x24, 0x03, 0x4a, 0x03, 0x40, 0x03, 0xda, 0x02, 
-0xe3, 0x02, 0xca, 0x01, 0x71, 0x01, 0xa0, 0x00, 0x6a, 0xff, 0x14, 0xff, 0x6d, 0xfe, 0x3a, 0xfe, 
-0xe4, 0xfd, 0x82, 0xfd, 0x56, 0xfd, 0x0f, 0xfd, 0xe9, 0xfc, 0xf8, 0xfc, 0xb9, 0xfc, 0xa7, 0xfc, 
-0x11, 0xfc, 0xcb, 0xfb, 0x9c, 0xfb, 0xbc, 0xfb, 0x93, 0xfb, 0x0d, 0xfc, 0xa3, 0xfc, 0x02, 0xfd, 
-0x1f, 0xfe, 0x44, 0xff, 0xf6, 0xff, 0xd4, 0x00, 0xd6, 0x01, 0x61, 0x02, 0x48, 0x03, 0x62, 0x03, 
-0x85, 0x03, 0x55, 0x04, 0x11, 0x04, 0xda, 0x04, 0xab, 0x04, 0x73, 0x04, 0x78, 0x04, 0x91, 0x03, 
-0x5d, 0x03, 0x2e, 0x02, 0xa7, 0x01, 0xd2, 0x00, 0xfc, 0xff, 0x9a, 0xff, 0x02, 0xff, 0x99, 0xfe, 
-0x67, 0xfe, 0x78, 0xfe, 0x1a, 0xfe, 0xef, 0xfd, 0x1c, 0xfe, 0x61, 0xfe, 0xc2, 0xfd, 0x8e, 0xfd, 
-0xb8, 0xfd, 0x2c, 0xfd, 0xfc, 0xfc, 0xfd, 0xfc, 0x29, 0xfd, 0x8f, 0xfd, 0xe4, 0xfd, 0x4d, 0xfe, 
-0x0f, 0xff, 0x3a, 0xff, 0xf1, 0xff, 0x1b, 0x00, 0xa1, 0x00, 0x5a, 0x01, 0x46, 0x01, 0x92, 0x01, 
-0x29, 0x02, 0x6c, 0x02, 0x50, 0x02, 0x9a, 0x02, 0x85, 0x02, 0xa4, 0x02, 0x54, 0x02, 0xc0, 0x01, 
-0xd6, 0x01, 0x1a, 0x01, 0xa8, 0x00, 0x93, 0x00, 0xef, 0xff, 0x32, 0x00, 0xf4, 0xff, 0xbc, 0xff, 
-0x02, 0x00, 0xbf, 0xff, 0xbc, 0xff, 0x5e, 0xff, 0x36, 0xff, 0xf5, 0xfe, 0x8d, 0xfe, 0x52, 0xfe, 
-0x70, 0xfe, 0x58, 0xfe, 0x24, 0xfe, 0xa1, 0xfe, 0x81, 0xfe, 0xca, 0xfe, 0xf5, 0xfe, 0x32, 0xff, 
-0x6a, 0xff, 0xae, 0xff, 0xd6, 0xff, 0x20, 0x00, 0x7b, 0x00, 0x9e, 0x00, 0xd4, 0x00, 0xdc, 0x00, 
-0xf8, 0x00, 0xe1, 0x00, 0xbe, 0x00, 0xc0, 0x00, 0xde, 0x00, 0x8e, 0x00, 0xaf, 0x00, 0x8d, 0x00, 
-0x5d, 0x00, 0x4d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x2f, 0x00, 0x54, 0x00, 0x6c, 0x00, 0x76, 0x00, 
-0x6e, 0x00, 0x74, 0x00, 0x60, 0x00, 0x16, 0x00, 0xf5, 0xff, 0xe0, 0xff, 0xa9, 0xff, 0x8c, 0xff, 
-0x2f, 0xff, 0x27, 0xff, 0x20, 0xff, 0xeb, 0xfe, 0x1b, 0xff, 0x45, 0xff, 0x63, 0xff, 0xb3, 0xff, 
-0xfa, 0xff, 0x40, 0x00, 0x8c, 0x00, 0xbb, 0x00, 0xfa, 0x00, 0x28, 0x01, 0x1a, 0x01, 0x1f, 0x01, 
-0xf7, 0x00, 0xd0, 0x00, 0xb0, 0x00, 0x7f, 0x00, 0x60, 0x00, 0x1c, 0x00, 0x05, 0x00, 0x03, 0x00, 
-0xdb, 0xff, 0xdd, 0xff, 0xcf, 0xff, 0xd5, 0xff, 0xc6, 0xff, 0xd0, 0xff, 0xee, 0xff, 0xc6, 0xff, 
-0xc6, 0xff, 0xaa, 0xff, 0x92, 0xff, 0x91, 0xff, 0x55, 0xff, 0x2b, 0xff, 0x23, 0xff, 0x11, 0xff, 
-0x06, 0xff, 0xfe, 0xfe, 0x20, 0xff, 0x4f, 0xff, 0x6b, 0xff, 0xab, 0xff, 0x03, 0x00, 0x19, 0x00, 
-0x6e, 0x00, 0xab, 0x00, 0xe3, 0x00, 0x05, 0x01, 0x04, 0x01, 0x28, 0x01, 0x24, 0x01, 0x16, 0x01, 
-0xff, 0x00, 0xe6, 0x00, 0xdf, 0x00, 0xcb, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0x8a, 0x00, 0x83, 0x00, 
-0x50, 0x00, 0x3a, 0x00, 0x2e, 0x00, 0x07, 0x00, 0xe7, 0xff, 0xe1, 0xff, 0xb0, 0xff, 0x80, 0xff, 
-0x57, 0xff, 0x2f, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x4e, 0xff, 0x02, 0xff, 0xd4, 0xfe, 0xbb, 0xfe, 
-0xfb, 0xfe, 0x12, 0xff, 0x46, 0xff, 0x3a, 0xff, 0x56, 0xff, 0x8d, 0xff, 0xcc, 0xff, 0x0a, 0x00, 
-0x2d, 0x00, 0x6e, 0x00, 0x74, 0x00, 0xa5, 0x00, 0xbd, 0x00, 0xcd, 0x00, 0xde, 0x00, 0xdd, 0x00, 
-0xd2, 0x00, 0xdf, 0x00, 0xbf, 0x00, 0xd1, 0x00, 0xb6, 0x00, 0xbc, 0x00, 0xa0, 0x00, 0x86, 0x00, 
-0x77, 0x00, 0x5b, 0x00, 0x4e, 0x00, 0x2d, 0x00, 0x07, 0x00, 0xf4, 0xff, 0xd3, 0xff, 0x98, 0xff, 
-0x8b, 0xff, 0x77, 0xff, 0x43, 0xff, 0x3e, 0xff, 0x22, 0xff, 0x19, 0xff, 0xd7, 0xfe, 0xfe, 0xfe, 
-0x29, 0xff, 0xf9, 0xfe, 0x28, 0xff, 0x28, 0xff, 0x4d, 0xff, 0x65, 0xff, 0xb4, 0xff, 0xe8, 0xff, 
-0x02, 0x00, 0x58, 0x00, 0x75, 0x00, 0xa5, 0x00, 0xd0, 0x00, 0xa4, 0x00, 0xaf, 0x00, 0xcf, 0x00, 
-0xde, 0x00, 0xdd, 0x00, 0xc9, 0x00, 0xa6, 0x00, 0xc0, 0x00, 0x95, 0x00, 0x79, 0x00, 0x78, 0x00, 
-0x49, 0x00, 0x36, 0x00, 0x43, 0x00, 0x5d, 0x00, 0x16, 0x00, 0xf3, 0xff, 0xdf, 0xff, 0x89, 0xff, 
-0x77, 0xff, 0x78, 0xff, 0x83, 0xff, 0x57, 0xff, 0x32, 0xff, 0x0f, 0xff, 0xd5, 0xfe, 0x0a, 0xff, 
-0x13, 0xff, 0x47, 0xff, 0x44, 0xff, 0x31, 0xff, 0x57, 0xff, 0x7a, 0xff, 0x99, 0xff, 0xdc, 0xff, 
-0xcc, 0xff, 0x21, 0x00, 0x22, 0x00, 0x22, 0x00, 0x80, 0x00, 0x60, 0x00, 0xcf, 0x00, 0x99, 0x00, 
-0x5a, 0x00, 0xcb, 0x00, 0xc4, 0x00, 0x89, 0x00, 0xe4, 0x00, 0xb3, 0x00, 0x62, 0x00, 0x72, 0x00, 
-0x9a, 0x00, 0x5e, 0x00, 0x20, 0x00, 0x4a, 0x00, 0x42, 0x00, 0x3e, 0x00, 0xcf, 0xff, 0xf6, 0xff, 
-0xc3, 0xff, 0x8a, 0xff, 0xc5, 0xff, 0x71, 0xff, 0x8a, 0xff, 0x1c, 0xff, 0x95, 0xff, 0x97, 0xff, 
-0x56, 0xff, 0x64, 0xff, 0xfe, 0xfe, 0xa2, 0xff, 0x66, 0xff, 0x77, 0xff, 0x85, 0xff, 0x8b, 0xff, 
-0xd3, 0xff, 0x8f, 0xff, 0xba, 0xff, 0xf3, 0xff, 0x3f, 0x00, 0x5e, 0x00, 0x1f, 0x00, 0x45, 0x00, 
-0x7b, 0x00, 0x79, 0x00, 0x40, 0x00, 0x70, 0x00, 0x97, 0x00, 0x16, 0x00, 0xc7, 0x00, 0x29, 0x00, 
-0x4e, 0x00, 0x42, 0x00, 0x53, 0x00, 0x56, 0x01, 0x64, 0xff, 0xd8, 0x01, 0x5d, 0xff, 0x18, 0x06, 
-0x46, 0x02, 0x64, 0xfa, 0x46, 0x02, 0x71, 0xfa, 0x6a, 0x04, 0x04, 0x04, 0x48, 0xfb, 0xc8, 0x00, 
-0x09, 0xfc, 0x20, 0x00, 0x65, 0xfe, 0xba, 0xfe, 0x6a, 0x00, 0x12, 0xfc, 0xcc, 0x03, 0xa9, 0x01, 
-0xd5, 0xfd, 0x02, 0x01, 0x0c, 0xfe, 0x5d, 0x00, 0x12, 0x00, 0x7f, 0x00, 0x16, 0x00, 0x57, 0xfe, 
-0x69, 0x00, 0xf6, 0xff, 0xc0, 0x00, 0x25, 0xff, 0x07, 0x01, 0xbc, 0x02, 0x6e, 0x00, 0x9b, 0x00, 
-0xd1, 0xff, 0xba, 0xfe, 0xd9, 0xfe, 0x99, 0x00, 0xb9, 0x02, 0x0f, 0xff, 0xf8, 0xfe, 0x2a, 0xfe, 
-0xc3, 0xfe, 0x54, 0xff, 0x02, 0xff, 0x2e, 0x00, 0x05, 0xff, 0xb7, 0xff, 0xc5, 0xff, 0x48, 0x00, 
-0x2f, 0x00, 0x10, 0x00, 0xad, 0xff, 0x70, 0x00, 0xc0, 0xfe, 0xe2, 0x00, 0xe5, 0xff, 0x1d, 0x01, 
-0x84, 0xff, 0x2d, 0x00, 0x07, 0x00, 0x06, 0xff, 0x4e, 0x01, 0xe2, 0xfe, 0x71, 0x00, 0x22, 0x00, 
-0x98, 0xff, 0x2b, 0x01, 0xb9, 0xfe, 0xc9, 0x00, 0x38, 0x00, 0xdc, 0x00, 0x06, 0x00, 0xcb, 0xfe, 
-0x85, 0x02, 0x7d, 0xff, 0x53, 0x02, 0xc6, 0xfe, 0x05, 0x01, 0x91, 0x01, 0xa9, 0xfe, 0xc8, 0x02, 
-0xfd, 0xff, 0xca, 0xfe, 0xc4, 0x00, 0xa2, 0xff, 0x36, 0x01, 0xfb, 0xfe, 0x4a, 0x01, 0xf0, 0xff, 
-0x35, 0xff, 0x4b, 0x01, 0xc3, 0xfe, 0xf1, 0x00, 0xfa, 0xfe, 0xac, 0x00, 0x5c, 0x01, 0x07, 0xfe, 
-0x72, 0x02, 0x26, 0xfe, 0x75, 0x00, 0x2c, 0x00, 0x93, 0x00, 0x2d, 0x01, 0xfe, 0xfd, 0xbc, 0x02, 
-0xe7, 0xfd, 0x29, 0x01, 0x98, 0x00, 0x46, 0xfd, 0xae, 0x03, 0x25, 0xfe, 0xc9, 0xff, 0x25, 0x02, 
-0x6e, 0xfe, 0xab, 0x01, 0x5b, 0xfd, 0x3c, 0x03, 0x5e, 0xfc, 0xd6, 0x02, 0xfb, 0xfe, 0x21, 0x00, 
-0x64, 0x00, 0xee, 0xfe, 0x7f, 0x00, 0xbc, 0xff, 0x8a, 0xfe, 0x94, 0x00, 0x3d, 0xff, 0xdf, 0xfe, 
-0xdd, 0x01, 0x1e, 0xfd, 0x40, 0x03, 0x67, 0xfc, 0x6b, 0x03, 0x65, 0xfc, 0x2e, 0x03, 0x89, 0xfc, 
-0x40, 0x02, 0x1e, 0xff, 0x93, 0x00, 0x20, 0xff, 0x5b, 0x01, 0x30, 0x00, 0xa8, 0xfd, 0x9f, 0x03, 
-0xcc, 0xfd, 0x22, 0x02, 0x1d, 0xff, 0x05, 0x02, 0xd0, 0x00, 0x39, 0x06, 0x09, 0xfd, 0x40, 0x03, 
-0x37, 0xfc, 0x00, 0x01, 0xc0, 0xff, 0xec, 0xff, 0x79, 0xff, 0xf5, 0xfe, 0x2f, 0x00, 0x1a, 0xfd, 
-0x22, 0x02, 0x50, 0xfe, 0x1d, 0x00, 0x9c, 0x00, 0x4f, 0xff, 0x56, 0xff, 0xf8, 0x01, 0x45, 0xfe, 
-0xb6, 0x01, 0x87, 0xfd, 0x4e, 0x01, 0xaf, 0xfe, 0x00, 0xfe, 0xc8, 0x02, 0x4b, 0xfc, 0x66, 0x01, 
-0xc7, 0xff, 0xe5, 0xfd, 0xa0, 0x02, 0x7f, 0xfd, 0x25, 0x02, 0x79, 0xff, 0x9d, 0xfe, 0x0a, 0x02, 
-0x42, 0xff, 0x81, 0xfe, 0x8b, 0x03, 0xfb, 0xfd, 0xf9, 0xff, 0xd5, 0x00, 0x41, 0xfd, 0x4a, 0x03, 
-0x53, 0xfc, 0x87, 0x00, 0x0a, 0x01, 0xf8, 0xfc, 0x17, 0x02, 0x20, 0xfe, 0xc8, 0x00, 0xfa, 0xfe, 
-0x11, 0xfe, 0xff, 0x00, 0x5f, 0xfc, 0xff, 0xff, 0xdf, 0xfe, 0xe6, 0xfe, 0x9f, 0xfe, 0x31, 0x00, 
-0x2c, 0xff, 0x4e, 0xfe, 0xfc, 0xff, 0x29, 0x00, 0x16, 0x00, 0xdf, 0xff, 0x94, 0x00, 0xba, 0x01, 
-0x74, 0x00, 0x3d, 0x00, 0x05, 0x02, 0x95, 0xff, 0x23, 0x01, 0x2d, 0x01, 0xa0, 0x00, 0x3d, 0x02, 
-0x81, 0x00, 0x3c, 0x02, 0x99, 0xfe, 0xf6, 0xff, 0x43, 0x02, 0xc4, 0x00, 0xcb, 0x00, 0xf9, 0xff, 
-0x6f, 0x01, 0xf5, 0xfe, 0x41, 0xff, 0xc7, 0x00, 0x13, 0xff, 0x70, 0xff, 0x5c, 0x00, 0x60, 0x00, 
-0x2a, 0xff, 0xb0, 0xff, 0xc7, 0x00, 0x7a, 0xff, 0x84, 0xff, 0x59, 0x00, 0xd5, 0xfe, 0x5d, 0xfe, 
-0xca, 0xff, 0xf0, 0xfe, 0x9d, 0xfd, 0xe8, 0xfe, 0xb9, 0xff, 0xb0, 0xff, 0xc3, 0xfe, 0xdd, 0xff, 
-0x5e, 0x02, 0x7f, 0xfe, 0x36, 0x01, 0xb2, 0x02, 0xef, 0xfe, 0x18, 0x01, 0xb6, 0x01, 0x96, 0x01, 
-0x5c, 0xff, 0xba, 0x00, 0x69, 0x02, 0xb6, 0xfd, 0x10, 0x01, 0x30, 0x02, 0x44, 0xfe, 0x49, 0x01, 
-0x35, 0xff, 0x00, 0x02, 0xc5, 0x00, 0x2e, 0xff, 0xac, 0x02, 0x2e, 0xfe, 0xc8, 0x01, 0x05, 0xff, 
-0x81, 0x00, 0xa4, 0x01, 0x23, 0xfb, 0x4e, 0x02, 0x0e, 0xfe, 0x02, 0xfe, 0xb4, 0x00, 0x0d, 0xff, 
-0x12, 0x01, 0x35, 0xfc, 0x52, 0x01, 0xe7, 0x00, 0xba, 0xfc, 0xac, 0x02, 0xf2, 0xfe, 0xb7, 0xfd, 
-0xf9, 0x00, 0x0e, 0xfe, 0xe4, 0x00, 0x8b, 0xfd, 0x81, 0x00, 0x15, 0x00, 0x2d, 0xfd, 0xb0, 0x03, 
-0x9e, 0xfd, 0x9f, 0x02, 0xfd, 0xfe, 0x84, 0xff, 0xdb, 0x03, 0xde, 0xfc, 0x60, 0x03, 0x1c, 0xff, 
-0xa4, 0x01, 0x46, 0x01, 0xb0, 0xfe, 0xb8, 0x02, 0x32, 0xfe, 0x62, 0x02, 0xab, 0xff, 0x68, 0xfd, 
-0x20, 0x04, 0x3d, 0xfe, 0x2b, 0xfe, 0x1e, 0x03, 0x11, 0xff, 0xc3, 0xfe, 0xb1, 0xff, 0xab, 0x01, 
-0xed, 0xfc, 0x96, 0xff, 0xbc, 0x03, 0x77, 0xfc, 0x6f, 0x00, 0x8c, 0x02, 0x8d, 0xfd, 0x5e, 0xff, 
-0x0a, 0x02, 0x04, 0xff, 0x9c, 0xfe, 0xb2, 0x01, 0x3a, 0xff, 0xbc, 0xfd, 0xaf, 0x00, 0x9e, 0xfe, 
-0xed, 0xfe, 0x25, 0x03, 0xa1, 0xff, 0x09, 0x00, 0x43, 0x02, 0x91, 0x01, 0xb3, 0xfe, 0x94, 0x01, 
-0xb3, 0x01, 0x7a, 0xfe, 0xbf, 0x01, 0xde, 0xff, 0x37, 0x00, 0x19, 0xff, 0xff, 0x00, 0x1b, 0x01, 
-0x5f, 0xff, 0x5a, 0x02, 0x11, 0xff, 0xd6, 0x00, 0xd4, 0x00, 0xae, 0xfe, 0x00, 0x02, 0x04, 0xff, 
-0x4e, 0x00, 0x2f, 0xff, 0xcb, 0xfd, 0x94, 0x01, 0x01, 0xfe, 0x76, 0xff, 0xdf, 0xff, 0x72, 0xff, 
-0x38, 0x00, 0x71, 0xfd, 0xb3, 0x02, 0x69, 0xff, 0xbf, 0xfd, 0xb2, 0x01, 0x56, 0x00, 0x36, 0xfe, 
-0x98, 0xfe, 0x24, 0x02, 0x77, 0xfe, 0x5c, 0xfe, 0x8f, 0x01, 0x23, 0x00, 0xdf, 0xfe, 0x3c, 0x01, 
-0xa9, 0x02, 0xd1, 0xfd, 0x80, 0x01, 0x8c, 0x01, 0x4f, 0xfd, 0xe2, 0x03, 0x54, 0x00, 0xc4, 0xfe, 
-0xb0, 0x00, 0x20, 0x00, 0x4b, 0x00, 0x4b, 0xfd, 0x42, 0x03, 0xcf, 0xfe, 0x9a, 0xfd, 0xeb, 0x03, 
-0x7b, 0xfd, 0xff, 0xff, 0xac, 0x02, 0x77, 0xff, 0xbf, 0x00, 0x96, 0x00, 0x98, 0x00, 0x2b, 0xfd, 
-0x8f, 0xff, 0xdd, 0x01, 0x8f, 0xfc, 0xa6, 0x00, 0xf1, 0xfe, 0xf3, 0xfe, 0x4b, 0x00, 0x3a, 0xff, 
-0xd6, 0x01, 0x0c, 0xff, 0xbd, 0x02, 0x0a, 0xff, 0x2c, 0x00, 0xc9, 0x01, 0x57, 0xfc, 0x2d, 0x02, 
-0x8d, 0xfd, 0x64, 0xfe, 0x2f, 0x00, 0xde, 0xfd, 0x66, 0x02, 0x1f, 0xfd, 0x06, 0x02, 0x67, 0x01, 
-0x51, 0xfe, 0xf6, 0x04, 0x36, 0xff, 0x05, 0x02, 0xb6, 0x00, 0x1e, 0x00, 0xd9, 0x01, 0x5a, 0xfe, 
-0x4a, 0x02, 0x24, 0xff, 0x79, 0x00, 0x06, 0x00, 0xb7, 0xff, 0xb1, 0x00, 0x45, 0xff, 0x5e, 0x01, 
-0xe9, 0xfe, 0xa7, 0x00, 0x3c, 0xff, 0x92, 0xfe, 0x8e, 0x00, 0x3c, 0xff, 0x7d, 0xff, 0xde, 0xfe, 
-0x49, 0x00, 0xfc, 0xff, 0x9a, 0xfd, 0xf7, 0x00, 0x99, 0x01, 0xfd, 0xfd, 0x02, 0x01, 0x11, 0x01, 
-0xe2, 0xfe, 0x31, 0x00, 0xf7, 0xfe, 0x5d, 0x00, 0xe6, 0xfe, 0x30, 0xff, 0x0a, 0x02, 0x6e, 0xff, 
-0x08, 0x01, 0x0c, 0xff, 0x62, 0x00, 0x86, 0x00, 0xa9, 0xfe, 0xa4, 0x02, 0x19, 0xff, 0xff, 0x00, 
-0xb7, 0xfe, 0x79, 0xff, 0xd7, 0xff, 0x8a, 0xfd, 0x24, 0x02, 0x6f, 0xfd, 0x5e, 0x01, 0xa2, 0xff, 
-0xfb, 0xff, 0x1c, 0x01, 0xde, 0xfc, 0xc0, 0x03, 0x07, 0xfd, 0x2e, 0x00, 0x8a, 0x02, 0xcd, 0xfc, 
-0x68, 0x01, 0x3f, 0xfe, 0x78, 0x00, 0x17, 0xff, 0xe4, 0xfe, 0x50, 0x02, 0x83, 0xfd, 0x7f, 0x01, 
-0xf6, 0xff, 0x83, 0xfe, 0x9f, 0x01, 0x7b, 0xfd, 0x9a, 0xff, 0xb7, 0x00, 0xba, 0xfe, 0x5a, 0x01, 
-0x4c, 0x00, 0x34, 0x00, 0xe0, 0xff, 0xb8, 0xff, 0xcb, 0x01, 0xe6, 0xfd, 0x02, 0x01, 0x3c, 0x00, 
-0x59, 0xff, 0xd1, 0x02, 0xf2, 0xfe, 0x5d, 0x02, 0x42, 0x00, 0xab, 0x00, 0xea, 0x00, 0x54, 0xfe, 
-0x4c, 0x01, 0xcc, 0xfd, 0x28, 0x00, 0xa5, 0xff, 0x9f, 0xfe, 0x1d, 0x00, 0xe5, 0xfd, 0x72, 0x00, 
-0x23, 0x00, 0x31, 0xff, 0xb0, 0x00, 0xc5, 0x00, 0x99, 0xff, 0xf1, 0xff, 0xcc, 0x01, 0xbe, 0xfe, 
-0xf1, 0xff, 0xde, 0x01, 0x72, 0xfe, 0xf1, 0xff, 0x85, 0x00, 0x43, 0x00, 0xea, 0xfe, 0xe9, 0x00, 
-0x5b, 0x00, 0x3d, 0xfe, 0x1d, 0x01, 0x2b, 0xff, 0xeb, 0x00, 0xde, 0xfe, 0xed, 0x00, 0x1a, 0x01, 
-0x67, 0xfe, 0xba, 0x01, 0x31, 0xff, 0xee, 0x00, 0x5f, 0xff, 0xcd, 0x00, 0x64, 0xff, 0x2f, 0xff, 
-0x63, 0x02, 0xf4, 0xfd, 0x3e, 0x02, 0x43, 0x00, 0xea, 0xff, 0x9b, 0x01, 0x69, 0xff, 0x72, 0x00, 
-0x5e, 0xfe, 0x22, 0x00, 0xdc, 0xfe, 0x35, 0xff, 0x78, 0x00, 0x45, 0xfe, 0x71, 0x00, 0xab, 0xff, 
-0xc3, 0xff, 0x16, 0x00, 0x95, 0xfe, 0x22, 0x00, 0x33, 0xff, 0x04, 0xff, 0xd3, 0xff, 0x64, 0x00, 
-0xf2, 0xff, 0xa9, 0xff, 0xb5, 0x01, 0xca, 0xfe, 0x32, 0x00, 0x2a, 0x00, 0xd2, 0xfe, 0x50, 0x01, 
-0x72, 0xff, 0x52, 0x01, 0xcd, 0x00, 0xc1, 0x01, 0x27, 0x01, 0xc4, 0x00, 0xfe, 0x02, 0xa0, 0xff, 
-0x23, 0x01, 0x6b, 0x00, 0xc9, 0xff, 0x42, 0xff, 0xc8, 0xff, 0x6f, 0xff, 0xfc, 0xfd, 0xe5, 0x00, 
-0x08, 0xfe, 0x00, 0xff, 0x77, 0x00, 0x0f, 0xff, 0x13, 0xff, 0xb8, 0x00, 0xdd, 0xfe, 0x84, 0xfd, 
-0x2c, 0x01, 0x88, 0xfc, 0xa4, 0xfe, 0x69, 0x00, 0xc7, 0xfc, 0xb0, 0xff, 0x4b, 0xff, 0x65, 0xfe, 
-0x35, 0xff, 0x87, 0x00, 0x9e, 0xff, 0x64, 0x00, 0xe9, 0x00, 0xbf, 0xff, 0xbc, 0x02, 0xeb, 0x00, 
-0xd8, 0x00, 0x6f, 0x03, 0xeb, 0x00, 0x13, 0x02, 0x91, 0x02, 0xc1, 0x00, 0xf3, 0x02, 0xb8, 0x01, 
-0x8b, 0x01, 0xc4, 0x02, 0xf1, 0x00, 0x1a, 0x02, 0x28, 0x02, 0x26, 0x02, 0x04, 0x01, 0xb0, 0x01, 
-0x50, 0x01, 0x28, 0xff, 0xf8, 0x01, 0x48, 0xff, 0xd8, 0xff, 0x38, 0x00, 0x92, 0xfc, 0x4e, 0xfe, 
-0x95, 0xfb, 0x18, 0xfb, 0xdb, 0xfb, 0x3f, 0xf9, 0xd4, 0xfa, 0x6b, 0xf8, 0xb1, 0xf8, 0x8e, 0xf9, 
-0x36, 0xf6, 0xfa, 0xfa, 0x96, 0xf9, 0xa1, 0xf9, 0x0d, 0xfe, 0x75, 0xfd, 0x9f, 0xff, 0x80, 0x01, 
-0x6a, 0x05, 0x5e, 0x04, 0x53, 0x08, 0x46, 0x0b, 0xd4, 0x07, 0xbf, 0x0e, 0xd8, 0x0b, 0x8f, 0x0a, 
-0xb6, 0x0e, 0x05, 0x09, 0xa6, 0x09, 0x64, 0x09, 0x3d, 0x05, 0x9e, 0x04, 0xe3, 0x02, 0x83, 0x00, 
-0x45, 0xff, 0x85, 0xfe, 0xf5, 0xfb, 0x3d, 0xfc, 0x29, 0xfb, 0xc9, 0xf7, 0x29, 0xfa, 0x41, 0xf8, 
-0xd8, 0xf5, 0x97, 0xf8, 0x0f, 0xf6, 0x36, 0xf5, 0x5f, 0xf5, 0xc2, 0xf1, 0x58, 0xf3, 0x26, 0xf3, 
-0x90, 0xf1, 0x4e, 0xf5, 0x0d, 0xf7, 0xb0, 0xf7, 0xbb, 0xfc, 0x85, 0x00, 0x56, 0x01, 0x8d, 0x06, 
-0x43, 0x0a, 0x83, 0x0b, 0x4d, 0x0f, 0x81, 0x10, 0x20, 0x0f, 0xe4, 0x10, 0x68, 0x0f, 0xc0, 0x0b, 
-0xfe, 0x0c, 0xcd, 0x08, 0x4c, 0x06, 0x43, 0x06, 0xdd, 0x02, 0xe8, 0x02, 0xb0, 0x01, 0x15, 0x01, 
-0x50, 0x01, 0x4c, 0x01, 0x8d, 0x01, 0xc3, 0x00, 0x11, 0x02, 0xc1, 0xff, 0xcb, 0xfe, 0x7c, 0xfe, 
-0xd3, 0xf9, 0x0b, 0xfa, 0x48, 0xf6, 0xd7, 0xf3, 0x65, 0xf3, 0x10, 0xef, 0x67, 0xee, 0x5f, 0xec, 
-0x25, 0xec, 0x5f, 0xeb, 0x96, 0xee, 0x1d, 0xf1, 0xa8, 0xf2, 0x9a, 0xfb, 0xc6, 0xfc, 0x08, 0x02, 
-0x8b, 0x09, 0x11, 0x0a, 0xe9, 0x0f, 0x1a, 0x12, 0x50, 0x12, 0x54, 0x14, 0xdb, 0x11, 0x35, 0x11, 
-0xf2, 0x0d, 0xa3, 0x0b, 0x6f, 0x09, 0xeb, 0x04, 0xaa, 0x04, 0x8b, 0x00, 0x33, 0x01, 0x42, 0x00, 
-0x26, 0xff, 0xbd, 0x02, 0xab, 0x00, 0x54, 0x03, 0x22, 0x04, 0x9e, 0x03, 0x65, 0x05, 0x00, 0x04, 
-0x91, 0x03, 0x39, 0x01, 0xad, 0xfe, 0x9f, 0xfd, 0x62, 0xf8, 0xa0, 0xf6, 0x45, 0xf3, 0x16, 0xef, 
-0x02, 0xee, 0xfe, 0xe7, 0x07, 0xea, 0x6f, 0xe7, 0x27, 0xe9, 0x2b, 0xef, 0x75, 0xee, 0x80, 0xf8, 
-0xb9, 0xfa, 0xb7, 0x00, 0x66, 0x08, 0xcf, 0x09, 0x93, 0x11, 0xed, 0x11, 0xeb, 0x13, 0x9d, 0x15, 
-0x47, 0x12, 0x72, 0x11, 0xfe, 0x0d, 0xcc, 0x0a, 0x16, 0x07, 0x37, 0x04, 0x42, 0x02, 0xd1, 0xfe, 
-0x43, 0x00, 0xc7, 0xfe, 0x0f, 0xff, 0xf4, 0x01, 0xb9, 0x00, 0xa2, 0x04, 0xf9, 0x04, 0xe1, 0x04, 
-0xa1, 0x07, 0x2a, 0x05, 0xbd, 0x04, 0x34, 0x04, 0xab, 0xff, 0x8d, 0xfe, 0xad, 0xfb, 0x45, 0xf7, 
-0x29, 0xf5, 0xc7, 0xf1, 0xda, 0xed, 0xe0, 0xe9, 0xf1, 0xea, 0xd5, 0xe7, 0x0c, 0xea, 0xea, 0xee, 
-0xec, 0xed, 0xa4, 0xf7, 0x34, 0xfa, 0x42, 0xfe, 0x79, 0x07, 0xbd, 0x08, 0x39, 0x0e, 0x6a, 0x12, 
-0xd5, 0x12, 0xf4, 0x13, 0xd0, 0x13, 0x1f, 0x10, 0x95, 0x0e, 0x80, 0x0b, 0x3e, 0x06, 0x4c, 0x05, 
-0x09, 0x02, 0xe9, 0xfe, 0xef, 0xff, 0xe7, 0xfe, 0x0c, 0xfe, 0x43, 0x01, 0x18, 0x01, 0x22, 0x02, 
-0xa9, 0x05, 0xb0, 0x04, 0x55, 0x06, 0x1b, 0x07, 0x99, 0x04, 0x81, 0x04, 0x7b, 0x02, 0x5c, 0xff, 
-0x9e, 0xfc, 0x2f, 0xf9, 0x1a, 0xf5, 0x6f, 0xf1, 0x46, 0xee, 0xaf, 0xe8, 0x1f, 0xe9, 0x44, 0xe8, 
-0xb2, 0xe6, 0xb7, 0xed, 0x9f, 0xed, 0x25, 0xf3, 0xd2, 0xfa, 0x44, 0xfd, 0x0a, 0x06, 0x0f, 0x0a, 
-0x5e, 0x0f, 0xf9, 0x12, 0xa4, 0x14, 0x7b, 0x16, 0xc0, 0x13, 0x70, 0x13, 0xc2, 0x0e, 0xc7, 0x0b, 
-0xee, 0x08, 0x56, 0x03, 0x2d, 0x02, 0x2a, 0xff, 0xfa, 0xfc, 0xdf, 0xfd, 0xd6, 0xfd, 0xf2, 0xfd, 
-0xa9, 0x00, 0x06, 0x02, 0x13, 0x03, 0x63, 0x05, 0x71, 0x06, 0xe8, 0x05, 0x50, 0x06, 0x6b, 0x05, 
-0x6e, 0x02, 0x01, 0x02, 0x81, 0xfd, 0x25, 0xfb, 0x1c, 0xf8, 0x31, 0xf2, 0xfd, 0xf1, 0xd2, 0xeb, 
-0xd5, 0xe9, 0x22, 0xeb, 0x11, 0xe8, 0x1e, 0xec, 0x7c, 0xef, 0x03, 0xf2, 0x24, 0xf8, 0x4e, 0xfd, 
-0x29, 0x02, 0x15, 0x08, 0xff, 0x0c, 0xe0, 0x0f, 0x6e, 0x13, 0x24, 0x14, 0x28, 0x13, 0x11, 0x13, 
-0x39, 0x0f, 0x5b, 0x0c, 0xd2, 0x09, 0xc2, 0x04, 0x75, 0x02, 0x9c, 0x00, 0x02, 0xfd, 0x61, 0xfd, 
-0x4b, 0xfd, 0x8e, 0xfc, 0x47, 0xff, 0xd8, 0xff, 0x94, 0x01, 0xc4, 0x03, 0x48, 0x04, 0x95, 0x05, 
-0x11, 0x05, 0xa6, 0x04, 0x8a, 0x03, 0xbb, 0x01, 0x5f, 0xff, 0xcb, 0xfc, 0xbc, 0xf9, 0x51, 0xf6, 
-0x89, 0xf3, 0x96, 0xef, 0xca, 0xec, 0x7d, 0xeb, 0xe6, 0xea, 0x95, 0xeb, 0x44, 0xee, 0xda, 0xf1, 
-0x78, 0xf5, 0xbd, 0xfb, 0x29, 0x00, 0xd3, 0x04, 0x60, 0x0b, 0x2d, 0x0d, 0x86, 0x11, 0xdd, 0x13, 
-0xe2, 0x12, 0xa2, 0x13, 0xd8, 0x10, 0x0b, 0x0e, 0x1f, 0x0b, 0xe7, 0x07, 0xc6, 0x03, 0xed, 0x00, 
-0xb3, 0xff, 0xf2, 0xfb, 0xaf, 0xfc, 0xce, 0xfc, 0x30, 0xfc, 0x9d, 0xfe, 0x2b, 0x00, 0xe1, 0x00, 
-0x21, 0x03, 0x6c, 0x04, 0x25, 0x04, 0xfb, 0x04, 0x29, 0x04, 0x03, 0x03, 0xf9, 0x00, 0x34, 0xff, 
-0x5a, 0xfc, 0x0a, 0xf9, 0x32, 0xf7, 0x4d, 0xf3, 0xd6, 0xf0, 0xf9, 0xec, 0xd2, 0xec, 0xa7, 0xeb, 
-0x1d, 0xec, 0x9d, 0xf1, 0x9f, 0xf0, 0x31, 0xf8, 0xba, 0xfc, 0x60, 0xff, 0x28, 0x08, 0xc4, 0x09, 
-0xe5, 0x0e, 0x60, 0x12, 0xe3, 0x12, 0xd8, 0x13, 0x72, 0x12, 0xb4, 0x10, 0x17, 0x0d, 0x18, 0x0b, 
-0xff, 0x05, 0x36, 0x03, 0x95, 0x00, 0xa7, 0xfc, 0xfe, 0xfc, 0x49, 0xfb, 0xa0, 0xfb, 0x49, 0xfd, 
-0xe8, 0xfd, 0x8f, 0x00, 0xe3, 0x01, 0x95, 0x03, 0x1f, 0x05, 0xbf, 0x05, 0x0a, 0x06, 0xe5, 0x04, 
-0x31, 0x04, 0xef, 0x01, 0x5e, 0xff, 0x8c, 0xfd, 0x9e, 0xf9, 0xb4, 0xf6, 0xdf, 0xf3, 0x30, 0xf0, 
-0x70, 0xec, 0x34, 0xec, 0xdc, 0xea, 0x1b, 0xea, 0x06, 0xf0, 0xf0, 0xef, 0xba, 0xf4, 0x06, 0xfc, 
-0x3d, 0xfd, 0xa7, 0x05, 0x6b, 0x0a, 0xc6, 0x0c, 0x28, 0x13, 0x03, 0x13, 0x03, 0x14, 0x60, 0x14, 
-0x14, 0x11, 0x2f, 0x0f, 0xf4, 0x0b, 0x54, 0x07, 0x1e, 0x04, 0x8a, 0x01, 0x5d, 0xfd, 0xb7, 0xfc, 
-0x03, 0xfc, 0x97, 0xfa, 0x5e, 0xfd, 0x9e, 0xfd, 0x83, 0xff, 0x3e, 0x02, 0xb1, 0x03, 0x0c, 0x05, 
-0x19, 0x06, 0xc5, 0x06, 0x0f, 0x05, 0xfb, 0x04, 0xfd, 0x02, 0xd1, 0xff, 0xf8, 0xfd, 0x13, 0xfa, 
-0x49, 0xf7, 0x03, 0xf4, 0x34, 0xf1, 0x42, 0xed, 0x4c, 0xeb, 0x87, 0xeb, 0xaa, 0xe9, 0x2b, 0xee, 
-0x8c, 0xef, 0xdf, 0xf2, 0xad, 0xf9, 0x7e, 0xfc, 0xef, 0x02, 0x4c, 0x08, 0x5b, 0x0c, 0x75, 0x10, 
-0x64, 0x13, 0x26, 0x14, 0xa6, 0x13, 0xe9, 0x12, 0xdd, 0x0f, 0x8d, 0x0c, 0xbc, 0x09, 0x84, 0x05, 
-0xb1, 0x01, 0x45, 0x00, 0x9b, 0xfc, 0x47, 0xfc, 0x3c, 0xfc, 0x07, 0xfc, 0x63, 0xfe, 0xe2, 0xfe, 
-0x04, 0x02, 0x71, 0x03, 0xe3, 0x04, 0x1c, 0x07, 0xbd, 0x05, 0xfe, 0x06, 0xde, 0x05, 0x1e, 0x03, 
-0xa4, 0x02, 0x42, 0xff, 0x97, 0xfb, 0x77, 0xf9, 0xd5, 0xf5, 0xe1, 0xf1, 0x63, 0xf0, 0xd3, 0xea, 
-0xd4, 0xea, 0x6e, 0xeb, 0x96, 0xe8, 0x73, 0xef, 0xd4, 0xef, 0x4a, 0xf3, 0xdc, 0xfb, 0x96, 0xfd, 
-0xb5, 0x04, 0xb2, 0x0a, 0x90, 0x0d, 0xd7, 0x11, 0x49, 0x14, 0x5c, 0x14, 0xae, 0x13, 0x2f, 0x12, 
-0x2b, 0x0f, 0x07, 0x0b, 0xaf, 0x08, 0x36, 0x04, 0x0f, 0x00, 0xd8, 0xff, 0xaf, 0xfb, 0x86, 0xfb, 
-0x81, 0xfd, 0x23, 0xfb, 0x0c, 0xff, 0x1f, 0x01, 0xf3, 0x00, 0xb8, 0x05, 0xc4, 0x05, 0xdb, 0x05, 
-0x48, 0x08, 0x6c, 0x06, 0x14, 0x05, 0xe2, 0x04, 0x1f, 0x01, 0x96, 0xfe, 0x99, 0xfc, 0xe0, 0xf7, 
-0xff, 0xf4, 0xbc, 0xf2, 0xd7, 0xed, 0xaa, 0xea, 0xb3, 0xeb, 0xe5, 0xe8, 0x53, 0xea, 0xe6, 0xee, 
-0x76, 0xef, 0x22, 0xf6, 0xda, 0xfa, 0x88, 0xff, 0x8f, 0x06, 0x18, 0x0a, 0xc6, 0x0e, 0x79, 0x12, 
-0x58, 0x13, 0x15, 0x14, 0xfe, 0x13, 0x90, 0x10, 0x2a, 0x0e, 0xda, 0x0b, 0xa7, 0x06, 0x2b, 0x04, 
-0xa9, 0x01, 0x39, 0xfe, 0xcb, 0xfd, 0x13, 0xfd, 0x16, 0xfd, 0x73, 0xfe, 0xc7, 0xff, 0x70, 0x01, 
-0x40, 0x03, 0x04, 0x05, 0x84, 0x05, 0x22, 0x07, 0xd0, 0x06, 0x10, 0x05, 0xb8, 0x05, 0x47, 0x02, 
-0xa5, 0xff, 0xd0, 0xfe, 0xc7, 0xf9, 0x7e, 0xf7, 0xfd, 0xf4, 0xaf, 0xf0, 0x8a, 0xed, 0xf9, 0xea, 
-0x21, 0xea, 0xb7, 0xe8, 0x58, 0xeb, 0x32, 0xee, 0x17, 0xf0, 0x03, 0xf7, 0xbe, 0xfa, 0xb9, 0xff, 
-0x75, 0x07, 0x11, 0x0a, 0x06, 0x0f, 0x8e, 0x13, 0x76, 0x13, 0xf9, 0x14, 0x7e, 0x14, 0x8a, 0x11, 
-0x28, 0x0f, 0xfa, 0x0b, 0x97, 0x08, 0x68, 0x04, 0x8d, 0x01, 0x72, 0xff, 0xad, 0xfc, 0xe9, 0xfc, 
-0xf7, 0xfc, 0x02, 0xfd, 0x27, 0xff, 0x72, 0x00, 0xfe, 0x01, 0x72, 0x04, 0x58, 0x05, 0x78, 0x05, 
-0xee, 0x06, 0x3c, 0x05, 0xe5, 0x03, 0xc2, 0x03, 0xcd, 0xfe, 0x76, 0xfd, 0x11, 0xfb, 0x91, 0xf5, 
-0xc5, 0xf4, 0x0c, 0xf0, 0xdc, 0xeb, 0x02, 0xeb, 0xa0, 0xe8, 0x85, 0xe9, 0xfc, 0xea, 0x48, 0xed, 
-0x7f, 0xf2, 0x23, 0xf6, 0x6e, 0xfb, 0x89, 0x02, 0x4d, 0x06, 0xfe, 0x0b, 0x28, 0x11, 0x98, 0x12, 
-0x3b, 0x15, 0xd5, 0x14, 0x4a, 0x13, 0x09, 0x12, 0xd3, 0x0d, 0x2b, 0x0b, 0xe8, 0x07, 0x18, 0x03, 
-0x49, 0x01, 0x0c, 0xff, 0xd1, 0xfc, 0x2a, 0xfd, 0x74, 0xfd, 0x64, 0xfe, 0x68, 0x00, 0xf6, 0x01, 
-0x83, 0x04, 0xcf, 0x05, 0x51, 0x06, 0xd8, 0x07, 0xc9, 0x06, 0x02, 0x06, 0x04, 0x05, 0x3b, 0x02, 
-0xf1, 0xff, 0x01, 0xfd, 0x75, 0xf9, 0xcd, 0xf6, 0x68, 0xf3, 0x27, 0xf0, 0xa2, 0xed, 0xd3, 0xe9, 
-0xb2, 0xe9, 0xfb, 0xe9, 0xdc, 0xe9, 0xe9, 0xed, 0x82, 0xf1, 0xa6, 0xf4, 0xc6, 0xfa, 0x55, 0x00, 
-0x71, 0x04, 0xfe, 0x09, 0xcd, 0x0d, 0xba, 0x10, 0x75, 0x12, 0x11, 0x13, 0x86, 0x12, 0xdd, 0x0f, 
-0x9d, 0x0e, 0x17, 0x0b, 0xff, 0x06, 0x31, 0x05, 0xcf, 0x01, 0x49, 0xff, 0x5c, 0xff, 0x0d, 0xfe, 
-0x21, 0xfe, 0x84, 0x00, 0xbd, 0x00, 0x92, 0x02, 0x58, 0x05, 0xf4, 0x05, 0x48, 0x07, 0x09, 0x08, 
-0xa2, 0x07, 0x65, 0x06, 0xa2, 0x04, 0x7a, 0x03, 0x41, 0x00, 0xe2, 0xfc, 0x5e, 0xfa, 0xa3, 0xf7, 
-0xa4, 0xf3, 0xa3, 0xf0, 0x42, 0xef, 0xf4, 0xe9, 0x58, 0xe9, 0x88, 0xeb, 0x21, 0xe9, 0x55, 0xec, 
-0xdd, 0xf1, 0xd4, 0xf3, 0x8e, 0xf8, 0xbe, 0xff, 0x52, 0x04, 0xe7, 0x07, 0x7b, 0x0d, 0xd0, 0x10, 
-0x9c, 0x11, 0x4a, 0x13, 0x34, 0x13, 0xab, 0x10, 0xa4, 0x0e, 0x77, 0x0c, 0x23, 0x08, 0xb9, 0x04, 
-0x69, 0x02, 0x9b, 0xff, 0x10, 0xfe, 0x77, 0xfd, 0x13, 0xfe, 0xc7, 0xfe, 0xe1, 0xff, 0x35, 0x02, 
-0xd4, 0x03, 0x4e, 0x05, 0x53, 0x06, 0x13, 0x07, 0x87, 0x07, 0x53, 0x06, 0xdd, 0x04, 0xa9, 0x03, 
-0xd5, 0x00, 0x6e, 0xfe, 0x16, 0xfc, 0x51, 0xf8, 0x6b, 0xf6, 0x10, 0xf4, 0x76, 0xf1, 0xfd, 0xee, 
-0x10, 0xec, 0x49, 0xed, 0x33, 0xed, 0xd0, 0xec, 0x72, 0xf1, 0x13, 0xf4, 0x8e, 0xf6, 0xd6, 0xfb, 
-0xd2, 0xff, 0xe1, 0x03, 0x07, 0x08, 0x44, 0x0b, 0x64, 0x0e, 0xc1, 0x0f, 0xbe, 0x0f, 0x89, 0x10, 
-0x44, 0x0e, 0x3b, 0x0b, 0x1d, 0x0b, 0x94, 0x07, 0x89, 0x04, 0x45, 0x03, 0x9c, 0x01, 0xcb, 0x00, 
-0xd1, 0xff, 0x90, 0x00, 0xf4, 0x00, 0xab, 0x01, 0x91, 0x02, 0xa4, 0x03, 0x88, 0x04, 0x82, 0x03, 
-0x71, 0x04, 0xe5, 0x03, 0x35, 0x02, 0x6b, 0x02, 0x08, 0x00, 0xdc, 0xfe, 0xee, 0xfd, 0x08, 0xfb, 
-0xf8, 0xf9, 0x9f, 0xf8, 0x1d, 0xf6, 0x46, 0xf5, 0x0a, 0xf4, 0xe3, 0xf0, 0xfb, 0xf0, 0x5d, 0xf1, 
-0xed, 0xf0, 0x52, 0xf2, 0x47, 0xf4, 0xfa, 0xf6, 0xa5, 0xf9, 0xa3, 0xfc, 0x9d, 0x00, 0xff, 0x03, 
-0x14, 0x07, 0x4d, 0x0a, 0x01, 0x0c, 0x38, 0x0d, 0x1c, 0x0e, 0x44, 0x0d, 0x12, 0x0c, 0x10, 0x0b, 
-0x4f, 0x09, 0xae, 0x07, 0x44, 0x05, 0xa5, 0x03, 0x45, 0x03, 0x8e, 0x02, 0x55, 0x01, 0xa8, 0x01, 
-0x0e, 0x02, 0xf8, 0x01, 0x7f, 0x02, 0x4e, 0x02, 0x26, 0x03, 0x43, 0x03, 0x8c, 0x02, 0x85, 0x02, 
-0x9f, 0x01, 0x11, 0x01, 0xea, 0x00, 0xc4, 0xfe, 0xac, 0xfd, 0x65, 0xfd, 0x34, 0xfb, 0xbd, 0xf9, 
-0x86, 0xf8, 0x76, 0xf7, 0xe5, 0xf5, 0xc6, 0xf3, 0x3d, 0xf3, 0x16, 0xf3, 0x81, 0xf2, 0x1c, 0xf3, 
-0x4f, 0xf5, 0x95, 0xf6, 0x2c, 0xf8, 0xa0, 0xfb, 0xf7, 0xfd, 0x44, 0x00, 0xcf, 0x03, 0x9d, 0x05, 
-0x89, 0x07, 0x7f, 0x09, 0xa5, 0x09, 0xad, 0x09, 0x3f, 0x0a, 0xa4, 0x09, 0x55, 0x08, 0x9c, 0x07, 
-0xde, 0x05, 0x9b, 0x05, 0xec, 0x05, 0xe3, 0x03, 0xe2, 0x03, 0xa0, 0x03, 0xcc, 0x02, 0x8a, 0x03, 
-0x9d, 0x03, 0xf2, 0x01, 0x10, 0x02, 0xfe, 0x02, 0x7e, 0x01, 0x30, 0x01, 0x47, 0x02, 0xa8, 0x00, 
-0x6a, 0xff, 0x2a, 0x00, 0x62, 0xff, 0xb5, 0xfe, 0x45, 0xfd, 0xd9, 0xfb, 0xf2, 0xfb, 0xd7, 0xf9, 
-0x55, 0xf8, 0x4c, 0xf8, 0xb6, 0xf6, 0x56, 0xf5, 0xb9, 0xf4, 0x8c, 0xf5, 0x61, 0xf5, 0x0c, 0xf6, 
-0xa2, 0xf7, 0x97, 0xf8, 0x76, 0xfa, 0x8a, 0xfc, 0xa9, 0xfe, 0x93, 0x00, 0x64, 0x02, 0x46, 0x04, 
-0xa3, 0x05, 0xdb, 0x06, 0x78, 0x07, 0xec, 0x07, 0xde, 0x07, 0x9b, 0x07, 0xd4, 0x07, 0x00, 0x07, 
-0x6c, 0x06, 0x13, 0x06, 0xf3, 0x05, 0x1c, 0x05, 0x35, 0x04, 0x17, 0x04, 0x5a, 0x03, 0x2c, 0x03, 
-0x0f, 0x03, 0x19, 0x03, 0x91, 0x02, 0xe4, 0x01, 0xf9, 0x01, 0x5a, 0x01, 0x43, 0x01, 0x0f, 0x01, 
-0x2b, 0xff, 0x0b, 0xff, 0xfe, 0xfe, 0x16, 0xfe, 0x42, 0xfd, 0x7c, 0xfc, 0x75, 0xfb, 0x14, 0xfb, 
-0xf5, 0xfa, 0x74, 0xf9, 0x3a, 0xf9, 0x6b, 0xf8, 0x74, 0xf8, 0xb4, 0xf7, 0xdd, 0xf7, 0xe4, 0xf8, 
-0xa2, 0xf8, 0x67, 0xf9, 0x3c, 0xfa, 0xf9, 0xfb, 0x44, 0xfd, 0x32, 0xfe, 0xe2, 0xff, 0x45, 0x01, 
-0xd7, 0x02, 0x50, 0x04, 0x8b, 0x04, 0x63, 0x05, 0xbb, 0x06, 0xfc, 0x06, 0x9c, 0x06, 0x77, 0x06, 
-0x12, 0x07, 0xf5, 0x05, 0xf8, 0x05, 0xde, 0x05, 0x5f, 0x04, 0x26, 0x05, 0x23, 0x04, 0xc1, 0x02, 
-0xbe, 0x03, 0x57, 0x03, 0x14, 0x02, 0xff, 0x01, 0x85, 0x01, 0xc8, 0x00, 0x84, 0x00, 0xfa, 0xff, 
-0xd7, 0xfe, 0xb0, 0xfe, 0xdf, 0xfe, 0xfd, 0xfd, 0x8f, 0xfd, 0x4d, 0xfc, 0x32, 0xfc, 0xab, 0xfc, 
-0x83, 0xfb, 0xde, 0xfa, 0xd2, 0xfa, 0x39, 0xfb, 0x22, 0xfa, 0x17, 0xfa, 0x49, 0xfb, 0x84, 0xfa, 
-0xc2, 0xf9, 0xb6, 0xfa, 0x77, 0xfb, 0x5e, 0xfc, 0xa4, 0xfc, 0xc7, 0xfc, 0xb3, 0xfe, 0x0c, 0x00, 
-0x72, 0x00, 0xd6, 0x01, 0x03, 0x03, 0xdc, 0x03, 0xcc, 0x04, 0x50, 0x05, 0xbc, 0x05, 0xed, 0x05, 
-0x4c, 0x06, 0x0b, 0x06, 0x39, 0x05, 0x33, 0x05, 0x1a, 0x05, 0x8a, 0x04, 0x54, 0x04, 0xd2, 0x02, 
-0x8f, 0x02, 0x3c, 0x03, 0x01, 0x02, 0x67, 0x01, 0xef, 0x00, 0x09, 0x01, 0x8a, 0x00, 0x1e, 0xff, 
-0xa3, 0xff, 0x0b, 0xff, 0xf4, 0xfd, 0xf9, 0xfd, 0xe5, 0xfd, 0xc3, 0xfc, 0x28, 0xfd, 0x1c, 0xfc, 
-0xfb, 0xfb, 0x8a, 0xfc, 0x5d, 0xfc, 0x06, 0xfc, 0xeb, 0xfa, 0x1f, 0xfc, 0xd7, 0xfb, 0x26, 0xfc, 
-0x2e, 0xfc, 0x61, 0xfb, 0xf7, 0xfc, 0x48, 0xfd, 0x7a, 0xfd, 0x11, 0xfe, 0xee, 0xfe, 0x7c, 0xff, 
-0xbc, 0xff, 0x62, 0x01, 0x2e, 0x01, 0x4c, 0x02, 0x4a, 0x03, 0x75, 0x03, 0xfb, 0x03, 0x3e, 0x04, 
-0xcf, 0x04, 0xa8, 0x04, 0x4e, 0x04, 0x76, 0x04, 0x03, 0x05, 0x21, 0x04, 0x72, 0x03, 0x71, 0x03, 
-0xd0, 0x02, 0x70, 0x02, 0xf5, 0x01, 0x5f, 0x01, 0xf5, 0x00, 0xd1, 0x00, 0x7f, 0xff, 0xf5, 0xff, 
-0xe0, 0xff, 0x4a, 0xfe, 0x05, 0xfe, 0x61, 0xfe, 0x96, 0xfd, 0xcd, 0xfc, 0x22, 0xfd, 0x40, 0xfd, 
-0x42, 0xfc, 0x92, 0xfb, 0x78, 0xfc, 0xe9, 0xfb, 0xf5, 0xfb, 0xe5, 0xfc, 0xcf, 0xfb, 0xa9, 0xfc, 
-0x1d, 0xfe, 0x18, 0xfd, 0x31, 0xfe, 0xe6, 0xfe, 0x78, 0xfe, 0x54, 0xff, 0x9f, 0xff, 0x2c, 0x00, 
-0x66, 0x00, 0x7a, 0x00, 0x30, 0x01, 0xc5, 0x01, 0xfe, 0x01, 0xd4, 0x01, 0x97, 0x02, 0x54, 0x02, 
-0x08, 0x03, 0x21, 0x03, 0x38, 0x03, 0x7f, 0x03, 0xff, 0x02, 0xd8, 0x03, 0x4e, 0x03, 0xc1, 0x02, 
-0x4b, 0x02, 0x03, 0x02, 0x6a, 0x02, 0x46, 0x01, 0x00, 0x01, 0xb9, 0x00, 0x20, 0x00, 0x05, 0x00, 
-0xc8, 0xff, 0x78, 0xff, 0x8c, 0xfe, 0x85, 0xfe, 0xb1, 0xfe, 0xc8, 0xfd, 0xe3, 0xfd, 0x3d, 0xfd, 
-0x5c, 0xfd, 0xda, 0xfc, 0x34, 0xfc, 0xfa, 0xfd, 0xa4, 0xfb, 0x31, 0xfc, 0x2c, 0xfe, 0x87, 0xfc, 
-0x6b, 0xfd, 0xf1, 0xfe, 0x06, 0xfe, 0x16, 0xfe, 0xcb, 0xff, 0xe6, 0xff, 0xaa, 0xff, 0x13, 0x00, 
-0xc1, 0x00, 0x9a, 0x00, 0x81, 0x01, 0x6c, 0x01, 0xb8, 0x00, 0x27, 0x02, 0xc2, 0x01, 0xbd, 0x01, 
-0x23, 0x02, 0x23, 0x01, 0xee, 0x01, 0xc2, 0x03, 0xbc, 0x01, 0xed, 0x01, 0xff, 0x02, 0x87, 0x01, 
-0x27, 0x02, 0x3e, 0x01, 0x6c, 0x01, 0x31, 0x01, 0x40, 0x00, 0x59, 0x01, 0x75, 0xff, 0x4c, 0xff, 
-0x07, 0x00, 0xc8, 0xfe, 0x52, 0xfe, 0x2b, 0xfe, 0xf4, 0xfe, 0x95, 0xfe, 0x98, 0xfd, 0xf2, 0xfd, 
-0x35, 0xfe, 0x92, 0xfd, 0x40, 0xfe, 0x20, 0xfe, 0x5f, 0xfd, 0xad, 0xfe, 0x7d, 0xfe, 0x29, 0xfe, 
-0x14, 0xff, 0x7c, 0xfe, 0x9f, 0xfe, 0x68, 0xff, 0x0c, 0x00, 0x21, 0x00, 0xd9, 0xfe, 0xc6, 0x00, 
-0x25, 0x01, 0xd6, 0xff, 0x4a, 0x01, 0x56, 0x01, 0xd2, 0x00, 0x6b, 0x01, 0x93, 0x01, 0x14, 0x02, 
-0x71, 0x02, 0x8c, 0x01, 0x00, 0x02, 0xc2, 0x01, 0x5e, 0x01, 0x65, 0x02, 0x8d, 0x01, 0x6e, 0x00, 
-0x67, 0x01, 0x84, 0x01, 0x54, 0x00, 0x70, 0xff, 0xb3, 0xff, 0x12, 0x01, 0x42, 0xff, 0x8b, 0xfe, 
-0x36, 0xff, 0xaf, 0xff, 0x96, 0xff, 0x3f, 0xfd, 0x53, 0xfe, 0x16, 0x00, 0x5a, 0xfe, 0x7b, 0xfe, 
-0x0c, 0x00, 0x5a, 0xfe, 0xf2, 0xfe, 0xb8, 0xff, 0x60, 0xfe, 0x27, 0xff, 0xf4, 0xfe, 0x83, 0xfe, 
-0xf5, 0xfe, 0xb3, 0xfe, 0xf4, 0xfe, 0x32, 0xff, 0x6d, 0x00, 0x06, 0xff, 0x68, 0xfe, 0x9e, 0x01, 
-0x9b, 0x01, 0xf6, 0xff, 0x16, 0x00, 0x9e, 0x00, 0x03, 0x01, 0x31, 0x01, 0x7f, 0x00, 0x2a, 0x01, 
-0x88, 0x01, 0xab, 0x01, 0xe8, 0x01, 0xe7, 0x00, 0x0a, 0x01, 0x92, 0x02, 0x75, 0x02, 0x7f, 0x00, 
-0xfb, 0x01, 0x71, 0x01, 0xab, 0xff, 0x63, 0x01, 0x62, 0x00, 0x59, 0xff, 0x72, 0x00, 0xe8, 0xfe, 
-0xfa, 0xfe, 0x3d, 0x00, 0xb4, 0xfd, 0x6a, 0xff, 0x01, 0x01, 0x77, 0xfd, 0x3d, 0xfe, 0x03, 0x00, 
-0x8d, 0xfe, 0xdb, 0xfd, 0x5a, 0xfe, 0xd7, 0xff, 0x96, 0xfe, 0xe4, 0xfd, 0x2e, 0xfe, 0x60, 0xff, 
-0x98, 0x00, 0xbe, 0xfd, 0x66, 0xfe, 0x7a, 0xff, 0x99, 0xff, 0x21, 0x00, 0x3a, 0xfe, 0x2b, 0xff, 
-0x5c, 0x01, 0x9c, 0xff, 0x2c, 0xff, 0x53, 0x01, 0x48, 0x01, 0x92, 0x01, 0x96, 0x01, 0x92, 0x02, 
-0x18, 0x03, 0x8f, 0x01, 0xf4, 0x02, 0xa0, 0x03, 0xca, 0x02, 0x92, 0x03, 0x8e, 0x02, 0x78, 0x01, 
-0xf8, 0x01, 0x97, 0x01, 0x3f, 0x01, 0x70, 0xff, 0xf4, 0xfe, 0xc2, 0x01, 0x22, 0x01, 0xff, 0xfe, 
-0xe4, 0xff, 0xe3, 0xff, 0xb4, 0x00, 0x21, 0x00, 0x5d, 0xfe, 0x77, 0xff, 0x8b, 0xff, 0xa8, 0xfd, 
-0xea, 0xfc, 0x30, 0xff, 0xd0, 0xfd, 0x09, 0xfc, 0x86, 0xfb, 0xde, 0xfc, 0x77, 0xfe, 0x6f, 0xf9, 
-0x85, 0xfa, 0x3b, 0xfe, 0xbf, 0xfb, 0x81, 0xfa, 0x6e, 0xfc, 0xdf, 0xfd, 0x33, 0xfd, 0x54, 0xff, 
-0xe2, 0x00, 0xe3, 0xff, 0xf7, 0x01, 0x8a, 0x03, 0x41, 0x04, 0x84, 0x04, 0x21, 0x05, 0xd0, 0x06, 
-0xe6, 0x06, 0xfa, 0x06, 0xc0, 0x07, 0xa8, 0x06, 0x6d, 0x06, 0x53, 0x06, 0x1c, 0x04, 0xeb, 0x04, 
-0x6e, 0x04, 0x9e, 0x01, 0x13, 0x02, 0x79, 0x01, 0x72, 0xfe, 0xe6, 0xff, 0x22, 0x00, 0x4a, 0xfd, 
-0x6e, 0xfd, 0x4c, 0xfd, 0x12, 0xfd, 0x7a, 0xfb, 0x62, 0xfc, 0xa6, 0xfb, 0xd9, 0xf9, 0xd1, 0xfa, 
-0x41, 0xf8, 0xa9, 0xf8, 0xbf, 0xf8, 0xbb, 0xf6, 0xd1, 0xf6, 0x5a, 0xf6, 0xbd, 0xf7, 0x27, 0xf8, 
-0x15, 0xf9, 0x4e, 0xfc, 0xeb, 0xfe, 0x0f, 0x00, 0xab, 0x00, 0xc3, 0x06, 0x30, 0x08, 0x2a, 0x06, 
-0x79, 0x09, 0x52, 0x0b, 0xd1, 0x0a, 0x8a, 0x08, 0x17, 0x0a, 0x2b, 0x09, 0x4e, 0x06, 0x61, 0x07, 
-0x8e, 0x05, 0xd4, 0x05, 0xb0, 0x03, 0xf5, 0x02, 0xf7, 0x03, 0xd5, 0x02, 0x22, 0x03, 0xe2, 0x00, 
-0x76, 0x01, 0x23, 0x02, 0xc1, 0x00, 0xcd, 0xfe, 0x91, 0xfe, 0x6e, 0x00, 0x73, 0xfd, 0xa2, 0xfb, 
-0xa1, 0xfc, 0x61, 0xfb, 0xe5, 0xf8, 0x3b, 0xf8, 0xae, 0xf9, 0xa3, 0xf5, 0xf4, 0xf1, 0x5f, 0xf5, 
-0x5a, 0xf3, 0x1f, 0xf0, 0xfb, 0xf1, 0x50, 0xf4, 0xc8, 0xf5, 0x2e, 0xf7, 0x35, 0xfb, 0x26, 0xff, 
-0x4a, 0x01, 0x51, 0x04, 0xb7, 0x07, 0xeb, 0x09, 0x16, 0x0c, 0x86, 0x0d, 0x2f, 0x0d, 0x69, 0x0d, 
-0xe8, 0x0c, 0x60, 0x0a, 0x9a, 0x08, 0x8e, 0x08, 0xa6, 0x06, 0x1c, 0x04, 0x17, 0x04, 0x41, 0x04, 
-0xd5, 0x03, 0x6d, 0x01, 0x4f, 0x03, 0x1b, 0x06, 0xa2, 0x03, 0x70, 0x02, 0xac, 0x04, 0xa7, 0x04, 
-0xed, 0x00, 0x76, 0x00, 0xd9, 0x01, 0xa9, 0xff, 0xb0, 0xfa, 0xc0, 0xfa, 0x55, 0xfb, 0xcd, 0xf6, 
-0xfb, 0xf3, 0x65, 0xf4, 0xe9, 0xf1, 0x92, 0xee, 0x83, 0xed, 0xb9, 0xeb, 0x33, 0xed, 0x4d, 0xed, 
-0xf2, 0xef, 0x35, 0xf5, 0x48, 0xf7, 0xe1, 0xfd, 0x86, 0x02, 0x0d, 0x05, 0xa7, 0x0b, 0x4d, 0x0e, 
-0xe6, 0x0f, 0x15, 0x13, 0x4d, 0x12, 0xe1, 0x10, 0xbd, 0x0f, 0xd7, 0x0c, 0x99, 0x0a, 0x04, 0x07, 
-0x96, 0x04, 0x7b, 0x03, 0xf7, 0x00, 0x12, 0x01, 0x63, 0x01, 0x58, 0x01, 0xe7, 0x02, 0x18, 0x04, 
-0xe2, 0x05, 0x1d, 0x06, 0xd9, 0x05, 0x1e, 0x08, 0xf4, 0x05, 0x04, 0x03, 0xdc, 0x02, 0x27, 0x01, 
-0xec, 0xfd, 0x1b, 0xfb, 0x90, 0xf9, 0xe0, 0xf6, 0x21, 0xf4, 0x09, 0xf1, 0x56, 0xf0, 0x8a, 0xee, 
-0xf4, 0xea, 0xc6, 0xe8, 0xfc, 0xe8, 0x73, 0xe9, 0x28, 0xeb, 0xc7, 0xf1, 0x88, 0xf4, 0x00, 0xf9, 
-0x6c, 0x02, 0x8f, 0x06, 0xeb, 0x09, 0x14, 0x12, 0xe6, 0x14, 0x37, 0x14, 0x7c, 0x16, 0xe6, 0x15, 
-0x4a, 0x11, 0x32, 0x0d, 0xf1, 0x0b, 0x6b, 0x07, 0x99, 0x01, 0xac, 0x00, 0xe1, 0xfe, 0x4a, 0xfd, 
-0xdb, 0xfe, 0x0c, 0x00, 0x54, 0x01, 0x7a, 0x04, 0xa8, 0x06, 0x51, 0x08, 0xab, 0x09, 0x91, 0x09, 
-0xc0, 0x0a, 0x2c, 0x08, 0xfb, 0x05, 0x72, 0x04, 0x6a, 0x00, 0x38, 0xfe, 0xa1, 0xfa, 0x99, 0xf7, 
-0x45, 0xf5, 0xb8, 0xf1, 0x87, 0xee, 0xc8, 0xed, 0x0c, 0xeb, 0x37, 0xe6, 0x4c, 0xe6, 0x4f, 0xe7, 
-0xbc, 0xe5, 0x36, 0xeb, 0xe9, 0xf1, 0x6c, 0xf3, 0xf0, 0xfb, 0xbe, 0x04, 0xd2, 0x07, 0xee, 0x0e, 
-0x83, 0x16, 0xeb, 0x16, 0x64, 0x18, 0xd5, 0x19, 0x30, 0x16, 0xbf, 0x11, 0x6c, 0x0e, 0x50, 0x0a, 
-0xc6, 0x03, 0x97, 0x01, 0xe5, 0xff, 0x1b, 0xfb, 0xa1, 0xfc, 0xfc, 0xff, 0xd8, 0xfd, 0xd4, 0x03, 
-0xd9, 0x06, 0x57, 0x06, 0x11, 0x0c, 0xb8, 0x0a, 0x7e, 0x0b, 0x9d, 0x0b, 0x07, 0x07, 0x41, 0x06, 
-0xf3, 0x01, 0xd4, 0xfd, 0x25, 0xfc, 0xeb, 0xf6, 0x1a, 0xf5, 0xd5, 0xf2, 0x45, 0xef, 0xc5, 0xee, 
-0x72, 0xeb, 0xdf, 0xea, 0x05, 0xe7, 0x57, 0xe6, 0x28, 0xea, 0x3c, 0xe8, 0x37, 0xef, 0x26, 0xf5, 
-0x4a, 0xf6, 0x4d, 0x00, 0x82, 0x06, 0xa2, 0x08, 0xf1, 0x10, 0x2b, 0x14, 0x03, 0x15, 0xfc, 0x16, 
-0x91, 0x15, 0x26, 0x13, 0xad, 0x0e, 0x9a, 0x0b, 0x13, 0x07, 0xea, 0x01, 0x3e, 0x01, 0x08, 0xfd, 
-0x3c, 0xfc, 0x18, 0xfe, 0xed, 0xfd, 0x1d, 0x00, 0xe4, 0x03, 0x27, 0x05, 0xe3, 0x07, 0x05, 0x0b, 
-0x12, 0x0a, 0xa6, 0x0b, 0x0f, 0x0a, 0x9c, 0x07, 0xac, 0x05, 0x44, 0x02, 0x98, 0xfe, 0xfe, 0xfb, 
-0x8e, 0xf9, 0x71, 0xf5, 0xf5, 0xf4, 0x2c, 0xf2, 0x0c, 0xf0, 0x42, 0xee, 0x5a, 0xec, 0x36, 0xe8, 
-0x14, 0xe7, 0x5c, 0xea, 0x45, 0xe8, 0x36, 0xef, 0x7a, 0xf4, 0xdf, 0xf5, 0xce, 0xff, 0xcb, 0x05, 
-0xcf, 0x07, 0xf3, 0x10, 0xba, 0x13, 0xb1, 0x13, 0xdb, 0x17, 0x17, 0x15, 0x6d, 0x12, 0xfd, 0x0e, 
-0x05, 0x0b, 0xa0, 0x06, 0x4b, 0x01, 0x6a, 0x00, 0x40, 0xfc, 0x0d, 0xfb, 0xdf, 0xfd, 0xd6, 0xfc, 
-0x64, 0x00, 0x86, 0x04, 0xfa, 0x04, 0x36, 0x09, 0xa3, 0x0b, 0x3b, 0x0b, 0x03, 0x0d, 0x86, 0x0a, 
-0x7b, 0x09, 0x82, 0x07, 0x98, 0x02, 0x02, 0x01, 0xbe, 0xfc, 0x21, 0xfa, 0x58, 0xf7, 0x1d, 0xf4, 
-0x64, 0xf3, 0x5a, 0xef, 0x8c, 0xed, 0xb9, 0xec, 0xf9, 0xe6, 0x07, 0xe6, 0x0f, 0xe8, 0x99, 0xe5, 
-0xda, 0xec, 0x0b, 0xf2, 0x78, 0xf3, 0xde, 0xfe, 0x3c, 0x04, 0xd1, 0x07, 0x36, 0x11, 0x0e, 0x14, 
-0x7c, 0x15, 0x89, 0x18, 0xc6, 0x16, 0xda, 0x13, 0xdc, 0x0f, 0x47, 0x0c, 0x1c, 0x06, 0xe2, 0x01, 
-0x58, 0x00, 0x77, 0xfa, 0x9e, 0xfa, 0x30, 0xfc, 0x7d, 0xfb, 0xcc, 0xff, 0xe1, 0x02, 0x99, 0x05, 
-0x4e, 0x09, 0x08, 0x0b, 0x0d, 0x0d, 0xbf, 0x0c, 0x8f, 0x0c, 0x2e, 0x0a, 0x85, 0x06, 0xf4, 0x05, 
-0x02, 0x00, 0x94, 0xfd, 0x63, 0xfb, 0xde, 0xf6, 0x20, 0xf6, 0x3b, 0xf3, 0x5f, 0xf1, 0x7d, 0xef, 
-0x1f, 0xee, 0x9a, 0xeb, 0xcc, 0xe7, 0xcd, 0xe9, 0x93, 0xe8, 0x6d, 0xe9, 0xc6, 0xf0, 0x8c, 0xf1, 
-0xc4, 0xf7, 0x5d, 0xff, 0x7e, 0x02, 0x6d, 0x0a, 0xd9, 0x0e, 0xdf, 0x11, 0xca, 0x15, 0x19, 0x15, 
-0x01, 0x15, 0x71, 0x12, 0x65, 0x0e, 0x40, 0x0b, 0x40, 0x06, 0x8d, 0x03, 0xd2, 0xff, 0x2a, 0xfd, 
-0x7c, 0xfd, 0x8a, 0xfc, 0x34, 0xfe, 0xa9, 0x01, 0x13, 0x03, 0xca, 0x06, 0xb8, 0x09, 0x90, 0x0b, 
-0x5c, 0x0d, 0x73, 0x0d, 0xd4, 0x0c, 0xf0, 0x09, 0x99, 0x07, 0x2b, 0x04, 0xda, 0x00, 0x78, 0xfc, 
-0x4f, 0xfa, 0x5c, 0xf7, 0xdd, 0xf3, 0xab, 0xf3, 0x8f, 0xf0, 0xf0, 0xee, 0x21, 0xed, 0x6d, 0xeb, 
-0x1c, 0xe7, 0x92, 0xe7, 0xa0, 0xe8, 0x8c, 0xe9, 0x57, 0xf0, 0xe4, 0xf2, 0x67, 0xf8, 0xa1, 0x00, 
-0x95, 0x03, 0x8e, 0x0a, 0xc6, 0x10, 0xfa, 0x10, 0x89, 0x15, 0x62, 0x15, 0xa4, 0x12, 0x92, 0x11, 
-0x61, 0x0d, 0x4b, 0x09, 0x46, 0x05, 0xd1, 0x02, 0xdb, 0xfe, 0x3e, 0xfd, 0x72, 0xfd, 0x67, 0xfc, 
-0x1f, 0xff, 0x3d, 0x01, 0x49, 0x03, 0xc0, 0x06, 0xa6, 0x08, 0x14, 0x0b, 0x3e, 0x0c, 0xd7, 0x0b, 
-0x22, 0x0c, 0x4d, 0x09, 0x08, 0x07, 0x10, 0x04, 0x55, 0x00, 0x90, 0xfd, 0x1d, 0xfa, 0x2d, 0xf8, 
-0x91, 0xf5, 0x7d, 0xf4, 0x2d, 0xf2, 0xd9, 0xf0, 0xe2, 0xee, 0x78, 0xec, 0x4d, 0xea, 0x7f, 0xe6, 
-0x7d, 0xea, 0x01, 0xe8, 0xfb, 0xed, 0xc3, 0xf4, 0xad, 0xf3, 0x80, 0x00, 0x25, 0x03, 0x6a, 0x07, 
-0xb5, 0x10, 0xf1, 0x10, 0xb5, 0x14, 0xf5, 0x15, 0x6f, 0x14, 0x02, 0x12, 0x74, 0x0f, 0x03, 0x0b, 
-0xe9, 0x05, 0x3b, 0x04, 0x50, 0xff, 0xa5, 0xfd, 0x0b, 0xfd, 0xdf, 0xfb, 0x11, 0xfe, 0xd5, 0xff, 
-0xf6, 0x02, 0x5d, 0x05, 0x4c, 0x09, 0xcd, 0x0a, 0xde, 0x0b, 0xa2, 0x0e, 0x58, 0x0b, 0x28, 0x0b, 
-0xb9, 0x09, 0xce, 0x03, 0x61, 0x03, 0x32, 0xff, 0xaf, 0xfa, 0x09, 0xfb, 0xc6, 0xf6, 0x6f, 0xf5, 
-0x30, 0xf5, 0x8d, 0xf1, 0xad, 0xf0, 0xcf, 0xee, 0xfa, 0xeb, 0x16, 0xeb, 0x94, 0xe7, 0x06, 0xe9, 
-0xbe, 0xe9, 0x91, 0xeb, 0xc9, 0xf2, 0xfa, 0xf4, 0xa2, 0xfc, 0xc9, 0x02, 0x89, 0x07, 0x94, 0x0e, 
-0xfc, 0x11, 0x68, 0x15, 0x94, 0x16, 0x1c, 0x16, 0x03, 0x14, 0x6e, 0x11, 0x31, 0x0d, 0xec, 0x08, 
-0x5b, 0x05, 0x4b, 0x01, 0xd9, 0xfe, 0x8f, 0xfc, 0xb9, 0xfc, 0x6d, 0xfc, 0x27, 0xff, 0x1f, 0x02, 
-0xf3, 0x03, 0x9b, 0x08, 0x49, 0x09, 0x21, 0x0c, 0x01, 0x0d, 0xf7, 0x0a, 0x94, 0x0b, 0xaf, 0x07, 
-0x76, 0x04, 0x32, 0x02, 0x89, 0xfd, 0x96, 0xfa, 0x0b, 0xf8, 0x56, 0xf5, 0x05, 0xf3, 0xde, 0xf1, 
-0x2f, 0xf0, 0xe9, 0xee, 0x0c, 0xed, 0x5e, 0xec, 0x46, 0xeb, 0x79, 0xe6, 0x92, 0xea, 0xf7, 0xea, 
-0x80, 0xeb, 0x54, 0xf5, 0xb5, 0xf5, 0x10, 0xfc, 0x95, 0x04, 0xd8, 0x06, 0x12, 0x0e, 0xf7, 0x12, 
-0x05, 0x15, 0xe6, 0x16, 0xcd, 0x17, 0x50, 0x15, 0xec, 0x12, 0x40, 0x10, 0xbd, 0x0a, 0xf1, 0x07, 
-0x5d, 0x03, 0xa2, 0xff, 0x9f, 0xfe, 0xe6, 0xfb, 0x8a, 0xfd, 0x6a, 0xfe, 0x20, 0x00, 0xfe, 0x04, 
-0x74, 0x05, 0x7f, 0x09, 0xf3, 0x0b, 0x10, 0x0a, 0x92, 0x0c, 0xac, 0x09, 0x87, 0x06, 0xdf, 0x05, 
-0x44, 0x01, 0xd1, 0xfd, 0x51, 0xfc, 0x52, 0xf8, 0x9d, 0xf5, 0xf3, 0xf5, 0x40, 0xf2, 0x0c, 0xf2, 
-0xc1, 0xf0, 0x33, 0xef, 0x63, 0xed, 0x89, 0xeb, 0x06, 0xea, 0xea, 0xe6, 0xd2, 0xea, 0xc7, 0xe9, 
-0x67, 0xee, 0xfb, 0xf3, 0x22, 0xf6, 0xa6, 0xff, 0xe7, 0x02, 0x54, 0x09, 0x96, 0x10, 0x85, 0x11, 
-0x66, 0x17, 0x82, 0x17, 0xb3, 0x16, 0xff, 0x16, 0xfc, 0x11, 0x73, 0x0f, 0xc9, 0x0a, 0x0f, 0x06, 
-0x45, 0x03, 0x04, 0xff, 0x40, 0xfd, 0xa2, 0xfc, 0x63, 0xfc, 0x3c, 0xfe, 0x5b, 0x01, 0x1d, 0x03, 
-0x30, 0x06, 0xf6, 0x09, 0x2a, 0x09, 0xe7, 0x0b, 0x7b, 0x0b, 0x1d, 0x08, 0x94, 0x08, 0xb2, 0x04, 
-0x4d, 0x01, 0xb1, 0xff, 0xa6, 0xfa, 0x55, 0xf9, 0x7a, 0xf6, 0x54, 0xf4, 0xbe, 0xf4, 0x7d, 0xf1, 
-0x82, 0xf1, 0x7d, 0xf0, 0xd4, 0xed, 0x4f, 0xed, 0xf8, 0xec, 0x8c, 0xe7, 0xf6, 0xeb, 0xc6, 0xeb, 
-0xb9, 0xeb, 0xad, 0xf5, 0x41, 0xf4, 0x47, 0xfd, 0xf8, 0x03, 0x62, 0x06, 0x5d, 0x10, 0x18, 0x12, 
-0x1a, 0x16, 0x54, 0x19, 0xb8, 0x17, 0xce, 0x17, 0x43, 0x14, 0x8e, 0x10, 0xd8, 0x0b, 0xe6, 0x07, 
-0x4f, 0x03, 0x77, 0xff, 0x9b, 0xfe, 0x6c, 0xfb, 0x38, 0xfd, 0x47, 0xfe, 0xba, 0xff, 0xb5, 0x03, 
-0xe3, 0x04, 0xe6, 0x08, 0xb9, 0x08, 0x43, 0x0a, 0xd6, 0x0a, 0x0a, 0x07, 0x4b, 0x08, 0x7e, 0x03, 
-0x42, 0x01, 0x58, 0xff, 0x33, 0xfa, 0xbc, 0xf9, 0xe6, 0xf5, 0xb1, 0xf4, 0xbb, 0xf3, 0x76, 0xf1, 
-0xde, 0xf1, 0x1d, 0xef, 0xfc, 0xee, 0x77, 0xec, 0x02, 0xec, 0xbd, 0xe9, 0x56, 0xe8, 0x1e, 0xed, 
-0xb2, 0xea, 0x0a, 0xf4, 0x71, 0xf6, 0xc5, 0xfa, 0xeb, 0x05, 0xa3, 0x06, 0x8c, 0x10, 0x3c, 0x14, 
-0xe3, 0x15, 0xd4, 0x1a, 0xb6, 0x17, 0xf3, 0x17, 0x97, 0x14, 0xe4, 0x0f, 0xc2, 0x0c, 0x6b, 0x06, 
-0x05, 0x04, 0x0a, 0xff, 0x25, 0xfd, 0x8a, 0xfc, 0x77, 0xfb, 0x8a, 0xfd, 0x53, 0xff, 0xb6, 0x01, 
-0x25, 0x04, 0x1c, 0x08, 0xef, 0x07, 0x56, 0x09, 0x39, 0x0a, 0x68, 0x06, 0x4d, 0x07, 0xc6, 0x03, 
-0xbe, 0x00, 0xc6, 0xff, 0x26, 0xfb, 0x1b, 0xfa, 0x78, 0xf7, 0x8a, 0xf5, 0x87, 0xf5, 0x37, 0xf3, 
-0x7d, 0xf3, 0x6f, 0xf2, 0xeb, 0xf0, 0x2a, 0xf0, 0x5d, 0xee, 0x36, 0xed, 0x25, 0xea, 0x36, 0xed, 
-0x14, 0xec, 0x26, 0xef, 0x6b, 0xf6, 0xf6, 0xf6, 0x02, 0x01, 0xce, 0x05, 0x0c, 0x0b, 0x86, 0x12, 
-0x24, 0x14, 0x3c, 0x18, 0x5c, 0x18, 0xc5, 0x17, 0x1f, 0x16, 0xbb, 0x11, 0xbd, 0x0d, 0x01, 0x09, 
-0xc1, 0x03, 0xa2, 0x00, 0xd3, 0xfd, 0xdc, 0xfb, 0x18, 0xfc, 0x52, 0xfd, 0x63, 0xfe, 0x25, 0x01, 
-0xae, 0x04, 0x1a, 0x05, 0xf9, 0x07, 0x5d, 0x08, 0x4c, 0x07, 0x21, 0x08, 0x70, 0x06, 0x52, 0x04, 
-0xa8, 0x03, 0x5b, 0x01, 0x7f, 0xfe, 0x87, 0xfe, 0xa8, 0xfa, 0x1d, 0xf9, 0x4b, 0xf8, 0x83, 0xf3, 
-0x58, 0xf4, 0x62, 0xf1, 0xbb, 0xee, 0x3e, 0xef, 0x60, 0xeb, 0x62, 0xea, 0xe0, 0xea, 0xcf, 0xe6, 
-0x94, 0xea, 0x47, 0xed, 0x6f, 0xee, 0xa8, 0xf9, 0xe0, 0xfc, 0x50, 0x04, 0xb4, 0x0d, 0xb6, 0x0e, 
-0x4e, 0x15, 0x58, 0x17, 0xb9, 0x15, 0x7d, 0x17, 0x46, 0x14, 0xca, 0x11, 0xec, 0x0f, 0x51, 0x0c, 
-0x44, 0x0a, 0x20, 0x07, 0xfe, 0x04, 0x90, 0x02, 0x6d, 0x00, 0x97, 0xff, 0xd6, 0xfe, 0x9b, 0xfe, 
-0x16, 0xff, 0xd4, 0xff, 0x3c, 0x00, 0x16, 0x02, 0x57, 0x03, 0x8f, 0x04, 0x54, 0x05, 0x5d, 0x05, 
-0x78, 0x05, 0xcf, 0x04, 0xc4, 0x03, 0x1a, 0x02, 0x99, 0xff, 0xdf, 0xfc, 0x99, 0xf9, 0x6a, 0xf7, 
-0x3e, 0xf4, 0x9c, 0xf2, 0x03, 0xf1, 0x15, 0xee, 0x4b, 0xef, 0x89, 0xec, 0xe1, 0xeb, 0x87, 0xee, 
-0xee, 0xe9, 0x29, 0xec, 0x5a, 0xf1, 0x76, 0xed, 0x66, 0xf9, 0x9b, 0xfd, 0x9a, 0xfe, 0x4f, 0x0d, 
-0xb5, 0x0a, 0xa3, 0x10, 0x19, 0x17, 0x67, 0x12, 0x38, 0x17, 0xd4, 0x15, 0xe9, 0x11, 0xe3, 0x12, 
-0x0b, 0x0f, 0x88, 0x0b, 0x9a, 0x0a, 0x91, 0x06, 0x0d, 0x03, 0x1e, 0x02, 0x04, 0xff, 0x4d, 0xfd, 
-0x8c, 0xfe, 0xf4, 0xfc, 0xcc, 0xfd, 0xce, 0xff, 0x41, 0xff, 0xc4, 0x01, 0x41, 0x03, 0xd5, 0x02, 
-0xbf, 0x04, 0x60, 0x05, 0xd0, 0x03, 0x77, 0x05, 0xb9, 0x02, 0x2b, 0x00, 0xdc, 0xff, 0x61, 0xfa, 
-0x30, 0xf9, 0xea, 0xf6, 0xf7, 0xf1, 0xeb, 0xf1, 0xc4, 0xee, 0x24, 0xed, 0xda, 0xed, 0xcd, 0xea, 
-0xaa, 0xec, 0x41, 0xec, 0xd4, 0xe9, 0x51, 0xf0, 0x6f, 0xf0, 0x0c, 0xf5, 0xff, 0xfe, 0xb7, 0xff, 
-0x40, 0x09, 0x02, 0x0e, 0x0e, 0x10, 0xec, 0x15, 0xb6, 0x15, 0x93, 0x16, 0xcf, 0x15, 0xdd, 0x13, 
-0xe6, 0x11, 0x6f, 0x0f, 0x9e, 0x0d, 0x99, 0x09, 0xcd, 0x07, 0x89, 0x04, 0x68, 0x00, 0x0d, 0x00, 
-0x94, 0xfc, 0x7b, 0xfc, 0x42, 0xfc, 0xe1, 0xfb, 0x70, 0xfd, 0x6b, 0xfe, 0xb4, 0x00, 0x74, 0x01, 
-0xe2, 0x03, 0x4b, 0x03, 0x5a, 0x04, 0x61, 0x04, 0xb9, 0x02, 0x7c, 0x03, 0x1e, 0x00, 0x30, 0xff, 
-0xf7, 0xfc, 0x54, 0xf9, 0x4b, 0xf9, 0xb7, 0xf5, 0xbc, 0xf3, 0xe7, 0xf3, 0x71, 0xef, 0xd2, 0xef, 
-0xa2, 0xee, 0x1d, 0xec, 0x12, 0xef, 0x8e, 0xec, 0x61, 0xed, 0x16, 0xf2, 0xdb, 0xf0, 0xd8, 0xf8, 
-0x0b, 0xfe, 0xe4, 0xff, 0x4a, 0x0a, 0x00, 0x0a, 0x91, 0x0e, 0x7f, 0x13, 0x31, 0x11, 0x54, 0x15, 
-0xf3, 0x13, 0x1a, 0x12, 0x24, 0x12, 0x11, 0x0f, 0x1e, 0x0d, 0xbe, 0x0a, 0x98, 0x07, 0xf0, 0x04, 
-0x63, 0x01, 0xd7, 0xff, 0x0c, 0xfe, 0xc6, 0xfc, 0x82, 0xfd, 0x72, 0xfc, 0x69, 0xfe, 0xff, 0xfe, 
-0x0d, 0x00, 0xfb, 0x02, 0xbb, 0x02, 0xbc, 0x04, 0xe2, 0x05, 0xae, 0x04, 0xbd, 0x05, 0x1f, 0x04, 
-0x46, 0x02, 0x2d, 0x01, 0xa3, 0xfd, 0xfe, 0xfb, 0xd9, 0xf8, 0xed, 0xf5, 0x80, 0xf4, 0xab, 0xf1, 
-0xa5, 0xf0, 0x32, 0xef, 0xae, 0xee, 0x94, 0xed, 0x19, 0xed, 0x9e, 0xee, 0xdb, 0xeb, 0x1f, 0xf0, 
-0x47, 0xf2, 0xd4, 0xf3, 0x2b, 0xfd, 0xb2, 0xfe, 0x4f, 0x06, 0x55, 0x0b, 0x28, 0x0d, 0x3a, 0x13, 
-0xe2, 0x11, 0xc8, 0x14, 0x0d, 0x14, 0x36, 0x12, 0x95, 0x12, 0x8c, 0x0e, 0xc8, 0x0d, 0x37, 0x0a, 
-0xda, 0x06, 0x7b, 0x04, 0x41, 0x00, 0x46, 0xff, 0xcc, 0xfc, 0x4b, 0xfc, 0x2b, 0xfc, 0x03, 0xfc, 
-0x55, 0xfd, 0xcd, 0xfd, 0x96, 0x00, 0x09, 0x01, 0x02, 0x03, 0xd2, 0x04, 0x18, 0x04, 0xdf, 0x05, 
-0x58, 0x05, 0x01, 0x04, 0xb1, 0x03, 0x8f, 0x00, 0xfb, 0xfe, 0x83, 0xfc, 0xc9, 0xf9, 0x26, 0xf9, 
-0x56, 0xf6, 0x9b, 0xf5, 0xf4, 0xf3, 0xd9, 0xf1, 0x3b, 0xf1, 0x77, 0xef, 0x00, 0xef, 0x70, 0xef, 
-0xdc, 0xed, 0xc7, 0xef, 0xd8, 0xf1, 0x20, 0xf3, 0xc7, 0xfa, 0x6e, 0xfd, 0xd3, 0x02, 0x9b, 0x09, 
-0x11, 0x0a, 0xbc, 0x0f, 0x97, 0x11, 0x8c, 0x11, 0xbe, 0x13, 0xb6, 0x11, 0xd1, 0x10, 0x6b, 0x0f, 
-0xa5, 0x0d, 0xab, 0x0b, 0xb0, 0x08, 0xca, 0x06, 0xa8, 0x02, 0x3a, 0x00, 0xc1, 0xfe, 0x43, 0xfc, 
-0x0b, 0xfc, 0x43, 0xfc, 0xc7, 0xfb, 0xd0, 0xfd, 0x39, 0xff, 0xf0, 0xff, 0xe7, 0x02, 0x2b, 0x03, 
-0x83, 0x04, 0xde, 0x05, 0x2d, 0x05, 0x7c, 0x05, 0x19, 0x04, 0x26, 0x02, 0xb7, 0x00, 0x14, 0xfe, 
-0x54, 0xfb, 0x8e, 0xf9, 0x41, 0xf6, 0xe4, 0xf4, 0xc9, 0xf3, 0xb2, 0xf1, 0x27, 0xf2, 0xfc, 0xef, 
-0x91, 0xef, 0x1c, 0xf0, 0xe5, 0xed, 0x8c, 0xef, 0xbf, 0xf0, 0x98, 0xf1, 0x1a, 0xf7, 0x0a, 0xfb, 
-0x53, 0x00, 0x9e, 0x06, 0xba, 0x09, 0x48, 0x0e, 0xcf, 0x10, 0xc5, 0x11, 0x62, 0x13, 0x41, 0x12, 
-0x87, 0x11, 0x23, 0x10, 0x77, 0x0e, 0x64, 0x0c, 0xe4, 0x09, 0x65, 0x07, 0x21, 0x03, 0xf5, 0x01, 
-0x5f, 0xfe, 0x7e, 0xfd, 0xa5, 0xfd, 0xac, 0xfb, 0x69, 0xfd, 0x7b, 0xfd, 0xfd, 0xfd, 0x1d, 0x00, 
-0x71, 0x01, 0x92, 0x02, 0x9b, 0x04, 0x31, 0x05, 0xd2, 0x05, 0xee, 0x05, 0xe5, 0x04, 0x36, 0x03, 
-0x91, 0x01, 0xca, 0xfe, 0x53, 0xfc, 0x7f, 0xfa, 0x90, 0xf7, 0x62, 0xf6, 0xf3, 0xf4, 0xc5, 0xf2, 
-0x98, 0xf2, 0x5c, 0xf0, 0x3e, 0xef, 0xe8, 0xef, 0xe4, 0xec, 0xf3, 0xee, 0xf2, 0xed, 0x56, 0xef, 
-0x0b, 0xf3, 0xf5, 0xf5, 0x57, 0xfd, 0x50, 0x00, 0x3a, 0x07, 0x91, 0x0a, 0xac, 0x0c, 0xb7, 0x11, 
-0xe1, 0x10, 0xee, 0x12, 0xff, 0x12, 0xc9, 0x10, 0x6f, 0x11, 0xe2, 0x0e, 0x87, 0x0d, 0x36, 0x0b, 
-0xc1, 0x07, 0x0c, 0x05, 0xd6, 0x01, 0x2d, 0x00, 0x09, 0xfe, 0x48, 0xfd, 0x97, 0xfc, 0x27, 0xfc, 
-0x1c, 0xfd, 0xc3, 0xfd, 0x9c, 0xff, 0x5e, 0x01, 0x9a, 0x02, 0xd2, 0x04, 0xb5, 0x05, 0xf6, 0x05, 
-0xa7, 0x06, 0x2c, 0x05, 0x3b, 0x03, 0x48, 0x02, 0xe3, 0xfe, 0xe1, 0xfc, 0xea, 0xfa, 0xd8, 0xf7, 
-0xc9, 0xf6, 0x2a, 0xf5, 0xe5, 0xf3, 0x59, 0xf3, 0x62, 0xf2, 0xfb, 0xf0, 0x7c, 0xf0, 0x94, 0xef, 
-0x7f, 0xee, 0x89, 0xee, 0x93, 0xef, 0x69, 0xf1, 0xc1, 0xf5, 0x36, 0xfb, 0x6d, 0x00, 0xc0, 0x05, 
-0x89, 0x09, 0x18, 0x0d, 0xf2, 0x0e, 0xb7, 0x10, 0xde, 0x11, 0x58, 0x11, 0xef, 0x11, 0xb5, 0x10, 
-0xac, 0x0f, 0x2b, 0x0e, 0x04, 0x0b, 0x40, 0x08, 0xd5, 0x04, 0x0a, 0x02, 0x3d, 0x00, 0x59, 0xfe, 
-0x5b, 0xfd, 0xc6, 0xfc, 0x6b, 0xfc, 0xf7, 0xfc, 0xd5, 0xfd, 0x27, 0xff, 0x11, 0x00, 0xe6, 0x01, 
-0x37, 0x03, 0x55, 0x04, 0x87, 0x05, 0xee, 0x05, 0xa8, 0x04, 0x06, 0x04, 0x18, 0x02, 0x9c, 0xff, 
-0x32, 0xfe, 0xda, 0xfa, 0x59, 0xf9, 0x2b, 0xf6, 0x62, 0xf4, 0x42, 0xf3, 0x99, 0xf0, 0xe0, 0xf0, 
-0xb5, 0xef, 0x44, 0xee, 0x46, 0xef, 0x6b, 0xee, 0x42, 0xee, 0x7e, 0xf0, 0x76, 0xf2, 0xe1, 0xf5, 
-0xd6, 0xfb, 0xb8, 0x00, 0x6a, 0x05, 0x05, 0x0b, 0x0d, 0x0d, 0x38, 0x10, 0x55, 0x12, 0x44, 0x12, 
-0x52, 0x13, 0x42, 0x13, 0x72, 0x11, 0xf4, 0x10, 0x61, 0x0e, 0xef, 0x0a, 0x9b, 0x08, 0x47, 0x04, 
-0xeb, 0x01, 0x73, 0xff, 0xc3, 0xfd, 0x1b, 0xfd, 0x06, 0xfc, 0x60, 0xfc, 0xe9, 0xfc, 0x12, 0xfd, 
-0xec, 0xfe, 0x93, 0x00, 0x80, 0x01, 0x91, 0x03, 0x61, 0x05, 0xb5, 0x04, 0xd4, 0x05, 0xab, 0x04, 
-0xd3, 0x02, 0x27, 0x02, 0x90, 0xff, 0x91, 0xfe, 0xd2, 0xfb, 0x2f, 0xfa, 0x58, 0xf8, 0xeb, 0xf5, 
-0x8c, 0xf5, 0x9f, 0xf3, 0x91, 0xf2, 0xac, 0xf2, 0x19, 0xf1, 0xca, 0xf1, 0x9f, 0xf1, 0xc2, 0xf0, 
-0x9b, 0xf0, 0x07, 0xf2, 0x18, 0xf3, 0x23, 0xf7, 0x8e, 0xfc, 0x24, 0xff, 0x87, 0x05, 0x4b, 0x07, 
-0xb4, 0x0a, 0x1a, 0x0e, 0xe6, 0x0d, 0xac, 0x10, 0x2f, 0x10, 0xfb, 0x0f, 0xd7, 0x10, 0x7a, 0x0f, 
-0xd5, 0x0d, 0x5c, 0x0c, 0x65, 0x08, 0xe1, 0x05, 0xf2, 0x03, 0x94, 0x00, 0x3b, 0x00, 0x38, 0xfe, 
-0x01, 0xfd, 0xd1, 0xfd, 0xb5, 0xfc, 0x07, 0xfe, 0xe8, 0xfe, 0x6e, 0xff, 0xbd, 0x01, 0x15, 0x02, 
-0x34, 0x04, 0x01, 0x04, 0x18, 0x04, 0xd8, 0x03, 0x63, 0x01, 0xd2, 0x01, 0x6c, 0xfe, 0x1a, 0xfd, 
-0x22, 0xfc, 0x65, 0xf8, 0xa9, 0xf8, 0x83, 0xf6, 0x18, 0xf5, 0xbf, 0xf4, 0x14, 0xf3, 0xbd, 0xf2, 
-0x15, 0xf2, 0xfa, 0xf0, 0x7e, 0xf1, 0x62, 0xf0, 0xfb, 0xf0, 0x95, 0xf4, 0x42, 0xf5, 0x91, 0xfb, 
-0xc8, 0xff, 0x1b, 0x02, 0x14, 0x09, 0x95, 0x09, 0xc0, 0x0c, 0x71, 0x10, 0x66, 0x0e, 0xc9, 0x11, 
-0xec, 0x10, 0x82, 0x0f, 0xda, 0x10, 0x15, 0x0d, 0xdd, 0x0b, 0x5f, 0x09, 0x4d, 0x05, 0xdf, 0x03, 
-0x01, 0x01, 0xf8, 0xfe, 0x5e, 0xfe, 0xe6, 0xfc, 0x4b, 0xfc, 0x07, 0xfd, 0x6b, 0xfc, 0xef, 0xfd, 
-0x9e, 0xff, 0x44, 0x00, 0xc2, 0x02, 0x15, 0x03, 0xc3, 0x03, 0xfa, 0x03, 0x0a, 0x03, 0x9b, 0x02, 
-0x0c, 0x01, 0xe9, 0xff, 0x7d, 0xfe, 0x7d, 0xfc, 0x42, 0xfb, 0x1c, 0xf9, 0x7c, 0xf7, 0x2d, 0xf6, 
-0xe3, 0xf4, 0x3c, 0xf4, 0x74, 0xf3, 0x66, 0xf3, 0xa6, 0xf2, 0x56, 0xf2, 0xb7, 0xf2, 0x36, 0xf1, 
-0x33, 0xf3, 0xb5, 0xf4, 0x04, 0xf6, 0xa6, 0xfc, 0x2f, 0xfe, 0xce, 0x02, 0xee, 0x07, 0xed, 0x07, 
-0x6e, 0x0d, 0x0c, 0x0e, 0x59, 0x0e, 0x25, 0x11, 0xc3, 0x0e, 0xc1, 0x0f, 0x30, 0x0f, 0xf9, 0x0c, 
-0x10, 0x0c, 0x83, 0x09, 0x22, 0x07, 0xd6, 0x04, 0x2c, 0x03, 0xee, 0x00, 0xff, 0xfe, 0x88, 0xfe, 
-0x87, 0xfc, 0xe0, 0xfc, 0xf9, 0xfc, 0x10, 0xfd, 0x1a, 0xff, 0x7e, 0xff, 0xa0, 0x01, 0xee, 0x01, 
-0x86, 0x02, 0x2b, 0x03, 0xc4, 0x01, 0x64, 0x02, 0xa2, 0x00, 0x20, 0xff, 0x4b, 0xfe, 0xda, 0xfb, 
-0xba, 0xfa, 0x51, 0xf9, 0xca, 0xf7, 0xa7, 0xf6, 0x2c, 0xf6, 0x44, 0xf5, 0xcd, 0xf4, 0x78, 0xf4, 
-0xbc, 0xf2, 0xc8, 0xf2, 0x23, 0xf2, 0xae, 0xf1, 0x08, 0xf5, 0x1e, 0xf5, 0x87, 0xf9, 0x08, 0xfe, 
-0x56, 0xff, 0xda, 0x05, 0x8c, 0x06, 0x1b, 0x09, 0x7a, 0x0c, 0x14, 0x0c, 0xf7, 0x0e, 0x6f, 0x0f, 
-0xa5, 0x0f, 0x9c, 0x0f, 0xc9, 0x0e, 0x00, 0x0d, 0x90, 0x0a, 0x7c, 0x08, 0xd9, 0x04, 0x03, 0x03, 
-0xfc, 0x00, 0xe8, 0xfe, 0x91, 0xfe, 0x48, 0xfd, 0x1a, 0xfd, 0x68, 0xfd, 0x8f, 0xfd, 0xbf, 0xfe, 
-0x42, 0xff, 0xfb, 0x00, 0x8a, 0x01, 0x6e, 0x02, 0x5c, 0x03, 0x34, 0x02, 0x8c, 0x02, 0x60, 0x01, 
-0xae, 0xff, 0x4b, 0xff, 0x5d, 0xfd, 0x7b, 0xfb, 0xed, 0xfa, 0xab, 0xf8, 0x80, 0xf7, 0x20, 0xf7, 
-0x1f, 0xf5, 0x0b, 0xf5, 0x5c, 0xf4, 0x8f, 0xf3, 0xd3, 0xf3, 0x20, 0xf3, 0xa9, 0xf3, 0xa7, 0xf3, 
-0x60, 0xf5, 0xa9, 0xf7, 0x38, 0xfa, 0xa9, 0xfe, 0x87, 0x01, 0xdc, 0x04, 0x5f, 0x08, 0x0a, 0x0a, 
-0xb5, 0x0c, 0x4f, 0x0e, 0xab, 0x0e, 0x14, 0x10, 0x5f, 0x0f, 0x15, 0x0f, 0x5c, 0x0e, 0xc9, 0x0b, 
-0x57, 0x0a, 0x4d, 0x07, 0xb5, 0x04, 0x30, 0x03, 0x62, 0x00, 0x73, 0xff, 0xf8, 0xfd, 0xe1, 0xfc, 
-0xe1, 0xfc, 0x52, 0xfc, 0x19, 0xfd, 0x19, 0xfd, 0x57, 0xfe, 0x31, 0xff, 0x11, 0x00, 0x9c, 0x01, 
-0x09, 0x01, 0x5c, 0x02, 0x13, 0x01, 0xd6, 0x00, 0xa2, 0x00, 0xf2, 0xfd, 0x77, 0xfe, 0xbd, 0xfb, 
-0x4d, 0xfa, 0x32, 0xfa, 0x3c, 0xf7, 0x9f, 0xf7, 0xfc, 0xf5, 0xf1, 0xf4, 0xfe, 0xf4, 0xd6, 0xf3, 
-0xe2, 0xf3, 0x60, 0xf3, 0x5f, 0xf3, 0x97, 0xf3, 0x6e, 0xf5, 0x43, 0xf7, 0xfe, 0xfa, 0xf6, 0xfe, 
-0xdd, 0x01, 0x89, 0x06, 0x66, 0x08, 0xeb, 0x0a, 0xa5, 0x0d, 0x5d, 0x0d, 0xc1, 0x0f, 0x30, 0x0f, 
-0x01, 0x0f, 0x8b, 0x0f, 0x15, 0x0d, 0x8c, 0x0c, 0xe8, 0x09, 0x18, 0x07, 0x89, 0x05, 0x96, 0x02, 
-0x30, 0x01, 0xd3, 0xff, 0x01, 0xfe, 0xda, 0xfd, 0xd6, 0xfc, 0x03, 0xfd, 0xa6, 0xfd, 0x99, 0xfd, 
-0x1d, 0xff, 0x6a, 0xff, 0x6a, 0x00, 0x30, 0x01, 0x0d, 0x01, 0x68, 0x01, 0x67, 0x00, 0x28, 0x00, 
-0x04, 0xff, 0xf4, 0xfd, 0x81, 0xfd, 0x83, 0xfb, 0x02, 0xfb, 0x6f, 0xf9, 0x29, 0xf8, 0xa3, 0xf7, 
-0x38, 0xf6, 0x26, 0xf6, 0x2a, 0xf5, 0x43, 0xf5, 0xf8, 0xf4, 0x29, 0xf5, 0xc5, 0xf5, 0x0d, 0xf6, 
-0xaf, 0xf7, 0xff, 0xf8, 0xa0, 0xfb, 0xa0, 0xfe, 0x54, 0x01, 0x8e, 0x04, 0xc8, 0x06, 0x34, 0x09, 
-0xe1, 0x0a, 0x8a, 0x0c, 0x7b, 0x0d, 0xb3, 0x0d, 0x4d, 0x0e, 0x19, 0x0d, 0xd8, 0x0c, 0x11, 0x0b, 
-0x54, 0x09, 0xd7, 0x07, 0x0c, 0x05, 0x31, 0x04, 0xbd, 0x01, 0x5a, 0x00, 0xe5, 0xff, 0x9e, 0xfd, 
-0x11, 0xfe, 0x4f, 0xfd, 0xc0, 0xfc, 0x09, 0xfe, 0x96, 0xfd, 0xc5, 0xfe, 0x9f, 0xff, 0xb9, 0xff, 
-0x91, 0x00, 0x89, 0x00, 0x52, 0x00, 0x3d, 0x00, 0x5a, 0xff, 0xee, 0xfd, 0x39, 0xfd, 0x90, 0xfb, 
-0x77, 0xfa, 0x20, 0xfa, 0x78, 0xf8, 0xfa, 0xf7, 0x6e, 0xf7, 0xe0, 0xf5, 0x57, 0xf6, 0x12, 0xf5, 
-0xf8, 0xf4, 0x97, 0xf5, 0xc7, 0xf4, 0x33, 0xf7, 0xe5, 0xf7, 0xf6, 0xf9, 0x67, 0xfd, 0xe6, 0xfe, 
-0x78, 0x02, 0x2b, 0x05, 0xde, 0x06, 0xb7, 0x09, 0xea, 0x0a, 0x4b, 0x0c, 0x7e, 0x0d, 0xab, 0x0d, 
-0xff, 0x0d, 0x43, 0x0d, 0x46, 0x0c, 0xb3, 0x0a, 0xc2, 0x08, 0xc7, 0x06, 0x86, 0x04, 0xd3, 0x02, 
-0xca, 0x00, 0x8a, 0xff, 0x90, 0xfe, 0x46, 0xfd, 0x76, 0xfd, 0xc0, 0xfc, 0xf1, 0xfc, 0xb1, 0xfd, 
-0xb7, 0xfd, 0x17, 0xff, 0x9b, 0xff, 0x2d, 0x00, 0xc8, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x37, 0x00, 
-0x8d, 0xff, 0x8d, 0xfe, 0xad, 0xfd, 0x7a, 0xfc, 0x38, 0xfb, 0x63, 0xfa, 0x06, 0xf9, 0x2d, 0xf8, 
-0x52, 0xf7, 0x91, 0xf6, 0x00, 0xf6, 0xcd, 0xf5, 0xea, 0xf5, 0xea, 0xf5, 0x3b, 0xf7, 0xe1, 0xf7, 
-0x57, 0xf9, 0x94, 0xfb, 0x2f, 0xfd, 0x12, 0x00, 0x73, 0x02, 0x71, 0x04, 0xc5, 0x06, 0x37, 0x08, 
-0xa3, 0x09, 0x2d, 0x0b, 0xa0, 0x0b, 0x2d, 0x0c, 0x36, 0x0c, 0x56, 0x0b, 0x03, 0x0b, 0x7a, 0x09, 
-0xef, 0x07, 0x78, 0x06, 0x60, 0x04, 0x23, 0x03, 0xb2, 0x01, 0x5f, 0x00, 0x5c, 0xff, 0xb8, 0xfe, 
-0xe2, 0xfd, 0xfc, 0xfd, 0xf4, 0xfd, 0xaa, 0xfd, 0xa4, 0xfe, 0x92, 0xfe, 0x21, 0xff, 0xc5, 0xff, 
-0xa8, 0xff, 0xc1, 0xff, 0xa8, 0xff, 0x4f, 0xff, 0xe3, 0xfe, 0x8e, 0xfe, 0x88, 0xfd, 0xab, 0xfc, 
-0xc8, 0xfb, 0x6d, 0xfa, 0x04, 0xfa, 0xc7, 0xf8, 0x25, 0xf8, 0xf5, 0xf7, 0xd1, 0xf6, 0x4c, 0xf7, 
-0xdc, 0xf6, 0x0e, 0xf7, 0xe4, 0xf7, 0xbc, 0xf8, 0x35, 0xfa, 0xd6, 0xfb, 0x55, 0xfe, 0xc8, 0xff, 
-0x91, 0x02, 0x72, 0x04, 0xc0, 0x05, 0x05, 0x08, 0xa8, 0x08, 0xed, 0x09, 0x19, 0x0b, 0x2b, 0x0b, 
-0x5f, 0x0b, 0x20, 0x0b, 0xfd, 0x09, 0x31, 0x09, 0xbb, 0x07, 0x00, 0x06, 0xbc, 0x04, 0xfd, 0x02, 
-0xed, 0x01, 0xdb, 0x00, 0xc5, 0xff, 0x5f, 0xff, 0x70, 0xfe, 0x77, 0xfe, 0x91, 0xfe, 0x6f, 0xfe, 
-0x4a, 0xff, 0x0c, 0xff, 0x94, 0xff, 0xb3, 0xff, 0x36, 0xff, 0x8a, 0xff, 0x42, 0xfe, 0xfc, 0xfd, 
-0x15, 0xfd, 0xde, 0xfb, 0xa0, 0xfb, 0x0a, 0xfa, 0xbf, 0xf9, 0xb2, 0xf8, 0x07, 0xf8, 0x05, 0xf8, 
-0x11, 0xf7, 0xb5, 0xf7, 0x3a, 0xf7, 0xc4, 0xf7, 0xd0, 0xf8, 0x1a, 0xf9, 0x08, 0xfb, 0xda, 0xfb, 
-0x59, 0xfd, 0x59, 0xff, 0x76, 0x00, 0x57, 0x02, 0xc0, 0x03, 0xd1, 0x04, 0x4b, 0x06, 0x74, 0x07, 
-0x58, 0x08, 0x0d, 0x09, 0x6c, 0x09, 0x2e, 0x09, 0xfa, 0x08, 0x7e, 0x08, 0xa5, 0x07, 0x14, 0x07, 
-0x12, 0x06, 0x70, 0x05, 0x7e, 0x04, 0x93, 0x03, 0xb5, 0x02, 0x74, 0x01, 0xc9, 0x00, 0xe1, 0xff, 
-0x66, 0xff, 0x3b, 0xff, 0x13, 0xff, 0x1a, 0xff, 0x2a, 0xff, 0xf6, 0xfe, 0xdd, 0xfe, 0x4c, 0xfe, 
-0xa5, 0xfd, 0x30, 0xfd, 0x0f, 0xfc, 0xc8, 0xfb, 0xf0, 0xfa, 0x33, 0xfa, 0x0d, 0xfa, 0x30, 0xf9, 
-0x1d, 0xf9, 0x4a, 0xf9, 0x27, 0xf9, 0xc5, 0xf9, 0x16, 0xfa, 0x4f, 0xfa, 0x35, 0xfb, 0x94, 0xfb, 
-0x76, 0xfc, 0x45, 0xfd, 0xf0, 0xfd, 0x38, 0xff, 0x30, 0x00, 0x52, 0x01, 0x7d, 0x02, 0x54, 0x03, 
-0x0f, 0x04, 0x00, 0x05, 0x68, 0x05, 0xc8, 0x05, 0x94, 0x06, 0x7f, 0x06, 0xf2, 0x06, 0x2d, 0x07, 
-0xc8, 0x06, 0xd5, 0x06, 0x48, 0x06, 0xcc, 0x05, 0x5c, 0x05, 0xd0, 0x04, 0x14, 0x04, 0x83, 0x03, 
-0xa8, 0x02, 0xcf, 0x01, 0x46, 0x01, 0x42, 0x00, 0xd3, 0xff, 0x20, 0xff, 0x81, 0xfe, 0x33, 0xfe, 
-0xae, 0xfd, 0x58, 0xfd, 0xc1, 0xfc, 0x35, 0xfc, 0x9c, 0xfb, 0x1b, 0xfb, 0xdc, 0xfa, 0x7b, 0xfa, 
-0x7b, 0xfa, 0x7f, 0xfa, 0x6b, 0xfa, 0xdd, 0xfa, 0xbd, 0xfa, 0xf9, 0xfa, 0x50, 0xfb, 0x7e, 0xfb, 
-0x2b, 0xfc, 0xc1, 0xfc, 0x76, 0xfd, 0xfc, 0xfd, 0x01, 0xff, 0x6d, 0xff, 0x4d, 0x00, 0x30, 0x01, 
-0x47, 0x01, 0x61, 0x02, 0x80, 0x02, 0x0e, 0x03, 0xbc, 0x03, 0xad, 0x03, 0x3b, 0x04, 0x51, 0x04, 
-0xa1, 0x04, 0xdc, 0x04, 0xe6, 0x04, 0xfa, 0x04, 0xab, 0x04, 0xc6, 0x04, 0x82, 0x04, 0x21, 0x04, 
-0x09, 0x04, 0x72, 0x03, 0x42, 0x03, 0xe2, 0x02, 0x70, 0x02, 0xf8, 0x01, 0x23, 0x01, 0xd3, 0x00, 
-0x1c, 0x00, 0xaf, 0xff, 0x4b, 0xff, 0x65, 0xfe, 0xf3, 0xfd, 0x64, 0xfd, 0xf4, 0xfc, 0x7a, 0xfc, 
-0x08, 0xfc, 0xa7, 0xfb, 0x58, 0xfb, 0x5d, 0xfb, 0x49, 0xfb, 0x68, 0xfb, 0x8b, 0xfb, 0xd9, 0xfb, 
-0x3a, 0xfc, 0x78, 0xfc, 0xf3, 0xfc, 0x2d, 0xfd, 0x8b, 0xfd, 0x39, 0xfe, 0x95, 0xfe, 0x3b, 0xff, 
-0xd5, 0xff, 0x54, 0x00, 0xf1, 0x00, 0x59, 0x01, 0xde, 0x01, 0xf7, 0x01, 0x65, 0x02, 0x8f, 0x02, 
-0x9b, 0x02, 0x4c, 0x03, 0x24, 0x03, 0x47, 0x03, 0x63, 0x03, 0x1f, 0x03, 0x2e, 0x03, 0x41, 0x03, 
-0x0a, 0x03, 0x00, 0x03, 0x3e, 0x03, 0xc8, 0x02, 0xf8, 0x02, 0xdc, 0x02, 0x51, 0x02, 0x73, 0x02, 
-0xc6, 0x01, 0x77, 0x01, 0x4f, 0x01, 0x8e, 0x00, 0x5b, 0x00, 0xdd, 0xff, 0x61, 0xff, 0x32, 0xff, 
-0xc5, 0xfe, 0x71, 0xfe, 0x10, 0xfe, 0xce, 0xfd, 0x66, 0xfd, 0x35, 0xfd, 0x0d, 0xfd, 0xc0, 0xfc, 
-0xd3, 0xfc, 0xbc, 0xfc, 0xd9, 0xfc, 0xf4, 0xfc, 0x0b, 0xfd, 0x51, 0xfd, 0x80, 0xfd, 0xd1, 0xfd, 
-0x34, 0xfe, 0x94, 0xfe, 0xf9, 0xfe, 0x72, 0xff, 0xb5, 0xff, 0x36, 0x00, 0x95, 0x00, 0xd9, 0x00, 
-0x59, 0x01, 0x61, 0x01, 0xc4, 0x01, 0xee, 0x01, 0xd9, 0x01, 0x49, 0x02, 0x08, 0x02, 0x06, 0x02, 
-0x3f, 0x02, 0xf2, 0x01, 0x2f, 0x02, 0x27, 0x02, 0xf6, 0x01, 0x0e, 0x02, 0xf0, 0x01, 0xdb, 0x01, 
-0xbc, 0x01, 0x8d, 0x01, 0x2d, 0x01, 0xfb, 0x00, 0xe3, 0x00, 0x97, 0x00, 0x9b, 0x00, 0x63, 0x00, 
-0x29, 0x00, 0x39, 0x00, 0xf6, 0xff, 0xdb, 0xff, 0x9d, 0xff, 0x5a, 0xff, 0x32, 0xff, 0xdd, 0xfe, 
-0xd6, 0xfe, 0x72, 0xfe, 0x4b, 0xfe, 0x3e, 0xfe, 0xfe, 0xfd, 0x38, 0xfe, 0x1e, 0xfe, 0x26, 0xfe, 
-0x36, 0xfe, 0x3b, 0xfe, 0x75, 0xfe, 0x82, 0xfe, 0xcc, 0xfe, 0xf1, 0xfe, 0x48, 0xff, 0xbc, 0xff, 
-0xff, 0xff, 0x70, 0x00, 0x81, 0x00, 0xc1, 0x00, 0xfd, 0x00, 0x19, 0x01, 0x57, 0x01, 0x39, 0x01, 
-0x54, 0x01, 0x46, 0x01, 0x2b, 0x01, 0x33, 0x01, 0xe4, 0x00, 0xdb, 0x00, 0xa7, 0x00, 0x9f, 0x00, 
-0xb8, 0x00, 0x89, 0x00, 0xa4, 0x00, 0x72, 0x00, 0x71, 0x00, 0x85, 0x00, 0x55, 0x00, 0x6f, 0x00, 
-0x53, 0x00, 0x4a, 0x00, 0x5c, 0x00, 0x4c, 0x00, 0x4a, 0x00, 0x34, 0x00, 0x23, 0x00, 0x0a, 0x00, 
-0xf3, 0xff, 0xde, 0xff, 0xc0, 0xff, 0xba, 0xff, 0xad, 0xff, 0xac, 0xff, 0xb8, 0xff, 0xb2, 0xff, 
-0xc4, 0xff, 0xc8, 0xff, 0xc6, 0xff, 0xd8, 0xff, 0xd5, 0xff, 0xda, 0xff, 0xe7, 0xff, 0xe6, 0xff, 
-0xed, 0xff, 0xf4, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0x00, 0x00, 0xfb, 0xff, 
-0x02, 0x00, 0x02, 0x00, 0xfd, 0xff, 0x0a, 0x00, 0x02, 0x00, 0x05, 0x00, 0x07, 0x00, 0xfd, 0xff, 
-0x09, 0x00, 0x05, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x02, 0x00, 0xff, 0xff, 0x00, 0x00, 0x02, 0x00, 0xfe, 0xff, 0x03, 0x00, 0xff, 0xff, 
-0xfb, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 
-0xfa, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0x01, 0x00, 0xfd, 0xff, 
-0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 
-0x02, 0x00, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 
-0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0xfd, 0xff, 0x03, 0x00, 
-0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfe, 0xff, 
-0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 
-};
-
@@ -1,1023 +0,0 @@
-#include <stdio.h>
-const unsigned char me_turn_on_the_light[] = {
-0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xfe, 0xff, 0x02, 0x00, 0xfd, 0xff, 0x00, 0x00, 0x01, 0x00, 0xfd, 0xff, 0x05, 0x00, 0xfe, 0xff, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 
-0xf8, 0xff, 0x03, 0x00, 0x05, 0x00, 0xfc, 0xff, 0x01, 0x00, 0x05, 0x00, 0xf8, 0xff, 0x01, 0x00, 
-0x07, 0x00, 0xf8, 0xff, 0xfb, 0xff, 0x09, 0x00, 0xf9, 0xff, 0x05, 0x00, 0x08, 0x00, 0xfc, 0xff, 
-0xff, 0xff, 0x02, 0x00, 0xfd, 0xff, 0xf8, 0xff, 0x0d, 0x00, 0xfc, 0xff, 0x00, 0x00, 0x0c, 0x00, 
-0xf9, 0xff, 0xf6, 0xff, 0x0b, 0x00, 0xfc, 0xff, 0xf3, 0xff, 0x06, 0x00, 0xfe, 0xff, 0xf3, 0xff, 
-0x0b, 0x00, 0x05, 0x00, 0xf7, 0xff, 0x04, 0x00, 0x01, 0x00, 0xfb, 0xff, 0x03, 0x00, 0x0c, 0x00, 
-0xf8, 0xff, 0x15, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x17, 0x00, 0xf6, 0xff, 0x12, 0x00, 0xfc, 0xff, 
-0x00, 0x00, 0xf9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xf6, 0xff, 0x09, 0x00, 0xf9, 0xff, 0x04, 0x00, 
-0x05, 0x00, 0xf8, 0xff, 0x0b, 0x00, 0x03, 0x00, 0xe9, 0xff, 0x18, 0x00, 0xfb, 0xff, 0xfc, 0xff, 
-0x01, 0x00, 0xe7, 0xff, 0x00, 0x00, 0xee, 0xff, 0x05, 0x00, 0xf9, 0xff, 0xff, 0xff, 0x09, 0x00, 
-0xf5, 0xff, 0x14, 0x00, 0xe4, 0xff, 0x0f, 0x00, 0xfb, 0xff, 0xf8, 0xff, 0x17, 0x00, 0xe4, 0xff, 
-0x08, 0x00, 0x14, 0x00, 0xf6, 0xff, 0xfe, 0xff, 0x09, 0x00, 0xee, 0xff, 0x0e, 0x00, 0x03, 0x00, 
-0xfb, 0xff, 0x03, 0x00, 0xff, 0xff, 0x0e, 0x00, 0xf6, 0xff, 0x0e, 0x00, 0xf7, 0xff, 0x0d, 0x00, 
-0xf2, 0xff, 0x2c, 0x00, 0xf9, 0xff, 0xfc, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x11, 0x00, 0x11, 0x00, 
-0x2e, 0x01, 0x62, 0xff, 0xd4, 0xff, 0x11, 0x00, 0x88, 0xff, 0x10, 0x00, 0xf7, 0xff, 0x12, 0x00, 
-0x5d, 0xff, 0xdd, 0xff, 0xab, 0xff, 0x9b, 0xff, 0x14, 0x00, 0xf9, 0xff, 0x14, 0x00, 0x35, 0x00, 
-0xea, 0xff, 0x17, 0x00, 0xc8, 0x00, 0xd0, 0xff, 0x3e, 0x00, 0x81, 0x00, 0x18, 0x00, 0xfc, 0xff, 
-0xda, 0xff, 0xe9, 0xff, 0xc0, 0xff, 0x0b, 0x00, 0xf7, 0xff, 0x76, 0xff, 0x90, 0x01, 0x23, 0x01, 
-0x80, 0xff, 0xe5, 0xff, 0xb8, 0xff, 0x06, 0x00, 0x67, 0x00, 0x66, 0x00, 0x30, 0x00, 0x50, 0x00, 
-0x12, 0xff, 0x82, 0xff, 0x5f, 0xff, 0x83, 0xff, 0x6a, 0xff, 0x16, 0x00, 0x00, 0x00, 0x9a, 0xff, 
-0x79, 0x00, 0x83, 0xff, 0x1c, 0x00, 0xd3, 0xff, 0x46, 0x00, 0x7d, 0x00, 0xb7, 0xff, 0x75, 0x00, 
-0x76, 0xff, 0x2e, 0x00, 0xd9, 0xff, 0x00, 0x00, 0xcd, 0xff, 0x8d, 0xff, 0x73, 0x02, 0x66, 0x00, 
-0x08, 0x00, 0x23, 0x01, 0x56, 0xff, 0x6f, 0xff, 0x3d, 0x00, 0xbe, 0xff, 0x90, 0x00, 0xe4, 0xff, 
-0x58, 0xff, 0x21, 0x00, 0x40, 0xff, 0x5c, 0xff, 0x0b, 0x00, 0x92, 0x00, 0xef, 0xff, 0x26, 0x00, 
-0x37, 0x01, 0xf7, 0xff, 0xfb, 0xff, 0x50, 0x01, 0x97, 0x00, 0xec, 0x00, 0x15, 0x00, 0x32, 0xff, 
-0x10, 0x00, 0x66, 0xff, 0x27, 0xff, 0xa3, 0x01, 0xce, 0x04, 0xcf, 0x02, 0x9d, 0xff, 0x65, 0xff, 
-0x6a, 0xff, 0xad, 0xfd, 0x9a, 0xff, 0x80, 0xfe, 0x68, 0xfe, 0x20, 0xff, 0x9b, 0xfe, 0x11, 0xff, 
-0xb4, 0xff, 0xf0, 0xfd, 0x2f, 0x00, 0x3f, 0x01, 0x60, 0xff, 0x84, 0x01, 0x5b, 0xff, 0x04, 0x01, 
-0x5a, 0x00, 0x13, 0xff, 0xb0, 0xff, 0x80, 0xff, 0xdd, 0xfd, 0x76, 0x00, 0x5a, 0xfe, 0x5c, 0xff, 
-0xdf, 0xff, 0xae, 0xfd, 0xa4, 0x01, 0x0c, 0xff, 0x2d, 0xff, 0xa7, 0x00, 0xb9, 0xff, 0xbd, 0xff, 
-0x60, 0x01, 0xc3, 0xfe, 0x77, 0x02, 0x69, 0xff, 0x22, 0x00, 0x25, 0x01, 0x6d, 0xff, 0xfd, 0x00, 
-0xb6, 0xff, 0x29, 0xff, 0xda, 0x00, 0x59, 0x00, 0xf8, 0xfe, 0xba, 0x01, 0x9e, 0xff, 0x6a, 0x01, 
-0xbe, 0xfe, 0xfe, 0x00, 0x23, 0x01, 0xa4, 0xfe, 0xef, 0x01, 0xf7, 0x00, 0x6e, 0x01, 0xf7, 0x03, 
-0x46, 0xff, 0x42, 0x01, 0x10, 0x00, 0x19, 0xfc, 0xef, 0x01, 0x09, 0xff, 0xc6, 0xfe, 0x25, 0x01, 
-0x2f, 0xff, 0x78, 0x00, 0xd3, 0xff, 0xd8, 0xfe, 0x12, 0x01, 0x6a, 0x00, 0xaf, 0xfd, 0x02, 0x02, 
-0x8e, 0xfe, 0x26, 0x00, 0xc7, 0xff, 0xbb, 0xff, 0xf5, 0x00, 0x56, 0xfe, 0xe7, 0xff, 0x40, 0xff, 
-0x6e, 0xff, 0x64, 0x01, 0x8c, 0xfe, 0xec, 0x01, 0x54, 0x00, 0xe5, 0xfc, 0x76, 0x02, 0x15, 0xfe, 
-0x13, 0x01, 0xe6, 0xff, 0x7a, 0x00, 0x7c, 0x00, 0xdc, 0xfe, 0x8b, 0x00, 0xca, 0xff, 0xd9, 0xfd, 
-0xb3, 0x01, 0xd1, 0x00, 0x8e, 0xfd, 0xd2, 0x01, 0x4a, 0x00, 0x9f, 0xff, 0x0f, 0x00, 0xc3, 0xff, 
-0x94, 0x01, 0x2e, 0xfe, 0x6c, 0xff, 0xea, 0x02, 0xbf, 0xfc, 0xe8, 0x02, 0x89, 0xff, 0x47, 0xfd, 
-0x98, 0x02, 0xcf, 0xfd, 0x75, 0xff, 0x5b, 0x02, 0xe9, 0xfe, 0xbb, 0xfe, 0x50, 0x02, 0x8e, 0xfe, 
-0x1e, 0xff, 0xd9, 0x02, 0xcf, 0xfb, 0xf4, 0x01, 0xe3, 0x01, 0xd2, 0xfc, 0xcf, 0x02, 0x25, 0xff, 
-0x91, 0xff, 0x4b, 0x00, 0xcc, 0xfe, 0xe9, 0x01, 0x5a, 0xff, 0xb7, 0x00, 0x07, 0x00, 0x3c, 0xff, 
-0x6e, 0x01, 0x79, 0xfd, 0x98, 0xff, 0x47, 0x01, 0x65, 0x00, 0xb5, 0xfe, 0x30, 0x00, 0xdf, 0x00, 
-0x1e, 0x00, 0x4e, 0xfd, 0xc4, 0x01, 0x5f, 0x00, 0xa4, 0xfe, 0xb7, 0x00, 0x57, 0xfe, 0x14, 0x02, 
-0x49, 0xfe, 0xde, 0xfc, 0xa7, 0x04, 0xea, 0xfb, 0x31, 0xff, 0x48, 0x01, 0xac, 0xff, 0x65, 0x01, 
-0x21, 0xf9, 0x24, 0x06, 0x26, 0x00, 0x83, 0xfb, 0x89, 0x08, 0x34, 0xfb, 0x63, 0xfe, 0xd2, 0x05, 
-0xc5, 0xf8, 0x78, 0x03, 0x02, 0x01, 0xd8, 0xfa, 0xb5, 0x04, 0xa0, 0x00, 0xdf, 0xfa, 0x7a, 0x04, 
-0x90, 0xfe, 0xfd, 0xfe, 0x13, 0x03, 0xf7, 0xfb, 0x2e, 0x03, 0x3e, 0x02, 0xeb, 0xfa, 0xfe, 0x02, 
-0xd1, 0x02, 0xb3, 0xfa, 0x0a, 0x03, 0xd0, 0xff, 0xaa, 0xfe, 0xa1, 0x01, 0x04, 0xff, 0xd1, 0xfe, 
-0x34, 0x03, 0x75, 0xfc, 0xce, 0x00, 0x1e, 0xfe, 0x33, 0x01, 0x8f, 0xfe, 0xe7, 0xfe, 0x0e, 0x06, 
-0x48, 0xfb, 0x9a, 0x03, 0xd1, 0xff, 0x9b, 0xfa, 0x0c, 0x05, 0x30, 0xfa, 0xbb, 0xff, 0xb7, 0x05, 
-0xfd, 0xf6, 0xc4, 0x05, 0xaf, 0xfc, 0x26, 0xfe, 0xf0, 0x03, 0x5e, 0xfc, 0x9f, 0x03, 0x59, 0x03, 
-0xe4, 0xfa, 0xe9, 0x04, 0xce, 0xfd, 0xa9, 0xfc, 0x6c, 0x05, 0xbc, 0xf9, 0x4f, 0x01, 0xf2, 0x02, 
-0xe4, 0xf9, 0x36, 0x01, 0x5c, 0x00, 0x76, 0xfd, 0x53, 0x03, 0x03, 0x00, 0xf1, 0x00, 0xca, 0xfd, 
-0x93, 0x02, 0xef, 0xfd, 0x9f, 0x02, 0xf2, 0xff, 0x83, 0xfb, 0x4a, 0x05, 0x06, 0xfe, 0x41, 0x00, 
-0x9d, 0x02, 0xb5, 0xfc, 0x8a, 0x02, 0x21, 0xfc, 0x4c, 0x02, 0x72, 0x04, 0x90, 0xf9, 0x29, 0x07, 
-0x80, 0x01, 0x34, 0xfd, 0x61, 0x03, 0x62, 0xff, 0x03, 0x00, 0x0d, 0x03, 0xec, 0xfa, 0x3a, 0x00, 
-0x63, 0x03, 0x63, 0xfc, 0xca, 0xfd, 0x25, 0x01, 0xef, 0x04, 0x71, 0xff, 0x7b, 0xfc, 0xa5, 0x07, 
-0xf0, 0xfd, 0x1c, 0xfd, 0x3b, 0x05, 0xf5, 0xf9, 0xa5, 0x02, 0x29, 0xfd, 0x26, 0xfd, 0xeb, 0x07, 
-0x8e, 0xfa, 0x3c, 0xfd, 0x6b, 0x07, 0x1b, 0xfc, 0x0c, 0x00, 0x1b, 0x03, 0x53, 0xfc, 0x2e, 0x03, 
-0xda, 0xfd, 0xbf, 0xfa, 0x8a, 0x04, 0x61, 0xff, 0x85, 0xfd, 0x96, 0x02, 0x42, 0xff, 0xd9, 0x00, 
-0xfb, 0xfe, 0x79, 0xff, 0x1d, 0xfe, 0xe1, 0x00, 0xa3, 0x03, 0x7b, 0xfe, 0x7f, 0xfd, 0xf6, 0x01, 
-0xc9, 0x00, 0x2c, 0xfe, 0x7e, 0x00, 0x4b, 0x01, 0x61, 0xfd, 0x02, 0xfe, 0x19, 0xfe, 0xa8, 0x00, 
-0x19, 0x03, 0x12, 0xfa, 0x00, 0x02, 0x8d, 0x03, 0x06, 0xfc, 0xc2, 0xff, 0x8c, 0x02, 0xd6, 0x01, 
-0x36, 0xfe, 0x61, 0xfe, 0xb5, 0x03, 0x04, 0xff, 0x61, 0xfc, 0x88, 0xfe, 0xa8, 0x00, 0x4e, 0x00, 
-0xc6, 0xff, 0xc3, 0xfe, 0xef, 0x01, 0xc7, 0x00, 0xec, 0xfa, 0x9e, 0x04, 0xbb, 0x03, 0x20, 0xff, 
-0x25, 0x03, 0xb5, 0x00, 0x88, 0x00, 0x91, 0xff, 0xc3, 0xfb, 0x6e, 0x03, 0x20, 0xff, 0xca, 0xfc, 
-0x6d, 0xff, 0x3c, 0x01, 0x27, 0x01, 0xba, 0xfd, 0x5f, 0x00, 0x4e, 0x01, 0x8f, 0x01, 0xb3, 0xff, 
-0xbb, 0xfe, 0x79, 0x02, 0xe8, 0x00, 0x4e, 0xfd, 0x3d, 0xff, 0x91, 0x02, 0xc3, 0xfd, 0x13, 0xff, 
-0xeb, 0x03, 0x01, 0xfc, 0x23, 0x03, 0xe6, 0x00, 0x06, 0xfc, 0x4e, 0x04, 0x00, 0x00, 0xaf, 0xfd, 
-0x3e, 0x05, 0x2a, 0xff, 0x44, 0xfb, 0x26, 0x04, 0xf2, 0x00, 0xc8, 0xfc, 0xec, 0x00, 0xfc, 0x01, 
-0xdf, 0xfd, 0x59, 0xff, 0x2b, 0x03, 0xdb, 0xfe, 0x32, 0xfe, 0x22, 0x03, 0xf4, 0xff, 0xae, 0xff, 
-0x20, 0x02, 0xd4, 0x00, 0x04, 0x00, 0x56, 0x00, 0xcb, 0x00, 0x9f, 0x00, 0xdc, 0xfd, 0x04, 0xfd, 
-0x4b, 0x01, 0xd6, 0xfe, 0x2f, 0xfe, 0xa9, 0x05, 0xc9, 0x00, 0x3f, 0xfd, 0x8b, 0x04, 0x08, 0xfe, 
-0xba, 0x00, 0x6e, 0xff, 0x72, 0xfb, 0x4a, 0x01, 0xcb, 0x01, 0x42, 0xff, 0x01, 0xff, 0x7c, 0x03, 
-0xb5, 0x00, 0x30, 0xfd, 0x66, 0x00, 0x2c, 0x00, 0xac, 0xff, 0x4a, 0xff, 0xe5, 0xfe, 0xa5, 0xff, 
-0x95, 0xff, 0xe4, 0xfe, 0xe8, 0xfe, 0xd1, 0xfe, 0xf8, 0x00, 0xc8, 0x03, 0x0f, 0x00, 0x00, 0xff, 
-0x66, 0x01, 0x20, 0x03, 0x20, 0xfe, 0xee, 0xfe, 0x85, 0x00, 0xa5, 0xff, 0x61, 0xfe, 0xa4, 0xfe, 
-0xa4, 0x02, 0x72, 0x00, 0x04, 0xff, 0x44, 0xfe, 0x80, 0x01, 0xf2, 0x02, 0xfa, 0xfc, 0xb4, 0xff, 
-0x04, 0x03, 0xd9, 0xfe, 0x74, 0xff, 0x2e, 0x02, 0x73, 0xfe, 0x6e, 0xfd, 0x1b, 0x01, 0x3b, 0xfe, 
-0x96, 0xff, 0x6d, 0x03, 0x13, 0x01, 0x95, 0xfd, 0x49, 0x01, 0x2b, 0x01, 0x05, 0xfe, 0xc3, 0xff, 
-0xc9, 0x02, 0x40, 0x00, 0x58, 0xfd, 0x39, 0x02, 0x43, 0x00, 0xe3, 0xfb, 0xdd, 0x00, 0x62, 0x01, 
-0x88, 0xfe, 0x36, 0x02, 0xb2, 0x03, 0x6d, 0x00, 0x7c, 0xff, 0xad, 0xfe, 0x3a, 0xfc, 0x7c, 0xfe, 
-0x1b, 0x01, 0x89, 0x00, 0xc1, 0xff, 0x27, 0x01, 0x65, 0x01, 0xa2, 0xff, 0x8e, 0xff, 0xc6, 0x00, 
-0x64, 0xfe, 0x3c, 0xff, 0x37, 0x02, 0x14, 0x01, 0x64, 0x03, 0xd8, 0x02, 0xe6, 0xfb, 0xe1, 0xfc, 
-0xd3, 0xfe, 0xff, 0xfe, 0x97, 0xfc, 0xa3, 0xfe, 0x85, 0x04, 0xb9, 0x02, 0x75, 0xfc, 0x67, 0xfc, 
-0x39, 0x00, 0x74, 0xfc, 0x5d, 0xfa, 0x1a, 0x01, 0xea, 0x00, 0xd9, 0xff, 0xc5, 0x04, 0x23, 0x02, 
-0xbc, 0xfe, 0xc1, 0x02, 0x9f, 0x03, 0x30, 0x00, 0x61, 0x01, 0xda, 0x04, 0x26, 0x03, 0xcd, 0x02, 
-0x09, 0x03, 0x89, 0x01, 0x9e, 0x05, 0x7d, 0x02, 0x96, 0xfe, 0x22, 0x01, 0xea, 0x03, 0x85, 0xfe, 
-0x6a, 0xfd, 0xbf, 0xff, 0x97, 0xfe, 0xe6, 0xfa, 0x7b, 0xf8, 0xe8, 0xf9, 0x47, 0xf9, 0x4c, 0xf9, 
-0xbf, 0xf8, 0x19, 0xfb, 0xf7, 0xfb, 0x3b, 0xf9, 0xde, 0xf9, 0xd2, 0xfb, 0x42, 0xff, 0x50, 0x00, 
-0x2e, 0x02, 0x9f, 0x04, 0xd9, 0x01, 0xf2, 0x04, 0x6f, 0x06, 0x8a, 0x06, 0x23, 0x0b, 0x15, 0x0c, 
-0x6b, 0x07, 0xca, 0x07, 0x92, 0x08, 0xb2, 0x04, 0xd4, 0x04, 0xf8, 0x05, 0xe0, 0x04, 0xd8, 0x03, 
-0xc5, 0x02, 0x2b, 0xff, 0x7e, 0xfc, 0x66, 0xfc, 0x89, 0xfb, 0x3e, 0xfa, 0xcd, 0xf6, 0xc1, 0xf5, 
-0xe0, 0xf6, 0xb4, 0xf3, 0x64, 0xf0, 0x5a, 0xee, 0x6a, 0xf2, 0xe5, 0xf3, 0x2d, 0xf6, 0x61, 0xfd, 
-0x76, 0xff, 0x34, 0x02, 0xd8, 0x03, 0xb3, 0x06, 0x15, 0x0a, 0xbb, 0x0a, 0x58, 0x0a, 0xaa, 0x0a, 
-0xb0, 0x0c, 0x65, 0x0b, 0xa9, 0x0a, 0x36, 0x09, 0x1e, 0x08, 0x05, 0x09, 0x80, 0x07, 0x74, 0x06, 
-0xbc, 0x07, 0xe6, 0x05, 0xc9, 0x01, 0xa7, 0x00, 0x5e, 0xfc, 0x67, 0xfb, 0x37, 0xfb, 0x09, 0xf8, 
-0x0f, 0xf6, 0xf8, 0xf4, 0xef, 0xf2, 0xf5, 0xef, 0x27, 0xee, 0x2c, 0xea, 0x9d, 0xe9, 0x64, 0xf0, 
-0xce, 0xf5, 0x2a, 0xf7, 0x5e, 0xfe, 0xf1, 0x08, 0xaf, 0x0a, 0xda, 0x07, 0x38, 0x0d, 0x0d, 0x10, 
-0x7d, 0x0e, 0x1a, 0x10, 0x7a, 0x0c, 0xcd, 0x0a, 0x68, 0x0e, 0xca, 0x0b, 0x1b, 0x06, 0xa7, 0x07, 
-0x2f, 0x0b, 0xc8, 0x07, 0x14, 0x03, 0xe6, 0x03, 0xda, 0x04, 0x81, 0xfe, 0xf3, 0xf6, 0xe6, 0xf7, 
-0x14, 0xf8, 0x43, 0xf5, 0x5b, 0xf3, 0x41, 0xf2, 0x34, 0xf2, 0x98, 0xed, 0xb0, 0xe5, 0x5e, 0xe5, 
-0xbe, 0xee, 0xd2, 0xed, 0x19, 0xf1, 0xfd, 0x00, 0xed, 0x0c, 0x70, 0x0d, 0x37, 0x0e, 0x98, 0x12, 
-0x9d, 0x10, 0x36, 0x0f, 0x63, 0x0c, 0x2c, 0x09, 0x53, 0x09, 0x38, 0x0b, 0x83, 0x0a, 0x94, 0x0a, 
-0xf0, 0x09, 0x53, 0x09, 0x92, 0x09, 0xa4, 0x08, 0xc9, 0x06, 0xb2, 0x05, 0x05, 0x04, 0xfc, 0xfe, 
-0x0f, 0xfb, 0xc1, 0xf5, 0x05, 0xf3, 0x5a, 0xf3, 0xb8, 0xf0, 0x6e, 0xee, 0x08, 0xee, 0xa7, 0xe8, 
-0x71, 0xe2, 0x4c, 0xe4, 0x0f, 0xed, 0xd3, 0xef, 0xb2, 0xf1, 0xb5, 0x01, 0x99, 0x0e, 0x17, 0x11, 
-0xe3, 0x11, 0xa0, 0x17, 0xa1, 0x14, 0x17, 0x0e, 0xaa, 0x0c, 0x6b, 0x07, 0xcd, 0x04, 0x7c, 0x07, 
-0x25, 0x09, 0x1d, 0x06, 0x76, 0x09, 0x69, 0x0f, 0xe3, 0x0e, 0xef, 0x0b, 0xcb, 0x0b, 0x86, 0x08, 
-0x4f, 0x02, 0xa8, 0xfe, 0x2b, 0xfb, 0x99, 0xf7, 0xab, 0xf3, 0x04, 0xf1, 0xcb, 0xed, 0x75, 0xec, 
-0x6e, 0xed, 0xdf, 0xe6, 0x5c, 0xdc, 0xa9, 0xde, 0x34, 0xee, 0x23, 0xf5, 0xf2, 0xf4, 0xc3, 0x02, 
-0xa6, 0x13, 0x2b, 0x17, 0x27, 0x14, 0xb5, 0x14, 0xdc, 0x12, 0x45, 0x0d, 0x9f, 0x08, 0x8c, 0x01, 
-0xcf, 0xfc, 0x4e, 0x00, 0x29, 0x04, 0xb9, 0x01, 0x5a, 0x05, 0xe7, 0x0d, 0x44, 0x10, 0xb5, 0x0e, 
-0x6c, 0x10, 0xd4, 0x10, 0x25, 0x0a, 0xaf, 0x03, 0x2c, 0xff, 0xd3, 0xfb, 0x02, 0xf9, 0x83, 0xf7, 
-0x6d, 0xf4, 0xbd, 0xf0, 0x72, 0xef, 0xea, 0xec, 0x44, 0xe9, 0xc0, 0xe3, 0x5c, 0xdd, 0x3c, 0xe1, 
-0x94, 0xf1, 0xf6, 0xfd, 0x70, 0x01, 0x7a, 0x08, 0xb6, 0x12, 0x05, 0x15, 0x63, 0x10, 0x20, 0x0a, 
-0xca, 0x08, 0xed, 0x08, 0x48, 0x07, 0xcf, 0x03, 0x69, 0x03, 0x8c, 0x07, 0xf6, 0x0a, 0x55, 0x0b, 
-0x10, 0x0a, 0xa0, 0x0b, 0x1f, 0x0c, 0x5d, 0x09, 0xaf, 0x03, 0xe8, 0x00, 0x3d, 0x01, 0xc1, 0xff, 
-0x43, 0xfc, 0x43, 0xfb, 0xa8, 0xfc, 0xde, 0xfd, 0xf6, 0xfc, 0xd4, 0xf9, 0x7f, 0xf7, 0xb1, 0xf3, 
-0x2e, 0xed, 0x2c, 0xe7, 0xca, 0xe3, 0xd9, 0xe1, 0xd0, 0xe9, 0x99, 0xf7, 0x9a, 0x01, 0x83, 0x07, 
-0x25, 0x0c, 0x1e, 0x11, 0x94, 0x11, 0x4d, 0x0d, 0x57, 0x08, 0x8c, 0x07, 0x2c, 0x07, 0x5f, 0x05, 
-0x3a, 0x04, 0x66, 0x05, 0x89, 0x07, 0x5a, 0x09, 0x82, 0x09, 0xe3, 0x09, 0x8f, 0x09, 0xb4, 0x07, 
-0x8a, 0x04, 0xb9, 0xfe, 0x68, 0xfe, 0x08, 0x00, 0x32, 0xfe, 0xa9, 0xfc, 0xbe, 0xfd, 0x88, 0x00, 
-0xd3, 0x01, 0xc6, 0x00, 0xcf, 0xfc, 0x5d, 0xf6, 0xa6, 0xf0, 0x51, 0xeb, 0xf7, 0xe7, 0x43, 0xe1, 
-0x99, 0xe1, 0x68, 0xf0, 0x10, 0xfd, 0x77, 0x02, 0xb1, 0x06, 0x14, 0x0f, 0x85, 0x11, 0x19, 0x0e, 
-0xcd, 0x0a, 0xc1, 0x08, 0xcb, 0x07, 0xdb, 0x06, 0x23, 0x06, 0x8b, 0x05, 0xc6, 0x06, 0x18, 0x08, 
-0xa3, 0x08, 0xd2, 0x08, 0x5b, 0x08, 0xd6, 0x06, 0x0e, 0x05, 0x6a, 0x02, 0x12, 0x00, 0xc3, 0xff, 
-0xa3, 0xfe, 0x77, 0xfe, 0x5d, 0xff, 0x3a, 0xff, 0xb0, 0x01, 0x0a, 0x03, 0x1d, 0x00, 0x43, 0xfa, 
-0x3a, 0xf5, 0xbf, 0xef, 0x58, 0xe9, 0xf2, 0xe4, 0xdf, 0xe0, 0x7f, 0xe6, 0x70, 0xf1, 0x1b, 0xfc, 
-0x86, 0x03, 0x7f, 0x08, 0x92, 0x0d, 0x7f, 0x0f, 0x31, 0x0f, 0xf3, 0x09, 0xcf, 0x07, 0x61, 0x08, 
-0xbb, 0x09, 0x40, 0x07, 0x0f, 0x04, 0x0d, 0x07, 0x44, 0x09, 0xc8, 0x06, 0x4c, 0x03, 0x98, 0x06, 
-0x68, 0x07, 0x6f, 0x04, 0xec, 0x01, 0x5f, 0x01, 0xbd, 0x02, 0x08, 0x00, 0xc2, 0xfe, 0xf2, 0xfe, 
-0x81, 0x01, 0x42, 0x02, 0x8e, 0x00, 0x52, 0xff, 0x8b, 0xfc, 0xbf, 0xf9, 0xc7, 0xf1, 0x75, 0xea, 
-0x58, 0xe7, 0x9e, 0xe4, 0xac, 0xe6, 0xac, 0xef, 0x02, 0xfa, 0x13, 0x00, 0xd3, 0x04, 0xc9, 0x0a, 
-0x7d, 0x0c, 0x98, 0x0c, 0x0e, 0x0b, 0x51, 0x09, 0xe4, 0x09, 0x27, 0x09, 0x62, 0x07, 0x0a, 0x05, 
-0x17, 0x07, 0xdd, 0x07, 0x5a, 0x06, 0xe6, 0x05, 0x2c, 0x06, 0x1d, 0x07, 0x6d, 0x05, 0x47, 0x03, 
-0xc3, 0x00, 0x00, 0x00, 0x76, 0xfe, 0x72, 0xfc, 0x58, 0xfe, 0x92, 0xff, 0x6d, 0x01, 0x05, 0x02, 
-0x75, 0x01, 0xff, 0xff, 0x9c, 0xfb, 0xf2, 0xf5, 0xc5, 0xed, 0xc5, 0xe9, 0x0f, 0xe6, 0x78, 0xe5, 
-0xcc, 0xeb, 0xd2, 0xf3, 0x47, 0xfd, 0x8a, 0x01, 0xfd, 0x05, 0x3d, 0x0b, 0x85, 0x0e, 0x90, 0x0d, 
-0x3d, 0x0b, 0x12, 0x0d, 0xa4, 0x0b, 0x94, 0x08, 0xa5, 0x06, 0xb5, 0x07, 0x23, 0x08, 0x10, 0x05, 
-0x24, 0x05, 0x2e, 0x05, 0x6a, 0x04, 0x35, 0x03, 0x28, 0x02, 0x2c, 0x01, 0x6c, 0xff, 0x75, 0xfe, 
-0x9e, 0xfc, 0x79, 0xfe, 0xc4, 0xff, 0xe3, 0x00, 0x17, 0x03, 0xa3, 0x03, 0x7a, 0x02, 0x51, 0xfd, 
-0x4d, 0xf9, 0xb5, 0xf4, 0xbb, 0xed, 0x74, 0xe6, 0x16, 0xe5, 0xec, 0xea, 0x8f, 0xef, 0x11, 0xf6, 
-0xf0, 0xfc, 0x40, 0x02, 0x0c, 0x09, 0xe7, 0x0b, 0x98, 0x0c, 0x6a, 0x0d, 0x54, 0x0e, 0xde, 0x0d, 
-0x5c, 0x0b, 0xce, 0x09, 0xf1, 0x08, 0xd0, 0x08, 0xe0, 0x06, 0x44, 0x04, 0x26, 0x03, 0x33, 0x01, 
-0x9b, 0x00, 0xd5, 0x00, 0x69, 0xff, 0x00, 0xff, 0xf6, 0xff, 0xf5, 0xfe, 0xe3, 0xfd, 0x80, 0x00, 
-0x3a, 0x02, 0x80, 0x01, 0x27, 0x02, 0x31, 0x03, 0x26, 0x01, 0x4c, 0xfc, 0x94, 0xf8, 0xb2, 0xf4, 
-0x1c, 0xee, 0xec, 0xe7, 0x29, 0xe8, 0xc6, 0xed, 0x31, 0xf0, 0x15, 0xf4, 0x4e, 0xfb, 0xef, 0x02, 
-0x64, 0x07, 0x80, 0x08, 0x45, 0x0c, 0x26, 0x0e, 0xa1, 0x0e, 0x3e, 0x0d, 0x03, 0x0c, 0x88, 0x0c, 
-0x3d, 0x0b, 0xd7, 0x09, 0x0a, 0x07, 0x80, 0x04, 0x30, 0x03, 0xac, 0x00, 0x52, 0xff, 0x0f, 0x00, 
-0xa0, 0xff, 0x74, 0xff, 0x38, 0xff, 0x82, 0xff, 0x39, 0x00, 0xc9, 0xff, 0x9a, 0x00, 0xd7, 0x01, 
-0xa0, 0x02, 0xf6, 0x00, 0x70, 0xfe, 0xf0, 0xfc, 0x07, 0xf9, 0x05, 0xf3, 0xa8, 0xed, 0x53, 0xea, 
-0xdb, 0xea, 0x45, 0xed, 0x51, 0xf0, 0x9b, 0xf4, 0xc3, 0xfa, 0x0d, 0x02, 0x29, 0x06, 0x19, 0x08, 
-0xd5, 0x0a, 0x39, 0x0d, 0x3d, 0x0e, 0x84, 0x0d, 0x6f, 0x0d, 0x76, 0x0e, 0x2e, 0x0d, 0xf8, 0x0a, 
-0x15, 0x08, 0x5f, 0x05, 0xc9, 0x02, 0x49, 0x00, 0x07, 0x00, 0x31, 0xff, 0x0e, 0xff, 0x5c, 0xff, 
-0x84, 0xfe, 0x46, 0xff, 0xd2, 0xff, 0x0c, 0x00, 0x12, 0x00, 0x6e, 0x00, 0xa1, 0x01, 0xa4, 0xff, 
-0x5f, 0xfd, 0x5b, 0xfb, 0x8f, 0xf7, 0x6d, 0xf3, 0xc3, 0xee, 0x09, 0xed, 0x17, 0xee, 0xef, 0xef, 
-0x53, 0xf2, 0xad, 0xf5, 0xc0, 0xfb, 0x84, 0x00, 0xb7, 0x02, 0x95, 0x05, 0xf1, 0x08, 0x03, 0x0b, 
-0x95, 0x0b, 0x1f, 0x0d, 0x9d, 0x0f, 0x18, 0x10, 0x02, 0x0e, 0xad, 0x0b, 0xab, 0x09, 0x6b, 0x07, 
-0x24, 0x04, 0x16, 0x02, 0x14, 0x02, 0x6f, 0x01, 0x87, 0x00, 0xa6, 0xff, 0xbf, 0xff, 0x35, 0xff, 
-0x08, 0xff, 0x75, 0xff, 0x41, 0xff, 0xcc, 0xff, 0xdf, 0xfe, 0xcc, 0xfd, 0xbf, 0xfc, 0x68, 0xf9, 
-0x19, 0xf5, 0xb0, 0xf0, 0x59, 0xed, 0xbf, 0xeb, 0x3c, 0xeb, 0xcb, 0xec, 0xe8, 0xef, 0x56, 0xf4, 
-0xb5, 0xf8, 0x2d, 0xfc, 0x43, 0x01, 0xb9, 0x05, 0xc0, 0x08, 0xe8, 0x0c, 0xe1, 0x10, 0xdf, 0x13, 
-0xd2, 0x15, 0xf5, 0x15, 0x0e, 0x14, 0xfe, 0x10, 0x4a, 0x0e, 0xc0, 0x0a, 0xed, 0x06, 0xc3, 0x04, 
-0xc0, 0x02, 0xbb, 0x00, 0xe9, 0xfe, 0x03, 0xfd, 0x7a, 0xfb, 0xc6, 0xfa, 0x35, 0xfb, 0xe0, 0xfa, 
-0xe2, 0xfa, 0xa6, 0xfb, 0xf7, 0xfa, 0x92, 0xf9, 0x10, 0xf7, 0x49, 0xf3, 0x9a, 0xee, 0xc5, 0xea, 
-0xc6, 0xe9, 0xd2, 0xea, 0x9e, 0xed, 0x2e, 0xf1, 0x48, 0xf6, 0x74, 0xfc, 0xf4, 0x00, 0x41, 0x05, 
-0xfc, 0x09, 0x23, 0x0e, 0x4f, 0x11, 0xa8, 0x13, 0xa3, 0x15, 0xe5, 0x15, 0x08, 0x14, 0x02, 0x11, 
-0xb3, 0x0d, 0xaa, 0x0a, 0x9c, 0x07, 0xbc, 0x04, 0x8b, 0x02, 0x5a, 0x00, 0x36, 0xfe, 0x21, 0xfc, 
-0xd1, 0xfa, 0xa1, 0xfa, 0x8f, 0xfa, 0xc2, 0xfa, 0x27, 0xfb, 0x50, 0xfb, 0x7b, 0xfb, 0x9c, 0xfa, 
-0x2d, 0xf8, 0x6a, 0xf5, 0x03, 0xf3, 0x51, 0xf2, 0x44, 0xf2, 0xde, 0xf1, 0x1f, 0xf2, 0xcd, 0xf4, 
-0xf7, 0xf8, 0xaf, 0xfb, 0xc3, 0xfd, 0x9d, 0x00, 0xc0, 0x04, 0xc0, 0x08, 0x3e, 0x0b, 0x65, 0x0d, 
-0xbd, 0x0f, 0x3b, 0x11, 0xca, 0x10, 0x9e, 0x0e, 0xaa, 0x0c, 0xcc, 0x0a, 0x77, 0x08, 0xc2, 0x06, 
-0xdf, 0x04, 0x21, 0x03, 0x60, 0x01, 0xc3, 0xfe, 0xfa, 0xfc, 0xbb, 0xfb, 0xf0, 0xfa, 0x12, 0xfb, 
-0x01, 0xfb, 0x71, 0xfb, 0x6a, 0xfb, 0x6d, 0xfb, 0xa3, 0xfb, 0x84, 0xfa, 0x09, 0xf9, 0x87, 0xf5, 
-0x1c, 0xf2, 0x24, 0xf2, 0x43, 0xf3, 0x34, 0xf3, 0x82, 0xf3, 0x34, 0xf6, 0x73, 0xfa, 0x6f, 0xfe, 
-0xf8, 0xff, 0x7f, 0x01, 0xcd, 0x05, 0x44, 0x0a, 0xc7, 0x0c, 0xbd, 0x0d, 0xc7, 0x0e, 0x5e, 0x0f, 
-0x22, 0x0f, 0x32, 0x0e, 0x57, 0x0b, 0x1b, 0x08, 0x84, 0x06, 0xde, 0x05, 0x20, 0x04, 0x25, 0x02, 
-0x0c, 0x00, 0x0e, 0xfe, 0xcb, 0xfc, 0xf5, 0xfb, 0x50, 0xfb, 0x86, 0xfa, 0x6a, 0xfb, 0xe2, 0xfb, 
-0x33, 0xfc, 0x08, 0xfc, 0xe2, 0xfa, 0x97, 0xf9, 0x26, 0xf8, 0x5c, 0xf5, 0x8e, 0xf1, 0x83, 0xf3, 
-0x53, 0xf5, 0x7e, 0xf4, 0xee, 0xf5, 0x94, 0xf8, 0xa0, 0xfd, 0x4a, 0x01, 0x34, 0x02, 0x12, 0x04, 
-0xd8, 0x07, 0x27, 0x0c, 0xf2, 0x0d, 0x82, 0x0e, 0x85, 0x0e, 0x26, 0x0e, 0xed, 0x0d, 0x0b, 0x0c, 
-0x9f, 0x08, 0x88, 0x05, 0x7a, 0x03, 0x6d, 0x02, 0x06, 0x02, 0xa5, 0xff, 0x90, 0xfc, 0xa1, 0xfb, 
-0x73, 0xfb, 0x66, 0xfa, 0x0a, 0xfa, 0x11, 0xfa, 0x4e, 0xfb, 0x2f, 0xfd, 0x12, 0xfc, 0xe5, 0xfa, 
-0xfa, 0xf9, 0x01, 0xf8, 0x72, 0xf6, 0xb2, 0xf4, 0x3a, 0xf5, 0xb3, 0xf6, 0xde, 0xf6, 0xcd, 0xf7, 
-0x52, 0xfa, 0x88, 0xfe, 0xc5, 0x01, 0x0f, 0x03, 0x60, 0x04, 0x0e, 0x08, 0xd0, 0x0b, 0xf0, 0x0d, 
-0xc4, 0x0e, 0xb9, 0x0d, 0x96, 0x0d, 0x84, 0x0c, 0xf0, 0x09, 0xce, 0x06, 0x85, 0x03, 0xa5, 0x02, 
-0xf6, 0x01, 0xcd, 0xff, 0xb1, 0xfd, 0xa4, 0xfb, 0x7b, 0xfa, 0xd5, 0xf9, 0x18, 0xf9, 0x46, 0xfa, 
-0x96, 0xfa, 0x4f, 0xfa, 0x34, 0xfb, 0x3c, 0xfb, 0x50, 0xfb, 0xe7, 0xfa, 0xa1, 0xf8, 0x16, 0xf7, 
-0x78, 0xf6, 0x8c, 0xf8, 0x27, 0xfa, 0x3a, 0xfa, 0xd4, 0xfa, 0x11, 0xfd, 0xa6, 0x00, 0xde, 0x02, 
-0x02, 0x04, 0xb3, 0x04, 0x30, 0x08, 0xc8, 0x0b, 0x18, 0x0d, 0x8a, 0x0c, 0x81, 0x0b, 0xfb, 0x0a, 
-0x39, 0x0a, 0x11, 0x08, 0x1a, 0x05, 0x0d, 0x03, 0x62, 0x02, 0x77, 0x00, 0x25, 0xff, 0x1c, 0xfd, 
-0x9e, 0xfb, 0xb7, 0xfb, 0x89, 0xfa, 0x56, 0xfa, 0x26, 0xfa, 0xd3, 0xfb, 0x90, 0xfc, 0x3f, 0xfb, 
-0xf3, 0xfb, 0xa0, 0xfb, 0xe1, 0xfb, 0xbb, 0xf6, 0x06, 0xf2, 0x8e, 0xf7, 0x38, 0xf9, 0x0d, 0xfb, 
-0xf1, 0xf9, 0x6e, 0xfc, 0x67, 0x01, 0x9f, 0x03, 0xa9, 0x05, 0x13, 0x03, 0x4c, 0x06, 0x78, 0x09, 
-0xa0, 0x0b, 0x69, 0x0b, 0xa4, 0x09, 0x5a, 0x09, 0x60, 0x0a, 0xac, 0x09, 0x4a, 0x04, 0x0d, 0x01, 
-0x05, 0xff, 0xcf, 0xfe, 0x7f, 0xfd, 0xd6, 0xfb, 0x00, 0xfa, 0x8a, 0xf7, 0xa1, 0xf8, 0x96, 0xf8, 
-0x5a, 0xfa, 0x44, 0xfa, 0x72, 0xfc, 0x1d, 0xfe, 0x55, 0xff, 0x44, 0x01, 0x0c, 0x00, 0xba, 0xff, 
-0x6f, 0xfd, 0x09, 0xfd, 0x5a, 0xfc, 0x5e, 0xfe, 0x80, 0xfe, 0xcd, 0xff, 0xa7, 0x00, 0x86, 0x01, 
-0xb3, 0x03, 0x26, 0x03, 0xf9, 0x04, 0x7a, 0x04, 0x70, 0x05, 0xd3, 0x04, 0xdc, 0x04, 0x54, 0x05, 
-0xfe, 0x03, 0x7d, 0x03, 0x1f, 0x02, 0xe6, 0x02, 0x19, 0x01, 0xf7, 0x00, 0xf2, 0x00, 0x0c, 0x01, 
-0xcf, 0xff, 0x70, 0xfd, 0xf6, 0xfc, 0xa0, 0xfb, 0x82, 0xfc, 0xd6, 0xfa, 0x47, 0xfa, 0x37, 0xf9, 
-0x66, 0xf8, 0xa5, 0xf8, 0x0f, 0xf8, 0x58, 0xf6, 0x34, 0xf6, 0x36, 0xfd, 0x0b, 0x01, 0xcd, 0x02, 
-0x7e, 0x00, 0x17, 0x02, 0x45, 0x07, 0xa4, 0x08, 0x1c, 0x08, 0x00, 0x05, 0xac, 0x06, 0x60, 0x08, 
-0x06, 0x09, 0x09, 0x06, 0x6e, 0x03, 0xf6, 0x02, 0x47, 0x03, 0x8c, 0x02, 0x82, 0xfe, 0x66, 0xfb, 
-0xd6, 0xfa, 0x5d, 0xfb, 0xc3, 0xfa, 0x23, 0xfa, 0x4a, 0xf9, 0x9b, 0xfb, 0x4c, 0xfe, 0x9b, 0xff, 
-0x46, 0x01, 0x28, 0x02, 0x88, 0x04, 0xfe, 0x06, 0xcb, 0x07, 0x54, 0x06, 0x9c, 0x03, 0xc3, 0x01, 
-0x0e, 0x01, 0x2b, 0xff, 0x3c, 0xfb, 0x7a, 0xf8, 0xc6, 0xf5, 0xad, 0xf3, 0x16, 0xf1, 0x5a, 0xef, 
-0x09, 0xf9, 0x9a, 0x01, 0xfb, 0x04, 0x4d, 0x00, 0xa0, 0xfd, 0x6c, 0x03, 0xd3, 0x09, 0x54, 0x0c, 
-0x98, 0x07, 0x23, 0x07, 0xde, 0x08, 0x58, 0x0a, 0x19, 0x07, 0xf5, 0x02, 0x33, 0x02, 0xd6, 0x03, 
-0xe1, 0x03, 0x49, 0xff, 0x14, 0xf9, 0x8a, 0xf6, 0xe4, 0xf6, 0x5c, 0xf8, 0xa7, 0xf8, 0xfc, 0xf7, 
-0x0d, 0xfa, 0x23, 0xfd, 0x7b, 0x00, 0xb0, 0x01, 0xd5, 0x00, 0xa2, 0x02, 0xfa, 0x05, 0x0e, 0x08, 
-0x21, 0x07, 0x67, 0x04, 0x97, 0x02, 0x38, 0x02, 0x1c, 0x03, 0x89, 0x01, 0xde, 0xff, 0x1b, 0xff, 
-0x7c, 0xff, 0x13, 0xff, 0xa9, 0xfd, 0x20, 0xfc, 0x56, 0xfc, 0x86, 0xfe, 0xd9, 0xff, 0xc3, 0x00, 
-0xd9, 0x00, 0x5e, 0x01, 0xd9, 0x01, 0xd7, 0x01, 0x0d, 0x02, 0xcc, 0x01, 0x3a, 0x01, 0xe1, 0xff, 
-0x15, 0xfc, 0x91, 0xfa, 0xa3, 0xf9, 0x1a, 0xf9, 0xd8, 0xf8, 0x1c, 0xf8, 0xe9, 0xf9, 0xb1, 0xfb, 
-0x3f, 0xfc, 0x38, 0xfb, 0xa6, 0xfc, 0x33, 0x01, 0xac, 0x03, 0x69, 0x06, 0x65, 0x02, 0xe2, 0x02, 
-0x07, 0x06, 0x36, 0x05, 0xe1, 0x06, 0x3c, 0x04, 0x82, 0x02, 0x99, 0x03, 0xdb, 0x01, 0x5c, 0xff, 
-0x0d, 0x00, 0x4c, 0xfb, 0x0f, 0xfe, 0xde, 0xff, 0x62, 0xfd, 0xdc, 0x00, 0x17, 0xfd, 0xf9, 0xfe, 
-0x0d, 0x01, 0x25, 0x02, 0x56, 0x04, 0x62, 0x02, 0x94, 0x00, 0xbf, 0xfc, 0x68, 0xfa, 0x6d, 0xf9, 
-0x31, 0xfe, 0x88, 0x02, 0x03, 0x03, 0x68, 0xff, 0x5c, 0xfc, 0x67, 0xfd, 0x4c, 0x00, 0x2d, 0x02, 
-0x1e, 0x00, 0xbd, 0xfe, 0x57, 0xff, 0x54, 0x01, 0x05, 0x02, 0xab, 0x01, 0xde, 0x00, 0x9b, 0x02, 
-0x5d, 0x05, 0x10, 0x05, 0x51, 0x03, 0x8d, 0xff, 0x59, 0xfd, 0xe7, 0xfd, 0xa4, 0xfe, 0xb9, 0xff, 
-0xfc, 0xfe, 0x17, 0xfe, 0x24, 0xfe, 0xf8, 0xfe, 0xee, 0xff, 0x45, 0x00, 0xab, 0x00, 0xee, 0x01, 
-0x54, 0x02, 0xd8, 0x01, 0xee, 0x00, 0x30, 0xff, 0x96, 0xff, 0x11, 0x00, 0xc7, 0x00, 0x7c, 0x00, 
-0xd5, 0xfe, 0x0c, 0xfe, 0x0a, 0xfe, 0x25, 0xfe, 0xc8, 0xfd, 0xc5, 0xfe, 0x15, 0xff, 0x25, 0xff, 
-0x25, 0x00, 0x5d, 0x00, 0x8c, 0x00, 0x68, 0x00, 0x12, 0x00, 0x9b, 0x00, 0x9f, 0x01, 0xb8, 0x01, 
-0xb3, 0x01, 0xb9, 0x01, 0xec, 0xff, 0x65, 0xff, 0xc6, 0xfe, 0x6d, 0xff, 0x3a, 0x00, 0x5f, 0xff, 
-0x8f, 0xfe, 0xb6, 0xfd, 0x6e, 0xfe, 0xbc, 0xff, 0x17, 0x00, 0x68, 0x00, 0x93, 0xff, 0x49, 0x01, 
-0x95, 0x05, 0x39, 0x07, 0x06, 0x05, 0x92, 0xff, 0x8f, 0xfd, 0xb6, 0xfd, 0x15, 0x01, 0x84, 0x01, 
-0x30, 0xfd, 0x66, 0xf8, 0xc3, 0xf6, 0xdb, 0xf9, 0xa5, 0xfe, 0xfc, 0x00, 0x7f, 0xff, 0x1e, 0xfd, 
-0x06, 0xfc, 0x52, 0xfe, 0x0d, 0x01, 0x6b, 0x01, 0x9b, 0x00, 0xb9, 0x00, 0x60, 0x02, 0xae, 0x04, 
-0xee, 0x03, 0x02, 0x02, 0x63, 0x00, 0xa7, 0x00, 0xca, 0x01, 0x06, 0x02, 0x09, 0x01, 0x72, 0xfe, 
-0x9e, 0xfd, 0xc4, 0xfd, 0x57, 0xfe, 0x27, 0x00, 0x48, 0x00, 0x45, 0x00, 0x3f, 0x00, 0x29, 0x00, 
-0x1d, 0x01, 0x4a, 0x02, 0x50, 0x02, 0xb2, 0x01, 0xc9, 0x01, 0xba, 0x01, 0xf7, 0x01, 0x72, 0x01, 
-0xe4, 0xff, 0x0a, 0xff, 0x4f, 0xff, 0x1f, 0xff, 0xea, 0xfe, 0xde, 0xfd, 0xc3, 0xfc, 0x96, 0xfd, 
-0xbf, 0xfe, 0xf5, 0xfe, 0xb7, 0xff, 0xc4, 0xff, 0x4b, 0x00, 0xf5, 0x01, 0xd1, 0x01, 0x30, 0x01, 
-0xe0, 0x00, 0xd6, 0x00, 0xb5, 0x01, 0x1a, 0x02, 0x72, 0x01, 0x6b, 0x00, 0xc8, 0xff, 0x99, 0xff, 
-0xda, 0xff, 0xea, 0xff, 0x72, 0xff, 0x46, 0xff, 0x41, 0xff, 0xec, 0xfe, 0xef, 0xfe, 0xfc, 0xfe, 
-0x16, 0xff, 0x2c, 0x00, 0x75, 0x00, 0x4d, 0x00, 0x2b, 0x00, 0xe0, 0xff, 0x03, 0x00, 0x35, 0x00, 
-0x2f, 0x00, 0x5d, 0x00, 0x76, 0x00, 0x45, 0x00, 0xfd, 0xff, 0xe4, 0xff, 0x34, 0x00, 0x8f, 0x00, 
-0x83, 0x00, 0x26, 0x00, 0xd6, 0xff, 0xe4, 0xff, 0x32, 0x00, 0x90, 0x00, 0xbc, 0x00, 0x96, 0x00, 
-0x8b, 0x00, 0x99, 0x00, 0x7b, 0x00, 0x3f, 0x00, 0x01, 0x00, 0xe2, 0xff, 0xd3, 0xff, 0xc3, 0xff, 
-0xc7, 0xff, 0x9c, 0xff, 0x69, 0xff, 0x06, 0xff, 0xff, 0xfe, 0x17, 0xff, 0xc2, 0xff, 0xc5, 0xff, 
-0xb0, 0x00, 0xf2, 0x02, 0x66, 0x04, 0xe1, 0x03, 0x3f, 0x01, 0xa0, 0xfe, 0x58, 0xfe, 0x41, 0x00, 
-0xcc, 0x01, 0x3e, 0x00, 0x6d, 0xfc, 0x1a, 0xf8, 0x02, 0xf6, 0xb4, 0xf8, 0x39, 0xfe, 0xce, 0x02, 
-0x28, 0x03, 0x7d, 0xff, 0x50, 0xfb, 0xd5, 0xfa, 0x85, 0xfe, 0xe9, 0x03, 0xe5, 0x06, 0x04, 0x06, 
-0x72, 0x02, 0xbb, 0xff, 0x06, 0x00, 0x07, 0x03, 0x1b, 0x06, 0x46, 0x06, 0x6a, 0x03, 0x64, 0xff, 
-0xb2, 0xfc, 0x60, 0xfc, 0x6d, 0xfd, 0x90, 0xfe, 0x99, 0xfe, 0x41, 0xfe, 0x36, 0xfe, 0xe8, 0xfe, 
-0xd0, 0xff, 0x8d, 0x00, 0xf2, 0x00, 0x38, 0x01, 0xce, 0x01, 0x7e, 0x02, 0xfb, 0x02, 0xd8, 0x02, 
-0xf4, 0x01, 0xa9, 0x00, 0x02, 0x00, 0x35, 0x00, 0xff, 0x00, 0x40, 0x01, 0x6a, 0x00, 0xe1, 0xfe, 
-0x6d, 0xfd, 0x33, 0xfd, 0x4a, 0xfe, 0x14, 0x00, 0x3f, 0x01, 0x21, 0x01, 0x41, 0x00, 0x61, 0xff, 
-0x91, 0xff, 0x8c, 0x00, 0xb7, 0x01, 0x4b, 0x02, 0xac, 0x01, 0xc5, 0x00, 0xed, 0xff, 0x83, 0xff, 
-0x8c, 0xff, 0x9a, 0xff, 0x7f, 0xff, 0x2a, 0xff, 0xc5, 0xfe, 0x79, 0xfe, 0x5d, 0xfe, 0x6b, 0xfe, 
-0x6f, 0xfe, 0xb1, 0xfe, 0x5d, 0xff, 0xfe, 0xff, 0x57, 0x00, 0x3a, 0x00, 0x08, 0x00, 0x23, 0x00, 
-0x66, 0x00, 0xfa, 0x00, 0x0e, 0x01, 0x2e, 0x01, 0xa2, 0x00, 0x4d, 0x00, 0x47, 0x02, 0x30, 0x04, 
-0x0f, 0x05, 0x81, 0x03, 0xf3, 0x00, 0xdd, 0xfe, 0xc4, 0xfe, 0xed, 0xff, 0x2b, 0x00, 0xeb, 0xfe, 
-0x43, 0xfc, 0xdb, 0xf9, 0x8e, 0xf8, 0x51, 0xf8, 0x81, 0xf9, 0x12, 0xfc, 0xeb, 0xfe, 0x90, 0x00, 
-0x09, 0x00, 0x47, 0xfe, 0xf1, 0xfc, 0x1e, 0xfe, 0x53, 0x01, 0xe0, 0x04, 0xc4, 0x06, 0xc5, 0x05, 
-0x28, 0x03, 0x4a, 0x01, 0x5b, 0x01, 0x01, 0x03, 0xff, 0x04, 0x1e, 0x05, 0xff, 0x02, 0x93, 0xff, 
-0x62, 0xfc, 0xff, 0xfa, 0xd9, 0xfb, 0x1a, 0xfe, 0xed, 0xff, 0x6c, 0x00, 0x67, 0xff, 0x3d, 0xfe, 
-0x2c, 0xfe, 0x45, 0xff, 0x3c, 0x01, 0xd5, 0x02, 0x70, 0x03, 0xf6, 0x02, 0x0d, 0x02, 0xef, 0x00, 
-0x45, 0x00, 0x62, 0x00, 0xbb, 0x00, 0xe2, 0x02, 0x75, 0x04, 0x3d, 0x04, 0xf3, 0x01, 0xc9, 0xfe, 
-0x25, 0xfd, 0xc5, 0xfd, 0xba, 0x00, 0x5a, 0x02, 0x00, 0x02, 0x90, 0xff, 0x86, 0xfb, 0x6d, 0xf8, 
-0xe7, 0xf7, 0x95, 0xf9, 0xd1, 0xfa, 0x3f, 0xfa, 0x19, 0xf9, 0xc0, 0xf8, 0xc3, 0xfa, 0xea, 0xfd, 
-0x31, 0x00, 0x13, 0x01, 0x7f, 0x00, 0x62, 0x00, 0xe8, 0x00, 0xf7, 0x02, 0x33, 0x05, 0xfb, 0x05, 
-0x90, 0x05, 0x00, 0x04, 0xe8, 0x02, 0x00, 0x03, 0xf8, 0x03, 0xaf, 0x04, 0x08, 0x04, 0x7e, 0x01, 
-0x45, 0xfe, 0x9b, 0xfb, 0x59, 0xfb, 0x55, 0xfd, 0xfb, 0xff, 0x91, 0x01, 0x7a, 0x00, 0x78, 0x00, 
-0xef, 0x01, 0xac, 0x04, 0xf9, 0x06, 0x1d, 0x07, 0x1c, 0x06, 0xff, 0x03, 0x62, 0x02, 0x40, 0x01, 
-0xe5, 0xff, 0x65, 0xfe, 0x24, 0xfc, 0xf0, 0xf9, 0xd2, 0xf7, 0x9f, 0xf5, 0x49, 0xf4, 0x98, 0xf2, 
-0x02, 0xf3, 0xe7, 0xf5, 0x3e, 0xfa, 0x27, 0xfe, 0xc5, 0xff, 0xe5, 0xff, 0xa6, 0xff, 0x64, 0x01, 
-0x02, 0x05, 0xd6, 0x08, 0x72, 0x0b, 0x49, 0x0b, 0xfc, 0x08, 0xff, 0x05, 0x91, 0x03, 0xda, 0x02, 
-0xfb, 0x02, 0xa1, 0x02, 0xf1, 0x00, 0x6e, 0xfd, 0xf5, 0xf9, 0x89, 0xf7, 0x83, 0xf7, 0x55, 0xfa, 
-0xda, 0xfd, 0x6e, 0x02, 0xed, 0x05, 0x44, 0x07, 0x81, 0x06, 0xd2, 0x04, 0xeb, 0x04, 0x78, 0x06, 
-0x14, 0x09, 0xf0, 0x08, 0x9f, 0x05, 0x92, 0x00, 0xdb, 0xfb, 0x33, 0xf9, 0xc5, 0xf7, 0x42, 0xf7, 
-0x1b, 0xf6, 0x88, 0xf3, 0x7b, 0xef, 0x40, 0xec, 0x61, 0xed, 0xd0, 0xf3, 0x62, 0xfc, 0x49, 0x03, 
-0xc0, 0x05, 0xe5, 0x04, 0x7a, 0x03, 0x36, 0x04, 0xa3, 0x07, 0xfc, 0x0b, 0xf9, 0x0e, 0xad, 0x0d, 
-0x00, 0x09, 0x54, 0x03, 0x0f, 0x00, 0x15, 0x00, 0x27, 0x02, 0x34, 0x03, 0xb3, 0x00, 0x6b, 0xfb, 
-0x43, 0xf6, 0xa0, 0xf4, 0x46, 0xf7, 0x38, 0xfe, 0xfa, 0x05, 0x0d, 0x0b, 0x59, 0x0a, 0xb5, 0x05, 
-0x0e, 0x01, 0xff, 0xff, 0x5b, 0x04, 0x0f, 0x0a, 0x60, 0x0d, 0x1a, 0x0a, 0x83, 0x02, 0xd5, 0xf9, 
-0xb0, 0xf4, 0x24, 0xf5, 0x0c, 0xf8, 0x2b, 0xfa, 0xb9, 0xf7, 0x9b, 0xf2, 0xe6, 0xed, 0x94, 0xed, 
-0x80, 0xf2, 0x8e, 0xfa, 0xfd, 0x02, 0x6f, 0x08, 0x2b, 0x09, 0x05, 0x07, 0xd3, 0x04, 0x6f, 0x05, 
-0x97, 0x08, 0x1e, 0x0c, 0xc8, 0x0d, 0xef, 0x0b, 0x63, 0x08, 0x91, 0x04, 0x6b, 0x02, 0xec, 0x01, 
-0x88, 0x01, 0x6c, 0x01, 0x08, 0x00, 0x1c, 0xfe, 0xd9, 0xfa, 0x3b, 0xf8, 0x2c, 0xf8, 0x02, 0xfa, 
-0x4d, 0xfc, 0x23, 0xfd, 0xb3, 0xfc, 0xbd, 0xfa, 0xda, 0xf7, 0x39, 0xf4, 0xb3, 0xf0, 0xec, 0xec, 
-0xd6, 0xf3, 0x3b, 0x02, 0x44, 0x10, 0x26, 0x14, 0x82, 0x0c, 0x8d, 0xfe, 0x9c, 0xf5, 0xfa, 0xf9, 
-0xe8, 0x05, 0xa4, 0x12, 0x0a, 0x17, 0x21, 0x11, 0xff, 0x05, 0xa1, 0xfe, 0x7d, 0xfe, 0x67, 0x06, 
-0x75, 0x0e, 0x9f, 0x10, 0x1b, 0x08, 0x4e, 0xfa, 0x99, 0xee, 0x6c, 0xed, 0x80, 0xf8, 0xba, 0x07, 
-0x37, 0x12, 0xb8, 0x0f, 0xd9, 0x03, 0x1e, 0xf8, 0xf0, 0xf4, 0x99, 0xfc, 0x04, 0x09, 0x18, 0x10, 
-0x0d, 0x0e, 0x6c, 0x04, 0x83, 0xf9, 0x9d, 0xf2, 0x99, 0xf2, 0x86, 0xf7, 0x95, 0xfa, 0x7d, 0xf9, 
-0x1c, 0xf4, 0x94, 0xed, 0xe8, 0xea, 0xca, 0xec, 0x63, 0xf4, 0xaa, 0xfe, 0xd9, 0x06, 0xe5, 0x07, 
-0xc2, 0x03, 0xe6, 0xff, 0xcb, 0xff, 0xa1, 0x05, 0xf9, 0x0c, 0xcf, 0x11, 0x28, 0x12, 0xbb, 0x0e, 
-0x7a, 0x09, 0xa8, 0x05, 0xe9, 0x03, 0x9b, 0x04, 0xed, 0x04, 0x9f, 0x04, 0xc3, 0x01, 0xb1, 0xfd, 
-0xd5, 0xf9, 0x8f, 0xf7, 0x90, 0xf8, 0xbe, 0xfa, 0x7c, 0xfc, 0x79, 0xfa, 0x6d, 0xf5, 0xed, 0xee, 
-0xe7, 0xe9, 0x4a, 0xe6, 0xfd, 0xe6, 0xc4, 0xed, 0x62, 0xfb, 0x4e, 0x0a, 0xd3, 0x11, 0xd4, 0x0d, 
-0xb8, 0x02, 0xad, 0xfb, 0x2b, 0xfd, 0xb5, 0x06, 0xd6, 0x10, 0xde, 0x14, 0xc2, 0x0f, 0x65, 0x06, 
-0xc5, 0xff, 0x09, 0x00, 0xa7, 0x06, 0x2a, 0x0e, 0x55, 0x10, 0x1b, 0x0a, 0xa5, 0xfe, 0x06, 0xf4, 
-0x90, 0xf0, 0x17, 0xf6, 0x6b, 0x01, 0x9e, 0x0a, 0x83, 0x0c, 0x2a, 0x07, 0x88, 0xff, 0x60, 0xfc, 
-0x1d, 0xff, 0x86, 0x05, 0x6c, 0x0a, 0xe0, 0x0a, 0x6b, 0x05, 0x6c, 0xfd, 0x4b, 0xf5, 0x16, 0xf0, 
-0xb2, 0xee, 0x87, 0xef, 0xe7, 0xef, 0x79, 0xed, 0xd4, 0xe8, 0x5b, 0xe8, 0x89, 0xf1, 0xa5, 0xff, 
-0xf6, 0x09, 0x05, 0x0b, 0x28, 0x05, 0x43, 0x00, 0x7f, 0x02, 0x5f, 0x0a, 0x3e, 0x13, 0x38, 0x17, 
-0x01, 0x14, 0x07, 0x0c, 0xb7, 0x04, 0x13, 0x01, 0xfa, 0x02, 0x74, 0x07, 0x90, 0x09, 0xa7, 0x05, 
-0x83, 0xfd, 0xc0, 0xf5, 0x0e, 0xf3, 0x1a, 0xf7, 0x5b, 0xff, 0x96, 0x06, 0x66, 0x08, 0x65, 0x05, 
-0xd4, 0x00, 0xe4, 0xfe, 0xd8, 0x00, 0xd5, 0x04, 0xf5, 0x05, 0x1d, 0x01, 0x57, 0xf7, 0x77, 0xec, 
-0x1e, 0xe4, 0x6c, 0xe0, 0xda, 0xe1, 0xba, 0xe6, 0x56, 0xef, 0x24, 0xfb, 0x66, 0x05, 0xc0, 0x08, 
-0xa7, 0x05, 0x47, 0x01, 0x99, 0x00, 0x89, 0x06, 0x53, 0x0f, 0x40, 0x15, 0x7f, 0x14, 0x81, 0x0f, 
-0x21, 0x09, 0x9d, 0x05, 0x61, 0x06, 0xbd, 0x09, 0x7f, 0x0b, 0x4c, 0x08, 0x8c, 0xff, 0xc4, 0xf4, 
-0xe3, 0xef, 0xd7, 0xf3, 0x7e, 0xfe, 0x69, 0x08, 0x40, 0x0c, 0x76, 0x08, 0xa9, 0x02, 0x66, 0xff, 
-0x39, 0x00, 0x2d, 0x04, 0xda, 0x08, 0x10, 0x0b, 0x09, 0x08, 0xaf, 0x00, 0x9d, 0xf6, 0x71, 0xed, 
-0xaf, 0xe6, 0x21, 0xe3, 0x4b, 0xe2, 0x7d, 0xe5, 0x95, 0xec, 0x92, 0xf6, 0xa6, 0x00, 0x78, 0x06, 
-0xac, 0x06, 0xfa, 0x03, 0x41, 0x02, 0x63, 0x04, 0x80, 0x0b, 0x38, 0x13, 0x85, 0x15, 0x3b, 0x11, 
-0x93, 0x09, 0x14, 0x04, 0xc1, 0x03, 0xec, 0x07, 0x6c, 0x0b, 0xef, 0x09, 0x08, 0x02, 0xfa, 0xf7, 
-0xcd, 0xf1, 0x70, 0xf3, 0xc1, 0xfc, 0x2d, 0x08, 0xad, 0x0f, 0xbe, 0x0e, 0x34, 0x08, 0x99, 0x00, 
-0x4b, 0xfe, 0x6e, 0x01, 0x6e, 0x08, 0x75, 0x0c, 0xc1, 0x09, 0xab, 0xff, 0x91, 0xf2, 0x9c, 0xe7, 
-0x09, 0xe2, 0x7b, 0xe1, 0x38, 0xe2, 0x27, 0xe4, 0x74, 0xe7, 0x1f, 0xf0, 0xd3, 0xfb, 0xaf, 0x06, 
-0xeb, 0x0a, 0xc7, 0x0a, 0x7c, 0x08, 0x6e, 0x08, 0xe7, 0x0b, 0xf9, 0x10, 0x75, 0x13, 0x6c, 0x11, 
-0x0b, 0x0d, 0x1f, 0x08, 0x39, 0x06, 0xb8, 0x06, 0xdb, 0x07, 0x55, 0x05, 0x6d, 0xff, 0x06, 0xf8, 
-0xcd, 0xf3, 0x39, 0xf5, 0x96, 0xfb, 0xc9, 0x03, 0x9a, 0x09, 0x6e, 0x0b, 0x61, 0x09, 0xa6, 0x06, 
-0x30, 0x05, 0x79, 0x06, 0x6f, 0x08, 0x12, 0x09, 0xa4, 0x06, 0xb8, 0x00, 0x44, 0xf8, 0x0d, 0xef, 
-0x50, 0xe8, 0x46, 0xe5, 0x04, 0xe5, 0x8b, 0xe4, 0x3f, 0xe4, 0xae, 0xe5, 0x90, 0xec, 0xa1, 0xf8, 
-0x98, 0x04, 0xae, 0x0a, 0x4f, 0x0b, 0x3a, 0x09, 0xf4, 0x08, 0xe1, 0x0c, 0x82, 0x12, 0xa9, 0x14, 
-0x74, 0x12, 0xbe, 0x0c, 0xe9, 0x06, 0x33, 0x04, 0x1d, 0x05, 0x32, 0x06, 0xf4, 0x04, 0x6e, 0x00, 
-0x15, 0xfa, 0xee, 0xf5, 0x8f, 0xf6, 0x65, 0xfc, 0x2d, 0x04, 0x37, 0x0a, 0x3f, 0x0b, 0x95, 0x09, 
-0x42, 0x07, 0x18, 0x07, 0xe0, 0x08, 0x56, 0x0b, 0x34, 0x0b, 0x5e, 0x08, 0x9d, 0x02, 0x7d, 0xfb, 
-0x80, 0xf4, 0x9e, 0xee, 0xbd, 0xe9, 0xc6, 0xe5, 0xf6, 0xe1, 0xb9, 0xde, 0x76, 0xde, 0xe4, 0xe2, 
-0x62, 0xed, 0x9d, 0xfb, 0xfe, 0x07, 0xb7, 0x0d, 0x94, 0x0d, 0xbe, 0x0a, 0xf6, 0x09, 0x45, 0x0d, 
-0xa5, 0x12, 0x30, 0x16, 0x5d, 0x15, 0xfd, 0x0f, 0xbb, 0x08, 0x0e, 0x04, 0x66, 0x03, 0x12, 0x05, 
-0x2e, 0x05, 0x69, 0x01, 0xed, 0xfa, 0x97, 0xf5, 0xae, 0xf4, 0x6f, 0xf8, 0x7d, 0xff, 0x14, 0x06, 
-0xea, 0x09, 0x54, 0x0a, 0x88, 0x09, 0x43, 0x09, 0x54, 0x0a, 0x90, 0x0b, 0x17, 0x0b, 0xec, 0x08, 
-0x25, 0x04, 0xbb, 0xfd, 0x7a, 0xf5, 0xfd, 0xed, 0xb8, 0xe7, 0x23, 0xe4, 0x5e, 0xe1, 0x87, 0xdf, 
-0xdf, 0xde, 0x7f, 0xe1, 0xb0, 0xe9, 0x6f, 0xf6, 0xf6, 0x03, 0x43, 0x0c, 0x14, 0x0f, 0x43, 0x0d, 
-0x51, 0x0c, 0xfa, 0x0d, 0x0b, 0x13, 0xe1, 0x16, 0x12, 0x17, 0xd7, 0x11, 0x90, 0x0a, 0xfd, 0x04, 
-0x96, 0x03, 0x79, 0x04, 0xac, 0x04, 0x74, 0x01, 0x06, 0xfb, 0x1b, 0xf5, 0xbf, 0xf3, 0x30, 0xf8, 
-0xe0, 0xff, 0xf1, 0x06, 0x17, 0x0a, 0x56, 0x0a, 0x3b, 0x09, 0xcb, 0x09, 0x71, 0x0b, 0x05, 0x0d, 
-0xc4, 0x0b, 0x46, 0x08, 0x7e, 0x02, 0x5d, 0xfc, 0x96, 0xf6, 0x91, 0xf1, 0xdf, 0xec, 0x0c, 0xe8, 
-0x14, 0xe3, 0x4d, 0xde, 0x72, 0xdc, 0xb7, 0xde, 0xdf, 0xe6, 0xba, 0xf2, 0x0a, 0xff, 0x5c, 0x07, 
-0x77, 0x0b, 0x8a, 0x0c, 0xe9, 0x0d, 0x2e, 0x11, 0x61, 0x15, 0xa2, 0x17, 0x78, 0x16, 0x64, 0x12, 
-0x3d, 0x0d, 0x30, 0x09, 0xa7, 0x06, 0xd9, 0x04, 0x32, 0x02, 0x50, 0xfe, 0x29, 0xfa, 0x8e, 0xf7, 
-0x43, 0xf7, 0xd5, 0xf9, 0xe7, 0xfd, 0xfc, 0x01, 0x2d, 0x05, 0xf4, 0x07, 0xb9, 0x09, 0x93, 0x0b, 
-0xd5, 0x0c, 0x1d, 0x0d, 0x44, 0x0b, 0x29, 0x08, 0x04, 0x04, 0x51, 0xff, 0xab, 0xf9, 0x99, 0xf3, 
-0x6b, 0xee, 0xf8, 0xe9, 0x38, 0xe6, 0xa8, 0xe1, 0xd9, 0xde, 0xac, 0xde, 0x40, 0xe3, 0x3e, 0xeb, 
-0x20, 0xf6, 0x1c, 0x00, 0xf1, 0x07, 0x6f, 0x0d, 0xd9, 0x10, 0xa3, 0x13, 0x58, 0x15, 0xdd, 0x16, 
-0x0a, 0x16, 0x22, 0x14, 0xc9, 0x0f, 0xb1, 0x0b, 0x57, 0x07, 0x90, 0x04, 0xc5, 0x02, 0xac, 0x00, 
-0x07, 0xfe, 0xdc, 0xfa, 0x02, 0xf9, 0x20, 0xf8, 0x1c, 0xfa, 0x34, 0xfd, 0x35, 0x02, 0x8f, 0x06, 
-0xde, 0x09, 0xc2, 0x0b, 0x1a, 0x0d, 0xb1, 0x0d, 0x96, 0x0c, 0x23, 0x0a, 0x06, 0x06, 0x06, 0x02, 
-0xa2, 0xfd, 0xcb, 0xf8, 0x46, 0xf3, 0x52, 0xee, 0xf0, 0xe9, 0x79, 0xe5, 0x44, 0xe1, 0x03, 0xde, 
-0x43, 0xde, 0x3d, 0xe3, 0xe0, 0xeb, 0x0d, 0xf6, 0xd6, 0xff, 0xf8, 0x07, 0x7b, 0x0d, 0x48, 0x11, 
-0x3a, 0x13, 0xa6, 0x14, 0x98, 0x15, 0x9f, 0x15, 0xcb, 0x13, 0x30, 0x10, 0xa5, 0x0b, 0x1a, 0x07, 
-0x26, 0x04, 0x09, 0x02, 0x9b, 0x00, 0xcc, 0xfe, 0x02, 0xfd, 0xbe, 0xfb, 0x67, 0xfb, 0x06, 0xfc, 
-0xcf, 0xfd, 0x3d, 0x01, 0x4f, 0x05, 0xd7, 0x08, 0x4d, 0x0b, 0x81, 0x0c, 0x4f, 0x0c, 0x28, 0x0b, 
-0x31, 0x09, 0x3a, 0x06, 0xe6, 0x02, 0x39, 0xfe, 0x67, 0xf8, 0x50, 0xf3, 0x47, 0xef, 0x62, 0xec, 
-0x8b, 0xe9, 0x5e, 0xe6, 0x8f, 0xe2, 0x67, 0xe1, 0x7a, 0xe3, 0x6d, 0xe9, 0x9d, 0xf2, 0x54, 0xfc, 
-0x9f, 0x04, 0xc4, 0x0a, 0xc1, 0x0e, 0x93, 0x10, 0xc4, 0x12, 0x0c, 0x14, 0x4f, 0x14, 0xc8, 0x12, 
-0xda, 0x0f, 0x51, 0x0c, 0x1e, 0x09, 0x83, 0x06, 0x8c, 0x03, 0xeb, 0x00, 0x3c, 0xfe, 0x8e, 0xfc, 
-0x67, 0xfb, 0x63, 0xfb, 0x34, 0xfc, 0xaa, 0xfd, 0xfc, 0xff, 0xf6, 0x02, 0xc1, 0x05, 0xa5, 0x07, 
-0x12, 0x09, 0x72, 0x09, 0x3a, 0x09, 0x93, 0x08, 0x84, 0x07, 0xdd, 0x05, 0x7b, 0x03, 0xd6, 0xff, 
-0x87, 0xfb, 0xa1, 0xf7, 0x52, 0xf4, 0x49, 0xf1, 0x66, 0xee, 0xb3, 0xea, 0xa7, 0xe7, 0x5d, 0xe6, 
-0x9b, 0xe7, 0x26, 0xeb, 0xd8, 0xef, 0xbe, 0xf4, 0x6b, 0xf9, 0xdd, 0xfe, 0x89, 0x03, 0xdc, 0x07, 
-0x98, 0x0b, 0xc8, 0x0e, 0xda, 0x10, 0x7f, 0x12, 0x39, 0x13, 0xcf, 0x12, 0x37, 0x12, 0x75, 0x10, 
-0xfa, 0x0d, 0x6b, 0x0a, 0xf3, 0x06, 0x98, 0x03, 0x4b, 0x01, 0xb7, 0xff, 0x77, 0xfe, 0x77, 0xfd, 
-0x1f, 0xfd, 0xc0, 0xfd, 0x24, 0xfe, 0x44, 0xff, 0x55, 0x00, 0x9c, 0x01, 0xb2, 0x02, 0x84, 0x03, 
-0xd5, 0x03, 0x86, 0x03, 0x6b, 0x02, 0x37, 0x00, 0xf8, 0xfd, 0x39, 0xfb, 0x8c, 0xf8, 0x98, 0xf5, 
-0xab, 0xf1, 0x63, 0xed, 0x5e, 0xea, 0xcd, 0xe8, 0x04, 0xe9, 0xcb, 0xea, 0xeb, 0xec, 0x39, 0xf0, 
-0x01, 0xf5, 0x55, 0xfa, 0xaa, 0xff, 0xdb, 0x04, 0xb0, 0x09, 0xbe, 0x0d, 0x52, 0x11, 0xc1, 0x13, 
-0x1e, 0x15, 0x45, 0x16, 0x63, 0x16, 0x56, 0x15, 0x88, 0x12, 0x55, 0x0f, 0xc1, 0x0b, 0x77, 0x08, 
-0x4c, 0x05, 0xc5, 0x01, 0xf4, 0xfe, 0x79, 0xfd, 0xd4, 0xfc, 0x36, 0xfc, 0x43, 0xfc, 0x58, 0xfc, 
-0xc6, 0xfc, 0xb7, 0xfd, 0xe9, 0xfe, 0xeb, 0xff, 0xf2, 0x00, 0x08, 0x01, 0x33, 0x00, 0x62, 0xff, 
-0xc9, 0xfd, 0x23, 0xfb, 0x8b, 0xf7, 0xa7, 0xf3, 0x84, 0xef, 0x79, 0xec, 0xca, 0xea, 0x85, 0xe9, 
-0x57, 0xea, 0x45, 0xec, 0x98, 0xef, 0x3f, 0xf4, 0x4b, 0xf9, 0x35, 0xfe, 0xf8, 0x02, 0xc8, 0x07, 
-0x16, 0x0c, 0xec, 0x0f, 0x9a, 0x12, 0x20, 0x14, 0xc3, 0x14, 0x80, 0x14, 0x2b, 0x13, 0x4f, 0x11, 
-0x80, 0x0e, 0x60, 0x0b, 0x44, 0x08, 0x5e, 0x05, 0x31, 0x03, 0x3f, 0x01, 0xc4, 0xff, 0xe3, 0xfe, 
-0x3e, 0xfe, 0xcd, 0xfd, 0xcf, 0xfd, 0x8a, 0xfd, 0xbb, 0xfd, 0x36, 0xfe, 0xf9, 0xfd, 0xea, 0xfd, 
-0x24, 0xfe, 0xe6, 0xfd, 0x6f, 0xfd, 0x5b, 0xfc, 0xca, 0xfa, 0x0c, 0xf9, 0xcc, 0xf6, 0xe3, 0xf3, 
-0xf1, 0xf0, 0xfb, 0xee, 0x8d, 0xed, 0xa8, 0xed, 0xf5, 0xee, 0xac, 0xf0, 0xab, 0xf3, 0x13, 0xf8, 
-0xc6, 0xfc, 0x01, 0x02, 0x66, 0x06, 0x0c, 0x0a, 0xfe, 0x0d, 0x70, 0x11, 0x31, 0x14, 0x3b, 0x15, 
-0x14, 0x15, 0x06, 0x14, 0x3a, 0x12, 0xc7, 0x0f, 0x75, 0x0c, 0x12, 0x09, 0xd1, 0x05, 0x0c, 0x03, 
-0xc4, 0x00, 0x94, 0xfe, 0xfc, 0xfc, 0x86, 0xfb, 0xc3, 0xfa, 0xc9, 0xfa, 0xec, 0xfa, 0x45, 0xfb, 
-0x75, 0xfb, 0xed, 0xfb, 0x7c, 0xfc, 0x0f, 0xfd, 0x6b, 0xfd, 0xd9, 0xfc, 0x05, 0xfc, 0xc5, 0xfa, 
-0x25, 0xf9, 0x02, 0xf7, 0x4a, 0xf4, 0x36, 0xf2, 0x1c, 0xf0, 0xb2, 0xee, 0x4f, 0xef, 0x6c, 0xf0, 
-0x8e, 0xf2, 0xfb, 0xf5, 0xf9, 0xf9, 0x64, 0xff, 0xb1, 0x04, 0xd4, 0x08, 0x75, 0x0c, 0xcf, 0x0f, 
-0x02, 0x13, 0x09, 0x15, 0x7c, 0x15, 0xa0, 0x14, 0x17, 0x13, 0x6c, 0x11, 0xe4, 0x0e, 0x82, 0x0b, 
-0x0a, 0x08, 0xec, 0x04, 0x5e, 0x02, 0x60, 0x00, 0x76, 0xfe, 0x9e, 0xfc, 0x74, 0xfb, 0x1a, 0xfb, 
-0x45, 0xfb, 0x8a, 0xfb, 0x8a, 0xfb, 0xfd, 0xfb, 0x8a, 0xfc, 0x04, 0xfd, 0x69, 0xfd, 0x11, 0xfd, 
-0x61, 0xfc, 0x6d, 0xfb, 0x17, 0xfa, 0x2f, 0xf8, 0x8c, 0xf5, 0x89, 0xf2, 0x23, 0xf0, 0x55, 0xee, 
-0x19, 0xed, 0x65, 0xed, 0xed, 0xee, 0xb9, 0xf1, 0xc8, 0xf5, 0x62, 0xfa, 0xa9, 0xff, 0xf7, 0x04, 
-0x8d, 0x09, 0x8e, 0x0d, 0xcf, 0x10, 0x73, 0x13, 0x4b, 0x15, 0x8e, 0x15, 0xa7, 0x14, 0x29, 0x13, 
-0x0f, 0x11, 0x2a, 0x0e, 0xe8, 0x0a, 0x48, 0x07, 0x0d, 0x04, 0xae, 0x01, 0x95, 0xff, 0xe6, 0xfd, 
-0x5d, 0xfc, 0x66, 0xfb, 0x71, 0xfb, 0xfc, 0xfb, 0x80, 0xfc, 0xc6, 0xfc, 0x76, 0xfd, 0x28, 0xfe, 
-0xa8, 0xfe, 0x19, 0xff, 0xd0, 0xfe, 0x0a, 0xfe, 0xe5, 0xfc, 0x48, 0xfb, 0x31, 0xf9, 0x4d, 0xf6, 
-0x5f, 0xf3, 0xc9, 0xf0, 0x37, 0xee, 0xbd, 0xec, 0xbe, 0xec, 0x37, 0xee, 0x8e, 0xf0, 0x0b, 0xf4, 
-0xdb, 0xf8, 0x49, 0xfe, 0xb4, 0x03, 0x53, 0x08, 0x60, 0x0c, 0x25, 0x10, 0x5e, 0x13, 0x1d, 0x15, 
-0x58, 0x15, 0x89, 0x14, 0x0c, 0x13, 0x24, 0x11, 0x3f, 0x0e, 0x93, 0x0a, 0xf0, 0x06, 0xee, 0x03, 
-0xb2, 0x01, 0xde, 0xff, 0x12, 0xfe, 0x94, 0xfc, 0x05, 0xfc, 0x1f, 0xfc, 0x73, 0xfc, 0xae, 0xfc, 
-0x00, 0xfd, 0xa8, 0xfd, 0x3e, 0xfe, 0x88, 0xfe, 0x90, 0xfe, 0x67, 0xfe, 0xdc, 0xfd, 0xba, 0xfc, 
-0x2a, 0xfb, 0x49, 0xf9, 0x15, 0xf7, 0x2e, 0xf4, 0x2d, 0xf1, 0xaa, 0xee, 0xe2, 0xec, 0x73, 0xec, 
-0x63, 0xed, 0x1f, 0xef, 0x57, 0xf2, 0xda, 0xf6, 0x0d, 0xfc, 0xb7, 0x01, 0xbe, 0x06, 0x86, 0x0b, 
-0xb0, 0x0f, 0x1c, 0x13, 0xa0, 0x15, 0x62, 0x16, 0xe0, 0x15, 0x81, 0x14, 0x8e, 0x12, 0xa5, 0x0f, 
-0xea, 0x0b, 0x2d, 0x08, 0x9d, 0x04, 0xc3, 0x01, 0xb2, 0xff, 0x0c, 0xfe, 0x9d, 0xfc, 0x95, 0xfb, 
-0x9d, 0xfb, 0x43, 0xfc, 0x83, 0xfc, 0xed, 0xfc, 0xb6, 0xfd, 0xe5, 0xfe, 0xf5, 0xff, 0x6f, 0x00, 
-0xd6, 0x00, 0x9a, 0x00, 0xa9, 0xff, 0x00, 0xfe, 0xf1, 0xfb, 0x31, 0xf9, 0xec, 0xf5, 0xc8, 0xf2, 
-0x99, 0xef, 0x02, 0xed, 0x7e, 0xeb, 0x43, 0xeb, 0x1a, 0xec, 0x7c, 0xee, 0x4d, 0xf2, 0x4d, 0xf7, 
-0x01, 0xfd, 0xbb, 0x02, 0x46, 0x08, 0x34, 0x0d, 0x95, 0x11, 0xa2, 0x14, 0x6a, 0x16, 0xf3, 0x16, 
-0x2d, 0x16, 0x7e, 0x14, 0xe4, 0x11, 0x95, 0x0e, 0xcf, 0x0a, 0xfc, 0x06, 0xa4, 0x03, 0xba, 0x00, 
-0xa9, 0xfe, 0x04, 0xfd, 0xe1, 0xfb, 0x82, 0xfb, 0x6f, 0xfb, 0xe7, 0xfb, 0x96, 0xfc, 0xa7, 0xfd, 
-0xa9, 0xfe, 0x70, 0xff, 0x41, 0x00, 0xe6, 0x00, 0x27, 0x01, 0x84, 0x00, 0x72, 0xff, 0xeb, 0xfd, 
-0x7e, 0xfb, 0xce, 0xf8, 0xd7, 0xf5, 0x67, 0xf2, 0x39, 0xef, 0xaf, 0xec, 0x43, 0xeb, 0x2c, 0xeb, 
-0x19, 0xec, 0x7c, 0xee, 0x2f, 0xf2, 0xe5, 0xf6, 0xa3, 0xfc, 0x8f, 0x02, 0x06, 0x08, 0xf9, 0x0c, 
-0xeb, 0x10, 0xd3, 0x13, 0x8e, 0x15, 0x03, 0x16, 0x5e, 0x15, 0xaf, 0x13, 0x3e, 0x11, 0xab, 0x0d, 
-0xe5, 0x09, 0xf9, 0x05, 0x63, 0x02, 0x38, 0x00, 0x29, 0xfe, 0x04, 0xfd, 0x89, 0xfc, 0x3b, 0xfc, 
-0xe4, 0xfc, 0x96, 0xfd, 0x59, 0xfe, 0x6e, 0xff, 0xb0, 0x00, 0x04, 0x02, 0x5b, 0x03, 0x07, 0x04, 
-0xda, 0x03, 0x57, 0x03, 0x23, 0x02, 0x89, 0x00, 0x3d, 0xfe, 0x30, 0xfb, 0xcf, 0xf7, 0x36, 0xf4, 
-0xcb, 0xf0, 0x8d, 0xed, 0xd9, 0xea, 0xb3, 0xe9, 0x18, 0xea, 0xd3, 0xeb, 0xe9, 0xee, 0xe7, 0xf2, 
-0x29, 0xf8, 0xe5, 0xfd, 0x57, 0x03, 0x3b, 0x08, 0x34, 0x0c, 0x6b, 0x0f, 0xcd, 0x11, 0x15, 0x13, 
-0x05, 0x13, 0xf7, 0x11, 0xd4, 0x0f, 0xed, 0x0c, 0xbc, 0x09, 0x90, 0x06, 0x5e, 0x03, 0x83, 0x00, 
-0x92, 0xfe, 0xe6, 0xfc, 0x81, 0xfc, 0x9f, 0xfc, 0xf9, 0xfc, 0x0d, 0xfe, 0x93, 0xff, 0x52, 0x01, 
-0x4c, 0x02, 0x5e, 0x03, 0x03, 0x04, 0xe1, 0x03, 0x7c, 0x03, 0x4e, 0x02, 0x29, 0x01, 0xe8, 0xff, 
-0x89, 0xfe, 0x4f, 0xfd, 0x73, 0xfb, 0xdb, 0xf9, 0x22, 0xf8, 0x83, 0xf6, 0xdb, 0xf5, 0x18, 0xf5, 
-0x24, 0xf5, 0x07, 0xf6, 0x84, 0xf7, 0x85, 0xf9, 0x76, 0xfb, 0xb7, 0xfd, 0xfb, 0xff, 0x79, 0x02, 
-0xc7, 0x04, 0x2d, 0x06, 0x09, 0x07, 0xfe, 0x07, 0x7c, 0x08, 0x5c, 0x08, 0xda, 0x07, 0xec, 0x06, 
-0x02, 0x06, 0xd3, 0x04, 0x7c, 0x03, 0x40, 0x02, 0x30, 0x01, 0x6d, 0x00, 0x0b, 0x00, 0xf9, 0xff, 
-0x2a, 0x00, 0x8e, 0x00, 0x75, 0x00, 0x1a, 0x01, 0x0e, 0x02, 0x58, 0x02, 0x4e, 0x03, 0x3b, 0x03, 
-0xe9, 0x01, 0x7d, 0x01, 0x00, 0x02, 0x19, 0x02, 0x03, 0x01, 0x9c, 0x00, 0xcb, 0xff, 0xf5, 0xfd, 
-0xe0, 0xfc, 0x37, 0xfc, 0x6d, 0xfb, 0x63, 0xfa, 0x7e, 0xf9, 0x6c, 0xf9, 0xc6, 0xf9, 0x52, 0xfa, 
-0x8b, 0xfb, 0x56, 0xfc, 0xf3, 0xfd, 0xcc, 0xff, 0xaa, 0x00, 0xc0, 0x01, 0xc6, 0x02, 0x3f, 0x03, 
-0xd9, 0x03, 0xa5, 0x04, 0xe9, 0x04, 0xa6, 0x03, 0x13, 0x08, 0x9e, 0x09, 0x14, 0x02, 0x7d, 0x00, 
-0x5b, 0x01, 0xfa, 0x00, 0x53, 0xff, 0xc7, 0xff, 0x02, 0x01, 0xfd, 0xff, 0xc0, 0xff, 0xa2, 0x00, 
-0x5c, 0x01, 0x00, 0x02, 0x3d, 0x02, 0x3f, 0x05, 0x87, 0x05, 0x74, 0x02, 0xdb, 0x01, 0x2b, 0x02, 
-0xba, 0x02, 0x1c, 0xfc, 0xaf, 0xf8, 0x69, 0xf7, 0xd8, 0xf4, 0x34, 0xf4, 0x27, 0xf3, 0xf2, 0xf5, 
-0x69, 0xf9, 0x03, 0xfb, 0xfe, 0xfb, 0xeb, 0xfc, 0xbb, 0x00, 0x48, 0x03, 0x78, 0x02, 0x72, 0x03, 
-0x15, 0x05, 0x6c, 0x06, 0xb6, 0x05, 0x1d, 0x04, 0x66, 0x04, 0x8b, 0x04, 0x5a, 0x04, 0x84, 0x03, 
-0x12, 0x03, 0x95, 0x03, 0xa9, 0x03, 0x7a, 0x03, 0x9b, 0x03, 0x05, 0x03, 0x7a, 0x02, 0x39, 0x03, 
-0x14, 0x03, 0x24, 0x02, 0x96, 0x01, 0x19, 0x00, 0x45, 0xfe, 0xbc, 0xfb, 0x20, 0xf8, 0xb6, 0xf5, 
-0x1f, 0xf3, 0x90, 0xf0, 0x23, 0xed, 0xfb, 0xeb, 0x9b, 0xef, 0xb7, 0xf6, 0x0d, 0x00, 0x42, 0x06, 
-0xe4, 0x09, 0x74, 0x0d, 0x52, 0x10, 0x7d, 0x0f, 0x4c, 0x0a, 0x7a, 0x04, 0x94, 0x02, 0xea, 0x01, 
-0x86, 0x00, 0xbb, 0xff, 0xea, 0xff, 0x9c, 0x02, 0x92, 0x04, 0x7e, 0x05, 0x9d, 0x06, 0x5f, 0x08, 
-0xee, 0x09, 0x48, 0x09, 0xd9, 0x07, 0x4b, 0x06, 0xbd, 0x04, 0x4a, 0x03, 0x7a, 0x01, 0x66, 0x00, 
-0x5e, 0x01, 0x90, 0x02, 0x83, 0x01, 0xfd, 0xfe, 0xb5, 0xfb, 0x4d, 0xf7, 0x84, 0xf2, 0x39, 0xeb, 
-0x72, 0xe5, 0x9d, 0xe4, 0xdd, 0xe3, 0xed, 0xe7, 0xb6, 0xf2, 0x0d, 0x01, 0x12, 0x0e, 0xf0, 0x13, 
-0x4b, 0x16, 0x23, 0x15, 0xc0, 0x0f, 0x56, 0x07, 0xbe, 0xfd, 0xe4, 0xf7, 0x13, 0xf6, 0x22, 0xf7, 
-0x7a, 0xf9, 0x07, 0xfd, 0x44, 0x03, 0xcc, 0x08, 0x80, 0x0c, 0x54, 0x0c, 0x0a, 0x0b, 0x11, 0x0b, 
-0x1f, 0x09, 0x99, 0x06, 0xd8, 0x02, 0xb6, 0x01, 0xdc, 0x02, 0x8f, 0x03, 0x9a, 0x03, 0x09, 0x03, 
-0x30, 0x03, 0xd6, 0x01, 0xd2, 0xfd, 0xc6, 0xf7, 0x0c, 0xf2, 0x27, 0xee, 0xfb, 0xe7, 0x8e, 0xe0, 
-0x01, 0xdc, 0xd5, 0xde, 0xea, 0xec, 0x1c, 0x01, 0xf8, 0x11, 0x8e, 0x19, 0xba, 0x1a, 0x3f, 0x19, 
-0xfa, 0x12, 0x2b, 0x06, 0x46, 0xf8, 0x25, 0xf0, 0xa8, 0xf0, 0x5d, 0xf6, 0x6e, 0xfc, 0xc0, 0x03, 
-0x06, 0x0c, 0x2a, 0x13, 0x3c, 0x14, 0x93, 0x0f, 0x58, 0x08, 0x07, 0x03, 0xdb, 0x02, 0x53, 0x01, 
-0x9b, 0xff, 0x87, 0x01, 0xc8, 0x06, 0xaa, 0x09, 0xb2, 0x07, 0x4e, 0x04, 0xf3, 0x01, 0x31, 0x00, 
-0x6d, 0xfc, 0x07, 0xf7, 0x6a, 0xf1, 0x04, 0xef, 0xc7, 0xec, 0xe9, 0xe5, 0x21, 0xde, 0x8a, 0xdc, 
-0xfa, 0xe5, 0xc9, 0xf8, 0x20, 0x0c, 0x28, 0x17, 0x8b, 0x1a, 0x8c, 0x1a, 0x3b, 0x17, 0x01, 0x0e, 
-0x0f, 0x00, 0xf4, 0xf3, 0xf8, 0xef, 0x55, 0xf4, 0x19, 0xfc, 0x8f, 0x02, 0x3b, 0x08, 0x97, 0x0e, 
-0x07, 0x13, 0xd6, 0x11, 0x2d, 0x0b, 0x63, 0x03, 0x51, 0x00, 0x96, 0x01, 0xa9, 0x01, 0x06, 0x01, 
-0x46, 0x03, 0xf2, 0x07, 0x57, 0x09, 0x89, 0x06, 0x61, 0x00, 0x0c, 0xfc, 0x2f, 0xfb, 0x7c, 0xfb, 
-0x69, 0xf9, 0xc5, 0xf4, 0x26, 0xf2, 0xe8, 0xec, 0x36, 0xe4, 0xd5, 0xdb, 0x14, 0xdd, 0x08, 0xec, 
-0x0f, 0x02, 0xae, 0x13, 0xb2, 0x18, 0x43, 0x17, 0xfc, 0x14, 0xa0, 0x10, 0x1c, 0x06, 0xe7, 0xf7, 
-0x08, 0xee, 0xf9, 0xee, 0xba, 0xf8, 0x00, 0x02, 0x0f, 0x07, 0xdf, 0x0a, 0xe5, 0x0f, 0xcc, 0x13, 
-0xab, 0x11, 0x58, 0x09, 0x97, 0xff, 0x5b, 0xfd, 0xee, 0x01, 0xc1, 0x04, 0x7f, 0x04, 0x59, 0x04, 
-0xaa, 0x06, 0x27, 0x08, 0xa6, 0x05, 0x04, 0xff, 0x46, 0xfa, 0x7a, 0xfa, 0xee, 0xfb, 0xe9, 0xf9, 
-0xf3, 0xf4, 0x3c, 0xee, 0xb1, 0xe6, 0x53, 0xe0, 0x3b, 0xde, 0x6f, 0xe6, 0x90, 0xf9, 0x96, 0x0e, 
-0xab, 0x19, 0x2e, 0x19, 0x7c, 0x13, 0x14, 0x0e, 0xbf, 0x07, 0x50, 0xfe, 0x18, 0xf4, 0xfb, 0xee, 
-0x16, 0xf3, 0xd7, 0xfc, 0xbf, 0x05, 0x00, 0x0b, 0xb4, 0x0c, 0x54, 0x0e, 0xc3, 0x0f, 0x82, 0x0c, 
-0xcf, 0x04, 0xf6, 0xfe, 0x7f, 0xff, 0x01, 0x04, 0xba, 0x07, 0x4c, 0x07, 0x28, 0x05, 0x27, 0x04, 
-0x5d, 0x04, 0x8e, 0x02, 0x52, 0xff, 0xfa, 0xfb, 0x14, 0xfb, 0x4d, 0xfb, 0x15, 0xf9, 0x2e, 0xf3, 
-0xe9, 0xe8, 0xe5, 0xdf, 0x85, 0xdc, 0xca, 0xe2, 0x14, 0xf4, 0xaf, 0x07, 0x5a, 0x14, 0x48, 0x18, 
-0x93, 0x15, 0x9a, 0x11, 0x3a, 0x0c, 0x94, 0x03, 0xb3, 0xf8, 0xcb, 0xf0, 0xd8, 0xef, 0x3b, 0xf6, 
-0x7c, 0xff, 0x3f, 0x06, 0x82, 0x0a, 0x76, 0x0c, 0x76, 0x0e, 0x18, 0x0e, 0x63, 0x09, 0x5a, 0x04, 
-0x96, 0x01, 0xe8, 0x01, 0xd0, 0x04, 0xfd, 0x06, 0x86, 0x06, 0xec, 0x04, 0x9f, 0x03, 0x8f, 0x02, 
-0xd3, 0x00, 0xcb, 0xfd, 0xb5, 0xfb, 0xe0, 0xfa, 0x03, 0xf9, 0x5f, 0xf6, 0x8b, 0xef, 0x3c, 0xe6, 
-0xd5, 0xdf, 0x42, 0xe1, 0xf9, 0xed, 0xa0, 0x00, 0x2c, 0x0f, 0x44, 0x15, 0x57, 0x14, 0x42, 0x11, 
-0xff, 0x0e, 0xb0, 0x09, 0x19, 0x00, 0x6a, 0xf5, 0xe7, 0xef, 0x8c, 0xf3, 0xe9, 0xfb, 0xf4, 0x02, 
-0xaa, 0x06, 0x1d, 0x08, 0x12, 0x0a, 0xe1, 0x0c, 0xbd, 0x0c, 0x38, 0x09, 0x0f, 0x05, 0x81, 0x02, 
-0xa1, 0x02, 0x2a, 0x04, 0x80, 0x04, 0x08, 0x03, 0xfc, 0x00, 0x0e, 0x00, 0xc3, 0x00, 0x55, 0x00, 
-0x7b, 0xfe, 0x55, 0xfa, 0x32, 0xf6, 0xb6, 0xf3, 0xfa, 0xf0, 0x03, 0xec, 0x72, 0xe5, 0x65, 0xe3, 
-0x92, 0xeb, 0x8b, 0xfc, 0x84, 0x0d, 0xce, 0x15, 0x44, 0x15, 0x30, 0x10, 0x9e, 0x0b, 0x0f, 0x08, 
-0x7a, 0x02, 0xf5, 0xfa, 0x4d, 0xf4, 0xb6, 0xf3, 0x42, 0xf9, 0x25, 0x01, 0xcf, 0x06, 0x6c, 0x08, 
-0x7b, 0x08, 0x07, 0x09, 0xe0, 0x09, 0x7f, 0x0a, 0xa3, 0x09, 0x0b, 0x07, 0xaf, 0x04, 0x05, 0x03, 
-0xab, 0x02, 0xd0, 0x02, 0xc9, 0x01, 0x2e, 0x00, 0x78, 0xfe, 0xc3, 0xfd, 0xb8, 0xfd, 0x22, 0xfc, 
-0x42, 0xf9, 0xf7, 0xf4, 0x29, 0xef, 0x0f, 0xea, 0xed, 0xe5, 0x0f, 0xe6, 0x25, 0xee, 0x75, 0xfb, 
-0x39, 0x09, 0x00, 0x12, 0xeb, 0x13, 0xbc, 0x11, 0x22, 0x0d, 0x6c, 0x08, 0xe8, 0x02, 0x72, 0xfc, 
-0x5a, 0xf7, 0x8b, 0xf5, 0x85, 0xf8, 0xee, 0xfd, 0x61, 0x02, 0x36, 0x05, 0xf1, 0x06, 0x0b, 0x09, 
-0x2d, 0x0a, 0xe5, 0x0a, 0xb0, 0x0a, 0xa8, 0x08, 0x08, 0x07, 0xe1, 0x04, 0x06, 0x03, 0x47, 0x02, 
-0x66, 0x01, 0x9c, 0x00, 0x72, 0xff, 0xf1, 0xfd, 0x00, 0xfd, 0xe2, 0xfa, 0x77, 0xf8, 0x86, 0xf5, 
-0x1a, 0xf1, 0xfd, 0xeb, 0x1f, 0xe7, 0x37, 0xe6, 0xad, 0xed, 0xef, 0xfa, 0xb7, 0x08, 0x47, 0x11, 
-0x61, 0x12, 0xaa, 0x0f, 0xf4, 0x0b, 0x1b, 0x09, 0x24, 0x06, 0x4d, 0x01, 0xd4, 0xfb, 0x5a, 0xf7, 
-0xc7, 0xf6, 0x68, 0xfa, 0x62, 0xff, 0xdf, 0x03, 0xe1, 0x05, 0x01, 0x07, 0x79, 0x08, 0x05, 0x0b, 
-0x49, 0x0d, 0x5d, 0x0c, 0xd6, 0x08, 0xb8, 0x03, 0xf9, 0xff, 0x3e, 0xff, 0x77, 0x00, 0xc3, 0x01, 
-0x0b, 0x01, 0x43, 0xfe, 0xf3, 0xfa, 0x3e, 0xf8, 0x28, 0xf7, 0xfc, 0xf5, 0xf4, 0xf2, 0xbb, 0xed, 
-0x70, 0xe8, 0xdc, 0xe7, 0x9b, 0xee, 0x3c, 0xfb, 0x22, 0x08, 0x1a, 0x10, 0x99, 0x11, 0xa4, 0x0e, 
-0x4e, 0x0b, 0xb5, 0x08, 0xa0, 0x06, 0x78, 0x03, 0x4f, 0xfe, 0x00, 0xfa, 0xc9, 0xf7, 0x9f, 0xf9, 
-0x68, 0xfd, 0x1e, 0x01, 0x17, 0x04, 0x5a, 0x05, 0x63, 0x07, 0x65, 0x0a, 0x04, 0x0d, 0x81, 0x0d, 
-0x43, 0x0a, 0xeb, 0x04, 0xe7, 0xff, 0xa0, 0xfd, 0x9c, 0xfe, 0x61, 0x00, 0xfb, 0x00, 0x2c, 0xff, 
-0xca, 0xfb, 0xad, 0xf8, 0xf3, 0xf6, 0xe3, 0xf5, 0xcc, 0xf3, 0xe2, 0xef, 0x98, 0xeb, 0x5f, 0xea, 
-0x45, 0xef, 0x94, 0xf9, 0xa5, 0x05, 0x0f, 0x0e, 0xb0, 0x10, 0xac, 0x0e, 0x22, 0x0b, 0x69, 0x08, 
-0x7b, 0x06, 0x6d, 0x04, 0x0d, 0x01, 0x59, 0xfd, 0x95, 0xfa, 0x74, 0xfa, 0x59, 0xfc, 0x5f, 0xff, 
-0x23, 0x02, 0xf1, 0x03, 0xb3, 0x05, 0xf0, 0x07, 0x83, 0x0a, 0x47, 0x0c, 0x81, 0x0b, 0x1d, 0x08, 
-0x57, 0x03, 0x65, 0xff, 0xa6, 0xfd, 0x03, 0xfe, 0xcd, 0xfe, 0x8c, 0xfe, 0x8f, 0xfc, 0x75, 0xf9, 
-0xd1, 0xf6, 0x6b, 0xf4, 0x00, 0xf3, 0x0d, 0xf1, 0x1b, 0xef, 0x46, 0xee, 0x79, 0xf0, 0xf9, 0xf6, 
-0x0e, 0x00, 0xc1, 0x08, 0xe7, 0x0d, 0xf4, 0x0e, 0xf7, 0x0c, 0x04, 0x0a, 0x75, 0x07, 0x6f, 0x05, 
-0x19, 0x03, 0x57, 0x00, 0x51, 0xfd, 0x83, 0xfb, 0xd9, 0xfa, 0x31, 0xfc, 0xe3, 0xfe, 0x51, 0x02, 
-0x38, 0x06, 0x42, 0x09, 0x61, 0x0b, 0xe7, 0x0b, 0xcf, 0x0a, 0x33, 0x08, 0xa8, 0x04, 0x4b, 0x01, 
-0xcf, 0xfe, 0x8d, 0xfd, 0x71, 0xfd, 0x92, 0xfd, 0x3d, 0xfd, 0x91, 0xfb, 0x10, 0xf9, 0x83, 0xf5, 
-0xa1, 0xf2, 0x8b, 0xf0, 0xb1, 0xef, 0x1a, 0xf0, 0xbc, 0xf1, 0xbc, 0xf5, 0x9c, 0xfb, 0xf8, 0x02, 
-0xa1, 0x09, 0xc4, 0x0d, 0x60, 0x0e, 0x0b, 0x0c, 0x64, 0x08, 0x5b, 0x05, 0x33, 0x03, 0xc1, 0x01, 
-0x2f, 0x00, 0x7d, 0xfe, 0xf2, 0xfc, 0x4d, 0xfc, 0x28, 0xfd, 0xde, 0xff, 0xc6, 0x03, 0xc6, 0x07, 
-0xb6, 0x0a, 0xb8, 0x0b, 0xea, 0x0a, 0x56, 0x08, 0x25, 0x05, 0x15, 0x02, 0xf5, 0xff, 0xa2, 0xfe, 
-0xcf, 0xfd, 0xd6, 0xfc, 0xa4, 0xfb, 0x2e, 0xfa, 0xcf, 0xf8, 0x3d, 0xf7, 0x9d, 0xf5, 0x7f, 0xf3, 
-0x85, 0xf1, 0x6d, 0xf0, 0xfc, 0xf0, 0x4b, 0xf4, 0x90, 0xf9, 0x5e, 0x00, 0xa0, 0x06, 0x2c, 0x0b, 
-0x2c, 0x0d, 0x8c, 0x0c, 0x6b, 0x0a, 0xea, 0x07, 0xb4, 0x05, 0xf0, 0x03, 0x3c, 0x02, 0x9f, 0x00, 
-0x18, 0xff, 0xf5, 0xfd, 0x75, 0xfd, 0x53, 0xfe, 0x9a, 0x00, 0xdf, 0x03, 0x2c, 0x07, 0x79, 0x09, 
-0x39, 0x0a, 0x10, 0x09, 0xa0, 0x06, 0xad, 0x03, 0x2f, 0x01, 0x20, 0xff, 0xa3, 0xfd, 0x1a, 0xfc, 
-0xa8, 0xfa, 0x5f, 0xf9, 0x65, 0xf8, 0xd8, 0xf7, 0x25, 0xf7, 0xd1, 0xf5, 0xc8, 0xf3, 0xbc, 0xf1, 
-0x0e, 0xf1, 0xf6, 0xf2, 0x87, 0xf7, 0xd5, 0xfd, 0x2e, 0x04, 0x24, 0x09, 0xd9, 0x0b, 0x2e, 0x0c, 
-0xdf, 0x0a, 0xbc, 0x08, 0x92, 0x06, 0x9e, 0x04, 0xfa, 0x02, 0x8f, 0x01, 0x34, 0x00, 0x0d, 0xff, 
-0x40, 0xfe, 0x8d, 0xfe, 0x1d, 0x00, 0xb2, 0x02, 0xa1, 0x05, 0x0b, 0x08, 0x86, 0x09, 0x6b, 0x09, 
-0xf1, 0x07, 0x92, 0x05, 0xeb, 0x02, 0x7a, 0x00, 0x43, 0xfe, 0x7a, 0xfc, 0xe7, 0xfa, 0x55, 0xf9, 
-0x02, 0xf8, 0xf3, 0xf6, 0x19, 0xf6, 0x4a, 0xf5, 0x07, 0xf4, 0x01, 0xf3, 0x66, 0xf2, 0x7d, 0xf3, 
-0x99, 0xf6, 0x6c, 0xfb, 0x49, 0x01, 0x90, 0x06, 0x76, 0x0a, 0x14, 0x0c, 0xbc, 0x0b, 0x04, 0x0a, 
-0xb2, 0x07, 0x93, 0x05, 0xdb, 0x03, 0x93, 0x02, 0x7d, 0x01, 0x3a, 0x00, 0x48, 0xff, 0x86, 0xfe, 
-0xf7, 0xfe, 0x8a, 0x00, 0xff, 0x02, 0xfc, 0x05, 0x34, 0x08, 0x66, 0x09, 0xbd, 0x08, 0xd0, 0x06, 
-0x1e, 0x04, 0x8a, 0x01, 0x55, 0xff, 0x86, 0xfd, 0xf5, 0xfb, 0x48, 0xfa, 0xa1, 0xf8, 0x19, 0xf7, 
-0x1b, 0xf6, 0x53, 0xf5, 0x92, 0xf4, 0x91, 0xf3, 0xff, 0xf2, 0x38, 0xf3, 0x50, 0xf5, 0x3e, 0xf9, 
-0x94, 0xfe, 0x47, 0x04, 0xe6, 0x08, 0xc2, 0x0b, 0x48, 0x0c, 0x22, 0x0b, 0xc2, 0x08, 0x51, 0x06, 
-0x38, 0x04, 0xf6, 0x02, 0x18, 0x02, 0x5a, 0x01, 0x8e, 0x00, 0xd0, 0xff, 0x8f, 0xff, 0x03, 0x00, 
-0x82, 0x01, 0x91, 0x03, 0xbd, 0x05, 0x48, 0x07, 0xd7, 0x07, 0x2d, 0x07, 0x8b, 0x05, 0x64, 0x03, 
-0x11, 0x01, 0xd8, 0xfe, 0xe0, 0xfc, 0x1a, 0xfb, 0x74, 0xf9, 0xfe, 0xf7, 0xed, 0xf6, 0xf3, 0xf5, 
-0xcd, 0xf4, 0xa7, 0xf3, 0xac, 0xf2, 0x8d, 0xf2, 0xf4, 0xf3, 0x65, 0xf7, 0x65, 0xfc, 0x05, 0x02, 
-0x23, 0x07, 0xaa, 0x0a, 0x37, 0x0c, 0xc1, 0x0b, 0x05, 0x0a, 0xc9, 0x07, 0xa7, 0x05, 0xf5, 0x03, 
-0xc9, 0x02, 0xdc, 0x01, 0xf3, 0x00, 0x1f, 0x00, 0x92, 0xff, 0xad, 0xff, 0x8c, 0x00, 0x10, 0x02, 
-0x00, 0x04, 0xe8, 0x05, 0x3e, 0x07, 0x71, 0x07, 0x92, 0x06, 0xb0, 0x04, 0x48, 0x02, 0xc4, 0xff, 
-0x78, 0xfd, 0xa0, 0xfb, 0xef, 0xf9, 0x9d, 0xf8, 0x8e, 0xf7, 0x6a, 0xf6, 0x23, 0xf5, 0xab, 0xf3, 
-0x2d, 0xf2, 0xa1, 0xf1, 0x8e, 0xf2, 0x97, 0xf5, 0x51, 0xfa, 0xea, 0xff, 0x5a, 0x05, 0x5b, 0x09, 
-0xa0, 0x0b, 0xf7, 0x0b, 0x00, 0x0b, 0x40, 0x09, 0x3c, 0x07, 0x7a, 0x05, 0x16, 0x04, 0x0c, 0x03, 
-0xf9, 0x01, 0xd2, 0x00, 0xe1, 0xff, 0x5e, 0xff, 0xb7, 0xff, 0x06, 0x01, 0x05, 0x03, 0x3b, 0x05, 
-0xdc, 0x06, 0x57, 0x07, 0x9f, 0x06, 0xf2, 0x04, 0xaf, 0x02, 0x63, 0x00, 0x53, 0xfe, 0xa6, 0xfc, 
-0x17, 0xfb, 0xc2, 0xf9, 0x6c, 0xf8, 0xec, 0xf6, 0x99, 0xf5, 0x20, 0xf4, 0xcb, 0xf2, 0x04, 0xf2, 
-0x63, 0xf2, 0x65, 0xf4, 0x35, 0xf8, 0x78, 0xfd, 0x20, 0x03, 0xe0, 0x07, 0xea, 0x0a, 0x05, 0x0c, 
-0x86, 0x0b, 0x1c, 0x0a, 0x59, 0x08, 0xcc, 0x06, 0x93, 0x05, 0xa6, 0x04, 0x7a, 0x03, 0x0e, 0x02, 
-0x60, 0x00, 0xf0, 0xfe, 0x8c, 0xfe, 0x72, 0xff, 0x7e, 0x01, 0xf1, 0x03, 0x13, 0x06, 0xfa, 0x06, 
-0xa3, 0x06, 0x46, 0x05, 0x3c, 0x03, 0x21, 0x01, 0x2d, 0xff, 0x8c, 0xfd, 0x22, 0xfc, 0x97, 0xfa, 
-0xda, 0xf8, 0x0b, 0xf7, 0x8d, 0xf5, 0x36, 0xf4, 0xe4, 0xf2, 0x08, 0xf2, 0xde, 0xf1, 0x18, 0xf3, 
-0x06, 0xf6, 0xb8, 0xfa, 0x4e, 0x00, 0x7c, 0x05, 0x44, 0x09, 0x0b, 0x0b, 0x15, 0x0b, 0xde, 0x09, 
-0x60, 0x08, 0x01, 0x07, 0x03, 0x06, 0x1d, 0x05, 0xfb, 0x03, 0x80, 0x02, 0xaf, 0x00, 0x24, 0xff, 
-0x7d, 0xfe, 0x1b, 0xff, 0xd7, 0x00, 0x2e, 0x03, 0x76, 0x05, 0x04, 0x07, 0x6f, 0x07, 0xbf, 0x06, 
-0x29, 0x05, 0x1d, 0x03, 0x19, 0x01, 0x5a, 0xff, 0xc0, 0xfd, 0xea, 0xfb, 0x05, 0xfa, 0x31, 0xf8, 
-0xb0, 0xf6, 0x73, 0xf5, 0x01, 0xf4, 0xa3, 0xf2, 0xbe, 0xf1, 0x03, 0xf2, 0x14, 0xf4, 0x10, 0xf8, 
-0x62, 0xfd, 0xfa, 0x02, 0xb6, 0x07, 0xae, 0x0a, 0xbf, 0x0b, 0x1b, 0x0b, 0xb3, 0x09, 0x1b, 0x08, 
-0xb6, 0x06, 0x7f, 0x05, 0x2a, 0x04, 0xc4, 0x02, 0x23, 0x01, 0xc6, 0xff, 0xe7, 0xfe, 0xea, 0xfe, 
-0xec, 0xff, 0xa0, 0x01, 0xb5, 0x03, 0xb1, 0x05, 0x0d, 0x07, 0x34, 0x07, 0x51, 0x06, 0x77, 0x04, 
-0x4d, 0x02, 0x4b, 0x00, 0x65, 0xfe, 0x93, 0xfc, 0x9d, 0xfa, 0xac, 0xf8, 0x01, 0xf7, 0xc4, 0xf5, 
-0x8d, 0xf4, 0x4c, 0xf3, 0x5d, 0xf2, 0xdc, 0xf1, 0x6a, 0xf2, 0xc0, 0xf4, 0x12, 0xf9, 0x8b, 0xfe, 
-0xf5, 0x03, 0x62, 0x08, 0xee, 0x0a, 0x9f, 0x0b, 0xd0, 0x0a, 0x56, 0x09, 0x08, 0x08, 0xc6, 0x06, 
-0xc3, 0x05, 0xac, 0x04, 0x16, 0x03, 0x4d, 0x01, 0x8f, 0xff, 0x9e, 0xfe, 0xdd, 0xfe, 0x7c, 0x00, 
-0xd5, 0x02, 0x0a, 0x05, 0xc5, 0x06, 0x41, 0x07, 0xab, 0x06, 0x17, 0x05, 0xe5, 0x02, 0x00, 0x01, 
-0x61, 0xff, 0xf7, 0xfd, 0x79, 0xfc, 0x91, 0xfa, 0x60, 0xf8, 0x44, 0xf6, 0xb4, 0xf4, 0x7e, 0xf3, 
-0x54, 0xf2, 0x3e, 0xf1, 0xd6, 0xf0, 0x47, 0xf2, 0x0c, 0xf6, 0xcc, 0xfb, 0x1e, 0x02, 0xba, 0x07, 
-0x80, 0x0b, 0xe9, 0x0c, 0x73, 0x0c, 0xb9, 0x0a, 0x0d, 0x09, 0xe1, 0x07, 0x1a, 0x07, 0x2c, 0x06, 
-0xa1, 0x04, 0x9e, 0x02, 0x65, 0x00, 0xc7, 0xfe, 0x76, 0xfe, 0xd1, 0xff, 0x0e, 0x02, 0x8e, 0x04, 
-0x97, 0x06, 0x90, 0x07, 0xa4, 0x07, 0x8d, 0x06, 0xd9, 0x04, 0xe9, 0x02, 0x10, 0x01, 0x4b, 0xff, 
-0x64, 0xfd, 0x73, 0xfb, 0x0a, 0xf9, 0xb9, 0xf6, 0xf5, 0xf4, 0x69, 0xf3, 0xdb, 0xf1, 0x72, 0xf0, 
-0x8f, 0xef, 0x18, 0xf0, 0xd0, 0xf2, 0x94, 0xf7, 0x9b, 0xfd, 0x9e, 0x03, 0x57, 0x08, 0xf3, 0x0a, 
-0x94, 0x0b, 0xee, 0x0a, 0xd3, 0x09, 0xc1, 0x08, 0xdf, 0x07, 0xda, 0x06, 0x5e, 0x05, 0x65, 0x03, 
-0x1c, 0x01, 0x3b, 0xff, 0x41, 0xfe, 0x8c, 0xfe, 0x19, 0x00, 0x85, 0x02, 0x0a, 0x05, 0xe4, 0x06, 
-0xca, 0x07, 0x8b, 0x07, 0x55, 0x06, 0x59, 0x04, 0x4f, 0x02, 0x81, 0x00, 0x90, 0xfe, 0x61, 0xfc, 
-0x22, 0xfa, 0x20, 0xf8, 0x3a, 0xf6, 0x91, 0xf4, 0x42, 0xf3, 0xdb, 0xf1, 0x54, 0xf0, 0x72, 0xef, 
-0x60, 0xf0, 0xad, 0xf3, 0x20, 0xf9, 0xd5, 0xff, 0x19, 0x06, 0x6d, 0x0a, 0x48, 0x0c, 0x53, 0x0c, 
-0x2b, 0x0b, 0xad, 0x09, 0xb4, 0x08, 0xe8, 0x07, 0xf5, 0x06, 0x5e, 0x05, 0x2f, 0x03, 0xe5, 0x00, 
-0x02, 0xff, 0x36, 0xfe, 0xfc, 0xfe, 0x4a, 0x01, 0x3d, 0x04, 0x3d, 0x07, 0x2e, 0x09, 0xb6, 0x09, 
-0xd4, 0x08, 0xf8, 0x06, 0xc6, 0x04, 0x44, 0x02, 0xf6, 0xff, 0x89, 0xfd, 0xea, 0xfa, 0x56, 0xf8, 
-0x4d, 0xf6, 0xc4, 0xf4, 0xb9, 0xf3, 0x93, 0xf2, 0xeb, 0xf0, 0x68, 0xef, 0x73, 0xee, 0xf8, 0xef, 
-0x09, 0xf4, 0x32, 0xfa, 0x3e, 0x01, 0x5a, 0x07, 0x98, 0x0b, 0xdd, 0x0c, 0x49, 0x0c, 0xa4, 0x0a, 
-0x5e, 0x09, 0xcd, 0x08, 0x1d, 0x08, 0x21, 0x07, 0xf0, 0x04, 0x5c, 0x02, 0xcd, 0xff, 0x0c, 0xfe, 
-0xfe, 0xfd, 0x9e, 0xff, 0xbc, 0x02, 0x1e, 0x06, 0xb9, 0x08, 0xef, 0x09, 0xc0, 0x09, 0x99, 0x08, 
-0xa9, 0x06, 0x23, 0x04, 0x75, 0x01, 0x08, 0xff, 0xd3, 0xfc, 0x1a, 0xfa, 0x8d, 0xf7, 0x97, 0xf5, 
-0x38, 0xf4, 0x41, 0xf3, 0x98, 0xf1, 0x1f, 0xef, 0x6c, 0xec, 0x1f, 0xeb, 0x09, 0xed, 0x0c, 0xf3, 
-0xc7, 0xfb, 0xa0, 0x04, 0x4b, 0x0b, 0x7f, 0x0e, 0x93, 0x0e, 0xb7, 0x0c, 0x85, 0x0a, 0xe2, 0x08, 
-0xbf, 0x07, 0x66, 0x06, 0x8b, 0x04, 0x22, 0x02, 0x78, 0xff, 0x57, 0xfd, 0xfe, 0xfc, 0x02, 0xff, 
-0x9d, 0x02, 0xbc, 0x06, 0x02, 0x0a, 0x7f, 0x0b, 0x79, 0x0b, 0x10, 0x0a, 0x1d, 0x08, 0xf8, 0x05, 
-0xa5, 0x03, 0x65, 0x02, 0x74, 0xff, 0x13, 0xfb, 0x94, 0xf7, 0x33, 0xf5, 0x76, 0xf4, 0x0c, 0xf4, 
-0xfa, 0xf2, 0xfc, 0xef, 0xb1, 0xeb, 0x22, 0xe9, 0x25, 0xea, 0x4c, 0xf0, 0xed, 0xf9, 0xda, 0x04, 
-0xa3, 0x0d, 0xbe, 0x11, 0x88, 0x11, 0xce, 0x0d, 0xd6, 0x09, 0xb9, 0x06, 0x4e, 0x05, 0x47, 0x04, 
-0xdb, 0x02, 0x71, 0x00, 0x12, 0xfd, 0x0c, 0xfb, 0x0a, 0xfb, 0x6c, 0xfe, 0xdc, 0x03, 0x71, 0x09, 
-0x46, 0x0d, 0xf6, 0x0d, 0xb6, 0x0c, 0x12, 0x0a, 0x5b, 0x07, 0x22, 0x05, 0x1a, 0x03, 0xff, 0x00, 
-0x49, 0xfe, 0x85, 0xfb, 0x8b, 0xf9, 0x8e, 0xf8, 0x0a, 0xf8, 0x3d, 0xf7, 0x7b, 0xf5, 0x8d, 0xf2, 
-0xbf, 0xed, 0x80, 0xe8, 0x13, 0xe6, 0xe6, 0xe7, 0x76, 0xf0, 0x75, 0xfd, 0xa4, 0x0a, 0xaf, 0x13, 
-0x43, 0x15, 0xdf, 0x11, 0xbc, 0x0b, 0x89, 0x06, 0x5a, 0x03, 0x02, 0x02, 0x30, 0x01, 0x46, 0xff, 
-0x27, 0xfd, 0x6a, 0xfb, 0x56, 0xfc, 0xb3, 0xff, 0x56, 0x05, 0x20, 0x0b, 0xb4, 0x0e, 0x9b, 0x0f, 
-0x5b, 0x0d, 0x20, 0x0a, 0x91, 0x06, 0xe3, 0x03, 0xe3, 0x01, 0xb9, 0x00, 0x89, 0xff, 0x0f, 0xfe, 
-0x90, 0xfd, 0x54, 0xfd, 0x29, 0xfd, 0x3a, 0xfb, 0x1b, 0xf8, 0x69, 0xf3, 0xff, 0xee, 0xc4, 0xea, 
-0x1d, 0xe7, 0x47, 0xe6, 0x05, 0xe8, 0xcc, 0xf0, 0xc7, 0xfd, 0x7c, 0x0c, 0x33, 0x17, 0xdd, 0x19, 
-0x04, 0x16, 0x0a, 0x0d, 0xbc, 0x04, 0xd5, 0xfd, 0xe0, 0xfa, 0xdf, 0xf9, 0xbe, 0xf9, 0x3a, 0xfb, 
-0x08, 0xfd, 0xb4, 0x01, 0x0a, 0x07, 0xbf, 0x0c, 0xc6, 0x0f, 0x4d, 0x0f, 0xa5, 0x0c, 0x17, 0x08, 
-0x49, 0x05, 0x9c, 0x02, 0xec, 0x01, 0xe5, 0x01, 0x11, 0x02, 0x02, 0x02, 0xc4, 0x00, 0xca, 0xff, 
-0xbb, 0xfd, 0xa0, 0xfc, 0x2f, 0xfa, 0x6d, 0xf7, 0xd4, 0xf3, 0x0b, 0xf0, 0x17, 0xec, 0xbc, 0xe6, 
-0x0b, 0xe3, 0xeb, 0xe3, 0x79, 0xed, 0x4c, 0xfe, 0xea, 0x10, 0x62, 0x1c, 0x44, 0x1d, 0xa8, 0x13, 
-0x75, 0x06, 0x3c, 0xfc, 0x20, 0xf8, 0x63, 0xf9, 0x63, 0xfb, 0x7a, 0xfd, 0xed, 0xfe, 0xde, 0x02, 
-0xf4, 0x08, 0x69, 0x0f, 0xcf, 0x11, 0xff, 0x0d, 0x18, 0x07, 0xaa, 0x01, 0x2f, 0x01, 0x46, 0x03, 
-0xa8, 0x05, 0xe2, 0x05, 0xe8, 0x04, 0x1c, 0x04, 0x2a, 0x04, 0x6e, 0x04, 0x4a, 0x02, 0x3c, 0xfe, 
-0x75, 0xf9, 0xa0, 0xf7, 0x34, 0xf8, 0xff, 0xf9, 0xef, 0xf9, 0xf9, 0xf3, 0x5f, 0xea, 0x7c, 0xdf, 
-0xb9, 0xdc, 0x34, 0xe5, 0xac, 0xf7, 0xf6, 0x0b, 0x80, 0x18, 0xe4, 0x1a, 0xa0, 0x12, 0xdc, 0x08, 
-0x80, 0xff, 0x97, 0xf9, 0x85, 0xf5, 0xd9, 0xf3, 0x71, 0xf6, 0xac, 0xfc, 0x14, 0x07, 0x01, 0x0f, 
-0xf6, 0x12, 0x94, 0x10, 0xf8, 0x0a, 0xe2, 0x04, 0x9a, 0x00, 0x37, 0x00, 0x43, 0x02, 0xf6, 0x04, 
-0x45, 0x07, 0x38, 0x08, 0x45, 0x07, 0x17, 0x05, 0xa8, 0x01, 0x37, 0xff, 0x7b, 0xfd, 0x5f, 0xfe, 
-0xdb, 0x00, 0x12, 0x03, 0x0e, 0x03, 0x7b, 0xfe, 0x9c, 0xf7, 0xeb, 0xee, 0x02, 0xe7, 0xac, 0xdf, 
-0x98, 0xdc, 0xf6, 0xe1, 0xfe, 0xef, 0xdd, 0x05, 0x6d, 0x18, 0xa6, 0x21, 0x49, 0x1c, 0x49, 0x0d, 
-0xed, 0xfd, 0xd0, 0xf2, 0x61, 0xef, 0xc0, 0xef, 0xb9, 0xf5, 0x74, 0xfe, 0x3c, 0x0a, 0x0c, 0x14, 
-0x0c, 0x17, 0x75, 0x12, 0xe5, 0x07, 0xbc, 0xff, 0x52, 0xfc, 0x72, 0xff, 0x13, 0x04, 0x02, 0x08, 
-0x5f, 0x09, 0x64, 0x08, 0x9f, 0x06, 0xe7, 0x03, 0x61, 0x01, 0xbf, 0xfe, 0xb7, 0xfe, 0x45, 0x00, 
-0xfd, 0x02, 0xe6, 0x04, 0x03, 0x04, 0xa3, 0xff, 0xac, 0xf7, 0xa6, 0xf0, 0x5a, 0xea, 0x89, 0xe5, 
-0xb2, 0xe2, 0x75, 0xe3, 0x9a, 0xea, 0x22, 0xf8, 0xb7, 0x0a, 0x7d, 0x18, 0xbb, 0x1b, 0xd0, 0x11, 
-0x63, 0x02, 0x18, 0xf6, 0x48, 0xf0, 0x22, 0xf2, 0xbe, 0xf5, 0x24, 0xfc, 0x43, 0x04, 0x91, 0x0e, 
-0x93, 0x16, 0xbd, 0x16, 0xc9, 0x0e, 0x65, 0x02, 0x18, 0xfb, 0x62, 0xfa, 0xe2, 0xfe, 0x35, 0x04, 
-0x5e, 0x07, 0xa1, 0x08, 0x9a, 0x08, 0x2a, 0x08, 0xdc, 0x05, 0x48, 0x02, 0xd8, 0xfe, 0xe5, 0xfe, 
-0x42, 0x03, 0x8e, 0x08, 0x53, 0x0a, 0xab, 0x05, 0x78, 0xfd, 0x9e, 0xf3, 0x36, 0xed, 0xf6, 0xe9, 
-0x24, 0xe8, 0xdf, 0xe6, 0x16, 0xe5, 0xa6, 0xe8, 0x83, 0xf2, 0x18, 0x04, 0x98, 0x14, 0x96, 0x1b, 
-0xcc, 0x14, 0xcc, 0x03, 0xde, 0xf4, 0x46, 0xee, 0xa0, 0xf2, 0x55, 0xfa, 0xcd, 0x01, 0x5a, 0x08, 
-0x46, 0x0f, 0x07, 0x15, 0x7f, 0x14, 0xb8, 0x0c, 0xdc, 0x00, 0x30, 0xf9, 0x65, 0xf9, 0xdc, 0xfe, 
-0xb0, 0x05, 0x76, 0x09, 0xc2, 0x0a, 0xb5, 0x0a, 0x49, 0x08, 0xb0, 0x03, 0xe3, 0xfd, 0xab, 0xfb, 
-0xe3, 0xfe, 0xac, 0x06, 0x31, 0x0d, 0xfd, 0x0c, 0x3c, 0x05, 0xc2, 0xf9, 0xc9, 0xf1, 0x87, 0xee, 
-0x21, 0xef, 0xcf, 0xf0, 0x6a, 0xee, 0xad, 0xea, 0xb1, 0xe7, 0x41, 0xea, 0xae, 0xf3, 0x72, 0x02, 
-0x4a, 0x12, 0x1a, 0x18, 0xa5, 0x12, 0xda, 0x02, 0xc5, 0xf5, 0xbb, 0xf0, 0xfb, 0xf3, 0xaf, 0xfb, 
-0x7f, 0x01, 0x4c, 0x08, 0xae, 0x0e, 0x17, 0x15, 0x57, 0x14, 0xfa, 0x0a, 0x7b, 0xfe, 0x5b, 0xf6, 
-0xa2, 0xf7, 0x8a, 0xfd, 0xf5, 0x04, 0x3a, 0x0a, 0xc5, 0x0c, 0x70, 0x0d, 0x51, 0x09, 0xd0, 0x02, 
-0xe4, 0xfc, 0x64, 0xfc, 0xb6, 0x02, 0x37, 0x0a, 0xa5, 0x0d, 0xb3, 0x09, 0xe1, 0x00, 0x1a, 0xf8, 
-0x91, 0xf3, 0x83, 0xf1, 0x7c, 0xf1, 0x96, 0xf2, 0x72, 0xf1, 0x4a, 0xf0, 0x75, 0xed, 0x39, 0xeb, 
-0x74, 0xee, 0xb9, 0xf7, 0x02, 0x09, 0xfd, 0x15, 0x85, 0x15, 0x04, 0x09, 0x4f, 0xf8, 0x1a, 0xf1, 
-0xc1, 0xf3, 0xe2, 0xfb, 0xf1, 0x02, 0x14, 0x08, 0xa6, 0x0d, 0x19, 0x12, 0x2d, 0x12, 0x59, 0x09, 
-0x03, 0xfd, 0x42, 0xf5, 0x8b, 0xf7, 0x56, 0x01, 0x9b, 0x09, 0xb1, 0x0c, 0x5c, 0x0b, 0x46, 0x08, 
-0x61, 0x06, 0x30, 0x03, 0xee, 0xfe, 0x50, 0xfd, 0x5c, 0x01, 0x17, 0x0a, 0x7b, 0x0d, 0x0d, 0x0a, 
-0x5a, 0x00, 0x3c, 0xf8, 0x2a, 0xf6, 0xe9, 0xf6, 0x78, 0xf8, 0x8c, 0xf6, 0x52, 0xf6, 0xbb, 0xf5, 
-0xce, 0xf1, 0x9d, 0xea, 0x08, 0xe4, 0x9f, 0xe6, 0xa6, 0xf4, 0x0c, 0x0a, 0x58, 0x1a, 0xf1, 0x19, 
-0x47, 0x0a, 0x76, 0xf7, 0x7d, 0xee, 0x3b, 0xf2, 0x10, 0xfc, 0x93, 0x04, 0xc1, 0x09, 0xf2, 0x0e, 
-0x8d, 0x12, 0xb5, 0x10, 0x16, 0x07, 0xeb, 0xf9, 0x10, 0xf3, 0xa9, 0xf7, 0x6c, 0x03, 0xa2, 0x0c, 
-0xfc, 0x0d, 0x31, 0x0a, 0xca, 0x06, 0xa2, 0x03, 0x6d, 0x01, 0x5a, 0xff, 0x54, 0xff, 0x58, 0x04, 
-0xb2, 0x09, 0x3c, 0x0d, 0x7a, 0x08, 0x72, 0x00, 0x35, 0xfa, 0x03, 0xf7, 0xd3, 0xf8, 0x17, 0xf9, 
-0x28, 0xf9, 0xd9, 0xf9, 0x35, 0xf7, 0x2a, 0xf0, 0x26, 0xe8, 0xdc, 0xe4, 0x0f, 0xeb, 0x13, 0xf5, 
-0x36, 0x03, 0x36, 0x11, 0xf8, 0x16, 0xf4, 0x10, 0x4d, 0x00, 0x0e, 0xf1, 0x09, 0xec, 0x6f, 0xf4, 
-0x84, 0x02, 0x3b, 0x0d, 0x52, 0x0f, 0x98, 0x0c, 0x46, 0x09, 0xdb, 0x05, 0xf0, 0x00, 0x8c, 0xfb, 
-0xe6, 0xfb, 0xd0, 0x01, 0xdb, 0x07, 0xe0, 0x0a, 0xac, 0x08, 0xdd, 0x04, 0x1f, 0x01, 0x7b, 0xfe, 
-0x90, 0x00, 0x5c, 0x04, 0x22, 0x0a, 0x1f, 0x0d, 0xee, 0x0a, 0x82, 0x05, 0x73, 0xfe, 0xc2, 0xf9, 
-0x7e, 0xf9, 0x35, 0xfb, 0xb1, 0xfd, 0x67, 0xfd, 0x2d, 0xfb, 0x7b, 0xf9, 0x4a, 0xf2, 0xe7, 0xea, 
-0xc3, 0xe5, 0x57, 0xe6, 0x87, 0xef, 0xf7, 0xfa, 0xe5, 0x0b, 0xee, 0x17, 0xa0, 0x15, 0x74, 0x07, 
-0x91, 0xf4, 0xb7, 0xec, 0x5f, 0xf0, 0x1d, 0xfc, 0xb6, 0x07, 0xa9, 0x0d, 0x2b, 0x10, 0x6c, 0x0d, 
-0x2d, 0x08, 0x37, 0x00, 0xce, 0xf8, 0xbe, 0xf6, 0xce, 0xfb, 0xb8, 0x06, 0xf0, 0x0b, 0xf5, 0x0b, 
-0x8c, 0x09, 0xf7, 0x05, 0x8a, 0x03, 0xe2, 0xff, 0x44, 0x00, 0xd6, 0x02, 0xe5, 0x07, 0x9f, 0x0b, 
-0x0f, 0x09, 0x3e, 0x04, 0x21, 0xfe, 0xd4, 0xfb, 0xcf, 0xfb, 0xdb, 0xfc, 0x1d, 0xfe, 0x82, 0xfa, 
-0x7f, 0xfb, 0x18, 0xf9, 0xec, 0xf0, 0xaf, 0xe9, 0x13, 0xe5, 0xd6, 0xeb, 0x7d, 0xef, 0x22, 0xf8, 
-0xae, 0x07, 0x26, 0x14, 0xe0, 0x18, 0x33, 0x09, 0xd9, 0xf5, 0xec, 0xeb, 0x9b, 0xf1, 0x76, 0x02, 
-0x0d, 0x0d, 0x60, 0x0e, 0x73, 0x08, 0x19, 0x05, 0x10, 0x05, 0xc8, 0x01, 0x52, 0xfd, 0xab, 0xfa, 
-0x6a, 0x00, 0x40, 0x09, 0xfd, 0x0c, 0x82, 0x09, 0x29, 0x02, 0x3d, 0xff, 0x5d, 0x02, 0x98, 0x05, 
-0xaa, 0x05, 0xdc, 0x05, 0xa2, 0x08, 0xf8, 0x0b, 0xac, 0x08, 0x21, 0x01, 0x51, 0xfb, 0xd8, 0xfb, 
-0x74, 0xff, 0xd2, 0x00, 0xd0, 0xfe, 0xa5, 0xf8, 0x6a, 0xf8, 0x96, 0xfb, 0xe9, 0xf8, 0x35, 0xef, 
-0xfc, 0xe5, 0xe2, 0xe6, 0x5a, 0xeb, 0x59, 0xf2, 0x26, 0xff, 0x1d, 0x0f, 0x8d, 0x19, 0x04, 0x11, 
-0x49, 0xfc, 0x78, 0xec, 0x94, 0xeb, 0xeb, 0xf9, 0x90, 0x07, 0x56, 0x0c, 0xca, 0x0b, 0xc7, 0x0a, 
-0x4c, 0x0a, 0xbd, 0x02, 0x71, 0xf8, 0xcf, 0xf4, 0xe3, 0xfc, 0xf1, 0x09, 0x98, 0x0f, 0xef, 0x0c, 
-0x7c, 0x06, 0xd2, 0x01, 0xd2, 0x00, 0xda, 0x01, 0x81, 0x03, 0x51, 0x05, 0xce, 0x07, 0x62, 0x09, 
-0xd3, 0x08, 0x88, 0x05, 0x4c, 0x01, 0xc0, 0x00, 0xb2, 0xff, 0x16, 0xfe, 0xb3, 0xfc, 0x17, 0xfa, 
-0x07, 0xf9, 0xcf, 0xf9, 0xdb, 0xfa, 0x30, 0xf8, 0xe7, 0xf0, 0x67, 0xec, 0xf7, 0xeb, 0x46, 0xec, 
-0x27, 0xf1, 0xc3, 0xf7, 0x2d, 0x09, 0x7f, 0x19, 0x39, 0x14, 0x3d, 0x03, 0x38, 0xf0, 0x4a, 0xee, 
-0x79, 0xf9, 0x3e, 0x02, 0x6e, 0x06, 0xb0, 0x05, 0x56, 0x0a, 0x43, 0x0c, 0xce, 0x06, 0xe0, 0xfc, 
-0x75, 0xf5, 0xb2, 0xfd, 0x23, 0x09, 0x88, 0x0e, 0xb0, 0x0a, 0xad, 0x03, 0x7c, 0x02, 0x68, 0x02, 
-0x08, 0x03, 0x2c, 0x04, 0x14, 0x06, 0x48, 0x0a, 0xc1, 0x0c, 0x57, 0x09, 0xcf, 0x02, 0xcc, 0xfe, 
-0xbb, 0xff, 0xe6, 0xff, 0xe2, 0xfd, 0xc4, 0xfb, 0xbc, 0xfb, 0x22, 0xfe, 0x33, 0xfc, 0x46, 0xf8, 
-0x2f, 0xf2, 0x2f, 0xee, 0x23, 0xf2, 0x36, 0xf2, 0xe0, 0xee, 0x6e, 0xea, 0xcb, 0xec, 0xb7, 0x01, 
-0x9b, 0x16, 0xbc, 0x19, 0x22, 0x09, 0x42, 0xf4, 0xbb, 0xee, 0x6b, 0xf5, 0x96, 0xff, 0x3d, 0x06, 
-0x94, 0x07, 0xa4, 0x0a, 0xcc, 0x0c, 0x2e, 0x09, 0x3a, 0x00, 0x15, 0xf9, 0x9d, 0xfb, 0x08, 0x05, 
-0x94, 0x0c, 0x84, 0x0d, 0xc4, 0x09, 0x1d, 0x05, 0x55, 0x01, 0x9c, 0xfe, 0x44, 0x01, 0x1c, 0x08, 
-0x3d, 0x0c, 0x5f, 0x0b, 0x7b, 0x06, 0x76, 0x02, 0x22, 0x01, 0xbb, 0xfe, 0xd8, 0xfd, 0x9a, 0xfc, 
-0xb8, 0xfb, 0x4f, 0xfe, 0xf8, 0xfc, 0x39, 0xf9, 0x4a, 0xf8, 0xab, 0xf9, 0x27, 0xfa, 0xd9, 0xf4, 
-0xb5, 0xee, 0x90, 0xed, 0xca, 0xeb, 0x48, 0xeb, 0x8c, 0xef, 0x0a, 0x01, 0x2f, 0x17, 0x90, 0x18, 
-0xca, 0x08, 0xd2, 0xf5, 0x23, 0xee, 0x1c, 0xf6, 0x06, 0x00, 0xe6, 0x06, 0x4a, 0x0a, 0x66, 0x0c, 
-0xbe, 0x0d, 0xb2, 0x05, 0xc4, 0xfb, 0x82, 0xf8, 0x85, 0xfe, 0x0d, 0x0a, 0x1c, 0x0e, 0x9d, 0x0b, 
-0xe0, 0x07, 0xf4, 0x03, 0xe0, 0x01, 0xdd, 0xff, 0x41, 0x02, 0xa6, 0x09, 0x9d, 0x0b, 0x66, 0x0a, 
-0xf3, 0x06, 0x6d, 0x02, 0xd4, 0x01, 0xcb, 0xff, 0x2e, 0xfe, 0x5b, 0xfc, 0x43, 0xfc, 0x00, 0xfe, 
-0x4a, 0xfb, 0x63, 0xfa, 0x48, 0xf8, 0x36, 0xf9, 0x90, 0xf9, 0x57, 0xf4, 0xd7, 0xf1, 0x08, 0xf1, 
-0xeb, 0xee, 0x66, 0xe9, 0xba, 0xeb, 0xbe, 0xf8, 0x33, 0x0e, 0x97, 0x16, 0xbc, 0x09, 0xec, 0xfc, 
-0x63, 0xf5, 0xb5, 0xf8, 0xf8, 0xfc, 0x97, 0xfe, 0xd2, 0x06, 0x67, 0x0d, 0x6e, 0x0f, 0xb2, 0x08, 
-0x60, 0xfd, 0x5f, 0xfb, 0x8d, 0xff, 0xb0, 0x05, 0x27, 0x08, 0xe3, 0x07, 0x0c, 0x0a, 0xea, 0x07, 
-0xf1, 0x03, 0x33, 0x01, 0x20, 0x01, 0xc5, 0x08, 0x34, 0x0d, 0x74, 0x0a, 0x56, 0x06, 0x9f, 0x02, 
-0xe9, 0x01, 0xad, 0xff, 0x0d, 0xfe, 0x71, 0x01, 0x38, 0x03, 0x2f, 0xff, 0xc3, 0xf7, 0xe6, 0xf4, 
-0x2f, 0xf8, 0x6f, 0xfa, 0x2d, 0xf8, 0xfe, 0xf3, 0x48, 0xf6, 0x7b, 0xf8, 0xe9, 0xf3, 0x2b, 0xe9, 
-0x87, 0xe4, 0x87, 0xed, 0x7b, 0xfc, 0x90, 0x10, 0x90, 0x14, 0xf8, 0x09, 0x78, 0x00, 0x69, 0xf7, 
-0xb1, 0xf4, 0x38, 0xf6, 0x38, 0xfc, 0x0b, 0x0a, 0x51, 0x13, 0x9d, 0x12, 0x94, 0x0b, 0x47, 0x00, 
-0x33, 0xfb, 0xac, 0xfb, 0x1b, 0x01, 0x4c, 0x0a, 0x86, 0x0e, 0x28, 0x0d, 0x92, 0x06, 0x06, 0x02, 
-0x2a, 0x01, 0x26, 0x03, 0xf9, 0x07, 0x79, 0x08, 0x39, 0x09, 0x83, 0x07, 0xfb, 0x03, 0x8b, 0x04, 
-0x28, 0x01, 0x9f, 0xfd, 0x87, 0xfd, 0xaa, 0xfc, 0x2b, 0xfb, 0xb6, 0xf8, 0x59, 0xf9, 0xdf, 0xfa, 
-0x58, 0xfb, 0xa5, 0xfa, 0xbf, 0xf2, 0x8a, 0xef, 0x8d, 0xf0, 0xd7, 0xf1, 0x4d, 0xf2, 0xfd, 0xed, 
-0x5c, 0xee, 0x48, 0xf8, 0xa1, 0x09, 0xe0, 0x10, 0x48, 0x09, 0x6a, 0x01, 0x2e, 0xfc, 0x8a, 0xf9, 
-0xf4, 0xf9, 0xdb, 0xfe, 0x50, 0x08, 0x8c, 0x0d, 0xea, 0x0c, 0xc4, 0x0a, 0xdd, 0x06, 0x6c, 0x01, 
-0x7e, 0xfe, 0x44, 0x00, 0x50, 0x06, 0x17, 0x0a, 0xea, 0x07, 0x94, 0x06, 0xd5, 0x07, 0xb6, 0x06, 
-0x83, 0x03, 0xf2, 0x03, 0xcd, 0x04, 0x02, 0x06, 0x8e, 0x07, 0x2c, 0x07, 0xc1, 0x06, 0xd8, 0x02, 
-0x3f, 0xfe, 0x17, 0xfc, 0x11, 0xfb, 0xd1, 0xfb, 0xfc, 0xfa, 0xcc, 0xf9, 0xf0, 0xf6, 0xff, 0xf1, 
-0x84, 0xf4, 0x7b, 0xfa, 0x0d, 0xfa, 0xf9, 0xf6, 0x32, 0xf4, 0x4e, 0xec, 0x23, 0xe4, 0x5f, 0xe7, 
-0x78, 0xf8, 0xd0, 0x0c, 0x42, 0x15, 0x27, 0x11, 0x62, 0x08, 0xc4, 0xfd, 0xa0, 0xf6, 0x1d, 0xf5, 
-0x98, 0xf9, 0xc1, 0x04, 0x02, 0x0e, 0x66, 0x11, 0x40, 0x10, 0x3f, 0x0a, 0x6c, 0x01, 0xa3, 0xfb, 
-0x0c, 0xfd, 0x7b, 0x01, 0x66, 0x05, 0x22, 0x0a, 0xbf, 0x0c, 0x34, 0x0b, 0x6b, 0x07, 0xb0, 0x01, 
-0x71, 0xfe, 0x78, 0x00, 0xca, 0x05, 0x27, 0x0a, 0x05, 0x0a, 0xc7, 0x07, 0x29, 0x03, 0x60, 0xfc, 
-0x78, 0xfa, 0x56, 0xfc, 0x8f, 0xfb, 0x42, 0xf8, 0x83, 0xf7, 0xc8, 0xf9, 0x8b, 0xf7, 0x37, 0xf5, 
-0x20, 0xf8, 0x60, 0xf8, 0x6b, 0xf4, 0x99, 0xf4, 0x23, 0xf7, 0xb7, 0xef, 0x0a, 0xe8, 0xd1, 0xee, 
-0x71, 0xfc, 0x01, 0x0a, 0xe4, 0x0e, 0xd1, 0x0a, 0xe4, 0x08, 0xcf, 0x01, 0xf8, 0xf8, 0x27, 0xfa, 
-0x47, 0xfe, 0xbe, 0x04, 0x62, 0x0b, 0x3b, 0x0e, 0x23, 0x10, 0xac, 0x0a, 0x46, 0x01, 0x07, 0xfd, 
-0xca, 0xfc, 0x4f, 0x00, 0x34, 0x05, 0xbe, 0x09, 0xa0, 0x0e, 0xa5, 0x0c, 0x2e, 0x05, 0xdb, 0x01, 
-0x23, 0x01, 0xe9, 0x00, 0x18, 0x02, 0x93, 0x06, 0xbf, 0x0a, 0x51, 0x08, 0xa8, 0x02, 0x8e, 0xfd, 
-0xaf, 0xf8, 0x6b, 0xf6, 0x58, 0xf6, 0xa7, 0xf8, 0x74, 0xfd, 0xcf, 0xff, 0x5b, 0xfc, 0xb8, 0xf6, 
-0x12, 0xf6, 0xab, 0xf4, 0xbf, 0xf1, 0xad, 0xf4, 0x18, 0xf7, 0xb3, 0xf1, 0x2a, 0xee, 0x0b, 0xf3, 
-0xfc, 0xf8, 0x97, 0x02, 0xbd, 0x0d, 0x37, 0x0e, 0xc8, 0x07, 0x37, 0x02, 0x7e, 0xfd, 0x75, 0xfc, 
-0x2d, 0xfe, 0xb5, 0x02, 0x52, 0x09, 0xae, 0x0b, 0x3d, 0x0b, 0x85, 0x08, 0xbb, 0x04, 0x8c, 0x02, 
-0x5a, 0x01, 0x35, 0x02, 0x3c, 0x04, 0x57, 0x05, 0x71, 0x05, 0x5a, 0x06, 0x35, 0x07, 0x44, 0x05, 
-0x05, 0x04, 0x80, 0x04, 0xdf, 0x02, 0x91, 0x01, 0x8a, 0x02, 0xb7, 0x04, 0x77, 0x03, 0x49, 0xff, 
-0x99, 0xfe, 0x0d, 0xfd, 0xeb, 0xf8, 0x53, 0xf8, 0x01, 0xfc, 0x28, 0xfc, 0xb1, 0xf7, 0x39, 0xf7, 
-0xbf, 0xf9, 0xf0, 0xf8, 0xda, 0xf4, 0xc2, 0xf3, 0x13, 0xf0, 0xb3, 0xea, 0xb2, 0xf2, 0xee, 0x00, 
-0x25, 0x07, 0xcb, 0x08, 0xa0, 0x0a, 0x06, 0x05, 0x68, 0xfc, 0xe7, 0xf9, 0xaa, 0xfc, 0x50, 0x02, 
-0x08, 0x08, 0x4b, 0x0d, 0xf8, 0x0e, 0x50, 0x09, 0x37, 0x02, 0x90, 0x00, 0xf2, 0xff, 0xbe, 0x00, 
-0xd0, 0x04, 0x6f, 0x08, 0x5c, 0x09, 0xb7, 0x06, 0xa0, 0x04, 0x53, 0x02, 0xdd, 0xfd, 0xae, 0xfe, 
-0x9d, 0x00, 0x3a, 0x02, 0xa1, 0x05, 0x3f, 0x06, 0x0b, 0x05, 0x73, 0x02, 0xea, 0xff, 0x6f, 0xfd, 
-0x2f, 0xfd, 0x04, 0xff, 0x1f, 0xff, 0x40, 0xfd, 0xec, 0xf9, 0x11, 0xf9, 0x5a, 0xf9, 0x7f, 0xf6, 
-0xec, 0xf6, 0x60, 0xf8, 0x05, 0xf8, 0xcc, 0xf9, 0x89, 0xf8, 0x57, 0xf1, 0xcd, 0xeb, 0x1b, 0xf0, 
-0x08, 0xfb, 0xce, 0x04, 0x50, 0x0b, 0x94, 0x0d, 0x3c, 0x09, 0x37, 0x02, 0x71, 0xfd, 0x49, 0xfc, 
-0x43, 0xfe, 0xf8, 0x03, 0xfd, 0x0a, 0xb7, 0x0d, 0x2e, 0x0d, 0x0b, 0x0a, 0x36, 0x04, 0x91, 0xfe, 
-0xb3, 0xfe, 0x79, 0x01, 0x3e, 0x03, 0xc3, 0x06, 0x98, 0x07, 0xa0, 0x07, 0x83, 0x03, 0xf4, 0x00, 
-0xc4, 0x00, 0xf5, 0xfb, 0x1e, 0xff, 0x1d, 0x04, 0x93, 0x04, 0xaf, 0x05, 0xb5, 0x06, 0xfb, 0x01, 
-0x10, 0xfc, 0x0d, 0xfb, 0x90, 0xf9, 0x10, 0xf9, 0x08, 0xfd, 0xe2, 0x00, 0x92, 0xff, 0x63, 0xfb, 
-0xb6, 0xf9, 0x79, 0xf7, 0x62, 0xf5, 0xc3, 0xf8, 0xd9, 0xf9, 0x09, 0xf9, 0x3f, 0xf9, 0x92, 0xf3, 
-0x5d, 0xf1, 0xbc, 0xf7, 0x35, 0xfb, 0x2d, 0x02, 0x74, 0x08, 0xed, 0x08, 0x91, 0x08, 0xbb, 0x04, 
-0x20, 0x01, 0x97, 0xfe, 0x6c, 0xff, 0xd7, 0x02, 0x22, 0x05, 0x4c, 0x08, 0x01, 0x0b, 0x70, 0x09, 
-0x87, 0x05, 0x5f, 0x02, 0x64, 0x00, 0xa9, 0xff, 0xb9, 0x01, 0x69, 0x03, 0x70, 0x04, 0x82, 0x04, 
-0xd5, 0x03, 0xaa, 0x03, 0xd1, 0x00, 0x3b, 0xff, 0x54, 0x00, 0xf9, 0xff, 0x5a, 0x01, 0x6a, 0x05, 
-0x8c, 0x03, 0x29, 0x02, 0x9c, 0x02, 0xc8, 0xfe, 0xdd, 0xfb, 0xa4, 0xfb, 0x8a, 0xfc, 0xd4, 0xfb, 
-0x59, 0xfd, 0x22, 0xfe, 0xbf, 0xfb, 0x0d, 0xfb, 0x43, 0xfa, 0x88, 0xf8, 0x4d, 0xf7, 0x8e, 0xf8, 
-0x81, 0xf7, 0xc5, 0xf3, 0x6a, 0xf1, 0x6f, 0xf4, 0x53, 0xfb, 0x16, 0x00, 0x1d, 0x07, 0xd9, 0x09, 
-0x73, 0x06, 0x41, 0x05, 0xaa, 0x02, 0x36, 0x00, 0x0e, 0x00, 0xc1, 0x01, 0xc2, 0x03, 0x0c, 0x06, 
-0x3b, 0x09, 0x82, 0x09, 0xef, 0x07, 0xc8, 0x04, 0x6e, 0x03, 0x0f, 0x01, 0x91, 0xff, 0x76, 0x02, 
-0xbd, 0x01, 0x43, 0x03, 0xf4, 0x05, 0xd6, 0x03, 0x27, 0x03, 0x65, 0x01, 0x8a, 0xfe, 0xb2, 0xff, 
-0xf2, 0x00, 0x70, 0x02, 0x99, 0x04, 0xcd, 0x04, 0x5c, 0x03, 0xd4, 0x00, 0xe6, 0xfd, 0xa3, 0xfb, 
-0xc9, 0xfb, 0x21, 0xfa, 0x5a, 0xfa, 0x0d, 0xfc, 0xa9, 0xfb, 0x8e, 0xfd, 0x1f, 0xfc, 0x16, 0xfb, 
-0xd8, 0xfa, 0x23, 0xf8, 0x3b, 0xf7, 0x61, 0xf5, 0xa9, 0xf1, 0xd2, 0xf1, 0xc5, 0xf5, 0xd4, 0xfa, 
-0x01, 0x01, 0xf3, 0x06, 0x3b, 0x0a, 0x74, 0x09, 0xeb, 0x07, 0x80, 0x04, 0x07, 0x01, 0xb4, 0xff, 
-0xfc, 0xff, 0x85, 0x01, 0x02, 0x04, 0x15, 0x07, 0x7e, 0x08, 0xe3, 0x07, 0x77, 0x06, 0x4a, 0x04, 
-0x22, 0x02, 0x45, 0x01, 0x46, 0x00, 0x9d, 0x01, 0x09, 0x03, 0xf8, 0x02, 0x4d, 0x02, 0xc9, 0x01, 
-0x54, 0x01, 0xb1, 0xff, 0x60, 0x00, 0xdb, 0x01, 0x56, 0x02, 0x59, 0x03, 0x90, 0x03, 0xf4, 0x01, 
-0x50, 0x01, 0x0b, 0x00, 0x0f, 0xfd, 0xcc, 0xfb, 0x6c, 0xfa, 0x7a, 0xf9, 0x5c, 0xfb, 0xd2, 0xfd, 
-0xd9, 0xfc, 0x46, 0xfb, 0x7a, 0xfc, 0xc4, 0xf8, 0x62, 0xf7, 0xba, 0xf8, 0x60, 0xf6, 0xba, 0xf5, 
-0x20, 0xf5, 0xca, 0xf6, 0x9f, 0xf9, 0xcf, 0xfe, 0x4a, 0x03, 0x28, 0x06, 0xec, 0x08, 0xb2, 0x08, 
-0x93, 0x07, 0x45, 0x05, 0x66, 0x03, 0x84, 0x01, 0xcd, 0x00, 0x0a, 0x02, 0x2c, 0x03, 0x8a, 0x04, 
-0xfd, 0x06, 0x85, 0x06, 0x16, 0x06, 0x97, 0x05, 0xe3, 0x02, 0x5d, 0x01, 0x00, 0x00, 0xea, 0xff, 
-0xb7, 0xff, 0xfd, 0xff, 0xce, 0x00, 0xa9, 0x01, 0x77, 0x01, 0x43, 0x02, 0xb4, 0x02, 0xe5, 0x01, 
-0x8a, 0x03, 0xbb, 0x02, 0x6e, 0x01, 0xba, 0x01, 0xe3, 0xff, 0x3b, 0xfe, 0x81, 0xfd, 0x1f, 0xfc, 
-0xc2, 0xfb, 0x4d, 0xfc, 0x2c, 0xfc, 0x31, 0xfb, 0x2d, 0xfc, 0x20, 0xfc, 0x16, 0xfa, 0xec, 0xf9, 
-0x10, 0xf9, 0x6b, 0xf7, 0xf0, 0xf6, 0xde, 0xf5, 0x4f, 0xf5, 0xbe, 0xf8, 0x6b, 0xfc, 0x38, 0xff, 
-0xaa, 0x04, 0x89, 0x07, 0x5b, 0x07, 0xdc, 0x08, 0x7d, 0x06, 0xb9, 0x03, 0x4d, 0x04, 0x34, 0x02, 
-0x83, 0x01, 0xd2, 0x02, 0x7d, 0x02, 0x10, 0x04, 0x7f, 0x05, 0xa5, 0x05, 0x8e, 0x05, 0xdc, 0x04, 
-0x5c, 0x03, 0x60, 0x01, 0xd8, 0x00, 0xaf, 0xff, 0x74, 0xff, 0x2b, 0xff, 0x98, 0xff, 0x5e, 0x00, 
-0xe8, 0xff, 0xe0, 0x02, 0xec, 0x02, 0x89, 0x03, 0x74, 0x05, 0x57, 0x02, 0x7a, 0x02, 0x90, 0x01, 
-0x5f, 0xfe, 0xc6, 0xfe, 0x7b, 0xfd, 0x37, 0xfc, 0xa6, 0xfc, 0x6f, 0xfb, 0x2e, 0xfb, 0xca, 0xfb, 
-0x3f, 0xfb, 0xd1, 0xfa, 0x8a, 0xfb, 0x5b, 0xfa, 0x54, 0xf9, 0x80, 0xf9, 0x85, 0xf6, 0x40, 0xf5, 
-0x1b, 0xf7, 0x29, 0xf8, 0xb0, 0xfb, 0x26, 0x00, 0xef, 0x02, 0xbc, 0x06, 0x0e, 0x08, 0xe8, 0x07, 
-0xa5, 0x07, 0x70, 0x05, 0xe6, 0x03, 0xcf, 0x02, 0xa6, 0x01, 0xa0, 0x01, 0xed, 0x01, 0x6f, 0x02, 
-0x5d, 0x03, 0x55, 0x04, 0xb2, 0x04, 0xef, 0x03, 0x76, 0x03, 0x59, 0x02, 0xe8, 0x00, 0x4b, 0x00, 
-0x3d, 0xff, 0x0e, 0xff, 0x67, 0xff, 0x27, 0x00, 0x50, 0x01, 0x07, 0x02, 0x03, 0x03, 0xb5, 0x03, 
-0xf7, 0x03, 0xfe, 0x03, 0x1c, 0x03, 0xdf, 0x01, 0x64, 0x01, 0xe6, 0xff, 0x78, 0xfe, 0x15, 0xfe, 
-0x04, 0xfc, 0x5b, 0xfb, 0x41, 0xfc, 0xc0, 0xfa, 0x57, 0xfb, 0x7c, 0xfc, 0xa6, 0xfb, 0x4d, 0xfb, 
-0xd0, 0xfa, 0xe8, 0xf8, 0x61, 0xf6, 0x7e, 0xf6, 0x78, 0xf5, 0x00, 0xf7, 0xbd, 0xfa, 0x89, 0xfc, 
-0x7d, 0x01, 0x16, 0x04, 0x0b, 0x06, 0xb2, 0x07, 0x21, 0x07, 0xfe, 0x06, 0x08, 0x05, 0x2f, 0x04, 
-0x1e, 0x03, 0xce, 0x01, 0x3b, 0x02, 0x44, 0x02, 0x62, 0x02, 0x54, 0x03, 0x7d, 0x03, 0x04, 0x04, 
-0x0f, 0x04, 0xae, 0x03, 0x21, 0x03, 0xbe, 0x01, 0x27, 0x01, 0x4e, 0x00, 0xda, 0xfe, 0xd9, 0xff, 
-0x40, 0x00, 0x31, 0x00, 0x85, 0x03, 0x72, 0x02, 0xc8, 0x03, 0xdf, 0x04, 0x10, 0x02, 0x87, 0x03, 
-0x7e, 0x01, 0x8a, 0xff, 0xad, 0xff, 0x7e, 0xfd, 0xd8, 0xfc, 0xe8, 0xfc, 0x5f, 0xfb, 0x21, 0xfb, 
-0x36, 0xfb, 0x30, 0xfa, 0x5e, 0xfa, 0xad, 0xfa, 0x4a, 0xfa, 0x6e, 0xfa, 0x1e, 0xfa, 0x42, 0xf8, 
-0x60, 0xf8, 0x0c, 0xf8, 0x43, 0xf9, 0x06, 0xfc, 0x81, 0xfd, 0x60, 0x01, 0x29, 0x03, 0xf1, 0x04, 
-0xce, 0x06, 0x72, 0x06, 0xa2, 0x06, 0x32, 0x06, 0xc5, 0x04, 0xa0, 0x03, 0xfd, 0x02, 0xce, 0x01, 
-0x90, 0x01, 0x17, 0x02, 0xbd, 0x01, 0x88, 0x02, 0x30, 0x03, 0xe2, 0x02, 0x07, 0x03, 0xcd, 0x02, 
-0x04, 0x02, 0x6c, 0x01, 0xe1, 0x00, 0x29, 0x00, 0x3f, 0x00, 0xb1, 0x00, 0x52, 0x01, 0x53, 0x02, 
-0xc7, 0x02, 0x16, 0x03, 0x5c, 0x03, 0x44, 0x02, 0xcf, 0x01, 0x03, 0x01, 0xbd, 0xfe, 0x67, 0xfe, 
-0x27, 0xfd, 0x86, 0xfb, 0x2e, 0xfc, 0xe0, 0xfa, 0x00, 0xfb, 0x97, 0xfb, 0x70, 0xfa, 0x95, 0xfb, 
-0xa6, 0xfa, 0x8d, 0xfa, 0x6b, 0xfa, 0x17, 0xf8, 0xac, 0xf8, 0x04, 0xf8, 0x94, 0xf9, 0xec, 0xfb, 
-0x23, 0xfd, 0xab, 0x00, 0x74, 0x02, 0x47, 0x04, 0x2e, 0x06, 0x69, 0x06, 0xb1, 0x06, 0x38, 0x06, 
-0x69, 0x05, 0xa1, 0x04, 0x44, 0x03, 0xee, 0x02, 0xf8, 0x01, 0x27, 0x02, 0x64, 0x02, 0x06, 0x02, 
-0x03, 0x03, 0xc8, 0x02, 0xc6, 0x02, 0xaa, 0x02, 0x5e, 0x02, 0xb7, 0x01, 0x1e, 0x01, 0xff, 0x00, 
-0x47, 0x00, 0x01, 0x01, 0x7c, 0x00, 0x72, 0x01, 0x7b, 0x02, 0x21, 0x01, 0x53, 0x03, 0x6a, 0x02, 
-0x69, 0x01, 0x59, 0x02, 0x43, 0x00, 0xc4, 0xff, 0x0f, 0xff, 0x27, 0xfd, 0xb2, 0xfc, 0x35, 0xfb, 
-0x7a, 0xfa, 0xf5, 0xf9, 0x85, 0xf9, 0x85, 0xfa, 0x81, 0xf9, 0x2a, 0xfa, 0xae, 0xf9, 0x2a, 0xf8, 
-0x90, 0xf8, 0x2c, 0xf9, 0x47, 0xfa, 0x32, 0xfc, 0xad, 0xfe, 0x60, 0x00, 0xa9, 0x02, 0x88, 0x04, 
-0x25, 0x05, 0x4b, 0x06, 0xc3, 0x06, 0x60, 0x05, 0x88, 0x05, 0xbc, 0x04, 0x51, 0x03, 0x0c, 0x03, 
-0x48, 0x02, 0xaf, 0x01, 0xa0, 0x01, 0xcc, 0x01, 0x9b, 0x01, 0xec, 0x01, 0xc3, 0x01, 0xa5, 0x01, 
-0x54, 0x01, 0x1f, 0x01, 0xd3, 0x00, 0x4f, 0x00, 0x8f, 0x00, 0xd8, 0x00, 0xee, 0x00, 0x65, 0x01, 
-0x20, 0x02, 0xb1, 0x01, 0xdf, 0x02, 0xb8, 0x02, 0x9f, 0x01, 0x6e, 0x02, 0xab, 0x00, 0x45, 0x00, 
-0x97, 0xff, 0x68, 0xfd, 0xf1, 0xfc, 0x30, 0xfb, 0x8b, 0xfa, 0xfd, 0xf9, 0x21, 0xf9, 0x84, 0xfa, 
-0x20, 0xf9, 0x33, 0xf9, 0x6e, 0xfa, 0x93, 0xf7, 0xcc, 0xf9, 0xc2, 0xfb, 0x73, 0xfa, 0xfa, 0xfe, 
-0x8d, 0x00, 0x7b, 0x00, 0x96, 0x04, 0x19, 0x04, 0x62, 0x04, 0xad, 0x06, 0xd1, 0x04, 0x63, 0x05, 
-0xf2, 0x05, 0x82, 0x03, 0x04, 0x04, 0x46, 0x03, 0xae, 0x01, 0x93, 0x02, 0x83, 0x01, 0x2e, 0x01, 
-0xc4, 0x01, 0xec, 0x00, 0x9d, 0x00, 0xe3, 0x00, 0x21, 0x00, 0xce, 0xff, 0x93, 0x00, 0xe1, 0xff, 
-0x24, 0x00, 0x4f, 0x01, 0xf6, 0x00, 0xf8, 0x01, 0x62, 0x02, 0xfa, 0x01, 0xb6, 0x02, 0x21, 0x02, 
-0x86, 0x01, 0x09, 0x01, 0x71, 0x00, 0x18, 0xff, 0xa0, 0xfe, 0x8b, 0xfd, 0xdf, 0xfb, 0x89, 0xfb, 
-0x9e, 0xfa, 0xb5, 0xf9, 0x7d, 0xf9, 0x86, 0xf9, 0x6d, 0xf8, 0xc1, 0xf8, 0x78, 0xf8, 0xbf, 0xf9, 
-0x21, 0xfb, 0xdc, 0xfb, 0x7a, 0xff, 0x82, 0x00, 0x3c, 0x02, 0x00, 0x05, 0xac, 0x04, 0xd2, 0x05, 
-0xa1, 0x06, 0x5b, 0x05, 0xea, 0x05, 0xeb, 0x04, 0xfb, 0x03, 0x2e, 0x03, 0x53, 0x02, 0xe7, 0x01, 
-0xb0, 0x00, 0x4b, 0x01, 0x87, 0x00, 0x32, 0x00, 0xdf, 0x00, 0xd5, 0xff, 0x4f, 0x00, 0x14, 0x00, 
-0xc7, 0xff, 0x1a, 0x00, 0x59, 0xff, 0x46, 0x00, 0x22, 0x00, 0xe3, 0x00, 0x46, 0x01, 0xaa, 0x01, 
-0xad, 0x02, 0x9e, 0x01, 0xdc, 0x02, 0x53, 0x02, 0x78, 0x01, 0xe9, 0x01, 0x25, 0x00, 0x13, 0x00, 
-0xdf, 0xfe, 0xef, 0xfc, 0x27, 0xfd, 0x16, 0xfb, 0xb5, 0xfa, 0x5b, 0xfa, 0x52, 0xf9, 0xaf, 0xf9, 
-0xdd, 0xf8, 0x45, 0xf9, 0x1d, 0xfa, 0x47, 0xfb, 0x8a, 0xfc, 0x70, 0xfe, 0xe6, 0xff, 0xfc, 0x00, 
-0xe8, 0x02, 0x57, 0x03, 0x18, 0x04, 0x3e, 0x05, 0xaf, 0x04, 0xd6, 0x04, 0xd8, 0x04, 0x90, 0x03, 
-0x79, 0x03, 0x08, 0x03, 0xf7, 0x01, 0xc3, 0x01, 0x56, 0x01, 0xa2, 0x00, 0x82, 0x00, 0x5c, 0x00, 
-0x04, 0x00, 0x0c, 0x00, 0x25, 0x00, 0xbb, 0xff, 0xe5, 0xff, 0xd7, 0xff, 0x04, 0x00, 0xae, 0x00, 
-0xdf, 0x00, 0xaf, 0x01, 0xff, 0x01, 0x58, 0x02, 0x6a, 0x02, 0x46, 0x02, 0x29, 0x02, 0x6f, 0x01, 
-0xe3, 0x00, 0x2a, 0x00, 0xab, 0xfe, 0xeb, 0xfd, 0xb3, 0xfc, 0xdb, 0xfa, 0xdc, 0xfa, 0x08, 0xf9, 
-0xae, 0xf8, 0x31, 0xf8, 0xf7, 0xf6, 0xb7, 0xf9, 0x60, 0xf9, 0x08, 0xfb, 0x7e, 0xfe, 0x9e, 0xfe, 
-0x7e, 0x01, 0x5e, 0x03, 0xa9, 0x03, 0x13, 0x05, 0xaa, 0x05, 0x59, 0x05, 0xcd, 0x04, 0x0d, 0x05, 
-0xe2, 0x03, 0xbc, 0x02, 0x48, 0x03, 0xcf, 0x01, 0xde, 0x00, 0x84, 0x01, 0x67, 0x00, 0xea, 0xff, 
-0x86, 0x00, 0x30, 0x00, 0xd1, 0xff, 0x4b, 0x00, 0x26, 0x00, 0xbc, 0xff, 0x30, 0x00, 0x0d, 0x00, 
-0x05, 0x00, 0x58, 0x00, 0x63, 0x00, 0xae, 0x00, 0xe2, 0x00, 0x48, 0x01, 0x7b, 0x01, 0x9b, 0x01, 
-0xb9, 0x01, 0x96, 0x01, 0x44, 0x01, 0xca, 0x00, 0x88, 0x00, 0x9a, 0xff, 0x58, 0xff, 0xd3, 0xfe, 
-0x0e, 0xfe, 0x30, 0xfe, 0x55, 0xfd, 0x6c, 0xfd, 0x3c, 0xfd, 0x79, 0xfc, 0x5b, 0xfd, 0xd9, 0xfc, 
-0xd8, 0xfc, 0x06, 0xfe, 0x86, 0xfd, 0x32, 0xfe, 0x0f, 0xff, 0xbc, 0xfe, 0xd4, 0xff, 0xa6, 0x00, 
-0x67, 0x00, 0xb6, 0x01, 0x44, 0x02, 0xec, 0x01, 0xed, 0x02, 0xf3, 0x02, 0xaa, 0x02, 0xec, 0x02, 
-0xec, 0x02, 0x65, 0x02, 0x56, 0x02, 0x7c, 0x02, 0x79, 0x01, 0x33, 0x01, 0x1f, 0x01, 0x0b, 0x00, 
-0xc7, 0xff, 0x80, 0xff, 0xc0, 0xfe, 0xac, 0xfe, 0x73, 0xfe, 0x48, 0xfe, 0x5e, 0xfe, 0x5b, 0xfe, 
-0x32, 0xfe, 0x79, 0xfe, 0xa4, 0xfe, 0x57, 0xfe, 0xd9, 0xfe, 0xb4, 0xfe, 0x85, 0xfe, 0xb1, 0xfe, 
-0x5f, 0xfe, 0x92, 0xfe, 0x78, 0xfe, 0x8c, 0xfe, 0xed, 0xfe, 0x0f, 0xff, 0x53, 0xff, 0xaa, 0xff, 
-0x3d, 0x00, 0x76, 0x00, 0xc6, 0x00, 0x4a, 0x01, 0x5b, 0x01, 0xb6, 0x01, 0xe0, 0x01, 0xec, 0x01, 
-0x28, 0x02, 0x07, 0x02, 0x0c, 0x02, 0xe5, 0x01, 0xa3, 0x01, 0xb5, 0x01, 0x57, 0x01, 0x24, 0x01, 
-0x12, 0x01, 0xbc, 0x00, 0xaf, 0x00, 0x76, 0x00, 0x49, 0x00, 0x2c, 0x00, 0xf8, 0xff, 0xe5, 0xff, 
-0xb4, 0xff, 0xb7, 0xff, 0xb0, 0xff, 0xa1, 0xff, 0xb6, 0xff, 0x98, 0xff, 0xaf, 0xff, 0xbb, 0xff, 
-0x91, 0xff, 0xab, 0xff, 0x9d, 0xff, 0x7d, 0xff, 0x6f, 0xff, 0x58, 0xff, 0x65, 0xff, 0x53, 0xff, 
-0x56, 0xff, 0x39, 0xff, 0x2e, 0xff, 0x41, 0xff, 0x21, 0xff, 0x2d, 0xff, 0x3d, 0xff, 0x2f, 0xff, 
-0x3c, 0xff, 0x4b, 0xff, 0x3e, 0xff, 0x55, 0xff, 0x87, 0xff, 0x85, 0xff, 0xa1, 0xff, 0xeb, 0xff, 
-0xca, 0xff, 0xd1, 0xff, 0x00, 0x00, 0xc8, 0xff, 0xc8, 0xff, 0xd9, 0xff, 0xb2, 0xff, 0xae, 0xff, 
-0xc1, 0xff, 0xa5, 0xff, 0xb5, 0xff, 0xc7, 0xff, 0xad, 0xff, 0xd6, 0xff, 0xf0, 0xff, 0xd6, 0xff, 
-0xfe, 0xff, 0x13, 0x00, 0x0e, 0x00, 0x3e, 0x00, 0x39, 0x00, 0x41, 0x00, 0x5c, 0x00, 0x48, 0x00, 
-0x58, 0x00, 0x5b, 0x00, 0x55, 0x00, 0x66, 0x00, 0x54, 0x00, 0x57, 0x00, 0x64, 0x00, 0x51, 0x00, 
-0x51, 0x00, 0x43, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x09, 0x00, 0x04, 0x00, 0xe9, 0xff, 0xd0, 0xff, 
-0xdb, 0xff, 0xd0, 0xff, 0xd1, 0xff, 0xe5, 0xff, 0xe7, 0xff, 0xf6, 0xff, 0x0f, 0x00, 0x1e, 0x00, 
-0x36, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x6d, 0x00, 
-0x5e, 0x00, 0x55, 0x00, 0x45, 0x00, 0x2f, 0x00, 0x2e, 0x00, 0x15, 0x00, 0x04, 0x00, 0x03, 0x00, 
-0xfc, 0xff, 0xf3, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xd9, 0xff, 0xc2, 0xff, 0xcd, 0xff, 0xc5, 0xff, 
-0xc0, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xcf, 0xff, 0xdb, 0xff, 0xe9, 0xff, 0xf6, 0xff, 
-0xfa, 0xff, 0x03, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x15, 0x00, 0x02, 0x00, 0xf7, 0xff, 0xf8, 0xff, 
-0xe6, 0xff, 0xd8, 0xff, 0xe3, 0xff, 0xdd, 0xff, 0xcf, 0xff, 0xdb, 0xff, 0xdc, 0xff, 0xe9, 0xff, 
-0xec, 0xff, 0xf7, 0xff, 0x06, 0x00, 0xfe, 0xff, 0x10, 0x00, 0x0a, 0x00, 0xfe, 0xff, 0x04, 0x00, 
-0xfa, 0xff, 0xed, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xdd, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xcc, 0xff, 
-0xc8, 0xff, 0xce, 0xff, 0xcf, 0xff, 0xd5, 0xff, 0xd3, 0xff, 0xca, 0xff, 0xd1, 0xff, 0xd4, 0xff, 
-0xd0, 0xff, 0xcc, 0xff, 0xd3, 0xff, 0xd1, 0xff, 0xc7, 0xff, 0xd1, 0xff, 0xd5, 0xff, 0xd4, 0xff, 
-0xd9, 0xff, 0xde, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xef, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xfa, 0xff, 
-0x08, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x0f, 0x00, 0x15, 0x00, 0x19, 0x00, 0x13, 0x00, 
-0x12, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x09, 0x00, 0x07, 0x00, 0x03, 0x00, 0xf7, 0xff, 
-0xf0, 0xff, 0xee, 0xff, 0xe2, 0xff, 0xd9, 0xff, 0xd7, 0xff, 0xd1, 0xff, 0xd2, 0xff, 0xd0, 0xff, 
-0xce, 0xff, 0xd3, 0xff, 0xdb, 0xff, 0xe2, 0xff, 0xe1, 0xff, 0xee, 0xff, 0xf3, 0xff, 0xf0, 0xff, 
-0xf4, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0x03, 0x00, 0x06, 0x00, 0x05, 0x00, 
-0x02, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 
-0x02, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x09, 0x00, 0x17, 0x00, 
-0x1f, 0x00, 0x24, 0x00, 0x27, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2b, 0x00, 0x24, 0x00, 
-0x20, 0x00, 0x1a, 0x00, 0x11, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xed, 0xff, 0xe8, 0xff, 
-0xe7, 0xff, 0xe0, 0xff, 0xda, 0xff, 0xda, 0xff, 0xdf, 0xff, 0xe0, 0xff, 0xe1, 0xff, 0xe7, 0xff, 
-0xeb, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0x03, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 
-0x14, 0x00, 0x19, 0x00, 0x16, 0x00, 0x19, 0x00, 0x19, 0x00, 0x15, 0x00, 0x13, 0x00, 0x10, 0x00, 
-0x08, 0x00, 0x03, 0x00, 0xff, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xef, 0xff, 
-0xec, 0xff, 0xef, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x05, 0x00, 0x10, 0x00, 
-0x13, 0x00, 0x16, 0x00, 0x16, 0x00, 0x15, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x01, 0x00, 
-0xfe, 0xff, 0xf6, 0xff, 0xf1, 0xff, 0xeb, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xe8, 0xff, 
-0xeb, 0xff, 0xef, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x03, 0x00, 0x09, 0x00, 
-0x0e, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x27, 0x00, 0x25, 0x00, 0x2c, 0x00, 
-0x2d, 0x00, 0x2b, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x26, 0x00, 0x1e, 0x00, 0x16, 0x00, 0x14, 0x00, 
-0x0d, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 
-0x0a, 0x00, 0x09, 0x00, 0x09, 0x00, 0x08, 0x00, 0x09, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0b, 0x00, 
-0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x07, 0x00, 
-0x0d, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0f, 0x00, 
-0x11, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x13, 0x00, 
-0x0f, 0x00, 0x12, 0x00, 0x16, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x0a, 0x00, 
-0x01, 0x00, 0xfc, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf3, 0xff, 
-0xf1, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfb, 0xff, 
-0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x02, 0x00, 0xfd, 0xff, 0xfc, 0xff, 
-0xfc, 0xff, 0xff, 0xff, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x08, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0xfe, 0xff, 0x03, 0x00, 
-0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0xfc, 0xff, 0xfa, 0xff, 0x03, 0x00, 0xfc, 0xff, 
-0xf9, 0xff, 0x01, 0x00, 0xf9, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0x00, 0x00, 0xf8, 0xff, 0xf1, 0xff, 
-0xfc, 0xff, 0xed, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xee, 0xff, 0x10, 0x00, 0x05, 0x00, 0xf8, 0xff, 
-0xeb, 0xff, 0xd9, 0xff, 0x0c, 0x00, 0xeb, 0xff, 0xe8, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xff, 0xff, 
-0xda, 0xff, 0xdd, 0xff, 0xe9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xe0, 0xff, 0xc5, 0xff, 0xbe, 0xff, 
-0x0e, 0x00, 0xcd, 0xff, 0xd8, 0xff, 0xf4, 0xff, 0xd6, 0xff, 0x14, 0x00, 0xd8, 0xff, 0x0c, 0x00, 
-0xd1, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xee, 0xff, 0x33, 0x00, 0xcf, 0xff, 0x1a, 0x00, 0x43, 0x00, 
-0x12, 0x00, 0xeb, 0xff, 0xd2, 0xff, 0xf0, 0xff, 0x15, 0x00, 0x1d, 0x00, 0xcd, 0xff, 0xe7, 0xff, 
-0xde, 0xff, 0x05, 0x00, 0x5b, 0x00, 0xa1, 0xff, 0x29, 0x00, 0x3e, 0x00, 0xec, 0xff, 0xdc, 0xff, 
-0x71, 0xff, 0x09, 0x00, 0x04, 0x00, 0xbd, 0xff, 0x53, 0x00, 0x35, 0x00, 0xe5, 0xff, 0x19, 0x00, 
-0xf5, 0xff, 0x39, 0x00, 0x2a, 0x00, 0x7e, 0x00, 0xc2, 0xff, 0xbb, 0x00, 0x02, 0x00, 0x94, 0x01, 
-0x39, 0x05, 0x55, 0x01, 0xf5, 0x01, 0x9f, 0x02, 0x2c, 0xff, 0xa9, 0xfd, 0x83, 0xfe, 0xaf, 0xfe, 
-0x56, 0xfd, 0xc7, 0xfe, 0xe1, 0xff, 0xc1, 0xfe, 0xff, 0xfe, 0x32, 0x00, 0xa7, 0x00, 0x68, 0x00, 
-0xed, 0xff, 0x6f, 0x02, 0x29, 0x02, 0x7f, 0x03, 0x13, 0x04, 0xf5, 0x00, 0xa1, 0xff, 0x65, 0xfd, 
-0x82, 0xfd, 0x2d, 0xfd, 0x63, 0xfd, 0xee, 0xfd, 0x11, 0xfd, 0x5e, 0xfe, 0x0a, 0xff, 0xd9, 0xfe, 
-0x6a, 0xff, 0x32, 0xff, 0x1b, 0x00, 0x97, 0x00, 0xf9, 0xff, 0xc0, 0x00, 0x1e, 0x01, 0x7e, 0x00, 
-0xee, 0xff, 0x10, 0x00, 0xcf, 0xff, 0x00, 0xff, 0x3b, 0xff, 0xc1, 0xff, 0x9c, 0xff, 0x62, 0xff, 
-0xae, 0xff, 0xf4, 0xff, 0x3a, 0xff, 0x92, 0xff, 0x16, 0x00, 0xab, 0xff, 0xb2, 0xff, 0xcb, 0xff, 
-0x36, 0x00, 0xf1, 0xff, 0xb2, 0xff, 0x32, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x64, 0x00, 0x49, 0x00, 
-0x66, 0x00, 0x4b, 0x00, 0x41, 0x00, 0x92, 0x00, 0x17, 0x00, 0x30, 0x00, 0x4b, 0x00, 0xde, 0xff, 
-0xda, 0xff, 0xb6, 0xff, 0xec, 0xff, 0xf8, 0xff, 0xdd, 0xff, 0x2e, 0x00, 0x6d, 0x00, 0x0d, 0x00, 
-0x68, 0x00, 0x39, 0x00, 0x2a, 0x00, 0x66, 0x00, 0x1f, 0x00, 0x58, 0x00, 0x56, 0x00, 0xfb, 0xff, 
-0x72, 0x00, 0x15, 0x00, 0x18, 0x00, 0x5e, 0x00, 0xb8, 0xff, 0x96, 0x00, 0x20, 0x00, 0x70, 0x00, 
-0xc3, 0x00, 0x60, 0x00, 0xed, 0x00, 0x72, 0x00, 0xa5, 0x00, 0x8f, 0x00, 0x1a, 0x00, 0x51, 0x00, 
-0x20, 0x00, 0x8f, 0xff, 0xf8, 0xff, 0x45, 0x00, 0x28, 0x00, 0x57, 0x00, 0x61, 0x00, 0x02, 0x00, 
-0x75, 0xff, 0xc8, 0xff, 0x47, 0x00, 0xca, 0xff, 0xf8, 0xff, 0x91, 0x00, 0xfc, 0xff, 0xf2, 0xff, 
-0xf1, 0xff, 0x42, 0x00, 0x1f, 0x00, 0x9b, 0xff, 0x56, 0x00, 0xde, 0xff, 0xe6, 0xff, 0x1c, 0x00, 
-0xec, 0xff, 0x1b, 0x00, 0xd1, 0xff, 0x13, 0x00, 0x14, 0x00, 0xf0, 0xff, 0xe1, 0xff, 0xb4, 0xff, 
-0x9f, 0xff, 0xf9, 0xff, 0xd4, 0xff, 0xb9, 0xff, 0x01, 0x00, 0xbf, 0xff, 0x0f, 0x00, 0xe4, 0xff, 
-0x97, 0xff, 0x69, 0x00, 0xe4, 0xff, 0xf3, 0xff, 0x4d, 0x00, 0xe9, 0xff, 0x3a, 0x00, 0x97, 0xff, 
-0x41, 0x00, 0x28, 0x00, 0x79, 0xff, 0x4e, 0x00, 0xf5, 0xff, 0x04, 0x00, 0x17, 0x00, 0xaf, 0xff, 
-0xf6, 0xff, 0xef, 0xff, 0xf9, 0xff, 0xbd, 0xff, 0x12, 0x00, 0x0e, 0x00, 0x84, 0xff, 0x04, 0x00, 
-0xde, 0xff, 0xfe, 0xff, 0xb3, 0xff, 0x26, 0x00, 0x46, 0x00, 0x76, 0xff, 0xbf, 0x00, 0x5d, 0x00, 
-0x81, 0xff, 0x6a, 0x00, 0x53, 0x00, 0xfb, 0xff, 0xf0, 0xff, 0x85, 0x00, 0x80, 0x00, 0x6c, 0xff, 
-0x77, 0x00, 0xb0, 0x00, 0x2c, 0xff, 0x1a, 0x00, 0xd8, 0x00, 0xd8, 0xff, 0x33, 0x00, 0x98, 0x00, 
-0x87, 0xff, 0xa8, 0xff, 0x58, 0x00, 0x50, 0x00, 0x0b, 0x00, 0x77, 0x00, 0x19, 0x01, 0xb0, 0xff, 
-0x1e, 0x00, 0x74, 0x01, 0xa7, 0xff, 0xde, 0xff, 0x95, 0x00, 0xde, 0xff, 0x3a, 0x00, 0xc6, 0xff, 
-0x44, 0x00, 0x77, 0x00, 0x6f, 0xff, 0x19, 0x00, 0x0c, 0x00, 0xda, 0xff, 0x4c, 0x00, 0x53, 0xff, 
-0x4f, 0x00, 0x63, 0x00, 0x5f, 0xff, 0x7b, 0x00, 0x12, 0x00, 0xd7, 0xff, 0xda, 0xff, 0xa6, 0xff, 
-0x96, 0x00, 0xbe, 0xff, 0x6b, 0xff, 0x88, 0x00, 0x81, 0xff, 0xfe, 0xff, 0x50, 0x00, 0x13, 0x00, 
-0x29, 0x00, 0x50, 0xff, 0x6e, 0x00, 0x4e, 0x00, 0x21, 0x00, 0x76, 0x00, 0xc7, 0xff, 0x32, 0x00, 
-0xdb, 0xff, 0x13, 0x00, 0x9d, 0x00, 0x82, 0xff, 0x81, 0x00, 0xa1, 0x00, 0xfc, 0xff, 0x0f, 0x00, 
-0x05, 0x00, 0xed, 0x00, 0x8a, 0xff, 0xbe, 0xff, 0x02, 0x01, 0x3b, 0xff, 0x01, 0x00, 0xc0, 0x00, 
-0xb5, 0xff, 0x1f, 0x00, 0x83, 0xff, 0xc8, 0xff, 0x77, 0xff, 0x00, 0xff, 0x94, 0x00, 0xff, 0xff, 
-0xdb, 0xff, 0x68, 0x00, 0x84, 0xff, 0x58, 0x00, 0xf2, 0xff, 0x88, 0xff, 0x29, 0x00, 0x1d, 0xff, 
-0xa2, 0x00, 0x59, 0x01, 0x08, 0x00, 0xf2, 0xff, 0x65, 0xff, 0xb5, 0xff, 0x84, 0xff, 0x8d, 0xff, 
-0x61, 0x00, 0x7f, 0xff, 0x7f, 0xff, 0xeb, 0xff, 0x08, 0x00, 0x84, 0x00, 0x56, 0xff, 0xcc, 0xff, 
-0xa1, 0x00, 0xc9, 0xff, 0xef, 0xff, 0x2c, 0x00, 0xe8, 0xff, 0x26, 0xff, 0xb8, 0xff, 0x95, 0x00, 
-0xc5, 0xff, 0x2a, 0x00, 0x2e, 0x00, 0x80, 0xff, 0x28, 0x00, 0xca, 0xff, 0x91, 0xff, 0x4c, 0x00, 
-0x95, 0x00, 0xea, 0xff, 0xfc, 0xff, 0xfc, 0x00, 0x33, 0x00, 0xea, 0xff, 0xcb, 0x00, 0x12, 0x00, 
-0x97, 0xff, 0x38, 0x00, 0xd8, 0xff, 0x7c, 0xff, 0x3a, 0x00, 0x21, 0x00, 0x91, 0xff, 0x46, 0x00, 
-0x3c, 0x00, 0xe1, 0xff, 0xbe, 0xff, 0x8c, 0xff, 0xd7, 0xff, 0xe0, 0xff, 0x6a, 0x00, 0xf6, 0xff, 
-0x28, 0x00, 0x50, 0x00, 0x50, 0xff, 0xf8, 0xff, 0x0d, 0x00, 0x7e, 0xff, 0x0b, 0x00, 0x50, 0x00, 
-0x91, 0x00, 0x14, 0x00, 0x1c, 0x00, 0xf8, 0xff, 0x8c, 0xff, 0x2d, 0x00, 0xa7, 0xff, 0x40, 0x00, 
-0x64, 0x00, 0x6a, 0xff, 0x0b, 0x00, 0xce, 0xff, 0x75, 0xff, 0xbc, 0xff, 0x39, 0x00, 0x6a, 0x00, 
-0x86, 0xff, 0x78, 0x00, 0xa3, 0x00, 0xb6, 0xff, 0x5b, 0x00, 0x44, 0x00, 0xbf, 0xff, 0xc8, 0xff, 
-0xf0, 0xff, 0xe0, 0xff, 0xdb, 0xff, 0x3e, 0x00, 0x20, 0x00, 0xf5, 0xff, 0x08, 0x00, 0xb0, 0xff, 
-0x8a, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0x80, 0x00, 0x79, 0x00, 0x12, 0x00, 0xef, 0xff, 
-0xe7, 0xff, 0x10, 0x00, 0xec, 0xff, 0x36, 0x00, 0x48, 0x00, 0xf7, 0xff, 0xfc, 0xff, 0xa5, 0xff, 
-0xdb, 0xff, 0x40, 0x00, 0xfc, 0xff, 0x09, 0x00, 0x27, 0x00, 0xec, 0xff, 0xc5, 0xff, 0xc6, 0xff, 
-0xff, 0xff, 0xfd, 0xff, 0xf3, 0xff, 0x0b, 0x00, 0xe5, 0xff, 0xd5, 0xff, 0x21, 0x00, 0x04, 0x00, 
-0xd8, 0xff, 0x11, 0x00, 0x2c, 0x00, 0x0c, 0x00, 0xce, 0xff, 0xf6, 0xff, 0x04, 0x00, 0xe8, 0xff, 
-0xf8, 0xff, 0x16, 0x00, 0x2e, 0x00, 0xe2, 0xff, 0xde, 0xff, 0x25, 0x00, 0xf8, 0xff, 0xfe, 0xff, 
-0xfd, 0xff, 0xee, 0xff, 0x17, 0x00, 0xe4, 0xff, 0xff, 0xff, 0x1c, 0x00, 0xe7, 0xff, 0xe4, 0xff, 
-0xf3, 0xff, 0x06, 0x00, 0x01, 0x00, 0xf8, 0xff, 0x27, 0x00, 0xfd, 0xff, 0xc9, 0xff, 0x01, 0x00, 
-0xf8, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x02, 0x00, 0xe9, 0xff, 
-0xf4, 0xff, 0x11, 0x00, 0xe6, 0xff, 0xfd, 0xff, 0x02, 0x00, 0xf2, 0xff, 0x18, 0x00, 0xf2, 0xff, 
-0xf4, 0xff, 0x04, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x00, 0x00, 
-0xe7, 0xff, 0xf0, 0xff, 0x00, 0x00, 0xfa, 0xff, 0xed, 0xff, 0x10, 0x00, 0x20, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x07, 0x00, 0xf7, 0xff, 0xfa, 0xff, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x17, 0x00, 
-0xf6, 0xff, 0xfe, 0xff, 0x33, 0x00, 0xf4, 0xff, 0xf2, 0xff, 0x08, 0x00, 0xe8, 0xff, 0xf2, 0xff, 
-0x0c, 0x00, 0x04, 0x00, 0x05, 0x00, 0x14, 0x00, 0x0c, 0x00, 0xf8, 0xff, 0xfa, 0xff, 0xfe, 0xff, 
-0xeb, 0xff, 0xf7, 0xff, 0x14, 0x00, 0xff, 0xff, 0x07, 0x00, 0x2a, 0x00, 0xee, 0xff, 0xf1, 0xff, 
-0x0f, 0x00, 0xf7, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0x04, 0x00, 0x02, 0x00, 
-0x02, 0x00, 0x05, 0x00, 0xf1, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xef, 0xff, 0xf2, 0xff, 
-0x0a, 0x00, 0x07, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0xfc, 0xff, 0x02, 0x00, 0xf9, 0xff, 0xfd, 0xff, 0xf6, 0xff, 0xfc, 0xff, 0x09, 0x00, 0xf7, 0xff, 
-0x04, 0x00, 0x04, 0x00, 0xfe, 0xff, 0x06, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf6, 0xff, 
-0x0a, 0x00, 0xf7, 0xff, 0x05, 0x00, 0x0a, 0x00, 0xf8, 0xff, 0x05, 0x00, 0xfe, 0xff, 0xfc, 0xff, 
-0xff, 0xff, 0xfb, 0xff, 0x08, 0x00, 0x01, 0x00, 0xfd, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0xf7, 0xff, 0xff, 0xff, 0x06, 0x00, 0xfd, 0xff, 0xfc, 0xff, 
-0x02, 0x00, 0x05, 0x00, 0x02, 0x00, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 
-0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfc, 0xff, 0x02, 0x00, 0xff, 0xff, 0x00, 0x00, 0x03, 0x00, 
-0xfb, 0xff, 0x01, 0x00, 0x01, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xff, 0xff, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 
-0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
@@ -0,0 +1,37 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _MODEL_MANAGER_H_
+#define _MODEL_MANAGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "esp_mn_iface.h"
+#include "model_path.h"
+
+// Pick the multinet model and start the idle reclaim task. Nothing is
+// allocated until the first wake word.
+esp_err_t model_manager_init(srmodel_list_t *models);
+
+esp_mn_iface_t *model_manager_multinet(void);
+
+// Create the multinet if it is not resident and mark it in use. Called on
+// wake with *loading false; returns NULL if it could not be created.
+// With CONFIG_MODEL_IN_SPIFFS it never loads on the caller: it returns NULL
+// with *loading set while the manager task loads, and the caller calls
+// again for each frame, with *loading still set, until it gets the model
+// or NULL with *loading cleared.
+model_iface_data_t *model_manager_acquire(bool *loading);
+
+// Done with the multinet for this wake; it is freed after the idle period
+void model_manager_release(void);
+
+esp_err_t model_manager_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,51 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _PERF_MONITOR_H_
+#define _PERF_MONITOR_H_
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+// Accumulated CPU cycle counts for one measured code section
+typedef struct {
+    uint32_t count;
+    uint64_t total;
+    uint32_t max;
+} perf_counter_t;
+
+// Idle-task run time per core at a point in time (run time stats clock is esp_timer, in us)
+typedef struct {
+    int64_t time_us;
+    uint32_t idle_us[portNUM_PROCESSORS];
+} perf_cpu_snapshot_t;
+
+static inline void perf_counter_add(perf_counter_t *c, uint32_t cycles)
+{
+    c->count++;
+    c->total += cycles;
+    if (cycles > c->max) {
+        c->max = cycles;
+    }
+}
+
+static inline uint32_t perf_counter_avg(const perf_counter_t *c)
+{
+    return c->count ? (uint32_t)(c->total / c->count) : 0;
+}
+
+void perf_counter_reset(perf_counter_t *c);
+
+// Convert cycles to microseconds at the current CPU clock
+float perf_cycles_to_us(uint64_t cycles);
+
+void perf_cpu_snapshot(perf_cpu_snapshot_t *snap);
+
+// Per-core load in percent between two snapshots; -1 when run time stats are disabled
+void perf_cpu_load(const perf_cpu_snapshot_t *from, const perf_cpu_snapshot_t *to, float load[portNUM_PROCESSORS]);
+
+#endif
@@ -0,0 +1,54 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _PHRASE_SYNTH_H_
+#define _PHRASE_SYNTH_H_
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "prompt_pack.h"
+
+#define PHRASE_MAX_WORDS        16
+#define PHRASE_CROSSFADE_MS     12
+#define PHRASE_XFADE_MAX        (48000 * PHRASE_CROSSFADE_MS / 1000)
+
+// A confirmation built from word clip names in the prompt pack
+typedef struct {
+    const char *words[PHRASE_MAX_WORDS];
+    int count;
+} phrase_t;
+
+// Pull-style renderer for one phrase
+typedef struct {
+    phrase_t phrase;
+    int next_word;
+    bool word_open;
+    bool first_block;
+    bool finished;
+    int xfade;
+    int held;                   // samples in work not yet returned
+    prompt_reader_t word;
+    int16_t work[PHRASE_XFADE_MAX + PROMPT_READ_SAMPLES];
+    int16_t block[PROMPT_READ_SAMPLES];
+} phrase_reader_t;
+
+// Append one word; ignored when the phrase is full
+void phrase_add(phrase_t *phrase, const char *word);
+
+// Append a spoken duration, e.g. 5400 -> "one hour thirty minutes"
+void phrase_add_duration(phrase_t *phrase, int seconds);
+
+// True when every word of the phrase has a clip in the pack
+bool phrase_synth_available(const phrase_t *phrase);
+
+// Word clips are stitched with PHRASE_CROSSFADE_MS linear crossfades.
+// phrase_reader_read fills up to max samples
+// and returns 0 once the phrase is done; missing word clips are skipped.
+void phrase_reader_init(phrase_reader_t *reader, const phrase_t *phrase);
+int phrase_reader_read(phrase_reader_t *reader, int16_t *out, int max);
+
+#endif
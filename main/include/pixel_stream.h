@@ -0,0 +1,47 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _PIXEL_STREAM_H_
+#define _PIXEL_STREAM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define PIXEL_DDP_PORT          4048
+#define PIXEL_E131_PORT         5568
+#define PIXEL_E131_UNIVERSE     1       // ring starts at channel 1; 170 LEDs fit in one universe
+#define PIXEL_TIMEOUT_MS        2500    // no frame for this long: back to local animations
+#define PIXEL_MAX_PACKET        1472    // DDP: 14-byte header + 1440 data bytes
+#define PIXEL_NVS_NS            "pixels"
+
+// Frame buffer access from main.c. write() puts count RGB triplets from
+// first onward straight into the strip driver's buffer and returns false
+// when the ring is showing something else (voice feedback, a timer); show()
+// sends the buffer to the LEDs. Both are called from the receive task only.
+typedef struct {
+    int leds;
+    bool (*write)(int first, const uint8_t *rgb, int count);
+    void (*show)(void);
+} pixel_stream_ops_t;
+
+// Load the saved on/off state, bind both ports and start the receive task.
+// ops must stay valid.
+esp_err_t pixel_stream_start(const pixel_stream_ops_t *ops);
+
+// A sender has shown a frame within PIXEL_TIMEOUT_MS and not ended its
+// stream; the local idle animations stay off the ring meanwhile
+bool pixel_stream_active(void);
+
+bool pixel_stream_enabled(void);
+void pixel_stream_set_enabled(bool enable);
+
+// GET/POST /api/pixels
+esp_err_t pixel_stream_register_http(httpd_handle_t server);
+
+#endif
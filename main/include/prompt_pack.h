@@ -0,0 +1,86 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _PROMPT_PACK_H_
+#define _PROMPT_PACK_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "adpcm.h"
+
+// Prompt pack partition written by tools/mkprompts.py
+#define PROMPT_PACK_PARTITION   "prompts"
+#define PROMPT_PACK_MAGIC       "PPK1"
+#define PROMPT_PACK_VERSION     2
+#define PROMPT_NAME_LEN         32
+
+// Well-known prompt ids
+#define PROMPT_ID_WORD_BASE     128         // word clips for phrase_synth, found by name
+
+typedef enum {
+    PROMPT_FORMAT_PCM16 = 0,    // 16-bit little-endian PCM
+    PROMPT_FORMAT_IMA_ADPCM,    // mono IMA-ADPCM in ADPCM_BLOCK_BYTES blocks (adpcm.h)
+} prompt_format_t;
+
+typedef struct __attribute__((packed)) {
+    char magic[4];
+    uint16_t version;
+    uint16_t count;
+    uint32_t reserved[2];
+} prompt_pack_header_t;
+
+typedef struct __attribute__((packed)) {
+    char name[PROMPT_NAME_LEN];
+    uint16_t id;
+    uint8_t format;             // prompt_format_t
+    uint8_t channels;
+    uint32_t sample_rate;
+    uint32_t offset;            // byte offset from the start of the partition
+    uint32_t length;            // bytes
+    uint32_t samples;           // decoded samples per channel
+} prompt_pack_entry_t;
+
+// A prompt inside the mapped partition
+typedef struct {
+    const char *name;
+    uint16_t id;
+    prompt_format_t format;
+    uint8_t channels;
+    uint32_t sample_rate;
+    const uint8_t *data;        // points into the flash mapping, valid until reboot
+    uint32_t length;
+    uint32_t samples;
+} prompt_t;
+
+// Sequential decoder over one prompt
+typedef struct {
+    prompt_t prompt;
+    uint32_t pos;               // bytes consumed
+    uint32_t remaining;         // samples still to deliver
+} prompt_reader_t;
+
+// Smallest buffer prompt_reader_read accepts
+#define PROMPT_READ_SAMPLES     ADPCM_BLOCK_SAMPLES
+
+// Map the prompt partition, validate its index and time the ADPCM decoder
+// over every compressed prompt
+esp_err_t prompt_pack_init(void);
+
+esp_err_t prompt_pack_find(uint16_t id, prompt_t *out);
+esp_err_t prompt_pack_find_by_name(const char *name, prompt_t *out);
+
+void prompt_reader_init(prompt_reader_t *reader, const prompt_t *prompt);
+
+// Decode the next samples into out (at least PROMPT_READ_SAMPLES long).
+// ADPCM prompts are returned one block per call. Returns 0 at the end.
+int prompt_reader_read(prompt_reader_t *reader, int16_t *out, int max);
+
+// GET /api/prompts
+esp_err_t prompt_pack_register_http(httpd_handle_t server);
+
+#endif
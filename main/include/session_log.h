@@ -0,0 +1,139 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _SESSION_LOG_H_
+#define _SESSION_LOG_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SESSION_LOG_PARTITION       "sessions"
+#define SESSION_SECTOR_SIZE         4096    // erase unit
+#define SESSION_PAGE_SIZE           256     // program unit: one write covers 4 records
+#define SESSION_RECORD_SIZE         64
+#define SESSION_RECORDS_PER_SECTOR  (SESSION_SECTOR_SIZE / SESSION_RECORD_SIZE)
+#define SESSION_MAX_SECTORS         64      // index capacity, 256 KB of log
+#define SESSION_BATCH               (SESSION_PAGE_SIZE / SESSION_RECORD_SIZE)
+#define SESSION_PENDING_MAX         16      // held in RAM while a write is in progress
+#define SESSION_FLUSH_MS            (60 * 60 * 1000)    // write a part page after this long
+#define SESSION_CLOCK_VALID         1700000000          // time() below this: clock not set yet
+
+typedef enum {
+    SESSION_END_COMPLETED = 1,
+    SESSION_END_STOPPED = 2,
+    SESSION_END_REPLACED = 3,   // another timer was started
+    SESSION_END_RESTART = 4,    // device restarted while it ran
+} session_end_t;
+
+#define SESSION_FLAG_COUNTDOWN  0x01
+#define SESSION_FLAG_CLOCK      0x02    // start_unix is set
+#define SESSION_FLAG_REMOTE     0x04    // started on another ring (timer sync)
+
+// One finished timer. Erased flash reads all 0xFF, so seq 0xFFFFFFFF never
+// occurs in a written record.
+typedef struct __attribute__((packed)) {
+    uint32_t seq;               // 1, 2, 3, ... over the life of the log
+    uint32_t start_unix;        // 0 when the clock was not set
+    uint32_t uptime_s;          // at the start
+    uint16_t boot;              // boot number, counted in the log itself
+    uint8_t end;                // session_end_t
+    uint8_t flags;              // SESSION_FLAG_*
+    uint32_t planned_s;         // duration it was started with
+    uint32_t added_s;
+    uint32_t run_s;             // running time, pauses excluded
+    uint32_t paused_s;
+    uint16_t pauses;
+    uint16_t adds;
+    char name[16];
+    uint8_t reserved[8];        // 0xFF, for later fields
+    uint32_t crc;               // session_crc32() of everything above
+} session_record_t;
+
+// Flash under the log: a partition on the device, a RAM image in
+// tools/session_log_sim.c. Offsets are relative to the log. Return 0 on success.
+typedef struct {
+    void *ctx;
+    uint32_t size;              // bytes, a multiple of SESSION_SECTOR_SIZE
+    int (*read)(void *ctx, uint32_t offset, void *buf, size_t len);
+    int (*write)(void *ctx, uint32_t offset, const void *buf, size_t len);
+    int (*erase)(void *ctx, uint32_t offset, size_t len);
+} session_flash_t;
+
+// What each sector holds, built by the mount scan
+typedef struct {
+    uint32_t first_seq;         // 0 = no valid records
+    uint32_t last_seq;
+    uint32_t min_unix;          // over records with the clock set, 0 = none
+    uint32_t max_unix;
+    uint16_t used;              // slots written, valid or not
+    uint16_t valid;
+} session_sector_t;
+
+typedef struct {
+    const session_flash_t *flash;
+    int sectors;
+    int head;                   // sector being appended to
+    uint32_t next_seq;
+    uint16_t boot;              // highest boot in the log + 1
+    session_sector_t index[SESSION_MAX_SECTORS];
+    uint32_t records;           // valid records in the log
+    uint32_t bad;               // CRC failures found by the scan (torn writes)
+    uint32_t erases;
+    uint32_t writes;
+    uint32_t pages_read;
+} session_log_t;
+
+// Called with each matching record, oldest first; return false to stop
+typedef bool (*session_visit_t)(const session_record_t *record, void *arg);
+
+uint32_t session_crc32(const void *data, size_t len);
+
+// Scan the whole log once and build the index. Returns 0, or -1 on a read
+// error or a flash layout the index cannot hold.
+int session_log_mount(session_log_t *log, const session_flash_t *flash);
+
+// Number, checksum and write records[0..count) with as few writes as fit
+// (one per sector they land in), erasing the oldest sector when the head
+// one fills. Returns 0, or -1 on a flash error.
+int session_log_append(session_log_t *log, session_record_t *records, int count);
+
+// Records that fill the head page to its end (1..SESSION_BATCH); appending
+// that many, or that plus whole pages, leaves the next write page-aligned
+int session_log_page_room(const session_log_t *log);
+
+// Records started in [from_unix, to_unix] (0, 0 = all, undated ones
+// included) with seq > after_seq. Sectors the index rules out are not read.
+// Returns the number visited, -1 on a read error.
+int session_log_query(session_log_t *log, uint32_t from_unix, uint32_t to_unix, uint32_t after_seq,
+                      session_visit_t visit, void *arg);
+
+#ifdef ESP_PLATFORM
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// Mount the "sessions" partition and start the writer task
+esp_err_t session_log_init(void);
+
+// Start SNTP once the network is up; start times are 0 until it syncs
+void session_log_start_clock(void);
+
+// Timer hooks from main.c; each is a few stores under a spinlock
+void session_log_begin(const char *name, bool countdown, uint32_t seconds, bool remote);
+void session_log_pause(void);
+void session_log_resume(void);
+void session_log_add(uint32_t seconds);
+void session_log_end(session_end_t reason);
+
+// Write buffered records now. Also runs on esp_restart().
+esp_err_t session_log_flush(void);
+
+// GET /api/sessions (streamed), GET /api/sessions/stats
+esp_err_t session_log_register_http(httpd_handle_t server);
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _SETTINGS_STORE_H_
+#define _SETTINGS_STORE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define SETTINGS_NVS_NS         "timer_settings"
+#define SETTINGS_VERSION        2
+#define SETTINGS_QUIET_MS       1500    // commit once changes stop for this long
+#define SETTINGS_MAX_DIRTY_MS   10000   // or this long after the first uncommitted change
+#define SETTINGS_RETRY_MS       5000    // after a failed commit
+
+// Timer appearance as kept in RAM and in NVS (schema version
+// SETTINGS_VERSION). Fields are only ever appended.
+typedef struct __attribute__((packed)) {
+    uint8_t primary[3];         // r, g, b
+    uint8_t segment[3];
+    uint8_t end[3];
+    uint8_t segments;
+    uint8_t use_end_color;
+    uint8_t brightness;
+} timer_settings_t;
+
+// Load the saved settings, migrating older versions, and start the commit
+// task. Nothing saved (or unreadable) leaves the defaults.
+esp_err_t settings_store_init(const timer_settings_t *defaults);
+
+void settings_store_get(timer_settings_t *out);
+
+// Replace the settings in RAM. They reach flash SETTINGS_QUIET_MS after the
+// last change, so a burst of updates costs one write. Returns false when
+// nothing changed. Never blocks on flash.
+bool settings_store_set(const timer_settings_t *settings);
+
+// Commit now if there is anything uncommitted. Also runs on esp_restart().
+esp_err_t settings_store_flush(void);
+
+// GET /api/settings/store
+esp_err_t settings_store_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,44 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _SPECTRUM_VIZ_H_
+#define _SPECTRUM_VIZ_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define SPECTRUM_RATE           8000    // feed audio decimated 2:1
+#define SPECTRUM_FFT_SIZE       256     // 32 ms window, 31.25 Hz bins
+#define SPECTRUM_RING_SAMPLES   1024    // power of two
+#define SPECTRUM_BANDS          17      // 5 LEDs each on the 85-LED ring
+#define SPECTRUM_MIN_HZ         80
+#define SPECTRUM_FPS            60
+#define SPECTRUM_BUDGET_CYCLES  120000  // analysis + render per frame, 0.5 ms at 240 MHz
+#define SPECTRUM_PEAK_HOLD_MS   500
+#define SPECTRUM_CHECK_MAX_S    60
+#define SPECTRUM_NVS_NS         "spectrum"
+
+// Paint one frame: levels and peak-hold positions are 0..255 per band,
+// lowest band first. Returns false when the ring is showing something else.
+typedef bool (*spectrum_draw_fn)(const uint8_t *levels, const uint8_t *peaks, int bands);
+
+// Load the saved on/off state and start the frame task
+esp_err_t spectrum_viz_init(spectrum_draw_fn draw);
+
+// feed_Task only: decimate the first channel of one interleaved chunk into
+// the analysis ring. Returns at once while the mode is off.
+void spectrum_viz_feed(const int16_t *data, int channels, int frames);
+
+bool spectrum_viz_enabled(void);
+void spectrum_viz_set_enabled(bool enable);
+
+// GET/POST /api/spectrum
+esp_err_t spectrum_viz_register_http(httpd_handle_t server);
+
+#endif
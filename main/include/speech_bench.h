@@ -0,0 +1,45 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _SPEECH_BENCH_H_
+#define _SPEECH_BENCH_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "model_path.h"
+
+// Corpus partition written by tools/build_corpus.py
+#define SPEECH_BENCH_PARTITION  "corpus"
+#define SPEECH_BENCH_MAGIC      "SRBC"
+#define SPEECH_BENCH_VERSION    1
+#define SPEECH_BENCH_LABEL_LEN  24
+
+typedef struct __attribute__((packed)) {
+    char magic[4];
+    uint16_t version;
+    uint16_t count;
+    uint32_t sample_rate;
+    uint32_t reserved;
+} speech_corpus_header_t;
+
+// One labelled clip of 16-bit mono PCM
+typedef struct __attribute__((packed)) {
+    char label[SPEECH_BENCH_LABEL_LEN];
+    int16_t command_id;     // expected multinet command id, -1 if none
+    uint8_t wake;           // 1 if the clip contains the wake word
+    uint8_t reserved;
+    uint32_t offset;        // byte offset from the start of the partition
+    uint32_t samples;
+} speech_corpus_entry_t;
+
+// Remember the model list used to resolve wakenet/multinet names
+void speech_bench_init(srmodel_list_t *models);
+
+esp_err_t speech_bench_register_http(httpd_handle_t server);
+
+#endif
@@ -20,7 +20,15 @@ void led_off(int gpio);
 
 void led_Task(void *arg);
 
-void speech_commands_action(int command_id);
+// Speak a confirmation for a recognised command, e.g. ("timer", 300) -> "timer five minutes".
+// Both only queue the sound on the audio engine and return immediately.
+void speech_commands_action(const char *action, int duration_seconds);
 
 void wake_up_action(void);
+
+// Beep for the last ten seconds of a timer, higher for the last three
+void timer_countdown_action(int seconds_left);
+
+// Alarm when a timer runs out, as long as the end animation
+void timer_complete_action(void);
 #endif
\ No newline at end of file
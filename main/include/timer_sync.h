@@ -0,0 +1,99 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _TIMER_SYNC_H_
+#define _TIMER_SYNC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// tools/timer_sync_sim.py mirrors the wire format below; keep them in step
+#define TIMER_SYNC_PORT         4211
+#define TIMER_SYNC_GROUP        "239.255.42.11"
+#define TIMER_SYNC_MAGIC        0x5354  // "TS" on the wire
+#define TIMER_SYNC_VERSION      1
+#define TIMER_SYNC_BEACON_MS    1000
+#define TIMER_SYNC_PING_MS      1000    // 250 ms until the filter is full
+#define TIMER_SYNC_LISTEN_MS    2500    // after boot, look for an existing timebase this long
+#define TIMER_SYNC_PEER_TTL_MS  5000
+#define TIMER_SYNC_PEERS_MAX    8
+#define TIMER_SYNC_FILTER       8       // ping samples; the one with the lowest delay wins
+#define TIMER_SYNC_MAX_ERROR_US 10000   // synced when the offset is known to within this
+
+// Header of every packet, little-endian, no padding
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t type;               // timer_sync_type_t
+    uint32_t node;              // sender
+    uint32_t master;            // whose clock the sender follows, 0 = none yet
+    uint8_t flags;              // TIMER_SYNC_FLAG_*
+} timer_sync_header_t;
+
+#define TIMER_SYNC_FLAG_ESTABLISHED 0x01    // sender has a timebase (its own or the master's)
+
+typedef enum {
+    TIMER_SYNC_BEACON = 1,      // multicast every TIMER_SYNC_BEACON_MS: timer_sync_state_t
+    TIMER_SYNC_PING = 2,        // to the master: int64_t t1
+    TIMER_SYNC_PONG = 3,        // to the pinger: timer_sync_pong_t
+    TIMER_SYNC_STATE = 4,       // multicast on every local timer change: timer_sync_state_t
+} timer_sync_type_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t requester;
+    int64_t t1;                 // requester's clock when the ping left
+    int64_t t2;                 // shared time when the master got it
+    int64_t t3;                 // shared time when the pong left
+} timer_sync_pong_t;
+
+// The timer as every ring should show it. Times are in the shared
+// timebase; the latest change (stamp, then node) wins everywhere.
+typedef struct __attribute__((packed)) {
+    int64_t stamp_us;           // shared time of the change, 0 = no timer state yet
+    uint32_t stamp_node;
+    uint8_t active;
+    uint8_t countdown;
+    uint8_t paused;
+    uint8_t use_end_color;
+    uint8_t primary[3];
+    uint8_t end[3];
+    uint8_t segment[3];
+    uint8_t segments;
+    uint32_t total_s;
+    int64_t start_us;
+    int64_t paused_us;          // when paused
+    char name[16];
+} timer_sync_state_t;
+
+// main.c reads and sets its TimerState through these; times are converted
+// with timer_sync_now_us(). apply() runs on the sync task. snapshot() and
+// apply() are called between lock() and unlock(), which take the lock the
+// timer's other writers hold; it must be recursive, since publishing from
+// under it takes it again.
+typedef struct {
+    void (*lock)(void);
+    void (*unlock)(void);
+    void (*snapshot)(timer_sync_state_t *out);
+    void (*apply)(const timer_sync_state_t *state);
+} timer_sync_ops_t;
+
+// Join the group and start the sync task. ops must stay valid.
+esp_err_t timer_sync_start(const timer_sync_ops_t *ops);
+
+// Tell the other rings about a local timer change (start, pause, resume,
+// stop, add). Safe from any task; returns at once.
+void timer_sync_publish(void);
+
+// Now in the shared timebase, in microseconds
+int64_t timer_sync_now_us(void);
+
+// GET /api/sync
+esp_err_t timer_sync_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,100 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _TONE_SYNTH_H_
+#define _TONE_SYNTH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define TONE_SYNTH_RATE         16000
+#define TONE_MAX_NOTES          8
+#define TONE_BENCH_BLOCK        160     // 10 ms, the audio engine block
+#define TONE_BUDGET_CYCLES      20000   // per TONE_BENCH_BLOCK, ~83 us at 240 MHz
+
+typedef enum {
+    TONE_WAKE = 0,              // wake word chime
+    TONE_COUNTDOWN,             // one beep per second, 10..4 s left
+    TONE_COUNTDOWN_FINAL,       // last three seconds
+    TONE_COMPLETE,              // timer finished, lasts as long as the end animation
+    TONE_COUNT
+} tone_id_t;
+
+typedef enum {
+    TONE_WAVE_SINE = 0,
+    TONE_WAVE_TRIANGLE,
+} tone_wave_t;
+
+typedef struct {
+    uint16_t attack_ms;
+    uint16_t decay_ms;
+    uint8_t sustain;            // 0..255 of the peak
+    uint16_t release_ms;
+} tone_adsr_t;
+
+// One note: two oscillators under one envelope. level + partial_level <= 255.
+typedef struct {
+    uint16_t freq_hz;           // 0 = rest
+    uint16_t partial_hz;        // second oscillator, 0 = off
+    uint8_t level;
+    uint8_t partial_level;
+    uint16_t on_ms;             // key held; the release follows
+    uint16_t gap_ms;            // silence after the release
+} tone_note_t;
+
+typedef struct {
+    const char *name;
+    tone_wave_t wave;
+    tone_adsr_t env;
+    uint8_t repeat;             // times the note list is played
+    uint8_t count;
+    tone_note_t notes[TONE_MAX_NOTES];
+} tone_pattern_t;
+
+typedef enum {
+    TONE_ENV_ATTACK = 0,
+    TONE_ENV_DECAY,
+    TONE_ENV_SUSTAIN,
+    TONE_ENV_RELEASE,
+    TONE_ENV_OFF,
+} tone_env_stage_t;
+
+// Pull-style renderer for one pattern
+typedef struct {
+    const tone_pattern_t *pattern;
+    int note;
+    int pass;
+    bool finished;
+    uint32_t phase[2];
+    uint32_t step[2];
+    int32_t level[2];
+    uint32_t pos;               // sample within the note
+    uint32_t on;                // key-up sample
+    uint32_t length;            // on + release + gap
+    tone_env_stage_t stage;
+    int32_t env;                // Q24
+    int32_t env_step;
+    int32_t sustain;            // Q24
+} tone_reader_t;
+
+// Build the oscillator table and benchmark every pattern against TONE_BUDGET_CYCLES
+esp_err_t tone_synth_init(void);
+
+tone_id_t tone_synth_find(const char *name);
+
+// Every sample runs both oscillators and the envelope whatever the pattern
+// plays, so the cost per block is fixed. tone_reader_read fills up to max
+// samples and returns 0 once the pattern is done.
+void tone_reader_init(tone_reader_t *reader, tone_id_t id);
+int tone_reader_read(tone_reader_t *reader, int16_t *out, int max);
+
+// GET/POST /api/tones
+esp_err_t tone_synth_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,98 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _UDP_CONTROL_H_
+#define _UDP_CONTROL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// tools/udp_control.py mirrors the wire format below; keep them in step
+#define UDP_CONTROL_PORT        4210
+#define UDP_CONTROL_MAGIC       0x544c  // "LT" on the wire
+#define UDP_CONTROL_VERSION     1
+#define UDP_CONTROL_MAX_PACKET  64
+#define UDP_PEERS_MAX           8       // senders whose last sequence number is remembered
+#define UDP_PEER_TTL_MS         60000   // after this long idle a sender starts afresh
+
+// Every packet starts with this header, little-endian, no padding
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t opcode;             // udp_op_t; replies set UDP_OP_REPLY
+    uint32_t seq;               // per sender, increasing; repeats are not executed again
+    uint8_t flags;              // UDP_FLAG_*
+    uint8_t len;                // payload bytes after the header
+} udp_header_t;
+
+#define UDP_FLAG_ACK            0x01    // request: reply with udp_reply_t
+#define UDP_FLAG_DUPLICATE      0x02    // reply: seq was already handled, not run again
+
+typedef enum {
+    UDP_OP_START = 1,           // udp_start_t
+    UDP_OP_PAUSE = 2,
+    UDP_OP_RESUME = 3,
+    UDP_OP_STOP = 4,
+    UDP_OP_ADD = 5,             // uint32_t seconds
+    UDP_OP_SETTINGS = 6,        // udp_appearance_t, saved to NVS
+    UDP_OP_STATUS = 7,          // always replied to
+    UDP_OP_REPLY = 0x80,
+} udp_op_t;
+
+typedef enum {
+    UDP_RESULT_OK = 0,
+    UDP_RESULT_BAD_REQUEST = 1,
+    UDP_RESULT_UNSUPPORTED = 2,
+} udp_result_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t primary[3];         // r, g, b
+    uint8_t end[3];
+    uint8_t segment[3];
+    uint8_t segments;           // 1..12
+    uint8_t use_end_color;
+} udp_appearance_t;
+
+#define UDP_START_COUNTUP       0x01
+#define UDP_START_APPEARANCE    0x02    // appearance is valid; otherwise the current one is kept
+
+typedef struct __attribute__((packed)) {
+    uint32_t seconds;
+    uint8_t flags;              // UDP_START_*
+    udp_appearance_t appearance;
+} udp_start_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t result;             // udp_result_t
+    uint8_t active;
+    uint8_t paused;
+    uint8_t led_state;
+    int32_t remaining_s;        // -1 when idle
+    uint32_t total_s;
+} udp_reply_t;
+
+// What the protocol drives; main.c fills this in with the same timer
+// control functions the voice commands and the REST API use
+typedef struct {
+    void (*start)(const udp_start_t *start);
+    void (*pause)(void);
+    void (*resume)(void);
+    void (*stop)(void);
+    void (*add)(uint32_t seconds);
+    void (*settings)(const udp_appearance_t *appearance);
+    void (*status)(udp_reply_t *out);
+} udp_control_ops_t;
+
+// Bind UDP_CONTROL_PORT and start the receive task. ops must stay valid.
+esp_err_t udp_control_start(const udp_control_ops_t *ops);
+
+// GET /api/udp
+esp_err_t udp_control_register_http(httpd_handle_t server);
+
+#endif
@@ -1,1149 +0,0 @@
-#include <stdio.h>
-const unsigned char wake_up_prompt_tone[] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x04, 0x00, 
-0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff, 
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 0xff, 0xff, 
-0xfc, 0xff, 0xfd, 0xff, 0x02, 0x00, 0x03, 0x00, 0x06, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 
-0xfe, 0xff, 0xfb, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf5, 0xff, 
-0xff, 0xff, 0x06, 0x00, 0x04, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0xff, 
-0xfc, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x00, 0x00, 
-0xfb, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0x02, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x10, 0x00, 
-0x09, 0x00, 0x02, 0x00, 0x04, 0x00, 0x03, 0x00, 0xfb, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xef, 0xff, 
-0xf1, 0xff, 0xf8, 0xff, 0x01, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x03, 0x00, 0xf8, 0xff, 
-0xf3, 0xff, 0xef, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0x02, 0x00, 0xf9, 0xff, 0xf5, 0xff, 0xf8, 0xff, 
-0xf7, 0xff, 0xfb, 0xff, 0x02, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x12, 0x00, 0x11, 0x00, 0x1c, 0x00, 
-0x21, 0x00, 0x23, 0x00, 0x23, 0x00, 0x17, 0x00, 0x10, 0x00, 0x03, 0x00, 0xfe, 0xff, 0xf2, 0xff, 
-0xe1, 0xff, 0xda, 0xff, 0xd8, 0xff, 0xe3, 0xff, 0xeb, 0xff, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 
-0x34, 0x00, 0x29, 0x00, 0x25, 0x00, 0x1b, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xfe, 0xff, 
-0xfa, 0xff, 0x3a, 0x00, 0xcb, 0xff, 0xc5, 0xfd, 0x82, 0xfb, 0xcb, 0xf9, 0xb5, 0xf9, 0x15, 0xf9, 
-0x86, 0xf9, 0x91, 0xfd, 0x05, 0x04, 0x43, 0x0c, 0xea, 0x14, 0x1f, 0x1d, 0xc5, 0x1f, 0xb8, 0x1b, 
-0x9c, 0x12, 0xb6, 0x05, 0x2f, 0xf7, 0x30, 0xe9, 0xbe, 0xdd, 0x01, 0xd6, 0xfa, 0xd2, 0xb7, 0xd4, 
-0x2b, 0xdb, 0xf4, 0xe5, 0xbc, 0xf3, 0x92, 0x02, 0xc7, 0x10, 0x8b, 0x1d, 0xc4, 0x27, 0x94, 0x2e, 
-0x7a, 0x31, 0x22, 0x30, 0x91, 0x2a, 0xdf, 0x20, 0x60, 0x13, 0xde, 0x02, 0xf8, 0xf0, 0xfa, 0xdf, 
-0x4a, 0xd2, 0x54, 0xc9, 0x1e, 0xc6, 0xc7, 0xc8, 0xf5, 0xd0, 0x1a, 0xde, 0x98, 0xee, 0x21, 0x00, 
-0xfc, 0x10, 0xc5, 0x1f, 0xbc, 0x2b, 0x7d, 0x33, 0x66, 0x36, 0xa9, 0x34, 0x80, 0x2e, 0xc1, 0x24, 
-0xe3, 0x17, 0x95, 0x08, 0x65, 0xf8, 0xf1, 0xe8, 0xb2, 0xdb, 0x1b, 0xd2, 0xb7, 0xcc, 0x02, 0xcc, 
-0xc4, 0xcf, 0xd8, 0xd7, 0xfb, 0xe3, 0x71, 0xf2, 0xa8, 0x01, 0x4a, 0x10, 0x56, 0x1d, 0xd1, 0x27, 
-0xda, 0x2e, 0xda, 0x31, 0x9d, 0x30, 0xdd, 0x2a, 0xa0, 0x20, 0xa9, 0x12, 0xbe, 0x01, 0xf5, 0xef, 
-0x85, 0xdf, 0x80, 0xd2, 0xa3, 0xca, 0x79, 0xc8, 0xda, 0xcb, 0x5d, 0xd4, 0x29, 0xe1, 0x06, 0xf1, 
-0xd1, 0x01, 0xcc, 0x11, 0xfc, 0x1f, 0x60, 0x2b, 0xd4, 0x32, 0xef, 0x35, 0x80, 0x34, 0xbc, 0x2e, 
-0xd7, 0x24, 0x6a, 0x17, 0x8d, 0x07, 0xa6, 0xf6, 0x97, 0xe6, 0x39, 0xd9, 0xa6, 0xcf, 0x9d, 0xca, 
-0x61, 0xca, 0xe9, 0xce, 0xcc, 0xd7, 0x89, 0xe4, 0x41, 0xf3, 0xa1, 0x02, 0x40, 0x11, 0xf8, 0x1d, 
-0x5c, 0x28, 0xe7, 0x2e, 0x81, 0x31, 0xfa, 0x2f, 0xe5, 0x29, 0x99, 0x1f, 0x6e, 0x11, 0xb5, 0x00, 
-0xcd, 0xef, 0x85, 0xe0, 0xea, 0xd4, 0x3b, 0xce, 0xa5, 0xcc, 0x54, 0xd0, 0xb9, 0xd8, 0x14, 0xe5, 
-0xe7, 0xf3, 0x59, 0x03, 0x1e, 0x12, 0x18, 0x1f, 0x34, 0x29, 0xa8, 0x2f, 0xd8, 0x31, 0x39, 0x2f, 
-0xbf, 0x28, 0xb2, 0x1e, 0x69, 0x11, 0xb0, 0x02, 0x6d, 0xf3, 0x61, 0xe5, 0x44, 0xda, 0xa2, 0xd2, 
-0x3e, 0xcf, 0x66, 0xd0, 0x63, 0xd5, 0x48, 0xde, 0x22, 0xeb, 0x62, 0xf8, 0xfe, 0x04, 0xaa, 0x13, 
-0xa9, 0x20, 0xe2, 0x29, 0xb4, 0x2f, 0x26, 0x31, 0x1f, 0x2e, 0x99, 0x26, 0xc2, 0x1a, 0x62, 0x0b, 
-0xe4, 0xf9, 0xa9, 0xe8, 0x5a, 0xda, 0x27, 0xd0, 0xc3, 0xca, 0xeb, 0xca, 0x09, 0xd0, 0xe7, 0xd9, 
-0x8e, 0xe7, 0x29, 0xf7, 0x3f, 0x07, 0x50, 0x16, 0x6d, 0x23, 0xc7, 0x2d, 0x0f, 0x34, 0xd9, 0x35, 
-0x01, 0x33, 0xa7, 0x2b, 0x5b, 0x20, 0x9e, 0x11, 0xe6, 0x00, 0xfe, 0xef, 0xc3, 0xe0, 0xd4, 0xd4, 
-0x02, 0xcd, 0xbe, 0xc9, 0x42, 0xcb, 0x8c, 0xd1, 0x1d, 0xdc, 0xb5, 0xe9, 0x04, 0xf9, 0x67, 0x08, 
-0xb1, 0x16, 0x15, 0x23, 0x76, 0x2c, 0x1d, 0x32, 0x2d, 0x33, 0xb9, 0x2f, 0x7a, 0x27, 0x9a, 0x1a, 
-0x6d, 0x0a, 0x01, 0xf9, 0xaa, 0xe8, 0x32, 0xdb, 0xf6, 0xd1, 0x84, 0xcd, 0x26, 0xce, 0x82, 0xd3, 
-0x1b, 0xdd, 0x0f, 0xea, 0xd8, 0xf8, 0xe7, 0x07, 0xf9, 0x15, 0x59, 0x22, 0xb7, 0x2b, 0x0b, 0x31, 
-0xb3, 0x31, 0xd6, 0x2d, 0xff, 0x25, 0x59, 0x1a, 0x07, 0x0c, 0x85, 0xfc, 0x88, 0xed, 0x9e, 0xe0, 
-0xf7, 0xd6, 0x3d, 0xd1, 0x97, 0xcf, 0x22, 0xd2, 0xed, 0xd8, 0x5e, 0xe3, 0x33, 0xf0, 0x1b, 0xfe, 
-0xe6, 0x0b, 0x9d, 0x18, 0x52, 0x23, 0x0f, 0x2b, 0x0c, 0x2f, 0xa4, 0x2e, 0xc8, 0x29, 0xcf, 0x20, 
-0xaa, 0x13, 0xdb, 0x03, 0x7e, 0xf3, 0x93, 0xe4, 0x06, 0xd9, 0x9e, 0xd1, 0xd5, 0xce, 0xcc, 0xd0, 
-0x0a, 0xd7, 0x45, 0xe1, 0x5f, 0xee, 0xaf, 0xfc, 0x0e, 0x0b, 0x6c, 0x18, 0xd0, 0x23, 0x60, 0x2c, 
-0xfe, 0x30, 0x41, 0x31, 0x1b, 0x2d, 0xce, 0x24, 0xb0, 0x18, 0xdd, 0x09, 0x0b, 0xfa, 0x10, 0xeb, 
-0x47, 0xde, 0xec, 0xd4, 0x92, 0xcf, 0x8d, 0xce, 0x08, 0xd2, 0x8d, 0xd9, 0x8a, 0xe4, 0x91, 0xf1, 
-0x7e, 0xff, 0x5d, 0x0d, 0x1a, 0x1a, 0x99, 0x24, 0xe2, 0x2b, 0x23, 0x2f, 0xf6, 0x2d, 0xa1, 0x28, 
-0xe0, 0x1e, 0x4b, 0x11, 0x91, 0x01, 0xcc, 0xf1, 0x10, 0xe4, 0xc4, 0xd9, 0x9e, 0xd3, 0x12, 0xd2, 
-0xf1, 0xd4, 0xb9, 0xdb, 0xe7, 0xe5, 0x4f, 0xf2, 0xc2, 0xff, 0x19, 0x0d, 0x56, 0x19, 0x90, 0x23, 
-0xd6, 0x2a, 0x23, 0x2e, 0xf7, 0x2c, 0xa8, 0x27, 0x8c, 0x1e, 0x2c, 0x12, 0x02, 0x04, 0xb1, 0xf5, 
-0xa1, 0xe8, 0x1b, 0xde, 0xe9, 0xd6, 0x8c, 0xd3, 0x20, 0xd4, 0x88, 0xd8, 0x81, 0xe0, 0x25, 0xeb, 
-0x55, 0xf7, 0xfd, 0x03, 0x5c, 0x10, 0x72, 0x1b, 0x4e, 0x24, 0x00, 0x2a, 0xc6, 0x2b, 0x84, 0x29, 
-0x56, 0x23, 0x01, 0x19, 0x5e, 0x0b, 0x49, 0xfc, 0xe8, 0xed, 0xf6, 0xe1, 0x7e, 0xd9, 0x04, 0xd5, 
-0x9d, 0xd4, 0x29, 0xd8, 0x48, 0xdf, 0x6b, 0xe9, 0x6c, 0xf5, 0x10, 0x02, 0x80, 0x0e, 0xbd, 0x19, 
-0xfb, 0x22, 0x6d, 0x29, 0x49, 0x2c, 0x1c, 0x2b, 0x16, 0x26, 0x30, 0x1d, 0x0d, 0x11, 0x1d, 0x03, 
-0x07, 0xf5, 0x5f, 0xe8, 0x39, 0xde, 0x6a, 0xd7, 0x54, 0xd4, 0x13, 0xd5, 0x86, 0xd9, 0x5b, 0xe1, 
-0xab, 0xeb, 0x76, 0xf7, 0xcb, 0x03, 0xd1, 0x0f, 0x96, 0x1a, 0x10, 0x23, 0x6c, 0x28, 0xf1, 0x29, 
-0x98, 0x27, 0x3e, 0x21, 0xd7, 0x16, 0xa8, 0x09, 0x8a, 0xfb, 0x69, 0xee, 0xc8, 0xe3, 0x7e, 0xdc, 
-0xf4, 0xd8, 0x43, 0xd9, 0x1f, 0xdd, 0x29, 0xe4, 0xab, 0xed, 0x9f, 0xf8, 0x16, 0x04, 0x3d, 0x0f, 
-0x34, 0x19, 0x2d, 0x21, 0x54, 0x26, 0xc6, 0x27, 0x55, 0x25, 0x59, 0x1f, 0xfe, 0x15, 0x4a, 0x0a, 
-0xc7, 0xfd, 0xcc, 0xf1, 0x9e, 0xe7, 0xff, 0xdf, 0x6e, 0xdb, 0x2c, 0xda, 0x1c, 0xdc, 0x18, 0xe1, 
-0xbc, 0xe8, 0x4e, 0xf2, 0xef, 0xfc, 0xcb, 0x07, 0x13, 0x12, 0xf5, 0x1a, 0x9c, 0x21, 0x3b, 0x25, 
-0x57, 0x25, 0xfc, 0x21, 0xe7, 0x1a, 0x42, 0x10, 0xa5, 0x03, 0xda, 0xf6, 0x90, 0xeb, 0xde, 0xe2, 
-0x57, 0xdd, 0x3f, 0xdb, 0x80, 0xdc, 0xeb, 0xe0, 0x09, 0xe8, 0x2b, 0xf1, 0x74, 0xfb, 0x0d, 0x06, 
-0x3c, 0x10, 0x35, 0x19, 0x38, 0x20, 0x95, 0x24, 0xa1, 0x25, 0x46, 0x23, 0x98, 0x1d, 0x9f, 0x14, 
-0x64, 0x09, 0x5b, 0xfd, 0xdb, 0xf1, 0x16, 0xe8, 0xc0, 0xe0, 0x5b, 0xdc, 0x28, 0xdb, 0x19, 0xdd, 
-0xf0, 0xe1, 0x3c, 0xe9, 0x68, 0xf2, 0x9f, 0xfc, 0x17, 0x07, 0x08, 0x11, 0x98, 0x19, 0xf7, 0x1f, 
-0x6f, 0x23, 0x87, 0x23, 0x2d, 0x20, 0x1f, 0x19, 0xec, 0x0e, 0x3b, 0x03, 0xaa, 0xf7, 0x9d, 0xed, 
-0xf6, 0xe5, 0x2f, 0xe1, 0x7a, 0xdf, 0xc6, 0xe0, 0xde, 0xe4, 0x48, 0xeb, 0x7d, 0xf3, 0xb7, 0xfc, 
-0x31, 0x06, 0x3d, 0x0f, 0x27, 0x17, 0x41, 0x1d, 0xc8, 0x20, 0x15, 0x21, 0x1b, 0x1e, 0xff, 0x17, 
-0x20, 0x0f, 0xd5, 0x04, 0x65, 0xfa, 0xeb, 0xf0, 0x31, 0xe9, 0xbf, 0xe3, 0xdb, 0xe0, 0xa5, 0xe0, 
-0x24, 0xe3, 0x01, 0xe8, 0xd7, 0xee, 0x1d, 0xf7, 0x2b, 0x00, 0x45, 0x09, 0xa7, 0x11, 0xaa, 0x18, 
-0xac, 0x1d, 0xf7, 0x1f, 0x29, 0x1f, 0x20, 0x1b, 0xbd, 0x13, 0xe6, 0x09, 0x22, 0xff, 0xf3, 0xf4, 
-0x6f, 0xec, 0x4b, 0xe6, 0xd2, 0xe2, 0x0a, 0xe2, 0xe6, 0xe3, 0x26, 0xe8, 0x5a, 0xee, 0x04, 0xf6, 
-0x9f, 0xfe, 0x79, 0x07, 0xd1, 0x0f, 0xf8, 0x16, 0x54, 0x1c, 0x3d, 0x1f, 0x55, 0x1f, 0x9a, 0x1c, 
-0xc1, 0x16, 0x37, 0x0e, 0x47, 0x04, 0x46, 0xfa, 0x24, 0xf1, 0xc9, 0xe9, 0xad, 0xe4, 0xf1, 0xe1, 
-0xd1, 0xe1, 0x3a, 0xe4, 0xd7, 0xe8, 0x3a, 0xef, 0x1a, 0xf7, 0xcf, 0xff, 0x9b, 0x08, 0x9f, 0x10, 
-0x49, 0x17, 0xfa, 0x1b, 0x24, 0x1e, 0x64, 0x1d, 0x42, 0x19, 0xfd, 0x11, 0xa1, 0x08, 0xcc, 0xfe, 
-0xb0, 0xf5, 0x33, 0xee, 0xad, 0xe8, 0xb4, 0xe5, 0x65, 0xe5, 0x61, 0xe7, 0x4b, 0xeb, 0xec, 0xf0, 
-0xf8, 0xf7, 0xcd, 0xff, 0xf3, 0x07, 0x7e, 0x0f, 0xe6, 0x15, 0x65, 0x1a, 0x99, 0x1c, 0xe1, 0x1b, 
-0x25, 0x18, 0x7b, 0x11, 0xec, 0x08, 0xc8, 0xff, 0xf9, 0xf6, 0x95, 0xef, 0xf4, 0xe9, 0xa7, 0xe6, 
-0x45, 0xe5, 0x44, 0xe6, 0x55, 0xe9, 0x2a, 0xee, 0x6e, 0xf4, 0xd3, 0xfb, 0xe2, 0x03, 0x67, 0x0b, 
-0x3c, 0x12, 0x58, 0x17, 0xb0, 0x1a, 0xa0, 0x1b, 0xd4, 0x19, 0xe7, 0x14, 0x49, 0x0d, 0x54, 0x04, 
-0x1f, 0xfb, 0x23, 0xf3, 0xcf, 0xec, 0xad, 0xe8, 0xaa, 0xe6, 0xe2, 0xe6, 0x3c, 0xe9, 0x62, 0xed, 
-0xf8, 0xf2, 0xba, 0xf9, 0x49, 0x01, 0xf0, 0x08, 0xfa, 0x0f, 0xa7, 0x15, 0x7f, 0x19, 0x08, 0x1b, 
-0x38, 0x1a, 0xd7, 0x16, 0xce, 0x10, 0x17, 0x09, 0x71, 0x00, 0xf6, 0xf7, 0xf9, 0xf0, 0x49, 0xeb, 
-0xbf, 0xe7, 0x47, 0xe6, 0xe3, 0xe6, 0x7e, 0xe9, 0xe5, 0xed, 0xa6, 0xf3, 0x69, 0xfa, 0x2c, 0x02, 
-0x9d, 0x09, 0x36, 0x12, 0x75, 0x18, 0xfb, 0x19, 0x6e, 0x17, 0x82, 0x11, 0x96, 0x09, 0xa3, 0xff, 
-0xb5, 0xf7, 0xdd, 0xf4, 0x1a, 0xf8, 0xc1, 0xff, 0x0b, 0x0a, 0x78, 0x10, 0x74, 0x0c, 0x44, 0x01, 
-0xf9, 0xf2, 0xb4, 0xe5, 0xd8, 0xdc, 0xad, 0xd9, 0x58, 0xdd, 0xb5, 0xe7, 0x4e, 0xf7, 0xb7, 0x09, 
-0xbf, 0x1b, 0x1d, 0x2b, 0x84, 0x35, 0x58, 0x39, 0x86, 0x34, 0x41, 0x25, 0x1e, 0x0e, 0x43, 0xf4, 
-0x97, 0xdc, 0x01, 0xca, 0x7f, 0xbe, 0x75, 0xbb, 0x6e, 0xc1, 0x15, 0xd0, 0xd8, 0xe5, 0xae, 0xff, 
-0x6e, 0x1a, 0x6c, 0x32, 0x68, 0x44, 0x22, 0x4d, 0xbb, 0x49, 0x90, 0x3a, 0xe6, 0x22, 0x96, 0x07, 
-0x1b, 0xed, 0x47, 0xd7, 0x8d, 0xc8, 0x87, 0xc2, 0x4d, 0xc5, 0xdc, 0xcf, 0xc1, 0xdf, 0x7a, 0xf2, 
-0xa4, 0x05, 0x8a, 0x16, 0x59, 0x23, 0x62, 0x28, 0x36, 0x24, 0x7a, 0x19, 0x2c, 0x0c, 0x17, 0xff, 
-0x11, 0xf4, 0xa2, 0xeb, 0x66, 0xe7, 0xe4, 0xe8, 0x68, 0xef, 0xbf, 0xfa, 0x5c, 0x08, 0xf8, 0x15, 
-0xd8, 0x20, 0x60, 0x26, 0x69, 0x24, 0x7e, 0x19, 0x52, 0x08, 0x01, 0xf5, 0xc1, 0xe3, 0x29, 0xd7, 
-0x1e, 0xd1, 0xb5, 0xd2, 0xa5, 0xdb, 0x8a, 0xea, 0x3f, 0xfd, 0xc4, 0x10, 0xc9, 0x21, 0x02, 0x2e, 
-0x96, 0x33, 0xf9, 0x30, 0x7a, 0x24, 0x8f, 0x10, 0x93, 0xf9, 0xdb, 0xe3, 0xc5, 0xd2, 0xad, 0xc7, 
-0x13, 0xc4, 0x81, 0xc8, 0x64, 0xd5, 0x64, 0xe9, 0x57, 0x01, 0xd6, 0x1a, 0x79, 0x31, 0xe6, 0x40, 
-0x73, 0x48, 0x0d, 0x45, 0x58, 0x36, 0xf6, 0x1f, 0x11, 0x06, 0x15, 0xed, 0x73, 0xd8, 0xc4, 0xca, 
-0x57, 0xc5, 0x40, 0xc8, 0xad, 0xd2, 0x87, 0xe2, 0x17, 0xf5, 0x7e, 0x07, 0x7d, 0x17, 0xbd, 0x22, 
-0xee, 0x25, 0x98, 0x20, 0x69, 0x15, 0xbe, 0x07, 0xe3, 0xfa, 0x3a, 0xf0, 0xb0, 0xe8, 0xd7, 0xe4, 
-0x29, 0xe6, 0x36, 0xed, 0xc0, 0xf8, 0xe6, 0x06, 0x3a, 0x15, 0x30, 0x21, 0x86, 0x28, 0x7d, 0x28, 
-0x65, 0x1f, 0xb9, 0x0f, 0x1d, 0xfd, 0x69, 0xeb, 0xba, 0xdd, 0x16, 0xd6, 0x1b, 0xd5, 0xfb, 0xda, 
-0x18, 0xe7, 0xc7, 0xf7, 0xff, 0x09, 0xc7, 0x1a, 0xe7, 0x27, 0xfe, 0x2e, 0x55, 0x2e, 0x01, 0x24, 
-0x77, 0x12, 0xc9, 0xfd, 0xa8, 0xe9, 0x64, 0xd9, 0xd3, 0xcd, 0x9c, 0xc8, 0x76, 0xcb, 0x6d, 0xd4, 
-0x69, 0xe3, 0x5c, 0xf9, 0xf9, 0x11, 0xba, 0x28, 0x16, 0x3a, 0xad, 0x43, 0xc9, 0x42, 0xd2, 0x36, 
-0xb3, 0x22, 0x7a, 0x0a, 0x32, 0xf2, 0x5c, 0xdd, 0xd8, 0xce, 0xd2, 0xc7, 0x1e, 0xc9, 0x84, 0xd2, 
-0xe6, 0xe1, 0x3c, 0xf4, 0xe0, 0x06, 0x17, 0x17, 0xbd, 0x22, 0xf7, 0x26, 0xbf, 0x22, 0x9d, 0x18, 
-0x76, 0x0b, 0x53, 0xfe, 0x02, 0xf3, 0x6a, 0xea, 0x18, 0xe5, 0x77, 0xe4, 0x86, 0xe9, 0x0a, 0xf4, 
-0x5d, 0x02, 0x7e, 0x11, 0xc4, 0x1e, 0x8c, 0x27, 0x1d, 0x29, 0xbe, 0x21, 0x1c, 0x13, 0x89, 0x00, 
-0x22, 0xee, 0x61, 0xdf, 0xd2, 0xd6, 0x04, 0xd4, 0x67, 0xd7, 0xed, 0xe1, 0xfe, 0xf1, 0xdb, 0x04, 
-0xf5, 0x16, 0x4d, 0x25, 0x13, 0x2e, 0x07, 0x2f, 0x8f, 0x26, 0xc1, 0x16, 0x77, 0x03, 0x5a, 0xf0, 
-0x0b, 0xe0, 0x49, 0xd4, 0xe4, 0xcd, 0xa2, 0xcd, 0xcb, 0xd4, 0x67, 0xe3, 0x86, 0xf7, 0xc5, 0x0d, 
-0xc9, 0x22, 0xb6, 0x33, 0xc4, 0x3d, 0x40, 0x3e, 0x50, 0x34, 0x82, 0x22, 0x74, 0x0c, 0xf3, 0xf5, 
-0x52, 0xe2, 0xea, 0xd3, 0xf1, 0xcb, 0xbb, 0xcb, 0x5a, 0xd3, 0x2a, 0xe1, 0x41, 0xf2, 0xbf, 0x03, 
-0x2a, 0x13, 0x58, 0x1e, 0x90, 0x22, 0x35, 0x1f, 0x46, 0x16, 0x6d, 0x0a, 0x84, 0xfe, 0x38, 0xf4, 
-0x77, 0xec, 0x4e, 0xe7, 0xe4, 0xe5, 0x18, 0xea, 0xcd, 0xf3, 0x60, 0x01, 0x41, 0x10, 0x85, 0x1d, 
-0x7c, 0x26, 0x16, 0x29, 0x71, 0x23, 0x90, 0x16, 0x85, 0x05, 0xe2, 0xf3, 0xc6, 0xe4, 0x4b, 0xda, 
-0xc7, 0xd5, 0xbc, 0xd7, 0x50, 0xe0, 0x73, 0xee, 0xf3, 0xff, 0x7a, 0x11, 0xe0, 0x1f, 0xfd, 0x28, 
-0xae, 0x2a, 0xf6, 0x23, 0x5d, 0x16, 0x6f, 0x05, 0x42, 0xf4, 0x32, 0xe5, 0x05, 0xda, 0xae, 0xd3, 
-0x94, 0xd2, 0x0c, 0xd8, 0x7b, 0xe4, 0x44, 0xf6, 0x8f, 0x0a, 0x26, 0x1e, 0x2d, 0x2e, 0x9e, 0x37, 
-0x84, 0x38, 0x3e, 0x30, 0x74, 0x20, 0x3e, 0x0c, 0x29, 0xf7, 0x9c, 0xe4, 0xee, 0xd6, 0x63, 0xcf, 
-0x1b, 0xcf, 0x33, 0xd6, 0x81, 0xe3, 0x5d, 0xf4, 0x61, 0x05, 0x21, 0x14, 0x7b, 0x1e, 0x27, 0x22, 
-0xea, 0x1e, 0x72, 0x16, 0x29, 0x0b, 0x99, 0xff, 0x59, 0xf5, 0x91, 0xed, 0x3f, 0xe8, 0x71, 0xe6, 
-0xda, 0xe9, 0x8c, 0xf2, 0x3c, 0xff, 0x32, 0x0d, 0xe6, 0x19, 0xf0, 0x22, 0xf9, 0x25, 0xac, 0x21, 
-0x78, 0x16, 0xf4, 0x06, 0x65, 0xf6, 0xd2, 0xe7, 0xe8, 0xdc, 0x38, 0xd7, 0x93, 0xd7, 0x64, 0xde, 
-0x16, 0xeb, 0x80, 0xfb, 0x6d, 0x0c, 0xe9, 0x1a, 0xd2, 0x24, 0xe4, 0x27, 0x6d, 0x23, 0xa6, 0x18, 
-0x89, 0x0a, 0xbf, 0xfb, 0x29, 0xee, 0x70, 0xe3, 0x6a, 0xdc, 0x86, 0xd9, 0x11, 0xdc, 0xf0, 0xe4, 
-0x25, 0xf3, 0x55, 0x04, 0xcc, 0x15, 0xa1, 0x24, 0x15, 0x2e, 0x59, 0x30, 0xa7, 0x2a, 0x38, 0x1e, 
-0x9e, 0x0d, 0xca, 0xfb, 0x66, 0xeb, 0x92, 0xde, 0xd0, 0xd6, 0x3f, 0xd5, 0x42, 0xda, 0xfc, 0xe4, 
-0x5a, 0xf3, 0x5a, 0x02, 0x66, 0x0f, 0x83, 0x18, 0x19, 0x1c, 0xb7, 0x19, 0xf0, 0x12, 0xe2, 0x09, 
-0x60, 0x00, 0x16, 0xf8, 0xd3, 0xf1, 0x40, 0xed, 0x0b, 0xeb, 0x10, 0xed, 0xd2, 0xf3, 0x91, 0xfe, 
-0x08, 0x0b, 0xeb, 0x16, 0x7e, 0x1f, 0x90, 0x22, 0x39, 0x1f, 0x96, 0x15, 0xd2, 0x07, 0xb9, 0xf8, 
-0x11, 0xeb, 0xf1, 0xe0, 0x7d, 0xdb, 0x64, 0xdb, 0x22, 0xe1, 0x4d, 0xec, 0x2a, 0xfb, 0xe3, 0x0a, 
-0x98, 0x18, 0xf2, 0x21, 0xd8, 0x24, 0xea, 0x20, 0x5c, 0x17, 0x72, 0x0a, 0x9e, 0xfc, 0xa0, 0xef, 
-0x40, 0xe5, 0x5a, 0xde, 0xf0, 0xda, 0x55, 0xdc, 0xac, 0xe3, 0x35, 0xf0, 0xfb, 0xff, 0xa4, 0x10, 
-0x61, 0x1f, 0x4a, 0x29, 0xc4, 0x2c, 0x24, 0x29, 0x00, 0x1f, 0x5d, 0x10, 0x18, 0x00, 0xb9, 0xf0, 
-0x47, 0xe4, 0x28, 0xdc, 0x5c, 0xd9, 0xdd, 0xdc, 0x1c, 0xe6, 0xc9, 0xf2, 0x98, 0x00, 0xe9, 0x0c, 
-0x98, 0x15, 0x7e, 0x19, 0x03, 0x18, 0xa4, 0x12, 0x4f, 0x0b, 0xf1, 0x02, 0x58, 0xfb, 0xec, 0xf4, 
-0xad, 0xef, 0xb9, 0xec, 0x5e, 0xed, 0x5c, 0xf2, 0x61, 0xfb, 0x70, 0x06, 0xf8, 0x10, 0x14, 0x19, 
-0xfd, 0x1c, 0x4d, 0x1b, 0x9e, 0x14, 0x55, 0x09, 0x9d, 0xfc, 0x2f, 0xf0, 0x5e, 0xe6, 0x4c, 0xe0, 
-0x0d, 0xdf, 0x65, 0xe3, 0x8a, 0xec, 0x4c, 0xf9, 0x52, 0x07, 0xe4, 0x13, 0xa3, 0x1c, 0x9f, 0x1f, 
-0x12, 0x1d, 0xa5, 0x15, 0x6b, 0x0b, 0xd2, 0xff, 0x3c, 0xf5, 0x01, 0xec, 0xf4, 0xe4, 0x69, 0xe1, 
-0xe1, 0xe1, 0x42, 0xe7, 0xc5, 0xf1, 0x1b, 0xff, 0x2d, 0x0d, 0xef, 0x19, 0x99, 0x22, 0xda, 0x25, 
-0x24, 0x23, 0xea, 0x1a, 0xeb, 0x0e, 0x28, 0x01, 0xa4, 0xf3, 0x76, 0xe8, 0xe2, 0xe0, 0xd0, 0xdd, 
-0x5b, 0xe0, 0xc5, 0xe7, 0xde, 0xf2, 0x73, 0xff, 0x66, 0x0a, 0xf9, 0x11, 0x75, 0x15, 0x3b, 0x14, 
-0x9f, 0x0f, 0x92, 0x09, 0x72, 0x02, 0xb8, 0xfb, 0x73, 0xf6, 0x1a, 0xf2, 0x3f, 0xef, 0xdb, 0xef, 
-0x44, 0xf4, 0x30, 0xfc, 0xba, 0x05, 0x47, 0x0f, 0x41, 0x17, 0x50, 0x1b, 0x7d, 0x1a, 0xbd, 0x14, 
-0xea, 0x0a, 0x0e, 0xff, 0x8d, 0xf3, 0xb7, 0xe9, 0x41, 0xe3, 0x4b, 0xe1, 0x90, 0xe3, 0x0e, 0xeb, 
-0x84, 0xf6, 0xdf, 0x02, 0x02, 0x0f, 0x00, 0x19, 0xe2, 0x1c, 0xd4, 0x1b, 0x2f, 0x16, 0x60, 0x0d, 
-0xf1, 0x02, 0xbc, 0xf8, 0x23, 0xf0, 0x50, 0xe9, 0xea, 0xe4, 0x32, 0xe4, 0x67, 0xe8, 0x9c, 0xf0, 
-0x2c, 0xfb, 0x82, 0x07, 0xc2, 0x12, 0xc8, 0x1b, 0xc3, 0x1f, 0x25, 0x1f, 0x32, 0x19, 0x7c, 0x0f, 
-0x06, 0x04, 0x11, 0xf8, 0xce, 0xee, 0x8b, 0xe7, 0x8e, 0xe3, 0x86, 0xe4, 0x56, 0xea, 0x0f, 0xf3, 
-0x74, 0xfd, 0x2c, 0x08, 0x4e, 0x0f, 0xb5, 0x12, 0x53, 0x12, 0x0b, 0x0f, 0xa2, 0x0a, 0xdb, 0x04, 
-0x7c, 0xfe, 0x1b, 0xf9, 0xf4, 0xf3, 0x09, 0xf1, 0x47, 0xf0, 0xce, 0xf2, 0xad, 0xf9, 0xd3, 0x01, 
-0x73, 0x0a, 0xb9, 0x11, 0x62, 0x15, 0x08, 0x16, 0x98, 0x12, 0xc7, 0x0a, 0x5a, 0x01, 0xbe, 0xf7, 
-0x1d, 0xef, 0x70, 0xe8, 0x5d, 0xe5, 0x4c, 0xe7, 0x17, 0xed, 0x5f, 0xf6, 0x45, 0x01, 0x79, 0x0b, 
-0x3a, 0x13, 0x60, 0x17, 0x42, 0x17, 0x26, 0x13, 0x58, 0x0c, 0xda, 0x04, 0x8c, 0xfd, 0xca, 0xf5, 
-0x68, 0xef, 0x70, 0xea, 0xc7, 0xe8, 0x9f, 0xeb, 0xb1, 0xf1, 0x5c, 0xfa, 0xd4, 0x04, 0x7b, 0x0e, 
-0xb5, 0x16, 0xd9, 0x1a, 0x79, 0x1a, 0x75, 0x16, 0x91, 0x0e, 0x1b, 0x05, 0xcd, 0xfa, 0xdc, 0xf0, 
-0xaa, 0xe9, 0xaf, 0xe5, 0x22, 0xe6, 0xd5, 0xea, 0xe8, 0xf2, 0xf5, 0xfc, 0xe0, 0x05, 0xe6, 0x0c, 
-0xc0, 0x10, 0x45, 0x11, 0xb8, 0x0e, 0xa3, 0x0a, 0xef, 0x04, 0x71, 0xfd, 0x31, 0xdf, 0x80, 0xd9, 
-0x95, 0xf7, 0xec, 0x0b, 0xa8, 0x1a, 0x61, 0x24, 0xfd, 0x28, 0x80, 0x23, 0xa3, 0x11, 0x9b, 0xf9, 
-0x1c, 0xe4, 0x37, 0xd4, 0xd9, 0xcf, 0x8e, 0xd6, 0x7f, 0xe5, 0xc1, 0xf7, 0x51, 0x08, 0x26, 0x15, 
-0xe8, 0x1b, 0xd7, 0x1b, 0x08, 0x14, 0x27, 0x07, 0xdd, 0xfa, 0xa7, 0xf1, 0xca, 0xee, 0x67, 0xf4, 
-0xce, 0xff, 0x3b, 0x0d, 0x0c, 0x1b, 0xc8, 0x24, 0x8d, 0x25, 0x1e, 0x1a, 0xbc, 0x01, 0x15, 0xe4, 
-0x07, 0xcb, 0x5a, 0xbd, 0x18, 0xc1, 0x74, 0xd4, 0xba, 0xf0, 0x08, 0x10, 0xba, 0x2b, 0x6d, 0x3f, 
-0x04, 0x46, 0x25, 0x3d, 0xac, 0x26, 0xf9, 0x07, 0xbd, 0xe8, 0x67, 0xcf, 0x4d, 0xc1, 0x4e, 0xc2, 
-0xf6, 0xd0, 0x06, 0xea, 0x59, 0x08, 0x5a, 0x24, 0xfc, 0x36, 0xf4, 0x38, 0x5d, 0x2a, 0x51, 0x10, 
-0x45, 0xf2, 0x30, 0xda, 0xbe, 0xcd, 0x21, 0xcf, 0x4d, 0xdb, 0x11, 0xee, 0x2f, 0x04, 0xaa, 0x18, 
-0x9e, 0x27, 0xe1, 0x2d, 0x23, 0x28, 0x49, 0x1a, 0x06, 0x08, 0x46, 0xf6, 0x17, 0xea, 0x3f, 0xe5, 
-0x6d, 0xe8, 0x3a, 0xf1, 0x82, 0xfe, 0x5f, 0x0c, 0x8f, 0x15, 0x33, 0x17, 0x53, 0x0e, 0x3f, 0xfc, 
-0xaa, 0xe9, 0x6d, 0xdc, 0x61, 0xd9, 0x0c, 0xe0, 0x09, 0xef, 0xd2, 0x02, 0x45, 0x16, 0x43, 0x26, 
-0xf1, 0x2e, 0xf5, 0x2c, 0xc8, 0x1e, 0x71, 0x07, 0x58, 0xee, 0x86, 0xda, 0xea, 0xcf, 0x6d, 0xd1, 
-0xe8, 0xdd, 0xfb, 0xf2, 0x04, 0x0c, 0x6c, 0x24, 0x14, 0x36, 0xa5, 0x3a, 0xbb, 0x2e, 0xa4, 0x14, 
-0xf7, 0xf4, 0xbf, 0xd8, 0x42, 0xc5, 0x77, 0xc0, 0xdd, 0xca, 0x53, 0xdf, 0xb4, 0xfa, 0xa7, 0x16, 
-0x21, 0x2c, 0x26, 0x36, 0x72, 0x32, 0x55, 0x23, 0x7b, 0x0d, 0x32, 0xf7, 0x89, 0xe5, 0xef, 0xdb, 
-0xd3, 0xdb, 0x6d, 0xe3, 0x4a, 0xf2, 0x90, 0x05, 0xc2, 0x17, 0x81, 0x24, 0x15, 0x26, 0xa5, 0x1a, 
-0x40, 0x07, 0xa5, 0xf2, 0x57, 0xe3, 0x82, 0xdd, 0x70, 0xe1, 0xfe, 0xeb, 0xf1, 0xfa, 0xa0, 0x0a, 
-0x04, 0x17, 0xad, 0x1c, 0xe1, 0x19, 0xc0, 0x0f, 0x3e, 0x01, 0x38, 0xf3, 0xaa, 0xe9, 0x43, 0xe6, 
-0xe8, 0xe9, 0x31, 0xf3, 0x23, 0x01, 0xf4, 0x10, 0x7a, 0x1e, 0x8a, 0x25, 0xcd, 0x1f, 0x9e, 0x0e, 
-0x85, 0xf6, 0x05, 0xdd, 0x7b, 0xcc, 0xe0, 0xc8, 0xe5, 0xd2, 0x79, 0xe7, 0x28, 0x02, 0x37, 0x1e, 
-0x3f, 0x34, 0x6e, 0x3f, 0xb3, 0x3c, 0x58, 0x2c, 0xbc, 0x12, 0x3c, 0xf7, 0xbc, 0xde, 0x9b, 0xce, 
-0x10, 0xca, 0x21, 0xd1, 0x60, 0xe2, 0x27, 0xfb, 0x5a, 0x15, 0xd1, 0x29, 0x9e, 0x31, 0xd9, 0x28, 
-0x89, 0x14, 0x47, 0xfb, 0xc0, 0xe4, 0xb9, 0xd6, 0xe8, 0xd3, 0x70, 0xdb, 0x4c, 0xea, 0x39, 0xfe, 
-0x1c, 0x13, 0xd0, 0x23, 0x14, 0x2b, 0xa3, 0x26, 0xae, 0x19, 0x80, 0x08, 0xf2, 0xf7, 0xb8, 0xeb, 
-0x64, 0xe5, 0xf3, 0xe5, 0x9c, 0xec, 0xaf, 0xf8, 0x16, 0x07, 0xd3, 0x12, 0x14, 0x17, 0x73, 0x10, 
-0xfb, 0x01, 0x5b, 0xf1, 0x0c, 0xe4, 0x13, 0xde, 0x21, 0xe1, 0x8b, 0xec, 0xa5, 0xfd, 0xb2, 0x11, 
-0x09, 0x24, 0x8d, 0x2e, 0x3c, 0x2e, 0xff, 0x21, 0x4b, 0x0d, 0xe7, 0xf5, 0x80, 0xe1, 0xab, 0xd4, 
-0xf8, 0xd1, 0x96, 0xd9, 0x64, 0xea, 0x34, 0x01, 0x0f, 0x19, 0xe8, 0x2c, 0xef, 0x36, 0x8f, 0x31, 
-0x21, 0x1e, 0x25, 0x03, 0x08, 0xe8, 0x0e, 0xd3, 0x9c, 0xc8, 0x39, 0xca, 0x12, 0xd7, 0x60, 0xed, 
-0x0b, 0x08, 0x06, 0x20, 0x1f, 0x2f, 0x03, 0x31, 0x88, 0x26, 0xbc, 0x14, 0xfb, 0x00, 0x27, 0xef, 
-0x36, 0xe2, 0x9c, 0xdc, 0x24, 0xdf, 0x11, 0xea, 0xb1, 0xfa, 0xac, 0x0c, 0xd1, 0x1a, 0x9c, 0x1e, 
-0x80, 0x17, 0x1d, 0x0a, 0x21, 0xfb, 0xda, 0xee, 0x20, 0xe8, 0xed, 0xe8, 0xdc, 0xf0, 0x89, 0xfd, 
-0x6c, 0x0c, 0x57, 0x18, 0x30, 0x1d, 0x2f, 0x19, 0x44, 0x0d, 0xb2, 0xfd, 0x33, 0xef, 0x63, 0xe5, 
-0x75, 0xe2, 0xdf, 0xe5, 0x63, 0xef, 0xb8, 0xfe, 0xc1, 0x10, 0xdb, 0x20, 0x47, 0x2a, 0x0b, 0x28, 
-0x0a, 0x19, 0x8c, 0x01, 0xf9, 0xe8, 0xc8, 0xd5, 0xf7, 0xcb, 0x95, 0xcd, 0x16, 0xda, 0x70, 0xef, 
-0x8b, 0x09, 0x5c, 0x22, 0x40, 0x34, 0xec, 0x39, 0xa3, 0x31, 0x12, 0x1f, 0x8d, 0x07, 0x73, 0xf0, 
-0xdc, 0xdd, 0xca, 0xd2, 0x2c, 0xd1, 0xee, 0xd9, 0xe4, 0xeb, 0x7d, 0x02, 0x60, 0x17, 0x71, 0x23, 
-0x5b, 0x22, 0x45, 0x17, 0x8b, 0x07, 0x34, 0xf7, 0x66, 0xea, 0x07, 0xe4, 0x21, 0xe5, 0x90, 0xed, 
-0xb1, 0xfb, 0x05, 0x0c, 0x31, 0x19, 0x61, 0x1e, 0xf3, 0x1a, 0x6f, 0x11, 0x17, 0x05, 0xdc, 0xf8, 
-0x8d, 0xef, 0xa9, 0xeb, 0x5e, 0xed, 0x0a, 0xf4, 0x35, 0xff, 0xc1, 0x0b, 0xc5, 0x15, 0xb5, 0x18, 
-0x85, 0x11, 0x6b, 0x03, 0x65, 0xf3, 0xa9, 0xe5, 0xd1, 0xdd, 0x84, 0xdd, 0x35, 0xe5, 0xad, 0xf3, 
-0x38, 0x06, 0x6d, 0x19, 0x47, 0x28, 0xec, 0x2d, 0xcd, 0x27, 0xff, 0x17, 0x75, 0x03, 0xe8, 0xee, 
-0xa8, 0xde, 0x0d, 0xd6, 0x5f, 0xd6, 0xa7, 0xdf, 0x97, 0xf0, 0xbb, 0x05, 0x49, 0x1a, 0x85, 0x28, 
-0xe2, 0x2a, 0x38, 0x21, 0x08, 0x10, 0xf8, 0xfb, 0xbf, 0xe9, 0xfe, 0xdc, 0x2c, 0xd8, 0xf0, 0xdc, 
-0xb7, 0xea, 0xf4, 0xfd, 0x1c, 0x11, 0x81, 0x1e, 0x65, 0x22, 0x1a, 0x1d, 0x13, 0x12, 0xae, 0x04, 
-0xe8, 0xf7, 0x3d, 0xee, 0x62, 0xe9, 0x30, 0xea, 0xf1, 0xf0, 0x3b, 0xfc, 0x04, 0x09, 0x2c, 0x13, 
-0xe5, 0x15, 0x95, 0x10, 0xc8, 0x06, 0x59, 0xfb, 0x08, 0xf1, 0x69, 0xea, 0xaf, 0xe9, 0xcf, 0xef, 
-0x40, 0xfb, 0x20, 0x09, 0xc3, 0x15, 0x16, 0x1d, 0xea, 0x1b, 0x88, 0x12, 0xc7, 0x04, 0xa0, 0xf6, 
-0x18, 0xeb, 0x41, 0xe4, 0x29, 0xe3, 0x28, 0xe8, 0xf6, 0xf2, 0xf2, 0x01, 0xba, 0x11, 0xbf, 0x1d, 
-0xe5, 0x20, 0x8b, 0x19, 0x20, 0x0b, 0xff, 0xf9, 0x42, 0xea, 0x58, 0xdf, 0xb5, 0xdb, 0xf9, 0xe0, 
-0x94, 0xee, 0xaf, 0x01, 0x92, 0x15, 0xb1, 0x24, 0x71, 0x2a, 0x96, 0x25, 0x06, 0x19, 0xa7, 0x08, 
-0xe1, 0xf7, 0x86, 0xe9, 0xd3, 0xdf, 0xe1, 0xdc, 0xe9, 0xe1, 0x27, 0xee, 0x8c, 0xfe, 0xcb, 0x0e, 
-0x49, 0x19, 0x89, 0x1a, 0x19, 0x14, 0x4d, 0x09, 0x47, 0xfd, 0xa3, 0xf2, 0x2f, 0xeb, 0x53, 0xe9, 
-0x48, 0xee, 0xcf, 0xf8, 0xf0, 0x05, 0xce, 0x11, 0x4b, 0x18, 0x3b, 0x17, 0x2c, 0x10, 0x36, 0x06, 
-0xb1, 0xfb, 0xb0, 0xf2, 0xf7, 0xec, 0x57, 0xec, 0x6b, 0xf1, 0xe5, 0xfa, 0x43, 0x06, 0x62, 0x10, 
-0x20, 0x15, 0xd7, 0x11, 0x5b, 0x08, 0x75, 0xfc, 0x27, 0xf1, 0xdb, 0xe8, 0x0b, 0xe5, 0x34, 0xe7, 
-0x1a, 0xf0, 0x54, 0xfe, 0xc0, 0x0e, 0x0b, 0x1d, 0x59, 0x24, 0xe0, 0x21, 0x3d, 0x17, 0x35, 0x08, 
-0x3b, 0xf8, 0x6c, 0xea, 0x39, 0xe1, 0xb2, 0xde, 0x08, 0xe4, 0x44, 0xf0, 0xab, 0x00, 0x39, 0x11, 
-0x0e, 0x1d, 0x54, 0x20, 0x73, 0x1b, 0x1a, 0x11, 0x74, 0x03, 0x18, 0xf5, 0xbd, 0xe8, 0x60, 0xe1, 
-0xc4, 0xe1, 0xc9, 0xe9, 0x33, 0xf7, 0xaf, 0x06, 0xca, 0x13, 0x1d, 0x1a, 0x9e, 0x18, 0xac, 0x11, 
-0x03, 0x08, 0xbd, 0xfd, 0x8e, 0xf4, 0x3d, 0xee, 0x02, 0xed, 0x1f, 0xf1, 0x30, 0xf9, 0x0e, 0x03, 
-0x5e, 0x0b, 0xb2, 0x0e, 0x7e, 0x0c, 0xb2, 0x06, 0x5a, 0xff, 0xf0, 0xf7, 0x04, 0xf2, 0x46, 0xef, 
-0x11, 0xf2, 0xbd, 0xfa, 0xac, 0x06, 0x4b, 0x12, 0xbe, 0x19, 0x94, 0x19, 0x12, 0x12, 0x4b, 0x06, 
-0xa3, 0xf9, 0xc3, 0xee, 0x62, 0xe7, 0xb8, 0xe4, 0x1b, 0xe8, 0x46, 0xf1, 0x60, 0xfe, 0x92, 0x0c, 
-0x36, 0x18, 0x31, 0x1d, 0x0c, 0x1a, 0x9c, 0x10, 0xa6, 0x03, 0xd3, 0xf5, 0xe0, 0xe9, 0x49, 0xe2, 
-0xf2, 0xe1, 0xb6, 0xe9, 0x81, 0xf7, 0xd2, 0x07, 0x93, 0x16, 0x61, 0x1f, 0xfd, 0x1f, 0x8f, 0x19, 
-0x84, 0x0e, 0x52, 0x01, 0x41, 0xf4, 0x40, 0xe9, 0x59, 0xe3, 0x57, 0xe4, 0x6e, 0xeb, 0xe7, 0xf6, 
-0x9e, 0x03, 0x55, 0x0d, 0x6d, 0x11, 0x32, 0x10, 0x4e, 0x0b, 0x25, 0x04, 0x54, 0xfc, 0xa3, 0xf5, 
-0x5e, 0xf2, 0x76, 0xf4, 0x40, 0xfb, 0x5b, 0x04, 0x00, 0x0d, 0xe1, 0x11, 0xf3, 0x10, 0x48, 0x0b, 
-0x69, 0x03, 0x65, 0xfb, 0x7a, 0xf4, 0x7d, 0xef, 0x50, 0xee, 0x79, 0xf2, 0x0d, 0xfb, 0xa0, 0x05, 
-0x0e, 0x0f, 0x16, 0x14, 0xdb, 0x12, 0x5b, 0x0c, 0x0c, 0x03, 0xd1, 0xf8, 0x7c, 0xef, 0xe8, 0xe8, 
-0x20, 0xe7, 0xb6, 0xeb, 0xe3, 0xf5, 0x55, 0x03, 0x04, 0x11, 0xec, 0x1a, 0xc0, 0x1d, 0x43, 0x19, 
-0x74, 0x0f, 0xcc, 0x02, 0x0f, 0xf6, 0x3c, 0xeb, 0xa0, 0xe4, 0xd2, 0xe4, 0x93, 0xeb, 0xe5, 0xf6, 
-0x14, 0x04, 0x2c, 0x0f, 0x29, 0x15, 0x6c, 0x15, 0x0a, 0x11, 0x7b, 0x09, 0xf5, 0xff, 0xf4, 0xf5, 
-0x04, 0xee, 0x5c, 0xeb, 0xfe, 0xee, 0x64, 0xf7, 0x10, 0x02, 0xd0, 0x0b, 0x45, 0x11, 0x02, 0x11, 
-0x6d, 0x0c, 0xad, 0x05, 0x73, 0xfe, 0xd0, 0xf7, 0xf8, 0xf2, 0x23, 0xf2, 0xc1, 0xf5, 0x3d, 0xfc, 
-0xf9, 0x03, 0x48, 0x0a, 0xd0, 0x0c, 0x5c, 0x0b, 0x1f, 0x07, 0x84, 0x01, 0x2e, 0xfb, 0xc5, 0xf4, 
-0x31, 0xf0, 0x2f, 0xf0, 0xf6, 0xf5, 0xb2, 0xff, 0x52, 0x0a, 0x9f, 0x12, 0xd2, 0x15, 0x20, 0x13, 
-0xd4, 0x0b, 0x2b, 0x02, 0x41, 0xf8, 0x7f, 0xef, 0xb7, 0xe9, 0x16, 0xe9, 0x1b, 0xee, 0x32, 0xf7, 
-0x61, 0x02, 0x9a, 0x0c, 0xb8, 0x12, 0xac, 0x13, 0xed, 0x0f, 0xac, 0x08, 0x60, 0xff, 0x5e, 0xf5, 
-0x2d, 0xed, 0xe4, 0xe9, 0x1d, 0xed, 0x35, 0xf6, 0x5d, 0x02, 0x14, 0x0e, 0x0e, 0x16, 0x0b, 0x18, 
-0x9d, 0x14, 0xa0, 0x0d, 0x96, 0x04, 0xe3, 0xfa, 0xf8, 0xf1, 0x3c, 0xec, 0xba, 0xeb, 0x03, 0xf0, 
-0x99, 0xf7, 0x54, 0x00, 0x40, 0x07, 0xf4, 0x0a, 0x72, 0x0b, 0xf7, 0x08, 0x56, 0x04, 0x6b, 0xfe, 
-0x5f, 0xf8, 0xcd, 0xf4, 0xcf, 0xf5, 0xfd, 0xfa, 0x58, 0x02, 0x88, 0x09, 0x66, 0x0e, 0x6a, 0x0f, 
-0x48, 0x0c, 0x3f, 0x06, 0x08, 0xff, 0xfe, 0xf7, 0xfe, 0xf1, 0xb8, 0xee, 0x55, 0xf0, 0x46, 0xf6, 
-0x93, 0xfe, 0xfe, 0x06, 0x8e, 0x0c, 0xf6, 0x0d, 0x8b, 0x0b, 0x90, 0x06, 0x14, 0x00, 0x15, 0xf9, 
-0xc1, 0xf2, 0x1a, 0xef, 0x87, 0xf0, 0x0f, 0xf7, 0x92, 0x00, 0x83, 0x0a, 0x34, 0x12, 0x91, 0x15, 
-0x81, 0x13, 0xff, 0x0c, 0x0c, 0x04, 0x2a, 0xfa, 0x1c, 0xf1, 0x09, 0xeb, 0x4b, 0xea, 0xda, 0xee, 
-0x84, 0xf6, 0x8f, 0x00, 0x06, 0x0a, 0xfd, 0x0f, 0x60, 0x12, 0x38, 0x11, 0xcf, 0x0c, 0xb9, 0x05, 
-0xe9, 0xfc, 0x8b, 0xf4, 0xdd, 0xef, 0x45, 0xf0, 0xe7, 0xf4, 0x2a, 0xfc, 0xa5, 0x03, 0x26, 0x09, 
-0x7f, 0x0b, 0x2c, 0x0a, 0xea, 0x05, 0x5e, 0x00, 0x7e, 0xfa, 0xe8, 0xf5, 0x9b, 0xf4, 0x2f, 0xf7, 
-0x75, 0xfc, 0x43, 0x02, 0xe4, 0x06, 0x38, 0x09, 0x34, 0x09, 0x21, 0x07, 0x70, 0x03, 0x9d, 0xfe, 
-0x2a, 0xf9, 0x62, 0xf4, 0xc9, 0xf2, 0xc9, 0xf5, 0xa5, 0xfc, 0x69, 0x05, 0x3b, 0x0d, 0xe9, 0x11, 
-0xd2, 0x11, 0xdc, 0x0c, 0xe4, 0x04, 0xe4, 0xfb, 0xa6, 0xf3, 0x9f, 0xed, 0xb1, 0xeb, 0xe0, 0xee, 
-0x42, 0xf6, 0xa3, 0xff, 0x58, 0x08, 0xb3, 0x0e, 0xe8, 0x11, 0x67, 0x11, 0x53, 0x0d, 0x41, 0x06, 
-0x30, 0xfd, 0xf1, 0xf3, 0xa8, 0xed, 0xbc, 0xec, 0x3f, 0xf1, 0x96, 0xf9, 0x10, 0x03, 0x5b, 0x0b, 
-0xb6, 0x10, 0xe9, 0x11, 0x27, 0x0f, 0x5d, 0x09, 0xac, 0x01, 0x9c, 0xf9, 0x61, 0xf3, 0xbd, 0xf0, 
-0x0e, 0xf2, 0x52, 0xf6, 0x9b, 0xfb, 0x73, 0x00, 0x38, 0x04, 0x41, 0x06, 0x4d, 0x06, 0x5e, 0x04, 
-0xce, 0x00, 0x91, 0xfc, 0x67, 0xf9, 0x80, 0xf9, 0xe3, 0xfc, 0x5c, 0x02, 0xde, 0x07, 0xbe, 0x0b, 
-0x1a, 0x0d, 0x23, 0x0b, 0x31, 0x06, 0xb8, 0xff, 0x38, 0xf9, 0xb6, 0xf3, 0xc0, 0xf0, 0xa3, 0xf1, 
-0x6e, 0xf6, 0xd6, 0xfd, 0x4b, 0x05, 0xd9, 0x0a, 0x00, 0x0e, 0xe1, 0x0d, 0xf7, 0x09, 0x68, 0x04, 
-0x09, 0xfe, 0xe9, 0xf6, 0x2e, 0xf1, 0x71, 0xef, 0x9c, 0xf2, 0x60, 0xf9, 0xad, 0x01, 0x3b, 0x09, 
-0xbc, 0x0e, 0xe1, 0x10, 0x28, 0x0f, 0x27, 0x0a, 0xb3, 0x02, 0x03, 0xfa, 0xc3, 0xf2, 0x2d, 0xef, 
-0xf1, 0xef, 0x73, 0xf4, 0x9f, 0xfa, 0xcc, 0x00, 0x0b, 0x06, 0xba, 0x09, 0x68, 0x0b, 0x96, 0x0a, 
-0x7e, 0x07, 0x48, 0x02, 0x6e, 0xfc, 0x2d, 0xf8, 0x43, 0xf7, 0x85, 0xf9, 0x96, 0xfd, 0xdc, 0x01, 
-0x53, 0x05, 0x34, 0x07, 0x8d, 0x06, 0xc7, 0x03, 0xc8, 0xff, 0x73, 0xfb, 0x39, 0xf8, 0x94, 0xf7, 
-0xd6, 0xf9, 0x2e, 0xfe, 0xe8, 0x02, 0x2b, 0x06, 0x70, 0x07, 0x7b, 0x07, 0x58, 0x06, 0xbe, 0x03, 
-0xd5, 0xff, 0x0b, 0xfb, 0x85, 0xf6, 0x3c, 0xf4, 0xb2, 0xf5, 0x95, 0xfa, 0x3f, 0x01, 0xc9, 0x07, 
-0x91, 0x0c, 0x9e, 0x0e, 0x28, 0x0d, 0x8b, 0x08, 0xd9, 0x01, 0x5d, 0xfa, 0xeb, 0xf3, 0x55, 0xf0, 
-0x8b, 0xf0, 0x5b, 0xf4, 0x27, 0xfa, 0x09, 0x00, 0x11, 0x05, 0x00, 0x09, 0x42, 0x0b, 0x13, 0x0b, 
-0x56, 0x08, 0x26, 0x03, 0xdd, 0xfc, 0x7f, 0xf7, 0x6e, 0xf5, 0x1d, 0xf7, 0x64, 0xfb, 0xd2, 0x00, 
-0xc2, 0x05, 0xa0, 0x09, 0x22, 0x0b, 0xb3, 0x09, 0x1a, 0x06, 0xf3, 0x00, 0x9b, 0xfb, 0x88, 0xf7, 
-0x02, 0xf6, 0x30, 0xf7, 0x17, 0xfa, 0x5a, 0xfd, 0x35, 0x00, 0x9c, 0x02, 0x53, 0x04, 0xd2, 0x04, 
-0xa7, 0x03, 0x1e, 0x01, 0xe9, 0xfd, 0x48, 0xfb, 0xe6, 0xfa, 0x24, 0xfd, 0x1c, 0x01, 0x4b, 0x05, 
-0x73, 0x08, 0xec, 0x09, 0x53, 0x09, 0x71, 0x06, 0xc3, 0x01, 0xeb, 0xfb, 0x4f, 0xf6, 0xd5, 0xf2, 
-0xa8, 0xf2, 0xa3, 0xf5, 0xcf, 0xfa, 0x72, 0x00, 0x13, 0x05, 0x9e, 0x08, 0xfb, 0x09, 0x92, 0x09, 
-0x5e, 0x07, 0x07, 0x03, 0xb4, 0xfd, 0xc9, 0xf8, 0x0e, 0xf6, 0x57, 0xf6, 0x62, 0xf9, 0xfa, 0xfd, 
-0xdb, 0x02, 0x30, 0x07, 0x12, 0x0a, 0x62, 0x0a, 0xff, 0x07, 0x82, 0x03, 0x14, 0xfe, 0x54, 0xf9, 
-0x8e, 0xf6, 0x83, 0xf6, 0xfd, 0xf8, 0x64, 0xfc, 0x6c, 0xff, 0x3e, 0x02, 0x02, 0x05, 0xe4, 0x06, 
-0x2b, 0x07, 0x91, 0x05, 0x79, 0x02, 0x07, 0xff, 0x51, 0xfc, 0x61, 0xfb, 0x66, 0xfc, 0x85, 0xfe, 
-0xa9, 0x00, 0x68, 0x02, 0xa5, 0x03, 0xb2, 0x03, 0x22, 0x02, 0x25, 0xff, 0xbe, 0xfb, 0x41, 0xf9, 
-0xc0, 0xf8, 0x9d, 0xfa, 0xfe, 0xfd, 0x84, 0x01, 0xb1, 0x03, 0xc2, 0x04, 0x61, 0x05, 0x64, 0x05, 
-0x10, 0x04, 0x3b, 0x01, 0x78, 0xfd, 0x2c, 0xfa, 0x43, 0xf8, 0x6f, 0xf8, 0x12, 0xfb, 0x40, 0xff, 
-0xbd, 0x03, 0xac, 0x07, 0xa6, 0x0a, 0x6b, 0x0b, 0x23, 0x09, 0x8d, 0x04, 0xb0, 0xfe, 0x1d, 0xf9, 
-0x88, 0xf5, 0xa1, 0xf4, 0x41, 0xf6, 0x59, 0xf9, 0xaa, 0xfc, 0x0b, 0x00, 0xa5, 0x03, 0xd1, 0x06, 
-0x73, 0x08, 0xda, 0x07, 0x32, 0x05, 0x5d, 0x01, 0xcc, 0xfd, 0xa6, 0xfb, 0x4f, 0xfb, 0xaa, 0xfc, 
-0xe1, 0xfe, 0x4e, 0x01, 0xc7, 0x03, 0x62, 0x05, 0x32, 0x05, 0x4e, 0x03, 0x18, 0x00, 0xbc, 0xfc, 
-0x66, 0xfa, 0xae, 0xf9, 0xa5, 0xfa, 0x9c, 0xfc, 0x68, 0xfe, 0xc2, 0xff, 0x1d, 0x01, 0x6c, 0x02, 
-0x0d, 0x03, 0x7b, 0x02, 0xa9, 0x00, 0x58, 0xfe, 0x9e, 0xfc, 0x32, 0xfc, 0x86, 0xfd, 0x4e, 0x00, 
-0x82, 0x03, 0x26, 0x06, 0xf3, 0x07, 0x72, 0x08, 0xf5, 0x06, 0x38, 0x03, 0xf4, 0xfd, 0x96, 0xf8, 
-0xfb, 0xf4, 0x44, 0xf4, 0x55, 0xf6, 0x67, 0xfa, 0xf4, 0xfe, 0xfd, 0x02, 0x93, 0x06, 0x89, 0x09, 
-0xe9, 0x0a, 0xe0, 0x09, 0x6d, 0x06, 0xbd, 0x01, 0xef, 0xfc, 0x16, 0xf9, 0x34, 0xf7, 0x94, 0xf7, 
-0xb0, 0xf9, 0xd7, 0xfc, 0x8b, 0x00, 0x38, 0x04, 0x94, 0x06, 0x9c, 0x06, 0x76, 0x04, 0x20, 0x01, 
-0xce, 0xfd, 0x56, 0xfb, 0x9f, 0xfa, 0xa7, 0xfb, 0x58, 0xfd, 0xda, 0xfe, 0x68, 0x00, 0x32, 0x02, 
-0xa1, 0x03, 0x1f, 0x04, 0x33, 0x03, 0x1c, 0x01, 0xd1, 0xfe, 0x09, 0xfd, 0x73, 0xfc, 0x16, 0xfd, 
-0x92, 0xfe, 0x89, 0x00, 0xa4, 0x02, 0xa1, 0x04, 0x8f, 0x05, 0x7a, 0x04, 0x6b, 0x01, 0x9b, 0xfd, 
-0x80, 0xfa, 0x0a, 0xf9, 0xba, 0xf9, 0x48, 0xfc, 0x78, 0xff, 0x1b, 0x02, 0x1f, 0x04, 0xd2, 0x05, 
-0xab, 0x06, 0xf6, 0x05, 0xbd, 0x03, 0x37, 0x00, 0x60, 0xfc, 0x71, 0xf9, 0x2e, 0xf8, 0xf9, 0xf8, 
-0x41, 0xfb, 0x6a, 0xfe, 0x52, 0x02, 0x26, 0x06, 0xb9, 0x08, 0x1e, 0x09, 0x04, 0x07, 0x25, 0x03, 
-0xdf, 0xfe, 0x4d, 0xfb, 0x25, 0xf9, 0xb9, 0xf8, 0x67, 0xf9, 0x91, 0xfa, 0x67, 0xfc, 0x08, 0xff, 
-0xcd, 0x01, 0xb3, 0x03, 0x49, 0x04, 0x8c, 0x03, 0x23, 0x02, 0x96, 0x00, 0x83, 0xff, 0x58, 0xff, 
-0xf6, 0xff, 0xf9, 0x00, 0x2b, 0x02, 0x70, 0x03, 0x13, 0x04, 0x96, 0x03, 0xaa, 0x01, 0x7d, 0xfe, 
-0x8b, 0xfb, 0xc0, 0xf9, 0x5b, 0xf9, 0xa1, 0xfa, 0xd9, 0xfc, 0x24, 0xff, 0x24, 0x01, 0xd9, 0x02, 
-0x2c, 0x04, 0x9b, 0x04, 0x9b, 0x03, 0x8a, 0x01, 0x4b, 0xff, 0xa3, 0xfd, 0x20, 0xfd, 0xc4, 0xfd, 
-0x37, 0xff, 0x0d, 0x01, 0xf6, 0x02, 0xa7, 0x04, 0x99, 0x05, 0x32, 0x05, 0x23, 0x03, 0xac, 0xff, 
-0xec, 0xfb, 0x0b, 0xf9, 0xb9, 0xf7, 0x40, 0xf8, 0x51, 0xfa, 0xfa, 0xfc, 0xb1, 0xff, 0x72, 0x02, 
-0xb5, 0x04, 0x39, 0x06, 0x65, 0x06, 0xf4, 0x04, 0xa1, 0x02, 0x2f, 0x00, 0x4b, 0xfe, 0x2c, 0xfd, 
-0xe1, 0xfc, 0x5c, 0xfd, 0x81, 0xfe, 0x25, 0x00, 0xf6, 0x01, 0x20, 0x03, 0xdc, 0x02, 0x14, 0x01, 
-0x77, 0xfe, 0x52, 0xfc, 0x54, 0xfb, 0xc2, 0xfb, 0x8e, 0xfd, 0xa9, 0xff, 0x78, 0x01, 0x0d, 0x03, 
-0x57, 0x04, 0xcf, 0x04, 0xfa, 0x03, 0x0b, 0x02, 0xb8, 0xff, 0xc8, 0xfd, 0x91, 0xfc, 0x2c, 0xfc, 
-0xba, 0xfc, 0x3c, 0xfe, 0x3d, 0x00, 0x5c, 0x02, 0x09, 0x04, 0xc0, 0x04, 0xe2, 0x03, 0x57, 0x01, 
-0x22, 0xfe, 0x46, 0xfb, 0xd3, 0xf9, 0x28, 0xfa, 0x16, 0xfc, 0xa9, 0xfe, 0x0c, 0x01, 0x2c, 0x03, 
-0xd4, 0x04, 0x85, 0x05, 0xe7, 0x04, 0x04, 0x03, 0x47, 0x00, 0xa0, 0xfd, 0x8f, 0xfb, 0x7f, 0xfa, 
-0xd2, 0xfa, 0x50, 0xfc, 0x92, 0xfe, 0x66, 0x01, 0x34, 0x04, 0x18, 0x06, 0x54, 0x06, 0xa9, 0x04, 
-0xad, 0x01, 0xa8, 0xfe, 0xa1, 0xfc, 0xc5, 0xfb, 0x26, 0xfc, 0x27, 0xfd, 0x6c, 0xfe, 0xd0, 0xff, 
-0x2b, 0x01, 0x49, 0x02, 0x91, 0x02, 0xe9, 0x01, 0x75, 0x00, 0xff, 0xfe, 0xec, 0xfd, 0x89, 0xfd, 
-0x1b, 0xfe, 0x57, 0xff, 0xe9, 0x00, 0xc3, 0x02, 0x7c, 0x04, 0x42, 0x05, 0x8c, 0x04, 0x6f, 0x02, 
-0x37, 0xff, 0x08, 0xfc, 0x3a, 0xfa, 0xbe, 0xf9, 0xb6, 0xfa, 0xa8, 0xfc, 0xb2, 0xfe, 0x9d, 0x00, 
-0x58, 0x02, 0xc5, 0x03, 0x26, 0x04, 0x13, 0x03, 0xe1, 0x00, 0x7e, 0xfe, 0xe9, 0xfc, 0x73, 0xfc, 
-0x24, 0xfd, 0xb4, 0xfe, 0xb4, 0x00, 0xf5, 0x02, 0x1d, 0x05, 0x59, 0x06, 0x24, 0x06, 0x7d, 0x04, 
-0x7b, 0x01, 0xe9, 0xfd, 0xd1, 0xfa, 0xf1, 0xf8, 0xa4, 0xf8, 0xc4, 0xf9, 0xad, 0xfb, 0x1c, 0xfe, 
-0xd4, 0x00, 0x4d, 0x03, 0xfb, 0x04, 0x55, 0x05, 0x58, 0x04, 0xa2, 0x02, 0xef, 0x00, 0xbd, 0xff, 
-0x1f, 0xff, 0xed, 0xfe, 0x12, 0xff, 0x8f, 0xff, 0x88, 0x00, 0x89, 0x01, 0x03, 0x02, 0x96, 0x01, 
-0x04, 0x00, 0xfe, 0xfd, 0x2e, 0xfc, 0x19, 0xfb, 0x22, 0xfb, 0x45, 0xfc, 0x1b, 0xfe, 0x21, 0x00, 
-0x31, 0x02, 0xd9, 0x03, 0xaa, 0x04, 0x61, 0x04, 0x15, 0x03, 0x5a, 0x01, 0xa2, 0xff, 0x4b, 0xfe, 
-0x6f, 0xfd, 0x52, 0xfd, 0xe1, 0xfd, 0xf8, 0xfe, 0x82, 0x00, 0x03, 0x02, 0x0b, 0x03, 0x02, 0x03, 
-0xb2, 0x01, 0x69, 0xff, 0x19, 0xfd, 0xcb, 0xfb, 0xae, 0xfb, 0x97, 0xfc, 0x2b, 0xfe, 0x25, 0x00, 
-0x3a, 0x02, 0x0b, 0x04, 0x06, 0x05, 0xdf, 0x04, 0xad, 0x03, 0xe5, 0x01, 0xf4, 0xff, 0x10, 0xfe, 
-0x83, 0xfc, 0xa7, 0xfb, 0xc1, 0xfb, 0xcb, 0xfc, 0x90, 0xfe, 0xb1, 0x00, 0x8d, 0x02, 0x8d, 0x03, 
-0x58, 0x03, 0xf9, 0x01, 0x34, 0x00, 0xc3, 0xfe, 0xee, 0xfd, 0xe7, 0xfd, 0x79, 0xfe, 0x05, 0xff, 
-0xb5, 0xff, 0x95, 0x00, 0x61, 0x01, 0xb0, 0x01, 0x1d, 0x01, 0x1b, 0x00, 0x18, 0xff, 0x3b, 0xfe, 
-0xaa, 0xfd, 0xa6, 0xfd, 0x52, 0xfe, 0xa0, 0xff, 0x7f, 0x01, 0x6e, 0x03, 0xce, 0x04, 0x48, 0x05, 
-0x5b, 0x04, 0x32, 0x02, 0x86, 0xff, 0x28, 0xfd, 0xa2, 0xfb, 0x14, 0xfb, 0x2f, 0xfb, 0xe7, 0xfb, 
-0x7e, 0xfd, 0x6f, 0xff, 0x47, 0x01, 0x82, 0x02, 0xf8, 0x02, 0x9e, 0x02, 0xaf, 0x01, 0x9a, 0x00, 
-0xbc, 0xff, 0x62, 0xff, 0x6c, 0xff, 0xf3, 0xff, 0xd1, 0x00, 0xdf, 0x01, 0xaf, 0x02, 0xcf, 0x02, 
-0x34, 0x02, 0xfb, 0x00, 0x54, 0xff, 0xa9, 0xfd, 0x5a, 0xfc, 0xa5, 0xfb, 0xac, 0xfb, 0x5d, 0xfc, 
-0xbb, 0xfd, 0x87, 0xff, 0x39, 0x01, 0x83, 0x02, 0xfc, 0x02, 0xb2, 0x02, 0x09, 0x02, 0x41, 0x01, 
-0x88, 0x00, 0xe9, 0xff, 0x9d, 0xff, 0xaa, 0xff, 0x0a, 0x00, 0xcb, 0x00, 0x96, 0x01, 0x14, 0x02, 
-0xce, 0x01, 0xaf, 0x00, 0x12, 0xff, 0x4d, 0xfd, 0xf0, 0xfb, 0x3f, 0xfb, 0x6c, 0xfb, 0x6f, 0xfc, 
-0x4a, 0xfe, 0xb3, 0x00, 0xfa, 0x02, 0x8d, 0x04, 0x2a, 0x05, 0xc9, 0x04, 0xb7, 0x03, 0x48, 0x02, 
-0xa4, 0x00, 0x10, 0xff, 0xc2, 0xfd, 0x02, 0xfd, 0xf7, 0xfc, 0xa0, 0xfd, 0xd0, 0xfe, 0x00, 0x00, 
-0xa7, 0x00, 0xa7, 0x00, 0x37, 0x00, 0x63, 0xff, 0xad, 0xfe, 0x59, 0xfe, 0x90, 0xfe, 0x4d, 0xff, 
-0x49, 0x00, 0x58, 0x01, 0x3e, 0x02, 0xd3, 0x02, 0xd2, 0x02, 0x4f, 0x02, 0x3e, 0x01, 0xfe, 0xff, 
-0xb7, 0xfe, 0xba, 0xfd, 0x41, 0xfd, 0x37, 0xfd, 0xdb, 0xfd, 0x0c, 0xff, 0x55, 0x00, 0x62, 0x01, 
-0xe9, 0x01, 0xb9, 0x01, 0x0f, 0x01, 0x0a, 0x00, 0x29, 0xff, 0xa4, 0xfe, 0xcc, 0xfe, 0x24, 0xff, 
-0x8d, 0xff, 0x7c, 0x00, 0x66, 0x01, 0x09, 0x02, 0x2a, 0x02, 0xca, 0x01, 0x08, 0x01, 0x21, 0x00, 
-0x32, 0xff, 0x56, 0xfe, 0xc1, 0xfd, 0xa3, 0xfd, 0x08, 0xfe, 0xd9, 0xfe, 0x1a, 0x00, 0x5e, 0x01, 
-0x43, 0x02, 0x8e, 0x02, 0x3f, 0x02, 0x90, 0x01, 0xbc, 0x00, 0xda, 0xff, 0x03, 0xff, 0x32, 0xfe, 
-0x8a, 0xfd, 0x9a, 0xfd, 0x46, 0xfe, 0x15, 0xff, 0xb4, 0xff, 0x0c, 0x00, 0x27, 0x00, 0x16, 0x00, 
-0xf2, 0xff, 0xc4, 0xff, 0xb4, 0xff, 0xec, 0xff, 0x89, 0x00, 0x60, 0x01, 0x3d, 0x02, 0xe6, 0x02, 
-0x10, 0x03, 0xa6, 0x02, 0xb7, 0x01, 0x6d, 0x00, 0x02, 0xff, 0x9d, 0xfd, 0xaa, 0xfc, 0x3b, 0xfc, 
-0x58, 0xfc, 0x44, 0xfd, 0xba, 0xfe, 0x38, 0x00, 0x78, 0x01, 0x39, 0x02, 0x57, 0x02, 0x09, 0x02, 
-0x64, 0x01, 0xaf, 0x00, 0x22, 0x00, 0xa3, 0xff, 0x67, 0xff, 0xa1, 0xff, 0x3f, 0x00, 0xe9, 0x00, 
-0x37, 0x01, 0x2c, 0x01, 0xd9, 0x00, 0x5b, 0x00, 0x8a, 0xff, 0x6b, 0xfe, 0x62, 0xfd, 0xc7, 0xfc, 
-0xae, 0xfc, 0x51, 0xfd, 0xa9, 0xfe, 0x51, 0x00, 0xa9, 0x01, 0x7e, 0x02, 0xe4, 0x02, 0xd0, 0x02, 
-0x7d, 0x02, 0xc5, 0x01, 0xce, 0x00, 0xf2, 0xff, 0x30, 0xff, 0xa5, 0xfe, 0x9d, 0xfe, 0xec, 0xfe, 
-0x49, 0xff, 0x77, 0xff, 0x7e, 0xff, 0x6f, 0xff, 0x26, 0xff, 0xc8, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 
-0xfd, 0xfe, 0xee, 0xff, 0x2b, 0x01, 0x5d, 0x02, 0x3f, 0x03, 0x59, 0x03, 0xcb, 0x02, 0x07, 0x02, 
-0x12, 0x01, 0x09, 0x00, 0xe2, 0xfe, 0xda, 0xfd, 0x5a, 0xfd, 0x63, 0xfd, 0xdb, 0xfd, 0xa4, 0xfe, 
-0x8d, 0xff, 0x4c, 0x00, 0xb9, 0x00, 0xef, 0x00, 0xd7, 0x00, 0x64, 0x00, 0xfe, 0xff, 0xaf, 0xff, 
-0x74, 0xff, 0x7e, 0xff, 0xdc, 0xff, 0x77, 0x00, 0xe8, 0x00, 0x00, 0x01, 0xd4, 0x00, 0xa6, 0x00, 
-0x60, 0x00, 0xdc, 0xff, 0x42, 0xff, 0xc1, 0xfe, 0x84, 0xfe, 0x9a, 0xfe, 0x31, 0xff, 0xf0, 0xff, 
-0xac, 0x00, 0x43, 0x01, 0x72, 0x01, 0x68, 0x01, 0x3d, 0x01, 0xdf, 0x00, 0x46, 0x00, 0xc8, 0xff, 
-0x6a, 0xff, 0x2d, 0xff, 0x45, 0xff, 0x8a, 0xff, 0xb7, 0xff, 0xbd, 0xff, 0x9f, 0xff, 0x47, 0xff, 
-0xe9, 0xfe, 0xbd, 0xfe, 0xbb, 0xfe, 0xd3, 0xfe, 0x3d, 0xff, 0x23, 0x00, 0x38, 0x01, 0x58, 0x02, 
-0x20, 0x03, 0x47, 0x03, 0xed, 0x02, 0x05, 0x02, 0xe3, 0x00, 0xba, 0xff, 0x82, 0xfe, 0x76, 0xfd, 
-0xbb, 0xfc, 0x98, 0xfc, 0x15, 0xfd, 0x15, 0xfe, 0x52, 0xff, 0x5f, 0x00, 0x00, 0x01, 0x4b, 0x01, 
-0x50, 0x01, 0x1e, 0x01, 0xe2, 0x00, 0xa8, 0x00, 0x82, 0x00, 0x76, 0x00, 0x9c, 0x00, 0xe3, 0x00, 
-0x05, 0x01, 0xee, 0x00, 0xae, 0x00, 0x34, 0x00, 0xa9, 0xff, 0x19, 0xff, 0x84, 0xfe, 0x16, 0xfe, 
-0xb1, 0xfd, 0x92, 0xfd, 0x33, 0xfe, 0x55, 0xff, 0x7c, 0x00, 0x4d, 0x01, 0xb3, 0x01, 0xd3, 0x01, 
-0xaf, 0x01, 0x75, 0x01, 0x0c, 0x01, 0x92, 0x00, 0x36, 0x00, 0x05, 0x00, 0xf5, 0xff, 0x27, 0x00, 
-0x76, 0x00, 0x4f, 0x00, 0xd2, 0xff, 0x44, 0xff, 0x9e, 0xfe, 0x16, 0xfe, 0xba, 0xfd, 0x84, 0xfd, 
-0xba, 0xfd, 0x5a, 0xfe, 0x77, 0xff, 0xfb, 0x00, 0x71, 0x02, 0x6f, 0x03, 0xd0, 0x03, 0x89, 0x03, 
-0x9c, 0x02, 0x5e, 0x01, 0xee, 0xff, 0x88, 0xfe, 0x52, 0xfd, 0x98, 0xfc, 0xb0, 0xfc, 0x94, 0xfd, 
-0xef, 0xfe, 0x15, 0x00, 0xb2, 0x00, 0x0c, 0x01, 0x3b, 0x01, 0x27, 0x01, 0xba, 0x00, 0x11, 0x00, 
-0x75, 0xff, 0x2a, 0xff, 0x62, 0xff, 0x03, 0x00, 0xc9, 0x00, 0x58, 0x01, 0x92, 0x01, 0x5c, 0x01, 
-0x0a, 0x01, 0xc8, 0x00, 0x43, 0x00, 0x81, 0xff, 0xb9, 0xfe, 0x3e, 0xfe, 0x2c, 0xfe, 0xa9, 0xfe, 
-0x6c, 0xff, 0x1a, 0x00, 0x9d, 0x00, 0xee, 0x00, 0x0e, 0x01, 0xf9, 0x00, 0xa3, 0x00, 0x22, 0x00, 
-0x9e, 0xff, 0x2e, 0xff, 0x18, 0xff, 0x54, 0xff, 0xb5, 0xff, 0x2f, 0x00, 0x79, 0x00, 0x71, 0x00, 
-0x42, 0x00, 0xff, 0xff, 0x83, 0xff, 0xce, 0xfe, 0x41, 0xfe, 0x35, 0xfe, 0xc6, 0xfe, 0xde, 0xff, 
-0x28, 0x01, 0x44, 0x02, 0xd6, 0x02, 0xdb, 0x02, 0x72, 0x02, 0xc3, 0x01, 0xd4, 0x00, 0xa0, 0xff, 
-0x62, 0xfe, 0x6e, 0xfd, 0x0c, 0xfd, 0x54, 0xfd, 0x1c, 0xfe, 0x1f, 0xff, 0x0f, 0x00, 0xc0, 0x00, 
-0x32, 0x01, 0x70, 0x01, 0x66, 0x01, 0x02, 0x01, 0x63, 0x00, 0xd7, 0xff, 0x9c, 0xff, 0xb8, 0xff, 
-0x27, 0x00, 0x92, 0x00, 0xd9, 0x00, 0xdc, 0x00, 0xa9, 0x00, 0x72, 0x00, 0x1d, 0x00, 0x90, 0xff, 
-0xe9, 0xfe, 0x57, 0xfe, 0xff, 0xfd, 0x3d, 0xfe, 0xf3, 0xfe, 0xa9, 0xff, 0x4f, 0x00, 0xb9, 0x00, 
-0xe0, 0x00, 0xd6, 0x00, 0x9f, 0x00, 0x52, 0x00, 0x05, 0x00, 0xe5, 0xff, 0x04, 0x00, 0x53, 0x00, 
-0xc5, 0x00, 0x3e, 0x01, 0x57, 0x01, 0x27, 0x01, 0xc6, 0x00, 0x02, 0x00, 0x37, 0xff, 0x75, 0xfe, 
-0xb9, 0xfd, 0x37, 0xfd, 0x3d, 0xfd, 0xff, 0xfd, 0x58, 0xff, 0xcf, 0x00, 0xf1, 0x01, 0xc1, 0x02, 
-0x14, 0x03, 0xed, 0x02, 0x58, 0x02, 0x6b, 0x01, 0x39, 0x00, 0x09, 0xff, 0x24, 0xfe, 0xa2, 0xfd, 
-0xb9, 0xfd, 0x45, 0xfe, 0x03, 0xff, 0x8f, 0xff, 0x03, 0x00, 0x72, 0x00, 0x9a, 0x00, 0x75, 0x00, 
-0x1c, 0x00, 0xb2, 0xff, 0x83, 0xff, 0xce, 0xff, 0x7f, 0x00, 0x00, 0x01, 0x28, 0x01, 0x1e, 0x01, 
-0xf1, 0x00, 0xb2, 0x00, 0x51, 0x00, 0xc9, 0xff, 0x43, 0xff, 0xc3, 0xfe, 0x90, 0xfe, 0xe2, 0xfe, 
-0x69, 0xff, 0x05, 0x00, 0x8b, 0x00, 0xb8, 0x00, 0xa1, 0x00, 0x8f, 0x00, 0x7f, 0x00, 0x33, 0x00, 
-0xca, 0xff, 0x78, 0xff, 0x5d, 0xff, 0x91, 0xff, 0x0a, 0x00, 0x91, 0x00, 0xcf, 0x00, 0xa6, 0x00, 
-0x42, 0x00, 0xe8, 0xff, 0x9a, 0xff, 0x40, 0xff, 0xc0, 0xfe, 0x59, 0xfe, 0x59, 0xfe, 0xc4, 0xfe, 
-0xa6, 0xff, 0xb2, 0x00, 0x8f, 0x01, 0x07, 0x02, 0x13, 0x02, 0xee, 0x01, 0xb4, 0x01, 0x3c, 0x01, 
-0x7e, 0x00, 0xac, 0xff, 0xf2, 0xfe, 0x84, 0xfe, 0x6a, 0xfe, 0x93, 0xfe, 0xe5, 0xfe, 0x11, 0xff, 
-0x19, 0xff, 0x3f, 0xff, 0x8f, 0xff, 0xd9, 0xff, 0x02, 0x00, 0x25, 0x00, 0x6b, 0x00, 0xe1, 0x00, 
-0x70, 0x01, 0xd1, 0x01, 0xbc, 0x01, 0x62, 0x01, 0xdd, 0x00, 0x41, 0x00, 0xc1, 0xff, 0x5c, 0xff, 
-0xeb, 0xfe, 0x8e, 0xfe, 0x6f, 0xfe, 0x77, 0xfe, 0xd5, 0xfe, 0x7c, 0xff, 0x17, 0x00, 0x73, 0x00, 
-0x8d, 0x00, 0x8f, 0x00, 0x97, 0x00, 0xa6, 0x00, 0x7d, 0x00, 0x3f, 0x00, 0x13, 0x00, 0x17, 0x00, 
-0x47, 0x00, 0x83, 0x00, 0xba, 0x00, 0xb4, 0x00, 0x7a, 0x00, 0x09, 0x00, 0x9c, 0xff, 0x48, 0xff, 
-0xda, 0xfe, 0x62, 0xfe, 0x1e, 0xfe, 0x28, 0xfe, 0xa5, 0xfe, 0x85, 0xff, 0x6f, 0x00, 0x2f, 0x01, 
-0xbf, 0x01, 0x0e, 0x02, 0x1c, 0x02, 0xed, 0x01, 0x7c, 0x01, 0xe5, 0x00, 0x2e, 0x00, 0x7c, 0xff, 
-0x24, 0xff, 0x00, 0xff, 0xc7, 0xfe, 0x93, 0xfe, 0x79, 0xfe, 0x82, 0xfe, 0xc3, 0xfe, 0x0c, 0xff, 
-0x53, 0xff, 0x9e, 0xff, 0xdb, 0xff, 0x37, 0x00, 0xd8, 0x00, 0x73, 0x01, 0xe2, 0x01, 0xf2, 0x01, 
-0xa4, 0x01, 0x40, 0x01, 0xe0, 0x00, 0x7d, 0x00, 0xfe, 0xff, 0x76, 0xff, 0xf0, 0xfe, 0xad, 0xfe, 
-0xbd, 0xfe, 0xff, 0xfe, 0x43, 0xff, 0x95, 0xff, 0xd5, 0xff, 0xf2, 0xff, 0x1e, 0x00, 0x41, 0x00, 
-0x36, 0x00, 0x05, 0x00, 0xe2, 0xff, 0xf1, 0xff, 0x40, 0x00, 0x94, 0x00, 0xe5, 0x00, 0xec, 0x00, 
-0xa5, 0x00, 0x51, 0x00, 0xec, 0xff, 0x7e, 0xff, 0x03, 0xff, 0x74, 0xfe, 0x2e, 0xfe, 0x69, 0xfe, 
-0xe0, 0xfe, 0x9c, 0xff, 0x67, 0x00, 0x05, 0x01, 0x7d, 0x01, 0xbe, 0x01, 0xd9, 0x01, 0xc3, 0x01, 
-0x6e, 0x01, 0xdf, 0x00, 0x20, 0x00, 0x80, 0xff, 0x39, 0xff, 0x3e, 0xff, 0x4d, 0xff, 0x2f, 0xff, 
-0xff, 0xfe, 0xe5, 0xfe, 0xe7, 0xfe, 0xf4, 0xfe, 0x13, 0xff, 0x3d, 0xff, 0x63, 0xff, 0xc8, 0xff, 
-0x6b, 0x00, 0x0e, 0x01, 0xae, 0x01, 0xfe, 0x01, 0xc8, 0x01, 0x56, 0x01, 0xee, 0x00, 0x87, 0x00, 
-0x13, 0x00, 0x86, 0xff, 0xfc, 0xfe, 0xbb, 0xfe, 0xdd, 0xfe, 0x35, 0xff, 0x74, 0xff, 0xa7, 0xff, 
-0xcf, 0xff, 0xb5, 0xff, 0x77, 0xff, 0x5f, 0xff, 0x63, 0xff, 0x6d, 0xff, 0x8c, 0xff, 0xdb, 0xff, 
-0x83, 0x00, 0x5e, 0x01, 0x11, 0x02, 0x45, 0x02, 0x00, 0x02, 0x79, 0x01, 0xbb, 0x00, 0xf2, 0xff, 
-0x1e, 0xff, 0x4c, 0xfe, 0xbb, 0xfd, 0x87, 0xfd, 0xd5, 0xfd, 0xa1, 0xfe, 0x90, 0xff, 0x4f, 0x00, 
-0xe8, 0x00, 0x55, 0x01, 0x8d, 0x01, 0x90, 0x01, 0x3b, 0x01, 0xa4, 0x00, 0x1a, 0x00, 0xb5, 0xff, 
-0x94, 0xff, 0xcb, 0xff, 0x02, 0x00, 0x22, 0x00, 0x29, 0x00, 0x02, 0x00, 0xc8, 0xff, 0x86, 0xff, 
-0x3b, 0xff, 0xe4, 0xfe, 0xb3, 0xfe, 0xad, 0xfe, 0xee, 0xfe, 0x9d, 0xff, 0x76, 0x00, 0x23, 0x01, 
-0x7a, 0x01, 0x6a, 0x01, 0x25, 0x01, 0xda, 0x00, 0x75, 0x00, 0x0b, 0x00, 0xc6, 0xff, 0xbe, 0xff, 
-0xe9, 0xff, 0x2f, 0x00, 0x65, 0x00, 0x76, 0x00, 0x50, 0x00, 0xe9, 0xff, 0x64, 0xff, 0xe6, 0xfe, 
-0x8e, 0xfe, 0x58, 0xfe, 0x56, 0xfe, 0xb8, 0xfe, 0x7e, 0xff, 0x69, 0x00, 0x53, 0x01, 0x0f, 0x02, 
-0x5e, 0x02, 0x1a, 0x02, 0x79, 0x01, 0xb1, 0x00, 0xdb, 0xff, 0x0f, 0xff, 0x5f, 0xfe, 0x03, 0xfe, 
-0x1f, 0xfe, 0x8d, 0xfe, 0x3b, 0xff, 0xfb, 0xff, 0x93, 0x00, 0xec, 0x00, 0x01, 0x01, 0x02, 0x01, 
-0xe2, 0x00, 0x8d, 0x00, 0x12, 0x00, 0xc2, 0xff, 0xae, 0xff, 0xca, 0xff, 0x27, 0x00, 0x6a, 0x00, 
-0x77, 0x00, 0x3f, 0x00, 0xcb, 0xff, 0x7a, 0xff, 0x5d, 0xff, 0x50, 0xff, 0x4b, 0xff, 0x3f, 0xff, 
-0x5b, 0xff, 0xc9, 0xff, 0x62, 0x00, 0xc8, 0x00, 0xdc, 0x00, 0xd3, 0x00, 0xb2, 0x00, 0x61, 0x00, 
-0x0e, 0x00, 0xe0, 0xff, 0xad, 0xff, 0x92, 0xff, 0xba, 0xff, 0x16, 0x00, 0x77, 0x00, 0xad, 0x00, 
-0x9b, 0x00, 0x49, 0x00, 0xb4, 0xff, 0x23, 0xff, 0xb3, 0xfe, 0x48, 0xfe, 0x2b, 0xfe, 0x79, 0xfe, 
-0x2e, 0xff, 0x49, 0x00, 0x7f, 0x01, 0x74, 0x02, 0xe9, 0x02, 0xb5, 0x02, 0x10, 0x02, 0x3f, 0x01, 
-0x3a, 0x00, 0x23, 0xff, 0x1d, 0xfe, 0x5f, 0xfd, 0x2b, 0xfd, 0x91, 0xfd, 0x6d, 0xfe, 0x67, 0xff, 
-0x48, 0x00, 0xda, 0x00, 0x1d, 0x01, 0x37, 0x01, 0x25, 0x01, 0xcb, 0x00, 0x53, 0x00, 0x1a, 0x00, 
-0x0b, 0x00, 0x30, 0x00, 0x87, 0x00, 0xc6, 0x00, 0xc8, 0x00, 0x87, 0x00, 0x2b, 0x00, 0xd2, 0xff, 
-0x66, 0xff, 0xf6, 0xfe, 0x9f, 0xfe, 0x7c, 0xfe, 0x99, 0xfe, 0xfc, 0xfe, 0xac, 0xff, 0x68, 0x00, 
-0xdc, 0x00, 0xf3, 0x00, 0xc9, 0x00, 0x86, 0x00, 0x51, 0x00, 0x1a, 0x00, 0xf3, 0xff, 0x04, 0x00, 
-0x62, 0x00, 0xe5, 0x00, 0x4f, 0x01, 0x6d, 0x01, 0x27, 0x01, 0x7d, 0x00, 0x9c, 0xff, 0xd7, 0xfe, 
-0x3c, 0xfe, 0xb8, 0xfd, 0x78, 0xfd, 0xa0, 0xfd, 0x45, 0xfe, 0x57, 0xff, 0x99, 0x00, 0xda, 0x01, 
-0xbf, 0x02, 0x02, 0x03, 0xc1, 0x02, 0xf4, 0x01, 0xcd, 0x00, 0xab, 0xff, 0xaa, 0xfe, 0x06, 0xfe, 
-0xc5, 0xfd, 0xeb, 0xfd, 0x8d, 0xfe, 0x57, 0xff, 0x02, 0x00, 0x80, 0x00, 0xac, 0x00, 0xaa, 0x00, 
-0xa8, 0x00, 0x7c, 0x00, 0x42, 0x00, 0x14, 0x00, 0xf5, 0xff, 0x27, 0x00, 0x6e, 0x00, 0xbb, 0x00, 
-0xf2, 0x00, 0xcc, 0x00, 0x78, 0x00, 0x05, 0x00, 0x7e, 0xff, 0x19, 0xff, 0xe5, 0xfe, 0xd7, 0xfe, 
-0x19, 0xff, 0x92, 0xff, 0x1a, 0x00, 0x8c, 0x00, 0xcc, 0x00, 0xcb, 0x00, 0x78, 0x00, 0x05, 0x00, 
-0xa7, 0xff, 0x4e, 0xff, 0x13, 0xff, 0x34, 0xff, 0x91, 0xff, 0x18, 0x00, 0xbe, 0x00, 0x51, 0x01, 
-0x8e, 0x01, 0x4d, 0x01, 0xcf, 0x00, 0x49, 0x00, 0x96, 0xff, 0xda, 0xfe, 0x4c, 0xfe, 0xfa, 0xfd, 
-0x15, 0xfe, 0xa8, 0xfe, 0x9b, 0xff, 0xb5, 0x00, 0x92, 0x01, 0xfd, 0x01, 0x06, 0x02, 0xbf, 0x01, 
-0x3c, 0x01, 0x6c, 0x00, 0x8f, 0xff, 0xeb, 0xfe, 0x90, 0xfe, 0x81, 0xfe, 0xbf, 0xfe, 0x39, 0xff, 
-0xc0, 0xff, 0x27, 0x00, 0x63, 0x00, 0x79, 0x00, 0x85, 0x00, 0x65, 0x00, 0x13, 0x00, 0xde, 0xff, 
-0xcb, 0xff, 0xf9, 0xff, 0x41, 0x00, 0x6e, 0x00, 0x9d, 0x00, 0xc2, 0x00, 0x94, 0x00, 0x32, 0x00, 
-0xdf, 0xff, 0xa3, 0xff, 0x68, 0xff, 0x37, 0xff, 0x35, 0xff, 0x5a, 0xff, 0xa9, 0xff, 0xfa, 0xff, 
-0x32, 0x00, 0x6b, 0x00, 0x6e, 0x00, 0x38, 0x00, 0xef, 0xff, 0xaa, 0xff, 0x74, 0xff, 0x5f, 0xff, 
-0x88, 0xff, 0xe9, 0xff, 0x7d, 0x00, 0x1b, 0x01, 0x80, 0x01, 0x87, 0x01, 0x4b, 0x01, 0xf0, 0x00, 
-0x5e, 0x00, 0x9a, 0xff, 0xdc, 0xfe, 0x3d, 0xfe, 0xf2, 0xfd, 0xfb, 0xfd, 0x66, 0xfe, 0x2f, 0xff, 
-0x0c, 0x00, 0xd4, 0x00, 0x79, 0x01, 0xce, 0x01, 0xb9, 0x01, 0x5c, 0x01, 0xdf, 0x00, 0x54, 0x00, 
-0xc0, 0xff, 0x3d, 0xff, 0xed, 0xfe, 0xf8, 0xfe, 0x2b, 0xff, 0x66, 0xff, 0xb0, 0xff, 0xe7, 0xff, 
-0x0f, 0x00, 0x24, 0x00, 0x17, 0x00, 0xf9, 0xff, 0xda, 0xff, 0xd2, 0xff, 0xfa, 0xff, 0x54, 0x00, 
-0xa7, 0x00, 0xda, 0x00, 0xd3, 0x00, 0x8b, 0x00, 0x33, 0x00, 0xd2, 0xff, 0x6d, 0xff, 0x2e, 0xff, 
-0x30, 0xff, 0x5c, 0xff, 0xc3, 0xff, 0x4e, 0x00, 0xc6, 0x00, 0x07, 0x01, 0xfb, 0x00, 0xaf, 0x00, 
-0x3e, 0x00, 0xbe, 0xff, 0x34, 0xff, 0xb2, 0xfe, 0x77, 0xfe, 0x9b, 0xfe, 0x0c, 0xff, 0xc7, 0xff, 
-0xab, 0x00, 0x67, 0x01, 0xbd, 0x01, 0xba, 0x01, 0x67, 0x01, 0xca, 0x00, 0xe9, 0xff, 0x0b, 0xff, 
-0x6e, 0xfe, 0x2d, 0xfe, 0x58, 0xfe, 0xbf, 0xfe, 0x6d, 0xff, 0x33, 0x00, 0xd4, 0x00, 0x5a, 0x01, 
-0xa1, 0x01, 0x98, 0x01, 0x42, 0x01, 0xb1, 0x00, 0x07, 0x00, 0x71, 0xff, 0x10, 0xff, 0xe6, 0xfe, 
-0xed, 0xfe, 0x16, 0xff, 0x4c, 0xff, 0x9b, 0xff, 0xe6, 0xff, 0x19, 0x00, 0x2f, 0x00, 0x36, 0x00, 
-0x49, 0x00, 0x52, 0x00, 0x7d, 0x00, 0xc2, 0x00, 0xdb, 0x00, 0xcf, 0x00, 0x94, 0x00, 0x4f, 0x00, 
-0x0e, 0x00, 0xa5, 0xff, 0x2f, 0xff, 0xd9, 0xfe, 0xb3, 0xfe, 0xcc, 0xfe, 0x20, 0xff, 0x9f, 0xff, 
-0x47, 0x00, 0xdc, 0x00, 0x48, 0x01, 0x71, 0x01, 0x38, 0x01, 0xcf, 0x00, 0x37, 0x00, 0x82, 0xff, 
-0xfa, 0xfe, 0xb5, 0xfe, 0xc2, 0xfe, 0x31, 0xff, 0xde, 0xff, 0x87, 0x00, 0xeb, 0x00, 0x13, 0x01, 
-0x18, 0x01, 0xee, 0x00, 0x7f, 0x00, 0xe0, 0xff, 0x51, 0xff, 0xe0, 0xfe, 0x9a, 0xfe, 0xac, 0xfe, 
-0x03, 0xff, 0x81, 0xff, 0x13, 0x00, 0xa7, 0x00, 0x13, 0x01, 0x3b, 0x01, 0x30, 0x01, 0xed, 0x00, 
-0x9d, 0x00, 0x53, 0x00, 0xf5, 0xff, 0xaa, 0xff, 0x70, 0xff, 0x41, 0xff, 0x22, 0xff, 0x27, 0xff, 
-0x43, 0xff, 0x5b, 0xff, 0x74, 0xff, 0xae, 0xff, 0xfe, 0xff, 0x2b, 0x00, 0x62, 0x00, 0xaa, 0x00, 
-0xe1, 0x00, 0x06, 0x01, 0x19, 0x01, 0x00, 0x01, 0xaf, 0x00, 0x49, 0x00, 0xc8, 0xff, 0x33, 0xff, 
-0xc8, 0xfe, 0xa2, 0xfe, 0xcd, 0xfe, 0x30, 0xff, 0xc7, 0xff, 0x57, 0x00, 0xc7, 0x00, 0x06, 0x01, 
-0x1c, 0x01, 0x0a, 0x01, 0xa7, 0x00, 0x1c, 0x00, 0x97, 0xff, 0x20, 0xff, 0xce, 0xfe, 0xca, 0xfe, 
-0x18, 0xff, 0x9b, 0xff, 0x23, 0x00, 0xa5, 0x00, 0x08, 0x01, 0x29, 0x01, 0xf5, 0x00, 0x87, 0x00, 
-0xef, 0xff, 0x59, 0xff, 0x05, 0xff, 0xe9, 0xfe, 0x0c, 0xff, 0x4e, 0xff, 0xb0, 0xff, 0x2e, 0x00, 
-0x9d, 0x00, 0xf8, 0x00, 0x12, 0x01, 0xf6, 0x00, 0xc0, 0x00, 0x6c, 0x00, 0x0a, 0x00, 0xb3, 0xff, 
-0x83, 0xff, 0x77, 0xff, 0x69, 0xff, 0x75, 0xff, 0x9b, 0xff, 0xb3, 0xff, 0xb5, 0xff, 0xb0, 0xff, 
-0x9c, 0xff, 0x93, 0xff, 0xc9, 0xff, 0x2e, 0x00, 0x9a, 0x00, 0x04, 0x01, 0x57, 0x01, 0x5e, 0x01, 
-0x15, 0x01, 0xac, 0x00, 0x35, 0x00, 0x90, 0xff, 0xe9, 0xfe, 0x83, 0xfe, 0x48, 0xfe, 0x41, 0xfe, 
-0xa1, 0xfe, 0x4c, 0xff, 0x08, 0x00, 0xba, 0x00, 0x4c, 0x01, 0x99, 0x01, 0x9b, 0x01, 0x4a, 0x01, 
-0xbd, 0x00, 0x1b, 0x00, 0x86, 0xff, 0x24, 0xff, 0x06, 0xff, 0x2a, 0xff, 0x77, 0xff, 0xe1, 0xff, 
-0x3a, 0x00, 0x79, 0x00, 0x92, 0x00, 0x88, 0x00, 0x5d, 0x00, 0x08, 0x00, 0x88, 0xff, 0x22, 0xff, 
-0x0d, 0xff, 0x25, 0xff, 0x54, 0xff, 0xaa, 0xff, 0x27, 0x00, 0xa1, 0x00, 0x09, 0x01, 0x38, 0x01, 
-0x21, 0x01, 0xd7, 0x00, 0x66, 0x00, 0x05, 0x00, 0xc0, 0xff, 0x82, 0xff, 0x60, 0xff, 0x57, 0xff, 
-0x53, 0xff, 0x6c, 0xff, 0x96, 0xff, 0xbc, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xc5, 0xff, 0xd2, 0xff, 
-0xf8, 0xff, 0x31, 0x00, 0x85, 0x00, 0xe5, 0x00, 0x14, 0x01, 0x1d, 0x01, 0x1b, 0x01, 0xc5, 0x00, 
-0x2c, 0x00, 0x7a, 0xff, 0xe0, 0xfe, 0x72, 0xfe, 0x58, 0xfe, 0x94, 0xfe, 0x11, 0xff, 0xc4, 0xff, 
-0x7c, 0x00, 0x15, 0x01, 0x69, 0x01, 0x78, 0x01, 0x3d, 0x01, 0xbf, 0x00, 0x21, 0x00, 0x93, 0xff, 
-0x25, 0xff, 0xe7, 0xfe, 0xef, 0xfe, 0x34, 0xff, 0xa2, 0xff, 0x10, 0x00, 0x82, 0x00, 0xd9, 0x00, 
-0xe5, 0x00, 0xa5, 0x00, 0x37, 0x00, 0xc8, 0xff, 0x6e, 0xff, 0x3e, 0xff, 0x24, 0xff, 0x2c, 0xff, 
-0x7d, 0xff, 0xf8, 0xff, 0x71, 0x00, 0xdc, 0x00, 0x29, 0x01, 0x29, 0x01, 0xe0, 0x00, 0x80, 0x00, 
-0x27, 0x00, 0xcc, 0xff, 0x71, 0xff, 0x42, 0xff, 0x1b, 0xff, 0x13, 0xff, 0x39, 0xff, 0x73, 0xff, 
-0xba, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0x03, 0x00, 0x15, 0x00, 0x54, 0x00, 0xa2, 0x00, 0xcb, 0x00, 
-0xed, 0x00, 0x01, 0x01, 0x02, 0x01, 0xe9, 0x00, 0x86, 0x00, 0xef, 0xff, 0x50, 0xff, 0xaf, 0xfe, 
-0x29, 0xfe, 0x00, 0xfe, 0x38, 0xfe, 0xc9, 0xfe, 0x98, 0xff, 0x6b, 0x00, 0x30, 0x01, 0xc7, 0x01, 
-0xfb, 0x01, 0xc8, 0x01, 0x42, 0x01, 0x95, 0x00, 0xf7, 0xff, 0x58, 0xff, 0xfc, 0xfe, 0xf3, 0xfe, 
-0x14, 0xff, 0x6a, 0xff, 0xe0, 0xff, 0x4e, 0x00, 0x91, 0x00, 0x8c, 0x00, 0x42, 0x00, 0xd7, 0xff, 
-0x6f, 0xff, 0x3d, 0xff, 0x29, 0xff, 0x2a, 0xff, 0x65, 0xff, 0xcc, 0xff, 0x5a, 0x00, 0xdf, 0x00, 
-0x3a, 0x01, 0x4b, 0x01, 0x08, 0x01, 0xa0, 0x00, 0x40, 0x00, 0xed, 0xff, 0xa4, 0xff, 0x67, 0xff, 
-0x4d, 0xff, 0x55, 0xff, 0x73, 0xff, 0x9d, 0xff, 0xb4, 0xff, 0xb3, 0xff, 0x94, 0xff, 0x7d, 0xff, 
-0x7e, 0xff, 0x98, 0xff, 0xe6, 0xff, 0x5b, 0x00, 0xd3, 0x00, 0x40, 0x01, 0x91, 0x01, 0xc4, 0x01, 
-0xb3, 0x01, 0x36, 0x01, 0x67, 0x00, 0x86, 0xff, 0xb5, 0xfe, 0x1d, 0xfe, 0xcb, 0xfd, 0xce, 0xfd, 
-0x32, 0xfe, 0xd8, 0xfe, 0xb4, 0xff, 0xa2, 0x00, 0x5f, 0x01, 0xc9, 0x01, 0xd3, 0x01, 0x8f, 0x01, 
-0x18, 0x01, 0x77, 0x00, 0xce, 0xff, 0x45, 0xff, 0xf7, 0xfe, 0xfa, 0xfe, 0x43, 0xff, 0xb2, 0xff, 
-0x0e, 0x00, 0x40, 0x00, 0x58, 0x00, 0x46, 0x00, 0x0d, 0x00, 0xd6, 0xff, 0x9c, 0xff, 0x5b, 0xff, 
-0x4b, 0xff, 0x80, 0xff, 0xbf, 0xff, 0x16, 0x00, 0x88, 0x00, 0xd7, 0x00, 0xf2, 0x00, 0xdf, 0x00, 
-0xc7, 0x00, 0x94, 0x00, 0x35, 0x00, 0xe2, 0xff, 0xbc, 0xff, 0xa0, 0xff, 0x85, 0xff, 0x89, 0xff, 
-0x9c, 0xff, 0x90, 0xff, 0x71, 0xff, 0x5c, 0xff, 0x50, 0xff, 0x56, 0xff, 0x75, 0xff, 0xc4, 0xff, 
-0x49, 0x00, 0xd9, 0x00, 0x5a, 0x01, 0xb7, 0x01, 0xc2, 0x01, 0x77, 0x01, 0xf0, 0x00, 0x36, 0x00, 
-0x60, 0xff, 0xa1, 0xfe, 0x1e, 0xfe, 0xe3, 0xfd, 0xfa, 0xfd, 0x6c, 0xfe, 0x1f, 0xff, 0xf5, 0xff, 
-0xbc, 0x00, 0x58, 0x01, 0xa8, 0x01, 0x8c, 0x01, 0x31, 0x01, 0xd3, 0x00, 0x7b, 0x00, 0x25, 0x00, 
-0xdd, 0xff, 0xaf, 0xff, 0xa1, 0xff, 0xa7, 0xff, 0xc2, 0xff, 0xe3, 0xff, 0xd5, 0xff, 0xae, 0xff, 
-0x8d, 0xff, 0x79, 0xff, 0x6f, 0xff, 0x63, 0xff, 0x78, 0xff, 0xa6, 0xff, 0xdd, 0xff, 0x1b, 0x00, 
-0x6a, 0x00, 0xaf, 0x00, 0xd6, 0x00, 0xdb, 0x00, 0xb4, 0x00, 0x86, 0x00, 0x4d, 0x00, 0x16, 0x00, 
-0xf9, 0xff, 0xea, 0xff, 0xd6, 0xff, 0xb8, 0xff, 0x99, 0xff, 0x77, 0xff, 0x63, 0xff, 0x4f, 0xff, 
-0x43, 0xff, 0x55, 0xff, 0x76, 0xff, 0xae, 0xff, 0x0c, 0x00, 0x73, 0x00, 0xd0, 0x00, 0x2f, 0x01, 
-0x7b, 0x01, 0x8f, 0x01, 0x5a, 0x01, 0xe7, 0x00, 0x4a, 0x00, 0x86, 0xff, 0xb8, 0xfe, 0x1c, 0xfe, 
-0xda, 0xfd, 0xf8, 0xfd, 0x72, 0xfe, 0x2c, 0xff, 0x0c, 0x00, 0xe8, 0x00, 0x84, 0x01, 0xc0, 0x01, 
-0xa8, 0x01, 0x56, 0x01, 0xda, 0x00, 0x37, 0x00, 0x8f, 0xff, 0x22, 0xff, 0x03, 0xff, 0x2a, 0xff, 
-0x88, 0xff, 0xf8, 0xff, 0x5b, 0x00, 0x8d, 0x00, 0x76, 0x00, 0x32, 0x00, 0xcc, 0xff, 0x6d, 0xff, 
-0x2c, 0xff, 0x1b, 0xff, 0x4b, 0xff, 0xa3, 0xff, 0x21, 0x00, 0x9e, 0x00, 0xf6, 0x00, 0x0f, 0x01, 
-0xe6, 0x00, 0x9a, 0x00, 0x3e, 0x00, 0xda, 0xff, 0x93, 0xff, 0x89, 0xff, 0xa2, 0xff, 0xcc, 0xff, 
-0xea, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xee, 0xff, 0xd3, 0xff, 0x95, 0xff, 0x65, 0xff, 0x4b, 0xff, 
-0x5a, 0xff, 0xac, 0xff, 0x2c, 0x00, 0xb6, 0x00, 0x23, 0x01, 0x61, 0x01, 0x6f, 0x01, 0x34, 0x01, 
-0xa9, 0x00, 0xf8, 0xff, 0x49, 0xff, 0xb9, 0xfe, 0x50, 0xfe, 0x35, 0xfe, 0x7b, 0xfe, 0x1e, 0xff, 
-0xf1, 0xff, 0x96, 0x00, 0x11, 0x01, 0x63, 0x01, 0x60, 0x01, 0xff, 0x00, 0x72, 0x00, 0xea, 0xff, 
-0x7c, 0xff, 0x42, 0xff, 0x4d, 0xff, 0x9e, 0xff, 0x14, 0x00, 0x7e, 0x00, 0xc9, 0x00, 0xd6, 0x00, 
-0x9d, 0x00, 0x29, 0x00, 0x9f, 0xff, 0x1a, 0xff, 0xc3, 0xfe, 0xb1, 0xfe, 0xe0, 0xfe, 0x5d, 0xff, 
-0xf4, 0xff, 0x75, 0x00, 0xdd, 0x00, 0x20, 0x01, 0x2c, 0x01, 0xeb, 0x00, 0x6a, 0x00, 0xfc, 0xff, 
-0xb2, 0xff, 0x79, 0xff, 0x73, 0xff, 0xb2, 0xff, 0x07, 0x00, 0x3b, 0x00, 0x52, 0x00, 0x52, 0x00, 
-0x25, 0x00, 0xcc, 0xff, 0x49, 0xff, 0xe9, 0xfe, 0xc4, 0xfe, 0xcb, 0xfe, 0x39, 0xff, 0xed, 0xff, 
-0xb7, 0x00, 0x62, 0x01, 0xdf, 0x01, 0x0b, 0x02, 0xc6, 0x01, 0x33, 0x01, 0x60, 0x00, 0x84, 0xff, 
-0xce, 0xfe, 0x46, 0xfe, 0x1f, 0xfe, 0x63, 0xfe, 0xdd, 0xfe, 0x8d, 0xff, 0x3e, 0x00, 0xcb, 0x00, 
-0x23, 0x01, 0x1d, 0x01, 0xc5, 0x00, 0x41, 0x00, 0xc3, 0xff, 0x64, 0xff, 0x2c, 0xff, 0x43, 0xff, 
-0xb3, 0xff, 0x39, 0x00, 0xb2, 0x00, 0x12, 0x01, 0x33, 0x01, 0xfe, 0x00, 0x85, 0x00, 0xe9, 0xff, 
-0x4e, 0xff, 0xe2, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0x34, 0xff, 0x9d, 0xff, 0xf4, 0xff, 0x4f, 0x00, 
-0x9e, 0x00, 0xbd, 0x00, 0x90, 0x00, 0x3e, 0x00, 0xfe, 0xff, 0xe4, 0xff, 0xf5, 0xff, 0x10, 0x00, 
-0x4d, 0x00, 0x9c, 0x00, 0xc6, 0x00, 0xc3, 0x00, 0x89, 0x00, 0x1d, 0x00, 0x85, 0xff, 0xdc, 0xfe, 
-0x5c, 0xfe, 0x38, 0xfe, 0x7f, 0xfe, 0x0f, 0xff, 0xce, 0xff, 0x9d, 0x00, 0x56, 0x01, 0xe8, 0x01, 
-0x24, 0x02, 0xd5, 0x01, 0x2e, 0x01, 0x64, 0x00, 0x91, 0xff, 0xd7, 0xfe, 0x61, 0xfe, 0x4b, 0xfe, 
-0x98, 0xfe, 0x2a, 0xff, 0xcd, 0xff, 0x67, 0x00, 0xd5, 0x00, 0xf4, 0x00, 0xb6, 0x00, 0x44, 0x00, 
-0xcf, 0xff, 0x7d, 0xff, 0x5c, 0xff, 0x69, 0xff, 0xa7, 0xff, 0x0b, 0x00, 0x69, 0x00, 0xbf, 0x00, 
-0xfc, 0x00, 0xf7, 0x00, 0xbb, 0x00, 0x4f, 0x00, 0xe0, 0xff, 0x8b, 0xff, 0x4b, 0xff, 0x35, 0xff, 
-0x3d, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0x30, 0x00, 0x45, 0x00, 0x32, 0x00, 0xf1, 0xff, 
-0xbf, 0xff, 0xbf, 0xff, 0xe6, 0xff, 0x22, 0x00, 0x5f, 0x00, 0xa6, 0x00, 0xdd, 0x00, 0xf5, 0x00, 
-0xd9, 0x00, 0x83, 0x00, 0x0b, 0x00, 0x73, 0xff, 0xe9, 0xfe, 0xa4, 0xfe, 0x9b, 0xfe, 0xbe, 0xfe, 
-0x12, 0xff, 0x8e, 0xff, 0x29, 0x00, 0xc9, 0x00, 0x4d, 0x01, 0x98, 0x01, 0x81, 0x01, 0x17, 0x01, 
-0x93, 0x00, 0xfc, 0xff, 0x76, 0xff, 0x15, 0xff, 0xe9, 0xfe, 0xf5, 0xfe, 0x36, 0xff, 0xaa, 0xff, 
-0x16, 0x00, 0x63, 0x00, 0x87, 0x00, 0x77, 0x00, 0x48, 0x00, 0x05, 0x00, 0xc2, 0xff, 0x94, 0xff, 
-0x7e, 0xff, 0x8e, 0xff, 0xd9, 0xff, 0x3c, 0x00, 0x9a, 0x00, 0xee, 0x00, 0x05, 0x01, 0xd5, 0x00, 
-0x72, 0x00, 0xff, 0xff, 0x9c, 0xff, 0x48, 0xff, 0x20, 0xff, 0x33, 0xff, 0x60, 0xff, 0xaa, 0xff, 
-0x05, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x2d, 0x00, 0xf9, 0xff, 0xd0, 0xff, 0xc9, 0xff, 0xca, 0xff, 
-0xda, 0xff, 0x11, 0x00, 0x62, 0x00, 0xb4, 0x00, 0xef, 0x00, 0xf8, 0x00, 0xc1, 0x00, 0x5c, 0x00, 
-0xd5, 0xff, 0x40, 0xff, 0xce, 0xfe, 0x9e, 0xfe, 0xb4, 0xfe, 0x11, 0xff, 0xa2, 0xff, 0x37, 0x00, 
-0xb3, 0x00, 0x16, 0x01, 0x4b, 0x01, 0x2e, 0x01, 0xdb, 0x00, 0x6a, 0x00, 0xf4, 0xff, 0x83, 0xff, 
-0x2a, 0xff, 0x00, 0xff, 0x0d, 0xff, 0x56, 0xff, 0xc5, 0xff, 0x30, 0x00, 0x78, 0x00, 0x8b, 0x00, 
-0x72, 0x00, 0x4a, 0x00, 0x0b, 0x00, 0xca, 0xff, 0x96, 0xff, 0x8e, 0xff, 0xc3, 0xff, 0x03, 0x00, 
-0x40, 0x00, 0x7e, 0x00, 0xa0, 0x00, 0x97, 0x00, 0x74, 0x00, 0x3f, 0x00, 0xf4, 0xff, 0xa5, 0xff, 
-0x65, 0xff, 0x4d, 0xff, 0x5e, 0xff, 0x8e, 0xff, 0xd5, 0xff, 0x12, 0x00, 0x3f, 0x00, 0x52, 0x00, 
-0x3e, 0x00, 0x1f, 0x00, 0x05, 0x00, 0xea, 0xff, 0xdd, 0xff, 0xe2, 0xff, 0x0a, 0x00, 0x3f, 0x00, 
-0x70, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x5b, 0x00, 0x11, 0x00, 0xc0, 0xff, 0x6d, 0xff, 0x29, 0xff, 
-0x01, 0xff, 0x09, 0xff, 0x40, 0xff, 0x9b, 0xff, 0x15, 0x00, 0x90, 0x00, 0xfd, 0x00, 0x45, 0x01, 
-0x3c, 0x01, 0xf7, 0x00, 0x96, 0x00, 0x28, 0x00, 0xb1, 0xff, 0x4e, 0xff, 0x1f, 0xff, 0x22, 0xff, 
-0x5b, 0xff, 0xaa, 0xff, 0xf7, 0xff, 0x34, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x30, 0x00, 0x15, 0x00, 
-0xee, 0xff, 0xc7, 0xff, 0xb7, 0xff, 0xb1, 0xff, 0xd0, 0xff, 0x1b, 0x00, 0x5f, 0x00, 0x80, 0x00, 
-0x82, 0x00, 0x68, 0x00, 0x3e, 0x00, 0x06, 0x00, 0xbe, 0xff, 0x87, 0xff, 0x78, 0xff, 0x91, 0xff, 
-0xc3, 0xff, 0xf5, 0xff, 0x20, 0x00, 0x37, 0x00, 0x29, 0x00, 0xfd, 0xff, 0xe5, 0xff, 0xd5, 0xff, 
-0xcd, 0xff, 0xe0, 0xff, 0x00, 0x00, 0x27, 0x00, 0x51, 0x00, 0x95, 0x00, 0xc5, 0x00, 0xaf, 0x00, 
-0x6f, 0x00, 0x13, 0x00, 0xad, 0xff, 0x59, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x16, 0xff, 0x58, 0xff, 
-0xc1, 0xff, 0x3a, 0x00, 0x9e, 0x00, 0xe1, 0x00, 0xfc, 0x00, 0xe8, 0x00, 0xb2, 0x00, 0x62, 0x00, 
-0xf4, 0xff, 0x97, 0xff, 0x5c, 0xff, 0x44, 0xff, 0x51, 0xff, 0x81, 0xff, 0xc5, 0xff, 0x06, 0x00, 
-0x47, 0x00, 0x6b, 0x00, 0x56, 0x00, 0x1d, 0x00, 0xed, 0xff, 0xc6, 0xff, 0xb1, 0xff, 0xbe, 0xff, 
-0xdc, 0xff, 0x0e, 0x00, 0x50, 0x00, 0x84, 0x00, 0x92, 0x00, 0x85, 0x00, 0x5a, 0x00, 0x14, 0x00, 
-0xc9, 0xff, 0x90, 0xff, 0x66, 0xff, 0x66, 0xff, 0x99, 0xff, 0xd4, 0xff, 0x00, 0x00, 0x30, 0x00, 
-0x58, 0x00, 0x58, 0x00, 0x35, 0x00, 0x0b, 0x00, 0xed, 0xff, 0xd1, 0xff, 0xc5, 0xff, 0xd6, 0xff, 
-0xfa, 0xff, 0x29, 0x00, 0x4e, 0x00, 0x6c, 0x00, 0x8b, 0x00, 0x70, 0x00, 0x29, 0x00, 0xdd, 0xff, 
-0x8e, 0xff, 0x59, 0xff, 0x3f, 0xff, 0x31, 0xff, 0x3f, 0xff, 0x7c, 0xff, 0xde, 0xff, 0x4c, 0x00, 
-0xa1, 0x00, 0xe2, 0x00, 0x08, 0x01, 0x03, 0x01, 0xd4, 0x00, 0x83, 0x00, 0x24, 0x00, 0xc0, 0xff, 
-0x70, 0xff, 0x42, 0xff, 0x3f, 0xff, 0x69, 0xff, 0xa9, 0xff, 0xd7, 0xff, 0xf0, 0xff, 0x02, 0x00, 
-0xfd, 0xff, 0xee, 0xff, 0xdf, 0xff, 0xde, 0xff, 0xe2, 0xff, 0xfe, 0xff, 0x2e, 0x00, 0x61, 0x00, 
-0xa1, 0x00, 0xbe, 0x00, 0xaa, 0x00, 0x76, 0x00, 0x29, 0x00, 0xd0, 0xff, 0x80, 0xff, 0x4a, 0xff, 
-0x35, 0xff, 0x55, 0xff, 0xa5, 0xff, 0xf7, 0xff, 0x30, 0x00, 0x51, 0x00, 0x5f, 0x00, 0x4b, 0x00, 
-0x2d, 0x00, 0xff, 0xff, 0xd8, 0xff, 0xc4, 0xff, 0xb9, 0xff, 0xd9, 0xff, 0x25, 0x00, 0x70, 0x00, 
-0x94, 0x00, 0x99, 0x00, 0x78, 0x00, 0x43, 0x00, 0xf4, 0xff, 0x98, 0xff, 0x53, 0xff, 0x30, 0xff, 
-0x2d, 0xff, 0x4f, 0xff, 0xa3, 0xff, 0x0c, 0x00, 0x6d, 0x00, 0xb8, 0x00, 0xcf, 0x00, 0xb9, 0x00, 
-0x8e, 0x00, 0x44, 0x00, 0xec, 0xff, 0x9f, 0xff, 0x6d, 0xff, 0x62, 0xff, 0x8b, 0xff, 0xd1, 0xff, 
-0x17, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x63, 0x00, 0x47, 0x00, 0x0d, 0x00, 0xce, 0xff, 0x9d, 0xff, 
-0x7e, 0xff, 0x81, 0xff, 0xb5, 0xff, 0x13, 0x00, 0x5d, 0x00, 0x87, 0x00, 0x9f, 0x00, 0x8a, 0x00, 
-0x4b, 0x00, 0xfe, 0xff, 0xaa, 0xff, 0x71, 0xff, 0x60, 0xff, 0x77, 0xff, 0xba, 0xff, 0x0f, 0x00, 
-0x61, 0x00, 0x9b, 0x00, 0x9a, 0x00, 0x6e, 0x00, 0x33, 0x00, 0xef, 0xff, 0xb1, 0xff, 0x7d, 0xff, 
-0x5e, 0xff, 0x71, 0xff, 0xaf, 0xff, 0x02, 0x00, 0x4c, 0x00, 0x80, 0x00, 0x9f, 0x00, 0x96, 0x00, 
-0x57, 0x00, 0x10, 0x00, 0xc5, 0xff, 0x6e, 0xff, 0x34, 0xff, 0x36, 0xff, 0x73, 0xff, 0xc7, 0xff, 
-0x2c, 0x00, 0x8b, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xc1, 0x00, 0x8b, 0x00, 0x30, 0x00, 0xd4, 0xff, 
-0x87, 0xff, 0x52, 0xff, 0x54, 0xff, 0x83, 0xff, 0xc3, 0xff, 0x0b, 0x00, 0x49, 0x00, 0x7a, 0x00, 
-0x7e, 0x00, 0x5c, 0x00, 0x1b, 0x00, 0xcd, 0xff, 0x92, 0xff, 0x75, 0xff, 0x86, 0xff, 0xb9, 0xff, 
-0x07, 0x00, 0x51, 0x00, 0x80, 0x00, 0x97, 0x00, 0x7e, 0x00, 0x3f, 0x00, 0xf5, 0xff, 0x9e, 0xff, 
-0x5c, 0xff, 0x53, 0xff, 0x88, 0xff, 0xd9, 0xff, 0x2e, 0x00, 0x7b, 0x00, 0x9f, 0x00, 0xa0, 0x00, 
-0x7b, 0x00, 0x24, 0x00, 0xbb, 0xff, 0x6e, 0xff, 0x41, 0xff, 0x35, 0xff, 0x5e, 0xff, 0xbd, 0xff, 
-0x33, 0x00, 0x9c, 0x00, 0xe1, 0x00, 0xf0, 0x00, 0xcc, 0x00, 0x80, 0x00, 0x1b, 0x00, 0xb2, 0xff, 
-0x4c, 0xff, 0x0a, 0xff, 0x02, 0xff, 0x38, 0xff, 0xa1, 0xff, 0x19, 0x00, 0x7e, 0x00, 0xc3, 0x00, 
-0xec, 0x00, 0xe4, 0x00, 0xa0, 0x00, 0x2f, 0x00, 0xc0, 0xff, 0x71, 0xff, 0x47, 0xff, 0x4e, 0xff, 
-0x7f, 0xff, 0xbe, 0xff, 0xff, 0xff, 0x36, 0x00, 0x62, 0x00, 0x7f, 0x00, 0x6f, 0x00, 0x25, 0x00, 
-0xc3, 0xff, 0x81, 0xff, 0x6b, 0xff, 0x81, 0xff, 0xc6, 0xff, 0x23, 0x00, 0x65, 0x00, 0x9a, 0x00, 
-0xba, 0x00, 0xa7, 0x00, 0x74, 0x00, 0x30, 0x00, 0xd4, 0xff, 0x7e, 0xff, 0x56, 0xff, 0x5d, 0xff, 
-0x8c, 0xff, 0xc3, 0xff, 0x01, 0x00, 0x3c, 0x00, 0x5a, 0x00, 0x65, 0x00, 0x57, 0x00, 0x1a, 0x00, 
-0xca, 0xff, 0x91, 0xff, 0x76, 0xff, 0x89, 0xff, 0xc7, 0xff, 0x14, 0x00, 0x54, 0x00, 0x8b, 0x00, 
-0xaf, 0x00, 0xa6, 0x00, 0x6d, 0x00, 0x18, 0x00, 0xc4, 0xff, 0x74, 0xff, 0x3f, 0xff, 0x37, 0xff, 
-0x5e, 0xff, 0xa5, 0xff, 0x00, 0x00, 0x60, 0x00, 0xa6, 0x00, 0xca, 0x00, 0xd3, 0x00, 0xb1, 0x00, 
-0x5e, 0x00, 0xf6, 0xff, 0x93, 0xff, 0x5f, 0xff, 0x62, 0xff, 0x80, 0xff, 0xa9, 0xff, 0xdb, 0xff, 
-0x18, 0x00, 0x4e, 0x00, 0x63, 0x00, 0x46, 0x00, 0xfd, 0xff, 0xb6, 0xff, 0x96, 0xff, 0x98, 0xff, 
-0xae, 0xff, 0xe3, 0xff, 0x24, 0x00, 0x64, 0x00, 0x96, 0x00, 0xa3, 0x00, 0x92, 0x00, 0x62, 0x00, 
-0x1d, 0x00, 0xc8, 0xff, 0x82, 0xff, 0x5e, 0xff, 0x5d, 0xff, 0x90, 0xff, 0xda, 0xff, 0x13, 0x00, 
-0x3f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xcb, 0xff, 0x9d, 0xff, 0x9c, 0xff, 
-0xc9, 0xff, 0x00, 0x00, 0x2d, 0x00, 0x5a, 0x00, 0x7c, 0x00, 0x88, 0x00, 0x79, 0x00, 0x4b, 0x00, 
-0xfa, 0xff, 0xa2, 0xff, 0x66, 0xff, 0x4b, 0xff, 0x58, 0xff, 0x81, 0xff, 0xc3, 0xff, 0x11, 0x00, 
-0x5d, 0x00, 0xa3, 0x00, 0xc6, 0x00, 0xb0, 0x00, 0x74, 0x00, 0x2a, 0x00, 0xe5, 0xff, 0xae, 0xff, 
-0x84, 0xff, 0x75, 0xff, 0x81, 0xff, 0x9a, 0xff, 0xc2, 0xff, 0xf7, 0xff, 0x30, 0x00, 0x5c, 0x00, 
-0x57, 0x00, 0x25, 0x00, 0xfa, 0xff, 0xea, 0xff, 0xdc, 0xff, 0xdc, 0xff, 0xf1, 0xff, 0x0a, 0x00, 
-0x2f, 0x00, 0x5c, 0x00, 0x77, 0x00, 0x68, 0x00, 0x33, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xbb, 0xff, 
-0xb3, 0xff, 0xab, 0xff, 0xae, 0xff, 0xc9, 0xff, 0xea, 0xff, 0x0b, 0x00, 0x26, 0x00, 0x2a, 0x00, 
-0x19, 0x00, 0xf2, 0xff, 0xd7, 0xff, 0xd8, 0xff, 0xde, 0xff, 0xea, 0xff, 0x02, 0x00, 0x20, 0x00, 
-0x44, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x5d, 0x00, 0x30, 0x00, 0xed, 0xff, 0xb5, 0xff, 0x90, 0xff, 
-0x7f, 0xff, 0x83, 0xff, 0x99, 0xff, 0xb9, 0xff, 0xe8, 0xff, 0x2d, 0x00, 0x79, 0x00, 0x9f, 0x00, 
-0x99, 0x00, 0x83, 0x00, 0x57, 0x00, 0x21, 0x00, 0xf5, 0xff, 0xc6, 0xff, 0x9b, 0xff, 0x87, 0xff, 
-0x83, 0xff, 0x9b, 0xff, 0xd4, 0xff, 0x02, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x35, 0x00, 
-0x39, 0x00, 0x30, 0x00, 0x29, 0x00, 0x22, 0x00, 0x15, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x04, 0x00, 
-0xf8, 0xff, 0xe4, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xb1, 0xff, 0xb0, 0xff, 0xba, 0xff, 0xdb, 0xff, 
-0x07, 0x00, 0x28, 0x00, 0x40, 0x00, 0x55, 0x00, 0x49, 0x00, 0x1a, 0x00, 0xfb, 0xff, 0xe8, 0xff, 
-0xd7, 0xff, 0xd3, 0xff, 0xd7, 0xff, 0xe9, 0xff, 0x0d, 0x00, 0x34, 0x00, 0x50, 0x00, 0x4c, 0x00, 
-0x3c, 0x00, 0x2b, 0x00, 0x03, 0x00, 0xdc, 0xff, 0xbc, 0xff, 0xa3, 0xff, 0x97, 0xff, 0xa4, 0xff, 
-0xc6, 0xff, 0xf7, 0xff, 0x2b, 0x00, 0x58, 0x00, 0x6e, 0x00, 0x66, 0x00, 0x58, 0x00, 0x3f, 0x00, 
-0x1d, 0x00, 0xf2, 0xff, 0xc9, 0xff, 0xae, 0xff, 0xa6, 0xff, 0x9f, 0xff, 0xa3, 0xff, 0xc9, 0xff, 
-0xfb, 0xff, 0x17, 0x00, 0x1d, 0x00, 0x25, 0x00, 0x27, 0x00, 0x1b, 0x00, 0x0d, 0x00, 0x08, 0x00, 
-0x13, 0x00, 0x19, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x23, 0x00, 0x18, 0x00, 0x17, 0x00, 
-0x14, 0x00, 0xfa, 0xff, 0xe0, 0xff, 0xc7, 0xff, 0xbd, 0xff, 0xc2, 0xff, 0xc3, 0xff, 0xcd, 0xff, 
-0xe2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0x01, 0x00, 0x0a, 0x00, 0x20, 0x00, 0x39, 0x00, 0x42, 0x00, 
-0x43, 0x00, 0x3d, 0x00, 0x3f, 0x00, 0x42, 0x00, 0x34, 0x00, 0x0c, 0x00, 0xe0, 0xff, 0xc3, 0xff, 
-0xa6, 0xff, 0x8b, 0xff, 0x7c, 0xff, 0x88, 0xff, 0xa2, 0xff, 0xc3, 0xff, 0xf6, 0xff, 0x38, 0x00, 
-0x6f, 0x00, 0x87, 0x00, 0x80, 0x00, 0x75, 0x00, 0x70, 0x00, 0x5c, 0x00, 0x35, 0x00, 0xf8, 0xff, 
-0xb9, 0xff, 0x93, 0xff, 0x82, 0xff, 0x82, 0xff, 0xa1, 0xff, 0xc6, 0xff, 0xdb, 0xff, 0xee, 0xff, 
-0x06, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x54, 0x00, 0x50, 0x00, 0x47, 0x00, 0x40, 0x00, 0x2d, 0x00, 
-0x0a, 0x00, 0xe7, 0xff, 0xd1, 0xff, 0xcf, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xe5, 0xff, 0xf7, 0xff, 
-0xfd, 0xff, 0x06, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x05, 0x00, 0xe5, 0xff, 0xc1, 0xff, 
-0xb9, 0xff, 0xd3, 0xff, 0xea, 0xff, 0xfd, 0xff, 0x0f, 0x00, 0x2b, 0x00, 0x4f, 0x00, 0x73, 0x00, 
-0x84, 0x00, 0x73, 0x00, 0x4a, 0x00, 0x1d, 0x00, 0xe9, 0xff, 0xba, 0xff, 0x88, 0xff, 0x4f, 0xff, 
-0x36, 0xff, 0x52, 0xff, 0x8f, 0xff, 0xd0, 0xff, 0x1f, 0x00, 0x74, 0x00, 0xaa, 0x00, 0xb9, 0x00, 
-0xb2, 0x00, 0x90, 0x00, 0x4d, 0x00, 0x09, 0x00, 0xc2, 0xff, 0x81, 0xff, 0x62, 0xff, 0x66, 0xff, 
-0x8c, 0xff, 0xcb, 0xff, 0x0b, 0x00, 0x33, 0x00, 0x55, 0x00, 0x68, 0x00, 0x5e, 0x00, 0x43, 0x00, 
-0x24, 0x00, 0x04, 0x00, 0xec, 0xff, 0xd4, 0xff, 0xbc, 0xff, 0xbb, 0xff, 0xc4, 0xff, 0xd8, 0xff, 
-0xf8, 0xff, 0x21, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x40, 0x00, 0x21, 0x00, 0xfd, 0xff, 0xe4, 0xff, 
-0xd8, 0xff, 0xdd, 0xff, 0xe0, 0xff, 0xd1, 0xff, 0xc6, 0xff, 0xda, 0xff, 0xf2, 0xff, 0xf8, 0xff, 
-0xfa, 0xff, 0x0a, 0x00, 0x2f, 0x00, 0x4a, 0x00, 0x4f, 0x00, 0x4d, 0x00, 0x43, 0x00, 0x2e, 0x00, 
-0x13, 0x00, 0xf5, 0xff, 0xd5, 0xff, 0xbb, 0xff, 0x99, 0xff, 0x83, 0xff, 0x84, 0xff, 0xa3, 0xff, 
-0xd7, 0xff, 0x0c, 0x00, 0x3a, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x7a, 0x00, 0x75, 0x00, 0x5a, 0x00, 
-0x24, 0x00, 0xe4, 0xff, 0xb4, 0xff, 0x9d, 0xff, 0x9a, 0xff, 0xa7, 0xff, 0xc5, 0xff, 0xee, 0xff, 
-0x1f, 0x00, 0x49, 0x00, 0x59, 0x00, 0x4c, 0x00, 0x2e, 0x00, 0x02, 0x00, 0xdd, 0xff, 0xc7, 0xff, 
-0xbf, 0xff, 0xc9, 0xff, 0xdd, 0xff, 0xfb, 0xff, 0x16, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x39, 0x00, 
-0x21, 0x00, 0xfe, 0xff, 0xe4, 0xff, 0xdb, 0xff, 0xe1, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xe4, 0xff, 
-0xe8, 0xff, 0xf6, 0xff, 0x02, 0x00, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0x0e, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x39, 0x00, 0x43, 0x00, 0x46, 0x00, 0x3b, 0x00, 0x0a, 0x00, 
-0xcc, 0xff, 0xa5, 0xff, 0x92, 0xff, 0x8c, 0xff, 0x9a, 0xff, 0xbd, 0xff, 0xe8, 0xff, 0x0c, 0x00, 
-0x2f, 0x00, 0x52, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x60, 0x00, 0x34, 0x00, 0xfc, 0xff, 0xc2, 0xff, 
-0x97, 0xff, 0x89, 0xff, 0x9c, 0xff, 0xcf, 0xff, 0x0f, 0x00, 0x4c, 0x00, 0x7f, 0x00, 0x87, 0x00, 
-0x63, 0x00, 0x30, 0x00, 0xfb, 0xff, 0xd1, 0xff, 0xb4, 0xff, 0xa3, 0xff, 0xab, 0xff, 0xb2, 0xff, 
-0xc0, 0xff, 0xe5, 0xff, 0x13, 0x00, 0x38, 0x00, 0x43, 0x00, 0x32, 0x00, 0x11, 0x00, 0xef, 0xff, 
-0xd8, 0xff, 0xdc, 0xff, 0xf4, 0xff, 0x14, 0x00, 0x33, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x49, 0x00, 
-0x1d, 0x00, 0xdb, 0xff, 0xa1, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x9a, 0xff, 0xce, 0xff, 0x0b, 0x00, 
-0x47, 0x00, 0x7a, 0x00, 0x95, 0x00, 0x87, 0x00, 0x56, 0x00, 0x13, 0x00, 0xc4, 0xff, 0x76, 0xff, 
-0x53, 0xff, 0x72, 0xff, 0xae, 0xff, 0xe6, 0xff, 0x28, 0x00, 0x70, 0x00, 0x9d, 0x00, 0xa5, 0x00, 
-0x89, 0x00, 0x3e, 0x00, 0xdf, 0xff, 0x94, 0xff, 0x66, 0xff, 0x5f, 0xff, 0x7e, 0xff, 0xbc, 0xff, 
-0x0b, 0x00, 0x51, 0x00, 0x7b, 0x00, 0x88, 0x00, 0x7c, 0x00, 0x52, 0x00, 0x14, 0x00, 0xda, 0xff, 
-0xb1, 0xff, 0xa5, 0xff, 0xa3, 0xff, 0xa3, 0xff, 0xc0, 0xff, 0x00, 0x00, 0x39, 0x00, 0x49, 0x00, 
-0x39, 0x00, 0x1b, 0x00, 0xee, 0xff, 0xc0, 0xff, 0xad, 0xff, 0xb7, 0xff, 0xda, 0xff, 0x07, 0x00, 
-0x3e, 0x00, 0x70, 0x00, 0x8b, 0x00, 0x7e, 0x00, 0x50, 0x00, 0x1b, 0x00, 0xe8, 0xff, 0xae, 0xff, 
-0x82, 0xff, 0x79, 0xff, 0x8b, 0xff, 0xb6, 0xff, 0xfa, 0xff, 0x47, 0x00, 0x83, 0x00, 0xa4, 0x00, 
-0x99, 0x00, 0x5b, 0x00, 0x07, 0x00, 0xb8, 0xff, 0x79, 0xff, 0x5f, 0xff, 0x5b, 0xff, 0x6f, 0xff, 
-0xa4, 0xff, 0xe6, 0xff, 0x2c, 0x00, 0x6a, 0x00, 0x8a, 0x00, 0x86, 0x00, 0x70, 0x00, 0x42, 0x00, 
-0x0b, 0x00, 0xe4, 0xff, 0xce, 0xff, 0xc0, 0xff, 0xcb, 0xff, 0xf0, 0xff, 0x1c, 0x00, 0x34, 0x00, 
-0x37, 0x00, 0x28, 0x00, 0x07, 0x00, 0xe4, 0xff, 0xc7, 0xff, 0xb4, 0xff, 0xb8, 0xff, 0xcc, 0xff, 
-0xe5, 0xff, 0x0a, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x4a, 0x00, 0x34, 0x00, 0x0f, 0x00, 0xea, 0xff, 
-0xc2, 0xff, 0xa8, 0xff, 0xa9, 0xff, 0xc4, 0xff, 0xf6, 0xff, 0x30, 0x00, 0x70, 0x00, 0x93, 0x00, 
-0x8f, 0x00, 0x6b, 0x00, 0x2b, 0x00, 0xe1, 0xff, 0x9a, 0xff, 0x6a, 0xff, 0x4f, 0xff, 0x50, 0xff, 
-0x86, 0xff, 0xd6, 0xff, 0x28, 0x00, 0x7a, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x91, 0x00, 0x43, 0x00, 
-0xf1, 0xff, 0xa5, 0xff, 0x72, 0xff, 0x5f, 0xff, 0x73, 0xff, 0xa5, 0xff, 0xed, 0xff, 0x3a, 0x00, 
-0x71, 0x00, 0x8a, 0x00, 0x85, 0x00, 0x62, 0x00, 0x29, 0x00, 0xf0, 0xff, 0xbe, 0xff, 0x9d, 0xff, 
-0x9e, 0xff, 0xc3, 0xff, 0xfa, 0xff, 0x2c, 0x00, 0x51, 0x00, 0x57, 0x00, 0x3f, 0x00, 0x1b, 0x00, 
-0xe8, 0xff, 0xb9, 0xff, 0xa0, 0xff, 0x9b, 0xff, 0xab, 0xff, 0xcb, 0xff, 0x01, 0x00, 0x34, 0x00, 
-0x55, 0x00, 0x67, 0x00, 0x5f, 0x00, 0x35, 0x00, 0xf5, 0xff, 0xb9, 0xff, 0x97, 0xff, 0x9e, 0xff, 
-0xbd, 0xff, 0xec, 0xff, 0x1e, 0x00, 0x48, 0x00, 0x66, 0x00, 0x78, 0x00, 0x68, 0x00, 0x3d, 0x00, 
-0x07, 0x00, 0xcc, 0xff, 0x9e, 0xff, 0x80, 0xff, 0x7b, 0xff, 0x93, 0xff, 0xc9, 0xff, 0x17, 0x00, 
-0x5f, 0x00, 0x86, 0x00, 0x87, 0x00, 0x65, 0x00, 0x30, 0x00, 0xef, 0xff, 0xb1, 0xff, 0x92, 0xff, 
-0x91, 0xff, 0xa8, 0xff, 0xd0, 0xff, 0xfc, 0xff, 0x26, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x4a, 0x00, 
-0x2d, 0x00, 0x0a, 0x00, 0xe8, 0xff, 0xc2, 0xff, 0xa6, 0xff, 0xac, 0xff, 0xcd, 0xff, 0x07, 0x00, 
-0x40, 0x00, 0x5d, 0x00, 0x62, 0x00, 0x5e, 0x00, 0x4d, 0x00, 0x28, 0x00, 0xf3, 0xff, 0xc1, 0xff, 
-0x9d, 0xff, 0x97, 0xff, 0xa5, 0xff, 0xb7, 0xff, 0xd2, 0xff, 0xf4, 0xff, 0x11, 0x00, 0x22, 0x00, 
-0x2a, 0x00, 0x24, 0x00, 0x19, 0x00, 0x18, 0x00, 0x0f, 0x00, 0x04, 0x00, 0x02, 0x00, 0x11, 0x00, 
-0x2f, 0x00, 0x3d, 0x00, 0x41, 0x00, 0x3b, 0x00, 0x19, 0x00, 0xee, 0xff, 0xc7, 0xff, 0xa2, 0xff, 
-0x8f, 0xff, 0x92, 0xff, 0xa5, 0xff, 0xce, 0xff, 0x04, 0x00, 0x2c, 0x00, 0x46, 0x00, 0x50, 0x00, 
-0x44, 0x00, 0x33, 0x00, 0x1b, 0x00, 0xfa, 0xff, 0xdb, 0xff, 0xca, 0xff, 0xd1, 0xff, 0xe9, 0xff, 
-0x0c, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x45, 0x00, 0x2e, 0x00, 0x05, 0x00, 0xd2, 0xff, 
-0xa8, 0xff, 0x8f, 0xff, 0x92, 0xff, 0xae, 0xff, 0xd8, 0xff, 0x02, 0x00, 0x28, 0x00, 0x46, 0x00, 
-0x55, 0x00, 0x61, 0x00, 0x63, 0x00, 0x4c, 0x00, 0x23, 0x00, 0xf5, 0xff, 0xcf, 0xff, 0xb8, 0xff, 
-0xb5, 0xff, 0xc4, 0xff, 0xd9, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xec, 0xff, 0xe6, 0xff, 0xdb, 0xff, 
-0xd1, 0xff, 0xda, 0xff, 0xf5, 0xff, 0x1f, 0x00, 0x49, 0x00, 0x67, 0x00, 0x70, 0x00, 0x6d, 0x00, 
-0x63, 0x00, 0x4b, 0x00, 0x20, 0x00, 0xec, 0xff, 0xb6, 0xff, 0x80, 0xff, 0x6a, 0xff, 0x6d, 0xff, 
-0x88, 0xff, 0xcb, 0xff, 0x1a, 0x00, 0x52, 0x00, 0x6d, 0x00, 0x75, 0x00, 0x65, 0x00, 0x33, 0x00, 
-0xf5, 0xff, 0xcc, 0xff, 0xba, 0xff, 0xb5, 0xff, 0xc1, 0xff, 0xda, 0xff, 0xf8, 0xff, 0x1f, 0x00, 
-0x44, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x3d, 0x00, 0x13, 0x00, 0xdb, 0xff, 0xb0, 0xff, 0xa2, 0xff, 
-0xa4, 0xff, 0xbb, 0xff, 0xe6, 0xff, 0x0f, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x3c, 0x00, 0x39, 0x00, 
-0x2c, 0x00, 0x14, 0x00, 0xff, 0xff, 0xf1, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf6, 0xff, 
-0xfc, 0xff, 0xf9, 0xff, 0xeb, 0xff, 0xd4, 0xff, 0xbf, 0xff, 0xb3, 0xff, 0xbc, 0xff, 0xd6, 0xff, 
-0x02, 0x00, 0x40, 0x00, 0x74, 0x00, 0x94, 0x00, 0xa7, 0x00, 0x9e, 0x00, 0x6a, 0x00, 0x15, 0x00, 
-0xb9, 0xff, 0x71, 0xff, 0x48, 0xff, 0x45, 0xff, 0x69, 0xff, 0xa1, 0xff, 0xd9, 0xff, 0x16, 0x00, 
-0x55, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x51, 0x00, 0x2b, 0x00, 0x08, 0x00, 0xe5, 0xff, 0xc6, 0xff, 
-0xc2, 0xff, 0xd8, 0xff, 0xfe, 0xff, 0x20, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x51, 0x00, 0x38, 0x00, 
-0x01, 0x00, 0xcd, 0xff, 0xb2, 0xff, 0xac, 0xff, 0xb9, 0xff, 0xc9, 0xff, 0xda, 0xff, 0xf6, 0xff, 
-0x13, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x34, 0x00, 0x2a, 0x00, 0x1a, 0x00, 0x0b, 0x00, 0xfe, 0xff, 
-0xfe, 0xff, 0x0a, 0x00, 0x13, 0x00, 0x20, 0x00, 0x26, 0x00, 0x1e, 0x00, 0xfa, 0xff, 0xbc, 0xff, 
-0x83, 0xff, 0x5d, 0xff, 0x54, 0xff, 0x6f, 0xff, 0xaf, 0xff, 0x0d, 0x00, 0x6a, 0x00, 0xb3, 0x00, 
-0xe0, 0x00, 0xeb, 0x00, 0xcf, 0x00, 0x8a, 0x00, 0x2a, 0x00, 0xc2, 0xff, 0x69, 0xff, 0x39, 0xff, 
-0x30, 0xff, 0x4b, 0xff, 0x8e, 0xff, 0xe4, 0xff, 0x2f, 0x00, 0x63, 0x00, 0x74, 0x00, 0x61, 0x00, 
-0x36, 0x00, 0x04, 0x00, 0xe1, 0xff, 0xc9, 0xff, 0xbb, 0xff, 0xcc, 0xff, 0xef, 0xff, 0x13, 0x00, 
-0x31, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x46, 0x00, 0x32, 0x00, 0x17, 0x00, 0xfa, 0xff, 0xe2, 0xff, 
-0xd7, 0xff, 0xd7, 0xff, 0xdf, 0xff, 0xef, 0xff, 0xf4, 0xff, 0xe7, 0xff, 0xd8, 0xff, 0xce, 0xff, 
-0xc3, 0xff, 0xc3, 0xff, 0xd6, 0xff, 0xff, 0xff, 0x37, 0x00, 0x61, 0x00, 0x71, 0x00, 0x6a, 0x00, 
-0x5d, 0x00, 0x48, 0x00, 0x19, 0x00, 0xdc, 0xff, 0x9e, 0xff, 0x6e, 0xff, 0x65, 0xff, 0x7a, 0xff, 
-0xac, 0xff, 0xf4, 0xff, 0x3c, 0x00, 0x7d, 0x00, 0xa5, 0x00, 0xa2, 0x00, 0x7b, 0x00, 0x41, 0x00, 
-0x01, 0x00, 0xc9, 0xff, 0x9b, 0xff, 0x7e, 0xff, 0x7b, 0xff, 0x95, 0xff, 0xc2, 0xff, 0xf7, 0xff, 
-0x27, 0x00, 0x46, 0x00, 0x52, 0x00, 0x4c, 0x00, 0x3b, 0x00, 0x18, 0x00, 0xed, 0xff, 0xd3, 0xff, 
-0xc3, 0xff, 0xc1, 0xff, 0xd0, 0xff, 0xec, 0xff, 0x10, 0x00, 0x30, 0x00, 0x41, 0x00, 0x38, 0x00, 
-0x23, 0x00, 0x13, 0x00, 0x06, 0x00, 0xfe, 0xff, 0x04, 0x00, 0x12, 0x00, 0x15, 0x00, 0x13, 0x00, 
-0x08, 0x00, 0xf3, 0xff, 0xd9, 0xff, 0xb9, 0xff, 0xa6, 0xff, 0xa6, 0xff, 0xae, 0xff, 0xc9, 0xff, 
-0xf6, 0xff, 0x2b, 0x00, 0x5c, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x75, 0x00, 0x53, 0x00, 0x1a, 0x00, 
-0xcc, 0xff, 0x85, 0xff, 0x59, 0xff, 0x57, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0x0b, 0x00, 0x46, 0x00, 
-0x76, 0x00, 0x97, 0x00, 0x99, 0x00, 0x79, 0x00, 0x44, 0x00, 0x07, 0x00, 0xca, 0xff, 0xa0, 0xff, 
-0x8b, 0xff, 0x8d, 0xff, 0xb4, 0xff, 0xeb, 0xff, 0x20, 0x00, 0x4a, 0x00, 0x59, 0x00, 0x53, 0x00, 
-0x34, 0x00, 0xf7, 0xff, 0xb8, 0xff, 0x97, 0xff, 0x96, 0xff, 0xa3, 0xff, 0xbf, 0xff, 0xe9, 0xff, 
-0x1c, 0x00, 0x47, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x4b, 0x00, 0x29, 0x00, 0x06, 0x00, 
-0xee, 0xff, 0xe3, 0xff, 0xe1, 0xff, 0xe7, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xd8, 0xff, 0xc3, 0xff, 
-0xb2, 0xff, 0xa9, 0xff, 0xa7, 0xff, 0xbb, 0xff, 0xe1, 0xff, 0x16, 0x00, 0x4a, 0x00, 0x71, 0x00, 
-0x8e, 0x00, 0x92, 0x00, 0x77, 0x00, 0x51, 0x00, 0x1e, 0x00, 0xe5, 0xff, 0xae, 0xff, 0x7d, 0xff, 
-0x62, 0xff, 0x6d, 0xff, 0x9d, 0xff, 0xe1, 0xff, 0x20, 0x00, 0x5a, 0x00, 0x7c, 0x00, 0x78, 0x00, 
-0x61, 0x00, 0x3b, 0x00, 0x0f, 0x00, 0xdc, 0xff, 0xb4, 0xff, 0xa5, 0xff, 0xa6, 0xff, 0xb6, 0xff, 
-0xd9, 0xff, 0x0e, 0x00, 0x3c, 0x00, 0x58, 0x00, 0x5d, 0x00, 0x45, 0x00, 0x1c, 0x00, 0xf1, 0xff, 
-0xcd, 0xff, 0xac, 0xff, 0x95, 0xff, 0x94, 0xff, 0xa9, 0xff, 0xd0, 0xff, 0xfa, 0xff, 0x29, 0x00, 
-0x54, 0x00, 0x6c, 0x00, 0x71, 0x00, 0x6a, 0x00, 0x5a, 0x00, 0x3f, 0x00, 0x21, 0x00, 0x08, 0x00, 
-0xf1, 0xff, 0xd9, 0xff, 0xc1, 0xff, 0xad, 0xff, 0xa2, 0xff, 0xa5, 0xff, 0xac, 0xff, 0xb5, 0xff, 
-0xc6, 0xff, 0xe0, 0xff, 0x08, 0x00, 0x31, 0x00, 0x57, 0x00, 0x76, 0x00, 0x84, 0x00, 0x72, 0x00, 
-0x46, 0x00, 0x10, 0x00, 0xd8, 0xff, 0xa7, 0xff, 0x8b, 0xff, 0x89, 0xff, 0x9f, 0xff, 0xc6, 0xff, 
-0xfb, 0xff, 0x2d, 0x00, 0x4a, 0x00, 0x56, 0x00, 0x56, 0x00, 0x4a, 0x00, 0x2b, 0x00, 0x06, 0x00, 
-0xe5, 0xff, 0xc6, 0xff, 0xb1, 0xff, 0xb2, 0xff, 0xcb, 0xff, 0xf8, 0xff, 0x2a, 0x00, 0x50, 0x00, 
-0x63, 0x00, 0x57, 0x00, 0x30, 0x00, 0x07, 0x00, 0xd7, 0xff, 0xa5, 0xff, 0x84, 0xff, 0x79, 0xff, 
-0x87, 0xff, 0xa7, 0xff, 0xd4, 0xff, 0x0d, 0x00, 0x48, 0x00, 0x74, 0x00, 0x8d, 0x00, 0x96, 0x00, 
-0x86, 0x00, 0x66, 0x00, 0x38, 0x00, 0x07, 0x00, 0xe8, 0xff, 0xdb, 0xff, 0xca, 0xff, 0xad, 0xff, 
-0x9b, 0xff, 0x8e, 0xff, 0x87, 0xff, 0x8d, 0xff, 0x9c, 0xff, 0xba, 0xff, 0xf1, 0xff, 0x2b, 0x00, 
-0x5d, 0x00, 0x87, 0x00, 0x9c, 0x00, 0x9e, 0x00, 0x90, 0x00, 0x64, 0x00, 0x25, 0x00, 0xe4, 0xff, 
-0xa4, 0xff, 0x72, 0xff, 0x5e, 0xff, 0x64, 0xff, 0x82, 0xff, 0xc0, 0xff, 0x0e, 0x00, 0x49, 0x00, 
-0x6a, 0x00, 0x7c, 0x00, 0x79, 0x00, 0x5a, 0x00, 0x28, 0x00, 0xf6, 0xff, 0xcc, 0xff, 0xaf, 0xff, 
-0xa9, 0xff, 0xb9, 0xff, 0xda, 0xff, 0x0a, 0x00, 0x3d, 0x00, 0x5c, 0x00, 0x60, 0x00, 0x4c, 0x00, 
-0x20, 0x00, 0xe9, 0xff, 0xac, 0xff, 0x7f, 0xff, 0x72, 0xff, 0x7b, 0xff, 0x9e, 0xff, 0xd4, 0xff, 
-0x07, 0x00, 0x30, 0x00, 0x5b, 0x00, 0x7a, 0x00, 0x81, 0x00, 0x7d, 0x00, 0x6d, 0x00, 0x56, 0x00, 
-0x3e, 0x00, 0x23, 0x00, 0xfd, 0xff, 0xd8, 0xff, 0xba, 0xff, 0x95, 0xff, 0x7c, 0xff, 0x77, 0xff, 
-0x7c, 0xff, 0x8c, 0xff, 0xab, 0xff, 0xd8, 0xff, 0x11, 0x00, 0x52, 0x00, 0x8d, 0x00, 0xac, 0x00, 
-0xad, 0x00, 0x8e, 0x00, 0x5a, 0x00, 0x19, 0x00, 0xd3, 0xff, 0x96, 0xff, 0x6d, 0xff, 0x65, 0xff, 
-0x7e, 0xff, 0xab, 0xff, 0xe5, 0xff, 0x1e, 0x00, 0x4d, 0x00, 0x6c, 0x00, 0x72, 0x00, 0x5d, 0x00, 
-0x3a, 0x00, 0x0f, 0x00, 0xda, 0xff, 0xb3, 0xff, 0xa7, 0xff, 0xb7, 0xff, 0xe1, 0xff, 0x15, 0x00, 
-0x3e, 0x00, 0x55, 0x00, 0x58, 0x00, 0x40, 0x00, 0x13, 0x00, 0xe2, 0xff, 0xbb, 0xff, 0xa1, 0xff, 
-0x93, 0xff, 0x9c, 0xff, 0xb3, 0xff, 0xce, 0xff, 0xf1, 0xff, 0x19, 0x00, 0x3c, 0x00, 0x4f, 0x00, 
-0x53, 0x00, 0x4b, 0x00, 0x43, 0x00, 0x38, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x29, 0x00, 0x29, 0x00, 
-0x1b, 0x00, 0xf5, 0xff, 0xbc, 0xff, 0x8f, 0xff, 0x74, 0xff, 0x60, 0xff, 0x60, 0xff, 0x84, 0xff, 
-0xc3, 0xff, 0x10, 0x00, 0x60, 0x00, 0x9b, 0x00, 0xb6, 0x00, 0xb9, 0x00, 0x9e, 0x00, 0x67, 0x00, 
-0x1d, 0x00, 0xd0, 0xff, 0x8e, 0xff, 0x61, 0xff, 0x58, 0xff, 0x76, 0xff, 0xaf, 0xff, 0xf0, 0xff, 
-0x30, 0x00, 0x61, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x4e, 0x00, 0x21, 0x00, 0xee, 0xff, 0xc6, 0xff, 
-0xb7, 0xff, 0xb7, 0xff, 0xc7, 0xff, 0xe2, 0xff, 0x06, 0x00, 0x2a, 0x00, 0x42, 0x00, 0x4d, 0x00, 
-0x41, 0x00, 0x24, 0x00, 0xff, 0xff, 0xd6, 0xff, 0xb5, 0xff, 0xa8, 0xff, 0xae, 0xff, 0xc0, 0xff, 
-0xdd, 0xff, 0xf8, 0xff, 0x13, 0x00, 0x28, 0x00, 0x2d, 0x00, 0x28, 0x00, 0x28, 0x00, 0x2a, 0x00, 
-0x30, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x47, 0x00, 0x42, 0x00, 0x27, 0x00, 0xfd, 0xff, 0xd1, 0xff, 
-0xa4, 0xff, 0x73, 0xff, 0x53, 0xff, 0x52, 0xff, 0x6e, 0xff, 0xad, 0xff, 0x02, 0x00, 0x51, 0x00, 
-0x8d, 0x00, 0xba, 0x00, 0xc5, 0x00, 0xaa, 0x00, 0x6c, 0x00, 0x17, 0x00, 0xc8, 0xff, 0x82, 0xff, 
-0x5c, 0xff, 0x61, 0xff, 0x84, 0xff, 0xc0, 0xff, 0x05, 0x00, 0x44, 0x00, 0x6e, 0x00, 0x7f, 0x00, 
-0x70, 0x00, 0x49, 0x00, 0x16, 0x00, 0xe4, 0xff, 0xbb, 0xff, 0xa1, 0xff, 0x9f, 0xff, 0xb7, 0xff, 
-0xde, 0xff, 0x0e, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x50, 0x00, 0x3b, 0x00, 0x17, 0x00, 0xf2, 0xff, 
-0xd8, 0xff, 0xc8, 0xff, 0xc1, 0xff, 0xca, 0xff, 0xe0, 0xff, 0xf7, 0xff, 0x07, 0x00, 0x0d, 0x00, 
-0x07, 0x00, 0xf9, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0x05, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x4c, 0x00, 
-0x69, 0x00, 0x73, 0x00, 0x5c, 0x00, 0x2c, 0x00, 0xee, 0xff, 0xa6, 0xff, 0x64, 0xff, 0x3f, 0xff, 
-0x38, 0xff, 0x55, 0xff, 0xa4, 0xff, 0x08, 0x00, 0x5f, 0x00, 0xa1, 0x00, 0xc8, 0x00, 0xcb, 0x00, 
-0xa1, 0x00, 0x57, 0x00, 0x06, 0x00, 0xb7, 0xff, 0x7a, 0xff, 0x60, 0xff, 0x6b, 0xff, 0x98, 0xff, 
-0xd7, 0xff, 0x1f, 0x00, 0x5b, 0x00, 0x7a, 0x00, 0x77, 0x00, 0x53, 0x00, 0x21, 0x00, 0xf2, 0xff, 
-0xc5, 0xff, 0x9e, 0xff, 0x95, 0xff, 0xaf, 0xff, 0xd7, 0xff, 0x00, 0x00, 0x23, 0x00, 0x40, 0x00, 
-0x4d, 0x00, 0x45, 0x00, 0x28, 0x00, 0x02, 0x00, 0xe7, 0xff, 0xdb, 0xff, 0xd4, 0xff, 0xda, 0xff, 
-0xf1, 0xff, 0x05, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x02, 0x00, 0xef, 0xff, 0xdd, 0xff, 0xd3, 0xff, 
-0xd8, 0xff, 0xec, 0xff, 0x12, 0x00, 0x46, 0x00, 0x74, 0x00, 0x8b, 0x00, 0x86, 0x00, 0x63, 0x00, 
-0x23, 0x00, 0xd3, 0xff, 0x84, 0xff, 0x4c, 0xff, 0x2f, 0xff, 0x36, 0xff, 0x6b, 0xff, 0xc5, 0xff, 
-0x2c, 0x00, 0x80, 0x00, 0xbc, 0x00, 0xd2, 0x00, 0xbe, 0x00, 0x83, 0x00, 0x2d, 0x00, 0xce, 0xff, 
-0x7d, 0xff, 0x51, 0xff, 0x4d, 0xff, 0x76, 0xff, 0xc1, 0xff, 0x16, 0x00, 0x57, 0x00, 0x7c, 0x00, 
-0x83, 0x00, 0x6d, 0x00, 0x3a, 0x00, 0x03, 0x00, 0xd6, 0xff, 0xb2, 0xff, 0xa6, 0xff, 0xb0, 0xff, 
-0xcf, 0xff, 0xf0, 0xff, 0x13, 0x00, 0x31, 0x00, 0x3d, 0x00, 0x36, 0x00, 0x1a, 0x00, 0xf3, 0xff, 
-0xd7, 0xff, 0xce, 0xff, 0xd7, 0xff, 0xf4, 0xff, 0x1f, 0x00, 0x3f, 0x00, 0x44, 0x00, 0x33, 0x00, 
-0x1c, 0x00, 0xfa, 0xff, 0xc8, 0xff, 0xa5, 0xff, 0x94, 0xff, 0x9c, 0xff, 0xbf, 0xff, 0xfa, 0xff, 
-0x40, 0x00, 0x7a, 0x00, 0x9e, 0x00, 0xa2, 0x00, 0x81, 0x00, 0x3a, 0x00, 0xe2, 0xff, 0x88, 0xff, 
-0x3d, 0xff, 0x1e, 0xff, 0x2f, 0xff, 0x6c, 0xff, 0xce, 0xff, 0x3c, 0x00, 0x9b, 0x00, 0xd3, 0x00, 
-0xd9, 0x00, 0xb6, 0x00, 0x72, 0x00, 0x1c, 0x00, 0xc2, 0xff, 0x84, 0xff, 0x68, 0xff, 0x68, 0xff, 
-0x8a, 0xff, 0xcb, 0xff, 0x16, 0x00, 0x4c, 0x00, 0x68, 0x00, 0x69, 0x00, 0x4d, 0x00, 0x19, 0x00, 
-0xe3, 0xff, 0xc0, 0xff, 0xb6, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xfb, 0xff, 0x1a, 0x00, 0x32, 0x00, 
-0x35, 0x00, 0x26, 0x00, 0x0b, 0x00, 0xe4, 0xff, 0xc8, 0xff, 0xc1, 0xff, 0xcb, 0xff, 0xea, 0xff, 
-0x14, 0x00, 0x3c, 0x00, 0x59, 0x00, 0x5b, 0x00, 0x44, 0x00, 0x20, 0x00, 0xf0, 0xff, 0xb3, 0xff, 
-0x83, 0xff, 0x6d, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0x14, 0x00, 0x63, 0x00, 0xa1, 0x00, 0xbf, 0x00, 
-0xb4, 0x00, 0x7d, 0x00, 0x20, 0x00, 0xba, 0xff, 0x67, 0xff, 0x37, 0xff, 0x30, 0xff, 0x50, 0xff, 
-0x91, 0xff, 0xec, 0xff, 0x4c, 0x00, 0x98, 0x00, 0xbe, 0x00, 0xbd, 0x00, 0x97, 0x00, 0x52, 0x00, 
-0x05, 0x00, 0xbb, 0xff, 0x81, 0xff, 0x6e, 0xff, 0x7f, 0xff, 0xab, 0xff, 0xe2, 0xff, 0x12, 0x00, 
-0x33, 0x00, 0x3c, 0x00, 0x30, 0x00, 0x1b, 0x00, 0x03, 0x00, 0xf7, 0xff, 0xfe, 0xff, 0x0a, 0x00, 
-0x14, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x1d, 0x00, 0x0f, 0x00, 0x03, 0x00, 0xec, 0xff, 0xd0, 0xff, 
-0xb3, 0xff, 0xa2, 0xff, 0xa9, 0xff, 0xcc, 0xff, 0x00, 0x00, 0x3b, 0x00, 0x68, 0x00, 0x7d, 0x00, 
-0x77, 0x00, 0x53, 0x00, 0x17, 0x00, 0xd6, 0xff, 0xa3, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0xa4, 0xff, 
-0xd0, 0xff, 0x0b, 0x00, 0x4a, 0x00, 0x77, 0x00, 0x8e, 0x00, 0x87, 0x00, 0x5b, 0x00, 0x10, 0x00, 
-0xc0, 0xff, 0x7d, 0xff, 0x53, 0xff, 0x4a, 0xff, 0x69, 0xff, 0xac, 0xff, 0xff, 0xff, 0x53, 0x00, 
-0x8f, 0x00, 0xa7, 0x00, 0x9d, 0x00, 0x78, 0x00, 0x41, 0x00, 0x09, 0x00, 0xdb, 0xff, 0xbd, 0xff, 
-0xaa, 0xff, 0xa8, 0xff, 0xb6, 0xff, 0xd1, 0xff, 0xf1, 0xff, 0x03, 0x00, 0x0a, 0x00, 0x07, 0x00, 
-0x03, 0x00, 0xfb, 0xff, 0xf0, 0xff, 0xfb, 0xff, 0x17, 0x00, 0x30, 0x00, 0x48, 0x00, 0x51, 0x00, 
-0x45, 0x00, 0x25, 0x00, 0xf9, 0xff, 0xce, 0xff, 0xa7, 0xff, 0x8c, 0xff, 0x8b, 0xff, 0xa8, 0xff, 
-0xdb, 0xff, 0x13, 0x00, 0x48, 0x00, 0x6f, 0x00, 0x7e, 0x00, 0x6f, 0x00, 0x4a, 0x00, 0x18, 0x00, 
-0xe1, 0xff, 0xad, 0xff, 0x85, 0xff, 0x78, 0xff, 0x8c, 0xff, 0xbd, 0xff, 0x01, 0x00, 0x47, 0x00, 
-0x7d, 0x00, 0x99, 0x00, 0x92, 0x00, 0x6b, 0x00, 0x2c, 0x00, 0xe4, 0xff, 0xa6, 0xff, 0x7d, 0xff, 
-0x6d, 0xff, 0x77, 0xff, 0x9a, 0xff, 0xcc, 0xff, 0x04, 0x00, 0x3a, 0x00, 0x65, 0x00, 0x7e, 0x00, 
-0x79, 0x00, 0x5b, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xde, 0xff, 0xca, 0xff, 0xcb, 0xff, 0xd4, 0xff, 
-0xe1, 0xff, 0xea, 0xff, 0xe9, 0xff, 0xe7, 0xff, 0xe0, 0xff, 0xdd, 0xff, 0xe7, 0xff, 0xfc, 0xff, 
-0x12, 0x00, 0x2b, 0x00, 0x43, 0x00, 0x52, 0x00, 0x52, 0x00, 0x41, 0x00, 0x23, 0x00, 0xfb, 0xff, 
-0xcf, 0xff, 0xa6, 0xff, 0x89, 0xff, 0x83, 0xff, 0x99, 0xff, 0xc7, 0xff, 0x06, 0x00, 0x49, 0x00, 
-0x7b, 0x00, 0x91, 0x00, 0x8b, 0x00, 0x64, 0x00, 0x2a, 0x00, 0xe6, 0xff, 0xad, 0xff, 0x8a, 0xff, 
-0x80, 0xff, 0x91, 0xff, 0xb6, 0xff, 0xe7, 0xff, 0x20, 0x00, 0x53, 0x00, 0x72, 0x00, 0x77, 0x00, 
-0x5f, 0x00, 0x2f, 0x00, 0xf0, 0xff, 0xb9, 0xff, 0x96, 0xff, 0x88, 0xff, 0x99, 0xff, 0xbe, 0xff, 
-0xe8, 0xff, 0x15, 0x00, 0x3f, 0x00, 0x58, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x35, 0x00, 0x15, 0x00, 
-0xfc, 0xff, 0xeb, 0xff, 0xe4, 0xff, 0xe2, 0xff, 0xe1, 0xff, 0xe8, 0xff, 0xed, 0xff, 0xeb, 0xff, 
-0xe6, 0xff, 0xe0, 0xff, 0xdc, 0xff, 0xe0, 0xff, 0xed, 0xff, 0x01, 0x00, 0x1e, 0x00, 0x45, 0x00, 
-0x66, 0x00, 0x6f, 0x00, 0x5c, 0x00, 0x2b, 0x00, 0xf3, 0xff, 0xbc, 0xff, 0x8f, 0xff, 0x73, 0xff, 
-0x6d, 0xff, 0x8d, 0xff, 0xcc, 0xff, 0x14, 0x00, 0x50, 0x00, 0x7c, 0x00, 0x91, 0x00, 0x88, 0x00, 
-0x68, 0x00, 0x34, 0x00, 0xf5, 0xff, 0xb8, 0xff, 0x89, 0xff, 0x73, 0xff, 0x82, 0xff, 0xb0, 0xff, 
-0xee, 0xff, 0x2d, 0x00, 0x5f, 0x00, 0x7c, 0x00, 0x78, 0x00, 0x59, 0x00, 0x2b, 0x00, 0xf1, 0xff, 
-0xbc, 0xff, 0x9d, 0xff, 0x99, 0xff, 0xa8, 0xff, 0xc0, 0xff, 0xe0, 0xff, 0x05, 0x00, 0x25, 0x00, 
-0x3e, 0x00, 0x4d, 0x00, 0x43, 0x00, 0x27, 0x00, 0x0a, 0x00, 0xf3, 0xff, 0xea, 0xff, 0xf4, 0xff, 
-0x02, 0x00, 0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0xf4, 0xff, 0xde, 0xff, 0xcc, 0xff, 0xca, 0xff, 
-0xd2, 0xff, 0xe3, 0xff, 0x07, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x56, 0x00, 0x53, 0x00, 0x3a, 0x00, 
-0x17, 0x00, 0xf0, 0xff, 0xcb, 0xff, 0xaa, 0xff, 0x98, 0xff, 0x9d, 0xff, 0xb5, 0xff, 0xe1, 0xff, 
-0x1a, 0x00, 0x50, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x60, 0x00, 0x3c, 0x00, 0x0b, 0x00, 0xe0, 0xff, 
-0xbe, 0xff, 0xa2, 0xff, 0x9f, 0xff, 0xb2, 0xff, 0xc9, 0xff, 0xe8, 0xff, 0x11, 0x00, 0x3a, 0x00, 
-0x52, 0x00, 0x52, 0x00, 0x4c, 0x00, 0x31, 0x00, 0x09, 0x00, 0xe6, 0xff, 0xca, 0xff, 0xbb, 0xff, 
-0xbb, 0xff, 0xc7, 0xff, 0xe0, 0xff, 0xf9, 0xff, 0x09, 0x00, 0x16, 0x00, 0x22, 0x00, 0x27, 0x00, 
-0x25, 0x00, 0x1e, 0x00, 0x17, 0x00, 0x18, 0x00, 0x16, 0x00, 0x10, 0x00, 0x08, 0x00, 0xfc, 0xff, 
-0xe8, 0xff, 0xd5, 0xff, 0xca, 0xff, 0xca, 0xff, 0xd1, 0xff, 0xda, 0xff, 0xe9, 0xff, 0x08, 0x00, 
-0x2b, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x45, 0x00, 0x31, 0x00, 0x14, 0x00, 0xed, 0xff, 0xc5, 0xff, 
-0xad, 0xff, 0xa6, 0xff, 0xaf, 0xff, 0xce, 0xff, 0xf8, 0xff, 0x21, 0x00, 0x3e, 0x00, 0x50, 0x00, 
-0x53, 0x00, 0x46, 0x00, 0x35, 0x00, 0x15, 0x00, 0xee, 0xff, 0xca, 0xff, 0xae, 0xff, 0xa8, 0xff, 
-0xb2, 0xff, 0xc6, 0xff, 0xe3, 0xff, 0x0c, 0x00, 0x30, 0x00, 0x48, 0x00, 0x55, 0x00, 0x51, 0x00, 
-0x3d, 0x00, 0x1f, 0x00, 0x06, 0x00, 0xee, 0xff, 0xd8, 0xff, 0xc6, 0xff, 0xb9, 0xff, 0xbd, 0xff, 
-0xc9, 0xff, 0xd9, 0xff, 0xf2, 0xff, 0x10, 0x00, 0x25, 0x00, 0x29, 0x00, 0x24, 0x00, 0x25, 0x00, 
-0x28, 0x00, 0x28, 0x00, 0x23, 0x00, 0x18, 0x00, 0x01, 0x00, 0xe4, 0xff, 0xcb, 0xff, 0xbb, 0xff, 
-0xbe, 0xff, 0xc9, 0xff, 0xdc, 0xff, 0xfd, 0xff, 0x20, 0x00, 0x3a, 0x00, 0x47, 0x00, 0x44, 0x00, 
-0x38, 0x00, 0x23, 0x00, 0x03, 0x00, 0xe1, 0xff, 0xc1, 0xff, 0xad, 0xff, 0xac, 0xff, 0xbd, 0xff, 
-0xdb, 0xff, 0xfc, 0xff, 0x22, 0x00, 0x47, 0x00, 0x5e, 0x00, 0x5a, 0x00, 0x47, 0x00, 0x30, 0x00, 
-0x0c, 0x00, 0xe2, 0xff, 0xc6, 0xff, 0xb5, 0xff, 0xb1, 0xff, 0xbc, 0xff, 0xce, 0xff, 0xe5, 0xff, 
-0xfd, 0xff, 0x18, 0x00, 0x30, 0x00, 0x41, 0x00, 0x45, 0x00, 0x37, 0x00, 0x20, 0x00, 0x07, 0x00, 
-0xf2, 0xff, 0xe2, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xda, 0xff, 0xd7, 0xff, 0xdd, 0xff, 0xe6, 0xff, 
-0xf8, 0xff, 0x06, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x32, 0x00, 0x36, 0x00, 0x2b, 0x00, 
-0x12, 0x00, 0xf7, 0xff, 0xe8, 0xff, 0xd6, 0xff, 0xc4, 0xff, 0xc3, 0xff, 0xd2, 0xff, 0xe5, 0xff, 
-0xfc, 0xff, 0x1a, 0x00, 0x3d, 0x00, 0x54, 0x00, 0x58, 0x00, 0x48, 0x00, 0x28, 0x00, 0xff, 0xff, 
-0xd1, 0xff, 0xa5, 0xff, 0x8b, 0xff, 0x90, 0xff, 0xab, 0xff, 0xd5, 0xff, 0x03, 0x00, 0x2d, 0x00, 
-0x4d, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x53, 0x00, 0x39, 0x00, 0x0f, 0x00, 0xea, 0xff, 0xca, 0xff, 
-0xb4, 0xff, 0xae, 0xff, 0xb8, 0xff, 0xd0, 0xff, 0xea, 0xff, 0x05, 0x00, 0x20, 0x00, 0x34, 0x00, 
-0x3c, 0x00, 0x3b, 0x00, 0x2d, 0x00, 0x1d, 0x00, 0x0c, 0x00, 0xfa, 0xff, 0xe6, 0xff, 0xd3, 0xff, 
-0xca, 0xff, 0xc9, 0xff, 0xd4, 0xff, 0xe7, 0xff, 0xfd, 0xff, 0x12, 0x00, 0x1f, 0x00, 0x20, 0x00, 
-0x20, 0x00, 0x24, 0x00, 0x25, 0x00, 0x1c, 0x00, 0x11, 0x00, 0xff, 0xff, 0xea, 0xff, 0xd7, 0xff, 
-0xcb, 0xff, 0xc9, 0xff, 0xce, 0xff, 0xde, 0xff, 0xf7, 0xff, 0x0f, 0x00, 0x24, 0x00, 0x39, 0x00, 
-0x3f, 0x00, 0x3d, 0x00, 0x34, 0x00, 0x20, 0x00, 0x02, 0x00, 0xe1, 0xff, 0xc6, 0xff, 0xb4, 0xff, 
-0xaf, 0xff, 0xb8, 0xff, 0xd2, 0xff, 0xf0, 0xff, 0x13, 0x00, 0x33, 0x00, 0x49, 0x00, 0x51, 0x00, 
-0x4a, 0x00, 0x3a, 0x00, 0x1f, 0x00, 0xfa, 0xff, 0xdb, 0xff, 0xca, 0xff, 0xba, 0xff, 0xb7, 0xff, 
-0xc3, 0xff, 0xd5, 0xff, 0xed, 0xff, 0x11, 0x00, 0x32, 0x00, 0x46, 0x00, 0x49, 0x00, 0x3b, 0x00, 
-0x1f, 0x00, 0x06, 0x00, 0xf2, 0xff, 0xda, 0xff, 0xcb, 0xff, 0xca, 0xff, 0xd0, 0xff, 0xdd, 0xff, 
-0xef, 0xff, 0x03, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x27, 0x00, 0x22, 0x00, 0x17, 0x00, 
-0x09, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xe8, 0xff, 0xe6, 0xff, 
-0xea, 0xff, 0xee, 0xff, 0xf6, 0xff, 0x04, 0x00, 0x14, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x34, 0x00, 
-0x2b, 0x00, 0x15, 0x00, 0xf5, 0xff, 0xd7, 0xff, 0xc7, 0xff, 0xc0, 0xff, 0xc4, 0xff, 0xd1, 0xff, 
-0xe4, 0xff, 0xfc, 0xff, 0x16, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x47, 0x00, 0x3f, 0x00, 0x27, 0x00, 
-0x05, 0x00, 0xea, 0xff, 0xd8, 0xff, 0xce, 0xff, 0xcb, 0xff, 0xd2, 0xff, 0xe2, 0xff, 0xfa, 0xff, 
-0x15, 0x00, 0x28, 0x00, 0x30, 0x00, 0x2c, 0x00, 0x1b, 0x00, 0x0a, 0x00, 0xfd, 0xff, 0xec, 0xff, 
-0xd7, 0xff, 0xca, 0xff, 0xcd, 0xff, 0xd9, 0xff, 0xec, 0xff, 0x05, 0x00, 0x18, 0x00, 0x28, 0x00, 
-0x31, 0x00, 0x30, 0x00, 0x23, 0x00, 0x15, 0x00, 0x0b, 0x00, 0x02, 0x00, 0xfd, 0xff, 0xf7, 0xff, 
-0xed, 0xff, 0xe0, 0xff, 0xd7, 0xff, 0xd6, 0xff, 0xd8, 0xff, 0xe1, 0xff, 0xf2, 0xff, 0x06, 0x00, 
-0x18, 0x00, 0x26, 0x00, 0x30, 0x00, 0x35, 0x00, 0x31, 0x00, 0x22, 0x00, 0x0f, 0x00, 0xf2, 0xff, 
-0xd7, 0xff, 0xc9, 0xff, 0xc6, 0xff, 0xcd, 0xff, 0xd7, 0xff, 0xec, 0xff, 0x0b, 0x00, 0x2b, 0x00, 
-0x3e, 0x00, 0x41, 0x00, 0x35, 0x00, 0x1b, 0x00, 0xfd, 0xff, 0xe5, 0xff, 0xd9, 0xff, 0xd1, 0xff, 
-0xd2, 0xff, 0xde, 0xff, 0xf0, 0xff, 0x05, 0x00, 0x16, 0x00, 0x23, 0x00, 0x30, 0x00, 0x32, 0x00, 
-0x25, 0x00, 0x14, 0x00, 0x00, 0x00, 0xec, 0xff, 0xd9, 0xff, 0xcc, 0xff, 0xc8, 0xff, 0xce, 0xff, 
-0xdf, 0xff, 0xee, 0xff, 0xf8, 0xff, 0x06, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x31, 0x00, 
-0x32, 0x00, 0x2a, 0x00, 0x1b, 0x00, 0x0c, 0x00, 0xfd, 0xff, 0xee, 0xff, 0xe0, 0xff, 0xd4, 0xff, 
-0xd1, 0xff, 0xdb, 0xff, 0xea, 0xff, 0xf5, 0xff, 0x04, 0x00, 0x16, 0x00, 0x23, 0x00, 0x23, 0x00, 
-0x1d, 0x00, 0x14, 0x00, 0x04, 0x00, 0xf1, 0xff, 0xe3, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xec, 0xff, 
-0xfc, 0xff, 0x09, 0x00, 0x0f, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x10, 0x00, 0x00, 0x00, 
-0xf7, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xef, 0xff, 0xf4, 0xff, 0xf9, 0xff, 
-0x03, 0x00, 0x0c, 0x00, 0x12, 0x00, 0x16, 0x00, 0x15, 0x00, 0x13, 0x00, 0x10, 0x00, 0x0b, 0x00, 
-0x04, 0x00, 0xf8, 0xff, 0xe8, 0xff, 0xe0, 0xff, 0xda, 0xff, 0xd5, 0xff, 0xd8, 0xff, 0xe3, 0xff, 
-0xf7, 0xff, 0x12, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x48, 0x00, 0x40, 0x00, 0x2b, 0x00, 0x17, 0x00, 
-0x03, 0x00, 0xe9, 0xff, 0xd2, 0xff, 0xbf, 0xff, 0xb6, 0xff, 0xb9, 0xff, 0xce, 0xff, 0xed, 0xff, 
-0x0b, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x34, 0x00, 0x20, 0x00, 0x08, 0x00, 0xf4, 0xff, 
-0xee, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xfc, 0xff, 0x01, 0x00, 0x01, 0x00, 0xfd, 0xff, 0xfd, 0xff, 
-0x02, 0x00, 0xfe, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0xee, 0xff, 0xfd, 0xff, 0x0c, 0x00, 
-0x17, 0x00, 0x1b, 0x00, 0x18, 0x00, 0x0f, 0x00, 0x06, 0x00, 0xff, 0xff, 0xf7, 0xff, 0xf8, 0xff, 
-0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xe1, 0xff, 
-0xd4, 0xff, 0xcd, 0xff, 0xc9, 0xff, 0xcc, 0xff, 0xd8, 0xff, 0xf2, 0xff, 0x15, 0x00, 0x35, 0x00, 
-0x4d, 0x00, 0x56, 0x00, 0x50, 0x00, 0x3e, 0x00, 0x23, 0x00, 0x09, 0x00, 0xee, 0xff, 0xd2, 0xff, 
-0xbf, 0xff, 0xbd, 0xff, 0xc4, 0xff, 0xd3, 0xff, 0xe5, 0xff, 0xf9, 0xff, 0x0e, 0x00, 0x1a, 0x00, 
-0x20, 0x00, 0x22, 0x00, 0x20, 0x00, 0x16, 0x00, 0x09, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xf9, 0xff, 
-0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xec, 0xff, 
-0xe9, 0xff, 0xf1, 0xff, 0x00, 0x00, 0x0e, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x15, 0x00, 
-0x0c, 0x00, 0x09, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xef, 0xff, 0xfa, 0xff, 
-0x04, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0a, 0x00, 0xfd, 0xff, 0xea, 0xff, 0xd7, 0xff, 
-0xcf, 0xff, 0xd9, 0xff, 0xf2, 0xff, 0x0c, 0x00, 0x22, 0x00, 0x34, 0x00, 0x39, 0x00, 0x33, 0x00, 
-0x25, 0x00, 0x18, 0x00, 0x07, 0x00, 0xf0, 0xff, 0xd9, 0xff, 0xca, 0xff, 0xc8, 0xff, 0xcc, 0xff, 
-0xda, 0xff, 0xf0, 0xff, 0x05, 0x00, 0x16, 0x00, 0x20, 0x00, 0x23, 0x00, 0x1d, 0x00, 0x0d, 0x00, 
-0xff, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x05, 0x00, 0xff, 0xff, 
-0xfc, 0xff, 0xf9, 0xff, 0xf0, 0xff, 0xe7, 0xff, 0xe3, 0xff, 0xe0, 0xff, 0xe8, 0xff, 0xf8, 0xff, 
-0x09, 0x00, 0x18, 0x00, 0x26, 0x00, 0x2f, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x0e, 0x00, 0xf8, 0xff, 
-0xe9, 0xff, 0xe2, 0xff, 0xe2, 0xff, 0xf0, 0xff, 0x03, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0x05, 0x00, 
-0xfd, 0xff, 0xf6, 0xff, 0xea, 0xff, 0xda, 0xff, 0xcf, 0xff, 0xd0, 0xff, 0xdb, 0xff, 0xf1, 0xff, 
-0x0a, 0x00, 0x22, 0x00, 0x38, 0x00, 0x48, 0x00, 0x49, 0x00, 0x40, 0x00, 0x2a, 0x00, 0x0a, 0x00, 
-0xe9, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd3, 0xff, 0xdb, 0xff, 0xe5, 0xff, 0xf1, 0xff, 0xfd, 0xff, 
-0x05, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x03, 0x00, 0x08, 0x00, 
-0x0b, 0x00, 0x0f, 0x00, 0x11, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x09, 0x00, 0x00, 0x00, 0xef, 0xff, 
-0xdd, 0xff, 0xd5, 0xff, 0xda, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0x0f, 0x00, 0x1c, 0x00, 0x1c, 0x00, 
-0x17, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xf2, 0xff, 0xf1, 0xff, 0xf2, 0xff, 
-0xf5, 0xff, 0xfe, 0xff, 0x08, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x15, 0x00, 0x0d, 0x00, 0xff, 0xff, 
-0xec, 0xff, 0xdd, 0xff, 0xd7, 0xff, 0xdc, 0xff, 0xea, 0xff, 0xfb, 0xff, 0x0d, 0x00, 0x1e, 0x00, 
-0x29, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x28, 0x00, 0x1e, 0x00, 0x09, 0x00, 0xf5, 0xff, 0xe3, 0xff, 
-0xd5, 0xff, 0xce, 0xff, 0xd0, 0xff, 0xdb, 0xff, 0xeb, 0xff, 0xfd, 0xff, 0x0a, 0x00, 0x0f, 0x00, 
-0x0f, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x18, 0x00, 0x0e, 0x00, 
-0x03, 0x00, 0xfb, 0xff, 0xf1, 0xff, 0xe4, 0xff, 0xd9, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xe1, 0xff, 
-0xef, 0xff, 0x05, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x3e, 0x00, 0x36, 0x00, 0x1f, 0x00, 
-0x06, 0x00, 0xef, 0xff, 0xde, 0xff, 0xd8, 0xff, 0xdc, 0xff, 0xea, 0xff, 0xf7, 0xff, 0xfd, 0xff, 
-0x02, 0x00, 0x08, 0x00, 0x07, 0x00, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe1, 0xff, 0xe2, 0xff, 
-0xe9, 0xff, 0xf6, 0xff, 0x04, 0x00, 0x13, 0x00, 0x20, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x2e, 0x00, 
-0x21, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xf3, 0xff, 0xec, 0xff, 0xe7, 0xff, 0xe3, 0xff, 0xde, 0xff, 
-0xdb, 0xff, 0xdf, 0xff, 0xe5, 0xff, 0xec, 0xff, 0xf3, 0xff, 0xfe, 0xff, 0x0e, 0x00, 0x1c, 0x00, 
-0x27, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x13, 0x00, 0x02, 0x00, 0xf1, 0xff, 
-0xda, 0xff, 0xc3, 0xff, 0xb8, 0xff, 0xbf, 0xff, 0xd7, 0xff, 0xf4, 0xff, 0x11, 0x00, 0x29, 0x00, 
-0x35, 0x00, 0x35, 0x00, 0x2e, 0x00, 0x1f, 0x00, 0x05, 0x00, 0xef, 0xff, 0xe3, 0xff, 0xdf, 0xff, 
-0xdf, 0xff, 0xe6, 0xff, 0xf7, 0xff, 0x0e, 0x00, 0x1c, 0x00, 0x24, 0x00, 0x1f, 0x00, 0x10, 0x00, 
-0xf9, 0xff, 0xe2, 0xff, 0xd3, 0xff, 0xcf, 0xff, 0xd7, 0xff, 0xe9, 0xff, 0x00, 0x00, 0x15, 0x00, 
-0x22, 0x00, 0x26, 0x00, 0x28, 0x00, 0x26, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x0d, 0x00, 0x03, 0x00, 
-0xf8, 0xff, 0xef, 0xff, 0xe6, 0xff, 0xdd, 0xff, 0xd8, 0xff, 0xda, 0xff, 0xdf, 0xff, 0xe2, 0xff, 
-0xe7, 0xff, 0xef, 0xff, 0xf9, 0xff, 0x0b, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x3e, 0x00, 0x42, 0x00, 
-0x39, 0x00, 0x26, 0x00, 0x10, 0x00, 0xf6, 0xff, 0xdd, 0xff, 0xcd, 0xff, 0xc6, 0xff, 0xc6, 0xff, 
-0xcc, 0xff, 0xdb, 0xff, 0xee, 0xff, 0x05, 0x00, 0x1a, 0x00, 0x28, 0x00, 0x2d, 0x00, 0x2b, 0x00, 
-0x1f, 0x00, 0x0d, 0x00, 0xfc, 0xff, 0xee, 0xff, 0xeb, 0xff, 0xed, 0xff, 0xf4, 0xff, 0x01, 0x00, 
-0x0f, 0x00, 0x18, 0x00, 0x1b, 0x00, 0x15, 0x00, 0x05, 0x00, 0xf3, 0xff, 0xe2, 0xff, 0xd6, 0xff, 
-0xd0, 0xff, 0xcf, 0xff, 0xd8, 0xff, 0xe9, 0xff, 0xfc, 0xff, 0x12, 0x00, 0x24, 0x00, 0x30, 0x00, 
-0x38, 0x00, 0x34, 0x00, 0x2c, 0x00, 0x1f, 0x00, 0x10, 0x00, 0x03, 0x00, 0xfa, 0xff, 0xef, 0xff, 
-0xe1, 0xff, 0xd4, 0xff, 0xca, 0xff, 0xc9, 0xff, 0xcb, 0xff, 0xd6, 0xff, 0xe3, 0xff, 0xf4, 0xff, 
-0x10, 0x00, 0x2c, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x46, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x19, 0x00, 
-0xff, 0xff, 0xe4, 0xff, 0xce, 0xff, 0xc0, 0xff, 0xbe, 0xff, 0xc5, 0xff, 0xd8, 0xff, 0xef, 0xff, 
-0x08, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x07, 0x00, 0xfe, 0xff, 
-0xf8, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0x03, 0x00, 0x09, 0x00, 0x14, 0x00, 0x1d, 0x00, 
-0x1a, 0x00, 0x0e, 0x00, 0xff, 0xff, 0xf3, 0xff, 0xef, 0xff, 0xe6, 0xff, 0xdf, 0xff, 0xe0, 0xff, 
-0xe2, 0xff, 0xe6, 0xff, 0xee, 0xff, 0xfb, 0xff, 0x0b, 0x00, 0x18, 0x00, 0x25, 0x00, 0x32, 0x00, 
-0x38, 0x00, 0x36, 0x00, 0x2b, 0x00, 0x1a, 0x00, 0x07, 0x00, 0xef, 0xff, 0xda, 0xff, 0xca, 0xff, 
-0xbd, 0xff, 0xb9, 0xff, 0xbf, 0xff, 0xd0, 0xff, 0xe9, 0xff, 0x05, 0x00, 0x1d, 0x00, 0x36, 0x00, 
-0x48, 0x00, 0x46, 0x00, 0x39, 0x00, 0x26, 0x00, 0x0d, 0x00, 0xf4, 0xff, 0xe3, 0xff, 0xdb, 0xff, 
-0xd8, 0xff, 0xda, 0xff, 0xe2, 0xff, 0xeb, 0xff, 0xf7, 0xff, 0x09, 0x00, 0x15, 0x00, 0x1a, 0x00, 
-0x17, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x02, 0x00, 0xfa, 0xff, 0xf1, 0xff, 0xeb, 0xff, 0xec, 0xff, 
-0xf6, 0xff, 0x03, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x16, 0x00, 0x15, 0x00, 
-0x10, 0x00, 0x05, 0x00, 0xf4, 0xff, 0xe5, 0xff, 0xda, 0xff, 0xd4, 0xff, 0xd1, 0xff, 0xd9, 0xff, 
-0xea, 0xff, 0xfd, 0xff, 0x0d, 0x00, 0x23, 0x00, 0x36, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x37, 0x00, 
-0x29, 0x00, 0x13, 0x00, 0xf5, 0xff, 0xd7, 0xff, 0xbe, 0xff, 0xaf, 0xff, 0xb0, 0xff, 0xbf, 0xff, 
-0xd9, 0xff, 0xf9, 0xff, 0x13, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x32, 0x00, 
-0x20, 0x00, 0x0d, 0x00, 0xfb, 0xff, 0xec, 0xff, 0xde, 0xff, 0xd6, 0xff, 0xd7, 0xff, 0xde, 0xff, 
-0xea, 0xff, 0xf7, 0xff, 0x02, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x10, 0x00, 
-0x0e, 0x00, 0x0e, 0x00, 0x07, 0x00, 0xfc, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf4, 0xff, 
-0xff, 0xff, 0x0b, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x20, 0x00, 0x13, 0x00, 0x02, 0x00, 0xf2, 0xff, 
-0xe5, 0xff, 0xdb, 0xff, 0xd3, 0xff, 0xd0, 0xff, 0xd4, 0xff, 0xe3, 0xff, 0xf8, 0xff, 0x0c, 0x00, 
-0x23, 0x00, 0x3b, 0x00, 0x46, 0x00, 0x45, 0x00, 0x39, 0x00, 0x25, 0x00, 0x09, 0x00, 0xeb, 0xff, 
-0xd3, 0xff, 0xc5, 0xff, 0xc1, 0xff, 0xc3, 0xff, 0xcb, 0xff, 0xda, 0xff, 0xed, 0xff, 0x02, 0x00, 
-0x16, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x37, 0x00, 0x2e, 0x00, 0x1f, 0x00, 0x11, 0x00, 0x03, 0x00, 
-0xf5, 0xff, 0xea, 0xff, 0xe6, 0xff, 0xea, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 
-0xf9, 0xff, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01, 0x00, 0xfd, 0xff, 0xf8, 0xff, 
-0xfb, 0xff, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x13, 0x00, 
-0x13, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xea, 0xff, 0xdc, 0xff, 0xce, 0xff, 
-0xc9, 0xff, 0xd1, 0xff, 0xe1, 0xff, 0xf8, 0xff, 0x11, 0x00, 0x28, 0x00, 0x3b, 0x00, 0x45, 0x00, 
-0x46, 0x00, 0x3b, 0x00, 0x27, 0x00, 0x0f, 0x00, 0xf1, 0xff, 0xd6, 0xff, 0xc2, 0xff, 0xb8, 0xff, 
-0xb9, 0xff, 0xc3, 0xff, 0xd9, 0xff, 0xf5, 0xff, 0x12, 0x00, 0x27, 0x00, 0x31, 0x00, 0x35, 0x00, 
-0x31, 0x00, 0x26, 0x00, 0x17, 0x00, 0x07, 0x00, 0xfb, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xeb, 0xff, 
-0xed, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xfb, 0xff, 
-0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0xff, 0xff, 
-0xff, 0xff, 0x03, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x26, 0x00, 0x28, 0x00, 0x1e, 0x00, 
-0x0c, 0x00, 0xf5, 0xff, 0xe0, 0xff, 0xcc, 0xff, 0xbd, 0xff, 0xb8, 0xff, 0xbf, 0xff, 0xd3, 0xff, 
-0xf0, 0xff, 0x10, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x55, 0x00, 0x58, 0x00, 0x48, 0x00, 0x2b, 0x00, 
-0x0a, 0x00, 0xe9, 0xff, 0xcb, 0xff, 0xbc, 0xff, 0xbd, 0xff, 0xc5, 0xff, 0xd4, 0xff, 0xe7, 0xff, 
-0xf7, 0xff, 0x08, 0x00, 0x17, 0x00, 0x24, 0x00, 0x27, 0x00, 0x22, 0x00, 0x1a, 0x00, 0x10, 0x00, 
-0x05, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xf7, 0xff, 
-0xef, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xed, 0xff, 0xfa, 0xff, 0x07, 0x00, 0x11, 0x00, 0x14, 0x00, 
-0x13, 0x00, 0x11, 0x00, 0x0a, 0x00, 0xfd, 0xff, 0xf3, 0xff, 0xed, 0xff, 0xec, 0xff, 0xf2, 0xff, 
-0xfd, 0xff, 0x0c, 0x00, 0x1e, 0x00, 0x2b, 0x00, 0x2e, 0x00, 0x26, 0x00, 0x13, 0x00, 0xf8, 0xff, 
-0xda, 0xff, 0xc0, 0xff, 0xb4, 0xff, 0xb5, 0xff, 0xc6, 0xff, 0xe2, 0xff, 0x06, 0x00, 0x26, 0x00, 
-0x40, 0x00, 0x52, 0x00, 0x54, 0x00, 0x47, 0x00, 0x2e, 0x00, 0x0d, 0x00, 0xe8, 0xff, 0xc9, 0xff, 
-0xb8, 0xff, 0xb3, 0xff, 0xbf, 0xff, 0xd7, 0xff, 0xf0, 0xff, 0x08, 0x00, 0x1c, 0x00, 0x26, 0x00, 
-0x27, 0x00, 0x24, 0x00, 0x1d, 0x00, 0x15, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x02, 0x00, 0xfb, 0xff, 
-0xf9, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf1, 0xff, 0xef, 0xff, 0xec, 0xff, 0xe6, 0xff, 0xe5, 0xff, 
-0xec, 0xff, 0xf7, 0xff, 0x07, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x17, 0x00, 0x0b, 0x00, 
-0x00, 0x00, 0xf5, 0xff, 0xee, 0xff, 0xf1, 0xff, 0xfa, 0xff, 0x07, 0x00, 0x16, 0x00, 0x1f, 0x00, 
-0x1f, 0x00, 0x18, 0x00, 0x08, 0x00, 0xf6, 0xff, 0xe4, 0xff, 0xd1, 0xff, 0xc3, 0xff, 0xbe, 0xff, 
-0xc7, 0xff, 0xdd, 0xff, 0xfc, 0xff, 0x1a, 0x00, 0x35, 0x00, 0x49, 0x00, 0x52, 0x00, 0x4b, 0x00, 
-0x3b, 0x00, 0x22, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xcb, 0xff, 0xc6, 0xff, 0xca, 0xff, 0xd0, 0xff, 
-0xd8, 0xff, 0xe4, 0xff, 0xf1, 0xff, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x1c, 0x00, 0x1c, 0x00, 
-0x1d, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x15, 0x00, 0x0a, 0x00, 0xfd, 0xff, 0xee, 0xff, 
-0xde, 0xff, 0xd2, 0xff, 0xca, 0xff, 0xcc, 0xff, 0xda, 0xff, 0xf1, 0xff, 0x0d, 0x00, 0x23, 0x00, 
-0x2e, 0x00, 0x2c, 0x00, 0x25, 0x00, 0x1a, 0x00, 0x0b, 0x00, 0xfc, 0xff, 0xee, 0xff, 0xe5, 0xff, 
-0xe4, 0xff, 0xec, 0xff, 0xfd, 0xff, 0x0f, 0x00, 0x1e, 0x00, 0x27, 0x00, 0x24, 0x00, 0x17, 0x00, 
-0x02, 0x00, 0xe8, 0xff, 0xcd, 0xff, 0xba, 0xff, 0xb7, 0xff, 0xc5, 0xff, 0xde, 0xff, 0xff, 0xff, 
-0x1d, 0x00, 0x35, 0x00, 0x41, 0x00, 0x44, 0x00, 0x3e, 0x00, 0x30, 0x00, 0x19, 0x00, 0x01, 0x00, 
-0xeb, 0xff, 0xdc, 0xff, 0xd8, 0xff, 0xd9, 0xff, 0xde, 0xff, 0xe6, 0xff, 0xf0, 0xff, 0xf7, 0xff, 
-0xfb, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x05, 0x00, 0x12, 0x00, 0x20, 0x00, 0x2a, 0x00, 
-0x2b, 0x00, 0x24, 0x00, 0x1a, 0x00, 0x09, 0x00, 0xf7, 0xff, 0xe7, 0xff, 0xd7, 0xff, 0xcb, 0xff, 
-0xca, 0xff, 0xd5, 0xff, 0xe7, 0xff, 0xfb, 0xff, 0x11, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x2e, 0x00, 
-0x24, 0x00, 0x13, 0x00, 0xfb, 0xff, 0xe7, 0xff, 0xdf, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0x02, 0x00, 
-0x12, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x1f, 0x00, 0x11, 0x00, 0xfd, 0xff, 0xe8, 0xff, 0xd5, 0xff, 
-0xc8, 0xff, 0xc5, 0xff, 0xd0, 0xff, 0xe5, 0xff, 0xf9, 0xff, 0x12, 0x00, 0x2e, 0x00, 0x3f, 0x00, 
-0x44, 0x00, 0x3c, 0x00, 0x2c, 0x00, 0x18, 0x00, 0x01, 0x00, 0xed, 0xff, 0xe3, 0xff, 0xe1, 0xff, 
-0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xe8, 0xff, 0xea, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xf7, 0xff, 
-0xfd, 0xff, 0x08, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x26, 0x00, 0x29, 0x00, 0x27, 0x00, 0x23, 0x00, 
-0x1a, 0x00, 0x08, 0x00, 0xf1, 0xff, 0xda, 0xff, 0xc8, 0xff, 0xc6, 0xff, 0xcf, 0xff, 0xdf, 0xff, 
-0xf4, 0xff, 0x0b, 0x00, 0x1e, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x21, 0x00, 0x13, 0x00, 0x04, 0x00, 
-0xf3, 0xff, 0xe5, 0xff, 0xe3, 0xff, 0xeb, 0xff, 0xf6, 0xff, 0x04, 0x00, 0x14, 0x00, 0x22, 0x00, 
-0x27, 0x00, 0x21, 0x00, 0x10, 0x00, 0xf7, 0xff, 0xdf, 0xff, 0xcd, 0xff, 0xc6, 0xff, 0xcb, 0xff, 
-0xdb, 0xff, 0xf1, 0xff, 0x09, 0x00, 0x20, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x38, 0x00, 0x2c, 0x00, 
-0x19, 0x00, 0x03, 0x00, 0xf1, 0xff, 0xe4, 0xff, 0xdd, 0xff, 0xde, 0xff, 0xe6, 0xff, 0xf1, 0xff, 
-0xf5, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0x0b, 0x00, 
-0x19, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x25, 0x00, 0x19, 0x00, 0x05, 0x00, 0xf0, 0xff, 
-0xda, 0xff, 0xcb, 0xff, 0xc7, 0xff, 0xcf, 0xff, 0xe0, 0xff, 0xf5, 0xff, 0x0c, 0x00, 0x23, 0x00, 
-0x31, 0x00, 0x33, 0x00, 0x27, 0x00, 0x13, 0x00, 0xfb, 0xff, 0xe7, 0xff, 0xda, 0xff, 0xda, 0xff, 
-0xe1, 0xff, 0xf0, 0xff, 0x05, 0x00, 0x17, 0x00, 0x23, 0x00, 0x27, 0x00, 0x20, 0x00, 0x0d, 0x00, 
-0xf9, 0xff, 0xe5, 0xff, 0xd7, 0xff, 0xd2, 0xff, 0xd4, 0xff, 0xe0, 0xff, 0xf4, 0xff, 0x0c, 0x00, 
-0x22, 0x00, 0x30, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x1c, 0x00, 0x0b, 0x00, 0xfe, 0xff, 0xf5, 0xff, 
-0xef, 0xff, 0xee, 0xff, 0xef, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xec, 0xff, 0xe7, 0xff, 
-0xe4, 0xff, 0xe5, 0xff, 0xec, 0xff, 0xf8, 0xff, 0x0b, 0x00, 0x1d, 0x00, 0x2d, 0x00, 0x38, 0x00, 
-0x3c, 0x00, 0x37, 0x00, 0x23, 0x00, 0x06, 0x00, 0xe7, 0xff, 0xcd, 0xff, 0xba, 0xff, 0xb9, 0xff, 
-0xc4, 0xff, 0xdc, 0xff, 0xf9, 0xff, 0x13, 0x00, 0x27, 0x00, 0x33, 0x00, 0x35, 0x00, 0x2b, 0x00, 
-0x17, 0x00, 0x01, 0x00, 0xed, 0xff, 0xdf, 0xff, 0xdc, 0xff, 0xe2, 0xff, 0xf0, 0xff, 0x03, 0x00, 
-0x15, 0x00, 0x22, 0x00, 0x25, 0x00, 0x1b, 0x00, 0x0a, 0x00, 0xf5, 0xff, 0xe4, 0xff, 0xd8, 0xff, 
-0xd3, 0xff, 0xda, 0xff, 0xe7, 0xff, 0xfa, 0xff, 0x0c, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x25, 0x00, 
-0x1d, 0x00, 0x10, 0x00, 0x05, 0x00, 0xfc, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xfe, 0xff, 
-0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xe9, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xe0, 0xff, 
-0xee, 0xff, 0x03, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x31, 0x00, 0x22, 0x00, 
-0x09, 0x00, 0xeb, 0xff, 0xcf, 0xff, 0xc0, 0xff, 0xbe, 0xff, 0xc9, 0xff, 0xde, 0xff, 0xf8, 0xff, 
-0x12, 0x00, 0x28, 0x00, 0x35, 0x00, 0x35, 0x00, 0x28, 0x00, 0x15, 0x00, 0xff, 0xff, 0xea, 0xff, 
-0xde, 0xff, 0xdc, 0xff, 0xe3, 0xff, 0xef, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x16, 0x00, 0x18, 0x00, 
-0x13, 0x00, 0x07, 0x00, 0xfb, 0xff, 0xf0, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0xec, 0xff, 0xf5, 0xff, 
-0x02, 0x00, 0x10, 0x00, 0x18, 0x00, 0x1a, 0x00, 0x17, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xf6, 0xff, 
-0xf5, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x06, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x09, 0x00, 0xfd, 0xff, 
-0xef, 0xff, 0xe0, 0xff, 0xd5, 0xff, 0xd4, 0xff, 0xdd, 0xff, 0xed, 0xff, 0x03, 0x00, 0x1b, 0x00, 
-0x2f, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x35, 0x00, 0x23, 0x00, 0x08, 0x00, 0xed, 0xff, 0xd5, 0xff, 
-0xc2, 0xff, 0xc0, 0xff, 0xc9, 0xff, 0xdb, 0xff, 0xf4, 0xff, 0x0e, 0x00, 0x22, 0x00, 0x2c, 0x00, 
-0x2b, 0x00, 0x20, 0x00, 0x10, 0x00, 0x04, 0x00, 0xf7, 0xff, 0xed, 0xff, 0xe9, 0xff, 0xea, 0xff, 
-0xf1, 0xff, 0xfd, 0xff, 0x0a, 0x00, 0x13, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x05, 0x00, 0xfc, 0xff, 
-0xf1, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0x00, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0d, 0x00, 
-0x07, 0x00, 0x02, 0x00, 0xfd, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0x00, 0x00, 0x08, 0x00, 
-0x11, 0x00, 0x16, 0x00, 0x15, 0x00, 0x0b, 0x00, 0xfe, 0xff, 0xf1, 0xff, 0xe2, 0xff, 0xd7, 0xff, 
-0xd2, 0xff, 0xd8, 0xff, 0xe9, 0xff, 0xfe, 0xff, 0x14, 0x00, 0x29, 0x00, 0x37, 0x00, 0x39, 0x00, 
-0x30, 0x00, 0x1e, 0x00, 0x06, 0x00, 0xec, 0xff, 0xd9, 0xff, 0xce, 0xff, 0xcd, 0xff, 0xd7, 0xff, 
-0xe9, 0xff, 0x00, 0x00, 0x16, 0x00, 0x25, 0x00, 0x2a, 0x00, 0x24, 0x00, 0x15, 0x00, 0x06, 0x00, 
-0xf8, 0xff, 0xeb, 0xff, 0xe7, 0xff, 0xe9, 0xff, 0xf1, 0xff, 0xf9, 0xff, 0x02, 0x00, 0x0b, 0x00, 
-0x0f, 0x00, 0x0d, 0x00, 0x06, 0x00, 0xfd, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xfb, 0xff, 
-0x01, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x08, 0x00, 0xff, 0xff, 0xf5, 0xff, 
-0xef, 0xff, 0xee, 0xff, 0xf3, 0xff, 0xfc, 0xff, 0x06, 0x00, 0x12, 0x00, 0x19, 0x00, 0x19, 0x00, 
-0x11, 0x00, 0xff, 0xff, 0xed, 0xff, 0xe1, 0xff, 0xda, 0xff, 0xd9, 0xff, 0xe0, 0xff, 0xef, 0xff, 
-0x06, 0x00, 0x1b, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x33, 0x00, 0x28, 0x00, 0x11, 0x00, 0xfb, 0xff, 
-0xe7, 0xff, 0xd9, 0xff, 0xd6, 0xff, 0xd7, 0xff, 0xe2, 0xff, 0xf6, 0xff, 0x0a, 0x00, 0x15, 0x00, 
-0x19, 0x00, 0x15, 0x00, 0x0f, 0x00, 0x05, 0x00, 0xfb, 0xff, 0xf6, 0xff, 0xf4, 0xff, 0xf5, 0xff, 
-0xf8, 0xff, 0xff, 0xff, 0x06, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x0b, 0x00, 0x07, 0x00, 0xfe, 0xff, 
-0xf7, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0x06, 0x00, 0x0d, 0x00, 0x0f, 0x00, 
-0x0a, 0x00, 0x01, 0x00, 0xf4, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x04, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 
-0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 
-0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-};
-
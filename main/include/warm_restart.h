@@ -0,0 +1,51 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _WARM_RESTART_H_
+#define _WARM_RESTART_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define WARM_RESTART_MAGIC      0x57524D31  // "WRM1", bump when warm_timer_t changes
+#define WARM_RESTART_SAVE_MS    100         // a running timer is saved again this often
+#define WARM_RESTART_DELAY_MS   200         // POST /api/restore: lets the response out first
+
+// The running timer as kept in RTC slow memory across a reset
+typedef struct {
+    uint8_t active;
+    uint8_t countdown;
+    uint8_t paused;
+    uint8_t use_end_color;
+    uint8_t primary[3];
+    uint8_t segment[3];
+    uint8_t end[3];
+    uint8_t segments;
+    uint32_t total_s;
+    uint32_t elapsed_ms;        // running time at the save, pauses excluded
+    char name[32];
+} warm_timer_t;
+
+// Call first in app_main. True when a timer saved before a reset other than
+// power-on (panic, watchdog, brownout, esp_restart) passes its checksum;
+// `out` gets it with elapsed_ms moved on by the time the reset took.
+bool warm_restart_restore(warm_timer_t *out);
+
+// Keep the timer in RTC memory: a copy and a CRC under a spinlock. Call on
+// every change and every WARM_RESTART_SAVE_MS while a timer runs.
+void warm_restart_save(const warm_timer_t *timer);
+
+// The restored timer is on the ring; ends the reset-to-pixels measurement
+void warm_restart_painted(void);
+
+// GET /api/restore, POST /api/restore {"restart": "soft"}; "panic" as well
+// with CONFIG_WARM_RESTART_TEST_PANIC
+esp_err_t warm_restart_register_http(httpd_handle_t server);
+
+#endif
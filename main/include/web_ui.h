@@ -0,0 +1,36 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _WEB_UI_H_
+#define _WEB_UI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// Browsers keep the page but check its ETag on every load; a 304 is a few
+// hundred bytes instead of the whole UI
+#define WEB_CACHE_CONTROL       "no-cache"
+
+// One file from web/, generated into web_assets.c by tools/mkwebui.py
+typedef struct {
+    const char *uri;
+    const char *type;
+    const uint8_t *gz;          // gzip stream
+    uint32_t gz_len;
+    uint32_t raw_len;           // before compression
+    const char *etag;           // quoted, strong
+} web_asset_t;
+
+extern const web_asset_t web_assets[];
+extern const size_t web_asset_count;
+
+// One GET handler per asset
+esp_err_t web_ui_register_http(httpd_handle_t server);
+
+#endif
@@ -0,0 +1,36 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#ifndef _WIFI_MANAGER_H_
+#define _WIFI_MANAGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define WIFI_BACKOFF_FIRST_MS   200     // after the immediate retry
+#define WIFI_BACKOFF_MAX_MS     30000
+#define WIFI_FAST_FAILS_MAX     2       // cached channel/BSSID misses before alternating with full scans
+#define WIFI_INACTIVE_S         3       // missed beacons for this long count as a disconnect
+#define WIFI_STATUS_LOG_MS      30000
+#define WIFI_NVS_NS             "wifi"
+
+// Bring up netif and the station and start connecting, on the cached
+// channel and BSSID when there is one. Returns without waiting; from here on
+// the manager reconnects by itself with exponential backoff, forever.
+esp_err_t wifi_manager_start(const char *ssid, const char *password);
+
+// Wait for the first connection. ESP_ERR_TIMEOUT leaves the manager retrying.
+esp_err_t wifi_manager_wait_connected(uint32_t timeout_ms);
+
+bool wifi_manager_connected(void);
+
+// GET /api/wifi
+esp_err_t wifi_manager_register_http(httpd_handle_t server);
+
+#endif
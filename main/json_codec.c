@@ -0,0 +1,681 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Schema-driven JSON codec for the REST handlers, with no heap use.
+//
+// cJSON_Parse builds a tree of malloc'd nodes only for the handler to look
+// up a handful of known keys and free it again, and cJSON_Print mallocs the
+// response text. Here the parser walks the body once and writes each known
+// key straight into a typed request struct described by a json_field_t
+// table (type, offset, size, range); unknown keys are skipped, wrong types
+// and out-of-range numbers are errors with the byte offset. Responses are
+// written into a caller-owned buffer, normally on the handler's stack.
+//
+// Limits: keys are matched byte for byte (escaped keys never match),
+// integers only for JSON_INT (a fraction is truncated like cJSON's
+// valueint, an exponent is a type error), and nesting is capped at
+// JSON_MAX_DEPTH. Everything but the httpd helpers at the bottom is plain
+// C, so tools/json_bench.c builds this file on the host.
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "json_codec.h"
+
+typedef struct {
+    const char *start;
+    const char *p;
+    const char *end;
+    json_error_t *error;
+} json_parser_t;
+
+static json_err_t json_fail(json_parser_t *ps, json_err_t err, const char *key)
+{
+    if (ps->error) {
+        ps->error->err = err;
+        ps->error->pos = ps->p - ps->start;
+        ps->error->key = key;
+    }
+    return err;
+}
+
+static void json_skip_ws(json_parser_t *ps)
+{
+    while (ps->p < ps->end && (*ps->p == ' ' || *ps->p == '\t' || *ps->p == '\n' || *ps->p == '\r')) {
+        ps->p++;
+    }
+}
+
+static bool json_literal(json_parser_t *ps, const char *word)
+{
+    size_t n = strlen(word);
+    if ((size_t)(ps->end - ps->p) < n || memcmp(ps->p, word, n) != 0) {
+        return false;
+    }
+    ps->p += n;
+    return true;
+}
+
+static int json_hex4(const char *p)
+{
+    int v = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        v <<= 4;
+        if (c >= '0' && c <= '9') {
+            v |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            v |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            v |= c - 'A' + 10;
+        } else {
+            return -1;
+        }
+    }
+    return v;
+}
+
+// Decode the string at p (on its opening quote) into dst, or just skip it
+// when dst is NULL
+static json_err_t json_string(json_parser_t *ps, char *dst, size_t size, const char *key)
+{
+    size_t n = 0;
+    ps->p++;
+    while (ps->p < ps->end) {
+        char out[4];
+        size_t k = 1;
+        unsigned char c = *ps->p++;
+        if (c == '"') {
+            if (dst) {
+                dst[n] = '\0';
+            }
+            return JSON_OK;
+        }
+        if (c < 0x20) {
+            return json_fail(ps, JSON_ERR_SYNTAX, key);
+        }
+        out[0] = c;
+        if (c == '\\') {
+            if (ps->p >= ps->end) {
+                break;
+            }
+            char e = *ps->p++;
+            switch (e) {
+            case '"': case '\\': case '/': out[0] = e; break;
+            case 'b': out[0] = '\b'; break;
+            case 'f': out[0] = '\f'; break;
+            case 'n': out[0] = '\n'; break;
+            case 'r': out[0] = '\r'; break;
+            case 't': out[0] = '\t'; break;
+            case 'u': {
+                int cp = ps->end - ps->p >= 4 ? json_hex4(ps->p) : -1;
+                if (cp < 0) {
+                    return json_fail(ps, JSON_ERR_SYNTAX, key);
+                }
+                ps->p += 4;
+                if (cp >= 0xd800 && cp < 0xdc00 && ps->end - ps->p >= 6 && ps->p[0] == '\\' && ps->p[1] == 'u') {
+                    int low = json_hex4(ps->p + 2);
+                    if (low >= 0xdc00 && low < 0xe000) {
+                        cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                        ps->p += 6;
+                    }
+                }
+                if (cp < 0x80) {
+                    out[0] = cp;
+                } else if (cp < 0x800) {
+                    out[0] = 0xc0 | cp >> 6;
+                    out[1] = 0x80 | (cp & 0x3f);
+                    k = 2;
+                } else if (cp < 0x10000) {
+                    out[0] = 0xe0 | cp >> 12;
+                    out[1] = 0x80 | (cp >> 6 & 0x3f);
+                    out[2] = 0x80 | (cp & 0x3f);
+                    k = 3;
+                } else {
+                    out[0] = 0xf0 | cp >> 18;
+                    out[1] = 0x80 | (cp >> 12 & 0x3f);
+                    out[2] = 0x80 | (cp >> 6 & 0x3f);
+                    out[3] = 0x80 | (cp & 0x3f);
+                    k = 4;
+                }
+                break;
+            }
+            default:
+                return json_fail(ps, JSON_ERR_SYNTAX, key);
+            }
+        }
+        if (dst) {
+            if (n + k >= size) {
+                return json_fail(ps, JSON_ERR_TOO_LONG, key);
+            }
+            memcpy(dst + n, out, k);
+        }
+        n += k;
+    }
+    return json_fail(ps, JSON_ERR_SYNTAX, key);
+}
+
+// Scan a number; *value is its integer part, saturated
+static json_err_t json_number(json_parser_t *ps, int64_t *value, bool *integer, const char *key)
+{
+    bool negative = false;
+    int64_t v = 0;
+    *integer = true;
+    if (ps->p < ps->end && *ps->p == '-') {
+        negative = true;
+        ps->p++;
+    }
+    if (ps->p >= ps->end || *ps->p < '0' || *ps->p > '9') {
+        return json_fail(ps, JSON_ERR_SYNTAX, key);
+    }
+    if (*ps->p == '0') {
+        ps->p++;
+    } else {
+        while (ps->p < ps->end && *ps->p >= '0' && *ps->p <= '9') {
+            if (v < INT64_C(1000000000000)) {
+                v = v * 10 + (*ps->p - '0');
+            }
+            ps->p++;
+        }
+    }
+    if (ps->p < ps->end && *ps->p == '.') {
+        ps->p++;
+        if (ps->p >= ps->end || *ps->p < '0' || *ps->p > '9') {
+            return json_fail(ps, JSON_ERR_SYNTAX, key);
+        }
+        while (ps->p < ps->end && *ps->p >= '0' && *ps->p <= '9') {
+            ps->p++;
+        }
+    }
+    if (ps->p < ps->end && (*ps->p == 'e' || *ps->p == 'E')) {
+        *integer = false;
+        ps->p++;
+        if (ps->p < ps->end && (*ps->p == '+' || *ps->p == '-')) {
+            ps->p++;
+        }
+        if (ps->p >= ps->end || *ps->p < '0' || *ps->p > '9') {
+            return json_fail(ps, JSON_ERR_SYNTAX, key);
+        }
+        while (ps->p < ps->end && *ps->p >= '0' && *ps->p <= '9') {
+            ps->p++;
+        }
+    }
+    *value = negative ? -v : v;
+    return JSON_OK;
+}
+
+static json_err_t json_skip_value(json_parser_t *ps, int depth);
+
+static json_err_t json_skip_container(json_parser_t *ps, int depth, char close)
+{
+    if (depth > JSON_MAX_DEPTH) {
+        return json_fail(ps, JSON_ERR_DEPTH, NULL);
+    }
+    ps->p++;
+    json_skip_ws(ps);
+    if (ps->p < ps->end && *ps->p == close) {
+        ps->p++;
+        return JSON_OK;
+    }
+    while (ps->p < ps->end) {
+        json_err_t err;
+        if (close == '}') {
+            if (*ps->p != '"') {
+                break;
+            }
+            if ((err = json_string(ps, NULL, 0, NULL)) != JSON_OK) {
+                return err;
+            }
+            json_skip_ws(ps);
+            if (ps->p >= ps->end || *ps->p++ != ':') {
+                break;
+            }
+            json_skip_ws(ps);
+        }
+        if ((err = json_skip_value(ps, depth)) != JSON_OK) {
+            return err;
+        }
+        json_skip_ws(ps);
+        if (ps->p >= ps->end) {
+            break;
+        }
+        char c = *ps->p++;
+        if (c == close) {
+            return JSON_OK;
+        }
+        if (c != ',') {
+            ps->p--;
+            break;
+        }
+        json_skip_ws(ps);
+    }
+    return json_fail(ps, JSON_ERR_SYNTAX, NULL);
+}
+
+static json_err_t json_skip_value(json_parser_t *ps, int depth)
+{
+    int64_t v;
+    bool integer;
+    if (ps->p >= ps->end) {
+        return json_fail(ps, JSON_ERR_SYNTAX, NULL);
+    }
+    switch (*ps->p) {
+    case '{':
+        return json_skip_container(ps, depth + 1, '}');
+    case '[':
+        return json_skip_container(ps, depth + 1, ']');
+    case '"':
+        return json_string(ps, NULL, 0, NULL);
+    case 't':
+    case 'f':
+    case 'n':
+        if (json_literal(ps, "true") || json_literal(ps, "false") || json_literal(ps, "null")) {
+            return JSON_OK;
+        }
+        return json_fail(ps, JSON_ERR_SYNTAX, NULL);
+    default:
+        return json_number(ps, &v, &integer, NULL);
+    }
+}
+
+static json_err_t json_object(json_parser_t *ps, const json_field_t *schema, size_t count,
+                              uint8_t *base, int depth);
+
+static json_err_t json_field(json_parser_t *ps, const json_field_t *f, uint8_t *base, int depth)
+{
+    uint8_t *member = base + f->offset;
+    json_err_t err;
+
+    // null leaves the member as it was, like a missing key
+    if (json_literal(ps, "null")) {
+        return JSON_OK;
+    }
+    switch (f->type) {
+    case JSON_INT: {
+        int64_t v;
+        bool integer;
+        if (ps->p >= ps->end || (*ps->p != '-' && (*ps->p < '0' || *ps->p > '9'))) {
+            return json_fail(ps, JSON_ERR_TYPE, f->key);
+        }
+        const char *at = ps->p;
+        if ((err = json_number(ps, &v, &integer, f->key)) != JSON_OK) {
+            return err;
+        }
+        if (!integer) {
+            ps->p = at;
+            return json_fail(ps, JSON_ERR_TYPE, f->key);
+        }
+        if (v < f->min || v > f->max) {
+            ps->p = at;
+            return json_fail(ps, JSON_ERR_RANGE, f->key);
+        }
+        if (f->size == 1) {
+            uint8_t x = (uint8_t)v;
+            memcpy(member, &x, 1);
+        } else if (f->size == 2) {
+            uint16_t x = (uint16_t)v;
+            memcpy(member, &x, 2);
+        } else {
+            uint32_t x = (uint32_t)v;
+            memcpy(member, &x, 4);
+        }
+        return JSON_OK;
+    }
+    case JSON_BOOL: {
+        bool b;
+        if (json_literal(ps, "true")) {
+            b = true;
+        } else if (json_literal(ps, "false")) {
+            b = false;
+        } else {
+            return json_fail(ps, JSON_ERR_TYPE, f->key);
+        }
+        memcpy(member, &b, sizeof(b));
+        return JSON_OK;
+    }
+    case JSON_STRING:
+        if (ps->p >= ps->end || *ps->p != '"') {
+            return json_fail(ps, JSON_ERR_TYPE, f->key);
+        }
+        return json_string(ps, (char *)member, f->size, f->key);
+    case JSON_OBJECT:
+        if (ps->p >= ps->end || *ps->p != '{') {
+            return json_fail(ps, JSON_ERR_TYPE, f->key);
+        }
+        return json_object(ps, f->fields, f->field_count, member, depth + 1);
+    }
+    return json_fail(ps, JSON_ERR_TYPE, f->key);
+}
+
+static json_err_t json_object(json_parser_t *ps, const json_field_t *schema, size_t count,
+                              uint8_t *base, int depth)
+{
+    if (depth > JSON_MAX_DEPTH) {
+        return json_fail(ps, JSON_ERR_DEPTH, NULL);
+    }
+    json_skip_ws(ps);
+    if (ps->p >= ps->end || *ps->p != '{') {
+        return json_fail(ps, JSON_ERR_SYNTAX, NULL);
+    }
+    ps->p++;
+    json_skip_ws(ps);
+    if (ps->p < ps->end && *ps->p == '}') {
+        ps->p++;
+        return JSON_OK;
+    }
+    while (ps->p < ps->end && *ps->p == '"') {
+        json_err_t err;
+        const char *key = ps->p + 1;
+        if ((err = json_string(ps, NULL, 0, NULL)) != JSON_OK) {
+            return err;
+        }
+        size_t key_len = ps->p - 1 - key;
+        json_skip_ws(ps);
+        if (ps->p >= ps->end || *ps->p != ':') {
+            break;
+        }
+        ps->p++;
+        json_skip_ws(ps);
+
+        const json_field_t *f = NULL;
+        for (size_t i = 0; i < count; i++) {
+            if (strncmp(schema[i].key, key, key_len) == 0 && schema[i].key[key_len] == '\0') {
+                f = &schema[i];
+                break;
+            }
+        }
+        err = f ? json_field(ps, f, base, depth) : json_skip_value(ps, depth);
+        if (err != JSON_OK) {
+            return err;
+        }
+
+        json_skip_ws(ps);
+        if (ps->p < ps->end && *ps->p == '}') {
+            ps->p++;
+            return JSON_OK;
+        }
+        if (ps->p >= ps->end || *ps->p != ',') {
+            break;
+        }
+        ps->p++;
+        json_skip_ws(ps);
+    }
+    return json_fail(ps, JSON_ERR_SYNTAX, NULL);
+}
+
+json_err_t json_parse(const char *json, size_t len, const json_field_t *schema, size_t field_count,
+                      void *out, json_error_t *error)
+{
+    json_parser_t ps = { .start = json, .p = json, .end = json + len, .error = error };
+    if (error) {
+        error->err = JSON_OK;
+        error->pos = 0;
+        error->key = NULL;
+    }
+    json_err_t err = json_object(&ps, schema, field_count, out, 0);
+    if (err != JSON_OK) {
+        return err;
+    }
+    json_skip_ws(&ps);
+    if (ps.p != ps.end) {
+        return json_fail(&ps, JSON_ERR_SYNTAX, NULL);
+    }
+    return JSON_OK;
+}
+
+const char *json_err_to_name(json_err_t err)
+{
+    switch (err) {
+    case JSON_OK: return "ok";
+    case JSON_ERR_SYNTAX: return "syntax error";
+    case JSON_ERR_TYPE: return "wrong type";
+    case JSON_ERR_RANGE: return "out of range";
+    case JSON_ERR_TOO_LONG: return "too long";
+    case JSON_ERR_DEPTH: return "nested too deep";
+    }
+    return "unknown";
+}
+
+static void json_put(json_writer_t *w, const char *s, size_t n)
+{
+    if (w->overflow) {
+        return;
+    }
+    if (w->len + n >= w->size) {
+        w->overflow = true;
+        return;
+    }
+    memcpy(w->buf + w->len, s, n);
+    w->len += n;
+    w->buf[w->len] = '\0';
+}
+
+static void json_put_string(json_writer_t *w, const char *s)
+{
+    static const char hex[] = "0123456789abcdef";
+    json_put(w, "\"", 1);
+    const char *run = s;
+    for (; *s; s++) {
+        unsigned char c = *s;
+        if (c != '"' && c != '\\' && c >= 0x20) {
+            continue;
+        }
+        json_put(w, run, s - run);
+        char esc[6] = { '\\', (char)c };
+        size_t n = 2;
+        switch (c) {
+        case '"': case '\\': break;
+        case '\n': esc[1] = 'n'; break;
+        case '\r': esc[1] = 'r'; break;
+        case '\t': esc[1] = 't'; break;
+        default:
+            memcpy(esc + 1, "u00", 3);
+            esc[4] = hex[c >> 4];
+            esc[5] = hex[c & 0xf];
+            n = 6;
+        }
+        json_put(w, esc, n);
+        run = s + 1;
+    }
+    json_put(w, run, s - run);
+    json_put(w, "\"", 1);
+}
+
+// Separator and key before a value
+static void json_put_key(json_writer_t *w, const char *key)
+{
+    if (w->depth == 0) {
+        return;
+    }
+    uint32_t bit = 1u << w->depth;
+    if (w->has_items & bit) {
+        json_put(w, ",", 1);
+    }
+    w->has_items |= bit;
+    if (!(w->in_array & bit)) {
+        json_put_string(w, key ? key : "");
+        json_put(w, ":", 1);
+    }
+}
+
+void json_writer_init(json_writer_t *w, char *buf, size_t size)
+{
+    memset(w, 0, sizeof(*w));
+    w->buf = buf;
+    w->size = size;
+    if (size > 0) {
+        buf[0] = '\0';
+    } else {
+        w->overflow = true;
+    }
+}
+
+static void json_open(json_writer_t *w, const char *key, const char *open, bool array)
+{
+    json_put_key(w, key);
+    json_put(w, open, 1);
+    if (w->depth + 1 >= JSON_WRITER_MAX_DEPTH) {
+        w->overflow = true;
+        return;
+    }
+    w->depth++;
+    uint32_t bit = 1u << w->depth;
+    w->has_items &= ~bit;
+    w->in_array = array ? (w->in_array | bit) : (w->in_array & ~bit);
+}
+
+static void json_close(json_writer_t *w, const char *close)
+{
+    if (w->depth == 0) {
+        w->overflow = true;
+        return;
+    }
+    w->depth--;
+    json_put(w, close, 1);
+}
+
+void json_write_object_begin(json_writer_t *w, const char *key)
+{
+    json_open(w, key, "{", false);
+}
+
+void json_write_object_end(json_writer_t *w)
+{
+    json_close(w, "}");
+}
+
+void json_write_array_begin(json_writer_t *w, const char *key)
+{
+    json_open(w, key, "[", true);
+}
+
+void json_write_array_end(json_writer_t *w)
+{
+    json_close(w, "]");
+}
+
+void json_write_int(json_writer_t *w, const char *key, int32_t value)
+{
+    char num[12];
+    json_put_key(w, key);
+    json_put(w, num, snprintf(num, sizeof(num), "%ld", (long)value));
+}
+
+void json_write_uint(json_writer_t *w, const char *key, uint32_t value)
+{
+    char num[12];
+    json_put_key(w, key);
+    json_put(w, num, snprintf(num, sizeof(num), "%lu", (unsigned long)value));
+}
+
+void json_write_float(json_writer_t *w, const char *key, float value, int decimals)
+{
+    char num[24];
+    json_put_key(w, key);
+    if (!isfinite(value)) {
+        json_put(w, "null", 4);
+        return;
+    }
+    int n = snprintf(num, sizeof(num), "%.*f", decimals, (double)value);
+    json_put(w, num, n < (int)sizeof(num) ? n : 0);
+    if (n >= (int)sizeof(num)) {
+        w->overflow = true;
+    }
+}
+
+void json_write_bool(json_writer_t *w, const char *key, bool value)
+{
+    json_put_key(w, key);
+    json_put(w, value ? "true" : "false", value ? 4 : 5);
+}
+
+void json_write_string(json_writer_t *w, const char *key, const char *value)
+{
+    json_put_key(w, key);
+    if (!value) {
+        json_put(w, "null", 4);
+        return;
+    }
+    json_put_string(w, value);
+}
+
+size_t json_writer_finish(json_writer_t *w)
+{
+    if (w->overflow || w->depth != 0) {
+        return 0;
+    }
+    return w->len;
+}
+
+#ifdef ESP_PLATFORM
+#include "esp_log.h"
+
+static const char *TAG = "JSON_CODEC";
+
+#define JSON_RECV_TIMEOUTS_MAX  3
+
+esp_err_t json_recv_body(httpd_req_t *req, char *buf, size_t size, size_t *len)
+{
+    if (req->content_len >= size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    size_t got = 0;
+    int timeouts = 0;
+    while (got < req->content_len) {
+        int ret = httpd_req_recv(req, buf + got, req->content_len - got);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts <= JSON_RECV_TIMEOUTS_MAX) {
+            continue;
+        }
+        if (ret <= 0) {
+            return ESP_FAIL;
+        }
+        got += ret;
+    }
+    buf[got] = '\0';
+    *len = got;
+    return ESP_OK;
+}
+
+esp_err_t json_recv_request(httpd_req_t *req, char *buf, size_t size,
+                            const json_field_t *schema, size_t field_count, void *out)
+{
+    size_t len = 0;
+    esp_err_t err = json_recv_body(req, buf, size, &len);
+    if (err == ESP_ERR_INVALID_SIZE) {
+        httpd_resp_set_status(req, "413 Content Too Large");
+        httpd_resp_sendstr(req, "{\"error\":\"body too large\"}");
+        return err;
+    }
+    if (err != ESP_OK) {
+        httpd_resp_send_500(req);
+        return err;
+    }
+
+    json_error_t error;
+    if (json_parse(buf, len, schema, field_count, out, &error) != JSON_OK) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "%s%s%s at byte %u", error.key ? error.key : "", error.key ? ": " : "",
+                 json_err_to_name(error.err), error.pos);
+        ESP_LOGW(TAG, "%s: %s", req->uri, msg);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, msg);
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+esp_err_t json_send(httpd_req_t *req, json_writer_t *w)
+{
+    size_t len = json_writer_finish(w);
+    if (len == 0) {
+        ESP_LOGE(TAG, "%s: response does not fit in %u bytes", req->uri, (unsigned)w->size);
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, w->buf, len);
+}
+#endif
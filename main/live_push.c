@@ -0,0 +1,536 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Live state push to the web UI over a WebSocket at /api/live.
+//
+// One task samples the device state every LIVE_SAMPLE_MS (sooner when an
+// event is queued) and sends each connected client a small JSON frame with
+// only the fields that changed since the last frame *that client* got, plus
+// any wake/command events. Bursts are coalesced: whatever happens inside
+// LIVE_MIN_INTERVAL_MS goes out in one frame.
+//
+// Producers never wait on the network. live_push_event() only writes into a
+// small ring under a spinlock and notifies the task, and the task hands each
+// frame to httpd_ws_send_data_async(), which sends it from the server task.
+// Each client has a single frame buffer: if its previous frame is still
+// being sent (slow or stalled client) the new frame is dropped rather than
+// queued. The client's last-sent state is left alone in that case, so the
+// next frame that does go out carries every field that changed meanwhile --
+// stale intermediate values are skipped, nothing current is lost. Events
+// are copied into a small queue per client and leave it only once they are
+// in a frame that client was sent; a client that stays busy for more than
+// LIVE_EVENT_QUEUE events loses the oldest ones (counted as dropped).
+//
+// The server's close_fn calls live_push_closed(), so a slot is free again
+// as soon as its socket goes, not only after a failed send.
+//
+// Frame, drop and fan-out timing counters are served at /api/live/stats.
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "live_push.h"
+
+static const char *TAG = "LIVE_PUSH";
+
+#if CONFIG_HTTPD_WS_SUPPORT
+
+typedef struct {
+    live_event_t type;
+    char detail[LIVE_DETAIL_LEN];
+} live_pending_t;
+
+typedef struct {
+    int fd;                     // -1 = free slot
+    uint32_t generation;        // bumped each time the slot is taken
+    volatile bool busy;         // a frame is handed to the server and not yet sent
+    bool synced;                // `last` is what the client has
+    live_state_t last;
+    uint32_t sent;
+    uint32_t dropped;
+    uint32_t events_dropped;
+    uint8_t event_head;         // events not yet sent to this client
+    uint8_t event_count;
+    live_pending_t events[LIVE_EVENT_QUEUE];
+    char buf[LIVE_FRAME_MAX];
+} live_client_t;
+
+static const char *s_event_names[LIVE_EVENT_COUNT] = {
+    [LIVE_EVENT_WAKE] = "wake",
+    [LIVE_EVENT_COMMAND] = "command",
+    [LIVE_EVENT_TIMEOUT] = "timeout",
+    [LIVE_EVENT_TIMER_DONE] = "timer_done",
+};
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static httpd_handle_t s_server = NULL;
+static TaskHandle_t s_task = NULL;
+static live_state_fn s_sample = NULL;
+static live_client_t s_clients[LIVE_MAX_CLIENTS];
+static live_pending_t s_events[LIVE_EVENT_QUEUE];
+static uint32_t s_event_head = 0;
+static uint32_t s_event_count = 0;
+static uint32_t s_seq = 0;
+
+static struct {
+    uint32_t frames;
+    uint32_t dropped;           // frames skipped because the client was still busy
+    uint32_t events;
+    uint32_t events_dropped;    // overwritten before the task, or a busy client, got to them
+    uint32_t connects;
+    uint32_t disconnects;
+    perf_counter_t build_cycles;    // one frame
+    perf_counter_t fanout_cycles;   // one round over all clients
+} s_stats;
+
+void live_push_event(live_event_t event, const char *detail)
+{
+    if (event >= LIVE_EVENT_COUNT) {
+        return;
+    }
+    portENTER_CRITICAL(&s_mux);
+    uint32_t slot = (s_event_head + s_event_count) % LIVE_EVENT_QUEUE;
+    if (s_event_count == LIVE_EVENT_QUEUE) {
+        s_event_head = (s_event_head + 1) % LIVE_EVENT_QUEUE;
+        s_stats.events_dropped++;
+    } else {
+        s_event_count++;
+    }
+    s_events[slot].type = event;
+    strncpy(s_events[slot].detail, detail ? detail : "", LIVE_DETAIL_LEN - 1);
+    s_events[slot].detail[LIVE_DETAIL_LEN - 1] = '\0';
+    s_stats.events++;
+    portEXIT_CRITICAL(&s_mux);
+
+    if (s_task) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+static void live_client_remove(live_client_t *c)
+{
+    portENTER_CRITICAL(&s_mux);
+    if (c->fd >= 0) {
+        c->fd = -1;
+        c->busy = false;
+        s_stats.disconnects++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void live_push_closed(int fd)
+{
+    for (int i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        if (s_clients[i].fd == fd) {
+            live_client_remove(&s_clients[i]);
+        }
+    }
+}
+
+// Task only: queue events for a client, dropping its oldest when full
+static void live_client_queue(live_client_t *c, const live_pending_t *events, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        if (c->event_count == LIVE_EVENT_QUEUE) {
+            c->event_head = (c->event_head + 1) % LIVE_EVENT_QUEUE;
+            c->event_count--;
+            c->events_dropped++;
+            s_stats.events_dropped++;
+        }
+        c->events[(c->event_head + c->event_count) % LIVE_EVENT_QUEUE] = events[i];
+        c->event_count++;
+    }
+}
+
+// What a send passes to live_send_done: the slot and the connection it held
+static void *live_send_token(const live_client_t *c)
+{
+    return (void *)(uintptr_t)(c->generation * LIVE_MAX_CLIENTS + (uint32_t)(c - s_clients));
+}
+
+// Called from the server task once the frame is on the socket (or failed).
+// The socket may have closed in between and the slot gone to another
+// connection, maybe on the same fd; such a late completion is ignored.
+static void live_send_done(esp_err_t err, int socket, void *arg)
+{
+    uintptr_t token = (uintptr_t)arg;
+    live_client_t *c = &s_clients[token % LIVE_MAX_CLIENTS];
+    portENTER_CRITICAL(&s_mux);
+    bool current = c->fd == socket && live_send_token(c) == arg;
+    if (current) {
+        if (err != ESP_OK) {
+            c->fd = -1;
+            s_stats.disconnects++;
+        }
+        c->busy = false;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (err != ESP_OK) {
+        ESP_LOGD(TAG, "Send to fd %d failed: %s%s", socket, esp_err_to_name(err), current ? "" : " (gone)");
+    }
+}
+
+// snprintf into buf at *pos; false once the frame is full
+static bool live_append(char *buf, size_t *pos, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+static bool live_append(char *buf, size_t *pos, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + *pos, LIVE_FRAME_MAX - *pos, fmt, args);
+    va_end(args);
+    if (n < 0 || *pos + n >= LIVE_FRAME_MAX) {
+        return false;
+    }
+    *pos += n;
+    return true;
+}
+
+static bool live_append_string(char *buf, size_t *pos, const char *s)
+{
+    if (!live_append(buf, pos, "\"")) {
+        return false;
+    }
+    for (; *s; s++) {
+        unsigned char ch = (unsigned char)*s;
+        bool ok;
+        if (ch == '"' || ch == '\\') {
+            ok = live_append(buf, pos, "\\%c", ch);
+        } else if (ch < 0x20) {
+            ok = live_append(buf, pos, "\\u%04x", ch);
+        } else {
+            ok = live_append(buf, pos, "%c", ch);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return live_append(buf, pos, "\"");
+}
+
+// Build the frame for one client into its buffer; 0 when there is nothing
+// to send. *events_added is how many of its queued events went in.
+static size_t live_build_frame(live_client_t *c, const live_state_t *now, uint32_t *events_added)
+{
+    const live_state_t *last = c->synced ? &c->last : NULL;
+    char *buf = c->buf;
+    size_t pos = 0;
+    bool fields = false;
+
+    live_append(buf, &pos, "{\"s\":%lu", (unsigned long)s_seq);
+    if (!last || last->active != now->active) {
+        fields |= live_append(buf, &pos, ",\"a\":%d", now->active);
+    }
+    if (!last || last->paused != now->paused) {
+        fields |= live_append(buf, &pos, ",\"p\":%d", now->paused);
+    }
+    if (!last || last->remaining_s != now->remaining_s) {
+        fields |= live_append(buf, &pos, ",\"r\":%ld", (long)now->remaining_s);
+    }
+    if (!last || last->total_s != now->total_s) {
+        fields |= live_append(buf, &pos, ",\"d\":%ld", (long)now->total_s);
+    }
+    if (!last || last->led_state != now->led_state) {
+        fields |= live_append(buf, &pos, ",\"l\":%u", now->led_state);
+    }
+    if (!last || strcmp(last->name, now->name) != 0) {
+        fields |= live_append(buf, &pos, ",\"n\":") && live_append_string(buf, &pos, now->name);
+    }
+    uint32_t added = 0;
+    if (c->event_count > 0 && pos + 8 < LIVE_FRAME_MAX) {
+        // As many events as fit, keeping room for the closing "]}"; the
+        // rest stay queued for the next frame
+        size_t mark = pos;
+        live_append(buf, &pos, ",\"e\":[");
+        for (uint32_t i = 0; i < c->event_count; i++) {
+            const live_pending_t *event = &c->events[(c->event_head + i) % LIVE_EVENT_QUEUE];
+            size_t event_start = pos;
+            bool ok = live_append(buf, &pos, "%s[\"%s\",", added ? "," : "", s_event_names[event->type]) &&
+                      live_append_string(buf, &pos, event->detail) &&
+                      live_append(buf, &pos, "]") &&
+                      pos + 2 < LIVE_FRAME_MAX;
+            if (!ok) {
+                pos = event_start;
+                break;
+            }
+            added++;
+        }
+        if (added > 0) {
+            live_append(buf, &pos, "]");
+            fields = true;
+        } else {
+            pos = mark;
+        }
+    }
+    *events_added = added;
+    if (!fields || !live_append(buf, &pos, "}")) {
+        *events_added = 0;
+        return 0;
+    }
+    return pos;
+}
+
+static void live_push_task(void *arg)
+{
+    int64_t last_round_us = 0;
+    live_pending_t events[LIVE_EVENT_QUEUE];
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LIVE_SAMPLE_MS));
+
+        // Rate limit: whatever arrives before the interval is up joins this frame
+        int64_t wait_us = last_round_us + LIVE_MIN_INTERVAL_MS * 1000LL - esp_timer_get_time();
+        if (wait_us > 0) {
+            vTaskDelay(pdMS_TO_TICKS((wait_us + 999) / 1000) + 1);
+        }
+        last_round_us = esp_timer_get_time();
+
+        live_state_t now;
+        memset(&now, 0, sizeof(now));
+        s_sample(&now);
+
+        portENTER_CRITICAL(&s_mux);
+        uint32_t event_count = s_event_count;
+        for (uint32_t i = 0; i < event_count; i++) {
+            events[i] = s_events[(s_event_head + i) % LIVE_EVENT_QUEUE];
+        }
+        s_event_head = 0;
+        s_event_count = 0;
+        portEXIT_CRITICAL(&s_mux);
+
+        uint32_t fanout_start = esp_cpu_get_cycle_count();
+        bool any = false;
+        s_seq++;
+        for (int i = 0; i < LIVE_MAX_CLIENTS; i++) {
+            live_client_t *c = &s_clients[i];
+            if (c->fd < 0) {
+                continue;
+            }
+            live_client_queue(c, events, event_count);
+            if (c->busy) {
+                // Previous frame still in flight: drop this one, the next
+                // frame is built against what the client actually has
+                c->dropped++;
+                s_stats.dropped++;
+                continue;
+            }
+            if (httpd_ws_get_fd_info(s_server, c->fd) != HTTPD_WS_CLIENT_WEBSOCKET) {
+                live_client_remove(c);
+                continue;
+            }
+
+            uint32_t start = esp_cpu_get_cycle_count();
+            uint32_t events_added = 0;
+            size_t len = live_build_frame(c, &now, &events_added);
+            perf_counter_add(&s_stats.build_cycles, esp_cpu_get_cycle_count() - start);
+            if (len == 0) {
+                continue;
+            }
+
+            httpd_ws_frame_t frame = {
+                .final = true,
+                .type = HTTPD_WS_TYPE_TEXT,
+                .payload = (uint8_t *)c->buf,
+                .len = len,
+            };
+            c->busy = true;
+            if (httpd_ws_send_data_async(s_server, c->fd, &frame, live_send_done, live_send_token(c)) != ESP_OK) {
+                live_client_remove(c);
+                continue;
+            }
+            c->last = now;
+            c->synced = true;
+            c->event_head = (c->event_head + events_added) % LIVE_EVENT_QUEUE;
+            c->event_count -= events_added;
+            c->sent++;
+            s_stats.frames++;
+            any = true;
+        }
+        if (any) {
+            perf_counter_add(&s_stats.fanout_cycles, esp_cpu_get_cycle_count() - fanout_start);
+        }
+    }
+}
+
+esp_err_t live_push_init(live_state_fn sample)
+{
+    if (!sample) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_task) {
+        return ESP_OK;
+    }
+    for (int i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        s_clients[i].fd = -1;
+    }
+    s_sample = sample;
+    if (xTaskCreatePinnedToCore(&live_push_task, "live_push", 3 * 1024, NULL, 2, &s_task, 0) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create live push task");
+        s_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t live_ws_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_GET) {
+        // Handshake done: take a slot, the first frame carries the full state.
+        // A slot still holding this fd belongs to a closed socket it was
+        // reused from, so it is taken over.
+        int fd = httpd_req_to_sockfd(req);
+        live_client_t *slot = NULL;
+        portENTER_CRITICAL(&s_mux);
+        for (int i = 0; i < LIVE_MAX_CLIENTS && !slot; i++) {
+            if (s_clients[i].fd == fd) {
+                slot = &s_clients[i];
+                s_stats.disconnects++;
+            }
+        }
+        for (int i = 0; i < LIVE_MAX_CLIENTS && !slot; i++) {
+            if (s_clients[i].fd < 0) {
+                slot = &s_clients[i];
+            }
+        }
+        if (slot) {
+            slot->fd = fd;
+            slot->generation++;
+            slot->busy = false;
+            slot->synced = false;
+            slot->sent = 0;
+            slot->dropped = 0;
+            slot->events_dropped = 0;
+            slot->event_head = 0;
+            slot->event_count = 0;
+            s_stats.connects++;
+        }
+        portEXIT_CRITICAL(&s_mux);
+        if (!slot) {
+            ESP_LOGW(TAG, "No free client slot for fd %d", fd);
+            return ESP_FAIL;    // closes the socket
+        }
+        ESP_LOGI(TAG, "Client connected on fd %d", fd);
+        if (s_task) {
+            xTaskNotifyGive(s_task);
+        }
+        return ESP_OK;
+    }
+
+    // The channel is one-way; read and discard whatever the client sends
+    httpd_ws_frame_t frame = { .type = HTTPD_WS_TYPE_TEXT };
+    esp_err_t ret = httpd_ws_recv_frame(req, &frame, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (frame.len > 0) {
+        uint8_t buf[32];
+        if (frame.len > sizeof(buf)) {
+            return ESP_FAIL;
+        }
+        frame.payload = buf;
+        return httpd_ws_recv_frame(req, &frame, sizeof(buf));
+    }
+    return ESP_OK;
+}
+
+static esp_err_t live_stats_handler(httpd_req_t *req)
+{
+    cJSON *response = cJSON_CreateObject();
+    cJSON *clients = cJSON_AddArrayToObject(response, "clients");
+    for (int i = 0; i < LIVE_MAX_CLIENTS; i++) {
+        if (s_clients[i].fd < 0) {
+            continue;
+        }
+        cJSON *client = cJSON_CreateObject();
+        cJSON_AddNumberToObject(client, "fd", s_clients[i].fd);
+        cJSON_AddNumberToObject(client, "sent", s_clients[i].sent);
+        cJSON_AddNumberToObject(client, "dropped", s_clients[i].dropped);
+        cJSON_AddNumberToObject(client, "events_queued", s_clients[i].event_count);
+        cJSON_AddNumberToObject(client, "events_dropped", s_clients[i].events_dropped);
+        cJSON_AddBoolToObject(client, "busy", s_clients[i].busy);
+        cJSON_AddItemToArray(clients, client);
+    }
+    cJSON_AddNumberToObject(response, "seq", s_seq);
+    cJSON_AddNumberToObject(response, "frames", s_stats.frames);
+    cJSON_AddNumberToObject(response, "dropped", s_stats.dropped);
+    cJSON_AddNumberToObject(response, "events", s_stats.events);
+    cJSON_AddNumberToObject(response, "events_dropped", s_stats.events_dropped);
+    cJSON_AddNumberToObject(response, "connects", s_stats.connects);
+    cJSON_AddNumberToObject(response, "disconnects", s_stats.disconnects);
+    cJSON_AddNumberToObject(response, "build_us_avg", perf_cycles_to_us(perf_counter_avg(&s_stats.build_cycles)));
+    cJSON_AddNumberToObject(response, "build_us_max", perf_cycles_to_us(s_stats.build_cycles.max));
+    cJSON_AddNumberToObject(response, "fanout_us_avg", perf_cycles_to_us(perf_counter_avg(&s_stats.fanout_cycles)));
+    cJSON_AddNumberToObject(response, "fanout_us_max", perf_cycles_to_us(s_stats.fanout_cycles.max));
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t live_push_register_http(httpd_handle_t server)
+{
+    s_server = server;
+
+    httpd_uri_t live_uri = {
+        .uri = "/api/live",
+        .method = HTTP_GET,
+        .handler = live_ws_handler,
+        .user_ctx = NULL,
+        .is_websocket = true
+    };
+    esp_err_t err = httpd_register_uri_handler(server, &live_uri);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    httpd_uri_t stats_uri = {
+        .uri = "/api/live/stats",
+        .method = HTTP_GET,
+        .handler = live_stats_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &stats_uri);
+}
+
+#else
+
+void live_push_event(live_event_t event, const char *detail)
+{
+    (void)event;
+    (void)detail;
+}
+
+void live_push_closed(int fd)
+{
+    (void)fd;
+}
+
+esp_err_t live_push_init(live_state_fn sample)
+{
+    (void)sample;
+    ESP_LOGW(TAG, "CONFIG_HTTPD_WS_SUPPORT is off, live updates disabled");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t live_push_register_http(httpd_handle_t server)
+{
+    (void)server;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif
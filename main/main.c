@@ -13,9 +13,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <unistd.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/event_groups.h"
+#include "freertos/semphr.h"
 
 // ESP-SR Speech Recognition
 #include "esp_wn_iface.h"
@@ -28,6 +30,29 @@
 #include "speech_commands_action.h"
 #include "model_path.h"
 #include "esp_process_sdkconfig.h"
+#include "afe_manager.h"
+#include "afe_profiles.h"
+#include "speech_bench.h"
+#include "model_manager.h"
+#include "audio_history.h"
+#include "prompt_pack.h"
+#include "tone_synth.h"
+#include "spectrum_viz.h"
+#include "doa.h"
+#include "boot_orchestrator.h"
+#include "wifi_manager.h"
+#include "web_ui.h"
+#include "live_push.h"
+#include "json_codec.h"
+#include "http_workers.h"
+#include "udp_control.h"
+#include "pixel_stream.h"
+#include "timer_sync.h"
+#include "settings_store.h"
+#include "session_log.h"
+#include "warm_restart.h"
+#include "audio_engine.h"
+#include "aec_reference.h"
 
 // Networking and Web Server
 #include "esp_wifi.h"
@@ -35,6 +60,8 @@
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "cJSON.h"
 
@@ -47,20 +74,21 @@
 // Configuration
 #define LED_STRIP_GPIO 8
 #define LED_RING_LEDS 85  // Changed from 1 to 86 for ring
+#define DOA_ARC_HALF_WIDTH 8  // LEDs each side of the talker while listening
 #define RMT_CHANNEL RMT_CHANNEL_0
 
 // WiFi Configuration
 #define WIFI_SSID ".Bird Fern Nest"
 #define WIFI_PASS "violinfriend230"
-#define WIFI_MAXIMUM_RETRY  5
+#define WIFI_BOOT_WAIT_MS   15000  // the boot log waits this long; reconnecting goes on regardless
+#define TIMER_MONITOR_STACK (4 * 1024)  // logging under the timer lock; see timer_monitor_task
+#define TIMER_MONITOR_PERIOD_MS 100     // fine enough to start each countdown beep on its second
 
 // HTTP Server Configuration
 #define CONFIG_WEB_MOUNT_POINT "/www"
 
 // Global Variables
 static const char *TAG = "VOICE_TIMER";
-static EventGroupHandle_t s_wifi_event_group;
-static int s_retry_num = 0;
 static httpd_handle_t server = NULL;
 
 // Speech Recognition Variables
@@ -68,10 +96,10 @@ int detect_flag = 0;
 static esp_afe_sr_iface_t *afe_handle = NULL;
 static volatile int task_flag = 0;
 srmodel_list_t *models = NULL;
-static int play_voice = -2;
 
 // LED Variables
 led_strip_t *strip = NULL;
+static SemaphoreHandle_t led_lock = NULL; // led_task and the spectrum task both refresh the strip
 static int led_state = 0; // 0=idle, 1=wake_detected, 2=listening, 3=command_detected, 4=timer_active
 
 // Forward declarations
@@ -109,24 +137,33 @@ typedef struct {
     char timerName[32];  // "workout", "laundry", etc.
 } TimerState;
 
-// Persistent settings structure for NVS storage
-typedef struct {
-    CRGB primaryColor;
-    CRGB segmentColor;
-    CRGB endColor;
-    int segments;
-    bool useEndColor;
-    uint8_t brightness;
-    char magic[8]; // "TIMER01" to validate settings
-} TimerSettings;
-
-// WiFi Event Bits
-#define WIFI_CONNECTED_BIT BIT0
-#define WIFI_FAIL_BIT      BIT1
-
 // Timer instance
 TimerState timer = {0};
 
+// Voice, the web workers, the UDP task and timer sync all change the timer.
+// Changes, including the colours a start goes with, are made holding this
+// lock; timer_sync takes it through its ops before its own lock, for
+// snapshots as well as applies. Recursive, since the control functions
+// below also run inside callers that hold it.
+static SemaphoreHandle_t timer_mutex = NULL;
+
+static void timer_lock(void)
+{
+    xSemaphoreTakeRecursive(timer_mutex, portMAX_DELAY);
+}
+
+static void timer_unlock(void)
+{
+    xSemaphoreGiveRecursive(timer_mutex);
+}
+
+// Timer times are on esp_timer rather than the 10 ms tick, so times shared
+// by timer_sync are not rounded to a tick
+static unsigned long timer_now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
 // FastLED-style LED array
 CRGB leds[LED_RING_LEDS];
 
@@ -211,426 +248,233 @@ static const SpeechCommand speech_commands[] = {
 
 #define NUM_SPEECH_COMMANDS (sizeof(speech_commands) / sizeof(speech_commands[0]))
 
-// WiFi event handler
-static void wifi_event_handler(void* arg, esp_event_base_t event_base,
-                               int32_t event_id, void* event_data)
+// Settings persistence: the store keeps them in RAM and writes them to NVS
+// once changes stop
+static void timer_settings_snapshot(timer_settings_t *out)
 {
-    if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
-        ESP_LOGI(TAG, "WiFi station started, connecting to %s...", WIFI_SSID);
-        esp_wifi_connect();
-    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
-        if (s_retry_num < WIFI_MAXIMUM_RETRY) {
-            esp_wifi_connect();
-            s_retry_num++;
-            ESP_LOGI(TAG, "WiFi connection failed, retrying... (%d/%d)", s_retry_num, WIFI_MAXIMUM_RETRY);
-        } else {
-            xEventGroupSetBits(s_wifi_event_group, WIFI_FAIL_BIT);
-            ESP_LOGE(TAG, "WiFi connection failed after %d attempts", WIFI_MAXIMUM_RETRY);
-        }
-    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
-        ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
-        ESP_LOGI(TAG, "WiFi connected! IP address: " IPSTR, IP2STR(&event->ip_info.ip));
-        s_retry_num = 0;
-        xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
-    }
+    memcpy(out->primary, &timer.primaryColor, 3);
+    memcpy(out->segment, &timer.segmentColor, 3);
+    memcpy(out->end, &timer.endColor, 3);
+    out->segments = timer.segments;
+    out->use_end_color = timer.useEndColor;
 }
 
-// Initialize WiFi
-void wifi_init_sta(void)
+static void timer_settings_apply(const timer_settings_t *settings)
 {
-    s_wifi_event_group = xEventGroupCreate();
-
-    ESP_ERROR_CHECK(esp_netif_init());
-    ESP_ERROR_CHECK(esp_event_loop_create_default());
-    esp_netif_create_default_wifi_sta();
-
-    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-    ESP_ERROR_CHECK(esp_wifi_init(&cfg));
-
-    esp_event_handler_instance_t instance_any_id;
-    esp_event_handler_instance_t instance_got_ip;
-    ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT,
-                                                        ESP_EVENT_ANY_ID,
-                                                        &wifi_event_handler,
-                                                        NULL,
-                                                        &instance_any_id));
-    ESP_ERROR_CHECK(esp_event_handler_instance_register(IP_EVENT,
-                                                        IP_EVENT_STA_GOT_IP,
-                                                        &wifi_event_handler,
-                                                        NULL,
-                                                        &instance_got_ip));
-
-    wifi_config_t wifi_config = {
-        .sta = {
-            .ssid = WIFI_SSID,
-            .password = WIFI_PASS,
-            .threshold.authmode = WIFI_AUTH_WPA2_PSK,
-            .pmf_cfg = {
-                .capable = true,
-                .required = false
-            },
-        },
+    memcpy(&timer.primaryColor, settings->primary, 3);
+    memcpy(&timer.segmentColor, settings->segment, 3);
+    memcpy(&timer.endColor, settings->end, 3);
+    timer.segments = settings->segments;
+    timer.useEndColor = settings->use_end_color;
+}
+
+void save_timer_settings(void) {
+    timer_settings_t settings;
+    settings_store_get(&settings);
+    timer_settings_snapshot(&settings);
+    settings_store_set(&settings);
+}
+
+void load_timer_settings(void) {
+    timer_settings_t settings = {
+        .brightness = 150, // Default brightness
     };
-    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
-    ESP_ERROR_CHECK(esp_wifi_start());
-
-    ESP_LOGI(TAG, "WiFi initialization finished");
-
-    /* Wait until either connection is established (WIFI_CONNECTED_BIT) or connection failed */
-    EventBits_t bits = xEventGroupWaitBits(s_wifi_event_group,
-            WIFI_CONNECTED_BIT | WIFI_FAIL_BIT,
-            pdFALSE,
-            pdFALSE,
-            portMAX_DELAY);
-
-    if (bits & WIFI_CONNECTED_BIT) {
-        ESP_LOGI(TAG, "Connected to WiFi SSID: %s", WIFI_SSID);
-    } else if (bits & WIFI_FAIL_BIT) {
-        ESP_LOGE(TAG, "Failed to connect to WiFi SSID: %s", WIFI_SSID);
-    } else {
-        ESP_LOGE(TAG, "Unexpected WiFi event");
-    }
+    timer_settings_snapshot(&settings);
+    settings_store_init(&settings);
+    settings_store_get(&settings);
+    timer_settings_apply(&settings);
 }
 
-// WiFi status monitoring task
-void wifi_status_task(void *arg) {
-    while (task_flag) {
-        wifi_ap_record_t ap_info;
-        esp_err_t ret = esp_wifi_sta_get_ap_info(&ap_info);
+// Warm restart: the timer is kept in RTC memory so it survives a reset and
+// can be repainted before anything else is up (see warm_restart.c)
+static bool warm_restored = false;
+static warm_timer_t warm_state;
 
-        if (ret == ESP_OK) {
-            ESP_LOGI(TAG, "WiFi Status: Connected to %s, RSSI: %d dBm, Channel: %d",
-                     ap_info.ssid, ap_info.rssi, ap_info.primary);
-        } else {
-            ESP_LOGW(TAG, "WiFi Status: Disconnected");
-        }
+static void timer_warm_save(void)
+{
+    warm_timer_t out = {0};
+    unsigned long now = timer.paused ? timer.pausedTimeMs : timer_now_ms();
+    // A finished timer in its end animation is not brought back
+    out.active = timer.active && !timer.endAnimationActive;
+    out.countdown = timer.isCountdown;
+    out.paused = timer.paused;
+    out.use_end_color = timer.useEndColor;
+    memcpy(out.primary, &timer.primaryColor, 3);
+    memcpy(out.segment, &timer.segmentColor, 3);
+    memcpy(out.end, &timer.endColor, 3);
+    out.segments = timer.segments;
+    out.total_s = timer.totalDurationSec;
+    out.elapsed_ms = out.active ? now - timer.startTimeMs : 0;
+    strncpy(out.name, timer.timerName, sizeof(out.name) - 1);
+    warm_restart_save(&out);
+}
 
-        vTaskDelay(pdMS_TO_TICKS(30000)); // Print status every 30 seconds
-    }
-    vTaskDelete(NULL);
+static void timer_warm_appearance(const warm_timer_t *state)
+{
+    memcpy(&timer.primaryColor, state->primary, 3);
+    memcpy(&timer.segmentColor, state->segment, 3);
+    memcpy(&timer.endColor, state->end, 3);
+    timer.segments = state->segments ? state->segments : 4;
+    timer.useEndColor = state->use_end_color;
 }
 
-// NVS Settings Management
-void save_timer_settings(void) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open("timer_settings", NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
-        return;
-    }
+// Timer control, shared by voice commands, the REST API and the UDP protocol.
+// Colours and segments are set by the caller before starting. Every change
+// goes out to the other rings through timer_sync.
+static void timer_control_start(const char *name, bool countdown, uint32_t seconds)
+{
+    timer_lock();
+    timer.active = true;
+    timer.isCountdown = countdown;
+    timer.paused = false;
+    timer.endAnimationActive = false;
+    timer.totalDurationSec = seconds;
+    timer.startTimeMs = timer_now_ms();
+    strncpy(timer.timerName, name, sizeof(timer.timerName) - 1);
+    timer.timerName[sizeof(timer.timerName) - 1] = '\0';
+    led_state = 4; // timer_active
+    session_log_begin(timer.timerName, countdown, seconds, false);
+    timer_warm_save();
+    timer_sync_publish();
+    timer_unlock();
+}
 
-    TimerSettings settings = {
-        .primaryColor = timer.primaryColor,
-        .segmentColor = timer.segmentColor,
-        .endColor = timer.endColor,
-        .segments = timer.segments,
-        .useEndColor = timer.useEndColor,
-        .brightness = 150, // Default brightness
-    };
-    strcpy(settings.magic, "TIMER01");
+static void timer_control_pause(void)
+{
+    timer_lock();
+    if (timer.active && !timer.paused) {
+        timer.paused = true;
+        timer.pausedTimeMs = timer_now_ms();
+        ESP_LOGI(TAG, "Timer paused");
+        session_log_pause();
+        timer_warm_save();
+        timer_sync_publish();
+    }
+    timer_unlock();
+}
 
-    err = nvs_set_blob(nvs_handle, "settings", &settings, sizeof(settings));
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error saving settings: %s", esp_err_to_name(err));
-    } else {
-        ESP_LOGI(TAG, "Timer settings saved to NVS");
-        err = nvs_commit(nvs_handle);
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Error committing NVS: %s", esp_err_to_name(err));
-        }
+static void timer_control_resume(void)
+{
+    timer_lock();
+    if (timer.active && timer.paused) {
+        // Adjust start time to account for pause duration
+        unsigned long pauseDuration = timer_now_ms() - timer.pausedTimeMs;
+        timer.startTimeMs += pauseDuration;
+        timer.paused = false;
+        ESP_LOGI(TAG, "Timer resumed");
+        session_log_resume();
+        timer_warm_save();
+        timer_sync_publish();
     }
+    timer_unlock();
+}
 
-    nvs_close(nvs_handle);
+static void timer_clear(void)
+{
+    timer.active = false;
+    timer.paused = false;
+    timer.endAnimationActive = false;
+    fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
+    FastLED_show();
+    led_state = 0; // back to idle
 }
 
-void load_timer_settings(void) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open("timer_settings", NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "No saved settings found, using defaults");
-        return;
-    }
+static void timer_control_stop(void)
+{
+    timer_lock();
+    timer_clear();
+    ESP_LOGI(TAG, "Timer stopped/cancelled");
+    session_log_end(SESSION_END_STOPPED);
+    timer_warm_save();
+    timer_sync_publish();
+    timer_unlock();
+}
 
-    TimerSettings settings;
-    size_t required_size = sizeof(settings);
-    err = nvs_get_blob(nvs_handle, "settings", &settings, &required_size);
-
-    if (err == ESP_OK && strcmp(settings.magic, "TIMER01") == 0) {
-        timer.primaryColor = settings.primaryColor;
-        timer.segmentColor = settings.segmentColor;
-        timer.endColor = settings.endColor;
-        timer.segments = settings.segments;
-        timer.useEndColor = settings.useEndColor;
-        ESP_LOGI(TAG, "Timer settings loaded from NVS");
-    } else {
-        ESP_LOGW(TAG, "Invalid or corrupted settings, using defaults");
+static void timer_control_add(uint32_t seconds)
+{
+    timer_lock();
+    if (timer.active) {
+        timer.totalDurationSec += seconds;
+        ESP_LOGI(TAG, "Added %lu seconds to timer", (unsigned long)seconds);
+        session_log_add(seconds);
+        timer_warm_save();
+        timer_sync_publish();
     }
+    timer_unlock();
+}
 
-    nvs_close(nvs_handle);
-}
-
-// Web Interface HTML (inspired by Chronos_mini)
-static const char index_html[] = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Voice LED Timer Ring</title>
-    <style>
-        :root{--bg-color:#1a1a1a;--card-color:#2b2b2b;--text-color:#f0f0f0;--primary-color:#007bff;--border-color:#444;--input-bg:#333;}
-        body{font-family:-apple-system,BlinkMacSystemFont,"Segoe UI",Roboto,Helvetica,Arial,sans-serif;background-color:var(--bg-color);color:var(--text-color);margin:0;padding:1rem;display:flex;justify-content:center;align-items:flex-start;min-height:100vh;}
-        .container{width:100%;max-width:500px;background-color:var(--card-color);border-radius:12px;padding:1.5rem;box-shadow:0 4px 20px rgba(0,0,0,0.25);}
-        header{text-align:center;margin-bottom:1.5rem;border-bottom:1px solid var(--border-color);padding-bottom:1rem;}
-        h1{margin:0;} #status{font-size:0.9rem;color:#888;margin-top:0.5rem;}
-        .control-group{margin-bottom:1.5rem;border:1px solid var(--border-color);border-radius:8px;padding:1rem;}
-        .control-group legend{padding:0 0.5rem;font-weight:bold;color:var(--primary-color);}
-        .form-row{display:flex;justify-content:space-between;align-items:center;margin-bottom:1rem;flex-wrap:wrap;}
-        label{flex-basis:40%;margin-bottom:0.5rem;}
-        input[type="number"],input[type="time"],input[type="color"],select{flex-basis:50%;padding:0.6rem;background-color:var(--input-bg);border:1px solid var(--border-color);color:var(--text-color);border-radius:6px;box-sizing:border-box;}
-        input[type="color"]{height:45px;padding:0.2rem;} .radio-group{display:flex;gap:1rem;}
-        button{width:100%;padding:0.8rem;font-size:1rem;font-weight:bold;border:none;border-radius:8px;cursor:pointer;transition:background-color 0.2s;margin-bottom:0.5rem;}
-        .btn-start{background-color:var(--primary-color);color:white;} .btn-start:hover{background-color:#0056b3;}
-        .btn-stop{background-color:#dc3545;color:white;} .btn-stop:hover{background-color:#c82333;}
-        .btn-pause{background-color:#ffc107;color:black;} .btn-pause:hover{background-color:#e0a800;}
-        .speech-commands{background-color:#28a745;color:white;font-size:0.9rem;padding:0.5rem;text-align:center;border-radius:6px;margin-top:1rem;}
-        @media (max-width:480px){.form-row{flex-direction:column;align-items:stretch;} label,input{flex-basis:100%;} label{margin-bottom:0.5rem;}}
-    </style>
-</head>
-<body>
-    <div class="container">
-        <header>
-            <h1>🎤 Voice LED Timer Ring</h1>
-            <div id="status">Ready for voice commands</div>
-        </header>
-        <main>
-            <div class="control-group">
-                <legend>Quick Timer</legend>
-                <div class="form-row">
-                    <label for="duration">Duration (minutes)</label>
-                    <input type="number" id="duration" value="5" min="1" max="360">
-                </div>
-                <div class="form-row">
-                    <div class="radio-group">
-                        <input type="radio" id="modeCountdown" name="mode" value="countdown" checked>
-                        <label for="modeCountdown">Countdown</label>
-                    </div>
-                    <div class="radio-group">
-                        <input type="radio" id="modeCountup" name="mode" value="countup">
-                        <label for="modeCountup">Count Up</label>
-                    </div>
-                </div>
-            </div>
-
-            <div class="control-group">
-                <legend>LED Appearance</legend>
-                <div class="form-row">
-                    <label for="primaryColor">Primary Color</label>
-                    <input type="color" id="primaryColor" value="#0066ff">
-                </div>
-                <div class="form-row">
-                    <label for="endColor">End Color</label>
-                    <input type="color" id="endColor" value="#ff0000">
-                </div>
-                <div class="form-row">
-                    <label for="segmentColor">Segment Color</label>
-                    <input type="color" id="segmentColor" value="#ffd700">
-                </div>
-                <div class="form-row">
-                    <label for="segments">Segments</label>
-                    <select id="segments">
-                        <option value="1">1 Segment</option>
-                        <option value="2">2 Segments</option>
-                        <option value="4" selected>4 Segments</option>
-                        <option value="6">6 Segments</option>
-                        <option value="8">8 Segments</option>
-                    </select>
-                </div>
-                <div class="form-row">
-                    <label for="useEndColor">Color Gradient</label>
-                    <input type="checkbox" id="useEndColor" checked>
-                </div>
-                <button onclick="saveSettings()" style="background-color:#17a2b8;color:white;">💾 Save Settings</button>
-            </div>
-
-            <button class="btn-start" onclick="startTimer()">▶️ Start Timer</button>
-            <button class="btn-pause" onclick="pauseTimer()">⏸️ Pause/Resume</button>
-            <button class="btn-stop" onclick="stopTimer()">⏹️ Stop Timer</button>
-
-            <div class="speech-commands">
-                🎙️ Say "Timer 5 minutes", "Pause", "Resume", "Stop", "Add 1 minute"<br>
-                Also try: "Workout timer", "Laundry timer", "Count up 10 minutes"
-            </div>
-        </main>
-    </div>
-
-    <script>
-        function hexToRgb(hex) {
-            const result = /^#?([a-f\d]{2})([a-f\d]{2})([a-f\d]{2})$/i.exec(hex);
-            return result ? {
-                r: parseInt(result[1], 16),
-                g: parseInt(result[2], 16),
-                b: parseInt(result[3], 16)
-            } : null;
-        }
-
-        function startTimer() {
-            const data = {
-                command: "start",
-                mode: document.querySelector('input[name="mode"]:checked').value,
-                duration: parseInt(document.getElementById('duration').value),
-                primaryColor: hexToRgb(document.getElementById('primaryColor').value),
-                endColor: hexToRgb(document.getElementById('endColor').value),
-                segmentColor: hexToRgb(document.getElementById('segmentColor').value),
-                segments: parseInt(document.getElementById('segments').value),
-                useEndColor: document.getElementById('useEndColor').checked
-            };
-
-            fetch('/api/timer', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify(data)
-            }).then(response => response.json())
-              .then(data => console.log('Timer started:', data));
-        }
+// HTTP Request Handlers
 
-        function pauseTimer() {
-            fetch('/api/pause', {method: 'POST'})
-                .then(response => response.json())
-                .then(data => console.log('Timer paused/resumed:', data));
-        }
+// Body of POST /api/timer and POST /api/settings, parsed by json_codec
+// straight into this struct (settings use the colour/segment keys only)
+typedef struct {
+    char command[12];
+    char mode[12];
+    int32_t duration;           // minutes
+    CRGB primaryColor;
+    CRGB endColor;
+    CRGB segmentColor;
+    int32_t segments;
+    bool useEndColor;
+} web_timer_request_t;
 
-        function stopTimer() {
-            fetch('/api/stop', {method: 'POST'})
-                .then(response => response.json())
-                .then(data => console.log('Timer stopped:', data));
-        }
+#define WEB_MAX_DURATION_MIN    1440
+#define WEB_MAX_SEGMENTS        12
 
-        function saveSettings() {
-            const data = {
-                primaryColor: hexToRgb(document.getElementById('primaryColor').value),
-                endColor: hexToRgb(document.getElementById('endColor').value),
-                segmentColor: hexToRgb(document.getElementById('segmentColor').value),
-                segments: parseInt(document.getElementById('segments').value),
-                useEndColor: document.getElementById('useEndColor').checked
-            };
-
-            fetch('/api/settings', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify(data)
-            }).then(response => response.json())
-              .then(data => {
-                  console.log('Settings saved:', data);
-                  document.getElementById('status').textContent = 'Settings saved to EEPROM!';
-                  setTimeout(() => {
-                      document.getElementById('status').textContent = 'Ready for voice commands';
-                  }, 3000);
-              });
-        }
+static const json_field_t color_schema[] = {
+    JSON_FIELD_INT(CRGB, r, "r", 0, 255),
+    JSON_FIELD_INT(CRGB, g, "g", 0, 255),
+    JSON_FIELD_INT(CRGB, b, "b", 0, 255),
+};
 
-        // Load settings on page load
-        fetch('/api/settings')
-            .then(response => response.json())
-            .then(data => {
-                if (data.primaryColor) {
-                    document.getElementById('primaryColor').value =
-                        '#' + ((1 << 24) + (data.primaryColor.r << 16) + (data.primaryColor.g << 8) + data.primaryColor.b).toString(16).slice(1);
-                }
-                if (data.endColor) {
-                    document.getElementById('endColor').value =
-                        '#' + ((1 << 24) + (data.endColor.r << 16) + (data.endColor.g << 8) + data.endColor.b).toString(16).slice(1);
-                }
-                if (data.segmentColor) {
-                    document.getElementById('segmentColor').value =
-                        '#' + ((1 << 24) + (data.segmentColor.r << 16) + (data.segmentColor.g << 8) + data.segmentColor.b).toString(16).slice(1);
-                }
-                if (data.segments) {
-                    document.getElementById('segments').value = data.segments;
-                }
-                if (data.useEndColor !== undefined) {
-                    document.getElementById('useEndColor').checked = data.useEndColor;
-                }
-            });
-    </script>
-</body>
-</html>
-)rawliteral";
+#define TIMER_APPEARANCE_FIELDS \
+    JSON_FIELD_OBJECT(web_timer_request_t, primaryColor, "primaryColor", color_schema), \
+    JSON_FIELD_OBJECT(web_timer_request_t, endColor, "endColor", color_schema), \
+    JSON_FIELD_OBJECT(web_timer_request_t, segmentColor, "segmentColor", color_schema), \
+    JSON_FIELD_INT(web_timer_request_t, segments, "segments", 1, WEB_MAX_SEGMENTS), \
+    JSON_FIELD_BOOL(web_timer_request_t, useEndColor, "useEndColor")
+
+static const json_field_t timer_schema[] = {
+    JSON_FIELD_STRING(web_timer_request_t, command, "command"),
+    JSON_FIELD_STRING(web_timer_request_t, mode, "mode"),
+    JSON_FIELD_INT(web_timer_request_t, duration, "duration", 1, WEB_MAX_DURATION_MIN),
+    TIMER_APPEARANCE_FIELDS,
+};
 
-// HTTP Request Handlers
-esp_err_t root_handler(httpd_req_t *req) {
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_send(req, index_html, strlen(index_html));
-    return ESP_OK;
-}
+static const json_field_t settings_schema[] = {
+    TIMER_APPEARANCE_FIELDS,
+};
 
 esp_err_t timer_api_handler(httpd_req_t *req) {
     if (req->method == HTTP_POST) {
         char buf[1024];
-        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
-        if (ret <= 0) {
-            httpd_resp_send_500(req);
-            return ESP_FAIL;
+        // Keys left out keep these values
+        web_timer_request_t body = {
+            .duration = 5,
+            .primaryColor = timer.primaryColor,
+            .endColor = timer.endColor,
+            .segmentColor = timer.segmentColor,
+            .segments = 4,
+            .useEndColor = true,
+        };
+        if (json_recv_request(req, buf, sizeof(buf), timer_schema,
+                              sizeof(timer_schema) / sizeof(timer_schema[0]), &body) != ESP_OK) {
+            return ESP_OK;
         }
-        buf[ret] = '\0';
-
-        cJSON *json = cJSON_Parse(buf);
-        if (json) {
-            cJSON *command = cJSON_GetObjectItem(json, "command");
-            if (command && strcmp(command->valuestring, "start") == 0) {
-                // Extract timer parameters from JSON
-                cJSON *mode = cJSON_GetObjectItem(json, "mode");
-                cJSON *duration = cJSON_GetObjectItem(json, "duration");
-                cJSON *primaryColor = cJSON_GetObjectItem(json, "primaryColor");
-                cJSON *endColor = cJSON_GetObjectItem(json, "endColor");
-                cJSON *segmentColor = cJSON_GetObjectItem(json, "segmentColor");
-                cJSON *segments = cJSON_GetObjectItem(json, "segments");
-                cJSON *useEndColor = cJSON_GetObjectItem(json, "useEndColor");
-
-                // Start timer with web parameters
-                timer.active = true;
-                timer.isCountdown = (mode && strcmp(mode->valuestring, "countdown") == 0);
-                timer.paused = false;
-                timer.totalDurationSec = duration ? duration->valueint * 60 : 300; // Default 5 min
-                timer.startTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
-
-                // Apply colors if provided
-                if (primaryColor) {
-                    cJSON *r = cJSON_GetObjectItem(primaryColor, "r");
-                    cJSON *g = cJSON_GetObjectItem(primaryColor, "g");
-                    cJSON *b = cJSON_GetObjectItem(primaryColor, "b");
-                    if (r && g && b) {
-                        timer.primaryColor = CRGB_create(r->valueint, g->valueint, b->valueint);
-                    }
-                }
-                if (endColor) {
-                    cJSON *r = cJSON_GetObjectItem(endColor, "r");
-                    cJSON *g = cJSON_GetObjectItem(endColor, "g");
-                    cJSON *b = cJSON_GetObjectItem(endColor, "b");
-                    if (r && g && b) {
-                        timer.endColor = CRGB_create(r->valueint, g->valueint, b->valueint);
-                    }
-                }
-                if (segmentColor) {
-                    cJSON *r = cJSON_GetObjectItem(segmentColor, "r");
-                    cJSON *g = cJSON_GetObjectItem(segmentColor, "g");
-                    cJSON *b = cJSON_GetObjectItem(segmentColor, "b");
-                    if (r && g && b) {
-                        timer.segmentColor = CRGB_create(r->valueint, g->valueint, b->valueint);
-                    }
-                }
-
-                timer.segments = segments ? segments->valueint : 4;
-                timer.useEndColor = useEndColor ? cJSON_IsTrue(useEndColor) : true;
 
-                strncpy(timer.timerName, "web_timer", sizeof(timer.timerName) - 1);
-                led_state = 4; // Timer active
-
-                ESP_LOGI(TAG, "Web timer started: %lu seconds, mode: %s",
-                         timer.totalDurationSec, timer.isCountdown ? "countdown" : "countup");
-            }
-            cJSON_Delete(json);
+        if (strcmp(body.command, "start") == 0) {
+            // Start timer with web parameters
+            timer_lock();
+            timer.primaryColor = body.primaryColor;
+            timer.endColor = body.endColor;
+            timer.segmentColor = body.segmentColor;
+            timer.segments = body.segments;
+            timer.useEndColor = body.useEndColor;
+            timer_control_start("web_timer", strcmp(body.mode, "countdown") == 0, body.duration * 60);
+            timer_unlock();
+
+            ESP_LOGI(TAG, "Web timer started: %lu seconds, mode: %s",
+                     timer.totalDurationSec, timer.isCountdown ? "countdown" : "countup");
         }
 
         httpd_resp_set_type(req, "application/json");
@@ -642,23 +486,19 @@ esp_err_t timer_api_handler(httpd_req_t *req) {
 
 esp_err_t pause_api_handler(httpd_req_t *req) {
     if (req->method == HTTP_POST) {
-        if (timer.active) {
-            if (timer.paused) {
-                // Resume
-                unsigned long pauseDuration = (xTaskGetTickCount() * portTICK_PERIOD_MS) - timer.pausedTimeMs;
-                timer.startTimeMs += pauseDuration;
-                timer.paused = false;
-                ESP_LOGI(TAG, "Web timer resumed");
-            } else {
-                // Pause
-                timer.paused = true;
-                timer.pausedTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
-                ESP_LOGI(TAG, "Web timer paused");
-            }
+        // Toggles; the test, the change and the answer are one step, so two
+        // workers cannot both pause or report each other's result
+        timer_lock();
+        if (timer.paused) {
+            timer_control_resume();
+        } else {
+            timer_control_pause();
         }
+        bool paused = timer.paused;
+        timer_unlock();
 
         httpd_resp_set_type(req, "application/json");
-        const char* response = timer.paused ? "{\"status\":\"paused\"}" : "{\"status\":\"resumed\"}";
+        const char* response = paused ? "{\"status\":\"paused\"}" : "{\"status\":\"resumed\"}";
         httpd_resp_send(req, response, strlen(response));
         return ESP_OK;
     }
@@ -667,132 +507,96 @@ esp_err_t pause_api_handler(httpd_req_t *req) {
 
 esp_err_t stop_api_handler(httpd_req_t *req) {
     if (req->method == HTTP_POST) {
-        timer.active = false;
-        timer.paused = false;
-        timer.endAnimationActive = false;
-        fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
-        FastLED_show();
-        led_state = 0; // back to idle
-        ESP_LOGI(TAG, "Web timer stopped");
+        timer_control_stop();
 
         httpd_resp_set_type(req, "application/json");
-        httpd_resp_send(req, "{\"status\":\"stopped\"}", 18);
+        httpd_resp_sendstr(req, "{\"status\":\"stopped\"}");
         return ESP_OK;
     }
     return ESP_ERR_NOT_SUPPORTED;
 }
 
+static void write_color(json_writer_t *w, const char *key, CRGB color)
+{
+    json_write_object_begin(w, key);
+    json_write_uint(w, "r", color.r);
+    json_write_uint(w, "g", color.g);
+    json_write_uint(w, "b", color.b);
+    json_write_object_end(w);
+}
+
 esp_err_t settings_api_handler(httpd_req_t *req) {
     if (req->method == HTTP_POST) {
         // Save settings
         char buf[1024];
-        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
-        if (ret <= 0) {
-            httpd_resp_send_500(req);
-            return ESP_FAIL;
+        timer_lock();
+        web_timer_request_t body = {
+            .primaryColor = timer.primaryColor,
+            .endColor = timer.endColor,
+            .segmentColor = timer.segmentColor,
+            .segments = timer.segments,
+            .useEndColor = timer.useEndColor,
+        };
+        timer_unlock();
+        if (json_recv_request(req, buf, sizeof(buf), settings_schema,
+                              sizeof(settings_schema) / sizeof(settings_schema[0]), &body) != ESP_OK) {
+            return ESP_OK;
         }
-        buf[ret] = '\0';
-
-        cJSON *json = cJSON_Parse(buf);
-        if (json) {
-            cJSON *primaryColor = cJSON_GetObjectItem(json, "primaryColor");
-            cJSON *endColor = cJSON_GetObjectItem(json, "endColor");
-            cJSON *segmentColor = cJSON_GetObjectItem(json, "segmentColor");
-            cJSON *segments = cJSON_GetObjectItem(json, "segments");
-            cJSON *useEndColor = cJSON_GetObjectItem(json, "useEndColor");
-
-            // Update timer settings
-            if (primaryColor) {
-                cJSON *r = cJSON_GetObjectItem(primaryColor, "r");
-                cJSON *g = cJSON_GetObjectItem(primaryColor, "g");
-                cJSON *b = cJSON_GetObjectItem(primaryColor, "b");
-                if (r && g && b) {
-                    timer.primaryColor = CRGB_create(r->valueint, g->valueint, b->valueint);
-                }
-            }
-            if (endColor) {
-                cJSON *r = cJSON_GetObjectItem(endColor, "r");
-                cJSON *g = cJSON_GetObjectItem(endColor, "g");
-                cJSON *b = cJSON_GetObjectItem(endColor, "b");
-                if (r && g && b) {
-                    timer.endColor = CRGB_create(r->valueint, g->valueint, b->valueint);
-                }
-            }
-            if (segmentColor) {
-                cJSON *r = cJSON_GetObjectItem(segmentColor, "r");
-                cJSON *g = cJSON_GetObjectItem(segmentColor, "g");
-                cJSON *b = cJSON_GetObjectItem(segmentColor, "b");
-                if (r && g && b) {
-                    timer.segmentColor = CRGB_create(r->valueint, g->valueint, b->valueint);
-                }
-            }
-            if (segments) {
-                timer.segments = segments->valueint;
-            }
-            if (useEndColor) {
-                timer.useEndColor = cJSON_IsTrue(useEndColor);
-            }
 
-            // Save to NVS
-            save_timer_settings();
+        // Update timer settings
+        timer_lock();
+        timer.primaryColor = body.primaryColor;
+        timer.endColor = body.endColor;
+        timer.segmentColor = body.segmentColor;
+        timer.segments = body.segments;
+        timer.useEndColor = body.useEndColor;
 
-            cJSON_Delete(json);
-        }
+        // Saved to NVS in the background once changes stop
+        save_timer_settings();
+        timer_unlock();
 
         httpd_resp_set_type(req, "application/json");
-        httpd_resp_send(req, "{\"status\":\"saved\"}", 17);
+        httpd_resp_sendstr(req, "{\"status\":\"saved\"}");
         return ESP_OK;
 
     } else if (req->method == HTTP_GET) {
-        // Load and return current settings
-        cJSON *response = cJSON_CreateObject();
-
-        cJSON *primaryColor = cJSON_CreateObject();
-        cJSON_AddNumberToObject(primaryColor, "r", timer.primaryColor.r);
-        cJSON_AddNumberToObject(primaryColor, "g", timer.primaryColor.g);
-        cJSON_AddNumberToObject(primaryColor, "b", timer.primaryColor.b);
-        cJSON_AddItemToObject(response, "primaryColor", primaryColor);
-
-        cJSON *endColor = cJSON_CreateObject();
-        cJSON_AddNumberToObject(endColor, "r", timer.endColor.r);
-        cJSON_AddNumberToObject(endColor, "g", timer.endColor.g);
-        cJSON_AddNumberToObject(endColor, "b", timer.endColor.b);
-        cJSON_AddItemToObject(response, "endColor", endColor);
-
-        cJSON *segmentColor = cJSON_CreateObject();
-        cJSON_AddNumberToObject(segmentColor, "r", timer.segmentColor.r);
-        cJSON_AddNumberToObject(segmentColor, "g", timer.segmentColor.g);
-        cJSON_AddNumberToObject(segmentColor, "b", timer.segmentColor.b);
-        cJSON_AddItemToObject(response, "segmentColor", segmentColor);
-
-        cJSON_AddNumberToObject(response, "segments", timer.segments);
-        cJSON_AddBoolToObject(response, "useEndColor", timer.useEndColor);
-
-        char *json_string = cJSON_Print(response);
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_send(req, json_string, strlen(json_string));
-
-        free(json_string);
-        cJSON_Delete(response);
-        return ESP_OK;
+        // Return current settings
+        char buf[256];
+        json_writer_t w;
+        json_writer_init(&w, buf, sizeof(buf));
+        json_write_object_begin(&w, NULL);
+        timer_lock();
+        write_color(&w, "primaryColor", timer.primaryColor);
+        write_color(&w, "endColor", timer.endColor);
+        write_color(&w, "segmentColor", timer.segmentColor);
+        json_write_int(&w, "segments", timer.segments);
+        json_write_bool(&w, "useEndColor", timer.useEndColor);
+        timer_unlock();
+        json_write_object_end(&w);
+        return json_send(req, &w);
     }
     return ESP_ERR_NOT_SUPPORTED;
 }
 
+// Every socket the server closes passes through here; it must close the fd
+static void webserver_close_fn(httpd_handle_t hd, int sockfd)
+{
+    live_push_closed(sockfd);
+    close(sockfd);
+}
+
 // Start web server
 httpd_handle_t start_webserver(void) {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.max_uri_handlers = 8;
+    config.max_uri_handlers = 48;
+    config.close_fn = webserver_close_fn;
 
     if (httpd_start(&server, &config) == ESP_OK) {
-        // Root handler
-        httpd_uri_t root_uri = {
-            .uri = "/",
-            .method = HTTP_GET,
-            .handler = root_handler,
-            .user_ctx = NULL
-        };
-        httpd_register_uri_handler(server, &root_uri);
+        // Handlers that touch NVS, the LEDs or read a body run on workers
+        http_workers_start();
+
+        // Web UI, gzipped into flash at build time
+        web_ui_register_http(server);
 
         // Timer API
         httpd_uri_t timer_uri = {
@@ -801,7 +605,7 @@ httpd_handle_t start_webserver(void) {
             .handler = timer_api_handler,
             .user_ctx = NULL
         };
-        httpd_register_uri_handler(server, &timer_uri);
+        http_workers_register(server, &timer_uri);
 
         // Pause API
         httpd_uri_t pause_uri = {
@@ -810,7 +614,7 @@ httpd_handle_t start_webserver(void) {
             .handler = pause_api_handler,
             .user_ctx = NULL
         };
-        httpd_register_uri_handler(server, &pause_uri);
+        http_workers_register(server, &pause_uri);
 
         // Stop API
         httpd_uri_t stop_uri = {
@@ -819,7 +623,7 @@ httpd_handle_t start_webserver(void) {
             .handler = stop_api_handler,
             .user_ctx = NULL
         };
-        httpd_register_uri_handler(server, &stop_uri);
+        http_workers_register(server, &stop_uri);
 
         // Settings API (GET and POST)
         httpd_uri_t settings_get_uri = {
@@ -828,7 +632,7 @@ httpd_handle_t start_webserver(void) {
             .handler = settings_api_handler,
             .user_ctx = NULL
         };
-        httpd_register_uri_handler(server, &settings_get_uri);
+        http_workers_register(server, &settings_get_uri);
 
         httpd_uri_t settings_post_uri = {
             .uri = "/api/settings",
@@ -836,7 +640,30 @@ httpd_handle_t start_webserver(void) {
             .handler = settings_api_handler,
             .user_ctx = NULL
         };
-        httpd_register_uri_handler(server, &settings_post_uri);
+        http_workers_register(server, &settings_post_uri);
+
+        // AFE mode and statistics API
+        afe_manager_register_http(server);
+        afe_profiles_register_http(server);
+        speech_bench_register_http(server);
+        model_manager_register_http(server);
+        audio_history_register_http(server);
+        prompt_pack_register_http(server);
+        audio_engine_register_http(server);
+        tone_synth_register_http(server);
+        spectrum_viz_register_http(server);
+        doa_register_http(server);
+        aec_reference_register_http(server);
+        boot_register_http(server);
+        wifi_manager_register_http(server);
+        live_push_register_http(server);
+        http_workers_register_http(server);
+        udp_control_register_http(server);
+        pixel_stream_register_http(server);
+        timer_sync_register_http(server);
+        settings_store_register_http(server);
+        session_log_register_http(server);
+        warm_restart_register_http(server);
 
         ESP_LOGI(TAG, "Web server started on port %d", config.server_port);
     }
@@ -845,10 +672,12 @@ httpd_handle_t start_webserver(void) {
 
 // FastLED-style functions
 void FastLED_show() {
+    xSemaphoreTake(led_lock, portMAX_DELAY);
     for (int i = 0; i < LED_RING_LEDS; i++) {
         ESP_ERROR_CHECK(strip->set_pixel(strip, i, leds[i].r, leds[i].g, leds[i].b));
     }
     ESP_ERROR_CHECK(strip->refresh(strip, 100));
+    xSemaphoreGive(led_lock);
 }
 
 void FastLED_setBrightness(uint8_t brightness) {
@@ -922,105 +751,67 @@ void process_speech_command(int command_id) {
 
     ESP_LOGI(TAG, "Processing command: %s (%s)", cmd->command, cmd->action);
 
+    timer_lock();
     if (strcmp(cmd->action, "timer") == 0) {
         // Start countdown timer
-        timer.active = true;
-        timer.isCountdown = true;
-        timer.paused = false;
-        timer.totalDurationSec = cmd->duration_seconds;
-        timer.startTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
         timer.primaryColor = (CRGB)CRGB_BLUE;
         timer.endColor = (CRGB)CRGB_RED;
         timer.useEndColor = true;
         timer.segments = 4; // Default 4 segments
         timer.segmentColor = (CRGB)CRGB_GOLD;
-        strncpy(timer.timerName, "voice_timer", sizeof(timer.timerName) - 1);
-        led_state = 4; // timer_active
+        timer_control_start("voice_timer", true, cmd->duration_seconds);
         ESP_LOGI(TAG, "Started %d second countdown timer", cmd->duration_seconds);
 
     } else if (strcmp(cmd->action, "countup") == 0) {
         // Start count-up timer
-        timer.active = true;
-        timer.isCountdown = false;
-        timer.paused = false;
-        timer.totalDurationSec = cmd->duration_seconds;
-        timer.startTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
         timer.primaryColor = (CRGB)CRGB_GREEN;
         timer.endColor = (CRGB)CRGB_PURPLE;
         timer.useEndColor = true;
         timer.segments = 4;
         timer.segmentColor = (CRGB)CRGB_GOLD;
-        strncpy(timer.timerName, "voice_countup", sizeof(timer.timerName) - 1);
-        led_state = 4;
+        timer_control_start("voice_countup", false, cmd->duration_seconds);
         ESP_LOGI(TAG, "Started %d second count-up timer", cmd->duration_seconds);
 
     } else if (strcmp(cmd->action, "pause") == 0) {
-        if (timer.active && !timer.paused) {
-            timer.paused = true;
-            timer.pausedTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
-            ESP_LOGI(TAG, "Timer paused");
-        }
+        timer_control_pause();
 
     } else if (strcmp(cmd->action, "resume") == 0) {
-        if (timer.active && timer.paused) {
-            // Adjust start time to account for pause duration
-            unsigned long pauseDuration = (xTaskGetTickCount() * portTICK_PERIOD_MS) - timer.pausedTimeMs;
-            timer.startTimeMs += pauseDuration;
-            timer.paused = false;
-            ESP_LOGI(TAG, "Timer resumed");
-        }
+        timer_control_resume();
 
     } else if (strcmp(cmd->action, "stop") == 0 || strcmp(cmd->action, "cancel") == 0 || strcmp(cmd->action, "clear") == 0) {
-        timer.active = false;
-        timer.paused = false;
-        timer.endAnimationActive = false;
-        fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
-        FastLED_show();
-        led_state = 0; // back to idle
-        ESP_LOGI(TAG, "Timer stopped/cancelled");
+        timer_control_stop();
 
     } else if (strcmp(cmd->action, "add") == 0) {
-        if (timer.active) {
-            timer.totalDurationSec += cmd->duration_seconds;
-            ESP_LOGI(TAG, "Added %d seconds to timer", cmd->duration_seconds);
-        }
+        timer_control_add(cmd->duration_seconds);
 
     } else if (strcmp(cmd->action, "workout") == 0) {
         // Special workout timer with orange theme
-        timer.active = true;
-        timer.isCountdown = true;
-        timer.paused = false;
-        timer.totalDurationSec = cmd->duration_seconds;
-        timer.startTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
         timer.primaryColor = (CRGB)CRGB_ORANGE;
         timer.endColor = (CRGB)CRGB_RED;
         timer.useEndColor = true;
         timer.segments = 6; // More segments for workout
         timer.segmentColor = (CRGB)CRGB_WHITE;
-        strncpy(timer.timerName, "workout", sizeof(timer.timerName) - 1);
-        led_state = 4;
+        timer_control_start("workout", true, cmd->duration_seconds);
         ESP_LOGI(TAG, "Started workout timer: %d seconds", cmd->duration_seconds);
 
     } else if (strcmp(cmd->action, "laundry") == 0) {
         // Special laundry timer with blue theme
-        timer.active = true;
-        timer.isCountdown = true;
-        timer.paused = false;
-        timer.totalDurationSec = cmd->duration_seconds;
-        timer.startTimeMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
         timer.primaryColor = (CRGB)CRGB_BLUE;
         timer.endColor = (CRGB)CRGB_GREEN;
         timer.useEndColor = true;
         timer.segments = 4;
         timer.segmentColor = (CRGB)CRGB_WHITE;
-        strncpy(timer.timerName, "laundry", sizeof(timer.timerName) - 1);
-        led_state = 4;
+        timer_control_start("laundry", true, cmd->duration_seconds);
         ESP_LOGI(TAG, "Started laundry timer: %d seconds", cmd->duration_seconds);
     }
+    timer_unlock();
 }
 
 void FastLED_begin()
 {
+    if (strip) {
+        return; // already up for a warm restore
+    }
     rmt_config_t config = RMT_DEFAULT_CONFIG_TX(LED_STRIP_GPIO, RMT_CHANNEL);
     config.clk_div = 2;
 
@@ -1029,6 +820,7 @@ void FastLED_begin()
 
     led_strip_config_t strip_config = LED_STRIP_DEFAULT_CONFIG(LED_RING_LEDS, (led_strip_dev_t)config.channel);
     strip = led_strip_new_rmt_ws2812(&strip_config);
+    led_lock = xSemaphoreCreateMutex();
 
     if (!strip)
     {
@@ -1036,9 +828,12 @@ void FastLED_begin()
         return;
     }
 
-    // Initialize LED array to black
-    fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
-    FastLED_show();
+    // Initialize LED array to black, unless a restored timer is about to be
+    // painted: the LEDs still show its last frame from before the reset
+    if (!timer.active) {
+        fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
+        FastLED_show();
+    }
 
     ESP_LOGI(TAG, "FastLED initialized with %d LEDs on GPIO %d", LED_RING_LEDS, LED_STRIP_GPIO);
 }
@@ -1068,14 +863,14 @@ void update_timer_leds() {
 
     // Handle flash state for segment markers
     if (timer.flashActive) {
-        if ((xTaskGetTickCount() * portTICK_PERIOD_MS) - timer.lastFlashTime > 1000) {
+        if (timer_now_ms() - timer.lastFlashTime > 1000) {
             timer.flashActive = false;
         } else {
             return; // Hold flash color
         }
     }
 
-    unsigned long elapsedMs = (xTaskGetTickCount() * portTICK_PERIOD_MS) - timer.startTimeMs;
+    unsigned long elapsedMs = timer_now_ms() - timer.startTimeMs;
     float progress = (float)elapsedMs / (float)(timer.totalDurationSec * 1000);
     if (progress > 1.0f) progress = 1.0f;
 
@@ -1087,7 +882,7 @@ void update_timer_leds() {
             int segmentLedIndex = (LED_RING_LEDS * i) / timer.segments;
             if (timer.lastLedsLit < segmentLedIndex && ledsToShow >= segmentLedIndex) {
                 timer.flashActive = true;
-                timer.lastFlashTime = xTaskGetTickCount() * portTICK_PERIOD_MS;
+                timer.lastFlashTime = timer_now_ms();
                 fill_solid(leds, LED_RING_LEDS, timer.segmentColor);
                 FastLED_show();
                 break;
@@ -1131,14 +926,19 @@ void update_timer_leds() {
 void handle_timer_end_animation() {
     if (!timer.endAnimationActive) return;
 
-    unsigned long elapsed = (xTaskGetTickCount() * portTICK_PERIOD_MS) - timer.endAnimationStartMs;
+    unsigned long elapsed = timer_now_ms() - timer.endAnimationStartMs;
     if (elapsed > 5000) { // 5 second animation
-        timer.active = false;
-        timer.endAnimationActive = false;
-        fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
-        FastLED_show();
-        led_state = 0; // back to idle
-        ESP_LOGI(TAG, "Timer completed and reset");
+        timer_lock();
+        // A timer started meanwhile is left alone
+        if (timer.endAnimationActive) {
+            timer.active = false;
+            timer.endAnimationActive = false;
+            fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
+            FastLED_show();
+            led_state = 0; // back to idle
+            ESP_LOGI(TAG, "Timer completed and reset");
+        }
+        timer_unlock();
         return;
     }
 
@@ -1202,6 +1002,60 @@ void hsv_to_rgb(uint16_t h, uint8_t s, uint8_t v, uint8_t *r, uint8_t *g, uint8_
     }
 }
 
+// Spectrum mode, shown while idle: each band is a bar over its share of the
+// ring, hue from blue (bass) to red, with the peak-hold LED in white
+bool led_spectrum_draw(const uint8_t *levels, const uint8_t *peaks, int bands)
+{
+    if (led_state != 0 || pixel_stream_active()) return false;
+
+    int width = LED_RING_LEDS / bands;
+    fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
+    for (int b = 0; b < bands; b++) {
+        uint8_t hue = 170 - (170 * b) / (bands - 1);
+        int fill = levels[b] * width; // in 1/255 of an LED
+        for (int i = 0; i < width; i++) {
+            int v = fill - i * 255;
+            if (v <= 0) break;
+            CRGB *led = &leds[b * width + i];
+            hsv_to_rgb(hue, 255, v > 255 ? 255 : v, &led->r, &led->g, &led->b);
+        }
+        int top = (levels[b] * width + 254) / 255 - 1;
+        int peak = (peaks[b] * width + 254) / 255 - 1;
+        if (peak > top) {
+            leds[b * width + peak] = (CRGB){96, 96, 96};
+        }
+    }
+    FastLED_show();
+    return true;
+}
+
+// Pixel stream frames go straight into the strip driver's buffer, not leds[],
+// so the animations find their own frame untouched when the stream ends
+static bool led_stream_write(int first, const uint8_t *rgb, int count)
+{
+    if (led_state != 0) return false;
+
+    xSemaphoreTake(led_lock, portMAX_DELAY);
+    for (int i = 0; i < count; i++, rgb += 3) {
+        strip->set_pixel(strip, first + i, rgb[0], rgb[1], rgb[2]);
+    }
+    xSemaphoreGive(led_lock);
+    return true;
+}
+
+static void led_stream_show(void)
+{
+    xSemaphoreTake(led_lock, portMAX_DELAY);
+    ESP_ERROR_CHECK(strip->refresh(strip, 100));
+    xSemaphoreGive(led_lock);
+}
+
+static const pixel_stream_ops_t led_stream_ops = {
+    .leds = LED_RING_LEDS,
+    .write = led_stream_write,
+    .show = led_stream_show,
+};
+
 void led_idle_animation()
 {
     // No LEDs while waiting for wake phrase - completely dark
@@ -1247,7 +1101,23 @@ void led_listening_animation()
         direction = -direction;
     }
 
-    // White breathing effect while listening for commands
+    // Breathing arc facing the talker when the wake word gave a direction,
+    // otherwise the whole ring breathes white
+    doa_result_t doa;
+    if (doa_latest(&doa)) {
+        int center = doa_ring_position(&doa, LED_RING_LEDS);
+        fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
+        for (int d = -DOA_ARC_HALF_WIDTH; d <= DOA_ARC_HALF_WIDTH; d++) {
+            uint8_t level = brightness * (DOA_ARC_HALF_WIDTH + 1 - abs(d)) / (DOA_ARC_HALF_WIDTH + 1);
+            int i = (center + d + LED_RING_LEDS) % LED_RING_LEDS;
+            leds[i].r = level;
+            leds[i].g = level;
+            leds[i].b = level;
+        }
+        FastLED_show();
+        return;
+    }
+
     for (int i = 0; i < LED_RING_LEDS; i++) {
         leds[i].r = brightness;
         leds[i].g = brightness;
@@ -1270,6 +1140,7 @@ void led_task(void *arg)
         switch (led_state)
         {
         case 0: // idle - slow white breathing on a few LEDs
+            if (spectrum_viz_enabled() || pixel_stream_active()) break; // their tasks paint the idle ring
             // Clear all LEDs first
             fill_solid(leds, LED_RING_LEDS, (CRGB)CRGB_BLACK);
             led_idle_animation();
@@ -1296,89 +1167,171 @@ void led_task(void *arg)
     vTaskDelete(NULL);
 }
 
-void play_music(void *arg)
+// Profiles with fewer mics than the board records take the first ones
+static void feed_pack_mics(const int16_t *board, int board_channels, int16_t *afe_in, int mics, int samples)
 {
-    while (task_flag)
+    for (int i = 0; i < samples; i++)
     {
-        switch (play_voice)
+        for (int c = 0; c < mics; c++)
         {
-        case -2:
-            vTaskDelay(10);
-            break;
-        case -1:
-            wake_up_action();
-            play_voice = -2;
-            break;
-        default:
-            speech_commands_action(play_voice);
-            play_voice = -2;
-            break;
+            afe_in[i * mics + c] = board[i * board_channels + c];
         }
     }
-    vTaskDelete(NULL);
 }
 
 void feed_Task(void *arg)
 {
-    esp_afe_sr_data_t *afe_data = arg;
+    esp_afe_sr_data_t *afe_data = afe_manager_feed_checkpoint();
+    uint32_t generation = afe_manager_generation();
     int audio_chunksize = afe_handle->get_feed_chunksize(afe_data);
     int nch = afe_handle->get_channel_num(afe_data);
+    int total_ch = afe_handle->get_total_channel_num(afe_data);
     int feed_channel = esp_get_feed_channel();
     assert(nch <= feed_channel);
     int16_t *i2s_buff = malloc(audio_chunksize * sizeof(int16_t) * feed_channel);
     assert(i2s_buff);
+    // With AEC the AFE input is the mics plus the playback reference, and a
+    // profile may use fewer mics than the board frame carries
+    int16_t *afe_buff = NULL;
+    if ((AUDIO_ENGINE_AVAILABLE && total_ch > nch) || total_ch < feed_channel)
+    {
+        afe_buff = malloc(audio_chunksize * sizeof(int16_t) * total_ch);
+        assert(afe_buff);
+    }
 
     while (task_flag)
     {
+        afe_data = afe_manager_feed_checkpoint();
+        if (generation != afe_manager_generation())
+        {
+            // AFE was recreated in another mode, chunk size and channels may have changed
+            generation = afe_manager_generation();
+            audio_chunksize = afe_handle->get_feed_chunksize(afe_data);
+            nch = afe_handle->get_channel_num(afe_data);
+            total_ch = afe_handle->get_total_channel_num(afe_data);
+            free(i2s_buff);
+            i2s_buff = malloc(audio_chunksize * sizeof(int16_t) * feed_channel);
+            assert(i2s_buff);
+            free(afe_buff);
+            afe_buff = NULL;
+            if ((AUDIO_ENGINE_AVAILABLE && total_ch > nch) || total_ch < feed_channel)
+            {
+                afe_buff = malloc(audio_chunksize * sizeof(int16_t) * total_ch);
+                assert(afe_buff);
+            }
+            aec_reference_resync();
+        }
+
         esp_get_feed_data(false, i2s_buff, audio_chunksize * sizeof(int16_t) * feed_channel);
+        audio_history_write(i2s_buff, audio_chunksize);
+        spectrum_viz_feed(i2s_buff, feed_channel, audio_chunksize);
+        if (afe_buff && total_ch > nch)
+        {
+            aec_reference_feed(i2s_buff, feed_channel, afe_buff, nch, total_ch, audio_chunksize);
+        }
+        else if (afe_buff)
+        {
+            feed_pack_mics(i2s_buff, feed_channel, afe_buff, nch, audio_chunksize);
+        }
 
-        afe_handle->feed(afe_data, i2s_buff);
+        uint32_t start = esp_cpu_get_cycle_count();
+        afe_handle->feed(afe_data, afe_buff ? afe_buff : i2s_buff);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        afe_manager_record_feed(cycles, audio_chunksize);
+        if (afe_buff && total_ch > nch)
+        {
+            aec_reference_record_feed(cycles, audio_chunksize);
+        }
     }
     if (i2s_buff)
     {
         free(i2s_buff);
         i2s_buff = NULL;
     }
+    free(afe_buff);
     vTaskDelete(NULL);
 }
 
+// Wake word heard but no multinet to listen with: back to waiting for it
+static void detect_abandon_wake(esp_afe_sr_data_t *afe_data)
+{
+    ESP_LOGE(TAG, "Multinet unavailable, wake word dropped");
+    afe_manager_record_timeout();
+    audio_history_mark(AUDIO_CAPTURE_TIMEOUT);
+    live_push_event(LIVE_EVENT_TIMEOUT, NULL);
+    led_state = 0; // Back to idle
+    afe_handle->enable_wakenet(afe_data);
+}
+
 void detect_Task(void *arg)
 {
-    esp_afe_sr_data_t *afe_data = arg;
-
-    // Standard model initialization
-    int afe_chunksize = afe_handle->get_fetch_chunksize(afe_data);
-    char *mn_name = esp_srmodel_filter(models, ESP_MN_PREFIX, ESP_MN_ENGLISH);
-    ESP_LOGI(TAG, "Using multinet model: %s", mn_name);
-    esp_mn_iface_t *multinet = esp_mn_handle_from_name(mn_name);
-    model_iface_data_t *model_data = multinet->create(mn_name, 6000);
-    int mu_chunksize = multinet->get_samp_chunksize(model_data);
-    esp_mn_commands_update_from_sdkconfig(multinet, model_data);
-    assert(mu_chunksize == afe_chunksize);
-    multinet->print_active_speech_commands(model_data);
+    esp_afe_sr_data_t *afe_data = afe_manager_detect_checkpoint();
+
+    // multinet is created on wake by the model manager
+    esp_mn_iface_t *multinet = model_manager_multinet();
+    model_iface_data_t *model_data = NULL;
+    bool mn_loading = false;    // model manager is still loading it, frames are dropped
+    bool verified = false;      // channel verified before the multinet was there
+    int verified_channel = 0;
 
     ESP_LOGI(TAG, "Speech detection started - %d commands available", NUM_SPEECH_COMMANDS);
     while (task_flag)
     {
+        afe_data = afe_manager_detect_checkpoint();
         afe_fetch_result_t *res = afe_handle->fetch(afe_data);
         if (!res || res->ret_value == ESP_FAIL)
         {
             ESP_LOGE(TAG, "AFE fetch error!");
             break;
         }
+        boot_milestone(BOOT_MILESTONE_VOICE_READY);
+        afe_manager_observe(res, detect_flag == 1);
+        aec_reference_fetched(res->data, res->data_size / sizeof(int16_t));
 
+        bool asked = false;
         if (res->wakeup_state == WAKENET_DETECTED)
         {
             ESP_LOGI(TAG, "WAKE WORD DETECTED");
+            boot_milestone(BOOT_MILESTONE_FIRST_WAKE);
             led_state = 1; // Wake detected - solid white
+            live_push_event(LIVE_EVENT_WAKE, NULL);
+            audio_history_mark(AUDIO_CAPTURE_WAKE);
+            doa_request();
+            verified = false;
+            mn_loading = false;
+            model_data = model_manager_acquire(&mn_loading);
+            asked = true;
+        }
+        else if (mn_loading)
+        {
+            // This frame is dropped; ask again whether the load has finished
+            model_data = model_manager_acquire(&mn_loading);
+            asked = true;
+        }
+        if (asked && model_data)
+        {
+            assert(multinet->get_samp_chunksize(model_data) == afe_handle->get_fetch_chunksize(afe_data));
             multinet->clean(model_data);
         }
-        else if (res->wakeup_state == WAKENET_CHANNEL_VERIFIED)
+        else if (asked && !mn_loading)
+        {
+            detect_abandon_wake(afe_data);
+            verified = false;
+            continue;
+        }
+
+        if (res->wakeup_state == WAKENET_CHANNEL_VERIFIED)
         {
-            play_voice = -1;
+            verified = true;
+            verified_channel = res->trigger_channel_id;
+        }
+        if (verified && model_data && detect_flag == 0)
+        {
+            verified = false;
+            wake_up_action();
             detect_flag = 1;
             led_state = 2; // Listening for commands - red breathing
-            ESP_LOGI(TAG, "Channel verified, listening for commands (channel: %d)", res->trigger_channel_id);
+            ESP_LOGI(TAG, "Channel verified, listening for commands (channel: %d)", verified_channel);
         }
 
         if (detect_flag == 1)
@@ -1405,11 +1358,13 @@ void detect_Task(void *arg)
                     ESP_LOGI(TAG, "COMMAND DETECTED: ID=%d, Command='%s', Confidence=%.1f%%",
                              top_command_id, command_name, confidence);
 
-                    play_voice = top_command_id;
+                    afe_manager_record_command(cmd != NULL);
+                    live_push_event(LIVE_EVENT_COMMAND, command_name);
 
                     // Process the speech command using our integrated system
                     if (cmd) {
                         process_speech_command(top_command_id);
+                        speech_commands_action(cmd->action, cmd->duration_seconds);
                         led_state = 3; // Command detected - green flash
                         vTaskDelay(pdMS_TO_TICKS(1000)); // Show green for 1 second
                     } else {
@@ -1427,6 +1382,8 @@ void detect_Task(void *arg)
                 }
 
                 detect_flag = 0;
+                model_manager_release();
+                model_data = NULL;
                 afe_handle->enable_wakenet(afe_data);
                 ESP_LOGI(TAG, "Ready for next wake word");
             }
@@ -1434,9 +1391,14 @@ void detect_Task(void *arg)
             if (mn_state == ESP_MN_STATE_TIMEOUT)
             {
                 printf("timeout\n");
+                afe_manager_record_timeout();
+                audio_history_mark(AUDIO_CAPTURE_TIMEOUT);
+                live_push_event(LIVE_EVENT_TIMEOUT, NULL);
                 led_state = 0; // Back to idle
                 afe_handle->enable_wakenet(afe_data);
                 detect_flag = 0;
+                model_manager_release();
+                model_data = NULL;
                 printf("\n-----------awaits to be waken up-----------\n");
             }
         }
@@ -1445,42 +1407,234 @@ void detect_Task(void *arg)
     // Cleanup
     if (model_data)
     {
-        multinet->destroy(model_data);
+        model_manager_release();
         model_data = NULL;
     }
     printf("detect exit\n");
     vTaskDelete(NULL);
 }
 
-// Timer monitoring task
+// Timer monitoring task. Its deepest path is a completion: log line,
+// session end, the done prompt and the live event, all under the timer lock.
+// The stack it has never touched is logged at each new low.
 void timer_monitor_task(void *arg) {
+    int last_beep = 0;
+    int64_t last_save_us = 0;
+    UBaseType_t stack_free = UINT32_MAX;
     while (task_flag) {
+        timer_lock();
         if (timer.active && !timer.endAnimationActive && !timer.paused) {
-            unsigned long elapsed = (xTaskGetTickCount() * portTICK_PERIOD_MS) - timer.startTimeMs;
-            if (elapsed >= timer.totalDurationSec * 1000) {
+            unsigned long elapsed = timer_now_ms() - timer.startTimeMs;
+            unsigned long total = timer.totalDurationSec * 1000;
+            if (elapsed >= total) {
                 ESP_LOGI(TAG, "Timer '%s' completed! Starting end animation", timer.timerName);
                 timer.endAnimationActive = true;
-                timer.endAnimationStartMs = xTaskGetTickCount() * portTICK_PERIOD_MS;
+                timer.endAnimationStartMs = timer_now_ms();
+                timer_warm_save();
+                session_log_end(SESSION_END_COMPLETED);
+                timer_complete_action();
+                live_push_event(LIVE_EVENT_TIMER_DONE, timer.timerName);
+            } else {
+                // One beep as each of the last ten seconds starts
+                int seconds_left = (total - elapsed + 999) / 1000;
+                if (seconds_left <= 10 && seconds_left < last_beep && timer.totalDurationSec > 10) {
+                    timer_countdown_action(seconds_left);
+                }
+                last_beep = seconds_left;
             }
+        } else if (!timer.active) {
+            last_beep = 0;
+        }
+        // The RTC copy has its own period; changes save it straight away
+        int64_t now_us = esp_timer_get_time();
+        if (now_us - last_save_us >= WARM_RESTART_SAVE_MS * 1000LL) {
+            timer_warm_save();
+            last_save_us = now_us;
         }
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Check every second
+        timer_unlock();
+        UBaseType_t unused = uxTaskGetStackHighWaterMark(NULL);
+        if (unused < stack_free) {
+            stack_free = unused;
+            ESP_LOGI(TAG, "timer_monitor stack: %u of %u bytes never used", (unsigned)unused, TIMER_MONITOR_STACK);
+        }
+        vTaskDelay(pdMS_TO_TICKS(TIMER_MONITOR_PERIOD_MS));
     }
     vTaskDelete(NULL);
 }
 
-void app_main()
+// Snapshot for the live push channel, called from its task every 100 ms
+static void live_state_sample(live_state_t *out)
 {
-    ESP_LOGI(TAG, "Starting Voice-Controlled LED Timer Ring");
+    // One consistent timer: start time, duration and name from the same change
+    timer_lock();
+    out->active = timer.active;
+    out->paused = timer.paused;
+    out->total_s = timer.totalDurationSec;
+    out->remaining_s = -1;
+    if (timer.active) {
+        unsigned long now = timer.paused ? timer.pausedTimeMs : timer_now_ms();
+        unsigned long elapsed = now - timer.startTimeMs;
+        unsigned long total = timer.totalDurationSec * 1000;
+        out->remaining_s = elapsed >= total ? 0 : (total - elapsed + 999) / 1000;
+    }
+    out->led_state = led_state;
+    strncpy(out->name, timer.timerName, sizeof(out->name) - 1);
+    timer_unlock();
+}
+
+// UDP control protocol: the same timer control functions as voice and REST.
+// Caller holds the timer lock.
+static void udp_apply_appearance(const udp_appearance_t *a)
+{
+    timer.primaryColor = (CRGB){ .r = a->primary[0], .g = a->primary[1], .b = a->primary[2] };
+    timer.endColor = (CRGB){ .r = a->end[0], .g = a->end[1], .b = a->end[2] };
+    timer.segmentColor = (CRGB){ .r = a->segment[0], .g = a->segment[1], .b = a->segment[2] };
+    timer.segments = a->segments;
+    timer.useEndColor = a->use_end_color != 0;
+}
+
+static void udp_start(const udp_start_t *start)
+{
+    timer_lock();
+    if (start->flags & UDP_START_APPEARANCE) {
+        udp_apply_appearance(&start->appearance);
+    }
+    timer_control_start("udp_timer", !(start->flags & UDP_START_COUNTUP), start->seconds);
+    timer_unlock();
+    ESP_LOGI(TAG, "UDP timer started: %lu seconds", (unsigned long)start->seconds);
+}
+
+static void udp_settings(const udp_appearance_t *appearance)
+{
+    timer_lock();
+    udp_apply_appearance(appearance);
+    save_timer_settings();
+    timer_unlock();
+}
+
+static void udp_status(udp_reply_t *out)
+{
+    live_state_t state;
+    memset(&state, 0, sizeof(state));
+    live_state_sample(&state);
+    out->active = state.active;
+    out->paused = state.paused;
+    out->led_state = state.led_state;
+    out->remaining_s = state.remaining_s;
+    out->total_s = state.total_s;
+}
+
+// Timer sync: times go out as offsets from now, so the 32-bit millisecond
+// clock wrapping does not matter
+static void sync_snapshot(timer_sync_state_t *out)
+{
+    int64_t shared = timer_sync_now_us();
+    unsigned long now = timer_now_ms();
+    out->active = timer.active;
+    out->countdown = timer.isCountdown;
+    out->paused = timer.paused;
+    out->use_end_color = timer.useEndColor;
+    memcpy(out->primary, &timer.primaryColor, 3);
+    memcpy(out->end, &timer.endColor, 3);
+    memcpy(out->segment, &timer.segmentColor, 3);
+    out->segments = timer.segments;
+    out->total_s = timer.totalDurationSec;
+    out->start_us = shared - (int64_t)(now - timer.startTimeMs) * 1000;
+    out->paused_us = timer.paused ? shared - (int64_t)(now - timer.pausedTimeMs) * 1000 : 0;
+    strncpy(out->name, timer.timerName, sizeof(out->name) - 1);
+}
 
+static void sync_apply(const timer_sync_state_t *state)
+{
+    if (!state->active) {
+        if (timer.active) {
+            timer_clear();
+            session_log_end(SESSION_END_STOPPED);
+        }
+        return;
+    }
+    int64_t shared = timer_sync_now_us();
+    unsigned long now = timer_now_ms();
+    // Follow the other ring's changes in this ring's session log
+    if (!timer.active || strncmp(timer.timerName, state->name, sizeof(state->name)) != 0 ||
+        timer.totalDurationSec > state->total_s) {
+        session_log_begin(state->name, state->countdown, state->total_s, true);
+    } else {
+        if (state->total_s > timer.totalDurationSec) {
+            session_log_add(state->total_s - timer.totalDurationSec);
+        }
+        if (state->paused && !timer.paused) {
+            session_log_pause();
+        } else if (!state->paused && timer.paused) {
+            session_log_resume();
+        }
+    }
+    memcpy(&timer.primaryColor, state->primary, 3);
+    memcpy(&timer.endColor, state->end, 3);
+    memcpy(&timer.segmentColor, state->segment, 3);
+    timer.segments = state->segments >= 1 && state->segments <= WEB_MAX_SEGMENTS ? state->segments : 4;
+    timer.useEndColor = state->use_end_color;
+    timer.isCountdown = state->countdown;
+    timer.totalDurationSec = state->total_s;
+    timer.startTimeMs = now - (shared - state->start_us) / 1000;
+    timer.pausedTimeMs = now - (shared - state->paused_us) / 1000;
+    timer.paused = state->paused;
+    timer.lastLedsLit = 0;
+    timer.endAnimationActive = false;
+    strncpy(timer.timerName, state->name, sizeof(timer.timerName) - 1);
+    timer.timerName[sizeof(timer.timerName) - 1] = '\0';
+    timer.active = true;
+    led_state = 4; // timer_active
+}
+
+static const timer_sync_ops_t sync_ops = {
+    .lock = timer_lock,
+    .unlock = timer_unlock,
+    .snapshot = sync_snapshot,
+    .apply = sync_apply,
+};
+
+static const udp_control_ops_t udp_ops = {
+    .start = udp_start,
+    .pause = timer_control_pause,
+    .resume = timer_control_resume,
+    .stop = timer_control_stop,
+    .add = timer_control_add,
+    .settings = udp_settings,
+    .status = udp_status,
+};
+
+// Boot stages, run in parallel as soon as their dependencies are up. Voice
+// only needs the models, the audio board and the saved AFE profile, so it no
+// longer waits for WiFi; the web server comes up once there is something to serve.
+enum {
+    BOOT_NVS,
+    BOOT_LEDS,
+    BOOT_CONFIG,
+    BOOT_NETWORK,
+    BOOT_WIFI,
+    BOOT_MODELS,
+    BOOT_BOARD,
+    BOOT_SPEECH,
+    BOOT_HTTP,
+};
+
+static esp_err_t boot_nvs(void)
+{
     // Initialize NVS for WiFi and timer settings storage
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
         ESP_ERROR_CHECK(nvs_flash_erase());
         ret = nvs_flash_init();
     }
-    ESP_ERROR_CHECK(ret);
-    ESP_LOGI(TAG, "NVS initialized for WiFi and timer settings");
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "NVS initialized for WiFi and timer settings");
+    }
+    return ret;
+}
 
+static esp_err_t boot_leds(void)
+{
     // Initialize FastLED
     FastLED_begin();
 
@@ -1493,75 +1647,164 @@ void app_main()
 
     // Load saved settings from NVS
     load_timer_settings();
+    if (warm_restored) {
+        // The restored timer keeps the colours it ran with
+        timer_warm_appearance(&warm_state);
+    }
+
+    xTaskCreatePinnedToCore(&led_task, "led_control", 4 * 1024, NULL, 3, NULL, 0);
+    xTaskCreatePinnedToCore(&timer_monitor_task, "timer_monitor", TIMER_MONITOR_STACK, NULL, 2, NULL, 1);
+    return ESP_OK;
+}
 
-    // Initialize WiFi
+static esp_err_t boot_config(void)
+{
+    afe_profiles_init();
+    aec_reference_init();
+    session_log_init();
+    if (warm_restored && timer.active) {
+        // The part before the reset is not in the log unless it was an esp_restart()
+        session_log_begin(timer.timerName, timer.isCountdown, timer.totalDurationSec, false);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t boot_network(void)
+{
     ESP_LOGI(TAG, "Initializing WiFi...");
-    wifi_init_sta();
+    return wifi_manager_start(WIFI_SSID, WIFI_PASS);
+}
 
-    // Start web server
-    ESP_LOGI(TAG, "Starting web server...");
-    start_webserver();
+static esp_err_t boot_wifi(void)
+{
+    return wifi_manager_wait_connected(WIFI_BOOT_WAIT_MS);
+}
 
+static esp_err_t boot_models(void)
+{
     ESP_LOGI(TAG, "Initializing ESP-SR models");
     models = esp_srmodel_init("model");
-    ESP_ERROR_CHECK(esp_board_init(AUDIO_HAL_16K_SAMPLES, 2, 16));
-    uart_driver_delete(CONFIG_ESP_CONSOLE_UART_NUM);
-    uart_driver_install(CONFIG_ESP_CONSOLE_UART_NUM, 256, 0, 0, NULL, 0);
+    return models ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+static esp_err_t boot_board(void)
+{
+    esp_err_t err = esp_board_init(AUDIO_HAL_16K_SAMPLES, 2, 16);
+    if (err != ESP_OK) {
+        return err;
+    }
 
 #if defined CONFIG_ESP32_KORVO_V1_1_BOARD
     led_init();
 #endif
+    return ESP_OK;
+}
 
-#if CONFIG_IDF_TARGET_ESP32
-    ESP_LOGE(TAG, "This demo only supports ESP32S3");
-    return;
-#else
-    afe_handle = (esp_afe_sr_iface_t *)&ESP_AFE_SR_HANDLE;
-#endif
-
+static esp_err_t boot_speech(void)
+{
     ESP_LOGI(TAG, "Configuring audio front-end");
-    afe_config_t afe_config = AFE_CONFIG_DEFAULT();
-    afe_config.memory_alloc_mode = AFE_MEMORY_ALLOC_MORE_PSRAM;
-    afe_config.wakenet_init = true;
-    afe_config.aec_init = false;
-    afe_config.pcm_config.total_ch_num = 2;
-    afe_config.pcm_config.mic_num = 2;
-    afe_config.pcm_config.ref_num = 0;
-    afe_config.pcm_config.sample_rate = 16000;
-    afe_config.wakenet_mode = DET_MODE_2CH_95;
-    afe_config.afe_mode = SR_MODE_HIGH_PERF;
-    afe_config.vad_mode = VAD_MODE_4;
-
-    afe_config.wakenet_model_name = esp_srmodel_filter(models, ESP_WN_PREFIX, NULL);
-
-#if defined CONFIG_ESP32_S3_BOX_BOARD || defined CONFIG_ESP32_S3_EYE_BOARD
-    afe_config.aec_init = false;
-#if defined CONFIG_ESP32_S3_EYE_BOARD
-    afe_config.pcm_config.total_ch_num = 2;
-    afe_config.pcm_config.mic_num = 1;
-    afe_config.pcm_config.ref_num = 1;
-#endif
+    esp_err_t err = afe_manager_init(models, afe_profiles_active());
+    if (err != ESP_OK) {
+        return err;
+    }
+    afe_handle = afe_manager_handle();
+    audio_history_init(esp_get_feed_channel(), 16000);
+    spectrum_viz_init(led_spectrum_draw);
+#if !defined CONFIG_ESP32_S3_EYE_BOARD
+    // The EYE's second feed channel is the playback reference, not a microphone
+    doa_init(esp_get_feed_channel());
 #endif
-    esp_afe_sr_data_t *afe_data = afe_handle->create_from_config(&afe_config);
+    prompt_pack_init();
+    tone_synth_init();
+    speech_bench_init(models);
+    err = model_manager_init(models);
+    if (err != ESP_OK) {
+        return err;
+    }
 
     ESP_LOGI(TAG, "Starting tasks...");
     task_flag = 1;
 
     // Core tasks
-    xTaskCreatePinnedToCore(&detect_Task, "speech_detect", 8 * 1024, (void *)afe_data, 5, NULL, 1);
-    xTaskCreatePinnedToCore(&feed_Task, "audio_feed", 8 * 1024, (void *)afe_data, 5, NULL, 0);
-    xTaskCreatePinnedToCore(&led_task, "led_control", 4 * 1024, NULL, 3, NULL, 0);
-    xTaskCreatePinnedToCore(&timer_monitor_task, "timer_monitor", 2 * 1024, NULL, 2, NULL, 1);
-    xTaskCreatePinnedToCore(&wifi_status_task, "wifi_status", 4 * 1024, NULL, 1, NULL, 1);
+    xTaskCreatePinnedToCore(&detect_Task, "speech_detect", 8 * 1024, NULL, 5, NULL, 1);
+    xTaskCreatePinnedToCore(&feed_Task, "audio_feed", 8 * 1024, NULL, 5, NULL, 0);
 
 #if defined CONFIG_ESP32_S3_KORVO_1_V4_0_BOARD
     xTaskCreatePinnedToCore(&led_Task, "led", 2 * 1024, NULL, 5, NULL, 0);
 #endif
-#if defined CONFIG_ESP32_S3_KORVO_1_V4_0_BOARD || CONFIG_ESP32_S3_KORVO_2_V3_0_BOARD || CONFIG_ESP32_KORVO_V1_1_BOARD || CONFIG_ESP32_S3_BOX_BOARD
-    xTaskCreatePinnedToCore(&play_music, "play", 4 * 1024, NULL, 5, NULL, 1);
+#if AUDIO_ENGINE_AVAILABLE
+    audio_engine_init();
 #endif
 
     ESP_LOGI(TAG, "Voice-Controlled LED Timer Ring ready!");
     ESP_LOGI(TAG, "Say wake word to start. Available commands: %d", NUM_SPEECH_COMMANDS);
     ESP_LOGI(TAG, "LED Ring: %d LEDs on GPIO %d", LED_RING_LEDS, LED_STRIP_GPIO);
-}
\ No newline at end of file
+    return ESP_OK;
+}
+
+static esp_err_t boot_http(void)
+{
+    ESP_LOGI(TAG, "Starting web server...");
+    live_push_init(live_state_sample);
+    udp_control_start(&udp_ops);
+    pixel_stream_start(&led_stream_ops);
+    timer_sync_start(&sync_ops);
+    session_log_start_clock();
+    return start_webserver() ? ESP_OK : ESP_FAIL;
+}
+
+static const boot_stage_t boot_stages[] = {
+    [BOOT_NVS]     = { "nvs",     boot_nvs,            0,                      0, tskNO_AFFINITY, 4 * 1024 },
+    [BOOT_LEDS]    = { "leds",    boot_leds,           BOOT_DEP(BOOT_NVS),     0, tskNO_AFFINITY, 4 * 1024 },
+    [BOOT_CONFIG]  = { "config",  boot_config,         BOOT_DEP(BOOT_NVS),     0, tskNO_AFFINITY, 4 * 1024 },
+    [BOOT_NETWORK] = { "network", boot_network,        BOOT_DEP(BOOT_NVS),     0, 0,              4 * 1024 },
+    [BOOT_WIFI]    = { "wifi",    boot_wifi,           BOOT_DEP(BOOT_NETWORK), 0, tskNO_AFFINITY, 3 * 1024 },
+    [BOOT_MODELS]  = { "models",  boot_models,         0,                      0, 1,              4 * 1024 },
+    [BOOT_BOARD]   = { "board",   boot_board,          0,                      0, tskNO_AFFINITY, 4 * 1024 },
+    [BOOT_SPEECH]  = { "speech",  boot_speech,
+                       BOOT_DEP(BOOT_MODELS) | BOOT_DEP(BOOT_BOARD) | BOOT_DEP(BOOT_CONFIG) | BOOT_DEP(BOOT_LEDS),
+                       0, 1, 6 * 1024 },
+    // Serves the timer even if speech failed to come up, as before
+    [BOOT_HTTP]    = { "http",    boot_http,
+                       BOOT_DEP(BOOT_NETWORK) | BOOT_DEP(BOOT_LEDS) | BOOT_DEP(BOOT_CONFIG),
+                       BOOT_DEP(BOOT_SPEECH), tskNO_AFFINITY, 4 * 1024 },
+};
+
+// Early boot path after a warm reset: the LED driver and one frame of the
+// restored timer, before the boot stages start
+static void timer_warm_restore(void)
+{
+    if (!warm_restart_restore(&warm_state)) {
+        return;
+    }
+    warm_restored = true;
+    unsigned long now = timer_now_ms();
+    timer_warm_appearance(&warm_state);
+    timer.isCountdown = warm_state.countdown;
+    timer.totalDurationSec = warm_state.total_s;
+    timer.startTimeMs = now - warm_state.elapsed_ms;
+    timer.pausedTimeMs = now;
+    timer.paused = warm_state.paused;
+    timer.endAnimationActive = false;
+    timer.lastLedsLit = LED_RING_LEDS; // no segment flash for markers passed before the reset
+    strncpy(timer.timerName, warm_state.name, sizeof(timer.timerName) - 1);
+    timer.timerName[sizeof(timer.timerName) - 1] = '\0';
+    timer.active = true;
+    led_state = 4; // timer_active
+
+    FastLED_begin();
+    update_timer_leds();
+    warm_restart_painted();
+    boot_milestone(BOOT_MILESTONE_PIXELS_RESTORED);
+}
+
+void app_main()
+{
+    timer_mutex = xSemaphoreCreateRecursiveMutex();
+    timer_warm_restore();
+    ESP_LOGI(TAG, "Starting Voice-Controlled LED Timer Ring");
+    // Swap the console driver before any stage task is logging
+    uart_driver_delete(CONFIG_ESP_CONSOLE_UART_NUM);
+    uart_driver_install(CONFIG_ESP_CONSOLE_UART_NUM, 256, 0, 0, NULL, 0);
+    ESP_ERROR_CHECK(boot_run(boot_stages, sizeof(boot_stages) / sizeof(boot_stages[0])));
+}
@@ -0,0 +1,360 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Lazy multinet lifetime.
+//
+// multinet is only needed for the few seconds after a wake word, so it is
+// created on wake and destroyed again once it has been idle for idle_ms.
+// With CONFIG_MODEL_IN_FLASH the weights are used in place from the mmapped
+// model partition and only the working buffers come and go; with
+// CONFIG_MODEL_IN_SPIFFS the weights are copied to RAM on every create,
+// which takes long enough to stall the AFE fetch loop. There the model is
+// loaded once at start and kept (idle_ms defaults to 0), and a load after
+// a wake runs on the manager task while detect_Task drops its frames.
+// Resident memory is sampled periodically and served at /api/models.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_mn_models.h"
+#include "esp_process_sdkconfig.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "model_manager.h"
+#include "perf_monitor.h"
+
+#define MODELS_NVS_NS           "models"
+#if CONFIG_MODEL_IN_SPIFFS
+#define MODELS_DEFAULT_IDLE_MS  0       // a reload copies the weights again
+#else
+#define MODELS_DEFAULT_IDLE_MS  30000
+#endif
+#define MODELS_MAX_IDLE_MS      3600000
+#define MODELS_MN_TIMEOUT_MS    6000
+#define MODELS_CHECK_MS         1000
+#define MODELS_SAMPLE_MS        10000
+#define MODELS_HISTORY_LEN      60      // 10 minutes at MODELS_SAMPLE_MS
+
+static const char *TAG = "MODEL_MGR";
+
+typedef struct {
+    uint32_t time_s;
+    int32_t mn_internal;        // multinet bytes in internal RAM, 0 when not resident
+    int32_t mn_psram;
+    uint32_t free_internal;
+    uint32_t free_psram;
+} model_mem_sample_t;
+
+static char *s_mn_name = NULL;
+static esp_mn_iface_t *s_multinet = NULL;
+static model_iface_data_t *s_model_data = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static bool s_in_use = false;
+static bool s_loading = false;          // manager task is creating it
+static TaskHandle_t s_task = NULL;
+static bool s_commands_printed = false;
+static int64_t s_last_used_us = 0;
+static uint32_t s_idle_ms = MODELS_DEFAULT_IDLE_MS;
+
+static uint32_t s_loads = 0;
+static uint32_t s_unloads = 0;
+static uint32_t s_failures = 0;
+static uint32_t s_dropped = 0;          // frames detect_Task skipped during a load
+static perf_counter_t s_create_ms;
+static int32_t s_mn_internal = 0;
+static int32_t s_mn_psram = 0;
+
+static model_mem_sample_t s_history[MODELS_HISTORY_LEN];
+static int s_history_head = 0;
+static int s_history_count = 0;
+
+static void model_manager_save_idle(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(MODELS_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_u32(nvs_handle, "idle_ms", s_idle_ms);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving idle period: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static void model_manager_load_idle(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(MODELS_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    uint32_t idle_ms;
+    if (nvs_get_u32(nvs_handle, "idle_ms", &idle_ms) == ESP_OK && idle_ms <= MODELS_MAX_IDLE_MS) {
+        s_idle_ms = idle_ms;
+    }
+    nvs_close(nvs_handle);
+}
+
+// Caller holds s_lock, or is the manager task with s_loading set; the
+// caller stores the result in s_model_data
+static model_iface_data_t *model_manager_create(void)
+{
+    size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    int64_t start = esp_timer_get_time();
+
+    model_iface_data_t *model_data = s_multinet->create(s_mn_name, MODELS_MN_TIMEOUT_MS);
+    if (!model_data) {
+        ESP_LOGE(TAG, "Failed to create multinet %s", s_mn_name);
+        s_failures++;
+        return NULL;
+    }
+    esp_mn_commands_update_from_sdkconfig(s_multinet, model_data);
+
+    uint32_t create_ms = (esp_timer_get_time() - start) / 1000;
+    perf_counter_add(&s_create_ms, create_ms);
+    s_mn_internal = (int32_t)(internal_free - heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    s_mn_psram = (int32_t)(psram_free - heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    s_loads++;
+
+    if (!s_commands_printed) {
+        s_multinet->print_active_speech_commands(model_data);
+        s_commands_printed = true;
+    }
+    ESP_LOGI(TAG, "Multinet loaded in %lu ms (internal %ld B, psram %ld B)",
+             (unsigned long)create_ms, (long)s_mn_internal, (long)s_mn_psram);
+    return model_data;
+}
+
+// Caller holds s_lock
+static void model_manager_destroy(void)
+{
+    s_multinet->destroy(s_model_data);
+    s_model_data = NULL;
+    s_unloads++;
+    ESP_LOGI(TAG, "Multinet idle for %lu ms, freed (internal %ld B, psram %ld B)",
+             (unsigned long)s_idle_ms, (long)s_mn_internal, (long)s_mn_psram);
+    s_mn_internal = 0;
+    s_mn_psram = 0;
+}
+
+static void model_manager_sample(void)
+{
+    model_mem_sample_t *sample = &s_history[s_history_head];
+    sample->time_s = esp_timer_get_time() / 1000000;
+    sample->mn_internal = s_mn_internal;
+    sample->mn_psram = s_mn_psram;
+    sample->free_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    sample->free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    s_history_head = (s_history_head + 1) % MODELS_HISTORY_LEN;
+    if (s_history_count < MODELS_HISTORY_LEN) {
+        s_history_count++;
+    }
+}
+
+static void model_manager_task(void *arg)
+{
+    TickType_t last_sample = 0;
+    while (1) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        bool load = s_loading && !s_model_data;
+        xSemaphoreGive(s_lock);
+        if (load) {
+            // Without the lock: detect_Task polls model_manager_acquire() meanwhile
+            model_iface_data_t *model_data = model_manager_create();
+            xSemaphoreTake(s_lock, portMAX_DELAY);
+            s_model_data = model_data;
+            s_last_used_us = esp_timer_get_time();
+            s_loading = false;
+            xSemaphoreGive(s_lock);
+        }
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        if (s_model_data && !s_in_use && s_idle_ms > 0 &&
+            esp_timer_get_time() - s_last_used_us >= s_idle_ms * 1000LL) {
+            model_manager_destroy();
+        }
+        if (s_history_count == 0 || xTaskGetTickCount() - last_sample >= pdMS_TO_TICKS(MODELS_SAMPLE_MS)) {
+            model_manager_sample();
+            last_sample = xTaskGetTickCount();
+        }
+        xSemaphoreGive(s_lock);
+
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MODELS_CHECK_MS));
+    }
+}
+
+esp_err_t model_manager_init(srmodel_list_t *models)
+{
+    s_mn_name = esp_srmodel_filter(models, ESP_MN_PREFIX, ESP_MN_ENGLISH);
+    if (!s_mn_name) {
+        ESP_LOGE(TAG, "No English multinet model in the model partition");
+        return ESP_ERR_NOT_FOUND;
+    }
+    s_multinet = esp_mn_handle_from_name(s_mn_name);
+    s_lock = xSemaphoreCreateMutex();
+    perf_counter_reset(&s_create_ms);
+    model_manager_load_idle();
+#if CONFIG_MODEL_IN_SPIFFS
+    s_loading = true;           // pre-warm, so the first wake does not wait for a copy
+#endif
+
+    xTaskCreatePinnedToCore(&model_manager_task, "model_mgr", 3 * 1024, NULL, 1, &s_task, 1);
+    ESP_LOGI(TAG, "Using multinet model: %s, loaded on wake, freed after %lu ms idle",
+             s_mn_name, (unsigned long)s_idle_ms);
+    return ESP_OK;
+}
+
+esp_mn_iface_t *model_manager_multinet(void)
+{
+    return s_multinet;
+}
+
+model_iface_data_t *model_manager_acquire(bool *loading)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+#if CONFIG_MODEL_IN_SPIFFS
+    if (!s_model_data) {
+        if (!*loading) {
+            // Copying the weights would hold up fetch(); the manager task does it
+            if (!s_loading) {
+                s_loading = true;
+                xTaskNotifyGive(s_task);
+            }
+            *loading = true;
+        } else if (s_loading) {
+            s_dropped++;
+        } else {
+            *loading = false;   // the load finished without a model
+        }
+    }
+#else
+    if (!s_model_data) {
+        s_model_data = model_manager_create();
+    }
+    *loading = false;
+#endif
+    if (s_model_data) {
+        s_in_use = true;
+        *loading = false;
+    }
+    model_iface_data_t *model_data = s_model_data;
+    xSemaphoreGive(s_lock);
+    return model_data;
+}
+
+void model_manager_release(void)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_in_use = false;
+    s_last_used_us = esp_timer_get_time();
+    xSemaphoreGive(s_lock);
+}
+
+static esp_err_t models_api_handler(httpd_req_t *req)
+{
+    if (!s_lock) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Speech models not loaded");
+        return ESP_FAIL;
+    }
+
+    if (req->method == HTTP_POST) {
+        char buf[64];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        cJSON *idle = json ? cJSON_GetObjectItem(json, "idle_ms") : NULL;
+        bool ok = cJSON_IsNumber(idle) && idle->valuedouble >= 0 && idle->valuedouble <= MODELS_MAX_IDLE_MS;
+        if (ok) {
+            s_idle_ms = (uint32_t)idle->valuedouble;
+            model_manager_save_idle();
+        }
+        cJSON_Delete(json);
+        if (!ok) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "idle_ms out of range");
+            return ESP_OK;
+        }
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddStringToObject(response, "multinet", s_mn_name);
+#if CONFIG_MODEL_IN_FLASH
+    cJSON_AddStringToObject(response, "weights", "mapped");
+#else
+    cJSON_AddStringToObject(response, "weights", "loaded");
+#endif
+    cJSON_AddBoolToObject(response, "resident", s_model_data != NULL);
+    cJSON_AddBoolToObject(response, "in_use", s_in_use);
+    cJSON_AddNumberToObject(response, "idle_ms", s_idle_ms);
+    cJSON_AddNumberToObject(response, "loads", s_loads);
+    cJSON_AddNumberToObject(response, "unloads", s_unloads);
+    cJSON_AddBoolToObject(response, "loading", s_loading);
+    cJSON_AddNumberToObject(response, "failures", s_failures);
+    cJSON_AddNumberToObject(response, "dropped_frames", s_dropped);
+    cJSON_AddNumberToObject(response, "create_ms_avg", perf_counter_avg(&s_create_ms));
+    cJSON_AddNumberToObject(response, "create_ms_max", s_create_ms.max);
+    cJSON_AddNumberToObject(response, "internal_bytes", s_mn_internal);
+    cJSON_AddNumberToObject(response, "psram_bytes", s_mn_psram);
+
+    cJSON *history = cJSON_AddArrayToObject(response, "history");
+    for (int i = 0; i < s_history_count; i++) {
+        int idx = (s_history_head - s_history_count + i + MODELS_HISTORY_LEN) % MODELS_HISTORY_LEN;
+        const model_mem_sample_t *sample = &s_history[idx];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "t", sample->time_s);
+        cJSON_AddNumberToObject(item, "mn_internal", sample->mn_internal);
+        cJSON_AddNumberToObject(item, "mn_psram", sample->mn_psram);
+        cJSON_AddNumberToObject(item, "free_internal", sample->free_internal);
+        cJSON_AddNumberToObject(item, "free_psram", sample->free_psram);
+        cJSON_AddItemToArray(history, item);
+    }
+    xSemaphoreGive(s_lock);
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t model_manager_register_http(httpd_handle_t server)
+{
+    httpd_uri_t models_get_uri = {
+        .uri = "/api/models",
+        .method = HTTP_GET,
+        .handler = models_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &models_get_uri);
+
+    httpd_uri_t models_post_uri = {
+        .uri = "/api/models",
+        .method = HTTP_POST,
+        .handler = models_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &models_post_uri);
+}
@@ -0,0 +1,56 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_private/esp_clk.h"
+#include "perf_monitor.h"
+
+void perf_counter_reset(perf_counter_t *c)
+{
+    memset(c, 0, sizeof(*c));
+}
+
+float perf_cycles_to_us(uint64_t cycles)
+{
+    return (float)cycles / (float)(esp_clk_cpu_freq() / 1000000);
+}
+
+void perf_cpu_snapshot(perf_cpu_snapshot_t *snap)
+{
+    snap->time_us = esp_timer_get_time();
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        snap->idle_us[core] = (uint32_t)ulTaskGetIdleRunTimeCounterForCore(core);
+#else
+        snap->idle_us[core] = 0;
+#endif
+    }
+}
+
+void perf_cpu_load(const perf_cpu_snapshot_t *from, const perf_cpu_snapshot_t *to, float load[portNUM_PROCESSORS])
+{
+    uint32_t elapsed = (uint32_t)(to->time_us - from->time_us);
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        if (elapsed == 0) {
+            load[core] = 0;
+            continue;
+        }
+        // Unsigned subtraction keeps this correct across a 32-bit counter wrap
+        uint32_t idle = to->idle_us[core] - from->idle_us[core];
+        if (idle > elapsed) {
+            idle = elapsed;
+        }
+        load[core] = 100.0f - (100.0f * idle) / elapsed;
+#else
+        load[core] = -1;
+#endif
+    }
+}
@@ -0,0 +1,158 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Concatenative confirmations.
+//
+// Phrases are sequences of word clips from the prompt pack (ids from
+// PROMPT_ID_WORD_BASE, silence trimmed by tools/mkprompts.py). Each clip is
+// decoded block by block; the last PHRASE_CROSSFADE_MS of a word is held
+// back and blended linearly with the start of the next one. The reader is
+// pulled by the audio engine, so a phrase never needs more than its own
+// small work buffer.
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_log.h"
+#include "phrase_synth.h"
+
+static const char *TAG = "PHRASE";
+
+static const char *const s_ones[] = {
+    "zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine",
+    "ten", "eleven", "twelve", "thirteen", "fourteen", "fifteen", "sixteen", "seventeen", "eighteen", "nineteen",
+};
+static const char *const s_tens[] = {
+    NULL, NULL, "twenty", "thirty", "forty", "fifty", "sixty", "seventy", "eighty", "ninety",
+};
+
+void phrase_add(phrase_t *phrase, const char *word)
+{
+    if (phrase->count < PHRASE_MAX_WORDS) {
+        phrase->words[phrase->count++] = word;
+    }
+}
+
+// 1..99; larger values are clamped, no command gets near them
+static void phrase_add_number(phrase_t *phrase, int n)
+{
+    if (n > 99) {
+        n = 99;
+    }
+    if (n < 20) {
+        phrase_add(phrase, s_ones[n]);
+        return;
+    }
+    phrase_add(phrase, s_tens[n / 10]);
+    if (n % 10) {
+        phrase_add(phrase, s_ones[n % 10]);
+    }
+}
+
+static void phrase_add_unit(phrase_t *phrase, int n, const char *one, const char *many)
+{
+    if (n > 0) {
+        phrase_add_number(phrase, n);
+        phrase_add(phrase, n == 1 ? one : many);
+    }
+}
+
+void phrase_add_duration(phrase_t *phrase, int seconds)
+{
+    if (seconds <= 0) {
+        phrase_add(phrase, "zero");
+        phrase_add(phrase, "seconds");
+        return;
+    }
+    phrase_add_unit(phrase, seconds / 3600, "hour", "hours");
+    phrase_add_unit(phrase, seconds % 3600 / 60, "minute", "minutes");
+    phrase_add_unit(phrase, seconds % 60, "second", "seconds");
+}
+
+bool phrase_synth_available(const phrase_t *phrase)
+{
+    prompt_t prompt;
+    for (int i = 0; i < phrase->count; i++) {
+        if (prompt_pack_find_by_name(phrase->words[i], &prompt) != ESP_OK) {
+            return false;
+        }
+    }
+    return phrase->count > 0;
+}
+
+void phrase_reader_init(phrase_reader_t *reader, const phrase_t *phrase)
+{
+    reader->phrase = *phrase;
+    reader->next_word = 0;
+    reader->word_open = false;
+    reader->first_block = false;
+    reader->finished = false;
+    reader->xfade = 0;
+    reader->held = 0;
+}
+
+// Open the next word clip; false when the phrase is done
+static bool phrase_reader_next_word(phrase_reader_t *r)
+{
+    prompt_t prompt;
+    while (r->next_word < r->phrase.count) {
+        const char *word = r->phrase.words[r->next_word++];
+        if (prompt_pack_find_by_name(word, &prompt) != ESP_OK) {
+            ESP_LOGW(TAG, "No clip for '%s'", word);
+            continue;
+        }
+        prompt_reader_init(&r->word, &prompt);
+        r->xfade = prompt.sample_rate * PHRASE_CROSSFADE_MS / 1000;
+        if (r->xfade > PHRASE_XFADE_MAX) {
+            r->xfade = PHRASE_XFADE_MAX;
+        }
+        r->word_open = true;
+        r->first_block = true;
+        return true;
+    }
+    return false;
+}
+
+int phrase_reader_read(phrase_reader_t *r, int16_t *out, int max)
+{
+    while (true) {
+        // Everything except the crossfade tail can go out
+        int ready = r->finished ? r->held : r->held - r->xfade;
+        if (ready > 0) {
+            int n = ready < max ? ready : max;
+            memcpy(out, r->work, n * sizeof(int16_t));
+            memmove(r->work, r->work + n, (r->held - n) * sizeof(int16_t));
+            r->held -= n;
+            return n;
+        }
+        if (r->finished) {
+            return 0;
+        }
+
+        if (!r->word_open && !phrase_reader_next_word(r)) {
+            r->finished = true;
+            continue;
+        }
+        int n = prompt_reader_read(&r->word, r->block, PROMPT_READ_SAMPLES);
+        if (n == 0) {
+            r->word_open = false;
+            continue;
+        }
+
+        int k = 0;
+        if (r->first_block && r->held > 0) {
+            // Overlap the start of this word with the held tail of the last one
+            k = r->held < n ? r->held : n;
+            int16_t *tail = r->work + r->held - k;
+            for (int i = 0; i < k; i++) {
+                tail[i] = (int16_t)(((int32_t)tail[i] * (k - i) + (int32_t)r->block[i] * i) / k);
+            }
+        }
+        r->first_block = false;
+        memcpy(r->work + r->held, r->block + k, (n - k) * sizeof(int16_t));
+        r->held += n - k;
+    }
+}
@@ -0,0 +1,605 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Real-time pixel stream receiver: lighting software on a PC drives the ring.
+//
+// Two standard protocols are accepted, each on its own UDP socket and both
+// served by one task blocked in select():
+//
+//   DDP (port 4048)   a 10-byte header (14 with a timecode) and RGB data at
+//                     a byte offset. A frame may span several packets; it is
+//                     shown when the packet with the PUSH flag arrives.
+//   E1.31 / sACN      a 126-byte ACN header and one DMX universe of up to 512
+//   (port 5568)       channels. Frames are shown per packet, or, when the
+//                     sender sets a sync address, on the matching universe
+//                     sync packet. The universe's multicast group is joined,
+//                     so both unicast and multicast senders work.
+//
+// Packets are read into one receive buffer and the RGB payload is handed to
+// main.c, which writes it straight into the strip driver's pixel buffer: the
+// animation frame buffer is not involved and nothing is copied in between.
+// The first shown frame takes the ring over from the local idle animation
+// (and the spectrum mode); voice feedback and a running timer still win, and
+// frames arriving meanwhile are only counted. PIXEL_TIMEOUT_MS after the last
+// frame, or at once when an E1.31 sender ends its stream, the ring goes back
+// to the local animations.
+//
+// Both protocols number their packets. A gap counts as lost packets; a
+// packet older than the last one (reordered or repeated by the network) is
+// dropped as late rather than painting stale pixels. Jitter of the frame
+// interval is smoothed as in RFC 3550; when DDP senders include a timecode
+// the transit jitter is tracked too, which is independent of the sender's
+// frame pacing. All of it is served at /api/pixels for tools/pixel_sender.py.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "json_codec.h"
+#include "http_workers.h"
+#include "pixel_stream.h"
+
+#define DDP_HEADER_LEN          10
+#define DDP_TIMECODE_LEN        4
+#define DDP_VERSION_MASK        0xc0
+#define DDP_VERSION_1           0x40
+#define DDP_FLAG_TIMECODE       0x10
+#define DDP_FLAG_STORAGE        0x08
+#define DDP_FLAG_REPLY          0x04
+#define DDP_FLAG_QUERY          0x02
+#define DDP_FLAG_PUSH           0x01
+#define DDP_ID_DISPLAY          1
+#define DDP_ID_ALL              255
+#define DDP_SEQ_MOD             15      // sequence numbers 1..15, 0 = not used
+
+#define E131_SYNC_LEN           49
+#define E131_DATA_OFFSET        126
+#define E131_VECTOR_ROOT_DATA   0x00000004
+#define E131_VECTOR_ROOT_EXTENDED 0x00000008
+#define E131_VECTOR_DATA        0x00000002
+#define E131_VECTOR_SYNC        0x00000001
+#define E131_VECTOR_DMP         0x02
+#define E131_OPT_PREVIEW        0x80
+#define E131_OPT_TERMINATED     0x40
+#define E131_SEQ_WINDOW         20      // E1.31 6.7.2: up to this far behind is out of order
+
+#define PIXEL_JITTER_MAX_US     1000000 // a larger step is a sender restart, not jitter
+
+static const char *TAG = "PIXEL_STREAM";
+
+static const uint8_t e131_acn_id[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+
+typedef enum {
+    PIXEL_SRC_DDP,
+    PIXEL_SRC_E131,
+    PIXEL_SRC_COUNT
+} pixel_source_t;
+
+static const char *source_names[PIXEL_SRC_COUNT] = { "ddp", "e131" };
+
+static const pixel_stream_ops_t *s_ops = NULL;
+static int s_ddp_sock = -1;
+static int s_e131_sock = -1;
+static atomic_bool s_enabled = true;
+static atomic_bool s_live = false;
+static atomic_uint s_last_frame_ms = 0;
+
+// Receive task only
+static struct {
+    uint8_t last_seq;           // 0 = none yet
+    bool suppressed;            // a packet of this frame found the ring busy
+} s_ddp;
+
+static struct {
+    int last_seq;               // -1 = none yet
+    uint16_t sync_universe;     // data is waiting for this sync packet, 0 = none
+    uint16_t joined_sync;
+    bool suppressed;
+} s_e131 = { .last_seq = -1 };
+
+static struct {
+    pixel_source_t source;      // of the last frame shown
+    uint32_t packets[PIXEL_SRC_COUNT];
+    uint32_t frames;            // shown on the ring
+    uint32_t suppressed;        // arrived while voice feedback or a timer had the ring
+    uint32_t lost;              // sequence gaps
+    uint32_t late;              // older than the last packet, dropped
+    uint32_t bad;               // malformed or unsupported
+    uint32_t takeovers;         // streams that took the ring over
+    uint32_t timeouts;          // streams that went quiet
+    float fps;
+    float interval_jitter_us;
+    float transit_jitter_us;    // DDP with timecode only
+    perf_counter_t write_cycles;        // one packet into the strip buffer
+    perf_counter_t show_us;             // strip refresh
+    perf_counter_t latency_us;          // last packet of a frame received until shown
+} s_stats;
+
+static int64_t s_last_frame_us = 0;
+static int64_t s_last_interval_us = 0;
+static int64_t s_last_transit_us = 0;
+static bool s_have_transit = false;
+static int64_t s_fps_start = 0;
+static uint32_t s_fps_frames = 0;
+
+static uint16_t be16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void pixel_save(bool enable)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(PIXEL_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_u8(nvs_handle, "enabled", enable);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving pixel stream state: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static bool pixel_load(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(PIXEL_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return true;
+    }
+    uint8_t enabled = 1;
+    nvs_get_u8(nvs_handle, "enabled", &enabled);
+    nvs_close(nvs_handle);
+    return enabled != 0;
+}
+
+static void pixel_reset_sequences(void)
+{
+    s_ddp.last_seq = 0;
+    s_ddp.suppressed = false;
+    s_e131.last_seq = -1;
+    s_e131.sync_universe = 0;
+    s_e131.suppressed = false;
+    s_have_transit = false;
+    s_last_frame_us = 0;
+    s_last_interval_us = 0;
+}
+
+static void pixel_release(const char *why)
+{
+    if (atomic_exchange(&s_live, false)) {
+        ESP_LOGI(TAG, "Stream %s, back to local animations", why);
+    }
+    pixel_reset_sequences();
+}
+
+// The last packet of a frame is in: show it and update the timing stats
+static void pixel_frame_done(pixel_source_t source, bool suppressed, int64_t received_us)
+{
+    int64_t now = esp_timer_get_time();
+    atomic_store(&s_last_frame_ms, (uint32_t)(now / 1000));
+    if (!atomic_exchange(&s_live, true)) {
+        s_stats.takeovers++;
+        s_fps_start = now;
+        s_fps_frames = 0;
+        ESP_LOGI(TAG, "%s stream took over the ring", source_names[source]);
+    }
+    if (suppressed) {
+        s_stats.suppressed++;
+        return;
+    }
+
+    s_ops->show();
+    int64_t shown = esp_timer_get_time();
+    perf_counter_add(&s_stats.show_us, shown - now);
+    perf_counter_add(&s_stats.latency_us, shown - received_us);
+    s_stats.frames++;
+    s_stats.source = source;
+
+    if (s_last_frame_us) {
+        int64_t interval = received_us - s_last_frame_us;
+        if (s_last_interval_us) {
+            int64_t d = llabs(interval - s_last_interval_us);
+            if (d < PIXEL_JITTER_MAX_US) {
+                s_stats.interval_jitter_us += (d - s_stats.interval_jitter_us) / 16;
+            }
+        }
+        s_last_interval_us = interval;
+    }
+    s_last_frame_us = received_us;
+
+    s_fps_frames++;
+    if (shown - s_fps_start >= 1000000) {
+        s_stats.fps = s_fps_frames * 1e6f / (shown - s_fps_start);
+        s_fps_start = shown;
+        s_fps_frames = 0;
+    }
+}
+
+// A packet behind the last one is dropped; unless it repeats the last one
+// it is what the gap before counted as lost, so it is only late after all
+static void pixel_late(bool reordered)
+{
+    s_stats.late++;
+    if (reordered && s_stats.lost > 0) {
+        s_stats.lost--;
+    }
+}
+
+// Write payload pixels from byte offset; false when the ring was busy
+static bool pixel_write(uint32_t offset, const uint8_t *rgb, uint32_t len)
+{
+    int first = offset / 3;
+    int count = len / 3;
+    if (first >= s_ops->leds || count == 0) {
+        return true;
+    }
+    if (count > s_ops->leds - first) {
+        count = s_ops->leds - first;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    bool ok = s_ops->write(first, rgb, count);
+    perf_counter_add(&s_stats.write_cycles, esp_cpu_get_cycle_count() - start);
+    return ok;
+}
+
+static void pixel_handle_ddp(const uint8_t *p, int n, int64_t now)
+{
+    s_stats.packets[PIXEL_SRC_DDP]++;
+    if (n < DDP_HEADER_LEN || (p[0] & DDP_VERSION_MASK) != DDP_VERSION_1) {
+        s_stats.bad++;
+        return;
+    }
+    uint8_t flags = p[0];
+    uint8_t id = p[3];
+    if ((flags & (DDP_FLAG_QUERY | DDP_FLAG_REPLY | DDP_FLAG_STORAGE)) ||
+        (id != 0 && id != DDP_ID_DISPLAY && id != DDP_ID_ALL)) {
+        s_stats.bad++;          // status, config and storage requests are not served
+        return;
+    }
+    int header = DDP_HEADER_LEN + (flags & DDP_FLAG_TIMECODE ? DDP_TIMECODE_LEN : 0);
+    uint32_t offset = be32(p + 4);
+    uint16_t len = be16(p + 8);
+    if (n < header + len || offset % 3) {
+        s_stats.bad++;
+        return;
+    }
+
+    uint8_t seq = p[1] & 0x0f;
+    if (seq) {
+        if (s_ddp.last_seq) {
+            int diff = (seq - s_ddp.last_seq + DDP_SEQ_MOD) % DDP_SEQ_MOD;
+            if (diff == 0 || diff > DDP_SEQ_MOD / 2) {
+                pixel_late(diff != 0);
+                return;
+            }
+            s_stats.lost += diff - 1;
+        }
+        s_ddp.last_seq = seq;
+    }
+
+    if (!pixel_write(offset, p + header, len)) {
+        s_ddp.suppressed = true;
+    }
+    if (!(flags & DDP_FLAG_PUSH)) {
+        return;
+    }
+    if (flags & DDP_FLAG_TIMECODE) {
+        // 16.16 seconds on the sender's clock; only differences matter
+        int64_t sent_us = ((int64_t)be32(p + DDP_HEADER_LEN) * 1000000) >> 16;
+        int64_t transit = now - sent_us;
+        if (s_have_transit) {
+            int64_t d = llabs(transit - s_last_transit_us);
+            if (d < PIXEL_JITTER_MAX_US) {
+                s_stats.transit_jitter_us += (d - s_stats.transit_jitter_us) / 16;
+            }
+        }
+        s_last_transit_us = transit;
+        s_have_transit = true;
+    }
+    pixel_frame_done(PIXEL_SRC_DDP, s_ddp.suppressed, now);
+    s_ddp.suppressed = false;
+}
+
+static void pixel_join(uint16_t universe)
+{
+    // E1.31 multicast group for a universe: 239.255.<hi>.<lo>
+    struct ip_mreq mreq = {
+        .imr_multiaddr.s_addr = htonl(0xefff0000 | universe),
+        .imr_interface.s_addr = htonl(INADDR_ANY),
+    };
+    if (setsockopt(s_e131_sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+        ESP_LOGW(TAG, "Could not join universe %u multicast: errno %d", universe, errno);
+    }
+}
+
+static void pixel_handle_e131(const uint8_t *p, int n, int64_t now)
+{
+    s_stats.packets[PIXEL_SRC_E131]++;
+    if (n < E131_SYNC_LEN || be16(p) != 0x0010 || memcmp(p + 4, e131_acn_id, sizeof(e131_acn_id)) != 0) {
+        s_stats.bad++;
+        return;
+    }
+    uint32_t root_vector = be32(p + 18);
+    if (root_vector == E131_VECTOR_ROOT_EXTENDED) {
+        if (be32(p + 40) == E131_VECTOR_SYNC && s_e131.sync_universe &&
+            be16(p + 45) == s_e131.sync_universe) {
+            s_e131.sync_universe = 0;
+            pixel_frame_done(PIXEL_SRC_E131, s_e131.suppressed, now);
+            s_e131.suppressed = false;
+        }
+        return;
+    }
+    if (root_vector != E131_VECTOR_ROOT_DATA || n < E131_DATA_OFFSET ||
+        be32(p + 40) != E131_VECTOR_DATA || p[117] != E131_VECTOR_DMP) {
+        s_stats.bad++;
+        return;
+    }
+    if (be16(p + 113) != PIXEL_E131_UNIVERSE || (p[112] & E131_OPT_PREVIEW) || p[125] != 0) {
+        return;                 // other universes, preview data and non-dimmer start codes
+    }
+    if (p[112] & E131_OPT_TERMINATED) {
+        pixel_release("terminated by sender");
+        return;
+    }
+
+    uint8_t seq = p[111];
+    if (s_e131.last_seq >= 0) {
+        int8_t diff = (int8_t)(seq - s_e131.last_seq);
+        if (diff <= 0 && diff > -E131_SEQ_WINDOW) {
+            pixel_late(diff != 0);
+            return;
+        }
+        if (diff > 1) {
+            s_stats.lost += diff - 1;
+        }
+    }
+    s_e131.last_seq = seq;
+
+    uint16_t channels = be16(p + 123) - 1;     // the count includes the start code
+    if (channels > 512 || n < E131_DATA_OFFSET + channels) {
+        s_stats.bad++;
+        return;
+    }
+    if (!pixel_write(0, p + E131_DATA_OFFSET, channels)) {
+        s_e131.suppressed = true;
+    }
+
+    uint16_t sync = be16(p + 109);
+    if (sync) {
+        if (sync != s_e131.joined_sync && sync != PIXEL_E131_UNIVERSE) {
+            pixel_join(sync);
+            s_e131.joined_sync = sync;
+        }
+        s_e131.sync_universe = sync;
+        return;
+    }
+    pixel_frame_done(PIXEL_SRC_E131, s_e131.suppressed, now);
+    s_e131.suppressed = false;
+}
+
+static void pixel_stream_task(void *arg)
+{
+    static uint8_t packet[PIXEL_MAX_PACKET];
+    int max_fd = (s_ddp_sock > s_e131_sock ? s_ddp_sock : s_e131_sock) + 1;
+
+    while (1) {
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(s_ddp_sock, &fds);
+        FD_SET(s_e131_sock, &fds);
+        struct timeval tv = { .tv_sec = 0, .tv_usec = 250 * 1000 };
+        int ready = select(max_fd, &fds, NULL, NULL, &tv);
+
+        if (atomic_load(&s_live) && !atomic_load(&s_enabled)) {
+            pixel_release("turned off");
+        } else if (atomic_load(&s_live) && !pixel_stream_active()) {
+            s_stats.timeouts++;
+            pixel_release("timed out");
+        }
+        if (ready < 0) {
+            ESP_LOGW(TAG, "select failed: errno %d", errno);
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        for (int src = 0; src < PIXEL_SRC_COUNT && ready > 0; src++) {
+            int sock = src == PIXEL_SRC_DDP ? s_ddp_sock : s_e131_sock;
+            if (!FD_ISSET(sock, &fds)) {
+                continue;
+            }
+            int n = recv(sock, packet, sizeof(packet), 0);
+            if (n <= 0 || !atomic_load(&s_enabled)) {
+                continue;
+            }
+            int64_t now = esp_timer_get_time();
+            if (src == PIXEL_SRC_DDP) {
+                pixel_handle_ddp(packet, n, now);
+            } else {
+                pixel_handle_e131(packet, n, now);
+            }
+        }
+    }
+}
+
+static int pixel_bind(uint16_t port)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket: errno %d", errno);
+        return -1;
+    }
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        ESP_LOGE(TAG, "Failed to bind port %d: errno %d", port, errno);
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+esp_err_t pixel_stream_start(const pixel_stream_ops_t *ops)
+{
+    if (s_ddp_sock >= 0) {
+        return ESP_OK;
+    }
+    s_ops = ops;
+    atomic_store(&s_enabled, pixel_load());
+    s_ddp_sock = pixel_bind(PIXEL_DDP_PORT);
+    s_e131_sock = pixel_bind(PIXEL_E131_PORT);
+    if (s_ddp_sock < 0 || s_e131_sock < 0) {
+        goto fail;
+    }
+    pixel_join(PIXEL_E131_UNIVERSE);
+    if (xTaskCreatePinnedToCore(&pixel_stream_task, "pixel_stream", 3 * 1024, NULL, 5, NULL, 0) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create pixel stream task");
+        goto fail;
+    }
+    ESP_LOGI(TAG, "Pixel stream %s: DDP on %d, E1.31 universe %d on %d", atomic_load(&s_enabled) ? "on" : "off",
+             PIXEL_DDP_PORT, PIXEL_E131_UNIVERSE, PIXEL_E131_PORT);
+    return ESP_OK;
+
+fail:
+    if (s_ddp_sock >= 0) {
+        close(s_ddp_sock);
+        s_ddp_sock = -1;
+    }
+    if (s_e131_sock >= 0) {
+        close(s_e131_sock);
+        s_e131_sock = -1;
+    }
+    return ESP_FAIL;
+}
+
+bool pixel_stream_active(void)
+{
+    if (!atomic_load(&s_live) || !atomic_load(&s_enabled)) {
+        return false;
+    }
+    uint32_t now_ms = esp_timer_get_time() / 1000;
+    return now_ms - atomic_load(&s_last_frame_ms) < PIXEL_TIMEOUT_MS;
+}
+
+bool pixel_stream_enabled(void)
+{
+    return atomic_load(&s_enabled);
+}
+
+void pixel_stream_set_enabled(bool enable)
+{
+    // The receive task lets go of the ring on its next select timeout
+    if (atomic_exchange(&s_enabled, enable) == enable) {
+        return;
+    }
+    pixel_save(enable);
+    ESP_LOGI(TAG, "Pixel stream %s", enable ? "on" : "off");
+}
+
+// Body of POST /api/pixels
+typedef struct {
+    bool enabled;
+    bool reset;
+} pixel_request_t;
+
+static const json_field_t pixel_schema[] = {
+    JSON_FIELD_BOOL(pixel_request_t, enabled, "enabled"),
+    JSON_FIELD_BOOL(pixel_request_t, reset, "reset"),
+};
+
+static esp_err_t pixel_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[96];
+        pixel_request_t body = { .enabled = pixel_stream_enabled() };
+        if (json_recv_request(req, buf, sizeof(buf), pixel_schema,
+                              sizeof(pixel_schema) / sizeof(pixel_schema[0]), &body) != ESP_OK) {
+            return ESP_OK;
+        }
+        pixel_stream_set_enabled(body.enabled);
+        if (body.reset) {
+            pixel_source_t source = s_stats.source;
+            memset(&s_stats, 0, sizeof(s_stats));
+            s_stats.source = source;
+        }
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "enabled", pixel_stream_enabled());
+    cJSON_AddBoolToObject(response, "active", pixel_stream_active());
+    cJSON_AddStringToObject(response, "source", source_names[s_stats.source]);
+    cJSON_AddNumberToObject(response, "ddp_port", PIXEL_DDP_PORT);
+    cJSON_AddNumberToObject(response, "e131_port", PIXEL_E131_PORT);
+    cJSON_AddNumberToObject(response, "e131_universe", PIXEL_E131_UNIVERSE);
+    cJSON_AddNumberToObject(response, "leds", s_ops ? s_ops->leds : 0);
+    cJSON_AddNumberToObject(response, "timeout_ms", PIXEL_TIMEOUT_MS);
+
+    cJSON *packets = cJSON_AddObjectToObject(response, "packets");
+    for (int i = 0; i < PIXEL_SRC_COUNT; i++) {
+        cJSON_AddNumberToObject(packets, source_names[i], s_stats.packets[i]);
+    }
+    cJSON_AddNumberToObject(response, "frames", s_stats.frames);
+    cJSON_AddNumberToObject(response, "fps", pixel_stream_active() ? s_stats.fps : 0);
+    cJSON_AddNumberToObject(response, "suppressed", s_stats.suppressed);
+    cJSON_AddNumberToObject(response, "lost", s_stats.lost);
+    cJSON_AddNumberToObject(response, "late", s_stats.late);
+    cJSON_AddNumberToObject(response, "bad", s_stats.bad);
+    cJSON_AddNumberToObject(response, "takeovers", s_stats.takeovers);
+    cJSON_AddNumberToObject(response, "timeouts", s_stats.timeouts);
+
+    cJSON *timing = cJSON_AddObjectToObject(response, "timing");
+    cJSON_AddNumberToObject(timing, "interval_jitter_ms", s_stats.interval_jitter_us / 1000.0f);
+    cJSON_AddNumberToObject(timing, "transit_jitter_ms", s_stats.transit_jitter_us / 1000.0f);
+    cJSON_AddNumberToObject(timing, "latency_us_avg", perf_counter_avg(&s_stats.latency_us));
+    cJSON_AddNumberToObject(timing, "latency_us_max", s_stats.latency_us.max);
+    cJSON_AddNumberToObject(timing, "show_us_avg", perf_counter_avg(&s_stats.show_us));
+    cJSON_AddNumberToObject(timing, "show_us_max", s_stats.show_us.max);
+    cJSON_AddNumberToObject(timing, "write_cycles_avg", perf_counter_avg(&s_stats.write_cycles));
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t pixel_stream_register_http(httpd_handle_t server)
+{
+    httpd_uri_t pixel_get_uri = {
+        .uri = "/api/pixels",
+        .method = HTTP_GET,
+        .handler = pixel_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &pixel_get_uri);
+
+    // Saving the on/off state commits to NVS
+    httpd_uri_t pixel_post_uri = pixel_get_uri;
+    pixel_post_uri.method = HTTP_POST;
+    return http_workers_register(server, &pixel_post_uri);
+}
@@ -0,0 +1,248 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Voice prompts from the "prompts" partition.
+//
+// The whole partition is mapped once with esp_partition_mmap. Prompts are
+// read through prompt_reader_t: PCM is copied straight from the mapping,
+// IMA-ADPCM (the default, a quarter of the size) is decoded one block at a
+// time into the caller's buffer. The pack can be reflashed on its own
+// (tools/mkprompts.py --flash).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_partition.h"
+#include "cJSON.h"
+#include "adpcm.h"
+#include "perf_monitor.h"
+#include "prompt_pack.h"
+
+static const char *TAG = "PROMPTS";
+
+static const uint8_t *s_base = NULL;
+static const prompt_pack_entry_t *s_entries = NULL;
+static int s_count = 0;
+
+// Scratch output for the boot-time benchmark
+static int16_t s_bench_pcm[ADPCM_BLOCK_SAMPLES];
+
+// Decode cost per ADPCM block, from the boot benchmark and from playback
+static perf_counter_t s_bench_cycles;
+static uint64_t s_bench_samples = 0;
+static uint32_t s_bench_rate = 0;
+static perf_counter_t s_play_cycles;
+static uint64_t s_play_samples = 0;
+
+static void prompt_pack_bench(void)
+{
+    perf_counter_reset(&s_bench_cycles);
+    s_bench_samples = 0;
+    for (int i = 0; i < s_count; i++) {
+        const prompt_pack_entry_t *e = &s_entries[i];
+        if (e->format != PROMPT_FORMAT_IMA_ADPCM) {
+            continue;
+        }
+        const uint8_t *data = s_base + e->offset;
+        for (uint32_t pos = 0; pos < e->length; pos += ADPCM_BLOCK_BYTES) {
+            uint32_t bytes = e->length - pos < ADPCM_BLOCK_BYTES ? e->length - pos : ADPCM_BLOCK_BYTES;
+            uint32_t start = esp_cpu_get_cycle_count();
+            int n = adpcm_decode_block(data + pos, bytes, s_bench_pcm);
+            perf_counter_add(&s_bench_cycles, esp_cpu_get_cycle_count() - start);
+            s_bench_samples += n;
+        }
+        s_bench_rate = e->sample_rate;
+    }
+}
+
+// Decode cycles per second of audio, 0 before any ADPCM has been decoded
+static uint32_t prompt_pack_cycles_per_second(uint64_t cycles, uint64_t samples)
+{
+    return samples ? (uint32_t)(cycles * s_bench_rate / samples) : 0;
+}
+
+esp_err_t prompt_pack_init(void)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           PROMPT_PACK_PARTITION);
+    if (!part) {
+        ESP_LOGE(TAG, "No '%s' partition", PROMPT_PACK_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    const void *base;
+    esp_partition_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &base, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map prompt partition: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    const prompt_pack_header_t *header = (const prompt_pack_header_t *)base;
+    if (memcmp(header->magic, PROMPT_PACK_MAGIC, 4) != 0 || header->version != PROMPT_PACK_VERSION) {
+        ESP_LOGE(TAG, "Prompt partition is empty or has an unknown format, flash it with idf.py flash");
+        esp_partition_munmap(handle);
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    const prompt_pack_entry_t *entries = (const prompt_pack_entry_t *)((const uint8_t *)base + sizeof(*header));
+    if (sizeof(*header) + header->count * sizeof(*entries) > part->size) {
+        esp_partition_munmap(handle);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    for (int i = 0; i < header->count; i++) {
+        if ((uint64_t)entries[i].offset + entries[i].length > part->size) {
+            ESP_LOGE(TAG, "Prompt %u out of bounds", entries[i].id);
+            esp_partition_munmap(handle);
+            return ESP_ERR_INVALID_SIZE;
+        }
+        if (entries[i].format == PROMPT_FORMAT_IMA_ADPCM && entries[i].channels != 1) {
+            ESP_LOGE(TAG, "Prompt %u: ADPCM prompts must be mono", entries[i].id);
+            esp_partition_munmap(handle);
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+    }
+
+    // The mapping stays for the lifetime of the app
+    s_base = base;
+    s_entries = entries;
+    s_count = header->count;
+    ESP_LOGI(TAG, "%d prompts mapped from '%s' at 0x%lx", s_count, PROMPT_PACK_PARTITION,
+             (unsigned long)part->address);
+
+    prompt_pack_bench();
+    if (s_bench_samples) {
+        uint32_t per_second = prompt_pack_cycles_per_second(s_bench_cycles.total, s_bench_samples);
+        ESP_LOGI(TAG, "ADPCM decode: %lu cycles per second of audio (%.2f%% of one core), %lu cycles/block max",
+                 (unsigned long)per_second, perf_cycles_to_us(per_second) / 1e4f, (unsigned long)s_bench_cycles.max);
+    }
+    return ESP_OK;
+}
+
+static void prompt_from_entry(const prompt_pack_entry_t *e, prompt_t *out)
+{
+    out->name = e->name;
+    out->id = e->id;
+    out->format = (prompt_format_t)e->format;
+    out->channels = e->channels;
+    out->sample_rate = e->sample_rate;
+    out->data = s_base + e->offset;
+    out->length = e->length;
+    out->samples = e->samples;
+}
+
+esp_err_t prompt_pack_find(uint16_t id, prompt_t *out)
+{
+    for (int i = 0; i < s_count; i++) {
+        if (s_entries[i].id == id) {
+            prompt_from_entry(&s_entries[i], out);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t prompt_pack_find_by_name(const char *name, prompt_t *out)
+{
+    for (int i = 0; i < s_count; i++) {
+        if (strncmp(s_entries[i].name, name, PROMPT_NAME_LEN) == 0) {
+            prompt_from_entry(&s_entries[i], out);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+void prompt_reader_init(prompt_reader_t *reader, const prompt_t *prompt)
+{
+    reader->prompt = *prompt;
+    reader->pos = 0;
+    reader->remaining = prompt->format == PROMPT_FORMAT_PCM16 ? prompt->length / sizeof(int16_t) : prompt->samples;
+}
+
+int prompt_reader_read(prompt_reader_t *reader, int16_t *out, int max)
+{
+    const prompt_t *p = &reader->prompt;
+    int n = 0;
+    if (reader->remaining == 0 || max < PROMPT_READ_SAMPLES) {
+        return 0;
+    }
+
+    if (p->format == PROMPT_FORMAT_PCM16) {
+        n = reader->remaining < (uint32_t)max ? reader->remaining : max;
+        memcpy(out, p->data + reader->pos, n * sizeof(int16_t));
+        reader->pos += n * sizeof(int16_t);
+    } else if (p->format == PROMPT_FORMAT_IMA_ADPCM && reader->pos < p->length) {
+        uint32_t bytes = p->length - reader->pos < ADPCM_BLOCK_BYTES ? p->length - reader->pos : ADPCM_BLOCK_BYTES;
+        uint32_t start = esp_cpu_get_cycle_count();
+        n = adpcm_decode_block(p->data + reader->pos, bytes, out);
+        perf_counter_add(&s_play_cycles, esp_cpu_get_cycle_count() - start);
+        s_play_samples += n;
+        reader->pos += bytes;
+        // The last block is padded to a whole byte
+        if ((uint32_t)n > reader->remaining) {
+            n = reader->remaining;
+        }
+    }
+    reader->remaining = n ? reader->remaining - n : 0;
+    return n;
+}
+
+static esp_err_t prompts_api_handler(httpd_req_t *req)
+{
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "mapped", s_base != NULL);
+
+    uint32_t compressed = 0, pcm = 0;
+    cJSON *list = cJSON_AddArrayToObject(response, "prompts");
+    for (int i = 0; i < s_count; i++) {
+        const prompt_pack_entry_t *e = &s_entries[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddNumberToObject(item, "id", e->id);
+        cJSON_AddStringToObject(item, "name", e->name);
+        cJSON_AddStringToObject(item, "format", e->format == PROMPT_FORMAT_IMA_ADPCM ? "ima_adpcm" : "pcm16");
+        cJSON_AddNumberToObject(item, "sample_rate", e->sample_rate);
+        cJSON_AddNumberToObject(item, "duration_ms", e->sample_rate ? (uint64_t)e->samples * 1000 / e->sample_rate : 0);
+        cJSON_AddNumberToObject(item, "bytes", e->length);
+        cJSON_AddItemToArray(list, item);
+        compressed += e->length;
+        pcm += e->samples * e->channels * sizeof(int16_t);
+    }
+    cJSON_AddNumberToObject(response, "bytes", compressed);
+    cJSON_AddNumberToObject(response, "pcm_bytes", pcm);
+
+    cJSON *decode = cJSON_AddObjectToObject(response, "decode");
+    uint32_t bench = prompt_pack_cycles_per_second(s_bench_cycles.total, s_bench_samples);
+    cJSON_AddNumberToObject(decode, "bench_cycles_per_audio_second", bench);
+    cJSON_AddNumberToObject(decode, "bench_core_percent", perf_cycles_to_us(bench) / 1e4f);
+    cJSON_AddNumberToObject(decode, "block_cycles_avg", perf_counter_avg(&s_bench_cycles));
+    cJSON_AddNumberToObject(decode, "block_cycles_max", s_bench_cycles.max);
+    cJSON_AddNumberToObject(decode, "play_cycles_per_audio_second",
+                            prompt_pack_cycles_per_second(s_play_cycles.total, s_play_samples));
+    cJSON_AddNumberToObject(decode, "play_block_cycles_max", s_play_cycles.max);
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t prompt_pack_register_http(httpd_handle_t server)
+{
+    httpd_uri_t prompts_get_uri = {
+        .uri = "/api/prompts",
+        .method = HTTP_GET,
+        .handler = prompts_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &prompts_get_uri);
+}
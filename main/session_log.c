@@ -0,0 +1,722 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Timer session log: one fixed-size record per finished timer, appended to
+// the "sessions" data partition and never rewritten.
+//
+// The partition is a ring of 4 KB sectors holding 64 records each. Records
+// carry an increasing sequence number and a CRC-32, and are only ever
+// programmed into erased (0xFF) slots; when the sector being appended to is
+// full the next one, which holds the oldest records, is erased and becomes
+// the head. Every sector is therefore erased once per trip around the ring,
+// the least wear the partition allows. A write torn by a power cut leaves a
+// slot that fails its CRC; the scan counts it and moves on.
+//
+// At boot the whole log is read once, a page at a time, to build the index:
+// per sector the first/last sequence number and the earliest/latest start
+// time, 20 bytes each. Queries use it to skip every sector outside the
+// requested range and read only the pages of the rest, so lookups cost the
+// same however old the log is and nothing is loaded into RAM.
+//
+// The part above is plain C and also builds on the host, where
+// tools/session_log_sim.c runs it against a simulated NOR flash through
+// months of use and power cuts. The ESP_PLATFORM part follows the timer
+// from main.c's hooks, keeps finished sessions in RAM until they fill the
+// head flash page to its end (4 records once pages are aligned), or
+// SESSION_FLUSH_MS has passed, or the device restarts, and writes them from
+// its own task in a single write. After a part page, the next batch only
+// tops that page up, so later batches start on a page boundary again. Records
+// are streamed from /api/sessions in chunks while the log is read.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "session_log.h"
+
+_Static_assert(sizeof(session_record_t) == SESSION_RECORD_SIZE, "session record size");
+
+#define SESSION_CRC_LEN offsetof(session_record_t, crc)
+
+uint32_t session_crc32(const void *data, size_t len)
+{
+    const uint8_t *p = data;
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static bool session_erased(const session_record_t *r)
+{
+    const uint8_t *p = (const uint8_t *)r;
+    for (size_t i = 0; i < sizeof(*r); i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool session_valid(const session_record_t *r)
+{
+    return r->seq != 0 && r->seq != UINT32_MAX && r->crc == session_crc32(r, SESSION_CRC_LEN);
+}
+
+static void session_index_add(session_sector_t *sector, const session_record_t *r)
+{
+    if (!sector->first_seq) {
+        sector->first_seq = r->seq;
+    }
+    sector->last_seq = r->seq;
+    sector->valid++;
+    if (r->start_unix) {
+        if (!sector->min_unix || r->start_unix < sector->min_unix) {
+            sector->min_unix = r->start_unix;
+        }
+        if (r->start_unix > sector->max_unix) {
+            sector->max_unix = r->start_unix;
+        }
+    }
+}
+
+static bool session_matches(const session_record_t *r, uint32_t from_unix, uint32_t to_unix, uint32_t after_seq)
+{
+    if (r->seq <= after_seq) {
+        return false;
+    }
+    if (!from_unix && !to_unix) {
+        return true;
+    }
+    return r->start_unix && r->start_unix >= from_unix && (!to_unix || r->start_unix <= to_unix);
+}
+
+int session_log_mount(session_log_t *log, const session_flash_t *flash)
+{
+    memset(log, 0, sizeof(*log));
+    log->flash = flash;
+    log->sectors = flash->size / SESSION_SECTOR_SIZE;
+    if (log->sectors < 2 || log->sectors > SESSION_MAX_SECTORS) {
+        return -1;
+    }
+
+    session_record_t page[SESSION_BATCH];
+    uint32_t newest = 0;
+    uint16_t boot = 0;
+    for (int s = 0; s < log->sectors; s++) {
+        session_sector_t *sector = &log->index[s];
+        bool end = false;
+        for (int slot = 0; slot < SESSION_RECORDS_PER_SECTOR; slot += SESSION_BATCH) {
+            if (flash->read(flash->ctx, s * SESSION_SECTOR_SIZE + slot * SESSION_RECORD_SIZE, page, sizeof(page))) {
+                return -1;
+            }
+            log->pages_read++;
+            for (int i = 0; i < SESSION_BATCH; i++) {
+                // Slots are filled in order, so the first erased one ends the
+                // sector. Anything written after it is left from an erase cut
+                // short: the sector cannot take appends until erased again.
+                if (session_erased(&page[i])) {
+                    end = true;
+                    continue;
+                }
+                sector->used = end ? SESSION_RECORDS_PER_SECTOR : sector->used + 1;
+                if (!session_valid(&page[i])) {
+                    log->bad++;
+                    continue;
+                }
+                session_index_add(sector, &page[i]);
+                log->records++;
+                if (page[i].seq > newest) {
+                    newest = page[i].seq;
+                    log->head = s;
+                }
+                if (page[i].boot > boot) {
+                    boot = page[i].boot;
+                }
+            }
+        }
+    }
+    log->next_seq = newest + 1;
+    log->boot = boot + 1;
+    return 0;
+}
+
+int session_log_append(session_log_t *log, session_record_t *records, int count)
+{
+    const session_flash_t *flash = log->flash;
+    int done = 0;
+    while (done < count) {
+        session_sector_t *sector = &log->index[log->head];
+        if (sector->used >= SESSION_RECORDS_PER_SECTOR) {
+            // Head is full: the oldest sector goes
+            int next = (log->head + 1) % log->sectors;
+            session_sector_t *oldest = &log->index[next];
+            if (flash->erase(flash->ctx, next * SESSION_SECTOR_SIZE, SESSION_SECTOR_SIZE)) {
+                return -1;
+            }
+            log->erases++;
+            log->records -= oldest->valid;
+            memset(oldest, 0, sizeof(*oldest));
+            log->head = next;
+            continue;
+        }
+
+        int n = count - done;
+        if (n > SESSION_RECORDS_PER_SECTOR - sector->used) {
+            n = SESSION_RECORDS_PER_SECTOR - sector->used;
+        }
+        for (int i = done; i < done + n; i++) {
+            records[i].seq = log->next_seq++;
+            records[i].crc = session_crc32(&records[i], SESSION_CRC_LEN);
+        }
+        uint32_t offset = log->head * SESSION_SECTOR_SIZE + sector->used * SESSION_RECORD_SIZE;
+        int err = flash->write(flash->ctx, offset, &records[done], n * SESSION_RECORD_SIZE);
+        // The slots are spent either way; a failed write reads back as bad records
+        sector->used += n;
+        log->writes++;
+        if (err) {
+            return -1;
+        }
+        for (int i = done; i < done + n; i++) {
+            session_index_add(sector, &records[i]);
+        }
+        log->records += n;
+        done += n;
+    }
+    return 0;
+}
+
+int session_log_page_room(const session_log_t *log)
+{
+    return SESSION_BATCH - log->index[log->head].used % SESSION_BATCH;
+}
+
+int session_log_query(session_log_t *log, uint32_t from_unix, uint32_t to_unix, uint32_t after_seq,
+                      session_visit_t visit, void *arg)
+{
+    const session_flash_t *flash = log->flash;
+    bool dated = from_unix || to_unix;
+    uint32_t to = to_unix ? to_unix : UINT32_MAX;
+    session_record_t page[SESSION_BATCH];
+    int visited = 0;
+
+    // Oldest first: the sector after the head, round to the head
+    for (int k = 1; k <= log->sectors; k++) {
+        int s = (log->head + k) % log->sectors;
+        const session_sector_t *sector = &log->index[s];
+        if (!sector->first_seq || sector->last_seq <= after_seq) {
+            continue;
+        }
+        if (dated && (!sector->max_unix || sector->max_unix < from_unix || sector->min_unix > to)) {
+            continue;
+        }
+        for (int slot = 0; slot < sector->used; slot += SESSION_BATCH) {
+            if (flash->read(flash->ctx, s * SESSION_SECTOR_SIZE + slot * SESSION_RECORD_SIZE, page, sizeof(page))) {
+                return -1;
+            }
+            log->pages_read++;
+            for (int i = 0; i < SESSION_BATCH && slot + i < sector->used; i++) {
+                if (!session_valid(&page[i]) || !session_matches(&page[i], from_unix, to_unix, after_seq)) {
+                    continue;
+                }
+                visited++;
+                if (!visit(&page[i], arg)) {
+                    return visited;
+                }
+            }
+        }
+    }
+    return visited;
+}
+
+#ifdef ESP_PLATFORM
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "esp_partition.h"
+#include "esp_netif_sntp.h"
+#include "cJSON.h"
+#include "json_codec.h"
+#include "http_workers.h"
+#include "perf_monitor.h"
+
+#define SESSION_CHUNK_SIZE      1024
+#define SESSION_SNTP_SERVER     "pool.ntp.org"
+
+static const char *TAG = "SESSION_LOG";
+
+static const char *end_names[] = {"", "completed", "stopped", "replaced", "restart"};
+
+static session_flash_t s_flash;
+static session_log_t s_log;
+static SemaphoreHandle_t s_log_lock = NULL;     // s_log and the partition: writer task and queries
+static TaskHandle_t s_task = NULL;
+
+// Timer hooks run on any task and never wait for flash
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static struct {
+    bool active;
+    bool paused;
+    int64_t start_us;
+    int64_t paused_at_us;
+    int64_t paused_us;
+    session_record_t record;
+} s_open;
+static session_record_t s_pending[SESSION_PENDING_MAX];
+static int s_pending_count = 0;
+static int64_t s_pending_since_us = 0;
+static int s_page_room = SESSION_BATCH;     // records to the end of the head page
+static session_record_t s_batch[SESSION_PENDING_MAX];  // under s_log_lock
+
+static struct {
+    uint32_t sessions;
+    uint32_t flushes;
+    uint32_t flushed;
+    uint32_t dropped;           // pending buffer full
+    uint32_t lost;              // write failed
+    uint32_t queries;
+    int64_t mount_us;
+    uint32_t mount_pages;
+    perf_counter_t write_us;
+    perf_counter_t query_us;
+    perf_counter_t query_pages;
+} s_stats;
+
+static int partition_read(void *ctx, uint32_t offset, void *buf, size_t len)
+{
+    return esp_partition_read(ctx, offset, buf, len) == ESP_OK ? 0 : -1;
+}
+
+static int partition_write(void *ctx, uint32_t offset, const void *buf, size_t len)
+{
+    return esp_partition_write(ctx, offset, buf, len) == ESP_OK ? 0 : -1;
+}
+
+static int partition_erase(void *ctx, uint32_t offset, size_t len)
+{
+    return esp_partition_erase_range(ctx, offset, len) == ESP_OK ? 0 : -1;
+}
+
+void session_log_begin(const char *name, bool countdown, uint32_t seconds, bool remote)
+{
+    if (!s_task) {
+        return;
+    }
+    session_log_end(SESSION_END_REPLACED);
+
+    int64_t now = esp_timer_get_time();
+    time_t wall = time(NULL);
+    session_record_t r;
+    memset(&r, 0, sizeof(r));
+    strncpy(r.name, name, sizeof(r.name) - 1);
+    memset(r.reserved, 0xFF, sizeof(r.reserved));
+    r.start_unix = wall >= SESSION_CLOCK_VALID ? (uint32_t)wall : 0;
+    r.uptime_s = now / 1000000;
+    r.boot = s_log.boot;
+    r.flags = (countdown ? SESSION_FLAG_COUNTDOWN : 0) | (r.start_unix ? SESSION_FLAG_CLOCK : 0) |
+              (remote ? SESSION_FLAG_REMOTE : 0);
+    r.planned_s = seconds;
+
+    portENTER_CRITICAL(&s_mux);
+    s_open.record = r;
+    s_open.active = true;
+    s_open.paused = false;
+    s_open.start_us = now;
+    s_open.paused_us = 0;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void session_log_pause(void)
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    if (s_open.active && !s_open.paused) {
+        s_open.paused = true;
+        s_open.paused_at_us = now;
+        s_open.record.pauses++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void session_log_resume(void)
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    if (s_open.active && s_open.paused) {
+        s_open.paused = false;
+        s_open.paused_us += now - s_open.paused_at_us;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void session_log_add(uint32_t seconds)
+{
+    portENTER_CRITICAL(&s_mux);
+    if (s_open.active) {
+        s_open.record.adds++;
+        s_open.record.added_s += seconds;
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+void session_log_end(session_end_t reason)
+{
+    int64_t now = esp_timer_get_time();
+    bool wake = false;
+    portENTER_CRITICAL(&s_mux);
+    if (s_open.active) {
+        session_record_t *r = &s_open.record;
+        int64_t paused_us = s_open.paused_us + (s_open.paused ? now - s_open.paused_at_us : 0);
+        r->paused_s = paused_us / 1000000;
+        r->run_s = (now - s_open.start_us - paused_us) / 1000000;
+        r->end = reason;
+        if (s_pending_count < SESSION_PENDING_MAX) {
+            if (s_pending_count == 0) {
+                s_pending_since_us = now;
+            }
+            s_pending[s_pending_count++] = *r;
+            wake = s_pending_count >= s_page_room;
+        } else {
+            s_stats.dropped++;
+        }
+        s_stats.sessions++;
+        s_open.active = false;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (wake && s_task) {
+        xTaskNotifyGive(s_task);
+    }
+}
+
+// Write what is pending; with whole_pages only as many as end on a page
+// boundary, the rest waits for the next batch
+static esp_err_t session_log_write(bool whole_pages)
+{
+    if (!s_log_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_log_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_mux);
+    int count = s_pending_count;
+    if (whole_pages) {
+        count = count < s_page_room ? 0 : s_page_room + (count - s_page_room) / SESSION_BATCH * SESSION_BATCH;
+    }
+    memcpy(s_batch, s_pending, count * sizeof(s_batch[0]));
+    s_pending_count -= count;
+    memmove(s_pending, s_pending + count, s_pending_count * sizeof(s_pending[0]));
+    if (s_pending_count) {
+        s_pending_since_us = esp_timer_get_time();
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (count == 0) {
+        xSemaphoreGive(s_log_lock);
+        return ESP_OK;
+    }
+
+    int64_t start = esp_timer_get_time();
+    int err = session_log_append(&s_log, s_batch, count);
+    perf_counter_add(&s_stats.write_us, esp_timer_get_time() - start);
+    int room = session_log_page_room(&s_log);
+    portENTER_CRITICAL(&s_mux);
+    s_page_room = room;
+    portEXIT_CRITICAL(&s_mux);
+    xSemaphoreGive(s_log_lock);
+    if (err) {
+        s_stats.lost += count;
+        ESP_LOGE(TAG, "Failed to write %d sessions", count);
+        return ESP_FAIL;
+    }
+    s_stats.flushes++;
+    s_stats.flushed += count;
+    return ESP_OK;
+}
+
+esp_err_t session_log_flush(void)
+{
+    return session_log_write(false);
+}
+
+static void session_log_task(void *arg)
+{
+    while (1) {
+        portENTER_CRITICAL(&s_mux);
+        int count = s_pending_count;
+        int room = s_page_room;
+        int64_t since = s_pending_since_us;
+        portEXIT_CRITICAL(&s_mux);
+
+        int64_t wait_ms = count ? SESSION_FLUSH_MS - (esp_timer_get_time() - since) / 1000 : 0;
+        if (count && wait_ms <= 0) {
+            session_log_flush();
+            continue;
+        }
+        if (count >= room) {
+            session_log_write(true);
+            continue;
+        }
+        ulTaskNotifyTake(pdTRUE, count ? pdMS_TO_TICKS(wait_ms) + 1 : portMAX_DELAY);
+    }
+}
+
+static void session_log_shutdown(void)
+{
+    session_log_end(SESSION_END_RESTART);
+    session_log_flush();
+}
+
+esp_err_t session_log_init(void)
+{
+    if (s_task) {
+        return ESP_OK;
+    }
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           SESSION_LOG_PARTITION);
+    if (!part) {
+        ESP_LOGE(TAG, "No '%s' partition", SESSION_LOG_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    s_flash.ctx = (void *)part;
+    s_flash.size = part->size - part->size % SESSION_SECTOR_SIZE;
+    s_flash.read = partition_read;
+    s_flash.write = partition_write;
+    s_flash.erase = partition_erase;
+
+    int64_t start = esp_timer_get_time();
+    if (session_log_mount(&s_log, &s_flash) != 0) {
+        ESP_LOGE(TAG, "Cannot read the session log (%lu bytes)", (unsigned long)s_flash.size);
+        return ESP_FAIL;
+    }
+    s_stats.mount_us = esp_timer_get_time() - start;
+    s_stats.mount_pages = s_log.pages_read;
+    s_page_room = session_log_page_room(&s_log);
+    ESP_LOGI(TAG, "%lu sessions in %d sectors, boot %u, scanned in %lld us (%lu bad)",
+             (unsigned long)s_log.records, s_log.sectors, s_log.boot, s_stats.mount_us, (unsigned long)s_log.bad);
+
+    s_log_lock = xSemaphoreCreateMutex();
+    if (!s_log_lock ||
+        xTaskCreatePinnedToCore(&session_log_task, "session_log", 3 * 1024, NULL, 2, &s_task, 1) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create session log task");
+        return ESP_ERR_NO_MEM;
+    }
+    esp_register_shutdown_handler(session_log_shutdown);
+    return ESP_OK;
+}
+
+void session_log_start_clock(void)
+{
+    // Start times need the wall clock; sessions before the first sync are
+    // logged with boot number and uptime only
+    esp_sntp_config_t config = ESP_NETIF_SNTP_DEFAULT_CONFIG(SESSION_SNTP_SERVER);
+    if (esp_netif_sntp_init(&config) != ESP_OK) {
+        ESP_LOGW(TAG, "SNTP not started, sessions will have no start time");
+    }
+}
+
+typedef struct {
+    httpd_req_t *req;
+    uint32_t limit;
+    uint32_t count;
+    esp_err_t err;
+    size_t len;
+    char chunk[SESSION_CHUNK_SIZE];
+} session_stream_t;
+
+static bool session_stream_record(const session_record_t *r, void *arg)
+{
+    session_stream_t *st = arg;
+    char name[sizeof(r->name) + 1];
+    memcpy(name, r->name, sizeof(r->name));
+    name[sizeof(r->name)] = '\0';
+
+    char buf[384];
+    json_writer_t w;
+    json_writer_init(&w, buf, sizeof(buf));
+    json_write_object_begin(&w, NULL);
+    json_write_uint(&w, "seq", r->seq);
+    json_write_uint(&w, "start", r->start_unix);
+    json_write_uint(&w, "boot", r->boot);
+    json_write_uint(&w, "uptime_s", r->uptime_s);
+    json_write_string(&w, "name", name);
+    json_write_string(&w, "end", r->end < sizeof(end_names) / sizeof(end_names[0]) ? end_names[r->end] : "");
+    json_write_bool(&w, "countdown", r->flags & SESSION_FLAG_COUNTDOWN);
+    json_write_bool(&w, "remote", r->flags & SESSION_FLAG_REMOTE);
+    json_write_uint(&w, "planned_s", r->planned_s);
+    json_write_uint(&w, "added_s", r->added_s);
+    json_write_uint(&w, "adds", r->adds);
+    json_write_uint(&w, "run_s", r->run_s);
+    json_write_uint(&w, "paused_s", r->paused_s);
+    json_write_uint(&w, "pauses", r->pauses);
+    json_write_object_end(&w);
+    size_t n = json_writer_finish(&w);
+
+    if (st->len + n + 1 > sizeof(st->chunk)) {
+        st->err = httpd_resp_send_chunk(st->req, st->chunk, st->len);
+        st->len = 0;
+    }
+    if (st->count) {
+        st->chunk[st->len++] = ',';
+    }
+    memcpy(st->chunk + st->len, buf, n);
+    st->len += n;
+    st->count++;
+    return st->err == ESP_OK && (!st->limit || st->count < st->limit);
+}
+
+static uint32_t query_uint(const char *query, const char *key)
+{
+    char value[12];
+    return httpd_query_key_value(query, key, value, sizeof(value)) == ESP_OK ? strtoul(value, NULL, 10) : 0;
+}
+
+static esp_err_t sessions_get_handler(httpd_req_t *req)
+{
+    if (!s_log_lock) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Session log not available");
+        return ESP_FAIL;
+    }
+    char query[96] = "";
+    httpd_req_get_url_query_str(req, query, sizeof(query));
+    uint32_t from = query_uint(query, "from");
+    uint32_t to = query_uint(query, "to");
+    uint32_t after = query_uint(query, "after");
+
+    session_stream_t *st = calloc(1, sizeof(*st));
+    if (!st) {
+        httpd_resp_send_500(req);
+        return ESP_ERR_NO_MEM;
+    }
+    st->req = req;
+    st->limit = query_uint(query, "limit");
+    httpd_resp_set_type(req, "application/json");
+    st->err = httpd_resp_send_chunk(req, "{\"sessions\":[", HTTPD_RESP_USE_STRLEN);
+
+    // The log lock is held while streaming, so a slow client only delays the writer task
+    xSemaphoreTake(s_log_lock, portMAX_DELAY);
+    int64_t start = esp_timer_get_time();
+    uint32_t pages = s_log.pages_read;
+    int found = st->err == ESP_OK ? session_log_query(&s_log, from, to, after, session_stream_record, st) : 0;
+    pages = s_log.pages_read - pages;
+    // Then the finished sessions still waiting for a full page
+    bool more = found >= 0 && st->err == ESP_OK && (!st->limit || st->count < st->limit);
+    for (int i = 0; more; i++) {
+        portENTER_CRITICAL(&s_mux);
+        bool have = i < s_pending_count;
+        session_record_t r = have ? s_pending[i] : (session_record_t){0};
+        portEXIT_CRITICAL(&s_mux);
+        if (!have) {
+            break;
+        }
+        // Not numbered yet: shown after the newest written one
+        r.seq = s_log.next_seq + i;
+        if (session_matches(&r, from, to, after)) {
+            more = session_stream_record(&r, st);
+        }
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    xSemaphoreGive(s_log_lock);
+    s_stats.queries++;
+    perf_counter_add(&s_stats.query_us, elapsed);
+    perf_counter_add(&s_stats.query_pages, pages);
+
+    esp_err_t err = st->err;
+    if (err == ESP_OK) {
+        char tail[96];
+        snprintf(tail, sizeof(tail), "],\"count\":%lu,\"pages_read\":%lu,\"query_us\":%lld}",
+                 (unsigned long)st->count, (unsigned long)pages, elapsed);
+        if (st->len + strlen(tail) > sizeof(st->chunk)) {
+            err = httpd_resp_send_chunk(req, st->chunk, st->len);
+            st->len = 0;
+        }
+        memcpy(st->chunk + st->len, tail, strlen(tail));
+        st->len += strlen(tail);
+    }
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, st->chunk, st->len);
+    }
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    free(st);
+    if (found < 0) {
+        ESP_LOGE(TAG, "Flash read failed during a query");
+    }
+    return err;
+}
+
+static esp_err_t sessions_stats_handler(httpd_req_t *req)
+{
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddNumberToObject(response, "sectors", s_log.sectors);
+    cJSON_AddNumberToObject(response, "capacity", s_log.sectors * SESSION_RECORDS_PER_SECTOR);
+    cJSON_AddNumberToObject(response, "records", s_log.records);
+    cJSON_AddNumberToObject(response, "bad", s_log.bad);
+    cJSON_AddNumberToObject(response, "next_seq", s_log.next_seq);
+    cJSON_AddNumberToObject(response, "boot", s_log.boot);
+    cJSON_AddBoolToObject(response, "clock_set", time(NULL) >= SESSION_CLOCK_VALID);
+    // Every sector is erased once per trip around the ring
+    cJSON_AddNumberToObject(response, "erase_cycles",
+                            s_log.sectors ? (s_log.next_seq - 1) / (s_log.sectors * SESSION_RECORDS_PER_SECTOR) : 0);
+
+    portENTER_CRITICAL(&s_mux);
+    int pending = s_pending_count;
+    bool open = s_open.active;
+    portEXIT_CRITICAL(&s_mux);
+    cJSON_AddNumberToObject(response, "pending", pending);
+    cJSON_AddBoolToObject(response, "open", open);
+
+    cJSON *counts = cJSON_AddObjectToObject(response, "counts");
+    cJSON_AddNumberToObject(counts, "sessions", s_stats.sessions);
+    cJSON_AddNumberToObject(counts, "flushes", s_stats.flushes);
+    cJSON_AddNumberToObject(counts, "flushed", s_stats.flushed);
+    cJSON_AddNumberToObject(counts, "writes", s_log.writes);
+    cJSON_AddNumberToObject(counts, "erases", s_log.erases);
+    cJSON_AddNumberToObject(counts, "dropped", s_stats.dropped);
+    cJSON_AddNumberToObject(counts, "lost", s_stats.lost);
+    cJSON_AddNumberToObject(counts, "queries", s_stats.queries);
+
+    cJSON *timing = cJSON_AddObjectToObject(response, "timing");
+    cJSON_AddNumberToObject(timing, "mount_us", s_stats.mount_us);
+    cJSON_AddNumberToObject(timing, "mount_pages", s_stats.mount_pages);
+    cJSON_AddNumberToObject(timing, "write_us_avg", perf_counter_avg(&s_stats.write_us));
+    cJSON_AddNumberToObject(timing, "write_us_max", s_stats.write_us.max);
+    cJSON_AddNumberToObject(timing, "query_us_avg", perf_counter_avg(&s_stats.query_us));
+    cJSON_AddNumberToObject(timing, "query_us_max", s_stats.query_us.max);
+    cJSON_AddNumberToObject(timing, "query_pages_avg", perf_counter_avg(&s_stats.query_pages));
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t session_log_register_http(httpd_handle_t server)
+{
+    httpd_uri_t sessions_uri = {
+        .uri = "/api/sessions",
+        .method = HTTP_GET,
+        .handler = sessions_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_uri_t stats_uri = {
+        .uri = "/api/sessions/stats",
+        .method = HTTP_GET,
+        .handler = sessions_stats_handler,
+        .user_ctx = NULL
+    };
+    http_workers_register(server, &sessions_uri);
+    return httpd_register_uri_handler(server, &stats_uri);
+}
+#endif
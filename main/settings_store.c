@@ -0,0 +1,399 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Timer settings store: the live copy in RAM, written to NVS in the
+// background.
+//
+// settings_store_set() only compares and copies under a spinlock, marks the
+// settings dirty and wakes the store task. The task waits until the changes
+// have stopped for SETTINGS_QUIET_MS, so dragging a colour picker (dozens of
+// POSTs) costs one flash write; a steady stream is still committed
+// SETTINGS_MAX_DIRTY_MS after its first change. Setting the same values
+// again is not a change. A failed commit is retried, and whatever is
+// uncommitted is written from a shutdown handler on esp_restart().
+//
+// The NVS record is a header (magic, schema version, payload length, CRC-32)
+// followed by the payload. Version 1 is the "TIMER01" blob main.c used to
+// write under "settings"; it is migrated on load and replaced by the new
+// record at the first commit. A schema change bumps SETTINGS_VERSION,
+// freezes the old layout here and adds a step to s_migrations that turns a
+// payload of the old version into the new one; records are migrated one
+// step at a time, so any saved version loads. Fields are only appended, so
+// a record written by newer firmware still reads as its first part.
+//
+// Set/change/commit counts, commit time and time from first change to
+// commit are served at /api/settings/store together with the NVS usage, to
+// confirm that flash writes stay bounded.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "esp_rom_crc.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "settings_store.h"
+
+#define SETTINGS_MAGIC          0x54455354  // "TSET"
+#define SETTINGS_KEY            "store"
+#define SETTINGS_LEGACY_KEY     "settings"
+#define SETTINGS_MAX_PAYLOAD    64
+
+static const char *TAG = "SETTINGS";
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;           // of the payload
+    uint16_t length;            // payload bytes
+    uint32_t crc;               // esp_rom_crc32_le over the payload
+} settings_header_t;
+
+// Version 1: main.c's TimerSettings, stored as is under "settings"
+typedef struct {
+    uint8_t primary[3];
+    uint8_t segment[3];
+    uint8_t end[3];
+    int segments;
+    bool use_end_color;
+    uint8_t brightness;
+    char magic[8];              // "TIMER01"
+} settings_v1_t;
+
+// Turns a payload of version i into version i + 1 in place, returns the new length
+typedef size_t (*settings_migration_t)(uint8_t *payload, size_t length);
+
+static size_t settings_migrate_v1(uint8_t *payload, size_t length)
+{
+    settings_v1_t v1;
+    memcpy(&v1, payload, sizeof(v1));
+    timer_settings_t v2 = {
+        .segments = v1.segments > 0 && v1.segments <= UINT8_MAX ? v1.segments : 4,
+        .use_end_color = v1.use_end_color,
+        .brightness = v1.brightness,
+    };
+    memcpy(v2.primary, v1.primary, 3);
+    memcpy(v2.segment, v1.segment, 3);
+    memcpy(v2.end, v1.end, 3);
+    memcpy(payload, &v2, sizeof(v2));
+    return sizeof(v2);
+}
+
+static const settings_migration_t s_migrations[SETTINGS_VERSION] = {
+    [1] = settings_migrate_v1,
+};
+
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+static timer_settings_t s_current;
+static bool s_dirty = false;
+static int64_t s_dirty_since_us = 0;        // first uncommitted change
+static int64_t s_last_change_us = 0;
+static bool s_legacy = false;               // the TIMER01 blob is still in NVS
+static SemaphoreHandle_t s_write_lock = NULL;
+static TaskHandle_t s_task = NULL;
+
+static struct {
+    int loaded_version;                     // 0 = defaults
+    uint32_t sets;
+    uint32_t changes;
+    uint32_t unchanged;
+    uint32_t commits;
+    uint32_t failures;
+    uint32_t bytes_written;
+    int64_t last_commit_us;
+    perf_counter_t commit_us;
+    perf_counter_t dirty_ms;                // first change to commit
+} s_stats;
+
+static bool settings_load(nvs_handle_t nvs_handle)
+{
+    uint8_t blob[sizeof(settings_header_t) + SETTINGS_MAX_PAYLOAD];
+    uint8_t payload[SETTINGS_MAX_PAYLOAD];
+    size_t size = sizeof(blob);
+    size_t length;
+    int version;
+
+    esp_err_t err = nvs_get_blob(nvs_handle, SETTINGS_KEY, blob, &size);
+    if (err == ESP_OK) {
+        settings_header_t header;
+        if (size < sizeof(header)) {
+            ESP_LOGW(TAG, "Saved settings too short, using defaults");
+            return false;
+        }
+        memcpy(&header, blob, sizeof(header));
+        length = size - sizeof(header);
+        if (header.magic != SETTINGS_MAGIC || header.version == 0 || header.length != length ||
+            header.crc != esp_rom_crc32_le(0, blob + sizeof(header), length)) {
+            ESP_LOGW(TAG, "Invalid or corrupted settings, using defaults");
+            return false;
+        }
+        memcpy(payload, blob + sizeof(header), length);
+        version = header.version;
+    } else if (err == ESP_ERR_NVS_NOT_FOUND) {
+        settings_v1_t v1;
+        size = sizeof(v1);
+        if (nvs_get_blob(nvs_handle, SETTINGS_LEGACY_KEY, &v1, &size) != ESP_OK || size != sizeof(v1) ||
+            memcmp(v1.magic, "TIMER01", 8) != 0) {
+            return false;
+        }
+        memcpy(payload, &v1, sizeof(v1));
+        length = sizeof(v1);
+        version = 1;
+        s_legacy = true;
+    } else {
+        ESP_LOGW(TAG, "Cannot read saved settings (%s), using defaults", esp_err_to_name(err));
+        return false;
+    }
+
+    s_stats.loaded_version = version;
+    for (; version < SETTINGS_VERSION; version++) {
+        length = s_migrations[version](payload, length);
+    }
+    if (length < sizeof(timer_settings_t)) {
+        ESP_LOGW(TAG, "Saved settings version %d too short, using defaults", s_stats.loaded_version);
+        s_stats.loaded_version = 0;
+        return false;
+    }
+    memcpy(&s_current, payload, sizeof(s_current));
+    if (s_stats.loaded_version < SETTINGS_VERSION) {
+        ESP_LOGI(TAG, "Settings migrated from version %d to %d", s_stats.loaded_version, SETTINGS_VERSION);
+    } else if (s_stats.loaded_version > SETTINGS_VERSION) {
+        ESP_LOGW(TAG, "Settings version %d is newer than %d, using the fields this firmware knows",
+                 s_stats.loaded_version, SETTINGS_VERSION);
+    }
+    return true;
+}
+
+static esp_err_t settings_commit(const timer_settings_t *settings)
+{
+    uint8_t blob[sizeof(settings_header_t) + sizeof(*settings)];
+    settings_header_t header = {
+        .magic = SETTINGS_MAGIC,
+        .version = SETTINGS_VERSION,
+        .length = sizeof(*settings),
+        .crc = esp_rom_crc32_le(0, (const uint8_t *)settings, sizeof(*settings)),
+    };
+    memcpy(blob, &header, sizeof(header));
+    memcpy(blob + sizeof(header), settings, sizeof(*settings));
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(SETTINGS_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_set_blob(nvs_handle, SETTINGS_KEY, blob, sizeof(blob));
+    if (err == ESP_OK && s_legacy) {
+        err = nvs_erase_key(nvs_handle, SETTINGS_LEGACY_KEY);
+        if (err == ESP_ERR_NVS_NOT_FOUND) {
+            err = ESP_OK;
+        }
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    nvs_close(nvs_handle);
+    return err;
+}
+
+esp_err_t settings_store_flush(void)
+{
+    if (!s_write_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_write_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&s_mux);
+    bool dirty = s_dirty;
+    timer_settings_t settings = s_current;
+    int64_t since = s_dirty_since_us;
+    s_dirty = false;
+    portEXIT_CRITICAL(&s_mux);
+    if (!dirty) {
+        xSemaphoreGive(s_write_lock);
+        return ESP_OK;
+    }
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = settings_commit(&settings);
+    int64_t end = esp_timer_get_time();
+    if (err == ESP_OK) {
+        s_legacy = false;
+        s_stats.commits++;
+        s_stats.bytes_written += sizeof(settings_header_t) + sizeof(settings);
+        s_stats.last_commit_us = end;
+        perf_counter_add(&s_stats.commit_us, end - start);
+        perf_counter_add(&s_stats.dirty_ms, (end - since) / 1000);
+        ESP_LOGI(TAG, "Settings saved in %lld us", end - start);
+    } else {
+        s_stats.failures++;
+        ESP_LOGE(TAG, "Error saving settings: %s", esp_err_to_name(err));
+        portENTER_CRITICAL(&s_mux);
+        if (!s_dirty) {
+            s_dirty = true;
+            s_dirty_since_us = since;
+        }
+        portEXIT_CRITICAL(&s_mux);
+    }
+    xSemaphoreGive(s_write_lock);
+    return err;
+}
+
+static void settings_store_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // Let a burst of changes finish, but not for longer than SETTINGS_MAX_DIRTY_MS
+        while (1) {
+            portENTER_CRITICAL(&s_mux);
+            bool dirty = s_dirty;
+            int64_t quiet = s_last_change_us + SETTINGS_QUIET_MS * 1000LL;
+            int64_t deadline = s_dirty_since_us + SETTINGS_MAX_DIRTY_MS * 1000LL;
+            portEXIT_CRITICAL(&s_mux);
+            if (!dirty) {
+                break;
+            }
+            int64_t wait_us = (quiet < deadline ? quiet : deadline) - esp_timer_get_time();
+            if (wait_us > 0) {
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_us / 1000) + 1);
+            } else if (settings_store_flush() != ESP_OK) {
+                vTaskDelay(pdMS_TO_TICKS(SETTINGS_RETRY_MS));
+            }
+        }
+    }
+}
+
+static void settings_store_shutdown(void)
+{
+    settings_store_flush();
+}
+
+esp_err_t settings_store_init(const timer_settings_t *defaults)
+{
+    if (s_write_lock) {
+        return ESP_OK;
+    }
+    s_current = *defaults;
+    nvs_handle_t nvs_handle;
+    bool loaded = false;
+    if (nvs_open(SETTINGS_NVS_NS, NVS_READONLY, &nvs_handle) == ESP_OK) {
+        loaded = settings_load(nvs_handle);
+        nvs_close(nvs_handle);
+    }
+    if (!loaded) {
+        s_current = *defaults;
+        ESP_LOGI(TAG, "No saved settings, using defaults");
+    } else if (s_stats.loaded_version < SETTINGS_VERSION) {
+        // Write the migrated settings back in the current format
+        s_dirty = true;
+        s_dirty_since_us = s_last_change_us = esp_timer_get_time();
+    }
+
+    s_write_lock = xSemaphoreCreateMutex();
+    if (!s_write_lock ||
+        xTaskCreatePinnedToCore(&settings_store_task, "settings", 3 * 1024, NULL, 2, &s_task, 1) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create settings store task");
+        return ESP_ERR_NO_MEM;
+    }
+    esp_register_shutdown_handler(settings_store_shutdown);
+    if (s_dirty) {
+        xTaskNotifyGive(s_task);
+    }
+    return ESP_OK;
+}
+
+void settings_store_get(timer_settings_t *out)
+{
+    portENTER_CRITICAL(&s_mux);
+    *out = s_current;
+    portEXIT_CRITICAL(&s_mux);
+}
+
+bool settings_store_set(const timer_settings_t *settings)
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    s_stats.sets++;
+    bool changed = memcmp(settings, &s_current, sizeof(s_current)) != 0;
+    if (changed) {
+        s_current = *settings;
+        if (!s_dirty) {
+            s_dirty = true;
+            s_dirty_since_us = now;
+        }
+        s_last_change_us = now;
+        s_stats.changes++;
+    } else {
+        s_stats.unchanged++;
+    }
+    portEXIT_CRITICAL(&s_mux);
+    if (changed && s_task) {
+        xTaskNotifyGive(s_task);
+    }
+    return changed;
+}
+
+static esp_err_t settings_store_api_handler(httpd_req_t *req)
+{
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_mux);
+    bool dirty = s_dirty;
+    int64_t dirty_since = s_dirty_since_us;
+    portEXIT_CRITICAL(&s_mux);
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddNumberToObject(response, "version", SETTINGS_VERSION);
+    cJSON_AddNumberToObject(response, "loaded_version", s_stats.loaded_version);
+    cJSON_AddBoolToObject(response, "dirty", dirty);
+    cJSON_AddNumberToObject(response, "dirty_ms", dirty ? (now - dirty_since) / 1000 : 0);
+    cJSON_AddNumberToObject(response, "quiet_ms", SETTINGS_QUIET_MS);
+    cJSON_AddNumberToObject(response, "max_dirty_ms", SETTINGS_MAX_DIRTY_MS);
+
+    cJSON *counts = cJSON_AddObjectToObject(response, "counts");
+    cJSON_AddNumberToObject(counts, "sets", s_stats.sets);
+    cJSON_AddNumberToObject(counts, "changes", s_stats.changes);
+    cJSON_AddNumberToObject(counts, "unchanged", s_stats.unchanged);
+    cJSON_AddNumberToObject(counts, "commits", s_stats.commits);
+    cJSON_AddNumberToObject(counts, "failures", s_stats.failures);
+    cJSON_AddNumberToObject(counts, "bytes_written", s_stats.bytes_written);
+
+    cJSON *timing = cJSON_AddObjectToObject(response, "timing");
+    cJSON_AddNumberToObject(timing, "commit_us_avg", perf_counter_avg(&s_stats.commit_us));
+    cJSON_AddNumberToObject(timing, "commit_us_max", s_stats.commit_us.max);
+    cJSON_AddNumberToObject(timing, "change_to_commit_ms_avg", perf_counter_avg(&s_stats.dirty_ms));
+    cJSON_AddNumberToObject(timing, "change_to_commit_ms_max", s_stats.dirty_ms.max);
+    cJSON_AddNumberToObject(timing, "since_commit_s", s_stats.commits ? (now - s_stats.last_commit_us) / 1000000 : -1);
+
+    nvs_stats_t nvs;
+    if (nvs_get_stats(NULL, &nvs) == ESP_OK) {
+        cJSON *usage = cJSON_AddObjectToObject(response, "nvs");
+        cJSON_AddNumberToObject(usage, "used_entries", nvs.used_entries);
+        cJSON_AddNumberToObject(usage, "free_entries", nvs.free_entries);
+        cJSON_AddNumberToObject(usage, "total_entries", nvs.total_entries);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t settings_store_register_http(httpd_handle_t server)
+{
+    httpd_uri_t store_uri = {
+        .uri = "/api/settings/store",
+        .method = HTTP_GET,
+        .handler = settings_store_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &store_uri);
+}
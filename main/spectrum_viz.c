@@ -0,0 +1,494 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Audio-reactive spectrum mode for the LED ring.
+//
+// feed_Task hands every chunk to spectrum_viz_feed(), which (only while the
+// mode is on) low-passes and decimates the first microphone to 8 kHz into a
+// small ring and publishes the write position with a release store; it
+// never waits on the visualizer. A periodic esp_timer wakes the frame task
+// SPECTRUM_FPS times a second. When new audio has arrived the task windows
+// the newest SPECTRUM_FFT_SIZE samples and runs the esp-dsp radix-2 FFT
+// (the S3 build uses its SIMD variant), sums the bins into log-spaced
+// bands and follows them with an automatic gain. Every frame then applies
+// decay and peak-hold and paints through the callback from main.c.
+//
+// The frame task runs at a lower priority than feed_Task on the same core,
+// so it can only use time the AFE leaves idle. POST {"check": N} measures
+// AFE fetch latency for N seconds with the mode off and N seconds with it
+// on to confirm that.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_dsp.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "afe_manager.h"
+#include "spectrum_viz.h"
+
+#define SPECTRUM_RANGE_DB               36.0f   // shown between the gain reference and this far below
+#define SPECTRUM_MIN_REF_DB             -45.0f  // quietest gain reference, keeps silence dark
+#define SPECTRUM_AGC_FALL_DB            0.1f    // per analysed window, about 3 dB/s
+#define SPECTRUM_DECAY                  8       // level fall per frame, about half a second to dark
+#define SPECTRUM_PEAK_FALL              3
+#define SPECTRUM_PEAK_HOLD_FRAMES       (SPECTRUM_PEAK_HOLD_MS * SPECTRUM_FPS / 1000)
+#define SPECTRUM_LATENCY_TOLERANCE_US   1000
+
+static const char *TAG = "SPECTRUM";
+
+static spectrum_draw_fn s_draw = NULL;
+static esp_timer_handle_t s_timer = NULL;
+static TaskHandle_t s_task = NULL;
+static atomic_bool s_enabled = false;
+
+// Producer side (feed_Task)
+static int16_t s_ring[SPECTRUM_RING_SAMPLES];
+static atomic_uint s_written = 0;
+static int16_t s_prev = 0;
+
+// Analysis state, frame task only
+static float s_window[SPECTRUM_FFT_SIZE];
+static float s_fft[SPECTRUM_FFT_SIZE * 2] __attribute__((aligned(16)));
+static uint16_t s_band_lo[SPECTRUM_BANDS];
+static uint16_t s_band_hi[SPECTRUM_BANDS];
+static float s_agc_db = SPECTRUM_MIN_REF_DB;
+static uint8_t s_target[SPECTRUM_BANDS];
+static uint8_t s_levels[SPECTRUM_BANDS];
+static uint8_t s_peaks[SPECTRUM_BANDS];
+static uint8_t s_hold[SPECTRUM_BANDS];
+
+static struct {
+    uint32_t frames;
+    uint32_t analysed;          // frames with new audio
+    uint32_t drawn;
+    uint32_t busy;              // ring showed a timer or recognition state
+    uint32_t missed;            // timer ticks that arrived while a frame was still running
+    uint32_t over_budget;
+    float fps;
+    perf_counter_t frame_cycles;    // analysis + dynamics, against SPECTRUM_BUDGET_CYCLES
+    perf_counter_t fft_cycles;
+    perf_counter_t draw_us;         // paint and LED transfer
+    perf_counter_t feed_cycles;     // decimation per feed chunk
+} s_stats;
+
+static struct {
+    bool running;
+    bool valid;
+    uint32_t seconds;
+    perf_counter_t off_us;
+    perf_counter_t on_us;
+    uint32_t frames_drawn;
+} s_check;
+
+static void spectrum_save(bool enable)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(SPECTRUM_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_u8(nvs_handle, "enabled", enable);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving spectrum mode: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static bool spectrum_load(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(SPECTRUM_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+    uint8_t enabled = 0;
+    nvs_get_u8(nvs_handle, "enabled", &enabled);
+    nvs_close(nvs_handle);
+    return enabled != 0;
+}
+
+void spectrum_viz_feed(const int16_t *data, int channels, int frames)
+{
+    if (!atomic_load_explicit(&s_enabled, memory_order_relaxed)) {
+        return;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    uint32_t w = atomic_load_explicit(&s_written, memory_order_relaxed);
+    // [1 2 1] / 4 low-pass evaluated on every other sample
+    for (int i = 0; i + 1 < frames; i += 2) {
+        int32_t x0 = data[i * channels];
+        int32_t x1 = data[(i + 1) * channels];
+        s_ring[w++ & (SPECTRUM_RING_SAMPLES - 1)] = (int16_t)((s_prev + 2 * x0 + x1) >> 2);
+        s_prev = (int16_t)x1;
+    }
+    atomic_store_explicit(&s_written, w, memory_order_release);
+    perf_counter_add(&s_stats.feed_cycles, esp_cpu_get_cycle_count() - start);
+}
+
+static void spectrum_bands_init(void)
+{
+    const float bin_hz = (float)SPECTRUM_RATE / SPECTRUM_FFT_SIZE;
+    const float ratio = (SPECTRUM_RATE / 2.0f) / SPECTRUM_MIN_HZ;
+    int prev_hi = 1;    // skip DC
+    for (int b = 0; b < SPECTRUM_BANDS; b++) {
+        float lo_hz = SPECTRUM_MIN_HZ * powf(ratio, (float)b / SPECTRUM_BANDS);
+        float hi_hz = SPECTRUM_MIN_HZ * powf(ratio, (float)(b + 1) / SPECTRUM_BANDS);
+        int lo = (int)lroundf(lo_hz / bin_hz);
+        int hi = (int)lroundf(hi_hz / bin_hz);
+        if (lo < prev_hi) {
+            lo = prev_hi;
+        }
+        if (hi <= lo) {
+            hi = lo + 1;
+        }
+        if (b == SPECTRUM_BANDS - 1 || hi > SPECTRUM_FFT_SIZE / 2) {
+            hi = SPECTRUM_FFT_SIZE / 2;
+        }
+        s_band_lo[b] = lo;
+        s_band_hi[b] = hi;
+        prev_hi = hi;
+    }
+}
+
+// Newest window -> per-band targets
+static void spectrum_analyse(uint32_t written)
+{
+    for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
+        s_fft[2 * i] = s_ring[(written - SPECTRUM_FFT_SIZE + i) & (SPECTRUM_RING_SAMPLES - 1)] * s_window[i];
+        s_fft[2 * i + 1] = 0.0f;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    dsps_fft2r_fc32(s_fft, SPECTRUM_FFT_SIZE);
+    dsps_bit_rev_fc32(s_fft, SPECTRUM_FFT_SIZE);
+    perf_counter_add(&s_stats.fft_cycles, esp_cpu_get_cycle_count() - start);
+
+    // A full-scale sine lands at 0 dB: Hann coherent gain 0.5, FFT gain N
+    const float norm = 1.0f / ((SPECTRUM_FFT_SIZE / 4.0f) * (SPECTRUM_FFT_SIZE / 4.0f));
+    float db[SPECTRUM_BANDS];
+    float loudest = -120.0f;
+    for (int b = 0; b < SPECTRUM_BANDS; b++) {
+        float power = 0.0f;
+        for (int k = s_band_lo[b]; k < s_band_hi[b]; k++) {
+            power += s_fft[2 * k] * s_fft[2 * k] + s_fft[2 * k + 1] * s_fft[2 * k + 1];
+        }
+        db[b] = 10.0f * log10f(power * norm + 1e-12f);
+        if (db[b] > loudest) {
+            loudest = db[b];
+        }
+    }
+
+    // Gain follows the loudest band up at once and down slowly
+    s_agc_db -= SPECTRUM_AGC_FALL_DB;
+    if (loudest > s_agc_db) {
+        s_agc_db = loudest;
+    }
+    if (s_agc_db < SPECTRUM_MIN_REF_DB) {
+        s_agc_db = SPECTRUM_MIN_REF_DB;
+    }
+    for (int b = 0; b < SPECTRUM_BANDS; b++) {
+        float v = (db[b] - (s_agc_db - SPECTRUM_RANGE_DB)) * (255.0f / SPECTRUM_RANGE_DB);
+        s_target[b] = v <= 0.0f ? 0 : (v >= 255.0f ? 255 : (uint8_t)v);
+    }
+}
+
+// Instant attack, linear decay, peak-hold
+static void spectrum_dynamics(void)
+{
+    for (int b = 0; b < SPECTRUM_BANDS; b++) {
+        int level = s_levels[b] - SPECTRUM_DECAY;
+        s_levels[b] = s_target[b] > level ? s_target[b] : level;
+        if (s_levels[b] >= s_peaks[b]) {
+            s_peaks[b] = s_levels[b];
+            s_hold[b] = SPECTRUM_PEAK_HOLD_FRAMES;
+        } else if (s_hold[b]) {
+            s_hold[b]--;
+        } else {
+            int peak = s_peaks[b] - SPECTRUM_PEAK_FALL;
+            s_peaks[b] = peak > s_levels[b] ? peak : s_levels[b];
+        }
+    }
+}
+
+static void spectrum_task(void *arg)
+{
+    uint32_t last_written = 0;
+    int64_t fps_start = esp_timer_get_time();
+    uint32_t fps_frames = 0;
+
+    while (true) {
+        uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!atomic_load(&s_enabled)) {
+            continue;
+        }
+        if (ticks > 1) {
+            s_stats.missed += ticks - 1;
+        }
+        s_stats.frames++;
+
+        uint32_t start = esp_cpu_get_cycle_count();
+        uint32_t written = atomic_load_explicit(&s_written, memory_order_acquire);
+        if (written != last_written && written >= SPECTRUM_FFT_SIZE) {
+            spectrum_analyse(written);
+            last_written = written;
+            s_stats.analysed++;
+        }
+        spectrum_dynamics();
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        perf_counter_add(&s_stats.frame_cycles, cycles);
+        if (cycles > SPECTRUM_BUDGET_CYCLES) {
+            s_stats.over_budget++;
+        }
+
+        int64_t draw_start = esp_timer_get_time();
+        if (s_draw && s_draw(s_levels, s_peaks, SPECTRUM_BANDS)) {
+            s_stats.drawn++;
+            fps_frames++;
+            perf_counter_add(&s_stats.draw_us, (uint32_t)(esp_timer_get_time() - draw_start));
+        } else {
+            s_stats.busy++;
+        }
+
+        int64_t now = esp_timer_get_time();
+        if (now - fps_start >= 1000000) {
+            s_stats.fps = fps_frames * 1e6f / (now - fps_start);
+            fps_start = now;
+            fps_frames = 0;
+        }
+    }
+}
+
+static void spectrum_timer_cb(void *arg)
+{
+    xTaskNotifyGive(s_task);
+}
+
+// Turn the mode on or off without touching NVS
+static void spectrum_apply(bool enable)
+{
+    if (enable == atomic_load(&s_enabled)) {
+        return;
+    }
+    if (enable) {
+        atomic_store(&s_enabled, true);
+        esp_timer_start_periodic(s_timer, 1000000 / SPECTRUM_FPS);
+    } else {
+        atomic_store(&s_enabled, false);
+        esp_timer_stop(s_timer);
+        s_stats.fps = 0;
+    }
+}
+
+bool spectrum_viz_enabled(void)
+{
+    return atomic_load(&s_enabled);
+}
+
+void spectrum_viz_set_enabled(bool enable)
+{
+    spectrum_apply(enable);
+    spectrum_save(enable);
+}
+
+esp_err_t spectrum_viz_init(spectrum_draw_fn draw)
+{
+    s_draw = draw;
+    // The twiddle table is shared with the DOA estimator; size it for the largest transform
+    esp_err_t err = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "FFT init failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    dsps_wind_hann_f32(s_window, SPECTRUM_FFT_SIZE);
+    for (int i = 0; i < SPECTRUM_FFT_SIZE; i++) {
+        s_window[i] /= 32768.0f;
+    }
+    spectrum_bands_init();
+
+    // Below feed_Task (5) on its core: frames only use time the AFE leaves over
+    if (xTaskCreatePinnedToCore(&spectrum_task, "spectrum", 4 * 1024, NULL, 2, &s_task, 0) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_timer_create_args_t timer_args = {
+        .callback = spectrum_timer_cb,
+        .name = "spectrum",
+    };
+    err = esp_timer_create(&timer_args, &s_timer);
+    if (err != ESP_OK) {
+        return err;
+    }
+    spectrum_apply(spectrum_load());
+    ESP_LOGI(TAG, "Spectrum mode %s, %d bands from %d Hz, %d fps", spectrum_viz_enabled() ? "on" : "off",
+             SPECTRUM_BANDS, SPECTRUM_MIN_HZ, SPECTRUM_FPS);
+    return ESP_OK;
+}
+
+// Fetch latency with the mode off, then on, over the same length of time
+static void spectrum_check_task(void *arg)
+{
+    bool was_enabled = spectrum_viz_enabled();
+    TickType_t period = pdMS_TO_TICKS(s_check.seconds * 1000);
+
+    spectrum_apply(false);
+    vTaskDelay(pdMS_TO_TICKS(500));
+    afe_manager_reset_window();
+    vTaskDelay(period);
+    afe_manager_window_latency(&s_check.off_us);
+
+    spectrum_apply(true);
+    vTaskDelay(pdMS_TO_TICKS(500));
+    uint32_t drawn = s_stats.drawn;
+    afe_manager_reset_window();
+    vTaskDelay(period);
+    afe_manager_window_latency(&s_check.on_us);
+    s_check.frames_drawn = s_stats.drawn - drawn;
+
+    spectrum_apply(was_enabled);
+    s_check.valid = true;
+    s_check.running = false;
+    ESP_LOGI(TAG, "Fetch latency off %lu us avg / %lu max, on %lu us avg / %lu max, %lu frames drawn",
+             (unsigned long)perf_counter_avg(&s_check.off_us), (unsigned long)s_check.off_us.max,
+             (unsigned long)perf_counter_avg(&s_check.on_us), (unsigned long)s_check.on_us.max,
+             (unsigned long)s_check.frames_drawn);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t spectrum_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[96];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        if (!json) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
+            return ESP_OK;
+        }
+        cJSON *enabled = cJSON_GetObjectItem(json, "enabled");
+        cJSON *check = cJSON_GetObjectItem(json, "check");
+        bool reset = cJSON_IsTrue(cJSON_GetObjectItem(json, "reset"));
+        cJSON_Delete(json);
+
+        if (cJSON_IsBool(enabled) && !s_check.running) {
+            spectrum_viz_set_enabled(cJSON_IsTrue(enabled));
+        }
+        if (reset) {
+            s_stats.frames = 0;
+            s_stats.analysed = 0;
+            s_stats.drawn = 0;
+            s_stats.busy = 0;
+            s_stats.missed = 0;
+            s_stats.over_budget = 0;
+            perf_counter_reset(&s_stats.frame_cycles);
+            perf_counter_reset(&s_stats.fft_cycles);
+            perf_counter_reset(&s_stats.draw_us);
+            perf_counter_reset(&s_stats.feed_cycles);
+        }
+        if (cJSON_IsNumber(check)) {
+            if (check->valueint < 1 || check->valueint > SPECTRUM_CHECK_MAX_S) {
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "check out of range");
+                return ESP_OK;
+            }
+            if (s_check.running) {
+                httpd_resp_set_status(req, "409 Conflict");
+                httpd_resp_sendstr(req, "{\"error\":\"check already running\"}");
+                return ESP_OK;
+            }
+            s_check.running = true;
+            s_check.valid = false;
+            s_check.seconds = check->valueint;
+            if (xTaskCreatePinnedToCore(&spectrum_check_task, "spectrum_chk", 3 * 1024, NULL, 2, NULL, 1) != pdPASS) {
+                s_check.running = false;
+                httpd_resp_send_500(req);
+                return ESP_FAIL;
+            }
+            httpd_resp_set_status(req, "202 Accepted");
+        }
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "enabled", spectrum_viz_enabled());
+    cJSON_AddNumberToObject(response, "fps", s_stats.fps);
+    cJSON_AddNumberToObject(response, "frames", s_stats.frames);
+    cJSON_AddNumberToObject(response, "analysed", s_stats.analysed);
+    cJSON_AddNumberToObject(response, "drawn", s_stats.drawn);
+    cJSON_AddNumberToObject(response, "busy", s_stats.busy);
+    cJSON_AddNumberToObject(response, "missed", s_stats.missed);
+
+    cJSON *cost = cJSON_AddObjectToObject(response, "frame");
+    cJSON_AddNumberToObject(cost, "budget_cycles", SPECTRUM_BUDGET_CYCLES);
+    cJSON_AddNumberToObject(cost, "cycles_avg", perf_counter_avg(&s_stats.frame_cycles));
+    cJSON_AddNumberToObject(cost, "cycles_max", s_stats.frame_cycles.max);
+    cJSON_AddNumberToObject(cost, "over_budget", s_stats.over_budget);
+    cJSON_AddNumberToObject(cost, "fft_cycles_avg", perf_counter_avg(&s_stats.fft_cycles));
+    cJSON_AddNumberToObject(cost, "draw_us_avg", perf_counter_avg(&s_stats.draw_us));
+    cJSON_AddNumberToObject(cost, "draw_us_max", s_stats.draw_us.max);
+    cJSON_AddNumberToObject(cost, "feed_cycles_avg", perf_counter_avg(&s_stats.feed_cycles));
+    cJSON_AddNumberToObject(cost, "core_percent",
+                            perf_cycles_to_us((uint64_t)perf_counter_avg(&s_stats.frame_cycles) * SPECTRUM_FPS) / 1e4f);
+
+    cJSON *bands = cJSON_AddArrayToObject(response, "levels");
+    for (int b = 0; b < SPECTRUM_BANDS; b++) {
+        cJSON_AddItemToArray(bands, cJSON_CreateNumber(s_levels[b]));
+    }
+
+    cJSON *chk = cJSON_AddObjectToObject(response, "latency_check");
+    cJSON_AddBoolToObject(chk, "running", s_check.running);
+    if (s_check.valid) {
+        uint32_t off = perf_counter_avg(&s_check.off_us);
+        uint32_t on = perf_counter_avg(&s_check.on_us);
+        cJSON_AddNumberToObject(chk, "seconds", s_check.seconds);
+        cJSON_AddNumberToObject(chk, "off_us_avg", off);
+        cJSON_AddNumberToObject(chk, "off_us_max", s_check.off_us.max);
+        cJSON_AddNumberToObject(chk, "on_us_avg", on);
+        cJSON_AddNumberToObject(chk, "on_us_max", s_check.on_us.max);
+        cJSON_AddNumberToObject(chk, "frames_drawn", s_check.frames_drawn);
+        cJSON_AddBoolToObject(chk, "unchanged", on <= off + SPECTRUM_LATENCY_TOLERANCE_US);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t spectrum_viz_register_http(httpd_handle_t server)
+{
+    httpd_uri_t spectrum_get_uri = {
+        .uri = "/api/spectrum",
+        .method = HTTP_GET,
+        .handler = spectrum_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &spectrum_get_uri);
+
+    httpd_uri_t spectrum_post_uri = {
+        .uri = "/api/spectrum",
+        .method = HTTP_POST,
+        .handler = spectrum_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &spectrum_post_uri);
+}
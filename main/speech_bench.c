@@ -0,0 +1,591 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// On-device speech benchmark.
+//
+// Streams the labelled clips of the "corpus" partition through a real AFE
+// and multinet instead of the I2S microphones. The live pipeline is
+// suspended while it runs. Each configuration (AFE profile, wakenet,
+// multinet, feed block size) gets real-time factor, per-stage cycles,
+// wake recall, command accuracy and decode latency in one JSON report.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_partition.h"
+#include "esp_afe_sr_models.h"
+#include "esp_mn_iface.h"
+#include "esp_mn_models.h"
+#include "esp_process_sdkconfig.h"
+#include "esp_wn_models.h"
+#include "cJSON.h"
+#include "speech_bench.h"
+#include "afe_manager.h"
+#include "afe_profiles.h"
+#include "perf_monitor.h"
+
+#define BENCH_MAX_CONFIGS       6
+#define BENCH_MAX_CLIPS         64
+#define BENCH_MODEL_NAME_LEN    32
+#define BENCH_TAIL_MS           1500    // silence after each clip so multinet can finish
+#define BENCH_AHEAD_CHUNKS      8       // feed chunks allowed ahead of fetch
+#define BENCH_MAX_FEED_CHUNKS   8
+#define BENCH_MN_TIMEOUT_MS     6000
+#define BENCH_SAMPLE_RATE       16000
+
+static const char *TAG = "SPEECH_BENCH";
+
+typedef struct {
+    char profile[AFE_PROFILE_NAME_LEN];
+    char wakenet[BENCH_MODEL_NAME_LEN];     // empty: first wakenet in the model partition
+    char multinet[BENCH_MODEL_NAME_LEN];    // empty: English multinet
+    uint8_t feed_chunks;                    // AFE chunks per feeder wake-up (I2S block size)
+} bench_config_t;
+
+typedef struct {
+    bool woke;
+    int command;            // first command reported, -1 for none
+    int32_t latency_ms;     // audio time from the end of the clip to the command
+} bench_clip_result_t;
+
+// State shared between the runner (fetch side) and the feeder task
+typedef struct {
+    esp_afe_sr_iface_t *afe;
+    esp_afe_sr_data_t *data;
+    const uint8_t *corpus;
+    const speech_corpus_entry_t *entries;
+    int clips;
+    int feed_chunk;
+    int channels;
+    int mics;
+    int feed_chunks;
+    bool realtime;
+    uint32_t span[BENCH_MAX_CLIPS];     // samples streamed per clip, clip + tail, padded
+    volatile uint32_t fed;
+    volatile uint32_t fetched;
+    volatile bool abort;
+    TaskHandle_t feeder;
+    SemaphoreHandle_t feeder_done;
+    perf_counter_t feed_cycles;
+} bench_run_t;
+
+static srmodel_list_t *s_models = NULL;
+static volatile bool s_running = false;
+static char *s_report = NULL;
+static bench_config_t s_configs[BENCH_MAX_CONFIGS];
+static int s_config_count = 0;
+static bool s_realtime = false;
+static bench_run_t s_run;
+static bench_clip_result_t s_results[BENCH_MAX_CLIPS];
+
+void speech_bench_init(srmodel_list_t *models)
+{
+    s_models = models;
+}
+
+static void bench_fill_chunk(bench_run_t *run, int16_t *buf, const speech_corpus_entry_t *clip, uint32_t pos)
+{
+    const int16_t *pcm = (const int16_t *)(run->corpus + clip->offset);
+    for (int n = 0; n < run->feed_chunk; n++) {
+        int16_t sample = (pos + n < clip->samples) ? pcm[pos + n] : 0;
+        // The corpus is mono: same signal on every mic, reference channels silent
+        for (int ch = 0; ch < run->channels; ch++) {
+            buf[n * run->channels + ch] = ch < run->mics ? sample : 0;
+        }
+    }
+}
+
+static void bench_feed_task(void *arg)
+{
+    bench_run_t *run = (bench_run_t *)arg;
+    int block = run->feed_chunk * run->feed_chunks;
+    int16_t *buf = malloc(block * run->channels * sizeof(int16_t));
+    assert(buf);
+
+    int64_t next_us = esp_timer_get_time();
+    for (int i = 0; i < run->clips && !run->abort; i++) {
+        const speech_corpus_entry_t *clip = &run->entries[i];
+        for (uint32_t pos = 0; pos < run->span[i] && !run->abort; pos += block) {
+            // Flow control: fetch has to keep up, the AFE ring buffer is finite
+            while (run->fed - run->fetched >= BENCH_AHEAD_CHUNKS * block && !run->abort) {
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+            }
+
+            // Spans are whole blocks, see bench_run_config()
+            for (int c = 0; c < run->feed_chunks; c++) {
+                bench_fill_chunk(run, buf + c * run->feed_chunk * run->channels, clip, pos + c * run->feed_chunk);
+            }
+            for (int c = 0; c < run->feed_chunks; c++) {
+                uint32_t start = esp_cpu_get_cycle_count();
+                run->afe->feed(run->data, buf + c * run->feed_chunk * run->channels);
+                perf_counter_add(&run->feed_cycles, esp_cpu_get_cycle_count() - start);
+                run->fed += run->feed_chunk;
+            }
+
+            if (run->realtime) {
+                next_us += (int64_t)block * 1000000 / BENCH_SAMPLE_RATE;
+                int64_t wait_us = next_us - esp_timer_get_time();
+                if (wait_us > 0) {
+                    vTaskDelay(pdMS_TO_TICKS(wait_us / 1000) + 1);
+                }
+            }
+        }
+    }
+
+    free(buf);
+    xSemaphoreGive(run->feeder_done);
+    vTaskDelete(NULL);
+}
+
+static uint32_t gcd_u32(uint32_t a, uint32_t b)
+{
+    while (b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static void add_counter(cJSON *parent, const char *name, const perf_counter_t *c)
+{
+    cJSON *item = cJSON_AddObjectToObject(parent, name);
+    cJSON_AddNumberToObject(item, "avg", perf_counter_avg(c));
+    cJSON_AddNumberToObject(item, "max", c->max);
+    cJSON_AddNumberToObject(item, "count", c->count);
+}
+
+// Run the whole corpus through one configuration and append its report
+static void bench_run_config(const bench_config_t *config, const uint8_t *corpus, cJSON *reports)
+{
+    cJSON *report = cJSON_CreateObject();
+    cJSON_AddItemToArray(reports, report);
+    cJSON_AddStringToObject(report, "profile", config->profile);
+
+    const speech_corpus_header_t *header = (const speech_corpus_header_t *)corpus;
+    const afe_profile_t *profile = afe_profiles_find(config->profile);
+    char *wn_name = config->wakenet[0] ? (char *)config->wakenet : esp_srmodel_filter(s_models, ESP_WN_PREFIX, NULL);
+    char *mn_name = config->multinet[0] ? (char *)config->multinet
+                                        : esp_srmodel_filter(s_models, ESP_MN_PREFIX, ESP_MN_ENGLISH);
+    if (!profile || !wn_name || !mn_name || esp_srmodel_exists(s_models, wn_name) < 0 ||
+        esp_srmodel_exists(s_models, mn_name) < 0) {
+        cJSON_AddStringToObject(report, "error", "unknown profile or model");
+        return;
+    }
+    cJSON_AddStringToObject(report, "wakenet", wn_name);
+    cJSON_AddStringToObject(report, "multinet", mn_name);
+    cJSON_AddNumberToObject(report, "feed_chunks", config->feed_chunks);
+
+    esp_afe_sr_iface_t *afe = afe_manager_handle();
+    afe_config_t afe_config;
+    afe_manager_build_config(&afe_config, profile);
+    afe_config.wakenet_model_name = wn_name;
+    esp_afe_sr_data_t *data = afe->create_from_config(&afe_config);
+    if (!data) {
+        cJSON_AddStringToObject(report, "error", "AFE create failed");
+        return;
+    }
+
+    esp_mn_iface_t *multinet = esp_mn_handle_from_name(mn_name);
+    model_iface_data_t *model_data = multinet->create(mn_name, BENCH_MN_TIMEOUT_MS);
+    if (!model_data) {
+        afe->destroy(data);
+        cJSON_AddStringToObject(report, "error", "multinet create failed");
+        return;
+    }
+    esp_mn_commands_update_from_sdkconfig(multinet, model_data);
+
+    bench_run_t *run = &s_run;
+    memset(run, 0, sizeof(*run));
+    run->afe = afe;
+    run->data = data;
+    run->corpus = corpus;
+    run->entries = (const speech_corpus_entry_t *)(corpus + sizeof(*header));
+    run->clips = header->count;
+    run->feed_chunk = afe->get_feed_chunksize(data);
+    run->channels = afe->get_total_channel_num(data);
+    run->mics = afe->get_channel_num(data);
+    run->feed_chunks = config->feed_chunks;
+    run->realtime = s_realtime;
+    run->feeder_done = xSemaphoreCreateBinary();
+
+    int fetch_chunk = afe->get_fetch_chunksize(data);
+    cJSON_AddNumberToObject(report, "feed_chunk", run->feed_chunk);
+    cJSON_AddNumberToObject(report, "fetch_chunk", fetch_chunk);
+    if (multinet->get_samp_chunksize(model_data) != fetch_chunk) {
+        cJSON_AddStringToObject(report, "error", "multinet chunk size does not match AFE fetch size");
+        vSemaphoreDelete(run->feeder_done);
+        multinet->destroy(model_data);
+        afe->destroy(data);
+        return;
+    }
+
+    // Clip spans are whole feed blocks and whole fetch frames, so every
+    // clip boundary falls on a fetch boundary
+    uint32_t block = run->feed_chunk * run->feed_chunks;
+    uint32_t step = block / gcd_u32(block, fetch_chunk) * fetch_chunk;
+    uint32_t total = 0;
+    for (int i = 0; i < run->clips; i++) {
+        uint32_t samples = run->entries[i].samples + BENCH_TAIL_MS * BENCH_SAMPLE_RATE / 1000;
+        run->span[i] = (samples + step - 1) / step * step;
+        total += run->span[i];
+        s_results[i].woke = false;
+        s_results[i].command = -1;
+        s_results[i].latency_ms = -1;
+    }
+
+    perf_counter_t fetch_cycles, mn_cycles, latency;
+    perf_counter_reset(&fetch_cycles);
+    perf_counter_reset(&mn_cycles);
+    perf_counter_reset(&latency);
+
+    perf_cpu_snapshot_t cpu_from, cpu_to;
+    perf_cpu_snapshot(&cpu_from);
+    int64_t start_us = cpu_from.time_us;
+    xTaskCreatePinnedToCore(&bench_feed_task, "bench_feed", 4 * 1024, run, 5, &run->feeder, 0);
+
+    int clip = 0;
+    uint32_t clip_start = 0;
+    bool listening = false;
+    bool failed = false;
+    while (run->fetched < total) {
+        uint32_t start = esp_cpu_get_cycle_count();
+        afe_fetch_result_t *res = afe->fetch(data);
+        perf_counter_add(&fetch_cycles, esp_cpu_get_cycle_count() - start);
+        if (!res || res->ret_value == ESP_FAIL) {
+            ESP_LOGE(TAG, "AFE fetch error!");
+            failed = true;
+            break;
+        }
+        run->fetched += res->data_size / sizeof(int16_t);
+        xTaskNotifyGive(run->feeder);
+
+        bench_clip_result_t *r = &s_results[clip];
+        if (res->wakeup_state == WAKENET_DETECTED) {
+            r->woke = true;
+            multinet->clean(model_data);
+        } else if (res->wakeup_state == WAKENET_CHANNEL_VERIFIED) {
+            listening = true;
+        }
+
+        if (listening) {
+            start = esp_cpu_get_cycle_count();
+            esp_mn_state_t mn_state = multinet->detect(model_data, res->data);
+            perf_counter_add(&mn_cycles, esp_cpu_get_cycle_count() - start);
+
+            if (mn_state == ESP_MN_STATE_DETECTED) {
+                esp_mn_results_t *mn_result = multinet->get_results(model_data);
+                if (mn_result && mn_result->num > 0 && r->command < 0) {
+                    int32_t after = (int32_t)(run->fetched - clip_start) - (int32_t)run->entries[clip].samples;
+                    r->command = mn_result->command_id[0];
+                    r->latency_ms = after > 0 ? after * 1000 / BENCH_SAMPLE_RATE : 0;
+                }
+            }
+            if (mn_state != ESP_MN_STATE_DETECTING) {
+                listening = false;
+                afe->enable_wakenet(data);
+            }
+        }
+
+        if (run->fetched >= clip_start + run->span[clip]) {
+            if (listening) {
+                // Tail ran out before multinet decided, count it as a miss
+                multinet->clean(model_data);
+                afe->enable_wakenet(data);
+                listening = false;
+            }
+            clip_start += run->span[clip];
+            clip++;
+        }
+    }
+    perf_cpu_snapshot(&cpu_to);
+
+    run->abort = true;
+    if (failed) {
+        // The feeder may be blocked inside feed(); give it data room and time to exit
+        afe->reset_buffer(data);
+    }
+    xTaskNotifyGive(run->feeder);
+    xSemaphoreTake(run->feeder_done, portMAX_DELAY);
+    vSemaphoreDelete(run->feeder_done);
+    multinet->destroy(model_data);
+    afe->destroy(data);
+
+    if (failed) {
+        cJSON_AddStringToObject(report, "error", "fetch failed");
+        return;
+    }
+
+    float audio_s = (float)total / BENCH_SAMPLE_RATE;
+    float wall_s = (cpu_to.time_us - start_us) / 1e6f;
+    float cpu[portNUM_PROCESSORS];
+    perf_cpu_load(&cpu_from, &cpu_to, cpu);
+
+    int wake_expected = 0, wake_hit = 0, false_wakes = 0;
+    int cmd_expected = 0, cmd_correct = 0, cmd_wrong = 0, cmd_missed = 0;
+    cJSON *clips = cJSON_CreateArray();
+    for (int i = 0; i < run->clips; i++) {
+        const speech_corpus_entry_t *e = &run->entries[i];
+        const bench_clip_result_t *r = &s_results[i];
+        if (e->wake) {
+            wake_expected++;
+            wake_hit += r->woke;
+        } else {
+            false_wakes += r->woke;
+        }
+        if (e->command_id >= 0) {
+            cmd_expected++;
+            if (r->command == e->command_id) {
+                cmd_correct++;
+                perf_counter_add(&latency, r->latency_ms);
+            } else if (r->command >= 0) {
+                cmd_wrong++;
+            } else {
+                cmd_missed++;
+            }
+        }
+
+        char label[SPEECH_BENCH_LABEL_LEN + 1];
+        memcpy(label, e->label, SPEECH_BENCH_LABEL_LEN);
+        label[SPEECH_BENCH_LABEL_LEN] = '\0';
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "label", label);
+        cJSON_AddBoolToObject(item, "woke", r->woke);
+        cJSON_AddNumberToObject(item, "expected", e->command_id);
+        cJSON_AddNumberToObject(item, "command", r->command);
+        cJSON_AddNumberToObject(item, "latency_ms", r->latency_ms);
+        cJSON_AddItemToArray(clips, item);
+    }
+
+    cJSON_AddNumberToObject(report, "audio_s", audio_s);
+    cJSON_AddNumberToObject(report, "wall_s", wall_s);
+    cJSON_AddNumberToObject(report, "rtf", audio_s > 0 ? wall_s / audio_s : 0);
+    cJSON *cpu_json = cJSON_AddArrayToObject(report, "cpu_percent");
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        cJSON_AddItemToArray(cpu_json, cJSON_CreateNumber(cpu[core]));
+    }
+
+    cJSON *cycles = cJSON_AddObjectToObject(report, "cycles");
+    add_counter(cycles, "feed", &run->feed_cycles);
+    add_counter(cycles, "fetch", &fetch_cycles);
+    add_counter(cycles, "multinet", &mn_cycles);
+
+    cJSON *wake = cJSON_AddObjectToObject(report, "wake");
+    cJSON_AddNumberToObject(wake, "expected", wake_expected);
+    cJSON_AddNumberToObject(wake, "detected", wake_hit);
+    cJSON_AddNumberToObject(wake, "recall", wake_expected ? (float)wake_hit / wake_expected : 0);
+    cJSON_AddNumberToObject(wake, "false_wakes", false_wakes);
+
+    cJSON *commands = cJSON_AddObjectToObject(report, "commands");
+    cJSON_AddNumberToObject(commands, "expected", cmd_expected);
+    cJSON_AddNumberToObject(commands, "correct", cmd_correct);
+    cJSON_AddNumberToObject(commands, "wrong", cmd_wrong);
+    cJSON_AddNumberToObject(commands, "missed", cmd_missed);
+    cJSON_AddNumberToObject(commands, "accuracy", cmd_expected ? (float)cmd_correct / cmd_expected : 0);
+
+    add_counter(report, "decode_latency_ms", &latency);
+    cJSON_AddItemToObject(report, "clips", clips);
+
+    ESP_LOGI(TAG, "[%s/%s/%s x%d] rtf %.3f, wake %d/%d (%d false), commands %d/%d, latency %lu ms",
+             config->profile, wn_name, mn_name, config->feed_chunks, audio_s > 0 ? wall_s / audio_s : 0,
+             wake_hit, wake_expected, false_wakes, cmd_correct, cmd_expected,
+             (unsigned long)perf_counter_avg(&latency));
+}
+
+static esp_err_t bench_check_corpus(const uint8_t *corpus, size_t size)
+{
+    const speech_corpus_header_t *header = (const speech_corpus_header_t *)corpus;
+    if (memcmp(header->magic, SPEECH_BENCH_MAGIC, 4) != 0 || header->version != SPEECH_BENCH_VERSION) {
+        ESP_LOGE(TAG, "No corpus in partition (flash one with tools/build_corpus.py)");
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (header->sample_rate != BENCH_SAMPLE_RATE || header->count == 0 || header->count > BENCH_MAX_CLIPS) {
+        ESP_LOGE(TAG, "Unsupported corpus: %lu Hz, %u clips", (unsigned long)header->sample_rate, header->count);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    const speech_corpus_entry_t *entries = (const speech_corpus_entry_t *)(corpus + sizeof(*header));
+    for (int i = 0; i < header->count; i++) {
+        if (entries[i].offset % 2 || entries[i].offset + (uint64_t)entries[i].samples * 2 > size) {
+            ESP_LOGE(TAG, "Corpus entry %d out of bounds", i);
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+    return ESP_OK;
+}
+
+static void bench_task(void *arg)
+{
+    cJSON *root = cJSON_CreateObject();
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           SPEECH_BENCH_PARTITION);
+    const void *corpus = NULL;
+    esp_partition_mmap_handle_t mmap_handle;
+    esp_err_t err = part ? esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &corpus, &mmap_handle)
+                         : ESP_ERR_NOT_FOUND;
+    if (err == ESP_OK) {
+        err = bench_check_corpus(corpus, part->size);
+    }
+    if (err == ESP_OK) {
+        err = afe_manager_suspend();
+    }
+
+    if (err == ESP_OK) {
+        const speech_corpus_header_t *header = (const speech_corpus_header_t *)corpus;
+        cJSON_AddNumberToObject(root, "clips", header->count);
+        cJSON_AddBoolToObject(root, "realtime", s_realtime);
+        cJSON *reports = cJSON_AddArrayToObject(root, "configs");
+
+        ESP_LOGI(TAG, "Running %d configurations over %u clips", s_config_count, header->count);
+        for (int i = 0; i < s_config_count; i++) {
+            bench_run_config(&s_configs[i], corpus, reports);
+        }
+        afe_manager_resume_live();
+    } else {
+        cJSON_AddStringToObject(root, "error", esp_err_to_name(err));
+    }
+    if (corpus) {
+        esp_partition_munmap(mmap_handle);
+    }
+
+    char *report = cJSON_Print(root);
+    cJSON_Delete(root);
+    free(s_report);
+    s_report = report;
+    s_running = false;
+    ESP_LOGI(TAG, "Speech benchmark finished");
+    vTaskDelete(NULL);
+}
+
+static bool bench_config_from_json(cJSON *json, bench_config_t *config)
+{
+    memset(config, 0, sizeof(*config));
+    config->feed_chunks = 1;
+
+    cJSON *item = cJSON_GetObjectItem(json, "profile");
+    const afe_profile_t *profile = cJSON_IsString(item) ? afe_profiles_find(item->valuestring) : afe_profiles_active();
+    if (!profile) {
+        return false;
+    }
+    strcpy(config->profile, profile->name);
+
+    item = cJSON_GetObjectItem(json, "wakenet");
+    if (cJSON_IsString(item)) {
+        strncpy(config->wakenet, item->valuestring, BENCH_MODEL_NAME_LEN - 1);
+    }
+    item = cJSON_GetObjectItem(json, "multinet");
+    if (cJSON_IsString(item)) {
+        strncpy(config->multinet, item->valuestring, BENCH_MODEL_NAME_LEN - 1);
+    }
+    item = cJSON_GetObjectItem(json, "feed_chunks");
+    if (cJSON_IsNumber(item)) {
+        if (item->valueint < 1 || item->valueint > BENCH_MAX_FEED_CHUNKS) {
+            return false;
+        }
+        config->feed_chunks = item->valueint;
+    }
+    return true;
+}
+
+static esp_err_t bench_post_handler(httpd_req_t *req)
+{
+    char buf[1024];
+    int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+    buf[ret > 0 ? ret : 0] = '\0';
+
+    httpd_resp_set_type(req, "application/json");
+    if (!s_models) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Speech models not loaded");
+        return ESP_FAIL;
+    }
+    if (s_running) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_sendstr(req, "{\"status\":\"busy\"}");
+        return ESP_OK;
+    }
+
+    // {"realtime": false, "configs": [{"profile": "...", "wakenet": "...", "multinet": "...", "feed_chunks": 1}]}
+    bool ok = true;
+    s_config_count = 0;
+    s_realtime = false;
+    cJSON *json = cJSON_Parse(buf);
+    cJSON *configs = json ? cJSON_GetObjectItem(json, "configs") : NULL;
+    if (cJSON_IsArray(configs)) {
+        cJSON *item;
+        cJSON_ArrayForEach(item, configs) {
+            if (s_config_count == BENCH_MAX_CONFIGS || !bench_config_from_json(item, &s_configs[s_config_count])) {
+                ok = false;
+                break;
+            }
+            s_config_count++;
+        }
+    }
+    if (json) {
+        s_realtime = cJSON_IsTrue(cJSON_GetObjectItem(json, "realtime"));
+    }
+    cJSON_Delete(json);
+
+    if (ok && s_config_count == 0) {
+        // Default: the active profile with the default models
+        ok = bench_config_from_json(NULL, &s_configs[0]);
+        s_config_count = 1;
+    }
+    if (!ok) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid benchmark configuration");
+        return ESP_OK;
+    }
+
+    s_running = true;
+    if (xTaskCreatePinnedToCore(&bench_task, "speech_bench", 6 * 1024, NULL, 5, NULL, 1) != pdPASS) {
+        s_running = false;
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    httpd_resp_set_status(req, "202 Accepted");
+    httpd_resp_sendstr(req, "{\"status\":\"started\"}");
+    return ESP_OK;
+}
+
+static esp_err_t bench_get_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "application/json");
+    if (s_running) {
+        httpd_resp_sendstr(req, "{\"status\":\"running\"}");
+        return ESP_OK;
+    }
+    if (!s_report) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No benchmark report yet");
+        return ESP_OK;
+    }
+    httpd_resp_send(req, s_report, strlen(s_report));
+    return ESP_OK;
+}
+
+esp_err_t speech_bench_register_http(httpd_handle_t server)
+{
+    httpd_uri_t bench_get_uri = {
+        .uri = "/api/bench",
+        .method = HTTP_GET,
+        .handler = bench_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &bench_get_uri);
+
+    httpd_uri_t bench_post_uri = {
+        .uri = "/api/bench",
+        .method = HTTP_POST,
+        .handler = bench_post_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &bench_post_uri);
+}
@@ -11,50 +11,15 @@
 #include "freertos/FreeRTOS.h"
 #include <driver/gpio.h>
 
-#include "me_tell_me_a_joke.h"
-#include "me_sing_a_song.h"
-#include "me_play_news_channel.h"
-#include "me_turn_on_my_soundbox.h"
-#include "me_turn_off_my_soundbox.h"
-#include "me_highest_volume.h"
-#include "me_lowest_volume.h"
-#include "me_increase_volume.h"
-#include "me_decrease_the_volume.h"
-#include "me_turn_on_the_TV.h"
-#include "me_turn_off_the_TV.h"
-#include "me_make_me_a_tea.h"
-#include "me_make_me_a_coffee.h"
-#include "me_turn_on_the_light.h"
-#include "me_turn_off_the_light.h"
-#include "me_red_color.h"
-#include "me_green_color.h"
-#include "me_turn_on_all_the_light.h"
-#include "me_turn_off_all_the_light.h"
-#include "me_turn_on_the_air_conditioner.h"
-#include "me_turn_off_the_air_conditioner.h"
-#include "me_16_degress.h"
-#include "me_17_degrees.h"
-#include "me_18_degrees.h"
-#include "me_19_degrees.h"
-#include "me_20_degrees.h"
-#include "me_21_degrees.h"
-#include "me_22_degrees.h"
-#include "me_23_degrees.h"
-#include "me_24_degrees.h"
-#include "me_25_degrees.h"
-#include "me_26_degrees.h"
 #include "esp_board_init.h"
-#include "wake_up_prompt_tone.h"
+#include "prompt_pack.h"
+#include "phrase_synth.h"
+#include "tone_synth.h"
+#include "audio_engine.h"
 #include "speech_commands_action.h"
 
 extern int detect_flag;
 
-typedef struct {
-    char* name;
-    const uint16_t* data;
-    int length;
-} dac_audio_item_t;
-
 #if defined CONFIG_ESP32_S3_KORVO_1_V4_0_BOARD
 #include "led_strip.h"
 #include "driver/rmt.h"
@@ -139,49 +104,89 @@ void led_Task(void * arg)
 }
 #endif
 
-dac_audio_item_t playlist[] = {
-    // {"ie_kaiji.h", (uint16_t*)ie_kaiji, sizeof(ie_kaiji)},
-    {"wake_up_prompt_tone", (uint16_t*)wake_up_prompt_tone, sizeof(wake_up_prompt_tone)},
-    {"me_tell_me_a_joke", (uint16_t*)me_tell_me_a_joke, sizeof(me_tell_me_a_joke)},
-    {"me_sing_a_song", (uint16_t*)me_sing_a_song, sizeof(me_sing_a_song)},
-    {"me_play_news_channel", (uint16_t*)me_play_news_channel, sizeof(me_play_news_channel)},
-    {"me_turn_on_my_soundbox", (uint16_t*)me_turn_on_my_soundbox, sizeof(me_turn_on_my_soundbox)},
-    {"me_turn_off_my_soundbox", (uint16_t*)me_turn_off_my_soundbox, sizeof(me_turn_off_my_soundbox)},
-    {"me_highest_volume", (uint16_t*)me_highest_volume, sizeof(me_highest_volume)},
-    {"me_lowest_volume", (uint16_t*)me_lowest_volume, sizeof(me_lowest_volume)},
-    {"me_increase_volume", (uint16_t*)me_increase_volume, sizeof(me_increase_volume)},
-    {"me_decrease_the_volume", (uint16_t*)me_decrease_the_volume, sizeof(me_decrease_the_volume)},
-    {"me_turn_on_the_TV", (uint16_t*)me_turn_on_the_TV, sizeof(me_turn_on_the_TV)},
-    {"me_turn_off_the_TV", (uint16_t*)me_turn_off_the_TV, sizeof(me_turn_off_the_TV)},
-    {"me_make_me_a_tea", (uint16_t*)me_make_me_a_tea, sizeof(me_make_me_a_tea)},
-    {"me_make_me_a_coffee", (uint16_t*)me_make_me_a_coffee, sizeof(me_make_me_a_coffee)},
-    {"me_turn_on_the_light", (uint16_t*)me_turn_on_the_light, sizeof(me_turn_on_the_light)},
-    {"me_turn_off_the_light", (uint16_t*)me_turn_off_the_light, sizeof(me_turn_off_the_light)},
-    {"me_red_color", (uint16_t*)me_red_color, sizeof(me_red_color)},
-    {"me_green_color", (uint16_t*)me_green_color, sizeof(me_green_color)},
-    {"me_turn_on_all_the_light", (uint16_t*)me_turn_on_all_the_light, sizeof(me_turn_on_all_the_light)},
-    {"me_turn_off_all_the_light", (uint16_t*)me_turn_off_all_the_light, sizeof(me_turn_off_all_the_light)},
-    {"me_turn_on_the_air_conditioner", (uint16_t*)me_turn_on_the_air_conditioner, sizeof(me_turn_on_the_air_conditioner)},
-    {"me_turn_off_the_air_conditioner", (uint16_t*)me_turn_off_the_air_conditioner, sizeof(me_turn_off_the_air_conditioner)},
-    {"me_16_degress", (uint16_t*)me_16_degress, sizeof(me_16_degress)},
-    {"me_17_degrees", (uint16_t*)me_17_degrees, sizeof(me_17_degrees)},
-    {"me_18_degrees", (uint16_t*)me_18_degrees, sizeof(me_18_degrees)},
-    {"me_19_degrees", (uint16_t*)me_19_degrees, sizeof(me_19_degrees)},
-    {"me_20_degrees", (uint16_t*)me_20_degrees, sizeof(me_20_degrees)},
-    {"me_21_degrees", (uint16_t*)me_21_degrees, sizeof(me_21_degrees)},
-    {"me_22_degrees", (uint16_t*)me_22_degrees, sizeof(me_22_degrees)},
-    {"me_23_degrees", (uint16_t*)me_23_degrees, sizeof(me_23_degrees)},
-    {"me_24_degrees", (uint16_t*)me_24_degrees, sizeof(me_24_degrees)},
-    {"me_25_degrees", (uint16_t*)me_25_degrees, sizeof(me_25_degrees)},
-    {"me_26_degrees", (uint16_t*)me_26_degrees, sizeof(me_26_degrees)},
-};
+// Speech goes to the prompt voice and ducks alerts; the newest request wins
+static void play_speech(const audio_source_t *source)
+{
+    audio_play_t req = {
+        .voice = AUDIO_VOICE_PROMPT,
+        .priority = 1,
+        .gain = 1.0f,
+        .duck = true,
+        .source = *source,
+    };
+    audio_engine_play(&req);
+}
 
 void wake_up_action(void)
 {
-    esp_audio_play((int16_t *)(playlist[0].data), playlist[0].length, portMAX_DELAY);
+    audio_source_t source = { .kind = AUDIO_SOURCE_TONE, .tone = TONE_WAKE };
+    play_speech(&source);
 }
 
-void speech_commands_action(int command_id)
+// Alerts use their own voice so a confirmation only ducks them
+static void play_alert(tone_id_t tone, uint8_t priority)
 {
-    esp_audio_play((int16_t *)(playlist[command_id + 1].data), playlist[command_id + 1].length, portMAX_DELAY);
+    audio_play_t req = {
+        .voice = AUDIO_VOICE_ALERT,
+        .priority = priority,
+        .gain = 1.0f,
+        .duck = false,
+        .source = { .kind = AUDIO_SOURCE_TONE, .tone = tone },
+    };
+    audio_engine_play(&req);
+}
+
+void timer_countdown_action(int seconds_left)
+{
+    play_alert(seconds_left <= 3 ? TONE_COUNTDOWN_FINAL : TONE_COUNTDOWN, 1);
+}
+
+void timer_complete_action(void)
+{
+    play_alert(TONE_COMPLETE, 2);
+}
+
+// Spoken confirmation per command action (see speech_commands[] in main.c)
+static const struct {
+    const char *action;
+    const char *words[2];
+    bool duration;
+} s_confirmations[] = {
+    {"timer",    {"timer"},               true},
+    {"countup",  {"count", "up"},         true},
+    {"add",      {"added"},               true},
+    {"workout",  {"workout", "timer"},    true},
+    {"laundry",  {"laundry", "timer"},    true},
+    {"start",    {"timer", "started"},    false},
+    {"pause",    {"timer", "paused"},     false},
+    {"resume",   {"timer", "resumed"},    false},
+    {"stop",     {"timer", "stopped"},    false},
+    {"cancel",   {"timer", "cancelled"},  false},
+    {"clear",    {"timer", "cleared"},    false},
+    {"restart",  {"timer", "restarted"},  false},
+    {"reset",    {"timer", "reset"},      false},
+};
+
+void speech_commands_action(const char *action, int duration_seconds)
+{
+    phrase_t phrase = {0};
+    for (int i = 0; i < sizeof(s_confirmations) / sizeof(s_confirmations[0]); i++) {
+        if (strcmp(s_confirmations[i].action, action) == 0) {
+            for (int w = 0; w < 2 && s_confirmations[i].words[w]; w++) {
+                phrase_add(&phrase, s_confirmations[i].words[w]);
+            }
+            if (s_confirmations[i].duration) {
+                phrase_add_duration(&phrase, duration_seconds);
+            }
+            break;
+        }
+    }
+
+    // Until the word clips are in the pack, acknowledge with the wake chime
+    if (!phrase_synth_available(&phrase)) {
+        wake_up_action();
+        return;
+    }
+    audio_source_t source = { .kind = AUDIO_SOURCE_PHRASE, .phrase = phrase };
+    play_speech(&source);
 }
\ No newline at end of file
@@ -0,0 +1,569 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Timer synchronization between rings on the same network.
+//
+// Every ring multicasts a beacon on TIMER_SYNC_GROUP once a second and keeps
+// a table of the peers it hears. The rings share one timebase, that of the
+// master: the established ring with the lowest node id (from the MAC). A
+// ring that has just booted listens for TIMER_SYNC_LISTEN_MS; if nobody has a
+// timebase yet it takes its own clock as the base, otherwise it follows the
+// master and becomes established once synced. The master's base is its own
+// clock plus the offset it had when it took over, so a master going away
+// does not make the shared time jump.
+//
+// Followers ping the master NTP-style: t1 when the ping leaves (local), t2
+// and t3 when the master receives it and answers (shared), t4 when the pong
+// arrives (local). Each exchange gives an offset ((t2 - t1) + (t3 - t4)) / 2
+// and a round trip (t4 - t1) - (t3 - t2). Of the last TIMER_SYNC_FILTER
+// exchanges the one with the shortest round trip is used, since WiFi delay
+// is mostly queueing and power-save buffering that only ever adds time; the
+// offset is then known to within half that round trip, which must be under
+// TIMER_SYNC_MAX_ERROR_US before a ring counts as synced. Two followers can
+// each be off by that much, so rings agree to within the sum of their errors.
+//
+// When the master goes away its successor carries on in the same base, so
+// a follower keeps the offset it has as a first sample for the new master,
+// with the round trip it came from. The first exchanges after the switch
+// only move the clock if they are better; one that contradicts it beyond
+// both error bounds (the new master is in another base after all) drops it.
+//
+// The timer itself is a last-writer-wins register. A local start, pause,
+// resume, stop or add (voice, web or UDP) takes a snapshot of the TimerState
+// with its times in the shared base, stamps it with the shared time and
+// multicasts it at once; every beacon repeats the latest one, so a lost
+// packet or a ring that joins later catches up within a second. A ring
+// applies a state newer than its own, converting the times back to its own
+// clock, so update_timer_leds() draws the same progress everywhere.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_mac.h"
+#include "lwip/sockets.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "timer_sync.h"
+
+#define TIMER_SYNC_FAST_PING_MS     250
+#define TIMER_SYNC_RECV_TIMEOUT_MS  50
+#define TIMER_SYNC_MAX_PACKET       (sizeof(timer_sync_header_t) + sizeof(timer_sync_state_t))
+
+static const char *TAG = "TIMER_SYNC";
+
+typedef struct {
+    uint32_t node;              // 0 = free
+    uint32_t addr;              // network order
+    uint32_t master;
+    uint8_t flags;
+    int64_t last_us;
+} sync_peer_t;
+
+typedef struct {
+    int64_t offset_us;
+    int64_t delay_us;
+} sync_sample_t;
+
+static const timer_sync_ops_t *s_ops = NULL;
+static int s_sock = -1;
+static struct sockaddr_in s_group;
+static uint32_t s_node = 0;
+static SemaphoreHandle_t s_lock = NULL;     // s_state and its sends, from any task
+static portMUX_TYPE s_offset_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t s_offset_us = 0;             // shared = local + offset
+static timer_sync_state_t s_state;
+
+// Sync task only
+static int64_t s_boot_us = 0;
+static bool s_established = false;
+static uint32_t s_master = 0;
+static uint32_t s_master_addr = 0;
+static sync_peer_t s_peers[TIMER_SYNC_PEERS_MAX];
+static sync_sample_t s_samples[TIMER_SYNC_FILTER];
+static int s_sample_count = 0;
+static int s_sample_next = 0;
+static int64_t s_error_us = -1;             // half the best round trip, -1 = unknown
+static int s_seed = -1;                     // sample carried over from the last master
+
+static struct {
+    uint32_t beacons;
+    uint32_t pings;
+    uint32_t pongs;             // received from the master
+    uint32_t answered;          // pings answered
+    uint32_t published;
+    uint32_t applied;
+    uint32_t master_changes;
+    uint32_t bad;
+    int64_t last_step_us;       // last change of the offset
+    int64_t last_delay_us;
+    perf_counter_t delay_us;
+} s_stats;
+
+static int64_t sync_offset(void)
+{
+    portENTER_CRITICAL(&s_offset_mux);
+    int64_t offset = s_offset_us;
+    portEXIT_CRITICAL(&s_offset_mux);
+    return offset;
+}
+
+int64_t timer_sync_now_us(void)
+{
+    return esp_timer_get_time() + sync_offset();
+}
+
+static void sync_send(uint8_t type, const struct sockaddr_in *to, const void *payload, size_t len)
+{
+    uint8_t packet[TIMER_SYNC_MAX_PACKET];
+    timer_sync_header_t header = {
+        .magic = TIMER_SYNC_MAGIC,
+        .version = TIMER_SYNC_VERSION,
+        .type = type,
+        .node = s_node,
+        .master = s_master,
+        .flags = s_established ? TIMER_SYNC_FLAG_ESTABLISHED : 0,
+    };
+    memcpy(packet, &header, sizeof(header));
+    memcpy(packet + sizeof(header), payload, len);
+    sendto(s_sock, packet, sizeof(header) + len, 0, (const struct sockaddr *)to, sizeof(*to));
+}
+
+void timer_sync_publish(void)
+{
+    if (!s_lock) {
+        return;
+    }
+    // main.c's timer lock first, like its timer_control_* callers
+    s_ops->lock();
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    timer_sync_state_t state;
+    memset(&state, 0, sizeof(state));
+    s_ops->snapshot(&state);
+    state.stamp_us = timer_sync_now_us();
+    state.stamp_node = s_node;
+    s_state = state;
+    sync_send(TIMER_SYNC_STATE, &s_group, &s_state, sizeof(s_state));
+    s_stats.published++;
+    xSemaphoreGive(s_lock);
+    s_ops->unlock();
+}
+
+static bool sync_newer(const timer_sync_state_t *a, const timer_sync_state_t *b)
+{
+    return a->stamp_us > b->stamp_us || (a->stamp_us == b->stamp_us && a->stamp_node > b->stamp_node);
+}
+
+static void sync_receive_state(const sync_peer_t *peer, const timer_sync_state_t *in)
+{
+    // Only states in the base this ring follows can be converted
+    if (in->stamp_us == 0 || !s_established || !(peer->flags & TIMER_SYNC_FLAG_ESTABLISHED) ||
+        peer->master != s_master) {
+        return;
+    }
+    s_ops->lock();
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (sync_newer(in, &s_state)) {
+        s_state = *in;
+        // A countdown that ended before this ring heard of it is not replayed
+        bool over = in->active && in->countdown && !in->paused &&
+                    timer_sync_now_us() - in->start_us >= (int64_t)in->total_s * 1000000;
+        if (!over) {
+            s_ops->apply(in);
+            s_stats.applied++;
+            ESP_LOGI(TAG, "Timer %s from %08lx", in->active ? (in->paused ? "paused" : "running") : "stopped",
+                     (unsigned long)in->stamp_node);
+        }
+    }
+    xSemaphoreGive(s_lock);
+    s_ops->unlock();
+}
+
+static void sync_reset_samples(void)
+{
+    s_sample_count = 0;
+    s_sample_next = 0;
+    s_error_us = -1;
+    s_seed = -1;
+}
+
+static int64_t sync_abs(int64_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+static void sync_receive_pong(const sync_peer_t *peer, const timer_sync_pong_t *pong, int64_t t4)
+{
+    if (pong->requester != s_node || peer->node != s_master || s_master == s_node) {
+        return;
+    }
+    s_stats.pongs++;
+    int64_t delay = (t4 - pong->t1) - (pong->t3 - pong->t2);
+    if (delay < 0) {
+        delay = 0;
+    }
+    int64_t offset = ((pong->t2 - pong->t1) + (pong->t3 - t4)) / 2;
+    if (s_seed >= 0) {
+        const sync_sample_t *seed = &s_samples[s_seed];
+        if (s_seed == s_sample_next) {
+            s_seed = -1;        // aged out
+        } else if (sync_abs(offset - seed->offset_us) > (delay + seed->delay_us) / 2) {
+            s_samples[s_seed].delay_us = INT64_MAX;
+            s_seed = -1;
+            ESP_LOGW(TAG, "New master's time disagrees with the carried-over offset");
+        }
+    }
+    s_samples[s_sample_next].offset_us = offset;
+    s_samples[s_sample_next].delay_us = delay;
+    s_sample_next = (s_sample_next + 1) % TIMER_SYNC_FILTER;
+    if (s_sample_count < TIMER_SYNC_FILTER) {
+        s_sample_count++;
+    }
+    s_stats.last_delay_us = delay;
+    perf_counter_add(&s_stats.delay_us, delay);
+
+    const sync_sample_t *best = &s_samples[0];
+    for (int i = 1; i < s_sample_count; i++) {
+        if (s_samples[i].delay_us < best->delay_us) {
+            best = &s_samples[i];
+        }
+    }
+    portENTER_CRITICAL(&s_offset_mux);
+    s_stats.last_step_us = best->offset_us - s_offset_us;
+    s_offset_us = best->offset_us;
+    portEXIT_CRITICAL(&s_offset_mux);
+    s_error_us = best->delay_us / 2;
+
+    if (!s_established && s_sample_count >= TIMER_SYNC_FILTER / 2 && s_error_us <= TIMER_SYNC_MAX_ERROR_US) {
+        s_established = true;
+        ESP_LOGI(TAG, "Synced to %08lx: offset %lld us, within %lld us",
+                 (unsigned long)s_master, s_offset_us, s_error_us);
+    }
+}
+
+static sync_peer_t *sync_peer(uint32_t node, uint32_t addr, int64_t now)
+{
+    sync_peer_t *free_slot = NULL;
+    for (int i = 0; i < TIMER_SYNC_PEERS_MAX; i++) {
+        if (s_peers[i].node == node) {
+            s_peers[i].addr = addr;
+            return &s_peers[i];
+        }
+        if (!free_slot && (s_peers[i].node == 0 || now - s_peers[i].last_us > TIMER_SYNC_PEER_TTL_MS * 1000LL)) {
+            free_slot = &s_peers[i];
+        }
+    }
+    if (free_slot) {
+        memset(free_slot, 0, sizeof(*free_slot));
+        free_slot->node = node;
+        free_slot->addr = addr;
+    }
+    return free_slot;
+}
+
+// The established ring with the lowest node id keeps the time
+static void sync_elect(int64_t now)
+{
+    uint32_t master = s_established ? s_node : UINT32_MAX;
+    uint32_t master_addr = 0;
+    bool others_established = false;
+    for (int i = 0; i < TIMER_SYNC_PEERS_MAX; i++) {
+        sync_peer_t *p = &s_peers[i];
+        if (p->node == 0 || now - p->last_us > TIMER_SYNC_PEER_TTL_MS * 1000LL ||
+            !(p->flags & TIMER_SYNC_FLAG_ESTABLISHED)) {
+            continue;
+        }
+        others_established = true;
+        if (p->node < master) {
+            master = p->node;
+            master_addr = p->addr;
+        }
+    }
+    if (!s_established && !others_established && now - s_boot_us >= TIMER_SYNC_LISTEN_MS * 1000LL) {
+        s_established = true;
+        master = s_node;
+        ESP_LOGI(TAG, "No other timebase heard, %08lx keeps the time", (unsigned long)s_node);
+    }
+    if (master == UINT32_MAX) {
+        master = 0;
+    }
+    if (master != s_master) {
+        ESP_LOGI(TAG, "Master %08lx -> %08lx", (unsigned long)s_master, (unsigned long)master);
+        // A follower whose master went away: the successor has the same base
+        bool failover = s_established && s_master != 0 && s_master != s_node && master != 0 &&
+                        master != s_node && s_error_us >= 0;
+        int64_t error = s_error_us;
+        if (s_master == s_node && master != s_node) {
+            // Two timebases met (simultaneous boot, healed partition); this
+            // one is dropped and the ring is unsynced until it has caught up
+            s_established = false;
+        }
+        s_master = master;
+        s_stats.master_changes++;
+        sync_reset_samples();
+        if (master == s_node) {
+            s_error_us = 0;
+        } else if (failover) {
+            s_samples[0].offset_us = sync_offset();
+            s_samples[0].delay_us = error * 2;
+            s_sample_count = 1;
+            s_sample_next = 1;
+            s_seed = 0;
+            s_error_us = error;
+        }
+    }
+    s_master_addr = master_addr;
+}
+
+static void sync_handle(const uint8_t *packet, int n, const struct sockaddr_in *from, int64_t now)
+{
+    timer_sync_header_t header;
+    if (n < (int)sizeof(header)) {
+        s_stats.bad++;
+        return;
+    }
+    memcpy(&header, packet, sizeof(header));
+    if (header.magic != TIMER_SYNC_MAGIC || header.version != TIMER_SYNC_VERSION || header.node == 0) {
+        s_stats.bad++;
+        return;
+    }
+    if (header.node == s_node) {
+        return;
+    }
+    sync_peer_t *peer = sync_peer(header.node, from->sin_addr.s_addr, now);
+    if (!peer) {
+        return;                 // table full of live peers
+    }
+    peer->master = header.master;
+    peer->flags = header.flags;
+    peer->last_us = now;
+
+    const uint8_t *payload = packet + sizeof(header);
+    int len = n - sizeof(header);
+    switch (header.type) {
+    case TIMER_SYNC_BEACON:
+    case TIMER_SYNC_STATE:
+        if (len < (int)sizeof(timer_sync_state_t)) {
+            s_stats.bad++;
+            return;
+        }
+        timer_sync_state_t state;
+        memcpy(&state, payload, sizeof(state));
+        state.name[sizeof(state.name) - 1] = '\0';
+        sync_receive_state(peer, &state);
+        break;
+    case TIMER_SYNC_PING: {
+        int64_t t1;
+        if (len < (int)sizeof(t1)) {
+            s_stats.bad++;
+            return;
+        }
+        if (!s_established) {
+            return;
+        }
+        memcpy(&t1, payload, sizeof(t1));
+        timer_sync_pong_t pong = {
+            .requester = header.node,
+            .t1 = t1,
+            .t2 = now + sync_offset(),
+        };
+        pong.t3 = timer_sync_now_us();
+        sync_send(TIMER_SYNC_PONG, from, &pong, sizeof(pong));
+        s_stats.answered++;
+        break;
+    }
+    case TIMER_SYNC_PONG: {
+        timer_sync_pong_t pong;
+        if (len < (int)sizeof(pong)) {
+            s_stats.bad++;
+            return;
+        }
+        memcpy(&pong, payload, sizeof(pong));
+        sync_receive_pong(peer, &pong, now);
+        break;
+    }
+    default:
+        s_stats.bad++;
+        break;
+    }
+}
+
+static void timer_sync_task(void *arg)
+{
+    uint8_t packet[TIMER_SYNC_MAX_PACKET];
+    int64_t next_beacon = 0;
+    int64_t next_ping = 0;
+
+    while (1) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        int n = recvfrom(s_sock, packet, sizeof(packet), 0, (struct sockaddr *)&from, &from_len);
+        int64_t now = esp_timer_get_time();
+        if (n > 0) {
+            sync_handle(packet, n, &from, now);
+        }
+
+        sync_elect(now);
+        if (now >= next_beacon) {
+            xSemaphoreTake(s_lock, portMAX_DELAY);
+            sync_send(TIMER_SYNC_BEACON, &s_group, &s_state, sizeof(s_state));
+            xSemaphoreGive(s_lock);
+            s_stats.beacons++;
+            next_beacon = now + TIMER_SYNC_BEACON_MS * 1000LL;
+        }
+        if (s_master && s_master != s_node && now >= next_ping) {
+            struct sockaddr_in to = {
+                .sin_family = AF_INET,
+                .sin_port = htons(TIMER_SYNC_PORT),
+                .sin_addr.s_addr = s_master_addr,
+            };
+            int64_t t1 = esp_timer_get_time();
+            sync_send(TIMER_SYNC_PING, &to, &t1, sizeof(t1));
+            s_stats.pings++;
+            next_ping = now + (s_sample_count < TIMER_SYNC_FILTER ? TIMER_SYNC_FAST_PING_MS : TIMER_SYNC_PING_MS) * 1000LL;
+        }
+    }
+}
+
+esp_err_t timer_sync_start(const timer_sync_ops_t *ops)
+{
+    if (s_sock >= 0) {
+        return ESP_OK;
+    }
+    uint8_t mac[6];
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    s_node = ((uint32_t)mac[2] << 24) | ((uint32_t)mac[3] << 16) | ((uint32_t)mac[4] << 8) | mac[5];
+    s_ops = ops;
+    s_boot_us = esp_timer_get_time();
+
+    s_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s_sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket: errno %d", errno);
+        return ESP_FAIL;
+    }
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(TIMER_SYNC_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    s_group.sin_family = AF_INET;
+    s_group.sin_port = htons(TIMER_SYNC_PORT);
+    s_group.sin_addr.s_addr = inet_addr(TIMER_SYNC_GROUP);
+    struct ip_mreq mreq = {
+        .imr_multiaddr.s_addr = s_group.sin_addr.s_addr,
+        .imr_interface.s_addr = htonl(INADDR_ANY),
+    };
+    uint8_t loop = 0;
+    struct timeval timeout = { .tv_sec = 0, .tv_usec = TIMER_SYNC_RECV_TIMEOUT_MS * 1000 };
+    if (bind(s_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        setsockopt(s_sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
+        ESP_LOGE(TAG, "Failed to bind or join %s:%d: errno %d", TIMER_SYNC_GROUP, TIMER_SYNC_PORT, errno);
+        close(s_sock);
+        s_sock = -1;
+        return ESP_FAIL;
+    }
+    setsockopt(s_sock, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    setsockopt(s_sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock ||
+        xTaskCreatePinnedToCore(&timer_sync_task, "timer_sync", 4 * 1024, NULL, 5, NULL, 0) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create timer sync task");
+        close(s_sock);
+        s_sock = -1;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Node %08lx on %s:%d", (unsigned long)s_node, TIMER_SYNC_GROUP, TIMER_SYNC_PORT);
+    return ESP_OK;
+}
+
+static void sync_node_json(cJSON *parent, const char *name, uint32_t node)
+{
+    char text[12];
+    snprintf(text, sizeof(text), "%08lx", (unsigned long)node);
+    cJSON_AddStringToObject(parent, name, text);
+}
+
+static esp_err_t sync_api_handler(httpd_req_t *req)
+{
+    int64_t now = esp_timer_get_time();
+    cJSON *response = cJSON_CreateObject();
+    sync_node_json(response, "node", s_node);
+    sync_node_json(response, "master", s_master);
+    cJSON_AddStringToObject(response, "role", !s_master ? "listening" : s_master == s_node ? "master" : "follower");
+    cJSON_AddBoolToObject(response, "established", s_established);
+    cJSON_AddBoolToObject(response, "synced", s_error_us >= 0 && s_error_us <= TIMER_SYNC_MAX_ERROR_US);
+    cJSON_AddNumberToObject(response, "offset_us", sync_offset());
+    cJSON_AddNumberToObject(response, "error_us", s_error_us);
+    cJSON_AddNumberToObject(response, "samples", s_sample_count);
+    cJSON_AddNumberToObject(response, "last_step_us", s_stats.last_step_us);
+    cJSON_AddNumberToObject(response, "round_trip_us_last", s_stats.last_delay_us);
+    cJSON_AddNumberToObject(response, "round_trip_us_avg", perf_counter_avg(&s_stats.delay_us));
+    cJSON_AddNumberToObject(response, "round_trip_us_max", s_stats.delay_us.max);
+    cJSON_AddNumberToObject(response, "shared_ms", timer_sync_now_us() / 1000);
+
+    cJSON *counts = cJSON_AddObjectToObject(response, "counts");
+    cJSON_AddNumberToObject(counts, "beacons", s_stats.beacons);
+    cJSON_AddNumberToObject(counts, "pings", s_stats.pings);
+    cJSON_AddNumberToObject(counts, "pongs", s_stats.pongs);
+    cJSON_AddNumberToObject(counts, "answered", s_stats.answered);
+    cJSON_AddNumberToObject(counts, "published", s_stats.published);
+    cJSON_AddNumberToObject(counts, "applied", s_stats.applied);
+    cJSON_AddNumberToObject(counts, "master_changes", s_stats.master_changes);
+    cJSON_AddNumberToObject(counts, "bad", s_stats.bad);
+
+    cJSON *peers = cJSON_AddArrayToObject(response, "peers");
+    for (int i = 0; i < TIMER_SYNC_PEERS_MAX; i++) {
+        sync_peer_t *p = &s_peers[i];
+        if (p->node == 0 || now - p->last_us > TIMER_SYNC_PEER_TTL_MS * 1000LL) {
+            continue;
+        }
+        struct in_addr in = { .s_addr = p->addr };
+        cJSON *item = cJSON_CreateObject();
+        sync_node_json(item, "node", p->node);
+        cJSON_AddStringToObject(item, "addr", inet_ntoa(in));
+        sync_node_json(item, "master", p->master);
+        cJSON_AddBoolToObject(item, "established", p->flags & TIMER_SYNC_FLAG_ESTABLISHED);
+        cJSON_AddNumberToObject(item, "idle_ms", (now - p->last_us) / 1000);
+        cJSON_AddItemToArray(peers, item);
+    }
+
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        timer_sync_state_t state = s_state;
+        xSemaphoreGive(s_lock);
+        cJSON *timer = cJSON_AddObjectToObject(response, "timer");
+        sync_node_json(timer, "from", state.stamp_node);
+        cJSON_AddNumberToObject(timer, "age_ms", state.stamp_us ? (timer_sync_now_us() - state.stamp_us) / 1000 : -1);
+        cJSON_AddBoolToObject(timer, "active", state.active);
+        cJSON_AddBoolToObject(timer, "paused", state.paused);
+        cJSON_AddNumberToObject(timer, "total_s", state.total_s);
+        cJSON_AddStringToObject(timer, "name", state.name);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t timer_sync_register_http(httpd_handle_t server)
+{
+    httpd_uri_t sync_uri = {
+        .uri = "/api/sync",
+        .method = HTTP_GET,
+        .handler = sync_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &sync_uri);
+}
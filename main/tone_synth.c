@@ -0,0 +1,349 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Procedural alert tones.
+//
+// Chimes and beeps are generated while they play instead of being stored as
+// samples: each pattern is a short note list (frequency, partial, level,
+// key time, gap) under one ADSR envelope. Oscillators are 32-bit phase
+// accumulators (DDS) reading a 256-entry sine table with linear
+// interpolation, or a triangle computed from the phase. The envelope runs
+// in Q24 with per-stage increments worked out at each note start, so the
+// inner loop is integer only.
+//
+// tone_synth_init() renders every pattern once in audio engine sized blocks
+// and checks the worst block against TONE_BUDGET_CYCLES.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "audio_engine.h"
+#include "tone_synth.h"
+
+#define TONE_TABLE_BITS         8
+#define TONE_TABLE_SIZE         (1 << TONE_TABLE_BITS)
+#define TONE_ENV_PEAK           (1 << 24)
+
+static const char *TAG = "TONE_SYNTH";
+
+static const tone_pattern_t s_patterns[TONE_COUNT] = {
+    [TONE_WAKE] = {
+        "wake", TONE_WAVE_SINE, {4, 150, 90, 180}, 1, 2, {
+            {1047, 2094, 150, 50, 60, 0},
+            {1568, 3136, 150, 50, 160, 40},
+        },
+    },
+    [TONE_COUNTDOWN] = {
+        "countdown", TONE_WAVE_SINE, {3, 30, 200, 25}, 1, 1, {
+            {1000, 2000, 180, 30, 50, 0},
+        },
+    },
+    [TONE_COUNTDOWN_FINAL] = {
+        "countdown_final", TONE_WAVE_SINE, {3, 30, 200, 40}, 1, 1, {
+            {1500, 3000, 190, 30, 120, 0},
+        },
+    },
+    [TONE_COMPLETE] = {
+        // Four fast beeps and a pause, five times: the length of the end animation
+        "complete", TONE_WAVE_TRIANGLE, {2, 20, 220, 20}, 5, 5, {
+            {2093, 0, 220, 0, 70, 50},
+            {2093, 0, 220, 0, 70, 50},
+            {2093, 0, 220, 0, 70, 50},
+            {2093, 0, 220, 0, 70, 50},
+            {0, 0, 0, 0, 0, 420},
+        },
+    },
+};
+
+static int16_t s_sine[TONE_TABLE_SIZE + 1];   // one guard entry for interpolation
+
+// Cycles per TONE_BENCH_BLOCK, from the boot benchmark and from playback
+static perf_counter_t s_bench_cycles;
+static uint32_t s_bench_max[TONE_COUNT];
+static uint32_t s_bench_samples[TONE_COUNT];
+static perf_counter_t s_play_cycles;
+static uint64_t s_play_samples = 0;
+static int16_t s_bench_pcm[TONE_BENCH_BLOCK];
+
+static uint32_t ms_to_samples(uint16_t ms)
+{
+    return (uint32_t)ms * TONE_SYNTH_RATE / 1000;
+}
+
+static void tone_note_start(tone_reader_t *r)
+{
+    const tone_pattern_t *p = r->pattern;
+    const tone_note_t *n = &p->notes[r->note];
+    r->step[0] = (uint32_t)(((uint64_t)n->freq_hz << 32) / TONE_SYNTH_RATE);
+    r->step[1] = (uint32_t)(((uint64_t)n->partial_hz << 32) / TONE_SYNTH_RATE);
+    r->level[0] = n->freq_hz ? n->level : 0;
+    r->level[1] = n->partial_hz ? n->partial_level : 0;
+    r->phase[0] = 0;
+    r->phase[1] = 0;
+    r->pos = 0;
+    r->on = ms_to_samples(n->on_ms);
+    r->length = r->on + ms_to_samples(p->env.release_ms) + ms_to_samples(n->gap_ms);
+    r->sustain = (int32_t)p->env.sustain << 16;
+
+    uint32_t attack = ms_to_samples(p->env.attack_ms);
+    r->env = 0;
+    r->env_step = attack ? TONE_ENV_PEAK / attack : TONE_ENV_PEAK;
+    r->stage = TONE_ENV_ATTACK;
+}
+
+static inline void tone_env_tick(tone_reader_t *r)
+{
+    switch (r->stage) {
+    case TONE_ENV_ATTACK:
+        r->env += r->env_step;
+        if (r->env >= TONE_ENV_PEAK) {
+            uint32_t decay = ms_to_samples(r->pattern->env.decay_ms);
+            r->env = TONE_ENV_PEAK;
+            r->env_step = decay ? (TONE_ENV_PEAK - r->sustain) / decay : TONE_ENV_PEAK;
+            if (r->env_step < 1) {
+                r->env_step = 1;
+            }
+            r->stage = TONE_ENV_DECAY;
+        }
+        break;
+    case TONE_ENV_DECAY:
+        r->env -= r->env_step;
+        if (r->env <= r->sustain) {
+            r->env = r->sustain;
+            r->stage = TONE_ENV_SUSTAIN;
+        }
+        break;
+    case TONE_ENV_RELEASE:
+        r->env -= r->env_step;
+        if (r->env <= 0) {
+            r->env = 0;
+            r->stage = TONE_ENV_OFF;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static inline int32_t tone_osc(tone_wave_t wave, uint32_t phase)
+{
+    if (wave == TONE_WAVE_TRIANGLE) {
+        int32_t p = phase >> 16;
+        return (p < 32768 ? p : 65535 - p) * 2 - 32767;
+    }
+    uint32_t i = phase >> (32 - TONE_TABLE_BITS);
+    int32_t frac = (phase >> (16 - TONE_TABLE_BITS)) & 0xFFFF;
+    int32_t a = s_sine[i];
+    return a + (((s_sine[i + 1] - a) * frac) >> 16);
+}
+
+void tone_reader_init(tone_reader_t *reader, tone_id_t id)
+{
+    memset(reader, 0, sizeof(*reader));
+    if (id >= TONE_COUNT || s_patterns[id].count == 0) {
+        reader->finished = true;
+        return;
+    }
+    reader->pattern = &s_patterns[id];
+    tone_note_start(reader);
+}
+
+int tone_reader_read(tone_reader_t *r, int16_t *out, int max)
+{
+    uint32_t start = esp_cpu_get_cycle_count();
+    int n = 0;
+    while (n < max && !r->finished) {
+        if (r->pos == r->length) {
+            if (++r->note == r->pattern->count) {
+                r->note = 0;
+                if (++r->pass >= r->pattern->repeat) {
+                    r->finished = true;
+                    break;
+                }
+            }
+            tone_note_start(r);
+            continue;
+        }
+        if (r->pos == r->on) {
+            uint32_t release = ms_to_samples(r->pattern->env.release_ms);
+            r->env_step = release ? r->env / release : r->env;
+            if (r->env_step < 1) {
+                r->env_step = 1;
+            }
+            r->stage = TONE_ENV_RELEASE;
+        }
+
+        // Both oscillators always run, rests included: the cost per sample is fixed
+        tone_wave_t wave = r->pattern->wave;
+        int32_t mix = tone_osc(wave, r->phase[0]) * r->level[0] + tone_osc(wave, r->phase[1]) * r->level[1];
+        r->phase[0] += r->step[0];
+        r->phase[1] += r->step[1];
+        tone_env_tick(r);
+        out[n++] = (int16_t)(((mix >> 8) * (r->env >> 9)) >> 15);
+        r->pos++;
+    }
+    perf_counter_add(&s_play_cycles, esp_cpu_get_cycle_count() - start);
+    s_play_samples += n;
+    return n;
+}
+
+tone_id_t tone_synth_find(const char *name)
+{
+    for (int i = 0; i < TONE_COUNT; i++) {
+        if (strcmp(s_patterns[i].name, name) == 0) {
+            return (tone_id_t)i;
+        }
+    }
+    return TONE_COUNT;
+}
+
+static uint32_t tone_duration_ms(const tone_pattern_t *p)
+{
+    uint32_t ms = 0;
+    for (int i = 0; i < p->count; i++) {
+        ms += p->notes[i].on_ms + p->env.release_ms + p->notes[i].gap_ms;
+    }
+    return ms * p->repeat;
+}
+
+static void tone_synth_bench(void)
+{
+    static tone_reader_t reader;
+    perf_counter_reset(&s_bench_cycles);
+    for (int id = 0; id < TONE_COUNT; id++) {
+        s_bench_max[id] = 0;
+        s_bench_samples[id] = 0;
+        tone_reader_init(&reader, (tone_id_t)id);
+        while (true) {
+            uint32_t start = esp_cpu_get_cycle_count();
+            int n = tone_reader_read(&reader, s_bench_pcm, TONE_BENCH_BLOCK);
+            uint32_t cycles = esp_cpu_get_cycle_count() - start;
+            if (n <= 0) {
+                break;
+            }
+            perf_counter_add(&s_bench_cycles, cycles);
+            if (cycles > s_bench_max[id]) {
+                s_bench_max[id] = cycles;
+            }
+            s_bench_samples[id] += n;
+        }
+    }
+    // Playback figures should only count real playback
+    perf_counter_reset(&s_play_cycles);
+    s_play_samples = 0;
+}
+
+esp_err_t tone_synth_init(void)
+{
+    for (int i = 0; i <= TONE_TABLE_SIZE; i++) {
+        s_sine[i] = (int16_t)lrintf(32767.0f * sinf(2.0f * (float)M_PI * i / TONE_TABLE_SIZE));
+    }
+
+    tone_synth_bench();
+    ESP_LOGI(TAG, "%d tones in %u bytes of parameters, %lu cycles/block avg, %lu max (budget %d)",
+             TONE_COUNT, (unsigned)sizeof(s_patterns), (unsigned long)perf_counter_avg(&s_bench_cycles),
+             (unsigned long)s_bench_cycles.max, TONE_BUDGET_CYCLES);
+    if (s_bench_cycles.max > TONE_BUDGET_CYCLES) {
+        ESP_LOGW(TAG, "Tone synthesis over its cycle budget: %lu > %d",
+                 (unsigned long)s_bench_cycles.max, TONE_BUDGET_CYCLES);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t tones_api_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_POST) {
+        char buf[64];
+        int ret = httpd_req_recv(req, buf, sizeof(buf) - 1);
+        if (ret <= 0) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        buf[ret] = '\0';
+
+        cJSON *json = cJSON_Parse(buf);
+        if (!json) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON");
+            return ESP_OK;
+        }
+        cJSON *play = cJSON_GetObjectItem(json, "play");
+        tone_id_t id = cJSON_IsString(play) ? tone_synth_find(play->valuestring) : TONE_COUNT;
+        cJSON_Delete(json);
+        if (id == TONE_COUNT) {
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Unknown tone");
+            return ESP_OK;
+        }
+
+        audio_play_t play_req = {
+            .voice = AUDIO_VOICE_ALERT,
+            .priority = 1,
+            .gain = 1.0f,
+            .source = { .kind = AUDIO_SOURCE_TONE, .tone = id },
+        };
+        if (audio_engine_play(&play_req) != ESP_OK) {
+            httpd_resp_set_status(req, "409 Conflict");
+            httpd_resp_sendstr(req, "{\"error\":\"audio engine not running or busy\"}");
+            return ESP_OK;
+        }
+        httpd_resp_set_status(req, "202 Accepted");
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddNumberToObject(response, "param_bytes", sizeof(s_patterns));
+    cJSON_AddNumberToObject(response, "table_bytes", sizeof(s_sine));
+    cJSON *list = cJSON_AddArrayToObject(response, "tones");
+    for (int i = 0; i < TONE_COUNT; i++) {
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", s_patterns[i].name);
+        cJSON_AddNumberToObject(item, "duration_ms", tone_duration_ms(&s_patterns[i]));
+        cJSON_AddNumberToObject(item, "rendered_ms", s_bench_samples[i] * 1000 / TONE_SYNTH_RATE);
+        cJSON_AddNumberToObject(item, "block_cycles_max", s_bench_max[i]);
+        cJSON_AddItemToArray(list, item);
+    }
+
+    cJSON *cost = cJSON_AddObjectToObject(response, "synth");
+    cJSON_AddNumberToObject(cost, "block_samples", TONE_BENCH_BLOCK);
+    cJSON_AddNumberToObject(cost, "budget_cycles", TONE_BUDGET_CYCLES);
+    cJSON_AddNumberToObject(cost, "bench_block_cycles_avg", perf_counter_avg(&s_bench_cycles));
+    cJSON_AddNumberToObject(cost, "bench_block_cycles_max", s_bench_cycles.max);
+    cJSON_AddBoolToObject(cost, "within_budget", s_bench_cycles.max <= TONE_BUDGET_CYCLES);
+    cJSON_AddNumberToObject(cost, "play_block_cycles_avg",
+                            s_play_samples ? (double)s_play_cycles.total * TONE_BENCH_BLOCK / s_play_samples : 0);
+    cJSON_AddNumberToObject(cost, "play_read_cycles_max", s_play_cycles.max);
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t tone_synth_register_http(httpd_handle_t server)
+{
+    httpd_uri_t tones_get_uri = {
+        .uri = "/api/tones",
+        .method = HTTP_GET,
+        .handler = tones_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &tones_get_uri);
+
+    httpd_uri_t tones_post_uri = {
+        .uri = "/api/tones",
+        .method = HTTP_POST,
+        .handler = tones_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &tones_post_uri);
+}
@@ -0,0 +1,334 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Binary UDP control protocol for home-automation hubs.
+//
+// One datagram per command on UDP_CONTROL_PORT: a 10-byte little-endian
+// udp_header_t and a fixed payload (see udp_control.h). No connection, no
+// headers, no JSON, and the whole protocol costs one socket. Commands run
+// through the same timer control functions as voice and the REST API, so
+// the LEDs, the live push and the web UI all see them the same way.
+//
+// UDP may deliver a packet twice or a client may resend after a lost ack,
+// so every sender numbers its packets. The last sequence number of up to
+// UDP_PEERS_MAX senders (address and port) is remembered; a packet that is
+// not newer than that is not executed again, only acknowledged with
+// UDP_FLAG_DUPLICATE. A sender idle for UDP_PEER_TTL_MS is forgotten, so a
+// restarted client should begin at a random sequence number. Replies carry
+// the resulting timer state; they are sent when the request sets
+// UDP_FLAG_ACK, and always for UDP_OP_STATUS.
+//
+// Like the REST API this is for a trusted LAN: there is no authentication.
+// Packet counts and handling time are served at /api/udp.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "lwip/sockets.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "udp_control.h"
+
+#define UDP_MAX_SECONDS         (24 * 3600)
+#define UDP_MAX_SEGMENTS        12
+
+static const char *TAG = "UDP_CONTROL";
+
+typedef struct {
+    uint32_t addr;              // 0 = free
+    uint16_t port;
+    uint32_t last_seq;
+    uint8_t last_result;
+    int64_t last_us;
+} udp_peer_t;
+
+static const udp_control_ops_t *s_ops = NULL;
+static int s_sock = -1;
+static udp_peer_t s_peers[UDP_PEERS_MAX];
+
+static struct {
+    uint32_t packets;
+    uint32_t commands;
+    uint32_t duplicates;
+    uint32_t bad;               // malformed, wrong magic/version or rejected payload
+    uint32_t replies;
+    uint32_t per_op[UDP_OP_STATUS + 1];
+    perf_counter_t handle_cycles;       // parse, execute and build the reply
+} s_stats;
+
+// Find the sender's entry, taking a free or the stalest one for a new
+// sender. A new or expired entry accepts seq as the next packet.
+static udp_peer_t *udp_peer(uint32_t addr, uint16_t port, uint32_t seq, int64_t now)
+{
+    udp_peer_t *found = NULL;
+    udp_peer_t *oldest = &s_peers[0];
+    for (int i = 0; i < UDP_PEERS_MAX; i++) {
+        udp_peer_t *p = &s_peers[i];
+        if (p->addr == addr && p->port == port) {
+            found = p;
+            break;
+        }
+        if (p->addr == 0 || p->last_us < oldest->last_us) {
+            oldest = p;
+            if (p->addr == 0) {
+                break;
+            }
+        }
+    }
+    if (found && now - found->last_us < UDP_PEER_TTL_MS * 1000LL) {
+        return found;
+    }
+    udp_peer_t *p = found ? found : oldest;
+    p->addr = addr;
+    p->port = port;
+    p->last_seq = seq - 1;
+    p->last_result = UDP_RESULT_OK;
+    return p;
+}
+
+static bool udp_valid_appearance(const udp_appearance_t *a)
+{
+    return a->segments >= 1 && a->segments <= UDP_MAX_SEGMENTS;
+}
+
+static udp_result_t udp_execute(uint8_t opcode, const uint8_t *payload, uint8_t len)
+{
+    switch (opcode) {
+    case UDP_OP_START: {
+        udp_start_t start;
+        memset(&start, 0, sizeof(start));
+        if (len < offsetof(udp_start_t, appearance)) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        memcpy(&start, payload, len < sizeof(start) ? len : sizeof(start));
+        if (start.seconds == 0 || start.seconds > UDP_MAX_SECONDS) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        if ((start.flags & UDP_START_APPEARANCE) &&
+            (len < sizeof(start) || !udp_valid_appearance(&start.appearance))) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        s_ops->start(&start);
+        return UDP_RESULT_OK;
+    }
+    case UDP_OP_PAUSE:
+        s_ops->pause();
+        return UDP_RESULT_OK;
+    case UDP_OP_RESUME:
+        s_ops->resume();
+        return UDP_RESULT_OK;
+    case UDP_OP_STOP:
+        s_ops->stop();
+        return UDP_RESULT_OK;
+    case UDP_OP_ADD: {
+        uint32_t seconds;
+        if (len < sizeof(seconds)) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        memcpy(&seconds, payload, sizeof(seconds));
+        if (seconds == 0 || seconds > UDP_MAX_SECONDS) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        s_ops->add(seconds);
+        return UDP_RESULT_OK;
+    }
+    case UDP_OP_SETTINGS: {
+        udp_appearance_t appearance;
+        if (len < sizeof(appearance)) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        memcpy(&appearance, payload, sizeof(appearance));
+        if (!udp_valid_appearance(&appearance)) {
+            return UDP_RESULT_BAD_REQUEST;
+        }
+        s_ops->settings(&appearance);
+        return UDP_RESULT_OK;
+    }
+    case UDP_OP_STATUS:
+        return UDP_RESULT_OK;
+    default:
+        return UDP_RESULT_UNSUPPORTED;
+    }
+}
+
+// Handle one datagram; returns the reply length, 0 for no reply
+static size_t udp_handle(const uint8_t *packet, size_t size, const struct sockaddr_in *from, uint8_t *reply)
+{
+    udp_header_t header;
+    if (size < sizeof(header)) {
+        s_stats.bad++;
+        return 0;
+    }
+    memcpy(&header, packet, sizeof(header));
+    if (header.magic != UDP_CONTROL_MAGIC || header.version != UDP_CONTROL_VERSION ||
+        (header.opcode & UDP_OP_REPLY) || sizeof(header) + header.len > size) {
+        s_stats.bad++;
+        return 0;
+    }
+
+    int64_t now = esp_timer_get_time();
+    udp_peer_t *peer = udp_peer(from->sin_addr.s_addr, from->sin_port, header.seq, now);
+    uint8_t reply_flags = 0;
+    uint8_t result;
+    if ((int32_t)(header.seq - peer->last_seq) <= 0 && header.opcode != UDP_OP_STATUS) {
+        // Seen it: answer as before, do not run it twice
+        s_stats.duplicates++;
+        reply_flags = UDP_FLAG_DUPLICATE;
+        result = header.seq == peer->last_seq ? peer->last_result : UDP_RESULT_OK;
+    } else {
+        result = udp_execute(header.opcode, packet + sizeof(header), header.len);
+        if (result == UDP_RESULT_OK) {
+            s_stats.commands++;
+            s_stats.per_op[header.opcode]++;
+        } else {
+            s_stats.bad++;
+        }
+        if (header.opcode != UDP_OP_STATUS) {
+            peer->last_seq = header.seq;
+            peer->last_result = result;
+        }
+    }
+    peer->last_us = now;
+
+    if (!(header.flags & UDP_FLAG_ACK) && header.opcode != UDP_OP_STATUS) {
+        return 0;
+    }
+    udp_reply_t body;
+    memset(&body, 0, sizeof(body));
+    s_ops->status(&body);
+    body.result = result;
+    udp_header_t out = {
+        .magic = UDP_CONTROL_MAGIC,
+        .version = UDP_CONTROL_VERSION,
+        .opcode = header.opcode | UDP_OP_REPLY,
+        .seq = header.seq,
+        .flags = reply_flags,
+        .len = sizeof(body),
+    };
+    memcpy(reply, &out, sizeof(out));
+    memcpy(reply + sizeof(out), &body, sizeof(body));
+    return sizeof(out) + sizeof(body);
+}
+
+static void udp_control_task(void *arg)
+{
+    uint8_t packet[UDP_CONTROL_MAX_PACKET];
+    uint8_t reply[sizeof(udp_header_t) + sizeof(udp_reply_t)];
+
+    while (1) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        int n = recvfrom(s_sock, packet, sizeof(packet), 0, (struct sockaddr *)&from, &from_len);
+        if (n < 0) {
+            ESP_LOGW(TAG, "recvfrom failed: errno %d", errno);
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        s_stats.packets++;
+
+        uint32_t start = esp_cpu_get_cycle_count();
+        size_t reply_len = udp_handle(packet, n, &from, reply);
+        perf_counter_add(&s_stats.handle_cycles, esp_cpu_get_cycle_count() - start);
+
+        if (reply_len > 0 &&
+            sendto(s_sock, reply, reply_len, 0, (struct sockaddr *)&from, from_len) == (int)reply_len) {
+            s_stats.replies++;
+        }
+    }
+}
+
+esp_err_t udp_control_start(const udp_control_ops_t *ops)
+{
+    if (s_sock >= 0) {
+        return ESP_OK;
+    }
+    s_ops = ops;
+    s_sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s_sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket: errno %d", errno);
+        return ESP_FAIL;
+    }
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(UDP_CONTROL_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    if (bind(s_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        ESP_LOGE(TAG, "Failed to bind port %d: errno %d", UDP_CONTROL_PORT, errno);
+        close(s_sock);
+        s_sock = -1;
+        return ESP_FAIL;
+    }
+    if (xTaskCreatePinnedToCore(&udp_control_task, "udp_control", 4 * 1024, NULL, 5, NULL, 0) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create UDP control task");
+        close(s_sock);
+        s_sock = -1;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "UDP control on port %d", UDP_CONTROL_PORT);
+    return ESP_OK;
+}
+
+static esp_err_t udp_api_handler(httpd_req_t *req)
+{
+    static const char *op_names[UDP_OP_STATUS + 1] = {
+        NULL, "start", "pause", "resume", "stop", "add", "settings", "status"
+    };
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddNumberToObject(response, "port", UDP_CONTROL_PORT);
+    cJSON_AddBoolToObject(response, "running", s_sock >= 0);
+    cJSON_AddNumberToObject(response, "packets", s_stats.packets);
+    cJSON_AddNumberToObject(response, "commands", s_stats.commands);
+    cJSON_AddNumberToObject(response, "duplicates", s_stats.duplicates);
+    cJSON_AddNumberToObject(response, "bad", s_stats.bad);
+    cJSON_AddNumberToObject(response, "replies", s_stats.replies);
+    cJSON *ops = cJSON_AddObjectToObject(response, "ops");
+    for (int i = UDP_OP_START; i <= UDP_OP_STATUS; i++) {
+        cJSON_AddNumberToObject(ops, op_names[i], s_stats.per_op[i]);
+    }
+    cJSON_AddNumberToObject(response, "handle_us_avg", perf_cycles_to_us(perf_counter_avg(&s_stats.handle_cycles)));
+    cJSON_AddNumberToObject(response, "handle_us_max", perf_cycles_to_us(s_stats.handle_cycles.max));
+
+    int64_t now = esp_timer_get_time();
+    cJSON *peers = cJSON_AddArrayToObject(response, "peers");
+    for (int i = 0; i < UDP_PEERS_MAX; i++) {
+        if (s_peers[i].addr == 0) {
+            continue;
+        }
+        char text[24];
+        struct in_addr in = { .s_addr = s_peers[i].addr };
+        snprintf(text, sizeof(text), "%s:%u", inet_ntoa(in), ntohs(s_peers[i].port));
+        cJSON *peer = cJSON_CreateObject();
+        cJSON_AddStringToObject(peer, "addr", text);
+        cJSON_AddNumberToObject(peer, "last_seq", s_peers[i].last_seq);
+        cJSON_AddNumberToObject(peer, "idle_ms", (now - s_peers[i].last_us) / 1000);
+        cJSON_AddItemToArray(peers, peer);
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t udp_control_register_http(httpd_handle_t server)
+{
+    httpd_uri_t udp_uri = {
+        .uri = "/api/udp",
+        .method = HTTP_GET,
+        .handler = udp_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &udp_uri);
+}
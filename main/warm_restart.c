@@ -0,0 +1,308 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Warm restart: a running timer survives a reset and is back on the ring
+// before the rest of the firmware has started.
+//
+// main.c saves the timer into RTC slow memory (RTC_NOINIT, so the startup
+// code leaves it alone) on every change and every 100 ms while it runs,
+// with a magic number and a CRC. Only a power-on reset clears that memory;
+// after a panic, a watchdog, a brownout or esp_restart() the copy is still
+// there. The RTC timer keeps counting through those resets too, so the
+// time between the last save and the restore is added to the elapsed time
+// and the countdown carries on where it was, give or take one save period.
+//
+// app_main calls warm_restart_restore() before anything else, and main.c
+// paints the timer straight away with nothing but the LED driver set up.
+// WiFi, the models and the web server then come up behind it as usual.
+//
+// The measurement runs on the RTC timer as well: from the reset to the
+// first painted frame. For esp_restart() the shutdown handler notes the
+// exact moment of the reset; for the other resets the last save stands in
+// for it, so the figure is at most WARM_RESTART_SAVE_MS too long. Results
+// of earlier warm restarts are kept in RTC memory next to the timer and
+// served, with the last one, at /api/restore.
+//
+// POST /api/restore restarts the device to take the measurement. A panic
+// restart is only there with CONFIG_WARM_RESTART_TEST_PANIC, since the
+// endpoint is open to anyone on the network.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "esp_rtc_time.h"
+#include "esp_rom_crc.h"
+#include "esp_cpu.h"
+#include "cJSON.h"
+#include "json_codec.h"
+#include "http_workers.h"
+#include "perf_monitor.h"
+#include "warm_restart.h"
+
+static const char *TAG = "WARM_RESTART";
+
+typedef struct {
+    uint32_t magic;
+    uint64_t saved_rtc_us;      // esp_rtc_get_time_us() at the save
+    uint64_t reset_rtc_us;      // set by the shutdown handler, 0 = reset time unknown
+    warm_timer_t timer;
+    uint32_t crc;
+} warm_block_t;
+
+// Reset-to-pixels of the warm restarts since power-on
+typedef struct {
+    uint32_t magic;
+    uint32_t restores;
+    uint32_t exact;             // of them, measured from a known reset time
+    uint32_t last_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t crc;
+} warm_history_t;
+
+static RTC_NOINIT_ATTR warm_block_t s_block;
+static RTC_NOINIT_ATTR warm_history_t s_history;
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static struct {
+    esp_reset_reason_t reason;
+    bool kept;                  // a valid block survived the reset
+    bool restored;              // ... holding an active timer
+    bool exact;
+    char name[32];
+    uint32_t rejected;          // blocks failing magic or CRC
+    uint64_t reset_rtc_us;      // reset time used for the measurement
+    uint64_t restore_rtc_us;
+    uint32_t gap_ms;            // added to the timer's elapsed time
+    int64_t painted_us;         // esp_timer, i.e. since the app started
+    uint32_t reset_to_pixels_us;
+    uint32_t saves;
+    perf_counter_t save_cycles;
+} s_stats;
+
+static const char *reason_name(esp_reset_reason_t reason)
+{
+    switch (reason) {
+    case ESP_RST_POWERON:   return "power_on";
+    case ESP_RST_EXT:       return "external";
+    case ESP_RST_SW:        return "software";
+    case ESP_RST_PANIC:     return "panic";
+    case ESP_RST_INT_WDT:   return "interrupt_watchdog";
+    case ESP_RST_TASK_WDT:  return "task_watchdog";
+    case ESP_RST_WDT:       return "watchdog";
+    case ESP_RST_DEEPSLEEP: return "deep_sleep";
+    case ESP_RST_BROWNOUT:  return "brownout";
+    default:                return "other";
+    }
+}
+
+static uint32_t block_crc(const void *data, size_t len)
+{
+    return esp_rom_crc32_le(0, data, len);
+}
+
+static void warm_restart_shutdown(void)
+{
+    // esp_restart(): the reset is now, not at the last save
+    portENTER_CRITICAL(&s_mux);
+    if (s_block.magic == WARM_RESTART_MAGIC) {
+        s_block.reset_rtc_us = esp_rtc_get_time_us();
+        s_block.crc = block_crc(&s_block, offsetof(warm_block_t, crc));
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+bool warm_restart_restore(warm_timer_t *out)
+{
+    s_stats.reason = esp_reset_reason();
+    s_stats.restore_rtc_us = esp_rtc_get_time_us();
+    esp_register_shutdown_handler(warm_restart_shutdown);
+
+    if (s_stats.reason == ESP_RST_POWERON || s_stats.reason == ESP_RST_UNKNOWN) {
+        // RTC memory holds noise after power-on
+        memset(&s_history, 0, sizeof(s_history));
+        s_block.magic = 0;
+        return false;
+    }
+    if (s_history.magic != WARM_RESTART_MAGIC || s_history.crc != block_crc(&s_history, offsetof(warm_history_t, crc))) {
+        memset(&s_history, 0, sizeof(s_history));
+    }
+    if (s_block.magic != WARM_RESTART_MAGIC || s_block.crc != block_crc(&s_block, offsetof(warm_block_t, crc)) ||
+        s_block.saved_rtc_us > s_stats.restore_rtc_us) {
+        s_stats.rejected++;
+        s_block.magic = 0;
+        return false;
+    }
+    s_stats.kept = true;
+    if (!s_block.timer.active) {
+        return false;
+    }
+
+    *out = s_block.timer;
+    uint64_t gap_us = s_stats.restore_rtc_us - s_block.saved_rtc_us;
+    s_stats.gap_ms = gap_us / 1000;
+    if (!out->paused) {
+        out->elapsed_ms += s_stats.gap_ms;
+    }
+    s_stats.exact = s_block.reset_rtc_us != 0;
+    s_stats.reset_rtc_us = s_stats.exact ? s_block.reset_rtc_us : s_block.saved_rtc_us;
+    memcpy(s_stats.name, out->name, sizeof(s_stats.name));
+    s_stats.name[sizeof(s_stats.name) - 1] = '\0';
+    s_stats.restored = true;
+    return true;
+}
+
+void warm_restart_save(const warm_timer_t *timer)
+{
+    uint32_t start = esp_cpu_get_cycle_count();
+    uint64_t now = esp_rtc_get_time_us();
+    portENTER_CRITICAL(&s_mux);
+    s_block.magic = WARM_RESTART_MAGIC;
+    s_block.saved_rtc_us = now;
+    s_block.reset_rtc_us = 0;
+    s_block.timer = *timer;
+    s_block.crc = block_crc(&s_block, offsetof(warm_block_t, crc));
+    s_stats.saves++;
+    portEXIT_CRITICAL(&s_mux);
+    perf_counter_add(&s_stats.save_cycles, esp_cpu_get_cycle_count() - start);
+}
+
+void warm_restart_painted(void)
+{
+    if (!s_stats.restored || s_stats.painted_us) {
+        return;
+    }
+    uint64_t now = esp_rtc_get_time_us();
+    s_stats.painted_us = esp_timer_get_time();
+    s_stats.reset_to_pixels_us = now - s_stats.reset_rtc_us;
+
+    warm_history_t *h = &s_history;
+    h->magic = WARM_RESTART_MAGIC;
+    h->restores++;
+    h->exact += s_stats.exact;
+    h->last_us = s_stats.reset_to_pixels_us;
+    if (!h->min_us || h->last_us < h->min_us) {
+        h->min_us = h->last_us;
+    }
+    if (h->last_us > h->max_us) {
+        h->max_us = h->last_us;
+    }
+    h->sum_us += h->last_us;
+    h->crc = block_crc(h, offsetof(warm_history_t, crc));
+    ESP_LOGI(TAG, "Timer '%s' restored after %s reset: pixels %.1f ms after the reset%s, %.1f ms after app start",
+             s_stats.name, reason_name(s_stats.reason), s_stats.reset_to_pixels_us / 1000.0f,
+             s_stats.exact ? "" : " (from the last save)", s_stats.painted_us / 1000.0f);
+}
+
+// Body of POST /api/restore
+typedef struct {
+    char restart[8];
+} restore_request_t;
+
+static const json_field_t restore_schema[] = {
+    JSON_FIELD_STRING(restore_request_t, restart, "restart"),
+};
+
+static esp_err_t restore_api_handler(httpd_req_t *req)
+{
+    bool panic = false;
+    bool restart = false;
+    if (req->method == HTTP_POST) {
+        char buf[64];
+        restore_request_t body = {0};
+        if (json_recv_request(req, buf, sizeof(buf), restore_schema,
+                              sizeof(restore_schema) / sizeof(restore_schema[0]), &body) != ESP_OK) {
+            return ESP_OK;
+        }
+#if CONFIG_WARM_RESTART_TEST_PANIC
+        panic = strcmp(body.restart, "panic") == 0;
+        restart = panic || strcmp(body.restart, "soft") == 0;
+        if (!restart) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "restart must be \"soft\" or \"panic\"");
+            return ESP_OK;
+        }
+#else
+        restart = strcmp(body.restart, "soft") == 0;
+        if (!restart) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "restart must be \"soft\"");
+            return ESP_OK;
+        }
+#endif
+    }
+
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddStringToObject(response, "reset_reason", reason_name(s_stats.reason));
+    cJSON_AddBoolToObject(response, "kept", s_stats.kept);
+    cJSON_AddBoolToObject(response, "restored", s_stats.restored);
+    cJSON_AddNumberToObject(response, "rejected", s_stats.rejected);
+    if (s_stats.restored) {
+        cJSON_AddStringToObject(response, "timer", s_stats.name);
+        cJSON_AddBoolToObject(response, "exact", s_stats.exact);
+        cJSON_AddNumberToObject(response, "gap_ms", s_stats.gap_ms);
+        cJSON_AddNumberToObject(response, "reset_to_pixels_ms", s_stats.reset_to_pixels_us / 1000.0f);
+        cJSON_AddNumberToObject(response, "app_to_pixels_ms", s_stats.painted_us / 1000.0f);
+        cJSON_AddNumberToObject(response, "reset_to_app_ms",
+                                (s_stats.reset_to_pixels_us - s_stats.painted_us) / 1000.0f);
+    }
+
+    cJSON *history = cJSON_AddObjectToObject(response, "history");
+    cJSON_AddNumberToObject(history, "restores", s_history.restores);
+    cJSON_AddNumberToObject(history, "exact", s_history.exact);
+    cJSON_AddNumberToObject(history, "last_ms", s_history.last_us / 1000.0f);
+    cJSON_AddNumberToObject(history, "min_ms", s_history.min_us / 1000.0f);
+    cJSON_AddNumberToObject(history, "avg_ms",
+                            s_history.restores ? s_history.sum_us / s_history.restores / 1000.0f : 0);
+    cJSON_AddNumberToObject(history, "max_ms", s_history.max_us / 1000.0f);
+
+    cJSON_AddNumberToObject(response, "saves", s_stats.saves);
+    cJSON_AddNumberToObject(response, "save_cycles_avg", perf_counter_avg(&s_stats.save_cycles));
+    cJSON_AddNumberToObject(response, "save_period_ms", WARM_RESTART_SAVE_MS);
+    if (restart) {
+        cJSON_AddStringToObject(response, "restarting", panic ? "panic" : "soft");
+    }
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+
+    if (restart) {
+        ESP_LOGW(TAG, "Restarting (%s) on request", panic ? "panic" : "soft");
+        vTaskDelay(pdMS_TO_TICKS(WARM_RESTART_DELAY_MS));
+        if (panic) {
+            abort();
+        }
+        esp_restart();
+    }
+    return ESP_OK;
+}
+
+esp_err_t warm_restart_register_http(httpd_handle_t server)
+{
+    httpd_uri_t restore_get_uri = {
+        .uri = "/api/restore",
+        .method = HTTP_GET,
+        .handler = restore_api_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &restore_get_uri);
+
+    // Waits before restarting
+    httpd_uri_t restore_post_uri = restore_get_uri;
+    restore_post_uri.method = HTTP_POST;
+    return http_workers_register(server, &restore_post_uri);
+}
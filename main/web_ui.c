@@ -0,0 +1,76 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Static web UI.
+//
+// The files in web/ are gzipped at build time by tools/mkwebui.py into a
+// constant table in flash, with their lengths and a content-hash ETag
+// fixed at compile time. A request is answered with the stored gzip bytes
+// in a single send, or with 304 and no body when the browser already holds
+// that ETag. The gzip stream is sent even to clients that do not advertise
+// gzip (every browser does; use `curl --compressed`), so nothing is ever
+// decompressed on the device.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "esp_log.h"
+#include "web_ui.h"
+
+#define WEB_HEADER_MAX          128
+
+static const char *TAG = "WEB_UI";
+
+// True when If-None-Match lists the asset's ETag (or is "*")
+static bool web_etag_matches(httpd_req_t *req, const web_asset_t *asset)
+{
+    char value[WEB_HEADER_MAX];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) != ESP_OK) {
+        return false;
+    }
+    return strstr(value, asset->etag) != NULL || strcmp(value, "*") == 0;
+}
+
+static esp_err_t web_asset_handler(httpd_req_t *req)
+{
+    const web_asset_t *asset = req->user_ctx;
+    httpd_resp_set_hdr(req, "ETag", asset->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", WEB_CACHE_CONTROL);
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+
+    if (web_etag_matches(req, asset)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    httpd_resp_set_type(req, asset->type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char *)asset->gz, asset->gz_len);
+}
+
+esp_err_t web_ui_register_http(httpd_handle_t server)
+{
+    uint32_t raw = 0, gz = 0;
+    for (size_t i = 0; i < web_asset_count; i++) {
+        httpd_uri_t asset_uri = {
+            .uri = web_assets[i].uri,
+            .method = HTTP_GET,
+            .handler = web_asset_handler,
+            .user_ctx = (void *)&web_assets[i]
+        };
+        esp_err_t err = httpd_register_uri_handler(server, &asset_uri);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Could not register %s: %s", web_assets[i].uri, esp_err_to_name(err));
+            return err;
+        }
+        raw += web_assets[i].raw_len;
+        gz += web_assets[i].gz_len;
+    }
+    ESP_LOGI(TAG, "%u web assets, %lu bytes gzipped from %lu", (unsigned)web_asset_count,
+             (unsigned long)gz, (unsigned long)raw);
+    return ESP_OK;
+}
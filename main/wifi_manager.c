@@ -0,0 +1,387 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// WiFi station connection manager.
+//
+// The channel and BSSID of the last AP we were connected to are kept in
+// NVS, so (re)connecting starts with a scan of that one channel for that
+// one AP instead of a full scan. Once that has failed WIFI_FAST_FAILS_MAX
+// times in a row (AP moved channel or was replaced) every other attempt
+// scans all channels. After a disconnect the first retry is immediate and the
+// following ones back off exponentially up to WIFI_BACKOFF_MAX_MS, without
+// ever giving up; the HTTP server keeps running throughout, so the web UI
+// is back as soon as the station is. Beacon loss is detected after
+// WIFI_INACTIVE_S instead of the default 6 s.
+//
+// Outage length (disconnect to IP) and reconnect latency (start of the
+// successful attempt to IP) are recorded per reconnect and served at
+// /api/wifi.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_mac.h"
+#include "esp_wifi.h"
+#include "esp_netif.h"
+#include "esp_event.h"
+#include "nvs_flash.h"
+#include "cJSON.h"
+#include "perf_monitor.h"
+#include "boot_orchestrator.h"
+#include "wifi_manager.h"
+
+#define WIFI_CONNECTED_BIT      BIT0
+
+static const char *TAG = "WIFI_MGR";
+
+typedef struct {
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;            // 0 = nothing cached
+} wifi_cache_t;
+
+static EventGroupHandle_t s_events = NULL;
+static esp_timer_handle_t s_retry_timer = NULL;
+static esp_netif_t *s_netif = NULL;
+static char s_ssid[33];
+static char s_password[65];
+static wifi_cache_t s_cache;
+
+static volatile bool s_connected = false;
+static bool s_attempt_fast = false;
+static int64_t s_start_us = 0;
+static int64_t s_attempt_us = 0;        // start of the attempt in progress
+static int64_t s_down_since_us = 0;     // 0 while connected or before the first connection
+static int64_t s_up_since_us = 0;
+static uint32_t s_attempts = 0;         // since the last connection
+static uint32_t s_fast_fails = 0;
+static uint32_t s_retry_ms = 0;         // delay before the attempt in progress
+
+static struct {
+    uint32_t first_connect_ms;
+    uint32_t disconnects;
+    uint8_t last_reason;
+    uint32_t fast_attempts;
+    uint32_t full_attempts;
+    uint32_t fast_connects;             // connections made on the cached channel/BSSID
+    perf_counter_t outage_ms;
+    perf_counter_t reconnect_ms;
+    perf_counter_t attempts;            // attempts per reconnect
+    uint32_t last_outage_ms;
+    uint32_t last_reconnect_ms;
+} s_stats;
+
+static void wifi_load_cache(void)
+{
+    nvs_handle_t nvs_handle;
+    if (nvs_open(WIFI_NVS_NS, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    wifi_cache_t cache;
+    size_t size = sizeof(cache);
+    if (nvs_get_blob(nvs_handle, "ap", &cache, &size) == ESP_OK && size == sizeof(cache)
+        && strncmp(cache.ssid, s_ssid, sizeof(cache.ssid)) == 0) {
+        s_cache = cache;
+    }
+    nvs_close(nvs_handle);
+}
+
+static void wifi_save_cache(void)
+{
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(WIFI_NVS_NS, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening NVS handle: %s", esp_err_to_name(err));
+        return;
+    }
+    err = nvs_set_blob(nvs_handle, "ap", &s_cache, sizeof(s_cache));
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error saving AP cache: %s", esp_err_to_name(err));
+    }
+    nvs_close(nvs_handle);
+}
+
+static void wifi_connect_now(void)
+{
+    // After WIFI_FAST_FAILS_MAX misses, alternate with full scans: the AP may
+    // have moved, or it may just not be back yet
+    bool fast = s_cache.channel && (s_fast_fails < WIFI_FAST_FAILS_MAX || s_attempts % 2);
+    wifi_config_t wifi_config = {
+        .sta = {
+            .threshold.authmode = WIFI_AUTH_WPA2_PSK,
+            .pmf_cfg = {
+                .capable = true,
+                .required = false
+            },
+        },
+    };
+    strncpy((char *)wifi_config.sta.ssid, s_ssid, sizeof(wifi_config.sta.ssid));
+    strncpy((char *)wifi_config.sta.password, s_password, sizeof(wifi_config.sta.password));
+    if (fast) {
+        wifi_config.sta.scan_method = WIFI_FAST_SCAN;
+        wifi_config.sta.channel = s_cache.channel;
+        wifi_config.sta.bssid_set = true;
+        memcpy(wifi_config.sta.bssid, s_cache.bssid, sizeof(s_cache.bssid));
+        s_stats.fast_attempts++;
+    } else {
+        wifi_config.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+        wifi_config.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
+        s_stats.full_attempts++;
+    }
+    esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+
+    s_attempt_fast = fast;
+    s_attempt_us = esp_timer_get_time();
+    s_attempts++;
+    esp_err_t err = esp_wifi_connect();
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "esp_wifi_connect: %s", esp_err_to_name(err));
+    }
+}
+
+static void wifi_retry_cb(void *arg)
+{
+    if (!s_connected) {
+        wifi_connect_now();
+    }
+}
+
+// Immediate retry first, then WIFI_BACKOFF_FIRST_MS doubling up to the cap
+static void wifi_schedule_retry(void)
+{
+    if (s_attempts == 0) {
+        s_retry_ms = 0;
+    } else if (s_retry_ms == 0) {
+        s_retry_ms = WIFI_BACKOFF_FIRST_MS;
+    } else {
+        s_retry_ms = s_retry_ms * 2 > WIFI_BACKOFF_MAX_MS ? WIFI_BACKOFF_MAX_MS : s_retry_ms * 2;
+    }
+    if (s_retry_ms == 0) {
+        wifi_connect_now();
+        return;
+    }
+    ESP_LOGI(TAG, "Retrying in %lu ms (attempt %lu)", (unsigned long)s_retry_ms, (unsigned long)s_attempts + 1);
+    esp_timer_stop(s_retry_timer);
+    esp_timer_start_once(s_retry_timer, (uint64_t)s_retry_ms * 1000);
+}
+
+static void wifi_on_connected(void)
+{
+    int64_t now = esp_timer_get_time();
+    uint32_t latency_ms = (now - s_attempt_us) / 1000;
+    s_connected = true;
+    s_up_since_us = now;
+    if (s_attempt_fast) {
+        s_stats.fast_connects++;
+    }
+
+    if (s_down_since_us) {
+        uint32_t outage_ms = (now - s_down_since_us) / 1000;
+        perf_counter_add(&s_stats.outage_ms, outage_ms);
+        perf_counter_add(&s_stats.reconnect_ms, latency_ms);
+        perf_counter_add(&s_stats.attempts, s_attempts);
+        s_stats.last_outage_ms = outage_ms;
+        s_stats.last_reconnect_ms = latency_ms;
+        ESP_LOGI(TAG, "Reconnected after %lu ms outage (%lu attempts, last took %lu ms, %s)",
+                 (unsigned long)outage_ms, (unsigned long)s_attempts, (unsigned long)latency_ms,
+                 s_attempt_fast ? "cached channel" : "full scan");
+    } else {
+        s_stats.first_connect_ms = (now - s_start_us) / 1000;
+        ESP_LOGI(TAG, "Connected in %lu ms (%lu attempts, %s)", (unsigned long)s_stats.first_connect_ms,
+                 (unsigned long)s_attempts, s_attempt_fast ? "cached channel" : "full scan");
+    }
+    s_down_since_us = 0;
+    s_attempts = 0;
+    s_fast_fails = 0;
+    s_retry_ms = 0;
+
+    // Remember where the AP is for the next connect
+    wifi_ap_record_t ap_info;
+    if (esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK
+        && (s_cache.channel != ap_info.primary || memcmp(s_cache.bssid, ap_info.bssid, sizeof(s_cache.bssid)) != 0)) {
+        strlcpy(s_cache.ssid, s_ssid, sizeof(s_cache.ssid));
+        memcpy(s_cache.bssid, ap_info.bssid, sizeof(s_cache.bssid));
+        s_cache.channel = ap_info.primary;
+        wifi_save_cache();
+        ESP_LOGI(TAG, "Cached AP " MACSTR " on channel %u", MAC2STR(s_cache.bssid), s_cache.channel);
+    }
+    xEventGroupSetBits(s_events, WIFI_CONNECTED_BIT);
+}
+
+static void wifi_event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data)
+{
+    if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
+        ESP_LOGI(TAG, "WiFi station started, connecting to %s%s...", s_ssid,
+                 s_cache.channel ? " on the cached channel" : "");
+        wifi_connect_now();
+    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        wifi_event_sta_disconnected_t *event = event_data;
+        if (s_connected) {
+            s_connected = false;
+            s_down_since_us = esp_timer_get_time();
+            s_stats.disconnects++;
+            s_stats.last_reason = event->reason;
+            xEventGroupClearBits(s_events, WIFI_CONNECTED_BIT);
+            ESP_LOGW(TAG, "Disconnected (reason %u), reconnecting", event->reason);
+        } else {
+            if (s_attempt_fast) {
+                s_fast_fails++;
+            }
+            ESP_LOGI(TAG, "Attempt %lu failed (reason %u)", (unsigned long)s_attempts, event->reason);
+        }
+        wifi_schedule_retry();
+    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
+        ip_event_got_ip_t *event = event_data;
+        ESP_LOGI(TAG, "WiFi connected! IP address: " IPSTR, IP2STR(&event->ip_info.ip));
+        boot_milestone(BOOT_MILESTONE_WIFI_CONNECTED);
+        wifi_on_connected();
+    }
+}
+
+static void wifi_status_task(void *arg)
+{
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(WIFI_STATUS_LOG_MS));
+        wifi_ap_record_t ap_info;
+        if (s_connected && esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+            ESP_LOGI(TAG, "WiFi Status: Connected to %s, RSSI: %d dBm, Channel: %d, up %lld s",
+                     ap_info.ssid, ap_info.rssi, ap_info.primary, (esp_timer_get_time() - s_up_since_us) / 1000000);
+        } else {
+            ESP_LOGW(TAG, "WiFi Status: Disconnected, %lu attempts, retry every %lu ms",
+                     (unsigned long)s_attempts, (unsigned long)s_retry_ms);
+        }
+    }
+}
+
+esp_err_t wifi_manager_start(const char *ssid, const char *password)
+{
+    strlcpy(s_ssid, ssid, sizeof(s_ssid));
+    strlcpy(s_password, password, sizeof(s_password));
+    s_events = xEventGroupCreate();
+    wifi_load_cache();
+
+    esp_timer_create_args_t timer_args = {
+        .callback = wifi_retry_cb,
+        .name = "wifi_retry",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_retry_timer));
+
+    ESP_ERROR_CHECK(esp_netif_init());
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    s_netif = esp_netif_create_default_wifi_sta();
+
+    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_wifi_init(&cfg));
+    ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
+                                                        &wifi_event_handler, NULL, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
+                                                        &wifi_event_handler, NULL, NULL));
+
+    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+    s_start_us = esp_timer_get_time();
+    ESP_ERROR_CHECK(esp_wifi_start());
+    esp_wifi_set_inactive_time(WIFI_IF_STA, WIFI_INACTIVE_S);
+
+    xTaskCreatePinnedToCore(&wifi_status_task, "wifi_status", 3 * 1024, NULL, 1, NULL, 1);
+    ESP_LOGI(TAG, "WiFi initialization finished");
+    return ESP_OK;
+}
+
+esp_err_t wifi_manager_wait_connected(uint32_t timeout_ms)
+{
+    EventBits_t bits = xEventGroupWaitBits(s_events, WIFI_CONNECTED_BIT, pdFALSE, pdFALSE,
+                                           pdMS_TO_TICKS(timeout_ms));
+    if (bits & WIFI_CONNECTED_BIT) {
+        return ESP_OK;
+    }
+    ESP_LOGW(TAG, "Not connected to %s after %lu ms, still trying in the background", s_ssid,
+             (unsigned long)timeout_ms);
+    return ESP_ERR_TIMEOUT;
+}
+
+bool wifi_manager_connected(void)
+{
+    return s_connected;
+}
+
+static void wifi_counter_json(cJSON *parent, const char *name, const perf_counter_t *c, uint32_t last)
+{
+    cJSON *obj = cJSON_AddObjectToObject(parent, name);
+    cJSON_AddNumberToObject(obj, "count", c->count);
+    cJSON_AddNumberToObject(obj, "avg", perf_counter_avg(c));
+    cJSON_AddNumberToObject(obj, "max", c->max);
+    cJSON_AddNumberToObject(obj, "last", last);
+}
+
+static esp_err_t wifi_api_handler(httpd_req_t *req)
+{
+    char text[24];
+    int64_t now = esp_timer_get_time();
+    cJSON *response = cJSON_CreateObject();
+    cJSON_AddBoolToObject(response, "connected", s_connected);
+    cJSON_AddStringToObject(response, "ssid", s_ssid);
+
+    wifi_ap_record_t ap_info;
+    if (s_connected && esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+        cJSON_AddNumberToObject(response, "rssi", ap_info.rssi);
+        cJSON_AddNumberToObject(response, "channel", ap_info.primary);
+        snprintf(text, sizeof(text), MACSTR, MAC2STR(ap_info.bssid));
+        cJSON_AddStringToObject(response, "bssid", text);
+        esp_netif_ip_info_t ip_info;
+        if (esp_netif_get_ip_info(s_netif, &ip_info) == ESP_OK) {
+            snprintf(text, sizeof(text), IPSTR, IP2STR(&ip_info.ip));
+            cJSON_AddStringToObject(response, "ip", text);
+        }
+        cJSON_AddNumberToObject(response, "up_ms", (now - s_up_since_us) / 1000);
+    } else {
+        cJSON_AddNumberToObject(response, "down_ms", s_down_since_us ? (now - s_down_since_us) / 1000 : -1);
+        cJSON_AddNumberToObject(response, "attempts", s_attempts);
+        cJSON_AddNumberToObject(response, "retry_ms", s_retry_ms);
+    }
+
+    cJSON *cache = cJSON_AddObjectToObject(response, "cached_ap");
+    cJSON_AddNumberToObject(cache, "channel", s_cache.channel);
+    snprintf(text, sizeof(text), MACSTR, MAC2STR(s_cache.bssid));
+    cJSON_AddStringToObject(cache, "bssid", text);
+
+    cJSON *stats = cJSON_AddObjectToObject(response, "stats");
+    cJSON_AddNumberToObject(stats, "first_connect_ms", s_stats.first_connect_ms);
+    cJSON_AddNumberToObject(stats, "disconnects", s_stats.disconnects);
+    cJSON_AddNumberToObject(stats, "last_reason", s_stats.last_reason);
+    cJSON_AddNumberToObject(stats, "fast_attempts", s_stats.fast_attempts);
+    cJSON_AddNumberToObject(stats, "full_attempts", s_stats.full_attempts);
+    cJSON_AddNumberToObject(stats, "fast_connects", s_stats.fast_connects);
+    wifi_counter_json(stats, "outage_ms", &s_stats.outage_ms, s_stats.last_outage_ms);
+    wifi_counter_json(stats, "reconnect_ms", &s_stats.reconnect_ms, s_stats.last_reconnect_ms);
+    cJSON_AddNumberToObject(stats, "attempts_per_reconnect", perf_counter_avg(&s_stats.attempts));
+
+    char *json_string = cJSON_Print(response);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, json_string, strlen(json_string));
+    free(json_string);
+    cJSON_Delete(response);
+    return ESP_OK;
+}
+
+esp_err_t wifi_manager_register_http(httpd_handle_t server)
+{
+    httpd_uri_t wifi_uri = {
+        .uri = "/api/wifi",
+        .method = HTTP_GET,
+        .handler = wifi_api_handler,
+        .user_ctx = NULL
+    };
+    return httpd_register_uri_handler(server, &wifi_uri);
+}
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Build the speech benchmark corpus image for the "corpus" partition.
+
+The manifest is a CSV file with one clip per line:
+
+    path,label,wake,command_id
+    clips/hiesp_start_timer.wav,start_timer,1,5
+    clips/tv_noise.wav,tv_noise,0,-1
+
+Clips must be 16 kHz, 16-bit, mono WAV files. `wake` is 1 if the clip
+contains the wake word, `command_id` is the multinet command expected after
+it (-1 for none). Paths are relative to the manifest.
+
+    python tools/build_corpus.py corpus.csv -o corpus.bin
+    python tools/build_corpus.py corpus.csv -o corpus.bin --flash --port /dev/ttyACM0
+
+The layout matches speech_corpus_header_t / speech_corpus_entry_t in
+main/include/speech_bench.h.
+"""
+
+import argparse
+import csv
+import os
+import struct
+import subprocess
+import sys
+import wave
+
+MAGIC = b"SRBC"
+VERSION = 1
+SAMPLE_RATE = 16000
+LABEL_LEN = 24
+MAX_CLIPS = 64
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<%dshBBII" % LABEL_LEN)
+PARTITION = "corpus"
+
+
+def load_clip(path):
+    with wave.open(path, "rb") as wav:
+        if wav.getframerate() != SAMPLE_RATE or wav.getsampwidth() != 2 or wav.getnchannels() != 1:
+            sys.exit("%s: need %d Hz 16-bit mono, got %d Hz %d-bit %d ch" % (
+                path, SAMPLE_RATE, wav.getframerate(), wav.getsampwidth() * 8, wav.getnchannels()))
+        return wav.readframes(wav.getnframes())
+
+
+def build(manifest):
+    base = os.path.dirname(os.path.abspath(manifest))
+    with open(manifest, newline="") as f:
+        rows = [r for r in csv.DictReader(f) if r.get("path")]
+    if not rows or len(rows) > MAX_CLIPS:
+        sys.exit("manifest must list 1..%d clips" % MAX_CLIPS)
+
+    offset = HEADER.size + ENTRY.size * len(rows)
+    entries, blobs = [], []
+    for row in rows:
+        pcm = load_clip(os.path.join(base, row["path"]))
+        label = row["label"].encode()[:LABEL_LEN]
+        entries.append(ENTRY.pack(label, int(row["command_id"]), int(row["wake"]), 0,
+                                  offset, len(pcm) // 2))
+        blobs.append(pcm)
+        offset += len(pcm)
+
+    image = HEADER.pack(MAGIC, VERSION, len(rows), SAMPLE_RATE, 0) + b"".join(entries) + b"".join(blobs)
+    seconds = sum(len(b) for b in blobs) / 2 / SAMPLE_RATE
+    print("%d clips, %.1f s of audio, %d bytes" % (len(rows), seconds, len(image)))
+    return image
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("manifest")
+    parser.add_argument("-o", "--output", default="corpus.bin")
+    parser.add_argument("--size", type=lambda s: int(s, 0), default=512 * 1024,
+                        help="partition size from partitions.csv")
+    parser.add_argument("--flash", action="store_true", help="write the image with parttool.py")
+    parser.add_argument("--port", help="serial port for --flash")
+    args = parser.parse_args()
+
+    image = build(args.manifest)
+    if len(image) > args.size:
+        sys.exit("corpus is %d bytes, partition holds %d" % (len(image), args.size))
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+    if args.flash:
+        idf_path = os.environ.get("IDF_PATH")
+        if not idf_path:
+            sys.exit("IDF_PATH is not set, run export.sh first")
+        cmd = [sys.executable, os.path.join(idf_path, "components", "partition_table", "parttool.py")]
+        if args.port:
+            cmd += ["--port", args.port]
+        cmd += ["write_partition", "--partition-name", PARTITION, "--input", args.output]
+        subprocess.check_call(cmd)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Score the wake-word direction-of-arrival estimator on recorded stereo clips.
+
+The manifest is a CSV file with one clip per line:
+
+    path,angle
+    clips/kitchen_045.wav,45
+    clips/sofa_120.wav,120
+
+Clips are 16 kHz, 16-bit WAV files with mic 1 in the first channel and mic 2
+in the second, up to 3 s long. `angle` is the true direction in degrees from
+the mic axis: 0 is beyond mic 1, 90 is broadside, 180 is beyond mic 2. Paths
+are relative to the manifest.
+
+    python tools/doa_eval.py clips.csv
+    python tools/doa_eval.py clips.csv --device http://192.168.1.50
+    python tools/doa_eval.py --synth speech.wav --angles 0,30,60,90,120,150,180 --out clips
+
+Without --device the clips go through a port of main/doa.c (same framing,
+gate, band, PHAT weighting and peak interpolation, constants read from
+main/include/doa.h); with it each clip is POSTed to /api/doa/eval and the
+device's own estimate and cost are reported. --synth makes a manifest from
+one mono recording by delaying it between two virtual mics and adding noise.
+The exit status is 1 when the mean error is above --max-error.
+"""
+
+import argparse
+import cmath
+import csv
+import json
+import math
+import os
+import random
+import re
+import statistics
+import struct
+import sys
+import urllib.request
+import wave
+
+HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "main", "include", "doa.h")
+
+
+def load_constants(path=HEADER):
+    consts = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"#define\s+(DOA_\w+)\s+([0-9.]+)f?\b", line)
+            if m:
+                value = m.group(2)
+                consts[m.group(1)] = float(value) if "." in value else int(value)
+    return consts
+
+
+C = load_constants()
+RATE = C["DOA_RATE"]
+N = C["DOA_FFT_SIZE"]
+HOP = C["DOA_HOP"]
+UPS = C["DOA_UPSAMPLE"]
+BIN_LO = C["DOA_MIN_HZ"] * N // RATE
+BIN_HI = C["DOA_MAX_HZ"] * N // RATE
+MAX_FRAMES = C["DOA_MAX_FRAMES"]
+
+
+def fft(x):
+    """In-place iterative radix-2 FFT of a list of complex numbers."""
+    n = len(x)
+    j = 0
+    for i in range(1, n):
+        bit = n >> 1
+        while j & bit:
+            j ^= bit
+            bit >>= 1
+        j |= bit
+        if i < j:
+            x[i], x[j] = x[j], x[i]
+    size = 2
+    while size <= n:
+        step = cmath.exp(-2j * math.pi / size)
+        half = size // 2
+        for start in range(0, n, size):
+            w = 1
+            for k in range(start, start + half):
+                t = x[k + half] * w
+                x[k + half] = x[k] - t
+                x[k] += t
+                w *= step
+        size *= 2
+    return x
+
+
+def max_lag(spacing_mm):
+    return spacing_mm / 1000.0 / C["DOA_SOUND_SPEED"] * RATE
+
+
+def estimate(mic1, mic2, spacing_mm):
+    """GCC-PHAT as in doa_estimate(); returns (angle, lag, coherence, frames)."""
+    window = [0.5 - 0.5 * math.cos(2 * math.pi * i / (N - 1)) for i in range(N)]
+    count = (len(mic1) - N) // HOP + 1
+    if count < 1:
+        raise ValueError("clip shorter than one frame")
+    first = max(0, count - MAX_FRAMES)
+    starts = [f * HOP for f in range(first, count)]
+
+    energy = [sum(v * v for v in mic1[s:s + N]) for s in starts]
+    gate = max(energy) * 10 ** (-C["DOA_GATE_DB"] / 10.0)
+    cross = [0j] * (N // 2)
+    used = 0
+    for s, e in zip(starts, energy):
+        if e <= 0 or e < gate:
+            continue
+        x1 = fft([mic1[s + i] * window[i] for i in range(N)])
+        x2 = fft([mic2[s + i] * window[i] for i in range(N)])
+        for k in range(BIN_LO, BIN_HI):
+            p = x1[k] * x2[k].conjugate()
+            if abs(p) > 1e-20:
+                cross[k] += p / abs(p)
+        used += 1
+    if not used:
+        return None, 0.0, 0.0, 0
+
+    m = N * UPS
+    buf = [0j] * m
+    for k in range(BIN_LO, BIN_HI):
+        buf[k] = cross[k].conjugate()
+        buf[m - k] = cross[k]
+    corr = [v.real for v in fft(buf)]
+
+    limit = max_lag(spacing_mm)
+    span = min(int(math.ceil(limit * UPS)) + 1, m // 2 - 2)
+    best = max(range(-span, span + 1), key=lambda n: corr[n % m])
+    peak, left, right = corr[best % m], corr[(best - 1) % m], corr[(best + 1) % m]
+    denom = left - 2 * peak + right
+    delta = 0.5 * (left - right) / denom if denom < 0 else 0.0
+    lag = -(best + delta) / UPS
+    angle = math.degrees(math.acos(max(-1.0, min(1.0, lag / limit))))
+    coherence = peak / (2.0 * used * (BIN_HI - BIN_LO))
+    return angle, lag, coherence, used
+
+
+def read_wav(path):
+    with wave.open(path, "rb") as wav:
+        if wav.getframerate() != RATE or wav.getsampwidth() != 2 or wav.getnchannels() < 2:
+            sys.exit("%s: need %d Hz 16-bit with two or more channels, got %d Hz %d-bit %d ch" % (
+                path, RATE, wav.getframerate(), wav.getsampwidth() * 8, wav.getnchannels()))
+        ch = wav.getnchannels()
+        raw = wav.readframes(wav.getnframes())
+    samples = struct.unpack("<%dh" % (len(raw) // 2), raw)
+    return list(samples[0::ch]), list(samples[1::ch])
+
+
+def evaluate_device(url, path):
+    with open(path, "rb") as f:
+        body = f.read()
+    req = urllib.request.Request(url.rstrip("/") + "/api/doa/eval", data=body,
+                                 headers={"Content-Type": "audio/wav"})
+    with urllib.request.urlopen(req, timeout=30) as resp:
+        r = json.load(resp)
+    return r["angle_deg"] if r["frames"] else None, r["lag_samples"], r["coherence"], r["frames"], r["ms"]
+
+
+def synthesize(source, angles, snr_db, spacing_mm, out_dir):
+    with wave.open(source, "rb") as wav:
+        if wav.getframerate() != RATE or wav.getsampwidth() != 2 or wav.getnchannels() != 1:
+            sys.exit("%s: need %d Hz 16-bit mono" % (source, RATE))
+        raw = wav.readframes(min(wav.getnframes(), 3 * RATE))
+    src = struct.unpack("<%dh" % (len(raw) // 2), raw)
+    power = sum(v * v for v in src) / len(src)
+    noise = math.sqrt(power * 10 ** (-snr_db / 10.0))
+    taps = 16
+    rng = random.Random(1)
+
+    os.makedirs(out_dir, exist_ok=True)
+    rows = []
+    for angle in angles:
+        # Mic 2 hears the source this many samples after mic 1
+        delay = max_lag(spacing_mm) * math.cos(math.radians(angle))
+        frames = bytearray()
+        for i in range(len(src)):
+            acc = 0.0
+            for j in range(-taps, taps + 1):
+                k = i - j
+                if 0 <= k < len(src):
+                    x = j - delay
+                    sinc = 1.0 if abs(x) < 1e-9 else math.sin(math.pi * x) / (math.pi * x)
+                    acc += src[k] * sinc * (0.54 + 0.46 * math.cos(math.pi * x / (taps + 1)))
+            a = src[i] + rng.gauss(0, noise)
+            b = acc + rng.gauss(0, noise)
+            frames += struct.pack("<hh", max(-32768, min(32767, int(round(a)))),
+                                  max(-32768, min(32767, int(round(b)))))
+        name = "synth_%03d.wav" % angle
+        with wave.open(os.path.join(out_dir, name), "wb") as wav:
+            wav.setnchannels(2)
+            wav.setsampwidth(2)
+            wav.setframerate(RATE)
+            wav.writeframes(bytes(frames))
+        rows.append((name, angle))
+
+    manifest = os.path.join(out_dir, "manifest.csv")
+    with open(manifest, "w", newline="") as f:
+        w = csv.writer(f)
+        w.writerow(["path", "angle"])
+        w.writerows(rows)
+    print("%d clips at %.0f dB SNR, manifest %s" % (len(rows), snr_db, manifest))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("manifest", nargs="?")
+    parser.add_argument("--device", help="device URL; score POST /api/doa/eval instead of the host port")
+    parser.add_argument("--spacing-mm", type=float, default=C["DOA_MIC_SPACING_MM"],
+                        help="microphone spacing for the host port and --synth")
+    parser.add_argument("--max-error", type=float, default=15.0, help="fail above this mean error, degrees")
+    parser.add_argument("--synth", metavar="WAV", help="16 kHz mono recording to build clips from")
+    parser.add_argument("--angles", default="0,30,60,90,120,150,180")
+    parser.add_argument("--snr", type=float, default=20.0, help="noise for --synth, dB")
+    parser.add_argument("--out", default="doa_clips", help="output directory for --synth")
+    args = parser.parse_args()
+
+    if args.synth:
+        angles = [int(a) for a in args.angles.split(",")]
+        synthesize(args.synth, angles, args.snr, args.spacing_mm, args.out)
+        return
+    if not args.manifest:
+        parser.error("a manifest or --synth is required")
+
+    base = os.path.dirname(os.path.abspath(args.manifest))
+    with open(args.manifest, newline="") as f:
+        rows = [r for r in csv.DictReader(f) if r.get("path")]
+    errors, costs = [], []
+    print("%-28s %6s %7s %7s %5s %6s" % ("clip", "true", "est", "lag", "coh", "error"))
+    for row in rows:
+        path = os.path.join(base, row["path"])
+        truth = float(row["angle"])
+        if args.device:
+            angle, lag, coherence, frames, ms = evaluate_device(args.device, path)
+            costs.append(ms)
+        else:
+            mic1, mic2 = read_wav(path)
+            angle, lag, coherence, frames = estimate(mic1, mic2, args.spacing_mm)
+        if angle is None:
+            print("%-28s %6.0f %7s" % (row["path"], truth, "-"))
+            errors.append(180.0)
+            continue
+        error = abs(angle - truth)
+        errors.append(error)
+        print("%-28s %6.0f %7.1f %7.2f %5.2f %6.1f" % (row["path"], truth, angle, lag, coherence, error))
+
+    if not errors:
+        sys.exit("no clips in %s" % args.manifest)
+    mean = statistics.mean(errors)
+    within = 100.0 * sum(e <= 15.0 for e in errors) / len(errors)
+    print("%d clips: mean error %.1f deg, median %.1f deg, %.0f%% within 15 deg" % (
+        len(errors), mean, statistics.median(errors), within))
+    if costs:
+        print("device cost: mean %.2f ms, max %.2f ms per estimate" % (statistics.mean(costs), max(costs)))
+    if mean > args.max_error:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""Load the device's REST API and check the server stays responsive.
+
+Three kinds of client run at once for --duration seconds:
+
+    clients  N keep-alive connections looping GET /api/settings and a POST
+             of the same settings back (an NVS commit each time)
+    slow     K connections that POST /api/timer with a no-op command,
+             trickling the body one byte every --trickle-ms, so each one
+             holds a handler for seconds
+    probe    one connection revalidating GET / every --probe-ms; it is
+             answered on the server task itself, so its latency is how long
+             the listener takes to get to a new request
+
+With handlers on the server task a single slow client stalls everything,
+probe included; with the worker pool only the workers it holds are busy.
+Reports latency percentiles per request type, 503s (worker queue full),
+the queue wait the device reports in Server-Timing, and /api/http at the
+end. The server keeps at most 7 sockets, so keep clients + slow + 1 under
+that (fewer if the web UI is open).
+
+    python tools/http_load.py http://192.168.1.50
+    python tools/http_load.py http://192.168.1.50 -c 4 -s 2 -d 30 --label workers --csv load.csv
+"""
+
+import argparse
+import csv
+import json
+import re
+import statistics
+import sys
+import threading
+import time
+import urllib.parse
+
+from web_bench import connect, read_response
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latency = {}
+        self.queue_ms = []
+        self.status = {}
+        self.errors = 0
+
+    def add(self, kind, status, seconds, headers):
+        with self.lock:
+            self.latency.setdefault(kind, []).append(seconds * 1000)
+            self.status[(kind, status)] = self.status.get((kind, status), 0) + 1
+            match = re.search(r"queue;dur=([\d.]+)", headers.get("server-timing", ""))
+            if match:
+                self.queue_ms.append(float(match.group(1)))
+
+    def error(self):
+        with self.lock:
+            self.errors += 1
+
+
+def send(sock, host, method, path, body=b"", extra=""):
+    head = "%s %s HTTP/1.1\r\nHost: %s\r\nAccept-Encoding: gzip\r\n%s" % (method, path, host, extra)
+    if method == "POST":
+        head += "Content-Type: application/json\r\nContent-Length: %d\r\n" % len(body)
+    started = time.perf_counter()
+    sock.sendall(head.encode() + b"\r\n" + body)
+    status, headers, _, _, _ = read_response(sock, started)
+    return status, headers, time.perf_counter() - started
+
+
+def settings_client(host, port, settings, stop, stats):
+    body = json.dumps(settings).encode()
+    while not stop.is_set():
+        try:
+            with connect(host, port) as sock:
+                while not stop.is_set():
+                    for method, payload in (("GET", b""), ("POST", body)):
+                        status, headers, seconds = send(sock, host, method, "/api/settings", payload)
+                        stats.add("%s settings" % method, status, seconds, headers)
+                        if headers.get("connection", "").lower() == "close":
+                            raise ConnectionError("closed by server")
+        except (OSError, ValueError):
+            stats.error()
+            time.sleep(0.2)
+
+
+def slow_client(host, port, trickle_s, stop, stats):
+    body = b'{"command":"none"}'
+    while not stop.is_set():
+        try:
+            with connect(host, port) as sock:
+                head = ("POST /api/timer HTTP/1.1\r\nHost: %s\r\nContent-Type: application/json\r\n"
+                        "Content-Length: %d\r\n\r\n" % (host, len(body)))
+                started = time.perf_counter()
+                sock.sendall(head.encode())
+                for i in range(len(body)):
+                    if stop.is_set():
+                        return
+                    time.sleep(trickle_s)
+                    sock.sendall(body[i:i + 1])
+                status, headers, _, _, _ = read_response(sock, started)
+                stats.add("POST timer (slow)", status, time.perf_counter() - started, headers)
+        except (OSError, ValueError):
+            stats.error()
+            time.sleep(0.2)
+
+
+def probe(host, port, interval_s, stop, stats):
+    etag = ""
+    while not stop.is_set():
+        try:
+            with connect(host, port) as sock:
+                while not stop.is_set():
+                    extra = "If-None-Match: %s\r\n" % etag if etag else ""
+                    status, headers, seconds = send(sock, host, "GET", "/", extra=extra)
+                    etag = headers.get("etag", etag)
+                    stats.add("GET / (probe)", status, seconds, headers)
+                    time.sleep(interval_s)
+        except (OSError, ValueError):
+            stats.error()
+            time.sleep(0.2)
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p / 100.0 * len(values)))]
+
+
+def fetch_json(host, port, path):
+    with connect(host, port) as sock:
+        sock.sendall(("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n" % (path, host)).encode())
+        data = b""
+        while True:
+            chunk = sock.recv(4096)
+            if not chunk:
+                break
+            data += chunk
+    return json.loads(data.split(b"\r\n\r\n", 1)[1])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("url", help="device base URL, e.g. http://192.168.1.50")
+    parser.add_argument("-c", "--clients", type=int, default=4)
+    parser.add_argument("-s", "--slow", type=int, default=1)
+    parser.add_argument("-d", "--duration", type=float, default=20)
+    parser.add_argument("--trickle-ms", type=float, default=300)
+    parser.add_argument("--probe-ms", type=float, default=200)
+    parser.add_argument("--label", default="", help="name for this firmware in --csv")
+    parser.add_argument("--csv", help="append the results to this CSV file")
+    args = parser.parse_args()
+
+    url = urllib.parse.urlparse(args.url)
+    host, port = url.hostname, url.port or 80
+    try:
+        settings = fetch_json(host, port, "/api/settings")
+    except (OSError, ValueError) as e:
+        sys.exit("cannot read /api/settings: %s" % e)
+
+    stats = Stats()
+    stop = threading.Event()
+    threads = [threading.Thread(target=probe, args=(host, port, args.probe_ms / 1000, stop, stats))]
+    threads += [threading.Thread(target=settings_client, args=(host, port, settings, stop, stats))
+                for _ in range(args.clients)]
+    threads += [threading.Thread(target=slow_client, args=(host, port, args.trickle_ms / 1000, stop, stats))
+                for _ in range(args.slow)]
+    for t in threads:
+        t.daemon = True
+        t.start()
+    time.sleep(args.duration)
+    stop.set()
+    for t in threads:
+        t.join(timeout=5)
+
+    print("%s, %d clients + %d slow + probe, %.0f s, %d connection errors" % (
+        args.url, args.clients, args.slow, args.duration, stats.errors))
+    print("%-18s %6s %6s %8s %8s %8s" % ("request", "count", "503", "p50 ms", "p95 ms", "max ms"))
+    rows = []
+    for kind, values in sorted(stats.latency.items()):
+        busy = stats.status.get((kind, 503), 0)
+        p50, p95, worst = percentile(values, 50), percentile(values, 95), max(values)
+        print("%-18s %6d %6d %8.1f %8.1f %8.1f" % (kind, len(values), busy, p50, p95, worst))
+        rows.append([args.label, kind, len(values), busy, round(p50, 1), round(p95, 1), round(worst, 1)])
+    if stats.queue_ms:
+        print("worker queue wait (Server-Timing): median %.1f ms, max %.1f ms" % (
+            statistics.median(stats.queue_ms), max(stats.queue_ms)))
+
+    try:
+        http = fetch_json(host, port, "/api/http")
+        print("device: %d workers, queue peak %d of %d" % (http["workers"], http["queue_peak"], http["queue_len"]))
+        for route in http["routes"]:
+            print("  %-4s %-22s %6d done %4d rejected  wait avg %.1f max %.1f ms  service avg %.1f max %.1f ms" % (
+                route["method"], route["uri"], route["count"], route["rejected"],
+                route["wait_ms"]["avg"], route["wait_ms"]["max"],
+                route["service_ms"]["avg"], route["service_ms"]["max"]))
+    except (OSError, ValueError, KeyError):
+        print("device has no /api/http (firmware without the worker pool)")
+
+    if args.csv:
+        with open(args.csv, "a", newline="") as f:
+            writer = csv.writer(f)
+            if f.tell() == 0:
+                writer.writerow(["label", "request", "count", "busy_503", "p50_ms", "p95_ms", "max_ms"])
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,284 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Host benchmark: main/json_codec.c against cJSON on the web UI's requests.
+//
+//   parse   the POST /api/timer body the page sends, read into the same
+//           fields the handler uses (cJSON_Parse + lookups + cJSON_Delete
+//           versus json_parse into web_timer_request_t)
+//   write   the GET /api/settings response (object tree + cJSON_Print +
+//           free versus the fixed-buffer writer)
+//
+// For each it prints requests per second and heap churn per request:
+// malloc calls, bytes allocated and the peak held at once. cJSON goes
+// through counting hooks; json_codec never calls the allocator, which the
+// same counters confirm. The numbers are host numbers -- use them to compare
+// the two, not as ESP32 throughput. Build against the cJSON that ships with
+// ESP-IDF:
+//
+//   CJSON=$IDF_PATH/components/json/cJSON
+//   cc -O2 -Imain/include -I$CJSON tools/json_bench.c main/json_codec.c $CJSON/cJSON.c -lm -o json_bench
+//   ./json_bench [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cJSON.h"
+#include "json_codec.h"
+
+// Mirrors web_timer_request_t and its schema in main/main.c
+typedef struct {
+    uint8_t r, g, b;
+} CRGB;
+
+typedef struct {
+    char command[12];
+    char mode[12];
+    int32_t duration;
+    CRGB primaryColor;
+    CRGB endColor;
+    CRGB segmentColor;
+    int32_t segments;
+    bool useEndColor;
+} web_timer_request_t;
+
+static const json_field_t color_schema[] = {
+    JSON_FIELD_INT(CRGB, r, "r", 0, 255),
+    JSON_FIELD_INT(CRGB, g, "g", 0, 255),
+    JSON_FIELD_INT(CRGB, b, "b", 0, 255),
+};
+
+static const json_field_t timer_schema[] = {
+    JSON_FIELD_STRING(web_timer_request_t, command, "command"),
+    JSON_FIELD_STRING(web_timer_request_t, mode, "mode"),
+    JSON_FIELD_INT(web_timer_request_t, duration, "duration", 1, 1440),
+    JSON_FIELD_OBJECT(web_timer_request_t, primaryColor, "primaryColor", color_schema),
+    JSON_FIELD_OBJECT(web_timer_request_t, endColor, "endColor", color_schema),
+    JSON_FIELD_OBJECT(web_timer_request_t, segmentColor, "segmentColor", color_schema),
+    JSON_FIELD_INT(web_timer_request_t, segments, "segments", 1, 12),
+    JSON_FIELD_BOOL(web_timer_request_t, useEndColor, "useEndColor"),
+};
+
+// What the web UI's startTimer() posts
+static const char TIMER_BODY[] =
+    "{\"command\":\"start\",\"mode\":\"countdown\",\"duration\":25,"
+    "\"primaryColor\":{\"r\":0,\"g\":102,\"b\":255},\"endColor\":{\"r\":255,\"g\":0,\"b\":0},"
+    "\"segmentColor\":{\"r\":255,\"g\":215,\"b\":0},\"segments\":4,\"useEndColor\":true}";
+
+static const web_timer_request_t SETTINGS = {
+    .primaryColor = { 0, 102, 255 },
+    .endColor = { 255, 0, 0 },
+    .segmentColor = { 255, 215, 0 },
+    .segments = 4,
+    .useEndColor = true,
+};
+
+static struct {
+    size_t calls;
+    size_t bytes;
+    size_t live;
+    size_t peak;
+} s_heap;
+
+static void *counting_malloc(size_t size)
+{
+    size_t *p = malloc(size + sizeof(size_t));
+    if (!p) {
+        return NULL;
+    }
+    *p = size;
+    s_heap.calls++;
+    s_heap.bytes += size;
+    s_heap.live += size;
+    if (s_heap.live > s_heap.peak) {
+        s_heap.peak = s_heap.live;
+    }
+    return p + 1;
+}
+
+static void counting_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    size_t *p = (size_t *)ptr - 1;
+    s_heap.live -= *p;
+    free(p);
+}
+
+static volatile int s_sink;
+
+static void read_color(const cJSON *json, const char *key, CRGB *out)
+{
+    cJSON *color = cJSON_GetObjectItem(json, key);
+    if (color) {
+        cJSON *r = cJSON_GetObjectItem(color, "r");
+        cJSON *g = cJSON_GetObjectItem(color, "g");
+        cJSON *b = cJSON_GetObjectItem(color, "b");
+        if (r && g && b) {
+            out->r = r->valueint;
+            out->g = g->valueint;
+            out->b = b->valueint;
+        }
+    }
+}
+
+static void parse_cjson(web_timer_request_t *out)
+{
+    cJSON *json = cJSON_Parse(TIMER_BODY);
+    cJSON *command = cJSON_GetObjectItem(json, "command");
+    cJSON *mode = cJSON_GetObjectItem(json, "mode");
+    cJSON *duration = cJSON_GetObjectItem(json, "duration");
+    cJSON *segments = cJSON_GetObjectItem(json, "segments");
+    cJSON *useEndColor = cJSON_GetObjectItem(json, "useEndColor");
+    snprintf(out->command, sizeof(out->command), "%s", command->valuestring);
+    snprintf(out->mode, sizeof(out->mode), "%s", mode->valuestring);
+    out->duration = duration->valueint;
+    read_color(json, "primaryColor", &out->primaryColor);
+    read_color(json, "endColor", &out->endColor);
+    read_color(json, "segmentColor", &out->segmentColor);
+    out->segments = segments->valueint;
+    out->useEndColor = cJSON_IsTrue(useEndColor);
+    cJSON_Delete(json);
+}
+
+static void parse_codec(web_timer_request_t *out)
+{
+    if (json_parse(TIMER_BODY, sizeof(TIMER_BODY) - 1, timer_schema,
+                   sizeof(timer_schema) / sizeof(timer_schema[0]), out, NULL) != JSON_OK) {
+        abort();
+    }
+}
+
+static void add_color(cJSON *parent, const char *key, CRGB c)
+{
+    cJSON *color = cJSON_CreateObject();
+    cJSON_AddNumberToObject(color, "r", c.r);
+    cJSON_AddNumberToObject(color, "g", c.g);
+    cJSON_AddNumberToObject(color, "b", c.b);
+    cJSON_AddItemToObject(parent, key, color);
+}
+
+static cJSON *settings_tree(void)
+{
+    cJSON *response = cJSON_CreateObject();
+    add_color(response, "primaryColor", SETTINGS.primaryColor);
+    add_color(response, "endColor", SETTINGS.endColor);
+    add_color(response, "segmentColor", SETTINGS.segmentColor);
+    cJSON_AddNumberToObject(response, "segments", SETTINGS.segments);
+    cJSON_AddBoolToObject(response, "useEndColor", SETTINGS.useEndColor);
+    return response;
+}
+
+static void write_cjson(void)
+{
+    cJSON *response = settings_tree();
+    char *text = cJSON_Print(response);
+    s_sink += strlen(text);
+    cJSON_free(text);
+    cJSON_Delete(response);
+}
+
+static void write_color(json_writer_t *w, const char *key, CRGB c)
+{
+    json_write_object_begin(w, key);
+    json_write_uint(w, "r", c.r);
+    json_write_uint(w, "g", c.g);
+    json_write_uint(w, "b", c.b);
+    json_write_object_end(w);
+}
+
+static size_t settings_codec(char *buf, size_t size)
+{
+    json_writer_t w;
+    json_writer_init(&w, buf, size);
+    json_write_object_begin(&w, NULL);
+    write_color(&w, "primaryColor", SETTINGS.primaryColor);
+    write_color(&w, "endColor", SETTINGS.endColor);
+    write_color(&w, "segmentColor", SETTINGS.segmentColor);
+    json_write_int(&w, "segments", SETTINGS.segments);
+    json_write_bool(&w, "useEndColor", SETTINGS.useEndColor);
+    json_write_object_end(&w);
+    return json_writer_finish(&w);
+}
+
+static void write_codec(void)
+{
+    char buf[256];
+    s_sink += settings_codec(buf, sizeof(buf));
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void run(const char *name, void (*fn)(void), long iterations)
+{
+    memset(&s_heap, 0, sizeof(s_heap));
+    double start = now_s();
+    for (long i = 0; i < iterations; i++) {
+        fn();
+    }
+    double elapsed = now_s() - start;
+    printf("%-14s %12.0f %10.1f %12.1f %10zu\n", name, iterations / elapsed,
+           (double)s_heap.calls / iterations, (double)s_heap.bytes / iterations, s_heap.peak);
+}
+
+static void parse_cjson_once(void)
+{
+    web_timer_request_t out = { 0 };
+    parse_cjson(&out);
+    s_sink += out.duration;
+}
+
+static void parse_codec_once(void)
+{
+    web_timer_request_t out = { 0 };
+    parse_codec(&out);
+    s_sink += out.duration;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = argc > 1 ? atol(argv[1]) : 200000;
+    cJSON_Hooks hooks = { .malloc_fn = counting_malloc, .free_fn = counting_free };
+    cJSON_InitHooks(&hooks);
+
+    // Both sides have to agree before their speed means anything
+    web_timer_request_t a, b;
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    parse_cjson(&a);
+    parse_codec(&b);
+    if (memcmp(&a, &b, sizeof(a)) != 0) {
+        fprintf(stderr, "parse results differ\n");
+        return 1;
+    }
+    char buf[256];
+    cJSON *tree = settings_tree();
+    char *expected = cJSON_PrintUnformatted(tree);
+    size_t len = settings_codec(buf, sizeof(buf));
+    if (len != strlen(expected) || memcmp(buf, expected, len) != 0) {
+        fprintf(stderr, "writer output differs:\n  cJSON  %s\n  codec  %s\n", expected, buf);
+        return 1;
+    }
+    cJSON_free(expected);
+    cJSON_Delete(tree);
+
+    printf("%ld iterations; POST /api/timer body %zu bytes, GET /api/settings %zu bytes\n",
+           iterations, sizeof(TIMER_BODY) - 1, len);
+    printf("%-14s %12s %10s %12s %10s\n", "", "req/s", "mallocs", "bytes alloc", "peak B");
+    run("parse cJSON", parse_cjson_once, iterations);
+    run("parse codec", parse_codec_once, iterations);
+    run("write cJSON", write_cjson, iterations);
+    run("write codec", write_codec, iterations);
+    return 0;
+}
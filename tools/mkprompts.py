@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+"""Build the voice prompt pack for the "prompts" partition.
+
+The prompt directory holds WAV files (16-bit mono) and a manifest.csv:
+
+    id,name,file
+    128,timer,words/timer.wav
+    129,count,words/count.wav
+
+Ids from 128 are single words (prompts/words/) that main/phrase_synth.c
+stitches into confirmations such as "timer five minutes"; their leading and
+trailing silence is trimmed here. Word clips that have not been recorded yet
+are skipped with a warning and the device falls back to the wake chime for
+phrases that need them; tools/mkwords.py generates them with a TTS engine.
+The demo clips below id 128 fill the pack until then and are left out once
+every word exists, as both together do not fit the partition. The build
+fails if none of the manifest's files exist. Tones (wake chime, beeps,
+alarms) are not stored here: main/tone_synth.c generates them.
+
+    python tools/mkprompts.py prompts -o build/prompts.bin
+    python tools/mkprompts.py prompts -o build/prompts.bin --flash --port /dev/ttyACM0
+    python tools/mkprompts.py prompts -o build/prompts.bin --check
+
+Prompts are stored as IMA-ADPCM (4 bits per sample) unless --format pcm16 is
+given. Every encoded prompt is decoded again with the same arithmetic as
+main/adpcm.c and compared with the source PCM; the build fails if any prompt
+falls below --min-snr. --check prints the per-prompt figures.
+
+The build runs this automatically and `idf.py flash` writes the result;
+--flash updates the prompts on a device without rebuilding the firmware.
+The layout matches prompt_pack_header_t / prompt_pack_entry_t in
+main/include/prompt_pack.h.
+"""
+
+import argparse
+import csv
+import math
+import os
+import struct
+import subprocess
+import sys
+import wave
+
+MAGIC = b"PPK1"
+VERSION = 2
+NAME_LEN = 32
+FORMAT_PCM16 = 0
+FORMAT_IMA_ADPCM = 1
+ALIGN = 4
+PARTITION = "prompts"
+WORD_BASE = 128
+SILENCE = 300           # about -40 dBFS
+TRIM_MARGIN_MS = 10
+
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<%dsHBBIIII" % NAME_LEN)
+
+# IMA-ADPCM, see main/include/adpcm.h
+BLOCK_BYTES = 256
+BLOCK_SAMPLES = 1 + (BLOCK_BYTES - 4) * 2
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def load_wav(path):
+    with wave.open(path, "rb") as wav:
+        if wav.getsampwidth() != 2 or wav.getnchannels() != 1:
+            sys.exit("%s: need 16-bit mono" % path)
+        return wav.getframerate(), wav.readframes(wav.getnframes())
+
+
+def adpcm_step(code, predictor, index):
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if code & 1:
+        diff += step >> 2
+    if code & 2:
+        diff += step >> 1
+    if code & 4:
+        diff += step
+    predictor = predictor - diff if code & 8 else predictor + diff
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + INDEX_TABLE[code]))
+    return predictor, index
+
+
+def adpcm_encode(samples):
+    """Encode mono samples into blocks; the decoder state is tracked exactly
+    so quantisation error never accumulates."""
+    out = bytearray()
+    index = 0
+    for start in range(0, len(samples), BLOCK_SAMPLES):
+        block = samples[start:start + BLOCK_SAMPLES]
+        predictor = block[0]
+        out += struct.pack("<hBB", predictor, index, 0)
+        codes = []
+        for sample in block[1:]:
+            step = STEP_TABLE[index]
+            delta = sample - predictor
+            code = 0
+            if delta < 0:
+                code = 8
+                delta = -delta
+            if delta >= step:
+                code |= 4
+                delta -= step
+            if delta >= step >> 1:
+                code |= 2
+                delta -= step >> 1
+            if delta >= step >> 2:
+                code |= 1
+            predictor, index = adpcm_step(code, predictor, index)
+            codes.append(code)
+        if len(codes) % 2:
+            codes.append(0)
+        out += bytes(codes[i] | codes[i + 1] << 4 for i in range(0, len(codes), 2))
+    return bytes(out)
+
+
+def adpcm_decode(data, count):
+    samples = []
+    for start in range(0, len(data), BLOCK_BYTES):
+        block = data[start:start + BLOCK_BYTES]
+        predictor, index, _ = struct.unpack_from("<hBB", block)
+        index = min(index, 88)
+        samples.append(predictor)
+        for byte in block[4:]:
+            for code in (byte & 0x0f, byte >> 4):
+                predictor, index = adpcm_step(code, predictor, index)
+                samples.append(predictor)
+    return samples[:count]
+
+
+def snr_db(reference, decoded):
+    signal = sum(s * s for s in reference)
+    noise = sum((a - b) ** 2 for a, b in zip(reference, decoded))
+    if noise == 0:
+        return float("inf")
+    if signal == 0:
+        return float("-inf")
+    return 10 * math.log10(signal / noise)
+
+
+def trim_silence(samples, rate):
+    loud = [i for i, s in enumerate(samples) if abs(s) > SILENCE]
+    if not loud:
+        return samples
+    margin = rate * TRIM_MARGIN_MS // 1000
+    return samples[max(0, loud[0] - margin):loud[-1] + margin + 1]
+
+
+def build(directory, fmt, min_snr, report):
+    with open(os.path.join(directory, "manifest.csv"), newline="") as f:
+        rows = [r for r in csv.DictReader(f) if r.get("file")]
+    ids = [int(r["id"]) for r in rows]
+    if len(set(ids)) != len(ids):
+        sys.exit("duplicate prompt ids in manifest")
+    missing = [r for r in rows if not os.path.exists(os.path.join(directory, r["file"]))]
+    if rows and len(missing) == len(rows):
+        sys.exit("none of the %d prompt files in the manifest exist (run tools/mkwords.py for the words)"
+                 % len(rows))
+    words = [r for r in rows if int(r["id"]) >= WORD_BASE]
+    if words and not any(r in missing for r in words):
+        rows, missing = words, []
+    if any(int(r["id"]) < WORD_BASE for r in missing):
+        sys.exit("missing prompt files: %s" % ", ".join(r["file"] for r in missing))
+    if missing:
+        print("warning: %d word clips not recorded yet: %s" % (len(missing), " ".join(r["name"] for r in missing)))
+        rows = [r for r in rows if r not in missing]
+
+    offset = HEADER.size + ENTRY.size * len(rows)
+    entries, blobs = [], []
+    pcm_bytes, worst = 0, None
+    if report and fmt == "adpcm":
+        print("%-32s %8s %8s %8s" % ("prompt", "ms", "bytes", "snr_db"))
+    for row in sorted(rows, key=lambda r: int(r["id"])):
+        rate, pcm = load_wav(os.path.join(directory, row["file"]))
+        if int(row["id"]) >= WORD_BASE:
+            samples = trim_silence(list(struct.unpack("<%dh" % (len(pcm) // 2), pcm)), rate)
+            pcm = struct.pack("<%dh" % len(samples), *samples)
+        count = len(pcm) // 2
+        pcm_bytes += len(pcm)
+        if fmt == "adpcm":
+            samples = list(struct.unpack("<%dh" % count, pcm))
+            data = adpcm_encode(samples)
+            snr = snr_db(samples, adpcm_decode(data, count))
+            if report:
+                print("%-32s %8d %8d %8.1f" % (row["name"], count * 1000 // rate, len(data), snr))
+            if worst is None or snr < worst[1]:
+                worst = (row["name"], snr)
+            code = FORMAT_IMA_ADPCM
+        else:
+            data, code = pcm, FORMAT_PCM16
+        pad = -offset % ALIGN
+        blobs.append(b"\0" * pad)
+        offset += pad
+        entries.append(ENTRY.pack(row["name"].encode()[:NAME_LEN - 1], int(row["id"]), code, 1,
+                                  rate, offset, len(data), count))
+        blobs.append(data)
+        offset += len(data)
+
+    image = HEADER.pack(MAGIC, VERSION, len(rows), 0, 0) + b"".join(entries) + b"".join(blobs)
+    print("%d prompts, %d bytes (%d bytes of PCM)" % (len(rows), len(image), pcm_bytes))
+    if worst:
+        print("lowest SNR %.1f dB (%s)" % (worst[1], worst[0]))
+        if worst[1] < min_snr:
+            sys.exit("%s is below --min-snr %.1f dB" % (worst[0], min_snr))
+    return image
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("directory")
+    parser.add_argument("-o", "--output", default="prompts.bin")
+    parser.add_argument("--size", type=lambda s: int(s, 0), default=256 * 1024,
+                        help="partition size from partitions.csv")
+    parser.add_argument("--format", choices=("adpcm", "pcm16"), default="adpcm")
+    parser.add_argument("--min-snr", type=float, default=20.0,
+                        help="fail if a decoded ADPCM prompt is below this SNR in dB")
+    parser.add_argument("--check", action="store_true", help="print per-prompt ADPCM quality")
+    parser.add_argument("--flash", action="store_true", help="write the image with parttool.py")
+    parser.add_argument("--port", help="serial port for --flash")
+    args = parser.parse_args()
+
+    image = build(args.directory, args.format, args.min_snr, args.check)
+    if len(image) > args.size:
+        sys.exit("prompt pack is %d bytes, partition holds %d" % (len(image), args.size))
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+    if args.flash:
+        idf_path = os.environ.get("IDF_PATH")
+        if not idf_path:
+            sys.exit("IDF_PATH is not set, run export.sh first")
+        cmd = [sys.executable, os.path.join(idf_path, "components", "partition_table", "parttool.py")]
+        if args.port:
+            cmd += ["--port", args.port]
+        cmd += ["write_partition", "--partition-name", PARTITION, "--input", args.output]
+        subprocess.check_call(cmd)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Compress the web UI into a C source file that is linked into the firmware.
+
+Every file under web/ becomes one gzip'd asset served by main/web_ui.c:
+
+    web/index.html  ->  GET /
+    web/app.js      ->  GET /app.js
+
+Each asset gets a strong ETag (a hash of the uncompressed content) and its
+lengths as compile-time constants, so the server answers 304 to a matching
+If-None-Match and otherwise sends the gzip bytes in one call. The output is
+deterministic (no timestamps in the gzip header), so unchanged assets keep
+their ETag across builds.
+
+    python tools/mkwebui.py web -o build/web_assets.c
+    python tools/mkwebui.py web --check
+
+The build runs this automatically; --check prints the sizes. The table
+layout matches web_asset_t in main/include/web_ui.h.
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+
+def collect(directory):
+    assets = []
+    for root, _, files in os.walk(directory):
+        for name in sorted(files):
+            path = os.path.join(root, name)
+            ext = os.path.splitext(name)[1].lower()
+            if ext not in TYPES:
+                print("skipping %s: unknown type" % path, file=sys.stderr)
+                continue
+            with open(path, "rb") as f:
+                raw = f.read()
+            uri = "/" + os.path.relpath(path, directory).replace(os.sep, "/")
+            if uri == "/index.html":
+                uri = "/"
+            gz = gzip.compress(raw, compresslevel=9, mtime=0)
+            etag = '"%s"' % hashlib.sha256(raw).hexdigest()[:16]
+            assets.append((uri, TYPES[ext], raw, gz, etag))
+    if not assets:
+        sys.exit("no web assets in %s" % directory)
+    return sorted(assets)
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def write_source(assets, output):
+    out = ["// Generated by tools/mkwebui.py from web/, do not edit", "",
+           "#include <stddef.h>", "#include <stdint.h>", '#include "web_ui.h"', ""]
+    for i, (uri, _, _, gz, _) in enumerate(assets):
+        out.append("// %s" % uri)
+        out.append("static const uint8_t asset_%d[%d] = {" % (i, len(gz)))
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("")
+    out.append("const web_asset_t web_assets[] = {")
+    for i, (uri, ctype, raw, gz, etag) in enumerate(assets):
+        out.append('    { "%s", "%s", asset_%d, sizeof(asset_%d), %d, "%s" },' % (
+            uri, ctype, i, i, len(raw), etag.replace('"', '\\"')))
+    out.append("};")
+    out.append("")
+    out.append("const size_t web_asset_count = sizeof(web_assets) / sizeof(web_assets[0]);")
+    out.append("")
+    with open(output, "w") as f:
+        f.write("\n".join(out))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("directory")
+    parser.add_argument("-o", "--output", default="web_assets.c")
+    parser.add_argument("--check", action="store_true", help="print sizes, write nothing")
+    args = parser.parse_args()
+
+    assets = collect(args.directory)
+    total_raw = sum(len(a[2]) for a in assets)
+    total_gz = sum(len(a[3]) for a in assets)
+    if args.check:
+        for uri, ctype, raw, gz, etag in assets:
+            print("%-16s %-24s %6d -> %6d bytes (%3.0f%%) ETag %s" % (
+                uri, ctype, len(raw), len(gz), 100.0 * len(gz) / len(raw), etag))
+    print("%d web assets, %d bytes, %d gzipped" % (len(assets), total_raw, total_gz))
+    if not args.check:
+        write_source(assets, args.output)
+
+
+if __name__ == "__main__":
+    main()
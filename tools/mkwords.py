@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Generate the word clips in prompts/words/ with a text-to-speech engine.
+
+Every manifest entry with an id from 128 (see tools/mkprompts.py) is spoken
+by espeak-ng or pico2wave and written as 16 kHz mono 16-bit WAV, the format
+the prompt pack expects. Clips that already exist are kept, so recorded
+words can replace generated ones one at a time; --force regenerates all of
+them.
+
+    python tools/mkwords.py prompts
+    python tools/mkwords.py prompts --engine pico2wave --force
+    python tools/mkwords.py prompts --voice en-gb --speed 140
+
+The output only depends on the engine, its version and the options, so the
+same command gives the same clips on another machine. mkprompts.py trims
+the silence around each word when the pack is built.
+"""
+
+import argparse
+import csv
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import wave
+
+WORD_BASE = 128
+RATE = 16000
+ENGINES = ("espeak-ng", "pico2wave")
+
+
+def speak(engine, text, path, voice, speed):
+    if engine == "espeak-ng":
+        cmd = ["espeak-ng", "-v", voice or "en-us", "-s", str(speed), "-w", path, text]
+    else:
+        cmd = ["pico2wave", "-l", voice or "en-US", "-w", path, text]
+    subprocess.check_call(cmd)
+
+
+def to_mono16(path):
+    with wave.open(path, "rb") as wav:
+        if wav.getsampwidth() != 2:
+            sys.exit("%s: engine wrote %d-byte samples, need 16-bit" % (path, wav.getsampwidth()))
+        rate, channels = wav.getframerate(), wav.getnchannels()
+        frames = wav.readframes(wav.getnframes())
+    samples = struct.unpack("<%dh" % (len(frames) // 2), frames)
+    return rate, list(samples[::channels])
+
+
+def resample(samples, rate):
+    """Linear interpolation; the engines put next to nothing above 8 kHz."""
+    if rate == RATE or not samples:
+        return samples
+    count = len(samples) * RATE // rate
+    out = []
+    for i in range(count):
+        pos = i * rate / RATE
+        j = int(pos)
+        frac = pos - j
+        b = samples[j + 1] if j + 1 < len(samples) else samples[j]
+        out.append(int(round(samples[j] + (b - samples[j]) * frac)))
+    return out
+
+
+def write_wav(path, samples):
+    with wave.open(path, "wb") as wav:
+        wav.setnchannels(1)
+        wav.setsampwidth(2)
+        wav.setframerate(RATE)
+        wav.writeframes(struct.pack("<%dh" % len(samples), *samples))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("directory")
+    parser.add_argument("--engine", choices=ENGINES, help="default: the first one installed")
+    parser.add_argument("--voice", help="engine voice or language, e.g. en-us")
+    parser.add_argument("--speed", type=int, default=150, help="words per minute (espeak-ng)")
+    parser.add_argument("--force", action="store_true", help="replace clips that already exist")
+    args = parser.parse_args()
+
+    engine = args.engine or next((e for e in ENGINES if shutil.which(e)), None)
+    if not engine or not shutil.which(engine):
+        sys.exit("no text-to-speech engine found, install espeak-ng or pico2wave")
+
+    with open(os.path.join(args.directory, "manifest.csv"), newline="") as f:
+        rows = [r for r in csv.DictReader(f) if r.get("file") and int(r["id"]) >= WORD_BASE]
+
+    made = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        raw = os.path.join(tmp, "word.wav")
+        for row in rows:
+            path = os.path.join(args.directory, row["file"])
+            if os.path.exists(path) and not args.force:
+                continue
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            speak(engine, row["name"], raw, args.voice, args.speed)
+            rate, samples = to_mono16(raw)
+            write_wav(path, resample(samples, rate))
+            made += 1
+    print("%d of %d word clips generated with %s" % (made, len(rows), engine))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Stream test frames to the ring over DDP or E1.31 and report what arrived.
+
+Sends a moving rainbow at --fps for --duration seconds, like lighting
+software on a PC would, then reads /api/pixels from the device and prints
+frames shown, fps, packet loss, late (reordered or repeated) packets,
+interval and transit jitter and receive-to-shown latency next to what was
+sent. Faults can be injected to check the sequence handling: --drop,
+--reorder and --duplicate act on single packets, --jitter-ms randomises the
+send pacing.
+
+    python tools/pixel_sender.py 192.168.1.50
+    python tools/pixel_sender.py 192.168.1.50 --fps 120 -d 30
+    python tools/pixel_sender.py 192.168.1.50 --protocol e131 --sync 64000 --drop 0.02 --reorder 0.02
+    python tools/pixel_sender.py 192.168.1.50 --packet-leds 30 --duplicate 0.05
+
+DDP frames carry a timecode, so the device can track transit jitter; they
+may be split over several packets with --packet-leds (the last one has
+PUSH). E1.31 frames are one universe, shown per packet, or on a universe
+sync packet with --sync; the stream is ended with the terminated flag so the
+ring goes back to its own animations at once instead of after the timeout.
+"""
+
+import argparse
+import colorsys
+import json
+import os
+import random
+import socket
+import struct
+import sys
+import time
+import urllib.request
+
+DDP_PORT = 4048
+E131_PORT = 5568
+E131_UNIVERSE = 1
+
+DDP_VERSION_1 = 0x40
+DDP_FLAG_TIMECODE = 0x10
+DDP_FLAG_PUSH = 0x01
+DDP_TYPE_RGB8 = 0x0B
+DDP_ID_DISPLAY = 1
+
+E131_ACN_ID = b"ASC-E1.17\x00\x00\x00"
+E131_OPT_TERMINATED = 0x40
+
+
+def rainbow(leds, frame):
+    data = bytearray()
+    for i in range(leds):
+        r, g, b = colorsys.hsv_to_rgb(((i + frame) % leds) / leds, 1.0, 0.5)
+        data += bytes((int(r * 255), int(g * 255), int(b * 255)))
+    return bytes(data)
+
+
+class Ddp:
+    port = DDP_PORT
+
+    def __init__(self, args):
+        self.packet_bytes = (args.packet_leds or args.leds) * 3
+        self.seq = 0
+
+    def packets(self, pixels):
+        timecode = int(time.perf_counter() * 65536) & 0xFFFFFFFF
+        out = []
+        for offset in range(0, len(pixels), self.packet_bytes):
+            chunk = pixels[offset:offset + self.packet_bytes]
+            self.seq = self.seq % 15 + 1
+            flags = DDP_VERSION_1 | DDP_FLAG_TIMECODE
+            if offset + len(chunk) >= len(pixels):
+                flags |= DDP_FLAG_PUSH
+            header = struct.pack(">BBBBIHI", flags, self.seq, DDP_TYPE_RGB8, DDP_ID_DISPLAY,
+                                 offset, len(chunk), timecode)
+            out.append(header + chunk)
+        return out
+
+    def end(self):
+        return []
+
+
+class E131:
+    port = E131_PORT
+
+    def __init__(self, args):
+        self.cid = os.urandom(16)
+        self.sync = args.sync
+        self.seq = random.getrandbits(8)
+        self.sync_seq = 0
+
+    def _root(self, vector, length):
+        return struct.pack(">HH12sHI16s", 0x0010, 0, E131_ACN_ID, 0x7000 | (length - 16), vector, self.cid)
+
+    def data(self, pixels, options=0):
+        self.seq = (self.seq + 1) & 0xFF
+        length = 126 + len(pixels)
+        framing = struct.pack(">HI64sBHBBH", 0x7000 | (length - 38), 0x00000002,
+                              b"pixel_sender", 100, self.sync, self.seq, options, E131_UNIVERSE)
+        dmp = struct.pack(">HBBHHHB", 0x7000 | (length - 115), 0x02, 0xA1, 0, 1, len(pixels) + 1, 0)
+        return self._root(0x00000004, length) + framing + dmp + pixels
+
+    def sync_packet(self):
+        self.sync_seq = (self.sync_seq + 1) & 0xFF
+        framing = struct.pack(">HIBHH", 0x7000 | (49 - 38), 0x00000001, self.sync_seq, self.sync, 0)
+        return self._root(0x00000008, 49) + framing
+
+    def packets(self, pixels):
+        out = [self.data(pixels)]
+        if self.sync:
+            out.append(self.sync_packet())
+        return out
+
+    def end(self):
+        # E1.31 6.2.6: three packets with the terminated flag
+        return [self.data(bytes(0), E131_OPT_TERMINATED) for _ in range(3)]
+
+
+def api(host, port, body=None):
+    url = "http://%s:%d/api/pixels" % (host, port)
+    data = json.dumps(body).encode() if body is not None else None
+    with urllib.request.urlopen(urllib.request.Request(url, data=data), timeout=3) as r:
+        return json.load(r)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device address, e.g. 192.168.1.50")
+    parser.add_argument("--protocol", choices=["ddp", "e131"], default="ddp")
+    parser.add_argument("--fps", type=float, default=60)
+    parser.add_argument("-d", "--duration", type=float, default=10)
+    parser.add_argument("--leds", type=int, default=85)
+    parser.add_argument("--packet-leds", type=int, help="ddp: LEDs per packet (default: the whole ring)")
+    parser.add_argument("--sync", type=int, default=0, help="e131: show frames on sync packets for this universe")
+    parser.add_argument("--drop", type=float, default=0, help="probability of dropping a packet")
+    parser.add_argument("--reorder", type=float, default=0, help="probability of sending a packet after the next")
+    parser.add_argument("--duplicate", type=float, default=0, help="probability of sending a packet twice")
+    parser.add_argument("--jitter-ms", type=float, default=0, help="random +- offset on each frame's send time")
+    parser.add_argument("--port", type=int, help="override the UDP port")
+    parser.add_argument("--http-port", type=int, default=80)
+    parser.add_argument("--no-stats", action="store_true", help="do not reset or read /api/pixels")
+    parser.add_argument("--seed", type=int)
+    args = parser.parse_args()
+
+    random.seed(args.seed)
+    if args.protocol == "e131" and args.leds > 170:
+        sys.exit("one universe holds 170 LEDs")
+    stream = Ddp(args) if args.protocol == "ddp" else E131(args)
+    addr = (socket.gethostbyname(args.host), args.port or stream.port)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+    if not args.no_stats:
+        try:
+            api(args.host, args.http_port, {"reset": True})
+        except (OSError, ValueError) as e:
+            print("cannot reset /api/pixels (%s); sending anyway" % e)
+            args.no_stats = True
+
+    sent = dropped = reordered = duplicated = frames = 0
+    held = None
+    lateness = []
+    interval = 1.0 / args.fps
+    started = time.perf_counter()
+    while True:
+        due = started + frames * interval
+        if due - started >= args.duration:
+            break
+        target = due + random.uniform(-args.jitter_ms, args.jitter_ms) / 1000
+        delay = target - time.perf_counter()
+        if delay > 0:
+            time.sleep(delay)
+        lateness.append(max(0.0, time.perf_counter() - target) * 1000)
+        for packet in stream.packets(rainbow(args.leds, frames)):
+            if random.random() < args.drop:
+                dropped += 1
+                continue
+            if held is None and random.random() < args.reorder:
+                held = packet
+                reordered += 1
+                continue
+            sock.sendto(packet, addr)
+            sent += 1
+            if random.random() < args.duplicate:
+                sock.sendto(packet, addr)
+                duplicated += 1
+            if held is not None:
+                sock.sendto(held, addr)
+                sent += 1
+                held = None
+        frames += 1
+    elapsed = time.perf_counter() - started
+    if held is not None:
+        sock.sendto(held, addr)
+        sent += 1
+    for packet in stream.end():
+        sock.sendto(packet, addr)
+
+    lateness.sort()
+    print("%s to %s:%d, %d LEDs: %d frames in %.1f s (%.1f fps), %d packets sent" % (
+        args.protocol, addr[0], addr[1], args.leds, frames, elapsed, frames / elapsed, sent))
+    print("injected: %d dropped, %d reordered, %d duplicated; send lateness p50 %.2f ms, p99 %.2f ms" % (
+        dropped, reordered, duplicated, lateness[len(lateness) // 2], lateness[int(len(lateness) * 0.99)]))
+    if args.no_stats:
+        return
+
+    time.sleep(0.2)
+    try:
+        device = api(args.host, args.http_port)
+    except (OSError, ValueError) as e:
+        sys.exit("cannot read /api/pixels: %s" % e)
+    timing = device["timing"]
+    print("device: %d frames shown (%d suppressed), %.1f fps, %d lost, %d late, %d bad" % (
+        device["frames"], device["suppressed"], device["fps"], device["lost"], device["late"], device["bad"]))
+    print("        interval jitter %.2f ms, transit jitter %.2f ms, receive to shown avg %d us, max %d us" % (
+        timing["interval_jitter_ms"], timing["transit_jitter_ms"], timing["latency_us_avg"], timing["latency_us_max"]))
+
+
+if __name__ == "__main__":
+    main()
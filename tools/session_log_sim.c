@@ -0,0 +1,435 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+// Host simulation of the timer session log (main/session_log.c) over months
+// of use, on a RAM image of the "sessions" partition that behaves like NOR
+// flash: erase sets a 4 KB sector to 0xFF, a write can only clear bits, and
+// a write over bits that are already programmed stops the run.
+//
+// Each simulated day has a few timers at random times. Finished sessions are
+// batched the way the device does it (enough to fill the head page to its
+// end, or an hour after the oldest one) and appended. Now and then the power is cut: the sessions
+// still in RAM are lost, and some cuts land in the middle of a write or an
+// erase, leaving a torn record or a half-erased sector. Every cut, and every
+// week for a planned restart, the log is mounted again from flash and
+// checked against what was written: sequence numbers rising oldest to newest,
+// every record readable and unchanged, the counts in the index right.
+//
+// At the end it prints:
+//
+//   wear     erases per sector, how even they are, and the years to 100k
+//            erase cycles at this rate
+//   lookups  flash pages read and host time for a one-day query, the last
+//            few records (?after=) and a full read, against scanning the
+//            whole log for the same answer
+//
+//   cc -O2 -Imain/include tools/session_log_sim.c main/session_log.c -o session_log_sim
+//   ./session_log_sim [days] [sessions-per-day] [partition-KB] [seed]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "session_log.h"
+
+#define DAY_S           86400
+#define CUT_CHANCE      0.03    // per day
+#define TORN_CHANCE     0.4     // of a cut: it lands in a flash operation
+#define RESTART_DAYS    7
+#define ENDURANCE       100000  // erase cycles per sector
+#define SIM_START_UNIX  1735689600
+
+typedef struct {
+    uint8_t *data;
+    uint32_t size;
+    uint32_t *erases;
+    long budget;                // bytes left before the power goes, -1 = none
+    unsigned long pages_written;
+} sim_flash_t;
+
+typedef struct {
+    uint32_t start_unix;
+    uint32_t run_s;
+} shadow_t;
+
+static shadow_t *shadow;        // by seq: what was written
+static uint32_t shadow_len;
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void fail(const char *what, uint32_t seq)
+{
+    fprintf(stderr, "FAIL: %s (seq %u)\n", what, seq);
+    exit(1);
+}
+
+static int sim_read(void *ctx, uint32_t offset, void *buf, size_t len)
+{
+    sim_flash_t *f = ctx;
+    if (offset + len > f->size) {
+        return -1;
+    }
+    memcpy(buf, f->data + offset, len);
+    return 0;
+}
+
+static int sim_write(void *ctx, uint32_t offset, const void *buf, size_t len)
+{
+    sim_flash_t *f = ctx;
+    const uint8_t *src = buf;
+    if (offset + len > f->size) {
+        return -1;
+    }
+    f->pages_written += (offset % SESSION_PAGE_SIZE + len + SESSION_PAGE_SIZE - 1) / SESSION_PAGE_SIZE;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t *dst = &f->data[offset + i];
+        if ((*dst & src[i]) != src[i]) {
+            fail("write over programmed bits", 0);
+        }
+        if (f->budget == 0) {
+            // Power gone: this byte gets some of its bits, the rest none
+            *dst &= src[i] | (uint8_t)rand();
+            return -1;
+        }
+        if (f->budget > 0) {
+            f->budget--;
+        }
+        *dst = src[i];
+    }
+    return 0;
+}
+
+static int sim_erase(void *ctx, uint32_t offset, size_t len)
+{
+    sim_flash_t *f = ctx;
+    if (offset % SESSION_SECTOR_SIZE || len % SESSION_SECTOR_SIZE || offset + len > f->size) {
+        return -1;
+    }
+    for (uint32_t s = offset / SESSION_SECTOR_SIZE; s < (offset + len) / SESSION_SECTOR_SIZE; s++) {
+        f->erases[s]++;
+        if (f->budget >= 0 && f->budget < SESSION_SECTOR_SIZE) {
+            // Cut short: the start of the sector is erased, the rest keeps
+            // its old contents or comes out as noise
+            uint8_t *p = f->data + s * SESSION_SECTOR_SIZE;
+            memset(p, 0xFF, f->budget);
+            if (rand() & 1) {
+                for (int i = f->budget; i < SESSION_SECTOR_SIZE; i++) {
+                    p[i] |= (uint8_t)rand();
+                }
+            }
+            f->budget = 0;
+            return -1;
+        }
+        if (f->budget > 0) {
+            f->budget -= SESSION_SECTOR_SIZE;
+        }
+        memset(f->data + s * SESSION_SECTOR_SIZE, 0xFF, SESSION_SECTOR_SIZE);
+    }
+    return 0;
+}
+
+typedef struct {
+    uint32_t count;
+    uint32_t last_seq;
+    uint32_t from, to;
+} check_t;
+
+static bool check_record(const session_record_t *r, void *arg)
+{
+    check_t *c = arg;
+    if (r->seq <= c->last_seq) {
+        fail("sequence goes backwards", r->seq);
+    }
+    if (r->seq >= shadow_len || shadow[r->seq].start_unix != r->start_unix || shadow[r->seq].run_s != r->run_s) {
+        fail("record differs from what was written", r->seq);
+    }
+    if ((c->from || c->to) && (!r->start_unix || r->start_unix < c->from || r->start_unix > c->to)) {
+        fail("query returned a record outside its range", r->seq);
+    }
+    c->last_seq = r->seq;
+    c->count++;
+    return true;
+}
+
+// The answer without the index: every page, filtered here
+static bool scan_record(const session_record_t *r, void *arg)
+{
+    check_t *c = arg;
+    if (r->start_unix && r->start_unix >= c->from && r->start_unix <= c->to) {
+        c->count++;
+    }
+    return true;
+}
+
+static void verify(session_log_t *log)
+{
+    check_t c = {0};
+    if (session_log_query(log, 0, 0, 0, check_record, &c) < 0) {
+        fail("query failed", 0);
+    }
+    if (c.count != log->records) {
+        fail("index record count differs from the log", c.count);
+    }
+    if (c.count && c.last_seq != log->next_seq - 1) {
+        fail("newest record is not next_seq - 1", c.last_seq);
+    }
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    return *(const uint32_t *)a < *(const uint32_t *)b ? -1 : *(const uint32_t *)a > *(const uint32_t *)b;
+}
+
+// Append, and note what each record was numbered so verify() can check it.
+// A torn append still numbers records; the ones that made it to flash whole
+// are valid and the rest are reused after the next mount.
+static int append(session_log_t *log, session_record_t *records, int count)
+{
+    int err = session_log_append(log, records, count);
+    for (int k = 0; k < count; k++) {
+        if (records[k].seq < shadow_len) {
+            shadow[records[k].seq] = (shadow_t){ records[k].start_unix, records[k].run_s };
+        }
+    }
+    return err;
+}
+
+typedef struct {
+    double us;
+    unsigned long pages;
+    unsigned long found;
+} lookup_t;
+
+static void lookup(session_log_t *log, uint32_t from, uint32_t to, uint32_t after, lookup_t *out)
+{
+    check_t c = { .from = from, .to = to };
+    uint32_t pages = log->pages_read;
+    double start = now_us();
+    session_log_query(log, from, to, after, check_record, &c);
+    out->us += now_us() - start;
+    out->pages += log->pages_read - pages;
+    out->found += c.count;
+}
+
+static unsigned long sessions, written, appends, lost_ram, lost_torn, cuts, torn, restarts, mounts, bad_seen;
+
+static void remount(session_log_t *log, const session_flash_t *flash)
+{
+    if (session_log_mount(log, flash)) {
+        fail("mount failed", 0);
+    }
+    mounts++;
+    bad_seen += log->bad;
+    verify(log);
+}
+
+// Write what is pending. Returns true when the power went during the write.
+static bool flush(session_log_t *log, sim_flash_t *sim, session_record_t *pending, int *npending)
+{
+    if (!*npending) {
+        return false;
+    }
+    appends++;
+    int err = append(log, pending, *npending);
+    if (err && sim->budget == 0) {
+        sim->budget = -1;
+        torn++;
+        lost_torn += *npending;
+        *npending = 0;
+        return true;
+    }
+    if (err) {
+        fail("append failed", 0);
+    }
+    written += *npending;
+    *npending = 0;
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    int days = argc > 1 ? atoi(argv[1]) : 365;
+    int per_day = argc > 2 ? atoi(argv[2]) : 12;
+    uint32_t kb = argc > 3 ? atoi(argv[3]) : 128;
+    srand(argc > 4 ? atoi(argv[4]) : 1);
+    if (days < 1 || per_day < 1 || per_day > 64) {
+        fprintf(stderr, "usage: %s [days] [sessions-per-day 1..64] [partition-KB] [seed]\n", argv[0]);
+        return 1;
+    }
+
+    sim_flash_t sim = { .size = kb * 1024, .budget = -1 };
+    int sectors = sim.size / SESSION_SECTOR_SIZE;
+    sim.data = malloc(sim.size);
+    sim.erases = calloc(sectors, sizeof(uint32_t));
+    memset(sim.data, 0xFF, sim.size);
+    session_flash_t flash = { &sim, sim.size, sim_read, sim_write, sim_erase };
+
+    shadow_len = (uint32_t)days * per_day * 2 + 16;
+    shadow = calloc(shadow_len, sizeof(shadow_t));
+
+    static session_log_t log;
+    mounts = 1;
+    if (session_log_mount(&log, &flash)) {
+        fprintf(stderr, "Cannot mount %u KB (2..%d sectors of %d)\n", kb, SESSION_MAX_SECTORS, SESSION_SECTOR_SIZE);
+        return 1;
+    }
+
+    session_record_t pending[SESSION_PENDING_MAX];
+    int npending = 0;
+    uint32_t pending_since = 0;
+
+    for (int day = 0; day < days; day++) {
+        uint32_t day_start = SIM_START_UNIX + day * DAY_S;
+        uint32_t ends[2 * 64];
+        int n = per_day / 2 + rand() % (per_day + 1);
+        for (int i = 0; i < n; i++) {
+            ends[i] = day_start + 7 * 3600 + rand() % (15 * 3600);
+        }
+        qsort(ends, n, sizeof(ends[0]), cmp_u32);
+        uint32_t cut_at = 0;
+        if ((double)rand() / RAND_MAX < CUT_CHANCE) {
+            if ((double)rand() / RAND_MAX < TORN_CHANCE) {
+                // The power goes a few bytes into the next write or erase
+                sim.budget = rand() % (SESSION_PAGE_SIZE + SESSION_SECTOR_SIZE / 8);
+            } else {
+                cut_at = day_start + rand() % DAY_S;
+            }
+        }
+
+        for (int i = 0; i <= n; i++) {
+            uint32_t t = i < n ? ends[i] : day_start + DAY_S;
+            uint32_t due = pending_since + SESSION_FLUSH_MS / 1000;
+            // The writer task's timeout, if it comes before this event
+            if (npending && due <= t && (!cut_at || due < cut_at) && flush(&log, &sim, pending, &npending)) {
+                cuts++;
+                remount(&log, &flash);
+            }
+            if (cut_at && cut_at <= t) {
+                cuts++;
+                lost_ram += npending;
+                npending = 0;
+                remount(&log, &flash);
+                cut_at = 0;
+            }
+            if (i == n) {
+                break;
+            }
+
+            uint32_t run = 60 + rand() % 3600;
+            session_record_t r;
+            memset(&r, 0, sizeof(r));
+            memset(r.reserved, 0xFF, sizeof(r.reserved));
+            r.seq = UINT32_MAX;
+            r.start_unix = rand() % 10 ? ends[i] - run : 0;     // some start before SNTP has synced
+            r.uptime_s = ends[i] - day_start;
+            r.boot = log.boot;
+            r.end = rand() % 4 ? SESSION_END_COMPLETED : SESSION_END_STOPPED;
+            r.flags = SESSION_FLAG_COUNTDOWN | (r.start_unix ? SESSION_FLAG_CLOCK : 0);
+            r.planned_s = run;
+            r.run_s = run;
+            snprintf(r.name, sizeof(r.name), "timer%d", i);
+            if (npending == 0) {
+                pending_since = ends[i];
+            }
+            pending[npending++] = r;
+            sessions++;
+
+            if (npending >= session_log_page_room(&log) && flush(&log, &sim, pending, &npending)) {
+                cuts++;
+                remount(&log, &flash);
+            }
+        }
+
+        if ((day + 1) % RESTART_DAYS == 0) {
+            // Planned restart: the shutdown handler writes what is pending
+            restarts++;
+            if (flush(&log, &sim, pending, &npending)) {
+                cuts++;
+            }
+            remount(&log, &flash);
+        }
+    }
+    mounts--;   // the final one below is for timing
+
+    double mount_us = now_us();
+    session_log_mount(&log, &flash);
+    mount_us = now_us() - mount_us;
+    unsigned long mount_pages = log.pages_read;
+    verify(&log);
+
+    printf("%d days, %lu sessions, %u KB log (%d sectors, %d records)\n",
+           days, sessions, kb, sectors, sectors * SESSION_RECORDS_PER_SECTOR);
+    printf("written   %lu records in %lu appends, %lu page writes (%.2f records per page)\n",
+           written, appends, sim.pages_written, sim.pages_written ? (double)written / sim.pages_written : 0);
+    printf("lost      %lu in RAM at %lu power cuts, %lu in %lu torn writes; %lu bad slots seen\n",
+           lost_ram, cuts, lost_torn, torn, bad_seen);
+    printf("mounts    %lu (%lu restarts), all verified; now %u records, seq up to %u, boot %u\n",
+           mounts, restarts, log.records, log.next_seq - 1, log.boot);
+
+    uint32_t min_e = UINT32_MAX, max_e = 0;
+    unsigned long total_e = 0;
+    for (int s = 0; s < sectors; s++) {
+        min_e = sim.erases[s] < min_e ? sim.erases[s] : min_e;
+        max_e = sim.erases[s] > max_e ? sim.erases[s] : max_e;
+        total_e += sim.erases[s];
+    }
+    double per_year = max_e * 365.0 / days;
+    printf("wear      erases per sector min %u avg %.1f max %u; %.1f/year on the busiest sector",
+           min_e, (double)total_e / sectors, max_e, per_year);
+    if (per_year > 0) {
+        printf(", %.0f years to %d cycles\n", ENDURANCE / per_year, ENDURANCE);
+    } else {
+        printf(", no sector erased yet\n");
+    }
+
+    // Lookups over the days still in the log
+    uint32_t oldest = UINT32_MAX, newest = 0;
+    for (int s = 0; s < log.sectors; s++) {
+        if (log.index[s].max_unix) {
+            oldest = log.index[s].min_unix < oldest ? log.index[s].min_unix : oldest;
+            newest = log.index[s].max_unix > newest ? log.index[s].max_unix : newest;
+        }
+    }
+    int queries = 200;
+    lookup_t day_q = {0}, recent_q = {0}, all_q = {0};
+    double scan_us = 0;
+    unsigned long scan_pages = 0;
+    for (int q = 0; q < queries && newest; q++) {
+        uint32_t from = oldest + (uint32_t)((double)rand() / RAND_MAX * (newest - oldest));
+        from -= (from - SIM_START_UNIX) % DAY_S;
+        unsigned long found = day_q.found;
+        lookup(&log, from, from + DAY_S - 1, 0, &day_q);
+
+        check_t c = { .from = from, .to = from + DAY_S - 1 };
+        uint32_t pages = log.pages_read;
+        double start = now_us();
+        session_log_query(&log, 0, 0, 0, scan_record, &c);
+        scan_us += now_us() - start;
+        scan_pages += log.pages_read - pages;
+        if (c.count != day_q.found - found) {
+            fail("indexed and full-scan answers differ", from);
+        }
+        lookup(&log, 0, 0, log.next_seq > 10 ? log.next_seq - 11 : 0, &recent_q);
+    }
+    lookup(&log, 0, 0, 0, &all_q);
+
+    printf("mount     %lu pages, %.0f us\n", mount_pages, mount_us);
+    printf("lookup    %-14s %7s %10s %10s\n", "", "pages", "us", "records");
+    printf("          %-14s %7.1f %10.1f %10.1f\n", "one day", (double)day_q.pages / queries,
+           day_q.us / queries, (double)day_q.found / queries);
+    printf("          %-14s %7.1f %10.1f %10.1f\n", "  full scan", (double)scan_pages / queries,
+           scan_us / queries, (double)day_q.found / queries);
+    printf("          %-14s %7.1f %10.1f %10.1f\n", "last 10", (double)recent_q.pages / queries,
+           recent_q.us / queries, (double)recent_q.found / queries);
+    printf("          %-14s %7lu %10.1f %10lu\n", "everything", all_q.pages, all_q.us, all_q.found);
+    return 0;
+}
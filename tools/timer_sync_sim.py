@@ -0,0 +1,371 @@
+#!/usr/bin/env python3
+"""Simulate a cluster of rings running the timer sync protocol on one host.
+
+Each node is a separate process speaking the wire format of
+main/include/timer_sync.h: beacons and timer states multicast on
+239.255.42.11:4211, NTP-style pings to the master, the master chosen as
+the established node with the lowest id. Every node has its own clock,
+offset by up to --max-offset-s and running fast or slow by up to
+--max-drift-ppm, and its packets can be delayed, jittered and dropped.
+
+    python tools/timer_sync_sim.py --cluster 4
+    python tools/timer_sync_sim.py --cluster 5 --delay-ms 3 --jitter-ms 20 --loss 0.05 -d 60
+    python tools/timer_sync_sim.py --cluster 4 --start-after 8 --kill-master-after 20
+
+With --cluster N the processes run on 127.0.0.2 and up and report twice a
+second; the parent prints, per second, how far apart the nodes' shared
+clocks are and how far apart their ends of the running countdown are, then the
+time to converge and the spread percentiles after that. --start-after
+starts a countdown on the last node; --kill-master-after stops the master
+to check that another node takes over without the shared time jumping.
+
+A single node can also join real rings on the LAN, to watch the protocol
+or start a timer on all of them:
+
+    python tools/timer_sync_sim.py --bind 192.168.1.20 --start 300
+"""
+
+import argparse
+import heapq
+import json
+import os
+import random
+import select
+import socket
+import struct
+import subprocess
+import sys
+import time
+
+PORT = 4211
+GROUP = "239.255.42.11"
+MAGIC = 0x5354
+VERSION = 1
+BEACON, PING, PONG, STATE = 1, 2, 3, 4
+FLAG_ESTABLISHED = 0x01
+
+BEACON_MS = 1000
+PING_MS = 1000
+FAST_PING_MS = 250
+LISTEN_MS = 2500
+PEER_TTL_MS = 5000
+FILTER = 8
+MAX_ERROR_US = 10000
+
+HEADER = struct.Struct("<HBBIIB")
+STATE_FMT = struct.Struct("<qIBBBB3s3s3sBIqq16s")
+PONG_FMT = struct.Struct("<Iqqq")
+PING_FMT = struct.Struct("<q")
+
+EMPTY_STATE = dict(stamp_us=0, stamp_node=0, active=0, countdown=0, paused=0, use_end_color=1,
+                   primary=b"\x00\x00\xff", end=b"\xff\x00\x00", segment=b"\xff\xd7\x00",
+                   segments=4, total_s=0, start_us=0, paused_us=0, name=b"")
+STATE_KEYS = list(EMPTY_STATE)
+
+
+class Node:
+    def __init__(self, args):
+        self.id = args.node_id or random.randrange(1, 0xFFFFFFFF)
+        self.offset_us = args.offset_us
+        self.drift = args.drift_ppm / 1e6
+        self.delay_s = args.delay_ms / 1000
+        self.jitter_s = args.jitter_ms / 1000
+        self.loss = args.loss
+        self.t0 = time.monotonic()
+
+        self.ucast = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.ucast.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.ucast.bind((args.bind, PORT))
+        self.ucast.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(args.bind))
+        self.ucast.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+        self.mcast = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.mcast.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        if hasattr(socket, "SO_REUSEPORT"):
+            self.mcast.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+        self.mcast.bind((GROUP, PORT))
+        self.mcast.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP,
+                              socket.inet_aton(GROUP) + socket.inet_aton(args.bind))
+
+        self.boot_us = self.local_us()
+        self.established = False
+        self.master = 0
+        self.master_addr = None
+        self.shared_offset = 0              # shared = local + shared_offset
+        self.peers = {}                     # id -> dict(addr, master, flags, last_us)
+        self.samples = []
+        self.error_us = -1
+        self.state = dict(EMPTY_STATE)
+        self.outbox = []                    # (due, seq, packet, addr)
+        self.sent = 0
+        self.log = []
+
+    def local_us(self):
+        return int((time.monotonic() - self.t0) * 1e6 * (1 + self.drift)) + self.offset_us
+
+    def shared_us(self):
+        return self.local_us() + self.shared_offset
+
+    def send(self, kind, payload, addr):
+        if random.random() < self.loss:
+            return
+        header = HEADER.pack(MAGIC, VERSION, kind, self.id, self.master,
+                             FLAG_ESTABLISHED if self.established else 0)
+        due = time.monotonic() + self.delay_s + random.uniform(0, self.jitter_s)
+        self.sent += 1
+        heapq.heappush(self.outbox, (due, self.sent, header + payload, addr))
+
+    def flush(self):
+        while self.outbox and self.outbox[0][0] <= time.monotonic():
+            _, _, packet, addr = heapq.heappop(self.outbox)
+            self.ucast.sendto(packet, addr)
+
+    def pack_state(self):
+        return STATE_FMT.pack(*(self.state[k] for k in STATE_KEYS))
+
+    def publish(self, **changes):
+        self.state.update(changes)
+        self.state["stamp_us"] = self.shared_us()
+        self.state["stamp_node"] = self.id
+        self.send(STATE, self.pack_state(), (GROUP, PORT))
+
+    def start_timer(self, seconds, name=b"sim_timer"):
+        self.publish(active=1, countdown=1, paused=0, total_s=seconds, start_us=self.shared_us(), name=name)
+
+    def remaining_ms(self):
+        s = self.state
+        if not s["active"]:
+            return None
+        now = s["paused_us"] if s["paused"] else self.shared_us()
+        return s["total_s"] * 1000 - (now - s["start_us"]) / 1000
+
+    def elect(self, now):
+        alive = {n: p for n, p in self.peers.items()
+                 if now - p["last_us"] <= PEER_TTL_MS * 1000 and p["flags"] & FLAG_ESTABLISHED}
+        candidates = list(alive) + ([self.id] if self.established else [])
+        if not self.established and not alive and now - self.boot_us >= LISTEN_MS * 1000:
+            self.established = True
+            candidates = [self.id]
+        master = min(candidates) if candidates else 0
+        if master != self.master:
+            # As in the C task: a follower keeps its offset across a failover
+            failover = (self.established and self.master not in (0, self.id) and master not in (0, self.id)
+                        and self.error_us >= 0)
+            if self.master == self.id and master != self.id:
+                self.established = False
+            self.master = master
+            self.samples = [(self.error_us * 2, self.shared_offset, True)] if failover else []
+            self.error_us = 0 if master == self.id else (self.error_us if failover else -1)
+            self.log.append("master %08x" % master)
+        self.master_addr = alive[master]["addr"] if master in alive else None
+
+    def on_pong(self, node, t1, t2, t3, t4):
+        if node != self.master or self.master == self.id:
+            return
+        delay = max(0, (t4 - t1) - (t3 - t2))
+        offset = ((t2 - t1) + (t3 - t4)) // 2
+        # Drop the carried-over offset if the new master contradicts it
+        self.samples = [x for x in self.samples
+                        if not (x[2] and abs(offset - x[1]) > (delay + x[0]) // 2)]
+        self.samples = (self.samples + [(delay, offset, False)])[-FILTER:]
+        best_delay, best_offset, _ = min(self.samples)
+        self.shared_offset = best_offset
+        self.error_us = best_delay // 2
+        if not self.established and len(self.samples) >= FILTER // 2 and self.error_us <= MAX_ERROR_US:
+            self.established = True
+            self.log.append("synced to %08x within %d us" % (self.master, self.error_us))
+
+    def handle(self, data, addr):
+        now = self.local_us()
+        if len(data) < HEADER.size:
+            return
+        magic, version, kind, node, master, flags = HEADER.unpack_from(data)
+        if magic != MAGIC or version != VERSION or node in (0, self.id):
+            return
+        self.peers[node] = dict(addr=addr, master=master, flags=flags, last_us=now)
+        payload = data[HEADER.size:]
+        if kind in (BEACON, STATE) and len(payload) >= STATE_FMT.size:
+            state = dict(zip(STATE_KEYS, STATE_FMT.unpack_from(payload)))
+            if (state["stamp_us"] and self.established and flags & FLAG_ESTABLISHED and master == self.master and
+                    (state["stamp_us"], state["stamp_node"]) > (self.state["stamp_us"], self.state["stamp_node"])):
+                self.state = state
+        elif kind == PING and len(payload) >= PING_FMT.size and self.established:
+            (t1,) = PING_FMT.unpack_from(payload)
+            t2 = now + self.shared_offset
+            self.send(PONG, PONG_FMT.pack(node, t1, t2, self.shared_us()), (addr[0], PORT))
+        elif kind == PONG and len(payload) >= PONG_FMT.size:
+            requester, t1, t2, t3 = PONG_FMT.unpack_from(payload)
+            if requester == self.id:
+                self.on_pong(node, t1, t2, t3, now)
+
+    def run(self, duration, report, start_after, start_seconds):
+        next_beacon = next_ping = next_report = 0
+        started = time.monotonic()
+        timer_started = False
+        while duration <= 0 or time.monotonic() - started < duration:
+            timeout = 0.05
+            if self.outbox:
+                timeout = max(0.0, min(timeout, self.outbox[0][0] - time.monotonic()))
+            readable, _, _ = select.select([self.ucast, self.mcast], [], [], timeout)
+            for sock in readable:
+                data, addr = sock.recvfrom(256)
+                self.handle(data, addr)
+            now = self.local_us()
+            self.elect(now)
+            if now >= next_beacon:
+                self.send(BEACON, self.pack_state(), (GROUP, PORT))
+                next_beacon = now + BEACON_MS * 1000
+            if self.master and self.master != self.id and self.master_addr and now >= next_ping:
+                self.send(PING, PING_FMT.pack(self.local_us()), (self.master_addr[0], PORT))
+                next_ping = now + (FAST_PING_MS if len(self.samples) < FILTER else PING_MS) * 1000
+            if start_seconds and not timer_started and time.monotonic() - started >= start_after and self.established:
+                self.start_timer(start_seconds)
+                self.log.append("started a %d s timer" % start_seconds)
+                timer_started = True
+            self.flush()
+            if time.monotonic() >= next_report:
+                report(self)
+                next_report = time.monotonic() + 0.5
+
+
+def report_json(node):
+    # Both in host time, so that reports taken at different moments compare
+    host_us = int(time.monotonic() * 1e6)
+    remaining = node.remaining_ms()
+    print(json.dumps({
+        "node": node.id, "master": node.master, "established": node.established, "error_us": node.error_us,
+        "base_minus_host_us": node.shared_us() - host_us, "log": node.log,
+        "end_host_us": None if remaining is None else host_us + int(remaining * 1000),
+    }), flush=True)
+    node.log = []
+
+
+def report_text(node):
+    for line in node.log:
+        print(line)
+    node.log = []
+    role = "listening" if not node.master else "master" if node.master == node.id else "follower"
+    remaining = node.remaining_ms()
+    print("%08x %-9s master %08x error %6d us peers %d timer %s" % (
+        node.id, role, node.master, node.error_us, len(node.peers),
+        "-" if remaining is None else "%.1f s" % (remaining / 1000)), flush=True)
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p / 100.0 * len(values)))]
+
+
+def run_cluster(args):
+    procs = {}
+    for i in range(args.cluster):
+        cmd = [sys.executable, os.path.abspath(__file__), "--child", "--bind", "127.0.0.%d" % (i + 2),
+               "--node-id", str(0x1000 + i * 0x10 + random.randrange(0x10)),
+               "--offset-us", str(random.randint(-args.max_offset_s * 10**6, args.max_offset_s * 10**6)),
+               "--drift-ppm", str(random.uniform(-args.max_drift_ppm, args.max_drift_ppm)),
+               "--delay-ms", str(args.delay_ms), "--jitter-ms", str(args.jitter_ms), "--loss", str(args.loss),
+               "-d", str(args.duration + 1)]
+        if i == args.cluster - 1 and args.start_after:
+            cmd += ["--start", str(args.timer_s), "--start-after", str(args.start_after)]
+        procs[i] = subprocess.Popen(cmd, stdout=subprocess.PIPE, text=True, bufsize=1)
+        time.sleep(args.stagger_s)
+
+    latest = {}
+    spreads, timer_spreads = [], []
+    converged_at = None
+    killed = False
+    started = time.monotonic()
+    next_print = started + 1
+    streams = {p.stdout.fileno(): p for p in procs.values()}
+    print("%5s %5s %7s %9s %12s  %s" % ("t s", "nodes", "synced", "spread ms", "timer end ms", "events"))
+    events = []
+    while time.monotonic() - started < args.duration:
+        readable, _, _ = select.select(list(streams), [], [], 0.1)
+        for fd in readable:
+            line = streams[fd].stdout.readline()
+            if not line:
+                del streams[fd]
+                continue
+            r = json.loads(line)
+            latest[r["node"]] = r
+            events += ["%04x: %s" % (r["node"], e) for e in r["log"]]
+        elapsed = time.monotonic() - started
+        if args.kill_master_after and not killed and elapsed >= args.kill_master_after and latest:
+            master = min(n for n, r in latest.items() if r["established"])
+            for p in procs.values():
+                if "%d" % master in p.args:
+                    p.kill()
+            latest.pop(master, None)
+            events.append("killed master %04x" % master)
+            killed = True
+        if time.monotonic() < next_print:
+            continue
+        next_print += 1
+        nodes = list(latest.values())
+        synced = [r for r in nodes if r["established"]]
+        spread = None
+        if len(synced) > 1:
+            bases = [r["base_minus_host_us"] for r in synced]
+            spread = (max(bases) - min(bases)) / 1000
+            if len(synced) == len(nodes) == len(procs) - killed:
+                spreads.append(spread)
+                if converged_at is None and spread < MAX_ERROR_US / 1000:
+                    converged_at = elapsed
+        ends = [r["end_host_us"] for r in synced if r["end_host_us"] is not None]
+        timer_spread = ""
+        if len(ends) > 1:
+            timer_spreads.append((max(ends) - min(ends)) / 1000)
+            timer_spread = "%.2f" % timer_spreads[-1]
+        print("%5.0f %5d %7d %9s %12s  %s" % (elapsed, len(nodes), len(synced),
+                                            "-" if spread is None else "%.2f" % spread, timer_spread,
+                                            "; ".join(events)))
+        events = []
+
+    for p in procs.values():
+        p.kill()
+    if converged_at is None:
+        print("did not converge below %.0f ms" % (MAX_ERROR_US / 1000))
+        return
+    after = [s for s in spreads if s is not None]
+    print("converged in %.0f s; shared clock spread p50 %.2f ms, p99 %.2f ms, max %.2f ms" % (
+        converged_at, percentile(after, 50), percentile(after, 99), max(after)))
+    if timer_spreads:
+        print("timer end spread p50 %.2f ms, max %.2f ms" % (percentile(timer_spreads, 50), max(timer_spreads)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cluster", type=int, help="run this many nodes on 127.0.0.x and compare them")
+    parser.add_argument("-d", "--duration", type=float, default=30)
+    parser.add_argument("--bind", default="127.0.0.2", help="address of this node")
+    parser.add_argument("--node-id", type=int)
+    parser.add_argument("--offset-us", type=int, default=0)
+    parser.add_argument("--drift-ppm", type=float, default=0)
+    parser.add_argument("--max-offset-s", type=int, default=5)
+    parser.add_argument("--max-drift-ppm", type=float, default=50)
+    parser.add_argument("--delay-ms", type=float, default=1, help="one-way delay added to every packet")
+    parser.add_argument("--jitter-ms", type=float, default=5, help="up to this much more, at random")
+    parser.add_argument("--loss", type=float, default=0, help="probability of dropping a packet")
+    parser.add_argument("--stagger-s", type=float, default=0.3, help="cluster: time between node starts")
+    parser.add_argument("--start", type=int, help="start a countdown of this many seconds")
+    parser.add_argument("--start-after", type=float, default=0)
+    parser.add_argument("--timer-s", type=int, default=300, help="cluster: countdown length for --start-after")
+    parser.add_argument("--kill-master-after", type=float, help="cluster: stop the master after this many seconds")
+    parser.add_argument("--child", action="store_true", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.cluster:
+        run_cluster(args)
+        return
+    try:
+        node = Node(args)
+    except OSError as e:
+        sys.exit("cannot open the sync sockets on %s: %s" % (args.bind, e))
+    try:
+        node.run(args.duration if args.child else 0, report_json if args.child else report_text,
+                 args.start_after, args.start)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
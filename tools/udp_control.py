@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""Drive the timer over the binary UDP control protocol and benchmark it.
+
+Sends one command and prints the device's reply, or with "bench" fires a
+stream of acknowledged STATUS (or PAUSE/RESUME) packets and reports round
+trip latency and commands per second, optionally next to the same number of
+POST /api/pause requests over keep-alive HTTP for comparison.
+
+    python tools/udp_control.py 192.168.1.50 start 300 --primary 0,0,255
+    python tools/udp_control.py 192.168.1.50 add 60 --ack
+    python tools/udp_control.py 192.168.1.50 status
+    python tools/udp_control.py 192.168.1.50 bench -n 1000 --op pause --http
+
+The wire format mirrors main/include/udp_control.h: a 10-byte little-endian
+header (magic, version, opcode, seq, flags, len) and a fixed payload. Each
+run starts at a random sequence number so the device does not take it for a
+repeat of an earlier run; resends after a lost ack reuse the number, so a
+command is never applied twice.
+"""
+
+import argparse
+import random
+import socket
+import struct
+import sys
+import time
+
+from http_load import percentile
+from web_bench import connect, read_response
+
+PORT = 4210
+MAGIC = 0x544C
+VERSION = 1
+HEADER = struct.Struct("<HBBIBB")
+REPLY = struct.Struct("<BBBBiI")
+APPEARANCE = struct.Struct("<3B3B3BBB")
+START = struct.Struct("<IB")
+
+OPS = {"start": 1, "pause": 2, "resume": 3, "stop": 4, "add": 5, "settings": 6, "status": 7}
+OP_REPLY = 0x80
+FLAG_ACK = 0x01
+FLAG_DUPLICATE = 0x02
+START_COUNTUP = 0x01
+START_APPEARANCE = 0x02
+RESULTS = {0: "ok", 1: "bad request", 2: "unsupported"}
+
+
+class Client:
+    def __init__(self, host, port=PORT, timeout=0.5, retries=3):
+        self.addr = (socket.gethostbyname(host), port)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.settimeout(timeout)
+        self.retries = retries
+        self.seq = random.getrandbits(32)
+        self.resends = 0
+
+    def send(self, op, payload=b"", ack=True):
+        """Send one command; returns (reply dict, seconds) or None without ack."""
+        self.seq = (self.seq + 1) & 0xFFFFFFFF
+        packet = HEADER.pack(MAGIC, VERSION, OPS[op], self.seq, FLAG_ACK if ack else 0, len(payload)) + payload
+        if not ack and op != "status":
+            self.sock.sendto(packet, self.addr)
+            return None
+        for attempt in range(self.retries + 1):
+            started = time.perf_counter()
+            self.sock.sendto(packet, self.addr)
+            reply = self._receive(started)
+            if reply:
+                return reply, time.perf_counter() - started
+            self.resends += 1
+        raise TimeoutError("no reply to %s seq %d" % (op, self.seq))
+
+    def _receive(self, started):
+        while True:
+            try:
+                data, _ = self.sock.recvfrom(64)
+            except socket.timeout:
+                return None
+            if len(data) < HEADER.size + REPLY.size:
+                continue
+            magic, version, opcode, seq, flags, length = HEADER.unpack_from(data)
+            if magic != MAGIC or not opcode & OP_REPLY or seq != self.seq:
+                continue    # a late reply to an earlier resend
+            result, active, paused, led_state, remaining, total = REPLY.unpack_from(data, HEADER.size)
+            return {
+                "result": RESULTS.get(result, result),
+                "duplicate": bool(flags & FLAG_DUPLICATE),
+                "active": bool(active),
+                "paused": bool(paused),
+                "led_state": led_state,
+                "remaining_s": remaining,
+                "total_s": total,
+            }
+
+
+def parse_rgb(text):
+    parts = [int(p) for p in text.split(",")]
+    if len(parts) != 3 or not all(0 <= p <= 255 for p in parts):
+        raise argparse.ArgumentTypeError("expected r,g,b with values 0-255")
+    return parts
+
+
+def appearance(args):
+    return APPEARANCE.pack(*args.primary, *args.end, *args.segment, args.segments, 0 if args.no_end_color else 1)
+
+
+def http_pause_bench(host, count):
+    times = []
+    with connect(host, 80) as sock:
+        for _ in range(count):
+            started = time.perf_counter()
+            sock.sendall(("POST /api/pause HTTP/1.1\r\nHost: %s\r\nContent-Length: 0\r\n\r\n" % host).encode())
+            read_response(sock, started)
+            times.append(time.perf_counter() - started)
+    return times
+
+
+def report(label, times, elapsed):
+    ms = [t * 1000 for t in times]
+    print("%-14s %6d %8.2f %8.2f %8.2f %8.2f %9.0f" % (
+        label, len(ms), percentile(ms, 50), percentile(ms, 95), percentile(ms, 99), max(ms), len(ms) / elapsed))
+
+
+def bench(client, args):
+    ops = ["pause", "resume"] if args.op == "pause" else [args.op]
+    times = []
+    started = time.perf_counter()
+    for i in range(args.count):
+        _, seconds = client.send(ops[i % len(ops)])
+        times.append(seconds)
+    elapsed = time.perf_counter() - started
+
+    print("%-14s %6s %8s %8s %8s %8s %9s" % ("transport", "count", "p50 ms", "p95 ms", "p99 ms", "max ms", "cmds/s"))
+    report("udp " + args.op, times, elapsed)
+    if client.resends:
+        print("  %d resends after a lost packet or reply" % client.resends)
+    if args.http:
+        started = time.perf_counter()
+        times = http_pause_bench(client.addr[0], args.count)
+        report("http pause", times, time.perf_counter() - started)
+        if args.count % 2:
+            http_pause_bench(client.addr[0], 1)     # leave the timer as it was
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device address, e.g. 192.168.1.50")
+    parser.add_argument("command", choices=sorted(OPS) + ["bench"])
+    parser.add_argument("seconds", type=int, nargs="?", help="for start and add")
+    parser.add_argument("--port", type=int, default=PORT)
+    parser.add_argument("--ack", action="store_true", help="wait for the reply (always for status and bench)")
+    parser.add_argument("--countup", action="store_true", help="start a count-up timer")
+    parser.add_argument("--primary", type=parse_rgb, help="r,g,b; start sends the appearance when given")
+    parser.add_argument("--end", type=parse_rgb, default=[255, 0, 0])
+    parser.add_argument("--segment", type=parse_rgb, default=[255, 215, 0])
+    parser.add_argument("--segments", type=int, default=4)
+    parser.add_argument("--no-end-color", action="store_true")
+    parser.add_argument("-n", "--count", type=int, default=500, help="bench: commands to send")
+    parser.add_argument("--op", choices=["status", "pause"], default="status",
+                        help="bench: status, or pause (alternating pause/resume)")
+    parser.add_argument("--http", action="store_true", help="bench: also time POST /api/pause")
+    parser.add_argument("--timeout-ms", type=float, default=500)
+    args = parser.parse_args()
+
+    client = Client(args.host, args.port, args.timeout_ms / 1000)
+    try:
+        if args.command == "bench":
+            bench(client, args)
+            return
+        payload = b""
+        if args.command in ("start", "add"):
+            if not args.seconds:
+                sys.exit("%s needs a number of seconds" % args.command)
+            payload = struct.pack("<I", args.seconds)
+        if args.command == "start":
+            flags = START_COUNTUP if args.countup else 0
+            if args.primary:
+                flags |= START_APPEARANCE
+            payload = START.pack(args.seconds, flags) + (appearance(args) if args.primary else b"")
+        elif args.command == "settings":
+            if not args.primary:
+                sys.exit("settings needs at least --primary")
+            payload = appearance(args)
+        reply = client.send(args.command, payload, args.ack or args.command == "status")
+    except (OSError, TimeoutError) as e:
+        sys.exit(str(e))
+    if reply:
+        state, seconds = reply
+        print("%s in %.1f ms: %s" % (args.command, seconds * 1000,
+                                     ", ".join("%s=%s" % item for item in state.items())))
+
+
+if __name__ == "__main__":
+    main()
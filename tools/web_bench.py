@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Measure what loading the web UI costs on the wire.
+
+Each round opens a fresh connection, as a browser does on a new visit, and
+times three loads:
+
+    cold         GET / with no cached copy
+    revalidate   GET / with If-None-Match from the cold load (304 if ETags work)
+    interactive  GET / then GET /api/settings on the same connection, which is
+                 what the page does before its controls are filled in
+
+For each it reports bytes on the wire (status line, headers and body as
+received), time to first byte and total time, as medians over the rounds.
+Run it against the old and the new firmware to compare; --csv appends the
+results with a label so several runs end up in one file.
+
+    python tools/web_bench.py http://192.168.1.50
+    python tools/web_bench.py http://192.168.1.50 -n 50 --label gzip --csv web.csv
+"""
+
+import argparse
+import csv
+import socket
+import statistics
+import sys
+import time
+import urllib.parse
+
+
+def read_response(sock, started):
+    """Read one HTTP/1.1 response; returns (status, headers, wire_bytes, ttfb, total)."""
+    data = b""
+    ttfb = None
+    while b"\r\n\r\n" not in data:
+        chunk = sock.recv(4096)
+        if not chunk:
+            raise ConnectionError("connection closed in the headers")
+        if ttfb is None:
+            ttfb = time.perf_counter() - started
+        data += chunk
+    head, body = data.split(b"\r\n\r\n", 1)
+    lines = head.decode("latin-1").split("\r\n")
+    status = int(lines[0].split()[1])
+    headers = {}
+    for line in lines[1:]:
+        name, _, value = line.partition(":")
+        headers[name.strip().lower()] = value.strip()
+
+    length = int(headers.get("content-length", "0"))
+    if headers.get("transfer-encoding", "").lower() == "chunked":
+        # Read until the terminating zero-length chunk
+        while not body.endswith(b"0\r\n\r\n"):
+            chunk = sock.recv(4096)
+            if not chunk:
+                break
+            body += chunk
+        length = len(body)
+    while len(body) < length:
+        chunk = sock.recv(4096)
+        if not chunk:
+            break
+        body += chunk
+    total = time.perf_counter() - started
+    return status, headers, len(head) + 4 + len(body), ttfb, total
+
+
+def request(sock, host, path, extra=""):
+    req = ("GET %s HTTP/1.1\r\nHost: %s\r\nAccept: */*\r\nAccept-Encoding: gzip, deflate\r\n"
+           "%s\r\n" % (path, host, extra))
+    started = time.perf_counter()
+    sock.sendall(req.encode())
+    return read_response(sock, started)
+
+
+def connect(host, port):
+    sock = socket.create_connection((host, port), timeout=10)
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    return sock
+
+
+def one_round(host, port, etag):
+    results = {}
+    with connect(host, port) as sock:
+        started = time.perf_counter()
+        status, headers, wire, ttfb, _ = request(sock, host, "/")
+        results["cold"] = (status, wire, ttfb, time.perf_counter() - started)
+        etag = headers.get("etag", etag)
+        encoding = headers.get("content-encoding", "identity")
+
+    with connect(host, port) as sock:
+        extra = "If-None-Match: %s\r\n" % etag if etag else ""
+        started = time.perf_counter()
+        status, _, wire, ttfb, _ = request(sock, host, "/", extra)
+        results["revalidate"] = (status, wire, ttfb, time.perf_counter() - started)
+
+    with connect(host, port) as sock:
+        started = time.perf_counter()
+        status, _, wire1, ttfb, _ = request(sock, host, "/")
+        status2, _, wire2, _, _ = request(sock, host, "/api/settings")
+        results["interactive"] = (status2, wire1 + wire2, ttfb, time.perf_counter() - started)
+    return results, etag, encoding
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("url", help="device base URL, e.g. http://192.168.1.50")
+    parser.add_argument("-n", "--rounds", type=int, default=20)
+    parser.add_argument("--label", default="", help="name for this firmware in --csv")
+    parser.add_argument("--csv", help="append the medians to this CSV file")
+    args = parser.parse_args()
+
+    url = urllib.parse.urlparse(args.url)
+    host, port = url.hostname, url.port or 80
+    samples = {"cold": [], "revalidate": [], "interactive": []}
+    etag, encoding = None, None
+    for _ in range(args.rounds):
+        try:
+            results, etag, encoding = one_round(host, port, etag)
+        except (OSError, ValueError) as e:
+            print("round failed: %s" % e, file=sys.stderr)
+            continue
+        for kind, value in results.items():
+            samples[kind].append(value)
+    if not samples["cold"]:
+        sys.exit("no successful rounds")
+
+    print("%s, %d rounds, Content-Encoding %s, ETag %s" % (args.url, len(samples["cold"]), encoding, etag or "none"))
+    print("%-12s %6s %10s %9s %9s" % ("load", "status", "wire B", "ttfb ms", "total ms"))
+    rows = []
+    for kind, values in samples.items():
+        status = values[-1][0]
+        wire = statistics.median(v[1] for v in values)
+        ttfb = statistics.median(v[2] for v in values) * 1000
+        total = statistics.median(v[3] for v in values) * 1000
+        print("%-12s %6d %10.0f %9.1f %9.1f" % (kind, status, wire, ttfb, total))
+        rows.append([args.label, kind, status, int(wire), round(ttfb, 1), round(total, 1)])
+
+    if args.csv:
+        with open(args.csv, "a", newline="") as f:
+            writer = csv.writer(f)
+            if f.tell() == 0:
+                writer.writerow(["label", "load", "status", "wire_bytes", "ttfb_ms", "total_ms"])
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()